@@ -25,6 +25,7 @@
 
 #include <autoware_auto_common/common/types.hpp>
 
+#include <iterator>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -98,10 +99,12 @@ public:
   explicit SpatialHashBase(const ConfigT & cfg)
   : m_config{cfg},
     m_hash(),
-    m_neighbors{},  // TODO(c.ho) reserve, but there's no default constructor for output
-    m_bins_hit{},   // zero initialization (and below)
+    m_neighbors{},
+    m_bins_hit{},  // zero initialization (and below)
     m_neighbors_found{}
   {
+    // the buckets are allocated once so that inserting up to the capacity does not rehash
+    m_hash.reserve(m_config.get_capacity());
   }
 
   /// \brief Inserts point
@@ -198,6 +201,27 @@ protected:
   {
     // reset output
     m_neighbors.clear();
+    // update book-keeping
+    m_bins_hit += near_impl(x, y, z, radius, m_neighbors);
+    m_neighbors_found += m_neighbors.size();
+    return m_neighbors;
+  }
+
+  /// \brief Finds all points within a fixed radius of a reference point without modifying the
+  ///        data structure, so that it can be called concurrently with other const methods
+  /// \param[in] x The x component of the reference point
+  /// \param[in] y The y component of the reference point
+  /// \param[in] z The z component of the reference point, respected only if the spatial hash is not
+  ///              2D.
+  /// \param[in] radius The radius within which to find all near points
+  /// \param[out] neighbors The vector to which the iterators pointing to all points within the
+  ///                       radius, and the actual distance to the reference point are appended
+  /// \return The number of bins touched during the query
+  Index near_impl(
+    const float32_t x, const float32_t y, const float32_t z, const float32_t radius,
+    OutputVector & neighbors) const
+  {
+    Index bins_hit{};
     // Compute bin, bin range
     const Index3 ref_idx = m_config.index3(x, y, z);
     const float32_t radius2 = radius * radius;
@@ -205,8 +229,7 @@ protected:
     Index3 idx = idx_range.first;
     // For bins in radius
     do {  // guaranteed to have at least the bin ref_idx is in
-      // update book-keeping
-      ++m_bins_hit;
+      ++bins_hit;
       // Iterating in a square/cube pattern is easier than constructing sphere pattern
       if (m_config.is_candidate_bin(ref_idx, idx, radius2)) {
         // For point in bin
@@ -217,14 +240,37 @@ protected:
           const float32_t dist2 = m_config.distance_squared(x, y, z, pt);
           if (dist2 <= radius2) {
             // Only compute true distance if necessary
-            m_neighbors.emplace_back(it, sqrtf(dist2));
+            neighbors.emplace_back(it, sqrtf(dist2));
           }
         }
       }
     } while (m_config.next_bin(idx_range, idx));
-    // update book-keeping
-    m_neighbors_found += m_neighbors.size();
-    return m_neighbors;
+    return bins_hit;
+  }
+
+  /// \brief Finds all points within a fixed radius of each reference point without modifying the
+  ///        data structure, so that it can be called concurrently with other const methods
+  /// \param[in] begin The start of the range of reference points
+  /// \param[in] end The end of the range of reference points
+  /// \param[in] radius The radius within which to find all near points
+  /// \param[in] is_3d Whether the z component of the reference points is respected
+  /// \param[out] neighbors The neighbors of each reference point in the order of the range. The
+  ///                       vectors are reused so that they do not allocate once they have seen the
+  ///                       largest result.
+  /// \tparam IteratorT The iterator type
+  template <typename IteratorT>
+  void near_impl(
+    IteratorT begin, IteratorT end, const float32_t radius, const bool8_t is_3d,
+    std::vector<OutputVector> & neighbors) const
+  {
+    neighbors.resize(static_cast<std::size_t>(std::distance(begin, end)));
+    auto neighbors_it = neighbors.begin();
+    for (IteratorT it = begin; it != end; ++it, ++neighbors_it) {
+      neighbors_it->clear();
+      (void)near_impl(
+        point_adapter::x_(*it), point_adapter::y_(*it), is_3d ? point_adapter::z_(*it) : 0.0F,
+        radius, *neighbors_it);
+    }
   }
 
 private:
@@ -283,6 +329,34 @@ public:
   {
     return near(point_adapter::x_(pt), point_adapter::y_(pt), radius);
   }
+
+  /// \brief Finds all points within a fixed radius of a reference point, which is safe to call
+  ///        concurrently since the book-keeping of the data structure is not updated
+  /// \param[in] pt The reference point. Only the x and y members are respected.
+  /// \param[in] radius The radius within which to find all near points
+  /// \param[out] neighbors The vector to which the iterators pointing to all points within the
+  ///                       radius, and the actual distance to the reference point are written
+  void near(const PointT & pt, const float32_t radius, OutputVector & neighbors) const
+  {
+    neighbors.clear();
+    (void)this->near_impl(point_adapter::x_(pt), point_adapter::y_(pt), 0.0F, radius, neighbors);
+  }
+
+  /// \brief Finds all points within a fixed radius of each reference point, which is safe to call
+  ///        concurrently since the book-keeping of the data structure is not updated
+  /// \param[in] begin The start of the range of reference points. Only the x and y members are
+  ///                  respected.
+  /// \param[in] end The end of the range of reference points
+  /// \param[in] radius The radius within which to find all near points
+  /// \param[out] neighbors The neighbors of each reference point in the order of the range
+  /// \tparam IteratorT The iterator type
+  template <typename IteratorT>
+  void near(
+    IteratorT begin, IteratorT end, const float32_t radius,
+    std::vector<OutputVector> & neighbors) const
+  {
+    this->near_impl(begin, end, radius, false, neighbors);
+  }
 };
 
 /// \brief Explicit specialization of SpatialHash for 3D configuration
@@ -318,6 +392,34 @@ public:
   {
     return near(point_adapter::x_(pt), point_adapter::y_(pt), point_adapter::z_(pt), radius);
   }
+
+  /// \brief Finds all points within a fixed radius of a reference point, which is safe to call
+  ///        concurrently since the book-keeping of the data structure is not updated
+  /// \param[in] pt The reference point.
+  /// \param[in] radius The radius within which to find all near points
+  /// \param[out] neighbors The vector to which the iterators pointing to all points within the
+  ///                       radius, and the actual distance to the reference point are written
+  void near(const PointT & pt, const float32_t radius, OutputVector & neighbors) const
+  {
+    neighbors.clear();
+    (void)this->near_impl(
+      point_adapter::x_(pt), point_adapter::y_(pt), point_adapter::z_(pt), radius, neighbors);
+  }
+
+  /// \brief Finds all points within a fixed radius of each reference point, which is safe to call
+  ///        concurrently since the book-keeping of the data structure is not updated
+  /// \param[in] begin The start of the range of reference points
+  /// \param[in] end The end of the range of reference points
+  /// \param[in] radius The radius within which to find all near points
+  /// \param[out] neighbors The neighbors of each reference point in the order of the range
+  /// \tparam IteratorT The iterator type
+  template <typename IteratorT>
+  void near(
+    IteratorT begin, IteratorT end, const float32_t radius,
+    std::vector<OutputVector> & neighbors) const
+  {
+    this->near_impl(begin, end, radius, true, neighbors);
+  }
 };
 
 template <typename T>
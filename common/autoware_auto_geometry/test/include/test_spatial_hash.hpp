@@ -225,6 +225,54 @@ TYPED_TEST(TypedSpatialHashTest, 3d)
   EXPECT_EQ(count, 0U);
 }
 
+// const and batched queries
+TYPED_TEST(TypedSpatialHashTest, ConstNear)
+{
+  using PointT = TypeParam;
+  const float32_t dr = 1.0F;
+  Config2d cfg{-10.0F, 10.0F, -10.0F, 10.0F, 1.0F, 1024U};
+  SpatialHash2d<PointT> hash{cfg};
+
+  // build concentric rings around origin
+  const uint32_t PTS_PER_RING = 10U;
+  const uint32_t NUM_RINGS = 3U;
+  this->add_points(hash, PTS_PER_RING, NUM_RINGS, dr);
+
+  std::vector<PointT> refs{};
+  for (uint32_t rdx = 0U; rdx < NUM_RINGS; ++rdx) {
+    PointT pt;
+    pt.x = static_cast<float32_t>(rdx);
+    pt.y = 0.5F;
+    pt.z = 0.0F;
+    refs.push_back(pt);
+  }
+  const float32_t r = 1.5F;
+  using OutputVector = typename SpatialHash2d<PointT>::OutputVector;
+  std::vector<OutputVector> batch_neighbors{};
+  hash.near(refs.begin(), refs.end(), r, batch_neighbors);
+  ASSERT_EQ(batch_neighbors.size(), refs.size());
+
+  const auto & const_hash = hash;
+  OutputVector neighbors{};
+  std::size_t expected_neighbors_found = 0U;
+  for (std::size_t idx = 0U; idx < refs.size(); ++idx) {
+    const_hash.near(refs[idx], r, neighbors);
+    // the same neighbors as the query updating the book-keeping
+    const auto & expected_neighbors = hash.near(refs[idx], r);
+    expected_neighbors_found += expected_neighbors.size();
+    ASSERT_EQ(neighbors.size(), expected_neighbors.size());
+    ASSERT_EQ(batch_neighbors[idx].size(), expected_neighbors.size());
+    for (std::size_t jdx = 0U; jdx < neighbors.size(); ++jdx) {
+      EXPECT_EQ(neighbors[jdx].get_iterator(), expected_neighbors[jdx].get_iterator());
+      EXPECT_EQ(batch_neighbors[idx][jdx].get_iterator(), expected_neighbors[jdx].get_iterator());
+      EXPECT_FLOAT_EQ(neighbors[jdx].get_distance(), expected_neighbors[jdx].get_distance());
+    }
+  }
+  // only the non-const queries are counted
+  EXPECT_GT(expected_neighbors_found, 0U);
+  EXPECT_EQ(hash.neighbors_found(), expected_neighbors_found);
+}
+
 /// edge cases
 TEST(SpatialHashConfig, BadCases)
 {
@@ -807,32 +807,21 @@ void calc_circle_line_list(
   const geometry_msgs::msg::Point center, const double radius,
   std::vector<geometry_msgs::msg::Point> & points, const int n)
 {
-  for (int i = 0; i < n; ++i) {
+  // NOTE: Each vertex is shared by two adjacent lines, so that it is calculated once.
+  geometry_msgs::msg::Point prev_point;
+  points.reserve(points.size() + 2 * n);
+  for (int i = 0; i <= n; ++i) {
+    const double angle = (static_cast<double>(i) / static_cast<double>(n)) * 2.0 * M_PI +
+                         M_PI / static_cast<double>(n);
     geometry_msgs::msg::Point point;
-    point.x = std::cos(
-                (static_cast<double>(i) / static_cast<double>(n)) * 2.0 * M_PI +
-                M_PI / static_cast<double>(n)) *
-                radius +
-              center.x;
-    point.y = std::sin(
-                (static_cast<double>(i) / static_cast<double>(n)) * 2.0 * M_PI +
-                M_PI / static_cast<double>(n)) *
-                radius +
-              center.y;
+    point.x = std::cos(angle) * radius + center.x;
+    point.y = std::sin(angle) * radius + center.y;
     point.z = center.z;
-    points.push_back(point);
-    point.x = std::cos(
-                (static_cast<double>(i + 1.0) / static_cast<double>(n)) * 2.0 * M_PI +
-                M_PI / static_cast<double>(n)) *
-                radius +
-              center.x;
-    point.y = std::sin(
-                (static_cast<double>(i + 1.0) / static_cast<double>(n)) * 2.0 * M_PI +
-                M_PI / static_cast<double>(n)) *
-                radius +
-              center.y;
-    point.z = center.z;
-    points.push_back(point);
+    if (0 < i) {
+      points.push_back(prev_point);
+      points.push_back(point);
+    }
+    prev_point = point;
   }
 }
 
@@ -922,18 +911,30 @@ void calc_path_line_list(
 {
   const int circle_line_num = is_simple ? 5 : 10;
 
-  for (int i = 0; i < static_cast<int>(paths.path.size()) - 1; ++i) {
-    geometry_msgs::msg::Point point;
-    point.x = paths.path.at(i).position.x;
-    point.y = paths.path.at(i).position.y;
-    point.z = paths.path.at(i).position.z;
-    points.push_back(point);
-    point.x = paths.path.at(i + 1).position.x;
-    point.y = paths.path.at(i + 1).position.y;
-    point.z = paths.path.at(i + 1).position.z;
+  // NOTE: The circle of the same radius is drawn at every path point, so that it is calculated
+  //       once around the origin and translated to each point.
+  const int segments_num = static_cast<int>(paths.path.size()) - 1;
+  if (segments_num < 1) {
+    return;
+  }
+  geometry_msgs::msg::Point origin;
+  std::vector<geometry_msgs::msg::Point> circle_points;
+  calc_circle_line_list(origin, 0.25, circle_points, circle_line_num);
+  const int circles_num = is_simple ? (segments_num + 1) / 2 : segments_num;
+  points.reserve(points.size() + 2 * segments_num + circles_num * circle_points.size());
+
+  for (int i = 0; i < segments_num; ++i) {
+    const auto & point = paths.path.at(i + 1).position;
+    points.push_back(paths.path.at(i).position);
     points.push_back(point);
     if (!is_simple || i % 2 == 0) {
-      calc_circle_line_list(point, 0.25, points, circle_line_num);
+      for (const auto & circle_point : circle_points) {
+        geometry_msgs::msg::Point p;
+        p.x = circle_point.x + point.x;
+        p.y = circle_point.y + point.y;
+        p.z = point.z;
+        points.push_back(p);
+      }
     }
   }
 }
@@ -71,6 +71,12 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
   update_id_map(msg);
 
   std::vector<visualization_msgs::msg::Marker::SharedPtr> markers;
+  // NOTE: There are at most 12 markers per object in addition to the markers per path.
+  size_t markers_num = 12 * msg->objects.size();
+  for (const auto & object : msg->objects) {
+    markers_num += 2 * object.kinematics.predicted_paths.size();
+  }
+  markers.reserve(markers_num);
 
   for (const auto & object : msg->objects) {
     // Get marker for shape
@@ -39,6 +39,9 @@ void cuda_check_error(const ::cudaError_t e, F && f, N && n)
 }
 }  // namespace cuda_utils
 
+// may be defined by the packages having the same check of their own
+#ifndef CHECK_CUDA_ERROR
 #define CHECK_CUDA_ERROR(e) (cuda_utils::cuda_check_error(e, __FILE__, __LINE__))
+#endif
 
 #endif  // CUDA_UTILS__CUDA_CHECK_ERROR_HPP_
@@ -0,0 +1,117 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CUDA_UTILS__CUDA_POINTCLOUD2_HPP_
+#define CUDA_UTILS__CUDA_POINTCLOUD2_HPP_
+
+#include "cuda_utils/cuda_check_error.hpp"
+#include "cuda_utils/cuda_unique_ptr.hpp"
+
+#include <rclcpp/type_adapter.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <std_msgs/msg/header.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace cuda_utils
+{
+/**
+ * @brief sensor_msgs::msg::PointCloud2 whose data is on the device
+ * @details published with the type adapter below, it is passed to the subscriptions in the same
+ * process without leaving the device, and the other subscriptions receive a PointCloud2 copied to
+ * the host. the data must be ready on the device, i.e. its stream synchronized, when published.
+ */
+struct CudaPointCloud2
+{
+  CudaPointCloud2() = default;
+  CudaPointCloud2(CudaPointCloud2 &&) = default;
+  CudaPointCloud2 & operator=(CudaPointCloud2 &&) = default;
+  CudaPointCloud2(const CudaPointCloud2 & other) { *this = other; }
+  CudaPointCloud2 & operator=(const CudaPointCloud2 & other)
+  {
+    if (this != &other) {
+      copyMetadata(other, *this);
+      data = other.data_size() > 0 ? make_unique<uint8_t[]>(other.data_size()) : nullptr;
+      if (data) {
+        CHECK_CUDA_ERROR(
+          ::cudaMemcpy(data.get(), other.data.get(), other.data_size(), cudaMemcpyDeviceToDevice));
+      }
+    }
+    return *this;
+  }
+
+  std::size_t data_size() const { return static_cast<std::size_t>(row_step) * height; }
+
+  template <typename SrcT, typename DstT>
+  static void copyMetadata(const SrcT & src, DstT & dst)
+  {
+    dst.header = src.header;
+    dst.height = src.height;
+    dst.width = src.width;
+    dst.fields = src.fields;
+    dst.is_bigendian = src.is_bigendian;
+    dst.point_step = src.point_step;
+    dst.row_step = src.row_step;
+    dst.is_dense = src.is_dense;
+  }
+
+  std_msgs::msg::Header header;
+  uint32_t height{0};
+  uint32_t width{0};
+  std::vector<sensor_msgs::msg::PointField> fields;
+  bool is_bigendian{false};
+  uint32_t point_step{0};
+  uint32_t row_step{0};
+  bool is_dense{false};
+  CudaUniquePtr<uint8_t[]> data{nullptr};  // row_step * height bytes
+};
+}  // namespace cuda_utils
+
+template <>
+struct rclcpp::TypeAdapter<cuda_utils::CudaPointCloud2, sensor_msgs::msg::PointCloud2>
+{
+  using is_specialized = std::true_type;
+  using custom_type = cuda_utils::CudaPointCloud2;
+  using ros_message_type = sensor_msgs::msg::PointCloud2;
+
+  static void convert_to_ros_message(const custom_type & source, ros_message_type & destination)
+  {
+    custom_type::copyMetadata(source, destination);
+    destination.data.resize(source.data_size());
+    if (!destination.data.empty()) {
+      CHECK_CUDA_ERROR(::cudaMemcpy(
+        destination.data.data(), source.data.get(), destination.data.size(),
+        cudaMemcpyDeviceToHost));
+    }
+  }
+
+  static void convert_to_custom(const ros_message_type & source, custom_type & destination)
+  {
+    custom_type::copyMetadata(source, destination);
+    destination.data =
+      source.data.empty() ? nullptr : cuda_utils::make_unique<uint8_t[]>(source.data.size());
+    if (destination.data) {
+      CHECK_CUDA_ERROR(::cudaMemcpy(
+        destination.data.get(), source.data.data(), source.data.size(), cudaMemcpyHostToDevice));
+    }
+  }
+};
+
+RCLCPP_USING_CUSTOM_TYPE_AS_ROS_MESSAGE_TYPE(
+  cuda_utils::CudaPointCloud2, sensor_msgs::msg::PointCloud2);
+
+#endif  // CUDA_UTILS__CUDA_POINTCLOUD2_HPP_
@@ -19,6 +19,14 @@
 #include <geometry_msgs/msg/point.hpp>
 #include <tier4_map_msgs/msg/map_projector_info.hpp>
 
+#include <memory>
+#include <vector>
+
+namespace lanelet
+{
+class Projector;
+}  // namespace lanelet
+
 namespace geography_utils
 {
 using MapProjectorInfo = tier4_map_msgs::msg::MapProjectorInfo;
@@ -28,6 +36,27 @@ using LocalPoint = geometry_msgs::msg::Point;
 LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo & projector_info);
 GeoPoint project_reverse(const LocalPoint & local_point, const MapProjectorInfo & projector_info);
 
+/**
+ * @brief projector of the map built once from the projector info, so that the points are projected
+ * without building the lanelet2 projector for each of them as project_forward() and
+ * project_reverse() do
+ */
+class MapProjector
+{
+public:
+  explicit MapProjector(const MapProjectorInfo & projector_info);
+  ~MapProjector();
+
+  LocalPoint forward(const GeoPoint & geo_point) const;
+  GeoPoint reverse(const LocalPoint & local_point) const;
+  std::vector<LocalPoint> forward(const std::vector<GeoPoint> & geo_points) const;
+  std::vector<GeoPoint> reverse(const std::vector<LocalPoint> & local_points) const;
+
+private:
+  MapProjectorInfo projector_info_;
+  std::unique_ptr<lanelet::Projector> projector_;
+};
+
 }  // namespace geography_utils
 
 #endif  // GEOGRAPHY_UTILS__PROJECTION_HPP_
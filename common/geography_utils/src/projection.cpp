@@ -17,6 +17,8 @@
 #include <geography_utils/projection.hpp>
 #include <lanelet2_extension/projection/mgrs_projector.hpp>
 
+#include <vector>
+
 namespace geography_utils
 {
 
@@ -31,13 +33,30 @@ Eigen::Vector3d to_basic_point_3d_pt(const LocalPoint src)
 
 LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo & projector_info)
 {
-  std::unique_ptr<lanelet::Projector> projector = get_lanelet2_projector(projector_info);
+  return MapProjector(projector_info).forward(geo_point);
+}
+
+GeoPoint project_reverse(const LocalPoint & local_point, const MapProjectorInfo & projector_info)
+{
+  return MapProjector(projector_info).reverse(local_point);
+}
+
+MapProjector::MapProjector(const MapProjectorInfo & projector_info)
+: projector_info_(projector_info), projector_(get_lanelet2_projector(projector_info))
+{
+}
+
+MapProjector::~MapProjector() = default;
+
+LocalPoint MapProjector::forward(const GeoPoint & geo_point) const
+{
   lanelet::GPSPoint position{geo_point.latitude, geo_point.longitude, geo_point.altitude};
 
   lanelet::BasicPoint3d projected_local_point;
-  if (projector_info.projector_type == MapProjectorInfo::MGRS) {
+  if (projector_info_.projector_type == MapProjectorInfo::MGRS) {
     const int mgrs_precision = 9;  // set precision as 100 micro meter
-    const auto mgrs_projector = dynamic_cast<lanelet::projection::MGRSProjector *>(projector.get());
+    const auto mgrs_projector =
+      dynamic_cast<const lanelet::projection::MGRSProjector *>(projector_.get());
 
     // project x and y using projector
     // note that the altitude is ignored in MGRS projection conventionally
@@ -46,12 +65,12 @@ LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo &
     // project x and y using projector
     // note that the original projector such as UTM projector does not compensate for the altitude
     // offset
-    projected_local_point = projector->forward(position);
+    projected_local_point = projector_->forward(position);
 
     // correct z based on the map origin
     // note that the converted altitude in local point is in the same vertical datum as the geo
     // point
-    projected_local_point.z() = geo_point.altitude - projector_info.map_origin.altitude;
+    projected_local_point.z() = geo_point.altitude - projector_info_.map_origin.altitude;
   }
 
   LocalPoint local_point;
@@ -62,27 +81,26 @@ LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo &
   return local_point;
 }
 
-GeoPoint project_reverse(const LocalPoint & local_point, const MapProjectorInfo & projector_info)
+GeoPoint MapProjector::reverse(const LocalPoint & local_point) const
 {
-  std::unique_ptr<lanelet::Projector> projector = get_lanelet2_projector(projector_info);
-
   lanelet::GPSPoint projected_gps_point;
-  if (projector_info.projector_type == MapProjectorInfo::MGRS) {
-    const auto mgrs_projector = dynamic_cast<lanelet::projection::MGRSProjector *>(projector.get());
+  if (projector_info_.projector_type == MapProjectorInfo::MGRS) {
+    const auto mgrs_projector =
+      dynamic_cast<const lanelet::projection::MGRSProjector *>(projector_.get());
     // project latitude and longitude using projector
     // note that the z is ignored in MGRS projection conventionally
     projected_gps_point =
-      mgrs_projector->reverse(to_basic_point_3d_pt(local_point), projector_info.mgrs_grid);
+      mgrs_projector->reverse(to_basic_point_3d_pt(local_point), projector_info_.mgrs_grid);
   } else {
     // project latitude and longitude using projector
     // note that the original projector such as UTM projector does not compensate for the altitude
     // offset
-    projected_gps_point = projector->reverse(to_basic_point_3d_pt(local_point));
+    projected_gps_point = projector_->reverse(to_basic_point_3d_pt(local_point));
 
     // correct altitude based on the map origin
     // note that the converted altitude in local point is in the same vertical datum as the geo
     // point
-    projected_gps_point.ele = local_point.z + projector_info.map_origin.altitude;
+    projected_gps_point.ele = local_point.z + projector_info_.map_origin.altitude;
   }
 
   GeoPoint geo_point;
@@ -92,4 +110,24 @@ GeoPoint project_reverse(const LocalPoint & local_point, const MapProjectorInfo
   return geo_point;
 }
 
+std::vector<LocalPoint> MapProjector::forward(const std::vector<GeoPoint> & geo_points) const
+{
+  std::vector<LocalPoint> local_points;
+  local_points.reserve(geo_points.size());
+  for (const auto & geo_point : geo_points) {
+    local_points.push_back(forward(geo_point));
+  }
+  return local_points;
+}
+
+std::vector<GeoPoint> MapProjector::reverse(const std::vector<LocalPoint> & local_points) const
+{
+  std::vector<GeoPoint> geo_points;
+  geo_points.reserve(local_points.size());
+  for (const auto & local_point : local_points) {
+    geo_points.push_back(reverse(local_point));
+  }
+  return geo_points;
+}
+
 }  // namespace geography_utils
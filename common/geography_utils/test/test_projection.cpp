@@ -18,6 +18,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 TEST(GeographyUtilsProjection, ProjectForwardToMGRS)
 {
@@ -159,3 +160,41 @@ TEST(GeographyUtilsProjection, ProjectForwardAndReverseLocalCartesianUTMOrigin)
   EXPECT_NEAR(converted_geo_point.longitude, geo_point.longitude, 0.0001);
   EXPECT_NEAR(converted_geo_point.altitude, geo_point.altitude, 0.0001);
 }
+
+TEST(GeographyUtilsProjection, MapProjectorBatchConversion)
+{
+  // source points
+  std::vector<geographic_msgs::msg::GeoPoint> geo_points(3);
+  for (size_t i = 0; i < geo_points.size(); ++i) {
+    geo_points.at(i).latitude = 35.62426 + 0.001 * static_cast<double>(i);
+    geo_points.at(i).longitude = 139.74252 - 0.001 * static_cast<double>(i);
+    geo_points.at(i).altitude = 10.0;
+  }
+
+  // projector info
+  tier4_map_msgs::msg::MapProjectorInfo projector_info;
+  projector_info.projector_type = tier4_map_msgs::msg::MapProjectorInfo::LOCAL_CARTESIAN_UTM;
+  projector_info.vertical_datum = tier4_map_msgs::msg::MapProjectorInfo::WGS84;
+  projector_info.map_origin.latitude = 35.0;
+  projector_info.map_origin.longitude = 139.0;
+  projector_info.map_origin.altitude = 0.0;
+
+  // conversion
+  const geography_utils::MapProjector projector(projector_info);
+  const auto converted_local_points = projector.forward(geo_points);
+  const auto converted_geo_points = projector.reverse(converted_local_points);
+  ASSERT_EQ(converted_local_points.size(), geo_points.size());
+  ASSERT_EQ(converted_geo_points.size(), geo_points.size());
+
+  for (size_t i = 0; i < geo_points.size(); ++i) {
+    // same as the conversion of a single point
+    const auto local_point = geography_utils::project_forward(geo_points.at(i), projector_info);
+    EXPECT_DOUBLE_EQ(converted_local_points.at(i).x, local_point.x);
+    EXPECT_DOUBLE_EQ(converted_local_points.at(i).y, local_point.y);
+    EXPECT_DOUBLE_EQ(converted_local_points.at(i).z, local_point.z);
+
+    EXPECT_NEAR(converted_geo_points.at(i).latitude, geo_points.at(i).latitude, 0.0001);
+    EXPECT_NEAR(converted_geo_points.at(i).longitude, geo_points.at(i).longitude, 0.0001);
+    EXPECT_NEAR(converted_geo_points.at(i).altitude, geo_points.at(i).altitude, 0.0001);
+  }
+}
@@ -21,6 +21,7 @@
 #include <grid_map_core/GridMapMath.hpp>
 #include <grid_map_core/Polygon.hpp>
 
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -72,6 +73,10 @@ public:
   /// @return true if iterator is out of scope, false if end has not been reached.
   [[nodiscard]] bool isPastEnd() const;
 
+  friend void fillPolygon(
+    grid_map::GridMap & grid_map, const grid_map::Polygon & polygon, const std::string & layer,
+    const float value);
+
 private:
   /** @brief Calculate sorted edges of the given polygon.
       @details Vertices in an edge are ordered from higher to lower x.
@@ -124,6 +129,26 @@ private:
   int current_col_;
   int current_to_col_;
 };
+
+/// @brief Set the value of all cells whose center is inside a polygon.
+/// @details The same cells as the PolygonIterator are set, but each span of columns between two
+/// intersections of a row is filled at once instead of one cell at a time.
+/// @param grid_map the grid map to fill.
+/// @param polygon the polygonal area to fill.
+/// @param layer the layer of the grid map to fill.
+/// @param value the value to set.
+void fillPolygon(
+  grid_map::GridMap & grid_map, const grid_map::Polygon & polygon, const std::string & layer,
+  const float value);
+
+/// @brief Set the value of all cells whose center is inside at least one of the polygons.
+/// @param grid_map the grid map to fill.
+/// @param polygons the polygonal areas to fill.
+/// @param layer the layer of the grid map to fill.
+/// @param value the value to set.
+void fillPolygons(
+  grid_map::GridMap & grid_map, const std::vector<grid_map::Polygon> & polygons,
+  const std::string & layer, const float value);
 }  // namespace grid_map_utils
 
 #endif  // GRID_MAP_UTILS__POLYGON_ITERATOR_HPP_
@@ -20,7 +20,9 @@
 
 #include <algorithm>
 #include <functional>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace grid_map_utils
 {
@@ -214,4 +216,45 @@ PolygonIterator & PolygonIterator::operator++()
 {
   return current_line_ >= intersections_per_line_.size();
 }
+
+void fillPolygon(
+  grid_map::GridMap & grid_map, const grid_map::Polygon & polygon, const std::string & layer,
+  const float value)
+{
+  const PolygonIterator iterator(grid_map, polygon);
+  auto & data = grid_map[layer];
+  const auto & map_size = iterator.map_size_;
+  const auto & resolution = iterator.map_resolution_;
+  for (size_t line = 0; line < iterator.intersections_per_line_.size(); ++line) {
+    const auto & intersections = iterator.intersections_per_line_[line];
+    if (intersections.size() < 2) continue;
+    auto row = iterator.map_start_idx_(0) + iterator.row_of_first_line_ + static_cast<int>(line);
+    grid_map::wrapIndexToRange(row, map_size(0));
+    // same columns as PolygonIterator::calculateColumnIndexes() for each pair of intersections
+    for (size_t i = 0; i + 1 < intersections.size(); i += 2) {
+      const auto dist_from_origin = iterator.map_origin_y_ - intersections[i] + resolution;
+      const auto from_col =
+        std::clamp(static_cast<int>(dist_from_origin / resolution), 0, map_size(1) - 1);
+      const auto dist_to_origin = iterator.map_origin_y_ - intersections[i + 1];
+      const auto to_col =
+        std::clamp(static_cast<int>(dist_to_origin / resolution), 0, map_size(1) - 1);
+      if (to_col < from_col) continue;
+      // the span of columns is split in 2 blocks if it wraps around the circular buffer
+      auto col = iterator.map_start_idx_(1) + from_col;
+      grid_map::wrapIndexToRange(col, map_size(1));
+      const auto span_size = to_col - from_col + 1;
+      const auto first_block_size = std::min(span_size, map_size(1) - col);
+      data.block(row, col, 1, first_block_size).setConstant(value);
+      if (first_block_size < span_size)
+        data.block(row, 0, 1, span_size - first_block_size).setConstant(value);
+    }
+  }
+}
+
+void fillPolygons(
+  grid_map::GridMap & grid_map, const std::vector<grid_map::Polygon> & polygons,
+  const std::string & layer, const float value)
+{
+  for (const auto & polygon : polygons) fillPolygon(grid_map, polygon, layer, value);
+}
 }  // namespace grid_map_utils
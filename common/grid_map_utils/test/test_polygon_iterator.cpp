@@ -278,3 +278,30 @@ TEST(PolygonIterator, SelfCrossingPolygon)
   }
   EXPECT_FALSE(diff);
 }
+
+TEST(PolygonIterator, FillPolygon)
+{
+  GridMap map({"iterator", "fill"});
+  map.setGeometry(Length(8.0, 5.0), 1.0, Position(0.0, 0.0));  // bufferSize(8, 5)
+  // move the map so that the spans wrap around the circular buffer
+  map.move(Position(2.0, 1.0));
+
+  std::vector<Polygon> polygons(2);
+  polygons[0].addVertex(Position(6.1, 2.6));
+  polygons[0].addVertex(Position(0.9, 1.6));
+  polygons[0].addVertex(Position(0.9, -0.6));
+  polygons[0].addVertex(Position(4.1, -1.1));
+  polygons[1].addVertex(Position(-1.9, 3.3));
+  polygons[1].addVertex(Position(-1.9, -1.4));
+  polygons[1].addVertex(Position(0.2, 0.3));
+
+  map["iterator"].setZero();
+  map["fill"].setZero();
+  for (const auto & polygon : polygons)
+    for (grid_map_utils::PolygonIterator iterator(map, polygon); !iterator.isPastEnd(); ++iterator)
+      map.at("iterator", *iterator) = 1.0;
+  grid_map_utils::fillPolygons(map, polygons, "fill", 1.0);
+
+  EXPECT_GT(map["fill"].sum(), 0.0);
+  EXPECT_TRUE((map["fill"].array() == map["iterator"].array()).all());
+}
@@ -0,0 +1,103 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// measures the coefficient calculation and the queries of SplineInterpolation and
+// SplineInterpolationPoints2d on the trajectory sizes of the planning modules
+
+#include "interpolation/spline_interpolation.hpp"
+#include "interpolation/spline_interpolation_points_2d.hpp"
+
+#include <geometry_msgs/msg/point.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+// returns the average time of the function in [us]
+double measure(const int iterations_num, const std::function<void()> & f)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations_num; ++i) {
+    f();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / iterations_num;
+}
+
+// points on a curve with the interval of 1 [m], as a resampled trajectory
+std::vector<geometry_msgs::msg::Point> createPoints(const size_t points_num)
+{
+  std::vector<geometry_msgs::msg::Point> points(points_num);
+  for (size_t i = 0; i < points_num; ++i) {
+    const double s = static_cast<double>(i);
+    points.at(i).x = 50.0 * std::sin(s / 50.0);
+    points.at(i).y = 50.0 * (1.0 - std::cos(s / 50.0)) + std::sin(s / 10.0);
+  }
+  return points;
+}
+}  // namespace
+
+int main(int argc, char * argv[])
+{
+  const int iterations_num = argc > 1 ? std::atoi(argv[1]) : 100;
+
+  double checksum = 0.0;
+  for (const size_t points_num : {100, 500, 1000, 2000}) {
+    const auto points = createPoints(points_num);
+    std::vector<double> base_keys(points_num);
+    std::vector<double> base_values(points_num);
+    for (size_t i = 0; i < points_num; ++i) {
+      base_keys.at(i) = static_cast<double>(i);
+      base_values.at(i) = points.at(i).y;
+    }
+    // queries at the interval of 0.1 [m]
+    std::vector<double> query_keys;
+    for (double s = 0.0; s <= base_keys.back(); s += 0.1) {
+      query_keys.push_back(s);
+    }
+
+    const double coef_us = measure(
+      iterations_num, [&]() { checksum += SplineInterpolation(base_keys, base_values).getSize(); });
+
+    const SplineInterpolation spline(base_keys, base_values);
+    const double sweep_us = measure(iterations_num, [&]() {
+      checksum += spline.getSplineInterpolatedValues(query_keys).back();
+    });
+    const double single_us = measure(iterations_num, [&]() {
+      for (const double query_key : query_keys) {
+        checksum += spline.getSplineInterpolatedValue(query_key);
+      }
+    });
+
+    const SplineInterpolationPoints2d spline_points(points);
+    const double yaws_us = measure(iterations_num, [&]() {
+      checksum += spline_points.getSplineInterpolatedYaws().back();
+    });
+    const double curvatures_us = measure(iterations_num, [&]() {
+      checksum += spline_points.getSplineInterpolatedCurvatures().back();
+    });
+
+    std::cout << points_num << " points, " << query_keys.size()
+              << " queries: coefficients " << coef_us << " [us], sorted queries " << sweep_us
+              << " [us], single queries " << single_us << " [us], yaws " << yaws_us
+              << " [us], curvatures " << curvatures_us << " [us]" << std::endl;
+  }
+  std::cout << "checksum " << checksum << std::endl;
+  return 0;
+}
@@ -88,6 +88,25 @@ inline std::vector<double> validateKeys(
   return validated_query_keys;
 }
 
+// NOTE: Same as validateKeys for a single query key, except that base_keys is not checked to be
+//       sorted so that the key can be validated without scanning base_keys.
+inline double validateKey(const std::vector<double> & base_keys, const double query_key)
+{
+  // when size of vectors are less than 2
+  if (base_keys.size() < 2) {
+    throw std::invalid_argument(
+      "The size of points is less than 2. base_keys.size() = " + std::to_string(base_keys.size()));
+  }
+
+  // when query_key is out of base_keys (This function does not allow exterior division.)
+  constexpr double epsilon = 1e-3;
+  if (query_key < base_keys.front() - epsilon || base_keys.back() + epsilon < query_key) {
+    throw std::invalid_argument("query_key is out of base_keys");
+  }
+
+  return std::clamp(query_key, base_keys.front(), base_keys.back());
+}
+
 template <class T>
 void validateKeysAndValues(
   const std::vector<double> & base_keys, const std::vector<T> & base_values)
@@ -95,6 +95,13 @@ public:
   std::vector<double> getSplineInterpolatedQuadDiffValues(
     const std::vector<double> & query_keys) const;
 
+  //!< @brief get the value, 1st and 2nd differential values of spline interpolation on a
+  //           designated sampling point.
+  //!< @details The segment of query_key is found by a binary search, and nothing is allocated.
+  double getSplineInterpolatedValue(const double query_key) const;
+  double getSplineInterpolatedDiffValue(const double query_key) const;
+  double getSplineInterpolatedQuadDiffValue(const double query_key) const;
+
   size_t getSize() const { return base_keys_.size(); }
 
 private:
@@ -103,6 +110,9 @@ private:
 
   void calcSplineCoefficients(
     const std::vector<double> & base_keys, const std::vector<double> & base_values);
+
+  // index of the spline segment that is used by getSplineInterpolatedValues for query_key
+  size_t getSegmentIndex(const double query_key) const;
 };
 
 #endif  // INTERPOLATION__SPLINE_INTERPOLATION_HPP_
@@ -14,6 +14,8 @@
 
 #include "interpolation/spline_interpolation.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 namespace
@@ -287,3 +289,43 @@ std::vector<double> SplineInterpolation::getSplineInterpolatedQuadDiffValues(
 
   return res;
 }
+
+size_t SplineInterpolation::getSegmentIndex(const double query_key) const
+{
+  // NOTE: the first segment j such that query_key <= base_keys_[j + 1], as the sweeps find
+  const auto itr = std::lower_bound(base_keys_.begin() + 1, base_keys_.end() - 1, query_key);
+  return static_cast<size_t>(std::distance(base_keys_.begin() + 1, itr));
+}
+
+double SplineInterpolation::getSplineInterpolatedValue(const double query_key) const
+{
+  // throw exceptions for invalid arguments
+  const double validated_query_key = interpolation_utils::validateKey(base_keys_, query_key);
+
+  const size_t j = getSegmentIndex(validated_query_key);
+  const double ds = validated_query_key - base_keys_[j];
+  return multi_spline_coef_.d[j] +
+         (multi_spline_coef_.c[j] + (multi_spline_coef_.b[j] + multi_spline_coef_.a[j] * ds) * ds) *
+           ds;
+}
+
+double SplineInterpolation::getSplineInterpolatedDiffValue(const double query_key) const
+{
+  // throw exceptions for invalid arguments
+  const double validated_query_key = interpolation_utils::validateKey(base_keys_, query_key);
+
+  const size_t j = getSegmentIndex(validated_query_key);
+  const double ds = validated_query_key - base_keys_[j];
+  return multi_spline_coef_.c[j] +
+         (2.0 * multi_spline_coef_.b[j] + 3.0 * multi_spline_coef_.a[j] * ds) * ds;
+}
+
+double SplineInterpolation::getSplineInterpolatedQuadDiffValue(const double query_key) const
+{
+  // throw exceptions for invalid arguments
+  const double validated_query_key = interpolation_utils::validateKey(base_keys_, query_key);
+
+  const size_t j = getSegmentIndex(validated_query_key);
+  const double ds = validated_query_key - base_keys_[j];
+  return 2.0 * multi_spline_coef_.b[j] + 6.0 * multi_spline_coef_.a[j] * ds;
+}
@@ -137,9 +137,9 @@ geometry_msgs::msg::Point SplineInterpolationPoints2d::getSplineInterpolatedPoin
     whole_s = base_s_vec_.back();
   }
 
-  const double x = spline_x_.getSplineInterpolatedValues({whole_s}).at(0);
-  const double y = spline_y_.getSplineInterpolatedValues({whole_s}).at(0);
-  const double z = spline_z_.getSplineInterpolatedValues({whole_s}).at(0);
+  const double x = spline_x_.getSplineInterpolatedValue(whole_s);
+  const double y = spline_y_.getSplineInterpolatedValue(whole_s);
+  const double z = spline_z_.getSplineInterpolatedValue(whole_s);
 
   geometry_msgs::msg::Point geom_point;
   geom_point.x = x;
@@ -157,18 +157,21 @@ double SplineInterpolationPoints2d::getSplineInterpolatedYaw(const size_t idx, c
   const double whole_s =
     std::clamp(base_s_vec_.at(idx) + s, base_s_vec_.front(), base_s_vec_.back());
 
-  const double diff_x = spline_x_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-  const double diff_y = spline_y_.getSplineInterpolatedDiffValues({whole_s}).at(0);
+  const double diff_x = spline_x_.getSplineInterpolatedDiffValue(whole_s);
+  const double diff_y = spline_y_.getSplineInterpolatedDiffValue(whole_s);
 
   return std::atan2(diff_y, diff_x);
 }
 
 std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedYaws() const
 {
-  std::vector<double> yaw_vec;
-  for (size_t i = 0; i < spline_x_.getSize(); ++i) {
-    const double yaw = getSplineInterpolatedYaw(i, 0.0);
-    yaw_vec.push_back(yaw);
+  // NOTE: the base points are interpolated in a sweep instead of a search for each of them
+  const auto diff_x = spline_x_.getSplineInterpolatedDiffValues(base_s_vec_);
+  const auto diff_y = spline_y_.getSplineInterpolatedDiffValues(base_s_vec_);
+
+  std::vector<double> yaw_vec(base_s_vec_.size());
+  for (size_t i = 0; i < base_s_vec_.size(); ++i) {
+    yaw_vec[i] = std::atan2(diff_y[i], diff_x[i]);
   }
   return yaw_vec;
 }
@@ -183,11 +186,11 @@ double SplineInterpolationPoints2d::getSplineInterpolatedCurvature(
   const double whole_s =
     std::clamp(base_s_vec_.at(idx) + s, base_s_vec_.front(), base_s_vec_.back());
 
-  const double diff_x = spline_x_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-  const double diff_y = spline_y_.getSplineInterpolatedDiffValues({whole_s}).at(0);
+  const double diff_x = spline_x_.getSplineInterpolatedDiffValue(whole_s);
+  const double diff_y = spline_y_.getSplineInterpolatedDiffValue(whole_s);
 
-  const double quad_diff_x = spline_x_.getSplineInterpolatedQuadDiffValues({whole_s}).at(0);
-  const double quad_diff_y = spline_y_.getSplineInterpolatedQuadDiffValues({whole_s}).at(0);
+  const double quad_diff_x = spline_x_.getSplineInterpolatedQuadDiffValue(whole_s);
+  const double quad_diff_y = spline_y_.getSplineInterpolatedQuadDiffValue(whole_s);
 
   return (diff_x * quad_diff_y - quad_diff_x * diff_y) /
          std::pow(std::pow(diff_x, 2) + std::pow(diff_y, 2), 1.5);
@@ -195,10 +198,16 @@ double SplineInterpolationPoints2d::getSplineInterpolatedCurvature(
 
 std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedCurvatures() const
 {
-  std::vector<double> curvature_vec;
-  for (size_t i = 0; i < spline_x_.getSize(); ++i) {
-    const double curvature = getSplineInterpolatedCurvature(i, 0.0);
-    curvature_vec.push_back(curvature);
+  // NOTE: the base points are interpolated in a sweep instead of a search for each of them
+  const auto diff_x = spline_x_.getSplineInterpolatedDiffValues(base_s_vec_);
+  const auto diff_y = spline_y_.getSplineInterpolatedDiffValues(base_s_vec_);
+  const auto quad_diff_x = spline_x_.getSplineInterpolatedQuadDiffValues(base_s_vec_);
+  const auto quad_diff_y = spline_y_.getSplineInterpolatedQuadDiffValues(base_s_vec_);
+
+  std::vector<double> curvature_vec(base_s_vec_.size());
+  for (size_t i = 0; i < base_s_vec_.size(); ++i) {
+    curvature_vec[i] = (diff_x[i] * quad_diff_y[i] - quad_diff_x[i] * diff_y[i]) /
+                       std::pow(std::pow(diff_x[i], 2) + std::pow(diff_y[i], 2), 1.5);
   }
   return curvature_vec;
 }
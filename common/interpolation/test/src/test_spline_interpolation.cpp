@@ -266,4 +266,26 @@ TEST(spline_interpolation, SplineInterpolation)
       EXPECT_NEAR(query_values.at(i), ans.at(i), epsilon);
     }
   }
+  {
+    // single query key is the same as the sorted query keys
+    const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+    const std::vector<double> base_values{-1.2, 0.5, 1.0, 1.2, 2.0, 1.0};
+    const std::vector<double> query_keys{-1.5, 0.0, 1.0, 8.0, 12.0, 15.0, 18.0, 20.0};
+
+    SplineInterpolation s(base_keys, base_values);
+    const auto values = s.getSplineInterpolatedValues(query_keys);
+    const auto diff_values = s.getSplineInterpolatedDiffValues(query_keys);
+    const auto quad_diff_values = s.getSplineInterpolatedQuadDiffValues(query_keys);
+
+    for (size_t i = 0; i < query_keys.size(); ++i) {
+      EXPECT_DOUBLE_EQ(s.getSplineInterpolatedValue(query_keys.at(i)), values.at(i));
+      EXPECT_DOUBLE_EQ(s.getSplineInterpolatedDiffValue(query_keys.at(i)), diff_values.at(i));
+      EXPECT_DOUBLE_EQ(
+        s.getSplineInterpolatedQuadDiffValue(query_keys.at(i)), quad_diff_values.at(i));
+    }
+
+    // query key slightly out of base keys is cropped, and the one far from them is rejected
+    EXPECT_DOUBLE_EQ(s.getSplineInterpolatedValue(20.0 + 1e-4), values.back());
+    EXPECT_THROW(s.getSplineInterpolatedValue(21.0), std::invalid_argument);
+  }
 }
@@ -0,0 +1,102 @@
+// Copyright 2024 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// compares KalmanFilter and FixedSizeKalmanFilter on the predict/update cycle of a constant
+// velocity model tracking many objects, as the trackers of multi_object_tracker do
+
+#include "kalman_filter/fixed_size_kalman_filter.hpp"
+#include "kalman_filter/kalman_filter.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+constexpr int DIM = 4;
+constexpr int DIM_Y = 2;
+constexpr double dt = 0.1;
+
+// runs the cycles through the given filter type with the matrices built as the filter expects
+template <class Filter, class StateVector, class StateMatrix, class MeasVector, class MeasMatrix,
+          class MeasCovariance>
+double run(
+  const int objects_num, const int cycles_num, const StateVector & x0, const StateMatrix & P0,
+  double & checksum)
+{
+  std::vector<Filter> filters(objects_num);
+  for (auto & filter : filters) {
+    filter.init(x0, P0);
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int cycle = 0; cycle < cycles_num; ++cycle) {
+    for (auto & filter : filters) {
+      StateVector x(DIM, 1);
+      filter.getX(x);
+      StateMatrix A = StateMatrix::Identity(DIM, DIM);
+      A(0, 2) = dt;
+      A(1, 3) = dt;
+      const StateMatrix Q = StateMatrix::Identity(DIM, DIM) * 0.01;
+      const StateVector x_next = A * x;
+      filter.predict(x_next, A, Q);
+
+      MeasVector y(DIM_Y, 1);
+      y << x_next(0) + 0.01, x_next(1) - 0.01;
+      MeasMatrix C = MeasMatrix::Zero(DIM_Y, DIM);
+      C(0, 0) = 1.0;
+      C(1, 1) = 1.0;
+      const MeasCovariance R = MeasCovariance::Identity(DIM_Y, DIM_Y) * 0.09;
+      filter.update(y, C, R);
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  for (const auto & filter : filters) {
+    checksum += filter.getXelement(0);
+  }
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+}  // namespace
+
+int main(int argc, char * argv[])
+{
+  const int objects_num = argc > 1 ? std::atoi(argv[1]) : 300;
+  const int cycles_num = argc > 2 ? std::atoi(argv[2]) : 1000;
+
+  using FixedKF = FixedSizeKalmanFilter<DIM>;
+  FixedKF::StateVector x0;
+  x0 << 0.0, 0.0, 1.0, 0.5;
+  const FixedKF::StateMatrix P0 = FixedKF::StateMatrix::Identity();
+
+  double dynamic_checksum = 0.0;
+  const double dynamic_ms =
+    run<KalmanFilter, Eigen::MatrixXd, Eigen::MatrixXd, Eigen::MatrixXd, Eigen::MatrixXd,
+        Eigen::MatrixXd>(objects_num, cycles_num, x0, P0, dynamic_checksum);
+  double fixed_checksum = 0.0;
+  const double fixed_ms =
+    run<FixedKF, FixedKF::StateVector, FixedKF::StateMatrix, FixedKF::MeasurementVector<DIM_Y>,
+        FixedKF::MeasurementMatrix<DIM_Y>, FixedKF::MeasurementCovariance<DIM_Y>>(
+      objects_num, cycles_num, x0, P0, fixed_checksum);
+
+  const double updates_num = static_cast<double>(objects_num) * cycles_num;
+  std::cout << objects_num << " objects x " << cycles_num << " cycles" << std::endl;
+  std::cout << "KalmanFilter:             " << dynamic_ms << " [ms], "
+            << dynamic_ms * 1e6 / updates_num << " [ns/cycle]" << std::endl;
+  std::cout << "FixedSizeKalmanFilter<4>: " << fixed_ms << " [ms], "
+            << fixed_ms * 1e6 / updates_num << " [ns/cycle]" << std::endl;
+  std::cout << "state difference: " << (dynamic_checksum - fixed_checksum) << std::endl;
+  return 0;
+}
@@ -0,0 +1,140 @@
+// Copyright 2024 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef KALMAN_FILTER__FIXED_SIZE_KALMAN_FILTER_HPP_
+#define KALMAN_FILTER__FIXED_SIZE_KALMAN_FILTER_HPP_
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+/**
+ * @file fixed_size_kalman_filter.hpp
+ * @brief kalman filter class with the dimensions fixed at compile time
+ */
+
+/**
+ * @brief same filter as KalmanFilter with fixed-size matrices, which are not allocated on the heap
+ * @tparam StateDim dimension of the state
+ * @details the dimension of the measurement is given by the matrices passed to update(), so that a
+ * filter can be updated with different sets of the measured values.
+ */
+template <int StateDim>
+class FixedSizeKalmanFilter
+{
+public:
+  static constexpr int state_dim = StateDim;
+  using StateVector = Eigen::Matrix<double, StateDim, 1>;
+  using StateMatrix = Eigen::Matrix<double, StateDim, StateDim>;
+  template <int MeasDim>
+  using MeasurementVector = Eigen::Matrix<double, MeasDim, 1>;
+  template <int MeasDim>
+  using MeasurementMatrix = Eigen::Matrix<double, MeasDim, StateDim>;
+  template <int MeasDim>
+  using MeasurementCovariance = Eigen::Matrix<double, MeasDim, MeasDim>;
+
+  /**
+   * @brief initialization of kalman filter
+   * @param x initial state
+   * @param P0 initial covariance of estimated state
+   */
+  bool init(const StateVector & x, const StateMatrix & P0)
+  {
+    x_ = x;
+    P_ = P0;
+    return true;
+  }
+
+  /**
+   * @brief get current kalman filter state
+   * @param x kalman filter state
+   */
+  void getX(StateVector & x) const { x = x_; }
+
+  /**
+   * @brief get current kalman filter covariance
+   * @param P kalman filter covariance
+   */
+  void getP(StateMatrix & P) const { P = P_; }
+
+  /**
+   * @brief get component of current kalman filter state
+   * @param i index of kalman filter state
+   * @return value of i's component of the kalman filter state x[i]
+   */
+  double getXelement(unsigned int i) const { return x_(i); }
+
+  /**
+   * @brief calculate kalman filter covariance with prediction model with x, A, Q matrix. This is
+   * mainly for EKF with variable matrix.
+   * @param x_next predicted state
+   * @param A coefficient matrix of x for process model
+   * @param Q covariance matrix for process model
+   * @return bool to check matrix operations are being performed properly
+   */
+  bool predict(const StateVector & x_next, const StateMatrix & A, const StateMatrix & Q)
+  {
+    x_ = x_next;
+    P_ = A * P_ * A.transpose() + Q;
+    return true;
+  }
+
+  /**
+   * @brief calculate kalman filter state by measurement model with y_pred, C and R matrix. This is
+   * mainly for EKF with variable matrix.
+   * @param y measured values
+   * @param y_pred output values expected from measurement model
+   * @param C coefficient matrix of x for measurement model
+   * @param R covariance matrix for measurement model
+   * @return bool to check matrix operations are being performed properly
+   */
+  template <int MeasDim>
+  bool update(
+    const MeasurementVector<MeasDim> & y, const MeasurementVector<MeasDim> & y_pred,
+    const MeasurementMatrix<MeasDim> & C, const MeasurementCovariance<MeasDim> & R)
+  {
+    const Eigen::Matrix<double, StateDim, MeasDim> PCT = P_ * C.transpose();
+    const Eigen::Matrix<double, StateDim, MeasDim> K = PCT * ((R + C * PCT).inverse());
+
+    if (!K.allFinite()) {
+      return false;
+    }
+
+    x_ = x_ + K * (y - y_pred);
+    P_ = P_ - K * (C * P_);
+    return true;
+  }
+
+  /**
+   * @brief calculate kalman filter state by measurement model with C and R matrix. This is mainly
+   * for EKF with variable matrix.
+   * @param y measured values
+   * @param C coefficient matrix of x for measurement model
+   * @param R covariance matrix for measurement model
+   * @return bool to check matrix operations are being performed properly
+   */
+  template <int MeasDim>
+  bool update(
+    const MeasurementVector<MeasDim> & y, const MeasurementMatrix<MeasDim> & C,
+    const MeasurementCovariance<MeasDim> & R)
+  {
+    const MeasurementVector<MeasDim> y_pred = C * x_;
+    return update(y, y_pred, C, R);
+  }
+
+private:
+  StateVector x_{StateVector::Zero()};  //!< @brief current estimated state
+  StateMatrix P_{StateMatrix::Zero()};  //!< @brief covariance of estimated state
+};
+
+#endif  // KALMAN_FILTER__FIXED_SIZE_KALMAN_FILTER_HPP_
@@ -0,0 +1,179 @@
+// Copyright 2024 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef KALMAN_FILTER__FIXED_SIZE_TIME_DELAY_KALMAN_FILTER_HPP_
+#define KALMAN_FILTER__FIXED_SIZE_TIME_DELAY_KALMAN_FILTER_HPP_
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include <iostream>
+
+/**
+ * @file fixed_size_time_delay_kalman_filter.hpp
+ * @brief kalman filter with delayed measurement, whose delayed states are kept in a ring buffer
+ */
+
+/**
+ * @brief same filter as TimeDelayKalmanFilter with the state blocks of a fixed size
+ * @tparam StateDim dimension of the state of one time step
+ * @details the extended state is a ring buffer of max_delay_step blocks, and the latest state is
+ * the block at head_. The prediction moves head_ back onto the oldest block and writes only the
+ * block row and column of the new state, instead of sliding the whole extended covariance. The
+ * update reads only the block row and column of the delayed state.
+ */
+template <int StateDim>
+class FixedSizeTimeDelayKalmanFilter
+{
+public:
+  static constexpr int state_dim = StateDim;
+  using StateVector = Eigen::Matrix<double, StateDim, 1>;
+  using StateMatrix = Eigen::Matrix<double, StateDim, StateDim>;
+  template <int MeasDim>
+  using MeasurementVector = Eigen::Matrix<double, MeasDim, 1>;
+  template <int MeasDim>
+  using MeasurementMatrix = Eigen::Matrix<double, MeasDim, StateDim>;
+  template <int MeasDim>
+  using MeasurementCovariance = Eigen::Matrix<double, MeasDim, MeasDim>;
+
+  /**
+   * @brief initialization of kalman filter
+   * @param x initial state
+   * @param P0 initial covariance of estimated state
+   * @param max_delay_step Maximum number of delay steps, which determines the dimension of the
+   * extended kalman filter
+   */
+  void init(const StateVector & x, const StateMatrix & P0, const int max_delay_step)
+  {
+    max_delay_step_ = max_delay_step;
+    head_ = 0;
+    const int dim_x_ex = StateDim * max_delay_step_;
+
+    x_ = Eigen::VectorXd::Zero(dim_x_ex);
+    P_ = Eigen::MatrixXd::Zero(dim_x_ex, dim_x_ex);
+
+    for (int i = 0; i < max_delay_step_; ++i) {
+      x_.template segment<StateDim>(i * StateDim) = x;
+      P_.template block<StateDim, StateDim>(i * StateDim, i * StateDim) = P0;
+    }
+  }
+
+  /**
+   * @brief get latest time estimated state
+   */
+  StateVector getLatestX() const { return x_.template segment<StateDim>(offset(0)); }
+
+  /**
+   * @brief get latest time estimation covariance
+   */
+  StateMatrix getLatestP() const
+  {
+    return P_.template block<StateDim, StateDim>(offset(0), offset(0));
+  }
+
+  /**
+   * @brief get component of the extended state, indexed as in TimeDelayKalmanFilter
+   * @param i delay_step * StateDim + index of the state
+   * @return value of i's component of the extended state
+   */
+  double getXelement(unsigned int i) const
+  {
+    return x_(offset(static_cast<int>(i) / StateDim) + static_cast<int>(i) % StateDim);
+  }
+
+  /**
+   * @brief calculate kalman filter covariance by precision model with time delay. This is mainly
+   * for EKF of nonlinear process model.
+   * @param x_next predicted state by prediction model
+   * @param A coefficient matrix of x for process model
+   * @param Q covariance matrix for process model
+   */
+  bool predictWithDelay(const StateVector & x_next, const StateMatrix & A, const StateMatrix & Q)
+  {
+    /*
+     * the blocks of the delayed states keep their place and the oldest one, which is dropped by
+     * the time delay model, is overwritten by the new state:
+     *
+     * P_new(0, 0) = A * P(0, 0) * A' + Q
+     * P_new(0, j) = A * P(0, j - 1), P_new(j, 0) = P_new(0, j)'
+     */
+    head_ = (head_ + max_delay_step_ - 1) % max_delay_step_;
+    const int new_offset = offset(0);
+    const int prev_offset = offset(1);
+
+    const StateMatrix P_prev = P_.template block<StateDim, StateDim>(prev_offset, prev_offset);
+    const Eigen::Matrix<double, StateDim, Eigen::Dynamic> P_new_row =
+      A * P_.middleRows(prev_offset, StateDim);
+    P_.middleRows(new_offset, StateDim) = P_new_row;
+    P_.middleCols(new_offset, StateDim) = P_new_row.transpose();
+    P_.template block<StateDim, StateDim>(new_offset, new_offset) =
+      A * P_prev * A.transpose() + Q;
+
+    x_.template segment<StateDim>(new_offset) = x_next;
+    return true;
+  }
+
+  /**
+   * @brief calculate kalman filter covariance by measurement model with time delay. This is mainly
+   * for EKF of nonlinear process model.
+   * @param y measured values
+   * @param C coefficient matrix of x for measurement model
+   * @param R covariance matrix for measurement model
+   * @param delay_step measurement delay
+   */
+  template <int MeasDim>
+  bool updateWithDelay(
+    const MeasurementVector<MeasDim> & y, const MeasurementMatrix<MeasDim> & C,
+    const MeasurementCovariance<MeasDim> & R, const int delay_step)
+  {
+    if (delay_step >= max_delay_step_) {
+      std::cerr << "delay step is larger than max_delay_step. ignore update." << std::endl;
+      return false;
+    }
+
+    const int delayed_offset = offset(delay_step);
+
+    /* C_ex has the only non-zero block C at the delayed state */
+    const Eigen::Matrix<double, Eigen::Dynamic, MeasDim> PCT =
+      P_.middleCols(delayed_offset, StateDim) * C.transpose();
+    const MeasurementCovariance<MeasDim> S =
+      R + C * PCT.template middleRows<StateDim>(delayed_offset);
+    const Eigen::Matrix<double, Eigen::Dynamic, MeasDim> K = PCT * S.inverse();
+
+    if (!K.allFinite()) {
+      return false;
+    }
+
+    const MeasurementVector<MeasDim> y_pred = C * x_.template segment<StateDim>(delayed_offset);
+    const Eigen::Matrix<double, MeasDim, Eigen::Dynamic> CP =
+      C * P_.middleRows(delayed_offset, StateDim);
+    x_ += K * (y - y_pred);
+    P_.noalias() -= K * CP;
+    return true;
+  }
+
+private:
+  // offset of the block of the state delayed by delay_step in x_ and P_
+  int offset(const int delay_step) const
+  {
+    return ((head_ + delay_step) % max_delay_step_) * StateDim;
+  }
+
+  Eigen::VectorXd x_;  //!< @brief ring buffer of the estimated states
+  Eigen::MatrixXd P_;  //!< @brief covariance of the estimated states in the order of x_
+  int max_delay_step_{1};
+  int head_{0};  //!< @brief block of the latest state in the ring buffer
+};
+
+#endif  // KALMAN_FILTER__FIXED_SIZE_TIME_DELAY_KALMAN_FILTER_HPP_
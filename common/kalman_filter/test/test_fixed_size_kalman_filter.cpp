@@ -0,0 +1,111 @@
+// Copyright 2024 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "kalman_filter/fixed_size_kalman_filter.hpp"
+#include "kalman_filter/kalman_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+namespace
+{
+constexpr int DIM = 4;
+using FixedKF = FixedSizeKalmanFilter<DIM>;
+
+void expectSameState(const KalmanFilter & kf, const FixedKF & fixed_kf)
+{
+  Eigen::MatrixXd x;
+  Eigen::MatrixXd P;
+  kf.getX(x);
+  kf.getP(P);
+  FixedKF::StateVector fixed_x;
+  FixedKF::StateMatrix fixed_P;
+  fixed_kf.getX(fixed_x);
+  fixed_kf.getP(fixed_P);
+  for (int i = 0; i < DIM; ++i) {
+    EXPECT_NEAR(x(i), fixed_x(i), 1e-9);
+    EXPECT_NEAR(fixed_kf.getXelement(i), fixed_x(i), 1e-12);
+    for (int j = 0; j < DIM; ++j) {
+      EXPECT_NEAR(P(i, j), fixed_P(i, j), 1e-9);
+    }
+  }
+}
+}  // namespace
+
+TEST(fixed_size_kalman_filter, same_as_kalman_filter)
+{
+  FixedKF::StateVector x_t;
+  x_t << 1.0, 2.0, 0.5, -0.3;
+  FixedKF::StateMatrix P_t = FixedKF::StateMatrix::Identity();
+  P_t(0, 1) = P_t(1, 0) = 0.1;
+
+  KalmanFilter kf;
+  FixedKF fixed_kf;
+  EXPECT_TRUE(kf.init(x_t, P_t));
+  EXPECT_TRUE(fixed_kf.init(x_t, P_t));
+
+  // constant velocity prediction
+  constexpr double dt = 0.1;
+  FixedKF::StateMatrix A = FixedKF::StateMatrix::Identity();
+  A(0, 2) = dt;
+  A(1, 3) = dt;
+  const FixedKF::StateMatrix Q = FixedKF::StateMatrix::Identity() * 0.01;
+  const FixedKF::StateVector x_next = A * x_t;
+  EXPECT_TRUE(kf.predict(x_next, A, Q));
+  EXPECT_TRUE(fixed_kf.predict(x_next, A, Q));
+  expectSameState(kf, fixed_kf);
+
+  // position measurement
+  FixedKF::MeasurementVector<2> y_pose;
+  y_pose << 1.1, 1.9;
+  FixedKF::MeasurementMatrix<2> C_pose = FixedKF::MeasurementMatrix<2>::Zero();
+  C_pose(0, 0) = 1.0;
+  C_pose(1, 1) = 1.0;
+  FixedKF::MeasurementCovariance<2> R_pose;
+  R_pose << 0.09, 0.01, 0.01, 0.09;
+  EXPECT_TRUE(kf.update(y_pose, C_pose, R_pose));
+  EXPECT_TRUE(fixed_kf.update(y_pose, C_pose, R_pose));
+  expectSameState(kf, fixed_kf);
+
+  // position and velocity measurement
+  FixedKF::MeasurementVector<4> y_pose_vel;
+  y_pose_vel << 1.15, 1.85, 0.6, -0.2;
+  const FixedKF::MeasurementMatrix<4> C_pose_vel = FixedKF::MeasurementMatrix<4>::Identity();
+  const FixedKF::MeasurementCovariance<4> R_pose_vel =
+    FixedKF::MeasurementCovariance<4>::Identity() * 0.04;
+  EXPECT_TRUE(kf.update(y_pose_vel, C_pose_vel, R_pose_vel));
+  EXPECT_TRUE(fixed_kf.update(y_pose_vel, C_pose_vel, R_pose_vel));
+  expectSameState(kf, fixed_kf);
+}
+
+TEST(fixed_size_kalman_filter, reject_invalid_gain)
+{
+  FixedKF fixed_kf;
+  EXPECT_TRUE(fixed_kf.init(FixedKF::StateVector::Zero(), FixedKF::StateMatrix::Identity()));
+
+  FixedKF::MeasurementVector<2> y;
+  y << 1.0, 1.0;
+  FixedKF::MeasurementMatrix<2> C = FixedKF::MeasurementMatrix<2>::Zero();
+  C(0, 0) = 1.0;
+  C(1, 1) = 1.0;
+  FixedKF::MeasurementCovariance<2> R = FixedKF::MeasurementCovariance<2>::Zero();
+  R(0, 0) = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_FALSE(fixed_kf.update(y, C, R));
+
+  // the state is kept on failure
+  FixedKF::StateVector x;
+  fixed_kf.getX(x);
+  EXPECT_TRUE(x.isZero());
+}
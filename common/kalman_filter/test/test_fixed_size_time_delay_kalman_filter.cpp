@@ -0,0 +1,99 @@
+// Copyright 2024 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "kalman_filter/fixed_size_time_delay_kalman_filter.hpp"
+#include "kalman_filter/time_delay_kalman_filter.hpp"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+constexpr int DIM = 4;
+constexpr int MAX_DELAY_STEP = 5;
+using FixedTDKF = FixedSizeTimeDelayKalmanFilter<DIM>;
+
+void expectSameState(const TimeDelayKalmanFilter & td_kf, const FixedTDKF & fixed_td_kf)
+{
+  const Eigen::MatrixXd x = td_kf.getLatestX();
+  const Eigen::MatrixXd P = td_kf.getLatestP();
+  const FixedTDKF::StateVector fixed_x = fixed_td_kf.getLatestX();
+  const FixedTDKF::StateMatrix fixed_P = fixed_td_kf.getLatestP();
+  for (int i = 0; i < DIM; ++i) {
+    EXPECT_NEAR(x(i), fixed_x(i), 1e-9);
+    for (int j = 0; j < DIM; ++j) {
+      EXPECT_NEAR(P(i, j), fixed_P(i, j), 1e-9);
+    }
+  }
+  for (int i = 0; i < DIM * MAX_DELAY_STEP; ++i) {
+    EXPECT_NEAR(td_kf.getXelement(i), fixed_td_kf.getXelement(i), 1e-9);
+  }
+}
+}  // namespace
+
+TEST(fixed_size_time_delay_kalman_filter, same_as_time_delay_kalman_filter)
+{
+  FixedTDKF::StateVector x_t;
+  x_t << 1.0, 2.0, 0.5, -0.3;
+  FixedTDKF::StateMatrix P_t = FixedTDKF::StateMatrix::Identity();
+  P_t(0, 1) = P_t(1, 0) = 0.1;
+
+  TimeDelayKalmanFilter td_kf;
+  FixedTDKF fixed_td_kf;
+  td_kf.init(x_t, P_t, MAX_DELAY_STEP);
+  fixed_td_kf.init(x_t, P_t, MAX_DELAY_STEP);
+  expectSameState(td_kf, fixed_td_kf);
+
+  // constant velocity prediction
+  constexpr double dt = 0.1;
+  FixedTDKF::StateMatrix A = FixedTDKF::StateMatrix::Identity();
+  A(0, 2) = dt;
+  A(1, 3) = dt;
+  const FixedTDKF::StateMatrix Q = FixedTDKF::StateMatrix::Identity() * 0.01;
+
+  FixedTDKF::MeasurementMatrix<2> C_pose = FixedTDKF::MeasurementMatrix<2>::Zero();
+  C_pose(0, 0) = 1.0;
+  C_pose(1, 1) = 1.0;
+  FixedTDKF::MeasurementCovariance<2> R_pose;
+  R_pose << 0.09, 0.01, 0.01, 0.09;
+  FixedTDKF::MeasurementMatrix<1> C_velocity = FixedTDKF::MeasurementMatrix<1>::Zero();
+  C_velocity(0, 2) = 1.0;
+  const FixedTDKF::MeasurementCovariance<1> R_velocity =
+    FixedTDKF::MeasurementCovariance<1>::Constant(0.04);
+
+  // go around the ring buffer more than once with the measurements of several delays
+  for (int step = 0; step < 3 * MAX_DELAY_STEP; ++step) {
+    const FixedTDKF::StateVector x_next = A * fixed_td_kf.getLatestX();
+    EXPECT_TRUE(td_kf.predictWithDelay(x_next, A, Q));
+    EXPECT_TRUE(fixed_td_kf.predictWithDelay(x_next, A, Q));
+    expectSameState(td_kf, fixed_td_kf);
+
+    const int delay_step = step % MAX_DELAY_STEP;
+    FixedTDKF::MeasurementVector<2> y_pose;
+    y_pose << 1.0 + 0.05 * step, 1.9 - 0.03 * step;
+    EXPECT_TRUE(td_kf.updateWithDelay(y_pose, C_pose, R_pose, delay_step));
+    EXPECT_TRUE(fixed_td_kf.updateWithDelay(y_pose, C_pose, R_pose, delay_step));
+    expectSameState(td_kf, fixed_td_kf);
+
+    FixedTDKF::MeasurementVector<1> y_velocity;
+    y_velocity << 0.5;
+    EXPECT_TRUE(td_kf.updateWithDelay(y_velocity, C_velocity, R_velocity, 0));
+    EXPECT_TRUE(fixed_td_kf.updateWithDelay(y_velocity, C_velocity, R_velocity, 0));
+    expectSameState(td_kf, fixed_td_kf);
+  }
+
+  // the delay out of the buffer is rejected as TimeDelayKalmanFilter does
+  FixedTDKF::MeasurementVector<2> y_pose;
+  y_pose << 1.0, 2.0;
+  EXPECT_FALSE(fixed_td_kf.updateWithDelay(y_pose, C_pose, R_pose, MAX_DELAY_STEP));
+}
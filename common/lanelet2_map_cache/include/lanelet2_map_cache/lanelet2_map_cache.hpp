@@ -0,0 +1,46 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_CACHE__LANELET2_MAP_CACHE_HPP_
+#define LANELET2_MAP_CACHE__LANELET2_MAP_CACHE_HPP_
+
+#include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_traffic_rules/TrafficRules.h>
+
+namespace lanelet2_map_cache
+{
+using autoware_auto_mapping_msgs::msg::HADMapBin;
+
+struct LaneletMapWithRoutingGraph
+{
+  lanelet::LaneletMapPtr lanelet_map_ptr;
+  lanelet::traffic_rules::TrafficRulesPtr traffic_rules_ptr;
+  lanelet::routing::RoutingGraphPtr routing_graph_ptr;
+};
+
+/**
+ * @brief convert the map message as lanelet::utils::conversion::fromBinMsg() once per process
+ * @details the nodes in the same process, e.g. the ones loaded into one component container,
+ * which receive the same map message share the converted map, traffic rules and vehicle routing
+ * graph. they are kept while any of the returned pointers is held, and must not be modified.
+ * a node converting the message concurrently waits for the other one and takes its result.
+ */
+LaneletMapWithRoutingGraph fromBinMsg(const HADMapBin & msg);
+
+}  // namespace lanelet2_map_cache
+
+#endif  // LANELET2_MAP_CACHE__LANELET2_MAP_CACHE_HPP_
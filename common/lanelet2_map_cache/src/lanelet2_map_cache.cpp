@@ -0,0 +1,87 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_cache/lanelet2_map_cache.hpp"
+
+#include <lanelet2_extension/utility/message_conversion.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lanelet2_map_cache
+{
+namespace
+{
+struct CachedMap
+{
+  std::size_t data_hash;
+  std::size_t data_size;
+  std::string format_version;
+  std::string map_version;
+  // the owner of the converted map, shared by the aliasing pointers returned to the nodes
+  std::weak_ptr<const LaneletMapWithRoutingGraph> map;
+};
+
+std::mutex cache_mutex;
+std::vector<CachedMap> cache;
+
+LaneletMapWithRoutingGraph share(const std::shared_ptr<const LaneletMapWithRoutingGraph> & owner)
+{
+  return LaneletMapWithRoutingGraph{
+    lanelet::LaneletMapPtr(owner, owner->lanelet_map_ptr.get()),
+    lanelet::traffic_rules::TrafficRulesPtr(owner, owner->traffic_rules_ptr.get()),
+    lanelet::routing::RoutingGraphPtr(owner, owner->routing_graph_ptr.get())};
+}
+}  // namespace
+
+LaneletMapWithRoutingGraph fromBinMsg(const HADMapBin & msg)
+{
+  const std::size_t data_hash = std::hash<std::string_view>{}(
+    std::string_view(reinterpret_cast<const char *>(msg.data.data()), msg.data.size()));
+
+  // the conversion is done in the lock, so that the same map is converted only once
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  cache.erase(
+    std::remove_if(
+      cache.begin(), cache.end(), [](const CachedMap & cached) { return cached.map.expired(); }),
+    cache.end());
+
+  for (const auto & cached : cache) {
+    if (
+      cached.data_hash == data_hash && cached.data_size == msg.data.size() &&
+      cached.format_version == msg.format_version && cached.map_version == msg.map_version) {
+      if (const auto owner = cached.map.lock()) {
+        return share(owner);
+      }
+    }
+  }
+
+  auto converted = std::make_shared<LaneletMapWithRoutingGraph>();
+  converted->lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
+  lanelet::utils::conversion::fromBinMsg(
+    msg, converted->lanelet_map_ptr, &converted->traffic_rules_ptr,
+    &converted->routing_graph_ptr);
+
+  const std::shared_ptr<const LaneletMapWithRoutingGraph> owner = converted;
+  cache.push_back(
+    CachedMap{data_hash, msg.data.size(), msg.format_version, msg.map_version, owner});
+  return share(owner);
+}
+
+}  // namespace lanelet2_map_cache
@@ -0,0 +1,72 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_cache/lanelet2_map_cache.hpp"
+
+#include <lanelet2_extension/utility/message_conversion.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace
+{
+lanelet2_map_cache::HADMapBin createMapBin(const double x)
+{
+  lanelet::Point3d p1(lanelet::utils::getId(), x, 0.0, 0.0);
+  lanelet::Point3d p2(lanelet::utils::getId(), x + 10.0, 0.0, 0.0);
+  lanelet::Point3d p3(lanelet::utils::getId(), x, 3.0, 0.0);
+  lanelet::Point3d p4(lanelet::utils::getId(), x + 10.0, 3.0, 0.0);
+  lanelet::LineString3d right(lanelet::utils::getId(), {p1, p2});
+  lanelet::LineString3d left(lanelet::utils::getId(), {p3, p4});
+  lanelet::Lanelet lanelet(lanelet::utils::getId(), left, right);
+  lanelet.attributes()[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::Road;
+
+  auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
+  lanelet_map_ptr->add(lanelet);
+  lanelet2_map_cache::HADMapBin msg;
+  lanelet::utils::conversion::toBinMsg(lanelet_map_ptr, &msg);
+  return msg;
+}
+}  // namespace
+
+TEST(lanelet2_map_cache, shareSameMap)
+{
+  const auto msg = createMapBin(0.0);
+  const auto map1 = lanelet2_map_cache::fromBinMsg(msg);
+  const auto map2 = lanelet2_map_cache::fromBinMsg(msg);
+  ASSERT_NE(map1.lanelet_map_ptr, nullptr);
+  ASSERT_NE(map1.routing_graph_ptr, nullptr);
+  EXPECT_EQ(map1.lanelet_map_ptr, map2.lanelet_map_ptr);
+  EXPECT_EQ(map1.traffic_rules_ptr, map2.traffic_rules_ptr);
+  EXPECT_EQ(map1.routing_graph_ptr, map2.routing_graph_ptr);
+  EXPECT_EQ(map1.lanelet_map_ptr->laneletLayer.size(), 1u);
+}
+
+TEST(lanelet2_map_cache, convertDifferentMap)
+{
+  const auto map1 = lanelet2_map_cache::fromBinMsg(createMapBin(0.0));
+  const auto map2 = lanelet2_map_cache::fromBinMsg(createMapBin(100.0));
+  EXPECT_NE(map1.lanelet_map_ptr, map2.lanelet_map_ptr);
+}
+
+TEST(lanelet2_map_cache, keepMapWhileHeld)
+{
+  const auto msg = createMapBin(200.0);
+  lanelet::routing::RoutingGraphPtr routing_graph_ptr =
+    lanelet2_map_cache::fromBinMsg(msg).routing_graph_ptr;
+  // the map is kept by the routing graph pointer only
+  const auto map = lanelet2_map_cache::fromBinMsg(msg);
+  EXPECT_EQ(map.routing_graph_ptr, routing_graph_ptr);
+}
@@ -0,0 +1,465 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MOTION_UTILS__TRAJECTORY__INDEXED_TRAJECTORY_HPP_
+#define MOTION_UTILS__TRAJECTORY__INDEXED_TRAJECTORY_HPP_
+
+#include "motion_utils/trajectory/trajectory.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace motion_utils
+{
+/**
+ * @brief view of a points container which caches the data used by the queries of
+ * motion_utils/trajectory/trajectory.hpp, so that many queries on the same points in a cycle do
+ * not scan the points from the front every time.
+ * The cumulative arc length and the grid of the points for the nearest search are built at the
+ * first query which uses them.
+ * @details The points must outlive the view and must not be modified while it is used. The view
+ * is not thread safe since the caches are built by the const queries. The queries return the
+ * same indices as the functions of trajectory.hpp, while the arc lengths may differ from them
+ * by the rounding error since they are the differences of the cumulative arc lengths.
+ */
+template <class T>
+class IndexedTrajectory
+{
+public:
+  explicit IndexedTrajectory(const T & points) : points_(points) {}
+
+  const T & points() const { return points_; }
+  size_t size() const { return points_.size(); }
+
+  /**
+   * @brief calculate the signed arc length between two points in O(1)
+   * @note same as motion_utils::calcSignedArcLength(points, src_idx, dst_idx)
+   */
+  double calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const
+  {
+    if (points_.empty() || src_idx == dst_idx) {
+      return 0.0;
+    }
+    const auto & arc_lengths = getArcLengths();
+    return arc_lengths.at(dst_idx) - arc_lengths.at(src_idx);
+  }
+
+  /**
+   * @note same as motion_utils::calcSignedArcLength(points, src_point, dst_idx)
+   */
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point, const size_t dst_idx) const
+  {
+    if (points_.empty()) {
+      return 0.0;
+    }
+    const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+    return calcSignedArcLength(src_seg_idx, dst_idx) -
+           calcLongitudinalOffsetToSegment(src_seg_idx, src_point);
+  }
+
+  /**
+   * @note same as motion_utils::calcSignedArcLength(points, src_idx, dst_point)
+   */
+  double calcSignedArcLength(
+    const size_t src_idx, const geometry_msgs::msg::Point & dst_point) const
+  {
+    if (points_.empty()) {
+      return 0.0;
+    }
+    return -calcSignedArcLength(dst_point, src_idx);
+  }
+
+  /**
+   * @note same as motion_utils::calcSignedArcLength(points, src_point, dst_point)
+   */
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point, const geometry_msgs::msg::Point & dst_point) const
+  {
+    if (points_.empty()) {
+      return 0.0;
+    }
+    const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+    const size_t dst_seg_idx = findNearestSegmentIndex(dst_point);
+    return calcSignedArcLength(src_seg_idx, dst_seg_idx) -
+           calcLongitudinalOffsetToSegment(src_seg_idx, src_point) +
+           calcLongitudinalOffsetToSegment(dst_seg_idx, dst_point);
+  }
+
+  /**
+   * @note same as motion_utils::calcArcLength(points)
+   */
+  double calcArcLength() const
+  {
+    if (points_.empty()) {
+      return 0.0;
+    }
+    return getArcLengths().back();
+  }
+
+  /**
+   * @brief find the nearest point index by searching the cells of the grid around the point from
+   * the closest one, so that only the points near the given point are compared.
+   * @note same as motion_utils::findNearestIndex(points, point). The first index is returned
+   * among the points at the same distance.
+   */
+  size_t findNearestIndex(const geometry_msgs::msg::Point & point) const
+  {
+    validateNonEmpty(points_);
+
+    const auto & grid = getGrid();
+    const int64_t ix = static_cast<int64_t>(std::floor(point.x / grid.cell_size));
+    const int64_t iy = static_cast<int64_t>(std::floor(point.y / grid.cell_size));
+
+    double min_dist = std::numeric_limits<double>::max();
+    size_t min_idx = 0;
+    const auto update_nearest = [&](const size_t i) {
+      const auto dist = tier4_autoware_utils::calcSquaredDistance2d(points_.at(i), point);
+      if (dist < min_dist || (dist == min_dist && i < min_idx)) {
+        min_dist = dist;
+        min_idx = i;
+      }
+    };
+    const auto search_cell = [&](const int64_t cx, const int64_t cy) {
+      const auto itr = grid.cells.find(toCellKey(cx, cy));
+      if (itr == grid.cells.end()) {
+        return;
+      }
+      for (const size_t i : itr->second) {
+        update_nearest(i);
+      }
+    };
+
+    // NOTE: The points in the ring r of the cells around the point are farther than
+    //       (r - 1) * cell_size from it. The ring search is replaced with the scan of all the
+    //       points when it costs more than the scan, e.g. for a point far from the points.
+    for (int64_t r = 0;; ++r) {
+      if (points_.size() < static_cast<size_t>(4 * r * r)) {
+        for (size_t i = 0; i < points_.size(); ++i) {
+          update_nearest(i);
+        }
+        return min_idx;
+      }
+      if (r == 0) {
+        search_cell(ix, iy);
+      } else {
+        for (int64_t d = -r; d < r; ++d) {
+          search_cell(ix + d, iy - r);
+          search_cell(ix + r, iy + d);
+          search_cell(ix - d, iy + r);
+          search_cell(ix - r, iy - d);
+        }
+      }
+      const double lower_bound = (r - ring_margin) * grid.cell_size;
+      if (0.0 < lower_bound && min_dist < lower_bound * lower_bound) {
+        return min_idx;
+      }
+    }
+  }
+
+  /**
+   * @note same as motion_utils::findNearestSegmentIndex(points, point)
+   */
+  size_t findNearestSegmentIndex(const geometry_msgs::msg::Point & point) const
+  {
+    const size_t nearest_idx = findNearestIndex(point);
+
+    if (nearest_idx == 0) {
+      return 0;
+    }
+    if (nearest_idx == points_.size() - 1) {
+      return points_.size() - 2;
+    }
+
+    const double signed_length = calcLongitudinalOffsetToSegment(nearest_idx, point);
+
+    if (signed_length <= 0) {
+      return nearest_idx - 1;
+    }
+
+    return nearest_idx;
+  }
+
+  /**
+   * @brief calculate the longitudinal offset of the point to the segment, without copying the
+   * points to remove the overlapping ones.
+   * @note same as motion_utils::calcLongitudinalOffsetToSegment(points, seg_idx, p_target,
+   * throw_exception). The segment ends at the first point which does not overlap with the front
+   * point of it, as removeOverlapPoints(points, seg_idx) does.
+   */
+  double calcLongitudinalOffsetToSegment(
+    const size_t seg_idx, const geometry_msgs::msg::Point & p_target,
+    const bool throw_exception = false) const
+  {
+    if (points_.empty()) {
+      if (throw_exception) {
+        validateNonEmpty(points_);
+      }
+      return std::nan("");
+    }
+
+    if (seg_idx >= points_.size() - 1) {
+      return handleError(
+        std::string(__func__) +
+          ": Failed to calculate longitudinal offset because the given segment index is out of "
+          "the points size.",
+        throw_exception, false);
+    }
+
+    const auto p_front = tier4_autoware_utils::getPoint(points_.at(seg_idx));
+    constexpr double eps = 1.0E-08;
+    for (size_t i = seg_idx + 1; i < points_.size(); ++i) {
+      const auto p_back = tier4_autoware_utils::getPoint(points_.at(i));
+      if (std::abs(p_front.x - p_back.x) < eps && std::abs(p_front.y - p_back.y) < eps) {
+        continue;
+      }
+
+      const Eigen::Vector3d segment_vec{p_back.x - p_front.x, p_back.y - p_front.y, 0};
+      const Eigen::Vector3d target_vec{p_target.x - p_front.x, p_target.y - p_front.y, 0};
+      return segment_vec.dot(target_vec) / segment_vec.norm();
+    }
+
+    return handleError(
+      std::string(__func__) +
+        ": Longitudinal offset calculation is not supported for the same points.",
+      throw_exception, true);
+  }
+
+  /**
+   * @brief calculate the point offset from the source point along the points, by a binary search
+   * of the cumulative arc length
+   * @note same as motion_utils::calcLongitudinalOffsetPoint(points, src_idx, offset,
+   * throw_exception)
+   */
+  std::optional<geometry_msgs::msg::Point> calcLongitudinalOffsetPoint(
+    const size_t src_idx, const double offset, const bool throw_exception = false) const
+  {
+    if (points_.empty()) {
+      return {};
+    }
+
+    if (points_.size() - 1 < src_idx) {
+      const std::string error_message(
+        "[motion_utils] " + std::string(__func__) +
+        " error: The given source index is out of the points size. Failed to calculate "
+        "longitudinal offset.");
+      tier4_autoware_utils::print_backtrace();
+      if (throw_exception) {
+        throw std::out_of_range(error_message);
+      }
+      RCLCPP_DEBUG(
+        get_logger(),
+        "%s Return NaN since no_throw option is enabled. The maintainer must check the code.",
+        error_message.c_str());
+      return {};
+    }
+
+    if (points_.size() == 1) {
+      return {};
+    }
+
+    if (src_idx + 1 == points_.size() && offset == 0.0) {
+      return tier4_autoware_utils::getPoint(points_.at(src_idx));
+    }
+
+    const auto & arc_lengths = getArcLengths();
+    const double src_length = arc_lengths.at(src_idx);
+
+    if (offset < 0.0) {
+      // the last point before the source point which is farther than the offset from it
+      const auto itr = std::partition_point(
+        arc_lengths.begin(), arc_lengths.begin() + src_idx,
+        [&](const double length) { return src_length - length >= -offset; });
+      if (itr == arc_lengths.begin()) {
+        return {};
+      }
+      const size_t i = std::distance(arc_lengths.begin(), itr) - 1;
+      const double dist_segment = arc_lengths.at(i + 1) - arc_lengths.at(i);
+      const double dist_res = -offset - (src_length - arc_lengths.at(i));
+      return tier4_autoware_utils::calcInterpolatedPoint(
+        points_.at(i), points_.at(i + 1), std::abs(dist_res / dist_segment));
+    }
+
+    // the first point after the source point which is farther than the offset from it
+    const auto itr = std::partition_point(
+      arc_lengths.begin() + src_idx + 1, arc_lengths.end(),
+      [&](const double length) { return length - src_length < offset; });
+    if (itr == arc_lengths.end()) {
+      // not found (out of range)
+      return {};
+    }
+    const size_t i = std::distance(arc_lengths.begin(), itr) - 1;
+    const double dist_segment = arc_lengths.at(i + 1) - arc_lengths.at(i);
+    const double dist_res = offset - (arc_lengths.at(i + 1) - src_length);
+    return tier4_autoware_utils::calcInterpolatedPoint(
+      points_.at(i + 1), points_.at(i), std::abs(dist_res / dist_segment));
+  }
+
+private:
+  struct Grid
+  {
+    double cell_size;
+    std::unordered_map<uint64_t, std::vector<size_t>> cells;
+  };
+
+  // margin of the ring index for the rounding error of the cell indices
+  static constexpr double ring_margin = 1e-3;
+
+  static uint64_t toCellKey(const int64_t ix, const int64_t iy)
+  {
+    return (static_cast<uint64_t>(ix) << 32) ^ (static_cast<uint64_t>(iy) & 0xffffffff);
+  }
+
+  static double handleError(
+    const std::string & message, const bool throw_exception, const bool is_runtime_error)
+  {
+    const std::string error_message("[motion_utils] " + message);
+    tier4_autoware_utils::print_backtrace();
+    if (throw_exception) {
+      if (is_runtime_error) {
+        throw std::runtime_error(error_message);
+      }
+      throw std::out_of_range(error_message);
+    }
+    RCLCPP_DEBUG(
+      get_logger(),
+      "%s Return NaN since no_throw option is enabled. The maintainer must check the code.",
+      error_message.c_str());
+    return std::nan("");
+  }
+
+  const std::vector<double> & getArcLengths() const
+  {
+    if (!arc_lengths_) {
+      std::vector<double> arc_lengths(points_.size(), 0.0);
+      for (size_t i = 0; i + 1 < points_.size(); ++i) {
+        const double segment_length =
+          tier4_autoware_utils::calcDistance2d(points_.at(i), points_.at(i + 1));
+        arc_lengths.at(i + 1) = arc_lengths.at(i) + segment_length;
+      }
+      arc_lengths_ = std::move(arc_lengths);
+    }
+    return *arc_lengths_;
+  }
+
+  const Grid & getGrid() const
+  {
+    if (!grid_) {
+      // NOTE: The cell size is the average interval of the points so that a cell has a few points.
+      constexpr double min_cell_size = 0.1;
+      const double arc_length = calcArcLength();
+      Grid grid;
+      grid.cell_size = std::max(
+        min_cell_size, points_.size() < 2 ? 0.0 : arc_length / (points_.size() - 1));
+      for (size_t i = 0; i < points_.size(); ++i) {
+        const auto p = tier4_autoware_utils::getPoint(points_.at(i));
+        const int64_t ix = static_cast<int64_t>(std::floor(p.x / grid.cell_size));
+        const int64_t iy = static_cast<int64_t>(std::floor(p.y / grid.cell_size));
+        grid.cells[toCellKey(ix, iy)].push_back(i);
+      }
+      grid_ = std::move(grid);
+    }
+    return *grid_;
+  }
+
+  const T & points_;
+
+  mutable std::optional<std::vector<double>> arc_lengths_;
+  mutable std::optional<Grid> grid_;
+};
+
+// overloads of the functions of trajectory.hpp, so that the call sites can pass the view instead
+// of the points one by one
+template <class T>
+size_t findNearestIndex(
+  const IndexedTrajectory<T> & trajectory, const geometry_msgs::msg::Point & point)
+{
+  return trajectory.findNearestIndex(point);
+}
+
+template <class T>
+size_t findNearestSegmentIndex(
+  const IndexedTrajectory<T> & trajectory, const geometry_msgs::msg::Point & point)
+{
+  return trajectory.findNearestSegmentIndex(point);
+}
+
+template <class T>
+double calcLongitudinalOffsetToSegment(
+  const IndexedTrajectory<T> & trajectory, const size_t seg_idx,
+  const geometry_msgs::msg::Point & p_target, const bool throw_exception = false)
+{
+  return trajectory.calcLongitudinalOffsetToSegment(seg_idx, p_target, throw_exception);
+}
+
+template <class T>
+double calcSignedArcLength(
+  const IndexedTrajectory<T> & trajectory, const size_t src_idx, const size_t dst_idx)
+{
+  return trajectory.calcSignedArcLength(src_idx, dst_idx);
+}
+
+template <class T>
+double calcSignedArcLength(
+  const IndexedTrajectory<T> & trajectory, const geometry_msgs::msg::Point & src_point,
+  const size_t dst_idx)
+{
+  return trajectory.calcSignedArcLength(src_point, dst_idx);
+}
+
+template <class T>
+double calcSignedArcLength(
+  const IndexedTrajectory<T> & trajectory, const size_t src_idx,
+  const geometry_msgs::msg::Point & dst_point)
+{
+  return trajectory.calcSignedArcLength(src_idx, dst_point);
+}
+
+template <class T>
+double calcSignedArcLength(
+  const IndexedTrajectory<T> & trajectory, const geometry_msgs::msg::Point & src_point,
+  const geometry_msgs::msg::Point & dst_point)
+{
+  return trajectory.calcSignedArcLength(src_point, dst_point);
+}
+
+template <class T>
+double calcArcLength(const IndexedTrajectory<T> & trajectory)
+{
+  return trajectory.calcArcLength();
+}
+
+template <class T>
+std::optional<geometry_msgs::msg::Point> calcLongitudinalOffsetPoint(
+  const IndexedTrajectory<T> & trajectory, const size_t src_idx, const double offset,
+  const bool throw_exception = false)
+{
+  return trajectory.calcLongitudinalOffsetPoint(src_idx, offset, throw_exception);
+}
+
+extern template class IndexedTrajectory<std::vector<autoware_auto_planning_msgs::msg::PathPoint>>;
+extern template class IndexedTrajectory<
+  std::vector<autoware_auto_planning_msgs::msg::PathPointWithLaneId>>;
+extern template class IndexedTrajectory<
+  std::vector<autoware_auto_planning_msgs::msg::TrajectoryPoint>>;
+}  // namespace motion_utils
+
+#endif  // MOTION_UTILS__TRAJECTORY__INDEXED_TRAJECTORY_HPP_
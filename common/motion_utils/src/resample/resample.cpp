@@ -21,6 +21,11 @@
 #include "motion_utils/trajectory/trajectory.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
 namespace motion_utils
 {
 std::vector<geometry_msgs::msg::Point> resamplePointVector(
@@ -77,11 +82,10 @@ std::vector<geometry_msgs::msg::Point> resamplePointVector(
 
   // Insert Position
   for (size_t i = 0; i < resampled_points.size(); ++i) {
-    geometry_msgs::msg::Point point;
+    auto & point = resampled_points.at(i);
     point.x = interpolated_x.at(i);
     point.y = interpolated_y.at(i);
     point.z = interpolated_z.at(i);
-    resampled_points.at(i) = point;
   }
 
   return resampled_points;
@@ -189,30 +193,35 @@ autoware_auto_planning_msgs::msg::PathWithLaneId resamplePath(
   auto resampling_arclength = resampled_arclength;
 
   // Add resampling_arclength to insert input points which have multiple lane_ids
+  // NOTE: The arc length to each point is accumulated in the same order as calcSignedArcLength
+  //       does from the front point, and the resampling interval containing it is found by a
+  //       binary search since resampling_arclength is sorted.
+  double distance_to_resampling_point = 0.0;
   for (size_t i = 0; i < input_path.points.size(); ++i) {
+    if (0 < i) {
+      distance_to_resampling_point += tier4_autoware_utils::calcDistance2d(
+        input_path.points.at(i - 1), input_path.points.at(i));
+    }
     if (input_path.points.at(i).lane_ids.size() < 2) {
       continue;
     }
 
-    const double distance_to_resampling_point = calcSignedArcLength(input_path.points, 0, i);
-    for (size_t j = 1; j < resampling_arclength.size(); ++j) {
-      if (
-        resampling_arclength.at(j - 1) <= distance_to_resampling_point &&
-        distance_to_resampling_point < resampling_arclength.at(j)) {
-        const double dist_to_prev_point =
-          std::fabs(distance_to_resampling_point - resampling_arclength.at(j - 1));
-        const double dist_to_following_point =
-          std::fabs(resampling_arclength.at(j) - distance_to_resampling_point);
-        if (dist_to_prev_point < motion_utils::overlap_threshold) {
-          resampling_arclength.at(j - 1) = distance_to_resampling_point;
-        } else if (dist_to_following_point < motion_utils::overlap_threshold) {
-          resampling_arclength.at(j) = distance_to_resampling_point;
-        } else {
-          resampling_arclength.insert(
-            resampling_arclength.begin() + j, distance_to_resampling_point);
-        }
-        break;
-      }
+    const auto next_itr = std::upper_bound(
+      resampling_arclength.begin(), resampling_arclength.end(), distance_to_resampling_point);
+    if (next_itr == resampling_arclength.begin() || next_itr == resampling_arclength.end()) {
+      continue;
+    }
+    const size_t j = std::distance(resampling_arclength.begin(), next_itr);
+    const double dist_to_prev_point =
+      std::fabs(distance_to_resampling_point - resampling_arclength.at(j - 1));
+    const double dist_to_following_point =
+      std::fabs(resampling_arclength.at(j) - distance_to_resampling_point);
+    if (dist_to_prev_point < motion_utils::overlap_threshold) {
+      resampling_arclength.at(j - 1) = distance_to_resampling_point;
+    } else if (dist_to_following_point < motion_utils::overlap_threshold) {
+      resampling_arclength.at(j) = distance_to_resampling_point;
+    } else {
+      resampling_arclength.insert(resampling_arclength.begin() + j, distance_to_resampling_point);
     }
   }
 
@@ -339,14 +348,13 @@ autoware_auto_planning_msgs::msg::PathWithLaneId resamplePath(
   resampled_path.right_bound = input_path.right_bound;
   resampled_path.points.resize(interpolated_pose.size());
   for (size_t i = 0; i < resampled_path.points.size(); ++i) {
-    autoware_auto_planning_msgs::msg::PathPoint path_point;
+    auto & path_point = resampled_path.points.at(i).point;
     path_point.pose = interpolated_pose.at(i);
     path_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
     path_point.lateral_velocity_mps = interpolated_v_lat.at(i);
     path_point.heading_rate_rps = interpolated_heading_rate.at(i);
     path_point.is_final = interpolated_is_final.at(i);
-    resampled_path.points.at(i).point = path_point;
-    resampled_path.points.at(i).lane_ids = interpolated_lane_ids.at(i);
+    resampled_path.points.at(i).lane_ids = std::move(interpolated_lane_ids.at(i));
   }
 
   return resampled_path;
@@ -489,12 +497,11 @@ autoware_auto_planning_msgs::msg::Path resamplePath(
   resampled_path.right_bound = input_path.right_bound;
   resampled_path.points.resize(interpolated_pose.size());
   for (size_t i = 0; i < resampled_path.points.size(); ++i) {
-    autoware_auto_planning_msgs::msg::PathPoint path_point;
+    auto & path_point = resampled_path.points.at(i);
     path_point.pose = interpolated_pose.at(i);
     path_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
     path_point.lateral_velocity_mps = interpolated_v_lat.at(i);
     path_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    resampled_path.points.at(i) = path_point;
   }
 
   return resampled_path;
@@ -650,7 +657,7 @@ autoware_auto_planning_msgs::msg::Trajectory resampleTrajectory(
   resampled_trajectory.header = input_trajectory.header;
   resampled_trajectory.points.resize(interpolated_pose.size());
   for (size_t i = 0; i < resampled_trajectory.points.size(); ++i) {
-    autoware_auto_planning_msgs::msg::TrajectoryPoint traj_point;
+    auto & traj_point = resampled_trajectory.points.at(i);
     traj_point.pose = interpolated_pose.at(i);
     traj_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
     traj_point.lateral_velocity_mps = interpolated_v_lat.at(i);
@@ -659,7 +666,6 @@ autoware_auto_planning_msgs::msg::Trajectory resampleTrajectory(
     traj_point.front_wheel_angle_rad = interpolated_front_wheel_angle.at(i);
     traj_point.rear_wheel_angle_rad = interpolated_rear_wheel_angle.at(i);
     traj_point.time_from_start = rclcpp::Duration::from_seconds(interpolated_time_from_start.at(i));
-    resampled_trajectory.points.at(i) = traj_point;
   }
 
   return resampled_trajectory;
@@ -0,0 +1,95 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_utils/trajectory/indexed_trajectory.hpp"
+#include "motion_utils/trajectory/trajectory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+using tier4_autoware_utils::createPoint;
+
+std::vector<TrajectoryPoint> generateTestPoints(const size_t num_points)
+{
+  std::vector<TrajectoryPoint> points;
+  double x = 0.0;
+  double y = 0.0;
+  for (size_t i = 0; i < num_points; ++i) {
+    const double theta = 0.01 * i;
+    TrajectoryPoint p;
+    p.pose.position = createPoint(x, y, 0.0);
+    points.push_back(p);
+    x += std::cos(theta);
+    y += std::sin(theta);
+  }
+  return points;
+}
+
+// compares the queries of a cycle on the points and on the view of them
+template <class Queries>
+void compare(const std::string & name, const size_t num_points, const Queries & queries)
+{
+  const auto points = generateTestPoints(num_points);
+
+  const auto start = std::chrono::steady_clock::now();
+  queries(points);
+  const auto middle = std::chrono::steady_clock::now();
+  queries(motion_utils::IndexedTrajectory<std::vector<TrajectoryPoint>>(points));
+  const auto end = std::chrono::steady_clock::now();
+
+  std::cout << name << " (" << num_points << " points): points "
+            << std::chrono::duration<double, std::milli>(middle - start).count()
+            << " [ms], IndexedTrajectory "
+            << std::chrono::duration<double, std::milli>(end - middle).count() << " [ms]"
+            << std::endl;
+}
+}  // namespace
+
+TEST(trajectory_benchmark, DISABLED_IndexedTrajectory)
+{
+  std::default_random_engine engine(0);
+  constexpr auto nb_iteration = 10000;
+
+  for (const size_t num_points : {100, 500, 1000, 2000}) {
+    std::uniform_real_distribution<double> dist(0.0, static_cast<double>(num_points));
+    std::vector<geometry_msgs::msg::Point> query_points;
+    for (auto i = 0; i < nb_iteration; ++i) {
+      query_points.push_back(createPoint(dist(engine), dist(engine) * 0.1, 0.0));
+    }
+
+    // NOTE: the queries are passed as a generic lambda to call the overloads of both types
+    compare("findNearestSegmentIndex", num_points, [&](const auto & trajectory) {
+      for (const auto & p : query_points) {
+        motion_utils::findNearestSegmentIndex(trajectory, p);
+      }
+    });
+    compare("calcSignedArcLength", num_points, [&](const auto & trajectory) {
+      for (size_t i = 0; i < query_points.size(); ++i) {
+        motion_utils::calcSignedArcLength(trajectory, i % num_points, num_points - 1);
+      }
+    });
+    compare("calcLongitudinalOffsetPoint", num_points, [&](const auto & trajectory) {
+      for (size_t i = 0; i < query_points.size(); ++i) {
+        motion_utils::calcLongitudinalOffsetPoint(trajectory, 0, query_points.at(i).x);
+      }
+    });
+  }
+}
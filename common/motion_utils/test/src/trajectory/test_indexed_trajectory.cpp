@@ -0,0 +1,120 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_utils/trajectory/indexed_trajectory.hpp"
+#include "motion_utils/trajectory/trajectory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+using motion_utils::IndexedTrajectory;
+using tier4_autoware_utils::createPoint;
+
+constexpr double epsilon = 1e-6;
+
+std::vector<TrajectoryPoint> generateTestPoints(
+  const size_t num_points, const double point_interval, const double delta_theta)
+{
+  std::vector<TrajectoryPoint> points;
+  double x = 0.0;
+  double y = 0.0;
+  for (size_t i = 0; i < num_points; ++i) {
+    const double theta = i * delta_theta;
+    TrajectoryPoint p;
+    p.pose.position = createPoint(x, y, 0.0);
+    p.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(theta);
+    points.push_back(p);
+    x += point_interval * std::cos(theta);
+    y += point_interval * std::sin(theta);
+  }
+  return points;
+}
+}  // namespace
+
+TEST(indexed_trajectory, sameAsTrajectoryFunctions)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> dist(-20.0, 120.0);
+
+  auto points = generateTestPoints(100, 1.0, 0.05);
+  // overlapping points
+  points.insert(points.begin() + 50, points.at(50));
+  points.insert(points.begin() + 50, points.at(50));
+  const IndexedTrajectory<std::vector<TrajectoryPoint>> trajectory(points);
+
+  EXPECT_NEAR(trajectory.calcArcLength(), motion_utils::calcArcLength(points), epsilon);
+
+  for (int i = 0; i < 1000; ++i) {
+    const auto p = createPoint(dist(engine), dist(engine), 0.0);
+    EXPECT_EQ(trajectory.findNearestIndex(p), motion_utils::findNearestIndex(points, p));
+    EXPECT_EQ(
+      trajectory.findNearestSegmentIndex(p), motion_utils::findNearestSegmentIndex(points, p));
+
+    const size_t idx = i % points.size();
+    EXPECT_NEAR(
+      trajectory.calcSignedArcLength(p, idx), motion_utils::calcSignedArcLength(points, p, idx),
+      epsilon);
+    const auto q = createPoint(dist(engine), dist(engine), 0.0);
+    EXPECT_NEAR(
+      trajectory.calcSignedArcLength(p, q), motion_utils::calcSignedArcLength(points, p, q),
+      epsilon);
+
+    const double offset = dist(engine) - 50.0;
+    const auto offset_point = trajectory.calcLongitudinalOffsetPoint(idx, offset);
+    const auto expected_offset_point =
+      motion_utils::calcLongitudinalOffsetPoint(points, idx, offset);
+    ASSERT_EQ(offset_point.has_value(), expected_offset_point.has_value());
+    if (offset_point) {
+      EXPECT_NEAR(offset_point->x, expected_offset_point->x, epsilon);
+      EXPECT_NEAR(offset_point->y, expected_offset_point->y, epsilon);
+    }
+  }
+
+  // the segment at the overlapping points ends at the first different point
+  const auto p = createPoint(dist(engine), dist(engine), 0.0);
+  EXPECT_DOUBLE_EQ(
+    trajectory.calcLongitudinalOffsetToSegment(50, p),
+    motion_utils::calcLongitudinalOffsetToSegment(points, 50, p));
+  EXPECT_TRUE(std::isnan(trajectory.calcLongitudinalOffsetToSegment(points.size() - 1, p)));
+  EXPECT_THROW(
+    trajectory.calcLongitudinalOffsetToSegment(points.size() - 1, p, true), std::out_of_range);
+}
+
+TEST(indexed_trajectory, overloads)
+{
+  const auto points = generateTestPoints(10, 1.0, 0.0);
+  const IndexedTrajectory<std::vector<TrajectoryPoint>> trajectory(points);
+
+  const auto p = createPoint(3.4, 1.0, 0.0);
+  EXPECT_EQ(motion_utils::findNearestIndex(trajectory, p), 3U);
+  EXPECT_EQ(motion_utils::findNearestSegmentIndex(trajectory, p), 3U);
+  EXPECT_NEAR(motion_utils::calcSignedArcLength(trajectory, 2, 7), 5.0, epsilon);
+  EXPECT_NEAR(motion_utils::calcSignedArcLength(trajectory, 7, 2), -5.0, epsilon);
+  EXPECT_NEAR(motion_utils::calcSignedArcLength(trajectory, p, 5), 1.6, epsilon);
+  EXPECT_NEAR(motion_utils::calcArcLength(trajectory), 9.0, epsilon);
+  EXPECT_NEAR(motion_utils::calcLongitudinalOffsetPoint(trajectory, 2, 2.5)->x, 4.5, epsilon);
+  EXPECT_NEAR(motion_utils::calcLongitudinalOffsetPoint(trajectory, 2, -1.5)->x, 0.5, epsilon);
+  EXPECT_FALSE(motion_utils::calcLongitudinalOffsetPoint(trajectory, 2, 10.0));
+  EXPECT_FALSE(motion_utils::calcLongitudinalOffsetPoint(trajectory, 2, -3.0));
+
+  const std::vector<TrajectoryPoint> empty_points;
+  const IndexedTrajectory<std::vector<TrajectoryPoint>> empty_trajectory(empty_points);
+  EXPECT_THROW(empty_trajectory.findNearestIndex(p), std::invalid_argument);
+  EXPECT_DOUBLE_EQ(empty_trajectory.calcArcLength(), 0.0);
+}
@@ -20,6 +20,7 @@
 #include "object_recognition_utils/matching.hpp"
 #include "object_recognition_utils/object_classification.hpp"
 #include "object_recognition_utils/predicted_path_utils.hpp"
+#include "object_recognition_utils/spatial_grid.hpp"
 #include "object_recognition_utils/transform.hpp"
 
 #endif  // OBJECT_RECOGNITION_UTILS__OBJECT_RECOGNITION_UTILS_HPP_
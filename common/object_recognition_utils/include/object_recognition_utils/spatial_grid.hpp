@@ -0,0 +1,92 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBJECT_RECOGNITION_UTILS__SPATIAL_GRID_HPP_
+#define OBJECT_RECOGNITION_UTILS__SPATIAL_GRID_HPP_
+
+#include <geometry_msgs/msg/point.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace object_recognition_utils
+{
+/**
+ * @brief uniform grid of indexed 2d positions to find the ones within the cell size of a position
+ * @details this is the spatial pre-gate of the data associations, whose cell size is the largest
+ * distance gate, so that not all the pairs of the objects are evaluated
+ */
+class SpatialGrid
+{
+public:
+  explicit SpatialGrid(const double cell_size) : cell_size_(cell_size) {}
+
+  // the positions not finite are not inserted
+  void insert(const geometry_msgs::msg::Point & position, const size_t index)
+  {
+    if (!isFinite(position)) {
+      return;
+    }
+    cells_[toKey(toCellIndex(position.x), toCellIndex(position.y))].push_back(index);
+  }
+
+  /**
+   * @brief call func with the indices in the 3x3 cells around the position, a superset of the
+   * ones within the cell size of it
+   */
+  template <class F>
+  void forEachNeighbor(const geometry_msgs::msg::Point & position, F && func) const
+  {
+    if (!isFinite(position)) {
+      return;
+    }
+    const int64_t center_x = toCellIndex(position.x);
+    const int64_t center_y = toCellIndex(position.y);
+    for (int64_t x = center_x - 1; x <= center_x + 1; ++x) {
+      for (int64_t y = center_y - 1; y <= center_y + 1; ++y) {
+        const auto cell = cells_.find(toKey(x, y));
+        if (cell == cells_.end()) {
+          continue;
+        }
+        for (const size_t index : cell->second) {
+          func(index);
+        }
+      }
+    }
+  }
+
+  static bool isFinite(const geometry_msgs::msg::Point & position)
+  {
+    return std::isfinite(position.x) && std::isfinite(position.y);
+  }
+
+private:
+  int64_t toCellIndex(const double coordinate) const
+  {
+    return static_cast<int64_t>(std::floor(coordinate / cell_size_));
+  }
+  static uint64_t toKey(const int64_t x, const int64_t y)
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(y));
+  }
+
+  const double cell_size_;
+  std::unordered_map<uint64_t, std::vector<size_t>> cells_;
+};
+}  // namespace object_recognition_utils
+
+#endif  // OBJECT_RECOGNITION_UTILS__SPATIAL_GRID_HPP_
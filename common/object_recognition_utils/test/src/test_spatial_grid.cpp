@@ -0,0 +1,83 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "object_recognition_utils/spatial_grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+geometry_msgs::msg::Point createPoint(const double x, const double y)
+{
+  return geometry_msgs::build<geometry_msgs::msg::Point>().x(x).y(y).z(0.0);
+}
+
+std::vector<size_t> findNeighbors(
+  const object_recognition_utils::SpatialGrid & grid, const geometry_msgs::msg::Point & position)
+{
+  std::vector<size_t> indices;
+  grid.forEachNeighbor(position, [&](const size_t index) { indices.push_back(index); });
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+}  // namespace
+
+TEST(spatial_grid, test_forEachNeighbor)
+{
+  using object_recognition_utils::SpatialGrid;
+
+  {  // all the objects within the cell size are found
+    SpatialGrid grid(2.0);
+    const std::vector<geometry_msgs::msg::Point> positions{
+      createPoint(0.0, 0.0), createPoint(1.9, 0.0), createPoint(-1.5, -1.2),
+      createPoint(0.5, 1.99), createPoint(-3.9, 1.0)};
+    for (size_t i = 0; i < positions.size(); ++i) {
+      grid.insert(positions.at(i), i);
+    }
+    const auto query = createPoint(0.1, 0.1);
+    const auto indices = findNeighbors(grid, query);
+    for (size_t i = 0; i < positions.size(); ++i) {
+      const double dist =
+        std::hypot(positions.at(i).x - query.x, positions.at(i).y - query.y);
+      if (dist <= 2.0) {
+        EXPECT_TRUE(std::binary_search(indices.begin(), indices.end(), i));
+      }
+    }
+  }
+
+  {  // the objects out of the neighbor cells are not found
+    SpatialGrid grid(1.0);
+    grid.insert(createPoint(0.5, 0.5), 0);
+    grid.insert(createPoint(10.5, 0.5), 1);
+    grid.insert(createPoint(-5.5, -5.5), 2);
+    EXPECT_EQ(findNeighbors(grid, createPoint(0.0, 0.0)), std::vector<size_t>({0}));
+    EXPECT_EQ(findNeighbors(grid, createPoint(-5.0, -6.0)), std::vector<size_t>({2}));
+    EXPECT_TRUE(findNeighbors(grid, createPoint(5.0, 0.0)).empty());
+  }
+
+  {  // non-finite positions
+    SpatialGrid grid(1.0);
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    grid.insert(createPoint(nan, 0.0), 0);
+    grid.insert(createPoint(0.0, 0.0), 1);
+    EXPECT_TRUE(findNeighbors(grid, createPoint(0.0, nan)).empty());
+    EXPECT_EQ(findNeighbors(grid, createPoint(0.0, 0.0)), std::vector<size_t>({1}));
+  }
+
+}
@@ -0,0 +1,301 @@
+// Copyright 2024 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// compares setting up the workspace from the dense matrices at every cycle with updating the
+// values of the CSC matrices in place, on the QPs shaped as the ones of the optimizers using
+// OSQPInterface: the condensed MPC of mpc_lateral_controller, the MPT of
+// obstacle_avoidance_planner, the elastic band of path_smoother and the velocity smoothers of
+// motion_velocity_smoother
+
+#include "osqp_interface/osqp_interface.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using autoware::common::osqp::calCSCMatrix;
+using autoware::common::osqp::calCSCMatrixTrapezoidal;
+using autoware::common::osqp::INF;
+using autoware::common::osqp::OSQPInterface;
+
+struct Problem
+{
+  Eigen::SparseMatrix<double> P;
+  Eigen::SparseMatrix<double> A;
+  std::vector<double> q;
+  std::vector<double> l;
+  std::vector<double> u;
+};
+
+using Triplets = std::vector<Eigen::Triplet<double>>;
+
+Eigen::SparseMatrix<double> toSparseMatrix(const int rows, const int cols, const Triplets & vec)
+{
+  Eigen::SparseMatrix<double> mat(rows, cols);
+  mat.setFromTriplets(vec.begin(), vec.end());
+  return mat;
+}
+
+// adds the weighted squared k-th order differences of the n variables from offset to P
+void addDifferenceCost(
+  const int n, const int offset, const int order, const double weight, Triplets & P_vec)
+{
+  // coefficients of the first and second order differences
+  const std::vector<double> coeffs = order == 1 ? std::vector<double>{-1.0, 1.0}
+                                                : std::vector<double>{1.0, -2.0, 1.0};
+  const int width = static_cast<int>(coeffs.size());
+  for (int i = 0; i + width <= n; ++i) {
+    for (int r = 0; r < width; ++r) {
+      for (int c = 0; c < width; ++c) {
+        P_vec.emplace_back(offset + i + r, offset + i + c, weight * coeffs[r] * coeffs[c]);
+      }
+    }
+  }
+}
+
+// condensed MPC: dense hessian of the steering inputs with the limits of their values and rates
+Problem buildMpcProblem(const int n, const int cycle)
+{
+  const double curvature = 0.05 * std::sin(0.1 * cycle);
+
+  Triplets P_vec;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      // the lateral errors of the later steps depend on all the previous inputs
+      const double dt_sum = 0.1 * (n - std::max(i, j));
+      P_vec.emplace_back(i, j, dt_sum * dt_sum + (i == j ? 1.0 : 0.0));
+    }
+  }
+
+  Triplets A_vec;
+  for (int i = 0; i < n; ++i) {
+    A_vec.emplace_back(i, i, 1.0);
+  }
+  for (int i = 0; i + 1 < n; ++i) {
+    A_vec.emplace_back(n + i, i, -1.0);
+    A_vec.emplace_back(n + i, i + 1, 1.0);
+  }
+
+  Problem problem;
+  problem.P = toSparseMatrix(n, n, P_vec);
+  problem.A = toSparseMatrix(2 * n - 1, n, A_vec);
+  problem.q.resize(n);
+  for (int i = 0; i < n; ++i) {
+    problem.q.at(i) = -curvature * (n - i);
+  }
+  problem.l.assign(n, -0.7);
+  problem.u.assign(n, 0.7);
+  problem.l.resize(2 * n - 1, -0.05);
+  problem.u.resize(2 * n - 1, 0.05);
+  return problem;
+}
+
+// MPT: the lateral and yaw errors and the steering inputs bound by the state equation
+Problem buildMptProblem(const int n, const int cycle)
+{
+  constexpr int D_x = 2;
+  const int N_x = D_x * n;
+  const int N_u = n - 1;
+  const double ds = 1.0;
+
+  Triplets P_vec;
+  for (int i = 0; i < n; ++i) {
+    P_vec.emplace_back(i * D_x, i * D_x, 1.0);
+    P_vec.emplace_back(i * D_x + 1, i * D_x + 1, 0.1);
+  }
+  addDifferenceCost(N_u, N_x, 1, 10.0, P_vec);
+  for (int i = 0; i < N_u; ++i) {
+    P_vec.emplace_back(N_x + i, N_x + i, 1.0);
+  }
+
+  Triplets A_vec;
+  std::vector<double> bounds(N_x, 0.0);
+  for (int i = 0; i < n; ++i) {
+    A_vec.emplace_back(i * D_x, i * D_x, 1.0);
+    A_vec.emplace_back(i * D_x + 1, i * D_x + 1, 1.0);
+    if (i == 0) {
+      continue;
+    }
+    // the values of the linearized model vary with the curvature of the reference path
+    const double curvature = 0.1 * std::sin(0.1 * (cycle + i));
+    A_vec.emplace_back(i * D_x, (i - 1) * D_x, -1.0);
+    A_vec.emplace_back(i * D_x, (i - 1) * D_x + 1, -ds);
+    A_vec.emplace_back(i * D_x + 1, (i - 1) * D_x + 1, -1.0);
+    A_vec.emplace_back(i * D_x + 1, N_x + i - 1, -ds / std::pow(std::cos(curvature), 2));
+    bounds.at(i * D_x + 1) = -curvature * ds;
+  }
+  for (int i = 0; i < n; ++i) {
+    A_vec.emplace_back(N_x + i, i * D_x, 1.0);
+  }
+  for (int i = 0; i < N_u; ++i) {
+    A_vec.emplace_back(N_x + n + i, N_x + i, 1.0);
+  }
+
+  Problem problem;
+  problem.P = toSparseMatrix(N_x + N_u, N_x + N_u, P_vec);
+  problem.A = toSparseMatrix(N_x + n + N_u, N_x + N_u, A_vec);
+  problem.q.assign(N_x + N_u, 0.0);
+  problem.l = bounds;
+  problem.u = bounds;
+  problem.l.resize(N_x + n, -1.0);
+  problem.u.resize(N_x + n, 1.0);
+  problem.l.resize(N_x + n + N_u, -0.7);
+  problem.u.resize(N_x + n + N_u, 0.7);
+  problem.l.front() = problem.u.front() = 0.2 * std::sin(0.1 * cycle);
+  return problem;
+}
+
+// elastic band: the smoothness of the x and y of the points moving within their boxes
+Problem buildElasticBandProblem(const int n, const int cycle)
+{
+  Triplets P_vec;
+  addDifferenceCost(n, 0, 2, 1.0, P_vec);
+  addDifferenceCost(n, n, 2, 1.0, P_vec);
+
+  Triplets A_vec;
+  for (int i = 0; i < 2 * n; ++i) {
+    A_vec.emplace_back(i, i, 1.0);
+  }
+
+  Problem problem;
+  problem.P = toSparseMatrix(2 * n, 2 * n, P_vec);
+  problem.A = toSparseMatrix(2 * n, 2 * n, A_vec);
+  problem.q.assign(2 * n, 0.0);
+  problem.l.resize(2 * n);
+  problem.u.resize(2 * n);
+  for (int i = 0; i < n; ++i) {
+    const double y = std::sin(0.2 * i + 0.05 * cycle);
+    problem.l.at(i) = problem.u.at(i) = static_cast<double>(i);
+    problem.l.at(n + i) = y - 0.5;
+    problem.u.at(n + i) = y + 0.5;
+  }
+  return problem;
+}
+
+// velocity smoother: the squared velocities and accelerations with the jerk and the slack costs
+Problem buildVelocitySmootherProblem(const int n, const int cycle)
+{
+  const double ds = 1.0;
+
+  Triplets P_vec;
+  addDifferenceCost(n, n, 1, 1.0 / (ds * ds), P_vec);
+  for (int i = 0; i < n; ++i) {
+    P_vec.emplace_back(2 * n + i, 2 * n + i, 1000.0);
+  }
+
+  Triplets A_vec;
+  for (int i = 0; i < n; ++i) {
+    // velocity limit with slack
+    A_vec.emplace_back(i, i, 1.0);
+    A_vec.emplace_back(i, 2 * n + i, -1.0);
+    // acceleration limit
+    A_vec.emplace_back(n + i, n + i, 1.0);
+  }
+  for (int i = 0; i + 1 < n; ++i) {
+    // b' = 2a
+    A_vec.emplace_back(2 * n + i, i, -1.0 / ds);
+    A_vec.emplace_back(2 * n + i, i + 1, 1.0 / ds);
+    A_vec.emplace_back(2 * n + i, n + i, -2.0);
+  }
+
+  Problem problem;
+  problem.P = toSparseMatrix(3 * n, 3 * n, P_vec);
+  problem.A = toSparseMatrix(3 * n - 1, 3 * n, A_vec);
+  problem.q.assign(3 * n, 0.0);
+  problem.l.assign(3 * n - 1, 0.0);
+  problem.u.assign(3 * n - 1, 0.0);
+  for (int i = 0; i < n; ++i) {
+    const double v_max = 10.0 + 3.0 * std::sin(0.1 * (i + cycle));
+    problem.q.at(i) = -1.0;
+    problem.l.at(i) = -INF;
+    problem.u.at(i) = v_max * v_max;
+    problem.l.at(n + i) = -1.0;
+    problem.u.at(n + i) = 1.0;
+  }
+  return problem;
+}
+
+struct Result
+{
+  double dense_ms{0.0};
+  double csc_ms{0.0};
+  double max_diff{0.0};
+};
+
+Result run(
+  const std::function<Problem(int, int)> & build_problem, const int n, const int cycles_num)
+{
+  Result result;
+  OSQPInterface dense_solver(1e-6);
+  OSQPInterface csc_solver(1e-6);
+  for (int cycle = 0; cycle < cycles_num; ++cycle) {
+    const Problem problem = build_problem(n, cycle);
+
+    // NOTE: the matrix conversions are included since the optimizers convert them every cycle
+    auto start = std::chrono::steady_clock::now();
+    dense_solver.initializeProblem(
+      Eigen::MatrixXd(problem.P), Eigen::MatrixXd(problem.A), problem.q, problem.l, problem.u);
+    const auto dense_solution = std::get<0>(dense_solver.optimize());
+    auto end = std::chrono::steady_clock::now();
+    result.dense_ms += std::chrono::duration<double, std::milli>(end - start).count();
+
+    start = std::chrono::steady_clock::now();
+    csc_solver.updateCscProblem(
+      calCSCMatrixTrapezoidal(problem.P), calCSCMatrix(problem.A), problem.q, problem.l,
+      problem.u);
+    const auto csc_solution = std::get<0>(csc_solver.optimize());
+    end = std::chrono::steady_clock::now();
+    result.csc_ms += std::chrono::duration<double, std::milli>(end - start).count();
+
+    for (size_t i = 0; i < dense_solution.size(); ++i) {
+      result.max_diff =
+        std::max(result.max_diff, std::abs(dense_solution.at(i) - csc_solution.at(i)));
+    }
+  }
+  return result;
+}
+}  // namespace
+
+int main(int argc, char * argv[])
+{
+  const int n = argc > 1 ? std::atoi(argv[1]) : 100;
+  const int cycles_num = argc > 2 ? std::atoi(argv[2]) : 100;
+
+  const std::vector<std::pair<std::string, std::function<Problem(int, int)>>> problems{
+    {"mpc", buildMpcProblem},
+    {"mpt", buildMptProblem},
+    {"elastic_band", buildElasticBandProblem},
+    {"velocity_smoother", buildVelocitySmootherProblem}};
+
+  std::cout << n << " points x " << cycles_num << " cycles" << std::endl;
+  for (const auto & [name, build_problem] : problems) {
+    const auto result = run(build_problem, n, cycles_num);
+    std::cout << name << ": initializeProblem " << result.dense_ms / cycles_num
+              << " [ms/cycle], updateCscProblem " << result.csc_ms / cycles_num
+              << " [ms/cycle], max solution difference " << result.max_diff << std::endl;
+  }
+  return 0;
+}
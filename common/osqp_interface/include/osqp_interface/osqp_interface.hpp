@@ -54,6 +54,11 @@ private:
   bool m_work_initialized = false;
   // Exitflag
   int64_t m_exitflag;
+  // Sparsity pattern of P and A in the current work, with which the values can be updated in place
+  std::vector<c_int> m_P_row_idxs;
+  std::vector<c_int> m_P_col_idxs;
+  std::vector<c_int> m_A_row_idxs;
+  std::vector<c_int> m_A_col_idxs;
 
   // Runs the solver on the stored problem.
   std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t> solve();
@@ -135,6 +140,25 @@ public:
     CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
     const std::vector<double> & u);
 
+  /// \brief Updates the values of the problem in place if P and A have the same sparsity pattern
+  /// as the current work, otherwise sets up the workspace object again.
+  /// \details The solution of the previous optimization is kept for warm start when updated in
+  /// place. The sparsity pattern includes the explicit zeros of the CSC matrices, so the callers
+  /// should build them with a pattern depending only on the structure of the problem, e.g. with
+  /// calCSCMatrix() for Eigen::SparseMatrix.
+  /// \param P (n,n) upper trapezoidal CSC matrix defining relations between parameters.
+  /// \param A (m,n) CSC matrix defining parameter constraints relative to the lower and upper
+  /// bound.
+  /// \param q (n) vector defining the linear cost of the problem.
+  /// \param l (m) vector defining the lower bound problem constraint.
+  /// \param u (m) vector defining the upper bound problem constraint.
+  /// \return exit flag of the setup or the update (0 if succeeded)
+  int64_t updateCscProblem(
+    const CSC_Matrix & P, const CSC_Matrix & A, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u);
+  /// \brief Whether P and A have the same sparsity pattern as the current work
+  bool isSameSparsityPattern(const CSC_Matrix & P, const CSC_Matrix & A) const;
+
   // Setter functions for warm start
   bool setWarmStart(
     const std::vector<double> & primal_variables, const std::vector<double> & dual_variables);
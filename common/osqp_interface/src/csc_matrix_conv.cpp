@@ -18,6 +18,7 @@
 #include <Eigen/SparseCore>
 
 #include <exception>
+#include <stdexcept>
 #include <iostream>
 #include <vector>
 
@@ -115,6 +116,63 @@ CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat)
   return csc_matrix;
 }
 
+CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat)
+{
+  const size_t elem = static_cast<size_t>(mat.nonZeros());
+
+  std::vector<c_float> vals;
+  vals.reserve(elem);
+  std::vector<c_int> row_idxs;
+  row_idxs.reserve(elem);
+  std::vector<c_int> col_idxs;
+  col_idxs.reserve(static_cast<size_t>(mat.outerSize()) + 1);
+
+  col_idxs.push_back(0);
+
+  // NOTE: Eigen::SparseMatrix<double> is column major, so that its outer index is the column
+  for (Eigen::Index j = 0; j < mat.outerSize(); j++) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, j); it; ++it) {
+      vals.push_back(it.value());
+      row_idxs.push_back(it.row());
+    }
+    col_idxs.push_back(static_cast<c_int>(vals.size()));
+  }
+
+  return CSC_Matrix{vals, row_idxs, col_idxs};
+}
+
+CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat)
+{
+  if (mat.rows() != mat.cols()) {
+    throw std::invalid_argument("Matrix must be square (n, n)");
+  }
+
+  const size_t elem = static_cast<size_t>(mat.nonZeros());
+
+  std::vector<c_float> vals;
+  vals.reserve(elem);
+  std::vector<c_int> row_idxs;
+  row_idxs.reserve(elem);
+  std::vector<c_int> col_idxs;
+  col_idxs.reserve(static_cast<size_t>(mat.outerSize()) + 1);
+
+  col_idxs.push_back(0);
+
+  for (Eigen::Index j = 0; j < mat.outerSize(); j++) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, j); it; ++it) {
+      if (it.row() > j) {
+        // the row indices are sorted in each column of a compressed matrix
+        break;
+      }
+      vals.push_back(it.value());
+      row_idxs.push_back(it.row());
+    }
+    col_idxs.push_back(static_cast<c_int>(vals.size()));
+  }
+
+  return CSC_Matrix{vals, row_idxs, col_idxs};
+}
+
 void printCSCMatrix(const CSC_Matrix & csc_mat)
 {
   std::cout << "[";
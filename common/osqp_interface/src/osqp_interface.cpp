@@ -360,9 +360,46 @@ int64_t OSQPInterface::initializeProblem(
   m_work.reset(workspace);
   m_work_initialized = true;
 
+  m_P_row_idxs = P_csc.m_row_idxs;
+  m_P_col_idxs = P_csc.m_col_idxs;
+  m_A_row_idxs = A_csc.m_row_idxs;
+  m_A_col_idxs = A_csc.m_col_idxs;
+
+  return m_exitflag;
+}
+
+int64_t OSQPInterface::updateCscProblem(
+  const CSC_Matrix & P_csc, const CSC_Matrix & A_csc, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  if (
+    !isSameSparsityPattern(P_csc, A_csc) || static_cast<int64_t>(q.size()) != m_param_n ||
+    static_cast<c_int>(l.size()) != m_data->m || static_cast<c_int>(u.size()) != m_data->m) {
+    return initializeProblem(P_csc, A_csc, q, l, u);
+  }
+
+  // NOTE: osqp_update_P_A updates the factorization of the KKT matrix only once for P and A.
+  c_int exitflag = osqp_update_P_A(
+    m_work.get(), P_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(P_csc.m_vals.size()),
+    A_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(A_csc.m_vals.size()));
+  if (exitflag == 0) {
+    exitflag = osqp_update_lin_cost(m_work.get(), q.data());
+  }
+  if (exitflag == 0) {
+    exitflag = osqp_update_bounds(m_work.get(), l.data(), u.data());
+  }
+  m_exitflag = exitflag;
+
   return m_exitflag;
 }
 
+bool OSQPInterface::isSameSparsityPattern(const CSC_Matrix & P_csc, const CSC_Matrix & A_csc) const
+{
+  return m_work_initialized && P_csc.m_row_idxs == m_P_row_idxs &&
+         P_csc.m_col_idxs == m_P_col_idxs && A_csc.m_row_idxs == m_A_row_idxs &&
+         A_csc.m_col_idxs == m_A_col_idxs;
+}
+
 std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t>
 OSQPInterface::solve()
 {
@@ -16,6 +16,7 @@
 #include "osqp_interface/csc_matrix_conv.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <string>
 #include <tuple>
@@ -164,6 +165,50 @@ TEST(TestCscMatrixConv, Trapezoidal)
     EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
   }
 }
+TEST(TestCscMatrixConv, Sparse)
+{
+  using autoware::common::osqp::calCSCMatrix;
+  using autoware::common::osqp::calCSCMatrixTrapezoidal;
+  using autoware::common::osqp::CSC_Matrix;
+
+  // same matrices as the dense ones, with the explicit zeros
+  Eigen::MatrixXd dense_rect(2, 4);
+  dense_rect << 1.0, 0.0, 3.0, 0.0, 0.0, 6.0, 7.0, 0.0;
+  Eigen::SparseMatrix<double> sparse_rect = dense_rect.sparseView();
+  const CSC_Matrix rect_m = calCSCMatrix(sparse_rect);
+  const CSC_Matrix dense_rect_m = calCSCMatrix(dense_rect);
+  EXPECT_EQ(rect_m.m_vals, dense_rect_m.m_vals);
+  EXPECT_EQ(rect_m.m_row_idxs, dense_rect_m.m_row_idxs);
+  EXPECT_EQ(rect_m.m_col_idxs, dense_rect_m.m_col_idxs);
+
+  sparse_rect.coeffRef(1, 3) = 0.0;
+  const CSC_Matrix rect_m_with_zero = calCSCMatrix(sparse_rect);
+  ASSERT_EQ(rect_m_with_zero.m_vals.size(), size_t(5));
+  EXPECT_EQ(rect_m_with_zero.m_vals[4], 0.0);
+  EXPECT_EQ(rect_m_with_zero.m_row_idxs[4], c_int(1));
+  EXPECT_EQ(rect_m_with_zero.m_col_idxs.back(), c_int(5));
+
+  Eigen::MatrixXd dense_square(3, 3);
+  dense_square << 0.0, 2.0, 0.0, 4.0, 5.0, 6.0, 0.0, 0.0, 0.0;
+  Eigen::SparseMatrix<double> sparse_square = dense_square.sparseView();
+  const CSC_Matrix square_m = calCSCMatrixTrapezoidal(sparse_square);
+  const CSC_Matrix dense_square_m = calCSCMatrixTrapezoidal(dense_square);
+  EXPECT_EQ(square_m.m_vals, dense_square_m.m_vals);
+  EXPECT_EQ(square_m.m_row_idxs, dense_square_m.m_row_idxs);
+  EXPECT_EQ(square_m.m_col_idxs, dense_square_m.m_col_idxs);
+
+  sparse_square.coeffRef(0, 0) = 0.0;
+  sparse_square.coeffRef(2, 0) = 0.0;
+  sparse_square.makeCompressed();
+  const CSC_Matrix square_m_with_zero = calCSCMatrixTrapezoidal(sparse_square);
+  ASSERT_EQ(square_m_with_zero.m_vals.size(), size_t(4));
+  EXPECT_EQ(square_m_with_zero.m_vals[0], 0.0);
+  EXPECT_EQ(square_m_with_zero.m_row_idxs[0], c_int(0));
+  EXPECT_EQ(square_m_with_zero.m_col_idxs[1], c_int(1));
+
+  const Eigen::SparseMatrix<double> sparse_rect_for_trapezoidal(1, 2);
+  EXPECT_THROW(calCSCMatrixTrapezoidal(sparse_rect_for_trapezoidal), std::invalid_argument);
+}
 TEST(TestCscMatrixConv, Print)
 {
   using autoware::common::osqp::calCSCMatrix;
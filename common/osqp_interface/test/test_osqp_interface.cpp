@@ -16,6 +16,7 @@
 #include "osqp_interface/osqp_interface.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <tuple>
 #include <vector>
@@ -160,5 +161,49 @@ TEST(TestOsqpInterface, BasicQp)
     check_result(result);
     EXPECT_EQ(osqp.getTakenIter(), 1);
   }
+
+  // update problem in place
+  {
+    std::tuple<std::vector<double>, std::vector<double>, int, int, int> result;
+    // Initial problem whose zeros are dropped from the sparsity pattern
+    const Eigen::MatrixXd P_ini = (Eigen::MatrixXd(2, 2) << 2, 0, 0, 2).finished();
+    const Eigen::MatrixXd A_ini = (Eigen::MatrixXd(4, 2) << 1, 1, 1, 0, 0, 1, 0, 0).finished();
+    std::vector<double> q_ini(2, 0.0);
+    std::vector<double> l_ini(4, 0.0);
+    std::vector<double> u_ini(4, 0.0);
+    autoware::common::osqp::OSQPInterface osqp;
+    EXPECT_EQ(
+      osqp.updateCscProblem(
+        calCSCMatrixTrapezoidal(P_ini), calCSCMatrix(A_ini), q_ini, l_ini, u_ini),
+      0);
+    osqp.optimize();
+
+    // The problem of a different sparsity pattern sets up the workspace again
+    const Eigen::SparseMatrix<double> P_sparse = P.sparseView();
+    const Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+    CSC_Matrix P_csc = calCSCMatrixTrapezoidal(P_sparse);
+    CSC_Matrix A_csc = calCSCMatrix(A_sparse);
+    EXPECT_FALSE(osqp.isSameSparsityPattern(P_csc, A_csc));
+    EXPECT_EQ(osqp.updateCscProblem(P_csc, A_csc, q, l, u), 0);
+    result = osqp.optimize();
+    check_result(result);
+
+    // The problem with the explicit zeros has the same sparsity pattern
+    Eigen::SparseMatrix<double> P_ini_sparse = P_ini.sparseView();
+    Eigen::SparseMatrix<double> A_ini_sparse = A_ini.sparseView();
+    P_ini_sparse.coeffRef(0, 1) = 0.0;
+    A_ini_sparse.coeffRef(3, 1) = 0.0;
+    CSC_Matrix P_ini_csc = calCSCMatrixTrapezoidal(P_ini_sparse);
+    CSC_Matrix A_ini_csc = calCSCMatrix(A_ini_sparse);
+    EXPECT_TRUE(osqp.isSameSparsityPattern(P_ini_csc, A_ini_csc));
+    EXPECT_EQ(osqp.updateCscProblem(P_ini_csc, A_ini_csc, q_ini, l_ini, u_ini), 0);
+    osqp.optimize();
+
+    // Update the values of the problem in place
+    EXPECT_TRUE(osqp.isSameSparsityPattern(P_csc, A_csc));
+    EXPECT_EQ(osqp.updateCscProblem(P_csc, A_csc, q, l, u), 0);
+    result = osqp.optimize();
+    check_result(result);
+  }
 }
 }  // namespace
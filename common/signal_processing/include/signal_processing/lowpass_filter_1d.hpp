@@ -17,6 +17,10 @@
 
 #include <boost/optional.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace signal_processing
 {
 double lowpassFilter(const double current_val, const double prev_val, const double gain);
@@ -42,4 +46,34 @@ public:
   double filter(const double u);
 };
 
+/**
+ * @class First-order low-pass filters of many channels with the same gain
+ * @brief filtering values of all the channels at once, with the states stored contiguously so that
+ * the update of the channels can be vectorized
+ */
+class LowpassFilterBank1d
+{
+private:
+  std::vector<double> x_;                //!< @brief current filtered values
+  std::vector<std::uint8_t> has_value_;  //!< @brief whether each channel has a filtered value
+  double gain_;                          //!< @brief gain value of first-order low-pass filter
+
+public:
+  LowpassFilterBank1d(const std::size_t size, const double gain);
+
+  std::size_t size() const;
+
+  void reset();
+  void reset(const std::size_t idx);
+  void reset(const std::size_t idx, const double x);
+
+  boost::optional<double> getValue(const std::size_t idx) const;
+  /**
+   * @brief filter the input of all the channels
+   * @param u input of each channel, with the same size as the filter bank
+   * @return filtered value of each channel, the input for a channel without any value
+   */
+  const std::vector<double> & filter(const std::vector<double> & u);
+};
+
 #endif  // SIGNAL_PROCESSING__LOWPASS_FILTER_1D_HPP_
@@ -14,6 +14,10 @@
 
 #include "signal_processing/lowpass_filter_1d.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
 namespace signal_processing
 {
 double lowpassFilter(const double current_val, const double prev_val, const double gain)
@@ -52,3 +56,57 @@ double LowpassFilter1d::filter(const double u)
   x_ = u;
   return x_.get();
 }
+
+LowpassFilterBank1d::LowpassFilterBank1d(const std::size_t size, const double gain)
+: x_(size, 0.0), has_value_(size, 0), gain_(gain)
+{
+}
+
+std::size_t LowpassFilterBank1d::size() const
+{
+  return x_.size();
+}
+
+void LowpassFilterBank1d::reset()
+{
+  std::fill(has_value_.begin(), has_value_.end(), 0);
+}
+
+void LowpassFilterBank1d::reset(const std::size_t idx)
+{
+  has_value_.at(idx) = 0;
+}
+
+void LowpassFilterBank1d::reset(const std::size_t idx, const double x)
+{
+  x_.at(idx) = x;
+  has_value_.at(idx) = 1;
+}
+
+boost::optional<double> LowpassFilterBank1d::getValue(const std::size_t idx) const
+{
+  if (has_value_.at(idx)) {
+    return x_.at(idx);
+  }
+  return {};
+}
+
+const std::vector<double> & LowpassFilterBank1d::filter(const std::vector<double> & u)
+{
+  if (u.size() != x_.size()) {
+    throw std::invalid_argument("LowpassFilterBank1d: the input size differs from the bank size");
+  }
+
+  // NOTE: The channel without any value is selected without a branch, so that the loop is
+  //       vectorized.
+  const std::size_t size = x_.size();
+  double * x = x_.data();
+  std::uint8_t * has_value = has_value_.data();
+  const double * u_ptr = u.data();
+  for (std::size_t i = 0; i < size; ++i) {
+    const double filtered = gain_ * x[i] + (1.0 - gain_) * u_ptr[i];
+    x[i] = has_value[i] ? filtered : u_ptr[i];
+    has_value[i] = 1;
+  }
+  return x_;
+}
@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include <stdexcept>
+
 constexpr double epsilon = 1e-6;
 
 TEST(lowpass_filter_1d, filter)
@@ -41,3 +43,39 @@ TEST(lowpass_filter_1d, filter)
   EXPECT_NEAR(lowpass_filter_1d.filter(0.0), -0.11, epsilon);
   EXPECT_NEAR(*lowpass_filter_1d.getValue(), -0.11, epsilon);
 }
+
+TEST(lowpass_filter_bank_1d, filter)
+{
+  LowpassFilterBank1d lowpass_filter_bank_1d(3, 0.1);
+  LowpassFilter1d lowpass_filter_1d(0.1);
+  EXPECT_EQ(lowpass_filter_bank_1d.size(), 3u);
+
+  // initial state
+  EXPECT_EQ(lowpass_filter_bank_1d.getValue(0), boost::none);
+
+  // same result as the 1d filter for each channel
+  lowpass_filter_bank_1d.reset(2, -1.1);
+  lowpass_filter_1d.reset(-1.1);
+  for (const double u : {0.0, 1.0, 2.0}) {
+    const auto & values = lowpass_filter_bank_1d.filter({u, 2.0 * u, u});
+    const double value = lowpass_filter_1d.filter(u);
+    ASSERT_EQ(values.size(), 3u);
+    EXPECT_NEAR(values.at(2), value, epsilon);
+  }
+  EXPECT_NEAR(*lowpass_filter_bank_1d.getValue(0), 1.89, epsilon);
+  EXPECT_NEAR(*lowpass_filter_bank_1d.getValue(1), 3.78, epsilon);
+
+  // reset a single channel
+  lowpass_filter_bank_1d.reset(1);
+  EXPECT_EQ(lowpass_filter_bank_1d.getValue(1), boost::none);
+  EXPECT_NEAR(*lowpass_filter_bank_1d.getValue(0), 1.89, epsilon);
+  EXPECT_NEAR(lowpass_filter_bank_1d.filter({0.0, 5.0, 0.0}).at(1), 5.0, epsilon);
+
+  // reset all the channels
+  lowpass_filter_bank_1d.reset();
+  EXPECT_EQ(lowpass_filter_bank_1d.getValue(0), boost::none);
+  EXPECT_EQ(lowpass_filter_bank_1d.getValue(2), boost::none);
+
+  // invalid input size
+  EXPECT_THROW(lowpass_filter_bank_1d.filter({0.0}), std::invalid_argument);
+}
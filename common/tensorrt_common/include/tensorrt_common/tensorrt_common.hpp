@@ -62,6 +62,9 @@ struct BuildConfig
   // clip value for implicit quantization
   double clip_value;  // For implicit quantization
 
+  // flag for replaying the inference as a CUDA graph
+  bool use_cuda_graph;
+
   // Supported calibration type
   const std::array<std::string, 4> valid_calib_type = {"Entropy", "Legacy", "Percentile", "MinMax"};
 
@@ -71,20 +74,23 @@ struct BuildConfig
     quantize_first_layer(false),
     quantize_last_layer(false),
     profile_per_layer(false),
-    clip_value(0.0)
+    clip_value(0.0),
+    use_cuda_graph(false)
   {
   }
 
   explicit BuildConfig(
     const std::string & calib_type_str, const int dla_core_id = -1,
     const bool quantize_first_layer = false, const bool quantize_last_layer = false,
-    const bool profile_per_layer = false, const double clip_value = 0.0)
+    const bool profile_per_layer = false, const double clip_value = 0.0,
+    const bool use_cuda_graph = false)
   : calib_type_str(calib_type_str),
     dla_core_id(dla_core_id),
     quantize_first_layer(quantize_first_layer),
     quantize_last_layer(quantize_last_layer),
     profile_per_layer(profile_per_layer),
-    clip_value(clip_value)
+    clip_value(clip_value),
+    use_cuda_graph(use_cuda_graph)
   {
     if (
       std::find(valid_calib_type.begin(), valid_calib_type.end(), calib_type_str) ==
@@ -185,6 +191,16 @@ public:
   nvinfer1::Dims getBindingDimensions(const int32_t index) const;
   int32_t getNbBindings();
   bool setBindingDimensions(const int32_t index, const nvinfer1::Dims & dimensions) const;
+
+  /**
+   * @brief enqueue inference on the stream
+   * @param[in] bindings device buffers of the bindings
+   * @param[in] stream CUDA stream
+   * @param[in] input_consumed event which is signaled when the inputs can be refilled
+   * @note If use_cuda_graph is set in BuildConfig, the inference is captured into a CUDA graph at
+   * the first call and the graph is replayed after that. It is captured again when the bindings or
+   * the input dimensions are changed.
+   */
   bool enqueueV2(void ** bindings, cudaStream_t stream, cudaEvent_t * input_consumed);
 
   /**
@@ -220,6 +236,29 @@ private:
   SimpleProfiler host_profiler_;
 
   std::unique_ptr<const BuildConfig> build_config_;
+
+  /**
+   * @brief launch the captured CUDA graph, which is captured again if it is outdated
+   */
+  bool launchGraph(void ** bindings, cudaStream_t stream);
+
+  /**
+   * @brief check whether the captured CUDA graph is for the bindings and the current dimensions
+   */
+  bool isGraphValid(void ** bindings) const;
+
+  /**
+   * @brief destroy the captured CUDA graph
+   */
+  void destroyGraph();
+
+  // CUDA graph of the inference
+  cudaGraphExec_t graph_exec_{nullptr};
+  // bindings and input dimensions which the graph is captured for
+  std::vector<void *> graph_bindings_;
+  std::vector<nvinfer1::Dims> graph_dims_;
+  // flag whether capturing is failed, in which case the inference is not captured anymore
+  bool graph_failed_{false};
 };
 
 }  // namespace tensorrt_common
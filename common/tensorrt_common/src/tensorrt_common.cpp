@@ -16,7 +16,9 @@
 
 #include <NvInferPlugin.h>
 #include <dlfcn.h>
+#include <unistd.h>
 
+#include <algorithm>
 #include <fstream>
 #include <functional>
 #include <iostream>
@@ -129,6 +131,7 @@ TrtCommon::TrtCommon(
 
 TrtCommon::~TrtCommon()
 {
+  destroyGraph();
 }
 
 void TrtCommon::setup()
@@ -180,10 +183,20 @@ void TrtCommon::setup()
     // Output Network Information
     printNetworkInfo(model_file_path_);
 
-    if (fs::exists(cache_engine_path)) {
+    // NOTE: The cached engine is rebuilt if the model is updated after it was built, or if it
+    //       cannot be deserialized, e.g. it was built by another TensorRT version or GPU.
+    bool is_engine_loaded = false;
+    if (
+      fs::exists(cache_engine_path) &&
+      fs::last_write_time(cache_engine_path) >= fs::last_write_time(model_file_path_)) {
       std::cout << "Loading... " << cache_engine_path << std::endl;
-      loadEngine(cache_engine_path);
-    } else {
+      is_engine_loaded = loadEngine(cache_engine_path);
+      if (!is_engine_loaded) {
+        logger_.log(
+          nvinfer1::ILogger::Severity::kWARNING, "Fail to load the cached engine, rebuilding it");
+      }
+    }
+    if (!is_engine_loaded) {
       std::cout << "Building... " << cache_engine_path << std::endl;
       logger_.log(nvinfer1::ILogger::Severity::kINFO, "Start build engine");
       auto log_thread = logger_.log_throttle(
@@ -199,6 +212,12 @@ void TrtCommon::setup()
     return;
   }
 
+  if (!engine_) {
+    logger_.log(nvinfer1::ILogger::Severity::kERROR, "Fail to load or build engine");
+    is_initialized_ = false;
+    return;
+  }
+
   context_ = TrtUniquePtr<nvinfer1::IExecutionContext>(engine_->createExecutionContext());
   if (!context_) {
     logger_.log(nvinfer1::ILogger::Severity::kERROR, "Fail to create context");
@@ -225,13 +244,16 @@ void TrtCommon::setup()
 
 bool TrtCommon::loadEngine(const std::string & engine_file_path)
 {
-  std::ifstream engine_file(engine_file_path);
+  std::ifstream engine_file(engine_file_path, std::ios::binary);
+  if (!engine_file.is_open()) {
+    return false;
+  }
   std::stringstream engine_buffer;
   engine_buffer << engine_file.rdbuf();
   std::string engine_str = engine_buffer.str();
   engine_ = TrtUniquePtr<nvinfer1::ICudaEngine>(runtime_->deserializeCudaEngine(
     reinterpret_cast<const void *>(engine_str.data()), engine_str.size()));
-  return true;
+  return engine_ != nullptr;
 }
 
 void TrtCommon::printNetworkInfo(const std::string & onnx_file_path)
@@ -447,6 +469,20 @@ bool TrtCommon::buildEngineFromOnnx(
     }
   }
 
+  if (build_config_->dla_core_id != -1) {
+    // NOTE: The layers the DLA cannot run fall back to the GPU, so that the count is reported
+    //       to see how much of the model is actually offloaded from the GPU.
+    int num_dla_layers = 0;
+    for (int i = 0; i < num; i++) {
+      if (config->canRunOnDLA(network->getLayer(i))) {
+        num_dla_layers++;
+      }
+    }
+    std::cout << "###" << num_dla_layers << " of " << num << " layers run on DLA core "
+              << build_config_->dla_core_id << ", " << num - num_dla_layers
+              << " layers fall back to GPU ###" << std::endl;
+  }
+
   const auto input = network->getInput(0);
   const auto input_dims = input->getDimensions();
   const auto input_channel = input_dims.d[1];
@@ -517,8 +553,12 @@ bool TrtCommon::buildEngineFromOnnx(
 #if TENSORRT_VERSION_MAJOR < 8
   auto data = TrtUniquePtr<nvinfer1::IHostMemory>(engine_->serialize());
 #endif
+  // NOTE: The engine is written to a temporary file and renamed, so that an interrupted write
+  //       does not leave a broken cache, and other processes never read a partial engine.
+  const std::string tmp_engine_file_path =
+    output_engine_file_path + ".tmp" + std::to_string(getpid());
   std::ofstream file;
-  file.open(output_engine_file_path, std::ios::binary | std::ios::out);
+  file.open(tmp_engine_file_path, std::ios::binary | std::ios::out);
   if (!file.is_open()) {
     return false;
   }
@@ -529,6 +569,14 @@ bool TrtCommon::buildEngineFromOnnx(
 #endif
 
   file.close();
+  std::error_code error_code;
+  if (!file.fail()) {
+    fs::rename(tmp_engine_file_path, output_engine_file_path, error_code);
+  }
+  if (file.fail() || error_code) {
+    fs::remove(tmp_engine_file_path, error_code);
+    return false;
+  }
 
   return true;
 }
@@ -568,6 +616,14 @@ bool TrtCommon::setBindingDimensions(const int32_t index, const nvinfer1::Dims &
 
 bool TrtCommon::enqueueV2(void ** bindings, cudaStream_t stream, cudaEvent_t * input_consumed)
 {
+  // NOTE: The profiler measures the host time of each enqueue, and the event is not recorded by a
+  //       graph, so the graph is used only without them.
+  if (
+    build_config_->use_cuda_graph && !build_config_->profile_per_layer &&
+    input_consumed == nullptr && !graph_failed_) {
+    return launchGraph(bindings, stream);
+  }
+
   if (build_config_->profile_per_layer) {
     auto inference_start = std::chrono::high_resolution_clock::now();
 
@@ -583,6 +639,82 @@ bool TrtCommon::enqueueV2(void ** bindings, cudaStream_t stream, cudaEvent_t * i
   }
 }
 
+bool TrtCommon::launchGraph(void ** bindings, cudaStream_t stream)
+{
+  if (graph_exec_ && isGraphValid(bindings)) {
+    return cudaGraphLaunch(graph_exec_, stream) == cudaSuccess;
+  }
+  destroyGraph();
+
+  // TensorRT may allocate resources at the first inference after the dimensions are changed, which
+  // cannot be captured, so infer once without capturing
+  if (!context_->enqueueV2(bindings, stream, nullptr)) {
+    return false;
+  }
+
+  cudaGraph_t graph = nullptr;
+  bool captured = cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal) == cudaSuccess;
+  if (captured) {
+    const bool enqueued = context_->enqueueV2(bindings, stream, nullptr);
+    captured = cudaStreamEndCapture(stream, &graph) == cudaSuccess && enqueued;
+  }
+  if (captured) {
+    captured = cudaGraphInstantiateWithFlags(&graph_exec_, graph, 0) == cudaSuccess;
+  }
+  if (graph) {
+    cudaGraphDestroy(graph);
+  }
+  if (!captured) {
+    // Clear the error of the failed capture so that it is not reported by the following calls
+    cudaGetLastError();
+    graph_exec_ = nullptr;
+    graph_failed_ = true;
+    logger_.log(
+      nvinfer1::ILogger::Severity::kWARNING,
+      "Failed to capture the inference into a CUDA graph, so it is enqueued without the graph");
+    return true;
+  }
+
+  const int32_t nb_bindings = engine_->getNbBindings();
+  graph_bindings_.assign(bindings, bindings + nb_bindings);
+  graph_dims_.clear();
+  for (int32_t i = 0; i < nb_bindings; ++i) {
+    graph_dims_.push_back(context_->getBindingDimensions(i));
+  }
+  // The inference of this call has already been enqueued without the graph
+  return true;
+}
+
+bool TrtCommon::isGraphValid(void ** bindings) const
+{
+  const auto nb_bindings = static_cast<size_t>(engine_->getNbBindings());
+  if (graph_bindings_.size() != nb_bindings || graph_dims_.size() != nb_bindings) {
+    return false;
+  }
+  for (size_t i = 0; i < nb_bindings; ++i) {
+    if (graph_bindings_[i] != bindings[i]) {
+      return false;
+    }
+    const auto dims = context_->getBindingDimensions(static_cast<int32_t>(i));
+    if (
+      dims.nbDims != graph_dims_[i].nbDims ||
+      !std::equal(dims.d, dims.d + dims.nbDims, graph_dims_[i].d)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void TrtCommon::destroyGraph()
+{
+  if (graph_exec_) {
+    cudaGraphExecDestroy(graph_exec_);
+    graph_exec_ = nullptr;
+  }
+  graph_bindings_.clear();
+  graph_dims_.clear();
+}
+
 void TrtCommon::printProfiling()
 {
   std::cout << host_profiler_;
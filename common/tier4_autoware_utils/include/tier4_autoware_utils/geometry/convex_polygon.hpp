@@ -0,0 +1,70 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__GEOMETRY__CONVEX_POLYGON_HPP_
+#define TIER4_AUTOWARE_UTILS__GEOMETRY__CONVEX_POLYGON_HPP_
+
+#include "tier4_autoware_utils/geometry/boost_geometry.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+namespace tier4_autoware_utils
+{
+/**
+ * @brief convex polygon whose vertices are stored in a fixed-capacity array without the
+ * duplicated closing point, so that it can be built and checked without heap allocations
+ */
+class ConvexPolygon2d
+{
+public:
+  static constexpr size_t max_vertices_num = 32;
+
+  /// @brief create a convex polygon from the outer ring of a polygon
+  /// @return std::nullopt if the polygon is not convex, has inner rings or too many vertices
+  static std::optional<ConvexPolygon2d> create(const Polygon2d & polygon);
+
+  size_t size() const { return size_; }
+  const Point2d & at(const size_t i) const { return vertices_.at(i); }
+  const Point2d & operator[](const size_t i) const { return vertices_[i]; }
+
+private:
+  ConvexPolygon2d() = default;
+
+  std::array<Point2d, max_vertices_num> vertices_;
+  size_t size_{0};
+};
+
+/// @brief check if the polygon is convex, ignoring the collinear vertices
+bool isConvex(const Polygon2d & polygon);
+
+/// @brief check if the polygons intersect by the separating axis theorem
+/// @details the touching polygons intersect as in boost::geometry::intersects()
+bool intersects(const ConvexPolygon2d & polygon1, const ConvexPolygon2d & polygon2);
+
+/// @brief calculate the distance between the polygons, which is 0 if they intersect
+double distance(const ConvexPolygon2d & polygon1, const ConvexPolygon2d & polygon2);
+
+/// @brief check if the inner polygon is within the outer polygon, including the boundary
+bool within(const ConvexPolygon2d & inner_polygon, const ConvexPolygon2d & outer_polygon);
+
+// NOTE: The following functions use the kernels of ConvexPolygon2d when both polygons are
+//       convex, and fall back on boost::geometry otherwise.
+bool intersects(const Polygon2d & polygon1, const Polygon2d & polygon2);
+double distance(const Polygon2d & polygon1, const Polygon2d & polygon2);
+bool within(const Polygon2d & inner_polygon, const Polygon2d & outer_polygon);
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__GEOMETRY__CONVEX_POLYGON_HPP_
@@ -0,0 +1,94 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__GEOMETRY__FOOTPRINT_SWEEP_HPP_
+#define TIER4_AUTOWARE_UTILS__GEOMETRY__FOOTPRINT_SWEEP_HPP_
+
+#include "tier4_autoware_utils/geometry/boost_geometry.hpp"
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+
+#include <geometry_msgs/msg/pose.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+/// @brief transform the footprint in the local coordinate to the pose, rotating by the matrix
+/// calculated once for the pose
+LinearRing2d transformFootprint(
+  const LinearRing2d & local_footprint, const geometry_msgs::msg::Pose & pose);
+
+/**
+ * @brief footprints of the vehicle swept along the poses of a trajectory
+ * @details The footprint on each pose and the step polygon, which is the convex hull of the two
+ * adjacent footprints, are calculated once, so that the collision checks of the trajectory share
+ * them. The steps are indexed by their envelopes in an R-tree, and only the steps whose envelope
+ * overlaps the query are tested with the exact geometry.
+ */
+class FootprintSweep
+{
+public:
+  /// @param times time of each pose from the start, which is used only by the time-aware queries
+  /// @throws std::invalid_argument if the times are given but their size differs from the poses
+  FootprintSweep(
+    const LinearRing2d & local_footprint, const std::vector<geometry_msgs::msg::Pose> & poses,
+    const std::vector<double> & times = {});
+
+  const std::vector<LinearRing2d> & footprints() const { return footprints_; }
+
+  /// @brief step polygons, whose i-th element covers the move from the i-th to the (i+1)-th pose
+  const std::vector<Polygon2d> & stepPolygons() const { return step_polygons_; }
+
+  /// @brief indices of the steps which contain the point, in ascending order
+  std::vector<size_t> findStepsContaining(const Point2d & point) const;
+
+  /// @brief indices of the steps which intersect the polygon, in ascending order
+  std::vector<size_t> findStepsIntersecting(const Polygon2d & polygon) const;
+
+  /// @brief indices of the steps which intersect the polygon and whose time interval overlaps
+  /// [min_time, max_time], in ascending order
+  /// @details This is used for the objects which occupy the polygon only during the interval,
+  /// e.g. a pose of the predicted path of an object.
+  /// @throws std::logic_error if the times of the poses are not given
+  std::vector<size_t> findStepsIntersecting(
+    const Polygon2d & polygon, const double min_time, const double max_time) const;
+
+private:
+  using StepRtree = boost::geometry::index::rtree<
+    std::pair<Box2d, size_t>, boost::geometry::index::rstar<16>>;
+
+  std::vector<LinearRing2d> footprints_;
+  std::vector<Polygon2d> step_polygons_;
+  std::vector<double> times_;
+  StepRtree step_rtree_;
+};
+
+/// @brief create the footprint sweep along the points which have a pose, e.g. TrajectoryPoint
+template <class T>
+FootprintSweep createFootprintSweep(const LinearRing2d & local_footprint, const T & points)
+{
+  std::vector<geometry_msgs::msg::Pose> poses;
+  poses.reserve(points.size());
+  for (const auto & point : points) {
+    poses.push_back(getPose(point));
+  }
+  return FootprintSweep(local_footprint, poses);
+}
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__GEOMETRY__FOOTPRINT_SWEEP_HPP_
@@ -444,6 +444,22 @@ Eigen::Vector3d inverseTransformPoint(
 geometry_msgs::msg::Point inverseTransformPoint(
   const geometry_msgs::msg::Point & point, const geometry_msgs::msg::Pose & pose);
 
+// Transform points given as x, y and z arrays in place
+// NOTE: the rotation matrix is computed once, so the loop over the points vectorizes
+void transformPoints(
+  const geometry_msgs::msg::Pose & pose, std::vector<double> & xs, std::vector<double> & ys,
+  std::vector<double> & zs);
+
+// Transform points given as x, y and z arrays in world coordinates to local coordinates in place
+void inverseTransformPoints(
+  const geometry_msgs::msg::Pose & pose, std::vector<double> & xs, std::vector<double> & ys,
+  std::vector<double> & zs);
+
+// Calculate the 2d distances from points given as x and y arrays to the segment p1-p2
+void calcDistancesToSegment2d(
+  const geometry_msgs::msg::Point & p1, const geometry_msgs::msg::Point & p2,
+  const std::vector<double> & xs, const std::vector<double> & ys, std::vector<double> & distances);
+
 double calcCurvature(
   const geometry_msgs::msg::Point & p1, const geometry_msgs::msg::Point & p2,
   const geometry_msgs::msg::Point & p3);
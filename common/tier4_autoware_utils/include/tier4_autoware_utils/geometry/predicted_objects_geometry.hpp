@@ -0,0 +1,97 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__GEOMETRY__PREDICTED_OBJECTS_GEOMETRY_HPP_
+#define TIER4_AUTOWARE_UTILS__GEOMETRY__PREDICTED_OBJECTS_GEOMETRY_HPP_
+
+#include "tier4_autoware_utils/geometry/boost_geometry.hpp"
+
+#include <autoware_auto_perception_msgs/msg/predicted_objects.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+/**
+ * @brief footprints of the predicted objects calculated once per message
+ * @details The current footprint of each object and its footprints along each predicted path at
+ * the fixed time steps are calculated once, so that the planning modules consuming the same
+ * message share them instead of converting the shapes and interpolating the paths by themselves.
+ * The footprints are indexed by their envelopes in an R-tree per time step. The object is
+ * immutable after the construction, and is meant to be shared by const shared_ptr.
+ */
+class PredictedObjectsGeometry
+{
+public:
+  /// @brief footprint of a predicted path of an object at a time step
+  struct PathFootprint
+  {
+    size_t object_index{};
+    size_t path_index{};
+    Polygon2d polygon{};
+    Box2d envelope{};
+  };
+
+  /// @param time_step interval of the time steps along the predicted paths [s]
+  /// @param time_horizon the last time step is not after it [s]
+  /// @throws std::invalid_argument if time_step is not positive or time_horizon is negative
+  PredictedObjectsGeometry(
+    const autoware_auto_perception_msgs::msg::PredictedObjects & objects, const double time_step,
+    const double time_horizon);
+
+  size_t objectNum() const { return footprints_.size(); }
+  double timeStep() const { return time_step_; }
+  size_t timeStepNum() const { return step_footprints_.size(); }
+
+  /// @brief footprint of the object at its current pose, same as toPolygon2d()
+  const Polygon2d & footprint(const size_t object_index) const
+  {
+    return footprints_.at(object_index);
+  }
+  const Box2d & envelope(const size_t object_index) const { return envelopes_.at(object_index); }
+
+  /// @brief footprints on all the predicted paths at the time step_index * timeStep()
+  /// @details the paths ending before the time have no footprint at the step
+  const std::vector<PathFootprint> & footprintsAt(const size_t step_index) const
+  {
+    return step_footprints_.at(step_index);
+  }
+
+  /// @brief indices of the objects whose current footprint intersects the polygon, in ascending
+  /// order
+  std::vector<size_t> findObjectsIntersecting(const Polygon2d & polygon) const;
+
+  /// @brief indices of the objects whose footprint on any predicted path at the time step
+  /// intersects the polygon, in ascending order
+  std::vector<size_t> findObjectsIntersecting(
+    const Polygon2d & polygon, const size_t step_index) const;
+
+private:
+  using Rtree =
+    boost::geometry::index::rtree<std::pair<Box2d, size_t>, boost::geometry::index::rstar<16>>;
+
+  double time_step_;
+  std::vector<Polygon2d> footprints_;
+  std::vector<Box2d> envelopes_;
+  Rtree rtree_;
+  std::vector<std::vector<PathFootprint>> step_footprints_;
+  std::vector<Rtree> step_rtrees_;
+};
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__GEOMETRY__PREDICTED_OBJECTS_GEOMETRY_HPP_
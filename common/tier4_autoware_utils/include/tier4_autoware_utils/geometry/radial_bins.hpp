@@ -0,0 +1,161 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__GEOMETRY__RADIAL_BINS_HPP_
+#define TIER4_AUTOWARE_UTILS__GEOMETRY__RADIAL_BINS_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+/**
+ * @brief stable counting sort of the element indices by their bins
+ * @details the elements whose bin index is not less than bins_num are dropped
+ * @param offsets start of each bin in order, with bins_num + 1 elements ending with the size of
+ * order
+ * @param order element indices sorted by their bins, keeping the element order in each bin
+ */
+template <typename BinIndexT, typename IndexT>
+void sortIndicesByBin(
+  const std::vector<BinIndexT> & bin_indices, const size_t bins_num, std::vector<size_t> & offsets,
+  std::vector<IndexT> & order)
+{
+  offsets.assign(bins_num + 1, 0);
+  for (const auto bin_index : bin_indices) {
+    if (static_cast<size_t>(bin_index) < bins_num) {
+      ++offsets[static_cast<size_t>(bin_index) + 1];
+    }
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  // NOTE: The start of each bin is moved to the start of the next bin while scattering, so that
+  //       the offsets are shifted back afterwards instead of copying them to cursors.
+  order.resize(offsets.back());
+  for (size_t i = 0; i < bin_indices.size(); ++i) {
+    const auto bin_index = static_cast<size_t>(bin_indices[i]);
+    if (bin_index < bins_num) {
+      order[offsets[bin_index]++] = static_cast<IndexT>(i);
+    }
+  }
+  std::copy_backward(offsets.begin(), offsets.end() - 1, offsets.end());
+  offsets.front() = 0;
+}
+
+/**
+ * @brief values divided into the azimuth bins of a polar grid and sorted in each bin, stored in
+ * one flat array
+ * @details the buffers are kept over reset(), so that a member instance does not allocate once
+ * it has seen the largest input
+ */
+template <typename T>
+class RadialBins
+{
+public:
+  template <typename U>
+  class BinView
+  {
+  public:
+    BinView(U * data, const size_t size) : data_(data), size_(size) {}
+
+    U * begin() const { return data_; }
+    U * end() const { return data_ + size_; }
+    U * data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    U & operator[](const size_t i) const { return data_[i]; }
+    U & front() const { return data_[0]; }
+    U & back() const { return data_[size_ - 1]; }
+
+  private:
+    U * data_;
+    size_t size_;
+  };
+  using Bin = BinView<T>;
+  using ConstBin = BinView<const T>;
+
+  /// @brief clear the values and set the number of the bins, all of which are empty until sort()
+  void reset(const size_t bins_num)
+  {
+    bins_num_ = bins_num;
+    offsets_.assign(bins_num + 1, 0);
+    values_.clear();
+    unsorted_values_.clear();
+    unsorted_bin_indices_.clear();
+  }
+
+  void reserve(const size_t values_num)
+  {
+    unsorted_values_.reserve(values_num);
+    unsorted_bin_indices_.reserve(values_num);
+  }
+
+  /// @brief add a value to a bin, the value is dropped in sort() if the bin is out of range
+  void push_back(const size_t bin_index, const T & value)
+  {
+    unsorted_values_.push_back(value);
+    unsorted_bin_indices_.push_back(bin_index);
+  }
+
+  /// @brief divide the added values into the bins and sort each bin by comp
+  /// @details the result is the same as filling a vector per bin in the order of push_back() and
+  /// sorting each of them by std::sort()
+  template <typename Compare>
+  void sort(Compare comp)
+  {
+    sortIndicesByBin(unsorted_bin_indices_, bins_num_, offsets_, order_);
+    values_.clear();
+    values_.reserve(order_.size());
+    for (const auto i : order_) {
+      values_.push_back(unsorted_values_[i]);
+    }
+    for (size_t bin_index = 0; bin_index < bins_num_; ++bin_index) {
+      std::sort(
+        values_.begin() + offsets_[bin_index], values_.begin() + offsets_[bin_index + 1], comp);
+    }
+  }
+
+  /// @brief the number of the bins
+  size_t size() const { return bins_num_; }
+
+  /// @brief the number of the values in all the bins
+  size_t valuesNum() const { return values_.size(); }
+
+  Bin operator[](const size_t bin_index)
+  {
+    return Bin(values_.data() + offsets_[bin_index], binSize(bin_index));
+  }
+  ConstBin operator[](const size_t bin_index) const
+  {
+    return ConstBin(values_.data() + offsets_[bin_index], binSize(bin_index));
+  }
+
+private:
+  size_t binSize(const size_t bin_index) const
+  {
+    return offsets_[bin_index + 1] - offsets_[bin_index];
+  }
+
+  size_t bins_num_{0};
+  std::vector<size_t> offsets_{0};
+  std::vector<T> values_;
+  std::vector<T> unsorted_values_;
+  std::vector<size_t> unsorted_bin_indices_;
+  std::vector<size_t> order_;
+};
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__GEOMETRY__RADIAL_BINS_HPP_
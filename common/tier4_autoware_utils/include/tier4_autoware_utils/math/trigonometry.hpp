@@ -16,6 +16,7 @@
 #define TIER4_AUTOWARE_UTILS__MATH__TRIGONOMETRY_HPP_
 
 #include <utility>
+#include <vector>
 
 namespace tier4_autoware_utils
 {
@@ -26,6 +27,17 @@ float cos(float radian);
 
 std::pair<float, float> sin_and_cos(float radian);
 
+// Batch version of sin_and_cos(), which gives the same values for each radian
+void sin_and_cos(
+  const std::vector<float> & radians, std::vector<float> & sins, std::vector<float> & coss);
+
+// Polynomial approximation of std::atan2() used in OpenCV, whose error is less than 2e-4 [rad]
+float opencv_fast_atan2(float dy, float dx);
+
+// Batch version of opencv_fast_atan2(), which is written without branches to be vectorized
+void opencv_fast_atan2(
+  const std::vector<float> & dys, const std::vector<float> & dxs, std::vector<float> & radians);
+
 }  // namespace tier4_autoware_utils
 
 #endif  // TIER4_AUTOWARE_UTILS__MATH__TRIGONOMETRY_HPP_
@@ -0,0 +1,61 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__ROS__LATEST_VALUE_MAILBOX_HPP_
+#define TIER4_AUTOWARE_UTILS__ROS__LATEST_VALUE_MAILBOX_HPP_
+
+#include <memory>
+
+namespace tier4_autoware_utils
+{
+
+/**
+ * @brief holder of the latest message shared between the subscription callbacks and the timer
+ * @details Any number of threads may store and read the message concurrently without a mutex of
+ * the node. Only the shared_ptr is swapped atomically and no lock is held while the message is
+ * used, so the message must not be modified once stored.
+ */
+template <typename T>
+class LatestValueMailbox
+{
+public:
+  using ConstSharedPtr = std::shared_ptr<const T>;
+
+  void store(const ConstSharedPtr & value)
+  {
+    std::atomic_store_explicit(&latest_value_, value, std::memory_order_release);
+    std::atomic_store_explicit(&new_value_, value, std::memory_order_release);
+  }
+
+  /// @brief get the latest value, which is nullptr until the first store()
+  ConstSharedPtr load() const
+  {
+    return std::atomic_load_explicit(&latest_value_, std::memory_order_acquire);
+  }
+
+  /// @brief get the value stored after the last call of takeNew(), or nullptr if there is none
+  ConstSharedPtr takeNew()
+  {
+    return std::atomic_exchange_explicit(
+      &new_value_, ConstSharedPtr{nullptr}, std::memory_order_acq_rel);
+  }
+
+private:
+  ConstSharedPtr latest_value_{nullptr};
+  ConstSharedPtr new_value_{nullptr};
+};
+
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__ROS__LATEST_VALUE_MAILBOX_HPP_
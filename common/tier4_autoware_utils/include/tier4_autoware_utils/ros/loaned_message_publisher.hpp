@@ -0,0 +1,58 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__ROS__LOANED_MESSAGE_PUBLISHER_HPP_
+#define TIER4_AUTOWARE_UTILS__ROS__LOANED_MESSAGE_PUBLISHER_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace tier4_autoware_utils
+{
+
+/**
+ * @brief publish the message with a loaned message of the middleware if it is available, or with
+ * the ownership of the message otherwise
+ * @details The middleware loans a message only for the fixed-size types, e.g. with the shared
+ * memory transport, and then the message is written into the loaned memory instead of being
+ * serialized. Otherwise the ownership is passed to the publisher, so the message is not copied
+ * for the intra-process subscriptions as it is with publish(const MessageT &).
+ * The message must not be used after this call, so the stamp for PublishedTimePublisher should be
+ * taken before it.
+ */
+template <class MessageT>
+void publishLoanedOrMoved(
+  const std::shared_ptr<rclcpp::Publisher<MessageT>> & publisher, std::unique_ptr<MessageT> msg)
+{
+  if (publisher->can_loan_messages()) {
+    auto loaned_msg = publisher->borrow_loaned_message();
+    loaned_msg.get() = std::move(*msg);
+    publisher->publish(std::move(loaned_msg));
+    return;
+  }
+  publisher->publish(std::move(msg));
+}
+
+template <class MessageT>
+void publishLoanedOrMoved(
+  const std::shared_ptr<rclcpp::Publisher<MessageT>> & publisher, MessageT && msg)
+{
+  publishLoanedOrMoved(publisher, std::make_unique<MessageT>(std::move(msg)));
+}
+
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__ROS__LOANED_MESSAGE_PUBLISHER_HPP_
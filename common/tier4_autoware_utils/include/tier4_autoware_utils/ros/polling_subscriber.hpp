@@ -20,30 +20,59 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace tier4_autoware_utils
 {
+namespace polling_subscriber_detail
+{
+/// @brief create the subscription whose callback is never executed, so the messages are taken
+template <typename T>
+typename rclcpp::Subscription<T>::SharedPtr createNoExecSubscription(
+  rclcpp::Node * node, const std::string & topic_name, const rclcpp::QoS & qos)
+{
+  auto noexec_callback_group =
+    node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive, false);
+  auto noexec_subscription_options = rclcpp::SubscriptionOptions();
+  noexec_subscription_options.callback_group = noexec_callback_group;
+
+  return node->create_subscription<T>(
+    topic_name, qos,
+    [node]([[maybe_unused]] const typename T::ConstSharedPtr msg) { assert(false); },
+    noexec_subscription_options);
+}
+
+/// @brief get the buffer to take a message into, reusing it if nobody else refers to it
+template <typename T>
+void prepareBuffer(std::shared_ptr<T> & buffer)
+{
+  // NOTE: The taken message is deserialized into the reused one, so the capacity of its arrays
+  //       is kept and the allocation is skipped unless the message grows.
+  if (!buffer || buffer.use_count() > 1) {
+    buffer = std::make_shared<T>();
+  }
+}
+}  // namespace polling_subscriber_detail
 
+/**
+ * @brief subscriber which takes the latest message when it is polled, e.g. in the timer callback
+ * @details The message of the previous takeData() is reused as the buffer of the next one once
+ * the caller releases it. It is not thread-safe, so it should be polled from one thread.
+ */
 template <typename T>
 class InterProcessPollingSubscriber
 {
 private:
   typename rclcpp::Subscription<T>::SharedPtr subscriber_;
   typename T::SharedPtr data_;
+  typename T::SharedPtr buffer_;
 
 public:
   explicit InterProcessPollingSubscriber(
     rclcpp::Node * node, const std::string & topic_name, const rclcpp::QoS & qos = rclcpp::QoS{1})
   {
-    auto noexec_callback_group =
-      node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive, false);
-    auto noexec_subscription_options = rclcpp::SubscriptionOptions();
-    noexec_subscription_options.callback_group = noexec_callback_group;
-
-    subscriber_ = node->create_subscription<T>(
-      topic_name, qos,
-      [node]([[maybe_unused]] const typename T::ConstSharedPtr msg) { assert(false); },
-      noexec_subscription_options);
+    subscriber_ = polling_subscriber_detail::createNoExecSubscription<T>(node, topic_name, qos);
     if (qos.get_rmw_qos_profile().depth > 1) {
       throw std::invalid_argument(
         "InterProcessPollingSubscriber will be used with depth > 1, which may cause inefficient "
@@ -52,17 +81,68 @@ public:
   };
   typename T::ConstSharedPtr takeData()
   {
-    auto new_data = std::make_shared<T>();
+    polling_subscriber_detail::prepareBuffer(buffer_);
     rclcpp::MessageInfo message_info;
-    const bool success = subscriber_->take(*new_data, message_info);
+    const bool success = subscriber_->take(*buffer_, message_info);
     if (success) {
-      data_ = new_data;
+      std::swap(data_, buffer_);
     }
 
     return data_;
   };
 };
 
+/**
+ * @brief subscriber which takes all the messages received since the last poll
+ * @details The messages are taken into a ring of the buffers preallocated with the depth of the
+ * QoS, and a buffer is reused once the caller releases the message taken into it. It is not
+ * thread-safe, so it should be polled from one thread.
+ */
+template <typename T>
+class InterProcessPollingBatchSubscriber
+{
+private:
+  typename rclcpp::Subscription<T>::SharedPtr subscriber_;
+  std::vector<typename T::SharedPtr> buffers_;
+  size_t next_buffer_index_{0};
+  std::vector<typename T::ConstSharedPtr> data_;
+
+public:
+  explicit InterProcessPollingBatchSubscriber(
+    rclcpp::Node * node, const std::string & topic_name, const rclcpp::QoS & qos)
+  {
+    const size_t depth = qos.get_rmw_qos_profile().depth;
+    if (qos.get_rmw_qos_profile().history == RMW_QOS_POLICY_HISTORY_KEEP_ALL || depth == 0) {
+      throw std::invalid_argument(
+        "InterProcessPollingBatchSubscriber needs the history of KeepLast with depth > 0 to "
+        "preallocate the buffers");
+    }
+    subscriber_ = polling_subscriber_detail::createNoExecSubscription<T>(node, topic_name, qos);
+    buffers_.resize(depth);
+    for (auto & buffer : buffers_) {
+      buffer = std::make_shared<T>();
+    }
+    data_.reserve(depth);
+  };
+
+  /// @brief take the messages received since the last call in the order of the reception
+  const std::vector<typename T::ConstSharedPtr> & takeAll()
+  {
+    data_.clear();
+    rclcpp::MessageInfo message_info;
+    while (data_.size() < buffers_.size()) {
+      auto & buffer = buffers_.at(next_buffer_index_);
+      polling_subscriber_detail::prepareBuffer(buffer);
+      if (!subscriber_->take(*buffer, message_info)) {
+        break;
+      }
+      data_.push_back(buffer);
+      next_buffer_index_ = (next_buffer_index_ + 1) % buffers_.size();
+    }
+    return data_;
+  };
+};
+
 }  // namespace tier4_autoware_utils
 
 #endif  // TIER4_AUTOWARE_UTILS__ROS__POLLING_SUBSCRIBER_HPP_
@@ -15,10 +15,14 @@
 #ifndef TIER4_AUTOWARE_UTILS__ROS__PROCESSING_TIME_PUBLISHER_HPP_
 #define TIER4_AUTOWARE_UTILS__ROS__PROCESSING_TIME_PUBLISHER_HPP_
 
+#include "tier4_autoware_utils/system/allocation_counter.hpp"
+#include "tier4_autoware_utils/system/time_keeper.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include <diagnostic_msgs/msg/diagnostic_status.hpp>
 
+#include <algorithm>
 #include <map>
 #include <sstream>
 #include <string>
@@ -50,6 +54,52 @@ public:
     pub_processing_time_->publish(status);
   }
 
+  /**
+   * @brief publish the last, mean, 50th and 99th percentile and max processing times of the spans
+   * @details With the allocation hook, the last and mean allocations of the spans and the live,
+   * peak and maximum resident memory of the process are published as well.
+   */
+  void publish(const TimeKeeper & time_keeper)
+  {
+    diagnostic_msgs::msg::DiagnosticStatus status;
+
+    const bool is_allocation_counted = allocation_counter::isEnabled();
+    for (const auto * span : time_keeper.getSpans()) {
+      const auto & histogram = span->histogram;
+      diagnostic_msgs::msg::KeyValue key_value;
+      key_value.key = span->path;
+      key_value.value = "last: " + to_string_with_precision(span->last_ms, 3) +
+                        ", mean: " + to_string_with_precision(histogram.mean(), 3) +
+                        ", p50: " + to_string_with_precision(histogram.percentile(50.0), 3) +
+                        ", p99: " + to_string_with_precision(histogram.percentile(99.0), 3) +
+                        ", max: " + to_string_with_precision(histogram.max(), 3);
+      if (is_allocation_counted) {
+        const double count = std::max(static_cast<double>(histogram.count()), 1.0);
+        const auto & total = span->total_allocations;
+        key_value.value +=
+          ", allocations: " + std::to_string(span->last_allocations.count) +
+          ", allocated_bytes: " + std::to_string(span->last_allocations.bytes) +
+          ", mean_allocations: " + to_string_with_precision(total.count / count, 1) +
+          ", mean_allocated_bytes: " + to_string_with_precision(total.bytes / count, 1);
+      }
+      status.values.push_back(key_value);
+    }
+
+    if (is_allocation_counted) {
+      const auto add_value = [&status](const std::string & key, const size_t value) {
+        diagnostic_msgs::msg::KeyValue key_value;
+        key_value.key = key;
+        key_value.value = std::to_string(value);
+        status.values.push_back(key_value);
+      };
+      add_value("live_heap_bytes", allocation_counter::getLiveBytes());
+      add_value("peak_heap_bytes", allocation_counter::getPeakLiveBytes());
+      add_value("max_resident_bytes", allocation_counter::getMaxResidentBytes());
+    }
+
+    pub_processing_time_->publish(status);
+  }
+
 private:
   rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticStatus>::SharedPtr pub_processing_time_;
 
@@ -24,15 +24,23 @@
 #include <tf2_ros/transform_listener.h>
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace tier4_autoware_utils
 {
 class TransformListener
 {
 public:
-  explicit TransformListener(rclcpp::Node * node)
-  : clock_(node->get_clock()), logger_(node->get_logger())
+  /**
+   * @param cache_static_transforms if true, the transforms found static are kept and returned
+   * without looking up the tf buffer again
+   */
+  explicit TransformListener(rclcpp::Node * node, const bool cache_static_transforms = false)
+  : clock_(node->get_clock()),
+    logger_(node->get_logger()),
+    cache_static_transforms_(cache_static_transforms)
   {
     tf_buffer_ = std::make_shared<tf2_ros::Buffer>(clock_);
     auto timer_interface = std::make_shared<tf2_ros::CreateTimerROS>(
@@ -44,6 +52,10 @@ public:
   geometry_msgs::msg::TransformStamped::ConstSharedPtr getLatestTransform(
     const std::string & from, const std::string & to)
   {
+    if (const auto static_tf = getStaticTransform(from, to)) {
+      return static_tf;
+    }
+
     geometry_msgs::msg::TransformStamped tf;
     try {
       tf = tf_buffer_->lookupTransform(from, to, tf2::TimePointZero);
@@ -53,13 +65,17 @@ public:
       return {};
     }
 
-    return std::make_shared<const geometry_msgs::msg::TransformStamped>(tf);
+    return cacheIfStatic(from, to, tf);
   }
 
   geometry_msgs::msg::TransformStamped::ConstSharedPtr getTransform(
     const std::string & from, const std::string & to, const rclcpp::Time & time,
     const rclcpp::Duration & duration)
   {
+    if (const auto static_tf = getStaticTransform(from, to)) {
+      return static_tf;
+    }
+
     geometry_msgs::msg::TransformStamped tf;
     try {
       tf = tf_buffer_->lookupTransform(from, to, time, duration);
@@ -69,14 +85,46 @@ public:
       return {};
     }
 
-    return std::make_shared<const geometry_msgs::msg::TransformStamped>(tf);
+    return cacheIfStatic(from, to, tf);
   }
 
   rclcpp::Logger getLogger() { return logger_; }
 
 private:
+  geometry_msgs::msg::TransformStamped::ConstSharedPtr getStaticTransform(
+    const std::string & from, const std::string & to)
+  {
+    if (!cache_static_transforms_) {
+      return {};
+    }
+    std::lock_guard<std::mutex> lock(static_transforms_mutex_);
+    const auto itr = static_transforms_.find(from + "\n" + to);
+    if (itr == static_transforms_.end()) {
+      return {};
+    }
+    return itr->second;
+  }
+
+  // NOTE: tf2 returns the time zero when all the links between the frames are static, so that
+  //       the transform is valid at any time and is cached.
+  geometry_msgs::msg::TransformStamped::ConstSharedPtr cacheIfStatic(
+    const std::string & from, const std::string & to,
+    const geometry_msgs::msg::TransformStamped & tf)
+  {
+    auto tf_ptr = std::make_shared<const geometry_msgs::msg::TransformStamped>(tf);
+    if (cache_static_transforms_ && rclcpp::Time(tf.header.stamp).nanoseconds() == 0) {
+      std::lock_guard<std::mutex> lock(static_transforms_mutex_);
+      static_transforms_[from + "\n" + to] = tf_ptr;
+    }
+    return tf_ptr;
+  }
+
   rclcpp::Clock::SharedPtr clock_;
   rclcpp::Logger logger_;
+  bool cache_static_transforms_;
+  std::mutex static_transforms_mutex_;
+  std::unordered_map<std::string, geometry_msgs::msg::TransformStamped::ConstSharedPtr>
+    static_transforms_;
   std::shared_ptr<tf2_ros::Buffer> tf_buffer_;
   std::shared_ptr<tf2_ros::TransformListener> tf_listener_;
 };
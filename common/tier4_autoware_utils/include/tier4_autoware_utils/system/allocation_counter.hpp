@@ -0,0 +1,83 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__SYSTEM__ALLOCATION_COUNTER_HPP_
+#define TIER4_AUTOWARE_UTILS__SYSTEM__ALLOCATION_COUNTER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tier4_autoware_utils
+{
+struct AllocationStats
+{
+  uint64_t count{0};
+  uint64_t bytes{0};
+};
+
+/**
+ * @brief counters of the heap allocations made through operator new
+ * @details The counters are incremented only by the operator new of the opt-in library
+ * tier4_autoware_utils_allocation_hook, which is linked to the executable or loaded with
+ * LD_PRELOAD. Without it, isEnabled() is false and all the counters stay 0.
+ * NOTE: Eigen allocates the dynamic matrices with malloc, which is not counted.
+ */
+namespace allocation_counter
+{
+bool isEnabled();
+
+/// @brief get the allocations made by the calling thread so far
+AllocationStats getThreadStats();
+
+/// @brief get the bytes allocated by all the threads and not freed yet
+size_t getLiveBytes();
+
+/// @brief get the peak of getLiveBytes() since the start or the last resetPeakLiveBytes()
+size_t getPeakLiveBytes();
+void resetPeakLiveBytes();
+
+/// @brief get the maximum resident set size of the process, which is available without the hook
+size_t getMaxResidentBytes();
+
+namespace detail
+{
+// called by the hook
+void enable();
+void onAllocate(const size_t bytes) noexcept;
+void onDeallocate(const size_t bytes) noexcept;
+}  // namespace detail
+}  // namespace allocation_counter
+
+/**
+ * @brief scope counting the allocations of the calling thread inside it
+ * @details A test marks a scope which must not allocate with it and expects getStats().count to
+ * be 0, which fails only when the hook is linked to the test.
+ */
+class AllocationScope
+{
+public:
+  AllocationScope() : start_(allocation_counter::getThreadStats()) {}
+
+  AllocationStats getStats() const
+  {
+    const auto stats = allocation_counter::getThreadStats();
+    return AllocationStats{stats.count - start_.count, stats.bytes - start_.bytes};
+  }
+
+private:
+  AllocationStats start_;
+};
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__SYSTEM__ALLOCATION_COUNTER_HPP_
@@ -0,0 +1,138 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__SYSTEM__TIME_KEEPER_HPP_
+#define TIER4_AUTOWARE_UTILS__SYSTEM__TIME_KEEPER_HPP_
+
+#include "tier4_autoware_utils/system/allocation_counter.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+/**
+ * @brief histogram of latencies with the buckets growing exponentially, as HdrHistogram does
+ * @details The latencies are recorded in microseconds. The ones less than 16 [us] have their own
+ * buckets, and each power of 2 above them is split into 8 buckets, so a percentile is given with
+ * a relative error less than 1/16 without storing the samples.
+ */
+class LatencyHistogram
+{
+public:
+  void record(const double latency_ms);
+  void reset();
+
+  size_t count() const { return count_; }
+  double mean() const { return count_ == 0 ? 0.0 : sum_ms_ / static_cast<double>(count_); }
+  double max() const { return max_ms_; }
+
+  /// @brief get the latency at the percentile, which is in [0, 100]
+  double percentile(const double percentile) const;
+
+private:
+  static constexpr size_t exact_buckets_num = 16;
+  static constexpr size_t sub_buckets_num = 8;
+  static constexpr size_t max_exponent = 40;
+  static constexpr size_t buckets_num = exact_buckets_num + (max_exponent - 3) * sub_buckets_num;
+
+  static size_t toBucketIndex(const uint64_t latency_us);
+  static double toBucketMiddleMs(const size_t bucket_index);
+
+  std::array<uint64_t, buckets_num> buckets_{};
+  size_t count_{0};
+  double sum_ms_{0.0};
+  double max_ms_{0.0};
+};
+
+/**
+ * @brief recorder of the processing times of nested spans
+ * @details The spans form a tree keyed by the names of their ancestors, and each span keeps the
+ * last duration and the histogram of the durations. The nodes are allocated only when a span is
+ * seen for the first time, so the recording does not allocate in the steady state.
+ * The allocations of the thread inside a span are recorded as well when the allocation hook is
+ * linked, see allocation_counter.
+ * A TimeKeeper is not thread-safe, so each thread should have its own.
+ */
+class TimeKeeper
+{
+public:
+  struct Span
+  {
+    std::string name;
+    std::string path;  // names of the ancestors and the span joined with "/"
+    size_t depth{0};
+    double last_ms{0.0};
+    LatencyHistogram histogram;
+    // including the allocations of the children
+    AllocationStats last_allocations{};
+    AllocationStats total_allocations{};
+  };
+
+  /// @brief scoped span, which ends when it is destructed
+  class ScopedSpan
+  {
+  public:
+    ScopedSpan(TimeKeeper & time_keeper, const std::string & name) : time_keeper_(time_keeper)
+    {
+      time_keeper_.start(name);
+    }
+    ~ScopedSpan() { time_keeper_.end(); }
+
+    ScopedSpan(const ScopedSpan &) = delete;
+    ScopedSpan & operator=(const ScopedSpan &) = delete;
+
+  private:
+    TimeKeeper & time_keeper_;
+  };
+
+  void start(const std::string & name);
+  void end();
+
+  /// @brief get the spans in depth-first order, which are the ones seen so far
+  std::vector<const Span *> getSpans() const;
+
+  /// @brief reset the histograms and the total allocations of all spans, keeping the tree
+  void resetHistograms();
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Node
+  {
+    Span span;
+    std::vector<size_t> children;
+  };
+
+  struct ActiveSpan
+  {
+    size_t node_index;
+    Clock::time_point start_time;
+    AllocationStats start_allocations;
+  };
+
+  void appendSpans(const std::vector<size_t> & node_indices, std::vector<const Span *> & spans)
+    const;
+
+  std::vector<Node> nodes_;
+  std::vector<size_t> roots_;
+  std::vector<ActiveSpan> active_spans_;
+};
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__SYSTEM__TIME_KEEPER_HPP_
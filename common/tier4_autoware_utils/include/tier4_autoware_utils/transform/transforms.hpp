@@ -18,9 +18,16 @@
 #include <Eigen/Core>
 #include <rclcpp/rclcpp.hpp>
 
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
 #include <pcl/common/transforms.h>
 #include <pcl/point_cloud.h>
 
+#include <cstdint>
+#include <cstring>
+#include <string>
+
 namespace tier4_autoware_utils
 {
 template <typename PointT>
@@ -46,6 +53,47 @@ void transformPointCloud(
     pcl::transformPointCloud(cloud_in, cloud_out, transform);
   }
 }
+
+/**
+ * @brief transform the x, y and z fields of the pointcloud in place without converting it to pcl
+ * @details the other fields are kept as they are
+ * @return false if the pointcloud does not have the x, y and z fields of FLOAT32
+ */
+inline bool transformPointCloud(
+  sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Matrix<float, 4, 4> & transform)
+{
+  using sensor_msgs::msg::PointField;
+  int offsets[3] = {-1, -1, -1};
+  const std::string names[3] = {"x", "y", "z"};
+  for (const auto & field : cloud.fields) {
+    for (size_t i = 0; i < 3; ++i) {
+      if (field.name == names[i] && field.datatype == PointField::FLOAT32) {
+        offsets[i] = static_cast<int>(field.offset);
+      }
+    }
+  }
+  if (offsets[0] < 0 || offsets[1] < 0 || offsets[2] < 0) {
+    return false;
+  }
+
+  const Eigen::Matrix3f rotation = transform.topLeftCorner<3, 3>();
+  const Eigen::Vector3f translation = transform.topRightCorner<3, 1>();
+  // NOTE: The values are copied with memcpy since the fields are not always aligned in the buffer.
+  for (size_t row = 0; row < cloud.height; ++row) {
+    uint8_t * data = cloud.data.data() + row * cloud.row_step;
+    for (size_t col = 0; col < cloud.width; ++col, data += cloud.point_step) {
+      Eigen::Vector3f point;
+      for (size_t i = 0; i < 3; ++i) {
+        std::memcpy(&point[i], data + offsets[i], sizeof(float));
+      }
+      const Eigen::Vector3f transformed = rotation * point + translation;
+      for (size_t i = 0; i < 3; ++i) {
+        std::memcpy(data + offsets[i], &transformed[i], sizeof(float));
+      }
+    }
+  }
+  return true;
+}
 }  // namespace tier4_autoware_utils
 
 #endif  // TIER4_AUTOWARE_UTILS__TRANSFORM__TRANSFORMS_HPP_
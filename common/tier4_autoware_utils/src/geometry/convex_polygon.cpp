@@ -0,0 +1,250 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/geometry/convex_polygon.hpp"
+
+#include "tier4_autoware_utils/math/constants.hpp"
+
+#include <boost/geometry/geometry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+namespace bg = boost::geometry;
+using tier4_autoware_utils::ConvexPolygon2d;
+using tier4_autoware_utils::Point2d;
+using tier4_autoware_utils::Polygon2d;
+
+double cross(const Point2d & o, const Point2d & a, const Point2d & b)
+{
+  return (a.x() - o.x()) * (b.y() - o.y()) - (a.y() - o.y()) * (b.x() - o.x());
+}
+
+// call back on the vertices of the outer ring, skipping the duplicated and the closing points
+template <class Callback>
+void forEachVertex(const Polygon2d & polygon, const Callback & callback)
+{
+  const auto & outer = polygon.outer();
+  for (size_t i = 0; i < outer.size(); ++i) {
+    const auto & p = outer.at(i);
+    const auto & next_p = outer.at((i + 1) % outer.size());
+    if (p.x() != next_p.x() || p.y() != next_p.y()) {
+      callback(p);
+    }
+  }
+}
+
+// NOTE: The turns at the vertices must have the same sign and sum up to a single loop, otherwise
+//       a self-intersecting polygon such as a pentagram would pass the check.
+template <class Vertices>
+bool isConvexRing(const Vertices & vertices, const size_t size)
+{
+  if (size < 3) {
+    return false;
+  }
+
+  bool has_left_turn = false;
+  bool has_right_turn = false;
+  double turn_angle_sum = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    const auto & prev_p = vertices[i];
+    const auto & curr_p = vertices[(i + 1) % size];
+    const auto & next_p = vertices[(i + 2) % size];
+    const double turn_cross = cross(prev_p, curr_p, next_p);
+    const double turn_dot = (curr_p.x() - prev_p.x()) * (next_p.x() - curr_p.x()) +
+                            (curr_p.y() - prev_p.y()) * (next_p.y() - curr_p.y());
+    has_left_turn |= 0.0 < turn_cross;
+    has_right_turn |= turn_cross < 0.0;
+    turn_angle_sum += std::atan2(turn_cross, turn_dot);
+  }
+
+  constexpr double turn_angle_sum_threshold = 1e-6;
+  return has_left_turn != has_right_turn &&
+         std::abs(std::abs(turn_angle_sum) - 2.0 * tier4_autoware_utils::pi) <
+           turn_angle_sum_threshold;
+}
+
+// check if the projections of the polygons are separated on the normal of any edge of polygon1
+bool hasSeparatingAxis(const ConvexPolygon2d & polygon1, const ConvexPolygon2d & polygon2)
+{
+  for (size_t i = 0; i < polygon1.size(); ++i) {
+    const auto & p = polygon1[i];
+    const auto & next_p = polygon1[(i + 1) % polygon1.size()];
+    const double axis_x = p.y() - next_p.y();
+    const double axis_y = next_p.x() - p.x();
+
+    double min1 = std::numeric_limits<double>::max();
+    double max1 = std::numeric_limits<double>::lowest();
+    for (size_t j = 0; j < polygon1.size(); ++j) {
+      const double projection = axis_x * polygon1[j].x() + axis_y * polygon1[j].y();
+      min1 = std::min(min1, projection);
+      max1 = std::max(max1, projection);
+    }
+    double min2 = std::numeric_limits<double>::max();
+    double max2 = std::numeric_limits<double>::lowest();
+    for (size_t j = 0; j < polygon2.size(); ++j) {
+      const double projection = axis_x * polygon2[j].x() + axis_y * polygon2[j].y();
+      min2 = std::min(min2, projection);
+      max2 = std::max(max2, projection);
+    }
+
+    if (max1 < min2 || max2 < min1) {
+      return true;
+    }
+  }
+  return false;
+}
+
+double calcSquaredDistanceToSegment(const Point2d & p, const Point2d & a, const Point2d & b)
+{
+  const double seg_x = b.x() - a.x();
+  const double seg_y = b.y() - a.y();
+  const double dx = p.x() - a.x();
+  const double dy = p.y() - a.y();
+  const double squared_seg_length = seg_x * seg_x + seg_y * seg_y;
+  const double ratio =
+    squared_seg_length == 0.0
+      ? 0.0
+      : std::clamp((dx * seg_x + dy * seg_y) / squared_seg_length, 0.0, 1.0);
+  const double ex = dx - ratio * seg_x;
+  const double ey = dy - ratio * seg_y;
+  return ex * ex + ey * ey;
+}
+
+double calcMinSquaredDistanceFromVertices(
+  const ConvexPolygon2d & polygon1, const ConvexPolygon2d & polygon2)
+{
+  double min_squared_distance = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < polygon1.size(); ++i) {
+    for (size_t j = 0; j < polygon2.size(); ++j) {
+      min_squared_distance = std::min(
+        min_squared_distance,
+        calcSquaredDistanceToSegment(
+          polygon1[i], polygon2[j], polygon2[(j + 1) % polygon2.size()]));
+    }
+  }
+  return min_squared_distance;
+}
+}  // namespace
+
+namespace tier4_autoware_utils
+{
+std::optional<ConvexPolygon2d> ConvexPolygon2d::create(const Polygon2d & polygon)
+{
+  if (!polygon.inners().empty()) {
+    return std::nullopt;
+  }
+
+  ConvexPolygon2d convex_polygon;
+  bool is_overflowed = false;
+  forEachVertex(polygon, [&](const Point2d & p) {
+    if (convex_polygon.size_ < max_vertices_num) {
+      convex_polygon.vertices_[convex_polygon.size_++] = p;
+    } else {
+      is_overflowed = true;
+    }
+  });
+  if (is_overflowed || !isConvexRing(convex_polygon.vertices_, convex_polygon.size_)) {
+    return std::nullopt;
+  }
+  return convex_polygon;
+}
+
+bool isConvex(const Polygon2d & polygon)
+{
+  if (!polygon.inners().empty()) {
+    return false;
+  }
+
+  std::vector<Point2d> vertices;
+  vertices.reserve(polygon.outer().size());
+  forEachVertex(polygon, [&](const Point2d & p) { vertices.push_back(p); });
+  return isConvexRing(vertices, vertices.size());
+}
+
+bool intersects(const ConvexPolygon2d & polygon1, const ConvexPolygon2d & polygon2)
+{
+  return !hasSeparatingAxis(polygon1, polygon2) && !hasSeparatingAxis(polygon2, polygon1);
+}
+
+double distance(const ConvexPolygon2d & polygon1, const ConvexPolygon2d & polygon2)
+{
+  if (intersects(polygon1, polygon2)) {
+    return 0.0;
+  }
+
+  // NOTE: The nearest points of the disjoint convex polygons are on their boundaries, and one of
+  //       them is a vertex.
+  return std::sqrt(std::min(
+    calcMinSquaredDistanceFromVertices(polygon1, polygon2),
+    calcMinSquaredDistanceFromVertices(polygon2, polygon1)));
+}
+
+bool within(const ConvexPolygon2d & inner_polygon, const ConvexPolygon2d & outer_polygon)
+{
+  // NOTE: the sign of the area gives the orientation of the outer polygon
+  double doubled_area = 0.0;
+  for (size_t i = 0; i < outer_polygon.size(); ++i) {
+    doubled_area += cross(
+      outer_polygon[0], outer_polygon[i], outer_polygon[(i + 1) % outer_polygon.size()]);
+  }
+  const double orientation = 0.0 < doubled_area ? 1.0 : -1.0;
+
+  for (size_t i = 0; i < outer_polygon.size(); ++i) {
+    const auto & p = outer_polygon[i];
+    const auto & next_p = outer_polygon[(i + 1) % outer_polygon.size()];
+    for (size_t j = 0; j < inner_polygon.size(); ++j) {
+      if (orientation * cross(p, next_p, inner_polygon[j]) < 0.0) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool intersects(const Polygon2d & polygon1, const Polygon2d & polygon2)
+{
+  const auto convex_polygon1 = ConvexPolygon2d::create(polygon1);
+  const auto convex_polygon2 = convex_polygon1 ? ConvexPolygon2d::create(polygon2) : std::nullopt;
+  if (convex_polygon1 && convex_polygon2) {
+    return intersects(*convex_polygon1, *convex_polygon2);
+  }
+  return bg::intersects(polygon1, polygon2);
+}
+
+double distance(const Polygon2d & polygon1, const Polygon2d & polygon2)
+{
+  const auto convex_polygon1 = ConvexPolygon2d::create(polygon1);
+  const auto convex_polygon2 = convex_polygon1 ? ConvexPolygon2d::create(polygon2) : std::nullopt;
+  if (convex_polygon1 && convex_polygon2) {
+    return distance(*convex_polygon1, *convex_polygon2);
+  }
+  return bg::distance(polygon1, polygon2);
+}
+
+bool within(const Polygon2d & inner_polygon, const Polygon2d & outer_polygon)
+{
+  const auto convex_inner_polygon = ConvexPolygon2d::create(inner_polygon);
+  const auto convex_outer_polygon =
+    convex_inner_polygon ? ConvexPolygon2d::create(outer_polygon) : std::nullopt;
+  if (convex_inner_polygon && convex_outer_polygon) {
+    return within(*convex_inner_polygon, *convex_outer_polygon);
+  }
+  return bg::within(inner_polygon, outer_polygon);
+}
+}  // namespace tier4_autoware_utils
@@ -0,0 +1,136 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/geometry/footprint_sweep.hpp"
+
+#include <Eigen/Geometry>
+
+#include <boost/geometry.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace tier4_autoware_utils
+{
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+namespace
+{
+std::vector<size_t> toSortedIndices(const std::vector<std::pair<Box2d, size_t>> & values)
+{
+  std::vector<size_t> indices;
+  indices.reserve(values.size());
+  for (const auto & value : values) {
+    indices.push_back(value.second);
+  }
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+}  // namespace
+
+LinearRing2d transformFootprint(
+  const LinearRing2d & local_footprint, const geometry_msgs::msg::Pose & pose)
+{
+  const auto & q = pose.orientation;
+  const Eigen::Matrix3d rotation = Eigen::Quaterniond(q.w, q.x, q.y, q.z).toRotationMatrix();
+
+  LinearRing2d footprint;
+  footprint.reserve(local_footprint.size());
+  for (const auto & p : local_footprint) {
+    footprint.emplace_back(
+      rotation(0, 0) * p.x() + rotation(0, 1) * p.y() + pose.position.x,
+      rotation(1, 0) * p.x() + rotation(1, 1) * p.y() + pose.position.y);
+  }
+  return footprint;
+}
+
+FootprintSweep::FootprintSweep(
+  const LinearRing2d & local_footprint, const std::vector<geometry_msgs::msg::Pose> & poses,
+  const std::vector<double> & times)
+: times_(times)
+{
+  if (!times_.empty() && times_.size() != poses.size()) {
+    throw std::invalid_argument("the size of the times differs from the poses.");
+  }
+
+  footprints_.reserve(poses.size());
+  for (const auto & pose : poses) {
+    footprints_.push_back(transformFootprint(local_footprint, pose));
+  }
+
+  if (footprints_.size() < 2) {
+    return;
+  }
+  step_polygons_.reserve(footprints_.size() - 1);
+  std::vector<std::pair<Box2d, size_t>> step_boxes;
+  step_boxes.reserve(footprints_.size() - 1);
+  for (size_t i = 0; i + 1 < footprints_.size(); ++i) {
+    MultiPoint2d combined;
+    combined.reserve(footprints_.at(i).size() + footprints_.at(i + 1).size());
+    combined.insert(combined.end(), footprints_.at(i).begin(), footprints_.at(i).end());
+    combined.insert(combined.end(), footprints_.at(i + 1).begin(), footprints_.at(i + 1).end());
+
+    Polygon2d step_polygon;
+    bg::convex_hull(combined, step_polygon);
+    Box2d box;
+    bg::envelope(step_polygon, box);
+    step_polygons_.push_back(std::move(step_polygon));
+    step_boxes.emplace_back(box, i);
+  }
+  // NOTE: the packing construction builds a better tree than the insertion one by one
+  step_rtree_ = StepRtree(step_boxes.begin(), step_boxes.end());
+}
+
+std::vector<size_t> FootprintSweep::findStepsContaining(const Point2d & point) const
+{
+  std::vector<std::pair<Box2d, size_t>> values;
+  step_rtree_.query(
+    bgi::intersects(point) && bgi::satisfies([&](const std::pair<Box2d, size_t> & value) {
+      return bg::within(point, step_polygons_.at(value.second));
+    }),
+    std::back_inserter(values));
+  return toSortedIndices(values);
+}
+
+std::vector<size_t> FootprintSweep::findStepsIntersecting(const Polygon2d & polygon) const
+{
+  std::vector<std::pair<Box2d, size_t>> values;
+  step_rtree_.query(
+    bgi::intersects(polygon) && bgi::satisfies([&](const std::pair<Box2d, size_t> & value) {
+      return bg::intersects(polygon, step_polygons_.at(value.second));
+    }),
+    std::back_inserter(values));
+  return toSortedIndices(values);
+}
+
+std::vector<size_t> FootprintSweep::findStepsIntersecting(
+  const Polygon2d & polygon, const double min_time, const double max_time) const
+{
+  if (times_.empty()) {
+    throw std::logic_error("the times of the poses are required for the time-aware query.");
+  }
+
+  std::vector<std::pair<Box2d, size_t>> values;
+  step_rtree_.query(
+    bgi::intersects(polygon) && bgi::satisfies([&](const std::pair<Box2d, size_t> & value) {
+      const size_t i = value.second;
+      return times_.at(i) <= max_time && min_time <= times_.at(i + 1) &&
+             bg::intersects(polygon, step_polygons_.at(i));
+    }),
+    std::back_inserter(values));
+  return toSortedIndices(values);
+}
+}  // namespace tier4_autoware_utils
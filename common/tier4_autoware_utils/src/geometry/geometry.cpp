@@ -20,6 +20,10 @@
 
 #include <tf2/convert.h>
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
 namespace tf2
 {
 void fromMsg(const geometry_msgs::msg::PoseStamped & msg, tf2::Stamped<tf2::Transform> & out)
@@ -308,6 +312,89 @@ geometry_msgs::msg::Point inverseTransformPoint(
   return local_point;
 }
 
+namespace
+{
+void validateSameSize(
+  const std::vector<double> & xs, const std::vector<double> & ys, const std::vector<double> & zs)
+{
+  if (xs.size() != ys.size() || xs.size() != zs.size()) {
+    throw std::invalid_argument("the sizes of the x, y and z arrays are different.");
+  }
+}
+
+void rotateAndTranslatePoints(
+  const Eigen::Matrix3d & R, const Eigen::Vector3d & t, std::vector<double> & xs,
+  std::vector<double> & ys, std::vector<double> & zs)
+{
+  const double r00 = R(0, 0), r01 = R(0, 1), r02 = R(0, 2);
+  const double r10 = R(1, 0), r11 = R(1, 1), r12 = R(1, 2);
+  const double r20 = R(2, 0), r21 = R(2, 1), r22 = R(2, 2);
+  double * x = xs.data();
+  double * y = ys.data();
+  double * z = zs.data();
+  for (size_t i = 0; i < xs.size(); ++i) {
+    const double px = x[i];
+    const double py = y[i];
+    const double pz = z[i];
+    x[i] = r00 * px + r01 * py + r02 * pz + t.x();
+    y[i] = r10 * px + r11 * py + r12 * pz + t.y();
+    z[i] = r20 * px + r21 * py + r22 * pz + t.z();
+  }
+}
+}  // namespace
+
+void transformPoints(
+  const geometry_msgs::msg::Pose & pose, std::vector<double> & xs, std::vector<double> & ys,
+  std::vector<double> & zs)
+{
+  validateSameSize(xs, ys, zs);
+
+  const Eigen::Quaterniond q(
+    pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
+  const Eigen::Vector3d t(pose.position.x, pose.position.y, pose.position.z);
+  rotateAndTranslatePoints(q.toRotationMatrix(), t, xs, ys, zs);
+}
+
+void inverseTransformPoints(
+  const geometry_msgs::msg::Pose & pose, std::vector<double> & xs, std::vector<double> & ys,
+  std::vector<double> & zs)
+{
+  validateSameSize(xs, ys, zs);
+
+  const Eigen::Quaterniond q(
+    pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
+  const Eigen::Matrix3d R_inv = q.normalized().toRotationMatrix().transpose();
+  const Eigen::Vector3d local_origin(pose.position.x, pose.position.y, pose.position.z);
+  rotateAndTranslatePoints(R_inv, -(R_inv * local_origin), xs, ys, zs);
+}
+
+void calcDistancesToSegment2d(
+  const geometry_msgs::msg::Point & p1, const geometry_msgs::msg::Point & p2,
+  const std::vector<double> & xs, const std::vector<double> & ys, std::vector<double> & distances)
+{
+  if (xs.size() != ys.size()) {
+    throw std::invalid_argument("the sizes of the x and y arrays are different.");
+  }
+
+  const double seg_x = p2.x - p1.x;
+  const double seg_y = p2.y - p1.y;
+  const double squared_seg_length = seg_x * seg_x + seg_y * seg_y;
+  // NOTE: a degenerate segment is handled as the point p1
+  const double inv_squared_seg_length =
+    squared_seg_length < 1e-20 ? 0.0 : 1.0 / squared_seg_length;
+
+  distances.resize(xs.size());
+  for (size_t i = 0; i < xs.size(); ++i) {
+    const double dx = xs[i] - p1.x;
+    const double dy = ys[i] - p1.y;
+    const double ratio =
+      std::clamp((dx * seg_x + dy * seg_y) * inv_squared_seg_length, 0.0, 1.0);
+    const double ex = dx - ratio * seg_x;
+    const double ey = dy - ratio * seg_y;
+    distances[i] = std::sqrt(ex * ex + ey * ey);
+  }
+}
+
 double calcCurvature(
   const geometry_msgs::msg::Point & p1, const geometry_msgs::msg::Point & p2,
   const geometry_msgs::msg::Point & p3)
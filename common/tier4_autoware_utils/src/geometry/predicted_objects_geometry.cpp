@@ -0,0 +1,165 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/geometry/predicted_objects_geometry.hpp"
+
+#include "tier4_autoware_utils/geometry/boost_polygon_utils.hpp"
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+
+#include <rclcpp/duration.hpp>
+
+#include <boost/geometry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+
+namespace tier4_autoware_utils
+{
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+namespace
+{
+using autoware_auto_perception_msgs::msg::PredictedPath;
+
+/// @brief pose on the path at the time, linearly interpolated between the path points
+std::optional<geometry_msgs::msg::Pose> interpolatePose(
+  const PredictedPath & path, const double path_time_step, const double time)
+{
+  const double index = time / path_time_step;
+  const auto prev_index = static_cast<size_t>(std::floor(index));
+  if (prev_index >= path.path.size()) {
+    return std::nullopt;
+  }
+  const double ratio = index - static_cast<double>(prev_index);
+  if (prev_index + 1 == path.path.size()) {
+    if (ratio > 1e-6) {
+      return std::nullopt;
+    }
+    return path.path.at(prev_index);
+  }
+  return calcInterpolatedPose(path.path.at(prev_index), path.path.at(prev_index + 1), ratio, false);
+}
+
+std::vector<size_t> toSortedUniqueIndices(std::vector<size_t> indices)
+{
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+  return indices;
+}
+}  // namespace
+
+PredictedObjectsGeometry::PredictedObjectsGeometry(
+  const autoware_auto_perception_msgs::msg::PredictedObjects & objects, const double time_step,
+  const double time_horizon)
+: time_step_(time_step)
+{
+  if (time_step <= 0.0 || time_horizon < 0.0) {
+    throw std::invalid_argument("the time step must be positive and the horizon non-negative.");
+  }
+
+  const size_t object_num = objects.objects.size();
+  footprints_.reserve(object_num);
+  envelopes_.reserve(object_num);
+  std::vector<std::pair<Box2d, size_t>> boxes;
+  boxes.reserve(object_num);
+  for (size_t i = 0; i < object_num; ++i) {
+    footprints_.push_back(toPolygon2d(objects.objects.at(i)));
+    Box2d envelope;
+    bg::envelope(footprints_.back(), envelope);
+    envelopes_.push_back(envelope);
+    boxes.emplace_back(envelope, i);
+  }
+  // NOTE: the packing construction builds a better tree than the insertion one by one
+  rtree_ = Rtree(boxes.begin(), boxes.end());
+
+  const auto step_num = static_cast<size_t>(std::floor(time_horizon / time_step + 1e-6)) + 1;
+  step_footprints_.resize(step_num);
+  for (size_t i = 0; i < object_num; ++i) {
+    const auto & object = objects.objects.at(i);
+    const auto & paths = object.kinematics.predicted_paths;
+    for (size_t j = 0; j < paths.size(); ++j) {
+      const double path_time_step = rclcpp::Duration(paths.at(j).time_step).seconds();
+      if (path_time_step <= 0.0) {
+        continue;
+      }
+      for (size_t k = 0; k < step_num; ++k) {
+        const auto pose =
+          interpolatePose(paths.at(j), path_time_step, static_cast<double>(k) * time_step);
+        if (!pose) {
+          break;
+        }
+        PathFootprint path_footprint;
+        path_footprint.object_index = i;
+        path_footprint.path_index = j;
+        path_footprint.polygon = toPolygon2d(*pose, object.shape);
+        bg::envelope(path_footprint.polygon, path_footprint.envelope);
+        step_footprints_.at(k).push_back(std::move(path_footprint));
+      }
+    }
+  }
+
+  step_rtrees_.reserve(step_num);
+  for (const auto & path_footprints : step_footprints_) {
+    std::vector<std::pair<Box2d, size_t>> step_boxes;
+    step_boxes.reserve(path_footprints.size());
+    for (size_t i = 0; i < path_footprints.size(); ++i) {
+      step_boxes.emplace_back(path_footprints.at(i).envelope, i);
+    }
+    step_rtrees_.emplace_back(step_boxes.begin(), step_boxes.end());
+  }
+}
+
+std::vector<size_t> PredictedObjectsGeometry::findObjectsIntersecting(
+  const Polygon2d & polygon) const
+{
+  std::vector<std::pair<Box2d, size_t>> values;
+  rtree_.query(
+    bgi::intersects(polygon) && bgi::satisfies([&](const std::pair<Box2d, size_t> & value) {
+      return bg::intersects(polygon, footprints_.at(value.second));
+    }),
+    std::back_inserter(values));
+
+  std::vector<size_t> indices;
+  indices.reserve(values.size());
+  for (const auto & value : values) {
+    indices.push_back(value.second);
+  }
+  return toSortedUniqueIndices(std::move(indices));
+}
+
+std::vector<size_t> PredictedObjectsGeometry::findObjectsIntersecting(
+  const Polygon2d & polygon, const size_t step_index) const
+{
+  const auto & path_footprints = step_footprints_.at(step_index);
+  std::vector<std::pair<Box2d, size_t>> values;
+  step_rtrees_.at(step_index)
+    .query(
+      bgi::intersects(polygon) && bgi::satisfies([&](const std::pair<Box2d, size_t> & value) {
+        return bg::intersects(polygon, path_footprints.at(value.second).polygon);
+      }),
+      std::back_inserter(values));
+
+  // NOTE: an object has the footprints of several paths at a time step
+  std::vector<size_t> indices;
+  indices.reserve(values.size());
+  for (const auto & value : values) {
+    indices.push_back(path_footprints.at(value.second).object_index);
+  }
+  return toSortedUniqueIndices(std::move(indices));
+}
+}  // namespace tier4_autoware_utils
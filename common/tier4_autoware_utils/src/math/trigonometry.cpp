@@ -17,10 +17,35 @@
 #include "tier4_autoware_utils/math/constants.hpp"
 #include "tier4_autoware_utils/math/sin_table.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
 
 namespace tier4_autoware_utils
 {
+namespace
+{
+constexpr float atan2_p1 = 0.9997878412794807f;
+constexpr float atan2_p3 = -0.3258083974640975f;
+constexpr float atan2_p5 = 0.1555786518463281f;
+constexpr float atan2_p7 = -0.04432655554792128f;
+constexpr float atan2_epsilon = 2.2204460492503131e-016f;
+
+// atan2 of (dy, dx) with the branches replaced by selects
+inline float fast_atan2(const float dy, const float dx)
+{
+  constexpr float pi = static_cast<float>(tier4_autoware_utils::pi);
+  const float ax = std::abs(dx);
+  const float ay = std::abs(dy);
+  const float c = std::min(ax, ay) / (std::max(ax, ay) + atan2_epsilon);
+  const float c2 = c * c;
+  float a = (((atan2_p7 * c2 + atan2_p5) * c2 + atan2_p3) * c2 + atan2_p1) * c;
+  a = ax < ay ? pi / 2.f - a : a;
+  a = dx < 0.f ? pi - a : a;
+  return dy < 0.f ? -a : a;
+}
+}  // namespace
+
 
 float sin(float radian)
 {
@@ -72,4 +97,47 @@ std::pair<float, float> sin_and_cos(float radian)
   }
 }
 
+void sin_and_cos(
+  const std::vector<float> & radians, std::vector<float> & sins, std::vector<float> & coss)
+{
+  constexpr float tmp =
+    (180.f / static_cast<float>(tier4_autoware_utils::pi)) * (discrete_arcs_num_360 / 360.f);
+  const size_t size = radians.size();
+  sins.resize(size);
+  coss.resize(size);
+  for (size_t i = 0; i < size; ++i) {
+    const size_t idx =
+      (static_cast<int>(std::round(radians[i] * tmp)) % discrete_arcs_num_360 +
+       discrete_arcs_num_360) %
+      discrete_arcs_num_360;
+
+    // NOTE: the quadrant and the index in it select the same table entries as sin_and_cos(float)
+    const size_t quadrant = idx / discrete_arcs_num_90;
+    const size_t offset = idx % discrete_arcs_num_90;
+    const bool is_odd = quadrant % 2 == 1;
+    const float a = g_sin_table[is_odd ? discrete_arcs_num_90 - offset : offset];
+    const float b = g_sin_table[is_odd ? offset : discrete_arcs_num_90 - offset];
+    sins[i] = quadrant < 2 ? a : -a;
+    coss[i] = (quadrant == 0 || quadrant == 3) ? b : -b;
+  }
+}
+
+float opencv_fast_atan2(float dy, float dx)
+{
+  return fast_atan2(dy, dx);
+}
+
+void opencv_fast_atan2(
+  const std::vector<float> & dys, const std::vector<float> & dxs, std::vector<float> & radians)
+{
+  if (dys.size() != dxs.size()) {
+    throw std::invalid_argument("the sizes of dys and dxs are different.");
+  }
+
+  radians.resize(dys.size());
+  for (size_t i = 0; i < dys.size(); ++i) {
+    radians[i] = fast_atan2(dys[i], dxs[i]);
+  }
+}
+
 }  // namespace tier4_autoware_utils
@@ -0,0 +1,92 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/system/allocation_counter.hpp"
+
+#include <sys/resource.h>
+
+#include <atomic>
+
+namespace tier4_autoware_utils::allocation_counter
+{
+namespace
+{
+// NOTE: The counters are trivially constructible, so that they are usable by the operator new
+//       called before or during the static initialization.
+std::atomic<bool> is_enabled{false};
+thread_local AllocationStats thread_stats{};
+std::atomic<size_t> live_bytes{0};
+std::atomic<size_t> peak_live_bytes{0};
+}  // namespace
+
+bool isEnabled()
+{
+  return is_enabled.load(std::memory_order_relaxed);
+}
+
+AllocationStats getThreadStats()
+{
+  return thread_stats;
+}
+
+size_t getLiveBytes()
+{
+  return live_bytes.load(std::memory_order_relaxed);
+}
+
+size_t getPeakLiveBytes()
+{
+  return peak_live_bytes.load(std::memory_order_relaxed);
+}
+
+void resetPeakLiveBytes()
+{
+  peak_live_bytes.store(live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+size_t getMaxResidentBytes()
+{
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  // in kilobytes on Linux
+  return static_cast<size_t>(usage.ru_maxrss) * 1024;
+}
+
+namespace detail
+{
+void enable()
+{
+  is_enabled.store(true, std::memory_order_relaxed);
+}
+
+void onAllocate(const size_t bytes) noexcept
+{
+  thread_stats.count++;
+  thread_stats.bytes += bytes;
+
+  const size_t live = live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  size_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+  while (peak < live &&
+         !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+void onDeallocate(const size_t bytes) noexcept
+{
+  live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+}  // namespace detail
+}  // namespace tier4_autoware_utils::allocation_counter
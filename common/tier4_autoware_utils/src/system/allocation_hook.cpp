@@ -0,0 +1,170 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Replacement of the global operator new and delete counting the allocations, which is built as
+// the opt-in library tier4_autoware_utils_allocation_hook.
+
+#include "tier4_autoware_utils/system/allocation_counter.hpp"
+
+#include <malloc.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+namespace detail = tier4_autoware_utils::allocation_counter::detail;
+
+// NOTE: The usable size is counted instead of the requested one, so that the unsized delete
+//       subtracts the same bytes from the live bytes.
+void * allocate(const std::size_t size) noexcept
+{
+  void * ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr) {
+    detail::onAllocate(malloc_usable_size(ptr));
+  }
+  return ptr;
+}
+
+void * allocateAligned(const std::size_t size, const std::align_val_t alignment) noexcept
+{
+  void * ptr = nullptr;
+  const auto alignment_bytes = std::max(static_cast<std::size_t>(alignment), sizeof(void *));
+  if (posix_memalign(&ptr, alignment_bytes, size == 0 ? 1 : size) != 0) {
+    return nullptr;
+  }
+  detail::onAllocate(malloc_usable_size(ptr));
+  return ptr;
+}
+
+void deallocate(void * ptr) noexcept
+{
+  if (ptr) {
+    detail::onDeallocate(malloc_usable_size(ptr));
+    std::free(ptr);
+  }
+}
+
+[[maybe_unused]] const bool is_enabled = [] {
+  detail::enable();
+  return true;
+}();
+}  // namespace
+
+void * operator new(std::size_t size)
+{
+  if (void * ptr = allocate(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void * operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void * operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+  return allocate(size);
+}
+
+void * operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+  return allocate(size);
+}
+
+void * operator new(std::size_t size, std::align_val_t alignment)
+{
+  if (void * ptr = allocateAligned(size, alignment)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void * operator new[](std::size_t size, std::align_val_t alignment)
+{
+  return operator new(size, alignment);
+}
+
+void * operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+  return allocateAligned(size, alignment);
+}
+
+void * operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+  return allocateAligned(size, alignment);
+}
+
+void operator delete(void * ptr) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr, std::size_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void * ptr, const std::nothrow_t &) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr, const std::nothrow_t &) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void * ptr, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void * ptr, std::size_t, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr, std::size_t, std::align_val_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void * ptr, std::align_val_t, const std::nothrow_t &) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void * ptr, std::align_val_t, const std::nothrow_t &) noexcept
+{
+  deallocate(ptr);
+}
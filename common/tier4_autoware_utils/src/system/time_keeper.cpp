@@ -0,0 +1,169 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/system/time_keeper.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace tier4_autoware_utils
+{
+void LatencyHistogram::record(const double latency_ms)
+{
+  const double latency_us = std::max(std::round(latency_ms * 1e3), 0.0);
+  buckets_.at(toBucketIndex(static_cast<uint64_t>(latency_us)))++;
+  count_++;
+  sum_ms_ += latency_ms;
+  max_ms_ = std::max(max_ms_, latency_ms);
+}
+
+void LatencyHistogram::reset()
+{
+  buckets_.fill(0);
+  count_ = 0;
+  sum_ms_ = 0.0;
+  max_ms_ = 0.0;
+}
+
+double LatencyHistogram::percentile(const double percentile) const
+{
+  if (count_ == 0) {
+    return 0.0;
+  }
+
+  const double clamped_percentile = std::clamp(percentile, 0.0, 100.0);
+  const auto rank = std::max(
+    static_cast<uint64_t>(std::ceil(clamped_percentile / 100.0 * static_cast<double>(count_))),
+    uint64_t{1});
+
+  uint64_t accumulated_count = 0;
+  for (size_t i = 0; i < buckets_.size(); ++i) {
+    accumulated_count += buckets_.at(i);
+    if (rank <= accumulated_count) {
+      // NOTE: the middle of the last bucket may exceed the recorded max
+      return std::min(toBucketMiddleMs(i), max_ms_);
+    }
+  }
+  return max_ms_;
+}
+
+size_t LatencyHistogram::toBucketIndex(const uint64_t latency_us)
+{
+  if (latency_us < exact_buckets_num) {
+    return latency_us;
+  }
+
+  const uint64_t clamped_latency_us =
+    std::min(latency_us, (uint64_t{1} << (max_exponent + 1)) - 1);
+  size_t exponent = 0;
+  while ((clamped_latency_us >> (exponent + 1)) != 0) {
+    ++exponent;
+  }
+  const size_t sub_bucket_index = (clamped_latency_us >> (exponent - 3)) - sub_buckets_num;
+  return exact_buckets_num + (exponent - 4) * sub_buckets_num + sub_bucket_index;
+}
+
+double LatencyHistogram::toBucketMiddleMs(const size_t bucket_index)
+{
+  if (bucket_index < exact_buckets_num) {
+    return static_cast<double>(bucket_index) * 1e-3;
+  }
+
+  const size_t exponent = (bucket_index - exact_buckets_num) / sub_buckets_num + 4;
+  const size_t sub_bucket_index = (bucket_index - exact_buckets_num) % sub_buckets_num;
+  const double bucket_width_us = static_cast<double>(uint64_t{1} << (exponent - 3));
+  const double lower_us = static_cast<double>(sub_buckets_num + sub_bucket_index) * bucket_width_us;
+  return (lower_us + bucket_width_us / 2.0) * 1e-3;
+}
+
+void TimeKeeper::start(const std::string & name)
+{
+  // find the child of the current span, or the root with the name
+  auto & siblings =
+    active_spans_.empty() ? roots_ : nodes_.at(active_spans_.back().node_index).children;
+  const auto itr = std::find_if(siblings.begin(), siblings.end(), [&](const size_t index) {
+    return nodes_.at(index).span.name == name;
+  });
+
+  size_t node_index = 0;
+  if (itr != siblings.end()) {
+    node_index = *itr;
+  } else {
+    Node node;
+    node.span.name = name;
+    if (active_spans_.empty()) {
+      node.span.path = name;
+    } else {
+      const auto & parent_span = nodes_.at(active_spans_.back().node_index).span;
+      node.span.path = parent_span.path + "/" + name;
+      node.span.depth = parent_span.depth + 1;
+    }
+    node_index = nodes_.size();
+    // NOTE: siblings may refer to a member of nodes_, so it is updated before nodes_ grows
+    siblings.push_back(node_index);
+    nodes_.push_back(std::move(node));
+  }
+
+  active_spans_.push_back(
+    ActiveSpan{node_index, Clock::now(), allocation_counter::getThreadStats()});
+}
+
+void TimeKeeper::end()
+{
+  if (active_spans_.empty()) {
+    throw std::runtime_error("TimeKeeper::end() is called without any started span.");
+  }
+
+  const auto active_span = active_spans_.back();
+  active_spans_.pop_back();
+
+  const double duration_ms =
+    std::chrono::duration<double, std::milli>(Clock::now() - active_span.start_time).count();
+  const auto allocations = allocation_counter::getThreadStats();
+  auto & span = nodes_.at(active_span.node_index).span;
+  span.last_ms = duration_ms;
+  span.histogram.record(duration_ms);
+  span.last_allocations.count = allocations.count - active_span.start_allocations.count;
+  span.last_allocations.bytes = allocations.bytes - active_span.start_allocations.bytes;
+  span.total_allocations.count += span.last_allocations.count;
+  span.total_allocations.bytes += span.last_allocations.bytes;
+}
+
+std::vector<const TimeKeeper::Span *> TimeKeeper::getSpans() const
+{
+  std::vector<const Span *> spans;
+  spans.reserve(nodes_.size());
+  appendSpans(roots_, spans);
+  return spans;
+}
+
+void TimeKeeper::resetHistograms()
+{
+  for (auto & node : nodes_) {
+    node.span.histogram.reset();
+    node.span.total_allocations = AllocationStats{};
+  }
+}
+
+void TimeKeeper::appendSpans(
+  const std::vector<size_t> & node_indices, std::vector<const Span *> & spans) const
+{
+  for (const size_t index : node_indices) {
+    spans.push_back(&nodes_.at(index).span);
+    appendSpans(nodes_.at(index).children, spans);
+  }
+}
+}  // namespace tier4_autoware_utils
@@ -0,0 +1,178 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/geometry/convex_polygon.hpp"
+
+#include <boost/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+using tier4_autoware_utils::ConvexPolygon2d;
+using tier4_autoware_utils::Point2d;
+using tier4_autoware_utils::Polygon2d;
+
+namespace
+{
+constexpr double epsilon = 1e-6;
+
+Polygon2d createPolygon(const std::vector<Point2d> & points)
+{
+  Polygon2d polygon;
+  for (const auto & p : points) {
+    polygon.outer().push_back(p);
+  }
+  polygon.outer().push_back(points.front());
+  return polygon;
+}
+
+Polygon2d createBox(
+  const double x, const double y, const double yaw, const double length, const double width)
+{
+  std::vector<Point2d> points;
+  for (const auto & [l, w] :
+       std::vector<std::pair<double, double>>{{1, 1}, {1, -1}, {-1, -1}, {-1, 1}}) {
+    const double dx = l * length / 2.0;
+    const double dy = w * width / 2.0;
+    points.emplace_back(
+      x + dx * std::cos(yaw) - dy * std::sin(yaw), y + dx * std::sin(yaw) + dy * std::cos(yaw));
+  }
+  return createPolygon(points);
+}
+}  // namespace
+
+TEST(convex_polygon, create)
+{
+  using tier4_autoware_utils::isConvex;
+
+  // clockwise box
+  {
+    const auto polygon = createPolygon({{0.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {1.0, 0.0}});
+    const auto convex_polygon = ConvexPolygon2d::create(polygon);
+    ASSERT_TRUE(convex_polygon);
+    EXPECT_EQ(convex_polygon->size(), 4u);
+    EXPECT_TRUE(isConvex(polygon));
+  }
+
+  // counter-clockwise triangle with a duplicated point
+  {
+    const auto polygon = createPolygon({{0.0, 0.0}, {1.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}});
+    const auto convex_polygon = ConvexPolygon2d::create(polygon);
+    ASSERT_TRUE(convex_polygon);
+    EXPECT_EQ(convex_polygon->size(), 3u);
+  }
+
+  // concave polygon
+  {
+    const auto polygon =
+      createPolygon({{0.0, 0.0}, {0.0, 2.0}, {1.0, 1.0}, {2.0, 2.0}, {2.0, 0.0}});
+    EXPECT_FALSE(ConvexPolygon2d::create(polygon));
+    EXPECT_FALSE(isConvex(polygon));
+  }
+
+  // self-intersecting pentagram
+  {
+    std::vector<Point2d> points;
+    for (int i = 0; i < 5; ++i) {
+      const double angle = 4.0 * M_PI * i / 5.0;
+      points.emplace_back(std::cos(angle), std::sin(angle));
+    }
+    EXPECT_FALSE(ConvexPolygon2d::create(createPolygon(points)));
+  }
+
+  // too many vertices
+  {
+    std::vector<Point2d> points;
+    for (size_t i = 0; i < ConvexPolygon2d::max_vertices_num + 1; ++i) {
+      const double angle = -2.0 * M_PI * i / (ConvexPolygon2d::max_vertices_num + 1);
+      points.emplace_back(std::cos(angle), std::sin(angle));
+    }
+    const auto polygon = createPolygon(points);
+    EXPECT_FALSE(ConvexPolygon2d::create(polygon));
+    EXPECT_TRUE(isConvex(polygon));
+  }
+}
+
+TEST(convex_polygon, intersects)
+{
+  using tier4_autoware_utils::intersects;
+
+  const auto box = createBox(0.0, 0.0, 0.0, 4.0, 2.0);
+  EXPECT_TRUE(intersects(box, createBox(1.0, 1.0, M_PI / 4.0, 1.0, 1.0)));
+  EXPECT_FALSE(intersects(box, createBox(3.0, 2.0, M_PI / 4.0, 1.0, 1.0)));
+  // touching
+  EXPECT_TRUE(intersects(box, createBox(3.0, 0.0, 0.0, 2.0, 2.0)));
+  // contained
+  EXPECT_TRUE(intersects(box, createBox(0.0, 0.0, 0.0, 1.0, 1.0)));
+}
+
+TEST(convex_polygon, distance)
+{
+  using tier4_autoware_utils::distance;
+
+  const auto box = createBox(0.0, 0.0, 0.0, 4.0, 2.0);
+  EXPECT_NEAR(distance(box, createBox(1.0, 1.0, M_PI / 4.0, 1.0, 1.0)), 0.0, epsilon);
+  EXPECT_NEAR(distance(box, createBox(4.0, 0.0, 0.0, 2.0, 2.0)), 1.0, epsilon);
+  EXPECT_NEAR(
+    distance(box, createBox(4.0, 3.0, M_PI / 4.0, std::sqrt(2.0), std::sqrt(2.0))),
+    3.0 / std::sqrt(2.0), epsilon);
+}
+
+TEST(convex_polygon, within)
+{
+  using tier4_autoware_utils::within;
+
+  const auto box = createBox(0.0, 0.0, 0.0, 4.0, 2.0);
+  EXPECT_TRUE(within(createBox(0.5, 0.0, 0.3, 1.0, 1.0), box));
+  EXPECT_FALSE(within(box, createBox(0.5, 0.0, 0.3, 1.0, 1.0)));
+  EXPECT_FALSE(within(createBox(1.5, 0.0, 0.3, 1.0, 1.0), box));
+}
+
+TEST(convex_polygon, compare_with_boost)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> position(-5.0, 5.0);
+  std::uniform_real_distribution<double> yaw(-M_PI, M_PI);
+  std::uniform_real_distribution<double> size(0.5, 4.0);
+
+  for (int i = 0; i < 1000; ++i) {
+    const auto polygon1 =
+      createBox(position(engine), position(engine), yaw(engine), size(engine), size(engine));
+    const auto polygon2 =
+      createBox(position(engine), position(engine), yaw(engine), size(engine), size(engine));
+
+    EXPECT_EQ(
+      tier4_autoware_utils::intersects(polygon1, polygon2),
+      boost::geometry::intersects(polygon1, polygon2));
+    EXPECT_NEAR(
+      tier4_autoware_utils::distance(polygon1, polygon2),
+      boost::geometry::distance(polygon1, polygon2), epsilon);
+    EXPECT_EQ(
+      tier4_autoware_utils::within(polygon1, polygon2),
+      boost::geometry::within(polygon1, polygon2));
+  }
+
+  // fall back on boost::geometry for the concave polygons
+  const auto concave_polygon =
+    createPolygon({{0.0, 0.0}, {0.0, 2.0}, {1.0, 1.0}, {2.0, 2.0}, {2.0, 0.0}});
+  const auto box = createBox(1.0, 2.0, 0.0, 0.5, 0.5);
+  EXPECT_FALSE(tier4_autoware_utils::intersects(concave_polygon, box));
+  EXPECT_NEAR(
+    tier4_autoware_utils::distance(concave_polygon, box),
+    boost::geometry::distance(concave_polygon, box), epsilon);
+}
@@ -0,0 +1,152 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/geometry/footprint_sweep.hpp"
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using tier4_autoware_utils::FootprintSweep;
+using tier4_autoware_utils::LinearRing2d;
+using tier4_autoware_utils::Point2d;
+using tier4_autoware_utils::Polygon2d;
+
+namespace
+{
+constexpr double epsilon = 1e-6;
+
+geometry_msgs::msg::Pose createPose(const double x, const double y, const double yaw)
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.orientation.z = std::sin(yaw / 2.0);
+  pose.orientation.w = std::cos(yaw / 2.0);
+  return pose;
+}
+
+LinearRing2d createLocalFootprint()
+{
+  // front 2.0 m, rear 1.0 m and width 1.0 m with the collinear points at the center
+  return {Point2d(2.0, 0.5),  Point2d(2.0, -0.5), Point2d(0.5, -0.5), Point2d(-1.0, -0.5),
+          Point2d(-1.0, 0.5), Point2d(0.5, 0.5),  Point2d(2.0, 0.5)};
+}
+
+Polygon2d createBox(const double min_x, const double min_y, const double max_x, const double max_y)
+{
+  Polygon2d polygon;
+  polygon.outer() = {
+    Point2d(min_x, min_y), Point2d(min_x, max_y), Point2d(max_x, max_y), Point2d(max_x, min_y),
+    Point2d(min_x, min_y)};
+  boost::geometry::correct(polygon);
+  return polygon;
+}
+}  // namespace
+
+TEST(footprint_sweep, transformFootprint)
+{
+  using tier4_autoware_utils::transformFootprint;
+
+  const auto footprint = transformFootprint(createLocalFootprint(), createPose(1.0, 2.0, M_PI_2));
+  ASSERT_EQ(footprint.size(), 7u);
+  EXPECT_NEAR(footprint.at(0).x(), 0.5, epsilon);
+  EXPECT_NEAR(footprint.at(0).y(), 4.0, epsilon);
+  EXPECT_NEAR(footprint.at(3).x(), 1.5, epsilon);
+  EXPECT_NEAR(footprint.at(3).y(), 1.0, epsilon);
+}
+
+TEST(footprint_sweep, stepPolygons)
+{
+  const FootprintSweep sweep(
+    createLocalFootprint(), {createPose(0.0, 0.0, 0.0), createPose(3.0, 0.0, 0.0)});
+  ASSERT_EQ(sweep.footprints().size(), 2u);
+  ASSERT_EQ(sweep.stepPolygons().size(), 1u);
+
+  // the step polygon is the box from the rear of the first footprint to the front of the second
+  const auto & step_polygon = sweep.stepPolygons().front();
+  EXPECT_TRUE(boost::geometry::within(Point2d(-0.9, 0.4), step_polygon));
+  EXPECT_TRUE(boost::geometry::within(Point2d(4.9, -0.4), step_polygon));
+  EXPECT_FALSE(boost::geometry::within(Point2d(5.1, 0.0), step_polygon));
+  EXPECT_FALSE(boost::geometry::within(Point2d(1.0, 0.6), step_polygon));
+
+  // no step for a single pose
+  const FootprintSweep single_sweep(createLocalFootprint(), {createPose(0.0, 0.0, 0.0)});
+  EXPECT_EQ(single_sweep.footprints().size(), 1u);
+  EXPECT_TRUE(single_sweep.stepPolygons().empty());
+  EXPECT_TRUE(single_sweep.findStepsContaining(Point2d(0.0, 0.0)).empty());
+}
+
+TEST(footprint_sweep, findSteps)
+{
+  // a curved trajectory, whose steps are checked against the exhaustive search
+  std::vector<geometry_msgs::msg::Pose> poses;
+  std::vector<double> times;
+  for (int i = 0; i < 30; ++i) {
+    const double yaw = 0.05 * i;
+    poses.push_back(createPose(20.0 * std::sin(yaw), 20.0 * (1.0 - std::cos(yaw)), yaw));
+    times.push_back(0.1 * i);
+  }
+  const FootprintSweep sweep(createLocalFootprint(), poses, times);
+  const auto & step_polygons = sweep.stepPolygons();
+  ASSERT_EQ(step_polygons.size(), 29u);
+
+  for (double x = -2.0; x < 22.0; x += 0.37) {
+    for (double y = -2.0; y < 22.0; y += 0.41) {
+      const Point2d point(x, y);
+      std::vector<size_t> expected_indices;
+      for (size_t i = 0; i < step_polygons.size(); ++i) {
+        if (boost::geometry::within(point, step_polygons.at(i))) {
+          expected_indices.push_back(i);
+        }
+      }
+      EXPECT_EQ(sweep.findStepsContaining(point), expected_indices);
+
+      const auto box = createBox(x, y, x + 0.3, y + 0.2);
+      expected_indices.clear();
+      for (size_t i = 0; i < step_polygons.size(); ++i) {
+        if (boost::geometry::intersects(box, step_polygons.at(i))) {
+          expected_indices.push_back(i);
+        }
+      }
+      EXPECT_EQ(sweep.findStepsIntersecting(box), expected_indices);
+
+      // the steps out of the time interval are excluded
+      expected_indices.erase(
+        std::remove_if(
+          expected_indices.begin(), expected_indices.end(),
+          [&](const size_t i) { return times.at(i) > 1.0 || times.at(i + 1) < 0.5; }),
+        expected_indices.end());
+      EXPECT_EQ(sweep.findStepsIntersecting(box, 0.5, 1.0), expected_indices);
+    }
+  }
+}
+
+TEST(footprint_sweep, times)
+{
+  const std::vector<geometry_msgs::msg::Pose> poses{
+    createPose(0.0, 0.0, 0.0), createPose(1.0, 0.0, 0.0)};
+  EXPECT_THROW(FootprintSweep(createLocalFootprint(), poses, {0.0}), std::invalid_argument);
+
+  const FootprintSweep sweep(createLocalFootprint(), poses);
+  EXPECT_THROW(
+    sweep.findStepsIntersecting(createBox(0.0, 0.0, 1.0, 1.0), 0.0, 1.0), std::logic_error);
+}
@@ -19,7 +19,9 @@
 
 #include <gtest/gtest.h>
 
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 constexpr double epsilon = 1e-6;
 
@@ -1048,6 +1050,97 @@ TEST(geometry, inverseTransformPoint)
   EXPECT_NEAR(p_transformed.z, expected_p.z, epsilon);
 }
 
+TEST(geometry, transformPoints)
+{
+  using tier4_autoware_utils::createPoint;
+  using tier4_autoware_utils::createQuaternionFromRPY;
+  using tier4_autoware_utils::deg2rad;
+  using tier4_autoware_utils::inverseTransformPoint;
+  using tier4_autoware_utils::inverseTransformPoints;
+  using tier4_autoware_utils::transformPoint;
+  using tier4_autoware_utils::transformPoints;
+
+  geometry_msgs::msg::Pose pose_transform;
+  pose_transform.position.x = 1.0;
+  pose_transform.position.y = 2.0;
+  pose_transform.position.z = 3.0;
+  pose_transform.orientation = createQuaternionFromRPY(deg2rad(30), deg2rad(30), deg2rad(30));
+
+  const std::vector<double> xs{0.0, 2.0, -1.5, 10.0};
+  const std::vector<double> ys{0.0, 4.0, 0.5, -3.0};
+  const std::vector<double> zs{0.0, 6.0, 2.0, 1.0};
+
+  {
+    auto transformed_xs = xs;
+    auto transformed_ys = ys;
+    auto transformed_zs = zs;
+    transformPoints(pose_transform, transformed_xs, transformed_ys, transformed_zs);
+    for (size_t i = 0; i < xs.size(); ++i) {
+      const auto expected_p =
+        transformPoint(createPoint(xs.at(i), ys.at(i), zs.at(i)), pose_transform);
+      EXPECT_NEAR(transformed_xs.at(i), expected_p.x, epsilon);
+      EXPECT_NEAR(transformed_ys.at(i), expected_p.y, epsilon);
+      EXPECT_NEAR(transformed_zs.at(i), expected_p.z, epsilon);
+    }
+  }
+
+  {
+    auto transformed_xs = xs;
+    auto transformed_ys = ys;
+    auto transformed_zs = zs;
+    inverseTransformPoints(pose_transform, transformed_xs, transformed_ys, transformed_zs);
+    for (size_t i = 0; i < xs.size(); ++i) {
+      const auto expected_p =
+        inverseTransformPoint(createPoint(xs.at(i), ys.at(i), zs.at(i)), pose_transform);
+      EXPECT_NEAR(transformed_xs.at(i), expected_p.x, epsilon);
+      EXPECT_NEAR(transformed_ys.at(i), expected_p.y, epsilon);
+      EXPECT_NEAR(transformed_zs.at(i), expected_p.z, epsilon);
+    }
+  }
+
+  // arrays of different sizes
+  {
+    std::vector<double> transformed_xs{0.0, 1.0};
+    std::vector<double> transformed_ys{0.0};
+    std::vector<double> transformed_zs{0.0, 1.0};
+    EXPECT_THROW(
+      transformPoints(pose_transform, transformed_xs, transformed_ys, transformed_zs),
+      std::invalid_argument);
+  }
+}
+
+TEST(geometry, calcDistancesToSegment2d)
+{
+  using tier4_autoware_utils::calcDistancesToSegment2d;
+  using tier4_autoware_utils::createPoint;
+
+  const std::vector<double> xs{-1.0, 0.5, 1.0, 3.0, 2.0};
+  const std::vector<double> ys{0.0, 1.0, -2.0, 0.0, 0.0};
+
+  {
+    std::vector<double> distances;
+    calcDistancesToSegment2d(
+      createPoint(0.0, 0.0, 0.0), createPoint(2.0, 0.0, 0.0), xs, ys, distances);
+    ASSERT_EQ(distances.size(), xs.size());
+    EXPECT_NEAR(distances.at(0), 1.0, epsilon);
+    EXPECT_NEAR(distances.at(1), 1.0, epsilon);
+    EXPECT_NEAR(distances.at(2), 2.0, epsilon);
+    EXPECT_NEAR(distances.at(3), 1.0, epsilon);
+    EXPECT_NEAR(distances.at(4), 0.0, epsilon);
+  }
+
+  // degenerate segment
+  {
+    std::vector<double> distances;
+    calcDistancesToSegment2d(
+      createPoint(1.0, 0.0, 0.0), createPoint(1.0, 0.0, 0.0), xs, ys, distances);
+    ASSERT_EQ(distances.size(), xs.size());
+    EXPECT_NEAR(distances.at(0), 2.0, epsilon);
+    EXPECT_NEAR(distances.at(2), 2.0, epsilon);
+    EXPECT_NEAR(distances.at(3), 2.0, epsilon);
+  }
+}
+
 TEST(geometry, transformVector)
 {
   using tier4_autoware_utils::createQuaternionFromRPY;
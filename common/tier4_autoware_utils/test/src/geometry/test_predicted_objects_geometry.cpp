@@ -0,0 +1,98 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/geometry/predicted_objects_geometry.hpp"
+
+#include <boost/geometry/algorithms/correct.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+using autoware_auto_perception_msgs::msg::PredictedObject;
+using autoware_auto_perception_msgs::msg::PredictedObjects;
+using autoware_auto_perception_msgs::msg::Shape;
+using tier4_autoware_utils::Polygon2d;
+using tier4_autoware_utils::PredictedObjectsGeometry;
+
+namespace
+{
+PredictedObject createObject(const double x, const double y)
+{
+  PredictedObject object;
+  object.kinematics.initial_pose_with_covariance.pose.position.x = x;
+  object.kinematics.initial_pose_with_covariance.pose.position.y = y;
+  object.kinematics.initial_pose_with_covariance.pose.orientation.w = 1.0;
+  object.shape.type = Shape::BOUNDING_BOX;
+  object.shape.dimensions.x = 2.0;
+  object.shape.dimensions.y = 2.0;
+  return object;
+}
+
+Polygon2d createSquare(const double x, const double y, const double half_size)
+{
+  Polygon2d polygon;
+  polygon.outer() = {
+    {x - half_size, y - half_size},
+    {x - half_size, y + half_size},
+    {x + half_size, y + half_size},
+    {x + half_size, y - half_size},
+    {x - half_size, y - half_size}};
+  boost::geometry::correct(polygon);
+  return polygon;
+}
+}  // namespace
+
+TEST(PredictedObjectsGeometry, footprints)
+{
+  PredictedObjects objects;
+  // the object moving along the x axis at 1 m/s for 4 s
+  objects.objects.push_back(createObject(0.0, 0.0));
+  auto & path = objects.objects.back().kinematics.predicted_paths.emplace_back();
+  path.time_step.sec = 1;
+  for (int i = 0; i < 5; ++i) {
+    auto & pose = path.path.emplace_back();
+    pose.position.x = static_cast<double>(i);
+    pose.orientation.w = 1.0;
+  }
+  // the static object without the predicted path
+  objects.objects.push_back(createObject(0.0, 20.0));
+
+  const PredictedObjectsGeometry geometry(objects, 0.5, 10.0);
+  EXPECT_EQ(geometry.objectNum(), 2u);
+  EXPECT_EQ(geometry.timeStepNum(), 21u);
+
+  EXPECT_EQ(geometry.findObjectsIntersecting(createSquare(0.0, 0.0, 0.5)), std::vector<size_t>{0});
+  EXPECT_EQ(geometry.findObjectsIntersecting(createSquare(0.0, 20.0, 0.5)), std::vector<size_t>{1});
+  EXPECT_TRUE(geometry.findObjectsIntersecting(createSquare(10.0, 0.0, 0.5)).empty());
+
+  // at 1.5 s the footprint of the moving object covers [0.5, 2.5] along the x axis
+  ASSERT_EQ(geometry.footprintsAt(3).size(), 1u);
+  EXPECT_EQ(geometry.footprintsAt(3).front().object_index, 0u);
+  EXPECT_NEAR(geometry.footprintsAt(3).front().envelope.min_corner().x(), 0.5, 1e-6);
+  EXPECT_EQ(
+    geometry.findObjectsIntersecting(createSquare(2.3, 0.0, 0.1), 3), std::vector<size_t>{0});
+  EXPECT_TRUE(geometry.findObjectsIntersecting(createSquare(2.3, 0.0, 0.1), 0).empty());
+
+  // the path ends at 4 s
+  EXPECT_EQ(geometry.footprintsAt(8).size(), 1u);
+  EXPECT_TRUE(geometry.footprintsAt(9).empty());
+}
+
+TEST(PredictedObjectsGeometry, invalidTimeStep)
+{
+  EXPECT_THROW(PredictedObjectsGeometry(PredictedObjects{}, 0.0, 10.0), std::invalid_argument);
+  EXPECT_THROW(PredictedObjectsGeometry(PredictedObjects{}, 0.5, -1.0), std::invalid_argument);
+}
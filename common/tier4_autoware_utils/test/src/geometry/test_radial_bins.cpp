@@ -0,0 +1,105 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/geometry/radial_bins.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+struct Value
+{
+  float radius;
+  size_t index;
+};
+}  // namespace
+
+TEST(radial_bins, sortIndicesByBin)
+{
+  using tier4_autoware_utils::sortIndicesByBin;
+
+  const std::vector<int> bin_indices{2, 0, 5, 2, -1, 0, 3, 2};
+  std::vector<size_t> offsets;
+  std::vector<uint32_t> order;
+  sortIndicesByBin(bin_indices, 4, offsets, order);
+
+  // the bin 5 and -1 are dropped
+  EXPECT_EQ(offsets, (std::vector<size_t>{0, 2, 2, 5, 6}));
+  EXPECT_EQ(order, (std::vector<uint32_t>{1, 5, 0, 3, 7, 6}));
+
+  // the buffers are overwritten
+  sortIndicesByBin(std::vector<int>{}, 2, offsets, order);
+  EXPECT_EQ(offsets, (std::vector<size_t>{0, 0, 0}));
+  EXPECT_TRUE(order.empty());
+}
+
+TEST(radial_bins, RadialBins)
+{
+  constexpr size_t bins_num = 16;
+  const auto comp = [](const Value & a, const Value & b) { return a.radius < b.radius; };
+
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<size_t> bin_dist(0, bins_num + 2);
+  // coarse radii to have equal ones in a bin
+  std::uniform_int_distribution<int> radius_dist(0, 20);
+
+  tier4_autoware_utils::RadialBins<Value> bins;
+  for (const size_t values_num : {0, 1, 500, 100}) {
+    std::vector<std::vector<Value>> expected(bins_num);
+    bins.reset(bins_num);
+    for (size_t i = 0; i < values_num; ++i) {
+      const size_t bin_index = bin_dist(engine);
+      const Value value{static_cast<float>(radius_dist(engine)) * 0.5f, i};
+      bins.push_back(bin_index, value);
+      if (bin_index < bins_num) {
+        expected[bin_index].push_back(value);
+      }
+    }
+    bins.sort(comp);
+
+    ASSERT_EQ(bins.size(), bins_num);
+    size_t expected_values_num = 0;
+    for (size_t bin_index = 0; bin_index < bins_num; ++bin_index) {
+      std::sort(expected[bin_index].begin(), expected[bin_index].end(), comp);
+      const auto bin = bins[bin_index];
+      ASSERT_EQ(bin.size(), expected[bin_index].size());
+      EXPECT_EQ(bin.empty(), expected[bin_index].empty());
+      for (size_t i = 0; i < bin.size(); ++i) {
+        EXPECT_EQ(bin[i].radius, expected[bin_index][i].radius);
+        EXPECT_EQ(bin[i].index, expected[bin_index][i].index);
+      }
+      expected_values_num += expected[bin_index].size();
+    }
+    EXPECT_EQ(bins.valuesNum(), expected_values_num);
+  }
+}
+
+TEST(radial_bins, RadialBinsWithoutSort)
+{
+  tier4_autoware_utils::RadialBins<Value> bins;
+  bins.reset(3);
+  bins.push_back(1, Value{1.0f, 0});
+
+  // the bins are empty until sort()
+  EXPECT_EQ(bins.size(), 3u);
+  for (size_t bin_index = 0; bin_index < bins.size(); ++bin_index) {
+    EXPECT_TRUE(bins[bin_index].empty());
+  }
+  EXPECT_EQ(bins.valuesNum(), 0u);
+}
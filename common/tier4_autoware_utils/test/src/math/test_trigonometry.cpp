@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <vector>
 
 TEST(trigonometry, sin)
 {
@@ -50,3 +51,45 @@ TEST(trigonometry, sin_and_cos)
     EXPECT_TRUE(std::abs(std::cos(x * static_cast<float>(i)) - sin_and_cos.second) < 10e-7);
   }
 }
+
+TEST(trigonometry, sin_and_cos_batch)
+{
+  float x = 4.f * tier4_autoware_utils::pi / 128.f;
+  std::vector<float> radians;
+  for (int i = -128; i < 128; i++) {
+    radians.push_back(x * static_cast<float>(i));
+  }
+
+  std::vector<float> sins;
+  std::vector<float> coss;
+  tier4_autoware_utils::sin_and_cos(radians, sins, coss);
+  ASSERT_EQ(sins.size(), radians.size());
+  ASSERT_EQ(coss.size(), radians.size());
+  for (size_t i = 0; i < radians.size(); i++) {
+    const auto sin_and_cos = tier4_autoware_utils::sin_and_cos(radians.at(i));
+    EXPECT_EQ(sins.at(i), sin_and_cos.first);
+    EXPECT_EQ(coss.at(i), sin_and_cos.second);
+  }
+}
+
+TEST(trigonometry, opencv_fast_atan2)
+{
+  float x = 4.f * tier4_autoware_utils::pi / 128.f;
+  std::vector<float> dys;
+  std::vector<float> dxs;
+  for (int i = 0; i < 128; i++) {
+    const float radian = x * static_cast<float>(i) - tier4_autoware_utils::pi;
+    dys.push_back(3.f * std::sin(radian));
+    dxs.push_back(3.f * std::cos(radian));
+  }
+
+  std::vector<float> radians;
+  tier4_autoware_utils::opencv_fast_atan2(dys, dxs, radians);
+  ASSERT_EQ(radians.size(), dys.size());
+  for (size_t i = 0; i < dys.size(); i++) {
+    const float expected = std::atan2(dys.at(i), dxs.at(i));
+    const float diff = std::remainder(radians.at(i) - expected, 2.f * tier4_autoware_utils::pi);
+    EXPECT_TRUE(std::abs(diff) < 2e-4);
+    EXPECT_EQ(radians.at(i), tier4_autoware_utils::opencv_fast_atan2(dys.at(i), dxs.at(i)));
+  }
+}
@@ -0,0 +1,77 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/ros/latest_value_mailbox.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(latest_value_mailbox, store_and_take)
+{
+  tier4_autoware_utils::LatestValueMailbox<int> mailbox;
+  EXPECT_EQ(mailbox.load(), nullptr);
+  EXPECT_EQ(mailbox.takeNew(), nullptr);
+
+  mailbox.store(std::make_shared<const int>(1));
+  mailbox.store(std::make_shared<const int>(2));
+  ASSERT_NE(mailbox.load(), nullptr);
+  EXPECT_EQ(*mailbox.load(), 2);
+
+  // the new value is taken only once, while the latest value is kept
+  const auto new_value = mailbox.takeNew();
+  ASSERT_NE(new_value, nullptr);
+  EXPECT_EQ(*new_value, 2);
+  EXPECT_EQ(mailbox.takeNew(), nullptr);
+  ASSERT_NE(mailbox.load(), nullptr);
+  EXPECT_EQ(*mailbox.load(), 2);
+}
+
+TEST(latest_value_mailbox, concurrent_store_and_take)
+{
+  constexpr int values_num = 10000;
+  tier4_autoware_utils::LatestValueMailbox<int> mailbox;
+
+  std::vector<std::thread> producers;
+  for (int i = 0; i < 2; ++i) {
+    producers.emplace_back([&mailbox, i]() {
+      for (int v = 1; v <= values_num; ++v) {
+        mailbox.store(std::make_shared<const int>(2 * v + i));
+      }
+    });
+  }
+
+  // the values taken by the consumer increase for each producer
+  std::vector<int> last_values(2, 0);
+  bool is_increasing = true;
+  std::thread consumer([&]() {
+    for (int i = 0; i < values_num; ++i) {
+      if (const auto value = mailbox.takeNew()) {
+        is_increasing &= last_values.at(*value % 2) < *value;
+        last_values.at(*value % 2) = *value;
+      }
+    }
+  });
+
+  for (auto & producer : producers) {
+    producer.join();
+  }
+  consumer.join();
+
+  EXPECT_TRUE(is_increasing);
+  ASSERT_NE(mailbox.load(), nullptr);
+  EXPECT_GE(*mailbox.load(), 2 * values_num);
+}
@@ -0,0 +1,117 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rclcpp/rclcpp.hpp>
+#include <tier4_autoware_utils/ros/polling_subscriber.hpp>
+
+#include <std_msgs/msg/header.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using std_msgs::msg::Header;
+
+namespace
+{
+Header createHeader(const std::string & frame_id)
+{
+  Header header;
+  header.frame_id = frame_id;
+  return header;
+}
+
+// NOTE: the messages are delivered by the middleware, so the reception is waited for a while
+template <class Predicate>
+bool waitFor(const Predicate & predicate)
+{
+  for (int i = 0; i < 100; ++i) {
+    if (predicate()) {
+      return true;
+    }
+    rclcpp::sleep_for(std::chrono::milliseconds(10));
+  }
+  return false;
+}
+}  // namespace
+
+TEST(polling_subscriber, take_data)
+{
+  const auto node = std::make_shared<rclcpp::Node>("polling_subscriber_take_data_node");
+  const auto publisher = node->create_publisher<Header>("polling_subscriber_take_data", 1);
+  tier4_autoware_utils::InterProcessPollingSubscriber<Header> subscriber(
+    node.get(), "polling_subscriber_take_data");
+
+  EXPECT_EQ(subscriber.takeData(), nullptr);
+
+  publisher->publish(createHeader("first"));
+  Header::ConstSharedPtr first_data{nullptr};
+  ASSERT_TRUE(waitFor([&]() { return (first_data = subscriber.takeData()) != nullptr; }));
+  EXPECT_EQ(first_data->frame_id, "first");
+
+  // the latest data is kept while no new message is received
+  EXPECT_EQ(subscriber.takeData(), first_data);
+
+  // the data held by the caller is not overwritten by the new message
+  publisher->publish(createHeader("second"));
+  ASSERT_TRUE(waitFor([&]() { return subscriber.takeData() != first_data; }));
+  EXPECT_EQ(first_data->frame_id, "first");
+  EXPECT_EQ(subscriber.takeData()->frame_id, "second");
+
+  EXPECT_THROW(
+    tier4_autoware_utils::InterProcessPollingSubscriber<Header>(
+      node.get(), "polling_subscriber_take_data", rclcpp::QoS{10}),
+    std::invalid_argument);
+}
+
+TEST(polling_subscriber, take_all)
+{
+  const auto node = std::make_shared<rclcpp::Node>("polling_subscriber_take_all_node");
+  const auto publisher = node->create_publisher<Header>("polling_subscriber_take_all", 10);
+  tier4_autoware_utils::InterProcessPollingBatchSubscriber<Header> subscriber(
+    node.get(), "polling_subscriber_take_all", rclcpp::QoS{3});
+
+  EXPECT_TRUE(subscriber.takeAll().empty());
+
+  publisher->publish(createHeader("first"));
+  publisher->publish(createHeader("second"));
+  rclcpp::sleep_for(std::chrono::milliseconds(100));
+  const auto first_data = subscriber.takeAll();
+  ASSERT_EQ(first_data.size(), 2u);
+  EXPECT_EQ(first_data.at(0)->frame_id, "first");
+  EXPECT_EQ(first_data.at(1)->frame_id, "second");
+
+  // only the messages received since the last call are taken
+  EXPECT_TRUE(subscriber.takeAll().empty());
+
+  // the older messages are dropped by the depth, and the data held by the caller is kept
+  for (const auto & frame_id : {"third", "fourth", "fifth", "sixth"}) {
+    publisher->publish(createHeader(frame_id));
+  }
+  rclcpp::sleep_for(std::chrono::milliseconds(100));
+  const auto & second_data = subscriber.takeAll();
+  ASSERT_EQ(second_data.size(), 3u);
+  EXPECT_EQ(second_data.at(0)->frame_id, "fourth");
+  EXPECT_EQ(second_data.at(2)->frame_id, "sixth");
+  EXPECT_EQ(first_data.at(0)->frame_id, "first");
+  EXPECT_EQ(first_data.at(1)->frame_id, "second");
+
+  EXPECT_THROW(
+    tier4_autoware_utils::InterProcessPollingBatchSubscriber<Header>(
+      node.get(), "polling_subscriber_take_all", rclcpp::QoS{rclcpp::KeepAll()}),
+    std::invalid_argument);
+}
@@ -0,0 +1,90 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/system/allocation_counter.hpp"
+#include "tier4_autoware_utils/system/time_keeper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+// the test is linked with tier4_autoware_utils_allocation_hook
+TEST(system, AllocationCounter)
+{
+  using tier4_autoware_utils::AllocationScope;
+  namespace allocation_counter = tier4_autoware_utils::allocation_counter;
+
+  ASSERT_TRUE(allocation_counter::isEnabled());
+
+  std::vector<int> values;
+  values.reserve(1000);
+  {
+    const AllocationScope no_allocation_scope;
+    for (int i = 0; i < 1000; ++i) {
+      values.push_back(i);
+    }
+    EXPECT_EQ(no_allocation_scope.getStats().count, 0u);
+  }
+
+  const AllocationScope scope;
+  const auto live_bytes = allocation_counter::getLiveBytes();
+  auto buffer = std::make_unique<std::vector<double>>(1000);
+  EXPECT_EQ(scope.getStats().count, 2u);
+  EXPECT_GE(scope.getStats().bytes, sizeof(double) * 1000);
+  EXPECT_GE(allocation_counter::getLiveBytes(), live_bytes + sizeof(double) * 1000);
+  EXPECT_GE(allocation_counter::getPeakLiveBytes(), allocation_counter::getLiveBytes());
+  buffer.reset();
+  EXPECT_EQ(allocation_counter::getLiveBytes(), live_bytes);
+
+  // each thread has its own counts
+  std::thread thread([] {
+    const AllocationScope thread_scope;
+    const std::vector<int> thread_values(100);
+    EXPECT_EQ(thread_scope.getStats().count, 1u);
+  });
+  const auto count = scope.getStats().count;
+  thread.join();
+  EXPECT_EQ(scope.getStats().count, count);
+
+  EXPECT_GT(allocation_counter::getMaxResidentBytes(), 0u);
+}
+
+TEST(system, TimeKeeperAllocations)
+{
+  using tier4_autoware_utils::TimeKeeper;
+
+  TimeKeeper time_keeper;
+  std::vector<int> values;
+  for (int i = 0; i < 2; ++i) {
+    TimeKeeper::ScopedSpan total(time_keeper, "total");
+    {
+      TimeKeeper::ScopedSpan child(time_keeper, "child");
+      values = std::vector<int>(100);
+    }
+  }
+
+  const auto spans = time_keeper.getSpans();
+  ASSERT_EQ(spans.size(), 2u);
+  // NOTE: the first spans may also count the allocations of the TimeKeeper itself
+  EXPECT_EQ(spans.at(1)->last_allocations.count, 1u);
+  EXPECT_GE(spans.at(1)->total_allocations.count, 2u);
+  EXPECT_GE(spans.at(1)->last_allocations.bytes, sizeof(int) * 100);
+  // the allocations of the children are included
+  EXPECT_GE(spans.at(0)->last_allocations.count, spans.at(1)->last_allocations.count);
+
+  time_keeper.resetHistograms();
+  EXPECT_EQ(time_keeper.getSpans().at(1)->total_allocations.count, 0u);
+}
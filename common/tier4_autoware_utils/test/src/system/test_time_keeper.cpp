@@ -0,0 +1,85 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/system/time_keeper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+TEST(system, LatencyHistogram)
+{
+  using tier4_autoware_utils::LatencyHistogram;
+
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_DOUBLE_EQ(histogram.percentile(50.0), 0.0);
+
+  // 1, 2, ..., 1000 [ms]
+  for (int i = 1; i <= 1000; ++i) {
+    histogram.record(static_cast<double>(i));
+  }
+  EXPECT_EQ(histogram.count(), 1000u);
+  EXPECT_NEAR(histogram.mean(), 500.5, 1e-9);
+  EXPECT_DOUBLE_EQ(histogram.max(), 1000.0);
+
+  // the relative error of the percentiles is less than 1/16
+  EXPECT_NEAR(histogram.percentile(50.0), 500.0, 500.0 / 16.0);
+  EXPECT_NEAR(histogram.percentile(99.0), 990.0, 990.0 / 16.0);
+  EXPECT_LE(histogram.percentile(100.0), 1000.0);
+  EXPECT_NEAR(histogram.percentile(0.0), 1.0, 1.0 / 16.0);
+
+  // the latencies less than 16 [us] are exact
+  histogram.reset();
+  histogram.record(0.005);
+  EXPECT_EQ(histogram.count(), 1u);
+  EXPECT_DOUBLE_EQ(histogram.percentile(50.0), 0.005);
+}
+
+TEST(system, TimeKeeper)
+{
+  using tier4_autoware_utils::TimeKeeper;
+
+  TimeKeeper time_keeper;
+  for (int i = 0; i < 3; ++i) {
+    TimeKeeper::ScopedSpan total(time_keeper, "total");
+    {
+      TimeKeeper::ScopedSpan child(time_keeper, "child");
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    {
+      TimeKeeper::ScopedSpan other_child(time_keeper, "other_child");
+      TimeKeeper::ScopedSpan grandchild(time_keeper, "child");
+    }
+  }
+
+  const auto spans = time_keeper.getSpans();
+  ASSERT_EQ(spans.size(), 4u);
+  EXPECT_EQ(spans.at(0)->path, "total");
+  EXPECT_EQ(spans.at(1)->path, "total/child");
+  EXPECT_EQ(spans.at(2)->path, "total/other_child");
+  EXPECT_EQ(spans.at(3)->path, "total/other_child/child");
+  EXPECT_EQ(spans.at(3)->depth, 2u);
+  for (const auto * span : spans) {
+    EXPECT_EQ(span->histogram.count(), 3u);
+  }
+  EXPECT_GE(spans.at(0)->last_ms, spans.at(1)->last_ms);
+  EXPECT_GE(spans.at(1)->last_ms, 10.0);
+
+  time_keeper.resetHistograms();
+  EXPECT_EQ(time_keeper.getSpans().at(0)->histogram.count(), 0u);
+
+  ASSERT_ANY_THROW(time_keeper.end());
+}
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
 
 #include <thread>
 
@@ -57,3 +58,36 @@ TEST(system, empty_point_cloud)
     tier4_autoware_utils::transformPointCloud(cloud, cloud_transformed, transform));
   EXPECT_EQ(cloud_transformed.size(), 0ul);
 }
+
+TEST(system, transform_point_cloud2_in_place)
+{
+  pcl::PointCloud<pcl::PointXYZI> cloud;
+  cloud.push_back(pcl::PointXYZI(10.055880, -42.758892, -10.636949, 4));
+  cloud.push_back(pcl::PointXYZI(23.282284, -29.485722, -11.468469, 5));
+
+  Eigen::Matrix<float, 4, 4> transform;
+  transform << 0.834513, -0.550923, -0.008474, 89571.148438, 0.550986, 0.834372, 0.015428,
+    42301.179688, -0.001429, -0.017543, 0.999845, -3.157415, 0.000000, 0.000000, 0.000000, 1.000000;
+
+  pcl::PointCloud<pcl::PointXYZI> cloud_transformed;
+  tier4_autoware_utils::transformPointCloud(cloud, cloud_transformed, transform);
+
+  sensor_msgs::msg::PointCloud2 cloud_msg;
+  pcl::toROSMsg(cloud, cloud_msg);
+  EXPECT_TRUE(tier4_autoware_utils::transformPointCloud(cloud_msg, transform));
+  pcl::PointCloud<pcl::PointXYZI> cloud_msg_transformed;
+  pcl::fromROSMsg(cloud_msg, cloud_msg_transformed);
+
+  ASSERT_EQ(cloud_msg_transformed.size(), cloud_transformed.size());
+  constexpr float float_error = 0.0001;
+  for (size_t i = 0; i < cloud_transformed.size(); ++i) {
+    EXPECT_NEAR(cloud_msg_transformed[i].x, cloud_transformed[i].x, float_error);
+    EXPECT_NEAR(cloud_msg_transformed[i].y, cloud_transformed[i].y, float_error);
+    EXPECT_NEAR(cloud_msg_transformed[i].z, cloud_transformed[i].z, float_error);
+    EXPECT_EQ(cloud_msg_transformed[i].intensity, cloud[i].intensity);
+  }
+
+  // the pointcloud without the xyz fields is not transformed
+  sensor_msgs::msg::PointCloud2 empty_msg;
+  EXPECT_FALSE(tier4_autoware_utils::transformPointCloud(empty_msg, transform));
+}
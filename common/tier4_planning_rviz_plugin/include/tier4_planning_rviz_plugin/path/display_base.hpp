@@ -35,8 +35,10 @@
 #include <OgreSceneManager.h>
 #include <OgreSceneNode.h>
 
+#include <array>
 #include <deque>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #define EIGEN_MPL2_ONLY
@@ -356,48 +358,47 @@ protected:
     const float right = property_path_width_view_.getBool() ? property_path_width_.getFloat() / 2.0
                                                             : info->width / 2.0;
 
+    // NOTE: The properties are read once per message instead of once per point.
+    const bool is_path_view = property_path_view_.getBool();
+    const bool is_path_color_view = property_path_color_view_.getBool();
+    const Ogre::ColourValue path_color =
+      rviz_common::properties::qtToOgre(property_path_color_.getColor());
+    const float path_alpha = property_path_alpha_.getFloat();
+    const bool is_velocity_view = property_velocity_view_.getBool();
+    const bool is_velocity_color_view = property_velocity_color_view_.getBool();
+    const Ogre::ColourValue velocity_color =
+      rviz_common::properties::qtToOgre(property_velocity_color_.getColor());
+    const float velocity_alpha = property_velocity_alpha_.getFloat();
+    const float velocity_scale = property_velocity_scale_.getFloat();
+    const float vel_max = property_vel_max_.getFloat();
+
     for (size_t point_idx = 0; point_idx < msg_ptr->points.size(); point_idx++) {
       const auto & path_point = msg_ptr->points.at(point_idx);
       const auto & pose = tier4_autoware_utils::getPose(path_point);
       const auto & velocity = tier4_autoware_utils::getLongitudinalVelocity(path_point);
 
       // path
-      if (property_path_view_.getBool()) {
+      if (is_path_view) {
         Ogre::ColourValue color;
-        if (property_path_color_view_.getBool()) {
-          color = rviz_common::properties::qtToOgre(property_path_color_.getColor());
+        if (is_path_color_view) {
+          color = path_color;
         } else {
           // color change depending on velocity
           std::unique_ptr<Ogre::ColourValue> dynamic_color_ptr =
-            setColorDependsOnVelocity(property_vel_max_.getFloat(), velocity);
+            setColorDependsOnVelocity(vel_max, velocity);
           color = *dynamic_color_ptr;
         }
-        color.a = property_path_alpha_.getFloat();
-        Eigen::Vector3f vec_in;
-        Eigen::Vector3f vec_out;
-        Eigen::Quaternionf quat_yaw_reverse(0, 0, 0, 1);
-        {
-          vec_in << 0, right, 0;
-          Eigen::Quaternionf quat(
-            pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
-          if (!isDrivingForward(msg_ptr->points, point_idx)) {
-            quat *= quat_yaw_reverse;
-          }
-          vec_out = quat * vec_in;
-          path_manual_object_->position(
-            static_cast<float>(pose.position.x) + vec_out.x(),
-            static_cast<float>(pose.position.y) + vec_out.y(),
-            static_cast<float>(pose.position.z) + vec_out.z());
-          path_manual_object_->colour(color);
+        color.a = path_alpha;
+        Eigen::Quaternionf quat(
+          pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
+        if (!isDrivingForward(msg_ptr->points, point_idx)) {
+          const Eigen::Quaternionf quat_yaw_reverse(0, 0, 0, 1);
+          quat *= quat_yaw_reverse;
         }
-        {
-          vec_in << 0, left, 0;
-          Eigen::Quaternionf quat(
-            pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
-          if (!isDrivingForward(msg_ptr->points, point_idx)) {
-            quat *= quat_yaw_reverse;
-          }
-          vec_out = quat * vec_in;
+        // the left and right edges are on the lateral axis of the pose
+        const Eigen::Vector3f lateral_vec = quat * Eigen::Vector3f::UnitY();
+        for (const float lateral_offset : {right, left}) {
+          const Eigen::Vector3f vec_out = lateral_offset * lateral_vec;
           path_manual_object_->position(
             static_cast<float>(pose.position.x) + vec_out.x(),
             static_cast<float>(pose.position.y) + vec_out.y(),
@@ -407,21 +408,21 @@ protected:
       }
 
       // velocity
-      if (property_velocity_view_.getBool()) {
+      if (is_velocity_view) {
         Ogre::ColourValue color;
-        if (property_velocity_color_view_.getBool()) {
-          color = rviz_common::properties::qtToOgre(property_velocity_color_.getColor());
+        if (is_velocity_color_view) {
+          color = velocity_color;
         } else {
           /* color change depending on velocity */
           std::unique_ptr<Ogre::ColourValue> dynamic_color_ptr =
-            setColorDependsOnVelocity(property_vel_max_.getFloat(), velocity);
+            setColorDependsOnVelocity(vel_max, velocity);
           color = *dynamic_color_ptr;
         }
-        color.a = property_velocity_alpha_.getFloat();
+        color.a = velocity_alpha;
 
         velocity_manual_object_->position(
           pose.position.x, pose.position.y,
-          static_cast<float>(pose.position.z) + velocity * property_velocity_scale_.getFloat());
+          static_cast<float>(pose.position.z) + velocity * velocity_scale);
         velocity_manual_object_->colour(color);
       }
 
@@ -508,70 +509,71 @@ protected:
     const float left = -info->width / 2.0;
     const float right = info->width / 2.0;
 
+    const bool is_footprint_view = property_footprint_view_.getBool();
+    Ogre::ColourValue footprint_color =
+      rviz_common::properties::qtToOgre(property_footprint_color_.getColor());
+    footprint_color.a = property_footprint_alpha_.getFloat();
+    const std::array<Eigen::Vector3f, 4> footprint_offset_vecs{
+      Eigen::Vector3f{top, left, 0.0}, Eigen::Vector3f{top, right, 0.0},
+      Eigen::Vector3f{bottom, right, 0.0}, Eigen::Vector3f{bottom, left, 0.0}};
+
+    const bool is_point_view = property_point_view_.getBool();
+    Ogre::ColourValue point_color =
+      rviz_common::properties::qtToOgre(property_point_color_.getColor());
+    point_color.a = property_point_alpha_.getFloat();
+    const double point_offset = property_point_offset_.getFloat();
+    const double point_radius = property_point_radius_.getFloat();
+    // NOTE: The circle of the point is the same at every point, so that it is calculated once.
+    std::array<std::pair<double, double>, 9> point_circle_offsets;
+    for (size_t s_idx = 0; s_idx < point_circle_offsets.size(); ++s_idx) {
+      const double angle = static_cast<double>(s_idx) / 8.0 * 2.0 * M_PI;
+      point_circle_offsets.at(s_idx) = {
+        point_radius * std::cos(angle), point_radius * std::sin(angle)};
+    }
+
     for (size_t p_idx = 0; p_idx < msg_ptr->points.size(); p_idx++) {
       const auto & point = msg_ptr->points.at(p_idx);
       const auto & pose = tier4_autoware_utils::getPose(point);
       // footprint
-      if (property_footprint_view_.getBool()) {
-        Ogre::ColourValue color;
-        color = rviz_common::properties::qtToOgre(property_footprint_color_.getColor());
-        color.a = property_footprint_alpha_.getFloat();
-
-        const std::array<float, 4> lon_offset_vec{top, top, bottom, bottom};
-        const std::array<float, 4> lat_offset_vec{left, right, right, left};
-
+      if (is_footprint_view) {
+        const Eigen::Quaternionf quat(
+          pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
+        std::array<Eigen::Vector3f, 4> offset_to_edges;
         for (int f_idx = 0; f_idx < 4; ++f_idx) {
-          const Eigen::Quaternionf quat(
-            pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
+          offset_to_edges.at(f_idx) = quat * footprint_offset_vecs.at(f_idx);
+        }
 
-          {
-            const Eigen::Vector3f offset_vec{
-              lon_offset_vec.at(f_idx), lat_offset_vec.at(f_idx), 0.0};
-            const auto offset_to_edge = quat * offset_vec;
-            footprint_manual_object_->position(
-              pose.position.x + offset_to_edge.x(), pose.position.y + offset_to_edge.y(),
-              pose.position.z);
-            footprint_manual_object_->colour(color);
-          }
-          {
-            const Eigen::Vector3f offset_vec{
-              lon_offset_vec.at((f_idx + 1) % 4), lat_offset_vec.at((f_idx + 1) % 4), 0.0};
-            const auto offset_to_edge = quat * offset_vec;
+        for (int f_idx = 0; f_idx < 4; ++f_idx) {
+          for (const int e_idx : {f_idx, (f_idx + 1) % 4}) {
+            const auto & offset_to_edge = offset_to_edges.at(e_idx);
             footprint_manual_object_->position(
               pose.position.x + offset_to_edge.x(), pose.position.y + offset_to_edge.y(),
               pose.position.z);
-            footprint_manual_object_->colour(color);
+            footprint_manual_object_->colour(footprint_color);
           }
         }
       }
 
       // point
-      if (property_point_view_.getBool()) {
-        Ogre::ColourValue color;
-        color = rviz_common::properties::qtToOgre(property_point_color_.getColor());
-        color.a = property_point_alpha_.getFloat();
-
-        const double offset = property_point_offset_.getFloat();
+      if (is_point_view) {
         const double yaw = tf2::getYaw(pose.orientation);
-        const double base_x = pose.position.x + offset * std::cos(yaw);
-        const double base_y = pose.position.y + offset * std::sin(yaw);
+        const double base_x = pose.position.x + point_offset * std::cos(yaw);
+        const double base_y = pose.position.y + point_offset * std::sin(yaw);
         const double base_z = pose.position.z;
 
-        const double radius = property_point_radius_.getFloat();
         for (size_t s_idx = 0; s_idx < 8; ++s_idx) {
-          const double current_angle = static_cast<double>(s_idx) / 8.0 * 2.0 * M_PI;
-          const double next_angle = static_cast<double>(s_idx + 1) / 8.0 * 2.0 * M_PI;
+          const auto & current_offset = point_circle_offsets.at(s_idx);
+          const auto & next_offset = point_circle_offsets.at(s_idx + 1);
           point_manual_object_->position(
-            base_x + radius * std::cos(current_angle), base_y + radius * std::sin(current_angle),
-            base_z);
-          point_manual_object_->colour(color);
+            base_x + current_offset.first, base_y + current_offset.second, base_z);
+          point_manual_object_->colour(point_color);
 
           point_manual_object_->position(
-            base_x + radius * std::cos(next_angle), base_y + radius * std::sin(next_angle), base_z);
-          point_manual_object_->colour(color);
+            base_x + next_offset.first, base_y + next_offset.second, base_z);
+          point_manual_object_->colour(point_color);
 
           point_manual_object_->position(base_x, base_y, base_z);
-          point_manual_object_->colour(color);
+          point_manual_object_->colour(point_color);
         }
       }
 
@@ -23,7 +23,7 @@
 namespace rviz_plugins
 {
 template <class T>
-bool isDrivingForward(const T points_with_twist, size_t target_idx)
+bool isDrivingForward(const T & points_with_twist, size_t target_idx)
 {
   constexpr double epsilon = 1e-6;
 
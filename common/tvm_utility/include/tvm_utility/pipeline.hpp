@@ -23,10 +23,17 @@
 #include <tvm_vendor/tvm/runtime/packed_func.h>
 #include <tvm_vendor/tvm/runtime/registry.h>
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -183,6 +190,263 @@ private:
   PostProcessorType post_processor_{};
 };
 
+/**
+ * @class BoundedQueue
+ * @brief Blocking FIFO queue with a maximum size, used between the stages of AsyncPipeline.
+ */
+template <class T>
+class BoundedQueue
+{
+public:
+  explicit BoundedQueue(const size_t capacity) : capacity_(std::max<size_t>(capacity, 1)) {}
+
+  /**
+   * @brief Push an element, waiting while the queue is full.
+   *
+   * @return false if the queue is closed
+   */
+  bool push(T && element)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return closed_ || elements_.size() < capacity_; });
+    if (closed_) {
+      return false;
+    }
+    elements_.push_back(std::move(element));
+    not_empty_.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Pop an element, waiting while the queue is empty.
+   *
+   * @return false if the queue is closed and empty
+   */
+  bool pop(T & element)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return closed_ || !elements_.empty(); });
+    if (elements_.empty()) {
+      return false;
+    }
+    element = std::move(elements_.front());
+    elements_.pop_front();
+    not_full_.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Reject the following pushes and wake up the waiting threads. The remaining elements
+   * can still be popped.
+   */
+  void close()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    not_full_.notify_all();
+    not_empty_.notify_all();
+  }
+
+private:
+  const size_t capacity_;
+  std::deque<T> elements_;
+  bool closed_{false};
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+
+/**
+ * @class TVMArrayPool
+ * @brief Pool of tensors the outputs of a stage are copied into, so that the stage can overwrite
+ * its own output buffers while the next stage is still reading the previous ones.
+ */
+class TVMArrayPool
+{
+public:
+  /**
+   * @brief Copy the tensors into a buffer of the pool, allocating a new buffer with the same
+   * shapes and types if no buffer is free.
+   */
+  TVMArrayContainerVector copy(const TVMArrayContainerVector & tensors)
+  {
+    TVMArrayContainerVector buffer;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!free_buffers_.empty()) {
+        buffer = std::move(free_buffers_.back());
+        free_buffers_.pop_back();
+      }
+    }
+    if (buffer.size() != tensors.size()) {
+      buffer.clear();
+      for (const auto & tensor : tensors) {
+        const DLTensor * array = tensor.getArray();
+        buffer.emplace_back(
+          std::vector<int64_t>(array->shape, array->shape + array->ndim),
+          static_cast<DLDataTypeCode>(array->dtype.code), array->dtype.bits, array->dtype.lanes,
+          array->device.device_type, array->device.device_id);
+      }
+    }
+    for (size_t i = 0; i < tensors.size(); ++i) {
+      TVMArrayCopyFromTo(tensors[i].getArray(), buffer[i].getArray(), nullptr);
+    }
+    return buffer;
+  }
+
+  /**
+   * @brief Give the buffer back to the pool once the next stage does not read it anymore.
+   */
+  void release(TVMArrayContainerVector && buffer)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_buffers_.push_back(std::move(buffer));
+  }
+
+private:
+  std::vector<TVMArrayContainerVector> free_buffers_;
+  std::mutex mutex_;
+};
+
+/**
+ * @class AsyncPipeline
+ * @brief Inference Pipeline running each of the 3 stages in its own thread, so that the
+ * preprocessing of a frame, the inference of the previous frame and the postprocessing of the one
+ * before are executed at the same time.
+ * @details The frames are passed between the stages through queues of queue_size frames, and
+ * schedule() waits while the first queue is full. The tensors are copied between the stages into
+ * buffer pools, since the stages reuse their output buffers. The stages must not share any state
+ * with each other or with the caller, because they run in different threads.
+ */
+template <class PreProcessorType, class InferenceEngineType, class PostProcessorType>
+class AsyncPipeline
+{
+  using InputType = decltype(std::declval<PreProcessorType>().input_type_indicator_);
+  using OutputType = decltype(std::declval<PostProcessorType>().output_type_indicator_);
+
+  struct InputFrame
+  {
+    InputType input;
+    std::promise<OutputType> promise;
+  };
+  struct TensorFrame
+  {
+    TVMArrayContainerVector tensors;
+    std::promise<OutputType> promise;
+  };
+
+public:
+  /**
+   * @brief Construct a new AsyncPipeline object and start the threads of the stages
+   *
+   * @param pre_processor a PreProcessor object
+   * @param inference_engine a InferenceEngine object
+   * @param post_processor a PostProcessor object
+   * @param queue_size the maximum number of frames waiting for each stage
+   */
+  AsyncPipeline(
+    PreProcessorType pre_processor, InferenceEngineType inference_engine,
+    PostProcessorType post_processor, const size_t queue_size = 1)
+  : pre_processor_(pre_processor),
+    inference_engine_(inference_engine),
+    post_processor_(post_processor),
+    input_queue_(queue_size),
+    pre_processed_queue_(queue_size),
+    inferred_queue_(queue_size)
+  {
+    pre_processor_thread_ = std::thread([this] { runPreProcessor(); });
+    inference_engine_thread_ = std::thread([this] { runInferenceEngine(); });
+    post_processor_thread_ = std::thread([this] { runPostProcessor(); });
+  }
+
+  AsyncPipeline(const AsyncPipeline &) = delete;
+  AsyncPipeline & operator=(const AsyncPipeline &) = delete;
+
+  /**
+   * @brief Finish the frames already scheduled and stop the threads
+   */
+  ~AsyncPipeline()
+  {
+    input_queue_.close();
+    pre_processor_thread_.join();
+    inference_engine_thread_.join();
+    post_processor_thread_.join();
+  }
+
+  /**
+   * @brief push the input into the pipeline, waiting while the preprocessor is busy with
+   * queue_size frames.
+   *
+   * @param input The data to push into the pipeline
+   * @return The future of the pipeline output, which rethrows the exception thrown by a stage
+   */
+  std::future<OutputType> schedule(const InputType & input)
+  {
+    InputFrame frame{input, std::promise<OutputType>()};
+    auto future = frame.promise.get_future();
+    input_queue_.push(std::move(frame));
+    return future;
+  }
+
+private:
+  void runPreProcessor()
+  {
+    InputFrame frame;
+    while (input_queue_.pop(frame)) {
+      try {
+        const auto tensors = pre_processor_.schedule(frame.input);
+        pre_processed_queue_.push(
+          TensorFrame{pre_processed_pool_.copy(tensors), std::move(frame.promise)});
+      } catch (...) {
+        frame.promise.set_exception(std::current_exception());
+      }
+    }
+    pre_processed_queue_.close();
+  }
+
+  void runInferenceEngine()
+  {
+    TensorFrame frame;
+    while (pre_processed_queue_.pop(frame)) {
+      try {
+        const auto tensors = inference_engine_.schedule(frame.tensors);
+        inferred_queue_.push(TensorFrame{inferred_pool_.copy(tensors), std::move(frame.promise)});
+      } catch (...) {
+        frame.promise.set_exception(std::current_exception());
+      }
+      pre_processed_pool_.release(std::move(frame.tensors));
+    }
+    inferred_queue_.close();
+  }
+
+  void runPostProcessor()
+  {
+    TensorFrame frame;
+    while (inferred_queue_.pop(frame)) {
+      try {
+        frame.promise.set_value(post_processor_.schedule(frame.tensors));
+      } catch (...) {
+        frame.promise.set_exception(std::current_exception());
+      }
+      inferred_pool_.release(std::move(frame.tensors));
+    }
+  }
+
+  PreProcessorType pre_processor_;
+  InferenceEngineType inference_engine_;
+  PostProcessorType post_processor_;
+
+  BoundedQueue<InputFrame> input_queue_;
+  BoundedQueue<TensorFrame> pre_processed_queue_;
+  BoundedQueue<TensorFrame> inferred_queue_;
+  TVMArrayPool pre_processed_pool_;
+  TVMArrayPool inferred_pool_;
+
+  std::thread pre_processor_thread_;
+  std::thread inference_engine_thread_;
+  std::thread post_processor_thread_;
+};
+
 // NetworkNode
 typedef struct
 {
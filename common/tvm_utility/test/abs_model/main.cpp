@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <future>
 #include <string>
 #include <utility>
 #include <vector>
@@ -142,5 +143,36 @@ TEST(PipelineExamples, SimplePipeline)
   }
 }
 
+TEST(PipelineExamples, AsyncPipeline)
+{
+  using PrePT = PreProcessorLinearModel;
+  using IET = tvm_utility::pipeline::InferenceEngineTVM;
+  using PostPT = PostProcessorLinearModel;
+
+  PrePT PreP{config};
+  IET IE{config, "tvm_utility"};
+  PostPT PostP{config};
+
+  tvm_utility::pipeline::AsyncPipeline<PrePT, IET, PostPT> pipeline(PreP, IE, PostP, 2);
+
+  // schedule several frames before getting the outputs, so that the stages run at the same time
+  std::vector<std::future<std::vector<float>>> outputs;
+  for (int frame = 0; frame < 8; ++frame) {
+    const float offset = static_cast<float>(frame);
+    outputs.push_back(pipeline.schedule({-1.f - offset, -2.f, -3.f, 4.f + offset}));
+  }
+
+  for (int frame = 0; frame < 8; ++frame) {
+    const float offset = static_cast<float>(frame);
+    const auto output = outputs[frame].get();
+    const std::vector<float> expected_output{1.f + offset, 2.f, 3.f, 4.f + offset};
+    ASSERT_EQ(expected_output.size(), output.size()) << "Unexpected output size";
+    for (size_t i = 0; i < output.size(); ++i) {
+      EXPECT_NEAR(expected_output[i], output[i], 0.0001)
+        << "at frame: " << frame << ", index: " << i;
+    }
+  }
+}
+
 }  // namespace abs_model
 }  // namespace tvm_utility
@@ -0,0 +1,85 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTONOMOUS_EMERGENCY_BRAKING__CORRIDOR_GRID_HPP_
+#define AUTONOMOUS_EMERGENCY_BRAKING__CORRIDOR_GRID_HPP_
+
+#include <Eigen/Core>
+#include <tier4_autoware_utils/geometry/boost_geometry.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <pcl/PointIndices.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace autoware::motion::control::autonomous_emergency_braking
+{
+using tier4_autoware_utils::Polygon2d;
+
+/**
+ * @brief lookup grid of the ego footprint path, which is rasterized once per path
+ * @details The cells which are fully inside a polygon or do not intersect any polygon are
+ * answered by the lookup, and only the points in the cells on the boundary of the polygons are
+ * tested against the polygons overlapping the cell, so the result is the same as testing every
+ * polygon.
+ */
+class CorridorGrid
+{
+public:
+  CorridorGrid(const std::vector<Polygon2d> & polygons, const double resolution);
+
+  bool isInside(const double x, const double y) const;
+
+private:
+  enum class CellState : uint8_t { OUTSIDE, INSIDE, BOUNDARY };
+
+  std::vector<Polygon2d> polygons_;
+  double resolution_{1.0};
+  double min_x_{0.0};
+  double min_y_{0.0};
+  int width_{0};
+  int height_{0};
+  std::vector<CellState> cell_states_;
+  // indices of the polygons overlapping each cell, which are used only for the boundary cells
+  std::vector<std::vector<size_t>> cell_polygon_indices_;
+};
+
+/**
+ * @brief extract the points inside the corridor in a single pass over the buffer of the cloud
+ * @details Each point is transformed to base_link, filtered by the height and the corridor, and
+ * then the points inside the corridor are downsampled by the centroid of each voxel as
+ * pcl::VoxelGrid does. So the whole cloud is neither converted to pcl nor downsampled.
+ */
+pcl::PointCloud<pcl::PointXYZ> extractCorridorPoints(
+  const sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Matrix4f & transform,
+  const CorridorGrid & corridor, const double min_height, const double max_height,
+  const Eigen::Vector3f & voxel_size);
+
+/**
+ * @brief cluster the points whose distance is within the tolerance by union-find on a grid
+ * @details The grid size is the tolerance, so only the points in the 27 neighboring cells are
+ * compared, and the clusters are the same as pcl::EuclideanClusterExtraction. The clusters whose
+ * size is out of [min_cluster_size, max_cluster_size] are dropped.
+ */
+std::vector<pcl::PointIndices> clusterPointsByGrid(
+  const pcl::PointCloud<pcl::PointXYZ> & points, const double tolerance,
+  const int min_cluster_size, const int max_cluster_size);
+
+}  // namespace autoware::motion::control::autonomous_emergency_braking
+
+#endif  // AUTONOMOUS_EMERGENCY_BRAKING__CORRIDOR_GRID_HPP_
@@ -19,6 +19,7 @@
 #include <motion_utils/trajectory/trajectory.hpp>
 #include <pcl_ros/transforms.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <tier4_autoware_utils/geometry/footprint_sweep.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/ros/polling_subscriber.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
@@ -61,6 +62,7 @@ using sensor_msgs::msg::PointCloud2;
 using PointCloud = pcl::PointCloud<pcl::PointXYZ>;
 using diagnostic_updater::DiagnosticStatusWrapper;
 using diagnostic_updater::Updater;
+using tier4_autoware_utils::FootprintSweep;
 using tier4_autoware_utils::Point2d;
 using tier4_autoware_utils::Polygon2d;
 using vehicle_info_util::VehicleInfo;
@@ -270,10 +272,10 @@ public:
 
   Path generateEgoPath(const double curr_v, const double curr_w);
   std::optional<Path> generateEgoPath(const Trajectory & predicted_traj);
-  std::vector<Polygon2d> generatePathFootprint(const Path & path, const double extra_width_margin);
+  FootprintSweep generatePathFootprint(const Path & path, const double extra_width_margin);
 
   void createObjectDataUsingPointCloudClusters(
-    const Path & ego_path, const std::vector<Polygon2d> & ego_polys, const rclcpp::Time & stamp,
+    const Path & ego_path, const FootprintSweep & ego_footprint_sweep, const rclcpp::Time & stamp,
     std::vector<ObjectData> & objects,
     const pcl::PointCloud<pcl::PointXYZ>::Ptr obstacle_points_ptr);
 
@@ -297,6 +299,9 @@ public:
     const ObjectData & closest_object, const Path & path, const double current_ego_speed);
 
   PointCloud2::SharedPtr obstacle_ros_pointcloud_ptr_{nullptr};
+  // input point cloud and its transform to base_link, which are used with use_corridor_grid
+  PointCloud2::ConstSharedPtr input_pointcloud_ptr_{nullptr};
+  Eigen::Matrix4f input_pointcloud_transform_{Eigen::Matrix4f::Identity()};
   VelocityReport::ConstSharedPtr current_velocity_ptr_{nullptr};
   Vector3::SharedPtr angular_velocity_ptr_{nullptr};
   Trajectory::ConstSharedPtr predicted_traj_ptr_{nullptr};
@@ -321,6 +326,8 @@ public:
   double voxel_grid_x_;
   double voxel_grid_y_;
   double voxel_grid_z_;
+  bool use_corridor_grid_;
+  double corridor_grid_resolution_;
   double min_generated_path_length_;
   double expand_width_;
   double longitudinal_offset_;
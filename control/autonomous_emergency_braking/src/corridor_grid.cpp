@@ -0,0 +1,253 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autonomous_emergency_braking/corridor_grid.hpp"
+
+#include <Eigen/Geometry>
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+namespace autoware::motion::control::autonomous_emergency_braking
+{
+namespace bg = boost::geometry;
+using tier4_autoware_utils::Box2d;
+using tier4_autoware_utils::Point2d;
+
+namespace
+{
+// NOTE: 21 bits for each axis, which covers about 100 km with the voxel of 0.05 m
+uint64_t toGridKey(const Eigen::Vector3i & index)
+{
+  constexpr uint64_t mask = (1ULL << 21) - 1;
+  return ((static_cast<uint64_t>(index.x()) & mask) << 42) |
+         ((static_cast<uint64_t>(index.y()) & mask) << 21) |
+         (static_cast<uint64_t>(index.z()) & mask);
+}
+
+Eigen::Vector3i toGridIndex(const Eigen::Vector3f & point, const Eigen::Vector3f & inverse_size)
+{
+  return point.cwiseProduct(inverse_size).array().floor().cast<int>();
+}
+
+size_t findRoot(std::vector<size_t> & parents, size_t index)
+{
+  while (parents.at(index) != index) {
+    parents.at(index) = parents.at(parents.at(index));
+    index = parents.at(index);
+  }
+  return index;
+}
+}  // namespace
+
+CorridorGrid::CorridorGrid(const std::vector<Polygon2d> & polygons, const double resolution)
+: polygons_(polygons), resolution_(resolution)
+{
+  if (polygons_.empty()) {
+    return;
+  }
+
+  std::vector<Box2d> boxes;
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  min_x_ = std::numeric_limits<double>::max();
+  min_y_ = std::numeric_limits<double>::max();
+  for (const auto & polygon : polygons_) {
+    Box2d box;
+    bg::envelope(polygon, box);
+    min_x_ = std::min(min_x_, box.min_corner().x());
+    min_y_ = std::min(min_y_, box.min_corner().y());
+    max_x = std::max(max_x, box.max_corner().x());
+    max_y = std::max(max_y, box.max_corner().y());
+    boxes.push_back(box);
+  }
+  width_ = static_cast<int>(std::floor((max_x - min_x_) / resolution_)) + 1;
+  height_ = static_cast<int>(std::floor((max_y - min_y_) / resolution_)) + 1;
+  cell_states_.assign(static_cast<size_t>(width_ * height_), CellState::OUTSIDE);
+  cell_polygon_indices_.resize(cell_states_.size());
+
+  const auto to_cell = [&](const double value, const double min_value) {
+    return static_cast<int>(std::floor((value - min_value) / resolution_));
+  };
+  for (size_t i = 0; i < polygons_.size(); ++i) {
+    const auto & polygon = polygons_.at(i);
+    const auto & box = boxes.at(i);
+    const int max_ix = to_cell(box.max_corner().x(), min_x_);
+    const int max_iy = to_cell(box.max_corner().y(), min_y_);
+    for (int ix = to_cell(box.min_corner().x(), min_x_); ix <= max_ix; ++ix) {
+      for (int iy = to_cell(box.min_corner().y(), min_y_); iy <= max_iy; ++iy) {
+        const size_t cell_index = static_cast<size_t>(iy * width_ + ix);
+        auto & state = cell_states_.at(cell_index);
+        if (state == CellState::INSIDE) {
+          continue;
+        }
+        const double x0 = min_x_ + ix * resolution_;
+        const double y0 = min_y_ + iy * resolution_;
+        const double x1 = x0 + resolution_;
+        const double y1 = y0 + resolution_;
+        // NOTE: The footprint polygons are convex, so the cell is inside if all the corners are.
+        const bool is_inside =
+          bg::within(Point2d(x0, y0), polygon) && bg::within(Point2d(x1, y0), polygon) &&
+          bg::within(Point2d(x1, y1), polygon) && bg::within(Point2d(x0, y1), polygon);
+        if (is_inside) {
+          state = CellState::INSIDE;
+          cell_polygon_indices_.at(cell_index).clear();
+        } else if (bg::intersects(Box2d(Point2d(x0, y0), Point2d(x1, y1)), polygon)) {
+          state = CellState::BOUNDARY;
+          cell_polygon_indices_.at(cell_index).push_back(i);
+        }
+      }
+    }
+  }
+}
+
+bool CorridorGrid::isInside(const double x, const double y) const
+{
+  if (cell_states_.empty()) {
+    return false;
+  }
+  const int ix = static_cast<int>(std::floor((x - min_x_) / resolution_));
+  const int iy = static_cast<int>(std::floor((y - min_y_) / resolution_));
+  if (ix < 0 || width_ <= ix || iy < 0 || height_ <= iy) {
+    return false;
+  }
+
+  const size_t cell_index = static_cast<size_t>(iy * width_ + ix);
+  switch (cell_states_.at(cell_index)) {
+    case CellState::INSIDE:
+      return true;
+    case CellState::BOUNDARY: {
+      const Point2d point(x, y);
+      const auto & indices = cell_polygon_indices_.at(cell_index);
+      return std::any_of(indices.begin(), indices.end(), [&](const size_t i) {
+        return bg::within(point, polygons_.at(i));
+      });
+    }
+    default:
+      return false;
+  }
+}
+
+pcl::PointCloud<pcl::PointXYZ> extractCorridorPoints(
+  const sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Matrix4f & transform,
+  const CorridorGrid & corridor, const double min_height, const double max_height,
+  const Eigen::Vector3f & voxel_size)
+{
+  const Eigen::Affine3f affine(transform);
+  const Eigen::Vector3f inverse_voxel_size = voxel_size.cwiseInverse();
+
+  // sum of the points and the number of them in each voxel, in the order of the first point
+  std::unordered_map<uint64_t, size_t> voxel_indices;
+  std::vector<std::pair<Eigen::Vector3f, size_t>> voxels;
+
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(cloud, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const Eigen::Vector3f point = affine * Eigen::Vector3f(*iter_x, *iter_y, *iter_z);
+    if (!point.allFinite() || point.z() < min_height || max_height < point.z()) {
+      continue;
+    }
+    if (!corridor.isInside(point.x(), point.y())) {
+      continue;
+    }
+
+    const auto key = toGridKey(toGridIndex(point, inverse_voxel_size));
+    const auto [itr, is_new_voxel] = voxel_indices.emplace(key, voxels.size());
+    if (is_new_voxel) {
+      voxels.emplace_back(point, 1);
+    } else {
+      auto & voxel = voxels.at(itr->second);
+      voxel.first += point;
+      ++voxel.second;
+    }
+  }
+
+  pcl::PointCloud<pcl::PointXYZ> output;
+  output.reserve(voxels.size());
+  for (const auto & [sum, count] : voxels) {
+    const Eigen::Vector3f centroid = sum / static_cast<float>(count);
+    output.push_back(pcl::PointXYZ(centroid.x(), centroid.y(), centroid.z()));
+  }
+  return output;
+}
+
+std::vector<pcl::PointIndices> clusterPointsByGrid(
+  const pcl::PointCloud<pcl::PointXYZ> & points, const double tolerance,
+  const int min_cluster_size, const int max_cluster_size)
+{
+  const Eigen::Vector3f inverse_cell_size =
+    Eigen::Vector3f::Constant(static_cast<float>(1.0 / tolerance));
+  std::unordered_map<uint64_t, std::vector<size_t>> cells;
+  std::vector<Eigen::Vector3i> cell_indices(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    cell_indices.at(i) = toGridIndex(points.at(i).getVector3fMap(), inverse_cell_size);
+    cells[toGridKey(cell_indices.at(i))].push_back(i);
+  }
+
+  // NOTE: The distance is compared with "<" as the radius search of the kd-tree of pcl does.
+  const float squared_tolerance = static_cast<float>(tolerance * tolerance);
+  std::vector<size_t> parents(points.size());
+  std::iota(parents.begin(), parents.end(), 0);
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto & point = points.at(i).getVector3fMap();
+    for (int dx = -1; dx <= 1; ++dx) {
+      for (int dy = -1; dy <= 1; ++dy) {
+        for (int dz = -1; dz <= 1; ++dz) {
+          const auto itr = cells.find(toGridKey(cell_indices.at(i) + Eigen::Vector3i(dx, dy, dz)));
+          if (itr == cells.end()) {
+            continue;
+          }
+          for (const size_t j : itr->second) {
+            if (j <= i) {
+              continue;
+            }
+            if ((points.at(j).getVector3fMap() - point).squaredNorm() < squared_tolerance) {
+              parents.at(findRoot(parents, j)) = findRoot(parents, i);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  std::unordered_map<size_t, size_t> root_to_cluster;
+  std::vector<pcl::PointIndices> clusters;
+  for (size_t i = 0; i < points.size(); ++i) {
+    const size_t root = findRoot(parents, i);
+    const auto [itr, is_new_cluster] = root_to_cluster.emplace(root, clusters.size());
+    if (is_new_cluster) {
+      clusters.emplace_back();
+    }
+    clusters.at(itr->second).indices.push_back(static_cast<int>(i));
+  }
+
+  const auto is_out_of_size = [&](const pcl::PointIndices & cluster) {
+    const int size = static_cast<int>(cluster.indices.size());
+    return size < min_cluster_size || max_cluster_size < size;
+  };
+  clusters.erase(std::remove_if(clusters.begin(), clusters.end(), is_out_of_size), clusters.end());
+  return clusters;
+}
+
+}  // namespace autoware::motion::control::autonomous_emergency_braking
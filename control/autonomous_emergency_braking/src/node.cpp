@@ -14,17 +14,16 @@
 
 #include "autonomous_emergency_braking/node.hpp"
 
+#include "autonomous_emergency_braking/corridor_grid.hpp"
+
 #include <pcl_ros/transforms.hpp>
 #include <tier4_autoware_utils/geometry/boost_geometry.hpp>
 #include <tier4_autoware_utils/geometry/boost_polygon_utils.hpp>
+#include <tier4_autoware_utils/geometry/footprint_sweep.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/ros/marker_helper.hpp>
 #include <tier4_autoware_utils/ros/update_param.hpp>
 
-#include <boost/geometry/algorithms/convex_hull.hpp>
-#include <boost/geometry/algorithms/within.hpp>
-#include <boost/geometry/strategies/agnostic/hull_graham_andrew.hpp>
-
 #include <pcl/PCLPointCloud2.h>
 #include <pcl/filters/crop_hull.h>
 #include <pcl/filters/extract_indices.h>
@@ -47,58 +46,6 @@
 namespace autoware::motion::control::autonomous_emergency_braking
 {
 using diagnostic_msgs::msg::DiagnosticStatus;
-namespace bg = boost::geometry;
-
-void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point & geom_point)
-{
-  Point2d point;
-  point.x() = geom_point.x;
-  point.y() = geom_point.y;
-
-  bg::append(polygon.outer(), point);
-}
-
-Polygon2d createPolygon(
-  const geometry_msgs::msg::Pose & base_pose, const geometry_msgs::msg::Pose & next_pose,
-  const vehicle_info_util::VehicleInfo & vehicle_info, const double expand_width)
-{
-  Polygon2d polygon;
-
-  const double longitudinal_offset = vehicle_info.max_longitudinal_offset_m;
-  const double width = vehicle_info.vehicle_width_m / 2.0 + expand_width;
-  const double rear_overhang = vehicle_info.rear_overhang_m;
-
-  appendPointToPolygon(
-    polygon,
-    tier4_autoware_utils::calcOffsetPose(base_pose, longitudinal_offset, width, 0.0).position);
-  appendPointToPolygon(
-    polygon,
-    tier4_autoware_utils::calcOffsetPose(base_pose, longitudinal_offset, -width, 0.0).position);
-  appendPointToPolygon(
-    polygon, tier4_autoware_utils::calcOffsetPose(base_pose, -rear_overhang, -width, 0.0).position);
-  appendPointToPolygon(
-    polygon, tier4_autoware_utils::calcOffsetPose(base_pose, -rear_overhang, width, 0.0).position);
-
-  appendPointToPolygon(
-    polygon,
-    tier4_autoware_utils::calcOffsetPose(next_pose, longitudinal_offset, width, 0.0).position);
-  appendPointToPolygon(
-    polygon,
-    tier4_autoware_utils::calcOffsetPose(next_pose, longitudinal_offset, -width, 0.0).position);
-  appendPointToPolygon(
-    polygon, tier4_autoware_utils::calcOffsetPose(next_pose, -rear_overhang, -width, 0.0).position);
-  appendPointToPolygon(
-    polygon, tier4_autoware_utils::calcOffsetPose(next_pose, -rear_overhang, width, 0.0).position);
-
-  polygon = tier4_autoware_utils::isClockwise(polygon)
-              ? polygon
-              : tier4_autoware_utils::inverseClockwise(polygon);
-
-  Polygon2d hull_polygon;
-  bg::convex_hull(polygon, hull_polygon);
-
-  return hull_polygon;
-}
 
 AEB::AEB(const rclcpp::NodeOptions & node_options)
 : Node("AEB", node_options),
@@ -127,6 +74,8 @@ AEB::AEB(const rclcpp::NodeOptions & node_options)
   voxel_grid_x_ = declare_parameter<double>("voxel_grid_x");
   voxel_grid_y_ = declare_parameter<double>("voxel_grid_y");
   voxel_grid_z_ = declare_parameter<double>("voxel_grid_z");
+  use_corridor_grid_ = declare_parameter<bool>("use_corridor_grid");
+  corridor_grid_resolution_ = declare_parameter<double>("corridor_grid_resolution");
   min_generated_path_length_ = declare_parameter<double>("min_generated_path_length");
   expand_width_ = declare_parameter<double>("expand_width");
   longitudinal_offset_ = declare_parameter<double>("longitudinal_offset");
@@ -174,6 +123,8 @@ rcl_interfaces::msg::SetParametersResult AEB::onParameter(
   updateParam<double>(parameters, "voxel_grid_x", voxel_grid_x_);
   updateParam<double>(parameters, "voxel_grid_y", voxel_grid_y_);
   updateParam<double>(parameters, "voxel_grid_z", voxel_grid_z_);
+  updateParam<bool>(parameters, "use_corridor_grid", use_corridor_grid_);
+  updateParam<double>(parameters, "corridor_grid_resolution", corridor_grid_resolution_);
   updateParam<double>(parameters, "min_generated_path_length", min_generated_path_length_);
   updateParam<double>(parameters, "expand_width", expand_width_);
   updateParam<double>(parameters, "longitudinal_offset", longitudinal_offset_);
@@ -229,9 +180,7 @@ void AEB::onImu(const Imu::ConstSharedPtr input_msg)
 
 void AEB::onPointCloud(const PointCloud2::ConstSharedPtr input_msg)
 {
-  PointCloud::Ptr pointcloud_ptr(new PointCloud);
-  pcl::fromROSMsg(*input_msg, *pointcloud_ptr);
-
+  Eigen::Matrix4f affine_matrix = Eigen::Matrix4f::Identity();
   if (input_msg->header.frame_id != "base_link") {
     RCLCPP_ERROR_STREAM(
       get_logger(),
@@ -249,12 +198,27 @@ void AEB::onPointCloud(const PointCloud2::ConstSharedPtr input_msg)
       return;
     }
 
+    affine_matrix = tf2::transformToEigen(transform_stamped.transform).matrix().cast<float>();
+  }
+
+  // NOTE: The points are transformed and filtered while they are classified with the corridor of
+  //       each ego path in checkCollision.
+  if (use_corridor_grid_) {
+    input_pointcloud_ptr_ = input_msg;
+    input_pointcloud_transform_ = affine_matrix;
+    obstacle_ros_pointcloud_ptr_ = nullptr;
+    return;
+  }
+  input_pointcloud_ptr_ = nullptr;
+
+  PointCloud::Ptr pointcloud_ptr(new PointCloud);
+  if (input_msg->header.frame_id != "base_link") {
     // transform by using eigen matrix
     PointCloud2 transformed_points{};
-    const Eigen::Matrix4f affine_matrix =
-      tf2::transformToEigen(transform_stamped.transform).matrix().cast<float>();
     pcl_ros::transformPointCloud(affine_matrix, *input_msg, transformed_points);
     pcl::fromROSMsg(transformed_points, *pointcloud_ptr);
+  } else {
+    pcl::fromROSMsg(*input_msg, *pointcloud_ptr);
   }
 
   // apply z-axis filter for removing False Positive points
@@ -296,7 +260,7 @@ bool AEB::fetchLatestData()
     return missing("object pointcloud message");
   }
   onPointCloud(pointcloud_ptr);
-  if (!obstacle_ros_pointcloud_ptr_) {
+  if (use_corridor_grid_ ? !input_pointcloud_ptr_ : !obstacle_ros_pointcloud_ptr_) {
     return missing("object pointcloud");
   }
 
@@ -374,16 +338,26 @@ bool AEB::checkCollision(MarkerArray & debug_markers)
                            const std::string & debug_ns,
                            pcl::PointCloud<pcl::PointXYZ>::Ptr filtered_objects) {
     // Crop out Pointcloud using an extra wide ego path
-    const auto expanded_ego_polys =
+    const auto expanded_ego_footprint_sweep =
       generatePathFootprint(path, expand_width_ + path_footprint_extra_margin_);
-    cropPointCloudWithEgoFootprintPath(expanded_ego_polys, filtered_objects);
+    const auto & expanded_ego_polys = expanded_ego_footprint_sweep.stepPolygons();
+    if (use_corridor_grid_) {
+      const CorridorGrid corridor(expanded_ego_polys, corridor_grid_resolution_);
+      *filtered_objects = extractCorridorPoints(
+        *input_pointcloud_ptr_, input_pointcloud_transform_, corridor, detection_range_min_height_,
+        vehicle_info_.vehicle_height_m + detection_range_max_height_margin_,
+        Eigen::Vector3f(voxel_grid_x_, voxel_grid_y_, voxel_grid_z_));
+    } else {
+      cropPointCloudWithEgoFootprintPath(expanded_ego_polys, filtered_objects);
+    }
 
     // Check which points of the cropped point cloud are on the ego path, and get the closest one
     std::vector<ObjectData> objects_from_point_clusters;
-    const auto ego_polys = generatePathFootprint(path, expand_width_);
-    const auto current_time = obstacle_ros_pointcloud_ptr_->header.stamp;
+    const auto ego_footprint_sweep = generatePathFootprint(path, expand_width_);
+    const auto current_time = use_corridor_grid_ ? input_pointcloud_ptr_->header.stamp
+                                                 : obstacle_ros_pointcloud_ptr_->header.stamp;
     createObjectDataUsingPointCloudClusters(
-      path, ego_polys, current_time, objects_from_point_clusters, filtered_objects);
+      path, ego_footprint_sweep, current_time, objects_from_point_clusters, filtered_objects);
 
     // Get only the closest object and calculate its speed
     const auto closest_object_point = std::invoke([&]() -> std::optional<ObjectData> {
@@ -409,8 +383,9 @@ bool AEB::checkCollision(MarkerArray & debug_markers)
     {
       const auto [color_r, color_g, color_b, color_a] = debug_colors;
       addMarker(
-        this->get_clock()->now(), path, ego_polys, objects_from_point_clusters,
-        closest_object_point, color_r, color_g, color_b, color_a, debug_ns, debug_markers);
+        this->get_clock()->now(), path, ego_footprint_sweep.stepPolygons(),
+        objects_from_point_clusters, closest_object_point, color_r, color_g, color_b, color_a,
+        debug_ns, debug_markers);
     }
     // check collision using rss distance
     return (closest_object_point.has_value())
@@ -555,29 +530,29 @@ std::optional<Path> AEB::generateEgoPath(const Trajectory & predicted_traj)
   return path;
 }
 
-std::vector<Polygon2d> AEB::generatePathFootprint(
-  const Path & path, const double extra_width_margin)
+FootprintSweep AEB::generatePathFootprint(const Path & path, const double extra_width_margin)
 {
-  std::vector<Polygon2d> polygons;
-  for (size_t i = 0; i < path.size() - 1; ++i) {
-    polygons.push_back(
-      createPolygon(path.at(i), path.at(i + 1), vehicle_info_, extra_width_margin));
-  }
-  return polygons;
+  return FootprintSweep(vehicle_info_.createFootprint(extra_width_margin, 0.0), path);
 }
 
 void AEB::createObjectDataUsingPointCloudClusters(
-  const Path & ego_path, const std::vector<Polygon2d> & ego_polys, const rclcpp::Time & stamp,
+  const Path & ego_path, const FootprintSweep & ego_footprint_sweep, const rclcpp::Time & stamp,
   std::vector<ObjectData> & objects, const pcl::PointCloud<pcl::PointXYZ>::Ptr obstacle_points_ptr)
 {
   // check if the predicted path has valid number of points
-  if (ego_path.size() < 2 || ego_polys.empty() || obstacle_points_ptr->empty()) {
+  if (
+    ego_path.size() < 2 || ego_footprint_sweep.stepPolygons().empty() ||
+    obstacle_points_ptr->empty()) {
     return;
   }
 
   // eliminate noisy points by only considering points belonging to clusters of at least a certain
   // size
   const std::vector<pcl::PointIndices> cluster_indices = std::invoke([&]() {
+    if (use_corridor_grid_) {
+      return clusterPointsByGrid(
+        *obstacle_points_ptr, cluster_tolerance_, minimum_cluster_size_, maximum_cluster_size_);
+    }
     std::vector<pcl::PointIndices> cluster_idx;
     pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
     tree->setInputCloud(obstacle_points_ptr);
@@ -628,11 +603,8 @@ void AEB::createObjectDataUsingPointCloudClusters(
     obj.distance_to_object = dist_ego_to_object;
 
     const Point2d obj_point(p.x, p.y);
-    for (const auto & ego_poly : ego_polys) {
-      if (bg::within(obj_point, ego_poly)) {
-        objects.push_back(obj);
-        break;
-      }
+    if (!ego_footprint_sweep.findStepsContaining(obj_point).empty()) {
+      objects.push_back(obj);
     }
   }
 }
@@ -0,0 +1,131 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autonomous_emergency_braking/corridor_grid.hpp"
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using autoware::motion::control::autonomous_emergency_braking::clusterPointsByGrid;
+using autoware::motion::control::autonomous_emergency_braking::CorridorGrid;
+using autoware::motion::control::autonomous_emergency_braking::extractCorridorPoints;
+using tier4_autoware_utils::Point2d;
+using tier4_autoware_utils::Polygon2d;
+
+namespace
+{
+Polygon2d createBox(const double min_x, const double min_y, const double max_x, const double max_y)
+{
+  Polygon2d polygon;
+  polygon.outer() = {
+    Point2d(min_x, min_y), Point2d(min_x, max_y), Point2d(max_x, max_y), Point2d(max_x, min_y),
+    Point2d(min_x, min_y)};
+  boost::geometry::correct(polygon);
+  return polygon;
+}
+
+sensor_msgs::msg::PointCloud2 createPointCloud(const std::vector<Eigen::Vector3f> & points)
+{
+  sensor_msgs::msg::PointCloud2 cloud;
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(points.size());
+  sensor_msgs::PointCloud2Iterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(cloud, "z");
+  for (const auto & point : points) {
+    *iter_x = point.x();
+    *iter_y = point.y();
+    *iter_z = point.z();
+    ++iter_x, ++iter_y, ++iter_z;
+  }
+  return cloud;
+}
+}  // namespace
+
+TEST(CorridorGrid, isInside)
+{
+  // the polygons are not aligned with the grid, so the boundary cells are tested
+  const std::vector<Polygon2d> polygons{
+    createBox(0.05, -1.03, 2.07, 1.01), createBox(1.51, -0.47, 4.33, 2.29)};
+  const CorridorGrid corridor(polygons, 0.2);
+
+  for (double x = -1.0; x < 5.0; x += 0.013) {
+    for (double y = -2.0; y < 3.0; y += 0.017) {
+      const bool is_inside = boost::geometry::within(Point2d(x, y), polygons.at(0)) ||
+                             boost::geometry::within(Point2d(x, y), polygons.at(1));
+      EXPECT_EQ(corridor.isInside(x, y), is_inside) << "x: " << x << ", y: " << y;
+    }
+  }
+
+  const CorridorGrid empty_corridor({}, 0.2);
+  EXPECT_FALSE(empty_corridor.isInside(0.0, 0.0));
+}
+
+TEST(CorridorGrid, extractCorridorPoints)
+{
+  const CorridorGrid corridor({createBox(0.0, -1.0, 2.0, 1.0)}, 0.2);
+  const auto cloud = createPointCloud(
+    {{0.51f, 0.01f, 0.5f},
+     {0.53f, 0.03f, 0.7f},
+     {1.51f, 0.01f, 0.5f},
+     {3.0f, 0.0f, 0.5f},
+     {1.0f, 0.0f, 5.0f}});
+
+  // the points out of the corridor or the height are removed, and the first two are downsampled
+  const auto points = extractCorridorPoints(
+    cloud, Eigen::Matrix4f::Identity(), corridor, 0.0, 2.0, Eigen::Vector3f(0.1f, 0.1f, 100.0f));
+  ASSERT_EQ(points.size(), 2u);
+  EXPECT_FLOAT_EQ(points.at(0).x, 0.52f);
+  EXPECT_FLOAT_EQ(points.at(0).z, 0.6f);
+  EXPECT_FLOAT_EQ(points.at(1).x, 1.51f);
+
+  // the points are transformed before they are cropped
+  Eigen::Matrix4f transform = Eigen::Matrix4f::Identity();
+  transform(0, 3) = -2.0f;
+  const auto transformed_points =
+    extractCorridorPoints(cloud, transform, corridor, 0.0, 2.0, Eigen::Vector3f::Constant(0.01f));
+  ASSERT_EQ(transformed_points.size(), 1u);
+  EXPECT_FLOAT_EQ(transformed_points.at(0).x, 1.0f);
+}
+
+TEST(CorridorGrid, clusterPointsByGrid)
+{
+  pcl::PointCloud<pcl::PointXYZ> points;
+  // a chain of the points whose intervals are within the tolerance across the cells
+  for (int i = 0; i < 5; ++i) {
+    points.push_back(pcl::PointXYZ(0.08f * i, 0.0f, 0.0f));
+  }
+  // an isolated point and a pair of the points which are separated by the tolerance
+  points.push_back(pcl::PointXYZ(5.0f, 5.0f, 0.0f));
+  points.push_back(pcl::PointXYZ(10.0f, 0.0f, 0.0f));
+  points.push_back(pcl::PointXYZ(10.0f, 0.09f, 0.0f));
+
+  const auto clusters = clusterPointsByGrid(points, 0.1, 1, 100);
+  ASSERT_EQ(clusters.size(), 3u);
+  EXPECT_EQ(clusters.at(0).indices, (std::vector<int>{0, 1, 2, 3, 4}));
+  EXPECT_EQ(clusters.at(1).indices, (std::vector<int>{5}));
+  EXPECT_EQ(clusters.at(2).indices, (std::vector<int>{6, 7}));
+
+  // the clusters out of the size range are dropped
+  const auto sized_clusters = clusterPointsByGrid(points, 0.1, 2, 4);
+  ASSERT_EQ(sized_clusters.size(), 1u);
+  EXPECT_EQ(sized_clusters.at(0).indices, (std::vector<int>{6, 7}));
+}
@@ -41,6 +41,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -138,6 +139,26 @@ private:
   Param param_;
   std::shared_ptr<vehicle_info_util::VehicleInfo> vehicle_info_ptr_;
 
+  // NOTE: The uncrossable boundaries of the whole map are extracted once, and the segments around
+  //       ego are searched in the R-tree, until the map or the boundary types are changed.
+  struct UncrossableBoundariesCache
+  {
+    lanelet::LaneletMapPtr lanelet_map;
+    std::vector<std::string> boundary_types_to_detect;
+    SegmentRtree segments;
+  };
+  std::optional<UncrossableBoundariesCache> uncrossable_boundaries_cache_;
+
+  // NOTE: The fused polygon is shared by the checks of the same path lanelets, since the union of
+  //       the lanelet polygons is much more expensive than the checks themselves.
+  struct FusedLaneletPolygonCache
+  {
+    lanelet::LaneletMapPtr lanelet_map;
+    std::vector<lanelet::Id> lanelet_ids;
+    std::optional<tier4_autoware_utils::Polygon2d> polygon;
+  };
+  mutable std::optional<FusedLaneletPolygonCache> fused_lanelet_polygon_cache_;
+
   static PoseDeviation calcTrajectoryDeviation(
     const Trajectory & trajectory, const geometry_msgs::msg::Pose & pose,
     const double dist_threshold, const double yaw_threshold);
@@ -165,9 +186,17 @@ private:
     const lanelet::LaneletMap & lanelet_map, const geometry_msgs::msg::Point & ego_point,
     const double max_search_length, const std::vector<std::string> & boundary_types_to_detect);
 
+  const SegmentRtree & getUncrossableBoundaries(
+    const lanelet::LaneletMapPtr lanelet_map_ptr,
+    const std::vector<std::string> & boundary_types_to_detect);
+
   static bool willCrossBoundary(
     const std::vector<LinearRing2d> & vehicle_footprints,
     const SegmentRtree & uncrossable_segments);
+
+  static bool willCrossBoundary(
+    const std::vector<LinearRing2d> & vehicle_footprints, const SegmentRtree & uncrossable_segments,
+    const geometry_msgs::msg::Point & ego_point, const double max_search_length);
 };
 }  // namespace lane_departure_checker
 
@@ -16,6 +16,7 @@
 
 #include "lane_departure_checker/util/create_vehicle_footprint.hpp"
 
+#include <Eigen/Geometry>
 #include <motion_utils/trajectory/trajectory.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/math/normalization.hpp>
@@ -28,6 +29,8 @@
 #include <tf2/utils.h>
 
 #include <algorithm>
+#include <limits>
+#include <string>
 #include <vector>
 
 using motion_utils::calcArcLength;
@@ -43,6 +46,7 @@ using autoware_auto_planning_msgs::msg::Trajectory;
 using autoware_auto_planning_msgs::msg::TrajectoryPoint;
 using TrajectoryPoints = std::vector<TrajectoryPoint>;
 using geometry_msgs::msg::Point;
+using geometry_msgs::msg::Pose;
 
 double calcBrakingDistance(
   const double abs_velocity, const double max_deceleration, const double delay_time)
@@ -76,6 +80,22 @@ LinearRing2d createHullFromFootprints(const std::vector<LinearRing2d> & footprin
   return hull;
 }
 
+// NOTE: The rotation is calculated once for each pose instead of for each point of the footprint.
+LinearRing2d transformFootprint(const LinearRing2d & local_footprint, const Pose & pose)
+{
+  const auto & q = pose.orientation;
+  const Eigen::Matrix3d rotation = Eigen::Quaterniond(q.w, q.x, q.y, q.z).toRotationMatrix();
+
+  LinearRing2d footprint;
+  footprint.reserve(local_footprint.size());
+  for (const auto & p : local_footprint) {
+    footprint.emplace_back(
+      rotation(0, 0) * p.x() + rotation(0, 1) * p.y() + pose.position.x,
+      rotation(1, 0) * p.x() + rotation(1, 1) * p.y() + pose.position.y);
+  }
+  return footprint;
+}
+
 lanelet::ConstLanelets getCandidateLanelets(
   const lanelet::ConstLanelets & route_lanelets,
   const std::vector<LinearRing2d> & vehicle_footprints)
@@ -148,10 +168,11 @@ Output LaneDepartureChecker::update(const Input & input)
 
   const double max_search_length_for_boundaries =
     calcMaxSearchLengthForBoundaries(*input.predicted_trajectory);
-  const auto uncrossable_boundaries = extractUncrossableBoundaries(
-    *input.lanelet_map, input.predicted_trajectory->points.front().pose.position,
-    max_search_length_for_boundaries, input.boundary_types_to_detect);
-  output.will_cross_boundary = willCrossBoundary(output.vehicle_footprints, uncrossable_boundaries);
+  const auto & uncrossable_boundaries =
+    getUncrossableBoundaries(input.lanelet_map, input.boundary_types_to_detect);
+  output.will_cross_boundary = willCrossBoundary(
+    output.vehicle_footprints, uncrossable_boundaries,
+    input.predicted_trajectory->points.front().pose.position, max_search_length_for_boundaries);
   output.processing_time_map["willCrossBoundary"] = stop_watch.toc(true);
 
   return output;
@@ -249,9 +270,9 @@ std::vector<LinearRing2d> LaneDepartureChecker::createVehicleFootprints(
 
   // Create vehicle footprint on each TrajectoryPoint
   std::vector<LinearRing2d> vehicle_footprints;
+  vehicle_footprints.reserve(trajectory.size());
   for (const auto & p : trajectory) {
-    vehicle_footprints.push_back(
-      transformVector(local_vehicle_footprint, tier4_autoware_utils::pose2transform(p.pose)));
+    vehicle_footprints.push_back(transformFootprint(local_vehicle_footprint, p.pose));
   }
 
   return vehicle_footprints;
@@ -265,9 +286,9 @@ std::vector<LinearRing2d> LaneDepartureChecker::createVehicleFootprints(
 
   // Create vehicle footprint on each Path point
   std::vector<LinearRing2d> vehicle_footprints;
+  vehicle_footprints.reserve(path.points.size());
   for (const auto & p : path.points) {
-    vehicle_footprints.push_back(
-      transformVector(local_vehicle_footprint, tier4_autoware_utils::pose2transform(p.point.pose)));
+    vehicle_footprints.push_back(transformFootprint(local_vehicle_footprint, p.point.pose));
   }
 
   return vehicle_footprints;
@@ -325,6 +346,19 @@ std::optional<tier4_autoware_utils::Polygon2d> LaneDepartureChecker::getFusedLan
   const lanelet::LaneletMapPtr lanelet_map_ptr, const PathWithLaneId & path) const
 {
   const auto lanelets_distance_pair = getLaneletsFromPath(lanelet_map_ptr, path);
+
+  // NOTE: The union depends on the order of the lanelets, so the ids are compared in the order.
+  std::vector<lanelet::Id> lanelet_ids;
+  lanelet_ids.reserve(lanelets_distance_pair.size());
+  for (const auto & lanelet_distance_pair : lanelets_distance_pair) {
+    lanelet_ids.push_back(lanelet_distance_pair.second.id());
+  }
+  if (
+    fused_lanelet_polygon_cache_ && fused_lanelet_polygon_cache_->lanelet_map == lanelet_map_ptr &&
+    fused_lanelet_polygon_cache_->lanelet_ids == lanelet_ids) {
+    return fused_lanelet_polygon_cache_->polygon;
+  }
+
   auto to_polygon2d = [](const lanelet::BasicPolygon2d & poly) -> tier4_autoware_utils::Polygon2d {
     tier4_autoware_utils::Polygon2d p;
     auto & outer = p.outer();
@@ -356,6 +390,8 @@ std::optional<tier4_autoware_utils::Polygon2d> LaneDepartureChecker::getFusedLan
     return lanelet_unions.front();
   }();
 
+  fused_lanelet_polygon_cache_ =
+    FusedLaneletPolygonCache{lanelet_map_ptr, std::move(lanelet_ids), fused_lanelets};
   return fused_lanelets;
 }
 
@@ -445,6 +481,23 @@ SegmentRtree LaneDepartureChecker::extractUncrossableBoundaries(
   return uncrossable_segments_in_range;
 }
 
+const SegmentRtree & LaneDepartureChecker::getUncrossableBoundaries(
+  const lanelet::LaneletMapPtr lanelet_map_ptr,
+  const std::vector<std::string> & boundary_types_to_detect)
+{
+  if (
+    !uncrossable_boundaries_cache_ ||
+    uncrossable_boundaries_cache_->lanelet_map != lanelet_map_ptr ||
+    uncrossable_boundaries_cache_->boundary_types_to_detect != boundary_types_to_detect) {
+    uncrossable_boundaries_cache_ = UncrossableBoundariesCache{
+      lanelet_map_ptr, boundary_types_to_detect,
+      extractUncrossableBoundaries(
+        *lanelet_map_ptr, geometry_msgs::msg::Point{}, std::numeric_limits<double>::infinity(),
+        boundary_types_to_detect)};
+  }
+  return uncrossable_boundaries_cache_->segments;
+}
+
 bool LaneDepartureChecker::willCrossBoundary(
   const std::vector<LinearRing2d> & vehicle_footprints, const SegmentRtree & uncrossable_segments)
 {
@@ -459,4 +512,25 @@ bool LaneDepartureChecker::willCrossBoundary(
   return false;
 }
 
+bool LaneDepartureChecker::willCrossBoundary(
+  const std::vector<LinearRing2d> & vehicle_footprints, const SegmentRtree & uncrossable_segments,
+  const geometry_msgs::msg::Point & ego_point, const double max_search_length)
+{
+  // NOTE: Only the segments within the search length from ego are checked, as
+  //       extractUncrossableBoundaries does.
+  const auto ego_p = Point2d{ego_point.x, ego_point.y};
+  const auto is_in_range = [&](const Segment2d & segment) {
+    return boost::geometry::distance(segment, ego_p) < max_search_length;
+  };
+  for (const auto & footprint : vehicle_footprints) {
+    const auto itr = uncrossable_segments.qbegin(
+      boost::geometry::index::intersects(footprint) &&
+      boost::geometry::index::satisfies(is_in_range));
+    if (itr != uncrossable_segments.qend()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 }  // namespace lane_departure_checker
@@ -0,0 +1,115 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// compares the dense products with calcCondensedCost on the condensing of the QP, which MPC does
+// every control cycle, with the dimensions of the kinematics model
+
+#include "mpc_lateral_controller/mpc.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using autoware::motion::control::mpc_lateral_controller::calcCondensedCost;
+using autoware::motion::control::mpc_lateral_controller::MPCMatrix;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+namespace
+{
+constexpr int DIM_X = 3;
+constexpr int DIM_U = 1;
+constexpr int DIM_Y = 2;
+
+// builds the matrices in the same structure as MPC::generateMPCMatrix
+MPCMatrix createMPCMatrix(const int N)
+{
+  MPCMatrix m;
+  m.Aex = MatrixXd::Zero(DIM_X * N, DIM_X);
+  m.Bex = MatrixXd::Zero(DIM_X * N, DIM_U * N);
+  m.Wex = MatrixXd::Zero(DIM_X * N, 1);
+  m.Cex = MatrixXd::Zero(DIM_Y * N, DIM_X * N);
+  m.Qex = MatrixXd::Zero(DIM_Y * N, DIM_Y * N);
+  m.R1ex = MatrixXd::Identity(DIM_U * N, DIM_U * N);
+  m.R2ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
+  m.Uref_ex = MatrixXd::Constant(DIM_U * N, 1, 0.01);
+
+  const MatrixXd Ad = MatrixXd::Identity(DIM_X, DIM_X) + 0.1 * MatrixXd::Random(DIM_X, DIM_X);
+  const MatrixXd Bd = MatrixXd::Random(DIM_X, DIM_U);
+  const MatrixXd Wd = MatrixXd::Random(DIM_X, 1);
+  const MatrixXd Cd = MatrixXd::Identity(DIM_Y, DIM_X);
+  for (int i = 0; i < N; ++i) {
+    if (i == 0) {
+      m.Aex.block(0, 0, DIM_X, DIM_X) = Ad;
+      m.Wex.block(0, 0, DIM_X, 1) = Wd;
+    } else {
+      m.Aex.block(i * DIM_X, 0, DIM_X, DIM_X) = Ad * m.Aex.block((i - 1) * DIM_X, 0, DIM_X, DIM_X);
+      for (int j = 0; j < i; ++j) {
+        m.Bex.block(i * DIM_X, j * DIM_U, DIM_X, DIM_U) =
+          Ad * m.Bex.block((i - 1) * DIM_X, j * DIM_U, DIM_X, DIM_U);
+      }
+      m.Wex.block(i * DIM_X, 0, DIM_X, 1) = Ad * m.Wex.block((i - 1) * DIM_X, 0, DIM_X, 1) + Wd;
+    }
+    m.Bex.block(i * DIM_X, i * DIM_U, DIM_X, DIM_U) = Bd;
+    m.Cex.block(i * DIM_Y, i * DIM_X, DIM_Y, DIM_X) = Cd;
+    m.Qex.block(i * DIM_Y, i * DIM_Y, DIM_Y, DIM_Y) = MatrixXd::Identity(DIM_Y, DIM_Y);
+  }
+  return m;
+}
+
+// the condensing of MPC::executeOptimization before calcCondensedCost
+void calcDenseCondensedCost(const MPCMatrix & m, const VectorXd & x0, MatrixXd & H, MatrixXd & f)
+{
+  const MatrixXd CB = m.Cex * m.Bex;
+  const MatrixXd QCB = m.Qex * CB;
+  H = MatrixXd::Zero(m.Bex.cols(), m.Bex.cols());
+  H.triangularView<Eigen::Upper>() = CB.transpose() * QCB;
+  H.triangularView<Eigen::Upper>() += m.R1ex + m.R2ex;
+  H.triangularView<Eigen::Lower>() = H.transpose();
+  f = (m.Cex * (m.Aex * x0 + m.Wex)).transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
+}
+}  // namespace
+
+int main(int argc, char * argv[])
+{
+  const int N = argc > 1 ? std::atoi(argv[1]) : 50;
+  const int cycles_num = argc > 2 ? std::atoi(argv[2]) : 1000;
+
+  const auto m = createMPCMatrix(N);
+  const VectorXd x0 = VectorXd::Constant(DIM_X, 0.1);
+  MatrixXd dense_H;
+  MatrixXd dense_f;
+  MatrixXd H;
+  MatrixXd f;
+
+  const auto dense_start = std::chrono::steady_clock::now();
+  for (int i = 0; i < cycles_num; ++i) {
+    calcDenseCondensedCost(m, x0, dense_H, dense_f);
+  }
+  const auto dense_end = std::chrono::steady_clock::now();
+  for (int i = 0; i < cycles_num; ++i) {
+    calcCondensedCost(m, x0, DIM_X, DIM_U, DIM_Y, H, f);
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  const double dense_ms =
+    std::chrono::duration<double, std::milli>(dense_end - dense_start).count();
+  const double ms = std::chrono::duration<double, std::milli>(end - dense_end).count();
+  std::cout << "N = " << N << ", " << cycles_num << " cycles" << std::endl;
+  std::cout << "dense products:    " << dense_ms / cycles_num << " [ms/cycle]" << std::endl;
+  std::cout << "calcCondensedCost: " << ms / cycles_num << " [ms/cycle]" << std::endl;
+  std::cout << "max difference of H: " << (dense_H - H).cwiseAbs().maxCoeff()
+            << ", f: " << (dense_f - f).cwiseAbs().maxCoeff() << std::endl;
+  return 0;
+}
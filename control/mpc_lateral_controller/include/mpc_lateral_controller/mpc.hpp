@@ -31,6 +31,7 @@
 
 #include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -40,6 +41,7 @@ namespace autoware::motion::control::mpc_lateral_controller
 
 using autoware_auto_control_msgs::msg::AckermannLateralCommand;
 using autoware_auto_planning_msgs::msg::Trajectory;
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
 using autoware_auto_vehicle_msgs::msg::SteeringReport;
 using geometry_msgs::msg::Pose;
 using nav_msgs::msg::Odometry;
@@ -186,9 +188,31 @@ struct MPCMatrix
   MatrixXd R2ex;
   MatrixXd Uref_ex;
 
+  // discrete matrices of each step, which are stacked into Aex, Bex and Wex
+  std::vector<MatrixXd> Ad;
+  std::vector<MatrixXd> Bd;
+  std::vector<MatrixXd> Wd;
+
   MPCMatrix() = default;
 };
 
+/**
+ * @brief Calculate the Hessian and the gradient of the condensed cost 1/2 * Uex' * H * Uex + f' *
+ * Uex, where H = Bex' * Cex' * Qex * Cex * Bex + R1ex + R2ex.
+ * @details Cex and Qex are block diagonal and Bex is block lower triangular, so only their
+ * non-zero blocks are multiplied.
+ * @param m The MPC matrix.
+ * @param x0 The initial state vector.
+ * @param dim_x The dimension of the state.
+ * @param dim_u The dimension of the input.
+ * @param dim_y The dimension of the output.
+ * @param [out] H The Hessian matrix.
+ * @param [out] f The gradient as a row vector.
+ */
+void calcCondensedCost(
+  const MPCMatrix & m, const VectorXd & x0, const int dim_x, const int dim_u, const int dim_y,
+  MatrixXd & H, MatrixXd & f);
+
 /**
  * MPC-based waypoints follower class
  * @brief calculate control command to follow reference waypoints
@@ -205,6 +229,9 @@ private:
   // QP solver used for MPC.
   std::shared_ptr<QPSolverInterface> m_qpsolver_ptr;
 
+  // Constraint matrix of the steering rate, which depends only on the horizon.
+  MatrixXd m_steer_rate_constraint_matrix;
+
   // Calculate predicted steering angle based on the steering dynamics. The predicted value should
   // fit to the actual steering angle if the vehicle model is accurate enough.
   std::shared_ptr<SteeringPredictor> m_steering_predictor;
@@ -219,6 +246,16 @@ private:
 
   bool m_is_forward_shift = true;  // Flag indicating if the shift is in the forward direction.
 
+  // Inputs of the latest successful setReferenceTrajectory, to skip the same preprocessing.
+  struct ReferenceTrajectoryCache
+  {
+    std::vector<TrajectoryPoint> points;
+    size_t nearest_seg_idx;
+    double ego_offset_to_segment;
+    TrajectoryFilteringParam param;
+  };
+  std::optional<ReferenceTrajectoryCache> m_reference_trajectory_cache;
+
   double m_min_prediction_length = 5.0;  // Minimum prediction distance.
 
   rclcpp::Publisher<Trajectory>::SharedPtr m_debug_frenet_predicted_trajectory_pub;
@@ -273,6 +310,24 @@ private:
     const MPCMatrix & mpc_matrix, const VectorXd & x0, const double prediction_dt,
     const MPCTrajectory & trajectory, const double current_velocity);
 
+  /**
+   * @brief Create the QP problem keeping the states as the decision variables from the MPC
+   * matrix, which is solved instead of the condensed one if the QP solver supports it.
+   * @param mpc_matrix The parameters matrix used for optimization.
+   * @param x0 The initial state vector.
+   * @param prediction_dt The prediction time step.
+   * @param A The constraint matrix of the steering rate.
+   * @param lb The lower bound of the steering angle.
+   * @param ub The upper bound of the steering angle.
+   * @param lbA The lower bound of the steering rate constraint.
+   * @param ubA The upper bound of the steering rate constraint.
+   * @return The QP problem before condensing.
+   */
+  SparseMPCProblem createSparseMPCProblem(
+    const MPCMatrix & mpc_matrix, const VectorXd & x0, const double prediction_dt,
+    const MatrixXd & A, const VectorXd & lb, const VectorXd & ub, const VectorXd & lbA,
+    const VectorXd & ubA) const;
+
   /**
    * @brief Resample the trajectory with the MPC resampling time.
    * @param start_time The start time for resampling.
@@ -17,9 +17,34 @@
 
 #include <Eigen/Core>
 
+#include <vector>
+
 namespace autoware::motion::control::mpc_lateral_controller
 {
 
+/**
+ * QP problem of MPC whose decision variables are the states X = [x_1, ..., x_N] and the inputs
+ * U = [u_0, ..., u_N-1], i.e. the problem before condensing:
+ * minimize 1/2 * X' * Qx * X + 1/2 * U' * h_u * U + f_u * U
+ * subject to x_i+1 = Ad_i * x_i + Bd_i * u_i + Wd_i, lb < U < ub, lb_a < a * U < ub_a
+ */
+struct SparseMPCProblem
+{
+  std::vector<Eigen::MatrixXd> Ad;  // discrete state matrix of each step
+  std::vector<Eigen::MatrixXd> Bd;  // discrete input matrix of each step
+  std::vector<Eigen::MatrixXd> Wd;  // discrete disturbance of each step
+  std::vector<Eigen::MatrixXd> Qx;  // weight of each state x_i+1, i.e. Cd_i' * Q_i * Cd_i
+  Eigen::VectorXd x0;               // initial state
+  Eigen::MatrixXd h_u;              // weight of the inputs
+  Eigen::MatrixXd f_u;              // linear cost of the inputs as a row vector
+  Eigen::MatrixXd a;
+  Eigen::VectorXd lb;
+  Eigen::VectorXd ub;
+  Eigen::VectorXd lb_a;
+  Eigen::VectorXd ub_a;
+  int shift_steps{0};  // steps to shift the previous solution by for the warm start
+};
+
 /// Interface for solvers of Quadratic Programming (QP) problems
 class QPSolverInterface
 {
@@ -46,6 +71,23 @@ public:
     const Eigen::VectorXd & lb, const Eigen::VectorXd & ub, const Eigen::VectorXd & lb_a,
     const Eigen::VectorXd & ub_a, Eigen::VectorXd & u) = 0;
 
+  /**
+   * @brief whether the solver solves the problem without condensing with solveSparse()
+   */
+  virtual bool isSparseProblemSupported() const { return false; }
+
+  /**
+   * @brief solve QP problem keeping the states as the decision variables
+   * @param [in] problem QP problem before condensing
+   * @param [out] u optimal input vector
+   * @return true if the problem was solved
+   */
+  virtual bool solveSparse(
+    [[maybe_unused]] const SparseMPCProblem & problem, [[maybe_unused]] Eigen::VectorXd & u)
+  {
+    return false;
+  }
+
   virtual int64_t getTakenIter() const { return 0; }
   virtual double getRunTime() const { return 0.0; }
   virtual double getObjVal() const { return 0.0; }
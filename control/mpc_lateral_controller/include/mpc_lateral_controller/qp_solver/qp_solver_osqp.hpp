@@ -19,6 +19,8 @@
 #include "osqp_interface/osqp_interface.hpp"
 #include "rclcpp/rclcpp.hpp"
 
+#include <vector>
+
 namespace autoware::motion::control::mpc_lateral_controller
 {
 
@@ -28,8 +30,10 @@ class QPSolverOSQP : public QPSolverInterface
 public:
   /**
    * @brief constructor
+   * @param [in] logger logger
+   * @param [in] use_sparse_problem whether the problem is solved without condensing
    */
-  explicit QPSolverOSQP(const rclcpp::Logger & logger);
+  explicit QPSolverOSQP(const rclcpp::Logger & logger, const bool use_sparse_problem = false);
 
   /**
    * @brief destructor
@@ -53,6 +57,19 @@ public:
     const Eigen::VectorXd & lb, const Eigen::VectorXd & ub, const Eigen::VectorXd & lb_a,
     const Eigen::VectorXd & ub_a, Eigen::VectorXd & u) override;
 
+  bool isSparseProblemSupported() const override { return use_sparse_problem_; }
+
+  /**
+   * @brief solve QP problem keeping the states as the decision variables
+   * @details The sparsity pattern of P and A depends only on the horizon and the dimensions, so
+   * the values are updated in place in the solver, which starts from the previous solution
+   * shifted by problem.shift_steps.
+   * @param [in] problem QP problem before condensing
+   * @param [out] u optimal input vector
+   * @return true if the problem was solved
+   */
+  bool solveSparse(const SparseMPCProblem & problem, Eigen::VectorXd & u) override;
+
   int64_t getTakenIter() const override { return osqpsolver_.getTakenIter(); }
   double getRunTime() const override { return osqpsolver_.getRunTime(); }
   double getObjVal() const override { return osqpsolver_.getObjVal(); }
@@ -60,6 +77,15 @@ public:
 private:
   autoware::common::osqp::OSQPInterface osqpsolver_;
   rclcpp::Logger logger_;
+  bool use_sparse_problem_;
+  int h_u_bandwidth_{0};
+  std::vector<double> prev_sparse_solution_;
+
+  /**
+   * @brief check the status of the solver and the solution
+   */
+  bool checkResult(
+    const std::vector<double> & solution, const int status_val, const int status_polish) const;
 };
 }  // namespace autoware::motion::control::mpc_lateral_controller
 #endif  // MPC_LATERAL_CONTROLLER__QP_SOLVER__QP_SOLVER_OSQP_HPP_
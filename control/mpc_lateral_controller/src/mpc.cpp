@@ -29,6 +29,19 @@ using tier4_autoware_utils::calcDistance2d;
 using tier4_autoware_utils::normalizeRadian;
 using tier4_autoware_utils::rad2deg;
 
+namespace
+{
+bool isSameFilteringParam(const TrajectoryFilteringParam & a, const TrajectoryFilteringParam & b)
+{
+  return a.traj_resample_dist == b.traj_resample_dist &&
+         a.extend_trajectory_for_end_yaw_control == b.extend_trajectory_for_end_yaw_control &&
+         a.enable_path_smoothing == b.enable_path_smoothing &&
+         a.path_filter_moving_ave_num == b.path_filter_moving_ave_num &&
+         a.curvature_smoothing_num_traj == b.curvature_smoothing_num_traj &&
+         a.curvature_smoothing_num_ref_steer == b.curvature_smoothing_num_ref_steer;
+}
+}  // namespace
+
 MPC::MPC(rclcpp::Node & node)
 {
   m_debug_frenet_predicted_trajectory_pub = node.create_publisher<Trajectory>(
@@ -173,6 +186,18 @@ void MPC::setReferenceTrajectory(
   const double ego_offset_to_segment = motion_utils::calcLongitudinalOffsetToSegment(
     trajectory_msg.points, nearest_seg_idx, current_kinematics.pose.pose.position);
 
+  // NOTE: The reference trajectory is resampled from the ego position and the splines and the
+  //       filters are global, so the result is reused only when all the inputs are the same, e.g.
+  //       while the vehicle is stopped and the same trajectory is received.
+  const auto & cache = m_reference_trajectory_cache;
+  if (
+    cache && cache->nearest_seg_idx == nearest_seg_idx &&
+    cache->ego_offset_to_segment == ego_offset_to_segment &&
+    isSameFilteringParam(cache->param, param) && cache->points == trajectory_msg.points) {
+    return;
+  }
+  m_reference_trajectory_cache.reset();
+
   const auto mpc_traj_raw = MPCUtils::convertToMPCTrajectory(trajectory_msg);
 
   // resampling
@@ -240,6 +265,8 @@ void MPC::setReferenceTrajectory(
   }
 
   m_reference_trajectory = mpc_traj_smoothed;
+  m_reference_trajectory_cache =
+    ReferenceTrajectoryCache{trajectory_msg.points, nearest_seg_idx, ego_offset_to_segment, param};
 }
 
 void MPC::resetPrevResult(const SteeringReport & current_steer)
@@ -429,6 +456,9 @@ MPCMatrix MPC::generateMPCMatrix(
   m.R1ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
   m.R2ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
   m.Uref_ex = MatrixXd::Zero(DIM_U * N, 1);
+  m.Ad.reserve(N);
+  m.Bd.reserve(N);
+  m.Wd.reserve(N);
 
   // weight matrix depends on the vehicle model
   MatrixXd Q = MatrixXd::Zero(DIM_Y, DIM_Y);
@@ -457,6 +487,9 @@ MPCMatrix MPC::generateMPCMatrix(
     m_vehicle_model_ptr->setVelocity(ref_vx);
     m_vehicle_model_ptr->setCurvature(ref_k);
     m_vehicle_model_ptr->calculateDiscreteMatrix(Ad, Bd, Cd, Wd, DT);
+    m.Ad.push_back(Ad);
+    m.Bd.push_back(Bd);
+    m.Wd.push_back(Wd);
 
     Q = MatrixXd::Zero(DIM_Y, DIM_Y);
     R = MatrixXd::Zero(DIM_U, DIM_U);
@@ -520,6 +553,45 @@ MPCMatrix MPC::generateMPCMatrix(
   return m;
 }
 
+void calcCondensedCost(
+  const MPCMatrix & m, const VectorXd & x0, const int dim_x, const int dim_u, const int dim_y,
+  MatrixXd & H, MatrixXd & f)
+{
+  const int N = static_cast<int>(m.Aex.rows()) / dim_x;
+  const int DIM_U_N = dim_u * N;
+
+  // CB = Cex * Bex and QCB = Qex * CB, whose block rows i are zero after the block column i,
+  // and Y0 = Cex * (Aex * x0 + Wex), which is the output without the input
+  MatrixXd CB = MatrixXd::Zero(dim_y * N, DIM_U_N);
+  MatrixXd QCB = MatrixXd::Zero(dim_y * N, DIM_U_N);
+  VectorXd Y0(dim_y * N);
+  for (int i = 0; i < N; ++i) {
+    const auto Cd = m.Cex.block(i * dim_y, i * dim_x, dim_y, dim_x);
+    const auto Qd = m.Qex.block(i * dim_y, i * dim_y, dim_y, dim_y);
+    const int cols = (i + 1) * dim_u;
+    CB.block(i * dim_y, 0, dim_y, cols).noalias() = Cd * m.Bex.block(i * dim_x, 0, dim_x, cols);
+    QCB.block(i * dim_y, 0, dim_y, cols).noalias() = Qd * CB.block(i * dim_y, 0, dim_y, cols);
+    Y0.segment(i * dim_y, dim_y).noalias() =
+      Cd * (m.Aex.block(i * dim_x, 0, dim_x, dim_x) * x0 + m.Wex.block(i * dim_x, 0, dim_x, 1));
+  }
+
+  // the block (j, k) of CB' * QCB for k >= j, where the block rows of CB and QCB before k are
+  // zero in the block column k of QCB
+  H = MatrixXd::Zero(DIM_U_N, DIM_U_N);
+  for (int j = 0; j < N; ++j) {
+    for (int k = j; k < N; ++k) {
+      const int rows = (N - k) * dim_y;
+      H.block(j * dim_u, k * dim_u, dim_u, dim_u).noalias() =
+        CB.block(k * dim_y, j * dim_u, rows, dim_u).transpose() *
+        QCB.block(k * dim_y, k * dim_u, rows, dim_u);
+    }
+  }
+  H.triangularView<Eigen::Upper>() += m.R1ex + m.R2ex;
+  H.triangularView<Eigen::Lower>() = H.transpose();
+
+  f = Y0.transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
+}
+
 /*
  * solve quadratic optimization.
  * cost function: J = Xex' * Qex * Xex + (Uex - Uref)' * R1ex * (Uex - Uref_ex) + Uex' * R2ex * Uex
@@ -555,22 +627,13 @@ std::pair<bool, VectorXd> MPC::executeOptimization(
 
   const int DIM_U_N = m_param.prediction_horizon * m_vehicle_model_ptr->getDimU();
 
-  // cost function: 1/2 * Uex' * H * Uex + f' * Uex,  H = B' * C' * Q * C * B + R
-  const MatrixXd CB = m.Cex * m.Bex;
-  const MatrixXd QCB = m.Qex * CB;
-  // MatrixXd H = CB.transpose() * QCB + m.R1ex + m.R2ex; // This calculation is heavy. looking for
-  // a good way.  //NOLINT
-  MatrixXd H = MatrixXd::Zero(DIM_U_N, DIM_U_N);
-  H.triangularView<Eigen::Upper>() = CB.transpose() * QCB;
-  H.triangularView<Eigen::Upper>() += m.R1ex + m.R2ex;
-  H.triangularView<Eigen::Lower>() = H.transpose();
-  MatrixXd f = (m.Cex * (m.Aex * x0 + m.Wex)).transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
-  addSteerWeightF(prediction_dt, f);
-
-  MatrixXd A = MatrixXd::Identity(DIM_U_N, DIM_U_N);
-  for (int i = 1; i < DIM_U_N; i++) {
-    A(i, i - 1) = -1.0;
+  if (m_steer_rate_constraint_matrix.rows() != DIM_U_N) {
+    m_steer_rate_constraint_matrix = MatrixXd::Identity(DIM_U_N, DIM_U_N);
+    for (int i = 1; i < DIM_U_N; i++) {
+      m_steer_rate_constraint_matrix(i, i - 1) = -1.0;
+    }
   }
+  const MatrixXd & A = m_steer_rate_constraint_matrix;
 
   // steering angle limit
   VectorXd lb = VectorXd::Constant(DIM_U_N, -m_steer_lim);  // min steering angle
@@ -584,7 +647,20 @@ std::pair<bool, VectorXd> MPC::executeOptimization(
   lbA(0) = m_raw_steer_cmd_prev - steer_rate_limits(0) * m_ctrl_period;
 
   auto t_start = std::chrono::system_clock::now();
-  bool solve_result = m_qpsolver_ptr->solve(H, f.transpose(), A, lb, ub, lbA, ubA, Uex);
+  bool solve_result = false;
+  if (m_qpsolver_ptr->isSparseProblemSupported()) {
+    solve_result = m_qpsolver_ptr->solveSparse(
+      createSparseMPCProblem(m, x0, prediction_dt, A, lb, ub, lbA, ubA), Uex);
+  } else {
+    // cost function: 1/2 * Uex' * H * Uex + f' * Uex,  H = B' * C' * Q * C * B + R
+    MatrixXd H;
+    MatrixXd f;
+    calcCondensedCost(
+      m, x0, m_vehicle_model_ptr->getDimX(), m_vehicle_model_ptr->getDimU(),
+      m_vehicle_model_ptr->getDimY(), H, f);
+    addSteerWeightF(prediction_dt, f);
+    solve_result = m_qpsolver_ptr->solve(H, f.transpose(), A, lb, ub, lbA, ubA, Uex);
+  }
   auto t_end = std::chrono::system_clock::now();
   if (!solve_result) {
     warn_throttle("qp solver error");
@@ -603,6 +679,38 @@ std::pair<bool, VectorXd> MPC::executeOptimization(
   return {true, Uex};
 }
 
+SparseMPCProblem MPC::createSparseMPCProblem(
+  const MPCMatrix & m, const VectorXd & x0, const double prediction_dt, const MatrixXd & A,
+  const VectorXd & lb, const VectorXd & ub, const VectorXd & lbA, const VectorXd & ubA) const
+{
+  const int N = m_param.prediction_horizon;
+  const int DIM_X = m_vehicle_model_ptr->getDimX();
+  const int DIM_Y = m_vehicle_model_ptr->getDimY();
+
+  SparseMPCProblem problem;
+  problem.Ad = m.Ad;
+  problem.Bd = m.Bd;
+  problem.Wd = m.Wd;
+  problem.Qx.reserve(N);
+  for (int i = 0; i < N; ++i) {
+    const MatrixXd Cd = m.Cex.block(i * DIM_Y, i * DIM_X, DIM_Y, DIM_X);
+    problem.Qx.push_back(Cd.transpose() * m.Qex.block(i * DIM_Y, i * DIM_Y, DIM_Y, DIM_Y) * Cd);
+  }
+  problem.x0 = x0;
+  problem.h_u = m.R1ex + m.R2ex;
+  problem.f_u = -m.Uref_ex.transpose() * m.R1ex;
+  addSteerWeightF(prediction_dt, problem.f_u);
+  problem.a = A;
+  problem.lb = lb;
+  problem.ub = ub;
+  problem.lb_a = lbA;
+  problem.ub_a = ubA;
+  // NOTE: the reference trajectory starts from the current time, so the previous solution is
+  //       shifted by the steps of the control period
+  problem.shift_steps = static_cast<int>(std::round(m_ctrl_period / prediction_dt));
+  return problem;
+}
+
 void MPC::addSteerWeightR(const double prediction_dt, MatrixXd & R) const
 {
   const int N = m_param.prediction_horizon;
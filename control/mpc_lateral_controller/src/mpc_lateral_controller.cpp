@@ -210,6 +210,11 @@ std::shared_ptr<QPSolverInterface> MpcLateralController::createQPSolverInterface
     return qpsolver_ptr;
   }
 
+  if (qp_solver_type == "osqp_sparse") {
+    qpsolver_ptr = std::make_shared<QPSolverOSQP>(logger_, true);
+    return qpsolver_ptr;
+  }
+
   RCLCPP_ERROR(logger_, "qp_solver_type is undefined");
   return qpsolver_ptr;
 }
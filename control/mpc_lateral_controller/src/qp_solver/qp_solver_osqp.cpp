@@ -14,12 +14,17 @@
 
 #include "mpc_lateral_controller/qp_solver/qp_solver_osqp.hpp"
 
+#include <Eigen/SparseCore>
+
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 
 namespace autoware::motion::control::mpc_lateral_controller
 {
-QPSolverOSQP::QPSolverOSQP(const rclcpp::Logger & logger) : logger_{logger}
+QPSolverOSQP::QPSolverOSQP(const rclcpp::Logger & logger, const bool use_sparse_problem)
+: logger_{logger}, use_sparse_problem_{use_sparse_problem}
 {
 }
 bool QPSolverOSQP::solve(
@@ -58,20 +63,148 @@ bool QPSolverOSQP::solve(
   u = Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 1>>(
     &U_osqp[0], static_cast<Eigen::Index>(U_osqp.size()), 1);
 
-  const int status_val = std::get<3>(result);
+  return checkResult(U_osqp, std::get<3>(result), std::get<2>(result));
+}
+
+/*
+ * The decision variables are z = [x_1, ..., x_N, u_0, ..., u_N-1], and the constraints are
+ * (1) x_i+1 - Ad_i * x_i - Bd_i * u_i = Wd_i, where Ad_0 * x_0 is moved to the right side for i = 0
+ * (2) lb < u_i < ub
+ * (3) lb_a < a * U < ub_a
+ */
+bool QPSolverOSQP::solveSparse(const SparseMPCProblem & p, Eigen::VectorXd & u)
+{
+  const int N = static_cast<int>(p.Ad.size());
+  if (N == 0) {
+    RCLCPP_WARN(logger_, "optimization failed: the horizon is empty");
+    return false;
+  }
+  const int dim_x = static_cast<int>(p.x0.size());
+  const int dim_u = static_cast<int>(p.Bd.front().cols());
+  const int dim_x_n = dim_x * N;
+  const int dim_u_n = dim_u * N;
+  const int dim_a = static_cast<int>(p.a.rows());
+  const int num_variables = dim_x_n + dim_u_n;
+  const int num_constraints = dim_x_n + dim_u_n + dim_a;
+
+  // NOTE: All the entries of the blocks are stored even if they are zero, so that the sparsity
+  //       pattern depends only on the horizon and the dimensions, and the solver is updated in
+  //       place.
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  for (int i = 0; i < N; ++i) {
+    for (int c = 0; c < dim_x; ++c) {
+      for (int r = 0; r <= c; ++r) {
+        P_triplets.emplace_back(i * dim_x + r, i * dim_x + c, p.Qx.at(i)(r, c));
+      }
+    }
+  }
+  // the inputs are coupled only with the neighbors by the weights of the steering rate, the
+  // steering acceleration and the lateral jerk, so h_u is stored as a band matrix
+  for (int c = 0; c < dim_u_n; ++c) {
+    for (int r = 0; r < c; ++r) {
+      if (p.h_u(r, c) != 0.0) {
+        h_u_bandwidth_ = std::max(h_u_bandwidth_, c - r);
+      }
+    }
+  }
+  for (int c = 0; c < dim_u_n; ++c) {
+    for (int r = std::max(0, c - h_u_bandwidth_); r <= c; ++r) {
+      P_triplets.emplace_back(dim_x_n + r, dim_x_n + c, p.h_u(r, c));
+    }
+  }
+  Eigen::SparseMatrix<double> P(num_variables, num_variables);
+  P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  std::vector<double> q(num_variables, 0.0);
+  std::vector<double> lower_bound(num_constraints);
+  std::vector<double> upper_bound(num_constraints);
+  for (int i = 0; i < N; ++i) {
+    const int row = i * dim_x;
+    for (int r = 0; r < dim_x; ++r) {
+      A_triplets.emplace_back(row + r, row + r, 1.0);
+      for (int c = 0; c < dim_u; ++c) {
+        A_triplets.emplace_back(row + r, dim_x_n + i * dim_u + c, -p.Bd.at(i)(r, c));
+      }
+      if (i > 0) {
+        for (int c = 0; c < dim_x; ++c) {
+          A_triplets.emplace_back(row + r, row - dim_x + c, -p.Ad.at(i)(r, c));
+        }
+      }
+    }
+    const Eigen::VectorXd b = i == 0 ? Eigen::VectorXd(p.Ad.front() * p.x0 + p.Wd.front())
+                                     : Eigen::VectorXd(p.Wd.at(i));
+    for (int r = 0; r < dim_x; ++r) {
+      lower_bound.at(row + r) = b(r);
+      upper_bound.at(row + r) = b(r);
+    }
+  }
+  for (int j = 0; j < dim_u_n; ++j) {
+    A_triplets.emplace_back(dim_x_n + j, dim_x_n + j, 1.0);
+    lower_bound.at(dim_x_n + j) = p.lb(j);
+    upper_bound.at(dim_x_n + j) = p.ub(j);
+    q.at(dim_x_n + j) = p.f_u(0, j);
+  }
+  // NOTE: a is the constant difference matrix of the steering angle, so the pattern is fixed
+  for (int r = 0; r < dim_a; ++r) {
+    for (int c = 0; c < dim_u_n; ++c) {
+      if (p.a(r, c) != 0.0) {
+        A_triplets.emplace_back(dim_x_n + dim_u_n + r, dim_x_n + c, p.a(r, c));
+      }
+    }
+    lower_bound.at(dim_x_n + dim_u_n + r) = p.lb_a(r);
+    upper_bound.at(dim_x_n + dim_u_n + r) = p.ub_a(r);
+  }
+  Eigen::SparseMatrix<double> A(num_constraints, num_variables);
+  A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+
+  const auto P_csc = autoware::common::osqp::calCSCMatrixTrapezoidal(P);
+  const auto A_csc = autoware::common::osqp::calCSCMatrix(A);
+  const bool is_updated_in_place = osqpsolver_.isSameSparsityPattern(P_csc, A_csc);
+  osqpsolver_.updateCscProblem(P_csc, A_csc, q, lower_bound, upper_bound);
+
+  // NOTE: The solver keeps the previous solution when it is updated in place. It is shifted by the
+  //       steps elapsed since the previous cycle, repeating the last step.
+  if (
+    is_updated_in_place && 0 < p.shift_steps &&
+    static_cast<int>(prev_sparse_solution_.size()) == num_variables) {
+    std::vector<double> primal_solution(num_variables);
+    for (int i = 0; i < N; ++i) {
+      const int prev_i = std::min(i + p.shift_steps, N - 1);
+      std::copy_n(
+        prev_sparse_solution_.begin() + prev_i * dim_x, dim_x,
+        primal_solution.begin() + i * dim_x);
+      std::copy_n(
+        prev_sparse_solution_.begin() + dim_x_n + prev_i * dim_u, dim_u,
+        primal_solution.begin() + dim_x_n + i * dim_u);
+    }
+    osqpsolver_.setPrimalVariables(primal_solution);
+  }
+
+  /* execute optimization */
+  const auto result = osqpsolver_.optimize();
+
+  prev_sparse_solution_ = std::get<0>(result);
+  u = Eigen::Map<const Eigen::VectorXd>(prev_sparse_solution_.data() + dim_x_n, dim_u_n);
+
+  return checkResult(prev_sparse_solution_, std::get<3>(result), std::get<2>(result));
+}
+
+bool QPSolverOSQP::checkResult(
+  const std::vector<double> & solution, const int status_val, const int status_polish) const
+{
   if (status_val != 1) {
     RCLCPP_WARN(logger_, "optimization failed : %s", osqpsolver_.getStatusMessage().c_str());
     return false;
   }
   const auto has_nan =
-    std::any_of(U_osqp.begin(), U_osqp.end(), [](const auto v) { return std::isnan(v); });
+    std::any_of(solution.begin(), solution.end(), [](const auto v) { return std::isnan(v); });
   if (has_nan) {
     RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
     return false;
   }
 
   // polish status: successful (1), unperformed (0), (-1) unsuccessful
-  int status_polish = std::get<2>(result);
   if (status_polish == -1 || status_polish == 0) {
     const auto s = (status_polish == 0) ? "Polish process is not performed in osqp."
                                         : "Polish process failed in osqp.";
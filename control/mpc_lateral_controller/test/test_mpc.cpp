@@ -247,6 +247,31 @@ TEST_F(MPCTest, InitializeAndCalculateRightTurn)
   EXPECT_LT(ctrl_cmd.steering_tire_rotation_rate, 0.0f);
 }
 
+TEST_F(MPCTest, SetSameReferenceTrajectory)
+{
+  auto node = rclcpp::Node("mpc_test_node", rclcpp::NodeOptions{});
+  auto mpc = std::make_unique<MPC>(node);
+  initializeMPC(*mpc);
+  const auto current_kinematics =
+    makeOdometry(dummy_right_turn_trajectory.points.front().pose, 0.0);
+  mpc->setReferenceTrajectory(dummy_right_turn_trajectory, trajectory_param, current_kinematics);
+  const auto right_turn_reference = mpc->m_reference_trajectory;
+
+  // the preprocessing of the same trajectory is skipped, and the result is kept
+  mpc->setReferenceTrajectory(dummy_right_turn_trajectory, trajectory_param, current_kinematics);
+  EXPECT_EQ(mpc->m_reference_trajectory.x, right_turn_reference.x);
+  EXPECT_EQ(mpc->m_reference_trajectory.k, right_turn_reference.k);
+
+  // the different trajectory or parameter is preprocessed again
+  mpc->setReferenceTrajectory(dummy_straight_trajectory, trajectory_param, current_kinematics);
+  EXPECT_NE(mpc->m_reference_trajectory.k, right_turn_reference.k);
+  const auto straight_reference = mpc->m_reference_trajectory;
+  auto changed_param = trajectory_param;
+  changed_param.traj_resample_dist *= 2.0;
+  mpc->setReferenceTrajectory(dummy_straight_trajectory, changed_param, current_kinematics);
+  EXPECT_LT(mpc->m_reference_trajectory.size(), straight_reference.size());
+}
+
 TEST_F(MPCTest, OsqpCalculate)
 {
   auto node = rclcpp::Node("mpc_test_node", rclcpp::NodeOptions{});
@@ -302,6 +327,38 @@ TEST_F(MPCTest, OsqpCalculateRightTurn)
   EXPECT_LT(ctrl_cmd.steering_tire_rotation_rate, 0.0f);
 }
 
+TEST_F(MPCTest, OsqpSparseCalculateRightTurn)
+{
+  // solve the same problem with the condensed and the sparse formulations
+  AckermannLateralCommand ctrl_cmds[2];
+  for (const bool use_sparse_problem : {false, true}) {
+    auto node = rclcpp::Node("mpc_test_node", rclcpp::NodeOptions{});
+    auto mpc = std::make_unique<MPC>(node);
+    initializeMPC(*mpc);
+    const auto current_kinematics =
+      makeOdometry(dummy_right_turn_trajectory.points.front().pose, 0.0);
+    mpc->setReferenceTrajectory(dummy_right_turn_trajectory, trajectory_param, current_kinematics);
+
+    std::shared_ptr<VehicleModelInterface> vehicle_model_ptr =
+      std::make_shared<KinematicsBicycleModel>(wheelbase, steer_limit, steer_tau);
+    mpc->setVehicleModel(vehicle_model_ptr);
+    std::shared_ptr<QPSolverInterface> qpsolver_ptr =
+      std::make_shared<QPSolverOSQP>(logger, use_sparse_problem);
+    mpc->setQPSolver(qpsolver_ptr);
+    EXPECT_EQ(qpsolver_ptr->isSparseProblemSupported(), use_sparse_problem);
+
+    // Calculate MPC twice to solve the second one with the updated solver
+    Trajectory pred_traj;
+    Float32MultiArrayStamped diag;
+    const auto odom = makeOdometry(pose_zero, default_velocity);
+    auto & ctrl_cmd = ctrl_cmds[use_sparse_problem ? 1 : 0];
+    ASSERT_TRUE(mpc->calculateMPC(neutral_steer, odom, ctrl_cmd, pred_traj, diag));
+    ASSERT_TRUE(mpc->calculateMPC(neutral_steer, odom, ctrl_cmd, pred_traj, diag));
+    EXPECT_LT(ctrl_cmd.steering_tire_angle, 0.0f);
+  }
+  EXPECT_NEAR(ctrl_cmds[0].steering_tire_angle, ctrl_cmds[1].steering_tire_angle, 1e-3);
+}
+
 TEST_F(MPCTest, KinematicsNoDelayCalculate)
 {
   auto node = rclcpp::Node("mpc_test_node", rclcpp::NodeOptions{});
@@ -453,4 +510,40 @@ TEST_F(MPCTest, FailureCases)
   EXPECT_FALSE(mpc->calculateMPC(
     neutral_steer, makeOdometry(pose_far, default_velocity + 10.0), ctrl_cmd, pred_traj, diag));
 }
+
+TEST(MPCCondensingTest, CondensedCostMatchesDenseProducts)
+{
+  // the matrices in the structure of MPC::generateMPCMatrix with the kinematics model
+  const int N = 20;
+  const int dim_x = 3;
+  const int dim_u = 1;
+  const int dim_y = 2;
+  MPCMatrix m;
+  m.Aex = MatrixXd::Zero(dim_x * N, dim_x);
+  m.Bex = MatrixXd::Zero(dim_x * N, dim_u * N);
+  m.Wex = MatrixXd::Random(dim_x * N, 1);
+  m.Cex = MatrixXd::Zero(dim_y * N, dim_x * N);
+  m.Qex = MatrixXd::Zero(dim_y * N, dim_y * N);
+  m.R1ex = MatrixXd::Identity(dim_u * N, dim_u * N);
+  m.R2ex = MatrixXd::Identity(dim_u * N, dim_u * N) * 0.5;
+  m.Uref_ex = MatrixXd::Random(dim_u * N, 1);
+  for (int i = 0; i < N; ++i) {
+    m.Aex.block(i * dim_x, 0, dim_x, dim_x) = MatrixXd::Random(dim_x, dim_x);
+    m.Bex.block(i * dim_x, 0, dim_x, (i + 1) * dim_u) = MatrixXd::Random(dim_x, (i + 1) * dim_u);
+    m.Cex.block(i * dim_y, i * dim_x, dim_y, dim_x) = MatrixXd::Random(dim_y, dim_x);
+    m.Qex.block(i * dim_y, i * dim_y, dim_y, dim_y) = MatrixXd::Identity(dim_y, dim_y) * (i + 1);
+  }
+  const VectorXd x0 = VectorXd::Random(dim_x);
+
+  MatrixXd H;
+  MatrixXd f;
+  calcCondensedCost(m, x0, dim_x, dim_u, dim_y, H, f);
+
+  const MatrixXd CB = m.Cex * m.Bex;
+  const MatrixXd expected_H = CB.transpose() * m.Qex * CB + m.R1ex + m.R2ex;
+  const MatrixXd expected_f =
+    (m.Cex * (m.Aex * x0 + m.Wex)).transpose() * m.Qex * CB - m.Uref_ex.transpose() * m.R1ex;
+  EXPECT_TRUE(H.isApprox(expected_H, 1e-12));
+  EXPECT_TRUE(f.isApprox(expected_f, 1e-12));
+}
 }  // namespace autoware::motion::control::mpc_lateral_controller
@@ -16,6 +16,7 @@
 #define OBSTACLE_COLLISION_CHECKER__OBSTACLE_COLLISION_CHECKER_HPP_
 
 #include <tier4_autoware_utils/geometry/boost_geometry.hpp>
+#include <tier4_autoware_utils/geometry/footprint_sweep.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
 
 #include <autoware_auto_planning_msgs/msg/trajectory.hpp>
@@ -84,23 +85,9 @@ private:
   static autoware_auto_planning_msgs::msg::Trajectory cutTrajectory(
     const autoware_auto_planning_msgs::msg::Trajectory & trajectory, const double length);
 
-  static std::vector<LinearRing2d> createVehicleFootprints(
-    const autoware_auto_planning_msgs::msg::Trajectory & trajectory, const Param & param,
-    const vehicle_info_util::VehicleInfo & vehicle_info);
-
-  static std::vector<LinearRing2d> createVehiclePassingAreas(
-    const std::vector<LinearRing2d> & vehicle_footprints);
-
-  static LinearRing2d createHullFromFootprints(
-    const LinearRing2d & area1, const LinearRing2d & area2);
-
   static bool willCollide(
     const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud,
-    const std::vector<LinearRing2d> & vehicle_footprints);
-
-  static bool hasCollision(
-    const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud,
-    const LinearRing2d & vehicle_footprint);
+    const tier4_autoware_utils::FootprintSweep & vehicle_footprint_sweep);
 };
 }  // namespace obstacle_collision_checker
 
@@ -16,6 +16,7 @@
 
 #include <pcl_ros/transforms.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <tier4_autoware_utils/geometry/footprint_sweep.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/math/normalization.hpp>
 #include <tier4_autoware_utils/math/unit_conversion.hpp>
@@ -108,14 +109,17 @@ Output ObstacleCollisionChecker::update(const Input & input)
   const auto filtered_obstacle_pointcloud = filterPointCloudByTrajectory(
     obstacle_pointcloud, output.resampled_trajectory, param_.search_radius);
 
-  output.vehicle_footprints =
-    createVehicleFootprints(output.resampled_trajectory, param_, vehicle_info_);
+  const auto vehicle_footprint_sweep = tier4_autoware_utils::createFootprintSweep(
+    vehicle_info_.createFootprint(param_.footprint_margin), output.resampled_trajectory.points);
+  output.vehicle_footprints = vehicle_footprint_sweep.footprints();
   output.processing_time_map["createVehicleFootprints"] = stop_watch.toc(true);
 
-  output.vehicle_passing_areas = createVehiclePassingAreas(output.vehicle_footprints);
+  for (const auto & step_polygon : vehicle_footprint_sweep.stepPolygons()) {
+    output.vehicle_passing_areas.push_back(step_polygon.outer());
+  }
   output.processing_time_map["createVehiclePassingAreas"] = stop_watch.toc(true);
 
-  output.will_collide = willCollide(filtered_obstacle_pointcloud, output.vehicle_passing_areas);
+  output.will_collide = willCollide(filtered_obstacle_pointcloud, vehicle_footprint_sweep);
   output.processing_time_map["willCollide"] = stop_watch.toc(true);
 
   return output;
@@ -186,77 +190,15 @@ autoware_auto_planning_msgs::msg::Trajectory ObstacleCollisionChecker::cutTrajec
   return cut;
 }
 
-std::vector<LinearRing2d> ObstacleCollisionChecker::createVehicleFootprints(
-  const autoware_auto_planning_msgs::msg::Trajectory & trajectory, const Param & param,
-  const vehicle_info_util::VehicleInfo & vehicle_info)
-{
-  // Create vehicle footprint in base_link coordinate
-  const auto local_vehicle_footprint = vehicle_info.createFootprint(param.footprint_margin);
-
-  // Create vehicle footprint on each TrajectoryPoint
-  std::vector<LinearRing2d> vehicle_footprints;
-  for (const auto & p : trajectory.points) {
-    vehicle_footprints.push_back(
-      tier4_autoware_utils::transformVector<tier4_autoware_utils::LinearRing2d>(
-        local_vehicle_footprint, tier4_autoware_utils::pose2transform(p.pose)));
-  }
-
-  return vehicle_footprints;
-}
-
-std::vector<LinearRing2d> ObstacleCollisionChecker::createVehiclePassingAreas(
-  const std::vector<LinearRing2d> & vehicle_footprints)
-{
-  // Create hull from two adjacent vehicle footprints
-  std::vector<LinearRing2d> areas;
-  for (size_t i = 0; i < vehicle_footprints.size() - 1; ++i) {
-    const auto & footprint1 = vehicle_footprints.at(i);
-    const auto & footprint2 = vehicle_footprints.at(i + 1);
-    areas.push_back(createHullFromFootprints(footprint1, footprint2));
-  }
-
-  return areas;
-}
-
-LinearRing2d ObstacleCollisionChecker::createHullFromFootprints(
-  const LinearRing2d & area1, const LinearRing2d & area2)
-{
-  tier4_autoware_utils::MultiPoint2d combined;
-  for (const auto & p : area1) {
-    combined.push_back(p);
-  }
-  for (const auto & p : area2) {
-    combined.push_back(p);
-  }
-  LinearRing2d hull;
-  boost::geometry::convex_hull(combined, hull);
-  return hull;
-}
-
 bool ObstacleCollisionChecker::willCollide(
   const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud,
-  const std::vector<LinearRing2d> & vehicle_footprints)
-{
-  for (size_t i = 1; i < vehicle_footprints.size(); i++) {
-    // skip first footprint because surround obstacle checker handle it
-    const auto & vehicle_footprint = vehicle_footprints.at(i);
-    if (hasCollision(obstacle_pointcloud, vehicle_footprint)) {
-      RCLCPP_WARN(
-        rclcpp::get_logger("obstacle_collision_checker"), "ObstacleCollisionChecker::willCollide");
-      return true;
-    }
-  }
-
-  return false;
-}
-
-bool ObstacleCollisionChecker::hasCollision(
-  const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud,
-  const LinearRing2d & vehicle_footprint)
+  const tier4_autoware_utils::FootprintSweep & vehicle_footprint_sweep)
 {
   for (const auto & point : obstacle_pointcloud.points) {
-    if (boost::geometry::within(
-          tier4_autoware_utils::Point2d{point.x, point.y}, vehicle_footprint)) {
+    // skip first passing area because surround obstacle checker handle it
+    const auto step_indices =
+      vehicle_footprint_sweep.findStepsContaining(tier4_autoware_utils::Point2d{point.x, point.y});
+    if (!step_indices.empty() && step_indices.back() != 0) {
       RCLCPP_WARN(
         rclcpp::get_logger("obstacle_collision_checker"),
         "[ObstacleCollisionChecker] Collide to Point x: %f y: %f", point.x, point.y);
@@ -98,6 +98,7 @@ private:
 
   boost::optional<std::pair<geometry_msgs::msg::Point, PredictedObject>> checkDynamicObjects(
     const Pose & base_pose, PredictedObjects::ConstSharedPtr dynamic_objects,
+    const std::vector<Polygon2d> & object_polygons, const std::vector<size_t> & object_indices,
     const Polygon2d & one_step_move_vehicle_polygon2d, const double z_min, const double z_max);
 
   void updatePredictedObjectHistory(const rclcpp::Time & now)
@@ -55,10 +55,6 @@ using TrajectoryPoints = std::vector<TrajectoryPoint>;
 
 void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point & geom_point);
 
-Polygon2d createOneStepPolygon(
-  const geometry_msgs::msg::Pose & base_step_pose, const geometry_msgs::msg::Pose & next_step_pose,
-  const vehicle_info_util::VehicleInfo & vehicle_info, const double expand_width);
-
 TrajectoryPoint calcInterpolatedPoint(
   const TrajectoryPoints & trajectory, const geometry_msgs::msg::Point & target_point,
   const size_t segment_idx, const bool use_zero_order_hold_for_twist);
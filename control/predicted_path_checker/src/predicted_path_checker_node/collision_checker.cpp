@@ -15,6 +15,7 @@
 #include "predicted_path_checker/collision_checker.hpp"
 
 #include <rclcpp/logging.hpp>
+#include <tier4_autoware_utils/geometry/footprint_sweep.hpp>
 #include <tier4_autoware_utils/ros/marker_helper.hpp>
 
 #include <memory>
@@ -50,17 +51,33 @@ CollisionChecker::checkTrajectoryForCollision(
     return boost::none;
   }
 
-  for (size_t i = 0; i < predicted_trajectory_array.size() - 1; i++) {
-    // create one step circle center for vehicle
+  // NOTE: The one-step polygons of the trajectory and the steps which each object intersects are
+  //       calculated at once with the spatial index, instead of checking every object at each step.
+  const auto vehicle_footprint_sweep = tier4_autoware_utils::createFootprintSweep(
+    vehicle_info_.createFootprint(param_.width_margin, 0.0), predicted_trajectory_array);
+  const auto & one_step_move_vehicle_polygons = vehicle_footprint_sweep.stepPolygons();
+  std::vector<Polygon2d> object_polygons;
+  object_polygons.reserve(dynamic_objects->objects.size());
+  std::vector<std::vector<size_t>> step_object_indices(one_step_move_vehicle_polygons.size());
+  for (size_t i = 0; i < dynamic_objects->objects.size(); ++i) {
+    object_polygons.push_back(utils::convertObjToPolygon(dynamic_objects->objects.at(i)));
+    if (object_polygons.back().outer().empty()) {
+      // unsupported type
+      continue;
+    }
+    const auto step_indices = vehicle_footprint_sweep.findStepsIntersecting(object_polygons.back());
+    for (const auto step_idx : step_indices) {
+      step_object_indices.at(step_idx).push_back(i);
+    }
+  }
+
+  for (size_t i = 0; i < one_step_move_vehicle_polygons.size(); i++) {
     const auto & p_front = predicted_trajectory_array.at(i).pose;
-    const auto & p_back = predicted_trajectory_array.at(i + 1).pose;
     const auto z_min = p_front.position.z;
     const auto z_max =
       p_front.position.z + vehicle_info_.max_height_offset_m + param_.z_axis_filtering_buffer;
 
-    // create one-step polygon for vehicle
-    Polygon2d one_step_move_vehicle_polygon2d =
-      utils::createOneStepPolygon(p_front, p_back, vehicle_info_, param_.width_margin);
+    const auto & one_step_move_vehicle_polygon2d = one_step_move_vehicle_polygons.at(i);
     if (param_.enable_z_axis_obstacle_filtering) {
       debug_ptr_->pushPolyhedron(
         one_step_move_vehicle_polygon2d, z_min, z_max, PolygonType::Vehicle);
@@ -73,8 +90,9 @@ CollisionChecker::checkTrajectoryForCollision(
     auto found_collision_at_history =
       checkObstacleHistory(p_front, one_step_move_vehicle_polygon2d, z_min, z_max);
 
-    auto found_collision_at_dynamic_objects =
-      checkDynamicObjects(p_front, dynamic_objects, one_step_move_vehicle_polygon2d, z_min, z_max);
+    auto found_collision_at_dynamic_objects = checkDynamicObjects(
+      p_front, dynamic_objects, object_polygons, step_object_indices.at(i),
+      one_step_move_vehicle_polygon2d, z_min, z_max);
 
     if (found_collision_at_dynamic_objects || found_collision_at_history) {
       double distance_to_current = std::numeric_limits<double>::max();
@@ -155,9 +173,10 @@ CollisionChecker::checkObstacleHistory(
 boost::optional<std::pair<geometry_msgs::msg::Point, PredictedObject>>
 CollisionChecker::checkDynamicObjects(
   const Pose & base_pose, PredictedObjects::ConstSharedPtr dynamic_objects,
+  const std::vector<Polygon2d> & object_polygons, const std::vector<size_t> & object_indices,
   const Polygon2d & one_step_move_vehicle_polygon2d, const double z_min, const double z_max)
 {
-  if (dynamic_objects->objects.empty()) {
+  if (object_indices.empty()) {
     return boost::none;
   }
   double min_norm_collision_norm = 0.0;
@@ -165,58 +184,50 @@ CollisionChecker::checkDynamicObjects(
   size_t nearest_collision_object_index = 0;
   geometry_msgs::msg::Point nearest_collision_point;
 
-  for (size_t i = 0; i < dynamic_objects->objects.size(); ++i) {
+  // NOTE: object_indices are the objects which intersect the polygon, in ascending order
+  for (const auto i : object_indices) {
     const auto & obj = dynamic_objects->objects.at(i);
     if (param_.enable_z_axis_obstacle_filtering) {
       if (!utils::intersectsInZAxis(obj, z_min, z_max)) {
         continue;
       }
     }
-    const auto object_polygon = utils::convertObjToPolygon(obj);
-    if (object_polygon.outer().empty()) {
-      // unsupported type
-      continue;
+    const auto & object_polygon = object_polygons.at(i);
+
+    std::vector<Point2d> collision_points;
+    PointArray collision_point_array;
+    bg::intersection(one_step_move_vehicle_polygon2d, object_polygon, collision_points);
+    for (const auto & point : collision_points) {
+      geometry_msgs::msg::Point p;
+      p.x = point.x();
+      p.y = point.y();
+      collision_point_array.push_back(p);
     }
 
-    const auto found_collision_points =
-      bg::intersects(one_step_move_vehicle_polygon2d, object_polygon);
+    // Also check the corner points
 
-    if (found_collision_points) {
-      std::vector<Point2d> collision_points;
-      PointArray collision_point_array;
-      bg::intersection(one_step_move_vehicle_polygon2d, object_polygon, collision_points);
-      for (const auto & point : collision_points) {
+    for (const auto & point : object_polygon.outer()) {
+      if (bg::within(point, one_step_move_vehicle_polygon2d)) {
         geometry_msgs::msg::Point p;
         p.x = point.x();
         p.y = point.y();
         collision_point_array.push_back(p);
       }
-
-      // Also check the corner points
-
-      for (const auto & point : object_polygon.outer()) {
-        if (bg::within(point, one_step_move_vehicle_polygon2d)) {
-          geometry_msgs::msg::Point p;
-          p.x = point.x();
-          p.y = point.y();
-          collision_point_array.push_back(p);
-        }
-      }
-      geometry_msgs::msg::Point nearest_collision_point_tmp;
-
-      double norm = utils::getNearestPointAndDistanceForPredictedObject(
-        collision_point_array, base_pose, &nearest_collision_point_tmp);
-      if (norm < min_norm_collision_norm || !is_init) {
-        min_norm_collision_norm = norm;
-        nearest_collision_point = nearest_collision_point_tmp;
-        is_init = true;
-        nearest_collision_object_index = i;
-      }
+    }
+    geometry_msgs::msg::Point nearest_collision_point_tmp;
+
+    double norm = utils::getNearestPointAndDistanceForPredictedObject(
+      collision_point_array, base_pose, &nearest_collision_point_tmp);
+    if (norm < min_norm_collision_norm || !is_init) {
+      min_norm_collision_norm = norm;
+      nearest_collision_point = nearest_collision_point_tmp;
+      is_init = true;
+      nearest_collision_object_index = i;
     }
   }
   if (is_init) {
     const auto & obj = dynamic_objects->objects.at(nearest_collision_object_index);
-    const auto obstacle_polygon = utils::convertObjToPolygon(obj);
+    const auto & obstacle_polygon = object_polygons.at(nearest_collision_object_index);
     if (param_.enable_z_axis_obstacle_filtering) {
       debug_ptr_->pushPolyhedron(obstacle_polygon, z_min, z_max, PolygonType::Collision);
     } else {
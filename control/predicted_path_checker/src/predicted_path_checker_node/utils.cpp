@@ -15,7 +15,6 @@
 #include "predicted_path_checker/utils.hpp"
 
 #include <boost/format.hpp>
-#include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/strategies/agnostic/hull_graham_andrew.hpp>
 
 namespace utils
@@ -27,59 +26,6 @@ using tier4_autoware_utils::calcDistance2d;
 using tier4_autoware_utils::getRPY;
 
 // Utils Functions
-Polygon2d createOneStepPolygon(
-  const geometry_msgs::msg::Pose & base_step_pose, const geometry_msgs::msg::Pose & next_step_pose,
-  const vehicle_info_util::VehicleInfo & vehicle_info, const double expand_width)
-{
-  Polygon2d polygon;
-
-  const double longitudinal_offset = vehicle_info.max_longitudinal_offset_m;
-  const double width = vehicle_info.vehicle_width_m / 2.0 + expand_width;
-  const double rear_overhang = vehicle_info.rear_overhang_m;
-
-  {  // base step
-    appendPointToPolygon(
-      polygon, tier4_autoware_utils::calcOffsetPose(base_step_pose, longitudinal_offset, width, 0.0)
-                 .position);
-    appendPointToPolygon(
-      polygon,
-      tier4_autoware_utils::calcOffsetPose(base_step_pose, longitudinal_offset, -width, 0.0)
-        .position);
-    appendPointToPolygon(
-      polygon,
-      tier4_autoware_utils::calcOffsetPose(base_step_pose, -rear_overhang, -width, 0.0).position);
-    appendPointToPolygon(
-      polygon,
-      tier4_autoware_utils::calcOffsetPose(base_step_pose, -rear_overhang, width, 0.0).position);
-  }
-
-  {  // next step
-    appendPointToPolygon(
-      polygon, tier4_autoware_utils::calcOffsetPose(next_step_pose, longitudinal_offset, width, 0.0)
-                 .position);
-    appendPointToPolygon(
-      polygon,
-      tier4_autoware_utils::calcOffsetPose(next_step_pose, longitudinal_offset, -width, 0.0)
-        .position);
-    appendPointToPolygon(
-      polygon,
-      tier4_autoware_utils::calcOffsetPose(next_step_pose, -rear_overhang, -width, 0.0).position);
-    appendPointToPolygon(
-      polygon,
-      tier4_autoware_utils::calcOffsetPose(next_step_pose, -rear_overhang, width, 0.0).position);
-  }
-
-  polygon = tier4_autoware_utils::isClockwise(polygon)
-              ? polygon
-              : tier4_autoware_utils::inverseClockwise(polygon);
-
-  Polygon2d hull_polygon;
-  boost::geometry::convex_hull(polygon, hull_polygon);
-  boost::geometry::correct(hull_polygon);
-
-  return hull_polygon;
-}
-
 TrajectoryPoint calcInterpolatedPoint(
   const TrajectoryPoints & trajectory, const geometry_msgs::msg::Point & target_point,
   const size_t segment_idx, const bool use_zero_order_hold_for_twist)
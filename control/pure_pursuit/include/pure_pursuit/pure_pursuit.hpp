@@ -77,6 +77,8 @@ private:
   double lookahead_distance_, closest_thr_dist_, closest_thr_ang_;
   std::shared_ptr<std::vector<geometry_msgs::msg::Pose>> curr_wps_ptr_;
   std::shared_ptr<geometry_msgs::msg::Pose> curr_pose_ptr_;
+  // closest index of the last run, which is -1 for new waypoints
+  int32_t closest_idx_hint_{-1};
 
   // functions
   int32_t findNextPointIdx(int32_t search_start_idx);
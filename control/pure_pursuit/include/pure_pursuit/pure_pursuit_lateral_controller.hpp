@@ -51,6 +51,7 @@
 #include <boost/optional.hpp>  // To be replaced by std::optional in C++17
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 using autoware::motion::control::trajectory_follower::InputData;
@@ -126,6 +127,16 @@ private:
 
   void setResampledTrajectory();
 
+  // Resampled trajectory cache
+  // NOTE: The trajectory is resampled only when a new one is received, and the values derived
+  //       from it are kept with it, so that a control cycle does not iterate over the trajectory.
+  void updateResampledTrajectoryCache();
+  std::optional<size_t> findClosestIndex(const geometry_msgs::msg::Pose & pose);
+  double calcLateralOffset(const geometry_msgs::msg::Point & point, const size_t closest_idx) const;
+  std::vector<double> resampled_arc_lengths_;
+  std::vector<geometry_msgs::msg::Point> lateral_offset_points_;
+  std::optional<size_t> closest_idx_hint_;
+
   // TF
   tf2_ros::Buffer tf_buffer_;
   tf2_ros::TransformListener tf_listener_;
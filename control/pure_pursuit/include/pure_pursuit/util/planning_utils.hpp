@@ -22,6 +22,7 @@
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 #include <rclcpp/rclcpp.hpp>
+#include <tier4_autoware_utils/geometry/geometry.hpp>
 
 #include <autoware_auto_planning_msgs/msg/trajectory.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
@@ -39,6 +40,7 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #endif
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -73,6 +75,39 @@ std::pair<bool, int32_t> findClosestIdxWithDistAngThr(
   const geometry_msgs::msg::Pose & current_pose, const double th_dist = 3.0,
   const double th_yaw = M_PI_2);
 
+/**
+ * @brief find the closest index around the hint index with findLocalNearestIdx(), falling back
+ * to the search over all the poses if it does not satisfy the thresholds
+ */
+std::pair<bool, int32_t> findClosestIdxWithDistAngThr(
+  const std::vector<geometry_msgs::msg::Pose> & poses,
+  const geometry_msgs::msg::Pose & current_pose, const double th_dist, const double th_yaw,
+  const int32_t hint_idx);
+
+/**
+ * @brief find the nearest index by walking from the hint index while the distance decreases
+ * @details This is amortized O(1) when the point moves little from the last search. The result is
+ * a local minimum, which differs from the global one only if the points come back close to it.
+ */
+template <class T>
+size_t findLocalNearestIdx(
+  const std::vector<T> & points, const geometry_msgs::msg::Point & point, const size_t hint_idx)
+{
+  const auto squared_dist = [&](const size_t i) {
+    return calcDistSquared2D(tier4_autoware_utils::getPoint(points.at(i)), point);
+  };
+
+  size_t idx = std::min(hint_idx, points.size() - 1);
+  double min_squared_dist = squared_dist(idx);
+  while (idx + 1 < points.size() && squared_dist(idx + 1) < min_squared_dist) {
+    min_squared_dist = squared_dist(++idx);
+  }
+  while (idx > 0 && squared_dist(idx - 1) < min_squared_dist) {
+    min_squared_dist = squared_dist(--idx);
+  }
+  return idx;
+}
+
 int8_t getLaneDirection(const std::vector<geometry_msgs::msg::Pose> & poses, double th_dist = 0.5);
 bool isDirectionForward(
   const geometry_msgs::msg::Pose & prev, const geometry_msgs::msg::Pose & next);
@@ -34,9 +34,11 @@
 #include "pure_pursuit/util/planning_utils.hpp"
 #include "pure_pursuit/util/tf_utils.hpp"
 
+#include <tier4_autoware_utils/geometry/pose_deviation.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <utility>
 
@@ -52,6 +54,22 @@ enum TYPE {
   VELOCITY = 6,
   SIZE  // this is the number of enum elements
 };
+
+// NOTE: The trajectory is published by the planning with a new stamp, so the stamp and the ends
+//       are compared instead of all the points.
+bool isSameTrajectory(const Trajectory & a, const Trajectory & b)
+{
+  if (
+    a.header.stamp != b.header.stamp || a.header.frame_id != b.header.frame_id ||
+    a.points.size() != b.points.size()) {
+    return false;
+  }
+  if (a.points.empty()) {
+    return true;
+  }
+  return a.points.front().pose.position == b.points.front().pose.position &&
+         a.points.back().pose.position == b.points.back().pose.position;
+}
 }  // namespace
 
 namespace pure_pursuit
@@ -171,6 +189,92 @@ void PurePursuitLateralController::setResampledTrajectory()
   output_tp_array_ = motion_utils::convertToTrajectoryPointArray(*trajectory_resampled_);
 }
 
+void PurePursuitLateralController::updateResampledTrajectoryCache()
+{
+  const auto & points = trajectory_resampled_->points;
+
+  resampled_arc_lengths_.resize(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    resampled_arc_lengths_.at(i) =
+      (i == 0) ? 0.0
+               : resampled_arc_lengths_.at(i - 1) +
+                   std::hypot(
+                     points.at(i).pose.position.x - points.at(i - 1).pose.position.x,
+                     points.at(i).pose.position.y - points.at(i - 1).pose.position.y);
+  }
+
+  // the points used by motion_utils::calcLateralOffset()
+  const auto overlap_removed_points = motion_utils::removeOverlapPoints(points, 0);
+  lateral_offset_points_.clear();
+  lateral_offset_points_.reserve(overlap_removed_points.size());
+  for (const auto & p : overlap_removed_points) {
+    lateral_offset_points_.push_back(p.pose.position);
+  }
+
+  pure_pursuit_->setWaypoints(planning_utils::extractPoses(*trajectory_resampled_));
+  closest_idx_hint_.reset();
+}
+
+std::optional<size_t> PurePursuitLateralController::findClosestIndex(
+  const geometry_msgs::msg::Pose & pose)
+{
+  constexpr double max_dist = 3.0;
+  constexpr double max_yaw = M_PI_4;
+
+  // NOTE: The closest point is searched around the one of the last search first, and then over
+  //       all the points with the same thresholds as motion_utils::findNearestIndex().
+  if (closest_idx_hint_ && !output_tp_array_.empty()) {
+    const size_t idx =
+      planning_utils::findLocalNearestIdx(output_tp_array_, pose.position, *closest_idx_hint_);
+    const auto & closest_pose = output_tp_array_.at(idx).pose;
+    if (
+      tier4_autoware_utils::calcSquaredDistance2d(closest_pose, pose) <= max_dist * max_dist &&
+      std::abs(tier4_autoware_utils::calcYawDeviation(closest_pose, pose)) <= max_yaw) {
+      closest_idx_hint_ = idx;
+      return idx;
+    }
+  }
+
+  const auto closest_idx =
+    motion_utils::findNearestIndex(output_tp_array_, pose, max_dist, max_yaw);
+  if (closest_idx) {
+    closest_idx_hint_ = *closest_idx;
+  }
+  return closest_idx;
+}
+
+double PurePursuitLateralController::calcLateralOffset(
+  const geometry_msgs::msg::Point & point, const size_t closest_idx) const
+{
+  const auto & points = lateral_offset_points_;
+  if (points.size() < 2) {
+    return std::nan("");
+  }
+
+  // the segment of motion_utils::findNearestSegmentIndex()
+  const size_t nearest_idx =
+    planning_utils::findLocalNearestIdx(points, point, std::min(closest_idx, points.size() - 1));
+  size_t seg_idx = nearest_idx;
+  if (nearest_idx == points.size() - 1) {
+    seg_idx = points.size() - 2;
+  } else if (nearest_idx > 0) {
+    const auto & p_front = points.at(nearest_idx);
+    const auto & p_back = points.at(nearest_idx + 1);
+    const double dot = (p_back.x - p_front.x) * (point.x - p_front.x) +
+                       (p_back.y - p_front.y) * (point.y - p_front.y);
+    if (dot <= 0.0) {
+      seg_idx = nearest_idx - 1;
+    }
+  }
+
+  const auto & p_front = points.at(seg_idx);
+  const auto & p_back = points.at(seg_idx + 1);
+  const double segment_x = p_back.x - p_front.x;
+  const double segment_y = p_back.y - p_front.y;
+  const double cross = segment_x * (point.y - p_front.y) - segment_y * (point.x - p_front.x);
+  return cross / std::hypot(segment_x, segment_y);
+}
+
 double PurePursuitLateralController::calcCurvature(const size_t closest_idx)
 {
   // Calculate current curvature
@@ -268,15 +372,16 @@ void PurePursuitLateralController::averageFilterTrajectory(
 
 boost::optional<Trajectory> PurePursuitLateralController::generatePredictedTrajectory()
 {
-  const auto closest_idx_result =
-    motion_utils::findNearestIndex(output_tp_array_, current_odometry_.pose.pose, 3.0, M_PI_4);
+  const auto closest_idx_result = findClosestIndex(current_odometry_.pose.pose);
 
   if (!closest_idx_result) {
     return boost::none;
   }
+  // keep the hint of the current pose for the next cycle
+  const auto closest_idx_hint = closest_idx_hint_;
 
-  const double remaining_distance = planning_utils::calcArcLengthFromWayPoint(
-    *trajectory_resampled_, *closest_idx_result, trajectory_resampled_->points.size() - 1);
+  const double remaining_distance =
+    resampled_arc_lengths_.back() - resampled_arc_lengths_.at(*closest_idx_result);
 
   const auto num_of_iteration = std::max(
     static_cast<int>(std::ceil(
@@ -328,6 +433,7 @@ boost::optional<Trajectory> PurePursuitLateralController::generatePredictedTraje
   predicted_trajectory.points.back().longitudinal_velocity_mps = 0.0;
   predicted_trajectory.header.frame_id = trajectory_resampled_->header.frame_id;
   predicted_trajectory.header.stamp = trajectory_resampled_->header.stamp;
+  closest_idx_hint_ = closest_idx_hint;
 
   return predicted_trajectory;
 }
@@ -340,13 +446,17 @@ bool PurePursuitLateralController::isReady([[maybe_unused]] const InputData & in
 LateralOutput PurePursuitLateralController::run(const InputData & input_data)
 {
   current_pose_ = input_data.current_odometry.pose.pose;
-  trajectory_ = input_data.current_trajectory;
   current_odometry_ = input_data.current_odometry;
   current_steering_ = input_data.current_steering;
 
-  setResampledTrajectory();
-  if (param_.enable_path_smoothing) {
-    averageFilterTrajectory(*trajectory_resampled_);
+  // resample the trajectory only when a new one is received
+  if (!trajectory_resampled_ || !isSameTrajectory(input_data.current_trajectory, trajectory_)) {
+    trajectory_ = input_data.current_trajectory;
+    setResampledTrajectory();
+    if (param_.enable_path_smoothing) {
+      averageFilterTrajectory(*trajectory_resampled_);
+    }
+    updateResampledTrajectoryCache();
   }
   const auto cmd_msg = generateOutputControlCmd();
 
@@ -427,8 +537,7 @@ boost::optional<PpOutput> PurePursuitLateralController::calcTargetCurvature(
 
   // Calculate target point for velocity/acceleration
 
-  const auto closest_idx_result =
-    motion_utils::findNearestIndex(output_tp_array_, pose, 3.0, M_PI_4);
+  const auto closest_idx_result = findClosestIndex(pose);
   if (!closest_idx_result) {
     RCLCPP_ERROR(logger_, "cannot find closest waypoint");
     return {};
@@ -439,8 +548,7 @@ boost::optional<PpOutput> PurePursuitLateralController::calcTargetCurvature(
 
   // calculate the lateral error
 
-  const double lateral_error =
-    motion_utils::calcLateralOffset(trajectory_resampled_->points, pose.position);
+  const double lateral_error = calcLateralOffset(pose.position, *closest_idx_result);
 
   // calculate the current curvature
 
@@ -462,8 +570,8 @@ boost::optional<PpOutput> PurePursuitLateralController::calcTargetCurvature(
   }
 
   // Set PurePursuit data
+  // NOTE: The waypoints are set in updateResampledTrajectoryCache().
   pure_pursuit_->setCurrentPose(pose);
-  pure_pursuit_->setWaypoints(planning_utils::extractPoses(*trajectory_resampled_));
   pure_pursuit_->setLookaheadDistance(lookahead_distance);
 
   // Run PurePursuit
@@ -142,6 +142,23 @@ std::pair<bool, int32_t> findClosestIdxWithDistAngThr(
   return (idx_min >= 0) ? std::make_pair(true, idx_min) : std::make_pair(false, idx_min);
 }
 
+std::pair<bool, int32_t> findClosestIdxWithDistAngThr(
+  const std::vector<geometry_msgs::msg::Pose> & poses,
+  const geometry_msgs::msg::Pose & current_pose, const double th_dist, const double th_yaw,
+  const int32_t hint_idx)
+{
+  if (0 <= hint_idx && static_cast<size_t>(hint_idx) < poses.size()) {
+    const size_t idx = findLocalNearestIdx(poses, current_pose.position, hint_idx);
+    const double ds = calcDistSquared2D(poses.at(idx).position, current_pose.position);
+    const double yaw_diff = normalizeEulerAngle(
+      tf2::getYaw(current_pose.orientation) - tf2::getYaw(poses.at(idx).orientation));
+    if (ds <= th_dist * th_dist && fabs(yaw_diff) <= th_yaw) {
+      return std::make_pair(true, static_cast<int32_t>(idx));
+    }
+  }
+  return findClosestIdxWithDistAngThr(poses, current_pose, th_dist, th_yaw);
+}
+
 int8_t getLaneDirection(const std::vector<geometry_msgs::msg::Pose> & poses, double th_dist)
 {
   if (poses.size() < 2) {
@@ -55,8 +55,10 @@ std::pair<bool, double> PurePursuit::run()
     return std::make_pair(false, std::numeric_limits<double>::quiet_NaN());
   }
 
+  // NOTE: The closest point is searched around the one of the last run first, since the pose
+  //       moves little between the runs.
   auto closest_pair = planning_utils::findClosestIdxWithDistAngThr(
-    *curr_wps_ptr_, *curr_pose_ptr_, closest_thr_dist_, closest_thr_ang_);
+    *curr_wps_ptr_, *curr_pose_ptr_, closest_thr_dist_, closest_thr_ang_, closest_idx_hint_);
 
   if (!closest_pair.first) {
     RCLCPP_WARN(
@@ -64,6 +66,7 @@ std::pair<bool, double> PurePursuit::run()
       closest_pair.second);
     return std::make_pair(false, std::numeric_limits<double>::quiet_NaN());
   }
+  closest_idx_hint_ = closest_pair.second;
 
   int32_t next_wp_idx = findNextPointIdx(closest_pair.second);
   if (next_wp_idx == -1) {
@@ -155,6 +158,10 @@ int32_t PurePursuit::findNextPointIdx(int32_t search_start_idx)
     return -1;
   }
 
+  // the direction of the waypoints, which is checked only if there are 2 waypoints or more
+  const auto gld =
+    curr_wps_ptr_->size() < 2 ? 2 : planning_utils::getLaneDirection(*curr_wps_ptr_, 0.05);
+
   // look for the next waypoint.
   for (int32_t i = search_start_idx; i < (int32_t)curr_wps_ptr_->size(); i++) {
     // if search waypoint is the last
@@ -163,7 +170,6 @@ int32_t PurePursuit::findNextPointIdx(int32_t search_start_idx)
     }
 
     // if waypoint direction is forward
-    const auto gld = planning_utils::getLaneDirection(*curr_wps_ptr_, 0.05);
     if (gld == 0) {
       // if waypoint is not in front of ego, skip
       auto ret = planning_utils::transformToRelativeCoordinate2D(
@@ -207,6 +213,7 @@ void PurePursuit::setWaypoints(const std::vector<geometry_msgs::msg::Pose> & msg
 {
   curr_wps_ptr_ = std::make_shared<std::vector<geometry_msgs::msg::Pose>>();
   *curr_wps_ptr_ = msg;
+  closest_idx_hint_ = -1;
 }
 
 }  // namespace pure_pursuit
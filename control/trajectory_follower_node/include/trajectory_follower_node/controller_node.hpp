@@ -15,6 +15,7 @@
 #ifndef TRAJECTORY_FOLLOWER_NODE__CONTROLLER_NODE_HPP_
 #define TRAJECTORY_FOLLOWER_NODE__CONTROLLER_NODE_HPP_
 
+#include "diagnostic_updater/diagnostic_updater.hpp"
 #include "rclcpp/rclcpp.hpp"
 #include "tf2/utils.h"
 #include "tf2_ros/buffer.h"
@@ -43,7 +44,10 @@
 #include <tier4_debug_msgs/msg/float64_stamped.hpp>
 
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -60,16 +64,28 @@ using tier4_debug_msgs::msg::Float64Stamped;
 
 namespace trajectory_follower = ::autoware::motion::control::trajectory_follower;
 
+/// \brief statistics of the deviation of the control cycle from ctrl_period
+struct ControlCycleJitter
+{
+  size_t count{0};
+  double sum_ms{0.0};
+  double max_abs_ms{0.0};
+  size_t over_threshold_count{0};
+
+  void update(const double jitter_ms, const double threshold_ms);
+};
+
 /// \classController
 /// \brief The node class used for generating longitudinal control commands (velocity/acceleration)
 class TRAJECTORY_FOLLOWER_PUBLIC Controller : public rclcpp::Node
 {
 public:
   explicit Controller(const rclcpp::NodeOptions & node_options);
-  virtual ~Controller() {}
+  virtual ~Controller();
 
 private:
   rclcpp::TimerBase::SharedPtr timer_control_;
+  double ctrl_period_;
   double timeout_thr_sec_;
   boost::optional<LongitudinalOutput> longitudinal_output_{boost::none};
 
@@ -93,6 +109,22 @@ private:
   geometry_msgs::msg::AccelWithCovarianceStamped::SharedPtr current_accel_ptr_;
   OperationModeState::SharedPtr current_operation_mode_ptr_;
 
+  // NOTE: The input is copied into the same instance every cycle, so the trajectory points are
+  //       not allocated unless the trajectory grows.
+  trajectory_follower::InputData input_data_;
+
+  // real-time mode, in which the control and the inputs are executed in the dedicated thread
+  rclcpp::CallbackGroup::SharedPtr cb_group_control_{nullptr};
+  rclcpp::executors::SingleThreadedExecutor::SharedPtr realtime_executor_;
+  std::thread realtime_thread_;
+
+  // jitter of the control cycle, which is reported to the diagnostics
+  diagnostic_updater::Updater diag_updater_{this};
+  std::optional<rclcpp::Time> prev_control_time_;
+  double jitter_warn_threshold_ms_;
+  std::mutex jitter_mutex_;
+  ControlCycleJitter jitter_;
+
   enum class LateralControllerMode {
     INVALID = 0,
     MPC = 1,
@@ -106,8 +138,11 @@ private:
   /**
    * @brief compute control command, and publish periodically
    */
-  boost::optional<trajectory_follower::InputData> createInputData(rclcpp::Clock & clock) const;
+  bool createInputData(rclcpp::Clock & clock, trajectory_follower::InputData & input_data) const;
   void callbackTimerControl();
+  void startRealtimeThread(const int thread_priority, const int cpu_core);
+  void updateControlCycleJitter();
+  void checkControlCycleJitter(diagnostic_updater::DiagnosticStatusWrapper & stat);
   void onTrajectory(const autoware_auto_planning_msgs::msg::Trajectory::SharedPtr);
   void onOdometry(const nav_msgs::msg::Odometry::SharedPtr msg);
   void onSteering(const autoware_auto_vehicle_msgs::msg::SteeringReport::SharedPtr msg);
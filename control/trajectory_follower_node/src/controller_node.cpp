@@ -17,9 +17,17 @@
 #include "mpc_lateral_controller/mpc_lateral_controller.hpp"
 #include "pid_longitudinal_controller/pid_longitudinal_controller.hpp"
 #include "pure_pursuit/pure_pursuit_lateral_controller.hpp"
+#include "tier4_autoware_utils/ros/loaned_message_publisher.hpp"
 #include "tier4_autoware_utils/ros/marker_helper.hpp"
 
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
 #include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -28,12 +36,35 @@
 
 namespace autoware::motion::control::trajectory_follower_node
 {
+void ControlCycleJitter::update(const double jitter_ms, const double threshold_ms)
+{
+  ++count;
+  sum_ms += jitter_ms;
+  max_abs_ms = std::max(max_abs_ms, std::abs(jitter_ms));
+  if (threshold_ms < std::abs(jitter_ms)) {
+    ++over_threshold_count;
+  }
+}
+
 Controller::Controller(const rclcpp::NodeOptions & node_options) : Node("controller", node_options)
 {
   using std::placeholders::_1;
 
-  const double ctrl_period = declare_parameter<double>("ctrl_period");
+  ctrl_period_ = declare_parameter<double>("ctrl_period");
   timeout_thr_sec_ = declare_parameter<double>("timeout_thr_sec");
+  jitter_warn_threshold_ms_ = declare_parameter<double>("jitter_warn_threshold_ms");
+  const bool enable_realtime_mode = declare_parameter<bool>("realtime_mode.enable");
+  const int realtime_thread_priority = declare_parameter<int>("realtime_mode.thread_priority");
+  const int realtime_cpu_core = declare_parameter<int>("realtime_mode.cpu_core");
+  const bool lock_memory = declare_parameter<bool>("realtime_mode.lock_memory");
+
+  // NOTE: The callback group is not added to the executor of the node, e.g. of the component
+  //       container, but to the one spun in the dedicated thread.
+  if (enable_realtime_mode) {
+    cb_group_control_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive, false);
+  }
+  rclcpp::SubscriptionOptions sub_options;
+  sub_options.callback_group = cb_group_control_;
 
   const auto lateral_controller_mode =
     getLateralControllerMode(declare_parameter<std::string>("lateral_controller_mode"));
@@ -63,16 +94,21 @@ Controller::Controller(const rclcpp::NodeOptions & node_options) : Node("control
   }
 
   sub_ref_path_ = create_subscription<autoware_auto_planning_msgs::msg::Trajectory>(
-    "~/input/reference_trajectory", rclcpp::QoS{1}, std::bind(&Controller::onTrajectory, this, _1));
+    "~/input/reference_trajectory", rclcpp::QoS{1}, std::bind(&Controller::onTrajectory, this, _1),
+    sub_options);
   sub_steering_ = create_subscription<autoware_auto_vehicle_msgs::msg::SteeringReport>(
-    "~/input/current_steering", rclcpp::QoS{1}, std::bind(&Controller::onSteering, this, _1));
+    "~/input/current_steering", rclcpp::QoS{1}, std::bind(&Controller::onSteering, this, _1),
+    sub_options);
   sub_odometry_ = create_subscription<nav_msgs::msg::Odometry>(
-    "~/input/current_odometry", rclcpp::QoS{1}, std::bind(&Controller::onOdometry, this, _1));
+    "~/input/current_odometry", rclcpp::QoS{1}, std::bind(&Controller::onOdometry, this, _1),
+    sub_options);
   sub_accel_ = create_subscription<geometry_msgs::msg::AccelWithCovarianceStamped>(
-    "~/input/current_accel", rclcpp::QoS{1}, std::bind(&Controller::onAccel, this, _1));
+    "~/input/current_accel", rclcpp::QoS{1}, std::bind(&Controller::onAccel, this, _1),
+    sub_options);
   sub_operation_mode_ = create_subscription<OperationModeState>(
     "~/input/current_operation_mode", rclcpp::QoS{1},
-    [this](const OperationModeState::SharedPtr msg) { current_operation_mode_ptr_ = msg; });
+    [this](const OperationModeState::SharedPtr msg) { current_operation_mode_ptr_ = msg; },
+    sub_options);
   control_cmd_pub_ = create_publisher<autoware_auto_control_msgs::msg::AckermannControlCommand>(
     "~/output/control_cmd", rclcpp::QoS{1}.transient_local());
   pub_processing_time_lat_ms_ =
@@ -85,14 +121,68 @@ Controller::Controller(const rclcpp::NodeOptions & node_options) : Node("control
   // Timer
   {
     const auto period_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
-      std::chrono::duration<double>(ctrl_period));
+      std::chrono::duration<double>(ctrl_period_));
     timer_control_ = rclcpp::create_timer(
-      this, get_clock(), period_ns, std::bind(&Controller::callbackTimerControl, this));
+      this, get_clock(), period_ns, std::bind(&Controller::callbackTimerControl, this),
+      cb_group_control_);
   }
 
+  diag_updater_.setHardwareID("trajectory_follower_node");
+  diag_updater_.add("control_cycle_jitter", this, &Controller::checkControlCycleJitter);
+
   logger_configure_ = std::make_unique<tier4_autoware_utils::LoggerLevelConfigure>(this);
 
   published_time_publisher_ = std::make_unique<tier4_autoware_utils::PublishedTimePublisher>(this);
+
+  if (enable_realtime_mode) {
+    // NOTE: The memory of the whole process, e.g. of the component container, is locked, so that
+    //       the control is not blocked by the page faults.
+    if (lock_memory && mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+      RCLCPP_WARN(
+        get_logger(), "Failed to lock the memory: %s. CAP_IPC_LOCK or the memlock limit is needed.",
+        std::strerror(errno));
+    }
+    startRealtimeThread(realtime_thread_priority, realtime_cpu_core);
+  }
+}
+
+Controller::~Controller()
+{
+  if (realtime_thread_.joinable()) {
+    realtime_executor_->cancel();
+    realtime_thread_.join();
+  }
+}
+
+void Controller::startRealtimeThread(const int thread_priority, const int cpu_core)
+{
+  realtime_executor_ = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  realtime_executor_->add_callback_group(cb_group_control_, get_node_base_interface());
+
+  realtime_thread_ = std::thread([this, thread_priority, cpu_core]() {
+    if (0 < thread_priority) {
+      sched_param param{};
+      param.sched_priority = thread_priority;
+      const int result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+      if (result != 0) {
+        RCLCPP_WARN(
+          get_logger(), "Failed to set SCHED_FIFO with the priority %d: %s",
+          thread_priority, std::strerror(result));
+      }
+    }
+    if (0 <= cpu_core) {
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      CPU_SET(cpu_core, &cpu_set);
+      const int result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set);
+      if (result != 0) {
+        RCLCPP_WARN(
+          get_logger(), "Failed to set the affinity to the CPU %d: %s", cpu_core,
+          std::strerror(result));
+      }
+    }
+    realtime_executor_->spin();
+  });
 }
 
 Controller::LateralControllerMode Controller::getLateralControllerMode(
@@ -152,57 +242,96 @@ bool Controller::isTimeOut(
   return false;
 }
 
-boost::optional<trajectory_follower::InputData> Controller::createInputData(
-  rclcpp::Clock & clock) const
+bool Controller::createInputData(
+  rclcpp::Clock & clock, trajectory_follower::InputData & input_data) const
 {
   if (!current_trajectory_ptr_) {
     RCLCPP_INFO_THROTTLE(get_logger(), clock, 5000, "Waiting for trajectory.");
-    return {};
+    return false;
   }
 
   if (!current_odometry_ptr_) {
     RCLCPP_INFO_THROTTLE(get_logger(), clock, 5000, "Waiting for current odometry.");
-    return {};
+    return false;
   }
 
   if (!current_steering_ptr_) {
     RCLCPP_INFO_THROTTLE(get_logger(), clock, 5000, "Waiting for current steering.");
-    return {};
+    return false;
   }
 
   if (!current_accel_ptr_) {
     RCLCPP_INFO_THROTTLE(get_logger(), clock, 5000, "Waiting for current accel.");
-    return {};
+    return false;
   }
 
   if (!current_operation_mode_ptr_) {
     RCLCPP_INFO_THROTTLE(get_logger(), clock, 5000, "Waiting for current operation mode.");
-    return {};
+    return false;
   }
 
-  trajectory_follower::InputData input_data;
   input_data.current_trajectory = *current_trajectory_ptr_;
   input_data.current_odometry = *current_odometry_ptr_;
   input_data.current_steering = *current_steering_ptr_;
   input_data.current_accel = *current_accel_ptr_;
   input_data.current_operation_mode = *current_operation_mode_ptr_;
 
-  return input_data;
+  return true;
+}
+
+void Controller::updateControlCycleJitter()
+{
+  const auto now = this->now();
+  if (prev_control_time_) {
+    const double jitter_ms = ((now - *prev_control_time_).seconds() - ctrl_period_) * 1e3;
+    std::lock_guard<std::mutex> lock(jitter_mutex_);
+    jitter_.update(jitter_ms, jitter_warn_threshold_ms_);
+  }
+  prev_control_time_ = now;
+}
+
+void Controller::checkControlCycleJitter(diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  using diagnostic_msgs::msg::DiagnosticStatus;
+
+  // the statistics since the last diagnostics
+  ControlCycleJitter jitter;
+  {
+    std::lock_guard<std::mutex> lock(jitter_mutex_);
+    std::swap(jitter, jitter_);
+  }
+
+  stat.add("Control Cycles", jitter.count);
+  if (jitter.count == 0) {
+    stat.summary(DiagnosticStatus::OK, "No control cycle");
+    return;
+  }
+  stat.addf("Mean Jitter", "%.3f [ms]", jitter.sum_ms / static_cast<double>(jitter.count));
+  stat.addf("Max Absolute Jitter", "%.3f [ms]", jitter.max_abs_ms);
+  stat.add("Cycles Over Threshold", jitter.over_threshold_count);
+  if (0 < jitter.over_threshold_count) {
+    stat.summary(DiagnosticStatus::WARN, "Jitter of the control cycle exceeds the threshold");
+  } else {
+    stat.summary(DiagnosticStatus::OK, "OK");
+  }
 }
 
 void Controller::callbackTimerControl()
 {
+  updateControlCycleJitter();
+
   // 1. create input data
-  const auto input_data = createInputData(*get_clock());
-  if (!input_data) {
+  if (!createInputData(*get_clock(), input_data_)) {
     RCLCPP_INFO_THROTTLE(
       get_logger(), *get_clock(), 5000, "Control is skipped since input data is not ready.");
     return;
   }
 
+  const auto & input_data = input_data_;
+
   // 2. check if controllers are ready
-  const bool is_lat_ready = lateral_controller_->isReady(*input_data);
-  const bool is_lon_ready = longitudinal_controller_->isReady(*input_data);
+  const bool is_lat_ready = lateral_controller_->isReady(input_data);
+  const bool is_lon_ready = longitudinal_controller_->isReady(input_data);
   if (!is_lat_ready || !is_lon_ready) {
     RCLCPP_INFO_THROTTLE(
       get_logger(), *get_clock(), 5000,
@@ -212,11 +341,11 @@ void Controller::callbackTimerControl()
 
   // 3. run controllers
   stop_watch_.tic("lateral");
-  const auto lat_out = lateral_controller_->run(*input_data);
+  const auto lat_out = lateral_controller_->run(input_data);
   publishProcessingTime(stop_watch_.toc("lateral"), pub_processing_time_lat_ms_);
 
   stop_watch_.tic("longitudinal");
-  const auto lon_out = longitudinal_controller_->run(*input_data);
+  const auto lon_out = longitudinal_controller_->run(input_data);
   publishProcessingTime(stop_watch_.toc("longitudinal"), pub_processing_time_lon_ms_);
 
   // 4. sync with each other controllers
@@ -231,11 +360,12 @@ void Controller::callbackTimerControl()
   out.stamp = this->now();
   out.lateral = lat_out.control_cmd;
   out.longitudinal = lon_out.control_cmd;
-  control_cmd_pub_->publish(out);
+  const auto stamp = out.stamp;
+  tier4_autoware_utils::publishLoanedOrMoved(control_cmd_pub_, std::move(out));
 
   // 6. publish debug
-  published_time_publisher_->publish_if_subscribed(control_cmd_pub_, out.stamp);
-  publishDebugMarker(*input_data, lat_out);
+  published_time_publisher_->publish_if_subscribed(control_cmd_pub_, stamp);
+  publishDebugMarker(input_data, lat_out);
 }
 
 void Controller::publishDebugMarker(
@@ -599,3 +599,16 @@ TEST_F(FakeNodeFixture, longitudinal_check_steer_converged)
   // Keep stopped state when the lateral control is not converged.
   EXPECT_DOUBLE_EQ(tester.cmd_msg->longitudinal.speed, 0.0f);
 }
+
+TEST(ControlCycleJitter, update)
+{
+  autoware::motion::control::trajectory_follower_node::ControlCycleJitter jitter;
+  jitter.update(1.0, 5.0);
+  jitter.update(-6.0, 5.0);
+  jitter.update(3.0, 5.0);
+
+  EXPECT_EQ(jitter.count, 3u);
+  EXPECT_DOUBLE_EQ(jitter.sum_ms, -2.0);
+  EXPECT_DOUBLE_EQ(jitter.max_abs_ms, 6.0);
+  EXPECT_EQ(jitter.over_threshold_count, 1u);
+}
@@ -38,6 +38,7 @@ bool VehicleCmdFilter::setParameterWithValidation(const VehicleCmdFilterParam &
   }
 
   param_ = p;
+  updateSpeedInterpolation();
   return true;
 }
 void VehicleCmdFilter::setSteerLim(LimitArray v)
@@ -95,6 +96,12 @@ VehicleCmdFilterParam VehicleCmdFilter::getParam() const
   return param_;
 }
 
+void VehicleCmdFilter::setCurrentSpeed(double v)
+{
+  current_speed_ = v;
+  updateSpeedInterpolation();
+}
+
 void VehicleCmdFilter::limitLongitudinalWithVel(AckermannControlCommand & input) const
 {
   input.longitudinal.speed = std::max(
@@ -262,35 +269,58 @@ double VehicleCmdFilter::limitDiff(
   return prev + diff;
 }
 
-double VehicleCmdFilter::interpolateFromSpeed(const LimitArray & limits) const
+void VehicleCmdFilter::updateSpeedInterpolation()
 {
   // Consider only for the positive velocities.
   const auto current = std::abs(current_speed_);
-  const auto reference = param_.reference_speed_points;
+  const auto & reference = param_.reference_speed_points;
+
+  speed_index_ = 0;
+  speed_ratio_ = 0.0;
+  is_speed_interpolation_broken_ = false;
+  if (reference.empty()) {
+    return;
+  }
 
   // If the speed is out of range of the reference, apply zero-order hold.
   if (current <= reference.front()) {
-    return limits.front();
+    return;
   }
   if (current >= reference.back()) {
-    return limits.back();
+    speed_index_ = reference.size() - 1;
+    return;
   }
 
   // Apply linear interpolation
   for (size_t i = 0; i < reference.size() - 1; ++i) {
     if (reference.at(i) <= current && current <= reference.at(i + 1)) {
-      auto ratio =
+      const auto ratio =
         (current - reference.at(i)) / std::max(reference.at(i + 1) - reference.at(i), 1.0e-5);
-      ratio = std::clamp(ratio, 0.0, 1.0);
-      const auto interp = limits.at(i) + ratio * (limits.at(i + 1) - limits.at(i));
-      return interp;
+      speed_index_ = i;
+      speed_ratio_ = std::clamp(ratio, 0.0, 1.0);
+      return;
     }
   }
 
-  std::cerr << "VehicleCmdFilter::interpolateFromSpeed() interpolation logic is broken. Command "
-               "filter is not working. Please check the code."
-            << std::endl;
-  return reference.back();
+  is_speed_interpolation_broken_ = true;
+}
+
+double VehicleCmdFilter::interpolateFromSpeed(const LimitArray & limits) const
+{
+  if (is_speed_interpolation_broken_) {
+    std::cerr << "VehicleCmdFilter::interpolateFromSpeed() interpolation logic is broken. Command "
+                 "filter is not working. Please check the code."
+              << std::endl;
+    return param_.reference_speed_points.back();
+  }
+
+  // NOTE: The segment and the ratio are calculated when the speed or the parameter is set, so the
+  //       limits are interpolated without searching the reference speed points.
+  if (speed_ratio_ == 0.0) {
+    return limits.at(speed_index_);
+  }
+  return limits.at(speed_index_) +
+         speed_ratio_ * (limits.at(speed_index_ + 1) - limits.at(speed_index_));
 }
 
 double VehicleCmdFilter::getLonAccLim() const
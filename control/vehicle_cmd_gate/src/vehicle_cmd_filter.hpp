@@ -56,7 +56,7 @@ public:
   void setLatAccLim(LimitArray v);
   void setLatJerkLim(LimitArray v);
   void setActualSteerDiffLim(LimitArray v);
-  void setCurrentSpeed(double v) { current_speed_ = v; }
+  void setCurrentSpeed(double v);
   void setParam(const VehicleCmdFilterParam & p);
   VehicleCmdFilterParam getParam() const;
   void setPrevCmd(const AckermannControlCommand & v) { prev_cmd_ = v; }
@@ -84,6 +84,13 @@ private:
   AckermannControlCommand prev_cmd_;
   double current_speed_ = 0.0;
 
+  // segment of the reference speed points and the ratio in it for the current speed, which are
+  // shared by the interpolations of all the limits
+  size_t speed_index_ = 0;
+  double speed_ratio_ = 0.0;
+  bool is_speed_interpolation_broken_ = false;
+  void updateSpeedInterpolation();
+
   bool setParameterWithValidation(const VehicleCmdFilterParam & p);
 
   double calcLatAcc(const AckermannControlCommand & cmd) const;
@@ -604,7 +604,7 @@ AckermannControlCommand VehicleCmdGate::filterControlCommand(const AckermannCont
 {
   AckermannControlCommand out = in;
   const double dt = getDt();
-  const auto mode = current_operation_mode_;
+  const auto & mode = current_operation_mode_;
   const auto current_status_cmd = getActualStatusAsCommand();
   const auto ego_is_stopped = vehicle_stop_checker_->isVehicleStopped(stop_check_duration_);
   const auto input_cmd_is_stopping = in.longitudinal.acceleration < 0.0;
@@ -886,6 +886,7 @@ MarkerArray VehicleCmdGate::createMarkerArray(const IsFilterActivated & filter_a
 
 void VehicleCmdGate::publishMarkers(const IsFilterActivated & filter_activated)
 {
+  const auto filter_activated_markers = createMarkerArray(filter_activated);
   BoolStamped filter_activated_flag;
   if (filter_activated.is_activated) {
     filter_activated_count_++;
@@ -896,7 +897,7 @@ void VehicleCmdGate::publishMarkers(const IsFilterActivated & filter_activated)
     filter_activated_count_ >= filter_activated_count_threshold_ &&
     std::fabs(current_kinematics_.twist.twist.linear.x) >= filter_activated_velocity_threshold_ &&
     current_operation_mode_.mode == OperationModeState::AUTONOMOUS) {
-    filter_activated_marker_pub_->publish(createMarkerArray(filter_activated));
+    filter_activated_marker_pub_->publish(filter_activated_markers);
     filter_activated_flag.data = true;
   } else {
     filter_activated_flag.data = false;
@@ -904,7 +905,7 @@ void VehicleCmdGate::publishMarkers(const IsFilterActivated & filter_activated)
 
   filter_activated_flag.stamp = now();
   filter_activated_flag_pub_->publish(filter_activated_flag);
-  filter_activated_marker_raw_pub_->publish(createMarkerArray(filter_activated));
+  filter_activated_marker_raw_pub_->publish(filter_activated_markers);
 }
 }  // namespace vehicle_cmd_gate
 
@@ -60,6 +60,9 @@ private:
   std::vector<rclcpp::Subscription<DiagnosticArray>::SharedPtr> diagnostics_sub_;
   std::vector<std::unordered_map<std::string, rclcpp::Publisher<UserDefinedValue>::SharedPtr>>
     params_pub_;
+  // publishers of params_pub_ keyed by the status name and the key joined with '\0'
+  std::vector<std::unordered_map<std::string, rclcpp::Publisher<UserDefinedValue>::SharedPtr>>
+    status_key_pub_;
 };
 }  // namespace diagnostic_converter
 
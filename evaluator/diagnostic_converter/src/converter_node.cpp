@@ -14,18 +14,22 @@
 
 #include "diagnostic_converter/converter_node.hpp"
 
-#include <regex>
-
 namespace
 {
 std::string removeInvalidTopicString(const std::string & input_string)
 {
-  std::regex pattern{R"([a-zA-Z0-9/_]+)"};
+  // keep only the characters matching [a-zA-Z0-9/_]
+  const auto is_valid = [](const char c) {
+    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') ||
+           c == '/' || c == '_';
+  };
 
   std::string result;
-  for (std::sregex_iterator itr(std::begin(input_string), std::end(input_string), pattern), end;
-       itr != end; ++itr) {
-    result += itr->str();
+  result.reserve(input_string.size());
+  for (const char c : input_string) {
+    if (is_valid(c)) {
+      result += c;
+    }
   }
   return result;
 }
@@ -63,17 +67,28 @@ DiagnosticConverter::DiagnosticConverter(const rclcpp::NodeOptions & node_option
     diagnostics_sub_.push_back(create_subscription<DiagnosticArray>(diagnostic_topic, 1, fn));
   }
   params_pub_.resize(diagnostics_sub_.size());
+  status_key_pub_.resize(diagnostics_sub_.size());
 }
 
 void DiagnosticConverter::onDiagnostic(
   const DiagnosticArray::ConstSharedPtr diag_msg, const size_t diag_idx,
   const std::string & base_topic)
 {
+  // NOTE: The publishers are looked up by the status name and the key as they are, so that the
+  //       topic name is made only for a new pair of them.
+  auto & status_key_pubs = status_key_pub_[diag_idx];
+  std::string status_key;
   for (const auto & status : diag_msg->status) {
-    std::string status_topic = base_topic + (status.name.empty() ? "" : "_" + status.name);
     for (const auto & key_value : status.values) {
-      const auto valid_topic_name = removeInvalidTopicString(status_topic + "_" + key_value.key);
-      getPublisher(valid_topic_name, diag_idx)->publish(createUserDefinedValue(key_value));
+      status_key.assign(status.name).append(1, '\0').append(key_value.key);
+      auto itr = status_key_pubs.find(status_key);
+      if (itr == status_key_pubs.end()) {
+        const std::string status_topic =
+          base_topic + (status.name.empty() ? "" : "_" + status.name);
+        const auto valid_topic_name = removeInvalidTopicString(status_topic + "_" + key_value.key);
+        itr = status_key_pubs.emplace(status_key, getPublisher(valid_topic_name, diag_idx)).first;
+      }
+      itr->second->publish(createUserDefinedValue(key_value));
     }
   }
 }
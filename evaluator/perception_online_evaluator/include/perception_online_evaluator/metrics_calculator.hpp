@@ -34,6 +34,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -116,6 +117,8 @@ private:
   // Store predicted objects information and calculation results
   ObjectMap object_map_;
   HistoryPathMap history_path_map_;
+  // stamps of all the objects in object_map_
+  std::set<rclcpp::Time> stamps_;
 
   rclcpp::Time current_stamp_;
 
@@ -152,9 +155,9 @@ private:
   // Extract object
   rclcpp::Time getClosestStamp(const rclcpp::Time stamp) const;
   std::optional<StampObjectMapIterator> getClosestObjectIterator(
-    const std::string & uuid, const rclcpp::Time & stamp) const;
-  std::optional<PredictedObject> getObjectByStamp(
-    const std::string uuid, const rclcpp::Time stamp) const;
+    const std::string & uuid, const rclcpp::Time & closest_stamp) const;
+  const PredictedObject * getObjectByStamp(
+    const std::string & uuid, const rclcpp::Time stamp) const;
   std::optional<std::pair<rclcpp::Time, PredictedObject>> getPreviousObjectByStamp(
     const std::string uuid, const rclcpp::Time stamp) const;
   PredictedObjects getObjectsByStamp(const rclcpp::Time stamp) const;
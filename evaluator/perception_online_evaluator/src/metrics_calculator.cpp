@@ -122,34 +122,30 @@ bool MetricsCalculator::hasPassedTime(const rclcpp::Time stamp) const
 
 rclcpp::Time MetricsCalculator::getClosestStamp(const rclcpp::Time stamp) const
 {
+  // NOTE: The stamps of all the objects are kept in one sorted set, so that the closest one is
+  //       searched once instead of once per object.
   rclcpp::Time closest_stamp;
   rclcpp::Duration min_duration =
     rclcpp::Duration::from_nanoseconds(std::numeric_limits<int64_t>::max());
 
-  for (const auto & [uuid, stamp_and_objects] : object_map_) {
-    if (!stamp_and_objects.empty()) {
-      auto it = std::lower_bound(
-        stamp_and_objects.begin(), stamp_and_objects.end(), stamp,
-        [](const auto & pair, const rclcpp::Time & val) { return pair.first < val; });
-
-      // check the upper bound
-      if (it != stamp_and_objects.end()) {
-        const auto duration = it->first - stamp;
-        if (std::abs(duration.nanoseconds()) < min_duration.nanoseconds()) {
-          min_duration = duration;
-          closest_stamp = it->first;
-        }
-      }
+  const auto it = stamps_.lower_bound(stamp);
 
-      // check the lower bound (if it is not the first element)
-      if (it != stamp_and_objects.begin()) {
-        const auto prev_it = std::prev(it);
-        const auto duration = stamp - prev_it->first;
-        if (std::abs(duration.nanoseconds()) < min_duration.nanoseconds()) {
-          min_duration = duration;
-          closest_stamp = prev_it->first;
-        }
-      }
+  // check the upper bound
+  if (it != stamps_.end()) {
+    const auto duration = *it - stamp;
+    if (std::abs(duration.nanoseconds()) < min_duration.nanoseconds()) {
+      min_duration = duration;
+      closest_stamp = *it;
+    }
+  }
+
+  // check the lower bound (if it is not the first element)
+  if (it != stamps_.begin()) {
+    const auto prev_it = std::prev(it);
+    const auto duration = stamp - *prev_it;
+    if (std::abs(duration.nanoseconds()) < min_duration.nanoseconds()) {
+      min_duration = duration;
+      closest_stamp = *prev_it;
     }
   }
 
@@ -157,45 +153,44 @@ rclcpp::Time MetricsCalculator::getClosestStamp(const rclcpp::Time stamp) const
 }
 
 std::optional<StampObjectMapIterator> MetricsCalculator::getClosestObjectIterator(
-  const std::string & uuid, const rclcpp::Time & stamp) const
+  const std::string & uuid, const rclcpp::Time & closest_stamp) const
 {
-  const auto closest_stamp = getClosestStamp(stamp);
-  const auto it = std::lower_bound(
-    object_map_.at(uuid).begin(), object_map_.at(uuid).end(), closest_stamp,
-    [](const auto & pair, const rclcpp::Time & val) { return pair.first < val; });
+  const auto & stamp_and_objects = object_map_.at(uuid);
+  const auto it = stamp_and_objects.lower_bound(closest_stamp);
 
-  return it != object_map_.at(uuid).end() ? std::optional<StampObjectMapIterator>(it)
-                                          : std::nullopt;
+  return it != stamp_and_objects.end() ? std::optional<StampObjectMapIterator>(it) : std::nullopt;
 }
 
-std::optional<PredictedObject> MetricsCalculator::getObjectByStamp(
-  const std::string uuid, const rclcpp::Time stamp) const
+const PredictedObject * MetricsCalculator::getObjectByStamp(
+  const std::string & uuid, const rclcpp::Time stamp) const
 {
   constexpr double eps = 0.01;
   constexpr double close_time_threshold = 0.1;
 
-  const auto obj_it_opt = getClosestObjectIterator(uuid, stamp);
+  const auto closest_stamp = getClosestStamp(stamp);
+  const auto obj_it_opt = getClosestObjectIterator(uuid, closest_stamp);
   if (obj_it_opt.has_value()) {
     const auto it = obj_it_opt.value();
-    if (std::abs((it->first - getClosestStamp(stamp)).seconds()) < eps) {
+    if (std::abs((it->first - closest_stamp).seconds()) < eps) {
       const double time_diff = std::abs((it->first - stamp).seconds());
       if (time_diff < close_time_threshold) {
-        return it->second;
+        return &it->second;
       }
     }
   }
-  return std::nullopt;
+  return nullptr;
 }
 
 std::optional<std::pair<rclcpp::Time, PredictedObject>> MetricsCalculator::getPreviousObjectByStamp(
   const std::string uuid, const rclcpp::Time stamp) const
 {
-  const auto obj_it_opt = getClosestObjectIterator(uuid, stamp);
+  const auto closest_stamp = getClosestStamp(stamp);
+  const auto obj_it_opt = getClosestObjectIterator(uuid, closest_stamp);
   if (obj_it_opt.has_value()) {
     auto it = obj_it_opt.value();
     if (it != object_map_.at(uuid).begin()) {
       // If it is exactly the closest stamp, move one back to get the previous
-      if (it->first == getClosestStamp(stamp)) {
+      if (it->first == closest_stamp) {
         --it;
       } else {
         // If it is not the closest stamp, it already points to the previous one due to lower_bound
@@ -213,12 +208,9 @@ PredictedObjects MetricsCalculator::getObjectsByStamp(const rclcpp::Time stamp)
   PredictedObjects objects;
   objects.header.stamp = stamp;
   for (const auto & [uuid, stamp_and_objects] : object_map_) {
-    auto it = std::lower_bound(
-      stamp_and_objects.begin(), stamp_and_objects.end(), closest_stamp,
-      [](const auto & pair, const rclcpp::Time & val) { return pair.first < val; });
-
-    // add the object only if the element pointed to by lower_bound is equal to stamp
-    if (it != stamp_and_objects.end() && it->first == closest_stamp) {
+    // add the object only if it has the closest stamp
+    const auto it = stamp_and_objects.find(closest_stamp);
+    if (it != stamp_and_objects.end()) {
       objects.objects.push_back(it->second);
     }
   }
@@ -243,7 +235,7 @@ MetricStatMap MetricsCalculator::calcLateralDeviationMetrics(
         continue;
       }
       const auto object_pose = object.kinematics.initial_pose_with_covariance.pose;
-      const auto history_path = history_path_map_.at(uuid).second;
+      const auto & history_path = history_path_map_.at(uuid).second;
       if (history_path.empty()) {
         continue;
       }
@@ -272,7 +264,7 @@ MetricStatMap MetricsCalculator::calcYawDeviationMetrics(
         continue;
       }
       const auto object_pose = object.kinematics.initial_pose_with_covariance.pose;
-      const auto history_path = history_path_map_.at(uuid).second;
+      const auto & history_path = history_path_map_.at(uuid).second;
       if (history_path.empty()) {
         continue;
       }
@@ -327,9 +319,9 @@ PredictedPathDeviationMetrics MetricsCalculator::calcPredictedPathDeviationMetri
   const auto stamp = objects.header.stamp;
   for (const auto & object : objects.objects) {
     const auto uuid = tier4_autoware_utils::toHexString(object.object_id);
-    const auto predicted_paths = object.kinematics.predicted_paths;
+    const auto & predicted_paths = object.kinematics.predicted_paths;
     for (size_t i = 0; i < predicted_paths.size(); i++) {
-      const auto predicted_path = predicted_paths[i];
+      const auto & predicted_path = predicted_paths[i];
       const std::string path_id = uuid + "_" + std::to_string(i);
       for (size_t j = 0; j < predicted_path.path.size(); j++) {
         const double time_duration =
@@ -342,12 +334,11 @@ PredictedPathDeviationMetrics MetricsCalculator::calcPredictedPathDeviationMetri
         if (!hasPassedTime(uuid, target_stamp)) {
           continue;
         }
-        const auto history_object_opt = getObjectByStamp(uuid, target_stamp);
-        if (!history_object_opt.has_value()) {
+        const auto * history_object = getObjectByStamp(uuid, target_stamp);
+        if (!history_object) {
           continue;
         }
-        const auto history_object = history_object_opt.value();
-        const auto history_pose = history_object.kinematics.initial_pose_with_covariance.pose;
+        const auto & history_pose = history_object->kinematics.initial_pose_with_covariance.pose;
         const Pose & p = predicted_path.path[j];
         const double distance =
           tier4_autoware_utils::calcDistance2d(p.position, history_pose.position);
@@ -383,10 +374,10 @@ PredictedPathDeviationMetrics MetricsCalculator::calcPredictedPathDeviationMetri
     const auto [min_deviation_index, min_mean_deviation] = min_deviation.value();
     deviation_map_for_objects[uuid] = deviation_map.at(min_deviation_index);
     const auto path_id = uuid + "_" + std::to_string(min_deviation_index);
-    const auto target_stamp_object = getObjectByStamp(uuid, stamp);
-    if (target_stamp_object.has_value()) {
+    const auto * target_stamp_object = getObjectByStamp(uuid, stamp);
+    if (target_stamp_object) {
       ObjectData object_data;
-      object_data.object = target_stamp_object.value();
+      object_data.object = *target_stamp_object;
       object_data.path_pairs = debug_predicted_path_pairs_map[path_id];
       debug_target_object_[uuid] = object_data;
     }
@@ -513,30 +504,26 @@ void MetricsCalculator::deleteOldObjects(const rclcpp::Time stamp)
 {
   // delete the data older than 2*time_delay_
   const double time_delay = getTimeDelay();
-  for (auto & [uuid, stamp_and_objects] : object_map_) {
-    for (auto it = stamp_and_objects.begin(); it != stamp_and_objects.end();) {
-      if (it->first < stamp - rclcpp::Duration::from_seconds(time_delay * 2)) {
-        it = stamp_and_objects.erase(it);
-      } else {
-        break;
-      }
-    }
-  }
-
-  const auto object_map = object_map_;
-  for (const auto & [uuid, stamp_and_objects] : object_map) {
+  const auto oldest_stamp = stamp - rclcpp::Duration::from_seconds(time_delay * 2);
+  for (auto it = object_map_.begin(); it != object_map_.end();) {
+    auto & [uuid, stamp_and_objects] = *it;
+    stamp_and_objects.erase(stamp_and_objects.begin(), stamp_and_objects.lower_bound(oldest_stamp));
     if (stamp_and_objects.empty()) {
-      object_map_.erase(uuid);
       history_path_map_.erase(uuid);
       debug_target_object_.erase(uuid);  // debug
+      it = object_map_.erase(it);
+    } else {
+      ++it;
     }
   }
+  stamps_.erase(stamps_.begin(), stamps_.lower_bound(oldest_stamp));
 }
 
 void MetricsCalculator::updateObjects(
   const std::string uuid, const rclcpp::Time stamp, const PredictedObject & object)
 {
   object_map_[uuid][stamp] = object;
+  stamps_.insert(stamp);
 }
 
 void MetricsCalculator::updateHistoryPath()
@@ -28,19 +28,31 @@ namespace planning_diagnostics
 namespace metrics
 {
 using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+using autoware_auto_perception_msgs::msg::PredictedObject;
 using tier4_autoware_utils::calcDistance2d;
+using tier4_autoware_utils::calcSquaredDistance2d;
 
 Stat<double> calcDistanceToObstacle(const PredictedObjects & obstacles, const Trajectory & traj)
 {
   Stat<double> stat;
   for (const TrajectoryPoint & p : traj.points) {
-    double min_dist = std::numeric_limits<double>::max();
+    // NOTE: The nearest object is found by the squared distance, and only the distance to it is
+    //       calculated.
+    double min_squared_dist = std::numeric_limits<double>::max();
+    const PredictedObject * nearest_object = nullptr;
     for (const auto & object : obstacles.objects) {
       // TODO(Maxime CLEMENT): take into account the shape, not only the centroid
-      const auto dist = calcDistance2d(object.kinematics.initial_pose_with_covariance.pose, p);
-      min_dist = std::min(min_dist, dist);
+      const auto squared_dist =
+        calcSquaredDistance2d(object.kinematics.initial_pose_with_covariance.pose, p);
+      if (squared_dist < min_squared_dist) {
+        min_squared_dist = squared_dist;
+        nearest_object = &object;
+      }
     }
-    stat.add(min_dist);
+    stat.add(
+      nearest_object
+        ? calcDistance2d(nearest_object->kinematics.initial_pose_with_covariance.pose, p)
+        : std::numeric_limits<double>::max());
   }
   return stat;
 }
@@ -63,7 +75,7 @@ Stat<double> calcTimeToCollision(
     if (p0.longitudinal_velocity_mps != 0) {
       const double dt = traj_dist / std::abs(p0.longitudinal_velocity_mps);
       t += dt;
-      for (auto obstacle : obstacles.objects) {
+      for (const auto & obstacle : obstacles.objects) {
         const double obstacle_dist =
           calcDistance2d(p, obstacle.kinematics.initial_pose_with_covariance.pose);
         // TODO(Maxime CLEMENT): take shape into consideration
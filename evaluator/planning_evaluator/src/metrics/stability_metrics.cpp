@@ -14,14 +14,15 @@
 
 #include "planning_evaluator/metrics/stability_metrics.hpp"
 
+#include "motion_utils/trajectory/indexed_trajectory.hpp"
 #include "motion_utils/trajectory/trajectory.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
-#include <Eigen/Core>
-
 #include "autoware_auto_planning_msgs/msg/trajectory_point.hpp"
 
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace planning_diagnostics
 {
@@ -37,23 +38,26 @@ Stat<double> calcFrechetDistance(const Trajectory & traj1, const Trajectory & tr
     return stat;
   }
 
-  Eigen::MatrixXd ca = Eigen::MatrixXd::Zero(traj1.points.size(), traj2.points.size());
+  // NOTE: Only the previous row of the coupling matrix is needed to calculate the current row.
+  std::vector<double> prev_ca(traj2.points.size());
+  std::vector<double> ca(traj2.points.size());
 
   for (size_t i = 0; i < traj1.points.size(); ++i) {
     for (size_t j = 0; j < traj2.points.size(); ++j) {
       const double dist = tier4_autoware_utils::calcDistance2d(traj1.points[i], traj2.points[j]);
       if (i > 0 && j > 0) {
-        ca(i, j) = std::max(std::min(ca(i - 1, j), std::min(ca(i - 1, j - 1), ca(i, j - 1))), dist);
+        ca[j] = std::max(std::min(prev_ca[j], std::min(prev_ca[j - 1], ca[j - 1])), dist);
       } else if (i > 0 /*&& j == 0*/) {
-        ca(i, j) = std::max(ca(i - 1, 0), dist);
+        ca[j] = std::max(prev_ca[0], dist);
       } else if (j > 0 /*&& i == 0*/) {
-        ca(i, j) = std::max(ca(0, j - 1), dist);
+        ca[j] = std::max(ca[j - 1], dist);
       } else { /* i == j == 0 */
-        ca(i, j) = dist;
+        ca[j] = dist;
       }
     }
+    std::swap(prev_ca, ca);
   }
-  stat.add(ca(traj1.points.size() - 1, traj2.points.size() - 1));
+  stat.add(prev_ca.back());
   return stat;
 }
 
@@ -63,22 +67,24 @@ Stat<double> calcLateralDistance(const Trajectory & traj1, const Trajectory & tr
   if (traj1.points.empty()) {
     return stat;
   }
+  // the nearest segments of all the points of traj2 are searched on traj1
+  const motion_utils::IndexedTrajectory<std::vector<TrajectoryPoint>> indexed_traj1(traj1.points);
   for (const auto & point : traj2.points) {
     const auto p0 = tier4_autoware_utils::getPoint(point);
     // find nearest segment
-    const size_t nearest_segment_idx = motion_utils::findNearestSegmentIndex(traj1.points, p0);
+    const size_t nearest_segment_idx = indexed_traj1.findNearestSegmentIndex(p0);
     double dist;
     // distance to segment
     if (
       nearest_segment_idx == traj1.points.size() - 2 &&
-      motion_utils::calcLongitudinalOffsetToSegment(traj1.points, nearest_segment_idx, p0) >
+      indexed_traj1.calcLongitudinalOffsetToSegment(nearest_segment_idx, p0) >
         tier4_autoware_utils::calcDistance2d(
           traj1.points[nearest_segment_idx], traj1.points[nearest_segment_idx + 1])) {
       // distance to last point
       dist = tier4_autoware_utils::calcDistance2d(traj1.points.back(), p0);
     } else if (  // NOLINT
       nearest_segment_idx == 0 &&
-      motion_utils::calcLongitudinalOffsetToSegment(traj1.points, nearest_segment_idx, p0) <= 0) {
+      indexed_traj1.calcLongitudinalOffsetToSegment(nearest_segment_idx, p0) <= 0) {
       // distance to first point
       dist = tier4_autoware_utils::calcDistance2d(traj1.points.front(), p0);
     } else {
@@ -0,0 +1,140 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "planning_evaluator/metrics_calculator.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/serialization.hpp"
+#include "rosbag2_cpp/reader.hpp"
+
+#include "nav_msgs/msg/odometry.hpp"
+
+#include <array>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief calculate the trajectory metrics of the planning_evaluator from a rosbag, reading the
+ * messages in the order of the bag without the executor, and write them in the same format as the
+ * output_file of the planning_evaluator node
+ */
+int main(int argc, char * argv[])
+{
+  using nav_msgs::msg::Odometry;
+  using planning_diagnostics::Metric;
+  using planning_diagnostics::MetricsCalculator;
+  using planning_diagnostics::PredictedObjects;
+  using planning_diagnostics::Stat;
+  using planning_diagnostics::Trajectory;
+
+  rclcpp::init(argc, argv);
+  // NOTE: The node is used only to read the parameters and is not spun.
+  const auto node = std::make_shared<rclcpp::Node>("planning_evaluator_offline");
+
+  const auto bag_path = node->declare_parameter<std::string>("bag_path");
+  const auto output_file = node->declare_parameter<std::string>("output_file");
+  const auto odometry_topic = node->declare_parameter<std::string>("input/odometry");
+  const auto trajectory_topic = node->declare_parameter<std::string>("input/trajectory");
+  const auto reference_trajectory_topic =
+    node->declare_parameter<std::string>("input/reference_trajectory");
+  const auto objects_topic = node->declare_parameter<std::string>("input/objects");
+
+  MetricsCalculator metrics_calculator;
+  metrics_calculator.parameters.trajectory.min_point_dist_m =
+    node->declare_parameter<double>("trajectory.min_point_dist_m");
+  metrics_calculator.parameters.trajectory.lookahead.max_dist_m =
+    node->declare_parameter<double>("trajectory.lookahead.max_dist_m");
+  metrics_calculator.parameters.trajectory.lookahead.max_time_s =
+    node->declare_parameter<double>("trajectory.lookahead.max_time_s");
+  metrics_calculator.parameters.obstacle.dist_thr_m =
+    node->declare_parameter<double>("obstacle.dist_thr_m");
+
+  // the metrics of the modified goal are not calculated for a trajectory
+  std::vector<Metric> metrics;
+  for (const std::string & selected_metric :
+       node->declare_parameter<std::vector<std::string>>("selected_metrics")) {
+    if (selected_metric.rfind("modified_goal_", 0) == 0) {
+      continue;
+    }
+    metrics.push_back(planning_diagnostics::str_to_metric.at(selected_metric));
+  }
+
+  rosbag2_cpp::Reader bag_reader;
+  bag_reader.open(bag_path);
+
+  rclcpp::Serialization<Odometry> odometry_serialization;
+  rclcpp::Serialization<Trajectory> trajectory_serialization;
+  rclcpp::Serialization<PredictedObjects> objects_serialization;
+  Odometry odometry;
+  Trajectory trajectory;
+  PredictedObjects objects;
+  bool is_odometry_received = false;
+
+  std::vector<rclcpp::Time> stamps;
+  std::array<std::vector<Stat<double>>, static_cast<size_t>(Metric::SIZE)> metric_stats;
+  while (bag_reader.has_next()) {
+    const auto bag_message = bag_reader.read_next();
+    const rclcpp::SerializedMessage serialized_message(*bag_message->serialized_data);
+    if (bag_message->topic_name == odometry_topic) {
+      odometry_serialization.deserialize_message(&serialized_message, &odometry);
+      metrics_calculator.setEgoPose(odometry.pose.pose);
+      is_odometry_received = true;
+    } else if (bag_message->topic_name == reference_trajectory_topic) {
+      trajectory_serialization.deserialize_message(&serialized_message, &trajectory);
+      metrics_calculator.setReferenceTrajectory(trajectory);
+    } else if (bag_message->topic_name == objects_topic) {
+      objects_serialization.deserialize_message(&serialized_message, &objects);
+      metrics_calculator.setPredictedObjects(objects);
+    } else if (bag_message->topic_name == trajectory_topic && is_odometry_received) {
+      // same as PlanningEvaluatorNode::onTrajectory()
+      trajectory_serialization.deserialize_message(&serialized_message, &trajectory);
+      stamps.push_back(trajectory.header.stamp);
+      for (const Metric metric : metrics) {
+        const auto metric_stat = metrics_calculator.calculate(metric, trajectory);
+        metric_stats[static_cast<size_t>(metric)].push_back(
+          metric_stat ? *metric_stat : Stat<double>{});
+      }
+      metrics_calculator.setPreviousTrajectory(trajectory);
+    }
+  }
+  RCLCPP_INFO(
+    node->get_logger(), "Evaluated %zu trajectories of %s.", stamps.size(), bag_path.c_str());
+
+  // same format as the output_file of the planning_evaluator node
+  std::ofstream f(output_file);
+  f << std::fixed << std::left;
+  f << "#Stamp(ns)";
+  for (const Metric metric : metrics) {
+    f << " " << planning_diagnostics::metric_descriptions.at(metric);
+    f << " . .";
+  }
+  f << std::endl;
+  f << "#.";
+  for (size_t i = 0; i < metrics.size(); ++i) {
+    f << " min max mean";
+  }
+  f << std::endl;
+  for (size_t i = 0; i < stamps.size(); ++i) {
+    f << stamps[i].nanoseconds();
+    for (const Metric metric : metrics) {
+      f << " " << metric_stats[static_cast<size_t>(metric)][i];
+    }
+    f << std::endl;
+  }
+  f.close();
+
+  rclcpp::shutdown();
+  return 0;
+}
@@ -43,6 +43,8 @@ class PointcloudMapFilterPipeline:
             "map_update_distance_threshold"
         ]
         self.map_loader_radius = self.pointcloud_map_filter_param["map_loader_radius"]
+        self.map_prefetch_time = self.pointcloud_map_filter_param.get("map_prefetch_time", 0.0)
+        self.max_cached_map_cells = self.pointcloud_map_filter_param.get("max_cached_map_cells", 0)
         self.publish_debug_pcd = self.pointcloud_map_filter_param["publish_debug_pcd"]
         self.use_pointcloud_map = LaunchConfiguration("use_pointcloud_map").perform(context)
 
@@ -123,6 +125,8 @@ class PointcloudMapFilterPipeline:
                         "use_dynamic_map_loading": self.use_dynamic_map_loading,
                         "map_update_distance_threshold": self.map_update_distance_threshold,
                         "map_loader_radius": self.map_loader_radius,
+                        "map_prefetch_time": self.map_prefetch_time,
+                        "max_cached_map_cells": self.max_cached_map_cells,
                         "publish_debug_pcd": self.publish_debug_pcd,
                         "input_frame": "map",
                     }
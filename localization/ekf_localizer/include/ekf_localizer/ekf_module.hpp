@@ -16,9 +16,11 @@
 #define EKF_LOCALIZER__EKF_MODULE_HPP_
 
 #include "ekf_localizer/hyper_parameters.hpp"
+#include "ekf_localizer/matrix_types.hpp"
 #include "ekf_localizer/state_index.hpp"
 #include "ekf_localizer/warning.hpp"
 
+#include <kalman_filter/fixed_size_time_delay_kalman_filter.hpp>
 #include <kalman_filter/kalman_filter.hpp>
 #include <kalman_filter/time_delay_kalman_filter.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -91,7 +93,18 @@ public:
     const PoseWithCovariance & pose, const double delay_time);
 
 private:
-  TimeDelayKalmanFilter kalman_filter_;
+  // access to the filter selected by use_reference_delay_filter
+  void initFilter(const Vector6d & X, const Matrix6d & P);
+  double getXelement(const unsigned int i) const;
+  Vector6d getLatestX() const;
+  Matrix6d getLatestP() const;
+  template <int DimY>
+  void updateWithDelay(
+    const Eigen::MatrixXd & y, const Eigen::Matrix<double, DimY, 6> & C,
+    const Eigen::Matrix<double, DimY, DimY> & R, const int delay_step);
+
+  TimeDelayKalmanFilter kalman_filter_;  //!< @brief reference filter with the dense matrices
+  FixedSizeTimeDelayKalmanFilter<6> fixed_size_kalman_filter_;
 
   std::shared_ptr<Warning> warning_;
   const int dim_x_;
@@ -31,6 +31,7 @@ public:
     publish_tf_(node->declare_parameter<bool>("node.publish_tf")),
     enable_yaw_bias_estimation(node->declare_parameter<bool>("node.enable_yaw_bias_estimation")),
     extend_state_step(node->declare_parameter<int>("node.extend_state_step")),
+    use_reference_delay_filter(node->declare_parameter<bool>("node.use_reference_delay_filter")),
     pose_frame_id(node->declare_parameter<std::string>("misc.pose_frame_id")),
     pose_additional_delay(
       node->declare_parameter<double>("pose_measurement.pose_additional_delay")),
@@ -69,6 +70,7 @@ public:
   const bool publish_tf_;
   const bool enable_yaw_bias_estimation;
   const int extend_state_step;
+  const bool use_reference_delay_filter;
   const std::string pose_frame_id;
   const double pose_additional_delay;
   const double pose_gate_dist;
@@ -41,23 +41,23 @@ EKFModule::EKFModule(std::shared_ptr<Warning> warning, const HyperParameters par
   accumulated_delay_times_(params.extend_state_step, 1.0E15),
   params_(params)
 {
-  Eigen::MatrixXd X = Eigen::MatrixXd::Zero(dim_x_, 1);
-  Eigen::MatrixXd P = Eigen::MatrixXd::Identity(dim_x_, dim_x_) * 1.0E15;  // for x & y
-  P(IDX::YAW, IDX::YAW) = 50.0;                                            // for yaw
+  Vector6d X = Vector6d::Zero();
+  Matrix6d P = Matrix6d::Identity() * 1.0E15;  // for x & y
+  P(IDX::YAW, IDX::YAW) = 50.0;                // for yaw
   if (params_.enable_yaw_bias_estimation) {
     P(IDX::YAWB, IDX::YAWB) = 50.0;  // for yaw bias
   }
   P(IDX::VX, IDX::VX) = 1000.0;  // for vx
   P(IDX::WZ, IDX::WZ) = 50.0;    // for wz
 
-  kalman_filter_.init(X, P, params_.extend_state_step);
+  initFilter(X, P);
 }
 
 void EKFModule::initialize(
   const PoseWithCovariance & initial_pose, const geometry_msgs::msg::TransformStamped & transform)
 {
-  Eigen::MatrixXd X(dim_x_, 1);
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(dim_x_, dim_x_);
+  Vector6d X;
+  Matrix6d P = Matrix6d::Zero();
 
   X(IDX::X) = initial_pose.pose.pose.position.x + transform.transform.translation.x;
   X(IDX::Y) = initial_pose.pose.pose.position.y + transform.transform.translation.y;
@@ -78,22 +78,22 @@ void EKFModule::initialize(
   P(IDX::VX, IDX::VX) = 0.01;
   P(IDX::WZ, IDX::WZ) = 0.01;
 
-  kalman_filter_.init(X, P, params_.extend_state_step);
+  initFilter(X, P);
 }
 
 geometry_msgs::msg::PoseStamped EKFModule::getCurrentPose(
   const rclcpp::Time & current_time, const double z, const double roll, const double pitch,
   bool get_biased_yaw) const
 {
-  const double x = kalman_filter_.getXelement(IDX::X);
-  const double y = kalman_filter_.getXelement(IDX::Y);
+  const double x = getXelement(IDX::X);
+  const double y = getXelement(IDX::Y);
   /*
     getXelement(IDX::YAW) is surely `biased_yaw`.
     Please note how `yaw` and `yaw_bias` are used in the state transition model and
     how the observed pose is handled in the measurement pose update.
   */
-  const double biased_yaw = kalman_filter_.getXelement(IDX::YAW);
-  const double yaw_bias = kalman_filter_.getXelement(IDX::YAWB);
+  const double biased_yaw = getXelement(IDX::YAW);
+  const double yaw_bias = getXelement(IDX::YAWB);
   const double yaw = biased_yaw + yaw_bias;
 
   Pose current_ekf_pose;
@@ -112,8 +112,8 @@ geometry_msgs::msg::PoseStamped EKFModule::getCurrentPose(
 
 geometry_msgs::msg::TwistStamped EKFModule::getCurrentTwist(const rclcpp::Time & current_time) const
 {
-  const double vx = kalman_filter_.getXelement(IDX::VX);
-  const double wz = kalman_filter_.getXelement(IDX::WZ);
+  const double vx = getXelement(IDX::VX);
+  const double wz = getXelement(IDX::WZ);
 
   Twist current_ekf_twist;
   current_ekf_twist.header.frame_id = "base_link";
@@ -125,17 +125,17 @@ geometry_msgs::msg::TwistStamped EKFModule::getCurrentTwist(const rclcpp::Time &
 
 std::array<double, 36> EKFModule::getCurrentPoseCovariance() const
 {
-  return ekfCovarianceToPoseMessageCovariance(kalman_filter_.getLatestP());
+  return ekfCovarianceToPoseMessageCovariance(getLatestP());
 }
 
 std::array<double, 36> EKFModule::getCurrentTwistCovariance() const
 {
-  return ekfCovarianceToTwistMessageCovariance(kalman_filter_.getLatestP());
+  return ekfCovarianceToTwistMessageCovariance(getLatestP());
 }
 
 double EKFModule::getYawBias() const
 {
-  return kalman_filter_.getLatestX()(IDX::YAWB);
+  return getLatestX()(IDX::YAWB);
 }
 
 size_t EKFModule::find_closest_delay_time_index(double target_value) const
@@ -182,8 +182,8 @@ void EKFModule::accumulate_delay_time(const double dt)
 
 void EKFModule::predictWithDelay(const double dt)
 {
-  const Eigen::MatrixXd X_curr = kalman_filter_.getLatestX();
-  const Eigen::MatrixXd P_curr = kalman_filter_.getLatestP();
+  const Eigen::MatrixXd X_curr = getLatestX();
+  const Eigen::MatrixXd P_curr = getLatestP();
 
   const double proc_cov_vx_d = std::pow(params_.proc_stddev_vx_c * dt, 2.0);
   const double proc_cov_wz_d = std::pow(params_.proc_stddev_wz_c * dt, 2.0);
@@ -192,7 +192,11 @@ void EKFModule::predictWithDelay(const double dt)
   const Vector6d X_next = predictNextState(X_curr, dt);
   const Matrix6d A = createStateTransitionMatrix(X_curr, dt);
   const Matrix6d Q = processNoiseCovariance(proc_cov_yaw_d, proc_cov_vx_d, proc_cov_wz_d);
-  kalman_filter_.predictWithDelay(X_next, A, Q);
+  if (params_.use_reference_delay_filter) {
+    kalman_filter_.predictWithDelay(X_next, A, Q);
+  } else {
+    fixed_size_kalman_filter_.predictWithDelay(X_next, A, Q);
+  }
 }
 
 bool EKFModule::measurementUpdatePose(
@@ -205,7 +209,7 @@ bool EKFModule::measurementUpdatePose(
         pose.header.frame_id.c_str(), params_.pose_frame_id.c_str()),
       2000);
   }
-  const Eigen::MatrixXd X_curr = kalman_filter_.getLatestX();
+  const Eigen::MatrixXd X_curr = getLatestX();
   DEBUG_PRINT_MAT(X_curr.transpose());
 
   constexpr int dim_y = 3;  // pos_x, pos_y, yaw, depending on Pose output
@@ -234,7 +238,7 @@ bool EKFModule::measurementUpdatePose(
     offset the yaw angle so that the difference from the yaw angle that ekf holds internally is less
     than 2 pi. */
   double yaw = tf2::getYaw(pose.pose.pose.orientation);
-  const double ekf_yaw = kalman_filter_.getXelement(delay_step * dim_x_ + IDX::YAW);
+  const double ekf_yaw = getXelement(delay_step * dim_x_ + IDX::YAW);
   const double yaw_error = normalizeYaw(yaw - ekf_yaw);  // normalize the error not to exceed 2 pi
   yaw = yaw_error + ekf_yaw;
 
@@ -250,9 +254,9 @@ bool EKFModule::measurementUpdatePose(
 
   /* Gate */
   const Eigen::Vector3d y_ekf(
-    kalman_filter_.getXelement(delay_step * dim_x_ + IDX::X),
-    kalman_filter_.getXelement(delay_step * dim_x_ + IDX::Y), ekf_yaw);
-  const Eigen::MatrixXd P_curr = kalman_filter_.getLatestP();
+    getXelement(delay_step * dim_x_ + IDX::X),
+    getXelement(delay_step * dim_x_ + IDX::Y), ekf_yaw);
+  const Eigen::MatrixXd P_curr = getLatestP();
   const Eigen::MatrixXd P_y = P_curr.block(0, 0, dim_y, dim_y);
 
   const double distance = mahalanobis(y_ekf, y, P_y);
@@ -272,10 +276,10 @@ bool EKFModule::measurementUpdatePose(
   const Eigen::Matrix3d R =
     poseMeasurementCovariance(pose.pose.covariance, params_.pose_smoothing_steps);
 
-  kalman_filter_.updateWithDelay(y, C, R, delay_step);
+  updateWithDelay(y, C, R, delay_step);
 
   // debug
-  const Eigen::MatrixXd X_result = kalman_filter_.getLatestX();
+  const Eigen::MatrixXd X_result = getLatestX();
   DEBUG_PRINT_MAT(X_result.transpose());
   DEBUG_PRINT_MAT((X_result - X_curr).transpose());
 
@@ -286,7 +290,7 @@ geometry_msgs::msg::PoseWithCovarianceStamped EKFModule::compensatePoseWithZDela
   const PoseWithCovariance & pose, const double delay_time)
 {
   const auto rpy = tier4_autoware_utils::getRPY(pose.pose.pose.orientation);
-  const double dz_delay = kalman_filter_.getXelement(IDX::VX) * delay_time * std::sin(-rpy.y);
+  const double dz_delay = getXelement(IDX::VX) * delay_time * std::sin(-rpy.y);
   PoseWithCovariance pose_with_z_delay;
   pose_with_z_delay = pose;
   pose_with_z_delay.pose.pose.position.z += dz_delay;
@@ -301,7 +305,7 @@ bool EKFModule::measurementUpdateTwist(
     warning_->warnThrottle("twist frame_id must be base_link", 2000);
   }
 
-  const Eigen::MatrixXd X_curr = kalman_filter_.getLatestX();
+  const Eigen::MatrixXd X_curr = getLatestX();
   DEBUG_PRINT_MAT(X_curr.transpose());
 
   constexpr int dim_y = 2;  // vx, wz
@@ -337,9 +341,9 @@ bool EKFModule::measurementUpdateTwist(
   }
 
   const Eigen::Vector2d y_ekf(
-    kalman_filter_.getXelement(delay_step * dim_x_ + IDX::VX),
-    kalman_filter_.getXelement(delay_step * dim_x_ + IDX::WZ));
-  const Eigen::MatrixXd P_curr = kalman_filter_.getLatestP();
+    getXelement(delay_step * dim_x_ + IDX::VX),
+    getXelement(delay_step * dim_x_ + IDX::WZ));
+  const Eigen::MatrixXd P_curr = getLatestP();
   const Eigen::MatrixXd P_y = P_curr.block(4, 4, dim_y, dim_y);
 
   const double distance = mahalanobis(y_ekf, y, P_y);
@@ -359,12 +363,52 @@ bool EKFModule::measurementUpdateTwist(
   const Eigen::Matrix2d R =
     twistMeasurementCovariance(twist.twist.covariance, params_.twist_smoothing_steps);
 
-  kalman_filter_.updateWithDelay(y, C, R, delay_step);
+  updateWithDelay(y, C, R, delay_step);
 
   // debug
-  const Eigen::MatrixXd X_result = kalman_filter_.getLatestX();
+  const Eigen::MatrixXd X_result = getLatestX();
   DEBUG_PRINT_MAT(X_result.transpose());
   DEBUG_PRINT_MAT((X_result - X_curr).transpose());
 
   return true;
 }
+
+void EKFModule::initFilter(const Vector6d & X, const Matrix6d & P)
+{
+  if (params_.use_reference_delay_filter) {
+    kalman_filter_.init(X, P, params_.extend_state_step);
+  } else {
+    fixed_size_kalman_filter_.init(X, P, params_.extend_state_step);
+  }
+}
+
+double EKFModule::getXelement(const unsigned int i) const
+{
+  return params_.use_reference_delay_filter ? kalman_filter_.getXelement(i)
+                                            : fixed_size_kalman_filter_.getXelement(i);
+}
+
+Vector6d EKFModule::getLatestX() const
+{
+  return params_.use_reference_delay_filter ? Vector6d(kalman_filter_.getLatestX())
+                                            : fixed_size_kalman_filter_.getLatestX();
+}
+
+Matrix6d EKFModule::getLatestP() const
+{
+  return params_.use_reference_delay_filter ? Matrix6d(kalman_filter_.getLatestP())
+                                            : fixed_size_kalman_filter_.getLatestP();
+}
+
+template <int DimY>
+void EKFModule::updateWithDelay(
+  const Eigen::MatrixXd & y, const Eigen::Matrix<double, DimY, 6> & C,
+  const Eigen::Matrix<double, DimY, DimY> & R, const int delay_step)
+{
+  if (params_.use_reference_delay_filter) {
+    kalman_filter_.updateWithDelay(y, C, R, delay_step);
+  } else {
+    const Eigen::Matrix<double, DimY, 1> y_fixed = y;
+    fixed_size_kalman_filter_.updateWithDelay(y_fixed, C, R, delay_step);
+  }
+}
@@ -67,6 +67,7 @@ private:
     twist_with_covariance_pub_;
 
   std::shared_ptr<tier4_autoware_utils::TransformListener> transform_listener_;
+  geometry_msgs::msg::TransformStamped::ConstSharedPtr tf_imu2base_ptr_;
   std::unique_ptr<tier4_autoware_utils::LoggerLevelConfigure> logger_configure_;
 
   std::string output_frame_;
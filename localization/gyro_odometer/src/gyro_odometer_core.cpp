@@ -26,6 +26,7 @@
 #include <cmath>
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace autoware::gyro_odometer
 {
@@ -37,7 +38,8 @@ GyroOdometerNode::GyroOdometerNode(const rclcpp::NodeOptions & node_options)
   vehicle_twist_arrived_(false),
   imu_arrived_(false)
 {
-  transform_listener_ = std::make_shared<tier4_autoware_utils::TransformListener>(this);
+  // NOTE: The transform from the IMU frame is static, which is cached to skip the tf lookup.
+  transform_listener_ = std::make_shared<tier4_autoware_utils::TransformListener>(this, true);
   logger_configure_ = std::make_unique<tier4_autoware_utils::LoggerLevelConfigure>(this);
 
   vehicle_twist_sub_ = create_subscription<geometry_msgs::msg::TwistWithCovarianceStamped>(
@@ -200,8 +202,12 @@ void GyroOdometerNode::callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr i
     return;
   }
 
-  geometry_msgs::msg::TransformStamped::ConstSharedPtr tf_imu2base_ptr =
-    transform_listener_->getLatestTransform(imu_msg_ptr->header.frame_id, output_frame_);
+  // the imu is fixed on the vehicle, so its transform is looked up only for a new imu frame
+  if (!tf_imu2base_ptr_ || tf_imu2base_ptr_->header.frame_id != imu_msg_ptr->header.frame_id) {
+    tf_imu2base_ptr_ =
+      transform_listener_->getLatestTransform(imu_msg_ptr->header.frame_id, output_frame_);
+  }
+  const geometry_msgs::msg::TransformStamped::ConstSharedPtr tf_imu2base_ptr = tf_imu2base_ptr_;
   if (!tf_imu2base_ptr) {
     RCLCPP_ERROR(
       this->get_logger(), "Please publish TF %s to %s", output_frame_.c_str(),
@@ -250,30 +256,34 @@ void GyroOdometerNode::callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr i
 void GyroOdometerNode::publishData(
   const geometry_msgs::msg::TwistWithCovarianceStamped & twist_with_cov_raw)
 {
-  geometry_msgs::msg::TwistStamped twist_raw;
-  twist_raw.header = twist_with_cov_raw.header;
-  twist_raw.twist = twist_with_cov_raw.twist.twist;
-
-  twist_raw_pub_->publish(twist_raw);
-  twist_with_covariance_raw_pub_->publish(twist_with_cov_raw);
+  // the messages are published as unique_ptr, which are moved to the subscribers without copies
+  // when they are in the same process with intra-process communication
+  auto twist_raw = std::make_unique<geometry_msgs::msg::TwistStamped>();
+  twist_raw->header = twist_with_cov_raw.header;
+  twist_raw->twist = twist_with_cov_raw.twist.twist;
 
-  geometry_msgs::msg::TwistWithCovarianceStamped twist_with_covariance = twist_with_cov_raw;
-  geometry_msgs::msg::TwistStamped twist = twist_raw;
+  auto twist_with_covariance =
+    std::make_unique<geometry_msgs::msg::TwistWithCovarianceStamped>(twist_with_cov_raw);
+  auto twist = std::make_unique<geometry_msgs::msg::TwistStamped>(*twist_raw);
 
   // clear imu yaw bias if vehicle is stopped
   if (
     std::fabs(twist_with_cov_raw.twist.twist.angular.z) < 0.01 &&
     std::fabs(twist_with_cov_raw.twist.twist.linear.x) < 0.01) {
-    twist.twist.angular.x = 0.0;
-    twist.twist.angular.y = 0.0;
-    twist.twist.angular.z = 0.0;
-    twist_with_covariance.twist.twist.angular.x = 0.0;
-    twist_with_covariance.twist.twist.angular.y = 0.0;
-    twist_with_covariance.twist.twist.angular.z = 0.0;
+    twist->twist.angular.x = 0.0;
+    twist->twist.angular.y = 0.0;
+    twist->twist.angular.z = 0.0;
+    twist_with_covariance->twist.twist.angular.x = 0.0;
+    twist_with_covariance->twist.twist.angular.y = 0.0;
+    twist_with_covariance->twist.twist.angular.z = 0.0;
   }
 
-  twist_pub_->publish(twist);
-  twist_with_covariance_pub_->publish(twist_with_covariance);
+  twist_raw_pub_->publish(std::move(twist_raw));
+  twist_with_covariance_raw_pub_->publish(
+    std::make_unique<geometry_msgs::msg::TwistWithCovarianceStamped>(twist_with_cov_raw));
+
+  twist_pub_->publish(std::move(twist));
+  twist_with_covariance_pub_->publish(std::move(twist_with_covariance));
 }
 
 }  // namespace autoware::gyro_odometer
@@ -29,6 +29,8 @@ enum class ConvergedParamType {
   NEAREST_VOXEL_TRANSFORMATION_LIKELIHOOD = 1
 };
 
+enum class CovarianceEstimationType { MULTI_NDT = 0, LAPLACE_APPROXIMATION = 1 };
+
 struct HyperParameters
 {
   struct Frame
@@ -50,6 +52,7 @@ struct HyperParameters
   {
     int64_t particles_num;
     int64_t n_startup_trials;
+    int64_t parallel_trials_num;
   } initial_pose_estimation;
 
   struct Validation
@@ -79,7 +82,9 @@ struct HyperParameters
     struct CovarianceEstimation
     {
       bool enable;
+      CovarianceEstimationType covariance_estimation_type;
       std::vector<Eigen::Vector2d> initial_pose_offset_model;
+      double scale_factor;
     } covariance_estimation;
   } covariance;
 
@@ -88,6 +93,7 @@ struct HyperParameters
     double update_distance;
     double map_radius;
     double lidar_radius;
+    double prefetch_lookahead_time;
   } dynamic_map_loading;
 
 public:
@@ -114,6 +120,10 @@ public:
       node->declare_parameter<int64_t>("initial_pose_estimation.particles_num");
     initial_pose_estimation.n_startup_trials =
       node->declare_parameter<int64_t>("initial_pose_estimation.n_startup_trials");
+    initial_pose_estimation.parallel_trials_num =
+      node->declare_parameter<int64_t>("initial_pose_estimation.parallel_trials_num");
+    initial_pose_estimation.parallel_trials_num =
+      std::max(initial_pose_estimation.parallel_trials_num, static_cast<int64_t>(1));
 
     validation.lidar_topic_timeout_sec =
       node->declare_parameter<double>("validation.lidar_topic_timeout_sec");
@@ -146,6 +156,13 @@ public:
     covariance.covariance_estimation.enable =
       node->declare_parameter<bool>("covariance.covariance_estimation.enable");
     if (covariance.covariance_estimation.enable) {
+      const int64_t covariance_estimation_type_tmp = node->declare_parameter<int64_t>(
+        "covariance.covariance_estimation.covariance_estimation_type");
+      covariance.covariance_estimation.covariance_estimation_type =
+        static_cast<CovarianceEstimationType>(covariance_estimation_type_tmp);
+      covariance.covariance_estimation.scale_factor =
+        node->declare_parameter<double>("covariance.covariance_estimation.scale_factor");
+
       std::vector<double> initial_pose_offset_model_x =
         node->declare_parameter<std::vector<double>>(
           "covariance.covariance_estimation.initial_pose_offset_model_x");
@@ -177,6 +194,8 @@ public:
       node->declare_parameter<double>("dynamic_map_loading.map_radius");
     dynamic_map_loading.lidar_radius =
       node->declare_parameter<double>("dynamic_map_loading.lidar_radius");
+    dynamic_map_loading.prefetch_lookahead_time =
+      node->declare_parameter<double>("dynamic_map_loading.prefetch_lookahead_time");
   }
 };
 
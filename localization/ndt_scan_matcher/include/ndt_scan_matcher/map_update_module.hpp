@@ -59,6 +59,10 @@ private:
     const bool is_activated, const std::optional<geometry_msgs::msg::Point> & position,
     std::unique_ptr<DiagnosticsModule> & diagnostics_ptr);
 
+  // Predict the position to center the map loading at from the ego motion between the timer calls
+  geometry_msgs::msg::Point predict_prefetch_position(
+    const geometry_msgs::msg::Point & position,
+    std::unique_ptr<DiagnosticsModule> & diagnostics_ptr);
   [[nodiscard]] bool should_update_map(
     const geometry_msgs::msg::Point & position,
     std::unique_ptr<DiagnosticsModule> & diagnostics_ptr);
@@ -82,10 +86,13 @@ private:
   rclcpp::Clock::SharedPtr clock_;
 
   std::optional<geometry_msgs::msg::Point> last_update_position_ = std::nullopt;
+  std::optional<geometry_msgs::msg::Point> last_timer_position_ = std::nullopt;
+  rclcpp::Time last_timer_time_;
 
   HyperParameters::DynamicMapLoading param_;
 
-  // Indicate if there is a prefetch thread waiting for being collected
+  // The back buffer of ndt_ptr_. After a swap it holds the previous front buffer, which is
+  // brought up to date by the differential loading of its own map IDs instead of a deep copy.
   NdtPtrType secondary_ndt_ptr_;
   bool need_rebuild_;
 };
@@ -76,11 +76,49 @@ void MapUpdateModule::callback_timer(
     return;
   }
 
-  if (should_update_map(position.value(), diagnostics_ptr)) {
-    update_map(position.value(), diagnostics_ptr);
+  // should_update_map() decides need_rebuild_ first, which disables the prefetch
+  const bool should_update = should_update_map(position.value(), diagnostics_ptr);
+  const geometry_msgs::msg::Point prefetch_position =
+    predict_prefetch_position(position.value(), diagnostics_ptr);
+  if (should_update) {
+    update_map(prefetch_position, diagnostics_ptr);
   }
 }
 
+geometry_msgs::msg::Point MapUpdateModule::predict_prefetch_position(
+  const geometry_msgs::msg::Point & position, std::unique_ptr<DiagnosticsModule> & diagnostics_ptr)
+{
+  const rclcpp::Time now = clock_->now();
+  geometry_msgs::msg::Point prefetch_position = position;
+
+  if (last_timer_position_ != std::nullopt && !need_rebuild_) {
+    const double dt = (now - last_timer_time_).seconds();
+    if (dt > 0.0) {
+      const double scale = param_.prefetch_lookahead_time / dt;
+      double offset_x = (position.x - last_timer_position_.value().x) * scale;
+      double offset_y = (position.y - last_timer_position_.value().y) * scale;
+
+      // The current position must stay within update_distance from the loading center,
+      // otherwise the next timer call would update the map again.
+      const double offset = std::hypot(offset_x, offset_y);
+      if (offset > param_.update_distance) {
+        offset_x *= param_.update_distance / offset;
+        offset_y *= param_.update_distance / offset;
+      }
+      prefetch_position.x += offset_x;
+      prefetch_position.y += offset_y;
+    }
+  }
+
+  diagnostics_ptr->addKeyValue(
+    "prefetch_distance",
+    std::hypot(prefetch_position.x - position.x, prefetch_position.y - position.y));
+
+  last_timer_position_ = position;
+  last_timer_time_ = now;
+  return prefetch_position;
+}
+
 bool MapUpdateModule::should_update_map(
   const geometry_msgs::msg::Point & position, std::unique_ptr<DiagnosticsModule> & diagnostics_ptr)
 {
@@ -147,6 +185,10 @@ void MapUpdateModule::update_map(
       return;
     }
 
+    // The secondary NDT is copied only after a rebuild, and is updated differentially afterwards
+    secondary_ndt_ptr_.reset(new NdtType);
+    *secondary_ndt_ptr_ = *ndt_ptr_;
+
     ndt_ptr_mutex_->unlock();
     need_rebuild_ = false;
 
@@ -174,12 +216,11 @@ void MapUpdateModule::update_map(
     }
     ndt_ptr_mutex_->unlock();
 
-    dummy_ptr.reset();
+    // Reuse the previous NDT as the secondary one. It requests its own cached map IDs on the next
+    // update, so that only the cells loaded since its last update are built again.
+    secondary_ndt_ptr_ = dummy_ptr;
   }
 
-  secondary_ndt_ptr_.reset(new NdtType);
-  *secondary_ndt_ptr_ = *ndt_ptr_;
-
   // Memorize the position of the last update
   last_update_position_ = position;
 
@@ -244,12 +285,17 @@ bool MapUpdateModule::update_ndt(
   const auto exe_start_time = std::chrono::system_clock::now();
   // Perform heavy processing outside of the lock scope
 
-  // Add pcd
-  for (auto & map : maps_to_add) {
-    auto cloud = pcl::make_shared<pcl::PointCloud<PointTarget>>();
+  // Convert the new pcd in parallel, and add them in order since the NDT is not thread-safe
+  std::vector<pcl::shared_ptr<pcl::PointCloud<PointTarget>>> clouds(maps_to_add.size());
+#pragma omp parallel for
+  for (int i = 0; i < static_cast<int>(maps_to_add.size()); ++i) {
+    clouds[i] = pcl::make_shared<pcl::PointCloud<PointTarget>>();
+    pcl::fromROSMsg(maps_to_add[i].pointcloud, *clouds[i]);
+  }
 
-    pcl::fromROSMsg(map.pointcloud, *cloud);
-    ndt.addTarget(cloud, map.cell_id);
+  // Add pcd
+  for (size_t i = 0; i < maps_to_add.size(); ++i) {
+    ndt.addTarget(clouds[i], maps_to_add[i].cell_id);
   }
 
   // Remove pcd
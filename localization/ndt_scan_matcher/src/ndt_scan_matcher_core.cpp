@@ -776,9 +776,9 @@ std::array<double, 36> NDTScanMatcher::estimate_covariance(
   const rclcpp::Time & sensor_ros_time)
 {
   Eigen::Matrix2d rot = Eigen::Matrix2d::Identity();
+  const Eigen::Matrix2d hessian_inverse_xy = ndt_result.hessian.inverse().block(0, 0, 2, 2);
   try {
-    rot = find_rotation_matrix_aligning_covariance_to_principal_axes(
-      ndt_result.hessian.inverse().block(0, 0, 2, 2));
+    rot = find_rotation_matrix_aligning_covariance_to_principal_axes(hessian_inverse_xy);
   } catch (const std::exception & e) {
     std::stringstream message;
     message << "Error in Eigen solver: " << e.what();
@@ -787,6 +787,22 @@ std::array<double, 36> NDTScanMatcher::estimate_covariance(
     return param_.covariance.output_pose_covariance;
   }
 
+  // NOTE: The Laplace approximation takes the covariance from the Hessian of the main alignment,
+  //       so that no extra alignment is run on each scan unlike the multiple searches.
+  if (
+    param_.covariance.covariance_estimation.covariance_estimation_type ==
+    CovarianceEstimationType::LAPLACE_APPROXIMATION) {
+    const Eigen::Matrix2d laplace_covariance =
+      -hessian_inverse_xy * param_.covariance.covariance_estimation.scale_factor;
+
+    std::array<double, 36> ndt_covariance = param_.covariance.output_pose_covariance;
+    ndt_covariance[0 + 6 * 0] += laplace_covariance(0, 0);
+    ndt_covariance[1 + 6 * 0] += laplace_covariance(1, 0);
+    ndt_covariance[0 + 6 * 1] += laplace_covariance(0, 1);
+    ndt_covariance[1 + 6 * 1] += laplace_covariance(1, 1);
+    return ndt_covariance;
+  }
+
   // first result is added to mean
   const int n =
     static_cast<int>(param_.covariance.covariance_estimation.initial_pose_offset_model.size()) + 1;
@@ -1008,53 +1024,83 @@ geometry_msgs::msg::PoseWithCovarianceStamped NDTScanMatcher::align_pose(
   constexpr int64_t publish_num = 20;
   const int64_t publish_interval = param_.initial_pose_estimation.particles_num / publish_num;
 
-  for (int64_t i = 0; i < param_.initial_pose_estimation.particles_num; i++) {
-    const TreeStructuredParzenEstimator::Input input = tpe.get_next_input();
-
-    geometry_msgs::msg::Pose initial_pose;
-    initial_pose.position.x = input[0];
-    initial_pose.position.y = input[1];
-    initial_pose.position.z = input[2];
-    geometry_msgs::msg::Vector3 init_rpy;
-    init_rpy.x = input[3];
-    init_rpy.y = input[4];
-    init_rpy.z = input[5];
-    tf2::Quaternion tf_quaternion;
-    tf_quaternion.setRPY(init_rpy.x, init_rpy.y, init_rpy.z);
-    initial_pose.orientation = tf2::toMsg(tf_quaternion);
-
-    const Eigen::Matrix4f initial_pose_matrix = pose_to_matrix4f(initial_pose);
-    ndt_ptr_->align(*output_cloud, initial_pose_matrix);
-    const pclomp::NdtResult ndt_result = ndt_ptr_->getResult();
-
-    Particle particle(
-      initial_pose, matrix4f_to_pose(ndt_result.pose), ndt_result.transform_probability,
-      ndt_result.iteration_num);
-    particle_array.push_back(particle);
-    push_debug_markers(marker_array, get_clock()->now(), param_.frame.map_frame, particle, i);
-    if (
-      (i + 1) % publish_interval == 0 || (i + 1) == param_.initial_pose_estimation.particles_num) {
-      ndt_monte_carlo_initial_pose_marker_pub_->publish(marker_array);
-      marker_array.markers.clear();
+  // The NDT is not thread-safe, so each of the concurrent particles but the first one is aligned
+  // on its own copy of ndt_ptr_, which shares nothing with it. The copies are made once per call.
+  const int64_t parallel_trials_num = param_.initial_pose_estimation.parallel_trials_num;
+  std::vector<std::shared_ptr<NormalDistributionsTransform>> ndt_ptrs{ndt_ptr_};
+  for (int64_t j = 1; j < parallel_trials_num; j++) {
+    auto ndt_copy_ptr = std::make_shared<NormalDistributionsTransform>();
+    *ndt_copy_ptr = *ndt_ptr_;
+    ndt_ptrs.push_back(ndt_copy_ptr);
+  }
+  std::vector<std::shared_ptr<pcl::PointCloud<PointSource>>> output_clouds{output_cloud};
+  for (int64_t j = 1; j < parallel_trials_num; j++) {
+    output_clouds.push_back(std::make_shared<pcl::PointCloud<PointSource>>());
+  }
+
+  std::vector<geometry_msgs::msg::Pose> initial_poses(parallel_trials_num);
+  std::vector<pclomp::NdtResult> ndt_results(parallel_trials_num);
+  for (int64_t i = 0; i < param_.initial_pose_estimation.particles_num;) {
+    // The inputs of a batch are taken before any of its trials is added, since TPE is sequential
+    const int64_t batch_num =
+      std::min(parallel_trials_num, param_.initial_pose_estimation.particles_num - i);
+    for (int64_t j = 0; j < batch_num; j++) {
+      const TreeStructuredParzenEstimator::Input input = tpe.get_next_input();
+
+      geometry_msgs::msg::Pose & initial_pose = initial_poses[j];
+      initial_pose.position.x = input[0];
+      initial_pose.position.y = input[1];
+      initial_pose.position.z = input[2];
+      geometry_msgs::msg::Vector3 init_rpy;
+      init_rpy.x = input[3];
+      init_rpy.y = input[4];
+      init_rpy.z = input[5];
+      tf2::Quaternion tf_quaternion;
+      tf_quaternion.setRPY(init_rpy.x, init_rpy.y, init_rpy.z);
+      initial_pose.orientation = tf2::toMsg(tf_quaternion);
+    }
+
+#pragma omp parallel for num_threads(batch_num) if (batch_num > 1)
+    for (int64_t j = 0; j < batch_num; j++) {
+      const Eigen::Matrix4f initial_pose_matrix = pose_to_matrix4f(initial_poses[j]);
+      ndt_ptrs[j]->align(*output_clouds[j], initial_pose_matrix);
+      ndt_results[j] = ndt_ptrs[j]->getResult();
     }
 
-    const geometry_msgs::msg::Pose pose = matrix4f_to_pose(ndt_result.pose);
-    const geometry_msgs::msg::Vector3 rpy = get_rpy(pose);
-
-    TreeStructuredParzenEstimator::Input result(6);
-    result[0] = pose.position.x;
-    result[1] = pose.position.y;
-    result[2] = pose.position.z;
-    result[3] = rpy.x;
-    result[4] = rpy.y;
-    result[5] = rpy.z;
-    tpe.add_trial(TreeStructuredParzenEstimator::Trial{result, ndt_result.transform_probability});
-
-    auto sensor_points_in_map_ptr = std::make_shared<pcl::PointCloud<PointSource>>();
-    tier4_autoware_utils::transformPointCloud(
-      *ndt_ptr_->getInputSource(), *sensor_points_in_map_ptr, ndt_result.pose);
-    publish_point_cloud(
-      initial_pose_with_cov.header.stamp, param_.frame.map_frame, sensor_points_in_map_ptr);
+    for (int64_t j = 0; j < batch_num; j++, i++) {
+      const geometry_msgs::msg::Pose & initial_pose = initial_poses[j];
+      const pclomp::NdtResult & ndt_result = ndt_results[j];
+
+      Particle particle(
+        initial_pose, matrix4f_to_pose(ndt_result.pose), ndt_result.transform_probability,
+        ndt_result.iteration_num);
+      particle_array.push_back(particle);
+      push_debug_markers(marker_array, get_clock()->now(), param_.frame.map_frame, particle, i);
+      if (
+        (i + 1) % publish_interval == 0 ||
+        (i + 1) == param_.initial_pose_estimation.particles_num) {
+        ndt_monte_carlo_initial_pose_marker_pub_->publish(marker_array);
+        marker_array.markers.clear();
+      }
+
+      const geometry_msgs::msg::Pose pose = matrix4f_to_pose(ndt_result.pose);
+      const geometry_msgs::msg::Vector3 rpy = get_rpy(pose);
+
+      TreeStructuredParzenEstimator::Input result(6);
+      result[0] = pose.position.x;
+      result[1] = pose.position.y;
+      result[2] = pose.position.z;
+      result[3] = rpy.x;
+      result[4] = rpy.y;
+      result[5] = rpy.z;
+      tpe.add_trial(TreeStructuredParzenEstimator::Trial{result, ndt_result.transform_probability});
+
+      auto sensor_points_in_map_ptr = std::make_shared<pcl::PointCloud<PointSource>>();
+      tier4_autoware_utils::transformPointCloud(
+        *ndt_ptr_->getInputSource(), *sensor_points_in_map_ptr, ndt_result.pose);
+      publish_point_cloud(
+        initial_pose_with_cov.header.stamp, param_.frame.map_frame, sensor_points_in_map_ptr);
+    }
   }
 
   auto best_particle_ptr = std::max_element(
@@ -21,6 +21,9 @@
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -41,6 +44,68 @@ void upsample_line_string(
   }
 };
 
+// Centroids of the points in each voxel, same as pcl::VoxelGrid. The points are accumulated one
+// by one, so that neither the input points nor a dense index over the bounding box of the map are
+// kept. The latter overflows for large maps in pcl::VoxelGrid.
+class VoxelCentroids
+{
+public:
+  explicit VoxelCentroids(const float leaf_size) : inv_leaf_size_(1.0f / leaf_size) {}
+
+  void add(const Eigen::Vector3f & point)
+  {
+    const int64_t key = (voxel_index(point.x()) << 42) ^ (voxel_index(point.y()) << 21) ^
+                        voxel_index(point.z());
+    const auto [itr, inserted] = indices_.try_emplace(key, accumulators_.size());
+    if (inserted) accumulators_.emplace_back();
+    Accumulator & accumulator = accumulators_.at(itr->second);
+    accumulator.sum += point.cast<double>();
+    accumulator.count++;
+  }
+
+  // The centroids are ordered by the first point added to each voxel
+  pcl::PointCloud<pcl::PointXYZ>::Ptr cloud() const
+  {
+    auto cloud = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
+    cloud->reserve(accumulators_.size());
+    for (const Accumulator & accumulator : accumulators_) {
+      pcl::PointXYZ xyz;
+      xyz.getVector3fMap() = (accumulator.sum / accumulator.count).cast<float>();
+      cloud->push_back(xyz);
+    }
+    return cloud;
+  }
+
+private:
+  struct Accumulator
+  {
+    Eigen::Vector3d sum{Eigen::Vector3d::Zero()};
+    int count{0};
+  };
+
+  const float inv_leaf_size_;
+  std::unordered_map<int64_t, size_t> indices_;
+  std::vector<Accumulator> accumulators_;
+
+  // 21 bits for each axis, which covers +-1000 km with 1 m voxels
+  int64_t voxel_index(const float value) const
+  {
+    return static_cast<int64_t>(std::floor(value * inv_leaf_size_)) & ((int64_t{1} << 21) - 1);
+  }
+};
+
+void upsample_line_string(
+  const lanelet::ConstPoint3d & from, const lanelet::ConstPoint3d & to, VoxelCentroids & voxels)
+{
+  Eigen::Vector3f f(from.x(), from.y(), from.z());
+  Eigen::Vector3f t(to.x(), to.y(), to.z());
+  float length = (t - f).norm();
+  Eigen::Vector3f d = (t - f).normalized();
+  for (float l = 0; l < length; l += 0.5f) {
+    voxels.add(f + l * d);
+  }
+};
+
 std::vector<int> merge_indices(const std::vector<int> & indices1, const std::vector<int> & indices2)
 {
   std::unordered_set<int> set;
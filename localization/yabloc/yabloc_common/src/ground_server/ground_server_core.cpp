@@ -23,7 +23,6 @@
 
 #include <pcl/ModelCoefficients.h>
 #include <pcl/filters/crop_box.h>
-#include <pcl/filters/voxel_grid.h>
 #include <pcl/sample_consensus/method_types.h>
 #include <pcl/sample_consensus/model_types.h>
 #include <pcl/segmentation/sac_segmentation.h>
@@ -110,8 +109,9 @@ void GroundServer::on_map(const HADMapBin & msg)
     "zebra_marking",      "virtual",   "line_thin", "line_thick",
     "pedestrian_marking", "stop_line", "curbstone"};
 
-  pcl::PointCloud<pcl::PointXYZ>::Ptr upsampled_cloud =
-    pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
+  // NOTE: The upsampled points are downsampled into the voxels on the fly, instead of keeping the
+  //       whole upsampled cloud of the map.
+  VoxelCentroids voxels(1.0f);
 
   for (lanelet::LineString3d & line : lanelet_map->lineStringLayer) {
     if (!line.hasAttribute(lanelet::AttributeName::Type)) continue;
@@ -121,7 +121,7 @@ void GroundServer::on_map(const HADMapBin & msg)
 
     lanelet::ConstPoint3d const * from = nullptr;
     for (const lanelet::ConstPoint3d & p : line) {
-      if (from != nullptr) upsample_line_string(*from, p, upsampled_cloud);
+      if (from != nullptr) upsample_line_string(*from, p, voxels);
       from = &p;
     }
   }
@@ -132,12 +132,7 @@ void GroundServer::on_map(const HADMapBin & msg)
   // if(lanelet_map->polygonLayer.size() > 0)
   //   *upsampled_cloud += sample_from_polygons(lanelet_map->polygonLayer);
 
-  cloud_ = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
-  // Voxel
-  pcl::VoxelGrid<pcl::PointXYZ> filter;
-  filter.setInputCloud(upsampled_cloud);
-  filter.setLeafSize(1.0f, 1.0f, 1.0f);
-  filter.filter(*cloud_);
+  cloud_ = voxels.cloud();
 
   kdtree_ = pcl::make_shared<pcl::KdTreeFLANN<pcl::PointXYZ>>();
   kdtree_->setInputCloud(cloud_);
@@ -106,36 +106,43 @@ void GraphSegment::on_image(const Image & msg)
     road_keys = similar_area_searcher_->search(resized, segmented, target_class);
   }
 
-  // Draw output image and debug image
+  // Draw output image
   cv::Mat output_image = cv::Mat::zeros(resized.size(), CV_8UC1);
-  cv::Mat debug_image = cv::Mat::zeros(resized.size(), CV_8UC3);
   for (int h = 0; h < resized.rows; h++) {
     // NOTE: Accessing through ptr() is faster than at()
-    cv::Vec3b * const debug_image_ptr = debug_image.ptr<cv::Vec3b>(h);
     uchar * const output_image_ptr = output_image.ptr<uchar>(h);
     const int * const segmented_image_ptr = segmented.ptr<int>(h);
-
     for (int w = 0; w < resized.cols; w++) {
-      cv::Point2i px(w, h);
-      const int key = segmented_image_ptr[w];
-      if (road_keys.count(key) > 0) {
-        output_image_ptr[w] = 255;
-        if (key == target_class)
-          debug_image_ptr[w] = cv::Vec3b(30, 255, 255);
-        else
-          debug_image_ptr[w] = cv::Vec3b(10, 255, 255);
-      } else {
-        debug_image_ptr[w] = random_hsv(key);
-      }
+      if (road_keys.count(segmented_image_ptr[w]) > 0) output_image_ptr[w] = 255;
     }
   }
-  cv::cvtColor(debug_image, debug_image, cv::COLOR_HSV2BGR);
   cv::resize(output_image, output_image, image.size(), 0, 0, cv::INTER_NEAREST);
-  cv::resize(debug_image, debug_image, image.size(), 0, 0, cv::INTER_NEAREST);
 
   common::publish_image(*pub_mask_image_, output_image, msg.header.stamp);
 
-  draw_and_publish_image(image, debug_image, msg.header.stamp);
+  // NOTE: The debug image is drawn only when someone subscribes it
+  if (pub_debug_image_->get_subscription_count() > 0) {
+    cv::Mat debug_image = cv::Mat::zeros(resized.size(), CV_8UC3);
+    for (int h = 0; h < resized.rows; h++) {
+      cv::Vec3b * const debug_image_ptr = debug_image.ptr<cv::Vec3b>(h);
+      const int * const segmented_image_ptr = segmented.ptr<int>(h);
+
+      for (int w = 0; w < resized.cols; w++) {
+        const int key = segmented_image_ptr[w];
+        if (road_keys.count(key) > 0) {
+          if (key == target_class)
+            debug_image_ptr[w] = cv::Vec3b(30, 255, 255);
+          else
+            debug_image_ptr[w] = cv::Vec3b(10, 255, 255);
+        } else {
+          debug_image_ptr[w] = random_hsv(key);
+        }
+      }
+    }
+    cv::cvtColor(debug_image, debug_image, cv::COLOR_HSV2BGR);
+    cv::resize(debug_image, debug_image, image.size(), 0, 0, cv::INTER_NEAREST);
+    draw_and_publish_image(image, debug_image, msg.header.stamp);
+  }
   RCLCPP_INFO_STREAM(get_logger(), "total processing time: " << stop_watch.toc() * 1000 << "[ms]");
 }
 
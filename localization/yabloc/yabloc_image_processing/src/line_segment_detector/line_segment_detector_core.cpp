@@ -54,14 +54,17 @@ void LineSegmentDetector::execute(const cv::Mat & image, const rclcpp::Time & st
   {
     tier4_autoware_utils::StopWatch stop_watch;
     line_segment_detector_->detect(gray_image, lines);
+    RCLCPP_INFO_STREAM(this->get_logger(), "lsd: " << stop_watch.toc() << "[ms]");
+  }
+
+  // NOTE: The debug image is drawn only when someone subscribes it
+  if (pub_image_with_line_segments_->get_subscription_count() > 0) {
     if (lines.size().width != 0) {
       line_segment_detector_->drawSegments(gray_image, lines);
     }
-    RCLCPP_INFO_STREAM(this->get_logger(), "lsd: " << stop_watch.toc() << "[ms]");
+    common::publish_image(*pub_image_with_line_segments_, gray_image, stamp);
   }
 
-  common::publish_image(*pub_image_with_line_segments_, gray_image, stamp);
-
   pcl::PointCloud<pcl::PointNormal> line_cloud;
   std::vector<cv::Mat> filtered_lines = remove_too_outer_elements(lines, image.size());
 
@@ -28,6 +28,11 @@
 
 #include <optional>
 
+#ifdef YABLOC_USE_OPENCV_CUDA
+#include <opencv4/opencv2/core/cuda.hpp>
+#include <opencv4/opencv2/cudawarping.hpp>
+#endif
+
 namespace yabloc::undistort
 {
 class UndistortNode : public rclcpp::Node
@@ -40,10 +45,18 @@ public:
   UndistortNode()
   : Node("undistort"),
     OUTPUT_WIDTH(declare_parameter<int>("width")),
-    OVERRIDE_FRAME_ID(declare_parameter<std::string>("override_frame_id"))
+    OVERRIDE_FRAME_ID(declare_parameter<std::string>("override_frame_id")),
+    use_cuda_(declare_parameter<bool>("use_cuda"))
   {
     using std::placeholders::_1;
 
+#ifndef YABLOC_USE_OPENCV_CUDA
+    if (use_cuda_) {
+      RCLCPP_WARN_STREAM(get_logger(), "OpenCV is built without CUDA. use_cuda is ignored.");
+      use_cuda_ = false;
+    }
+#endif
+
     rclcpp::QoS qos{10};
     if (declare_parameter<bool>("use_sensor_qos")) {
       qos = rclcpp::QoS(10).durability_volatile().best_effort();
@@ -65,6 +78,7 @@ public:
 private:
   const int OUTPUT_WIDTH;
   const std::string OVERRIDE_FRAME_ID;
+  bool use_cuda_;
 
   rclcpp::Subscription<Image>::SharedPtr sub_image_;
   rclcpp::Subscription<CompressedImage>::SharedPtr sub_compressed_image_;
@@ -75,6 +89,11 @@ private:
   std::optional<CameraInfo> scaled_info_{std::nullopt};
 
   cv::Mat undistort_map_x, undistort_map_y;
+#ifdef YABLOC_USE_OPENCV_CUDA
+  // NOTE: The maps are uploaded once and the device buffers are reused for every image
+  cv::cuda::GpuMat gpu_map_x_, gpu_map_y_;
+  cv::cuda::GpuMat gpu_image_, gpu_undistorted_image_;
+#endif
 
   void make_remap_lut()
   {
@@ -91,6 +110,12 @@ private:
 
     cv::initUndistortRectifyMap(
       K, D, cv::Mat(), new_K, new_size, CV_32FC1, undistort_map_x, undistort_map_y);
+#ifdef YABLOC_USE_OPENCV_CUDA
+    if (use_cuda_) {
+      gpu_map_x_.upload(undistort_map_x);
+      gpu_map_y_.upload(undistort_map_y);
+    }
+#endif
 
     scaled_info_ = sensor_msgs::msg::CameraInfo{};
     scaled_info_->k.at(0) = new_K.at<double>(0, 0);
@@ -106,7 +131,18 @@ private:
   void remap_and_publish(const cv::Mat & image, const std_msgs::msg::Header & header)
   {
     cv::Mat undistorted_image;
+#ifdef YABLOC_USE_OPENCV_CUDA
+    if (use_cuda_) {
+      gpu_image_.upload(image);
+      cv::cuda::remap(
+        gpu_image_, gpu_undistorted_image_, gpu_map_x_, gpu_map_y_, cv::INTER_LINEAR);
+      gpu_undistorted_image_.download(undistorted_image);
+    } else {
+      cv::remap(image, undistorted_image, undistort_map_x, undistort_map_y, cv::INTER_LINEAR);
+    }
+#else
     cv::remap(image, undistorted_image, undistort_map_x, undistort_map_y, cv::INTER_LINEAR);
+#endif
 
     // Publish CameraInfo
     {
@@ -0,0 +1,151 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// compares the per-particle compute_logit() and the batched compute_logits() of
+// camera_particle_corrector on a synthetic road of parallel lane lines
+
+#include "yabloc_particle_filter/camera_corrector/logit_evaluator.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+#include <yabloc_common/transform_line_segments.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace mpf = yabloc::modularized_particle_filter;
+
+namespace
+{
+constexpr float far_weight_gain = 0.001f;
+
+pcl::PointCloud<pcl::PointNormal> create_lane_lines()
+{
+  pcl::PointCloud<pcl::PointNormal> cloud;
+  for (float y = -7.f; y <= 7.f; y += 3.5f) {
+    for (float x = -100.f; x < 100.f; x += 10.f) {
+      pcl::PointNormal pn;
+      pn.getVector3fMap() << x, y, 0.f;
+      pn.getNormalVector3fMap() << x + 10.f, y, 0.f;
+      cloud.push_back(pn);
+    }
+  }
+  return cloud;
+}
+
+// line segments detected on the lane lines around the ego
+mpf::LineSegments create_line_segments(std::mt19937 & engine, const uint32_t label)
+{
+  std::uniform_real_distribution<float> x_dist(-10.f, 20.f);
+  std::normal_distribution<float> noise(0.f, 0.1f);
+  mpf::LineSegments cloud;
+  for (float y = -7.f; y <= 7.f; y += 3.5f) {
+    for (int i = 0; i < 20; ++i) {
+      const float x = x_dist(engine);
+      mpf::LineSegment line;
+      line.getVector3fMap() << x, y + noise(engine), 0.f;
+      line.getNormalVector3fMap() << x + 2.f, y + noise(engine), 0.f;
+      line.label = label;
+      cloud.push_back(line);
+    }
+  }
+  return cloud;
+}
+}  // namespace
+
+int main(int argc, char * argv[])
+{
+  const int particles_num = argc > 1 ? std::atoi(argv[1]) : 2000;
+  const int cycles_num = argc > 2 ? std::atoi(argv[2]) : 10;
+
+  rclcpp::init(argc, argv);
+  rclcpp::NodeOptions options;
+  options.append_parameter_override("max_range", 40.0f);
+  options.append_parameter_override("image_size", 800);
+  options.append_parameter_override("gamma", 5.0f);
+  options.append_parameter_override("max_map_count", 10);
+  options.append_parameter_override("prefetch_time", 3.0f);
+  auto node = std::make_shared<rclcpp::Node>("logit_evaluator_benchmark", options);
+  yabloc::HierarchicalCostMap cost_map(node.get());
+  cost_map.set_cloud(create_lane_lines());
+
+  std::mt19937 engine(0);
+  const mpf::LineSegments reliable_cloud = create_line_segments(engine, 1);
+  const mpf::LineSegments iffy_cloud = create_line_segments(engine, 0);
+
+  std::normal_distribution<float> position_noise(0.f, 1.f);
+  std::normal_distribution<float> yaw_noise(0.f, 0.05f);
+  std::vector<Sophus::SE3f> transforms;
+  for (int i = 0; i < particles_num; ++i) {
+    transforms.emplace_back(
+      Sophus::SO3f::rotZ(yaw_noise(engine)),
+      Eigen::Vector3f(position_noise(engine), position_noise(engine), 0.f));
+  }
+
+  mpf::LineSegmentSamples samples;
+  samples.add(reliable_cloud);
+  samples.add(iffy_cloud);
+
+  // the maps are built in the background, so wait for them before the measurement
+  mpf::compute_logits(samples, transforms, far_weight_gain, cost_map);
+  if (!cost_map.wait_for_requested_maps(std::chrono::seconds(30))) {
+    std::cerr << "cost maps are not built in time" << std::endl;
+    return 1;
+  }
+
+  std::vector<float> reference_logits(particles_num);
+  const auto reference_start = std::chrono::steady_clock::now();
+  for (int cycle = 0; cycle < cycles_num; ++cycle) {
+    for (int i = 0; i < particles_num; ++i) {
+      mpf::LineSegments transformed =
+        yabloc::common::transform_line_segments(reliable_cloud, transforms[i]);
+      transformed += yabloc::common::transform_line_segments(iffy_cloud, transforms[i]);
+      reference_logits[i] =
+        mpf::compute_logit(transformed, transforms[i].translation(), far_weight_gain, cost_map);
+    }
+  }
+  const auto reference_end = std::chrono::steady_clock::now();
+
+  std::vector<float> logits;
+  const auto batch_start = std::chrono::steady_clock::now();
+  for (int cycle = 0; cycle < cycles_num; ++cycle) {
+    mpf::LineSegmentSamples cycle_samples;
+    cycle_samples.add(reliable_cloud);
+    cycle_samples.add(iffy_cloud);
+    logits = mpf::compute_logits(cycle_samples, transforms, far_weight_gain, cost_map);
+  }
+  const auto batch_end = std::chrono::steady_clock::now();
+
+  float max_difference = 0.f;
+  for (int i = 0; i < particles_num; ++i) {
+    max_difference = std::max(max_difference, std::abs(logits[i] - reference_logits[i]));
+  }
+
+  const auto ms = [](auto start, auto end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+  };
+  std::cout << particles_num << " particles x " << cycles_num << " cycles" << std::endl;
+  std::cout << "compute_logit:  " << ms(reference_start, reference_end) / cycles_num
+            << " [ms/cycle]" << std::endl;
+  std::cout << "compute_logits: " << ms(batch_start, batch_end) / cycles_num << " [ms/cycle]"
+            << std::endl;
+  std::cout << "max logit difference: " << max_difference << std::endl;
+
+  rclcpp::shutdown();
+  return 0;
+}
@@ -16,6 +16,7 @@
 #define YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__CAMERA_PARTICLE_CORRECTOR_HPP_
 
 #include <opencv4/opencv2/core.hpp>
+#include <yabloc_particle_filter/camera_corrector/logit_evaluator.hpp>
 #include <yabloc_particle_filter/correction/abstract_corrector.hpp>
 #include <yabloc_particle_filter/ll2_cost_map/hierarchical_cost_map.hpp>
 
@@ -34,7 +35,6 @@
 namespace yabloc::modularized_particle_filter
 {
 cv::Point2f cv2pt(const Eigen::Vector3f v);
-float abs_cos(const Eigen::Vector3f & t, float deg);
 
 class CameraParticleCorrector : public modularized_particle_filter::AbstractCorrector
 {
@@ -71,6 +71,8 @@ private:
   rclcpp::Publisher<String>::SharedPtr pub_string_;
 
   Eigen::Vector3f last_mean_position_;
+  Eigen::Vector2f last_prefetch_position_;
+  std::optional<rclcpp::Time> last_prefetch_stamp_{std::nullopt};
   std::optional<PoseStamped> latest_pose_{std::nullopt};
   std::function<float(float)> score_converter_;
 
@@ -85,9 +87,6 @@ private:
 
   std::pair<LineSegments, LineSegments> split_line_segments(const PointCloud2 & msg);
 
-  float compute_logit(
-    const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position);
-
   pcl::PointCloud<pcl::PointXYZI> evaluate_cloud(
     const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position);
 
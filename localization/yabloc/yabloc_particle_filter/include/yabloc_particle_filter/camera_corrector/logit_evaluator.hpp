@@ -0,0 +1,70 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__LOGIT_EVALUATOR_HPP_
+#define YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__LOGIT_EVALUATOR_HPP_
+
+#include <Eigen/Core>
+#include <sophus/se3.hpp>
+#include <yabloc_particle_filter/ll2_cost_map/hierarchical_cost_map.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <vector>
+
+namespace yabloc::modularized_particle_filter
+{
+using LineSegment = pcl::PointXYZLNormal;
+using LineSegments = pcl::PointCloud<LineSegment>;
+
+float abs_cos(const Eigen::Vector3f & t, float deg);
+
+/**
+ * Points sampled every 0.1 m on the line segments in the base_link frame
+ * They are kept in SoA form, so that they can be transformed for all particles in simple loops.
+ */
+struct LineSegmentSamples
+{
+  void add(const LineSegments & line_segments_cloud);
+  size_t size() const { return x.size(); }
+
+  std::vector<float> x, y, z;
+  std::vector<float> tangent_x, tangent_y, tangent_z;  // unit direction of the line segment
+  std::vector<float> weight;  // 1 for apriori, 0.2 for posteriori (label == 0)
+};
+
+/**
+ * Compute the logit of a particle from the line segments transformed by its pose
+ * This is the reference of compute_logits().
+ */
+float compute_logit(
+  const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position,
+  const float far_weight_gain, HierarchicalCostMap & cost_map);
+
+/**
+ * Compute the logits of all particles at once
+ * The areas of the cost map touched by any particle are built first, then the samples are
+ * transformed and looked up for the particles in parallel.
+ *
+ * @param[in] samples Line segment samples in the base_link frame
+ * @param[in] transforms Poses of the particles
+ * @return The logit of each particle
+ */
+std::vector<float> compute_logits(
+  const LineSegmentSamples & samples, const std::vector<Sophus::SE3f> & transforms,
+  const float far_weight_gain, HierarchicalCostMap & cost_map);
+}  // namespace yabloc::modularized_particle_filter
+
+#endif  // YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__LOGIT_EVALUATOR_HPP_
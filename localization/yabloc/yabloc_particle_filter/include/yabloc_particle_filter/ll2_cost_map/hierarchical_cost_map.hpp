@@ -29,8 +29,16 @@
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
-#include <list>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace yabloc
@@ -102,46 +110,132 @@ public:
   using BgPolygon = boost::geometry::model::polygon<BgPoint>;
 
   explicit HierarchicalCostMap(rclcpp::Node * node);
+  ~HierarchicalCostMap();
+
+  HierarchicalCostMap(const HierarchicalCostMap &) = delete;
+  HierarchicalCostMap & operator=(const HierarchicalCostMap &) = delete;
 
   void set_cloud(const pcl::PointCloud<pcl::PointNormal> & cloud);
   void set_bounding_box(const pcl::PointCloud<pcl::PointXYZL> & cloud);
 
   /**
    * Get pixel value at specified pixel
+   * If the map of the area has not been built yet, its build is requested and the pixel is
+   * treated as unmapped until it is done.
    *
    * @param[in] position Real scale position at world frame
    * @return The combination of intensity (0-1), angle (0-180), unmapped flag (0, 1)
    */
   CostMapValue at(const Eigen::Vector2f & position);
 
+  /**
+   * Request the maps of the areas which have not been built yet before they are looked up by
+   * gather()
+   *
+   * @param[in] areas Areas which will be looked up
+   */
+  void prepare(const std::vector<Area> & areas);
+
+  /**
+   * Get pixel values at specified positions as at() does, reusing the map of the last area for
+   * the following positions in the same area
+   * This does not request any map and can be called concurrently.
+   *
+   * @param[in] xs Real scale x of the positions at world frame
+   * @param[in] ys Real scale y of the positions at world frame
+   * @param[out] values The pixel values at the positions
+   */
+  void gather(
+    const std::vector<float> & xs, const std::vector<float> & ys,
+    std::vector<CostMapValue> & values) const;
+
+  /**
+   * Request the maps around the position and around where the ego will be after prefetch_time
+   *
+   * @param[in] position Real scale position of the ego at world frame
+   * @param[in] velocity Velocity of the ego at world frame
+   */
+  void prefetch(const Eigen::Vector2f & position, const Eigen::Vector2f & velocity);
+
+  /**
+   * Wait until all the requested maps are built
+   *
+   * @return false if the maps are still being built after the timeout
+   */
+  bool wait_for_requested_maps(const std::chrono::milliseconds & timeout);
+
   MarkerArray show_map_range() const;
 
   cv::Mat get_map_image(const Pose & pose);
 
+  /**
+   * Start a new access cycle
+   * The maps which have not been accessed for the most cycles are evicted first when the number
+   * of the maps exceeds max_map_count.
+   */
   void erase_obsolete();
 
   void set_height(float height);
 
 private:
+  struct CostMapTile
+  {
+    explicit CostMapTile(const cv::Mat & image, const uint64_t access_cycle)
+    : image(image), last_access_cycle(access_cycle)
+    {
+    }
+    const cv::Mat image;
+    mutable std::atomic<uint64_t> last_access_cycle;
+  };
+  using CostMapTiles = std::unordered_map<Area, std::shared_ptr<const CostMapTile>, Area>;
+
+  // what the maps are built from, copied by the builder for each map
+  struct MapSource
+  {
+    std::shared_ptr<const pcl::PointCloud<pcl::PointNormal>> cloud{nullptr};
+    std::shared_ptr<const std::vector<BgPolygon>> bounding_boxes{
+      std::make_shared<const std::vector<BgPolygon>>()};
+    std::optional<float> height{std::nullopt};
+  };
+
   const float max_range_;
   const float image_size_;
   const size_t max_map_count_;
+  const float prefetch_time_;
   rclcpp::Logger logger_;
-  std::optional<float> height_{std::nullopt};
 
   common::GammaConverter gamma_converter{4.0f};
 
-  std::unordered_map<Area, bool, Area> map_accessed_;
+  // The readers take a snapshot of the tiles and never wait for the builder, which replaces the
+  // whole table when it adds or evicts a map.
+  std::shared_ptr<const CostMapTiles> tiles_;
+  std::atomic<uint64_t> access_cycle_{0};
+
+  // guarded by mutex_
+  std::mutex mutex_;
+  std::condition_variable request_cv_;
+  std::condition_variable built_cv_;
+  MapSource source_;
+  std::deque<Area> requested_areas_;
+  std::unordered_set<Area, Area> pending_areas_;
+  uint64_t generation_{0};  // incremented when the maps are cleared
+  bool is_building_{false};
+  bool is_stopped_{false};
 
-  std::list<Area> generated_map_history_;
-  std::optional<pcl::PointCloud<pcl::PointNormal>> cloud_;
-  std::vector<BgPolygon> bounding_boxes_;
-  std::unordered_map<Area, cv::Mat, Area> cost_maps_;
+  std::thread builder_thread_;
 
   cv::Point to_cv_point(const Area & are, const Eigen::Vector2f) const;
-  void build_map(const Area & area);
+  CostMapValue value_at(
+    const CostMapTile & tile, const Area & area, const Eigen::Vector2f & position) const;
+
+  // request() must be called with mutex_ locked
+  void request(const Area & area, const bool is_urgent);
+  void run_builder();
+  void evict_least_recently_used(CostMapTiles & tiles, const Area & new_area) const;
 
-  cv::Mat create_available_area_image(const Area & area) const;
+  cv::Mat build_map(const Area & area, const MapSource & source) const;
+  cv::Mat create_available_area_image(
+    const Area & area, const std::vector<BgPolygon> & bounding_boxes) const;
 };
 }  // namespace yabloc
 
@@ -16,7 +16,6 @@
 #include "yabloc_particle_filter/camera_corrector/logit.hpp"
 
 #include <opencv4/opencv2/imgproc.hpp>
-#include <tier4_autoware_utils/math/trigonometry.hpp>
 #include <tier4_autoware_utils/system/stop_watch.hpp>
 #include <yabloc_common/color.hpp>
 #include <yabloc_common/pose_conversions.hpp>
@@ -163,18 +162,34 @@ void CameraParticleCorrector::on_line_segments(const PointCloud2 & line_segments
   }
 
   cost_map_.set_height(mean_pose.position.z);
+  {
+    // Build the cost maps ahead of the ego in the background
+    const Eigen::Vector2f position(mean_pose.position.x, mean_pose.position.y);
+    Eigen::Vector2f velocity = Eigen::Vector2f::Zero();
+    if (last_prefetch_stamp_.has_value()) {
+      const double elapsed = (stamp - last_prefetch_stamp_.value()).seconds();
+      if (elapsed > 0) velocity = (position - last_prefetch_position_) / elapsed;
+    }
+    last_prefetch_stamp_ = stamp;
+    last_prefetch_position_ = position;
+    cost_map_.prefetch(position, velocity);
+  }
 
   if (publish_weighted_particles) {
-    for (auto & particle : weighted_particles.particles) {
-      Sophus::SE3f transform = common::pose_to_se3(particle.pose);
-      LineSegments transformed_line_segments =
-        common::transform_line_segments(line_segments_cloud, transform);
-      LineSegments transformed_iffy_line_segments =
-        common::transform_line_segments(iffy_line_segments_cloud, transform);
-      transformed_line_segments += transformed_iffy_line_segments;
-
-      float logit = compute_logit(transformed_line_segments, transform.translation());
-      particle.weight = logit_to_prob(logit, 0.01f);
+    LineSegmentSamples samples;
+    samples.add(line_segments_cloud);
+    samples.add(iffy_line_segments_cloud);
+
+    std::vector<Sophus::SE3f> transforms;
+    transforms.reserve(weighted_particles.particles.size());
+    for (const auto & particle : weighted_particles.particles) {
+      transforms.push_back(common::pose_to_se3(particle.pose));
+    }
+
+    const std::vector<float> logits =
+      compute_logits(samples, transforms, far_weight_gain_, cost_map_);
+    for (size_t i = 0; i < logits.size(); ++i) {
+      weighted_particles.particles.at(i).weight = logit_to_prob(logits.at(i), 0.01f);
     }
 
     if (enable_switch_) {
@@ -254,46 +269,6 @@ void CameraParticleCorrector::on_ll2(const PointCloud2 & ll2_msg)
   RCLCPP_INFO_STREAM(get_logger(), "Set LL2 cloud into Hierarchical cost map");
 }
 
-float abs_cos(const Eigen::Vector3f & t, float deg)
-{
-  const float radian = deg * M_PI / 180.0;
-  Eigen::Vector2f x(t.x(), t.y());
-  Eigen::Vector2f y(tier4_autoware_utils::cos(radian), tier4_autoware_utils::sin(radian));
-  x.normalize();
-  return std::abs(x.dot(y));
-}
-
-float CameraParticleCorrector::compute_logit(
-  const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position)
-{
-  float logit = 0;
-  for (const LineSegment & pn : line_segments_cloud) {
-    const Eigen::Vector3f tangent = (pn.getNormalVector3fMap() - pn.getVector3fMap()).normalized();
-    const float length = (pn.getVector3fMap() - pn.getNormalVector3fMap()).norm();
-
-    for (float distance = 0; distance < length; distance += 0.1f) {
-      Eigen::Vector3f p = pn.getVector3fMap() + tangent * distance;
-
-      // NOTE: Close points are prioritized
-      float squared_norm = (p - self_position).topRows(2).squaredNorm();
-      float gain = exp(-far_weight_gain_ * squared_norm);  // 0 < gain < 1
-
-      const CostMapValue v3 = cost_map_.at(p.topRows(2));
-
-      if (v3.unmapped) {
-        // logit does not change if target pixel is unmapped
-        continue;
-      }
-      if (pn.label == 0) {  // posteriori
-        logit += 0.2f * gain * (abs_cos(tangent, v3.angle) * v3.intensity - 0.5f);
-      } else {  // apriori
-        logit += gain * (abs_cos(tangent, v3.angle) * v3.intensity - 0.5f);
-      }
-    }
-  }
-  return logit;
-}
-
 pcl::PointCloud<pcl::PointXYZI> CameraParticleCorrector::evaluate_cloud(
   const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position)
 {
@@ -0,0 +1,199 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "yabloc_particle_filter/camera_corrector/logit_evaluator.hpp"
+
+#include <tier4_autoware_utils/math/trigonometry.hpp>
+
+#include <array>
+#include <cmath>
+#include <optional>
+#include <unordered_set>
+
+namespace yabloc::modularized_particle_filter
+{
+namespace
+{
+// direction of each angle (0~180 deg) of the cost map
+struct AngleDirectionTable
+{
+  AngleDirectionTable()
+  {
+    for (size_t deg = 0; deg < table_.size(); ++deg) {
+      const float radian = deg * M_PI / 180.0;
+      table_.at(deg) = Eigen::Vector2f(std::cos(radian), std::sin(radian));
+    }
+  }
+  const Eigen::Vector2f & operator()(int deg) const { return table_[deg & 0xff]; }
+
+  std::array<Eigen::Vector2f, 256> table_;
+} angle_direction_table;
+
+// Transform the samples on the xy-plane, as they are looked up in the cost map
+void transform_xy(
+  const LineSegmentSamples & samples, const Eigen::Matrix3f & R, const Eigen::Vector3f & t,
+  std::vector<float> & xs, std::vector<float> & ys)
+{
+  const size_t size = samples.size();
+  xs.resize(size);
+  ys.resize(size);
+  const float * sx = samples.x.data();
+  const float * sy = samples.y.data();
+  const float * sz = samples.z.data();
+  for (size_t j = 0; j < size; ++j) {
+    xs[j] = R(0, 0) * sx[j] + R(0, 1) * sy[j] + R(0, 2) * sz[j] + t.x();
+    ys[j] = R(1, 0) * sx[j] + R(1, 1) * sy[j] + R(1, 2) * sz[j] + t.y();
+  }
+}
+
+std::vector<Area> touched_areas(
+  const LineSegmentSamples & samples, const std::vector<Sophus::SE3f> & transforms)
+{
+  std::unordered_set<Area, Area> areas;
+#pragma omp parallel
+  {
+    std::unordered_set<Area, Area> local_areas;
+    std::vector<float> xs;
+    std::vector<float> ys;
+#pragma omp for
+    for (int i = 0; i < static_cast<int>(transforms.size()); ++i) {
+      transform_xy(samples, transforms[i].rotationMatrix(), transforms[i].translation(), xs, ys);
+      std::optional<Area> last_key{std::nullopt};
+      for (size_t j = 0; j < xs.size(); ++j) {
+        const Area key(Eigen::Vector2f{xs[j], ys[j]});
+        if (!last_key || *last_key != key) {
+          local_areas.insert(key);
+          last_key = key;
+        }
+      }
+    }
+#pragma omp critical
+    areas.insert(local_areas.begin(), local_areas.end());
+  }
+  return {areas.begin(), areas.end()};
+}
+}  // namespace
+
+float abs_cos(const Eigen::Vector3f & t, float deg)
+{
+  const float radian = deg * M_PI / 180.0;
+  Eigen::Vector2f x(t.x(), t.y());
+  Eigen::Vector2f y(tier4_autoware_utils::cos(radian), tier4_autoware_utils::sin(radian));
+  x.normalize();
+  return std::abs(x.dot(y));
+}
+
+void LineSegmentSamples::add(const LineSegments & line_segments_cloud)
+{
+  for (const LineSegment & pn : line_segments_cloud) {
+    const Eigen::Vector3f tangent = (pn.getNormalVector3fMap() - pn.getVector3fMap()).normalized();
+    const float length = (pn.getVector3fMap() - pn.getNormalVector3fMap()).norm();
+    const float w = (pn.label == 0) ? 0.2f : 1.0f;
+
+    for (float distance = 0; distance < length; distance += 0.1f) {
+      const Eigen::Vector3f p = pn.getVector3fMap() + tangent * distance;
+      x.push_back(p.x());
+      y.push_back(p.y());
+      z.push_back(p.z());
+      tangent_x.push_back(tangent.x());
+      tangent_y.push_back(tangent.y());
+      tangent_z.push_back(tangent.z());
+      weight.push_back(w);
+    }
+  }
+}
+
+float compute_logit(
+  const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position,
+  const float far_weight_gain, HierarchicalCostMap & cost_map)
+{
+  float logit = 0;
+  for (const LineSegment & pn : line_segments_cloud) {
+    const Eigen::Vector3f tangent = (pn.getNormalVector3fMap() - pn.getVector3fMap()).normalized();
+    const float length = (pn.getVector3fMap() - pn.getNormalVector3fMap()).norm();
+
+    for (float distance = 0; distance < length; distance += 0.1f) {
+      Eigen::Vector3f p = pn.getVector3fMap() + tangent * distance;
+
+      // NOTE: Close points are prioritized
+      float squared_norm = (p - self_position).topRows(2).squaredNorm();
+      float gain = exp(-far_weight_gain * squared_norm);  // 0 < gain < 1
+
+      const CostMapValue v3 = cost_map.at(p.topRows(2));
+
+      if (v3.unmapped) {
+        // logit does not change if target pixel is unmapped
+        continue;
+      }
+      if (pn.label == 0) {  // posteriori
+        logit += 0.2f * gain * (abs_cos(tangent, v3.angle) * v3.intensity - 0.5f);
+      } else {  // apriori
+        logit += gain * (abs_cos(tangent, v3.angle) * v3.intensity - 0.5f);
+      }
+    }
+  }
+  return logit;
+}
+
+std::vector<float> compute_logits(
+  const LineSegmentSamples & samples, const std::vector<Sophus::SE3f> & transforms,
+  const float far_weight_gain, HierarchicalCostMap & cost_map)
+{
+  // build the maps here, since they cannot be built while being looked up concurrently
+  cost_map.prepare(touched_areas(samples, transforms));
+
+  std::vector<float> logits(transforms.size(), 0.f);
+#pragma omp parallel
+  {
+    std::vector<float> xs;
+    std::vector<float> ys;
+    std::vector<CostMapValue> values;
+#pragma omp for
+    for (int i = 0; i < static_cast<int>(transforms.size()); ++i) {
+      const Eigen::Matrix3f R = transforms[i].rotationMatrix();
+      const Eigen::Vector3f t = transforms[i].translation();
+      transform_xy(samples, R, t, xs, ys);
+      cost_map.gather(xs, ys, values);
+
+      float logit = 0;
+      for (size_t j = 0; j < values.size(); ++j) {
+        const CostMapValue & v3 = values[j];
+        if (v3.unmapped) {
+          // logit does not change if target pixel is unmapped
+          continue;
+        }
+
+        // NOTE: Close points are prioritized
+        const float dx = xs[j] - t.x();
+        const float dy = ys[j] - t.y();
+        const float gain = std::exp(-far_weight_gain * (dx * dx + dy * dy));  // 0 < gain < 1
+
+        const float tx = R(0, 0) * samples.tangent_x[j] + R(0, 1) * samples.tangent_y[j] +
+                         R(0, 2) * samples.tangent_z[j];
+        const float ty = R(1, 0) * samples.tangent_x[j] + R(1, 1) * samples.tangent_y[j] +
+                         R(1, 2) * samples.tangent_z[j];
+        const float tangent_norm = std::sqrt(tx * tx + ty * ty);
+        const Eigen::Vector2f & direction = angle_direction_table(v3.angle);
+        const float cos =
+          tangent_norm > 0 ? std::abs(tx * direction.x() + ty * direction.y()) / tangent_norm
+                           : 0.f;
+
+        logit += samples.weight[j] * gain * (cos * v3.intensity - 0.5f);
+      }
+      logits[i] = logit;
+    }
+  }
+  return logits;
+}
+}  // namespace yabloc::modularized_particle_filter
@@ -22,6 +22,9 @@
 
 #include <boost/geometry/geometry.hpp>
 
+#include <algorithm>
+#include <array>
+
 namespace yabloc
 {
 float Area::unit_length_ = -1;
@@ -29,12 +32,26 @@ float Area::unit_length_ = -1;
 HierarchicalCostMap::HierarchicalCostMap(rclcpp::Node * node)
 : max_range_(node->declare_parameter<float>("max_range")),
   image_size_(node->declare_parameter<int>("image_size")),
-  max_map_count_(10),
-  logger_(node->get_logger())
+  max_map_count_(std::max<int>(node->declare_parameter<int>("max_map_count"), 1)),
+  prefetch_time_(node->declare_parameter<float>("prefetch_time")),
+  logger_(node->get_logger()),
+  tiles_(std::make_shared<const CostMapTiles>())
 {
   Area::unit_length_ = max_range_;
   float gamma = node->declare_parameter<float>("gamma");
   gamma_converter.reset(gamma);
+
+  builder_thread_ = std::thread(&HierarchicalCostMap::run_builder, this);
+}
+
+HierarchicalCostMap::~HierarchicalCostMap()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopped_ = true;
+  }
+  request_cv_.notify_all();
+  builder_thread_.join();
 }
 
 cv::Point2i HierarchicalCostMap::to_cv_point(const Area & area, const Eigen::Vector2f p) const
@@ -45,64 +62,223 @@ cv::Point2i HierarchicalCostMap::to_cv_point(const Area & area, const Eigen::Vec
   return {static_cast<int>(px), static_cast<int>(py)};
 }
 
+CostMapValue HierarchicalCostMap::value_at(
+  const CostMapTile & tile, const Area & area, const Eigen::Vector2f & position) const
+{
+  cv::Point2i tmp = to_cv_point(area, position);
+  cv::Vec3b b3 = tile.image.ptr<cv::Vec3b>(tmp.y)[tmp.x];
+  return {b3[0] / 255.f, b3[1], b3[2] == 1};
+}
+
 CostMapValue HierarchicalCostMap::at(const Eigen::Vector2f & position)
 {
-  if (!cloud_.has_value()) {
+  const std::shared_ptr<const CostMapTiles> tiles = std::atomic_load(&tiles_);
+
+  Area key(position);
+  const auto itr = tiles->find(key);
+  if (itr == tiles->end()) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    request(key, true);
     return CostMapValue{0.5f, 0, true};
   }
 
-  Area key(position);
-  if (cost_maps_.count(key) == 0) {
-    build_map(key);
+  const CostMapTile & tile = *itr->second;
+  tile.last_access_cycle.store(access_cycle_.load(std::memory_order_relaxed));
+  return value_at(tile, key, position);
+}
+
+void HierarchicalCostMap::prepare(const std::vector<Area> & areas)
+{
+  const std::shared_ptr<const CostMapTiles> tiles = std::atomic_load(&tiles_);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const Area & key : areas) {
+    if (tiles->count(key) == 0) {
+      request(key, true);
+    }
   }
-  map_accessed_[key] = true;
+}
 
-  cv::Point2i tmp = to_cv_point(key, position);
-  cv::Vec3b b3 = cost_maps_.at(key).ptr<cv::Vec3b>(tmp.y)[tmp.x];
-  return {b3[0] / 255.f, b3[1], b3[2] == 1};
+void HierarchicalCostMap::gather(
+  const std::vector<float> & xs, const std::vector<float> & ys,
+  std::vector<CostMapValue> & values) const
+{
+  const std::shared_ptr<const CostMapTiles> tiles = std::atomic_load(&tiles_);
+  const uint64_t access_cycle = access_cycle_.load(std::memory_order_relaxed);
+
+  values.clear();
+  values.reserve(xs.size());
+
+  std::optional<Area> last_key{std::nullopt};
+  const CostMapTile * tile = nullptr;
+  for (size_t i = 0; i < xs.size(); ++i) {
+    const Eigen::Vector2f position(xs[i], ys[i]);
+    const Area key(position);
+    if (!last_key || *last_key != key) {
+      const auto itr = tiles->find(key);
+      tile = (itr != tiles->end()) ? itr->second.get() : nullptr;
+      if (tile != nullptr) {
+        tile->last_access_cycle.store(access_cycle, std::memory_order_relaxed);
+      }
+      last_key = key;
+    }
+    if (tile == nullptr) {
+      // the map of the area is not built yet
+      values.emplace_back(0.5f, 0, true);
+      continue;
+    }
+    values.push_back(value_at(*tile, key, position));
+  }
+}
+
+void HierarchicalCostMap::prefetch(
+  const Eigen::Vector2f & position, const Eigen::Vector2f & velocity)
+{
+  // the areas within the half of max_range, where the line segments around the ego are
+  const std::shared_ptr<const CostMapTiles> tiles = std::atomic_load(&tiles_);
+  const Eigen::Vector2f margin = Eigen::Vector2f::Constant(max_range_ / 2);
+
+  const std::array<Eigen::Vector2f, 2> centers{
+    position, Eigen::Vector2f(position + velocity * prefetch_time_)};
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const Eigen::Vector2f & center : centers) {
+    const Area min_area(center - margin);
+    const Area max_area(center + margin);
+    for (int x = min_area.x; x <= max_area.x; ++x) {
+      for (int y = min_area.y; y <= max_area.y; ++y) {
+        Area key;
+        key.x = x;
+        key.y = y;
+        if (tiles->count(key) == 0) {
+          request(key, false);
+        }
+      }
+    }
+  }
+}
+
+bool HierarchicalCostMap::wait_for_requested_maps(const std::chrono::milliseconds & timeout)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return built_cv_.wait_for(
+    lock, timeout, [this]() { return requested_areas_.empty() && !is_building_; });
 }
 
 void HierarchicalCostMap::set_height(float height)
 {
-  if (height_) {
-    if (std::abs(*height_ - height) > 2) {
-      generated_map_history_.clear();
-      cost_maps_.clear();
-      map_accessed_.clear();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (source_.height) {
+    if (std::abs(*source_.height - height) > 2) {
+      // the maps being built for the previous height are discarded
+      ++generation_;
+      requested_areas_.clear();
+      pending_areas_.clear();
+      std::atomic_store(&tiles_, std::make_shared<const CostMapTiles>());
     }
   }
 
-  height_ = height;
+  source_.height = height;
 }
 
 void HierarchicalCostMap::set_bounding_box(const pcl::PointCloud<pcl::PointXYZL> & cloud)
 {
   if (cloud.empty()) return;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto bounding_boxes = std::make_shared<std::vector<BgPolygon>>(*source_.bounding_boxes);
   BgPolygon poly;
 
   std::optional<uint32_t> last_label = std::nullopt;
   for (const pcl::PointXYZL p : cloud) {
     if (last_label) {
       if ((*last_label) != p.label) {
-        bounding_boxes_.push_back(poly);
+        bounding_boxes->push_back(poly);
         poly.outer().clear();
       }
     }
     poly.outer().push_back(BgPoint(p.x, p.y));
     last_label = p.label;
   }
-  bounding_boxes_.push_back(poly);
+  bounding_boxes->push_back(poly);
+  source_.bounding_boxes = std::move(bounding_boxes);
 }
 
 void HierarchicalCostMap::set_cloud(const pcl::PointCloud<pcl::PointNormal> & cloud)
 {
-  cloud_ = cloud;
+  auto shared_cloud = std::make_shared<const pcl::PointCloud<pcl::PointNormal>>(cloud);
+  std::lock_guard<std::mutex> lock(mutex_);
+  source_.cloud = std::move(shared_cloud);
+}
+
+void HierarchicalCostMap::request(const Area & area, const bool is_urgent)
+{
+  if (!source_.cloud || pending_areas_.count(area) != 0) {
+    return;
+  }
+  pending_areas_.insert(area);
+  if (is_urgent) {
+    requested_areas_.push_front(area);
+  } else {
+    requested_areas_.push_back(area);
+  }
+  request_cv_.notify_one();
+}
+
+void HierarchicalCostMap::run_builder()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    request_cv_.wait(lock, [this]() { return is_stopped_ || !requested_areas_.empty(); });
+    if (is_stopped_) {
+      return;
+    }
+
+    const Area area = requested_areas_.front();
+    requested_areas_.pop_front();
+    const MapSource source = source_;
+    const uint64_t generation = generation_;
+    is_building_ = true;
+
+    lock.unlock();
+    const cv::Mat image = build_map(area, source);
+    lock.lock();
+
+    is_building_ = false;
+    pending_areas_.erase(area);
+    if (generation == generation_) {
+      auto tiles = std::make_shared<CostMapTiles>(*std::atomic_load(&tiles_));
+      (*tiles)[area] = std::make_shared<const CostMapTile>(image, access_cycle_.load());
+      evict_least_recently_used(*tiles, area);
+      std::atomic_store(&tiles_, std::shared_ptr<const CostMapTiles>(std::move(tiles)));
+
+      RCLCPP_INFO_STREAM(
+        logger_, "succeeded to build map " << area(area) << " " << area.real_scale().transpose());
+    }
+    built_cv_.notify_all();
+  }
 }
 
-void HierarchicalCostMap::build_map(const Area & area)
+void HierarchicalCostMap::evict_least_recently_used(
+  CostMapTiles & tiles, const Area & new_area) const
 {
-  if (!cloud_.has_value()) return;
+  while (tiles.size() > max_map_count_) {
+    auto oldest = tiles.end();
+    for (auto itr = tiles.begin(); itr != tiles.end(); ++itr) {
+      if (itr->first == new_area) continue;
+      if (
+        oldest == tiles.end() ||
+        itr->second->last_access_cycle.load() < oldest->second->last_access_cycle.load()) {
+        oldest = itr;
+      }
+    }
+    if (oldest == tiles.end()) return;
+    tiles.erase(oldest);
+  }
+}
 
+cv::Mat HierarchicalCostMap::build_map(const Area & area, const MapSource & source) const
+{
   cv::Mat image = 255 * cv::Mat::ones(cv::Size(image_size_, image_size_), CV_8UC1);
   cv::Mat orientation = cv::Mat::zeros(cv::Size(image_size_, image_size_), CV_8UC1);
 
@@ -111,10 +287,10 @@ void HierarchicalCostMap::build_map(const Area & area)
   };
 
   // TODO(KYabuuchi) We can speed up by skipping too far line_segments
-  for (const auto pn : cloud_.value()) {
-    if (height_) {
-      if (std::abs(pn.z - *height_) > 4) continue;
-      if (std::abs(pn.normal_z - *height_) > 4) continue;
+  for (const auto pn : *source.cloud) {
+    if (source.height) {
+      if (std::abs(pn.z - *source.height) > 4) continue;
+      if (std::abs(pn.normal_z - *source.height) > 4) continue;
     }
 
     cv::Point2i from = cvPoint(pn.getVector3fMap());
@@ -138,18 +314,13 @@ void HierarchicalCostMap::build_map(const Area & area)
   cv::Mat whole_orientation = direct_cost_map(orientation, image);
 
   // channel-3
-  cv::Mat available_area = create_available_area_image(area);
+  cv::Mat available_area = create_available_area_image(area, *source.bounding_boxes);
 
   cv::Mat directed_cost_map;
   cv::merge(
     std::vector<cv::Mat>{gamma_converter(distance), whole_orientation, available_area},
     directed_cost_map);
-
-  cost_maps_[area] = directed_cost_map;
-  generated_map_history_.push_back(area);
-
-  RCLCPP_INFO_STREAM(
-    logger_, "succeeded to build map " << area(area) << " " << area.real_scale().transpose());
+  return directed_cost_map;
 }
 
 HierarchicalCostMap::MarkerArray HierarchicalCostMap::show_map_range() const
@@ -163,8 +334,9 @@ HierarchicalCostMap::MarkerArray HierarchicalCostMap::show_map_range() const
     return gp;
   };
 
+  const std::shared_ptr<const CostMapTiles> tiles = std::atomic_load(&tiles_);
   int id = 0;
-  for (const Area & area : generated_map_history_) {
+  for (const auto & [area, tile] : *tiles) {
     Marker marker;
     marker.header.frame_id = "map";
     marker.id = id++;
@@ -219,24 +391,14 @@ cv::Mat HierarchicalCostMap::get_map_image(const Pose & pose)
 
 void HierarchicalCostMap::erase_obsolete()
 {
-  if (cost_maps_.size() < max_map_count_) return;
-
-  for (auto itr = generated_map_history_.begin(); itr != generated_map_history_.end();) {
-    if (map_accessed_[*itr]) {
-      ++itr;
-      continue;
-    }
-    cost_maps_.erase(*itr);
-    itr = generated_map_history_.erase(itr);
-  }
-
-  map_accessed_.clear();
+  access_cycle_++;
 }
 
-cv::Mat HierarchicalCostMap::create_available_area_image(const Area & area) const
+cv::Mat HierarchicalCostMap::create_available_area_image(
+  const Area & area, const std::vector<BgPolygon> & bounding_boxes) const
 {
   cv::Mat available_area = cv::Mat::zeros(cv::Size(image_size_, image_size_), CV_8UC1);
-  if (bounding_boxes_.empty()) return available_area;
+  if (bounding_boxes.empty()) return available_area;
 
   // Define current area
   using BgBox = boost::geometry::model::box<BgPoint>;
@@ -248,7 +410,7 @@ cv::Mat HierarchicalCostMap::create_available_area_image(const Area & area) cons
 
   std::vector<std::vector<cv::Point2i>> contours;
 
-  for (const BgPolygon & box : bounding_boxes_) {
+  for (const BgPolygon & box : bounding_boxes) {
     if (boost::geometry::disjoint(area_polygon, box)) {
       continue;
     }
@@ -29,18 +29,199 @@
 #include <pcl_conversions/pcl_conversions.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
 namespace map_height_fitter
 {
 
+namespace
+{
+// The points of the pointcloud map bucketed into the cells of a 2D grid, with the lowest height of
+// each cell, so that the ground height is found around the query without scanning the whole map.
+class GroundHeightGrid
+{
+public:
+  explicit GroundHeightGrid(const pcl::PointCloud<pcl::PointXYZ> & cloud);
+
+  // Same as the lowest height within the distance to the closest point plus 1.0, which is set to
+  // search_radius. Return INFINITY if there is no point.
+  double find(const double x, const double y, double & search_radius) const;
+
+private:
+  static constexpr double default_cell_size = 2.0;
+  static constexpr double max_cells_num = 1e7;
+  // the points may be out of their cells by the rounding error of the cell index
+  static constexpr double cell_margin = 1e-3;
+
+  int64_t to_cell_index(const double value, const double min) const
+  {
+    return static_cast<int64_t>(std::floor((value - min) / cell_size_));
+  }
+
+  // Update min_dist2 with the points in the cells at the given Chebyshev distance from the cell
+  void find_closest_in_ring(
+    const double x, const double y, const int64_t cx, const int64_t cy, const int64_t ring,
+    double & min_dist2) const;
+
+  double cell_size_{default_cell_size};
+  double min_x_{0.0};
+  double min_y_{0.0};
+  int64_t width_{0};
+  int64_t height_{0};
+  // the points of the cell i are in [cell_begin_[i], cell_begin_[i + 1]) of points_
+  std::vector<size_t> cell_begin_;
+  std::vector<pcl::PointXYZ> points_;
+  std::vector<float> cell_min_z_;
+};
+
+GroundHeightGrid::GroundHeightGrid(const pcl::PointCloud<pcl::PointXYZ> & cloud)
+{
+  if (cloud.points.empty()) {
+    return;
+  }
+
+  double max_x = -INFINITY;
+  double max_y = -INFINITY;
+  min_x_ = INFINITY;
+  min_y_ = INFINITY;
+  for (const auto & p : cloud.points) {
+    min_x_ = std::min(min_x_, static_cast<double>(p.x));
+    min_y_ = std::min(min_y_, static_cast<double>(p.y));
+    max_x = std::max(max_x, static_cast<double>(p.x));
+    max_y = std::max(max_y, static_cast<double>(p.y));
+  }
+  // NOTE: The cells are enlarged for a map spread widely, e.g. by outliers, to bound the memory.
+  const double area = (max_x - min_x_ + default_cell_size) * (max_y - min_y_ + default_cell_size);
+  cell_size_ = std::max(default_cell_size, std::sqrt(area / max_cells_num));
+  width_ = to_cell_index(max_x, min_x_) + 1;
+  height_ = to_cell_index(max_y, min_y_) + 1;
+
+  // counting sort of the points by their cell
+  const auto cell_of = [this](const pcl::PointXYZ & p) {
+    const int64_t ix = std::clamp<int64_t>(to_cell_index(p.x, min_x_), 0, width_ - 1);
+    const int64_t iy = std::clamp<int64_t>(to_cell_index(p.y, min_y_), 0, height_ - 1);
+    return static_cast<size_t>(iy * width_ + ix);
+  };
+  const auto cells_num = static_cast<size_t>(width_ * height_);
+  cell_begin_.assign(cells_num + 1, 0);
+  cell_min_z_.assign(cells_num, std::numeric_limits<float>::infinity());
+  for (const auto & p : cloud.points) {
+    const size_t cell = cell_of(p);
+    ++cell_begin_[cell + 1];
+    cell_min_z_[cell] = std::min(cell_min_z_[cell], p.z);
+  }
+  for (size_t i = 0; i < cells_num; ++i) {
+    cell_begin_[i + 1] += cell_begin_[i];
+  }
+  std::vector<size_t> cell_end(cell_begin_.begin(), cell_begin_.end() - 1);
+  points_.resize(cloud.points.size());
+  for (const auto & p : cloud.points) {
+    points_[cell_end[cell_of(p)]++] = p;
+  }
+}
+
+void GroundHeightGrid::find_closest_in_ring(
+  const double x, const double y, const int64_t cx, const int64_t cy, const int64_t ring,
+  double & min_dist2) const
+{
+  const int64_t begin_y = std::max<int64_t>(cy - ring, 0);
+  const int64_t end_y = std::min<int64_t>(cy + ring, height_ - 1);
+  for (int64_t iy = begin_y; iy <= end_y; ++iy) {
+    // the whole row on the top and the bottom of the ring, otherwise its both ends
+    const bool is_edge_row = iy == cy - ring || iy == cy + ring;
+    const int64_t step = is_edge_row ? 1 : std::max<int64_t>(2 * ring, 1);
+    for (int64_t ix = cx - ring; ix <= cx + ring; ix += step) {
+      if (ix < 0 || width_ <= ix) {
+        continue;
+      }
+      const auto cell = static_cast<size_t>(iy * width_ + ix);
+      for (size_t i = cell_begin_[cell]; i < cell_begin_[cell + 1]; ++i) {
+        const double dx = x - points_[i].x;
+        const double dy = y - points_[i].y;
+        min_dist2 = std::min(min_dist2, (dx * dx) + (dy * dy));
+      }
+    }
+  }
+}
+
+double GroundHeightGrid::find(const double x, const double y, double & search_radius) const
+{
+  search_radius = INFINITY;
+  if (points_.empty()) {
+    return INFINITY;
+  }
+
+  // find distance d to closest point, from the rings of cells around the cell of the query
+  const int64_t cx = to_cell_index(x, min_x_);
+  const int64_t cy = to_cell_index(y, min_y_);
+  const int64_t max_ring = std::max(
+    {std::abs(cx), std::abs(cx - (width_ - 1)), std::abs(cy), std::abs(cy - (height_ - 1))});
+  double min_dist2 = INFINITY;
+  for (int64_t ring = 0; ring <= max_ring; ++ring) {
+    find_closest_in_ring(x, y, cx, cy, ring, min_dist2);
+    // the points in the outer rings are farther than this distance
+    const double outer_dist = std::max(static_cast<double>(ring) * cell_size_ - cell_margin, 0.0);
+    if (min_dist2 <= outer_dist * outer_dist) {
+      break;
+    }
+  }
+
+  // find lowest height within radius (d+1.0)
+  search_radius = std::sqrt(min_dist2) + 1.0;
+  const double radius2 = std::pow(search_radius, 2.0);
+  const int64_t begin_x = std::max<int64_t>(to_cell_index(x - search_radius, min_x_), 0);
+  const int64_t end_x = std::min<int64_t>(to_cell_index(x + search_radius, min_x_), width_ - 1);
+  const int64_t begin_y = std::max<int64_t>(to_cell_index(y - search_radius, min_y_), 0);
+  const int64_t end_y = std::min<int64_t>(to_cell_index(y + search_radius, min_y_), height_ - 1);
+  double height = INFINITY;
+  for (int64_t iy = begin_y; iy <= end_y; ++iy) {
+    const double cell_min_y = min_y_ + static_cast<double>(iy) * cell_size_ - cell_margin;
+    const double far_dy =
+      std::max(std::abs(y - cell_min_y), std::abs(y - cell_min_y - cell_size_ - 2 * cell_margin));
+    for (int64_t ix = begin_x; ix <= end_x; ++ix) {
+      const auto cell = static_cast<size_t>(iy * width_ + ix);
+      if (cell_begin_[cell] == cell_begin_[cell + 1]) {
+        continue;
+      }
+      // the lowest height of the cell is used as it is if the whole cell is within the radius
+      const double cell_min_x = min_x_ + static_cast<double>(ix) * cell_size_ - cell_margin;
+      const double far_dx =
+        std::max(std::abs(x - cell_min_x), std::abs(x - cell_min_x - cell_size_ - 2 * cell_margin));
+      if ((far_dx * far_dx) + (far_dy * far_dy) < radius2) {
+        height = std::min(height, static_cast<double>(cell_min_z_[cell]));
+        continue;
+      }
+      for (size_t i = cell_begin_[cell]; i < cell_begin_[cell + 1]; ++i) {
+        const double dx = x - points_[i].x;
+        const double dy = y - points_[i].y;
+        const double sd = (dx * dx) + (dy * dy);
+        if (sd < radius2) {
+          height = std::min(height, static_cast<double>(points_[i].z));
+        }
+      }
+    }
+  }
+  return height;
+}
+}  // namespace
+
 struct MapHeightFitter::Impl
 {
   static constexpr char enable_partial_load[] = "enable_partial_load";
+  static constexpr double partial_map_radius = 50.0;
 
   explicit Impl(rclcpp::Node * node);
   void on_pcd_map(const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg);
   void on_vector_map(const autoware_auto_mapping_msgs::msg::HADMapBin::ConstSharedPtr msg);
   bool get_partial_point_cloud_map(const Point & point);
-  double get_ground_height(const Point & point) const;
+  double get_ground_height(const Point & point, double & search_radius) const;
+  bool is_covered_by_partial_map(const Point & position, const double search_radius) const;
   std::optional<Point> fit(const Point & position, const std::string & frame);
 
   tf2::BufferCore tf2_buffer_;
@@ -52,7 +233,8 @@ struct MapHeightFitter::Impl
 
   // for fitting by pointcloud_map_loader
   rclcpp::CallbackGroup::SharedPtr group_;
-  pcl::PointCloud<pcl::PointXYZ>::Ptr map_cloud_;
+  std::optional<GroundHeightGrid> map_grid_;
+  std::optional<Point> partial_map_center_;
   rclcpp::Client<autoware_map_msgs::srv::GetPartialPointCloudMap>::SharedPtr cli_pcd_map_;
   rclcpp::Subscription<sensor_msgs::msg::PointCloud2>::SharedPtr sub_pcd_map_;
   rclcpp::AsyncParametersClient::SharedPtr params_pcd_map_loader_;
@@ -107,8 +289,9 @@ MapHeightFitter::Impl::Impl(rclcpp::Node * node) : tf2_listener_(tf2_buffer_), n
 void MapHeightFitter::Impl::on_pcd_map(const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)
 {
   map_frame_ = msg->header.frame_id;
-  map_cloud_ = pcl::PointCloud<pcl::PointXYZ>::Ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(*msg, *map_cloud_);
+  pcl::PointCloud<pcl::PointXYZ> map_cloud;
+  pcl::fromROSMsg(*msg, map_cloud);
+  map_grid_.emplace(map_cloud);
 }
 
 bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
@@ -127,7 +310,7 @@ bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
   const auto req = std::make_shared<autoware_map_msgs::srv::GetPartialPointCloudMap::Request>();
   req->area.center_x = point.x;
   req->area.center_y = point.y;
-  req->area.radius = 50;
+  req->area.radius = partial_map_radius;
 
   RCLCPP_DEBUG(logger, "Send request to map_loader");
   auto future = cli_pcd_map_->async_send_request(req);
@@ -157,11 +340,23 @@ bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
     }
   }
   map_frame_ = res->header.frame_id;
-  map_cloud_ = pcl::PointCloud<pcl::PointXYZ>::Ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(pcd_msg, *map_cloud_);
+  pcl::PointCloud<pcl::PointXYZ> map_cloud;
+  pcl::fromROSMsg(pcd_msg, map_cloud);
+  map_grid_.emplace(map_cloud);
+  partial_map_center_ = point;
   return true;
 }
 
+bool MapHeightFitter::Impl::is_covered_by_partial_map(
+  const Point & position, const double search_radius) const
+{
+  // the partial map contains all the points within partial_map_radius from its center
+  return partial_map_center_ &&
+         std::hypot(position.x - partial_map_center_->x, position.y - partial_map_center_->y) +
+             search_radius <=
+           partial_map_radius;
+}
+
 void MapHeightFitter::Impl::on_vector_map(
   const autoware_auto_mapping_msgs::msg::HADMapBin::ConstSharedPtr msg)
 {
@@ -170,7 +365,7 @@ void MapHeightFitter::Impl::on_vector_map(
   map_frame_ = msg->header.frame_id;
 }
 
-double MapHeightFitter::Impl::get_ground_height(const Point & point) const
+double MapHeightFitter::Impl::get_ground_height(const Point & point, double & search_radius) const
 {
   const auto logger = node_->get_logger();
 
@@ -178,27 +373,9 @@ double MapHeightFitter::Impl::get_ground_height(const Point & point) const
   const double y = point.y;
 
   double height = INFINITY;
+  search_radius = 0.0;
   if (fit_target_ == "pointcloud_map") {
-    // find distance d to closest point
-    double min_dist2 = INFINITY;
-    for (const auto & p : map_cloud_->points) {
-      const double dx = x - p.x;
-      const double dy = y - p.y;
-      const double sd = (dx * dx) + (dy * dy);
-      min_dist2 = std::min(min_dist2, sd);
-    }
-
-    // find lowest height within radius (d+1.0)
-    const double radius2 = std::pow(std::sqrt(min_dist2) + 1.0, 2.0);
-
-    for (const auto & p : map_cloud_->points) {
-      const double dx = x - p.x;
-      const double dy = y - p.y;
-      const double sd = (dx * dx) + (dy * dy);
-      if (sd < radius2) {
-        height = std::min(height, static_cast<double>(p.z));
-      }
-    }
+    height = map_grid_->find(x, y, search_radius);
   } else if (fit_target_ == "vector_map") {
     const auto closest_points = vector_map_->pointLayer.nearest(lanelet::BasicPoint2d{x, y}, 1);
     if (closest_points.empty()) {
@@ -224,14 +401,19 @@ std::optional<Point> MapHeightFitter::Impl::fit(const Point & position, const st
   RCLCPP_DEBUG(logger, "original point: %.3f %.3f %.3f", point.x, point.y, point.z);
 
   // prepare data
+  // NOTE: The partial map of the previous request is reused while it contains all the points the
+  //       height is fitted with, which is checked after the fitting below.
+  bool is_partial_map_loaded = false;
   if (fit_target_ == "pointcloud_map") {
-    if (cli_pcd_map_) {  // if cli_pcd_map_ is available, prepare pointcloud map by partial loading
+    // if cli_pcd_map_ is available, prepare pointcloud map by partial loading
+    if (cli_pcd_map_ && !partial_map_center_) {
       if (!get_partial_point_cloud_map(position)) {
         RCLCPP_WARN_STREAM(logger, "failed to get partial point cloud map");
         return std::nullopt;
       }
+      is_partial_map_loaded = true;
     }  // otherwise, pointcloud map should be already prepared by on_pcd_map
-    if (!map_cloud_) {
+    if (!map_grid_) {
       RCLCPP_WARN_STREAM(logger, "point cloud map is not ready");
       return std::nullopt;
     }
@@ -255,7 +437,19 @@ std::optional<Point> MapHeightFitter::Impl::fit(const Point & position, const st
   }
 
   // fit height on map_frame_
-  point.z = get_ground_height(point);
+  double search_radius = 0.0;
+  double height = get_ground_height(point, search_radius);
+  if (
+    cli_pcd_map_ && !is_partial_map_loaded &&
+    !is_covered_by_partial_map(position, search_radius)) {
+    RCLCPP_DEBUG(logger, "the partial point cloud map is loaded again around the point");
+    if (!get_partial_point_cloud_map(position)) {
+      RCLCPP_WARN_STREAM(logger, "failed to get partial point cloud map");
+      return std::nullopt;
+    }
+    height = get_ground_height(point, search_radius);
+  }
+  point.z = height;
 
   // transform map_frame_ to frame
   try {
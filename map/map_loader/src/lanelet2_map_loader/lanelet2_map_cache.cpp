@@ -0,0 +1,160 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_cache.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+constexpr uint32_t MAGIC = 0x4c4d5741;  // "AWML" in little endian
+constexpr uint32_t VERSION = 1;
+
+template <typename T>
+void write(std::ofstream & ofs, const T & value)
+{
+  ofs.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+bool read(std::ifstream & ifs, T & value)
+{
+  return static_cast<bool>(ifs.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+template <typename Container>
+void write_sequence(std::ofstream & ofs, const Container & sequence)
+{
+  write(ofs, static_cast<uint64_t>(sequence.size()));
+  ofs.write(
+    reinterpret_cast<const char *>(sequence.data()), static_cast<std::streamsize>(sequence.size()));
+}
+
+// Fail without allocating if the stored size exceeds the rest of the file
+template <typename Container>
+bool read_sequence(std::ifstream & ifs, const uint64_t file_size, Container & sequence)
+{
+  uint64_t size = 0;
+  if (!read(ifs, size) || file_size - static_cast<uint64_t>(ifs.tellg()) < size) {
+    return false;
+  }
+  sequence.resize(size);
+  return static_cast<bool>(
+    ifs.read(reinterpret_cast<char *>(sequence.data()), static_cast<std::streamsize>(size)));
+}
+
+// 64-bit FNV-1a, which does not depend on the standard library unlike std::hash
+bool hash_file(const std::string & path, uint64_t & hash)
+{
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs) {
+    return false;
+  }
+  hash = 0xcbf29ce484222325;
+  std::vector<char> buffer(1 << 20);
+  while (ifs.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || ifs.gcount() > 0) {
+    const auto size = static_cast<size_t>(ifs.gcount());
+    for (size_t i = 0; i < size; ++i) {
+      hash ^= static_cast<uint8_t>(buffer[i]);
+      hash *= 0x100000001b3;
+    }
+  }
+  return ifs.eof();
+}
+}  // namespace
+
+std::string getLanelet2MapCachePath(const std::string & lanelet2_filename)
+{
+  return std::filesystem::path(lanelet2_filename)
+    .replace_extension(LANELET2_MAP_CACHE_EXTENSION)
+    .string();
+}
+
+std::string createLanelet2MapCacheKey(
+  const std::string & lanelet2_filename,
+  const tier4_map_msgs::msg::MapProjectorInfo & projector_info, const double center_line_resolution)
+{
+  uint64_t hash = 0;
+  if (!hash_file(lanelet2_filename, hash)) {
+    return "";
+  }
+
+  std::ostringstream key;
+  key << std::hex << hash << std::dec << std::setprecision(17) << " "
+      << projector_info.projector_type << " " << projector_info.vertical_datum << " "
+      << projector_info.mgrs_grid << " " << projector_info.map_origin.latitude << " "
+      << projector_info.map_origin.longitude << " " << projector_info.map_origin.altitude << " "
+      << center_line_resolution;
+  return key.str();
+}
+
+bool saveLanelet2MapCache(
+  const std::string & path, const std::string & key,
+  const autoware_auto_mapping_msgs::msg::HADMapBin & map_bin_msg)
+{
+  std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+  if (!ofs) {
+    return false;
+  }
+
+  write(ofs, MAGIC);
+  write(ofs, VERSION);
+  write_sequence(ofs, key);
+  write_sequence(ofs, map_bin_msg.format_version);
+  write_sequence(ofs, map_bin_msg.map_version);
+  write_sequence(ofs, map_bin_msg.data);
+  return static_cast<bool>(ofs);
+}
+
+bool loadLanelet2MapCache(
+  const std::string & path, const std::string & key,
+  autoware_auto_mapping_msgs::msg::HADMapBin & map_bin_msg)
+{
+  std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+  if (!ifs) {
+    return false;
+  }
+  const auto file_size = static_cast<uint64_t>(ifs.tellg());
+  ifs.seekg(0);
+
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  std::string stored_key{};
+  if (
+    !read(ifs, magic) || !read(ifs, version) || magic != MAGIC || version != VERSION ||
+    !read_sequence(ifs, file_size, stored_key) || stored_key != key) {
+    return false;
+  }
+
+  // the message is left as it is unless the whole cache is read
+  std::string format_version{};
+  std::string map_version{};
+  std::vector<uint8_t> data{};
+  if (
+    !read_sequence(ifs, file_size, format_version) || !read_sequence(ifs, file_size, map_version) ||
+    !read_sequence(ifs, file_size, data)) {
+    return false;
+  }
+  map_bin_msg.format_version = std::move(format_version);
+  map_bin_msg.map_version = std::move(map_version);
+  map_bin_msg.data = std::move(data);
+  return true;
+}
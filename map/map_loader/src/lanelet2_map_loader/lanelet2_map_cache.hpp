@@ -0,0 +1,48 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
+#define LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
+
+#include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
+#include <tier4_map_msgs/msg/map_projector_info.hpp>
+
+#include <string>
+
+// A lanelet2 map cache stored as the versions and the serialized map of HADMapBin after the
+// projection and the centerline overwrite, preceded by the key it was created with. The loader
+// publishes the serialized map as it is, instead of parsing the OSM file.
+constexpr char LANELET2_MAP_CACHE_EXTENSION[] = ".osmbin";
+
+// Return the path of the cache created from the given OSM file
+std::string getLanelet2MapCachePath(const std::string & lanelet2_filename);
+
+// Return the key made of the hash of the OSM file and the parameters the map is processed with,
+// or an empty string if the OSM file cannot be read
+std::string createLanelet2MapCacheKey(
+  const std::string & lanelet2_filename,
+  const tier4_map_msgs::msg::MapProjectorInfo & projector_info,
+  const double center_line_resolution);
+
+bool saveLanelet2MapCache(
+  const std::string & path, const std::string & key,
+  const autoware_auto_mapping_msgs::msg::HADMapBin & map_bin_msg);
+
+// Return false if the file cannot be read, is not a cache of this version or has another key.
+// The header of the message is not stored and is left as it is.
+bool loadLanelet2MapCache(
+  const std::string & path, const std::string & key,
+  autoware_auto_mapping_msgs::msg::HADMapBin & map_bin_msg);
+
+#endif  // LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
@@ -34,6 +34,7 @@
 #include "map_loader/lanelet2_map_loader_node.hpp"
 
 #include "lanelet2_local_projector.hpp"
+#include "lanelet2_map_cache.hpp"
 
 #include <ament_index_cpp/get_package_prefix.hpp>
 #include <geography_utils/lanelet2_projector.hpp>
@@ -63,6 +64,7 @@ Lanelet2MapLoaderNode::Lanelet2MapLoaderNode(const rclcpp::NodeOptions & options
 
   declare_parameter<std::string>("lanelet2_map_path");
   declare_parameter<double>("center_line_resolution");
+  declare_parameter<bool>("enable_lanelet2_map_cache");
 }
 
 void Lanelet2MapLoaderNode::on_map_projector_info(
@@ -70,19 +72,40 @@ void Lanelet2MapLoaderNode::on_map_projector_info(
 {
   const auto lanelet2_filename = get_parameter("lanelet2_map_path").as_string();
   const auto center_line_resolution = get_parameter("center_line_resolution").as_double();
+  const auto enable_lanelet2_map_cache = get_parameter("enable_lanelet2_map_cache").as_bool();
+
+  // load map from cache
+  // NOTE: The key is empty if the cache is disabled or the OSM file cannot be read, then the map
+  //       is loaded from the OSM file as usual.
+  const auto cache_path = getLanelet2MapCachePath(lanelet2_filename);
+  const auto cache_key =
+    enable_lanelet2_map_cache
+      ? createLanelet2MapCacheKey(lanelet2_filename, *msg, center_line_resolution)
+      : std::string{};
+  HADMapBin map_bin_msg;
+  if (!cache_key.empty() && loadLanelet2MapCache(cache_path, cache_key, map_bin_msg)) {
+    map_bin_msg.header.stamp = now();
+    map_bin_msg.header.frame_id = "map";
+    RCLCPP_INFO(get_logger(), "Loaded lanelet2_map from the cache %s.", cache_path.c_str());
+  } else {
+    // load map from file
+    const auto map = load_map(lanelet2_filename, *msg);
+    if (!map) {
+      RCLCPP_ERROR(get_logger(), "Failed to load lanelet2_map. Not published.");
+      return;
+    }
 
-  // load map from file
-  const auto map = load_map(lanelet2_filename, *msg);
-  if (!map) {
-    RCLCPP_ERROR(get_logger(), "Failed to load lanelet2_map. Not published.");
-    return;
-  }
+    // overwrite centerline
+    lanelet::utils::overwriteLaneletsCenterline(map, center_line_resolution, false);
 
-  // overwrite centerline
-  lanelet::utils::overwriteLaneletsCenterline(map, center_line_resolution, false);
+    // create map bin msg
+    map_bin_msg = create_map_bin_msg(map, lanelet2_filename, now());
 
-  // create map bin msg
-  const auto map_bin_msg = create_map_bin_msg(map, lanelet2_filename, now());
+    // save map to cache for the next startup
+    if (!cache_key.empty() && !saveLanelet2MapCache(cache_path, cache_key, map_bin_msg)) {
+      RCLCPP_WARN(get_logger(), "Failed to save the lanelet2_map cache %s.", cache_path.c_str());
+    }
+  }
 
   // create publisher and publish
   pub_map_bin_ =
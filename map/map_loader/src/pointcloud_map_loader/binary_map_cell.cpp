@@ -0,0 +1,181 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "binary_map_cell.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace
+{
+constexpr uint32_t MAGIC = 0x434d5741;  // "AWMC" in little endian
+constexpr uint32_t VERSION = 1;
+
+template <typename T>
+void write(std::ofstream & ofs, const T & value)
+{
+  ofs.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+// Read the values from the mapped file, failing once the end of the file is reached
+class MappedFileReader
+{
+public:
+  MappedFileReader(const uint8_t * data, const size_t size) : data_(data), size_(size) {}
+
+  template <typename T>
+  bool read(T & value)
+  {
+    if (size_ - offset_ < sizeof(T)) {
+      return false;
+    }
+    std::memcpy(&value, data_ + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return true;
+  }
+
+  const uint8_t * take(const size_t size)
+  {
+    if (size_ - offset_ < size) {
+      return nullptr;
+    }
+    const uint8_t * ptr = data_ + offset_;
+    offset_ += size;
+    return ptr;
+  }
+
+private:
+  const uint8_t * data_;
+  size_t size_;
+  size_t offset_{0};
+};
+
+bool parseBinaryMapCell(MappedFileReader & reader, sensor_msgs::msg::PointCloud2 & cloud)
+{
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  if (!reader.read(magic) || !reader.read(version) || magic != MAGIC || version != VERSION) {
+    return false;
+  }
+
+  uint8_t is_bigendian = 0;
+  uint8_t is_dense = 0;
+  uint32_t fields_num = 0;
+  if (
+    !reader.read(cloud.height) || !reader.read(cloud.width) || !reader.read(cloud.point_step) ||
+    !reader.read(cloud.row_step) || !reader.read(is_bigendian) || !reader.read(is_dense) ||
+    !reader.read(fields_num)) {
+    return false;
+  }
+  cloud.is_bigendian = is_bigendian;
+  cloud.is_dense = is_dense;
+
+  cloud.fields.resize(fields_num);
+  for (auto & field : cloud.fields) {
+    uint32_t name_size = 0;
+    if (!reader.read(name_size)) {
+      return false;
+    }
+    const uint8_t * name = reader.take(name_size);
+    if (
+      name == nullptr || !reader.read(field.offset) || !reader.read(field.datatype) ||
+      !reader.read(field.count)) {
+      return false;
+    }
+    field.name.assign(reinterpret_cast<const char *>(name), name_size);
+  }
+
+  uint64_t data_size = 0;
+  if (!reader.read(data_size)) {
+    return false;
+  }
+  const uint8_t * data = reader.take(data_size);
+  if (data == nullptr || data_size != static_cast<uint64_t>(cloud.row_step) * cloud.height) {
+    return false;
+  }
+  cloud.data.assign(data, data + data_size);
+  return true;
+}
+}  // namespace
+
+std::string getBinaryMapCellPath(const std::string & pcd_path)
+{
+  return std::filesystem::path(pcd_path).replace_extension(BINARY_MAP_CELL_EXTENSION).string();
+}
+
+bool saveBinaryMapCell(const std::string & path, const sensor_msgs::msg::PointCloud2 & cloud)
+{
+  std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+  if (!ofs) {
+    return false;
+  }
+
+  write(ofs, MAGIC);
+  write(ofs, VERSION);
+  write(ofs, cloud.height);
+  write(ofs, cloud.width);
+  write(ofs, cloud.point_step);
+  write(ofs, cloud.row_step);
+  write(ofs, static_cast<uint8_t>(cloud.is_bigendian));
+  write(ofs, static_cast<uint8_t>(cloud.is_dense));
+  write(ofs, static_cast<uint32_t>(cloud.fields.size()));
+  for (const auto & field : cloud.fields) {
+    write(ofs, static_cast<uint32_t>(field.name.size()));
+    ofs.write(field.name.data(), static_cast<std::streamsize>(field.name.size()));
+    write(ofs, field.offset);
+    write(ofs, field.datatype);
+    write(ofs, field.count);
+  }
+  write(ofs, static_cast<uint64_t>(cloud.data.size()));
+  ofs.write(
+    reinterpret_cast<const char *>(cloud.data.data()),
+    static_cast<std::streamsize>(cloud.data.size()));
+  return static_cast<bool>(ofs);
+}
+
+bool loadBinaryMapCell(const std::string & path, sensor_msgs::msg::PointCloud2 & cloud)
+{
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat file_stat
+  {
+  };
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    close(fd);
+    return false;
+  }
+  const auto size = static_cast<size_t>(file_stat.st_size);
+  void * addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return false;
+  }
+  // the data is read once from the beginning to the end
+  madvise(addr, size, MADV_SEQUENTIAL);
+
+  MappedFileReader reader(static_cast<const uint8_t *>(addr), size);
+  const bool is_loaded = parseBinaryMapCell(reader, cloud);
+  munmap(addr, size);
+  return is_loaded;
+}
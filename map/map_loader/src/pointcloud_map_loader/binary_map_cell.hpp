@@ -0,0 +1,35 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_MAP_LOADER__BINARY_MAP_CELL_HPP_
+#define POINTCLOUD_MAP_LOADER__BINARY_MAP_CELL_HPP_
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <string>
+
+// A pointcloud map cell stored as the PointCloud2 layout followed by its raw data, in the byte
+// order of the host. The loader maps the file and copies the data into the message as it is,
+// instead of parsing a PCD file.
+constexpr char BINARY_MAP_CELL_EXTENSION[] = ".pcdbin";
+
+// Return the path of the binary map cell converted from the given PCD file
+std::string getBinaryMapCellPath(const std::string & pcd_path);
+
+bool saveBinaryMapCell(const std::string & path, const sensor_msgs::msg::PointCloud2 & cloud);
+
+// Return false if the file cannot be mapped or is not a binary map cell of this version
+bool loadBinaryMapCell(const std::string & path, sensor_msgs::msg::PointCloud2 & cloud);
+
+#endif  // POINTCLOUD_MAP_LOADER__BINARY_MAP_CELL_HPP_
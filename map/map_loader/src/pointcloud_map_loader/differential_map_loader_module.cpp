@@ -15,8 +15,11 @@
 #include "differential_map_loader_module.hpp"
 
 DifferentialMapLoaderModule::DifferentialMapLoaderModule(
-  rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(pcd_file_metadata_dict)
+  rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict,
+  const bool enable_binary_map_cell_load)
+: logger_(node->get_logger()),
+  all_pcd_file_metadata_dict_(pcd_file_metadata_dict),
+  enable_binary_map_cell_load_(enable_binary_map_cell_load)
 {
   get_differential_pcd_maps_service_ = node->create_service<GetDifferentialPointCloudMap>(
     "service/get_differential_pcd_map",
@@ -31,31 +34,39 @@ void DifferentialMapLoaderModule::differentialAreaLoad(
 {
   // iterate over all the available pcd map grids
   std::vector<bool> should_remove(static_cast<int>(cached_ids.size()), true);
-  for (const auto & ele : all_pcd_file_metadata_dict_) {
-    std::string path = ele.first;
-    PCDFileMetadata metadata = ele.second;
-
+  std::vector<std::map<std::string, PCDFileMetadata>::const_iterator> grids_to_load;
+  for (auto ele = all_pcd_file_metadata_dict_.cbegin(); ele != all_pcd_file_metadata_dict_.cend();
+       ++ele) {
     // assume that the map ID = map path (for now)
-    std::string map_id = path;
+    const std::string & map_id = ele->first;
 
     // skip if the pcd file is not within the queried area
-    if (!isGridWithinQueriedArea(area, metadata)) continue;
+    if (!isGridWithinQueriedArea(area, ele->second)) continue;
 
     auto id_in_cached_list = std::find(cached_ids.begin(), cached_ids.end(), map_id);
     if (id_in_cached_list != cached_ids.end()) {
       int index = id_in_cached_list - cached_ids.begin();
       should_remove[index] = false;
     } else {
-      autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
-        loadPointCloudMapCellWithID(path, map_id);
-      pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
-      pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
-      pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
-      pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
-      response->new_pointcloud_with_ids.push_back(pointcloud_map_cell_with_id);
+      grids_to_load.push_back(ele);
     }
   }
 
+  // load the pcd files in parallel, and keep the order of the response
+  const size_t offset = response->new_pointcloud_with_ids.size();
+  response->new_pointcloud_with_ids.resize(offset + grids_to_load.size());
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < static_cast<int>(grids_to_load.size()); ++i) {
+    const std::string & path = grids_to_load[i]->first;
+    const PCDFileMetadata & metadata = grids_to_load[i]->second;
+    auto & pointcloud_map_cell_with_id = response->new_pointcloud_with_ids[offset + i];
+    pointcloud_map_cell_with_id = loadPointCloudMapCellWithID(path, path);
+    pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
+    pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
+    pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
+    pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
+  }
+
   for (size_t i = 0; i < cached_ids.size(); ++i) {
     if (should_remove[i]) {
       response->ids_to_remove.push_back(cached_ids[i]);
@@ -79,7 +90,10 @@ DifferentialMapLoaderModule::loadPointCloudMapCellWithID(
   const std::string & path, const std::string & map_id) const
 {
   sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
+  // the binary map cell converted from the PCD file is preferred, if any
+  const bool is_binary_map_cell_loaded =
+    enable_binary_map_cell_load_ && loadBinaryMapCell(getBinaryMapCellPath(path), pcd);
+  if (!is_binary_map_cell_loaded && pcl::io::loadPCDFile(path, pcd) == -1) {
     RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
   }
   autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
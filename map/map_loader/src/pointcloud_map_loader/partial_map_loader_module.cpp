@@ -29,24 +29,29 @@ void PartialMapLoaderModule::partialAreaLoad(
   GetPartialPointCloudMap::Response::SharedPtr & response) const
 {
   // iterate over all the available pcd map grids
-  for (const auto & ele : all_pcd_file_metadata_dict_) {
-    std::string path = ele.first;
-    PCDFileMetadata metadata = ele.second;
-
-    // assume that the map ID = map path (for now)
-    std::string map_id = path;
-
+  std::vector<std::map<std::string, PCDFileMetadata>::const_iterator> grids_to_load;
+  for (auto ele = all_pcd_file_metadata_dict_.cbegin(); ele != all_pcd_file_metadata_dict_.cend();
+       ++ele) {
     // skip if the pcd file is not within the queried area
-    if (!isGridWithinQueriedArea(area, metadata)) continue;
+    if (!isGridWithinQueriedArea(area, ele->second)) continue;
 
-    autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
-      loadPointCloudMapCellWithID(path, map_id);
+    grids_to_load.push_back(ele);
+  }
+
+  // load the pcd files in parallel, and keep the order of the response
+  const size_t offset = response->new_pointcloud_with_ids.size();
+  response->new_pointcloud_with_ids.resize(offset + grids_to_load.size());
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < static_cast<int>(grids_to_load.size()); ++i) {
+    // assume that the map ID = map path (for now)
+    const std::string & path = grids_to_load[i]->first;
+    const PCDFileMetadata & metadata = grids_to_load[i]->second;
+    auto & pointcloud_map_cell_with_id = response->new_pointcloud_with_ids[offset + i];
+    pointcloud_map_cell_with_id = loadPointCloudMapCellWithID(path, path);
     pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
     pointcloud_map_cell_with_id.metadata.min_y = metadata.min.y;
     pointcloud_map_cell_with_id.metadata.max_x = metadata.max.x;
     pointcloud_map_cell_with_id.metadata.max_y = metadata.max.y;
-
-    response->new_pointcloud_with_ids.push_back(pointcloud_map_cell_with_id);
   }
 }
 
@@ -0,0 +1,103 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Convert the .pcd files of a divided pointcloud map to the binary map cells (.pcdbin) next to
+// them, optionally downsampled with a voxel grid filter.
+//
+// usage: pointcloud_map_cell_converter [--leaf-size <m>] <pcd file or directory>...
+
+#include "binary_map_cell.hpp"
+
+#include <pcl/filters/voxel_grid.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+bool isPcdFile(const fs::path & p)
+{
+  return fs::is_regular_file(p) && (p.extension() == ".pcd" || p.extension() == ".PCD");
+}
+
+bool convert(const std::string & pcd_path, const double leaf_size)
+{
+  pcl::PCLPointCloud2 pcd;
+  if (pcl::io::loadPCDFile(pcd_path, pcd) == -1) {
+    std::cerr << "PCD load failed: " << pcd_path << std::endl;
+    return false;
+  }
+
+  if (leaf_size > 0.0) {
+    const auto input = pcl::make_shared<pcl::PCLPointCloud2>(pcd);
+    pcl::VoxelGrid<pcl::PCLPointCloud2> voxel_grid;
+    voxel_grid.setLeafSize(leaf_size, leaf_size, leaf_size);
+    voxel_grid.setInputCloud(input);
+    voxel_grid.filter(pcd);
+  }
+
+  sensor_msgs::msg::PointCloud2 cloud;
+  pcl_conversions::moveFromPCL(pcd, cloud);
+  const std::string binary_map_cell_path = getBinaryMapCellPath(pcd_path);
+  if (!saveBinaryMapCell(binary_map_cell_path, cloud)) {
+    std::cerr << "Binary map cell save failed: " << binary_map_cell_path << std::endl;
+    return false;
+  }
+  std::cout << pcd_path << " -> " << binary_map_cell_path << " (" << cloud.width * cloud.height
+            << " points)" << std::endl;
+  return true;
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  double leaf_size = 0.0;
+  std::vector<std::string> pcd_paths;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "--leaf-size" && i + 1 < argc) {
+      leaf_size = std::stod(argv[++i]);
+      continue;
+    }
+    if (fs::is_directory(arg)) {
+      for (const auto & file : fs::directory_iterator(arg)) {
+        if (isPcdFile(file.path())) {
+          pcd_paths.push_back(file.path().string());
+        }
+      }
+    } else if (isPcdFile(arg)) {
+      pcd_paths.push_back(arg);
+    } else {
+      std::cerr << "invalid path: " << arg << std::endl;
+    }
+  }
+
+  if (pcd_paths.empty()) {
+    std::cerr << "usage: pointcloud_map_cell_converter [--leaf-size <m>] <pcd file or directory>..."
+              << std::endl;
+    return 1;
+  }
+
+  bool is_succeeded = true;
+  for (const auto & pcd_path : pcd_paths) {
+    is_succeeded &= convert(pcd_path, leaf_size);
+  }
+  return is_succeeded ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/pointcloud_map_loader/binary_map_cell.hpp"
+
+#include <gmock/gmock.h>
+#include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <filesystem>
+#include <fstream>
+
+TEST(BinaryMapCellTest, SaveAndLoad)
+{
+  pcl::PointCloud<pcl::PointXYZ> dummy_cloud;
+  dummy_cloud.push_back(pcl::PointXYZ(-1.0, -1.0, -1.0));
+  dummy_cloud.push_back(pcl::PointXYZ(0.0, 0.0, 0.0));
+  dummy_cloud.push_back(pcl::PointXYZ(1.0, 1.0, 1.0));
+  sensor_msgs::msg::PointCloud2 expected;
+  pcl::toROSMsg(dummy_cloud, expected);
+
+  const std::string path =
+    (std::filesystem::temp_directory_path() / "temp_map_cell.pcdbin").string();
+  ASSERT_TRUE(saveBinaryMapCell(path, expected));
+
+  sensor_msgs::msg::PointCloud2 result;
+  ASSERT_TRUE(loadBinaryMapCell(path, result));
+  EXPECT_EQ(result.height, expected.height);
+  EXPECT_EQ(result.width, expected.width);
+  EXPECT_EQ(result.point_step, expected.point_step);
+  EXPECT_EQ(result.row_step, expected.row_step);
+  EXPECT_EQ(result.is_bigendian, expected.is_bigendian);
+  EXPECT_EQ(result.is_dense, expected.is_dense);
+  EXPECT_EQ(result.fields, expected.fields);
+  EXPECT_EQ(result.data, expected.data);
+}
+
+TEST(BinaryMapCellTest, RejectInvalidFile)
+{
+  const std::string path =
+    (std::filesystem::temp_directory_path() / "temp_invalid_map_cell.pcdbin").string();
+  std::ofstream ofs(path);
+  ofs << "not a binary map cell";
+  ofs.close();
+
+  sensor_msgs::msg::PointCloud2 result;
+  EXPECT_FALSE(loadBinaryMapCell(path, result));
+  EXPECT_FALSE(loadBinaryMapCell(path + ".missing", result));
+}
+
+TEST(BinaryMapCellTest, BinaryMapCellPath)
+{
+  EXPECT_EQ(getBinaryMapCellPath("/tmp/map/000.pcd"), "/tmp/map/000.pcdbin");
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleMock(&argc, argv);
+  return RUN_ALL_TESTS();
+}
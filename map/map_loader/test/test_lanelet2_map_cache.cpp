@@ -0,0 +1,106 @@
+// Copyright 2024 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/lanelet2_map_loader/lanelet2_map_cache.hpp"
+
+#include <gmock/gmock.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace
+{
+std::string writeDummyOsm(const std::string & filename, const std::string & content)
+{
+  const std::string path = (std::filesystem::temp_directory_path() / filename).string();
+  std::ofstream ofs(path);
+  ofs << content;
+  return path;
+}
+}  // namespace
+
+TEST(Lanelet2MapCacheTest, SaveAndLoad)
+{
+  const auto osm_path = writeDummyOsm("temp_map.osm", "<osm version=\"0.6\"></osm>");
+  tier4_map_msgs::msg::MapProjectorInfo projector_info;
+  projector_info.projector_type = tier4_map_msgs::msg::MapProjectorInfo::MGRS;
+  projector_info.mgrs_grid = "54SUE";
+  const auto key = createLanelet2MapCacheKey(osm_path, projector_info, 5.0);
+  ASSERT_FALSE(key.empty());
+
+  autoware_auto_mapping_msgs::msg::HADMapBin expected;
+  expected.format_version = "1.0";
+  expected.map_version = "2";
+  expected.data = {0, 1, 2, 3, 255};
+  const auto cache_path = getLanelet2MapCachePath(osm_path);
+  ASSERT_TRUE(saveLanelet2MapCache(cache_path, key, expected));
+
+  autoware_auto_mapping_msgs::msg::HADMapBin result;
+  ASSERT_TRUE(loadLanelet2MapCache(cache_path, key, result));
+  EXPECT_EQ(result.format_version, expected.format_version);
+  EXPECT_EQ(result.map_version, expected.map_version);
+  EXPECT_EQ(result.data, expected.data);
+}
+
+TEST(Lanelet2MapCacheTest, KeyDependsOnFileAndParameters)
+{
+  const auto osm_path = writeDummyOsm("temp_key_map.osm", "<osm version=\"0.6\"></osm>");
+  tier4_map_msgs::msg::MapProjectorInfo projector_info;
+  projector_info.projector_type = tier4_map_msgs::msg::MapProjectorInfo::LOCAL_CARTESIAN_UTM;
+  projector_info.map_origin.latitude = 35.0;
+  projector_info.map_origin.longitude = 139.0;
+  const auto key = createLanelet2MapCacheKey(osm_path, projector_info, 5.0);
+  EXPECT_EQ(createLanelet2MapCacheKey(osm_path, projector_info, 5.0), key);
+  EXPECT_NE(createLanelet2MapCacheKey(osm_path, projector_info, 1.0), key);
+
+  auto moved_projector_info = projector_info;
+  moved_projector_info.map_origin.latitude = 35.000001;
+  EXPECT_NE(createLanelet2MapCacheKey(osm_path, moved_projector_info, 5.0), key);
+
+  writeDummyOsm("temp_key_map.osm", "<osm version=\"0.6\"><node/></osm>");
+  EXPECT_NE(createLanelet2MapCacheKey(osm_path, projector_info, 5.0), key);
+
+  EXPECT_TRUE(createLanelet2MapCacheKey(osm_path + ".missing", projector_info, 5.0).empty());
+}
+
+TEST(Lanelet2MapCacheTest, RejectInvalidCache)
+{
+  const std::string path =
+    (std::filesystem::temp_directory_path() / "temp_invalid_map.osmbin").string();
+  autoware_auto_mapping_msgs::msg::HADMapBin map_bin_msg;
+  map_bin_msg.data = {0, 1, 2};
+  ASSERT_TRUE(saveLanelet2MapCache(path, "key", map_bin_msg));
+
+  autoware_auto_mapping_msgs::msg::HADMapBin result;
+  EXPECT_FALSE(loadLanelet2MapCache(path, "another key", result));
+  EXPECT_TRUE(result.data.empty());
+
+  std::ofstream ofs(path);
+  ofs << "not a lanelet2 map cache";
+  ofs.close();
+  EXPECT_FALSE(loadLanelet2MapCache(path, "key", result));
+  EXPECT_FALSE(loadLanelet2MapCache(path + ".missing", "key", result));
+}
+
+TEST(Lanelet2MapCacheTest, Lanelet2MapCachePath)
+{
+  EXPECT_EQ(getLanelet2MapCachePath("/tmp/map/lanelet2_map.osm"), "/tmp/map/lanelet2_map.osmbin");
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleMock(&argc, argv);
+  return RUN_ALL_TESTS();
+}
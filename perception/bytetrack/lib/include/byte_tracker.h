@@ -78,8 +78,6 @@ private:
     int & dist_size_size);
   std::vector<std::vector<float>> iou_distance(
     std::vector<STrack> & atracks, std::vector<STrack> & btracks);
-  std::vector<std::vector<float>> ious(
-    std::vector<std::vector<float>> & atlbrs, std::vector<std::vector<float>> & btlbrs);
 
   double lapjv(
     const std::vector<std::vector<float>> & cost, std::vector<int> & rowsol,
@@ -97,4 +95,8 @@ private:
   std::vector<STrack> lost_stracks;
   std::vector<STrack> removed_stracks;
   KalmanFilter kalman_filter;
+
+  // buffers of lapjv reused in every association
+  std::vector<double> lapjv_cost_buffer_;
+  std::vector<double *> lapjv_cost_rows_;
 };
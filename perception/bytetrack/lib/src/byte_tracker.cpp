@@ -227,10 +227,10 @@ std::vector<STrack> ByteTracker::update(const std::vector<ByteTrackObject> & obj
     this->lost_stracks.push_back(lost_stracks[i]);
   }
 
-  this->lost_stracks = sub_stracks(this->lost_stracks, this->removed_stracks);
-  for (size_t i = 0; i < removed_stracks.size(); i++) {
-    this->removed_stracks.push_back(removed_stracks[i]);
-  }
+  // NOTE: A removed track never comes back to the tracked or lost tracks, so only the tracks
+  //       removed in this frame have to be subtracted, and the history is not kept.
+  this->lost_stracks = sub_stracks(this->lost_stracks, removed_stracks);
+  this->removed_stracks.swap(removed_stracks);
 
   remove_duplicate_stracks(resa, resb, this->tracked_stracks, this->lost_stracks);
 
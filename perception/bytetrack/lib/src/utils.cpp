@@ -39,7 +39,57 @@
 #include "byte_tracker.h"
 #include "lapjv.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <numeric>
+
+namespace
+{
+// Boxes in the structure of arrays, so that the IoU of a box with all the others is vectorized
+struct Boxes
+{
+  std::vector<float> x1, y1, x2, y2, area;
+
+  void push_back(const std::vector<float> & tlbr)
+  {
+    x1.push_back(tlbr[0]);
+    y1.push_back(tlbr[1]);
+    x2.push_back(tlbr[2]);
+    y2.push_back(tlbr[3]);
+    area.push_back((tlbr[2] - tlbr[0] + 1) * (tlbr[3] - tlbr[1] + 1));
+  }
+  size_t size() const { return x1.size(); }
+};
+
+std::vector<std::vector<float>> compute_iou_distance(const Boxes & a, const Boxes & b)
+{
+  std::vector<std::vector<float>> cost_matrix;
+  if (a.size() * b.size() == 0) return cost_matrix;
+
+  cost_matrix.resize(a.size());
+  for (size_t n = 0; n < a.size(); n++) {
+    std::vector<float> & row = cost_matrix[n];
+    row.resize(b.size());
+    const float ax1 = a.x1[n], ay1 = a.y1[n], ax2 = a.x2[n], ay2 = a.y2[n], a_area = a.area[n];
+    for (size_t k = 0; k < b.size(); k++) {
+      const float iw = std::max(std::min(ax2, b.x2[k]) - std::max(ax1, b.x1[k]) + 1, 0.0f);
+      const float ih = std::max(std::min(ay2, b.y2[k]) - std::max(ay1, b.y1[k]) + 1, 0.0f);
+      const float inter = iw * ih;
+      row[k] = inter > 0 ? 1 - inter / (a_area + b.area[k] - inter) : 1.0f;
+    }
+  }
+  return cost_matrix;
+}
+
+int find_root(std::vector<int> & parents, int i)
+{
+  while (parents[i] != i) {
+    parents[i] = parents[parents[i]];
+    i = parents[i];
+  }
+  return i;
+}
+}  // namespace
 
 std::vector<STrack *> ByteTracker::joint_stracks(
   std::vector<STrack *> & tlista, std::vector<STrack> & tlistb)
@@ -156,129 +206,109 @@ void ByteTracker::linear_assignment(
     return;
   }
 
-  std::vector<int> rowsol;
-  std::vector<int> colsol;
-  [[maybe_unused]] float c = lapjv(cost_matrix, rowsol, colsol, true, thresh);
-  for (size_t i = 0; i < rowsol.size(); i++) {
-    if (rowsol[i] >= 0) {
-      std::vector<int> match;
-      match.push_back(i);
-      match.push_back(rowsol[i]);
-      matches.push_back(match);
-    } else {
-      unmatched_a.push_back(i);
+  // With the extended cost of thresh / 2 for the unmatched rows and columns, only the pairs
+  // cheaper than thresh can be matched. So the rows and columns are split into the connected
+  // components of such pairs, and each component is solved separately.
+  const int n_rows = cost_matrix.size();
+  const int n_cols = cost_matrix[0].size();
+  std::vector<int> parents(n_rows + n_cols);
+  std::iota(parents.begin(), parents.end(), 0);
+  for (int i = 0; i < n_rows; i++) {
+    for (int j = 0; j < n_cols; j++) {
+      if (cost_matrix[i][j] < thresh) {
+        parents[find_root(parents, i)] = find_root(parents, n_rows + j);
+      }
     }
   }
-
-  for (size_t i = 0; i < colsol.size(); i++) {
-    if (colsol[i] < 0) {
-      unmatched_b.push_back(i);
-    }
+  std::vector<std::vector<int>> component_rows(n_rows + n_cols);
+  std::vector<std::vector<int>> component_cols(n_rows + n_cols);
+  for (int i = 0; i < n_rows; i++) {
+    component_rows[find_root(parents, i)].push_back(i);
   }
-}
-
-std::vector<std::vector<float>> ByteTracker::ious(
-  std::vector<std::vector<float>> & atlbrs, std::vector<std::vector<float>> & btlbrs)
-{
-  std::vector<std::vector<float>> ious;
-  if (atlbrs.size() * btlbrs.size() == 0) return ious;
-
-  ious.resize(atlbrs.size());
-  for (size_t i = 0; i < ious.size(); i++) {
-    ious[i].resize(btlbrs.size());
+  for (int j = 0; j < n_cols; j++) {
+    component_cols[find_root(parents, n_rows + j)].push_back(j);
   }
 
-  // bbox_ious
-  for (size_t k = 0; k < btlbrs.size(); k++) {
-    std::vector<float> ious_tmp;
-    float box_area = (btlbrs[k][2] - btlbrs[k][0] + 1) * (btlbrs[k][3] - btlbrs[k][1] + 1);
-    for (size_t n = 0; n < atlbrs.size(); n++) {
-      float iw = std::min(atlbrs[n][2], btlbrs[k][2]) - std::max(atlbrs[n][0], btlbrs[k][0]) + 1;
-      if (iw > 0) {
-        float ih = std::min(atlbrs[n][3], btlbrs[k][3]) - std::max(atlbrs[n][1], btlbrs[k][1]) + 1;
-        if (ih > 0) {
-          float ua = (atlbrs[n][2] - atlbrs[n][0] + 1) * (atlbrs[n][3] - atlbrs[n][1] + 1) +
-                     box_area - iw * ih;
-          ious[n][k] = iw * ih / ua;
-        } else {
-          ious[n][k] = 0.0;
-        }
-      } else {
-        ious[n][k] = 0.0;
+  std::vector<int> rowsol_all(n_rows, -1);
+  std::vector<int> colsol_all(n_cols, -1);
+  std::vector<std::vector<float>> sub_cost;
+  std::vector<int> rowsol;
+  std::vector<int> colsol;
+  for (size_t c = 0; c < component_rows.size(); c++) {
+    const auto & rows = component_rows[c];
+    const auto & cols = component_cols[c];
+    if (rows.empty() || cols.empty()) {
+      continue;
+    }
+    if (rows.size() == 1 && cols.size() == 1) {
+      rowsol_all[rows[0]] = cols[0];
+      colsol_all[cols[0]] = rows[0];
+      continue;
+    }
+    sub_cost.resize(rows.size());
+    for (size_t i = 0; i < rows.size(); i++) {
+      sub_cost[i].resize(cols.size());
+      for (size_t j = 0; j < cols.size(); j++) {
+        sub_cost[i][j] = cost_matrix[rows[i]][cols[j]];
+      }
+    }
+    lapjv(sub_cost, rowsol, colsol, true, thresh, false);
+    for (size_t i = 0; i < rows.size(); i++) {
+      if (rowsol[i] >= 0) {
+        rowsol_all[rows[i]] = cols[rowsol[i]];
+        colsol_all[cols[rowsol[i]]] = rows[i];
       }
     }
   }
 
-  return ious;
+  for (int i = 0; i < n_rows; i++) {
+    if (rowsol_all[i] >= 0) {
+      matches.push_back({i, rowsol_all[i]});
+    } else {
+      unmatched_a.push_back(i);
+    }
+  }
+  for (int j = 0; j < n_cols; j++) {
+    if (colsol_all[j] < 0) {
+      unmatched_b.push_back(j);
+    }
+  }
 }
 
 std::vector<std::vector<float>> ByteTracker::iou_distance(
   std::vector<STrack *> & atracks, std::vector<STrack> & btracks, int & dist_size,
   int & dist_size_size)
 {
-  std::vector<std::vector<float>> cost_matrix;
-  if (atracks.size() * btracks.size() == 0) {
-    dist_size = atracks.size();
-    dist_size_size = btracks.size();
-    return cost_matrix;
-  }
-  std::vector<std::vector<float>> atlbrs, btlbrs;
+  dist_size = atracks.size();
+  dist_size_size = btracks.size();
+
+  Boxes atlbrs, btlbrs;
   for (size_t i = 0; i < atracks.size(); i++) {
     atlbrs.push_back(atracks[i]->tlbr);
   }
   for (size_t i = 0; i < btracks.size(); i++) {
     btlbrs.push_back(btracks[i].tlbr);
   }
-
-  dist_size = atracks.size();
-  dist_size_size = btracks.size();
-
-  std::vector<std::vector<float>> _ious = ious(atlbrs, btlbrs);
-
-  for (size_t i = 0; i < _ious.size(); i++) {
-    std::vector<float> _iou;
-    for (size_t j = 0; j < _ious[i].size(); j++) {
-      _iou.push_back(1 - _ious[i][j]);
-    }
-    cost_matrix.push_back(_iou);
-  }
-
-  return cost_matrix;
+  return compute_iou_distance(atlbrs, btlbrs);
 }
 
 std::vector<std::vector<float>> ByteTracker::iou_distance(
   std::vector<STrack> & atracks, std::vector<STrack> & btracks)
 {
-  std::vector<std::vector<float>> atlbrs, btlbrs;
+  Boxes atlbrs, btlbrs;
   for (size_t i = 0; i < atracks.size(); i++) {
     atlbrs.push_back(atracks[i].tlbr);
   }
   for (size_t i = 0; i < btracks.size(); i++) {
     btlbrs.push_back(btracks[i].tlbr);
   }
-
-  std::vector<std::vector<float>> _ious = ious(atlbrs, btlbrs);
-  std::vector<std::vector<float>> cost_matrix;
-  for (size_t i = 0; i < _ious.size(); i++) {
-    std::vector<float> _iou;
-    for (size_t j = 0; j < _ious[i].size(); j++) {
-      _iou.push_back(1 - _ious[i][j]);
-    }
-    cost_matrix.push_back(_iou);
-  }
-
-  return cost_matrix;
+  return compute_iou_distance(atlbrs, btlbrs);
 }
 
 double ByteTracker::lapjv(
   const std::vector<std::vector<float>> & cost, std::vector<int> & rowsol,
   std::vector<int> & colsol, bool extend_cost, float cost_limit, bool return_cost)
 {
-  std::vector<std::vector<float>> cost_c;
-  cost_c.assign(cost.begin(), cost.end());
-
-  std::vector<std::vector<float>> cost_c_extended;
-
   int n_rows = cost.size();
   int n_cols = cost[0].size();
   rowsol.resize(n_rows);
@@ -295,60 +325,39 @@ double ByteTracker::lapjv(
     }
   }
 
+  // The cost matrix is stored in one buffer, which is reused in every call
+  double fill_cost = 0.0;
   if (extend_cost || cost_limit < LONG_MAX) {
     n = n_rows + n_cols;
-    cost_c_extended.resize(n);
-    for (size_t i = 0; i < cost_c_extended.size(); i++) cost_c_extended[i].resize(n);
-
     if (cost_limit < LONG_MAX) {
-      for (size_t i = 0; i < cost_c_extended.size(); i++) {
-        for (size_t j = 0; j < cost_c_extended[i].size(); j++) {
-          cost_c_extended[i][j] = cost_limit / 2.0;
-        }
-      }
+      fill_cost = cost_limit / 2.0;
     } else {
       float cost_max = -1;
-      for (size_t i = 0; i < cost_c.size(); i++) {
-        for (size_t j = 0; j < cost_c[i].size(); j++) {
-          if (cost_c[i][j] > cost_max) cost_max = cost_c[i][j];
+      for (size_t i = 0; i < cost.size(); i++) {
+        for (size_t j = 0; j < cost[i].size(); j++) {
+          if (cost[i][j] > cost_max) cost_max = cost[i][j];
         }
       }
-      for (size_t i = 0; i < cost_c_extended.size(); i++) {
-        for (size_t j = 0; j < cost_c_extended[i].size(); j++) {
-          cost_c_extended[i][j] = cost_max + 1;
-        }
-      }
-    }
-
-    for (size_t i = n_rows; i < cost_c_extended.size(); i++) {
-      for (size_t j = n_cols; j < cost_c_extended[i].size(); j++) {
-        cost_c_extended[i][j] = 0;
-      }
+      fill_cost = cost_max + 1;
     }
-    for (int i = 0; i < n_rows; i++) {
-      for (int j = 0; j < n_cols; j++) {
-        cost_c_extended[i][j] = cost_c[i][j];
-      }
-    }
-
-    cost_c.clear();
-    cost_c.assign(cost_c_extended.begin(), cost_c_extended.end());
   }
-
-  double ** cost_ptr;
-  cost_ptr = new double *[sizeof(double *) * n];
-  for (int i = 0; i < n; i++) cost_ptr[i] = new double[sizeof(double) * n];
-
+  lapjv_cost_buffer_.assign(static_cast<size_t>(n) * n, fill_cost);
+  lapjv_cost_rows_.resize(n);
   for (int i = 0; i < n; i++) {
-    for (int j = 0; j < n; j++) {
-      cost_ptr[i][j] = cost_c[i][j];
+    double * row = lapjv_cost_buffer_.data() + static_cast<size_t>(i) * n;
+    lapjv_cost_rows_[i] = row;
+    if (i < n_rows) {
+      std::copy(cost[i].begin(), cost[i].end(), row);
+    } else {
+      std::fill(row + n_cols, row + n, 0.0);
     }
   }
+  double ** cost_ptr = lapjv_cost_rows_.data();
 
-  int * x_c = new int[sizeof(int) * n];
-  int * y_c = new int[sizeof(int) * n];
+  std::vector<int_t> x_c(n);
+  std::vector<int_t> y_c(n);
 
-  int ret = lapjv_internal(n, cost_ptr, x_c, y_c);
+  int ret = lapjv_internal(n, cost_ptr, x_c.data(), y_c.data());
   if (ret != 0) {
     std::cout << "Calculate Wrong!" << std::endl;
     // system("pause");
@@ -382,13 +391,6 @@ double ByteTracker::lapjv(
     }
   }
 
-  for (int i = 0; i < n; i++) {
-    delete[] cost_ptr[i];
-  }
-  delete[] cost_ptr;
-  delete[] x_c;
-  delete[] y_c;
-
   return opt;
 }
 
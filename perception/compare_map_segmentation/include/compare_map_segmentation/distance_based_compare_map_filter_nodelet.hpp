@@ -75,11 +75,11 @@ public:
     auto map_cell_voxel_input_tmp_ptr =
       std::make_shared<pcl::PointCloud<pcl::PointXYZ>>(map_cell_pc_tmp);
 
-    MapGridVoxelInfo current_voxel_grid_list_item;
-    current_voxel_grid_list_item.min_b_x = map_cell_to_add.metadata.min_x;
-    current_voxel_grid_list_item.min_b_y = map_cell_to_add.metadata.min_y;
-    current_voxel_grid_list_item.max_b_x = map_cell_to_add.metadata.max_x;
-    current_voxel_grid_list_item.max_b_y = map_cell_to_add.metadata.max_y;
+    auto current_voxel_grid_list_item = std::make_shared<MapGridVoxelInfo>();
+    current_voxel_grid_list_item->min_b_x = map_cell_to_add.metadata.min_x;
+    current_voxel_grid_list_item->min_b_y = map_cell_to_add.metadata.min_y;
+    current_voxel_grid_list_item->max_b_x = map_cell_to_add.metadata.max_x;
+    current_voxel_grid_list_item->max_b_y = map_cell_to_add.metadata.max_y;
 
     // add kdtree
     pcl::search::Search<pcl::PointXYZ>::Ptr tree_tmp;
@@ -91,12 +91,10 @@ public:
       }
     }
     tree_tmp->setInputCloud(map_cell_voxel_input_tmp_ptr);
-    current_voxel_grid_list_item.map_cell_kdtree = tree_tmp;
+    current_voxel_grid_list_item->map_cell_kdtree = tree_tmp;
 
     // add
-    (*mutex_ptr_).lock();
     current_voxel_grid_dict_.insert({map_cell_to_add.cell_id, current_voxel_grid_list_item});
-    (*mutex_ptr_).unlock();
   }
 };
 
@@ -90,19 +90,17 @@ public:
     map_cell_voxel_grid_tmp.setSaveLeafLayout(true);
     map_cell_voxel_grid_tmp.filter(*map_cell_downsampled_pc_ptr_tmp);
 
-    MapGridVoxelInfo current_voxel_grid_list_item;
-    current_voxel_grid_list_item.min_b_x = map_cell_to_add.metadata.min_x;
-    current_voxel_grid_list_item.min_b_y = map_cell_to_add.metadata.min_y;
-    current_voxel_grid_list_item.max_b_x = map_cell_to_add.metadata.max_x;
-    current_voxel_grid_list_item.max_b_y = map_cell_to_add.metadata.max_y;
+    auto current_voxel_grid_list_item = std::make_shared<MapGridVoxelInfo>();
+    current_voxel_grid_list_item->min_b_x = map_cell_to_add.metadata.min_x;
+    current_voxel_grid_list_item->min_b_y = map_cell_to_add.metadata.min_y;
+    current_voxel_grid_list_item->max_b_x = map_cell_to_add.metadata.max_x;
+    current_voxel_grid_list_item->max_b_y = map_cell_to_add.metadata.max_y;
 
-    current_voxel_grid_list_item.map_cell_voxel_grid.set_voxel_grid(
-      &(map_cell_voxel_grid_tmp.leaf_layout_), map_cell_voxel_grid_tmp.get_min_b(),
-      map_cell_voxel_grid_tmp.get_max_b(), map_cell_voxel_grid_tmp.get_div_b(),
-      map_cell_voxel_grid_tmp.get_divb_mul(), map_cell_voxel_grid_tmp.get_inverse_leaf_size());
+    current_voxel_grid_list_item->map_cell_voxel_key_map.build(
+      map_cell_voxel_grid_tmp.leaf_layout_, map_cell_voxel_grid_tmp.get_min_b(),
+      map_cell_voxel_grid_tmp.get_div_b(), map_cell_voxel_grid_tmp.get_inverse_leaf_size());
 
-    current_voxel_grid_list_item.map_cell_pc_ptr.reset(new pcl::PointCloud<pcl::PointXYZ>);
-    current_voxel_grid_list_item.map_cell_pc_ptr = std::move(map_cell_downsampled_pc_ptr_tmp);
+    current_voxel_grid_list_item->map_cell_pc_ptr = std::move(map_cell_downsampled_pc_ptr_tmp);
 
     // add kdtree
     pcl::search::Search<pcl::PointXYZ>::Ptr tree_tmp;
@@ -114,12 +112,10 @@ public:
       }
     }
     tree_tmp->setInputCloud(map_cell_voxel_input_tmp_ptr);
-    current_voxel_grid_list_item.map_cell_kdtree = tree_tmp;
+    current_voxel_grid_list_item->map_cell_kdtree = tree_tmp;
 
     // add
-    (*mutex_ptr_).lock();
     current_voxel_grid_dict_.insert({map_cell_to_add.cell_id, current_voxel_grid_list_item});
-    (*mutex_ptr_).unlock();
   }
 };
 
@@ -15,6 +15,8 @@
 #ifndef COMPARE_MAP_SEGMENTATION__VOXEL_GRID_MAP_LOADER_HPP_
 #define COMPARE_MAP_SEGMENTATION__VOXEL_GRID_MAP_LOADER_HPP_
 
+#include "compare_map_segmentation/voxel_key_map.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_map_msgs/srv/get_differential_point_cloud_map.hpp>
@@ -26,8 +28,12 @@
 #include <pcl/search/pcl_search.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <algorithm>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <utility>
@@ -68,19 +74,6 @@ protected:
 public:
   using pcl::VoxelGrid<PointT>::leaf_layout_;
 
-  inline void set_voxel_grid(
-    std::vector<int> * leaf_layout, const Eigen::Vector4i & min_b, const Eigen::Vector4i & max_b,
-    const Eigen::Vector4i & div_b, const Eigen::Vector4i & divb_mul,
-    const Eigen::Array4f & inverse_leaf_size)
-  {
-    leaf_layout_ = std::move(*leaf_layout);
-    min_b_ = min_b;
-    max_b_ = max_b;
-    div_b_ = div_b;
-    divb_mul_ = divb_mul;
-    inverse_leaf_size_ = inverse_leaf_size;
-  }
-
   inline Eigen::Vector4i get_min_b() const { return min_b_; }
   inline Eigen::Vector4i get_divb_mul() const { return divb_mul_; }
   inline Eigen::Vector4i get_max_b() const { return max_b_; }
@@ -107,17 +100,21 @@ public:
   explicit VoxelGridMapLoader(
     rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
     std::string * tf_map_input_frame, std::mutex * mutex);
+  virtual ~VoxelGridMapLoader() = default;
 
   virtual bool is_close_to_map(const pcl::PointXYZ & point, const double distance_threshold) = 0;
   bool is_close_to_neighbor_voxels(
-    const pcl::PointXYZ & point, const double distance_threshold, VoxelGridPointXYZ & voxel,
-    pcl::search::Search<pcl::PointXYZ>::Ptr tree) const;
+    const pcl::PointXYZ & point, const double distance_threshold,
+    const VoxelKeyMap & voxel_key_map, pcl::search::Search<pcl::PointXYZ>::Ptr tree) const;
+  /** \brief Check the voxel of the point and its 26 neighbor voxels, whose leaf size is the
+   * distance threshold
+   */
   bool is_close_to_neighbor_voxels(
     const pcl::PointXYZ & point, const double distance_threshold, const PointCloudPtr & map,
-    VoxelGridPointXYZ & voxel) const;
+    const VoxelKeyMap & voxel_key_map) const;
   bool is_in_voxel(
-    const pcl::PointXYZ & src_point, const pcl::PointXYZ & target_point,
-    const double distance_threshold, const PointCloudPtr & map, VoxelGridPointXYZ & voxel) const;
+    const int voxel_index, const pcl::PointXYZ & target_point, const double distance_threshold,
+    const PointCloudPtr & map) const;
 
   void publish_downsampled_map(const pcl::PointCloud<pcl::PointXYZ> & downsampled_pc);
   bool is_close_points(
@@ -131,6 +128,7 @@ class VoxelGridStaticMapLoader : public VoxelGridMapLoader
 protected:
   rclcpp::Subscription<sensor_msgs::msg::PointCloud2>::SharedPtr sub_map_;
   VoxelGridPointXYZ voxel_grid_;
+  VoxelKeyMap voxel_key_map_;
   PointCloudPtr voxel_map_ptr_;
 
 public:
@@ -146,23 +144,34 @@ class VoxelGridDynamicMapLoader : public VoxelGridMapLoader
 protected:
   struct MapGridVoxelInfo
   {
-    VoxelGridPointXYZ map_cell_voxel_grid;
+    VoxelKeyMap map_cell_voxel_key_map;
     PointCloudPtr map_cell_pc_ptr;
     float min_b_x, min_b_y, max_b_x, max_b_y;
     pcl::search::Search<pcl::PointXYZ>::Ptr map_cell_kdtree;
   };
 
-  typedef typename std::map<std::string, struct MapGridVoxelInfo> VoxelGridDict;
+  typedef typename std::map<std::string, std::shared_ptr<MapGridVoxelInfo>> VoxelGridDict;
 
-  /** \brief Map to hold loaded map grid id and it's voxel filter */
+  /** \brief Map to hold loaded map grid id and it's voxel filter, only used by the map update */
   VoxelGridDict current_voxel_grid_dict_;
+  /** \brief Map grids removed from current_voxel_grid_dict_, to reuse them without filtering the
+   * map cell again when they are loaded again. The most recently removed first.
+   */
+  std::list<std::pair<std::string, std::shared_ptr<MapGridVoxelInfo>>> removed_voxel_grid_list_;
+  size_t max_cached_map_cells_;
   rclcpp::Subscription<nav_msgs::msg::Odometry>::SharedPtr sub_kinematic_state_;
 
+  std::mutex kinematic_state_mutex_;
   std::optional<geometry_msgs::msg::Point> current_position_ = std::nullopt;
+  /** \brief Ego velocity in the map frame */
+  geometry_msgs::msg::Vector3 current_velocity_;
+  /** \brief Center and radius of the area requested at the last map update */
   std::optional<geometry_msgs::msg::Point> last_updated_position_ = std::nullopt;
+  double last_updated_radius_ = 0.0;
   rclcpp::TimerBase::SharedPtr map_update_timer_;
   double map_update_distance_threshold_;
   double map_loader_radius_;
+  double map_prefetch_time_;
   rclcpp::Client<autoware_map_msgs::srv::GetDifferentialPointCloudMap>::SharedPtr
     map_update_client_;
   rclcpp::CallbackGroup::SharedPtr client_callback_group_;
@@ -176,6 +185,8 @@ protected:
   double origin_y_remainder_ = 0.0;
 
   /** \brief Array to hold loaded map grid positions for fast map grid searching.
+   * It is swapped with a new one under the mutex at each map update, so that the filter only waits
+   * for the swap.
    */
   std::vector<std::shared_ptr<MapGridVoxelInfo>> current_voxel_grid_array_;
 
@@ -197,8 +208,8 @@ public:
   void onEstimatedPoseCallback(nav_msgs::msg::Odometry::ConstSharedPtr pose);
 
   void timer_callback();
-  bool should_update_map() const;
-  void request_update_map(const geometry_msgs::msg::Point & position);
+  bool should_update_map(const geometry_msgs::msg::Point & position) const;
+  void request_update_map(const geometry_msgs::msg::Point & position, const double radius);
   virtual bool is_close_to_map(const pcl::PointXYZ & point, const double distance_threshold);
   /** \brief Check if point close to map pointcloud in the */
   bool is_close_to_next_map_grid(
@@ -208,7 +219,7 @@ public:
   {
     pcl::PointCloud<pcl::PointXYZ> output;
     for (const auto & kv : current_voxel_grid_dict_) {
-      output = output + *(kv.second.map_cell_pc_ptr);
+      output = output + *(kv.second->map_cell_pc_ptr);
     }
     return output;
   }
@@ -225,7 +236,9 @@ public:
     std::vector<std::string> map_cell_ids_to_remove)
   {
     for (const auto & map_cell_to_add : map_cells_to_add) {
-      addMapCellAndFilter(map_cell_to_add);
+      if (!reuseRemovedMapCell(map_cell_to_add.cell_id)) {
+        addMapCellAndFilter(map_cell_to_add);
+      }
     }
     for (size_t i = 0; i < map_cell_ids_to_remove.size(); ++i) {
       removeMapCell(map_cell_ids_to_remove.at(i));
@@ -237,43 +250,72 @@ public:
   /** Update loaded map grid array for fast searching*/
   virtual inline void updateVoxelGridArray()
   {
-    origin_x_ = std::floor((current_position_.value().x - map_loader_radius_) / map_grid_size_x_) *
-                  map_grid_size_x_ +
-                origin_x_remainder_;
-    origin_y_ = std::floor((current_position_.value().y - map_loader_radius_) / map_grid_size_y_) *
-                  map_grid_size_y_ +
-                origin_y_remainder_;
-
-    map_grids_x_ = static_cast<int>(
-      std::ceil((current_position_.value().x + map_loader_radius_ - origin_x_) / map_grid_size_x_));
-    map_grids_y_ = static_cast<int>(
-      std::ceil((current_position_.value().y + map_loader_radius_ - origin_y_) / map_grid_size_y_));
-
-    if (map_grids_x_ * map_grids_y_ == 0) {
+    const auto & center = last_updated_position_.value();
+    const float origin_x =
+      std::floor((center.x - last_updated_radius_) / map_grid_size_x_) * map_grid_size_x_ +
+      origin_x_remainder_;
+    const float origin_y =
+      std::floor((center.y - last_updated_radius_) / map_grid_size_y_) * map_grid_size_y_ +
+      origin_y_remainder_;
+
+    const int map_grids_x =
+      static_cast<int>(std::ceil((center.x + last_updated_radius_ - origin_x) / map_grid_size_x_));
+    const int map_grids_y =
+      static_cast<int>(std::ceil((center.y + last_updated_radius_ - origin_y) / map_grid_size_y_));
+
+    if (map_grids_x * map_grids_y <= 0) {
       return;
     }
 
-    (*mutex_ptr_).lock();
-    current_voxel_grid_array_.assign(
-      map_grids_x_ * map_grid_size_y_, std::make_shared<MapGridVoxelInfo>());
+    // build the new array without blocking the filter, the map grids are shared with it
+    std::vector<std::shared_ptr<MapGridVoxelInfo>> voxel_grid_array(map_grids_x * map_grids_y);
     for (const auto & kv : current_voxel_grid_dict_) {
       int index = static_cast<int>(
-        std::floor((kv.second.min_b_x - origin_x_) / map_grid_size_x_) +
-        map_grids_x_ * std::floor((kv.second.min_b_y - origin_y_) / map_grid_size_y_));
+        std::floor((kv.second->min_b_x - origin_x) / map_grid_size_x_) +
+        map_grids_x * std::floor((kv.second->min_b_y - origin_y) / map_grid_size_y_));
       // TODO(1222-takeshi): check if index is valid
-      if (index >= map_grids_x_ * map_grids_y_ || index < 0) {
+      if (index >= map_grids_x * map_grids_y || index < 0) {
         continue;
       }
-      current_voxel_grid_array_.at(index) = std::make_shared<MapGridVoxelInfo>(kv.second);
+      voxel_grid_array.at(index) = kv.second;
     }
+
+    (*mutex_ptr_).lock();
+    current_voxel_grid_array_.swap(voxel_grid_array);
+    origin_x_ = origin_x;
+    origin_y_ = origin_y;
+    map_grids_x_ = map_grids_x;
+    map_grids_y_ = map_grids_y;
     (*mutex_ptr_).unlock();
   }
 
   inline void removeMapCell(const std::string map_cell_id_to_remove)
   {
-    (*mutex_ptr_).lock();
-    current_voxel_grid_dict_.erase(map_cell_id_to_remove);
-    (*mutex_ptr_).unlock();
+    const auto map_cell = current_voxel_grid_dict_.find(map_cell_id_to_remove);
+    if (map_cell == current_voxel_grid_dict_.end()) {
+      return;
+    }
+    if (max_cached_map_cells_ > 0) {
+      removed_voxel_grid_list_.emplace_front(map_cell->first, map_cell->second);
+      if (removed_voxel_grid_list_.size() > max_cached_map_cells_) {
+        removed_voxel_grid_list_.pop_back();
+      }
+    }
+    current_voxel_grid_dict_.erase(map_cell);
+  }
+
+  /** \brief Move back a removed map grid of the map cell to the loaded ones if it is kept */
+  inline bool reuseRemovedMapCell(const std::string & map_cell_id)
+  {
+    const auto removed_map_cell = std::find_if(
+      removed_voxel_grid_list_.begin(), removed_voxel_grid_list_.end(),
+      [&map_cell_id](const auto & removed) { return removed.first == map_cell_id; });
+    if (removed_map_cell == removed_voxel_grid_list_.end()) {
+      return false;
+    }
+    current_voxel_grid_dict_.insert({map_cell_id, removed_map_cell->second});
+    removed_voxel_grid_list_.erase(removed_map_cell);
+    return true;
   }
 
   virtual inline void addMapCellAndFilter(
@@ -299,23 +341,19 @@ public:
     map_cell_voxel_grid_tmp.setSaveLeafLayout(true);
     map_cell_voxel_grid_tmp.filter(*map_cell_downsampled_pc_ptr_tmp);
 
-    MapGridVoxelInfo current_voxel_grid_list_item;
-    current_voxel_grid_list_item.min_b_x = map_cell_to_add.metadata.min_x;
-    current_voxel_grid_list_item.min_b_y = map_cell_to_add.metadata.min_y;
-    current_voxel_grid_list_item.max_b_x = map_cell_to_add.metadata.max_x;
-    current_voxel_grid_list_item.max_b_y = map_cell_to_add.metadata.max_y;
+    auto current_voxel_grid_list_item = std::make_shared<MapGridVoxelInfo>();
+    current_voxel_grid_list_item->min_b_x = map_cell_to_add.metadata.min_x;
+    current_voxel_grid_list_item->min_b_y = map_cell_to_add.metadata.min_y;
+    current_voxel_grid_list_item->max_b_x = map_cell_to_add.metadata.max_x;
+    current_voxel_grid_list_item->max_b_y = map_cell_to_add.metadata.max_y;
 
-    current_voxel_grid_list_item.map_cell_voxel_grid.set_voxel_grid(
-      &(map_cell_voxel_grid_tmp.leaf_layout_), map_cell_voxel_grid_tmp.get_min_b(),
-      map_cell_voxel_grid_tmp.get_max_b(), map_cell_voxel_grid_tmp.get_div_b(),
-      map_cell_voxel_grid_tmp.get_divb_mul(), map_cell_voxel_grid_tmp.get_inverse_leaf_size());
+    current_voxel_grid_list_item->map_cell_voxel_key_map.build(
+      map_cell_voxel_grid_tmp.leaf_layout_, map_cell_voxel_grid_tmp.get_min_b(),
+      map_cell_voxel_grid_tmp.get_div_b(), map_cell_voxel_grid_tmp.get_inverse_leaf_size());
 
-    current_voxel_grid_list_item.map_cell_pc_ptr.reset(new pcl::PointCloud<pcl::PointXYZ>);
-    current_voxel_grid_list_item.map_cell_pc_ptr = std::move(map_cell_downsampled_pc_ptr_tmp);
+    current_voxel_grid_list_item->map_cell_pc_ptr = std::move(map_cell_downsampled_pc_ptr_tmp);
     // add
-    (*mutex_ptr_).lock();
     current_voxel_grid_dict_.insert({map_cell_to_add.cell_id, current_voxel_grid_list_item});
-    (*mutex_ptr_).unlock();
   }
 };
 
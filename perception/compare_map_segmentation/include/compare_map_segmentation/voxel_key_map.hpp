@@ -0,0 +1,121 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef COMPARE_MAP_SEGMENTATION__VOXEL_KEY_MAP_HPP_
+#define COMPARE_MAP_SEGMENTATION__VOXEL_KEY_MAP_HPP_
+
+#include <Eigen/Core>
+
+#include <pcl/point_types.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief flat open addressing hash map from the voxels occupied by a downsampled map to the
+ * indices of their centroids, which replaces the dense leaf layout of pcl::VoxelGrid
+ * @details a voxel key packs the voxel coordinates relative to the map into bit fields, and the
+ * field of a coordinate out of the map is invalid_key, so that the key of any combination of the
+ * fields is made by OR and is invalid_key if one of them is out of the map
+ */
+class VoxelKeyMap
+{
+public:
+  using Key = uint64_t;
+  static constexpr Key invalid_key = std::numeric_limits<Key>::max();
+
+  /**
+   * @brief build the map from the leaf layout of pcl::VoxelGrid filtered with
+   * setSaveLeafLayout(true), the arguments are the ones of the voxel grid
+   */
+  void build(
+    const std::vector<int> & leaf_layout, const Eigen::Vector4i & min_b,
+    const Eigen::Vector4i & div_b, const Eigen::Array4f & inverse_leaf_size);
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+
+  // the same voxel coordinates as pcl::VoxelGrid::getGridCoordinates()
+  Key getFieldX(const float x) const
+  {
+    return getField(x * inverse_leaf_size_x_, min_b_x_, div_b_x_, 0);
+  }
+  Key getFieldY(const float y) const
+  {
+    return getField(y * inverse_leaf_size_y_, min_b_y_, div_b_y_, shift_y_);
+  }
+  Key getFieldZ(const float z) const
+  {
+    return getField(z * inverse_leaf_size_z_, min_b_z_, div_b_z_, shift_z_);
+  }
+  Key getKey(const pcl::PointXYZ & point) const
+  {
+    return getFieldX(point.x) | getFieldY(point.y) | getFieldZ(point.z);
+  }
+
+  /// @brief index of the centroid in the voxel, or -1 if the voxel is empty or the key is invalid
+  int find(const Key key) const
+  {
+    if (key == invalid_key || size_ == 0) {
+      return -1;
+    }
+    for (size_t slot = hash(key);; slot = (slot + 1) & slot_mask_) {
+      if (keys_[slot] == key) {
+        return centroid_indices_[slot];
+      }
+      if (keys_[slot] == invalid_key) {
+        return -1;
+      }
+    }
+  }
+  int find(const pcl::PointXYZ & point) const { return find(getKey(point)); }
+
+private:
+  static Key getField(
+    const float scaled_coordinate, const int min_b, const int div_b, const int shift)
+  {
+    const int64_t coordinate = static_cast<int>(std::floor(scaled_coordinate)) - int64_t{min_b};
+    if (coordinate < 0 || coordinate >= div_b) {
+      return invalid_key;
+    }
+    return static_cast<Key>(coordinate) << shift;
+  }
+  size_t hash(const Key key) const
+  {
+    // Fibonacci hashing, the upper bits are the best mixed
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> hash_shift_);
+  }
+
+  std::vector<Key> keys_;
+  std::vector<int> centroid_indices_;
+  size_t size_{0};
+  size_t slot_mask_{0};
+  int hash_shift_{64};
+
+  float inverse_leaf_size_x_{0.0f};
+  float inverse_leaf_size_y_{0.0f};
+  float inverse_leaf_size_z_{0.0f};
+  int min_b_x_{0};
+  int min_b_y_{0};
+  int min_b_z_{0};
+  int div_b_x_{0};
+  int div_b_y_{0};
+  int div_b_z_{0};
+  int shift_y_{0};
+  int shift_z_{0};
+};
+
+#endif  // COMPARE_MAP_SEGMENTATION__VOXEL_KEY_MAP_HPP_
@@ -72,7 +72,7 @@ bool DistanceBasedStaticMapLoader::is_close_to_map(
 bool DistanceBasedDynamicMapLoader::is_close_to_map(
   const pcl::PointXYZ & point, const double distance_threshold)
 {
-  if (current_voxel_grid_dict_.size() == 0) {
+  if (current_voxel_grid_array_.empty()) {
     return false;
   }
   if (!isFinite(point)) {
@@ -29,8 +29,7 @@ bool VoxelBasedApproximateStaticMapLoader::is_close_to_map(
   if (voxel_map_ptr_ == NULL) {
     return false;
   }
-  const int index =
-    voxel_grid_.getCentroidIndexAt(voxel_grid_.getGridCoordinates(point.x, point.y, point.z));
+  const int index = voxel_key_map_.find(point);
   if (index == -1) {
     return false;
   } else {
@@ -41,7 +40,7 @@ bool VoxelBasedApproximateStaticMapLoader::is_close_to_map(
 bool VoxelBasedApproximateDynamicMapLoader::is_close_to_map(
   const pcl::PointXYZ & point, [[maybe_unused]] const double distance_threshold)
 {
-  if (current_voxel_grid_dict_.size() == 0) {
+  if (current_voxel_grid_array_.empty()) {
     return false;
   }
 
@@ -53,10 +52,8 @@ bool VoxelBasedApproximateDynamicMapLoader::is_close_to_map(
     return false;
   }
   if (current_voxel_grid_array_.at(map_grid_index) != NULL) {
-    const int index = current_voxel_grid_array_.at(map_grid_index)
-                        ->map_cell_voxel_grid.getCentroidIndexAt(
-                          current_voxel_grid_array_.at(map_grid_index)
-                            ->map_cell_voxel_grid.getGridCoordinates(point.x, point.y, point.z));
+    const int index =
+      current_voxel_grid_array_.at(map_grid_index)->map_cell_voxel_key_map.find(point);
     if (index == -1) {
       return false;
     } else {
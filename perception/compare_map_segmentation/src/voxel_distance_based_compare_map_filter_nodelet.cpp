@@ -39,6 +39,11 @@ void VoxelDistanceBasedStaticMapLoader::onMapCallback(
   voxel_grid_.setInputCloud(map_pcl_ptr);
   voxel_grid_.setSaveLeafLayout(true);
   voxel_grid_.filter(*voxel_map_ptr_);
+  voxel_key_map_.build(
+    voxel_grid_.leaf_layout_, voxel_grid_.get_min_b(), voxel_grid_.get_div_b(),
+    voxel_grid_.get_inverse_leaf_size());
+  // the dense leaf layout is not used anymore
+  std::vector<int>().swap(voxel_grid_.leaf_layout_);
   // kdtree
   map_ptr_ = map_pcl_ptr;
 
@@ -65,7 +70,7 @@ bool VoxelDistanceBasedStaticMapLoader::is_close_to_map(
   if (tree_ == NULL) {
     return false;
   }
-  if (is_close_to_neighbor_voxels(point, distance_threshold, voxel_grid_, tree_)) {
+  if (is_close_to_neighbor_voxels(point, distance_threshold, voxel_key_map_, tree_)) {
     return true;
   }
   return false;
@@ -74,7 +79,7 @@ bool VoxelDistanceBasedStaticMapLoader::is_close_to_map(
 bool VoxelDistanceBasedDynamicMapLoader::is_close_to_map(
   const pcl::PointXYZ & point, const double distance_threshold)
 {
-  if (current_voxel_grid_dict_.size() == 0) {
+  if (current_voxel_grid_array_.empty()) {
     return false;
   }
 
@@ -88,7 +93,8 @@ bool VoxelDistanceBasedDynamicMapLoader::is_close_to_map(
   if (
     current_voxel_grid_array_.at(map_grid_index) != NULL &&
     is_close_to_neighbor_voxels(
-      point, distance_threshold, current_voxel_grid_array_.at(map_grid_index)->map_cell_voxel_grid,
+      point, distance_threshold,
+      current_voxel_grid_array_.at(map_grid_index)->map_cell_voxel_key_map,
       current_voxel_grid_array_.at(map_grid_index)->map_cell_kdtree)) {
     return true;
   }
@@ -14,6 +14,10 @@
 
 #include "compare_map_segmentation/voxel_grid_map_loader.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 VoxelGridMapLoader::VoxelGridMapLoader(
   rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
   std::string * tf_map_input_frame, std::mutex * mutex)
@@ -49,10 +53,10 @@ void VoxelGridMapLoader::publish_downsampled_map(
 }
 
 bool VoxelGridMapLoader::is_close_to_neighbor_voxels(
-  const pcl::PointXYZ & point, const double distance_threshold, VoxelGridPointXYZ & voxel,
+  const pcl::PointXYZ & point, const double distance_threshold, const VoxelKeyMap & voxel_key_map,
   pcl::search::Search<pcl::PointXYZ>::Ptr tree) const
 {
-  const int index = voxel.getCentroidIndexAt(voxel.getGridCoordinates(point.x, point.y, point.z));
+  const int index = voxel_key_map.find(point);
   if (index != -1) {
     return true;
   }
@@ -69,184 +73,58 @@ bool VoxelGridMapLoader::is_close_to_neighbor_voxels(
 
 bool VoxelGridMapLoader::is_close_to_neighbor_voxels(
   const pcl::PointXYZ & point, const double distance_threshold, const PointCloudPtr & map,
-  VoxelGridPointXYZ & voxel) const
+  const VoxelKeyMap & voxel_key_map) const
 {
   // check map downsampled pc
   double distance_threshold_z = downsize_ratio_z_axis_ * distance_threshold;
   if (map == NULL) {
     return false;
   }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y, point.z), point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y, point.z - distance_threshold_z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y, point.z + distance_threshold_z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y - distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y - distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y - distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y + distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x - distance_threshold, point.y + distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x - distance_threshold, point.y + distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y - distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y - distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y - distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z - distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z), point, distance_threshold,
-        map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z + distance_threshold_z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y + distance_threshold,
-          point.z - distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(point.x + distance_threshold, point.y + distance_threshold, point.z), point,
-        distance_threshold, map, voxel)) {
-    return true;
-  }
-  if (is_in_voxel(
-        pcl::PointXYZ(
-          point.x + distance_threshold, point.y + distance_threshold,
-          point.z + distance_threshold_z),
-        point, distance_threshold, map, voxel)) {
-    return true;
+  // NOTE: The voxel coordinates of the point and of the point shifted by the thresholds are
+  //       computed once per axis, and the keys of the 27 voxels are combined from them by OR.
+  const std::array<VoxelKeyMap::Key, 3> fields_x{
+    voxel_key_map.getFieldX(point.x),
+    voxel_key_map.getFieldX(static_cast<float>(point.x - distance_threshold)),
+    voxel_key_map.getFieldX(static_cast<float>(point.x + distance_threshold))};
+  const std::array<VoxelKeyMap::Key, 3> fields_y{
+    voxel_key_map.getFieldY(point.y),
+    voxel_key_map.getFieldY(static_cast<float>(point.y - distance_threshold)),
+    voxel_key_map.getFieldY(static_cast<float>(point.y + distance_threshold))};
+  const std::array<VoxelKeyMap::Key, 3> fields_z{
+    voxel_key_map.getFieldZ(point.z),
+    voxel_key_map.getFieldZ(static_cast<float>(point.z - distance_threshold_z)),
+    voxel_key_map.getFieldZ(static_cast<float>(point.z + distance_threshold_z))};
+  for (const auto field_x : fields_x) {
+    if (field_x == VoxelKeyMap::invalid_key) {
+      continue;
+    }
+    for (const auto field_y : fields_y) {
+      if (field_y == VoxelKeyMap::invalid_key) {
+        continue;
+      }
+      for (const auto field_z : fields_z) {
+        const int voxel_index = voxel_key_map.find(field_x | field_y | field_z);
+        if (voxel_index != -1 && is_in_voxel(voxel_index, point, distance_threshold, map)) {
+          return true;
+        }
+      }
+    }
   }
   return false;
 }
 
 bool VoxelGridMapLoader::is_in_voxel(
-  const pcl::PointXYZ & src_point, const pcl::PointXYZ & target_point,
-  const double distance_threshold, const PointCloudPtr & map, VoxelGridPointXYZ & voxel) const
+  const int voxel_index, const pcl::PointXYZ & target_point, const double distance_threshold,
+  const PointCloudPtr & map) const
 {
-  int voxel_index =
-    voxel.getCentroidIndexAt(voxel.getGridCoordinates(src_point.x, src_point.y, src_point.z));
-  if (voxel_index != -1) {  // not empty voxel
-    const double dist_x = map->points.at(voxel_index).x - target_point.x;
-    const double dist_y = map->points.at(voxel_index).y - target_point.y;
-    const double dist_z = map->points.at(voxel_index).z - target_point.z;
-    // check if the point is inside the distance threshold voxel
-    if (
-      std::abs(dist_x) < distance_threshold && std::abs(dist_y) < distance_threshold &&
-      std::abs(dist_z) < distance_threshold * downsize_ratio_z_axis_) {
-      return true;
-    }
+  const double dist_x = map->points[voxel_index].x - target_point.x;
+  const double dist_y = map->points[voxel_index].y - target_point.y;
+  const double dist_z = map->points[voxel_index].z - target_point.z;
+  // check if the point is inside the distance threshold voxel
+  if (
+    std::abs(dist_x) < distance_threshold && std::abs(dist_y) < distance_threshold &&
+    std::abs(dist_z) < distance_threshold * downsize_ratio_z_axis_) {
+    return true;
   }
   return false;
 }
@@ -276,6 +154,11 @@ void VoxelGridStaticMapLoader::onMapCallback(
   voxel_grid_.setInputCloud(map_pcl_ptr);
   voxel_grid_.setSaveLeafLayout(true);
   voxel_grid_.filter(*voxel_map_ptr_);
+  voxel_key_map_.build(
+    voxel_grid_.leaf_layout_, voxel_grid_.get_min_b(), voxel_grid_.get_div_b(),
+    voxel_grid_.get_inverse_leaf_size());
+  // the dense leaf layout is not used anymore
+  std::vector<int>().swap(voxel_grid_.leaf_layout_);
   (*mutex_ptr_).unlock();
 
   if (debug_) {
@@ -285,7 +168,7 @@ void VoxelGridStaticMapLoader::onMapCallback(
 bool VoxelGridStaticMapLoader::is_close_to_map(
   const pcl::PointXYZ & point, const double distance_threshold)
 {
-  if (is_close_to_neighbor_voxels(point, distance_threshold, voxel_map_ptr_, voxel_grid_)) {
+  if (is_close_to_neighbor_voxels(point, distance_threshold, voxel_map_ptr_, voxel_key_map_)) {
     return true;
   }
   return false;
@@ -301,6 +184,9 @@ VoxelGridDynamicMapLoader::VoxelGridDynamicMapLoader(
   auto timer_interval_ms = node->declare_parameter<int>("timer_interval_ms");
   map_update_distance_threshold_ = node->declare_parameter<double>("map_update_distance_threshold");
   map_loader_radius_ = node->declare_parameter<double>("map_loader_radius");
+  map_prefetch_time_ = node->declare_parameter<double>("map_prefetch_time");
+  max_cached_map_cells_ =
+    static_cast<size_t>(std::max(node->declare_parameter<int>("max_cached_map_cells"), 0));
   auto main_sub_opt = rclcpp::SubscriptionOptions();
   main_sub_opt.callback_group = main_callback_group;
   sub_kinematic_state_ = node->create_subscription<nav_msgs::msg::Odometry>(
@@ -326,7 +212,14 @@ VoxelGridDynamicMapLoader::VoxelGridDynamicMapLoader(
 }
 void VoxelGridDynamicMapLoader::onEstimatedPoseCallback(nav_msgs::msg::Odometry::ConstSharedPtr msg)
 {
+  // the twist is in the child frame, rotate it to the map frame with the yaw
+  const auto & q = msg->pose.pose.orientation;
+  const double yaw = std::atan2(2.0 * (q.w * q.z + q.x * q.y), 1.0 - 2.0 * (q.y * q.y + q.z * q.z));
+  const auto & linear = msg->twist.twist.linear;
+  std::lock_guard<std::mutex> lock(kinematic_state_mutex_);
   current_position_ = msg->pose.pose.position;
+  current_velocity_.x = std::cos(yaw) * linear.x - std::sin(yaw) * linear.y;
+  current_velocity_.y = std::sin(yaw) * linear.x + std::cos(yaw) * linear.y;
 }
 bool VoxelGridDynamicMapLoader::is_close_to_next_map_grid(
   const pcl::PointXYZ & point, const int current_map_grid_index, const double distance_threshold)
@@ -338,13 +231,13 @@ bool VoxelGridDynamicMapLoader::is_close_to_next_map_grid(
   if (
     static_cast<size_t>(neighbor_map_grid_index) >= current_voxel_grid_array_.size() ||
     neighbor_map_grid_index == current_map_grid_index ||
-    current_voxel_grid_array_.at(neighbor_map_grid_index) != NULL) {
+    current_voxel_grid_array_.at(neighbor_map_grid_index) == NULL) {
     return false;
   }
   if (is_close_to_neighbor_voxels(
         point, distance_threshold,
         current_voxel_grid_array_.at(neighbor_map_grid_index)->map_cell_pc_ptr,
-        current_voxel_grid_array_.at(neighbor_map_grid_index)->map_cell_voxel_grid)) {
+        current_voxel_grid_array_.at(neighbor_map_grid_index)->map_cell_voxel_key_map)) {
     return true;
   }
   return false;
@@ -353,7 +246,7 @@ bool VoxelGridDynamicMapLoader::is_close_to_next_map_grid(
 bool VoxelGridDynamicMapLoader::is_close_to_map(
   const pcl::PointXYZ & point, const double distance_threshold)
 {
-  if (current_voxel_grid_dict_.size() == 0) {
+  if (current_voxel_grid_array_.empty()) {
     return false;
   }
 
@@ -370,7 +263,7 @@ bool VoxelGridDynamicMapLoader::is_close_to_map(
     current_voxel_grid_array_.at(map_grid_index) != NULL &&
     is_close_to_neighbor_voxels(
       point, distance_threshold, current_voxel_grid_array_.at(map_grid_index)->map_cell_pc_ptr,
-      current_voxel_grid_array_.at(map_grid_index)->map_cell_voxel_grid)) {
+      current_voxel_grid_array_.at(map_grid_index)->map_cell_voxel_key_map)) {
     return true;
   }
 
@@ -403,38 +296,48 @@ bool VoxelGridDynamicMapLoader::is_close_to_map(
 }
 void VoxelGridDynamicMapLoader::timer_callback()
 {
-  if (current_position_ == std::nullopt) {
-    return;
-  }
-  if (last_updated_position_ == std::nullopt) {
-    request_update_map(current_position_.value());
-    last_updated_position_ = current_position_;
-    return;
+  geometry_msgs::msg::Point position;
+  geometry_msgs::msg::Vector3 velocity;
+  {
+    std::lock_guard<std::mutex> lock(kinematic_state_mutex_);
+    if (current_position_ == std::nullopt) {
+      return;
+    }
+    position = current_position_.value();
+    velocity = current_velocity_;
   }
 
-  if (should_update_map()) {
-    last_updated_position_ = current_position_;
-    request_update_map((current_position_.value()));
-    last_updated_position_ = current_position_;
+  // prefetch the map ahead of the ego: the area covers the circles of map_loader_radius around the
+  // current position and the position after map_prefetch_time
+  const double lookahead_x = velocity.x * map_prefetch_time_;
+  const double lookahead_y = velocity.y * map_prefetch_time_;
+  geometry_msgs::msg::Point center = position;
+  center.x += 0.5 * lookahead_x;
+  center.y += 0.5 * lookahead_y;
+  const double radius = map_loader_radius_ + 0.5 * std::hypot(lookahead_x, lookahead_y);
+
+  if (last_updated_position_ == std::nullopt || should_update_map(center)) {
+    last_updated_position_ = center;
+    last_updated_radius_ = radius;
+    request_update_map(center, radius);
   }
 }
 
-bool VoxelGridDynamicMapLoader::should_update_map() const
+bool VoxelGridDynamicMapLoader::should_update_map(const geometry_msgs::msg::Point & position) const
 {
-  if (
-    distance2D(current_position_.value(), last_updated_position_.value()) >
-    map_update_distance_threshold_) {
+  if (distance2D(position, last_updated_position_.value()) > map_update_distance_threshold_) {
     return true;
   }
   return false;
 }
 
-void VoxelGridDynamicMapLoader::request_update_map(const geometry_msgs::msg::Point & position)
+void VoxelGridDynamicMapLoader::request_update_map(
+  const geometry_msgs::msg::Point & position, const double radius)
 {
   auto request = std::make_shared<autoware_map_msgs::srv::GetDifferentialPointCloudMap::Request>();
   request->area.center_x = position.x;
   request->area.center_y = position.y;
-  request->area.radius = map_loader_radius_;
+  request->area.radius = radius;
   request->cached_ids = getCurrentMapIDs();
 
   auto result{map_update_client_->async_send_request(
@@ -0,0 +1,78 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "compare_map_segmentation/voxel_key_map.hpp"
+
+#include <algorithm>
+
+namespace
+{
+int getBitWidth(const int value)
+{
+  int width = 0;
+  while ((int64_t{1} << width) <= value) {
+    ++width;
+  }
+  return width;
+}
+}  // namespace
+
+void VoxelKeyMap::build(
+  const std::vector<int> & leaf_layout, const Eigen::Vector4i & min_b,
+  const Eigen::Vector4i & div_b, const Eigen::Array4f & inverse_leaf_size)
+{
+  inverse_leaf_size_x_ = inverse_leaf_size[0];
+  inverse_leaf_size_y_ = inverse_leaf_size[1];
+  inverse_leaf_size_z_ = inverse_leaf_size[2];
+  min_b_x_ = min_b[0];
+  min_b_y_ = min_b[1];
+  min_b_z_ = min_b[2];
+  div_b_x_ = div_b[0];
+  div_b_y_ = div_b[1];
+  div_b_z_ = div_b[2];
+  // the leaf layout has less than 2^31 voxels, so the fields fit in 64 bits with a lot of margin
+  shift_y_ = getBitWidth(div_b_x_ - 1);
+  shift_z_ = shift_y_ + getBitWidth(div_b_y_ - 1);
+
+  size_ = static_cast<size_t>(
+    std::count_if(leaf_layout.begin(), leaf_layout.end(), [](const int i) { return i != -1; }));
+  // keep the load factor at most 0.5 for short probe sequences
+  size_t slots_num = 16;
+  hash_shift_ = 64 - 4;
+  while (slots_num < 2 * size_) {
+    slots_num *= 2;
+    --hash_shift_;
+  }
+  slot_mask_ = slots_num - 1;
+  keys_.assign(slots_num, invalid_key);
+  centroid_indices_.assign(slots_num, -1);
+
+  // the leaf layout index is (ijk - min_b).dot(divb_mul) with divb_mul = (1, div_x, div_x * div_y)
+  const size_t div_xy = static_cast<size_t>(div_b_x_) * div_b_y_;
+  for (size_t i = 0; i < leaf_layout.size(); ++i) {
+    if (leaf_layout[i] == -1) {
+      continue;
+    }
+    const Key x = i % div_b_x_;
+    const Key y = (i / div_b_x_) % div_b_y_;
+    const Key z = i / div_xy;
+    const Key key = x | (y << shift_y_) | (z << shift_z_);
+    size_t slot = hash(key);
+    while (keys_[slot] != invalid_key) {
+      slot = (slot + 1) & slot_mask_;
+    }
+    keys_[slot] = key;
+    centroid_indices_[slot] = leaf_layout[i];
+  }
+}
@@ -15,6 +15,7 @@
 
 #include <lanelet2_extension/regulatory_elements/Forward.hpp>
 #include <lanelet2_extension/utility/message_conversion.hpp>
+#include <lanelet2_map_cache/lanelet2_map_cache.hpp>
 
 #include <iostream>
 #include <memory>
@@ -103,9 +104,10 @@ CrosswalkTrafficLightEstimatorNode::CrosswalkTrafficLightEstimatorNode(
 void CrosswalkTrafficLightEstimatorNode::onMap(const HADMapBin::ConstSharedPtr msg)
 {
   RCLCPP_DEBUG(get_logger(), "[CrosswalkTrafficLightEstimatorNode]: Start loading lanelet");
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(
-    *msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
+  const auto map = lanelet2_map_cache::fromBinMsg(*msg);
+  lanelet_map_ptr_ = map.lanelet_map_ptr;
+  traffic_rules_ptr_ = map.traffic_rules_ptr;
+  routing_graph_ptr_ = map.routing_graph_ptr;
   const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
     lanelet::Locations::Germany, lanelet::Participants::Vehicle);
   const auto pedestrian_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
@@ -14,6 +14,9 @@
 
 #include <detected_object_feature_remover/detected_object_feature_remover.hpp>
 
+#include <memory>
+#include <utility>
+
 namespace detected_object_feature_remover
 {
 DetectedObjectFeatureRemover::DetectedObjectFeatureRemover(const rclcpp::NodeOptions & node_options)
@@ -29,10 +32,13 @@ DetectedObjectFeatureRemover::DetectedObjectFeatureRemover(const rclcpp::NodeOpt
 void DetectedObjectFeatureRemover::objectCallback(
   const DetectedObjectsWithFeature::ConstSharedPtr input)
 {
-  DetectedObjects output;
-  convert(*input, output);
-  pub_->publish(output);
-  published_time_publisher_->publish_if_subscribed(pub_, output.header.stamp);
+  // NOTE: The output is published as unique_ptr, so that it is not copied when the subscriber is
+  //       in the same container with intra-process communication.
+  auto output = std::make_unique<DetectedObjects>();
+  convert(*input, *output);
+  const auto stamp = output->header.stamp;
+  pub_->publish(std::move(output));
+  published_time_publisher_->publish_if_subscribed(pub_, stamp);
 }
 
 void DetectedObjectFeatureRemover::convert(
@@ -26,20 +26,39 @@
 #include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
 #include <autoware_auto_perception_msgs/msg/detected_objects.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
+
 #include <lanelet2_core/Forward.h>
+#include <lanelet2_core/primitives/Polygon.h>
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace object_lanelet_filter
 {
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::LinearRing2d;
 using tier4_autoware_utils::MultiPoint2d;
 using tier4_autoware_utils::Point2d;
 using tier4_autoware_utils::Polygon2d;
 
+using LaneletRtree =
+  boost::geometry::index::rtree<std::pair<Box2d, size_t>, boost::geometry::index::rstar<16>>;
+
+// spatial index of the lanelets, built when the map is received
+struct LaneletIndex
+{
+  lanelet::ConstLanelets lanelets;
+  // 2d polygon of each lanelet
+  std::vector<lanelet::BasicPolygon2d> polygons;
+  // bounding box of each lanelet
+  LaneletRtree rtree;
+};
+
 class ObjectLaneletFilterNode : public rclcpp::Node
 {
 public:
@@ -55,8 +74,8 @@ private:
   std::unique_ptr<tier4_autoware_utils::DebugPublisher> debug_publisher_{nullptr};
 
   lanelet::LaneletMapPtr lanelet_map_ptr_;
-  lanelet::ConstLanelets road_lanelets_;
-  lanelet::ConstLanelets shoulder_lanelets_;
+  LaneletIndex road_lanelet_index_;
+  LaneletIndex shoulder_lanelet_index_;
   std::string lanelet_frame_id_;
 
   tf2_ros::Buffer tf_buffer_;
@@ -74,15 +93,15 @@ private:
   bool filterObject(
     const autoware_auto_perception_msgs::msg::DetectedObject & transformed_object,
     const autoware_auto_perception_msgs::msg::DetectedObject & input_object,
-    const lanelet::ConstLanelets & intersected_road_lanelets,
-    const lanelet::ConstLanelets & intersected_shoulder_lanelets,
     autoware_auto_perception_msgs::msg::DetectedObjects & output_object_msg);
-  LinearRing2d getConvexHull(const autoware_auto_perception_msgs::msg::DetectedObjects &);
-  lanelet::ConstLanelets getIntersectedLanelets(
-    const LinearRing2d &, const lanelet::ConstLanelets &);
-  bool isPolygonOverlapLanelets(const Polygon2d &, const lanelet::ConstLanelets &);
+  static LaneletIndex createLaneletIndex(const lanelet::ConstLanelets & lanelets);
+  static void getIntersectedLanelets(
+    const Box2d & box, const LaneletIndex & lanelet_index, std::vector<size_t> & indices);
+  static bool isPolygonOverlapLanelets(
+    const Polygon2d & polygon, const LaneletIndex & lanelet_index,
+    const std::vector<size_t> & indices);
   bool isSameDirectionWithLanelets(
-    const lanelet::ConstLanelets & lanelets,
+    const LaneletIndex & lanelet_index, const std::vector<size_t> & indices,
     const autoware_auto_perception_msgs::msg::DetectedObject & object);
   geometry_msgs::msg::Polygon setFootprint(
     const autoware_auto_perception_msgs::msg::DetectedObject &);
@@ -19,12 +19,17 @@
 #include <object_recognition_utils/object_recognition_utils.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 
-#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/function_output_iterator.hpp>
 #include <boost/geometry/algorithms/disjoint.hpp>
-#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
 
 #include <lanelet2_core/geometry/Polygon.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace object_lanelet_filter
 {
 ObjectLaneletFilterNode::ObjectLaneletFilterNode(const rclcpp::NodeOptions & node_options)
@@ -74,8 +79,9 @@ void ObjectLaneletFilterNode::mapCallback(
   lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
   lanelet::utils::conversion::fromBinMsg(*map_msg, lanelet_map_ptr_);
   const lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
-  road_lanelets_ = lanelet::utils::query::roadLanelets(all_lanelets);
-  shoulder_lanelets_ = lanelet::utils::query::shoulderLanelets(all_lanelets);
+  road_lanelet_index_ = createLaneletIndex(lanelet::utils::query::roadLanelets(all_lanelets));
+  shoulder_lanelet_index_ =
+    createLaneletIndex(lanelet::utils::query::shoulderLanelets(all_lanelets));
 }
 
 void ObjectLaneletFilterNode::objectCallback(
@@ -98,21 +104,11 @@ void ObjectLaneletFilterNode::objectCallback(
     return;
   }
 
-  // calculate convex hull
-  const auto convex_hull = getConvexHull(transformed_objects);
-  // get intersected lanelets
-  lanelet::ConstLanelets intersected_road_lanelets =
-    getIntersectedLanelets(convex_hull, road_lanelets_);
-  lanelet::ConstLanelets intersected_shoulder_lanelets =
-    getIntersectedLanelets(convex_hull, shoulder_lanelets_);
-
   // filtering process
   for (size_t index = 0; index < transformed_objects.objects.size(); ++index) {
     const auto & transformed_object = transformed_objects.objects.at(index);
     const auto & input_object = input_msg->objects.at(index);
-    filterObject(
-      transformed_object, input_object, intersected_road_lanelets, intersected_shoulder_lanelets,
-      output_object_msg);
+    filterObject(transformed_object, input_object, output_object_msg);
   }
   object_pub_->publish(output_object_msg);
   published_time_publisher_->publish_if_subscribed(object_pub_, output_object_msg.header.stamp);
@@ -130,26 +126,39 @@ void ObjectLaneletFilterNode::objectCallback(
 bool ObjectLaneletFilterNode::filterObject(
   const autoware_auto_perception_msgs::msg::DetectedObject & transformed_object,
   const autoware_auto_perception_msgs::msg::DetectedObject & input_object,
-  const lanelet::ConstLanelets & intersected_road_lanelets,
-  const lanelet::ConstLanelets & intersected_shoulder_lanelets,
   autoware_auto_perception_msgs::msg::DetectedObjects & output_object_msg)
 {
   const auto & label = transformed_object.classification.front().label;
   if (filter_target_.isTarget(label)) {
+    // polygon of the object in the map frame
+    Polygon2d polygon;
+    const auto footprint = setFootprint(transformed_object);
+    for (const auto & point : footprint.points) {
+      const geometry_msgs::msg::Point32 point_transformed = tier4_autoware_utils::transformPoint(
+        point, transformed_object.kinematics.pose_with_covariance.pose);
+      polygon.outer().emplace_back(point_transformed.x, point_transformed.y);
+    }
+    if (!polygon.outer().empty()) {
+      polygon.outer().push_back(polygon.outer().front());
+    }
+
+    // get the lanelets intersecting the bounding box of the polygon and the position
+    const auto & position = transformed_object.kinematics.pose_with_covariance.pose.position;
+    Box2d object_box{Point2d{position.x, position.y}, Point2d{position.x, position.y}};
+    if (!polygon.outer().empty()) {
+      boost::geometry::expand(object_box, boost::geometry::return_envelope<Box2d>(polygon));
+    }
+    std::vector<size_t> intersected_road_lanelets;
+    std::vector<size_t> intersected_shoulder_lanelets;
+    getIntersectedLanelets(object_box, road_lanelet_index_, intersected_road_lanelets);
+    getIntersectedLanelets(object_box, shoulder_lanelet_index_, intersected_shoulder_lanelets);
+
     bool filter_pass = true;
     // 1. is polygon overlap with road lanelets or shoulder lanelets
     if (filter_settings_.polygon_overlap_filter) {
-      Polygon2d polygon;
-      const auto footprint = setFootprint(transformed_object);
-      for (const auto & point : footprint.points) {
-        const geometry_msgs::msg::Point32 point_transformed = tier4_autoware_utils::transformPoint(
-          point, transformed_object.kinematics.pose_with_covariance.pose);
-        polygon.outer().emplace_back(point_transformed.x, point_transformed.y);
-      }
-      polygon.outer().push_back(polygon.outer().front());
       const bool is_polygon_overlap =
-        isPolygonOverlapLanelets(polygon, intersected_road_lanelets) ||
-        isPolygonOverlapLanelets(polygon, intersected_shoulder_lanelets);
+        isPolygonOverlapLanelets(polygon, road_lanelet_index_, intersected_road_lanelets) ||
+        isPolygonOverlapLanelets(polygon, shoulder_lanelet_index_, intersected_shoulder_lanelets);
       filter_pass = filter_pass && is_polygon_overlap;
     }
 
@@ -159,8 +168,10 @@ bool ObjectLaneletFilterNode::filterObject(
       autoware_auto_perception_msgs::msg::TrackedObjectKinematics::UNAVAILABLE;
     if (filter_settings_.lanelet_direction_filter && !orientation_not_available) {
       const bool is_same_direction =
-        isSameDirectionWithLanelets(intersected_road_lanelets, transformed_object) ||
-        isSameDirectionWithLanelets(intersected_shoulder_lanelets, transformed_object);
+        isSameDirectionWithLanelets(
+          road_lanelet_index_, intersected_road_lanelets, transformed_object) ||
+        isSameDirectionWithLanelets(
+          shoulder_lanelet_index_, intersected_shoulder_lanelets, transformed_object);
       filter_pass = filter_pass && is_same_direction;
     }
 
@@ -201,44 +212,53 @@ geometry_msgs::msg::Polygon ObjectLaneletFilterNode::setFootprint(
   return footprint;
 }
 
-LinearRing2d ObjectLaneletFilterNode::getConvexHull(
-  const autoware_auto_perception_msgs::msg::DetectedObjects & detected_objects)
+LaneletIndex ObjectLaneletFilterNode::createLaneletIndex(const lanelet::ConstLanelets & lanelets)
 {
-  MultiPoint2d candidate_points;
-  for (const auto & object : detected_objects.objects) {
-    const auto & pos = object.kinematics.pose_with_covariance.pose.position;
-    const auto footprint = setFootprint(object);
-    for (const auto & p : footprint.points) {
-      candidate_points.emplace_back(p.x + pos.x, p.y + pos.y);
+  LaneletIndex lanelet_index;
+  lanelet_index.lanelets = lanelets;
+  lanelet_index.polygons.reserve(lanelets.size());
+  std::vector<std::pair<Box2d, size_t>> boxes;
+  boxes.reserve(lanelets.size());
+  for (size_t index = 0; index < lanelets.size(); ++index) {
+    lanelet_index.polygons.push_back(lanelets.at(index).polygon2d().basicPolygon());
+    const auto & polygon = lanelet_index.polygons.back();
+    if (polygon.empty()) {
+      continue;
+    }
+    Box2d box{
+      Point2d{polygon.front().x(), polygon.front().y()},
+      Point2d{polygon.front().x(), polygon.front().y()}};
+    for (const auto & point : polygon) {
+      boost::geometry::expand(box, Point2d{point.x(), point.y()});
     }
+    boxes.emplace_back(box, index);
   }
-
-  LinearRing2d convex_hull;
-  boost::geometry::convex_hull(candidate_points, convex_hull);
-
-  return convex_hull;
+  // NOTE: the packing algorithm builds the tree faster and better balanced than the insertion
+  lanelet_index.rtree = LaneletRtree(boxes.begin(), boxes.end());
+  return lanelet_index;
 }
 
-lanelet::ConstLanelets ObjectLaneletFilterNode::getIntersectedLanelets(
-  const LinearRing2d & convex_hull, const lanelet::ConstLanelets & road_lanelets)
+void ObjectLaneletFilterNode::getIntersectedLanelets(
+  const Box2d & box, const LaneletIndex & lanelet_index, std::vector<size_t> & indices)
 {
-  lanelet::ConstLanelets intersected_lanelets;
-
-  // WARNING: This implementation currently iterate all lanelets, which could degrade performance
-  // when handling large sized map.
-  for (const auto & road_lanelet : road_lanelets) {
-    if (boost::geometry::intersects(convex_hull, road_lanelet.polygon2d().basicPolygon())) {
-      intersected_lanelets.emplace_back(road_lanelet);
-    }
-  }
-  return intersected_lanelets;
+  indices.clear();
+  lanelet_index.rtree.query(
+    boost::geometry::index::intersects(box),
+    boost::make_function_output_iterator(
+      [&](const std::pair<Box2d, size_t> & value) { indices.push_back(value.second); }));
+  // keep the order of the map
+  std::sort(indices.begin(), indices.end());
 }
 
 bool ObjectLaneletFilterNode::isPolygonOverlapLanelets(
-  const Polygon2d & polygon, const lanelet::ConstLanelets & intersected_lanelets)
+  const Polygon2d & polygon, const LaneletIndex & lanelet_index,
+  const std::vector<size_t> & indices)
 {
-  for (const auto & lanelet : intersected_lanelets) {
-    if (!boost::geometry::disjoint(polygon, lanelet.polygon2d().basicPolygon())) {
+  if (polygon.outer().empty()) {
+    return false;
+  }
+  for (const auto index : indices) {
+    if (!boost::geometry::disjoint(polygon, lanelet_index.polygons.at(index))) {
       return true;
     }
   }
@@ -246,7 +266,7 @@ bool ObjectLaneletFilterNode::isPolygonOverlapLanelets(
 }
 
 bool ObjectLaneletFilterNode::isSameDirectionWithLanelets(
-  const lanelet::ConstLanelets & lanelets,
+  const LaneletIndex & lanelet_index, const std::vector<size_t> & indices,
   const autoware_auto_perception_msgs::msg::DetectedObject & object)
 {
   const double object_yaw = tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation);
@@ -261,7 +281,8 @@ bool ObjectLaneletFilterNode::isSameDirectionWithLanelets(
   if (object_velocity_norm < filter_settings_.lanelet_direction_filter_object_speed_threshold) {
     return true;
   }
-  for (const auto & lanelet : lanelets) {
+  for (const auto index : indices) {
+    const auto & lanelet = lanelet_index.lanelets.at(index);
     const bool is_in_lanelet =
       lanelet::utils::isInLanelet(object.kinematics.pose_with_covariance.pose, lanelet, 0.0);
     if (!is_in_lanelet) {
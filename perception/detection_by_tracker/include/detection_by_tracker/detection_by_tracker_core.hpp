@@ -76,6 +76,7 @@ private:
   tf2_ros::TransformListener tf_listener_;
 
   TrackerHandler tracker_handler_;
+  // NOTE: The shape estimator has no state to be updated, so it is shared by the threads.
   std::shared_ptr<ShapeEstimator> shape_estimator_;
   std::shared_ptr<euclidean_cluster::EuclideanClusterInterface> cluster_;
   std::shared_ptr<Debugger> debugger_;
@@ -94,17 +95,20 @@ private:
   void divideUnderSegmentedObjects(
     const autoware_auto_perception_msgs::msg::DetectedObjects & tracked_objects,
     const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_objects,
+    const std::vector<pcl::PointCloud<pcl::PointXYZ>::ConstPtr> & in_pcl_clusters,
     autoware_auto_perception_msgs::msg::DetectedObjects & out_no_found_tracked_objects,
     tier4_perception_msgs::msg::DetectedObjectsWithFeature & out_objects);
 
   float optimizeUnderSegmentedObject(
     const autoware_auto_perception_msgs::msg::DetectedObject & target_object,
-    const sensor_msgs::msg::PointCloud2 & under_segmented_cluster,
+    const std_msgs::msg::Header & header,
+    const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & under_segmented_cluster,
     tier4_perception_msgs::msg::DetectedObjectWithFeature & output);
 
   void mergeOverSegmentedObjects(
     const autoware_auto_perception_msgs::msg::DetectedObjects & tracked_objects,
     const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_objects,
+    const std::vector<pcl::PointCloud<pcl::PointXYZ>::ConstPtr> & in_pcl_clusters,
     autoware_auto_perception_msgs::msg::DetectedObjects & out_no_found_tracked_objects,
     tier4_perception_msgs::msg::DetectedObjectsWithFeature & out_objects);
 };
@@ -231,17 +231,28 @@ void DetectionByTracker::onObjects(
   debugger_->publishInitialObjects(*input_msg);
   debugger_->publishTrackedObjects(tracked_objects);
 
+  // convert the clusters to pcl once, which are shared by the merger and the divider
+  std::vector<pcl::PointCloud<pcl::PointXYZ>::ConstPtr> pcl_clusters;
+  pcl_clusters.reserve(input_msg->feature_objects.size());
+  for (const auto & initial_object : input_msg->feature_objects) {
+    pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_cluster(new pcl::PointCloud<pcl::PointXYZ>);
+    pcl::fromROSMsg(initial_object.feature.cluster, *pcl_cluster);
+    pcl_clusters.push_back(pcl_cluster);
+  }
+
   // merge over segmented objects
   tier4_perception_msgs::msg::DetectedObjectsWithFeature merged_objects;
   autoware_auto_perception_msgs::msg::DetectedObjects no_found_tracked_objects;
-  mergeOverSegmentedObjects(tracked_objects, *input_msg, no_found_tracked_objects, merged_objects);
+  mergeOverSegmentedObjects(
+    tracked_objects, *input_msg, pcl_clusters, no_found_tracked_objects, merged_objects);
   debugger_->publishMergedObjects(merged_objects);
 
   // divide under segmented objects
   tier4_perception_msgs::msg::DetectedObjectsWithFeature divided_objects;
   autoware_auto_perception_msgs::msg::DetectedObjects temp_no_found_tracked_objects;
   divideUnderSegmentedObjects(
-    no_found_tracked_objects, *input_msg, temp_no_found_tracked_objects, divided_objects);
+    no_found_tracked_objects, *input_msg, pcl_clusters, temp_no_found_tracked_objects,
+    divided_objects);
   debugger_->publishDividedObjects(divided_objects);
 
   // merge under/over segmented objects to build output objects
@@ -260,6 +271,7 @@ void DetectionByTracker::onObjects(
 void DetectionByTracker::divideUnderSegmentedObjects(
   const autoware_auto_perception_msgs::msg::DetectedObjects & tracked_objects,
   const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_cluster_objects,
+  const std::vector<pcl::PointCloud<pcl::PointXYZ>::ConstPtr> & in_pcl_clusters,
   autoware_auto_perception_msgs::msg::DetectedObjects & out_no_found_tracked_objects,
   tier4_perception_msgs::msg::DetectedObjectsWithFeature & out_objects)
 {
@@ -270,18 +282,25 @@ void DetectionByTracker::divideUnderSegmentedObjects(
   out_objects.header = in_cluster_objects.header;
   out_no_found_tracked_objects.header = tracked_objects.header;
 
-  for (const auto & tracked_object : tracked_objects.objects) {
+  // NOTE: The tracked objects are divided in parallel, and the results are collected in the order
+  //       of the tracked objects so that the output does not depend on the number of the threads.
+  const size_t num_tracked_objects = tracked_objects.objects.size();
+  std::vector<std::optional<tier4_perception_msgs::msg::DetectedObjectWithFeature>>
+    highest_score_divided_objects(num_tracked_objects);
+#pragma omp parallel for schedule(dynamic)
+  for (size_t i = 0; i < num_tracked_objects; ++i) {
+    const auto & tracked_object = tracked_objects.objects.at(i);
     const auto & label = tracked_object.classification.front().label;
     if (tracker_ignore_.isIgnore(label)) continue;
 
     // change search range according to label type
-    const float max_search_range = max_search_distance_for_divider_[label];
+    const float max_search_range = max_search_distance_for_divider_.at(label);
 
-    std::optional<tier4_perception_msgs::msg::DetectedObjectWithFeature>
-      highest_score_divided_object = std::nullopt;
+    auto & highest_score_divided_object = highest_score_divided_objects.at(i);
     float highest_score = 0.0;
 
-    for (const auto & initial_object : in_cluster_objects.feature_objects) {
+    for (size_t j = 0; j < in_cluster_objects.feature_objects.size(); ++j) {
+      const auto & initial_object = in_cluster_objects.feature_objects.at(j);
       // search near object
       const float distance = tier4_autoware_utils::calcDistance2d(
         tracked_object.kinematics.pose_with_covariance.pose,
@@ -302,7 +321,8 @@ void DetectionByTracker::divideUnderSegmentedObjects(
       // optimize clustering
       tier4_perception_msgs::msg::DetectedObjectWithFeature divided_object;
       float score = optimizeUnderSegmentedObject(
-        tracked_object, initial_object.feature.cluster, divided_object);
+        tracked_object, initial_object.feature.cluster.header, in_pcl_clusters.at(j),
+        divided_object);
       if (score < min_score_threshold) {
         continue;
       }
@@ -312,6 +332,13 @@ void DetectionByTracker::divideUnderSegmentedObjects(
         highest_score_divided_object = divided_object;
       }
     }
+  }
+
+  for (size_t i = 0; i < num_tracked_objects; ++i) {
+    const auto & tracked_object = tracked_objects.objects.at(i);
+    if (tracker_ignore_.isIgnore(tracked_object.classification.front().label)) continue;
+
+    const auto & highest_score_divided_object = highest_score_divided_objects.at(i);
     if (highest_score_divided_object) {  // found
       out_objects.feature_objects.push_back(highest_score_divided_object.value());
     } else {  // not found
@@ -322,7 +349,8 @@ void DetectionByTracker::divideUnderSegmentedObjects(
 
 float DetectionByTracker::optimizeUnderSegmentedObject(
   const autoware_auto_perception_msgs::msg::DetectedObject & target_object,
-  const sensor_msgs::msg::PointCloud2 & under_segmented_cluster,
+  const std_msgs::msg::Header & header,
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & under_segmented_cluster,
   tier4_perception_msgs::msg::DetectedObjectWithFeature & output)
 {
   constexpr float iter_rate = 0.8;
@@ -333,14 +361,15 @@ float DetectionByTracker::optimizeUnderSegmentedObject(
   float voxel_size = initial_voxel_size;
 
   const auto & label = target_object.classification.front().label;
+  const auto ref_yaw_info = getReferenceYawInfo(
+    label, tf2::getYaw(target_object.kinematics.pose_with_covariance.pose.orientation));
+  const auto ref_shape_size_info = getReferenceShapeSizeInfo(label, target_object.shape);
 
   // initialize clustering parameters
+  // NOTE: The instance is local since the clustering is called from the parallel divider.
   euclidean_cluster::VoxelGridBasedEuclideanCluster cluster(
     false, 4, 10000, initial_cluster_range, initial_voxel_size, 0);
-
-  // convert to pcl
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_cluster(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(under_segmented_cluster, *pcl_cluster);
+  cluster.setUseUnionFind(true);
 
   // iterate to find best fit divided object
   float highest_iou = 0.0;
@@ -351,29 +380,29 @@ float DetectionByTracker::optimizeUnderSegmentedObject(
     std::vector<pcl::PointCloud<pcl::PointXYZ>> divided_clusters;
     cluster.setTolerance(cluster_range);
     cluster.setVoxelLeafSize(voxel_size);
-    cluster.cluster(pcl_cluster, divided_clusters);
+    cluster.cluster(under_segmented_cluster, divided_clusters);
 
     // find highest iou object in divided clusters
+    // NOTE: The shape is estimated into a candidate, since it is overwritten even if the
+    //       estimation fails, and only the cluster of the highest iou is converted to the message.
     float highest_iou_in_current_iter = 0.0f;
+    const pcl::PointCloud<pcl::PointXYZ> * highest_iou_cluster_in_current_iter = nullptr;
     tier4_perception_msgs::msg::DetectedObjectWithFeature highest_iou_object_in_current_iter;
-    highest_iou_object_in_current_iter.object.classification = target_object.classification;
+    autoware_auto_perception_msgs::msg::DetectedObject candidate_object;
     for (const auto & divided_cluster : divided_clusters) {
       bool is_shape_estimated = shape_estimator_->estimateShapeAndPose(
-        label, divided_cluster,
-        getReferenceYawInfo(
-          label, tf2::getYaw(target_object.kinematics.pose_with_covariance.pose.orientation)),
-        getReferenceShapeSizeInfo(label, target_object.shape),
-        highest_iou_object_in_current_iter.object.shape,
-        highest_iou_object_in_current_iter.object.kinematics.pose_with_covariance.pose);
+        label, divided_cluster, ref_yaw_info, ref_shape_size_info, candidate_object.shape,
+        candidate_object.kinematics.pose_with_covariance.pose);
       if (!is_shape_estimated) {
         continue;
       }
-      const float iou = object_recognition_utils::get2dIoU(
-        highest_iou_object_in_current_iter.object, target_object);
+      const float iou = object_recognition_utils::get2dIoU(candidate_object, target_object);
       if (highest_iou_in_current_iter < iou) {
         highest_iou_in_current_iter = iou;
-        setClusterInObjectWithFeature(
-          under_segmented_cluster.header, divided_cluster, highest_iou_object_in_current_iter);
+        highest_iou_cluster_in_current_iter = &divided_cluster;
+        highest_iou_object_in_current_iter.object.shape = candidate_object.shape;
+        highest_iou_object_in_current_iter.object.kinematics.pose_with_covariance.pose =
+          candidate_object.kinematics.pose_with_covariance.pose;
       }
     }
 
@@ -381,6 +410,10 @@ float DetectionByTracker::optimizeUnderSegmentedObject(
     if (highest_iou_in_current_iter < highest_iou) {
       break;
     }
+    if (highest_iou_cluster_in_current_iter) {
+      setClusterInObjectWithFeature(
+        header, *highest_iou_cluster_in_current_iter, highest_iou_object_in_current_iter);
+    }
 
     // copy for next iteration
     highest_iou = highest_iou_in_current_iter;
@@ -399,6 +432,7 @@ float DetectionByTracker::optimizeUnderSegmentedObject(
 void DetectionByTracker::mergeOverSegmentedObjects(
   const autoware_auto_perception_msgs::msg::DetectedObjects & tracked_objects,
   const tier4_perception_msgs::msg::DetectedObjectsWithFeature & in_cluster_objects,
+  const std::vector<pcl::PointCloud<pcl::PointXYZ>::ConstPtr> & in_pcl_clusters,
   autoware_auto_perception_msgs::msg::DetectedObjects & out_no_found_tracked_objects,
   tier4_perception_msgs::msg::DetectedObjectsWithFeature & out_objects)
 {
@@ -406,19 +440,26 @@ void DetectionByTracker::mergeOverSegmentedObjects(
   out_objects.header = in_cluster_objects.header;
   out_no_found_tracked_objects.header = tracked_objects.header;
 
-  for (const auto & tracked_object : tracked_objects.objects) {
+  // NOTE: The tracked objects are merged in parallel as the divider does.
+  const size_t num_tracked_objects = tracked_objects.objects.size();
+  std::vector<std::optional<tier4_perception_msgs::msg::DetectedObjectWithFeature>>
+    merged_objects(num_tracked_objects);
+#pragma omp parallel for schedule(dynamic)
+  for (size_t i = 0; i < num_tracked_objects; ++i) {
+    const auto & tracked_object = tracked_objects.objects.at(i);
     const auto & label = tracked_object.classification.front().label;
     if (tracker_ignore_.isIgnore(label)) continue;
 
     // change search range according to label type
-    const float max_search_range = max_search_distance_for_merger_[label];
+    const float max_search_range = max_search_distance_for_merger_.at(label);
 
     // extend shape
     autoware_auto_perception_msgs::msg::DetectedObject extended_tracked_object = tracked_object;
     extended_tracked_object.shape = extendShape(tracked_object.shape, /*scale*/ 1.1);
 
     pcl::PointCloud<pcl::PointXYZ> pcl_merged_cluster;
-    for (const auto & initial_object : in_cluster_objects.feature_objects) {
+    for (size_t j = 0; j < in_cluster_objects.feature_objects.size(); ++j) {
+      const auto & initial_object = in_cluster_objects.feature_objects.at(j);
       const float distance = tier4_autoware_utils::calcDistance2d(
         tracked_object.kinematics.pose_with_covariance.pose,
         initial_object.object.kinematics.pose_with_covariance.pose);
@@ -433,13 +474,10 @@ void DetectionByTracker::mergeOverSegmentedObjects(
       if (precision < precision_threshold) {
         continue;
       }
-      pcl::PointCloud<pcl::PointXYZ> pcl_cluster;
-      pcl::fromROSMsg(initial_object.feature.cluster, pcl_cluster);
-      pcl_merged_cluster += pcl_cluster;
+      pcl_merged_cluster += *in_pcl_clusters.at(j);
     }
 
     if (pcl_merged_cluster.points.empty()) {  // if clusters aren't found
-      out_no_found_tracked_objects.objects.push_back(tracked_object);
       continue;
     }
 
@@ -454,14 +492,24 @@ void DetectionByTracker::mergeOverSegmentedObjects(
       getReferenceShapeSizeInfo(label, tracked_object.shape), feature_object.object.shape,
       feature_object.object.kinematics.pose_with_covariance.pose);
     if (!is_shape_estimated) {
-      out_no_found_tracked_objects.objects.push_back(tracked_object);
       continue;
     }
 
     feature_object.object.existence_probability =
       object_recognition_utils::get2dIoU(tracked_object, feature_object.object);
     setClusterInObjectWithFeature(in_cluster_objects.header, pcl_merged_cluster, feature_object);
-    out_objects.feature_objects.push_back(feature_object);
+    merged_objects.at(i) = feature_object;
+  }
+
+  for (size_t i = 0; i < num_tracked_objects; ++i) {
+    const auto & tracked_object = tracked_objects.objects.at(i);
+    if (tracker_ignore_.isIgnore(tracked_object.classification.front().label)) continue;
+
+    if (merged_objects.at(i)) {
+      out_objects.feature_objects.push_back(merged_objects.at(i).value());
+    } else {  // if clusters aren't found or the shape isn't estimated
+      out_no_found_tracked_objects.objects.push_back(tracked_object);
+    }
   }
 }
 
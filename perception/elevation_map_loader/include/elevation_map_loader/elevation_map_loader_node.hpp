@@ -90,6 +90,7 @@ private:
   void setVerbosityLevelToDebugIfFlagSet();
   void createElevationMapFromPointcloud(
     const pcl::shared_ptr<grid_map::GridMapPclLoader> & grid_map_pcl_loader);
+  void createElevationMapFromTiles(const rclcpp::Logger & grid_map_logger);
   void inpaintElevationMap(const float radius);
   pcl::PointCloud<pcl::PointXYZ>::Ptr createPointcloudFromElevationMap();
   void saveElevationMap();
@@ -103,6 +104,9 @@ private:
   unsigned int sequential_map_load_num_;
   bool use_elevation_map_cloud_publisher_;
   std::string param_file_path_;
+  bool use_tiled_build_;
+  double tile_size_;
+  int num_tile_build_threads_;
   bool is_map_metadata_received_ = false;
   bool is_map_received_ = false;
   bool is_elevation_map_published_ = false;
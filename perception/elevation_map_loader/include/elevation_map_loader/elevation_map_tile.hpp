@@ -0,0 +1,52 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ELEVATION_MAP_LOADER__ELEVATION_MAP_TILE_HPP_
+#define ELEVATION_MAP_LOADER__ELEVATION_MAP_TILE_HPP_
+
+#include <grid_map_core/GridMap.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <filesystem>
+#include <string>
+
+namespace elevation_map_loader
+{
+/**
+ * @brief hash of the points of a tile and the parameters to build it
+ * @details the tiles are cached by the hash, so a tile is built again only if its points or the
+ * parameters change.
+ */
+std::string computeTileHash(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud, const std::string & parameters);
+
+/**
+ * @brief save a layer of the tile as a raw array of float with a small header
+ * @return true if success to save the tile
+ */
+bool saveTile(
+  const std::filesystem::path & path, const grid_map::GridMap & tile, const std::string & layer);
+
+/**
+ * @brief load a layer of the tile saved by saveTile
+ * @details the file is memory-mapped and the layer is copied from it at once.
+ * @return false if the file does not exist or is broken
+ */
+bool loadTile(
+  const std::filesystem::path & path, const std::string & layer, grid_map::GridMap & tile);
+}  // namespace elevation_map_loader
+
+#endif  // ELEVATION_MAP_LOADER__ELEVATION_MAP_TILE_HPP_
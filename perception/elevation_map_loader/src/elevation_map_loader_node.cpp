@@ -14,6 +14,8 @@
 
 #include "elevation_map_loader/elevation_map_loader_node.hpp"
 
+#include "elevation_map_loader/elevation_map_tile.hpp"
+
 #include <grid_map_core/GridMap.hpp>
 #include <grid_map_cv/InpaintFilter.hpp>
 #include <grid_map_pcl/GridMapPclLoader.hpp>
@@ -38,9 +40,16 @@
 #include <pcl_conversions/pcl_conversions.h>
 #include <sensor_msgs/msg/point_cloud2.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <filesystem>
+#include <fstream>
+#include <limits>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -55,6 +64,18 @@
 #include <rosbag2_storage_default_plugins/sqlite/sqlite_statement_wrapper.hpp>
 #endif
 
+namespace
+{
+// NOTE: The margin has to be larger than the resolution of the grid map, so that the cells on the
+//       edges of a tile are evaluated with the points of the neighboring tiles.
+constexpr double tile_margin = 1.0;
+
+int64_t toTileKey(const int64_t x, const int64_t y)
+{
+  return (x << 32) ^ (y & 0xffffffff);
+}
+}  // namespace
+
 ElevationMapLoaderNode::ElevationMapLoaderNode(const rclcpp::NodeOptions & options)
 : Node("elevation_map_loader", options)
 {
@@ -72,6 +93,12 @@ ElevationMapLoaderNode::ElevationMapLoaderNode(const rclcpp::NodeOptions & optio
   inpaint_radius_ = this->declare_parameter("inpaint_radius", 0.3);
   use_elevation_map_cloud_publisher_ =
     this->declare_parameter("use_elevation_map_cloud_publisher", false);
+  use_tiled_build_ = this->declare_parameter("use_tiled_build", false);
+  tile_size_ = this->declare_parameter("tile_size", 100.0);
+  if (tile_size_ <= tile_margin) {
+    throw std::runtime_error("tile_size should be larger than 1.0.");
+  }
+  num_tile_build_threads_ = std::max(this->declare_parameter("num_tile_build_threads", 4), 1);
   elevation_map_directory_ = this->declare_parameter("elevation_map_directory", "path_default");
   const bool use_lane_filter = this->declare_parameter("use_lane_filter", false);
   data_manager_.use_lane_filter_ = use_lane_filter;
@@ -326,7 +353,9 @@ void ElevationMapLoaderNode::createElevationMap()
 {
   auto grid_map_logger = rclcpp::get_logger("grid_map_logger");
   grid_map_logger.set_level(rclcpp::Logger::Level::Error);
-  {
+  if (use_tiled_build_) {
+    createElevationMapFromTiles(grid_map_logger);
+  } else {
     pcl::shared_ptr<grid_map::GridMapPclLoader> grid_map_pcl_loader =
       pcl::make_shared<grid_map::GridMapPclLoader>(grid_map_logger);
     grid_map_pcl_loader->loadParameters(param_file_path_);
@@ -351,6 +380,119 @@ void ElevationMapLoaderNode::createElevationMapFromPointcloud(
     start, "Finish creating elevation map. Total time: ", this->get_logger());
 }
 
+void ElevationMapLoaderNode::createElevationMapFromTiles(const rclcpp::Logger & grid_map_logger)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+
+  struct Tile
+  {
+    pcl::PointCloud<pcl::PointXYZ>::Ptr cloud;
+    grid_map::GridMap map;
+    bool is_valid{false};
+  };
+
+  // Split the pointcloud map into the tiles with the margin, and get the bounds of the whole map
+  std::unordered_map<int64_t, size_t> tile_indices;
+  std::vector<Tile> tiles;
+  grid_map::Position min_position(
+    std::numeric_limits<double>::max(), std::numeric_limits<double>::max());
+  grid_map::Position max_position(
+    std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest());
+  for (const auto & p : data_manager_.map_pcl_ptr_->points) {
+    if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z)) {
+      continue;
+    }
+    min_position = min_position.cwiseMin(grid_map::Position(p.x, p.y));
+    max_position = max_position.cwiseMax(grid_map::Position(p.x, p.y));
+    const auto min_x = static_cast<int64_t>(std::floor((p.x - tile_margin) / tile_size_));
+    const auto max_x = static_cast<int64_t>(std::floor((p.x + tile_margin) / tile_size_));
+    const auto min_y = static_cast<int64_t>(std::floor((p.y - tile_margin) / tile_size_));
+    const auto max_y = static_cast<int64_t>(std::floor((p.y + tile_margin) / tile_size_));
+    for (int64_t x = min_x; x <= max_x; ++x) {
+      for (int64_t y = min_y; y <= max_y; ++y) {
+        const auto [it, is_new] = tile_indices.emplace(toTileKey(x, y), tiles.size());
+        if (is_new) {
+          tiles.push_back(Tile{pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>()});
+        }
+        tiles.at(it->second).cloud->push_back(p);
+      }
+    }
+  }
+  if (tiles.empty()) {
+    RCLCPP_ERROR(this->get_logger(), "The pointcloud map has no valid point.");
+    return;
+  }
+
+  // The tiles are built again only if their points or the parameters change
+  std::string parameters;
+  {
+    std::ifstream param_file(param_file_path_);
+    std::stringstream buffer;
+    buffer << param_file.rdbuf() << layer_name_;
+    parameters = buffer.str();
+  }
+  const auto tile_directory = std::filesystem::path(elevation_map_directory_) / "tiles";
+  std::filesystem::create_directories(tile_directory);
+
+  // Build or load the tiles in parallel
+  std::atomic<size_t> next_tile{0};
+  std::atomic<size_t> num_loaded_tiles{0};
+  const auto build_tiles = [&]() {
+    for (size_t i = next_tile++; i < tiles.size(); i = next_tile++) {
+      auto & tile = tiles.at(i);
+      const auto tile_path =
+        tile_directory / (elevation_map_loader::computeTileHash(*tile.cloud, parameters) + ".tile");
+      if (elevation_map_loader::loadTile(tile_path, layer_name_, tile.map)) {
+        tile.is_valid = true;
+        ++num_loaded_tiles;
+        continue;
+      }
+      auto grid_map_pcl_loader = pcl::make_shared<grid_map::GridMapPclLoader>(grid_map_logger);
+      grid_map_pcl_loader->loadParameters(param_file_path_);
+      grid_map_pcl_loader->setInputCloud(tile.cloud);
+      grid_map_pcl_loader->preProcessInputCloud();
+      grid_map_pcl_loader->initializeGridMapGeometryFromInputCloud();
+      grid_map_pcl_loader->addLayerFromInputCloud(layer_name_);
+      tile.map = grid_map_pcl_loader->getGridMap();
+      tile.is_valid = true;
+      elevation_map_loader::saveTile(tile_path, tile.map, layer_name_);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_tile_build_threads_; ++i) {
+    threads.emplace_back(build_tiles);
+  }
+  build_tiles();
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  // Merge the tiles, each cell of which is taken from the tile containing it without the margin
+  elevation_map_ = grid_map::GridMap({layer_name_});
+  elevation_map_.setGeometry(
+    grid_map::Length(max_position - min_position), tiles.front().map.getResolution(),
+    grid_map::Position((max_position + min_position) / 2.0));
+  for (grid_map::GridMapIterator iterator(elevation_map_); !iterator.isPastEnd(); ++iterator) {
+    grid_map::Position position;
+    elevation_map_.getPosition(*iterator, position);
+    const auto tile_index = tile_indices.find(toTileKey(
+      static_cast<int64_t>(std::floor(position.x() / tile_size_)),
+      static_cast<int64_t>(std::floor(position.y() / tile_size_))));
+    if (tile_index == tile_indices.end()) {
+      continue;
+    }
+    const auto & tile = tiles.at(tile_index->second);
+    if (tile.is_valid && tile.map.isInside(position)) {
+      elevation_map_.at(layer_name_, *iterator) = tile.map.atPosition(layer_name_, position);
+    }
+  }
+  RCLCPP_INFO(
+    this->get_logger(), "Loaded %zu of %zu elevation map tiles from the cache.",
+    num_loaded_tiles.load(), tiles.size());
+  grid_map::grid_map_pcl::printTimeElapsedToRosInfoStream(
+    start, "Finish creating elevation map. Total time: ", this->get_logger());
+}
+
 void ElevationMapLoaderNode::inpaintElevationMap(const float radius)
 {
   // Convert elevation layer to OpenCV image to fill in holes.
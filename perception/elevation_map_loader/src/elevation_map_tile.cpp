@@ -0,0 +1,153 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "elevation_map_loader/elevation_map_tile.hpp"
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace
+{
+constexpr char tile_magic[8] = {'E', 'M', 'T', 'I', 'L', 'E', '0', '1'};
+
+struct TileHeader
+{
+  char magic[8];
+  double resolution;
+  double position_x;
+  double position_y;
+  double length_x;
+  double length_y;
+  uint32_t size_x;
+  uint32_t size_y;
+};
+
+// FNV-1a
+class Hasher
+{
+public:
+  void update(const void * data, const size_t size)
+  {
+    const auto * bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i) {
+      hash_ = (hash_ ^ bytes[i]) * 0x100000001b3ULL;
+    }
+  }
+  uint64_t hash() const { return hash_; }
+
+private:
+  uint64_t hash_{0xcbf29ce484222325ULL};
+};
+}  // namespace
+
+namespace elevation_map_loader
+{
+std::string computeTileHash(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud, const std::string & parameters)
+{
+  Hasher hasher;
+  hasher.update(parameters.data(), parameters.size());
+  for (const auto & p : cloud.points) {
+    const float xyz[3] = {p.x, p.y, p.z};
+    hasher.update(xyz, sizeof(xyz));
+  }
+  std::ostringstream stream;
+  stream << std::hex << std::setw(16) << std::setfill('0') << hasher.hash();
+  return stream.str();
+}
+
+bool saveTile(
+  const std::filesystem::path & path, const grid_map::GridMap & tile, const std::string & layer)
+{
+  if (!tile.exists(layer)) {
+    return false;
+  }
+  // The layer is written in the order of the storage, which starts from the index (0, 0)
+  grid_map::GridMap default_start_tile = tile;
+  default_start_tile.convertToDefaultStartIndex();
+  const grid_map::Matrix & data = default_start_tile.get(layer);
+
+  TileHeader header{};
+  std::memcpy(header.magic, tile_magic, sizeof(tile_magic));
+  header.resolution = tile.getResolution();
+  header.position_x = tile.getPosition().x();
+  header.position_y = tile.getPosition().y();
+  header.length_x = tile.getLength().x();
+  header.length_y = tile.getLength().y();
+  header.size_x = static_cast<uint32_t>(data.rows());
+  header.size_y = static_cast<uint32_t>(data.cols());
+
+  // Write to a temporary file and rename it, so a broken tile is never loaded
+  const auto temporary_path = std::filesystem::path(path).concat(".tmp");
+  {
+    std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(
+      reinterpret_cast<const char *>(data.data()),
+      static_cast<std::streamsize>(data.size() * sizeof(float)));
+    if (!file) {
+      return false;
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(temporary_path, path, error);
+  return !error;
+}
+
+bool loadTile(
+  const std::filesystem::path & path, const std::string & layer, grid_map::GridMap & tile)
+{
+  if (!std::filesystem::exists(path)) {
+    return false;
+  }
+  boost::iostreams::mapped_file_source file;
+  try {
+    file.open(path.string());
+  } catch (const std::exception &) {
+    return false;
+  }
+  if (!file.is_open() || file.size() < sizeof(TileHeader)) {
+    return false;
+  }
+
+  TileHeader header{};
+  std::memcpy(&header, file.data(), sizeof(header));
+  const size_t data_size = static_cast<size_t>(header.size_x) * header.size_y * sizeof(float);
+  if (
+    std::memcmp(header.magic, tile_magic, sizeof(tile_magic)) != 0 ||
+    file.size() != sizeof(header) + data_size) {
+    return false;
+  }
+
+  tile = grid_map::GridMap({layer});
+  tile.setGeometry(
+    grid_map::Length(header.length_x, header.length_y), header.resolution,
+    grid_map::Position(header.position_x, header.position_y));
+  grid_map::Matrix & data = tile.get(layer);
+  if (
+    data.rows() != static_cast<Eigen::Index>(header.size_x) ||
+    data.cols() != static_cast<Eigen::Index>(header.size_y)) {
+    return false;
+  }
+  std::memcpy(data.data(), file.data() + sizeof(header), data_size);
+  return true;
+}
+}  // namespace elevation_map_loader
@@ -0,0 +1,37 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <pcl/PointIndices.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <vector>
+
+namespace euclidean_cluster
+{
+/**
+ * @brief cluster the points as pcl::EuclideanClusterExtraction does, connecting the points closer
+ * than the tolerance, with a grid of cells of the tolerance size instead of a k-d tree
+ * @details the pairs in the neighbouring cells are checked in parallel and joined with a lock-free
+ * union-find. the clusters are sorted by their smallest point index, with sorted indices.
+ * @param use_height use point.z, otherwise the points are clustered on the xy plane
+ * @param min_cluster_size the clusters with fewer points are dropped
+ * @param max_cluster_size the clusters with more points are dropped
+ */
+std::vector<pcl::PointIndices> extractClustersByUnionFind(
+  const pcl::PointCloud<pcl::PointXYZ> & pointcloud, float tolerance, bool use_height,
+  int min_cluster_size, int max_cluster_size);
+}  // namespace euclidean_cluster
@@ -44,12 +44,21 @@ public:
   {
     min_points_number_per_voxel_ = min_points_number_per_voxel;
   }
+  // cluster the voxels on a grid with a union-find instead of a k-d tree
+  void setUseUnionFind(bool use_union_find) { use_union_find_ = use_union_find; }
 
 private:
+  // cluster the voxels of the points, and return the number of the clusters
+  // point_cluster_indices is the cluster index of each point, or -1 if it is not clustered
+  size_t clusterVoxels(
+    const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
+    std::vector<int> & point_cluster_indices);
+
   pcl::VoxelGrid<pcl::PointXYZ> voxel_grid_;
   float tolerance_;
   float voxel_leaf_size_;
   int min_points_number_per_voxel_;
+  bool use_union_find_ = false;
 };
 
 }  // namespace euclidean_cluster
@@ -0,0 +1,198 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "euclidean_cluster/union_find_grid_cluster.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+using Parents = std::vector<std::atomic<int>>;
+
+// 21 bits per axis, i.e. +-1M cells
+constexpr int axis_bits = 21;
+constexpr int64_t axis_mask = (int64_t{1} << axis_bits) - 1;
+
+uint64_t toCellKey(const int64_t x, const int64_t y, const int64_t z)
+{
+  return (static_cast<uint64_t>(x & axis_mask) << (2 * axis_bits)) |
+         (static_cast<uint64_t>(y & axis_mask) << axis_bits) | static_cast<uint64_t>(z & axis_mask);
+}
+
+// the offsets to the neighbouring cells in one direction, each pair of cells is checked once
+std::vector<std::array<int, 3>> getHalfNeighbourOffsets(const bool use_height)
+{
+  std::vector<std::array<int, 3>> offsets;
+  const int z_range = use_height ? 1 : 0;
+  for (int dz = -z_range; dz <= z_range; ++dz) {
+    for (int dy = -1; dy <= 1; ++dy) {
+      for (int dx = -1; dx <= 1; ++dx) {
+        if (dz > 0 || (dz == 0 && dy > 0) || (dz == 0 && dy == 0 && dx > 0)) {
+          offsets.push_back({dx, dy, dz});
+        }
+      }
+    }
+  }
+  return offsets;
+}
+
+int findRoot(Parents & parents, int index)
+{
+  while (true) {
+    int parent = parents[index].load();
+    if (parent == index) {
+      return index;
+    }
+    // path halving, a concurrent update only moves the parent closer to the root
+    const int grandparent = parents[parent].load();
+    if (parent != grandparent) {
+      parents[index].compare_exchange_weak(parent, grandparent);
+    }
+    index = grandparent;
+  }
+}
+
+// the larger root is linked to the smaller one, so the root of a set is its smallest index
+void unite(Parents & parents, int a, int b)
+{
+  while (true) {
+    a = findRoot(parents, a);
+    b = findRoot(parents, b);
+    if (a == b) {
+      return;
+    }
+    if (a < b) {
+      std::swap(a, b);
+    }
+    int expected = a;
+    if (parents[a].compare_exchange_strong(expected, b)) {
+      return;
+    }
+  }
+}
+}  // namespace
+
+namespace euclidean_cluster
+{
+std::vector<pcl::PointIndices> extractClustersByUnionFind(
+  const pcl::PointCloud<pcl::PointXYZ> & pointcloud, float tolerance, bool use_height,
+  int min_cluster_size, int max_cluster_size)
+{
+  const int points_num = static_cast<int>(pointcloud.points.size());
+  Parents parents(points_num);
+  for (int i = 0; i < points_num; ++i) {
+    parents[i].store(i);
+  }
+
+  if (0.0f < tolerance) {
+    // sort the points by cell, the points which are not finite stay alone
+    std::vector<std::pair<uint64_t, int>> cell_points;
+    cell_points.reserve(points_num);
+    std::vector<std::array<int64_t, 3>> point_cells(points_num);
+    for (int i = 0; i < points_num; ++i) {
+      const auto & point = pointcloud.points[i];
+      if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z)) {
+        continue;
+      }
+      auto & cell = point_cells[i];
+      cell[0] = static_cast<int64_t>(std::floor(point.x / tolerance));
+      cell[1] = static_cast<int64_t>(std::floor(point.y / tolerance));
+      cell[2] = use_height ? static_cast<int64_t>(std::floor(point.z / tolerance)) : 0;
+      cell_points.emplace_back(toCellKey(cell[0], cell[1], cell[2]), i);
+    }
+    std::sort(cell_points.begin(), cell_points.end());
+
+    // [begin, end) of each cell in cell_points
+    std::vector<std::pair<size_t, size_t>> cells;
+    std::unordered_map<uint64_t, size_t> cell_map;
+    for (size_t begin = 0; begin < cell_points.size();) {
+      size_t end = begin + 1;
+      while (end < cell_points.size() && cell_points[end].first == cell_points[begin].first) {
+        ++end;
+      }
+      cell_map.emplace(cell_points[begin].first, cells.size());
+      cells.emplace_back(begin, end);
+      begin = end;
+    }
+
+    const float squared_tolerance = tolerance * tolerance;
+    const auto is_close = [&](const int a, const int b) {
+      const auto & point_a = pointcloud.points[a];
+      const auto & point_b = pointcloud.points[b];
+      const float dx = point_a.x - point_b.x;
+      const float dy = point_a.y - point_b.y;
+      const float dz = use_height ? point_a.z - point_b.z : 0.0f;
+      return dx * dx + dy * dy + dz * dz <= squared_tolerance;
+    };
+    const auto connect = [&](const int a, const int b) {
+      if (findRoot(parents, a) != findRoot(parents, b) && is_close(a, b)) {
+        unite(parents, a, b);
+      }
+    };
+
+    const auto neighbour_offsets = getHalfNeighbourOffsets(use_height);
+    const int cells_num = static_cast<int>(cells.size());
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int cell_index = 0; cell_index < cells_num; ++cell_index) {
+      const auto [begin, end] = cells[cell_index];
+      for (size_t i = begin; i < end; ++i) {
+        for (size_t j = i + 1; j < end; ++j) {
+          connect(cell_points[i].second, cell_points[j].second);
+        }
+      }
+
+      const auto & cell = point_cells[cell_points[begin].second];
+      for (const auto & offset : neighbour_offsets) {
+        const auto neighbour = cell_map.find(
+          toCellKey(cell[0] + offset[0], cell[1] + offset[1], cell[2] + offset[2]));
+        if (neighbour == cell_map.end()) {
+          continue;
+        }
+        const auto [neighbour_begin, neighbour_end] = cells[neighbour->second];
+        for (size_t i = begin; i < end; ++i) {
+          for (size_t j = neighbour_begin; j < neighbour_end; ++j) {
+            connect(cell_points[i].second, cell_points[j].second);
+          }
+        }
+      }
+    }
+  }
+
+  // the roots are visited first in the order of the points
+  std::vector<pcl::PointIndices> clusters;
+  std::vector<int> root_to_cluster(points_num, -1);
+  for (int i = 0; i < points_num; ++i) {
+    const int root = findRoot(parents, i);
+    if (root == i) {
+      root_to_cluster[i] = static_cast<int>(clusters.size());
+      clusters.emplace_back();
+    }
+    clusters[root_to_cluster[root]].indices.push_back(i);
+  }
+
+  const auto is_invalid_size = [&](const pcl::PointIndices & cluster) {
+    const int size = static_cast<int>(cluster.indices.size());
+    return size < min_cluster_size || max_cluster_size < size;
+  };
+  clusters.erase(
+    std::remove_if(clusters.begin(), clusters.end(), is_invalid_size), clusters.end());
+  return clusters;
+}
+}  // namespace euclidean_cluster
@@ -14,10 +14,13 @@
 
 #include "euclidean_cluster/voxel_grid_based_euclidean_cluster.hpp"
 
+#include "euclidean_cluster/union_find_grid_cluster.hpp"
+
 #include <pcl/kdtree/kdtree.h>
 #include <pcl/segmentation/extract_clusters.h>
 
-#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace euclidean_cluster
 {
@@ -40,69 +43,56 @@ VoxelGridBasedEuclideanCluster::VoxelGridBasedEuclideanCluster(
   min_points_number_per_voxel_(min_points_number_per_voxel)
 {
 }
-// TODO(badai-nguyen): remove this function when field copying also implemented for
-// euclidean_cluster.cpp
 bool VoxelGridBasedEuclideanCluster::cluster(
   const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
   std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters)
 {
-  (void)pointcloud;
-  (void)clusters;
-  return false;
+  std::vector<int> point_cluster_indices;
+  const size_t num_clusters = clusterVoxels(pointcloud, point_cluster_indices);
+
+  // create vector of point cloud cluster. vector index is cluster index.
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> temporary_clusters(num_clusters);
+  for (size_t i = 0; i < pointcloud->points.size(); ++i) {
+    const int cluster_idx = point_cluster_indices.at(i);
+    if (cluster_idx < 0) {
+      continue;
+    }
+    auto & temporary_cluster = temporary_clusters.at(cluster_idx);
+    if (max_cluster_size_ <= static_cast<int>(temporary_cluster.points.size())) {
+      continue;
+    }
+    temporary_cluster.points.push_back(pointcloud->points.at(i));
+  }
+
+  // build output and check cluster size
+  clusters.clear();
+  for (auto & temporary_cluster : temporary_clusters) {
+    if (static_cast<int>(temporary_cluster.points.size()) < min_cluster_size_) {
+      continue;
+    }
+    temporary_cluster.width = temporary_cluster.points.size();
+    temporary_cluster.height = 1;
+    temporary_cluster.is_dense = false;
+    clusters.push_back(std::move(temporary_cluster));
+  }
+  return true;
 }
 
 bool VoxelGridBasedEuclideanCluster::cluster(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr & pointcloud_msg,
   tier4_perception_msgs::msg::DetectedObjectsWithFeature & objects)
 {
-  // TODO(Saito) implement use_height is false version
-
-  // create voxel
   pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud(new pcl::PointCloud<pcl::PointXYZ>);
   int point_step = pointcloud_msg->point_step;
   pcl::fromROSMsg(*pointcloud_msg, *pointcloud);
-  pcl::PointCloud<pcl::PointXYZ>::Ptr voxel_map_ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  voxel_grid_.setLeafSize(voxel_leaf_size_, voxel_leaf_size_, 100000.0);
-  voxel_grid_.setMinimumPointsNumberPerVoxel(min_points_number_per_voxel_);
-  voxel_grid_.setInputCloud(pointcloud);
-  voxel_grid_.setSaveLeafLayout(true);
-  voxel_grid_.filter(*voxel_map_ptr);
-
-  // voxel is pressed 2d
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_2d_ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  for (const auto & point : voxel_map_ptr->points) {
-    pcl::PointXYZ point2d;
-    point2d.x = point.x;
-    point2d.y = point.y;
-    point2d.z = 0.0;
-    pointcloud_2d_ptr->push_back(point2d);
-  }
-
-  // create tree
-  pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
-  tree->setInputCloud(pointcloud_2d_ptr);
+  std::vector<int> point_cluster_indices;
+  const size_t num_clusters = clusterVoxels(pointcloud, point_cluster_indices);
 
-  // clustering
-  std::vector<pcl::PointIndices> cluster_indices;
-  pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
-  pcl_euclidean_cluster.setClusterTolerance(tolerance_);
-  pcl_euclidean_cluster.setMinClusterSize(1);
-  pcl_euclidean_cluster.setMaxClusterSize(max_cluster_size_);
-  pcl_euclidean_cluster.setSearchMethod(tree);
-  pcl_euclidean_cluster.setInputCloud(pointcloud_2d_ptr);
-  pcl_euclidean_cluster.extract(cluster_indices);
-
-  // create map to search cluster index from voxel grid index
-  std::unordered_map</* voxel grid index */ int, /* cluster index */ int> map;
   std::vector<sensor_msgs::msg::PointCloud2> temporary_clusters;  // no check about cluster size
   std::vector<size_t> clusters_data_size;
-  temporary_clusters.resize(cluster_indices.size());
-  for (size_t cluster_idx = 0; cluster_idx < cluster_indices.size(); ++cluster_idx) {
-    const auto & cluster = cluster_indices.at(cluster_idx);
+  temporary_clusters.resize(num_clusters);
+  for (size_t cluster_idx = 0; cluster_idx < num_clusters; ++cluster_idx) {
     auto & temporary_cluster = temporary_clusters.at(cluster_idx);
-    for (const auto & point_idx : cluster.indices) {
-      map[point_idx] = cluster_idx;
-    }
     temporary_cluster.height = pointcloud_msg->height;
     temporary_cluster.fields = pointcloud_msg->fields;
     temporary_cluster.point_step = point_step;
@@ -110,21 +100,20 @@ bool VoxelGridBasedEuclideanCluster::cluster(
     clusters_data_size.push_back(0);
   }
 
-  // create vector of point cloud cluster. vector index is voxel grid index.
+  // create vector of point cloud cluster. vector index is cluster index.
   for (size_t i = 0; i < pointcloud->points.size(); ++i) {
-    const auto & point = pointcloud->points.at(i);
-    const int index =
-      voxel_grid_.getCentroidIndexAt(voxel_grid_.getGridCoordinates(point.x, point.y, point.z));
-    if (map.find(index) != map.end()) {
-      auto & cluster_data_size = clusters_data_size.at(map[index]);
-      if (cluster_data_size + point_step > std::size_t(max_cluster_size_ * point_step)) {
-        continue;
-      }
-      std::memcpy(
-        &temporary_clusters.at(map[index]).data[cluster_data_size],
-        &pointcloud_msg->data[i * point_step], point_step);
-      cluster_data_size += point_step;
+    const int cluster_idx = point_cluster_indices.at(i);
+    if (cluster_idx < 0) {
+      continue;
+    }
+    auto & cluster_data_size = clusters_data_size.at(cluster_idx);
+    if (cluster_data_size + point_step > std::size_t(max_cluster_size_ * point_step)) {
+      continue;
     }
+    std::memcpy(
+      &temporary_clusters.at(cluster_idx).data[cluster_data_size],
+      &pointcloud_msg->data[i * point_step], point_step);
+    cluster_data_size += point_step;
   }
 
   // build output and check cluster size
@@ -162,4 +151,68 @@ bool VoxelGridBasedEuclideanCluster::cluster(
   return true;
 }
 
+size_t VoxelGridBasedEuclideanCluster::clusterVoxels(
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
+  std::vector<int> & point_cluster_indices)
+{
+  // TODO(Saito) implement use_height is false version
+
+  // create voxel
+  pcl::PointCloud<pcl::PointXYZ>::Ptr voxel_map_ptr(new pcl::PointCloud<pcl::PointXYZ>);
+  voxel_grid_.setLeafSize(voxel_leaf_size_, voxel_leaf_size_, 100000.0);
+  voxel_grid_.setMinimumPointsNumberPerVoxel(min_points_number_per_voxel_);
+  voxel_grid_.setInputCloud(pointcloud);
+  voxel_grid_.setSaveLeafLayout(true);
+  voxel_grid_.filter(*voxel_map_ptr);
+
+  // voxel is pressed 2d
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_2d_ptr(new pcl::PointCloud<pcl::PointXYZ>);
+  for (const auto & point : voxel_map_ptr->points) {
+    pcl::PointXYZ point2d;
+    point2d.x = point.x;
+    point2d.y = point.y;
+    point2d.z = 0.0;
+    pointcloud_2d_ptr->push_back(point2d);
+  }
+
+  // clustering
+  std::vector<pcl::PointIndices> cluster_indices;
+  if (use_union_find_) {
+    cluster_indices =
+      extractClustersByUnionFind(*pointcloud_2d_ptr, tolerance_, false, 1, max_cluster_size_);
+  } else {
+    // create tree
+    pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
+    tree->setInputCloud(pointcloud_2d_ptr);
+
+    pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
+    pcl_euclidean_cluster.setClusterTolerance(tolerance_);
+    pcl_euclidean_cluster.setMinClusterSize(1);
+    pcl_euclidean_cluster.setMaxClusterSize(max_cluster_size_);
+    pcl_euclidean_cluster.setSearchMethod(tree);
+    pcl_euclidean_cluster.setInputCloud(pointcloud_2d_ptr);
+    pcl_euclidean_cluster.extract(cluster_indices);
+  }
+
+  // search cluster index from voxel grid index, which is -1 if the voxel is not clustered
+  std::vector<int> voxel_cluster_indices(voxel_map_ptr->points.size(), -1);
+  for (size_t cluster_idx = 0; cluster_idx < cluster_indices.size(); ++cluster_idx) {
+    for (const auto & point_idx : cluster_indices.at(cluster_idx).indices) {
+      voxel_cluster_indices.at(point_idx) = static_cast<int>(cluster_idx);
+    }
+  }
+
+  // the voxel of each point is found from the leaf layout
+  point_cluster_indices.assign(pointcloud->points.size(), -1);
+  for (size_t i = 0; i < pointcloud->points.size(); ++i) {
+    const auto & point = pointcloud->points.at(i);
+    const int index =
+      voxel_grid_.getCentroidIndexAt(voxel_grid_.getGridCoordinates(point.x, point.y, point.z));
+    if (0 <= index && index < static_cast<int>(voxel_cluster_indices.size())) {
+      point_cluster_indices.at(i) = voxel_cluster_indices.at(index);
+    }
+  }
+  return cluster_indices.size();
+}
+
 }  // namespace euclidean_cluster
@@ -0,0 +1,194 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ament_index_cpp/get_package_share_directory.hpp"
+#include "ground_segmentation/ransac_ground_filter_nodelet.hpp"
+#include "ground_segmentation/ray_ground_filter_nodelet.hpp"
+#include "ground_segmentation/scan_ground_filter_nodelet.hpp"
+#include "pointcloud_preprocessor/utility/filter_benchmark.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// count the allocations of all the libraries for the allocations per frame
+void * operator new(std::size_t size)
+{
+  pointcloud_preprocessor::filter_benchmark::allocationCount().fetch_add(
+    1, std::memory_order_relaxed);
+  if (void * ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+void operator delete(void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+using pointcloud_preprocessor::filter_benchmark::PointCloud2;
+using pointcloud_preprocessor::filter_benchmark::Result;
+
+// expose the filter methods, which are called by the base class otherwise
+template <class Component>
+class BenchmarkComponent : public Component
+{
+public:
+  using Component::Component;
+  using Component::filter;
+};
+
+// the filter methods of ScanGroundFilterComponent are private
+class ScanGroundFilterBenchmark
+{
+public:
+  static void measure(
+    const rclcpp::NodeOptions & options, const std::vector<PointCloud2::ConstSharedPtr> & frames,
+    const size_t iterations, std::vector<Result> & results)
+  {
+    using pointcloud_preprocessor::filter_benchmark::run;
+
+    const auto component =
+      std::make_shared<ground_segmentation::ScanGroundFilterComponent>(options);
+    results.push_back(run(
+      "scan_ground_filter", "filter", frames, iterations,
+      [&](const PointCloud2::ConstSharedPtr & input, PointCloud2 & output) {
+        component->filter(input, nullptr, output);
+      }));
+    const pointcloud_preprocessor::TransformInfo transform_info;
+    results.push_back(run(
+      "scan_ground_filter", "faster_filter", frames, iterations,
+      [&](const PointCloud2::ConstSharedPtr & input, PointCloud2 & output) {
+        component->faster_filter(input, nullptr, output, transform_info);
+      }));
+  }
+};
+
+namespace
+{
+/**
+ * @brief the parameters of the config of the package and the vehicle parameters of the test,
+ * which are not used by the filters but required by VehicleInfoUtil
+ */
+rclcpp::NodeOptions makeOptions(const std::string & config_name)
+{
+  const auto share_dir = ament_index_cpp::get_package_share_directory("ground_segmentation");
+  rclcpp::NodeOptions options;
+  options.arguments(
+    {"--ros-args", "--params-file", share_dir + "/config/" + config_name + ".param.yaml"});
+  options.parameter_overrides({
+    rclcpp::Parameter("wheel_radius", 0.39),
+    rclcpp::Parameter("wheel_width", 0.42),
+    rclcpp::Parameter("wheel_base", 2.74),
+    rclcpp::Parameter("wheel_tread", 1.63),
+    rclcpp::Parameter("front_overhang", 1.0),
+    rclcpp::Parameter("rear_overhang", 1.03),
+    rclcpp::Parameter("left_overhang", 0.1),
+    rclcpp::Parameter("right_overhang", 0.1),
+    rclcpp::Parameter("vehicle_height", 2.5),
+    rclcpp::Parameter("max_steer_angle", 0.7),
+  });
+  return options;
+}
+
+/**
+ * @brief the frame of the test, which is recorded in velodyne_top, moved to base_link with the
+ * same transform as test_scan_ground_filter
+ */
+std::vector<PointCloud2::ConstSharedPtr> loadTestFrame()
+{
+  const auto share_dir = ament_index_cpp::get_package_share_directory("ground_segmentation");
+  const auto frames =
+    pointcloud_preprocessor::filter_benchmark::loadFrames({share_dir + "/data/test.pcd"}, "");
+
+  auto frame = std::make_shared<PointCloud2>(*frames.front());
+  frame->header.frame_id = "base_link";
+  sensor_msgs::PointCloud2Iterator<float> iter_x(*frame, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(*frame, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_z) {
+    *iter_x += 0.6f;
+    *iter_z += 2.0f;
+  }
+  return {frame};
+}
+}  // namespace
+
+/**
+ * @brief measure the filter() and faster_filter() of the ground filters on the frames recorded as
+ * PCD files in base_link, or on the frame of the test if no PCD is given
+ * @details usage: ground_filter_benchmark [--iterations N] [--filter NAME] [--json PATH] [PCD...]
+ */
+int main(int argc, char * argv[])
+{
+  rclcpp::init(argc, argv);
+  const auto options = pointcloud_preprocessor::filter_benchmark::parseOptions(
+    rclcpp::remove_ros_arguments(argc, argv));
+  const auto frames =
+    options.pcd_paths.empty()
+      ? loadTestFrame()
+      : pointcloud_preprocessor::filter_benchmark::loadFrames(options.pcd_paths, "base_link");
+
+  const auto is_selected = [&options](const std::string & name) {
+    return options.filter.empty() || options.filter == name;
+  };
+  std::vector<Result> results;
+  if (is_selected("ray_ground_filter")) {
+    const auto component =
+      std::make_shared<BenchmarkComponent<ground_segmentation::RayGroundFilterComponent>>(
+        makeOptions("ray_ground_filter"));
+    results.push_back(pointcloud_preprocessor::filter_benchmark::run(
+      "ray_ground_filter", "filter", frames, options.iterations,
+      [&](const PointCloud2::ConstSharedPtr & input, PointCloud2 & output) {
+        component->filter(input, nullptr, output);
+      }));
+  }
+  if (is_selected("ransac_ground_filter")) {
+    const auto component =
+      std::make_shared<BenchmarkComponent<ground_segmentation::RANSACGroundFilterComponent>>(
+        makeOptions("ransac_ground_filter"));
+    results.push_back(pointcloud_preprocessor::filter_benchmark::run(
+      "ransac_ground_filter", "filter", frames, options.iterations,
+      [&](const PointCloud2::ConstSharedPtr & input, PointCloud2 & output) {
+        component->filter(input, nullptr, output);
+      }));
+  }
+  if (is_selected("scan_ground_filter")) {
+    ScanGroundFilterBenchmark::measure(
+      makeOptions("scan_ground_filter"), frames, options.iterations, results);
+  }
+
+  for (const auto & r : results) {
+    std::printf(
+      "%-30s %-14s %14.0f points/s %10.1f allocations/frame\n", r.filter.c_str(), r.method.c_str(),
+      r.points_per_sec, r.allocations_per_frame);
+  }
+  if (!options.json_path.empty()) {
+    std::ofstream(options.json_path) << pointcloud_preprocessor::filter_benchmark::toJson(results);
+  }
+
+  rclcpp::shutdown();
+  return 0;
+}
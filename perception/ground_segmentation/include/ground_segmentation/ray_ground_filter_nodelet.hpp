@@ -68,6 +68,8 @@
 #include "ground_segmentation/gencolors.hpp"
 #include "pointcloud_preprocessor/filter.hpp"
 
+#include <tier4_autoware_utils/geometry/radial_bins.hpp>
+
 #include <opencv2/core.hpp>
 #include <opencv2/imgproc.hpp>
 
@@ -104,6 +106,7 @@ class RayGroundFilterComponent : public pointcloud_preprocessor::Filter
     size_t original_index;  // index of this point in the source pointcloud
   };
   typedef std::vector<PointXYZRTColor> PointCloudXYZRTColor;
+  typedef tier4_autoware_utils::RadialBins<PointXYZRTColor> RadialOrderedClouds;
 
 protected:
   void filter(
@@ -121,6 +124,7 @@ private:
     reclass_distance_threshold_;  // distance between points at which re classification will occur
 
   size_t radial_dividers_num_;
+  RadialOrderedClouds radial_ordered_clouds_;  // kept to reuse its buffers over the frames
 
   size_t grid_width_;
   size_t grid_height_;
@@ -156,13 +160,13 @@ private:
    * @param[out] out_organized_points Custom Point Cloud filled with XYZRTZColor data
    * @param[out] out_radial_divided_indices Indices of the points in the original cloud for each
    * radial segment
-   * @param[out] out_radial_ordered_clouds Vector of Points Clouds, each element will contain the
+   * @param[out] out_radial_ordered_clouds Radial bins of the points, each bin will contain the
    * points ordered
    */
   void ConvertXYZIToRTZColor(
     const pcl::PointCloud<PointType_>::Ptr in_cloud, PointCloudXYZRTColor & out_organized_points,
     std::vector<pcl::PointIndices> & out_radial_divided_indices,
-    std::vector<PointCloudXYZRTColor> & out_radial_ordered_clouds);
+    RadialOrderedClouds & out_radial_ordered_clouds);
 
   /*!
    * Classifies Points in the PointCloud as Ground and Not Ground
@@ -174,8 +178,8 @@ private:
    * original PointCloud
    */
   void ClassifyPointCloud(
-    std::vector<PointCloudXYZRTColor> & in_radial_ordered_clouds,
-    pcl::PointIndices & out_ground_indices, pcl::PointIndices & out_no_ground_indices);
+    RadialOrderedClouds & in_radial_ordered_clouds, pcl::PointIndices & out_ground_indices,
+    pcl::PointIndices & out_no_ground_indices);
 
   /*!
    * Returns the resulting complementary PointCloud, one with the points kept and the other removed
@@ -0,0 +1,92 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GROUND_SEGMENTATION__SCAN_GROUND_FILTER_CUDA__SCAN_GROUND_FILTER_CUDA_HPP_
+#define GROUND_SEGMENTATION__SCAN_GROUND_FILTER_CUDA__SCAN_GROUND_FILTER_CUDA_HPP_
+
+#include "ground_segmentation/scan_ground_filter_cuda/scan_ground_filter_kernel.hpp"
+
+#include <cuda_utils/cuda_unique_ptr.hpp>
+#include <cuda_utils/stream_unique_ptr.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ground_segmentation
+{
+/**
+ * @brief grid scan mode of the scan ground filter on the GPU
+ * @details the rays are binned and sorted by radix sort, and each ray is scanned by one thread
+ * with the same checks as the CPU implementation. the object points stay on the device after
+ * filter() so that a consumer running on the same GPU can take them without a host round trip.
+ * the device buffers only grow and are reused across frames.
+ */
+class ScanGroundFilterCuda
+{
+public:
+  ScanGroundFilterCuda();
+
+  /**
+   * @brief classify the points and gather the object points on the device
+   * @param points packed points of the input cloud on the host
+   * @return the number of object points
+   */
+  std::size_t filter(
+    const uint8_t * points, std::size_t points_num, std::size_t point_step, uint32_t x_offset,
+    uint32_t y_offset, uint32_t z_offset, const ScanGroundFilterCudaParam & param);
+
+  /** @brief object points of the last frame, packed with the point step of its input */
+  const uint8_t * objectPointsDevice() const { return object_points_d_.get(); }
+  std::size_t objectPointsNum() const { return object_points_num_; }
+  std::size_t objectPointsStep() const { return point_step_; }
+  cudaStream_t stream() const { return *stream_; }
+
+  /** @brief copy the object points of the last frame to dst, which must hold them all */
+  void copyObjectPointsToHost(uint8_t * dst) const;
+
+private:
+  void reservePoints(std::size_t points_num, std::size_t point_step);
+  void reserveRays(std::size_t radial_dividers_num);
+  void reserveTempStorage(std::size_t temp_storage_bytes);
+
+  cuda_utils::StreamUniquePtr stream_;
+
+  std::size_t points_capacity_{0};
+  std::size_t points_bytes_capacity_{0};
+  std::size_t rays_capacity_{0};
+  std::size_t temp_storage_capacity_{0};
+
+  std::size_t point_step_{0};
+  std::size_t object_points_num_{0};
+
+  cuda_utils::CudaUniquePtr<uint8_t[]> points_d_;
+  cuda_utils::CudaUniquePtr<uint8_t[]> object_points_d_;
+  cuda_utils::CudaUniquePtr<float4[]> points_xyzr_d_;
+  cuda_utils::CudaUniquePtr<uint16_t[]> grid_ids_d_;
+  cuda_utils::CudaUniquePtr<uint64_t[]> sort_keys_d_;
+  cuda_utils::CudaUniquePtr<uint64_t[]> sorted_keys_d_;
+  cuda_utils::CudaUniquePtr<uint32_t[]> sort_indices_d_;
+  cuda_utils::CudaUniquePtr<uint32_t[]> sorted_indices_d_;
+  cuda_utils::CudaUniquePtr<uint8_t[]> sorted_labels_d_;
+  // one more element than the points, so that the last output index is the object point count
+  cuda_utils::CudaUniquePtr<uint32_t[]> no_ground_flags_d_;
+  cuda_utils::CudaUniquePtr<uint32_t[]> output_indices_d_;
+  cuda_utils::CudaUniquePtr<uint32_t[]> ray_begins_d_;
+  cuda_utils::CudaUniquePtr<uint8_t[]> temp_storage_d_;
+  cuda_utils::CudaUniquePtrHost<uint32_t> object_points_num_h_;
+};
+
+}  // namespace ground_segmentation
+
+#endif  // GROUND_SEGMENTATION__SCAN_GROUND_FILTER_CUDA__SCAN_GROUND_FILTER_CUDA_HPP_
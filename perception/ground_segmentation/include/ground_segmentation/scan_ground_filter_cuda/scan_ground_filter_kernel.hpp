@@ -0,0 +1,91 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GROUND_SEGMENTATION__SCAN_GROUND_FILTER_CUDA__SCAN_GROUND_FILTER_KERNEL_HPP_
+#define GROUND_SEGMENTATION__SCAN_GROUND_FILTER_CUDA__SCAN_GROUND_FILTER_KERNEL_HPP_
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ground_segmentation
+{
+// upper bound of gnd_grid_buffer_size, the ground grids of a ray are kept in registers
+constexpr std::size_t CUDA_MAX_GND_GRID_BUFFER_SIZE = 16;
+
+// parameters of the grid scan mode, see ScanGroundFilterComponent for the meaning of each one
+struct ScanGroundFilterCudaParam
+{
+  float x_shift;
+  float low_priority_region_x;
+  float detection_range_z_max;
+  float non_ground_height_threshold;
+  float grid_size_m;
+  float grid_mode_switch_radius;
+  float grid_mode_switch_grid_id;
+  float grid_mode_switch_angle_rad;
+  float grid_size_rad;
+  float tan_grid_size_rad;
+  float virtual_lidar_z;
+  float global_slope_max_ratio;
+  float local_slope_max_ratio;
+  float radial_divider_angle_rad;
+  float split_points_distance_tolerance_square;
+  uint32_t radial_dividers_num;
+  uint16_t gnd_grid_buffer_size;
+  bool use_recheck_ground_cluster;
+  bool use_lowest_point;
+};
+
+// write x, y, z and the radius of each point, its grid id, and the key sorting the points by
+// radial division and then by radius. the points with a non-finite coordinate are keyed past the
+// last radial division.
+cudaError_t convertPointcloudGridScan_launch(
+  const uint8_t * points, std::size_t points_num, std::size_t point_step, uint32_t x_offset,
+  uint32_t y_offset, uint32_t z_offset, const ScanGroundFilterCudaParam & param,
+  float4 * points_xyzr, uint16_t * grid_ids, uint64_t * sort_keys, uint32_t * sort_indices,
+  cudaStream_t stream);
+
+// call with temp_storage == nullptr to get the required temp_storage_bytes
+cudaError_t sortPointsByRay_launch(
+  void * temp_storage, std::size_t & temp_storage_bytes, const uint64_t * sort_keys,
+  uint64_t * sorted_keys, const uint32_t * sort_indices, uint32_t * sorted_indices,
+  std::size_t points_num, int end_bit, cudaStream_t stream);
+
+// ray_begins has radial_dividers_num + 1 elements, the last one is the end of the last ray
+cudaError_t findRayBegins_launch(
+  const uint64_t * sorted_keys, std::size_t points_num, uint32_t radial_dividers_num,
+  uint32_t * ray_begins, cudaStream_t stream);
+
+// one thread scans one ray. no_ground_flags must be zero-filled in advance.
+cudaError_t classifyPointCloudGridScan_launch(
+  const float4 * points_xyzr, const uint16_t * grid_ids, const uint32_t * sorted_indices,
+  const uint32_t * ray_begins, const ScanGroundFilterCudaParam & param, uint8_t * sorted_labels,
+  uint32_t * no_ground_flags, cudaStream_t stream);
+
+// call with temp_storage == nullptr to get the required temp_storage_bytes
+cudaError_t exclusiveSum_launch(
+  void * temp_storage, std::size_t & temp_storage_bytes, const uint32_t * input, uint32_t * output,
+  std::size_t num, cudaStream_t stream);
+
+cudaError_t extractObjectPoints_launch(
+  const uint8_t * points, std::size_t points_num, std::size_t point_step,
+  const uint32_t * no_ground_flags, const uint32_t * output_indices, uint8_t * object_points,
+  cudaStream_t stream);
+
+}  // namespace ground_segmentation
+
+#endif  // GROUND_SEGMENTATION__SCAN_GROUND_FILTER_CUDA__SCAN_GROUND_FILTER_KERNEL_HPP_
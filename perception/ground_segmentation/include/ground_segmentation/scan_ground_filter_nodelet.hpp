@@ -18,6 +18,7 @@
 #include "pointcloud_preprocessor/filter.hpp"
 #include "pointcloud_preprocessor/transform_info.hpp"
 
+#include <tier4_autoware_utils/geometry/radial_bins.hpp>
 #include <vehicle_info_util/vehicle_info.hpp>
 
 #include <sensor_msgs/msg/point_cloud2.hpp>
@@ -35,11 +36,16 @@
 
 #include <tf2_ros/transform_listener.h>
 
+#if ENABLE_GPU
+#include "ground_segmentation/scan_ground_filter_cuda/scan_ground_filter_cuda.hpp"
+#endif
+
 #include <memory>
 #include <string>
 #include <vector>
 
 class ScanGroundFilterTest;
+class ScanGroundFilterBenchmark;
 
 namespace ground_segmentation
 {
@@ -69,6 +75,7 @@ private:
     size_t orig_index;  // index of this point in the source pointcloud
   };
   using PointCloudVector = std::vector<PointData>;
+  using RadialOrderedPoints = tier4_autoware_utils::RadialBins<PointData>;
 
   struct GridCenter
   {
@@ -158,13 +165,7 @@ private:
   tf2_ros::Buffer tf_buffer_{get_clock()};
   tf2_ros::TransformListener tf_listener_{tf_buffer_};
 
-  int x_offset_;
-  int y_offset_;
-  int z_offset_;
-  int intensity_offset_;
-  bool offset_initialized_;
-
-  void set_field_offsets(const PointCloud2ConstPtr & input);
+  pointcloud_preprocessor::utils::PointFieldOffsets field_offsets_;
 
   void get_point_from_global_offset(
     const PointCloud2ConstPtr & input, pcl::PointXYZ & point, size_t global_offset);
@@ -197,8 +198,15 @@ private:
   bool use_lowest_point_;  // to select lowest point for reference in recheck ground cluster,
                            // otherwise select middle point
   size_t radial_dividers_num_;
+  RadialOrderedPoints radial_ordered_points_;  // kept to reuse its buffers over the frames
+  bool use_cuda_;  // to run the grid scan mode on the GPU when built with CUDA
   VehicleInfo vehicle_info_;
 
+#if ENABLE_GPU
+  std::unique_ptr<ScanGroundFilterCuda> cuda_filter_ptr_{nullptr};
+  ScanGroundFilterCudaParam getCudaParam() const;
+#endif
+
   /*!
    * Output transformed PointCloud from in_cloud_ptr->header.frame_id to in_target_frame
    * @param[in] in_target_frame Coordinate system to perform transform
@@ -209,17 +217,15 @@ private:
    */
 
   /*!
-   * Convert sensor_msgs::msg::PointCloud2 to sorted PointCloudVector
+   * Convert sensor_msgs::msg::PointCloud2 to sorted RadialOrderedPoints
    * @param[in] in_cloud Input Point Cloud to be organized in radial segments
-   * @param[out] out_radial_ordered_points_manager Vector of Points Clouds,
-   *     each element will contain the points ordered
+   * @param[out] out_radial_ordered_points_manager Radial bins of the points,
+   *     each bin will contain the points ordered
    */
   void convertPointcloud(
-    const PointCloud2ConstPtr & in_cloud,
-    std::vector<PointCloudVector> & out_radial_ordered_points_manager);
+    const PointCloud2ConstPtr & in_cloud, RadialOrderedPoints & out_radial_ordered_points_manager);
   void convertPointcloudGridScan(
-    const PointCloud2ConstPtr & in_cloud,
-    std::vector<PointCloudVector> & out_radial_ordered_points_manager);
+    const PointCloud2ConstPtr & in_cloud, RadialOrderedPoints & out_radial_ordered_points_manager);
   /*!
    * Output ground center of front wheels as the virtual ground point
    * @param[out] point Virtual ground origin point
@@ -246,12 +252,10 @@ private:
   void checkBreakGndGrid(
     PointData & p, pcl::PointXYZ & p_orig_point, const std::vector<GridCenter> & gnd_grids_list);
   void classifyPointCloud(
-    const PointCloud2ConstPtr & in_cloud_ptr,
-    std::vector<PointCloudVector> & in_radial_ordered_clouds,
+    const PointCloud2ConstPtr & in_cloud_ptr, RadialOrderedPoints & in_radial_ordered_clouds,
     pcl::PointIndices & out_no_ground_indices);
   void classifyPointCloudGridScan(
-    const PointCloud2ConstPtr & in_cloud_ptr,
-    std::vector<PointCloudVector> & in_radial_ordered_clouds,
+    const PointCloud2ConstPtr & in_cloud_ptr, RadialOrderedPoints & in_radial_ordered_clouds,
     pcl::PointIndices & out_no_ground_indices);
   /*!
    * Re-classifies point of ground cluster based on their height
@@ -272,6 +276,16 @@ private:
   void extractObjectPoints(
     const PointCloud2ConstPtr & in_cloud_ptr, const pcl::PointIndices & in_indices,
     PointCloud2 & out_object_cloud);
+  /*!
+   * Sets everything of the output PointCloud except its data
+   * @param in_cloud_ptr Input PointCloud the object points are extracted from
+   * @param object_points_num Number of the object points
+   * @param out_object_cloud Resulting PointCloud with its data resized for the object points
+   */
+  void initializeObjectPointCloud(
+    const PointCloud2ConstPtr & in_cloud_ptr, const size_t object_points_num,
+    PointCloud2 & out_object_cloud);
+  void publishProcessingTime();
 
   /** \brief Parameter service callback result : needed to be hold */
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
@@ -290,6 +304,7 @@ public:
 
   // for test
   friend ScanGroundFilterTest;
+  friend ScanGroundFilterBenchmark;
 };
 }  // namespace ground_segmentation
 
@@ -74,12 +74,12 @@ RayGroundFilterComponent::RayGroundFilterComponent(const rclcpp::NodeOptions & o
 void RayGroundFilterComponent::ConvertXYZIToRTZColor(
   const pcl::PointCloud<PointType_>::Ptr in_cloud, PointCloudXYZRTColor & out_organized_points,
   std::vector<pcl::PointIndices> & out_radial_divided_indices,
-  std::vector<PointCloudXYZRTColor> & out_radial_ordered_clouds)
+  RadialOrderedClouds & out_radial_ordered_clouds)
 {
   out_organized_points.resize(in_cloud->points.size());
   out_radial_divided_indices.clear();
   out_radial_divided_indices.resize(radial_dividers_num_);
-  out_radial_ordered_clouds.resize(radial_dividers_num_);
+  out_radial_ordered_clouds.reset(radial_dividers_num_);
 
   for (size_t i = 0; i < in_cloud->points.size(); i++) {
     PointXYZRTColor new_point;
@@ -113,16 +113,12 @@ void RayGroundFilterComponent::ConvertXYZIToRTZColor(
     // radial divisions
     out_radial_divided_indices[radial_div].indices.push_back(i);
 
-    out_radial_ordered_clouds[radial_div].push_back(new_point);
+    out_radial_ordered_clouds.push_back(radial_div, new_point);
   }  // end for
 
   // order radial points on each division
-#pragma omp for
-  for (size_t i = 0; i < radial_dividers_num_; i++) {
-    std::sort(
-      out_radial_ordered_clouds[i].begin(), out_radial_ordered_clouds[i].end(),
-      [](const PointXYZRTColor & a, const PointXYZRTColor & b) { return a.radius < b.radius; });
-  }
+  out_radial_ordered_clouds.sort(
+    [](const PointXYZRTColor & a, const PointXYZRTColor & b) { return a.radius < b.radius; });
 }
 
 boost::optional<float> RayGroundFilterComponent::calcPointVehicleIntersection(const Point & point)
@@ -150,8 +146,8 @@ void RayGroundFilterComponent::setVehicleFootprint(
 }
 
 void RayGroundFilterComponent::ClassifyPointCloud(
-  std::vector<PointCloudXYZRTColor> & in_radial_ordered_clouds,
-  pcl::PointIndices & out_ground_indices, pcl::PointIndices & out_no_ground_indices)
+  RadialOrderedClouds & in_radial_ordered_clouds, pcl::PointIndices & out_ground_indices,
+  pcl::PointIndices & out_no_ground_indices)
 {
   out_ground_indices.indices.clear();
   out_no_ground_indices.indices.clear();
@@ -317,16 +313,15 @@ void RayGroundFilterComponent::filter(
 
   PointCloudXYZRTColor organized_points;
   std::vector<pcl::PointIndices> radial_division_indices;
-  std::vector<PointCloudXYZRTColor> radial_ordered_clouds;
 
   radial_dividers_num_ = ceil(360 / radial_divider_angle_);
 
   ConvertXYZIToRTZColor(
-    current_sensor_cloud_ptr, organized_points, radial_division_indices, radial_ordered_clouds);
+    current_sensor_cloud_ptr, organized_points, radial_division_indices, radial_ordered_clouds_);
 
   pcl::PointIndices ground_indices, no_ground_indices;
 
-  ClassifyPointCloud(radial_ordered_clouds, ground_indices, no_ground_indices);
+  ClassifyPointCloud(radial_ordered_clouds_, ground_indices, no_ground_indices);
 
   pcl::PointCloud<PointType_>::Ptr ground_cloud_ptr(new pcl::PointCloud<PointType_>);
   pcl::PointCloud<PointType_>::Ptr no_ground_cloud_ptr(new pcl::PointCloud<PointType_>);
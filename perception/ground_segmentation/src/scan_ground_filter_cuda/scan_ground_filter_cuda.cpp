@@ -0,0 +1,151 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ground_segmentation/scan_ground_filter_cuda/scan_ground_filter_cuda.hpp"
+
+#include <cuda_utils/cuda_check_error.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace ground_segmentation
+{
+ScanGroundFilterCuda::ScanGroundFilterCuda()
+: stream_(cuda_utils::makeCudaStream(cudaStreamNonBlocking)),
+  object_points_num_h_(cuda_utils::make_unique_host<uint32_t>())
+{
+  if (!stream_) {
+    throw std::runtime_error("failed to create a CUDA stream for the scan ground filter");
+  }
+}
+
+void ScanGroundFilterCuda::reservePoints(const std::size_t points_num, const std::size_t point_step)
+{
+  const std::size_t points_bytes = points_num * point_step;
+  if (points_bytes > points_bytes_capacity_) {
+    points_d_ = cuda_utils::make_unique<uint8_t[]>(points_bytes);
+    object_points_d_ = cuda_utils::make_unique<uint8_t[]>(points_bytes);
+    points_bytes_capacity_ = points_bytes;
+  }
+  if (points_num + 1 > points_capacity_) {
+    const std::size_t capacity = points_num + 1;
+    points_xyzr_d_ = cuda_utils::make_unique<float4[]>(capacity);
+    grid_ids_d_ = cuda_utils::make_unique<uint16_t[]>(capacity);
+    sort_keys_d_ = cuda_utils::make_unique<uint64_t[]>(capacity);
+    sorted_keys_d_ = cuda_utils::make_unique<uint64_t[]>(capacity);
+    sort_indices_d_ = cuda_utils::make_unique<uint32_t[]>(capacity);
+    sorted_indices_d_ = cuda_utils::make_unique<uint32_t[]>(capacity);
+    sorted_labels_d_ = cuda_utils::make_unique<uint8_t[]>(capacity);
+    no_ground_flags_d_ = cuda_utils::make_unique<uint32_t[]>(capacity);
+    output_indices_d_ = cuda_utils::make_unique<uint32_t[]>(capacity);
+    points_capacity_ = capacity;
+  }
+}
+
+void ScanGroundFilterCuda::reserveRays(const std::size_t radial_dividers_num)
+{
+  if (radial_dividers_num + 1 > rays_capacity_) {
+    ray_begins_d_ = cuda_utils::make_unique<uint32_t[]>(radial_dividers_num + 1);
+    rays_capacity_ = radial_dividers_num + 1;
+  }
+}
+
+void ScanGroundFilterCuda::reserveTempStorage(const std::size_t temp_storage_bytes)
+{
+  if (temp_storage_bytes > temp_storage_capacity_) {
+    temp_storage_d_ = cuda_utils::make_unique<uint8_t[]>(temp_storage_bytes);
+    temp_storage_capacity_ = temp_storage_bytes;
+  }
+}
+
+std::size_t ScanGroundFilterCuda::filter(
+  const uint8_t * points, const std::size_t points_num, const std::size_t point_step,
+  const uint32_t x_offset, const uint32_t y_offset, const uint32_t z_offset,
+  const ScanGroundFilterCudaParam & param)
+{
+  if (param.gnd_grid_buffer_size > CUDA_MAX_GND_GRID_BUFFER_SIZE) {
+    throw std::invalid_argument("gnd_grid_buffer_size exceeds CUDA_MAX_GND_GRID_BUFFER_SIZE");
+  }
+  point_step_ = point_step;
+  object_points_num_ = 0;
+  if (points_num == 0) {
+    return 0;
+  }
+
+  reservePoints(points_num, point_step);
+  reserveRays(param.radial_dividers_num);
+  cudaStream_t stream = *stream_;
+
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    points_d_.get(), points, points_num * point_step, cudaMemcpyHostToDevice, stream));
+  CHECK_CUDA_ERROR(
+    cudaMemsetAsync(no_ground_flags_d_.get(), 0, (points_num + 1) * sizeof(uint32_t), stream));
+
+  CHECK_CUDA_ERROR(convertPointcloudGridScan_launch(
+    points_d_.get(), points_num, point_step, x_offset, y_offset, z_offset, param,
+    points_xyzr_d_.get(), grid_ids_d_.get(), sort_keys_d_.get(), sort_indices_d_.get(), stream));
+
+  // the keys hold the radius in the lower 32 bits and the radial division above them
+  int end_bit = 32;
+  for (uint32_t radial_div = param.radial_dividers_num; radial_div > 0; radial_div >>= 1) {
+    ++end_bit;
+  }
+  std::size_t sort_temp_storage_bytes = 0;
+  std::size_t scan_temp_storage_bytes = 0;
+  CHECK_CUDA_ERROR(sortPointsByRay_launch(
+    nullptr, sort_temp_storage_bytes, sort_keys_d_.get(), sorted_keys_d_.get(),
+    sort_indices_d_.get(), sorted_indices_d_.get(), points_num, end_bit, stream));
+  CHECK_CUDA_ERROR(exclusiveSum_launch(
+    nullptr, scan_temp_storage_bytes, no_ground_flags_d_.get(), output_indices_d_.get(),
+    points_num + 1, stream));
+  reserveTempStorage(std::max(sort_temp_storage_bytes, scan_temp_storage_bytes));
+
+  CHECK_CUDA_ERROR(sortPointsByRay_launch(
+    temp_storage_d_.get(), sort_temp_storage_bytes, sort_keys_d_.get(), sorted_keys_d_.get(),
+    sort_indices_d_.get(), sorted_indices_d_.get(), points_num, end_bit, stream));
+  CHECK_CUDA_ERROR(findRayBegins_launch(
+    sorted_keys_d_.get(), points_num, param.radial_dividers_num, ray_begins_d_.get(), stream));
+
+  CHECK_CUDA_ERROR(classifyPointCloudGridScan_launch(
+    points_xyzr_d_.get(), grid_ids_d_.get(), sorted_indices_d_.get(), ray_begins_d_.get(), param,
+    sorted_labels_d_.get(), no_ground_flags_d_.get(), stream));
+
+  CHECK_CUDA_ERROR(exclusiveSum_launch(
+    temp_storage_d_.get(), scan_temp_storage_bytes, no_ground_flags_d_.get(),
+    output_indices_d_.get(), points_num + 1, stream));
+  CHECK_CUDA_ERROR(extractObjectPoints_launch(
+    points_d_.get(), points_num, point_step, no_ground_flags_d_.get(), output_indices_d_.get(),
+    object_points_d_.get(), stream));
+
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    object_points_num_h_.get(), output_indices_d_.get() + points_num, sizeof(uint32_t),
+    cudaMemcpyDeviceToHost, stream));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+  object_points_num_ = *object_points_num_h_;
+  return object_points_num_;
+}
+
+void ScanGroundFilterCuda::copyObjectPointsToHost(uint8_t * dst) const
+{
+  if (object_points_num_ == 0) {
+    return;
+  }
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    dst, object_points_d_.get(), object_points_num_ * point_step_, cudaMemcpyDeviceToHost,
+    *stream_));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(*stream_));
+}
+
+}  // namespace ground_segmentation
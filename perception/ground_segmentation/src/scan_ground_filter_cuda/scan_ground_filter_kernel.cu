@@ -0,0 +1,533 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ground_segmentation/scan_ground_filter_cuda/scan_ground_filter_kernel.hpp"
+
+#include <cub/cub.cuh>
+
+namespace
+{
+const std::size_t THREADS_PER_BLOCK = 256;
+const std::size_t RAYS_PER_BLOCK = 64;
+// ring buffer of the ground grids of a ray, a power of two larger than the max buffer size
+const int GND_GRID_RING_SIZE = 32;
+const uint16_t GND_GRID_CONTINUAL_THRESH = 3;
+const float TAN_5_DEG = 0.08748866352f;
+const float TWO_PI = 6.28318530718f;
+}  // namespace
+
+namespace ground_segmentation
+{
+static_assert(GND_GRID_RING_SIZE > CUDA_MAX_GND_GRID_BUFFER_SIZE + 1, "ring is too small");
+
+// same values as ScanGroundFilterComponent::PointLabel
+enum PointLabel : uint8_t { INIT = 0, GROUND = 1, NON_GROUND = 2, OUT_OF_RANGE = 6 };
+
+struct GridCenter
+{
+  float radius;
+  float avg_height;
+  float max_height;
+  uint16_t grid_id;
+};
+
+struct GndGrids
+{
+  GridCenter grids[GND_GRID_RING_SIZE];
+  int size;
+
+  __device__ void initialize()
+  {
+    for (int i = 0; i < GND_GRID_RING_SIZE; ++i) {
+      grids[i] = GridCenter{0.0f, 0.0f, 0.0f, 0};
+    }
+    size = 0;
+  }
+
+  __device__ void push(const GridCenter & grid)
+  {
+    grids[size & (GND_GRID_RING_SIZE - 1)] = grid;
+    ++size;
+  }
+
+  // k-th grid from the latest one, e.g. back(0) is gnd_grids.back() of the CPU implementation
+  __device__ const GridCenter & back(const int k) const
+  {
+    return grids[(size - 1 - k) & (GND_GRID_RING_SIZE - 1)];
+  }
+};
+
+struct PointsCentroid
+{
+  float radius_sum;
+  float height_sum;
+  float radius_avg;
+  float height_avg;
+  float height_max;
+  float height_min;
+  uint32_t point_num;
+  uint32_t begin;  // sorted index of the first point to recheck
+
+  __device__ void initialize(const uint32_t sorted_index)
+  {
+    radius_sum = 0.0f;
+    height_sum = 0.0f;
+    radius_avg = 0.0f;
+    height_avg = 0.0f;
+    height_max = 0.0f;
+    height_min = 10.0f;
+    point_num = 0;
+    begin = sorted_index;
+  }
+
+  __device__ void addPoint(const float radius, const float height)
+  {
+    radius_sum += radius;
+    height_sum += height;
+    ++point_num;
+    radius_avg = radius_sum / point_num;
+    height_avg = height_sum / point_num;
+    height_max = height_max < height ? height : height_max;
+    height_min = height_min > height ? height : height_min;
+  }
+};
+
+__device__ inline float normalizeRadianPositive(const float rad)
+{
+  return rad < 0.0f ? rad + TWO_PI : rad;
+}
+
+__device__ inline float loadFloat(const uint8_t * src)
+{
+  float value;
+  memcpy(&value, src, sizeof(float));
+  return value;
+}
+
+__global__ void convertPointcloudGridScan_kernel(
+  const uint8_t * points, const std::size_t points_num, const std::size_t point_step,
+  const uint32_t x_offset, const uint32_t y_offset, const uint32_t z_offset,
+  const ScanGroundFilterCudaParam param, float4 * points_xyzr, uint16_t * grid_ids,
+  uint64_t * sort_keys, uint32_t * sort_indices)
+{
+  const std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= points_num) {
+    return;
+  }
+
+  const uint8_t * point = points + point_idx * point_step;
+  const float x = loadFloat(point + x_offset);
+  const float y = loadFloat(point + y_offset);
+  const float z = loadFloat(point + z_offset);
+
+  const float inv_radial_divider_angle_rad = 1.0f / param.radial_divider_angle_rad;
+  const float inv_grid_size_rad = 1.0f / param.grid_size_rad;
+  const float inv_grid_size_m = 1.0f / param.grid_size_m;
+  const float grid_id_offset =
+    param.grid_mode_switch_grid_id - param.grid_mode_switch_angle_rad * inv_grid_size_rad;
+
+  const float shifted_x = x - param.x_shift;  // base on front wheel center
+  const float radius = hypotf(shifted_x, y);
+  const float theta = normalizeRadianPositive(atan2f(shifted_x, y));
+
+  uint32_t radial_div = param.radial_dividers_num;
+  uint16_t grid_id = 0;
+  if (isfinite(x) && isfinite(y) && isfinite(z)) {
+    radial_div = min(
+      static_cast<uint32_t>(floorf(theta * inv_radial_divider_angle_rad)),
+      param.radial_dividers_num - 1);
+    if (radius <= param.grid_mode_switch_radius) {
+      grid_id = static_cast<uint16_t>(radius * inv_grid_size_m);
+    } else {
+      const float gamma = normalizeRadianPositive(atan2f(radius, param.virtual_lidar_z));
+      grid_id = static_cast<uint16_t>(grid_id_offset + gamma * inv_grid_size_rad);
+    }
+  }
+
+  points_xyzr[point_idx] = make_float4(x, y, z, radius);
+  grid_ids[point_idx] = grid_id;
+  // the radius is not negative, so that its bits are ordered as the float values
+  sort_keys[point_idx] =
+    (static_cast<uint64_t>(radial_div) << 32) | static_cast<uint64_t>(__float_as_uint(radius));
+  sort_indices[point_idx] = point_idx;
+}
+
+__global__ void findRayBegins_kernel(
+  const uint64_t * sorted_keys, const std::size_t points_num, const uint32_t radial_dividers_num,
+  uint32_t * ray_begins)
+{
+  const uint32_t ray = blockIdx.x * blockDim.x + threadIdx.x;
+  if (ray > radial_dividers_num) {
+    return;
+  }
+
+  // lower bound of the first key of the ray
+  const uint64_t ray_key = static_cast<uint64_t>(ray) << 32;
+  std::size_t first = 0;
+  std::size_t count = points_num;
+  while (count > 0) {
+    const std::size_t step = count / 2;
+    if (sorted_keys[first + step] < ray_key) {
+      first += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  ray_begins[ray] = first;
+}
+
+__device__ inline float calcGridSize(
+  const ScanGroundFilterCudaParam & param, const float radius, const uint16_t grid_id)
+{
+  float grid_size = param.grid_size_m;
+  const uint16_t back_steps_num = 1;
+
+  if (
+    radius > param.grid_mode_switch_radius &&
+    grid_id > param.grid_mode_switch_grid_id + back_steps_num) {
+    grid_size = radius - (radius - param.tan_grid_size_rad * param.virtual_lidar_z) /
+                           (1 + radius * param.tan_grid_size_rad / param.virtual_lidar_z);
+  }
+  return grid_size;
+}
+
+__device__ void initializeFirstGndGrids(
+  const ScanGroundFilterCudaParam & param, const float h, const float r, const uint16_t id,
+  GndGrids & gnd_grids)
+{
+  const int buffer_size = param.gnd_grid_buffer_size;
+  for (int ind_grid = id - 1 - buffer_size; ind_grid < id - 1; ++ind_grid) {
+    const float ind_grid_ratio = static_cast<float>(ind_grid - id + 1 + buffer_size);
+    const float ind_gnd_z = ind_grid_ratio * (h / static_cast<float>(buffer_size));
+    const float ind_gnd_radius = ind_grid_ratio * (r / static_cast<float>(buffer_size));
+    gnd_grids.push(
+      GridCenter{ind_gnd_radius, ind_gnd_z, ind_gnd_z, static_cast<uint16_t>(ind_grid)});
+  }
+}
+
+__device__ uint8_t checkContinuousGndGrid(
+  const ScanGroundFilterCudaParam & param, const float radius, const float z,
+  const GndGrids & gnd_grids)
+{
+  float gnd_buff_z_mean = 0.0f;
+  float gnd_buff_radius = 0.0f;
+  for (int k = param.gnd_grid_buffer_size; k > 0; --k) {
+    gnd_buff_radius += gnd_grids.back(k).radius;
+    gnd_buff_z_mean += gnd_grids.back(k).avg_height;
+  }
+  gnd_buff_radius /= static_cast<float>(param.gnd_grid_buffer_size - 1);
+  gnd_buff_z_mean /= static_cast<float>(param.gnd_grid_buffer_size - 1);
+
+  const GridCenter & last_gnd_grid = gnd_grids.back(0);
+  float curr_gnd_slope_ratio =
+    (last_gnd_grid.avg_height - gnd_buff_z_mean) / (last_gnd_grid.radius - gnd_buff_radius);
+  curr_gnd_slope_ratio = fminf(
+    fmaxf(curr_gnd_slope_ratio, -param.global_slope_max_ratio), param.global_slope_max_ratio);
+
+  const float next_gnd_z = curr_gnd_slope_ratio * (radius - gnd_buff_radius) + gnd_buff_z_mean;
+  const float gnd_z_local_thresh = TAN_5_DEG * (radius - last_gnd_grid.radius);
+
+  const GridCenter & prev_gnd_grid = gnd_grids.back(1);
+  const float local_slope_ratio = (z - prev_gnd_grid.avg_height) / (radius - prev_gnd_grid.radius);
+  if (
+    fabsf(z - next_gnd_z) <= param.non_ground_height_threshold + gnd_z_local_thresh ||
+    fabsf(local_slope_ratio) <= param.local_slope_max_ratio) {
+    return GROUND;
+  } else if (z - next_gnd_z > param.non_ground_height_threshold + gnd_z_local_thresh) {
+    return NON_GROUND;
+  }
+  return INIT;
+}
+
+__device__ uint8_t checkDiscontinuousGndGrid(
+  const ScanGroundFilterCudaParam & param, const float radius, const float z,
+  const GndGrids & gnd_grids)
+{
+  const GridCenter & last_gnd_grid = gnd_grids.back(0);
+  const float tmp_delta_max_z = z - last_gnd_grid.max_height;
+  const float tmp_delta_avg_z = z - last_gnd_grid.avg_height;
+  const float local_slope_ratio = tmp_delta_avg_z / (radius - last_gnd_grid.radius);
+
+  if (
+    fabsf(local_slope_ratio) < param.local_slope_max_ratio ||
+    fabsf(tmp_delta_avg_z) < param.non_ground_height_threshold ||
+    fabsf(tmp_delta_max_z) < param.non_ground_height_threshold) {
+    return GROUND;
+  } else if (local_slope_ratio > param.global_slope_max_ratio) {
+    return NON_GROUND;
+  }
+  return INIT;
+}
+
+__device__ uint8_t checkBreakGndGrid(
+  const ScanGroundFilterCudaParam & param, const float radius, const float z,
+  const GndGrids & gnd_grids)
+{
+  const GridCenter & last_gnd_grid = gnd_grids.back(0);
+  const float local_slope_ratio =
+    (z - last_gnd_grid.avg_height) / (radius - last_gnd_grid.radius);
+  if (fabsf(local_slope_ratio) < param.global_slope_max_ratio) {
+    return GROUND;
+  } else if (local_slope_ratio > param.global_slope_max_ratio) {
+    return NON_GROUND;
+  }
+  return INIT;
+}
+
+__device__ void recheckGroundCluster(
+  const ScanGroundFilterCudaParam & param, const PointsCentroid & gnd_cluster,
+  const uint32_t cluster_end, const float4 * points_xyzr, const uint32_t * sorted_indices,
+  const uint8_t * sorted_labels, uint32_t * no_ground_flags)
+{
+  // the points of the cluster are the ground points scanned since its initialization
+  const float reference_height =
+    param.use_lowest_point ? gnd_cluster.height_min : gnd_cluster.height_avg;
+  for (uint32_t k = gnd_cluster.begin; k < cluster_end; ++k) {
+    if (sorted_labels[k] != GROUND) {
+      continue;
+    }
+    const uint32_t point_idx = sorted_indices[k];
+    if (points_xyzr[point_idx].z >= reference_height + param.non_ground_height_threshold) {
+      no_ground_flags[point_idx] = 1;
+    }
+  }
+}
+
+__global__ void classifyPointCloudGridScan_kernel(
+  const float4 * points_xyzr, const uint16_t * grid_ids, const uint32_t * sorted_indices,
+  const uint32_t * ray_begins, const ScanGroundFilterCudaParam param, uint8_t * sorted_labels,
+  uint32_t * no_ground_flags)
+{
+  const uint32_t ray = blockIdx.x * blockDim.x + threadIdx.x;
+  if (ray >= param.radial_dividers_num) {
+    return;
+  }
+  const uint32_t ray_begin = ray_begins[ray];
+  const uint32_t ray_end = ray_begins[ray + 1];
+  if (ray_begin == ray_end) {
+    return;
+  }
+
+  PointsCentroid ground_cluster;
+  ground_cluster.initialize(ray_begin);
+  GndGrids gnd_grids;
+  gnd_grids.initialize();
+
+  bool initialized_first_gnd_grid = false;
+  bool prev_list_init = false;
+  float4 p = make_float4(0.0f, 0.0f, 0.0f, 0.0f);
+  uint16_t p_grid_id = grid_ids[sorted_indices[ray_begin]];
+  uint8_t p_state = INIT;
+  for (uint32_t k = ray_begin; k < ray_end; ++k) {
+    const float4 prev_p = p;  // for checking the distance to prev point
+    const uint16_t prev_grid_id = p_grid_id;
+    const uint8_t prev_state = p_state;
+    const uint32_t point_idx = sorted_indices[k];
+    p = points_xyzr[point_idx];
+    p_grid_id = grid_ids[point_idx];
+    p_state = INIT;
+    const float radius = p.w;
+    bool is_no_ground = false;
+
+    // break leaves the classification of the point, as continue does in the CPU implementation
+    do {
+      const float global_slope_ratio_p = p.z / radius;
+      float non_ground_height_threshold_local = param.non_ground_height_threshold;
+      if (p.x < param.low_priority_region_x) {
+        non_ground_height_threshold_local =
+          param.non_ground_height_threshold * fabsf(p.x / param.low_priority_region_x);
+      }
+      // classify first grid's point cloud
+      if (
+        !initialized_first_gnd_grid && global_slope_ratio_p >= param.global_slope_max_ratio &&
+        p.z > non_ground_height_threshold_local) {
+        p_state = NON_GROUND;
+        is_no_ground = true;
+        break;
+      }
+      if (
+        !initialized_first_gnd_grid && fabsf(global_slope_ratio_p) < param.global_slope_max_ratio &&
+        fabsf(p.z) < non_ground_height_threshold_local) {
+        p_state = GROUND;
+        initialized_first_gnd_grid = p_grid_id != prev_grid_id;
+        break;
+      }
+      if (!initialized_first_gnd_grid) {
+        break;
+      }
+
+      // initialize lists of previous gnd grids
+      if (!prev_list_init) {
+        initializeFirstGndGrids(
+          param, ground_cluster.height_avg, ground_cluster.radius_avg, p_grid_id, gnd_grids);
+        prev_list_init = true;
+      }
+
+      // move to new grid
+      if (p_grid_id > prev_grid_id && ground_cluster.radius_avg > 0.0f) {
+        if (param.use_recheck_ground_cluster) {
+          recheckGroundCluster(
+            param, ground_cluster, k, points_xyzr, sorted_indices, sorted_labels, no_ground_flags);
+        }
+        gnd_grids.push(GridCenter{
+          ground_cluster.radius_avg, ground_cluster.height_avg, ground_cluster.height_max,
+          prev_grid_id});
+        ground_cluster.initialize(k);
+      }
+
+      // classify
+      if (p.z - gnd_grids.back(0).avg_height > param.detection_range_z_max) {
+        p_state = OUT_OF_RANGE;
+        break;
+      }
+      const float points_xy_distance_square =
+        (p.x - prev_p.x) * (p.x - prev_p.x) + (p.y - prev_p.y) * (p.y - prev_p.y);
+      if (
+        prev_state == NON_GROUND &&
+        points_xy_distance_square < param.split_points_distance_tolerance_square &&
+        p.z > prev_p.z) {
+        p_state = NON_GROUND;
+        is_no_ground = true;
+        break;
+      }
+      if (global_slope_ratio_p > param.global_slope_max_ratio) {
+        is_no_ground = true;
+        break;
+      }
+      // gnd grid is continuous, the last gnd grid is close
+      const uint16_t next_gnd_grid_id_thresh =
+        gnd_grids.back(param.gnd_grid_buffer_size - 1).grid_id + param.gnd_grid_buffer_size +
+        GND_GRID_CONTINUAL_THRESH;
+      const float curr_grid_size = calcGridSize(param, radius, p_grid_id);
+      const bool is_last_gnd_grid_close =
+        radius - gnd_grids.back(0).radius < GND_GRID_CONTINUAL_THRESH * curr_grid_size;
+      if (p_grid_id < next_gnd_grid_id_thresh && is_last_gnd_grid_close) {
+        p_state = checkContinuousGndGrid(param, radius, p.z, gnd_grids);
+      } else if (is_last_gnd_grid_close) {
+        p_state = checkDiscontinuousGndGrid(param, radius, p.z, gnd_grids);
+      } else {
+        p_state = checkBreakGndGrid(param, radius, p.z, gnd_grids);
+      }
+      is_no_ground = p_state == NON_GROUND;
+    } while (false);
+
+    if (p_state == GROUND) {
+      ground_cluster.addPoint(radius, p.z);
+    }
+    if (is_no_ground) {
+      no_ground_flags[point_idx] = 1;
+    }
+    sorted_labels[k] = p_state;
+  }
+}
+
+__global__ void extractObjectPoints_kernel(
+  const uint8_t * points, const std::size_t points_num, const std::size_t point_step,
+  const uint32_t * no_ground_flags, const uint32_t * output_indices, uint8_t * object_points)
+{
+  const std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= points_num || !no_ground_flags[point_idx]) {
+    return;
+  }
+
+  const uint8_t * src = points + point_idx * point_step;
+  uint8_t * dst = object_points + static_cast<std::size_t>(output_indices[point_idx]) * point_step;
+  if (point_step % sizeof(uint32_t) == 0) {
+    const uint32_t * src_words = reinterpret_cast<const uint32_t *>(src);
+    uint32_t * dst_words = reinterpret_cast<uint32_t *>(dst);
+    for (std::size_t i = 0; i < point_step / sizeof(uint32_t); ++i) {
+      dst_words[i] = src_words[i];
+    }
+  } else {
+    for (std::size_t i = 0; i < point_step; ++i) {
+      dst[i] = src[i];
+    }
+  }
+}
+
+cudaError_t convertPointcloudGridScan_launch(
+  const uint8_t * points, std::size_t points_num, std::size_t point_step, uint32_t x_offset,
+  uint32_t y_offset, uint32_t z_offset, const ScanGroundFilterCudaParam & param,
+  float4 * points_xyzr, uint16_t * grid_ids, uint64_t * sort_keys, uint32_t * sort_indices,
+  cudaStream_t stream)
+{
+  if (points_num == 0) {
+    return cudaSuccess;
+  }
+  const dim3 blocks((points_num + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK);
+  const dim3 threads(THREADS_PER_BLOCK);
+  convertPointcloudGridScan_kernel<<<blocks, threads, 0, stream>>>(
+    points, points_num, point_step, x_offset, y_offset, z_offset, param, points_xyzr, grid_ids,
+    sort_keys, sort_indices);
+  return cudaGetLastError();
+}
+
+cudaError_t sortPointsByRay_launch(
+  void * temp_storage, std::size_t & temp_storage_bytes, const uint64_t * sort_keys,
+  uint64_t * sorted_keys, const uint32_t * sort_indices, uint32_t * sorted_indices,
+  std::size_t points_num, int end_bit, cudaStream_t stream)
+{
+  return cub::DeviceRadixSort::SortPairs(
+    temp_storage, temp_storage_bytes, sort_keys, sorted_keys, sort_indices, sorted_indices,
+    static_cast<int>(points_num), 0, end_bit, stream);
+}
+
+cudaError_t findRayBegins_launch(
+  const uint64_t * sorted_keys, std::size_t points_num, uint32_t radial_dividers_num,
+  uint32_t * ray_begins, cudaStream_t stream)
+{
+  const dim3 blocks((radial_dividers_num + 1 + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK);
+  const dim3 threads(THREADS_PER_BLOCK);
+  findRayBegins_kernel<<<blocks, threads, 0, stream>>>(
+    sorted_keys, points_num, radial_dividers_num, ray_begins);
+  return cudaGetLastError();
+}
+
+cudaError_t classifyPointCloudGridScan_launch(
+  const float4 * points_xyzr, const uint16_t * grid_ids, const uint32_t * sorted_indices,
+  const uint32_t * ray_begins, const ScanGroundFilterCudaParam & param, uint8_t * sorted_labels,
+  uint32_t * no_ground_flags, cudaStream_t stream)
+{
+  const dim3 blocks((param.radial_dividers_num + RAYS_PER_BLOCK - 1) / RAYS_PER_BLOCK);
+  const dim3 threads(RAYS_PER_BLOCK);
+  classifyPointCloudGridScan_kernel<<<blocks, threads, 0, stream>>>(
+    points_xyzr, grid_ids, sorted_indices, ray_begins, param, sorted_labels, no_ground_flags);
+  return cudaGetLastError();
+}
+
+cudaError_t exclusiveSum_launch(
+  void * temp_storage, std::size_t & temp_storage_bytes, const uint32_t * input, uint32_t * output,
+  std::size_t num, cudaStream_t stream)
+{
+  return cub::DeviceScan::ExclusiveSum(
+    temp_storage, temp_storage_bytes, input, output, static_cast<int>(num), stream);
+}
+
+cudaError_t extractObjectPoints_launch(
+  const uint8_t * points, std::size_t points_num, std::size_t point_step,
+  const uint32_t * no_ground_flags, const uint32_t * output_indices, uint8_t * object_points,
+  cudaStream_t stream)
+{
+  if (points_num == 0) {
+    return cudaSuccess;
+  }
+  const dim3 blocks((points_num + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK);
+  const dim3 threads(THREADS_PER_BLOCK);
+  extractObjectPoints_kernel<<<blocks, threads, 0, stream>>>(
+    points, points_num, point_step, no_ground_flags, output_indices, object_points);
+  return cudaGetLastError();
+}
+
+}  // namespace ground_segmentation
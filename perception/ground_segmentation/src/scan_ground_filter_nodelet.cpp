@@ -19,6 +19,7 @@
 #include <tier4_autoware_utils/math/unit_conversion.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
 
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
@@ -59,6 +60,7 @@ ScanGroundFilterComponent::ScanGroundFilterComponent(const rclcpp::NodeOptions &
     use_recheck_ground_cluster_ = declare_parameter<bool>("use_recheck_ground_cluster");
     use_lowest_point_ = declare_parameter<bool>("use_lowest_point");
     radial_dividers_num_ = std::ceil(2.0 * M_PI / radial_divider_angle_rad_);
+    use_cuda_ = declare_parameter<bool>("use_cuda", false);
     vehicle_info_ = VehicleInfoUtil(*this).getVehicleInfo();
 
     grid_mode_switch_grid_id_ =
@@ -70,7 +72,22 @@ ScanGroundFilterComponent::ScanGroundFilterComponent(const rclcpp::NodeOptions &
       normalizeRadian(std::atan2(grid_mode_switch_radius_ + grid_size_m_, virtual_lidar_z_)) -
       normalizeRadian(std::atan2(grid_mode_switch_radius_, virtual_lidar_z_));
     tan_grid_size_rad_ = std::tan(grid_size_rad_);
-    offset_initialized_ = false;
+  }
+
+  if (use_cuda_) {
+#if ENABLE_GPU
+    if (!elevation_grid_mode_) {
+      RCLCPP_WARN(get_logger(), "use_cuda is supported only in elevation_grid_mode, run on CPU.");
+    } else if (gnd_grid_buffer_size_ > CUDA_MAX_GND_GRID_BUFFER_SIZE) {
+      RCLCPP_WARN(
+        get_logger(), "use_cuda supports gnd_grid_buffer_size up to %zu, run on CPU.",
+        CUDA_MAX_GND_GRID_BUFFER_SIZE);
+    } else {
+      cuda_filter_ptr_ = std::make_unique<ScanGroundFilterCuda>();
+    }
+#else
+    RCLCPP_WARN(get_logger(), "use_cuda is set but built without CUDA, run on CPU.");
+#endif
   }
 
   using std::placeholders::_1;
@@ -88,32 +105,18 @@ ScanGroundFilterComponent::ScanGroundFilterComponent(const rclcpp::NodeOptions &
   }
 }
 
-inline void ScanGroundFilterComponent::set_field_offsets(const PointCloud2ConstPtr & input)
-{
-  x_offset_ = input->fields[pcl::getFieldIndex(*input, "x")].offset;
-  y_offset_ = input->fields[pcl::getFieldIndex(*input, "y")].offset;
-  z_offset_ = input->fields[pcl::getFieldIndex(*input, "z")].offset;
-  int intensity_index = pcl::getFieldIndex(*input, "intensity");
-  if (intensity_index != -1) {
-    intensity_offset_ = input->fields[intensity_index].offset;
-  } else {
-    intensity_offset_ = z_offset_ + sizeof(float);
-  }
-  offset_initialized_ = true;
-}
-
 inline void ScanGroundFilterComponent::get_point_from_global_offset(
   const PointCloud2ConstPtr & input, pcl::PointXYZ & point, size_t global_offset)
 {
-  point.x = *reinterpret_cast<const float *>(&input->data[global_offset + x_offset_]);
-  point.y = *reinterpret_cast<const float *>(&input->data[global_offset + y_offset_]);
-  point.z = *reinterpret_cast<const float *>(&input->data[global_offset + z_offset_]);
+  std::memcpy(&point.x, &input->data[global_offset + field_offsets_.x], sizeof(float));
+  std::memcpy(&point.y, &input->data[global_offset + field_offsets_.y], sizeof(float));
+  std::memcpy(&point.z, &input->data[global_offset + field_offsets_.z], sizeof(float));
 }
 
 void ScanGroundFilterComponent::convertPointcloudGridScan(
-  const PointCloud2ConstPtr & in_cloud, std::vector<PointCloudVector> & out_radial_ordered_points)
+  const PointCloud2ConstPtr & in_cloud, RadialOrderedPoints & out_radial_ordered_points)
 {
-  out_radial_ordered_points.resize(radial_dividers_num_);
+  out_radial_ordered_points.reset(radial_dividers_num_);
   PointData current_point;
 
   const auto inv_radial_divider_angle_rad = 1.0f / radial_divider_angle_rad_;
@@ -152,22 +155,19 @@ void ScanGroundFilterComponent::convertPointcloudGridScan(
     current_point.orig_index = point_index;
 
     // radial divisions
-    out_radial_ordered_points[radial_div].emplace_back(current_point);
+    out_radial_ordered_points.push_back(radial_div, current_point);
     ++point_index;
   }
 
   // sort by distance
-  for (size_t i = 0; i < radial_dividers_num_; ++i) {
-    std::sort(
-      out_radial_ordered_points[i].begin(), out_radial_ordered_points[i].end(),
-      [](const PointData & a, const PointData & b) { return a.radius < b.radius; });
-  }
+  out_radial_ordered_points.sort(
+    [](const PointData & a, const PointData & b) { return a.radius < b.radius; });
 }
 
 void ScanGroundFilterComponent::convertPointcloud(
-  const PointCloud2ConstPtr & in_cloud, std::vector<PointCloudVector> & out_radial_ordered_points)
+  const PointCloud2ConstPtr & in_cloud, RadialOrderedPoints & out_radial_ordered_points)
 {
-  out_radial_ordered_points.resize(radial_dividers_num_);
+  out_radial_ordered_points.reset(radial_dividers_num_);
   PointData current_point;
 
   const auto inv_radial_divider_angle_rad = 1.0f / radial_divider_angle_rad_;
@@ -191,15 +191,12 @@ void ScanGroundFilterComponent::convertPointcloud(
     current_point.orig_index = point_index;
 
     // radial divisions
-    out_radial_ordered_points[radial_div].emplace_back(current_point);
+    out_radial_ordered_points.push_back(radial_div, current_point);
     ++point_index;
   }
   // sort by distance
-  for (size_t i = 0; i < radial_dividers_num_; ++i) {
-    std::sort(
-      out_radial_ordered_points[i].begin(), out_radial_ordered_points[i].end(),
-      [](const PointData & a, const PointData & b) { return a.radius < b.radius; });
-  }
+  out_radial_ordered_points.sort(
+    [](const PointData & a, const PointData & b) { return a.radius < b.radius; });
 }
 
 void ScanGroundFilterComponent::calcVirtualGroundOrigin(pcl::PointXYZ & point)
@@ -332,7 +329,7 @@ void ScanGroundFilterComponent::recheckGroundCluster(
 }
 
 void ScanGroundFilterComponent::classifyPointCloudGridScan(
-  const PointCloud2ConstPtr & in_cloud, std::vector<PointCloudVector> & in_radial_ordered_clouds,
+  const PointCloud2ConstPtr & in_cloud, RadialOrderedPoints & in_radial_ordered_clouds,
   pcl::PointIndices & out_no_ground_indices)
 {
   out_no_ground_indices.indices.clear();
@@ -452,7 +449,7 @@ void ScanGroundFilterComponent::classifyPointCloudGridScan(
 }
 
 void ScanGroundFilterComponent::classifyPointCloud(
-  const PointCloud2ConstPtr & in_cloud, std::vector<PointCloudVector> & in_radial_ordered_clouds,
+  const PointCloud2ConstPtr & in_cloud, RadialOrderedPoints & in_radial_ordered_clouds,
   pcl::PointIndices & out_no_ground_indices)
 {
   out_no_ground_indices.indices.clear();
@@ -577,6 +574,60 @@ void ScanGroundFilterComponent::extractObjectPoints(
   }
 }
 
+void ScanGroundFilterComponent::initializeObjectPointCloud(
+  const PointCloud2ConstPtr & in_cloud_ptr, const size_t object_points_num,
+  PointCloud2 & out_object_cloud)
+{
+  out_object_cloud.row_step = object_points_num * in_cloud_ptr->point_step;
+  out_object_cloud.data.resize(out_object_cloud.row_step);
+  out_object_cloud.width = object_points_num;
+  out_object_cloud.fields = in_cloud_ptr->fields;
+  out_object_cloud.is_dense = true;
+  out_object_cloud.height = in_cloud_ptr->height;
+  out_object_cloud.is_bigendian = in_cloud_ptr->is_bigendian;
+  out_object_cloud.point_step = in_cloud_ptr->point_step;
+  out_object_cloud.header = in_cloud_ptr->header;
+}
+
+void ScanGroundFilterComponent::publishProcessingTime()
+{
+  if (debug_publisher_ptr_ && stop_watch_ptr_) {
+    const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
+    const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
+    debug_publisher_ptr_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/cyclic_time_ms", cyclic_time_ms);
+    debug_publisher_ptr_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/processing_time_ms", processing_time_ms);
+  }
+}
+
+#if ENABLE_GPU
+ScanGroundFilterCudaParam ScanGroundFilterComponent::getCudaParam() const
+{
+  ScanGroundFilterCudaParam param;
+  param.x_shift = vehicle_info_.wheel_base_m / 2.0f + center_pcl_shift_;
+  param.low_priority_region_x = low_priority_region_x_;
+  param.detection_range_z_max = detection_range_z_max_;
+  param.non_ground_height_threshold = non_ground_height_threshold_;
+  param.grid_size_m = grid_size_m_;
+  param.grid_mode_switch_radius = grid_mode_switch_radius_;
+  param.grid_mode_switch_grid_id = grid_mode_switch_grid_id_;
+  param.grid_mode_switch_angle_rad = grid_mode_switch_angle_rad_;
+  param.grid_size_rad = grid_size_rad_;
+  param.tan_grid_size_rad = tan_grid_size_rad_;
+  param.virtual_lidar_z = virtual_lidar_z_;
+  param.global_slope_max_ratio = global_slope_max_ratio_;
+  param.local_slope_max_ratio = local_slope_max_ratio_;
+  param.radial_divider_angle_rad = radial_divider_angle_rad_;
+  param.split_points_distance_tolerance_square = split_points_distance_tolerance_square_;
+  param.radial_dividers_num = radial_dividers_num_;
+  param.gnd_grid_buffer_size = gnd_grid_buffer_size_;
+  param.use_recheck_ground_cluster = use_recheck_ground_cluster_;
+  param.use_lowest_point = use_lowest_point_;
+  return param;
+}
+#endif
+
 void ScanGroundFilterComponent::faster_filter(
   const PointCloud2ConstPtr & input, [[maybe_unused]] const IndicesPtr & indices,
   PointCloud2 & output,
@@ -585,39 +636,34 @@ void ScanGroundFilterComponent::faster_filter(
   std::scoped_lock lock(mutex_);
   stop_watch_ptr_->toc("processing_time", true);
 
-  if (!offset_initialized_) {
-    set_field_offsets(input);
+  field_offsets_ = input_field_offsets_cache_.resolve(*input);
+
+#if ENABLE_GPU
+  if (cuda_filter_ptr_) {
+    // the object points are kept in the input order, unlike the ray order of the CPU path
+    const size_t object_points_num = cuda_filter_ptr_->filter(
+      input->data.data(), input->data.size() / input->point_step, input->point_step,
+      field_offsets_.x, field_offsets_.y, field_offsets_.z, getCudaParam());
+    initializeObjectPointCloud(input, object_points_num, output);
+    cuda_filter_ptr_->copyObjectPointsToHost(output.data.data());
+    publishProcessingTime();
+    return;
   }
-  std::vector<PointCloudVector> radial_ordered_points;
+#endif
 
   pcl::PointIndices no_ground_indices;
 
   if (elevation_grid_mode_) {
-    convertPointcloudGridScan(input, radial_ordered_points);
-    classifyPointCloudGridScan(input, radial_ordered_points, no_ground_indices);
+    convertPointcloudGridScan(input, radial_ordered_points_);
+    classifyPointCloudGridScan(input, radial_ordered_points_, no_ground_indices);
   } else {
-    convertPointcloud(input, radial_ordered_points);
-    classifyPointCloud(input, radial_ordered_points, no_ground_indices);
+    convertPointcloud(input, radial_ordered_points_);
+    classifyPointCloud(input, radial_ordered_points_, no_ground_indices);
   }
-  output.row_step = no_ground_indices.indices.size() * input->point_step;
-  output.data.resize(output.row_step);
-  output.width = no_ground_indices.indices.size();
-  output.fields = input->fields;
-  output.is_dense = true;
-  output.height = input->height;
-  output.is_bigendian = input->is_bigendian;
-  output.point_step = input->point_step;
-  output.header = input->header;
+  initializeObjectPointCloud(input, no_ground_indices.indices.size(), output);
 
   extractObjectPoints(input, no_ground_indices, output);
-  if (debug_publisher_ptr_ && stop_watch_ptr_) {
-    const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
-    const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
-    debug_publisher_ptr_->publish<tier4_debug_msgs::msg::Float64Stamped>(
-      "debug/cyclic_time_ms", cyclic_time_ms);
-    debug_publisher_ptr_->publish<tier4_debug_msgs::msg::Float64Stamped>(
-      "debug/processing_time_ms", processing_time_ms);
-  }
+  publishProcessingTime();
 }
 
 // TODO(taisa1): Temporary Implementation: Delete this function definition when all the filter
@@ -92,6 +92,12 @@ protected:
 
   virtual void publish(const TargetMsg3D & output_msg);
 
+  // true if the rois of the camera have been received recently enough to be waited for
+  bool isRoiActive(const std::size_t roi_i, const int64_t timestamp_nsec) const;
+  // true if the rois of all the active cameras are fused into the message of the timestamp
+  bool isAllRoisFused(const int64_t timestamp_nsec) const;
+  void postprocessAndPublish(TargetMsg3D & output_msg);
+
   void timer_callback();
   void setPeriod(const int64_t new_period);
 
@@ -106,6 +112,7 @@ protected:
   rclcpp::TimerBase::SharedPtr timer_;
   double timeout_ms_{};
   double match_threshold_ms_{};
+  double inactive_roi_timeout_ms_{};
   std::vector<std::string> input_rois_topics_;
   std::vector<std::string> input_camera_info_topics_;
   std::vector<std::string> input_camera_topics_;
@@ -122,6 +129,7 @@ protected:
   std::pair<int64_t, typename TargetMsg3D::SharedPtr>
     cached_msg_;  // first element is the timestamp in nanoseconds, second element is the message
   std::vector<std::map<int64_t, typename Msg2D::ConstSharedPtr>> cached_roi_msgs_;
+  std::vector<int64_t> latest_roi_stamps_;  // the latest timestamp of the rois in nanoseconds
   std::mutex mutex_cached_msgs_;
 
   // output publisher
@@ -0,0 +1,91 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef IMAGE_PROJECTION_BASED_FUSION__UTILS__PROJECTION_CACHE_HPP_
+#define IMAGE_PROJECTION_BASED_FUSION__UTILS__PROJECTION_CACHE_HPP_
+
+#include <geometry_msgs/msg/transform.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace image_projection_based_fusion
+{
+/**
+ * @brief a point of a pointcloud in the camera optical frame and its pixel in the image
+ * @details u and v are NaN for the points at or behind the camera, i.e. z <= 0.
+ */
+struct ProjectedPoint
+{
+  float x;
+  float y;
+  float z;
+  float u;
+  float v;
+};
+
+// projections of the points of a pointcloud, in the order of the points
+using ProjectionTable = std::vector<ProjectedPoint>;
+
+/**
+ * @brief cache of the projections of the pointclouds into the cameras, shared by the fusion nodes
+ * running in the same process
+ * @details a table is reused for the pointclouds with the same x, y and z of the points, the same
+ * transform to the camera and the same camera projection matrix, whatever the node and the other
+ * fields of the pointcloud. it may be called from multiple threads.
+ */
+class ProjectionCache
+{
+public:
+  // the least recently used tables are dropped once their number exceeds this
+  static constexpr std::size_t max_tables_num = 16;
+
+  static ProjectionCache & getInstance();
+
+  /**
+   * @brief get the projections of the points of the pointcloud, computing them on the first query
+   * @param pointcloud pointcloud with float32 x, y and z fields
+   * @param transform transform from the pointcloud frame to the camera optical frame
+   * @param camera_projection row-major 3x4 projection matrix P of the camera info
+   * @return nullptr if the pointcloud has no float32 x, y or z field
+   */
+  std::shared_ptr<const ProjectionTable> getProjection(
+    const sensor_msgs::msg::PointCloud2 & pointcloud,
+    const geometry_msgs::msg::Transform & transform,
+    const std::array<double, 12> & camera_projection);
+
+  void clear();
+
+private:
+  struct Entry
+  {
+    uint64_t points_hash;
+    std::size_t points_num;
+    std::array<double, 12> transform;
+    std::array<double, 12> camera_projection;
+    std::shared_ptr<const ProjectionTable> table;
+  };
+
+  std::mutex mutex_;
+  // the most recently used first
+  std::deque<Entry> entries_;
+};
+}  // namespace image_projection_based_fusion
+
+#endif  // IMAGE_PROJECTION_BASED_FUSION__UTILS__PROJECTION_CACHE_HPP_
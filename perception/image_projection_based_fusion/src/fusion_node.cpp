@@ -24,6 +24,7 @@
 #include <boost/optional.hpp>
 
 #include <cmath>
+#include <limits>
 
 #ifdef ROS_DISTRO_GALACTIC
 #include <tf2_eigen/tf2_eigen.h>
@@ -61,6 +62,7 @@ FusionNode<TargetMsg3D, ObjType, Msg2D>::FusionNode(
   // Set parameters
   match_threshold_ms_ = declare_parameter<double>("match_threshold_ms");
   timeout_ms_ = declare_parameter<double>("timeout_ms");
+  inactive_roi_timeout_ms_ = declare_parameter<double>("inactive_roi_timeout_ms");
 
   input_rois_topics_.resize(rois_number_);
   input_camera_topics_.resize(rois_number_);
@@ -98,6 +100,7 @@ FusionNode<TargetMsg3D, ObjType, Msg2D>::FusionNode(
   rois_subs_.resize(rois_number_);
   cached_roi_msgs_.resize(rois_number_);
   is_fused_.resize(rois_number_, false);
+  latest_roi_stamps_.resize(rois_number_, std::numeric_limits<int64_t>::min());
   for (std::size_t roi_i = 0; roi_i < rois_number_; ++roi_i) {
     std::function<void(const typename Msg2D::ConstSharedPtr msg)> roi_callback =
       std::bind(&FusionNode::roiCallback, this, std::placeholders::_1, roi_i);
@@ -168,8 +171,7 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::subCallback(
   if (cached_msg_.second != nullptr) {
     stop_watch_ptr_->toc("processing_time", true);
     timer_->cancel();
-    postprocess(*(cached_msg_.second));
-    publish(*(cached_msg_.second));
+    postprocessAndPublish(*(cached_msg_.second));
     std::fill(is_fused_.begin(), is_fused_.end(), false);
 
     // add processing time for debug
@@ -270,10 +272,9 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::subCallback(
 
   // if all camera fused, postprocess; else, publish the old Msg(if exists) and cache the current
   // Msg
-  if (std::count(is_fused_.begin(), is_fused_.end(), true) == static_cast<int>(rois_number_)) {
+  if (isAllRoisFused(timestamp_nsec)) {
     timer_->cancel();
-    postprocess(*output_msg);
-    publish(*output_msg);
+    postprocessAndPublish(*output_msg);
     std::fill(is_fused_.begin(), is_fused_.end(), false);
     cached_msg_.second = nullptr;
 
@@ -302,6 +303,7 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::roiCallback(
 
   int64_t timestamp_nsec =
     (*input_roi_msg).header.stamp.sec * (int64_t)1e9 + (*input_roi_msg).header.stamp.nanosec;
+  latest_roi_stamps_.at(roi_i) = std::max(latest_roi_stamps_.at(roi_i), timestamp_nsec);
 
   // if cached Msg exist, try to match
   if (cached_msg_.second != nullptr) {
@@ -333,10 +335,9 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::roiCallback(
           timestamp_interval_ms - input_offset_ms_.at(roi_i));
       }
 
-      if (std::count(is_fused_.begin(), is_fused_.end(), true) == static_cast<int>(rois_number_)) {
+      if (isAllRoisFused(cached_msg_.first)) {
         timer_->cancel();
-        postprocess(*(cached_msg_.second));
-        publish(*(cached_msg_.second));
+        postprocessAndPublish(*(cached_msg_.second));
         std::fill(is_fused_.begin(), is_fused_.end(), false);
         cached_msg_.second = nullptr;
 
@@ -366,6 +367,49 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::postprocess(TargetMsg3D & output_msg
   // do nothing by default
 }
 
+template <class TargetMsg3D, class Obj, class Msg2D>
+bool FusionNode<TargetMsg3D, Obj, Msg2D>::isRoiActive(
+  const std::size_t roi_i, const int64_t timestamp_nsec) const
+{
+  if (inactive_roi_timeout_ms_ <= 0.0) {
+    return true;
+  }
+  const int64_t expected_stamp = timestamp_nsec + input_offset_ms_.at(roi_i) * (int64_t)1e6;
+  return latest_roi_stamps_.at(roi_i) >= expected_stamp - inactive_roi_timeout_ms_ * (int64_t)1e6;
+}
+
+template <class TargetMsg3D, class Obj, class Msg2D>
+bool FusionNode<TargetMsg3D, Obj, Msg2D>::isAllRoisFused(const int64_t timestamp_nsec) const
+{
+  // NOTE: The cameras which stopped publishing the rois are not waited for until the timeout, so
+  //       that one broken camera does not delay the fusion of every frame.
+  for (std::size_t roi_i = 0; roi_i < rois_number_; ++roi_i) {
+    if (!is_fused_.at(roi_i) && isRoiActive(roi_i, timestamp_nsec)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class TargetMsg3D, class Obj, class Msg2D>
+void FusionNode<TargetMsg3D, Obj, Msg2D>::postprocessAndPublish(TargetMsg3D & output_msg)
+{
+  postprocess(output_msg);
+  publish(output_msg);
+
+  // add the cameras fused into the published message for debug
+  if (debug_publisher_) {
+    std::vector<int32_t> fused_roi_ids;
+    for (std::size_t roi_i = 0; roi_i < rois_number_; ++roi_i) {
+      if (is_fused_.at(roi_i)) {
+        fused_roi_ids.push_back(static_cast<int32_t>(roi_i));
+      }
+    }
+    debug_publisher_->publish<tier4_debug_msgs::msg::Int32MultiArrayStamped>(
+      "debug/fused_roi_ids", fused_roi_ids);
+  }
+}
+
 template <class TargetMsg3D, class Obj, class Msg2D>
 void FusionNode<TargetMsg3D, Obj, Msg2D>::timer_callback()
 {
@@ -376,8 +420,7 @@ void FusionNode<TargetMsg3D, Obj, Msg2D>::timer_callback()
     if (cached_msg_.second != nullptr) {
       stop_watch_ptr_->toc("processing_time", true);
 
-      postprocess(*(cached_msg_.second));
-      publish(*(cached_msg_.second));
+      postprocessAndPublish(*(cached_msg_.second));
 
       // add processing time for debug
       if (debug_publisher_) {
@@ -17,6 +17,7 @@
 #include "autoware_point_types/types.hpp"
 
 #include <image_projection_based_fusion/utils/geometry.hpp>
+#include <image_projection_based_fusion/utils/projection_cache.hpp>
 #include <image_projection_based_fusion/utils/utils.hpp>
 #include <lidar_centerpoint/centerpoint_config.hpp>
 #include <lidar_centerpoint/preprocess/pointcloud_densification.hpp>
@@ -30,18 +31,6 @@
 
 #include <chrono>
 
-namespace
-{
-
-Eigen::Affine3f _transformToEigen(const geometry_msgs::msg::Transform & t)
-{
-  Eigen::Affine3f a;
-  a.matrix() = tf2::transformToEigen(t).matrix().cast<float>();
-  return a;
-}
-
-}  // namespace
-
 namespace image_projection_based_fusion
 {
 
@@ -278,9 +267,8 @@ void PointPaintingFusionNode::fuseOnSingleImage(
   std::vector<sensor_msgs::msg::RegionOfInterest> debug_image_rois;
   std::vector<Eigen::Vector2d> debug_image_points;
 
-  // get transform from cluster frame id to camera optical frame id
-  // geometry_msgs::msg::TransformStamped transform_stamped;
-  Eigen::Affine3f lidar2cam_affine;
+  // get the points in the camera optical frame, shared with the other fusion nodes
+  std::shared_ptr<const ProjectionTable> projection;
   {
     const auto transform_stamped_optional = getTransformStamped(
       tf_buffer_, /*target*/ input_roi_msg.header.frame_id,
@@ -288,29 +276,19 @@ void PointPaintingFusionNode::fuseOnSingleImage(
     if (!transform_stamped_optional) {
       return;
     }
-    lidar2cam_affine = _transformToEigen(transform_stamped_optional.value().transform);
+    projection = ProjectionCache::getInstance().getProjection(
+      painted_pointcloud_msg, transform_stamped_optional.value().transform, camera_info.p);
+    if (!projection) {
+      return;
+    }
   }
 
-  // transform
-  // sensor_msgs::msg::PointCloud2 transformed_pointcloud;
-  // tf2::doTransform(painted_pointcloud_msg, transformed_pointcloud, transform_stamped);
-
-  const auto x_offset =
-    painted_pointcloud_msg.fields.at(static_cast<size_t>(autoware_point_types::PointIndex::X))
-      .offset;
-  const auto y_offset =
-    painted_pointcloud_msg.fields.at(static_cast<size_t>(autoware_point_types::PointIndex::Y))
-      .offset;
-  const auto z_offset =
-    painted_pointcloud_msg.fields.at(static_cast<size_t>(autoware_point_types::PointIndex::Z))
-      .offset;
   const auto class_offset = painted_pointcloud_msg.fields.at(4).offset;
   const auto p_step = painted_pointcloud_msg.point_step;
   // projection matrix
   Eigen::Matrix3f camera_projection;  // use only x,y,z
   camera_projection << camera_info.p.at(0), camera_info.p.at(1), camera_info.p.at(2),
     camera_info.p.at(4), camera_info.p.at(5), camera_info.p.at(6);
-  Eigen::Vector3f point_lidar, point_camera;
   /** dc : don't care
 
 x    | f  x1 x2  dc ||xc|
@@ -320,23 +298,18 @@ dc   | dc dc dc  dc ||zc|
    **/
 
   auto objects = input_roi_msg.feature_objects;
-  int iterations = painted_pointcloud_msg.data.size() / painted_pointcloud_msg.point_step;
+  const int iterations = static_cast<int>(projection->size());
   // iterate points
   // Requires 'OMP_NUM_THREADS=N'
   omp_set_num_threads(omp_num_threads_);
 #pragma omp parallel for
   for (int i = 0; i < iterations; i++) {
     int stride = p_step * i;
-    unsigned char * data = &painted_pointcloud_msg.data[0];
     unsigned char * output = &painted_pointcloud_msg.data[0];
-    float p_x = *reinterpret_cast<const float *>(&data[stride + x_offset]);
-    float p_y = *reinterpret_cast<const float *>(&data[stride + y_offset]);
-    float p_z = *reinterpret_cast<const float *>(&data[stride + z_offset]);
-    point_lidar << p_x, p_y, p_z;
-    point_camera = lidar2cam_affine * point_lidar;
-    p_x = point_camera.x();
-    p_y = point_camera.y();
-    p_z = point_camera.z();
+    const auto & point_camera = (*projection)[i];
+    const float p_x = point_camera.x;
+    const float p_y = point_camera.y;
+    const float p_z = point_camera.z;
 
     if (p_z <= 0.0 || p_x > (tan_h_.at(image_id) * p_z) || p_x < (-tan_h_.at(image_id) * p_z)) {
       continue;
@@ -351,7 +324,6 @@ dc   | dc dc dc  dc ||zc|
       if (
         !isUnknown(label2d) &&
         isInsideBbox(normalized_projected_point.x(), normalized_projected_point.y(), roi, p_z)) {
-        data = &painted_pointcloud_msg.data[0];
         auto p_class = reinterpret_cast<float *>(&output[stride + class_offset]);
         for (const auto & cls : isClassTable_) {
           // add up the class values if the point belongs to multiple classes
@@ -15,6 +15,7 @@
 #include "image_projection_based_fusion/roi_pointcloud_fusion/node.hpp"
 
 #include "image_projection_based_fusion/utils/geometry.hpp"
+#include "image_projection_based_fusion/utils/projection_cache.hpp"
 #include "image_projection_based_fusion/utils/utils.hpp"
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -100,12 +101,8 @@ void RoiPointCloudFusionNode::fuseOnSingleImage(
     return;
   }
 
-  // transform pointcloud to camera optical frame id
-  Eigen::Matrix4d projection;
-  projection << camera_info.p.at(0), camera_info.p.at(1), camera_info.p.at(2), camera_info.p.at(3),
-    camera_info.p.at(4), camera_info.p.at(5), camera_info.p.at(6), camera_info.p.at(7),
-    camera_info.p.at(8), camera_info.p.at(9), camera_info.p.at(10), camera_info.p.at(11);
-  geometry_msgs::msg::TransformStamped transform_stamped;
+  // project pointcloud to the image of camera optical frame id, shared with the other fusion nodes
+  std::shared_ptr<const ProjectionTable> projection;
   {
     const auto transform_stamped_optional = getTransformStamped(
       tf_buffer_, input_roi_msg.header.frame_id, input_pointcloud_msg.header.frame_id,
@@ -113,15 +110,13 @@ void RoiPointCloudFusionNode::fuseOnSingleImage(
     if (!transform_stamped_optional) {
       return;
     }
-    transform_stamped = transform_stamped_optional.value();
+    projection = ProjectionCache::getInstance().getProjection(
+      input_pointcloud_msg, transform_stamped_optional.value().transform, camera_info.p);
+    if (!projection) {
+      return;
+    }
   }
   int point_step = input_pointcloud_msg.point_step;
-  int x_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "x")].offset;
-  int y_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "y")].offset;
-  int z_offset = input_pointcloud_msg.fields[pcl::getFieldIndex(input_pointcloud_msg, "z")].offset;
-
-  sensor_msgs::msg::PointCloud2 transformed_cloud;
-  tf2::doTransform(input_pointcloud_msg, transformed_cloud, transform_stamped);
 
   std::vector<sensor_msgs::msg::PointCloud2> clusters;
   std::vector<size_t> clusters_data_size;
@@ -133,20 +128,13 @@ void RoiPointCloudFusionNode::fuseOnSingleImage(
     cluster.data.resize(max_cluster_size_ * input_pointcloud_msg.point_step);
     clusters_data_size.push_back(0);
   }
-  for (size_t offset = 0; offset < input_pointcloud_msg.data.size(); offset += point_step) {
-    const float transformed_x =
-      *reinterpret_cast<const float *>(&transformed_cloud.data[offset + x_offset]);
-    const float transformed_y =
-      *reinterpret_cast<const float *>(&transformed_cloud.data[offset + y_offset]);
-    const float transformed_z =
-      *reinterpret_cast<const float *>(&transformed_cloud.data[offset + z_offset]);
-    if (transformed_z <= 0.0) {
+  for (std::size_t point_i = 0; point_i < projection->size(); ++point_i) {
+    const std::size_t offset = point_i * point_step;
+    const auto & projected_point = (*projection)[point_i];
+    if (projected_point.z <= 0.0) {
       continue;
     }
-    Eigen::Vector4d projected_point =
-      projection * Eigen::Vector4d(transformed_x, transformed_y, transformed_z, 1.0);
-    Eigen::Vector2d normalized_projected_point = Eigen::Vector2d(
-      projected_point.x() / projected_point.z(), projected_point.y() / projected_point.z());
+    const Eigen::Vector2d normalized_projected_point(projected_point.u, projected_point.v);
     for (std::size_t i = 0; i < output_objs.size(); ++i) {
       auto & feature_obj = output_objs.at(i);
       const auto & check_roi = feature_obj.feature.roi;
@@ -15,6 +15,7 @@
 #include "image_projection_based_fusion/segmentation_pointcloud_fusion/node.hpp"
 
 #include "image_projection_based_fusion/utils/geometry.hpp"
+#include "image_projection_based_fusion/utils/projection_cache.hpp"
 #include "image_projection_based_fusion/utils/utils.hpp"
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -65,13 +66,9 @@ void SegmentPointCloudFusionNode::fuseOnSingleImage(
   if (mask.cols == 0 || mask.rows == 0) {
     return;
   }
-  Eigen::Matrix4d projection;
-  projection << camera_info.p.at(0), camera_info.p.at(1), camera_info.p.at(2), camera_info.p.at(3),
-    camera_info.p.at(4), camera_info.p.at(5), camera_info.p.at(6), camera_info.p.at(7),
-    camera_info.p.at(8), camera_info.p.at(9), camera_info.p.at(10), camera_info.p.at(11), 0.0, 0.0,
-    0.0, 1.0;
-  geometry_msgs::msg::TransformStamped transform_stamped;
-  // transform pointcloud from frame id to camera optical frame id
+  // project pointcloud from frame id to the image of camera optical frame id, shared with the
+  // other fusion nodes
+  std::shared_ptr<const ProjectionTable> projection;
   {
     const auto transform_stamped_optional = getTransformStamped(
       tf_buffer_, input_mask.header.frame_id, input_pointcloud_msg.header.frame_id,
@@ -79,29 +76,27 @@ void SegmentPointCloudFusionNode::fuseOnSingleImage(
     if (!transform_stamped_optional) {
       return;
     }
-    transform_stamped = transform_stamped_optional.value();
+    projection = ProjectionCache::getInstance().getProjection(
+      input_pointcloud_msg, transform_stamped_optional.value().transform, camera_info.p);
+    if (!projection) {
+      return;
+    }
   }
 
-  PointCloud2 transformed_cloud;
-  tf2::doTransform(input_pointcloud_msg, transformed_cloud, transform_stamped);
-
   PointCloud output_cloud;
 
-  for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(transformed_cloud, "x"),
-       iter_y(transformed_cloud, "y"), iter_z(transformed_cloud, "z"),
-       iter_orig_x(input_pointcloud_msg, "x"), iter_orig_y(input_pointcloud_msg, "y"),
-       iter_orig_z(input_pointcloud_msg, "z");
-       iter_x != iter_x.end();
-       ++iter_x, ++iter_y, ++iter_z, ++iter_orig_x, ++iter_orig_y, ++iter_orig_z) {
+  std::size_t point_i = 0;
+  for (sensor_msgs::PointCloud2ConstIterator<float> iter_orig_x(input_pointcloud_msg, "x"),
+       iter_orig_y(input_pointcloud_msg, "y"), iter_orig_z(input_pointcloud_msg, "z");
+       iter_orig_x != iter_orig_x.end(); ++iter_orig_x, ++iter_orig_y, ++iter_orig_z, ++point_i) {
+    const auto & projected_point = (*projection)[point_i];
     // skip filtering pointcloud behind the camera or too far from camera
-    if (*iter_z <= 0.0 || *iter_z > filter_distance_threshold_) {
+    if (projected_point.z <= 0.0 || projected_point.z > filter_distance_threshold_) {
       output_cloud.push_back(pcl::PointXYZ(*iter_orig_x, *iter_orig_y, *iter_orig_z));
       continue;
     }
 
-    Eigen::Vector4d projected_point = projection * Eigen::Vector4d(*iter_x, *iter_y, *iter_z, 1.0);
-    Eigen::Vector2d normalized_projected_point = Eigen::Vector2d(
-      projected_point.x() / projected_point.z(), projected_point.y() / projected_point.z());
+    const Eigen::Vector2d normalized_projected_point(projected_point.u, projected_point.v);
 
     bool is_inside_image =
       normalized_projected_point.x() > 0 && normalized_projected_point.x() < camera_info.width &&
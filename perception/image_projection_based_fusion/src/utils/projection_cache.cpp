@@ -0,0 +1,155 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "image_projection_based_fusion/utils/projection_cache.hpp"
+
+#include "image_projection_based_fusion/utils/utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace
+{
+int getFloatFieldOffset(const sensor_msgs::msg::PointCloud2 & pointcloud, const std::string & name)
+{
+  for (const auto & field : pointcloud.fields) {
+    if (field.name == name && field.datatype == sensor_msgs::msg::PointField::FLOAT32) {
+      return static_cast<int>(field.offset);
+    }
+  }
+  return -1;
+}
+
+float readFloat(const uint8_t * data)
+{
+  float value;
+  std::memcpy(&value, data, sizeof(float));
+  return value;
+}
+
+uint32_t readBits(const uint8_t * data)
+{
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(uint32_t));
+  return value;
+}
+}  // namespace
+
+namespace image_projection_based_fusion
+{
+ProjectionCache & ProjectionCache::getInstance()
+{
+  static ProjectionCache instance;
+  return instance;
+}
+
+std::shared_ptr<const ProjectionTable> ProjectionCache::getProjection(
+  const sensor_msgs::msg::PointCloud2 & pointcloud, const geometry_msgs::msg::Transform & transform,
+  const std::array<double, 12> & camera_projection)
+{
+  const int x_offset = getFloatFieldOffset(pointcloud, "x");
+  const int y_offset = getFloatFieldOffset(pointcloud, "y");
+  const int z_offset = getFloatFieldOffset(pointcloud, "z");
+  if (x_offset < 0 || y_offset < 0 || z_offset < 0 || pointcloud.point_step == 0) {
+    return nullptr;
+  }
+  const std::size_t point_step = pointcloud.point_step;
+  const std::size_t points_num = pointcloud.data.size() / point_step;
+  const uint8_t * data = pointcloud.data.data();
+
+  // hash of the positions of the points, with independent lanes not to serialize the multiplies
+  constexpr uint64_t hash_prime = 0x100000001b3ULL;
+  std::array<uint64_t, 4> lanes{
+    0xcbf29ce484222325ULL, 0x84222325cbf29ce4ULL, 0x9e3779b97f4a7c15ULL, 0xc2b2ae3d27d4eb4fULL};
+  for (std::size_t i = 0; i < points_num; ++i) {
+    const uint8_t * point = data + i * point_step;
+    auto & lane = lanes[i % lanes.size()];
+    lane = (lane ^ readBits(point + x_offset)) * hash_prime;
+    lane = (lane ^ readBits(point + y_offset)) * hash_prime;
+    lane = (lane ^ readBits(point + z_offset)) * hash_prime;
+  }
+  const uint64_t points_hash =
+    ((lanes[0] * hash_prime ^ lanes[1]) * hash_prime ^ lanes[2]) * hash_prime ^ lanes[3];
+
+  const Eigen::Matrix4d transform_matrix = transformToEigen(transform).matrix();
+  std::array<double, 12> transform_array;
+  for (int row = 0; row < 3; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      transform_array[row * 4 + col] = transform_matrix(row, col);
+    }
+  }
+
+  const auto is_same = [&](const Entry & entry) {
+    return entry.points_hash == points_hash && entry.points_num == points_num &&
+           entry.transform == transform_array && entry.camera_projection == camera_projection;
+  };
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto entry = std::find_if(entries_.begin(), entries_.end(), is_same);
+    if (entry != entries_.end()) {
+      std::rotate(entries_.begin(), entry, std::next(entry));
+      return entries_.front().table;
+    }
+  }
+
+  // project the points without holding the lock, the first one stored is kept if computed twice
+  const auto & t = transform_array;
+  const auto & p = camera_projection;
+  auto table = std::make_shared<ProjectionTable>(points_num);
+  for (std::size_t i = 0; i < points_num; ++i) {
+    const uint8_t * point = data + i * point_step;
+    const double x = readFloat(point + x_offset);
+    const double y = readFloat(point + y_offset);
+    const double z = readFloat(point + z_offset);
+    auto & projected = (*table)[i];
+    const double camera_x = t[0] * x + t[1] * y + t[2] * z + t[3];
+    const double camera_y = t[4] * x + t[5] * y + t[6] * z + t[7];
+    const double camera_z = t[8] * x + t[9] * y + t[10] * z + t[11];
+    projected.x = static_cast<float>(camera_x);
+    projected.y = static_cast<float>(camera_y);
+    projected.z = static_cast<float>(camera_z);
+    if (projected.z <= 0.0f) {
+      projected.u = std::numeric_limits<float>::quiet_NaN();
+      projected.v = std::numeric_limits<float>::quiet_NaN();
+      continue;
+    }
+    // project the point in float as tf2::doTransform() gives it
+    const double w = p[8] * projected.x + p[9] * projected.y + p[10] * projected.z + p[11];
+    projected.u =
+      static_cast<float>((p[0] * projected.x + p[1] * projected.y + p[2] * projected.z + p[3]) / w);
+    projected.v =
+      static_cast<float>((p[4] * projected.x + p[5] * projected.y + p[6] * projected.z + p[7]) / w);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto entry = std::find_if(entries_.begin(), entries_.end(), is_same);
+  if (entry != entries_.end()) {
+    std::rotate(entries_.begin(), entry, std::next(entry));
+    return entries_.front().table;
+  }
+  entries_.push_front(Entry{points_hash, points_num, transform_array, camera_projection, table});
+  if (entries_.size() > max_tables_num) {
+    entries_.pop_back();
+  }
+  return table;
+}
+
+void ProjectionCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+}  // namespace image_projection_based_fusion
@@ -0,0 +1,122 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <image_projection_based_fusion/utils/projection_cache.hpp>
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+using image_projection_based_fusion::ProjectionCache;
+
+namespace
+{
+sensor_msgs::msg::PointCloud2 createPointCloud(const std::vector<std::array<float, 3>> & points)
+{
+  sensor_msgs::msg::PointCloud2 pointcloud;
+  sensor_msgs::PointCloud2Modifier modifier(pointcloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(points.size());
+  sensor_msgs::PointCloud2Iterator<float> iter_x(pointcloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(pointcloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(pointcloud, "z");
+  for (const auto & point : points) {
+    *iter_x = point[0];
+    *iter_y = point[1];
+    *iter_z = point[2];
+    ++iter_x, ++iter_y, ++iter_z;
+  }
+  return pointcloud;
+}
+
+// camera looking at the x axis of the pointcloud frame, with the y axis to the left
+geometry_msgs::msg::Transform createTransform(const double translation_x)
+{
+  geometry_msgs::msg::Transform transform;
+  // rotation of the camera frame (x right, y down, z forward) from the pointcloud frame
+  transform.rotation.x = 0.5;
+  transform.rotation.y = -0.5;
+  transform.rotation.z = 0.5;
+  transform.rotation.w = 0.5;
+  transform.translation.x = translation_x;
+  return transform;
+}
+
+constexpr std::array<double, 12> camera_projection{
+  1000.0, 0.0, 640.0, 0.0, 0.0, 1000.0, 360.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+}  // namespace
+
+TEST(ProjectionCacheTest, project_points)
+{
+  auto & cache = ProjectionCache::getInstance();
+  cache.clear();
+  const auto pointcloud =
+    createPointCloud({{10.0f, 0.0f, 0.0f}, {10.0f, 1.0f, -0.5f}, {-5.0f, 0.0f, 0.0f}});
+  const auto projection = cache.getProjection(pointcloud, createTransform(0.0), camera_projection);
+  ASSERT_NE(projection, nullptr);
+  ASSERT_EQ(projection->size(), 3u);
+
+  // point in front of the camera, at the image center
+  EXPECT_NEAR(projection->at(0).z, 10.0, 1e-5);
+  EXPECT_NEAR(projection->at(0).u, 640.0, 1e-3);
+  EXPECT_NEAR(projection->at(0).v, 360.0, 1e-3);
+
+  // point to the left and below
+  EXPECT_NEAR(projection->at(1).x, -1.0, 1e-5);
+  EXPECT_NEAR(projection->at(1).y, 0.5, 1e-5);
+  EXPECT_NEAR(projection->at(1).u, 640.0 - 100.0, 1e-3);
+  EXPECT_NEAR(projection->at(1).v, 360.0 + 50.0, 1e-3);
+
+  // point behind the camera
+  EXPECT_LT(projection->at(2).z, 0.0);
+  EXPECT_TRUE(std::isnan(projection->at(2).u));
+  EXPECT_TRUE(std::isnan(projection->at(2).v));
+}
+
+TEST(ProjectionCacheTest, reuse_projection)
+{
+  auto & cache = ProjectionCache::getInstance();
+  cache.clear();
+  auto pointcloud = createPointCloud({{10.0f, 0.0f, 0.0f}, {10.0f, 1.0f, -0.5f}});
+  const auto projection = cache.getProjection(pointcloud, createTransform(0.0), camera_projection);
+  ASSERT_NE(projection, nullptr);
+
+  // the same points from another message share the table
+  auto other_pointcloud = pointcloud;
+  other_pointcloud.header.frame_id = "other_frame";
+  EXPECT_EQ(
+    cache.getProjection(other_pointcloud, createTransform(0.0), camera_projection), projection);
+
+  // another transform or point position has its own table
+  EXPECT_NE(cache.getProjection(pointcloud, createTransform(1.0), camera_projection), projection);
+  *sensor_msgs::PointCloud2Iterator<float>(pointcloud, "y") = 0.5f;
+  const auto moved_projection =
+    cache.getProjection(pointcloud, createTransform(0.0), camera_projection);
+  EXPECT_NE(moved_projection, projection);
+  EXPECT_NEAR(moved_projection->at(0).x, -0.5, 1e-5);
+}
+
+TEST(ProjectionCacheTest, reject_pointcloud_without_xyz)
+{
+  sensor_msgs::msg::PointCloud2 pointcloud;
+  sensor_msgs::PointCloud2Modifier modifier(pointcloud);
+  modifier.setPointCloud2FieldsByString(1, "rgb");
+  modifier.resize(1);
+  auto & cache = ProjectionCache::getInstance();
+  EXPECT_EQ(cache.getProjection(pointcloud, createTransform(0.0), camera_projection), nullptr);
+}
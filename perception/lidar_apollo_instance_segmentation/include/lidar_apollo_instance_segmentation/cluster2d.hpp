@@ -103,6 +103,11 @@ public:
   void filter(const float * inferred_data);
   void classify(const float * inferred_data);
 
+  // take the obstacles clustered elsewhere, e.g. on the GPU, instead of cluster()
+  void setObstacles(
+    const pcl::PointCloud<pcl::PointXYZI>::Ptr & pc_ptr, std::vector<Obstacle> && obstacles,
+    std::vector<int> && point_obstacle_ids);
+
   void getObjects(
     const float confidence_thresh, const float height_thresh, const int min_pts_num,
     tier4_perception_msgs::msg::DetectedObjectsWithFeature & objects,
@@ -122,6 +127,8 @@ private:
   std::vector<int> point2grid_;
   std::vector<Obstacle> obstacles_;
   std::vector<int> id_img_;
+  // obstacle id of each point in pc_ptr_, or -1
+  std::vector<int> point_obstacle_ids_;
 
   pcl::PointCloud<pcl::PointXYZI>::Ptr pc_ptr_;
   const std::vector<int> * valid_indices_in_pc_ = nullptr;
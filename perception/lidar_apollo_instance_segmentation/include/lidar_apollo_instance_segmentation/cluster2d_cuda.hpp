@@ -0,0 +1,86 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_CUDA_HPP_
+#define LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_CUDA_HPP_
+
+#include "lidar_apollo_instance_segmentation/cluster2d.hpp"
+#include "lidar_apollo_instance_segmentation/cluster2d_kernel.hpp"
+
+#include <cuda_utils/cuda_unique_ptr.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lidar_apollo_instance_segmentation
+{
+/**
+ * @brief clustering of Cluster2D on the GPU over the network output on the device
+ * @details the center paths of the grids are followed by pointer jumping, the cycles they reach
+ * are united by a lock-free disjoint set, and the obstacles are numbered in the same order as
+ * Cluster2D. only the obstacle statistics and the obstacle id of each point are copied back.
+ * all the grids are used for clustering, as the detector does.
+ */
+class Cluster2DCuda
+{
+public:
+  Cluster2DCuda(const int rows, const int cols, const float range);
+
+  /**
+   * @brief cluster the grids and assign the points to the obstacles
+   * @param inferred_data_d network output on the device
+   * @param points_d points on the device, see FeatureGeneratorCuda
+   * @param obstacles obstacles with the score, height, heading and type of Cluster2D::filter()
+   * and Cluster2D::classify(), but without the grids
+   * @param point_obstacle_ids obstacle id of each point, or -1
+   */
+  void cluster(
+    const float * inferred_data_d, const uint8_t * points_d, std::size_t points_num,
+    const PointLayout & layout, float objectness_thresh, std::vector<Obstacle> & obstacles,
+    std::vector<int> & point_obstacle_ids, cudaStream_t stream);
+
+private:
+  void reservePoints(std::size_t points_num);
+
+  Cluster2DCudaParam param_{};
+  int grids_num_{0};
+
+  std::size_t points_capacity_{0};
+  std::size_t temp_storage_bytes_{0};
+
+  cuda_utils::CudaUniquePtr<int[]> jumps_d_;
+  cuda_utils::CudaUniquePtr<int[]> jumps_tmp_d_;
+  cuda_utils::CudaUniquePtr<int[]> min_grids_d_;
+  cuda_utils::CudaUniquePtr<int[]> min_grids_tmp_d_;
+  cuda_utils::CudaUniquePtr<int[]> parents_d_;
+  cuda_utils::CudaUniquePtr<int[]> cycles_d_;
+  cuda_utils::CudaUniquePtr<int[]> labels_d_;
+  cuda_utils::CudaUniquePtr<int[]> first_grids_d_;
+  cuda_utils::CudaUniquePtr<int[]> id_img_d_;
+  cuda_utils::CudaUniquePtr<uint8_t[]> is_object_d_;
+  cuda_utils::CudaUniquePtr<uint8_t[]> in_cycle_d_;
+  cuda_utils::CudaUniquePtr<uint8_t[]> used_cycle_d_;
+  // one more element than the grids, so that the last obstacle index is the obstacle count
+  cuda_utils::CudaUniquePtr<uint32_t[]> obstacle_flags_d_;
+  cuda_utils::CudaUniquePtr<uint32_t[]> obstacle_indices_d_;
+  cuda_utils::CudaUniquePtr<ObstacleSums[]> obstacle_sums_d_;
+  cuda_utils::CudaUniquePtr<int[]> point_obstacle_ids_d_;
+  cuda_utils::CudaUniquePtr<uint8_t[]> temp_storage_d_;
+  cuda_utils::CudaUniquePtrHost<uint32_t> obstacles_num_h_;
+  std::vector<ObstacleSums> obstacle_sums_;
+};
+}  // namespace lidar_apollo_instance_segmentation
+
+#endif  // LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_CUDA_HPP_
@@ -0,0 +1,108 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_KERNEL_HPP_
+#define LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_KERNEL_HPP_
+
+#include "lidar_apollo_instance_segmentation/feature_generator_kernel.hpp"
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lidar_apollo_instance_segmentation
+{
+// the same number as MAX_META_TYPE
+constexpr int CUDA_NUM_META_TYPES = 5;
+
+// same values as Cluster2D
+struct Cluster2DCudaParam
+{
+  int rows;
+  int cols;
+  float range;
+  float scale;
+  float inv_res_x;
+  float inv_res_y;
+  float objectness_thresh;
+};
+
+// sums of the network outputs over the grids of an obstacle
+struct ObstacleSums
+{
+  float grid_num;
+  float score;
+  float height;
+  float heading_x;
+  float heading_y;
+  float meta_type_probabilities[CUDA_NUM_META_TYPES];
+};
+
+// point each grid to its center grid, and initialize the minimum grid index of the path from each
+// grid and the disjoint set of the grids
+cudaError_t initializeNodes_launch(
+  const float * inferred_data, const Cluster2DCudaParam & param, int * jumps, int * min_grids,
+  int * parents, uint8_t * is_object, cudaStream_t stream);
+
+// double the length of the paths, the outputs must not be the inputs
+cudaError_t jumpNodes_launch(
+  const int * jumps, const int * min_grids, int grids_num, int * jumps_out, int * min_grids_out,
+  cudaStream_t stream);
+
+// after the paths are longer than the grids, peg each grid to the smallest grid of the cycle it
+// reaches, and mark the centers, which are the grids on the cycle reached by an object.
+// in_cycle and used_cycle must be zero-filled in advance.
+cudaError_t findCenters_launch(
+  const int * jumps, const int * min_grids, const uint8_t * is_object, int grids_num,
+  int * cycles, uint8_t * in_cycle, uint8_t * used_cycle, cudaStream_t stream);
+
+// unite the cycles, whose centers are next to each other
+cudaError_t uniteCenters_launch(
+  const int * cycles, const uint8_t * in_cycle, const uint8_t * used_cycle,
+  const Cluster2DCudaParam & param, int * parents, cudaStream_t stream);
+
+// label the object grids with the root of their cycles and find the first grid of each root.
+// first_grids must be filled with INT_MAX in advance.
+cudaError_t labelObjects_launch(
+  const int * cycles, const int * parents, const uint8_t * is_object, int grids_num, int * labels,
+  int * first_grids, cudaStream_t stream);
+
+// flags has grids_num + 1 elements and the last one is zero, so that its exclusive sum ends with
+// the number of the obstacles
+cudaError_t flagObstacles_launch(
+  const int * labels, const int * first_grids, int grids_num, uint32_t * flags,
+  cudaStream_t stream);
+
+// call with temp_storage == nullptr to get the required temp_storage_bytes
+cudaError_t exclusiveSum_launch(
+  void * temp_storage, std::size_t & temp_storage_bytes, const uint32_t * input, uint32_t * output,
+  std::size_t num, cudaStream_t stream);
+
+// sum up the outputs into the obstacles and write the obstacle id of each grid.
+// obstacle_sums must be zero-filled in advance.
+cudaError_t sumObstacles_launch(
+  const float * inferred_data, const int * labels, const int * first_grids,
+  const uint32_t * obstacle_indices, int grids_num, int * id_img, ObstacleSums * obstacle_sums,
+  cudaStream_t stream);
+
+cudaError_t assignPoints_launch(
+  const uint8_t * points, std::size_t points_num, const PointLayout & layout,
+  const Cluster2DCudaParam & param, const int * id_img, int * point_obstacle_ids,
+  cudaStream_t stream);
+
+}  // namespace lidar_apollo_instance_segmentation
+
+#endif  // LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_KERNEL_HPP_
@@ -17,6 +17,8 @@
 
 #include "cluster2d.hpp"
 #include "feature_generator.hpp"
+#include "lidar_apollo_instance_segmentation/cluster2d_cuda.hpp"
+#include "lidar_apollo_instance_segmentation/feature_generator_cuda.hpp"
 #include "lidar_apollo_instance_segmentation/node.hpp"
 
 #include <cuda_utils/cuda_unique_ptr.hpp>
@@ -59,6 +61,11 @@ private:
   std::shared_ptr<FeatureGenerator> feature_generator_;
   float score_threshold_;
 
+  // generate the feature map and cluster on the GPU
+  bool use_gpu_processing_;
+  std::unique_ptr<FeatureGeneratorCuda> feature_generator_cuda_;
+  std::unique_ptr<Cluster2DCuda> cluster2d_cuda_;
+
   tf2_ros::Buffer tf_buffer_;
   tf2_ros::TransformListener tf_listener_;
   std::string target_frame_;
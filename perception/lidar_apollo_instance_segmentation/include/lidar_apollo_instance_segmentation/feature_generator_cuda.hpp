@@ -0,0 +1,75 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_CUDA_HPP_
+#define LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_CUDA_HPP_
+
+#include "lidar_apollo_instance_segmentation/feature_generator_kernel.hpp"
+
+#include <cuda_utils/cuda_unique_ptr.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lidar_apollo_instance_segmentation
+{
+/**
+ * @brief feature generator on the GPU, which makes the same feature map as FeatureGenerator
+ * @details the points are summed up into the grids with atomics. the constant features and the
+ * reset values are computed once and copied on the device in every frame. the points are kept
+ * on the device after generate() so that the clustering takes them without another copy.
+ */
+class FeatureGeneratorCuda
+{
+public:
+  FeatureGeneratorCuda(
+    const int width, const int height, const int range, const bool use_intensity_feature,
+    const bool use_constant_feature);
+
+  /**
+   * @brief generate the feature map into feature_map_d
+   * @param feature_map_d device buffer of featureMapSize() floats, i.e. the network input
+   */
+  void generate(
+    const pcl::PointCloud<pcl::PointXYZI> & cloud, float * feature_map_d, cudaStream_t stream);
+
+  std::size_t featureMapSize() const { return feature_map_size_; }
+
+  /** @brief points of the last frame on the device */
+  const uint8_t * pointsDevice() const { return points_d_.get(); }
+  std::size_t pointsNum() const { return points_num_; }
+  const PointLayout & pointLayout() const { return layout_; }
+
+private:
+  void reservePoints(std::size_t points_num);
+
+  FeatureGeneratorCudaParam param_{};
+  FeatureChannels channels_{};
+  PointLayout layout_{};
+  std::size_t feature_map_size_{0};
+
+  std::size_t points_capacity_{0};
+  std::size_t points_num_{0};
+
+  cuda_utils::CudaUniquePtr<uint8_t[]> points_d_;
+  // the feature map of no point, including the constant features
+  cuda_utils::CudaUniquePtr<float[]> initial_feature_map_d_;
+  cuda_utils::CudaUniquePtr<unsigned long long[]> max_height_keys_d_;
+};
+}  // namespace lidar_apollo_instance_segmentation
+
+#endif  // LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_CUDA_HPP_
@@ -0,0 +1,74 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
+#define LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lidar_apollo_instance_segmentation
+{
+// layout of the points on the device, the offsets are in bytes
+struct PointLayout
+{
+  std::size_t point_step;
+  uint32_t x_offset;
+  uint32_t y_offset;
+  uint32_t z_offset;
+  uint32_t intensity_offset;
+};
+
+// channel of each feature in the feature map, or -1 if the feature map does not have it
+struct FeatureChannels
+{
+  int max_height;
+  int mean_height;
+  int count;
+  int top_intensity;
+  int mean_intensity;
+  int nonempty;
+};
+
+// same values as FeatureGenerator and FeatureMapInterface
+struct FeatureGeneratorCudaParam
+{
+  int width;
+  int height;
+  float range;
+  float inv_res_x;
+  float inv_res_y;
+  float min_height;
+  float max_height;
+};
+
+// sum up the points into the grids. the feature map must be reset and max_height_keys must be
+// zero-filled in advance.
+cudaError_t accumulateFeatures_launch(
+  const uint8_t * points, std::size_t points_num, const PointLayout & layout,
+  const FeatureGeneratorCudaParam & param, const FeatureChannels & channels,
+  unsigned long long * max_height_keys, float * feature_map, cudaStream_t stream);
+
+// turn the sums into the features and take the height and intensity of the highest point
+cudaError_t finalizeFeatures_launch(
+  const uint8_t * points, const PointLayout & layout, const FeatureGeneratorCudaParam & param,
+  const FeatureChannels & channels, const unsigned long long * max_height_keys,
+  float * feature_map, cudaStream_t stream);
+
+}  // namespace lidar_apollo_instance_segmentation
+
+#endif  // LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
@@ -68,6 +68,10 @@ struct FeatureMapWithConstantAndIntensity : public FeatureMapInterface
   void initializeMap(std::vector<float> & map) override;
   void resetMap(std::vector<float> & map) override;
 };
+
+std::shared_ptr<FeatureMapInterface> createFeatureMap(
+  const int width, const int height, const int range, const bool use_intensity_feature,
+  const bool use_constant_feature);
 }  // namespace lidar_apollo_instance_segmentation
 
 #endif  // LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_MAP_HPP_
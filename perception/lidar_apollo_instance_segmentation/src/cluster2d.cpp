@@ -56,6 +56,8 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #endif
 
+#include <utility>
+
 namespace lidar_apollo_instance_segmentation
 {
 geometry_msgs::msg::Quaternion getQuaternionFromRPY(const double r, const double p, const double y)
@@ -195,10 +197,26 @@ void Cluster2D::cluster(
       obstacles_[root->obstacle_id].grids.push_back(grid);
     }
   }
+
+  point_obstacle_ids_.assign(pc_ptr_->size(), -1);
+  for (size_t i = 0; i < point2grid_.size(); ++i) {
+    if (point2grid_[i] >= 0) {
+      point_obstacle_ids_[valid_indices_in_pc_->at(i)] = id_img_[point2grid_[i]];
+    }
+  }
   filter(inferred_data);
   classify(inferred_data);
 }
 
+void Cluster2D::setObstacles(
+  const pcl::PointCloud<pcl::PointXYZI>::Ptr & pc_ptr, std::vector<Obstacle> && obstacles,
+  std::vector<int> && point_obstacle_ids)
+{
+  pc_ptr_ = pc_ptr;
+  obstacles_ = std::move(obstacles);
+  point_obstacle_ids_ = std::move(point_obstacle_ids);
+}
+
 void Cluster2D::filter(const float * inferred_data)
 {
   const float * confidence_pt_data = inferred_data + size_ * 3;
@@ -346,15 +364,8 @@ void Cluster2D::getObjects(
   tier4_perception_msgs::msg::DetectedObjectsWithFeature & objects,
   const std_msgs::msg::Header & in_header)
 {
-  for (size_t i = 0; i < point2grid_.size(); ++i) {
-    int grid = point2grid_[i];
-    if (grid < 0) {
-      continue;
-    }
-
-    int obstacle_id = id_img_[grid];
-
-    int point_id = valid_indices_in_pc_->at(i);
+  for (size_t point_id = 0; point_id < point_obstacle_ids_.size(); ++point_id) {
+    const int obstacle_id = point_obstacle_ids_[point_id];
 
     if (obstacle_id >= 0 && obstacles_[obstacle_id].score >= confidence_thresh) {
       if (
@@ -0,0 +1,161 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lidar_apollo_instance_segmentation/cluster2d_cuda.hpp"
+
+#include <cuda_utils/cuda_check_error.hpp>
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace lidar_apollo_instance_segmentation
+{
+static_assert(CUDA_NUM_META_TYPES == MAX_META_TYPE, "the number of the meta types differs");
+
+Cluster2DCuda::Cluster2DCuda(const int rows, const int cols, const float range)
+: obstacles_num_h_(cuda_utils::make_unique_host<uint32_t>())
+{
+  // same values as Cluster2D
+  param_.rows = rows;
+  param_.cols = cols;
+  param_.range = range;
+  param_.scale = 0.5 * static_cast<float>(rows) / range;
+  param_.inv_res_x = 0.5 * static_cast<float>(cols) / range;
+  param_.inv_res_y = 0.5 * static_cast<float>(rows) / range;
+  grids_num_ = rows * cols;
+
+  jumps_d_ = cuda_utils::make_unique<int[]>(grids_num_);
+  jumps_tmp_d_ = cuda_utils::make_unique<int[]>(grids_num_);
+  min_grids_d_ = cuda_utils::make_unique<int[]>(grids_num_);
+  min_grids_tmp_d_ = cuda_utils::make_unique<int[]>(grids_num_);
+  parents_d_ = cuda_utils::make_unique<int[]>(grids_num_);
+  cycles_d_ = cuda_utils::make_unique<int[]>(grids_num_);
+  labels_d_ = cuda_utils::make_unique<int[]>(grids_num_);
+  first_grids_d_ = cuda_utils::make_unique<int[]>(grids_num_);
+  id_img_d_ = cuda_utils::make_unique<int[]>(grids_num_);
+  is_object_d_ = cuda_utils::make_unique<uint8_t[]>(grids_num_);
+  in_cycle_d_ = cuda_utils::make_unique<uint8_t[]>(grids_num_);
+  used_cycle_d_ = cuda_utils::make_unique<uint8_t[]>(grids_num_);
+  obstacle_flags_d_ = cuda_utils::make_unique<uint32_t[]>(grids_num_ + 1);
+  obstacle_indices_d_ = cuda_utils::make_unique<uint32_t[]>(grids_num_ + 1);
+  obstacle_sums_d_ = cuda_utils::make_unique<ObstacleSums[]>(grids_num_);
+
+  // the number of the grids is fixed, so the temporary storage is allocated once
+  CHECK_CUDA_ERROR(exclusiveSum_launch(
+    nullptr, temp_storage_bytes_, obstacle_flags_d_.get(), obstacle_indices_d_.get(),
+    grids_num_ + 1, nullptr));
+  temp_storage_d_ = cuda_utils::make_unique<uint8_t[]>(temp_storage_bytes_);
+}
+
+void Cluster2DCuda::reservePoints(const std::size_t points_num)
+{
+  if (points_num > points_capacity_) {
+    point_obstacle_ids_d_ = cuda_utils::make_unique<int[]>(points_num);
+    points_capacity_ = points_num;
+  }
+}
+
+void Cluster2DCuda::cluster(
+  const float * inferred_data_d, const uint8_t * points_d, const std::size_t points_num,
+  const PointLayout & layout, const float objectness_thresh, std::vector<Obstacle> & obstacles,
+  std::vector<int> & point_obstacle_ids, cudaStream_t stream)
+{
+  param_.objectness_thresh = objectness_thresh;
+  reservePoints(points_num);
+
+  CHECK_CUDA_ERROR(cudaMemsetAsync(in_cycle_d_.get(), 0, grids_num_, stream));
+  CHECK_CUDA_ERROR(cudaMemsetAsync(used_cycle_d_.get(), 0, grids_num_, stream));
+  // NOTE: 0x7F7F7F7F is larger than any grid index, so it works as INT_MAX for atomicMin
+  CHECK_CUDA_ERROR(cudaMemsetAsync(first_grids_d_.get(), 0x7F, grids_num_ * sizeof(int), stream));
+  CHECK_CUDA_ERROR(
+    cudaMemsetAsync(obstacle_sums_d_.get(), 0, grids_num_ * sizeof(ObstacleSums), stream));
+
+  CHECK_CUDA_ERROR(initializeNodes_launch(
+    inferred_data_d, param_, jumps_d_.get(), min_grids_d_.get(), parents_d_.get(),
+    is_object_d_.get(), stream));
+
+  // follow the center paths until they are longer than the grids
+  int * jumps = jumps_d_.get();
+  int * jumps_tmp = jumps_tmp_d_.get();
+  int * min_grids = min_grids_d_.get();
+  int * min_grids_tmp = min_grids_tmp_d_.get();
+  for (int length = 1; length < grids_num_; length *= 2) {
+    CHECK_CUDA_ERROR(
+      jumpNodes_launch(jumps, min_grids, grids_num_, jumps_tmp, min_grids_tmp, stream));
+    std::swap(jumps, jumps_tmp);
+    std::swap(min_grids, min_grids_tmp);
+  }
+
+  CHECK_CUDA_ERROR(findCenters_launch(
+    jumps, min_grids, is_object_d_.get(), grids_num_, cycles_d_.get(), in_cycle_d_.get(),
+    used_cycle_d_.get(), stream));
+  CHECK_CUDA_ERROR(uniteCenters_launch(
+    cycles_d_.get(), in_cycle_d_.get(), used_cycle_d_.get(), param_, parents_d_.get(), stream));
+  CHECK_CUDA_ERROR(labelObjects_launch(
+    cycles_d_.get(), parents_d_.get(), is_object_d_.get(), grids_num_, labels_d_.get(),
+    first_grids_d_.get(), stream));
+
+  CHECK_CUDA_ERROR(flagObstacles_launch(
+    labels_d_.get(), first_grids_d_.get(), grids_num_, obstacle_flags_d_.get(), stream));
+  CHECK_CUDA_ERROR(exclusiveSum_launch(
+    temp_storage_d_.get(), temp_storage_bytes_, obstacle_flags_d_.get(),
+    obstacle_indices_d_.get(), grids_num_ + 1, stream));
+  CHECK_CUDA_ERROR(sumObstacles_launch(
+    inferred_data_d, labels_d_.get(), first_grids_d_.get(), obstacle_indices_d_.get(), grids_num_,
+    id_img_d_.get(), obstacle_sums_d_.get(), stream));
+  CHECK_CUDA_ERROR(assignPoints_launch(
+    points_d, points_num, layout, param_, id_img_d_.get(), point_obstacle_ids_d_.get(), stream));
+
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    obstacles_num_h_.get(), obstacle_indices_d_.get() + grids_num_, sizeof(uint32_t),
+    cudaMemcpyDeviceToHost, stream));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+  const std::size_t obstacles_num = *obstacles_num_h_;
+  obstacle_sums_.resize(obstacles_num);
+  point_obstacle_ids.resize(points_num);
+  if (obstacles_num > 0) {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      obstacle_sums_.data(), obstacle_sums_d_.get(), obstacles_num * sizeof(ObstacleSums),
+      cudaMemcpyDeviceToHost, stream));
+  }
+  if (points_num > 0) {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      point_obstacle_ids.data(), point_obstacle_ids_d_.get(), points_num * sizeof(int),
+      cudaMemcpyDeviceToHost, stream));
+  }
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+  // same as Cluster2D::filter() and Cluster2D::classify()
+  obstacles.assign(obstacles_num, Obstacle());
+  for (std::size_t obstacle_id = 0; obstacle_id < obstacles_num; ++obstacle_id) {
+    const ObstacleSums & sums = obstacle_sums_[obstacle_id];
+    Obstacle & obs = obstacles[obstacle_id];
+    obs.cloud_ptr.reset(new pcl::PointCloud<pcl::PointXYZI>);
+    obs.score = sums.score / sums.grid_num;
+    obs.height = sums.height / sums.grid_num;
+    obs.heading = std::atan2(sums.heading_y, sums.heading_x) * 0.5;
+
+    int meta_type_id = 0;
+    for (int k = 0; k < CUDA_NUM_META_TYPES; ++k) {
+      obs.meta_type_probabilities[k] = sums.meta_type_probabilities[k] / sums.grid_num;
+      if (obs.meta_type_probabilities[k] > obs.meta_type_probabilities[meta_type_id]) {
+        meta_type_id = k;
+      }
+    }
+    obs.meta_type = static_cast<MetaType>(meta_type_id);
+  }
+}
+}  // namespace lidar_apollo_instance_segmentation
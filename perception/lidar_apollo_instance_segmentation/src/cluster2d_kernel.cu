@@ -0,0 +1,330 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lidar_apollo_instance_segmentation/cluster2d_kernel.hpp"
+
+#include <cub/cub.cuh>
+
+namespace
+{
+const std::size_t THREADS_PER_BLOCK = 256;
+}  // namespace
+
+namespace lidar_apollo_instance_segmentation
+{
+// channels of the network output
+enum OutputChannel : int {
+  CATEGORY = 0,
+  INSTANCE_X = 1,
+  INSTANCE_Y = 2,
+  CONFIDENCE = 3,
+  CLASSIFY = 4,
+  HEADING_X = 9,
+  HEADING_Y = 10,
+  HEIGHT = 11
+};
+
+// NOTE: the parents are read through a volatile pointer, since the other threads update them
+__device__ inline int findRoot(const volatile int * parents, int grid)
+{
+  int parent = parents[grid];
+  while (parent != grid) {
+    grid = parent;
+    parent = parents[grid];
+  }
+  return grid;
+}
+
+// a root is always linked to a smaller root, so that the links never make a loop
+__device__ void unite(int * parents, int a, int b)
+{
+  while (true) {
+    a = findRoot(parents, a);
+    b = findRoot(parents, b);
+    if (a == b) {
+      return;
+    }
+    if (a < b) {
+      const int tmp = a;
+      a = b;
+      b = tmp;
+    }
+    if (atomicCAS(parents + a, a, b) == a) {
+      return;
+    }
+  }
+}
+
+inline dim3 getBlocks(std::size_t num)
+{
+  return dim3((num + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK);
+}
+
+__global__ void initializeNodes_kernel(
+  const float * inferred_data, Cluster2DCudaParam param, int * jumps, int * min_grids,
+  int * parents, uint8_t * is_object)
+{
+  const int size = param.rows * param.cols;
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  const int row = grid / param.cols;
+  const int col = grid % param.cols;
+  int center_row = roundf(row + inferred_data[INSTANCE_X * size + grid] * param.scale);
+  int center_col = roundf(col + inferred_data[INSTANCE_Y * size + grid] * param.scale);
+  center_row = min(max(center_row, 0), param.rows - 1);
+  center_col = min(max(center_col, 0), param.cols - 1);
+
+  jumps[grid] = center_row * param.cols + center_col;
+  min_grids[grid] = grid;
+  parents[grid] = grid;
+  is_object[grid] = inferred_data[CATEGORY * size + grid] >= param.objectness_thresh;
+}
+
+cudaError_t initializeNodes_launch(
+  const float * inferred_data, const Cluster2DCudaParam & param, int * jumps, int * min_grids,
+  int * parents, uint8_t * is_object, cudaStream_t stream)
+{
+  const dim3 blocks = getBlocks(param.rows * param.cols);
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+  initializeNodes_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+    inferred_data, param, jumps, min_grids, parents, is_object);
+  return cudaGetLastError();
+}
+
+__global__ void jumpNodes_kernel(
+  const int * jumps, const int * min_grids, int grids_num, int * jumps_out, int * min_grids_out)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= grids_num) return;
+
+  const int jump = jumps[grid];
+  jumps_out[grid] = jumps[jump];
+  min_grids_out[grid] = min(min_grids[grid], min_grids[jump]);
+}
+
+cudaError_t jumpNodes_launch(
+  const int * jumps, const int * min_grids, int grids_num, int * jumps_out, int * min_grids_out,
+  cudaStream_t stream)
+{
+  const dim3 blocks = getBlocks(grids_num);
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+  jumpNodes_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+    jumps, min_grids, grids_num, jumps_out, min_grids_out);
+  return cudaGetLastError();
+}
+
+__global__ void findCenters_kernel(
+  const int * jumps, const int * min_grids, const uint8_t * is_object, int grids_num,
+  int * cycles, uint8_t * in_cycle, uint8_t * used_cycle)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= grids_num) return;
+
+  // the end of a path longer than the grids is on a cycle, and every grid on a cycle is the end of
+  // a path from another grid on it
+  const int end = jumps[grid];
+  const int cycle = min_grids[end];
+  cycles[grid] = cycle;
+  in_cycle[end] = 1;
+  if (is_object[grid]) {
+    used_cycle[cycle] = 1;
+  }
+}
+
+cudaError_t findCenters_launch(
+  const int * jumps, const int * min_grids, const uint8_t * is_object, int grids_num,
+  int * cycles, uint8_t * in_cycle, uint8_t * used_cycle, cudaStream_t stream)
+{
+  const dim3 blocks = getBlocks(grids_num);
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+  findCenters_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+    jumps, min_grids, is_object, grids_num, cycles, in_cycle, used_cycle);
+  return cudaGetLastError();
+}
+
+__global__ void uniteCenters_kernel(
+  const int * cycles, const uint8_t * in_cycle, const uint8_t * used_cycle,
+  Cluster2DCudaParam param, int * parents)
+{
+  const int size = param.rows * param.cols;
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  const auto is_center = [&](const int g) { return in_cycle[g] && used_cycle[cycles[g]]; };
+  if (!is_center(grid)) return;
+
+  // the right and the lower neighbors, the others are united by themselves
+  const int col = grid % param.cols;
+  if (col + 1 < param.cols && is_center(grid + 1)) {
+    unite(parents, cycles[grid], cycles[grid + 1]);
+  }
+  if (grid + param.cols < size && is_center(grid + param.cols)) {
+    unite(parents, cycles[grid], cycles[grid + param.cols]);
+  }
+}
+
+cudaError_t uniteCenters_launch(
+  const int * cycles, const uint8_t * in_cycle, const uint8_t * used_cycle,
+  const Cluster2DCudaParam & param, int * parents, cudaStream_t stream)
+{
+  const dim3 blocks = getBlocks(param.rows * param.cols);
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+  uniteCenters_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+    cycles, in_cycle, used_cycle, param, parents);
+  return cudaGetLastError();
+}
+
+__global__ void labelObjects_kernel(
+  const int * cycles, const int * parents, const uint8_t * is_object, int grids_num, int * labels,
+  int * first_grids)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= grids_num) return;
+
+  if (!is_object[grid]) {
+    labels[grid] = -1;
+    return;
+  }
+  const int root = findRoot(parents, cycles[grid]);
+  labels[grid] = root;
+  atomicMin(first_grids + root, grid);
+}
+
+cudaError_t labelObjects_launch(
+  const int * cycles, const int * parents, const uint8_t * is_object, int grids_num, int * labels,
+  int * first_grids, cudaStream_t stream)
+{
+  const dim3 blocks = getBlocks(grids_num);
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+  labelObjects_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+    cycles, parents, is_object, grids_num, labels, first_grids);
+  return cudaGetLastError();
+}
+
+__global__ void flagObstacles_kernel(
+  const int * labels, const int * first_grids, int grids_num, uint32_t * flags)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid > grids_num) return;
+
+  flags[grid] = grid < grids_num && labels[grid] >= 0 && first_grids[labels[grid]] == grid;
+}
+
+cudaError_t flagObstacles_launch(
+  const int * labels, const int * first_grids, int grids_num, uint32_t * flags,
+  cudaStream_t stream)
+{
+  const dim3 blocks = getBlocks(grids_num + 1);
+  flagObstacles_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+    labels, first_grids, grids_num, flags);
+  return cudaGetLastError();
+}
+
+cudaError_t exclusiveSum_launch(
+  void * temp_storage, std::size_t & temp_storage_bytes, const uint32_t * input, uint32_t * output,
+  std::size_t num, cudaStream_t stream)
+{
+  return cub::DeviceScan::ExclusiveSum(
+    temp_storage, temp_storage_bytes, input, output, static_cast<int>(num), stream);
+}
+
+__global__ void sumObstacles_kernel(
+  const float * inferred_data, const int * labels, const int * first_grids,
+  const uint32_t * obstacle_indices, int grids_num, int * id_img, ObstacleSums * obstacle_sums)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= grids_num) return;
+
+  const int label = labels[grid];
+  if (label < 0) {
+    id_img[grid] = -1;
+    return;
+  }
+  // the obstacles are numbered in the order of their first grids as the CPU implementation does
+  const int obstacle_id = obstacle_indices[first_grids[label]];
+  id_img[grid] = obstacle_id;
+
+  ObstacleSums * sums = obstacle_sums + obstacle_id;
+  atomicAdd(&sums->grid_num, 1.0f);
+  atomicAdd(&sums->score, inferred_data[CONFIDENCE * grids_num + grid]);
+  atomicAdd(&sums->height, inferred_data[HEIGHT * grids_num + grid]);
+  atomicAdd(&sums->heading_x, inferred_data[HEADING_X * grids_num + grid]);
+  atomicAdd(&sums->heading_y, inferred_data[HEADING_Y * grids_num + grid]);
+  for (int k = 0; k < CUDA_NUM_META_TYPES; ++k) {
+    atomicAdd(
+      &sums->meta_type_probabilities[k], inferred_data[(CLASSIFY + k) * grids_num + grid]);
+  }
+}
+
+cudaError_t sumObstacles_launch(
+  const float * inferred_data, const int * labels, const int * first_grids,
+  const uint32_t * obstacle_indices, int grids_num, int * id_img, ObstacleSums * obstacle_sums,
+  cudaStream_t stream)
+{
+  const dim3 blocks = getBlocks(grids_num);
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+  sumObstacles_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+    inferred_data, labels, first_grids, obstacle_indices, grids_num, id_img, obstacle_sums);
+  return cudaGetLastError();
+}
+
+__global__ void assignPoints_kernel(
+  const uint8_t * points, std::size_t points_num, PointLayout layout, Cluster2DCudaParam param,
+  const int * id_img, int * point_obstacle_ids)
+{
+  const std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= points_num) return;
+
+  const uint8_t * point = points + point_idx * layout.point_step;
+  float x, y;
+  memcpy(&x, point + layout.x_offset, sizeof(float));
+  memcpy(&y, point + layout.y_offset, sizeof(float));
+  // the coordinates of x and y have been exchanged in feature generation step
+  const int col = floorf((param.range - y) * param.inv_res_x);
+  const int row = floorf((param.range - x) * param.inv_res_y);
+  if (row < 0 || param.rows <= row || col < 0 || param.cols <= col) {
+    point_obstacle_ids[point_idx] = -1;
+    return;
+  }
+  point_obstacle_ids[point_idx] = id_img[row * param.cols + col];
+}
+
+cudaError_t assignPoints_launch(
+  const uint8_t * points, std::size_t points_num, const PointLayout & layout,
+  const Cluster2DCudaParam & param, const int * id_img, int * point_obstacle_ids,
+  cudaStream_t stream)
+{
+  const dim3 blocks = getBlocks(points_num);
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+  assignPoints_kernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+    points, points_num, layout, param, id_img, point_obstacle_ids);
+  return cudaGetLastError();
+}
+
+}  // namespace lidar_apollo_instance_segmentation
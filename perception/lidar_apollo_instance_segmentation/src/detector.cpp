@@ -20,6 +20,9 @@
 #include <NvInfer.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <utility>
+#include <vector>
+
 namespace lidar_apollo_instance_segmentation
 {
 LidarApolloInstanceSegmentation::LidarApolloInstanceSegmentation(rclcpp::Node * node)
@@ -38,6 +41,7 @@ LidarApolloInstanceSegmentation::LidarApolloInstanceSegmentation(rclcpp::Node *
   target_frame_ = node_->declare_parameter("target_frame", "base_link");
   z_offset_ = node_->declare_parameter<float>("z_offset", -2.0);
   const auto precision = node_->declare_parameter("precision", "fp32");
+  use_gpu_processing_ = node_->declare_parameter("use_gpu_processing", false);
 
   trt_common_ = std::make_unique<tensorrt_common::TrtCommon>(
     onnx_file, precision, nullptr, tensorrt_common::BatchConfig{1, 1, 1}, 1 << 30);
@@ -62,14 +66,22 @@ LidarApolloInstanceSegmentation::LidarApolloInstanceSegmentation(rclcpp::Node *
   output_size_ = std::accumulate(
     output_dims.d + 1, output_dims.d + output_dims.nbDims, 1, std::multiplies<int>());
   output_d_ = cuda_utils::make_unique<float[]>(output_size_);
-  output_h_ = cuda_utils::make_unique_host<float[]>(output_size_, cudaHostAllocPortable);
 
   // feature map generator: pre process
-  feature_generator_ = std::make_shared<FeatureGenerator>(
-    width, height, range, use_intensity_feature, use_constant_feature);
+  if (use_gpu_processing_) {
+    feature_generator_cuda_ = std::make_unique<FeatureGeneratorCuda>(
+      width, height, range, use_intensity_feature, use_constant_feature);
+  } else {
+    output_h_ = cuda_utils::make_unique_host<float[]>(output_size_, cudaHostAllocPortable);
+    feature_generator_ = std::make_shared<FeatureGenerator>(
+      width, height, range, use_intensity_feature, use_constant_feature);
+  }
 
   // cluster: post process
   cluster2d_ = std::make_shared<Cluster2D>(width, height, range);
+  if (use_gpu_processing_) {
+    cluster2d_cuda_ = std::make_unique<Cluster2DCuda>(width, height, range);
+  }
 }
 
 bool LidarApolloInstanceSegmentation::transformCloud(
@@ -127,31 +139,44 @@ bool LidarApolloInstanceSegmentation::detectDynamicObjects(
   pcl::PointCloud<pcl::PointXYZI>::Ptr pcl_pointcloud_raw_ptr(new pcl::PointCloud<pcl::PointXYZI>);
   pcl::fromROSMsg(transformed_cloud, *pcl_pointcloud_raw_ptr);
 
-  // generate feature map
-  std::shared_ptr<FeatureMapInterface> feature_map_ptr =
-    feature_generator_->generate(pcl_pointcloud_raw_ptr);
-
-  CHECK_CUDA_ERROR(cudaMemcpy(
-    input_d_.get(), feature_map_ptr->map_data.data(),
-    feature_map_ptr->map_data.size() * sizeof(float), cudaMemcpyHostToDevice));
-
-  std::vector<void *> buffers = {input_d_.get(), output_d_.get()};
-
-  trt_common_->enqueueV2(buffers.data(), *stream_, nullptr);
-
-  CHECK_CUDA_ERROR(cudaMemcpyAsync(
-    output_h_.get(), output_d_.get(), sizeof(float) * output_size_, cudaMemcpyDeviceToHost,
-    *stream_));
-  cudaStreamSynchronize(*stream_);
-
-  // post process
   const float objectness_thresh = 0.5;
-  pcl::PointIndices valid_idx;
-  valid_idx.indices.resize(pcl_pointcloud_raw_ptr->size());
-  std::iota(valid_idx.indices.begin(), valid_idx.indices.end(), 0);
-  cluster2d_->cluster(
-    output_h_.get(), pcl_pointcloud_raw_ptr, valid_idx, objectness_thresh,
-    true /*use all grids for clustering*/);
+  std::vector<void *> buffers = {input_d_.get(), output_d_.get()};
+  if (use_gpu_processing_) {
+    // the feature map and the network output stay on the device, and only the clusters come back
+    feature_generator_cuda_->generate(*pcl_pointcloud_raw_ptr, input_d_.get(), *stream_);
+    trt_common_->enqueueV2(buffers.data(), *stream_, nullptr);
+    std::vector<Obstacle> obstacles;
+    std::vector<int> point_obstacle_ids;
+    cluster2d_cuda_->cluster(
+      output_d_.get(), feature_generator_cuda_->pointsDevice(),
+      feature_generator_cuda_->pointsNum(), feature_generator_cuda_->pointLayout(),
+      objectness_thresh, obstacles, point_obstacle_ids, *stream_);
+    cluster2d_->setObstacles(
+      pcl_pointcloud_raw_ptr, std::move(obstacles), std::move(point_obstacle_ids));
+  } else {
+    // generate feature map
+    std::shared_ptr<FeatureMapInterface> feature_map_ptr =
+      feature_generator_->generate(pcl_pointcloud_raw_ptr);
+
+    CHECK_CUDA_ERROR(cudaMemcpy(
+      input_d_.get(), feature_map_ptr->map_data.data(),
+      feature_map_ptr->map_data.size() * sizeof(float), cudaMemcpyHostToDevice));
+
+    trt_common_->enqueueV2(buffers.data(), *stream_, nullptr);
+
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      output_h_.get(), output_d_.get(), sizeof(float) * output_size_, cudaMemcpyDeviceToHost,
+      *stream_));
+    cudaStreamSynchronize(*stream_);
+
+    // post process
+    pcl::PointIndices valid_idx;
+    valid_idx.indices.resize(pcl_pointcloud_raw_ptr->size());
+    std::iota(valid_idx.indices.begin(), valid_idx.indices.end(), 0);
+    cluster2d_->cluster(
+      output_h_.get(), pcl_pointcloud_raw_ptr, valid_idx, objectness_thresh,
+      true /*use all grids for clustering*/);
+  }
   const float height_thresh = 0.5;
   const int min_pts_num = 3;
   cluster2d_->getObjects(
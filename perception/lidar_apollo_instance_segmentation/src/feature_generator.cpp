@@ -34,16 +34,7 @@ FeatureGenerator::FeatureGenerator(
   use_intensity_feature_(use_intensity_feature),
   use_constant_feature_(use_constant_feature)
 {
-  // select feature map type
-  if (use_constant_feature && use_intensity_feature) {
-    map_ptr_ = std::make_shared<FeatureMapWithConstantAndIntensity>(width, height, range);
-  } else if (use_constant_feature) {
-    map_ptr_ = std::make_shared<FeatureMapWithConstant>(width, height, range);
-  } else if (use_intensity_feature) {
-    map_ptr_ = std::make_shared<FeatureMapWithIntensity>(width, height, range);
-  } else {
-    map_ptr_ = std::make_shared<FeatureMap>(width, height, range);
-  }
+  map_ptr_ = createFeatureMap(width, height, range, use_intensity_feature, use_constant_feature);
   map_ptr_->initializeMap(map_ptr_->map_data);
 }
 
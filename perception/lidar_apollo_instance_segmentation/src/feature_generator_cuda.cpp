@@ -0,0 +1,114 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lidar_apollo_instance_segmentation/feature_generator_cuda.hpp"
+
+#include "lidar_apollo_instance_segmentation/feature_map.hpp"
+
+#include <cuda_utils/cuda_check_error.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+int getChannel(
+  const lidar_apollo_instance_segmentation::FeatureMapInterface & map, const float * data)
+{
+  if (data == nullptr) {
+    return -1;
+  }
+  return static_cast<int>((data - map.map_data.data()) / (map.width * map.height));
+}
+}  // namespace
+
+namespace lidar_apollo_instance_segmentation
+{
+FeatureGeneratorCuda::FeatureGeneratorCuda(
+  const int width, const int height, const int range, const bool use_intensity_feature,
+  const bool use_constant_feature)
+{
+  // same values as FeatureGenerator
+  param_.width = width;
+  param_.height = height;
+  param_.range = range;
+  param_.inv_res_x = 0.5 * width / range;
+  param_.inv_res_y = 0.5 * height / range;
+  param_.min_height = -5.0;
+  param_.max_height = 5.0;
+
+  const auto map_ptr =
+    createFeatureMap(width, height, range, use_intensity_feature, use_constant_feature);
+  map_ptr->initializeMap(map_ptr->map_data);
+  map_ptr->resetMap(map_ptr->map_data);
+  channels_.max_height = getChannel(*map_ptr, map_ptr->max_height_data);
+  channels_.mean_height = getChannel(*map_ptr, map_ptr->mean_height_data);
+  channels_.count = getChannel(*map_ptr, map_ptr->count_data);
+  channels_.top_intensity = getChannel(*map_ptr, map_ptr->top_intensity_data);
+  channels_.mean_intensity = getChannel(*map_ptr, map_ptr->mean_intensity_data);
+  channels_.nonempty = getChannel(*map_ptr, map_ptr->nonempty_data);
+
+  feature_map_size_ = map_ptr->map_data.size();
+  initial_feature_map_d_ = cuda_utils::make_unique<float[]>(feature_map_size_);
+  CHECK_CUDA_ERROR(cudaMemcpy(
+    initial_feature_map_d_.get(), map_ptr->map_data.data(), feature_map_size_ * sizeof(float),
+    cudaMemcpyHostToDevice));
+  max_height_keys_d_ = cuda_utils::make_unique<unsigned long long[]>(width * height);
+
+  layout_.point_step = sizeof(pcl::PointXYZI);
+  layout_.x_offset = offsetof(pcl::PointXYZI, x);
+  layout_.y_offset = offsetof(pcl::PointXYZI, y);
+  layout_.z_offset = offsetof(pcl::PointXYZI, z);
+  layout_.intensity_offset = offsetof(pcl::PointXYZI, intensity);
+}
+
+void FeatureGeneratorCuda::reservePoints(const std::size_t points_num)
+{
+  if (points_num > points_capacity_) {
+    points_d_ = cuda_utils::make_unique<uint8_t[]>(points_num * layout_.point_step);
+    points_capacity_ = points_num;
+  }
+}
+
+void FeatureGeneratorCuda::generate(
+  const pcl::PointCloud<pcl::PointXYZI> & cloud, float * feature_map_d, cudaStream_t stream)
+{
+  // the point index is kept in the lower 32 bits of the keys
+  if (cloud.size() > UINT32_MAX) {
+    throw std::invalid_argument("too many points for the feature generator");
+  }
+  points_num_ = cloud.size();
+  reservePoints(points_num_);
+  if (points_num_ > 0) {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      points_d_.get(), cloud.points.data(), points_num_ * layout_.point_step,
+      cudaMemcpyHostToDevice, stream));
+  }
+
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    feature_map_d, initial_feature_map_d_.get(), feature_map_size_ * sizeof(float),
+    cudaMemcpyDeviceToDevice, stream));
+  CHECK_CUDA_ERROR(cudaMemsetAsync(
+    max_height_keys_d_.get(), 0, param_.width * param_.height * sizeof(unsigned long long),
+    stream));
+
+  CHECK_CUDA_ERROR(accumulateFeatures_launch(
+    points_d_.get(), points_num_, layout_, param_, channels_, max_height_keys_d_.get(),
+    feature_map_d, stream));
+  CHECK_CUDA_ERROR(finalizeFeatures_launch(
+    points_d_.get(), layout_, param_, channels_, max_height_keys_d_.get(), feature_map_d, stream));
+}
+}  // namespace lidar_apollo_instance_segmentation
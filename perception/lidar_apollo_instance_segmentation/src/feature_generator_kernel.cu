@@ -0,0 +1,139 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lidar_apollo_instance_segmentation/feature_generator_kernel.hpp"
+
+namespace
+{
+const std::size_t THREADS_PER_BLOCK = 256;
+const float EPSILON = 1e-6f;
+}  // namespace
+
+namespace lidar_apollo_instance_segmentation
+{
+__device__ inline float loadFloat(const uint8_t * point, uint32_t offset)
+{
+  float value;
+  memcpy(&value, point + offset, sizeof(float));
+  return value;
+}
+
+// bits of a float, which keep the order of the values as unsigned integers
+__device__ inline uint32_t orderedBits(float value)
+{
+  const uint32_t bits = __float_as_uint(value);
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+__global__ void accumulateFeatures_kernel(
+  const uint8_t * points, std::size_t points_num, PointLayout layout,
+  FeatureGeneratorCudaParam param, FeatureChannels channels, unsigned long long * max_height_keys,
+  float * feature_map)
+{
+  const std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= points_num) return;
+
+  const uint8_t * point = points + point_idx * layout.point_step;
+  const float x = loadFloat(point, layout.x_offset);
+  const float y = loadFloat(point, layout.y_offset);
+  const float z = loadFloat(point, layout.z_offset);
+  if (z <= param.min_height || param.max_height <= z) return;
+
+  const int pos_x = floorf((param.range - y) * param.inv_res_x);  // x on grid
+  const int pos_y = floorf((param.range - x) * param.inv_res_y);  // y on grid
+  if (pos_x < 0 || param.width <= pos_x || pos_y < 0 || param.height <= pos_y) return;
+
+  const int size = param.width * param.height;
+  const int idx = pos_y * param.width + pos_x;
+
+  // ordered by the height and then by the point index in reverse, so that the first one of the
+  // highest points is taken as the CPU implementation does
+  const unsigned long long key = (static_cast<unsigned long long>(orderedBits(z)) << 32) |
+                                 (0xFFFFFFFFu - static_cast<uint32_t>(point_idx));
+  atomicMax(max_height_keys + idx, key);
+
+  atomicAdd(feature_map + channels.mean_height * size + idx, z);
+  if (channels.mean_intensity >= 0) {
+    const float intensity = loadFloat(point, layout.intensity_offset) / 255.0f;
+    atomicAdd(feature_map + channels.mean_intensity * size + idx, intensity);
+  }
+  atomicAdd(feature_map + channels.count * size + idx, 1.0f);
+}
+
+cudaError_t accumulateFeatures_launch(
+  const uint8_t * points, std::size_t points_num, const PointLayout & layout,
+  const FeatureGeneratorCudaParam & param, const FeatureChannels & channels,
+  unsigned long long * max_height_keys, float * feature_map, cudaStream_t stream)
+{
+  dim3 blocks((points_num + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK);
+  dim3 threads(THREADS_PER_BLOCK);
+
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+
+  accumulateFeatures_kernel<<<blocks, threads, 0, stream>>>(
+    points, points_num, layout, param, channels, max_height_keys, feature_map);
+  return cudaGetLastError();
+}
+
+__global__ void finalizeFeatures_kernel(
+  const uint8_t * points, PointLayout layout, FeatureGeneratorCudaParam param,
+  FeatureChannels channels, const unsigned long long * max_height_keys, float * feature_map)
+{
+  const int size = param.width * param.height;
+  const int idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= size) return;
+
+  float * count = feature_map + channels.count * size + idx;
+  float * max_height = feature_map + channels.max_height * size + idx;
+  if (*count < EPSILON) {
+    *max_height = 0.0f;
+  } else {
+    const uint32_t point_idx = 0xFFFFFFFFu - static_cast<uint32_t>(max_height_keys[idx]);
+    const uint8_t * point = points + point_idx * layout.point_step;
+    *max_height = loadFloat(point, layout.z_offset);
+    if (channels.top_intensity >= 0) {
+      feature_map[channels.top_intensity * size + idx] =
+        loadFloat(point, layout.intensity_offset) / 255.0f;
+    }
+    feature_map[channels.mean_height * size + idx] /= *count;
+    if (channels.mean_intensity >= 0) {
+      feature_map[channels.mean_intensity * size + idx] /= *count;
+    }
+    feature_map[channels.nonempty * size + idx] = 1.0f;
+  }
+  // NOTE: the count is an integer, so this is the same value as calcApproximateLog
+  *count = log1pf(*count);
+}
+
+cudaError_t finalizeFeatures_launch(
+  const uint8_t * points, const PointLayout & layout, const FeatureGeneratorCudaParam & param,
+  const FeatureChannels & channels, const unsigned long long * max_height_keys,
+  float * feature_map, cudaStream_t stream)
+{
+  const std::size_t size = param.width * param.height;
+  dim3 blocks((size + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK);
+  dim3 threads(THREADS_PER_BLOCK);
+
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+
+  finalizeFeatures_kernel<<<blocks, threads, 0, stream>>>(
+    points, layout, param, channels, max_height_keys, feature_map);
+  return cudaGetLastError();
+}
+
+}  // namespace lidar_apollo_instance_segmentation
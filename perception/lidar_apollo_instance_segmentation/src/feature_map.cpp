@@ -168,4 +168,19 @@ void FeatureMapWithConstantAndIntensity::resetMap([[maybe_unused]] std::vector<f
     nonempty_data[i] = 0.0f;
   }
 }
+
+std::shared_ptr<FeatureMapInterface> createFeatureMap(
+  const int width, const int height, const int range, const bool use_intensity_feature,
+  const bool use_constant_feature)
+{
+  // select feature map type
+  if (use_constant_feature && use_intensity_feature) {
+    return std::make_shared<FeatureMapWithConstantAndIntensity>(width, height, range);
+  } else if (use_constant_feature) {
+    return std::make_shared<FeatureMapWithConstant>(width, height, range);
+  } else if (use_intensity_feature) {
+    return std::make_shared<FeatureMapWithIntensity>(width, height, range);
+  }
+  return std::make_shared<FeatureMap>(width, height, range);
+}
 }  // namespace lidar_apollo_instance_segmentation
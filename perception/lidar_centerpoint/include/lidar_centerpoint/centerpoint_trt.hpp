@@ -37,21 +37,26 @@ static constexpr size_t CAPACITY_POINT = 1000000;
 class NetworkParam
 {
 public:
-  NetworkParam(std::string onnx_path, std::string engine_path, std::string trt_precision)
+  NetworkParam(
+    std::string onnx_path, std::string engine_path, std::string trt_precision,
+    std::string calibration_data_dir = "")
   : onnx_path_(std::move(onnx_path)),
     engine_path_(std::move(engine_path)),
-    trt_precision_(std::move(trt_precision))
+    trt_precision_(std::move(trt_precision)),
+    calibration_data_dir_(std::move(calibration_data_dir))
   {
   }
 
   std::string onnx_path() const { return onnx_path_; }
   std::string engine_path() const { return engine_path_; }
   std::string trt_precision() const { return trt_precision_; }
+  std::string calibration_data_dir() const { return calibration_data_dir_; }
 
 private:
   std::string onnx_path_;
   std::string engine_path_;
   std::string trt_precision_;
+  std::string calibration_data_dir_;
 };
 
 class CenterPointTRT
@@ -67,16 +72,34 @@ public:
     const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer,
     std::vector<Box3D> & det_boxes3d);
 
+  // the points stay on the device from the input to the voxel features
+  bool detect(
+    const cuda_utils::CudaPointCloud2 & input_pointcloud, const tf2_ros::Buffer & tf_buffer,
+    std::vector<Box3D> & det_boxes3d);
+
+  // record the inputs of the networks of each frame to calibrate the int8 engines, which are
+  // written to the calibration_data_dir of encoder_param and head_param
+  void enableCalibrationDataRecord(
+    const NetworkParam & encoder_param, const NetworkParam & head_param);
+
 protected:
   void initPtr();
 
   virtual bool preprocess(
     const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer);
 
+  bool preprocessDevicePointCloud(
+    const cuda_utils::CudaPointCloud2 & input_pointcloud, const tf2_ros::Buffer & tf_buffer);
+
+  void generateVoxelFeatures(std::size_t points_num);
+
   void inference();
 
   void postProcess(std::vector<Box3D> & det_boxes3d);
 
+  void recordCalibrationData(
+    const float * input_d, const std::size_t input_size, const std::string & calibration_data_dir);
+
   std::unique_ptr<VoxelGeneratorTemplate> vg_ptr_{nullptr};
   std::unique_ptr<VoxelEncoderTRT> encoder_trt_ptr_{nullptr};
   std::unique_ptr<HeadTRT> head_trt_ptr_{nullptr};
@@ -108,6 +131,12 @@ protected:
   cuda::unique_ptr<float[]> voxels_buffer_d_{nullptr};
   cuda::unique_ptr<unsigned int[]> mask_d_{nullptr};
   cuda::unique_ptr<unsigned int[]> num_voxels_d_{nullptr};
+
+  // for the int8 calibration
+  std::string encoder_calibration_data_dir_;
+  std::string head_calibration_data_dir_;
+  std::size_t recorded_frames_num_{0};
+  std::vector<float> calibration_data_;
 };
 
 }  // namespace centerpoint
@@ -49,7 +49,10 @@
 #include <stdexcept>
 #include <type_traits>
 
+// the same check as cuda_utils/cuda_check_error.hpp, which can be included together
+#ifndef CHECK_CUDA_ERROR
 #define CHECK_CUDA_ERROR(e) (cuda::check_error(e, __FILE__, __LINE__))
+#endif
 
 namespace cuda
 {
@@ -0,0 +1,70 @@
+// Copyright 2021 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LIDAR_CENTERPOINT__NETWORK__CALIBRATOR_HPP_
+#define LIDAR_CENTERPOINT__NETWORK__CALIBRATOR_HPP_
+
+#include <lidar_centerpoint/cuda_utils.hpp>
+
+#include <NvInfer.h>
+
+#include <string>
+#include <vector>
+
+namespace centerpoint
+{
+// The extension of the recorded input of a network, which is the raw float tensor of a frame
+constexpr char CALIBRATION_DATA_EXTENSION[] = ".bin";
+
+// Return the sorted paths of the recorded inputs in the directory
+std::vector<std::string> getCalibrationDataPaths(const std::string & calibration_data_dir);
+
+// Write the input of a network on the host as a recorded input of the directory
+bool saveCalibrationData(
+  const std::string & calibration_data_dir, const std::size_t frame_id,
+  const std::vector<float> & input);
+
+/**
+ * @brief calibrator feeding the recorded inputs of a network one by one
+ * @details the calibration table is read from and written to calibration_table_path, so that the
+ * inputs are used only once for the network
+ */
+class Int8EntropyCalibrator : public nvinfer1::IInt8EntropyCalibrator2
+{
+public:
+  Int8EntropyCalibrator(
+    const std::vector<std::string> & input_paths, const std::size_t input_size,
+    const std::string & calibration_table_path);
+
+  int getBatchSize() const noexcept override { return 1; }
+
+  bool getBatch(void * bindings[], const char * names[], int nb_bindings) noexcept override;
+
+  const void * readCalibrationCache(size_t & length) noexcept override;
+
+  void writeCalibrationCache(const void * cache, size_t length) noexcept override;
+
+private:
+  std::vector<std::string> input_paths_;
+  std::size_t input_index_{0};
+  std::size_t input_size_;
+  std::string calibration_table_path_;
+  std::vector<float> input_;
+  cuda::unique_ptr<float[]> input_d_{nullptr};
+  std::vector<char> calibration_table_;
+};
+
+}  // namespace centerpoint
+
+#endif  // LIDAR_CENTERPOINT__NETWORK__CALIBRATOR_HPP_
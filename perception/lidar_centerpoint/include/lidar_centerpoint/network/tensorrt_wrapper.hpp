@@ -34,8 +34,10 @@ public:
 
   ~TensorRTWrapper();
 
+  // calibration_data_dir is the directory of the recorded inputs to calibrate the int8 engine
   bool init(
-    const std::string & onnx_path, const std::string & engine_path, const std::string & precision);
+    const std::string & onnx_path, const std::string & engine_path, const std::string & precision,
+    const std::string & calibration_data_dir = "");
 
   tensorrt_common::TrtUniquePtr<nvinfer1::IExecutionContext> context_{nullptr};
 
@@ -50,7 +52,7 @@ protected:
 private:
   bool parseONNX(
     const std::string & onnx_path, const std::string & engine_path, const std::string & precision,
-    size_t workspace_size = (1ULL << 30));
+    const std::string & calibration_data_dir, size_t workspace_size = (1ULL << 30));
 
   bool saveEngine(const std::string & engine_path);
 
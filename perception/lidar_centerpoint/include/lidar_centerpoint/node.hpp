@@ -17,6 +17,7 @@
 
 #include "lidar_centerpoint/postprocess/non_maximum_suppression.hpp"
 
+#include <cuda_utils/cuda_pointcloud2.hpp>
 #include <lidar_centerpoint/centerpoint_trt.hpp>
 #include <lidar_centerpoint/detection_class_remapper.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -43,12 +44,15 @@ public:
   explicit LidarCenterPointNode(const rclcpp::NodeOptions & node_options);
 
 private:
-  void pointCloudCallback(const sensor_msgs::msg::PointCloud2::ConstSharedPtr input_pointcloud_msg);
+  void pointCloudCallback(
+    const std::shared_ptr<const cuda_utils::CudaPointCloud2> input_pointcloud);
 
   tf2_ros::Buffer tf_buffer_;
   tf2_ros::TransformListener tf_listener_{tf_buffer_};
 
-  rclcpp::Subscription<sensor_msgs::msg::PointCloud2>::SharedPtr pointcloud_sub_;
+  // takes the device buffer of a producer in the same process as is, and copies the data of the
+  // others into the device once
+  rclcpp::Subscription<cuda_utils::CudaPointCloud2>::SharedPtr pointcloud_sub_;
   rclcpp::Publisher<autoware_auto_perception_msgs::msg::DetectedObjects>::SharedPtr objects_pub_;
 
   float score_threshold_{0.0};
@@ -15,6 +15,9 @@
 #ifndef LIDAR_CENTERPOINT__PREPROCESS__POINTCLOUD_DENSIFICATION_HPP_
 #define LIDAR_CENTERPOINT__PREPROCESS__POINTCLOUD_DENSIFICATION_HPP_
 
+#include <cuda_utils/cuda_pointcloud2.hpp>
+#include <lidar_centerpoint/cuda_utils.hpp>
+
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 #ifdef ROS_DISTRO_GALACTIC
@@ -82,6 +85,52 @@ private:
   std::list<PointCloudWithTransform> pointcloud_cache_;
 };
 
+struct DevicePointCloudWithTransform
+{
+  cuda::unique_ptr<float[]> points_xyz_d{nullptr};
+  std::size_t points_size{0};
+  std::size_t capacity{0};
+  double timestamp{0.0};
+  Eigen::Affine3f affine_past2world;
+};
+
+/**
+ * @brief densification cache keeping the past frames on the device
+ * @details only x, y and z of each point are cached, and the buffer of the oldest frame is reused
+ * for the newest one, so that the cache allocates no device memory in the steady state.
+ */
+class PointCloudDensificationCUDA
+{
+public:
+  explicit PointCloudDensificationCUDA(const DensificationParam & param);
+
+  bool enqueuePointCloud(
+    const cuda_utils::CudaPointCloud2 & input_pointcloud, const tf2_ros::Buffer & tf_buffer,
+    cudaStream_t stream);
+
+  double getCurrentTimestamp() const { return current_timestamp_; }
+  Eigen::Affine3f getAffineWorldToCurrent() const { return affine_world2current_; }
+  std::list<DevicePointCloudWithTransform>::iterator getPointCloudCacheIter()
+  {
+    return pointcloud_cache_.begin();
+  }
+  bool isCacheEnd(std::list<DevicePointCloudWithTransform>::iterator iter)
+  {
+    return iter == pointcloud_cache_.end();
+  }
+  unsigned int pointcloud_cache_size() const { return param_.pointcloud_cache_size(); }
+
+private:
+  void enqueue(
+    const cuda_utils::CudaPointCloud2 & input_pointcloud, const Eigen::Affine3f & affine,
+    cudaStream_t stream);
+
+  DensificationParam param_;
+  double current_timestamp_{0.0};
+  Eigen::Affine3f affine_world2current_;
+  std::list<DevicePointCloudWithTransform> pointcloud_cache_;
+};
+
 }  // namespace centerpoint
 
 #endif  // LIDAR_CENTERPOINT__PREPROCESS__POINTCLOUD_DENSIFICATION_HPP_
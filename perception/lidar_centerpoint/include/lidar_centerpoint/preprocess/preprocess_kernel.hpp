@@ -18,8 +18,25 @@
 #include <cuda.h>
 #include <cuda_runtime_api.h>
 
+#include <cstdint>
+
 namespace centerpoint
 {
+// upper 3x4 part of an affine transformation in row-major order
+struct Affine3x4f
+{
+  float m[12];
+};
+
+cudaError_t extractPointsXYZ_launch(
+  const uint8_t * input_data, std::size_t points_size, std::size_t point_step,
+  std::size_t x_offset, std::size_t y_offset, std::size_t z_offset, float * points_xyz,
+  cudaStream_t stream);
+
+cudaError_t generateSweepPoints_launch(
+  const float * points_xyz, std::size_t points_size, const Affine3x4f & affine_past2current,
+  float time_lag, std::size_t point_feature_size, float * output_points, cudaStream_t stream);
+
 cudaError_t generateVoxels_random_launch(
   const float * points, size_t points_size, float min_x_range, float max_x_range, float min_y_range,
   float max_y_range, float min_z_range, float max_z_range, float pillar_x_size, float pillar_y_size,
@@ -36,8 +36,19 @@ public:
   bool enqueuePointCloud(
     const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer);
 
+  bool enqueuePointCloud(
+    const cuda_utils::CudaPointCloud2 & input_pointcloud, const tf2_ros::Buffer & tf_buffer,
+    cudaStream_t stream);
+
+  /**
+   * @brief write the points of the device cache to points_d without going through the host
+   * @return the number of the points written, at most capacity
+   */
+  std::size_t generateSweepPoints(float * points_d, std::size_t capacity, cudaStream_t stream);
+
 protected:
   std::unique_ptr<PointCloudDensification> pd_ptr_{nullptr};
+  std::unique_ptr<PointCloudDensificationCUDA> pd_cuda_ptr_{nullptr};
 
   CenterPointConfig config_;
   std::array<float, 6> range_;
@@ -15,6 +15,7 @@
 #include "lidar_centerpoint/centerpoint_trt.hpp"
 
 #include <lidar_centerpoint/centerpoint_config.hpp>
+#include <lidar_centerpoint/network/calibrator.hpp>
 #include <lidar_centerpoint/network/scatter_kernel.hpp>
 #include <lidar_centerpoint/preprocess/preprocess_kernel.hpp>
 #include <tier4_autoware_utils/math/constants.hpp>
@@ -37,7 +38,8 @@ CenterPointTRT::CenterPointTRT(
   // encoder
   encoder_trt_ptr_ = std::make_unique<VoxelEncoderTRT>(config_);
   encoder_trt_ptr_->init(
-    encoder_param.onnx_path(), encoder_param.engine_path(), encoder_param.trt_precision());
+    encoder_param.onnx_path(), encoder_param.engine_path(), encoder_param.trt_precision(),
+    encoder_param.calibration_data_dir());
   encoder_trt_ptr_->context_->setBindingDimensions(
     0,
     nvinfer1::Dims3(
@@ -48,7 +50,9 @@ CenterPointTRT::CenterPointTRT(
     config_.class_size_,        config_.head_out_offset_size_, config_.head_out_z_size_,
     config_.head_out_dim_size_, config_.head_out_rot_size_,    config_.head_out_vel_size_};
   head_trt_ptr_ = std::make_unique<HeadTRT>(out_channel_sizes, config_);
-  head_trt_ptr_->init(head_param.onnx_path(), head_param.engine_path(), head_param.trt_precision());
+  head_trt_ptr_->init(
+    head_param.onnx_path(), head_param.engine_path(), head_param.trt_precision(),
+    head_param.calibration_data_dir());
   head_trt_ptr_->context_->setBindingDimensions(
     0, nvinfer1::Dims4(
          config_.batch_size_, config_.encoder_out_feature_size_, config_.grid_size_y_,
@@ -127,6 +131,28 @@ bool CenterPointTRT::detect(
   return true;
 }
 
+bool CenterPointTRT::detect(
+  const cuda_utils::CudaPointCloud2 & input_pointcloud, const tf2_ros::Buffer & tf_buffer,
+  std::vector<Box3D> & det_boxes3d)
+{
+  CHECK_CUDA_ERROR(cudaMemsetAsync(
+    encoder_in_features_d_.get(), 0, encoder_in_feature_size_ * sizeof(float), stream_));
+  CHECK_CUDA_ERROR(
+    cudaMemsetAsync(spatial_features_d_.get(), 0, spatial_features_size_ * sizeof(float), stream_));
+
+  if (!preprocessDevicePointCloud(input_pointcloud, tf_buffer)) {
+    RCLCPP_WARN_STREAM(
+      rclcpp::get_logger("lidar_centerpoint"), "Fail to preprocess and skip to detect.");
+    return false;
+  }
+
+  inference();
+
+  postProcess(det_boxes3d);
+
+  return true;
+}
+
 bool CenterPointTRT::preprocess(
   const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer)
 {
@@ -138,6 +164,26 @@ bool CenterPointTRT::preprocess(
   CHECK_CUDA_ERROR(cudaMemcpyAsync(
     points_d_.get(), points_.data(), count * config_.point_feature_size_ * sizeof(float),
     cudaMemcpyHostToDevice, stream_));
+  generateVoxelFeatures(count);
+
+  return true;
+}
+
+bool CenterPointTRT::preprocessDevicePointCloud(
+  const cuda_utils::CudaPointCloud2 & input_pointcloud, const tf2_ros::Buffer & tf_buffer)
+{
+  bool is_success = vg_ptr_->enqueuePointCloud(input_pointcloud, tf_buffer, stream_);
+  if (!is_success) {
+    return false;
+  }
+  const auto count = vg_ptr_->generateSweepPoints(points_d_.get(), CAPACITY_POINT, stream_);
+  generateVoxelFeatures(count);
+
+  return true;
+}
+
+void CenterPointTRT::generateVoxelFeatures(const std::size_t points_num)
+{
   CHECK_CUDA_ERROR(cudaMemsetAsync(num_voxels_d_.get(), 0, sizeof(unsigned int), stream_));
   CHECK_CUDA_ERROR(
     cudaMemsetAsync(voxels_buffer_d_.get(), 0, voxels_buffer_size_ * sizeof(float), stream_));
@@ -149,7 +195,7 @@ bool CenterPointTRT::preprocess(
     num_points_per_voxel_d_.get(), 0, config_.max_voxel_size_ * sizeof(float), stream_));
 
   CHECK_CUDA_ERROR(generateVoxels_random_launch(
-    points_d_.get(), count, config_.range_min_x_, config_.range_max_x_, config_.range_min_y_,
+    points_d_.get(), points_num, config_.range_min_x_, config_.range_max_x_, config_.range_min_y_,
     config_.range_max_y_, config_.range_min_z_, config_.range_max_z_, config_.voxel_size_x_,
     config_.voxel_size_y_, config_.voxel_size_z_, config_.grid_size_y_, config_.grid_size_x_,
     mask_d_.get(), voxels_buffer_d_.get(), stream_));
@@ -164,8 +210,6 @@ bool CenterPointTRT::preprocess(
     config_.max_voxel_size_, config_.voxel_size_x_, config_.voxel_size_y_, config_.voxel_size_z_,
     config_.range_min_x_, config_.range_min_y_, config_.range_min_z_, encoder_in_features_d_.get(),
     stream_));
-
-  return true;
 }
 
 void CenterPointTRT::inference()
@@ -174,6 +218,11 @@ void CenterPointTRT::inference()
     throw std::runtime_error("Failed to create tensorrt context.");
   }
 
+  if (!encoder_calibration_data_dir_.empty()) {
+    recordCalibrationData(
+      encoder_in_features_d_.get(), encoder_in_feature_size_, encoder_calibration_data_dir_);
+  }
+
   // pillar encoder network
   std::vector<void *> encoder_buffers{encoder_in_features_d_.get(), pillar_features_d_.get()};
   encoder_trt_ptr_->context_->enqueueV2(encoder_buffers.data(), stream_, nullptr);
@@ -184,6 +233,12 @@ void CenterPointTRT::inference()
     config_.encoder_out_feature_size_, config_.grid_size_x_, config_.grid_size_y_,
     spatial_features_d_.get(), stream_));
 
+  if (!head_calibration_data_dir_.empty()) {
+    recordCalibrationData(
+      spatial_features_d_.get(), spatial_features_size_, head_calibration_data_dir_);
+    ++recorded_frames_num_;
+  }
+
   // head network
   std::vector<void *> head_buffers = {spatial_features_d_.get(), head_out_heatmap_d_.get(),
                                       head_out_offset_d_.get(),  head_out_z_d_.get(),
@@ -192,6 +247,28 @@ void CenterPointTRT::inference()
   head_trt_ptr_->context_->enqueueV2(head_buffers.data(), stream_, nullptr);
 }
 
+void CenterPointTRT::enableCalibrationDataRecord(
+  const NetworkParam & encoder_param, const NetworkParam & head_param)
+{
+  encoder_calibration_data_dir_ = encoder_param.calibration_data_dir();
+  head_calibration_data_dir_ = head_param.calibration_data_dir();
+}
+
+void CenterPointTRT::recordCalibrationData(
+  const float * input_d, const std::size_t input_size, const std::string & calibration_data_dir)
+{
+  calibration_data_.resize(input_size);
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    calibration_data_.data(), input_d, input_size * sizeof(float), cudaMemcpyDeviceToHost,
+    stream_));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream_));
+  if (!saveCalibrationData(calibration_data_dir, recorded_frames_num_, calibration_data_)) {
+    RCLCPP_WARN_STREAM(
+      rclcpp::get_logger("lidar_centerpoint"),
+      "Failed to record the calibration data to " << calibration_data_dir);
+  }
+}
+
 void CenterPointTRT::postProcess(std::vector<Box3D> & det_boxes3d)
 {
   CHECK_CUDA_ERROR(post_proc_ptr_->generateDetectedBoxes3D_launch(
@@ -0,0 +1,126 @@
+// Copyright 2021 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lidar_centerpoint/network/calibrator.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace centerpoint
+{
+std::vector<std::string> getCalibrationDataPaths(const std::string & calibration_data_dir)
+{
+  std::vector<std::string> paths;
+  if (!std::filesystem::is_directory(calibration_data_dir)) {
+    return paths;
+  }
+  for (const auto & entry : std::filesystem::directory_iterator(calibration_data_dir)) {
+    if (entry.is_regular_file() && entry.path().extension() == CALIBRATION_DATA_EXTENSION) {
+      paths.push_back(entry.path().string());
+    }
+  }
+  std::sort(paths.begin(), paths.end());
+  return paths;
+}
+
+bool saveCalibrationData(
+  const std::string & calibration_data_dir, const std::size_t frame_id,
+  const std::vector<float> & input)
+{
+  std::filesystem::create_directories(calibration_data_dir);
+  std::ostringstream filename;
+  filename << std::setw(6) << std::setfill('0') << frame_id << CALIBRATION_DATA_EXTENSION;
+  std::ofstream file(
+    std::filesystem::path(calibration_data_dir) / filename.str(), std::ios::out | std::ios::binary);
+  file.write(
+    reinterpret_cast<const char *>(input.data()),
+    static_cast<std::streamsize>(input.size() * sizeof(float)));
+  return static_cast<bool>(file);
+}
+
+Int8EntropyCalibrator::Int8EntropyCalibrator(
+  const std::vector<std::string> & input_paths, const std::size_t input_size,
+  const std::string & calibration_table_path)
+: input_paths_(input_paths),
+  input_size_(input_size),
+  calibration_table_path_(calibration_table_path),
+  input_(input_size),
+  input_d_(cuda::make_unique<float[]>(input_size))
+{
+}
+
+bool Int8EntropyCalibrator::getBatch(
+  void * bindings[], const char * names[], int nb_bindings) noexcept
+{
+  (void)names;
+  (void)nb_bindings;
+
+  // the inputs recorded with another model config are skipped
+  while (input_index_ < input_paths_.size()) {
+    const auto & path = input_paths_.at(input_index_++);
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    file.read(
+      reinterpret_cast<char *>(input_.data()),
+      static_cast<std::streamsize>(input_size_ * sizeof(float)));
+    if (!file || file.peek() != std::ifstream::traits_type::eof()) {
+      std::cerr << "Skip the calibration data of an unexpected size: " << path << std::endl;
+      continue;
+    }
+    try {
+      CHECK_CUDA_ERROR(cudaMemcpy(
+        input_d_.get(), input_.data(), input_size_ * sizeof(float), cudaMemcpyHostToDevice));
+    } catch (const std::exception & e) {
+      std::cerr << e.what() << std::endl;
+      return false;
+    }
+    bindings[0] = input_d_.get();
+    return true;
+  }
+  return false;
+}
+
+const void * Int8EntropyCalibrator::readCalibrationCache(size_t & length) noexcept
+{
+  calibration_table_.clear();
+  std::ifstream input(calibration_table_path_, std::ios::binary);
+  input >> std::noskipws;
+  if (input.good()) {
+    std::copy(
+      std::istream_iterator<char>(input), std::istream_iterator<char>(),
+      std::back_inserter(calibration_table_));
+  }
+
+  length = calibration_table_.size();
+  if (length) {
+    std::cout << "Using cached calibration table to build the engine" << std::endl;
+  } else {
+    std::cout << "New calibration table will be created to build the engine" << std::endl;
+  }
+  return length ? calibration_table_.data() : nullptr;
+}
+
+void Int8EntropyCalibrator::writeCalibrationCache(const void * cache, size_t length) noexcept
+{
+  std::ofstream output(calibration_table_path_, std::ios::binary);
+  output.write(reinterpret_cast<const char *>(cache), static_cast<std::streamsize>(length));
+}
+
+}  // namespace centerpoint
@@ -34,6 +34,8 @@ bool VoxelEncoderTRT::setProfile(
   profile->setDimensions(out_name, nvinfer1::OptProfileSelector::kOPT, out_dims);
   profile->setDimensions(out_name, nvinfer1::OptProfileSelector::kMAX, out_dims);
   config.addOptimizationProfile(profile);
+  // the inputs of the same dimensions are used for the int8 calibration
+  config.setCalibrationProfile(profile);
 
   return true;
 }
@@ -75,6 +77,8 @@ bool HeadTRT::setProfile(
     profile->setDimensions(out_name, nvinfer1::OptProfileSelector::kMAX, out_dims);
   }
   config.addOptimizationProfile(profile);
+  // the inputs of the same dimensions are used for the int8 calibration
+  config.setCalibrationProfile(profile);
 
   return true;
 }
@@ -14,8 +14,11 @@
 
 #include "lidar_centerpoint/network/tensorrt_wrapper.hpp"
 
+#include <lidar_centerpoint/network/calibrator.hpp>
+
 #include <NvOnnxParser.h>
 
+#include <filesystem>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -35,7 +38,8 @@ TensorRTWrapper::~TensorRTWrapper()
 }
 
 bool TensorRTWrapper::init(
-  const std::string & onnx_path, const std::string & engine_path, const std::string & precision)
+  const std::string & onnx_path, const std::string & engine_path, const std::string & precision,
+  const std::string & calibration_data_dir)
 {
   runtime_ =
     tensorrt_common::TrtUniquePtr<nvinfer1::IRuntime>(nvinfer1::createInferRuntime(logger_));
@@ -52,7 +56,7 @@ bool TensorRTWrapper::init(
     auto log_thread = logger_.log_throttle(
       nvinfer1::ILogger::Severity::kINFO,
       "Applying optimizations and building TRT CUDA engine. Please wait a minutes...", 5);
-    success = parseONNX(onnx_path, engine_path, precision);
+    success = parseONNX(onnx_path, engine_path, precision, calibration_data_dir);
     logger_.stop_throttle(log_thread);
   }
   success &= createContext();
@@ -80,7 +84,7 @@ bool TensorRTWrapper::createContext()
 
 bool TensorRTWrapper::parseONNX(
   const std::string & onnx_path, const std::string & engine_path, const std::string & precision,
-  const size_t workspace_size)
+  const std::string & calibration_data_dir, const size_t workspace_size)
 {
   auto builder =
     tensorrt_common::TrtUniquePtr<nvinfer1::IBuilder>(nvinfer1::createInferBuilder(logger_));
@@ -128,6 +132,41 @@ bool TensorRTWrapper::parseONNX(
     return false;
   }
 
+  // the calibrator is used while building the engine
+  std::unique_ptr<Int8EntropyCalibrator> calibrator;
+  if (precision == "int8") {
+    if (builder->platformHasFastInt8()) {
+      tensorrt_common::LOG_INFO(logger_) << "Using TensorRT INT8 Inference" << std::endl;
+      config->setFlag(nvinfer1::BuilderFlag::kINT8);
+      // NOTE: The layers which are not quantized run in FP16 instead of FP32.
+      if (builder->platformHasFastFp16()) {
+        config->setFlag(nvinfer1::BuilderFlag::kFP16);
+      }
+
+      const auto calibration_table_path =
+        std::filesystem::path(onnx_path).replace_extension("EntropyV2-calibration.table").string();
+      const auto calibration_data_paths = getCalibrationDataPaths(calibration_data_dir);
+      if (calibration_data_paths.empty() && !std::filesystem::exists(calibration_table_path)) {
+        tensorrt_common::LOG_ERROR(logger_)
+          << "Neither calibration data in " << calibration_data_dir
+          << " nor calibration table " << calibration_table_path << " exists" << std::endl;
+        return false;
+      }
+      const auto in_dims = config->getCalibrationProfile()->getDimensions(
+        network->getInput(0)->getName(), nvinfer1::OptProfileSelector::kOPT);
+      std::size_t input_size = 1;
+      for (int32_t i = 0; i < in_dims.nbDims; ++i) {
+        input_size *= static_cast<std::size_t>(in_dims.d[i]);
+      }
+      calibrator = std::make_unique<Int8EntropyCalibrator>(
+        calibration_data_paths, input_size, calibration_table_path);
+      config->setInt8Calibrator(calibrator.get());
+    } else {
+      tensorrt_common::LOG_INFO(logger_)
+        << "TensorRT INT8 Inference isn't supported in this environment" << std::endl;
+    }
+  }
+
   plan_ = tensorrt_common::TrtUniquePtr<nvinfer1::IHostMemory>(
     builder->buildSerializedNetwork(*network, *config));
   if (!plan_) {
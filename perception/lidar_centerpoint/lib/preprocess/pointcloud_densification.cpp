@@ -14,6 +14,8 @@
 
 #include "lidar_centerpoint/preprocess/pointcloud_densification.hpp"
 
+#include "lidar_centerpoint/preprocess/preprocess_kernel.hpp"
+
 #include <pcl_ros/transforms.hpp>
 
 #include <boost/optional.hpp>
@@ -25,8 +27,12 @@
 #include <tf2_eigen/tf2_eigen.hpp>
 #endif
 
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -52,6 +58,18 @@ Eigen::Affine3f transformToEigen(const geometry_msgs::msg::Transform & t)
   return a;
 }
 
+std::size_t getFieldOffset(
+  const std::vector<sensor_msgs::msg::PointField> & fields, const std::string & name)
+{
+  const auto field = std::find_if(fields.begin(), fields.end(), [&name](const auto & f) {
+    return f.name == name && f.datatype == sensor_msgs::msg::PointField::FLOAT32;
+  });
+  if (field == fields.end()) {
+    throw std::runtime_error("pointcloud has no float32 field " + name);
+  }
+  return field->offset;
+}
+
 }  // namespace
 
 namespace centerpoint
@@ -99,4 +117,61 @@ void PointCloudDensification::dequeue()
   }
 }
 
+PointCloudDensificationCUDA::PointCloudDensificationCUDA(const DensificationParam & param)
+: param_(param)
+{
+}
+
+bool PointCloudDensificationCUDA::enqueuePointCloud(
+  const cuda_utils::CudaPointCloud2 & input_pointcloud, const tf2_ros::Buffer & tf_buffer,
+  cudaStream_t stream)
+{
+  const auto header = input_pointcloud.header;
+
+  if (param_.pointcloud_cache_size() > 1) {
+    auto transform_world2current =
+      getTransform(tf_buffer, header.frame_id, param_.world_frame_id(), header.stamp);
+    if (!transform_world2current) {
+      return false;
+    }
+    auto affine_world2current = transformToEigen(transform_world2current.get());
+
+    enqueue(input_pointcloud, affine_world2current, stream);
+  } else {
+    enqueue(input_pointcloud, Eigen::Affine3f::Identity(), stream);
+  }
+
+  return true;
+}
+
+void PointCloudDensificationCUDA::enqueue(
+  const cuda_utils::CudaPointCloud2 & input_pointcloud,
+  const Eigen::Affine3f & affine_world2current, cudaStream_t stream)
+{
+  affine_world2current_ = affine_world2current;
+  current_timestamp_ = rclcpp::Time(input_pointcloud.header.stamp).seconds();
+
+  // reuse the buffer of the oldest frame once the cache is full
+  if (pointcloud_cache_.size() < param_.pointcloud_cache_size()) {
+    pointcloud_cache_.emplace_front();
+  } else {
+    pointcloud_cache_.splice(
+      pointcloud_cache_.begin(), pointcloud_cache_, std::prev(pointcloud_cache_.end()));
+  }
+
+  auto & pointcloud = pointcloud_cache_.front();
+  pointcloud.points_size = input_pointcloud.width * input_pointcloud.height;
+  pointcloud.timestamp = current_timestamp_;
+  pointcloud.affine_past2world = affine_world2current.inverse();
+  if (pointcloud.points_size > pointcloud.capacity) {
+    pointcloud.points_xyz_d = cuda::make_unique<float[]>(pointcloud.points_size * 3);
+    pointcloud.capacity = pointcloud.points_size;
+  }
+
+  CHECK_CUDA_ERROR(extractPointsXYZ_launch(
+    input_pointcloud.data.get(), pointcloud.points_size, input_pointcloud.point_step,
+    getFieldOffset(input_pointcloud.fields, "x"), getFieldOffset(input_pointcloud.fields, "y"),
+    getFieldOffset(input_pointcloud.fields, "z"), pointcloud.points_xyz_d.get(), stream));
+}
+
 }  // namespace centerpoint
@@ -41,6 +41,71 @@ const std::size_t ENCODER_IN_FEATURE_SIZE = 9;  // the same as encoder_in_featur
 
 namespace centerpoint
 {
+__global__ void extractPointsXYZ_kernel(
+  const uint8_t * input_data, std::size_t points_size, std::size_t point_step,
+  std::size_t x_offset, std::size_t y_offset, std::size_t z_offset, float * points_xyz)
+{
+  std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= points_size) return;
+
+  const uint8_t * point = input_data + point_idx * point_step;
+  memcpy(points_xyz + point_idx * 3 + 0, point + x_offset, sizeof(float));
+  memcpy(points_xyz + point_idx * 3 + 1, point + y_offset, sizeof(float));
+  memcpy(points_xyz + point_idx * 3 + 2, point + z_offset, sizeof(float));
+}
+
+cudaError_t extractPointsXYZ_launch(
+  const uint8_t * input_data, std::size_t points_size, std::size_t point_step,
+  std::size_t x_offset, std::size_t y_offset, std::size_t z_offset, float * points_xyz,
+  cudaStream_t stream)
+{
+  dim3 blocks((points_size + 256 - 1) / 256);
+  dim3 threads(256);
+
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+
+  extractPointsXYZ_kernel<<<blocks, threads, 0, stream>>>(
+    input_data, points_size, point_step, x_offset, y_offset, z_offset, points_xyz);
+  return cudaGetLastError();
+}
+
+__global__ void generateSweepPoints_kernel(
+  const float * points_xyz, std::size_t points_size, Affine3x4f affine_past2current,
+  float time_lag, std::size_t point_feature_size, float * output_points)
+{
+  std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= points_size) return;
+
+  const float * m = affine_past2current.m;
+  const float x = points_xyz[point_idx * 3 + 0];
+  const float y = points_xyz[point_idx * 3 + 1];
+  const float z = points_xyz[point_idx * 3 + 2];
+
+  float * output_point = output_points + point_idx * point_feature_size;
+  output_point[0] = m[0] * x + m[1] * y + m[2] * z + m[3];
+  output_point[1] = m[4] * x + m[5] * y + m[6] * z + m[7];
+  output_point[2] = m[8] * x + m[9] * y + m[10] * z + m[11];
+  output_point[3] = time_lag;
+}
+
+cudaError_t generateSweepPoints_launch(
+  const float * points_xyz, std::size_t points_size, const Affine3x4f & affine_past2current,
+  float time_lag, std::size_t point_feature_size, float * output_points, cudaStream_t stream)
+{
+  dim3 blocks((points_size + 256 - 1) / 256);
+  dim3 threads(256);
+
+  if (blocks.x == 0) {
+    return cudaGetLastError();
+  }
+
+  generateSweepPoints_kernel<<<blocks, threads, 0, stream>>>(
+    points_xyz, points_size, affine_past2current, time_lag, point_feature_size, output_points);
+  return cudaGetLastError();
+}
+
 __global__ void generateVoxels_random_kernel(
   const float * points, size_t points_size, float min_x_range, float max_x_range, float min_y_range,
   float max_y_range, float min_z_range, float max_z_range, float pillar_x_size, float pillar_y_size,
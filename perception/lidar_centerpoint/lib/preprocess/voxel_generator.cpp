@@ -14,8 +14,12 @@
 
 #include "lidar_centerpoint/preprocess/voxel_generator.hpp"
 
+#include "lidar_centerpoint/preprocess/preprocess_kernel.hpp"
+
 #include <sensor_msgs/point_cloud2_iterator.hpp>
 
+#include <algorithm>
+
 namespace centerpoint
 {
 VoxelGeneratorTemplate::VoxelGeneratorTemplate(
@@ -23,6 +27,7 @@ VoxelGeneratorTemplate::VoxelGeneratorTemplate(
 : config_(config)
 {
   pd_ptr_ = std::make_unique<PointCloudDensification>(param);
+  pd_cuda_ptr_ = std::make_unique<PointCloudDensificationCUDA>(param);
   range_[0] = config.range_min_x_;
   range_[1] = config.range_min_y_;
   range_[2] = config.range_min_z_;
@@ -43,6 +48,41 @@ bool VoxelGeneratorTemplate::enqueuePointCloud(
   return pd_ptr_->enqueuePointCloud(input_pointcloud_msg, tf_buffer);
 }
 
+bool VoxelGeneratorTemplate::enqueuePointCloud(
+  const cuda_utils::CudaPointCloud2 & input_pointcloud, const tf2_ros::Buffer & tf_buffer,
+  cudaStream_t stream)
+{
+  return pd_cuda_ptr_->enqueuePointCloud(input_pointcloud, tf_buffer, stream);
+}
+
+std::size_t VoxelGeneratorTemplate::generateSweepPoints(
+  float * points_d, const std::size_t capacity, cudaStream_t stream)
+{
+  size_t point_counter{};
+  for (auto pc_cache_iter = pd_cuda_ptr_->getPointCloudCacheIter();
+       !pd_cuda_ptr_->isCacheEnd(pc_cache_iter); pc_cache_iter++) {
+    const Eigen::Affine3f affine_past2current =
+      pd_cuda_ptr_->getAffineWorldToCurrent() * pc_cache_iter->affine_past2world;
+    const float time_lag =
+      static_cast<float>(pd_cuda_ptr_->getCurrentTimestamp() - pc_cache_iter->timestamp);
+
+    Affine3x4f affine;
+    for (int row = 0; row < 3; ++row) {
+      for (int col = 0; col < 4; ++col) {
+        affine.m[row * 4 + col] = affine_past2current.matrix()(row, col);
+      }
+    }
+
+    const auto points_size = std::min(pc_cache_iter->points_size, capacity - point_counter);
+    CHECK_CUDA_ERROR(generateSweepPoints_launch(
+      pc_cache_iter->points_xyz_d.get(), points_size, affine, time_lag,
+      config_.point_feature_size_, points_d + point_counter * config_.point_feature_size_,
+      stream));
+    point_counter += points_size;
+  }
+  return point_counter;
+}
+
 std::size_t VoxelGenerator::generateSweepPoints(std::vector<float> & points)
 {
   Eigen::Vector3f point_current, point_past;
@@ -49,6 +49,9 @@ LidarCenterPointNode::LidarCenterPointNode(const rclcpp::NodeOptions & node_opti
   const int densification_num_past_frames =
     this->declare_parameter<int>("densification_params.num_past_frames");
   const std::string trt_precision = this->declare_parameter<std::string>("trt_precision");
+  const std::string calibration_data_path =
+    this->declare_parameter<std::string>("calibration_data_path");
+  const bool record_calibration_data = this->declare_parameter<bool>("record_calibration_data");
   const std::string encoder_onnx_path = this->declare_parameter<std::string>("encoder_onnx_path");
   const std::string encoder_engine_path =
     this->declare_parameter<std::string>("encoder_engine_path");
@@ -87,8 +90,10 @@ LidarCenterPointNode::LidarCenterPointNode(const rclcpp::NodeOptions & node_opti
     iou_bev_nms_.setParameters(p);
   }
 
-  NetworkParam encoder_param(encoder_onnx_path, encoder_engine_path, trt_precision);
-  NetworkParam head_param(head_onnx_path, head_engine_path, trt_precision);
+  NetworkParam encoder_param(
+    encoder_onnx_path, encoder_engine_path, trt_precision, calibration_data_path + "/encoder");
+  NetworkParam head_param(
+    head_onnx_path, head_engine_path, trt_precision, calibration_data_path + "/head");
   DensificationParam densification_param(
     densification_world_frame_id, densification_num_past_frames);
 
@@ -108,8 +113,11 @@ LidarCenterPointNode::LidarCenterPointNode(const rclcpp::NodeOptions & node_opti
     yaw_norm_thresholds, has_variance_);
   detector_ptr_ =
     std::make_unique<CenterPointTRT>(encoder_param, head_param, densification_param, config);
+  if (record_calibration_data) {
+    detector_ptr_->enableCalibrationDataRecord(encoder_param, head_param);
+  }
 
-  pointcloud_sub_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
+  pointcloud_sub_ = this->create_subscription<cuda_utils::CudaPointCloud2>(
     "~/input/pointcloud", rclcpp::SensorDataQoS{}.keep_last(1),
     std::bind(&LidarCenterPointNode::pointCloudCallback, this, std::placeholders::_1));
   objects_pub_ = this->create_publisher<autoware_auto_perception_msgs::msg::DetectedObjects>(
@@ -133,7 +141,7 @@ LidarCenterPointNode::LidarCenterPointNode(const rclcpp::NodeOptions & node_opti
 }
 
 void LidarCenterPointNode::pointCloudCallback(
-  const sensor_msgs::msg::PointCloud2::ConstSharedPtr input_pointcloud_msg)
+  const std::shared_ptr<const cuda_utils::CudaPointCloud2> input_pointcloud)
 {
   const auto objects_sub_count =
     objects_pub_->get_subscription_count() + objects_pub_->get_intra_process_subscription_count();
@@ -146,7 +154,7 @@ void LidarCenterPointNode::pointCloudCallback(
   }
 
   std::vector<Box3D> det_boxes3d;
-  bool is_success = detector_ptr_->detect(*input_pointcloud_msg, tf_buffer_, det_boxes3d);
+  bool is_success = detector_ptr_->detect(*input_pointcloud, tf_buffer_, det_boxes3d);
   if (!is_success) {
     return;
   }
@@ -160,7 +168,7 @@ void LidarCenterPointNode::pointCloudCallback(
   }
 
   autoware_auto_perception_msgs::msg::DetectedObjects output_msg;
-  output_msg.header = input_pointcloud_msg->header;
+  output_msg.header = input_pointcloud->header;
   output_msg.objects = iou_bev_nms_.apply(raw_objects);
 
   detection_class_remapper_.mapClasses(output_msg);
@@ -0,0 +1,46 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lidar_centerpoint/network/calibrator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+TEST(TestSuite, saveAndGetCalibrationData)
+{
+  const auto calibration_data_dir =
+    (std::filesystem::temp_directory_path() / "test_centerpoint_calibration_data").string();
+  std::filesystem::remove_all(calibration_data_dir);
+  EXPECT_TRUE(centerpoint::getCalibrationDataPaths(calibration_data_dir).empty());
+
+  const std::vector<float> input{0.0f, 1.0f, -2.5f};
+  ASSERT_TRUE(centerpoint::saveCalibrationData(calibration_data_dir, 10, input));
+  ASSERT_TRUE(centerpoint::saveCalibrationData(calibration_data_dir, 2, input));
+  std::ofstream(std::filesystem::path(calibration_data_dir) / "calibration.table") << "table";
+
+  const auto paths = centerpoint::getCalibrationDataPaths(calibration_data_dir);
+  ASSERT_EQ(paths.size(), 2u);
+  EXPECT_EQ(std::filesystem::path(paths.at(0)).filename(), "000002.bin");
+  EXPECT_EQ(std::filesystem::path(paths.at(1)).filename(), "000010.bin");
+
+  std::vector<float> loaded(input.size());
+  std::ifstream file(paths.at(0), std::ios::in | std::ios::binary);
+  file.read(reinterpret_cast<char *>(loaded.data()), loaded.size() * sizeof(float));
+  EXPECT_EQ(loaded, input);
+  EXPECT_EQ(file.peek(), std::ifstream::traits_type::eof());
+}
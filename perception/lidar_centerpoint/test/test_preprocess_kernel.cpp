@@ -394,6 +394,43 @@ TEST_F(PreprocessKernelTest, VoxelOverflowTest)
   }
 }
 
+TEST_F(PreprocessKernelTest, SweepPointsTest)
+{
+  // x, y, z and an unused intensity field, packed as in a PointCloud2
+  constexpr std::size_t points_num = 2;
+  constexpr std::size_t point_step = 4 * sizeof(float);
+  std::vector<float> input_points{1.0f, 2.0f, 3.0f, 10.0f, -4.0f, 5.0f, -6.0f, 20.0f};
+
+  auto input_d = cuda::make_unique<float[]>(input_points.size());
+  auto points_xyz_d = cuda::make_unique<float[]>(points_num * 3);
+  CHECK_CUDA_ERROR(cudaMemcpy(
+    input_d.get(), input_points.data(), input_points.size() * sizeof(float),
+    cudaMemcpyHostToDevice));
+
+  cudaError_t code = centerpoint::extractPointsXYZ_launch(
+    reinterpret_cast<const uint8_t *>(input_d.get()), points_num, point_step, 0, sizeof(float),
+    2 * sizeof(float), points_xyz_d.get(), stream_);
+  ASSERT_EQ(cudaSuccess, code);
+
+  // rotation of 90 degrees around z and translation of (1, 2, 3)
+  Affine3x4f affine{{0.0f, -1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 1.0f, 3.0f}};
+  const float time_lag = 0.1f;
+  code = centerpoint::generateSweepPoints_launch(
+    points_xyz_d.get(), points_num, affine, time_lag, point_feature_size_, points_d_.get(),
+    stream_);
+  ASSERT_EQ(cudaSuccess, code);
+
+  std::vector<float> points(points_num * point_feature_size_);
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream_));
+  CHECK_CUDA_ERROR(cudaMemcpy(
+    points.data(), points_d_.get(), points.size() * sizeof(float), cudaMemcpyDeviceToHost));
+
+  std::vector<float> expected{-1.0f, 3.0f, 6.0f, time_lag, -4.0f, -2.0f, -3.0f, time_lag};
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(expected[i], points[i], 1e-6);
+  }
+}
+
 }  // namespace centerpoint
 
 int main(int argc, char ** argv)
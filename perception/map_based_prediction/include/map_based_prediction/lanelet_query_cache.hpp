@@ -0,0 +1,101 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MAP_BASED_PREDICTION__LANELET_QUERY_CACHE_HPP_
+#define MAP_BASED_PREDICTION__LANELET_QUERY_CACHE_HPP_
+
+#include <tier4_autoware_utils/geometry/boost_geometry.hpp>
+
+#include <geometry_msgs/msg/point.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/RoutingGraph.h>
+
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace map_based_prediction
+{
+/**
+ * @brief cache of the lanelet queries repeated for every object, built once per map
+ * @details the centerline segments of all the lanelets are indexed by an R-tree with their yaw,
+ * and the centerlines and the possible paths are memoized on their first query. the queries may be
+ * called from multiple threads, while build() and clear() may not. build() also fills the
+ * centerlines lanelet2 caches lazily in the lanelets, whose first access is not thread-safe.
+ */
+class LaneletQueryCache
+{
+public:
+  // step of the search distance of the memoized possible paths, the distance is rounded up to it
+  static constexpr double possible_paths_distance_resolution = 1.0;
+  // the memoized possible paths are dropped once their number exceeds this
+  static constexpr std::size_t max_possible_paths_num = 10000;
+
+  void build(const lanelet::LaneletMapPtr & lanelet_map_ptr);
+  void clear();
+
+  /**
+   * @brief same as lanelet::utils::getLaneletAngle(), the yaw of the closest centerline segment
+   */
+  double getLaneletAngle(
+    const lanelet::ConstLanelet & lanelet, const geometry_msgs::msg::Point & search_point) const;
+
+  /**
+   * @brief centerline converted to geometry_msgs::msg::Point
+   */
+  std::vector<geometry_msgs::msg::Point> getCenterline(const lanelet::ConstLanelet & lanelet) const;
+
+  /**
+   * @brief RoutingGraph::possiblePaths() with the search distance rounded up, including the
+   * shorter paths but not the lane changes
+   */
+  lanelet::routing::LaneletPaths getPossiblePaths(
+    const lanelet::routing::RoutingGraphPtr & routing_graph_ptr,
+    const lanelet::ConstLanelet & lanelet, const double search_distance);
+
+private:
+  struct SegmentData
+  {
+    lanelet::Id lanelet_id;
+    std::size_t index;
+    // direction of the segment along the lanelet
+    double dx;
+    double dy;
+  };
+  using SegmentValue = std::pair<tier4_autoware_utils::Segment2d, SegmentData>;
+  using SegmentRtree =
+    boost::geometry::index::rtree<SegmentValue, boost::geometry::index::rstar<16>>;
+
+  bool isIndexed(const lanelet::ConstLanelet & lanelet) const;
+
+  SegmentRtree segment_rtree_;
+  // the number of segments of each indexed lanelet
+  std::unordered_map<lanelet::Id, std::size_t> segment_nums_;
+  // filled on the first query, for each direction of the lanelets
+  mutable std::map<std::pair<lanelet::Id, bool>, std::vector<geometry_msgs::msg::Point>>
+    centerlines_;
+  std::map<std::tuple<lanelet::Id, bool, int64_t>, lanelet::routing::LaneletPaths>
+    possible_paths_;
+  // guards the memoized results, which are computed without holding it
+  mutable std::mutex memo_mutex_;
+};
+}  // namespace map_based_prediction
+
+#endif  // MAP_BASED_PREDICTION__LANELET_QUERY_CACHE_HPP_
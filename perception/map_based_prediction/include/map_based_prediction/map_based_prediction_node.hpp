@@ -15,7 +15,9 @@
 #ifndef MAP_BASED_PREDICTION__MAP_BASED_PREDICTION_NODE_HPP_
 #define MAP_BASED_PREDICTION__MAP_BASED_PREDICTION_NODE_HPP_
 
+#include "map_based_prediction/lanelet_query_cache.hpp"
 #include "map_based_prediction/path_generator.hpp"
+#include "map_based_prediction/worker_pool.hpp"
 #include "tf2/LinearMath/Quaternion.h"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 #include "tier4_autoware_utils/ros/update_param.hpp"
@@ -42,6 +44,7 @@
 #include <lanelet2_traffic_rules/TrafficRules.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <deque>
 #include <map>
 #include <memory>
@@ -132,6 +135,26 @@ using autoware_perception_msgs::msg::TrafficSignalElement;
 using tier4_autoware_utils::StopWatch;
 using tier4_debug_msgs::msg::StringStamped;
 using TrajectoryPoints = std::vector<TrajectoryPoint>;
+using StoppedTimesAgainstGreen = std::map<lanelet::Id, rclcpp::Time>;
+
+/**
+ * @brief an object of a frame with the state it carries over the frames
+ * @details the states are moved out of the histories before the objects are predicted, possibly
+ * in parallel, and moved back in the input order afterwards, so that no object reads or writes
+ * the shared histories while the others are predicted.
+ */
+struct ObjectPredictionSlot
+{
+  TrackedObject object;  // in the map frame
+  std::uint8_t label;    // label for the prediction
+  std::string object_id;
+  std::deque<ObjectData> road_user_history;
+  StoppedTimesAgainstGreen stopped_times_against_green;
+  // results
+  std::optional<PredictedObject> predicted_object;
+  std::optional<Maneuver> debug_maneuver;
+};
+
 class MapBasedPredictionNode : public rclcpp::Node
 {
 public:
@@ -151,7 +174,7 @@ private:
 
   // Object History
   std::unordered_map<std::string, std::deque<ObjectData>> road_users_history;
-  std::map<std::pair<std::string, lanelet::Id>, rclcpp::Time> stopped_times_against_green_;
+  std::unordered_map<std::string, StoppedTimesAgainstGreen> stopped_times_against_green_;
   std::unordered_map<std::string, std::deque<CrosswalkUserData>> crosswalk_users_history_;
   std::unordered_map<std::string, std::string> known_matches_;
 
@@ -159,6 +182,8 @@ private:
   std::shared_ptr<lanelet::LaneletMap> lanelet_map_ptr_;
   std::shared_ptr<lanelet::routing::RoutingGraph> routing_graph_ptr_;
   std::shared_ptr<lanelet::traffic_rules::TrafficRules> traffic_rules_ptr_;
+  // lanelet queries per object, rebuilt with the map
+  LaneletQueryCache lanelet_query_cache_;
 
   std::unordered_map<lanelet::Id, TrafficSignal> traffic_signal_id_map_;
 
@@ -173,6 +198,9 @@ private:
   // Path Generator
   std::shared_ptr<PathGenerator> path_generator_;
 
+  // workers predicting the objects in parallel, null to predict them in the callback thread
+  std::unique_ptr<WorkerPool> worker_pool_;
+
   // Crosswalk Entry Points
   lanelet::ConstLanelets crosswalks_;
 
@@ -240,20 +268,30 @@ private:
 
   PredictedObject convertToPredictedObject(const TrackedObject & tracked_object);
 
-  PredictedObject getPredictedObjectAsCrosswalkUser(const TrackedObject & object);
+  PredictedObject getPredictedObjectAsCrosswalkUser(
+    const TrackedObject & object, StoppedTimesAgainstGreen & stopped_times_against_green);
+
+  void predictObjects(
+    std::vector<ObjectPredictionSlot> & slots, const std_msgs::msg::Header & header,
+    const double objects_detected_time);
+  void predictObject(
+    ObjectPredictionSlot & slot, const std_msgs::msg::Header & header,
+    const double objects_detected_time);
 
   void removeStaleTrafficLightInfo(const TrackedObjects::ConstSharedPtr in_objects);
 
-  LaneletsData getCurrentLanelets(const TrackedObject & object);
+  LaneletsData getCurrentLanelets(
+    const TrackedObject & object, const std::deque<ObjectData> & object_history);
   bool checkCloseLaneletCondition(
-    const std::pair<double, lanelet::Lanelet> & lanelet, const TrackedObject & object);
+    const std::pair<double, lanelet::Lanelet> & lanelet, const TrackedObject & object,
+    const std::deque<ObjectData> & object_history);
   float calculateLocalLikelihood(
     const lanelet::Lanelet & current_lanelet, const TrackedObject & object) const;
   void updateObjectData(TrackedObject & object);
 
   void updateRoadUsersHistory(
     const std_msgs::msg::Header & header, const TrackedObject & object,
-    const LaneletsData & current_lanelets_data);
+    const LaneletsData & current_lanelets_data, std::deque<ObjectData> & object_history);
   void updateCrosswalkUserHistory(
     const std_msgs::msg::Header & header, const TrackedObject & object,
     const std::string & object_id);
@@ -261,10 +299,11 @@ private:
     const std::string & object_id, std::unordered_map<std::string, TrackedObject> & current_users);
   std::vector<PredictedRefPath> getPredictedReferencePath(
     const TrackedObject & object, const LaneletsData & current_lanelets_data,
-    const double object_detected_time, const double time_horizon);
+    const double object_detected_time, const double time_horizon,
+    std::deque<ObjectData> & object_history);
   Maneuver predictObjectManeuver(
     const TrackedObject & object, const LaneletData & current_lanelet_data,
-    const double object_detected_time);
+    const double object_detected_time, std::deque<ObjectData> & object_history);
   geometry_msgs::msg::Pose compensateTimeDelay(
     const geometry_msgs::msg::Pose & delayed_pose, const geometry_msgs::msg::Twist & twist,
     const double dt) const;
@@ -278,14 +317,14 @@ private:
     const lanelet::routing::LaneletPaths & center_paths);
 
   void addReferencePaths(
-    const TrackedObject & object, const lanelet::routing::LaneletPaths & candidate_paths,
-    const float path_probability, const ManeuverProbability & maneuver_probability,
-    const Maneuver & maneuver, std::vector<PredictedRefPath> & reference_paths,
+    const lanelet::routing::LaneletPaths & candidate_paths, const float path_probability,
+    const ManeuverProbability & maneuver_probability, const Maneuver & maneuver,
+    std::vector<PredictedRefPath> & reference_paths, std::deque<ObjectData> & object_history,
     const double speed_limit = 0.0);
   std::vector<PosePath> convertPathType(const lanelet::routing::LaneletPaths & paths);
 
   void updateFuturePossibleLanelets(
-    const TrackedObject & object, const lanelet::routing::LaneletPaths & paths);
+    const lanelet::routing::LaneletPaths & paths, std::deque<ObjectData> & object_history);
 
   bool isDuplicated(
     const std::pair<double, lanelet::ConstLanelet> & target_lanelet,
@@ -296,17 +335,17 @@ private:
   std::optional<TrafficSignalElement> getTrafficSignalElement(const lanelet::Id & id);
   bool calcIntentionToCrossWithTrafficSignal(
     const TrackedObject & object, const lanelet::ConstLanelet & crosswalk,
-    const lanelet::Id & signal_id);
+    const lanelet::Id & signal_id, StoppedTimesAgainstGreen & stopped_times_against_green);
 
   visualization_msgs::msg::Marker getDebugMarker(
     const TrackedObject & object, const Maneuver & maneuver, const size_t obj_num);
 
   Maneuver predictObjectManeuverByTimeToLaneChange(
     const TrackedObject & object, const LaneletData & current_lanelet_data,
-    const double object_detected_time);
+    const double object_detected_time, const std::deque<ObjectData> & object_history);
   Maneuver predictObjectManeuverByLatDiffDistance(
     const TrackedObject & object, const LaneletData & current_lanelet_data,
-    const double object_detected_time);
+    const double object_detected_time, const std::deque<ObjectData> & object_history);
 
   // NOTE: This function is copied from the motion_velocity_smoother package.
   // TODO(someone): Consolidate functions and move them to a common
@@ -0,0 +1,111 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MAP_BASED_PREDICTION__WORKER_POOL_HPP_
+#define MAP_BASED_PREDICTION__WORKER_POOL_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace map_based_prediction
+{
+/**
+ * @brief fixed-size pool of worker threads executing jobs in FIFO order
+ * @details the threads are created once in the constructor so that the per-frame work of
+ * the prediction does not pay for thread creation.
+ */
+class WorkerPool
+{
+public:
+  explicit WorkerPool(const size_t num_threads)
+  {
+    const size_t num_workers = std::max<size_t>(num_threads, 1);
+    workers_.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+      workers_.emplace_back(&WorkerPool::workerThread, this);
+    }
+  }
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool & operator=(const WorkerPool &) = delete;
+
+  ~WorkerPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      should_terminate_ = true;
+    }
+    condition_.notify_all();
+    for (auto & worker : workers_) {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+  }
+
+  size_t size() const { return workers_.size(); }
+
+  /**
+   * @brief queue a job and return the future of its result
+   */
+  template <class F>
+  std::future<std::invoke_result_t<F>> enqueue(F && job)
+  {
+    using ResultT = std::invoke_result_t<F>;
+    auto task = std::make_shared<std::packaged_task<ResultT()>>(std::forward<F>(job));
+    std::future<ResultT> result = task->get_future();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.emplace([task]() { (*task)(); });
+    }
+    condition_.notify_one();
+    return result;
+  }
+
+private:
+  void workerThread()
+  {
+    while (true) {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return !jobs_.empty() || should_terminate_; });
+        if (should_terminate_ && jobs_.empty()) {
+          return;
+        }
+        job = std::move(jobs_.front());
+        jobs_.pop();
+      }
+      job();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::queue<std::function<void()>> jobs_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool should_terminate_{false};
+};
+}  // namespace map_based_prediction
+
+#endif  // MAP_BASED_PREDICTION__WORKER_POOL_HPP_
@@ -0,0 +1,157 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "map_based_prediction/lanelet_query_cache.hpp"
+
+#include <lanelet2_extension/utility/message_conversion.hpp>
+#include <lanelet2_extension/utility/utilities.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+namespace map_based_prediction
+{
+namespace bgi = boost::geometry::index;
+using tier4_autoware_utils::Point2d;
+using tier4_autoware_utils::Segment2d;
+
+void LaneletQueryCache::build(const lanelet::LaneletMapPtr & lanelet_map_ptr)
+{
+  clear();
+
+  std::vector<SegmentValue> segments;
+  for (const auto & lanelet : lanelet_map_ptr->laneletLayer) {
+    const auto centerline = lanelet.centerline2d();
+    if (centerline.size() < 2) {
+      continue;
+    }
+    for (std::size_t i = 1; i < centerline.size(); ++i) {
+      const auto & p0 = centerline[i - 1].basicPoint();
+      const auto & p1 = centerline[i].basicPoint();
+      segments.emplace_back(
+        Segment2d{Point2d{p0.x(), p0.y()}, Point2d{p1.x(), p1.y()}},
+        SegmentData{lanelet.id(), i - 1, p1.x() - p0.x(), p1.y() - p0.y()});
+    }
+    segment_nums_.emplace(lanelet.id(), centerline.size() - 1);
+  }
+  // packing algorithm of the R-tree
+  segment_rtree_ = SegmentRtree(segments.begin(), segments.end());
+}
+
+void LaneletQueryCache::clear()
+{
+  segment_rtree_.clear();
+  segment_nums_.clear();
+  centerlines_.clear();
+  possible_paths_.clear();
+}
+
+bool LaneletQueryCache::isIndexed(const lanelet::ConstLanelet & lanelet) const
+{
+  return segment_nums_.count(lanelet.id()) != 0;
+}
+
+double LaneletQueryCache::getLaneletAngle(
+  const lanelet::ConstLanelet & lanelet, const geometry_msgs::msg::Point & search_point) const
+{
+  if (!isIndexed(lanelet)) {
+    return lanelet::utils::getLaneletAngle(lanelet, search_point);
+  }
+
+  // a point closest to a vertex is as close to the both segments sharing it, and
+  // lanelet::utils::getLaneletAngle() takes the first one of them along the lanelet
+  const Point2d point{search_point.x, search_point.y};
+  const auto lanelet_id = lanelet.id();
+  std::vector<SegmentValue> nearest_segments;
+  const auto is_on_lanelet = [lanelet_id](const SegmentValue & value) {
+    return value.second.lanelet_id == lanelet_id;
+  };
+  segment_rtree_.query(
+    bgi::satisfies(is_on_lanelet) && bgi::nearest(point, 2), std::back_inserter(nearest_segments));
+
+  const bool inverted = lanelet.inverted();
+  const SegmentData * closest_segment = nullptr;
+  double min_distance = std::numeric_limits<double>::max();
+  for (const auto & [segment, data] : nearest_segments) {
+    const double distance = boost::geometry::distance(segment, point);
+    const bool is_earlier = closest_segment && (inverted ? data.index > closest_segment->index
+                                                         : data.index < closest_segment->index);
+    if (distance < min_distance || (distance == min_distance && is_earlier)) {
+      min_distance = distance;
+      closest_segment = &data;
+    }
+  }
+  if (!closest_segment) {
+    return lanelet::utils::getLaneletAngle(lanelet, search_point);
+  }
+  return inverted ? std::atan2(-closest_segment->dy, -closest_segment->dx)
+                  : std::atan2(closest_segment->dy, closest_segment->dx);
+}
+
+std::vector<geometry_msgs::msg::Point> LaneletQueryCache::getCenterline(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  const auto key = std::make_pair(lanelet.id(), lanelet.inverted());
+  if (isIndexed(lanelet)) {
+    std::lock_guard<std::mutex> lock(memo_mutex_);
+    const auto itr = centerlines_.find(key);
+    if (itr != centerlines_.end()) {
+      return itr->second;
+    }
+  }
+
+  std::vector<geometry_msgs::msg::Point> centerline;
+  centerline.reserve(lanelet.centerline().size());
+  for (const auto & p : lanelet.centerline()) {
+    centerline.push_back(lanelet::utils::conversion::toGeomMsgPt(p));
+  }
+  if (isIndexed(lanelet)) {
+    std::lock_guard<std::mutex> lock(memo_mutex_);
+    centerlines_.emplace(key, centerline);
+  }
+  return centerline;
+}
+
+lanelet::routing::LaneletPaths LaneletQueryCache::getPossiblePaths(
+  const lanelet::routing::RoutingGraphPtr & routing_graph_ptr,
+  const lanelet::ConstLanelet & lanelet, const double search_distance)
+{
+  const auto distance_step =
+    static_cast<int64_t>(std::ceil(search_distance / possible_paths_distance_resolution));
+  const lanelet::routing::PossiblePathsParams possible_params{
+    distance_step * possible_paths_distance_resolution, {}, 0, false, true};
+
+  const auto key = std::make_tuple(lanelet.id(), lanelet.inverted(), distance_step);
+  if (isIndexed(lanelet)) {
+    std::lock_guard<std::mutex> lock(memo_mutex_);
+    const auto itr = possible_paths_.find(key);
+    if (itr != possible_paths_.end()) {
+      return itr->second;
+    }
+  }
+
+  auto possible_paths = routing_graph_ptr->possiblePaths(lanelet, possible_params);
+  if (isIndexed(lanelet)) {
+    std::lock_guard<std::mutex> lock(memo_mutex_);
+    if (possible_paths_.size() >= max_possible_paths_num) {
+      possible_paths_.clear();
+    }
+    possible_paths_.emplace(key, possible_paths);
+  }
+  return possible_paths;
+}
+}  // namespace map_based_prediction
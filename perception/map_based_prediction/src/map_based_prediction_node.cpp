@@ -16,6 +16,7 @@
 
 #include <interpolation/linear_interpolation.hpp>
 #include <lanelet2_extension/utility/message_conversion.hpp>
+#include <lanelet2_map_cache/lanelet2_map_cache.hpp>
 #include <lanelet2_extension/utility/query.hpp>
 #include <lanelet2_extension/utility/utilities.hpp>
 #include <motion_utils/resample/resample.hpp>
@@ -45,9 +46,11 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <functional>
+#include <future>
 #include <limits>
 
 namespace map_based_prediction
@@ -848,6 +851,11 @@ MapBasedPredictionNode::MapBasedPredictionNode(const rclcpp::NodeOptions & node_
   path_generator_->setUseVehicleAcceleration(use_vehicle_acceleration_);
   path_generator_->setAccelerationHalfLife(acceleration_exponential_half_life_);
 
+  const auto num_threads = declare_parameter<int>("num_threads");
+  if (num_threads > 1) {
+    worker_pool_ = std::make_unique<WorkerPool>(static_cast<size_t>(num_threads));
+  }
+
   sub_objects_ = this->create_subscription<TrackedObjects>(
     "~/input/objects", 1,
     std::bind(&MapBasedPredictionNode::objectsCallback, this, std::placeholders::_1));
@@ -922,9 +930,10 @@ PredictedObject MapBasedPredictionNode::convertToPredictedObject(
 void MapBasedPredictionNode::mapCallback(const HADMapBin::ConstSharedPtr msg)
 {
   RCLCPP_DEBUG(get_logger(), "[Map Based Prediction]: Start loading lanelet");
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(
-    *msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
+  const auto map = lanelet2_map_cache::fromBinMsg(*msg);
+  lanelet_map_ptr_ = map.lanelet_map_ptr;
+  traffic_rules_ptr_ = map.traffic_rules_ptr;
+  routing_graph_ptr_ = map.routing_graph_ptr;
   RCLCPP_DEBUG(get_logger(), "[Map Based Prediction]: Map is loaded");
 
   const auto all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
@@ -932,6 +941,8 @@ void MapBasedPredictionNode::mapCallback(const HADMapBin::ConstSharedPtr msg)
   const auto walkways = lanelet::utils::query::walkwayLanelets(all_lanelets);
   crosswalks_.insert(crosswalks_.end(), crosswalks.begin(), crosswalks.end());
   crosswalks_.insert(crosswalks_.end(), walkways.begin(), walkways.end());
+
+  lanelet_query_cache_.build(lanelet_map_ptr_);
 }
 
 void MapBasedPredictionNode::trafficSignalsCallback(const TrafficSignalArray::ConstSharedPtr msg)
@@ -989,6 +1000,8 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
   output.header.frame_id = "map";
 
   // result debug
+  // NOTE: the markers are built only when subscribed
+  const bool publish_debug_markers = pub_debug_markers_->get_subscription_count() > 0;
   visualization_msgs::msg::MarkerArray debug_markers;
 
   // get current crosswalk users for later prediction
@@ -1005,9 +1018,14 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
   }
   std::unordered_set<std::string> predicted_crosswalk_users_ids;
 
-  for (const auto & object : in_objects->objects) {
-    std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-    TrackedObject transformed_object = object;
+  // move the states of the objects out of the histories so that the objects are predicted
+  // independently of each other
+  std::vector<ObjectPredictionSlot> slots(in_objects->objects.size());
+  for (size_t i = 0; i < in_objects->objects.size(); ++i) {
+    const auto & object = in_objects->objects.at(i);
+    auto & slot = slots.at(i);
+    slot.object_id = tier4_autoware_utils::toHexString(object.object_id);
+    slot.object = object;
 
     // transform object frame if it's based on map frame
     if (in_objects->header.frame_id != "map") {
@@ -1015,25 +1033,28 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
       geometry_msgs::msg::PoseStamped pose_orig;
       pose_orig.pose = object.kinematics.pose_with_covariance.pose;
       tf2::doTransform(pose_orig, pose_in_map, *world2map_transform);
-      transformed_object.kinematics.pose_with_covariance.pose = pose_in_map.pose;
+      slot.object.kinematics.pose_with_covariance.pose = pose_in_map.pose;
     }
 
     // get tracking label and update it for the prediction
-    const auto & label_ = transformed_object.classification.front().label;
-    const auto label = changeLabelForPrediction(label_, object, lanelet_map_ptr_);
+    const auto & label_ = slot.object.classification.front().label;
+    slot.label = changeLabelForPrediction(label_, object, lanelet_map_ptr_);
 
-    switch (label) {
+    switch (slot.label) {
       case ObjectClassification::PEDESTRIAN:
       case ObjectClassification::BICYCLE: {
-        std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
+        std::string object_id = slot.object_id;
         if (match_lost_and_appeared_crosswalk_users_) {
           object_id = tryMatchNewObjectToDisappeared(object_id, current_crosswalk_users);
         }
         predicted_crosswalk_users_ids.insert(object_id);
-        updateCrosswalkUserHistory(output.header, transformed_object, object_id);
-        const auto predicted_object_crosswalk =
-          getPredictedObjectAsCrosswalkUser(transformed_object);
-        output.objects.push_back(predicted_object_crosswalk);
+        updateCrosswalkUserHistory(output.header, slot.object, object_id);
+
+        const auto stopped_times_itr = stopped_times_against_green_.find(slot.object_id);
+        if (stopped_times_itr != stopped_times_against_green_.end()) {
+          slot.stopped_times_against_green = std::move(stopped_times_itr->second);
+          stopped_times_against_green_.erase(stopped_times_itr);
+        }
         break;
       }
       case ObjectClassification::CAR:
@@ -1041,160 +1062,36 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
       case ObjectClassification::TRAILER:
       case ObjectClassification::MOTORCYCLE:
       case ObjectClassification::TRUCK: {
-        // Update object yaw and velocity
-        updateObjectData(transformed_object);
-
-        // Get Closest Lanelet
-        const auto current_lanelets = getCurrentLanelets(transformed_object);
-
-        // Update Objects History
-        updateRoadUsersHistory(output.header, transformed_object, current_lanelets);
-
-        // For off lane obstacles
-        if (current_lanelets.empty()) {
-          PredictedPath predicted_path = path_generator_->generatePathForOffLaneVehicle(
-            transformed_object, prediction_time_horizon_.vehicle);
-          predicted_path.confidence = 1.0;
-          if (predicted_path.path.empty()) break;
-
-          auto predicted_object_vehicle = convertToPredictedObject(transformed_object);
-          predicted_object_vehicle.kinematics.predicted_paths.push_back(predicted_path);
-          output.objects.push_back(predicted_object_vehicle);
-          break;
-        }
-
-        // For too-slow vehicle
-        const double abs_obj_speed = std::hypot(
-          transformed_object.kinematics.twist_with_covariance.twist.linear.x,
-          transformed_object.kinematics.twist_with_covariance.twist.linear.y);
-        if (std::fabs(abs_obj_speed) < min_velocity_for_map_based_prediction_) {
-          PredictedPath predicted_path = path_generator_->generatePathForLowSpeedVehicle(
-            transformed_object, prediction_time_horizon_.vehicle);
-          predicted_path.confidence = 1.0;
-          if (predicted_path.path.empty()) break;
-
-          auto predicted_slow_object = convertToPredictedObject(transformed_object);
-          predicted_slow_object.kinematics.predicted_paths.push_back(predicted_path);
-          output.objects.push_back(predicted_slow_object);
-          break;
-        }
-
-        // Get Predicted Reference Path for Each Maneuver and current lanelets
-        // return: <probability, paths>
-        const auto ref_paths = getPredictedReferencePath(
-          transformed_object, current_lanelets, objects_detected_time,
-          prediction_time_horizon_.vehicle);
-
-        // If predicted reference path is empty, assume this object is out of the lane
-        if (ref_paths.empty()) {
-          PredictedPath predicted_path = path_generator_->generatePathForLowSpeedVehicle(
-            transformed_object, prediction_time_horizon_.vehicle);
-          predicted_path.confidence = 1.0;
-          if (predicted_path.path.empty()) break;
-
-          auto predicted_object_out_of_lane = convertToPredictedObject(transformed_object);
-          predicted_object_out_of_lane.kinematics.predicted_paths.push_back(predicted_path);
-          output.objects.push_back(predicted_object_out_of_lane);
-          break;
-        }
-
-        // Get Debug Marker for On Lane Vehicles
-        const auto max_prob_path = std::max_element(
-          ref_paths.begin(), ref_paths.end(),
-          [](const PredictedRefPath & a, const PredictedRefPath & b) {
-            return a.probability < b.probability;
-          });
-        const auto debug_marker =
-          getDebugMarker(object, max_prob_path->maneuver, debug_markers.markers.size());
-        debug_markers.markers.push_back(debug_marker);
-
-        // Fix object angle if its orientation unreliable (e.g. far object by radar sensor)
-        // This prevent bending predicted path
-        TrackedObject yaw_fixed_transformed_object = transformed_object;
-        if (
-          transformed_object.kinematics.orientation_availability ==
-          autoware_auto_perception_msgs::msg::TrackedObjectKinematics::UNAVAILABLE) {
-          replaceObjectYawWithLaneletsYaw(current_lanelets, yaw_fixed_transformed_object);
-        }
-        // Generate Predicted Path
-        std::vector<PredictedPath> predicted_paths;
-        double min_avg_curvature = std::numeric_limits<double>::max();
-        PredictedPath path_with_smallest_avg_curvature;
-
-        for (const auto & ref_path : ref_paths) {
-          PredictedPath predicted_path = path_generator_->generatePathForOnLaneVehicle(
-            yaw_fixed_transformed_object, ref_path.path, prediction_time_horizon_.vehicle,
-            lateral_control_time_horizon_, ref_path.speed_limit);
-          if (predicted_path.path.empty()) continue;
-
-          if (!check_lateral_acceleration_constraints_) {
-            predicted_path.confidence = ref_path.probability;
-            predicted_paths.push_back(predicted_path);
-            continue;
-          }
-
-          // Check lat. acceleration constraints
-          const auto trajectory_with_const_velocity =
-            toTrajectoryPoints(predicted_path, abs_obj_speed);
-
-          if (isLateralAccelerationConstraintSatisfied(
-                trajectory_with_const_velocity, prediction_sampling_time_interval_)) {
-            predicted_path.confidence = ref_path.probability;
-            predicted_paths.push_back(predicted_path);
-            continue;
-          }
-
-          // Calculate curvature assuming the trajectory points interval is constant
-          // In case all paths are deleted, a copy of the straightest path is kept
-
-          constexpr double curvature_calculation_distance = 2.0;
-          constexpr double points_interval = 1.0;
-          const size_t idx_dist = static_cast<size_t>(
-            std::max(static_cast<int>((curvature_calculation_distance) / points_interval), 1));
-          const auto curvature_v =
-            calcTrajectoryCurvatureFrom3Points(trajectory_with_const_velocity, idx_dist);
-          if (curvature_v.empty()) {
-            continue;
-          }
-          const auto curvature_avg =
-            std::accumulate(curvature_v.begin(), curvature_v.end(), 0.0) / curvature_v.size();
-          if (curvature_avg < min_avg_curvature) {
-            min_avg_curvature = curvature_avg;
-            path_with_smallest_avg_curvature = predicted_path;
-            path_with_smallest_avg_curvature.confidence = ref_path.probability;
-          }
-        }
-
-        if (predicted_paths.empty()) predicted_paths.push_back(path_with_smallest_avg_curvature);
-        // Normalize Path Confidence and output the predicted object
-
-        float sum_confidence = 0.0;
-        for (const auto & predicted_path : predicted_paths) {
-          sum_confidence += predicted_path.confidence;
+        const auto history_itr = road_users_history.find(slot.object_id);
+        if (history_itr != road_users_history.end()) {
+          slot.road_user_history = std::move(history_itr->second);
+          road_users_history.erase(history_itr);
         }
-        const float min_sum_confidence_value = 1e-3;
-        sum_confidence = std::max(sum_confidence, min_sum_confidence_value);
-
-        auto predicted_object = convertToPredictedObject(transformed_object);
-
-        for (auto & predicted_path : predicted_paths) {
-          predicted_path.confidence = predicted_path.confidence / sum_confidence;
-          if (predicted_object.kinematics.predicted_paths.size() >= 100) break;
-          predicted_object.kinematics.predicted_paths.push_back(predicted_path);
-        }
-        output.objects.push_back(predicted_object);
         break;
       }
-      default: {
-        auto predicted_unknown_object = convertToPredictedObject(transformed_object);
-        PredictedPath predicted_path = path_generator_->generatePathForNonVehicleObject(
-          transformed_object, prediction_time_horizon_.unknown);
-        predicted_path.confidence = 1.0;
-
-        predicted_unknown_object.kinematics.predicted_paths.push_back(predicted_path);
-        output.objects.push_back(predicted_unknown_object);
+      default:
         break;
-      }
+    }
+  }
+
+  predictObjects(slots, output.header, objects_detected_time);
+
+  // commit the results and the states in the input order
+  for (size_t i = 0; i < slots.size(); ++i) {
+    auto & slot = slots.at(i);
+    if (!slot.road_user_history.empty()) {
+      road_users_history[slot.object_id] = std::move(slot.road_user_history);
+    }
+    if (!slot.stopped_times_against_green.empty()) {
+      stopped_times_against_green_[slot.object_id] = std::move(slot.stopped_times_against_green);
+    }
+    if (publish_debug_markers && slot.debug_maneuver) {
+      const auto debug_marker = getDebugMarker(
+        in_objects->objects.at(i), *slot.debug_maneuver, debug_markers.markers.size());
+      debug_markers.markers.push_back(debug_marker);
+    }
+    if (slot.predicted_object) {
+      output.objects.push_back(std::move(*slot.predicted_object));
     }
   }
 
@@ -1204,8 +1101,14 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
       // get a predicted path for crosswalk users in history who didn't get path yet using latest
       // message
       if (predicted_crosswalk_users_ids.count(id) == 0) {
+        const auto & tracked_object = crosswalk_user.back().tracked_object;
+        const std::string object_id = tier4_autoware_utils::toHexString(tracked_object.object_id);
+        auto & stopped_times_against_green = stopped_times_against_green_[object_id];
         const auto predicted_object =
-          getPredictedObjectAsCrosswalkUser(crosswalk_user.back().tracked_object);
+          getPredictedObjectAsCrosswalkUser(tracked_object, stopped_times_against_green);
+        if (stopped_times_against_green.empty()) {
+          stopped_times_against_green_.erase(object_id);
+        }
         output.objects.push_back(predicted_object);
       }
     }
@@ -1214,7 +1117,9 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
   // Publish Results
   pub_objects_->publish(output);
   published_time_publisher_->publish_if_subscribed(pub_objects_, output.header.stamp);
-  pub_debug_markers_->publish(debug_markers);
+  if (publish_debug_markers) {
+    pub_debug_markers_->publish(debug_markers);
+  }
   const auto processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
   const auto cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
   processing_time_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
@@ -1223,6 +1128,210 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
     "debug/processing_time_ms", processing_time_ms);
 }
 
+void MapBasedPredictionNode::predictObjects(
+  std::vector<ObjectPredictionSlot> & slots, const std_msgs::msg::Header & header,
+  const double objects_detected_time)
+{
+  if (!worker_pool_ || slots.size() < 2) {
+    for (auto & slot : slots) {
+      predictObject(slot, header, objects_detected_time);
+    }
+    return;
+  }
+
+  // the workers take the objects one by one since their costs differ by far
+  std::atomic<size_t> next_slot_index{0};
+  const auto predict_slots = [&]() {
+    for (size_t i = next_slot_index++; i < slots.size(); i = next_slot_index++) {
+      predictObject(slots.at(i), header, objects_detected_time);
+    }
+  };
+  std::vector<std::future<void>> results;
+  results.reserve(worker_pool_->size());
+  for (size_t i = 0; i < std::min(worker_pool_->size(), slots.size()); ++i) {
+    results.push_back(worker_pool_->enqueue(predict_slots));
+  }
+  // wait for all the workers before rethrowing an exception since they refer to the slots
+  for (auto & result : results) {
+    result.wait();
+  }
+  for (auto & result : results) {
+    result.get();
+  }
+}
+
+void MapBasedPredictionNode::predictObject(
+  ObjectPredictionSlot & slot, const std_msgs::msg::Header & header,
+  const double objects_detected_time)
+{
+  auto & transformed_object = slot.object;
+  switch (slot.label) {
+    case ObjectClassification::PEDESTRIAN:
+    case ObjectClassification::BICYCLE: {
+      slot.predicted_object = getPredictedObjectAsCrosswalkUser(
+        transformed_object, slot.stopped_times_against_green);
+      break;
+    }
+    case ObjectClassification::CAR:
+    case ObjectClassification::BUS:
+    case ObjectClassification::TRAILER:
+    case ObjectClassification::MOTORCYCLE:
+    case ObjectClassification::TRUCK: {
+      // Update object yaw and velocity
+      updateObjectData(transformed_object);
+
+      // Get Closest Lanelet
+      const auto current_lanelets = getCurrentLanelets(transformed_object, slot.road_user_history);
+
+      // Update Objects History
+      updateRoadUsersHistory(header, transformed_object, current_lanelets, slot.road_user_history);
+
+      // For off lane obstacles
+      if (current_lanelets.empty()) {
+        PredictedPath predicted_path = path_generator_->generatePathForOffLaneVehicle(
+          transformed_object, prediction_time_horizon_.vehicle);
+        predicted_path.confidence = 1.0;
+        if (predicted_path.path.empty()) break;
+
+        auto predicted_object_vehicle = convertToPredictedObject(transformed_object);
+        predicted_object_vehicle.kinematics.predicted_paths.push_back(predicted_path);
+        slot.predicted_object = std::move(predicted_object_vehicle);
+        break;
+      }
+
+      // For too-slow vehicle
+      const double abs_obj_speed = std::hypot(
+        transformed_object.kinematics.twist_with_covariance.twist.linear.x,
+        transformed_object.kinematics.twist_with_covariance.twist.linear.y);
+      if (std::fabs(abs_obj_speed) < min_velocity_for_map_based_prediction_) {
+        PredictedPath predicted_path = path_generator_->generatePathForLowSpeedVehicle(
+          transformed_object, prediction_time_horizon_.vehicle);
+        predicted_path.confidence = 1.0;
+        if (predicted_path.path.empty()) break;
+
+        auto predicted_slow_object = convertToPredictedObject(transformed_object);
+        predicted_slow_object.kinematics.predicted_paths.push_back(predicted_path);
+        slot.predicted_object = std::move(predicted_slow_object);
+        break;
+      }
+
+      // Get Predicted Reference Path for Each Maneuver and current lanelets
+      // return: <probability, paths>
+      const auto ref_paths = getPredictedReferencePath(
+        transformed_object, current_lanelets, objects_detected_time,
+        prediction_time_horizon_.vehicle, slot.road_user_history);
+
+      // If predicted reference path is empty, assume this object is out of the lane
+      if (ref_paths.empty()) {
+        PredictedPath predicted_path = path_generator_->generatePathForLowSpeedVehicle(
+          transformed_object, prediction_time_horizon_.vehicle);
+        predicted_path.confidence = 1.0;
+        if (predicted_path.path.empty()) break;
+
+        auto predicted_object_out_of_lane = convertToPredictedObject(transformed_object);
+        predicted_object_out_of_lane.kinematics.predicted_paths.push_back(predicted_path);
+        slot.predicted_object = std::move(predicted_object_out_of_lane);
+        break;
+      }
+
+      // Get Debug Marker for On Lane Vehicles
+      const auto max_prob_path = std::max_element(
+        ref_paths.begin(), ref_paths.end(),
+        [](const PredictedRefPath & a, const PredictedRefPath & b) {
+          return a.probability < b.probability;
+        });
+      slot.debug_maneuver = max_prob_path->maneuver;
+
+      // Fix object angle if its orientation unreliable (e.g. far object by radar sensor)
+      // This prevent bending predicted path
+      TrackedObject yaw_fixed_transformed_object = transformed_object;
+      if (
+        transformed_object.kinematics.orientation_availability ==
+        autoware_auto_perception_msgs::msg::TrackedObjectKinematics::UNAVAILABLE) {
+        replaceObjectYawWithLaneletsYaw(current_lanelets, yaw_fixed_transformed_object);
+      }
+      // Generate Predicted Path
+      std::vector<PredictedPath> predicted_paths;
+      double min_avg_curvature = std::numeric_limits<double>::max();
+      PredictedPath path_with_smallest_avg_curvature;
+
+      for (const auto & ref_path : ref_paths) {
+        PredictedPath predicted_path = path_generator_->generatePathForOnLaneVehicle(
+          yaw_fixed_transformed_object, ref_path.path, prediction_time_horizon_.vehicle,
+          lateral_control_time_horizon_, ref_path.speed_limit);
+        if (predicted_path.path.empty()) continue;
+
+        if (!check_lateral_acceleration_constraints_) {
+          predicted_path.confidence = ref_path.probability;
+          predicted_paths.push_back(predicted_path);
+          continue;
+        }
+
+        // Check lat. acceleration constraints
+        const auto trajectory_with_const_velocity =
+          toTrajectoryPoints(predicted_path, abs_obj_speed);
+
+        if (isLateralAccelerationConstraintSatisfied(
+              trajectory_with_const_velocity, prediction_sampling_time_interval_)) {
+          predicted_path.confidence = ref_path.probability;
+          predicted_paths.push_back(predicted_path);
+          continue;
+        }
+
+        // Calculate curvature assuming the trajectory points interval is constant
+        // In case all paths are deleted, a copy of the straightest path is kept
+
+        constexpr double curvature_calculation_distance = 2.0;
+        constexpr double points_interval = 1.0;
+        const size_t idx_dist = static_cast<size_t>(
+          std::max(static_cast<int>((curvature_calculation_distance) / points_interval), 1));
+        const auto curvature_v =
+          calcTrajectoryCurvatureFrom3Points(trajectory_with_const_velocity, idx_dist);
+        if (curvature_v.empty()) {
+          continue;
+        }
+        const auto curvature_avg =
+          std::accumulate(curvature_v.begin(), curvature_v.end(), 0.0) / curvature_v.size();
+        if (curvature_avg < min_avg_curvature) {
+          min_avg_curvature = curvature_avg;
+          path_with_smallest_avg_curvature = predicted_path;
+          path_with_smallest_avg_curvature.confidence = ref_path.probability;
+        }
+      }
+
+      if (predicted_paths.empty()) predicted_paths.push_back(path_with_smallest_avg_curvature);
+      // Normalize Path Confidence and output the predicted object
+
+      float sum_confidence = 0.0;
+      for (const auto & predicted_path : predicted_paths) {
+        sum_confidence += predicted_path.confidence;
+      }
+      const float min_sum_confidence_value = 1e-3;
+      sum_confidence = std::max(sum_confidence, min_sum_confidence_value);
+
+      auto predicted_object = convertToPredictedObject(transformed_object);
+
+      for (auto & predicted_path : predicted_paths) {
+        predicted_path.confidence = predicted_path.confidence / sum_confidence;
+        if (predicted_object.kinematics.predicted_paths.size() >= 100) break;
+        predicted_object.kinematics.predicted_paths.push_back(predicted_path);
+      }
+      slot.predicted_object = std::move(predicted_object);
+      break;
+    }
+    default: {
+      auto predicted_unknown_object = convertToPredictedObject(transformed_object);
+      PredictedPath predicted_path = path_generator_->generatePathForNonVehicleObject(
+        transformed_object, prediction_time_horizon_.unknown);
+      predicted_path.confidence = 1.0;
+
+      predicted_unknown_object.kinematics.predicted_paths.push_back(predicted_path);
+      slot.predicted_object = std::move(predicted_unknown_object);
+      break;
+    }
+  }
+}
+
 void MapBasedPredictionNode::updateCrosswalkUserHistory(
   const std_msgs::msg::Header & header, const TrackedObject & object, const std::string & object_id)
 {
@@ -1337,7 +1446,7 @@ bool MapBasedPredictionNode::isIntersecting(
 }
 
 PredictedObject MapBasedPredictionNode::getPredictedObjectAsCrosswalkUser(
-  const TrackedObject & object)
+  const TrackedObject & object, StoppedTimesAgainstGreen & stopped_times_against_green)
 {
   auto predicted_object = convertToPredictedObject(object);
   {
@@ -1418,7 +1527,7 @@ PredictedObject MapBasedPredictionNode::getPredictedObjectAsCrosswalkUser(
     const auto crosswalk_signal_id_opt = getTrafficSignalId(crosswalk);
     if (crosswalk_signal_id_opt.has_value() && use_crosswalk_signal_) {
       if (!calcIntentionToCrossWithTrafficSignal(
-            object, crosswalk, crosswalk_signal_id_opt.value())) {
+            object, crosswalk, crosswalk_signal_id_opt.value(), stopped_times_against_green)) {
         continue;
       }
     }
@@ -1524,7 +1633,7 @@ void MapBasedPredictionNode::removeStaleTrafficLightInfo(
     const bool isDisappeared = std::none_of(
       in_objects->objects.begin(), in_objects->objects.end(),
       [&it](autoware_auto_perception_msgs::msg::TrackedObject obj) {
-        return tier4_autoware_utils::toHexString(obj.object_id) == it->first.first;
+        return tier4_autoware_utils::toHexString(obj.object_id) == it->first;
       });
     if (isDisappeared) {
       it = stopped_times_against_green_.erase(it);
@@ -1534,7 +1643,8 @@ void MapBasedPredictionNode::removeStaleTrafficLightInfo(
   }
 }
 
-LaneletsData MapBasedPredictionNode::getCurrentLanelets(const TrackedObject & object)
+LaneletsData MapBasedPredictionNode::getCurrentLanelets(
+  const TrackedObject & object, const std::deque<ObjectData> & object_history)
 {
   // obstacle point
   lanelet::BasicPoint2d search_point(
@@ -1556,7 +1666,9 @@ LaneletsData MapBasedPredictionNode::getCurrentLanelets(const TrackedObject & ob
     for (const auto & lanelet : surrounding_lanelets) {
       // Check if the close lanelets meet the necessary condition for start lanelets and
       // Check if similar lanelet is inside the object lanelet
-      if (!checkCloseLaneletCondition(lanelet, object) || isDuplicated(lanelet, object_lanelets)) {
+      if (
+        !checkCloseLaneletCondition(lanelet, object, object_history) ||
+        isDuplicated(lanelet, object_lanelets)) {
         continue;
       }
 
@@ -1604,7 +1716,7 @@ LaneletsData MapBasedPredictionNode::getCurrentLanelets(const TrackedObject & ob
     for (const auto & lanelet : surrounding_opposite_lanelets) {
       // Check if the close lanelets meet the necessary condition for start lanelets
       // except for distance checking
-      if (!checkCloseLaneletCondition(lanelet, object)) {
+      if (!checkCloseLaneletCondition(lanelet, object, object_history)) {
         continue;
       }
 
@@ -1624,7 +1736,8 @@ LaneletsData MapBasedPredictionNode::getCurrentLanelets(const TrackedObject & ob
 }
 
 bool MapBasedPredictionNode::checkCloseLaneletCondition(
-  const std::pair<double, lanelet::Lanelet> & lanelet, const TrackedObject & object)
+  const std::pair<double, lanelet::Lanelet> & lanelet, const TrackedObject & object,
+  const std::deque<ObjectData> & object_history)
 {
   // Step1. If we only have one point in the centerline, we will ignore the lanelet
   if (lanelet.second.centerline().size() <= 1) {
@@ -1633,10 +1746,9 @@ bool MapBasedPredictionNode::checkCloseLaneletCondition(
 
   // If the object is in the objects history, we check if the target lanelet is
   // inside the current lanelets id or following lanelets
-  const std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-  if (road_users_history.count(object_id) != 0) {
+  if (!object_history.empty()) {
     const std::vector<lanelet::ConstLanelet> & possible_lanelet =
-      road_users_history.at(object_id).back().future_possible_lanelets;
+      object_history.back().future_possible_lanelets;
 
     bool not_in_possible_lanelet =
       std::find(possible_lanelet.begin(), possible_lanelet.end(), lanelet.second) ==
@@ -1648,7 +1760,7 @@ bool MapBasedPredictionNode::checkCloseLaneletCondition(
 
   // Step2. Calculate the angle difference between the lane angle and obstacle angle
   const double object_yaw = tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation);
-  const double lane_yaw = lanelet::utils::getLaneletAngle(
+  const double lane_yaw = lanelet_query_cache_.getLaneletAngle(
     lanelet.second, object.kinematics.pose_with_covariance.pose.position);
   const double delta_yaw = object_yaw - lane_yaw;
   const double normalized_delta_yaw = tier4_autoware_utils::normalizeRadian(delta_yaw);
@@ -1676,17 +1788,12 @@ float MapBasedPredictionNode::calculateLocalLikelihood(
 
   // compute yaw difference between the object and lane
   const double obj_yaw = tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation);
-  const double lane_yaw = lanelet::utils::getLaneletAngle(current_lanelet, obj_point);
+  const double lane_yaw = lanelet_query_cache_.getLaneletAngle(current_lanelet, obj_point);
   const double delta_yaw = obj_yaw - lane_yaw;
   const double abs_norm_delta_yaw = std::fabs(tier4_autoware_utils::normalizeRadian(delta_yaw));
 
   // compute lateral distance
-  const auto centerline = current_lanelet.centerline();
-  std::vector<geometry_msgs::msg::Point> converted_centerline;
-  for (const auto & p : centerline) {
-    const auto converted_p = lanelet::utils::conversion::toGeomMsgPt(p);
-    converted_centerline.push_back(converted_p);
-  }
+  const auto converted_centerline = lanelet_query_cache_.getCenterline(current_lanelet);
   const double lat_dist =
     std::fabs(motion_utils::calcLateralOffset(converted_centerline, obj_point));
 
@@ -1705,9 +1812,8 @@ float MapBasedPredictionNode::calculateLocalLikelihood(
 
 void MapBasedPredictionNode::updateRoadUsersHistory(
   const std_msgs::msg::Header & header, const TrackedObject & object,
-  const LaneletsData & current_lanelets_data)
+  const LaneletsData & current_lanelets_data, std::deque<ObjectData> & object_history)
 {
-  std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
   const auto current_lanelets = getLanelets(current_lanelets_data);
 
   ObjectData single_object_data;
@@ -1727,25 +1833,20 @@ void MapBasedPredictionNode::updateRoadUsersHistory(
     single_object_data.lateral_kinematics_set[current_lane] = lateral_kinematics;
   }
 
-  if (road_users_history.count(object_id) == 0) {
-    // New Object(Create a new object in object histories)
-    std::deque<ObjectData> object_data = {single_object_data};
-    road_users_history.emplace(object_id, object_data);
-  } else {
+  if (!object_history.empty()) {
     // Object that is already in the object buffer
-    std::deque<ObjectData> & object_data = road_users_history.at(object_id);
     // get previous object data and update
-    const auto prev_object_data = object_data.back();
+    const auto & prev_object_data = object_history.back();
     updateLateralKinematicsVector(
       prev_object_data, single_object_data, routing_graph_ptr_, cutoff_freq_of_velocity_lpf_);
-
-    object_data.push_back(single_object_data);
   }
+  object_history.push_back(single_object_data);
 }
 
 std::vector<PredictedRefPath> MapBasedPredictionNode::getPredictedReferencePath(
   const TrackedObject & object, const LaneletsData & current_lanelets_data,
-  const double object_detected_time, const double time_horizon)
+  const double object_detected_time, const double time_horizon,
+  std::deque<ObjectData> & object_history)
 {
   const double obj_vel = std::hypot(
     object.kinematics.twist_with_covariance.twist.linear.x,
@@ -1805,7 +1906,6 @@ std::vector<PredictedRefPath> MapBasedPredictionNode::getPredictedReferencePath(
                            : get_search_distance_with_decaying_acc();
     search_dist += lanelet::utils::getLaneletLength3d(current_lanelet_data.lanelet);
 
-    lanelet::routing::PossiblePathsParams possible_params{search_dist, {}, 0, false, true};
     const double validate_time_horizon =
       t_h * prediction_time_horizon_rate_for_validate_lane_length_;
 
@@ -1814,7 +1914,7 @@ std::vector<PredictedRefPath> MapBasedPredictionNode::getPredictedReferencePath(
     auto getPathsForNormalOrIsolatedLanelet = [&](const lanelet::ConstLanelet & lanelet) {
       // if lanelet is not isolated, return normal possible paths
       if (!isIsolatedLanelet(lanelet, routing_graph_ptr_)) {
-        return routing_graph_ptr_->possiblePaths(lanelet, possible_params);
+        return lanelet_query_cache_.getPossiblePaths(routing_graph_ptr_, lanelet, search_dist);
       }
       // if lanelet is isolated, check if it has enough length
       if (!validateIsolatedLaneletLength(lanelet, object, validate_time_horizon)) {
@@ -1880,7 +1980,7 @@ std::vector<PredictedRefPath> MapBasedPredictionNode::getPredictedReferencePath(
 
     // Step2. Predict Object Maneuver
     const Maneuver predicted_maneuver =
-      predictObjectManeuver(object, current_lanelet_data, object_detected_time);
+      predictObjectManeuver(object, current_lanelet_data, object_detected_time, object_history);
 
     // Step3. Allocate probability for each predicted maneuver
     const auto maneuver_prob =
@@ -1890,7 +1990,8 @@ std::vector<PredictedRefPath> MapBasedPredictionNode::getPredictedReferencePath(
     const float path_prob = current_lanelet_data.probability;
     const auto addReferencePathsLocal = [&](const auto & paths, const auto & maneuver) {
       addReferencePaths(
-        object, paths, path_prob, maneuver_prob, maneuver, all_ref_paths, final_speed_limit);
+        paths, path_prob, maneuver_prob, maneuver, all_ref_paths, object_history,
+        final_speed_limit);
     };
     addReferencePathsLocal(left_paths, Maneuver::LEFT_LANE_CHANGE);
     addReferencePathsLocal(right_paths, Maneuver::RIGHT_LANE_CHANGE);
@@ -1906,25 +2007,24 @@ std::vector<PredictedRefPath> MapBasedPredictionNode::getPredictedReferencePath(
  */
 Maneuver MapBasedPredictionNode::predictObjectManeuver(
   const TrackedObject & object, const LaneletData & current_lanelet_data,
-  const double object_detected_time)
+  const double object_detected_time, std::deque<ObjectData> & object_history)
 {
   // calculate maneuver
   const auto current_maneuver = [&]() {
     if (lane_change_detection_method_ == "time_to_change_lane") {
       return predictObjectManeuverByTimeToLaneChange(
-        object, current_lanelet_data, object_detected_time);
+        object, current_lanelet_data, object_detected_time, object_history);
     } else if (lane_change_detection_method_ == "lat_diff_distance") {
       return predictObjectManeuverByLatDiffDistance(
-        object, current_lanelet_data, object_detected_time);
+        object, current_lanelet_data, object_detected_time, object_history);
     }
     throw std::logic_error("Lane change detection method is invalid.");
   }();
 
-  const std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-  if (road_users_history.count(object_id) == 0) {
+  if (object_history.empty()) {
     return current_maneuver;
   }
-  auto & object_info = road_users_history.at(object_id);
+  auto & object_info = object_history;
 
   // update maneuver in object history
   if (!object_info.empty()) {
@@ -1956,15 +2056,14 @@ Maneuver MapBasedPredictionNode::predictObjectManeuver(
 
 Maneuver MapBasedPredictionNode::predictObjectManeuverByTimeToLaneChange(
   const TrackedObject & object, const LaneletData & current_lanelet_data,
-  const double /*object_detected_time*/)
+  const double /*object_detected_time*/, const std::deque<ObjectData> & object_history)
 {
   // Step1. Check if we have the object in the buffer
-  const std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-  if (road_users_history.count(object_id) == 0) {
+  if (object_history.empty()) {
     return Maneuver::LANE_FOLLOW;
   }
 
-  const std::deque<ObjectData> & object_info = road_users_history.at(object_id);
+  const std::deque<ObjectData> & object_info = object_history;
 
   // Step2. Check if object history length longer than history_time_length
   const int latest_id = static_cast<int>(object_info.size()) - 1;
@@ -2027,15 +2126,14 @@ Maneuver MapBasedPredictionNode::predictObjectManeuverByTimeToLaneChange(
 
 Maneuver MapBasedPredictionNode::predictObjectManeuverByLatDiffDistance(
   const TrackedObject & object, const LaneletData & current_lanelet_data,
-  const double /*object_detected_time*/)
+  const double /*object_detected_time*/, const std::deque<ObjectData> & object_history)
 {
   // Step1. Check if we have the object in the buffer
-  const std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-  if (road_users_history.count(object_id) == 0) {
+  if (object_history.empty()) {
     return Maneuver::LANE_FOLLOW;
   }
 
-  const std::deque<ObjectData> & object_info = road_users_history.at(object_id);
+  const std::deque<ObjectData> & object_info = object_history;
   const double current_time = (this->get_clock()->now()).seconds();
 
   // Step2. Get the previous id
@@ -2189,15 +2287,14 @@ double MapBasedPredictionNode::calcLeftLateralOffset(
 }
 
 void MapBasedPredictionNode::updateFuturePossibleLanelets(
-  const TrackedObject & object, const lanelet::routing::LaneletPaths & paths)
+  const lanelet::routing::LaneletPaths & paths, std::deque<ObjectData> & object_history)
 {
-  std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-  if (road_users_history.count(object_id) == 0) {
+  if (object_history.empty()) {
     return;
   }
 
   std::vector<lanelet::ConstLanelet> & possible_lanelets =
-    road_users_history.at(object_id).back().future_possible_lanelets;
+    object_history.back().future_possible_lanelets;
   for (const auto & path : paths) {
     for (const auto & lanelet : path) {
       bool not_in_buffer = std::find(possible_lanelets.begin(), possible_lanelets.end(), lanelet) ==
@@ -2210,13 +2307,13 @@ void MapBasedPredictionNode::updateFuturePossibleLanelets(
 }
 
 void MapBasedPredictionNode::addReferencePaths(
-  const TrackedObject & object, const lanelet::routing::LaneletPaths & candidate_paths,
-  const float path_probability, const ManeuverProbability & maneuver_probability,
-  const Maneuver & maneuver, std::vector<PredictedRefPath> & reference_paths,
+  const lanelet::routing::LaneletPaths & candidate_paths, const float path_probability,
+  const ManeuverProbability & maneuver_probability, const Maneuver & maneuver,
+  std::vector<PredictedRefPath> & reference_paths, std::deque<ObjectData> & object_history,
   const double speed_limit)
 {
   if (!candidate_paths.empty()) {
-    updateFuturePossibleLanelets(object, candidate_paths);
+    updateFuturePossibleLanelets(candidate_paths, object_history);
     const auto converted_paths = convertPathType(candidate_paths);
     for (const auto & converted_path : converted_paths) {
       PredictedRefPath predicted_path;
@@ -2431,19 +2528,18 @@ std::optional<TrafficSignalElement> MapBasedPredictionNode::getTrafficSignalElem
 
 bool MapBasedPredictionNode::calcIntentionToCrossWithTrafficSignal(
   const TrackedObject & object, const lanelet::ConstLanelet & crosswalk,
-  const lanelet::Id & signal_id)
+  const lanelet::Id & signal_id, StoppedTimesAgainstGreen & stopped_times_against_green)
 {
   const auto signal_color = [&] {
     const auto elem_opt = getTrafficSignalElement(signal_id);
     return elem_opt ? elem_opt.value().color : TrafficSignalElement::UNKNOWN;
   }();
 
-  const auto key = std::make_pair(tier4_autoware_utils::toHexString(object.object_id), signal_id);
   if (
     signal_color == TrafficSignalElement::GREEN &&
     tier4_autoware_utils::calcNorm(object.kinematics.twist_with_covariance.twist.linear) <
       threshold_velocity_assumed_as_stopping_) {
-    stopped_times_against_green_.try_emplace(key, this->get_clock()->now());
+    stopped_times_against_green.try_emplace(signal_id, this->get_clock()->now());
 
     const auto timeout_no_intention_to_walk = [&]() {
       auto InterpolateMap = [](
@@ -2475,13 +2571,13 @@ bool MapBasedPredictionNode::calcIntentionToCrossWithTrafficSignal(
     }();
 
     if (
-      (this->get_clock()->now() - stopped_times_against_green_.at(key)).seconds() >
+      (this->get_clock()->now() - stopped_times_against_green.at(signal_id)).seconds() >
       timeout_no_intention_to_walk) {
       return false;
     }
 
   } else {
-    stopped_times_against_green_.erase(key);
+    stopped_times_against_green.erase(signal_id);
     // If the pedestrian disappears, another function erases the old data.
   }
 
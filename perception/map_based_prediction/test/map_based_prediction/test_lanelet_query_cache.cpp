@@ -0,0 +1,97 @@
+// Copyright 2024 TIER IV, inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "map_based_prediction/lanelet_query_cache.hpp"
+
+#include <lanelet2_extension/utility/message_conversion.hpp>
+#include <lanelet2_extension/utility/utilities.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/utility/Utilities.h>
+
+#include <cmath>
+#include <memory>
+
+using map_based_prediction::LaneletQueryCache;
+
+namespace
+{
+// a lane of 3.0m width turning left along a quarter circle of 20m radius
+lanelet::Lanelet createCurvedLanelet()
+{
+  lanelet::LineString3d left_bound(lanelet::utils::getId());
+  lanelet::LineString3d right_bound(lanelet::utils::getId());
+  constexpr int points_num = 10;
+  for (int i = 0; i <= points_num; ++i) {
+    const double theta = M_PI_2 * i / points_num;
+    left_bound.push_back(lanelet::Point3d(
+      lanelet::utils::getId(), 18.5 * std::sin(theta), 20.0 - 18.5 * std::cos(theta), 0.0));
+    right_bound.push_back(lanelet::Point3d(
+      lanelet::utils::getId(), 21.5 * std::sin(theta), 20.0 - 21.5 * std::cos(theta), 0.0));
+  }
+  return lanelet::Lanelet(lanelet::utils::getId(), left_bound, right_bound);
+}
+
+geometry_msgs::msg::Point createPoint(const double x, const double y)
+{
+  geometry_msgs::msg::Point point;
+  point.x = x;
+  point.y = y;
+  return point;
+}
+}  // namespace
+
+TEST(LaneletQueryCache, getLaneletAngle)
+{
+  const auto lanelet = createCurvedLanelet();
+  const lanelet::LaneletMapPtr lanelet_map_ptr = lanelet::utils::createMap({lanelet});
+  LaneletQueryCache cache;
+  cache.build(lanelet_map_ptr);
+
+  const lanelet::ConstLanelet const_lanelet = lanelet;
+  // around the lane, including the points beside its both ends
+  for (double x = -5.0; x <= 25.0; x += 0.5) {
+    for (double y = -5.0; y <= 25.0; y += 0.5) {
+      if (std::hypot(x, y - 20.0) < 15.0) {
+        continue;
+      }
+      const auto point = createPoint(x, y);
+      EXPECT_DOUBLE_EQ(
+        lanelet::utils::getLaneletAngle(const_lanelet, point),
+        cache.getLaneletAngle(const_lanelet, point));
+      EXPECT_DOUBLE_EQ(
+        lanelet::utils::getLaneletAngle(const_lanelet.invert(), point),
+        cache.getLaneletAngle(const_lanelet.invert(), point));
+    }
+  }
+}
+
+TEST(LaneletQueryCache, getCenterline)
+{
+  const auto lanelet = createCurvedLanelet();
+  const lanelet::LaneletMapPtr lanelet_map_ptr = lanelet::utils::createMap({lanelet});
+  LaneletQueryCache cache;
+  cache.build(lanelet_map_ptr);
+
+  const lanelet::ConstLanelet const_lanelet = lanelet;
+  for (const auto & target : {const_lanelet, const_lanelet.invert()}) {
+    const auto centerline = cache.getCenterline(target);
+    ASSERT_EQ(target.centerline().size(), centerline.size());
+    for (std::size_t i = 0; i < centerline.size(); ++i) {
+      const auto expected = lanelet::utils::conversion::toGeomMsgPt(target.centerline()[i]);
+      EXPECT_DOUBLE_EQ(expected.x, centerline[i].x);
+      EXPECT_DOUBLE_EQ(expected.y, centerline[i].y);
+    }
+  }
+}
@@ -19,7 +19,6 @@
 #ifndef MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__DATA_ASSOCIATION_HPP_
 #define MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__DATA_ASSOCIATION_HPP_
 
-#include <list>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -30,11 +29,16 @@
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
+#include <Eigen/SparseCore>
 
 #include <autoware_auto_perception_msgs/msg/detected_objects.hpp>
 
 class DataAssociation
 {
+public:
+  // row : tracker, col : measurement, only the pairs passing all the gates are stored
+  using ScoreMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
 private:
   Eigen::MatrixXi can_assign_matrix_;
   Eigen::MatrixXd max_dist_matrix_;
@@ -42,6 +46,8 @@ private:
   Eigen::MatrixXd min_area_matrix_;
   Eigen::MatrixXd max_rad_matrix_;
   Eigen::MatrixXd min_iou_matrix_;
+  // largest distance gate of the assignable labels, the cell size of the spatial pre-gate
+  double max_dist_;
   const double score_threshold_;
   std::unique_ptr<gnn_solver::GnnSolverInterface> gnn_solver_ptr_;
 
@@ -52,11 +58,11 @@ public:
     std::vector<double> max_area_vector, std::vector<double> min_area_vector,
     std::vector<double> max_rad_vector, std::vector<double> min_iou_vector);
   void assign(
-    const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
+    const ScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
     std::unordered_map<int, int> & reverse_assignment);
-  Eigen::MatrixXd calcScoreMatrix(
+  ScoreMatrix calcScoreMatrix(
     const autoware_auto_perception_msgs::msg::DetectedObjects & measurements,
-    const std::list<std::shared_ptr<Tracker>> & trackers);
+    const std::vector<std::shared_ptr<Tracker>> & trackers);
   virtual ~DataAssociation() {}
 };
 
@@ -85,7 +85,7 @@ public:
     channel_names_ = channel_names;
   }
   void collect(
-    const rclcpp::Time & message_time, const std::list<std::shared_ptr<Tracker>> & list_tracker,
+    const rclcpp::Time & message_time, const std::vector<std::shared_ptr<Tracker>> & list_tracker,
     const uint & channel_index,
     const autoware_auto_perception_msgs::msg::DetectedObjects & detected_objects,
     const std::unordered_map<int, int> & direct_assignment,
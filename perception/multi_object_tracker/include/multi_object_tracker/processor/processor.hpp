@@ -16,13 +16,14 @@
 #define MULTI_OBJECT_TRACKER__PROCESSOR__PROCESSOR_HPP_
 
 #include "multi_object_tracker/tracker/model/tracker_base.hpp"
+#include "multi_object_tracker/utils/worker_pool.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_auto_perception_msgs/msg/detected_objects.hpp>
 #include <autoware_auto_perception_msgs/msg/tracked_objects.hpp>
 
-#include <list>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -32,10 +33,11 @@
 class TrackerProcessor
 {
 public:
-  explicit TrackerProcessor(
-    const std::map<std::uint8_t, std::string> & tracker_map, const size_t & channel_size);
+  TrackerProcessor(
+    const std::map<std::uint8_t, std::string> & tracker_map, const size_t & channel_size,
+    const size_t num_threads);
 
-  const std::list<std::shared_ptr<Tracker>> & getListTracker() const { return list_tracker_; }
+  const std::vector<std::shared_ptr<Tracker>> & getListTracker() const { return list_tracker_; }
   // tracker processes
   void predict(const rclcpp::Time & time);
   void update(
@@ -61,8 +63,10 @@ public:
 
 private:
   std::map<std::uint8_t, std::string> tracker_map_;
-  std::list<std::shared_ptr<Tracker>> list_tracker_;
+  std::vector<std::shared_ptr<Tracker>> list_tracker_;
   const size_t channel_size_;
+  // workers running the trackers in parallel, null to run them in the caller thread
+  std::unique_ptr<utils::WorkerPool> worker_pool_;
 
   // parameters
   float max_elapsed_time_;            // [s]
@@ -71,6 +75,7 @@ private:
   double distance_threshold_;         // [m]
   int confident_count_threshold_;     // [count]
 
+  void forEachTracker(const std::function<void(const size_t)> & process);
   void removeOldTracker(const rclcpp::Time & time);
   void removeOverlappedTracker(const rclcpp::Time & time);
   std::shared_ptr<Tracker> createNewTracker(
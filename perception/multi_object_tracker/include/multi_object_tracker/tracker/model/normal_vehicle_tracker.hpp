@@ -81,7 +81,7 @@ public:
 private:
   void setNearestCornerOrSurfaceIndex(const geometry_msgs::msg::Transform & self_transform)
   {
-    Eigen::MatrixXd X_t(DIM, 1);
+    BicycleMotionModel::StateVec X_t;
     motion_model_.getStateVector(X_t);
     last_nearest_corner_index_ = utils::getNearestCornerOrSurface(
       X_t(IDX::X), X_t(IDX::Y), X_t(IDX::YAW), bounding_box_.width, bounding_box_.length,
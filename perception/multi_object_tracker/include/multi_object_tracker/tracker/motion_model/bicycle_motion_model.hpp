@@ -22,7 +22,6 @@
 #include "multi_object_tracker/tracker/motion_model/motion_model_base.hpp"
 
 #include <Eigen/Core>
-#include <kalman_filter/kalman_filter.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -32,7 +31,7 @@
 #endif
 #include <geometry_msgs/msg/twist.hpp>
 
-class BicycleMotionModel : public MotionModel
+class BicycleMotionModel : public MotionModel<5>
 {
 private:
   // attributes
@@ -64,7 +63,6 @@ public:
   BicycleMotionModel();
 
   enum IDX { X = 0, Y = 1, YAW = 2, VEL = 3, SLIP = 4 };
-  const char DIM = 5;
 
   bool initialize(
     const rclcpp::Time & time, const double & x, const double & y, const double & yaw,
@@ -98,7 +96,7 @@ public:
 
   bool updateExtendedState(const double & length);
 
-  bool predictStateStep(const double dt, KalmanFilter & ekf) const override;
+  bool predictStateStep(const double dt, FixedSizeKalmanFilter<DIM> & ekf) const override;
 
   bool getPredictedState(
     const rclcpp::Time & time, geometry_msgs::msg::Pose & pose, std::array<double, 36> & pose_cov,
@@ -22,7 +22,6 @@
 #include "multi_object_tracker/tracker/motion_model/motion_model_base.hpp"
 
 #include <Eigen/Core>
-#include <kalman_filter/kalman_filter.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -34,7 +33,7 @@
 
 // cspell: ignore CTRV
 
-class CTRVMotionModel : public MotionModel
+class CTRVMotionModel : public MotionModel<5>
 {
 private:
   // attributes
@@ -56,7 +55,6 @@ public:
   CTRVMotionModel();
 
   enum IDX { X = 0, Y = 1, YAW = 2, VEL = 3, WZ = 4 };
-  const char DIM = 5;
 
   bool initialize(
     const rclcpp::Time & time, const double & x, const double & y, const double & yaw,
@@ -85,7 +83,7 @@ public:
 
   bool limitStates();
 
-  bool predictStateStep(const double dt, KalmanFilter & ekf) const override;
+  bool predictStateStep(const double dt, FixedSizeKalmanFilter<DIM> & ekf) const override;
 
   bool getPredictedState(
     const rclcpp::Time & time, geometry_msgs::msg::Pose & pose, std::array<double, 36> & pose_cov,
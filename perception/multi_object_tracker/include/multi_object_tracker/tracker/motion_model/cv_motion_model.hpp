@@ -22,7 +22,6 @@
 #include "multi_object_tracker/tracker/motion_model/motion_model_base.hpp"
 
 #include <Eigen/Core>
-#include <kalman_filter/kalman_filter.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -32,7 +31,7 @@
 #endif
 #include <geometry_msgs/msg/twist.hpp>
 
-class CVMotionModel : public MotionModel
+class CVMotionModel : public MotionModel<4>
 {
 private:
   // attributes
@@ -53,7 +52,6 @@ public:
   CVMotionModel();
 
   enum IDX { X = 0, Y = 1, VX = 2, VY = 3 };
-  const char DIM = 4;
 
   bool initialize(
     const rclcpp::Time & time, const double & x, const double & y,
@@ -78,7 +76,7 @@ public:
 
   bool limitStates();
 
-  bool predictStateStep(const double dt, KalmanFilter & ekf) const override;
+  bool predictStateStep(const double dt, FixedSizeKalmanFilter<DIM> & ekf) const override;
 
   bool getPredictedState(
     const rclcpp::Time & time, geometry_msgs::msg::Pose & pose, std::array<double, 36> & pose_cov,
@@ -20,7 +20,7 @@
 #define MULTI_OBJECT_TRACKER__TRACKER__MOTION_MODEL__MOTION_MODEL_BASE_HPP_
 
 #include <Eigen/Core>
-#include <kalman_filter/kalman_filter.hpp>
+#include <kalman_filter/fixed_size_kalman_filter.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -30,15 +30,25 @@
 #endif
 #include <geometry_msgs/msg/twist.hpp>
 
+/**
+ * @brief base of the motion models, whose state of StateDim elements is estimated by a fixed-size
+ * extended kalman filter
+ */
+template <int StateDim>
 class MotionModel
 {
+public:
+  static constexpr int DIM = StateDim;
+  using StateVec = Eigen::Matrix<double, StateDim, 1>;
+  using StateMat = Eigen::Matrix<double, StateDim, StateDim>;
+
 private:
   bool is_initialized_{false};
   double dt_max_{0.11};  // [s] maximum time interval for prediction
 
 protected:
   rclcpp::Time last_update_time_;
-  KalmanFilter ekf_;
+  FixedSizeKalmanFilter<StateDim> ekf_;
 
 public:
   MotionModel();
@@ -51,14 +61,14 @@ public:
   }
   void setMaxDeltaTime(const double dt_max) { dt_max_ = dt_max; }
   double getStateElement(unsigned int idx) const { return ekf_.getXelement(idx); }
-  void getStateVector(Eigen::MatrixXd & X) const { ekf_.getX(X); }
+  void getStateVector(StateVec & X) const { ekf_.getX(X); }
 
-  bool initialize(const rclcpp::Time & time, const Eigen::MatrixXd & X, const Eigen::MatrixXd & P);
+  bool initialize(const rclcpp::Time & time, const StateVec & X, const StateMat & P);
 
   bool predictState(const rclcpp::Time & time);
-  bool getPredictedState(const rclcpp::Time & time, Eigen::MatrixXd & X, Eigen::MatrixXd & P) const;
+  bool getPredictedState(const rclcpp::Time & time, StateVec & X, StateMat & P) const;
 
-  virtual bool predictStateStep(const double dt, KalmanFilter & ekf) const = 0;
+  virtual bool predictStateStep(const double dt, FixedSizeKalmanFilter<StateDim> & ekf) const = 0;
   virtual bool getPredictedState(
     const rclcpp::Time & time, geometry_msgs::msg::Pose & pose, std::array<double, 36> & pose_cov,
     geometry_msgs::msg::Twist & twist, std::array<double, 36> & twist_cov) const = 0;
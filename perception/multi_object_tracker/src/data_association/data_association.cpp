@@ -19,7 +19,8 @@
 #include "object_recognition_utils/object_recognition_utils.hpp"
 
 #include <algorithm>
-#include <list>
+#include <cmath>
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -28,14 +29,15 @@ namespace
 {
 double getMahalanobisDistance(
   const geometry_msgs::msg::Point & measurement, const geometry_msgs::msg::Point & tracker,
-  const Eigen::Matrix2d & covariance)
+  const Eigen::Matrix2d & inverse_covariance)
 {
   Eigen::Vector2d measurement_point;
   measurement_point << measurement.x, measurement.y;
   Eigen::Vector2d tracker_point;
   tracker_point << tracker.x, tracker.y;
-  Eigen::MatrixXd mahalanobis_squared = (measurement_point - tracker_point).transpose() *
-                                        covariance.inverse() * (measurement_point - tracker_point);
+  const Eigen::Matrix<double, 1, 1> mahalanobis_squared =
+    (measurement_point - tracker_point).transpose() * inverse_covariance *
+    (measurement_point - tracker_point);
   return std::sqrt(mahalanobis_squared(0));
 }
 
@@ -72,7 +74,7 @@ DataAssociation::DataAssociation(
   std::vector<int> can_assign_vector, std::vector<double> max_dist_vector,
   std::vector<double> max_area_vector, std::vector<double> min_area_vector,
   std::vector<double> max_rad_vector, std::vector<double> min_iou_vector)
-: score_threshold_(0.01)
+: max_dist_(0.0), score_threshold_(0.01)
 {
   {
     const int assign_label_num = static_cast<int>(std::sqrt(can_assign_vector.size()));
@@ -111,25 +113,34 @@ DataAssociation::DataAssociation(
     min_iou_matrix_ = min_iou_matrix_tmp.transpose();
   }
 
+  for (int tracker_label = 0; tracker_label < can_assign_matrix_.rows(); ++tracker_label) {
+    for (int measurement_label = 0; measurement_label < can_assign_matrix_.cols();
+         ++measurement_label) {
+      if (can_assign_matrix_(tracker_label, measurement_label)) {
+        max_dist_ = std::max(max_dist_, max_dist_matrix_(tracker_label, measurement_label));
+      }
+    }
+  }
+
   gnn_solver_ptr_ = std::make_unique<gnn_solver::MuSSP>();
 }
 
 void DataAssociation::assign(
-  const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
+  const ScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
   std::unordered_map<int, int> & reverse_assignment)
 {
-  std::vector<std::vector<double>> score(src.rows());
-  for (int row = 0; row < src.rows(); ++row) {
-    score.at(row).resize(src.cols());
-    for (int col = 0; col < src.cols(); ++col) {
-      score.at(row).at(col) = src(row, col);
+  // the solver takes a dense matrix, where the pairs not passing the gates score zero
+  std::vector<std::vector<double>> score(src.rows(), std::vector<double>(src.cols(), 0.0));
+  for (int row = 0; row < src.outerSize(); ++row) {
+    for (ScoreMatrix::InnerIterator itr(src, row); itr; ++itr) {
+      score.at(row).at(itr.col()) = itr.value();
     }
   }
   // Solve
   gnn_solver_ptr_->maximizeLinearAssignment(score, &direct_assignment, &reverse_assignment);
 
   for (auto itr = direct_assignment.begin(); itr != direct_assignment.end();) {
-    if (src(itr->first, itr->second) < score_threshold_) {
+    if (src.coeff(itr->first, itr->second) < score_threshold_) {
       itr = direct_assignment.erase(itr);
       continue;
     } else {
@@ -137,7 +148,7 @@ void DataAssociation::assign(
     }
   }
   for (auto itr = reverse_assignment.begin(); itr != reverse_assignment.end();) {
-    if (src(itr->second, itr->first) < score_threshold_) {
+    if (src.coeff(itr->second, itr->first) < score_threshold_) {
       itr = reverse_assignment.erase(itr);
       continue;
     } else {
@@ -146,81 +157,102 @@ void DataAssociation::assign(
   }
 }
 
-Eigen::MatrixXd DataAssociation::calcScoreMatrix(
+DataAssociation::ScoreMatrix DataAssociation::calcScoreMatrix(
   const autoware_auto_perception_msgs::msg::DetectedObjects & measurements,
-  const std::list<std::shared_ptr<Tracker>> & trackers)
+  const std::vector<std::shared_ptr<Tracker>> & trackers)
 {
-  Eigen::MatrixXd score_matrix =
-    Eigen::MatrixXd::Zero(trackers.size(), measurements.objects.size());
+  // trackers at the time of the measurements, hashed in the grid for the spatial pre-gate
+  const size_t tracker_num = trackers.size();
+  std::vector<std::uint8_t> tracker_labels(tracker_num);
+  std::vector<autoware_auto_perception_msgs::msg::TrackedObject> tracked_objects(tracker_num);
+  std::vector<Eigen::Matrix2d> tracker_inverse_covariances(tracker_num);
+  object_recognition_utils::SpatialGrid tracker_grid(std::max(max_dist_, 1e-3));
   size_t tracker_idx = 0;
   for (auto tracker_itr = trackers.begin(); tracker_itr != trackers.end();
        ++tracker_itr, ++tracker_idx) {
-    const std::uint8_t tracker_label = (*tracker_itr)->getHighestProbLabel();
+    auto & tracked_object = tracked_objects.at(tracker_idx);
+    tracker_labels.at(tracker_idx) = (*tracker_itr)->getHighestProbLabel();
+    (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
+    tracker_inverse_covariances.at(tracker_idx) =
+      getXYCovariance(tracked_object.kinematics.pose_with_covariance).inverse();
 
-    for (size_t measurement_idx = 0; measurement_idx < measurements.objects.size();
-         ++measurement_idx) {
-      const autoware_auto_perception_msgs::msg::DetectedObject & measurement_object =
-        measurements.objects.at(measurement_idx);
-      const std::uint8_t measurement_label =
-        object_recognition_utils::getHighestProbLabel(measurement_object.classification);
+    tracker_grid.insert(tracked_object.kinematics.pose_with_covariance.pose.position, tracker_idx);
+  }
 
-      double score = 0.0;
-      if (can_assign_matrix_(tracker_label, measurement_label)) {
-        autoware_auto_perception_msgs::msg::TrackedObject tracked_object;
-        (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
-
-        const double max_dist = max_dist_matrix_(tracker_label, measurement_label);
-        const double dist = tier4_autoware_utils::calcDistance2d(
-          measurement_object.kinematics.pose_with_covariance.pose.position,
-          tracked_object.kinematics.pose_with_covariance.pose.position);
-
-        bool passed_gate = true;
-        // dist gate
-        if (passed_gate) {
-          if (max_dist < dist) passed_gate = false;
-        }
-        // area gate
-        if (passed_gate) {
-          const double max_area = max_area_matrix_(tracker_label, measurement_label);
-          const double min_area = min_area_matrix_(tracker_label, measurement_label);
-          const double area = tier4_autoware_utils::getArea(measurement_object.shape);
-          if (area < min_area || max_area < area) passed_gate = false;
+  std::vector<Eigen::Triplet<double>> scores;
+  for (size_t measurement_idx = 0; measurement_idx < measurements.objects.size();
+       ++measurement_idx) {
+    const autoware_auto_perception_msgs::msg::DetectedObject & measurement_object =
+      measurements.objects.at(measurement_idx);
+    const auto & measurement_position =
+      measurement_object.kinematics.pose_with_covariance.pose.position;
+    const std::uint8_t measurement_label =
+      object_recognition_utils::getHighestProbLabel(measurement_object.classification);
+    const double area = tier4_autoware_utils::getArea(measurement_object.shape);
+
+    // the trackers out of the neighbor cells are farther than any distance gate
+    tracker_grid.forEachNeighbor(measurement_position, [&](const size_t tracker_idx) {
+      const std::uint8_t tracker_label = tracker_labels.at(tracker_idx);
+      if (!can_assign_matrix_(tracker_label, measurement_label)) {
+        return;
+      }
+      const auto & tracked_object = tracked_objects.at(tracker_idx);
+
+      const double max_dist = max_dist_matrix_(tracker_label, measurement_label);
+      const double dist = tier4_autoware_utils::calcDistance2d(
+        measurement_position, tracked_object.kinematics.pose_with_covariance.pose.position);
+      // dist gate
+      if (max_dist < dist) {
+        return;
+      }
+      // area gate
+      {
+        const double max_area = max_area_matrix_(tracker_label, measurement_label);
+        const double min_area = min_area_matrix_(tracker_label, measurement_label);
+        if (area < min_area || max_area < area) {
+          return;
         }
-        // angle gate
-        if (passed_gate) {
-          const double max_rad = max_rad_matrix_(tracker_label, measurement_label);
-          const double angle = getFormedYawAngle(
-            measurement_object.kinematics.pose_with_covariance.pose.orientation,
-            tracked_object.kinematics.pose_with_covariance.pose.orientation, false);
-          if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle))
-            passed_gate = false;
+      }
+      // angle gate
+      {
+        const double max_rad = max_rad_matrix_(tracker_label, measurement_label);
+        const double angle = getFormedYawAngle(
+          measurement_object.kinematics.pose_with_covariance.pose.orientation,
+          tracked_object.kinematics.pose_with_covariance.pose.orientation, false);
+        if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle)) {
+          return;
         }
-        // mahalanobis dist gate
-        if (passed_gate) {
-          const double mahalanobis_dist = getMahalanobisDistance(
-            measurement_object.kinematics.pose_with_covariance.pose.position,
-            tracked_object.kinematics.pose_with_covariance.pose.position,
-            getXYCovariance(tracked_object.kinematics.pose_with_covariance));
-          if (3.035 /*99%*/ <= mahalanobis_dist) passed_gate = false;
+      }
+      // mahalanobis dist gate
+      {
+        const double mahalanobis_dist = getMahalanobisDistance(
+          measurement_position, tracked_object.kinematics.pose_with_covariance.pose.position,
+          tracker_inverse_covariances.at(tracker_idx));
+        if (3.035 /*99%*/ <= mahalanobis_dist) {
+          return;
         }
-        // 2d iou gate
-        if (passed_gate) {
-          const double min_iou = min_iou_matrix_(tracker_label, measurement_label);
-          const double min_union_iou_area = 1e-2;
-          const double iou = object_recognition_utils::get2dIoU(
-            measurement_object, tracked_object, min_union_iou_area);
-          if (iou < min_iou) passed_gate = false;
+      }
+      // 2d iou gate
+      {
+        const double min_iou = min_iou_matrix_(tracker_label, measurement_label);
+        const double min_union_iou_area = 1e-2;
+        const double iou = object_recognition_utils::get2dIoU(
+          measurement_object, tracked_object, min_union_iou_area);
+        if (iou < min_iou) {
+          return;
         }
+      }
 
-        // all gate is passed
-        if (passed_gate) {
-          score = (max_dist - std::min(dist, max_dist)) / max_dist;
-          if (score < score_threshold_) score = 0.0;
-        }
+      // all gate is passed
+      const double score = (max_dist - std::min(dist, max_dist)) / max_dist;
+      if (score_threshold_ <= score) {
+        scores.emplace_back(
+          static_cast<int>(tracker_idx), static_cast<int>(measurement_idx), score);
       }
-      score_matrix(tracker_idx, measurement_idx) = score;
-    }
+    });
   }
 
+  ScoreMatrix score_matrix(tracker_num, measurements.objects.size());
+  score_matrix.setFromTriplets(scores.begin(), scores.end());
   return score_matrix;
 }
@@ -73,7 +73,7 @@ void TrackerObjectDebugger::reset()
 }
 
 void TrackerObjectDebugger::collect(
-  const rclcpp::Time & message_time, const std::list<std::shared_ptr<Tracker>> & list_tracker,
+  const rclcpp::Time & message_time, const std::vector<std::shared_ptr<Tracker>> & list_tracker,
   const uint & channel_index,
   const autoware_auto_perception_msgs::msg::DetectedObjects & detected_objects,
   const std::unordered_map<int, int> & direct_assignment,
@@ -20,6 +20,7 @@
 #include <tf2_ros/create_timer_interface.h>
 #include <tf2_ros/create_timer_ros.h>
 
+#include <algorithm>
 #include <iterator>
 #include <list>
 #include <memory>
@@ -178,7 +179,9 @@ MultiObjectTracker::MultiObjectTracker(const rclcpp::NodeOptions & node_options)
     tracker_map.insert(std::make_pair(
       Label::MOTORCYCLE, this->declare_parameter<std::string>("motorcycle_tracker")));
 
-    processor_ = std::make_unique<TrackerProcessor>(tracker_map, input_channel_size_);
+    const auto num_threads = this->declare_parameter<int>("num_threads");
+    processor_ = std::make_unique<TrackerProcessor>(
+      tracker_map, input_channel_size_, static_cast<size_t>(std::max(num_threads, 1)));
   }
 
   // Data association initialization
@@ -293,7 +296,7 @@ void MultiObjectTracker::runProcess(
     const auto & list_tracker = processor_->getListTracker();
     const auto & detected_objects = transformed_objects;
     // global nearest neighbor
-    Eigen::MatrixXd score_matrix = data_association_->calcScoreMatrix(
+    const auto score_matrix = data_association_->calcScoreMatrix(
       detected_objects, list_tracker);  // row : tracker, col : measurement
     data_association_->assign(score_matrix, direct_assignment, reverse_assignment);
 
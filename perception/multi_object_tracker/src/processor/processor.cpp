@@ -19,14 +19,21 @@
 
 #include <autoware_auto_perception_msgs/msg/tracked_objects.hpp>
 
+#include <algorithm>
+#include <future>
 #include <iterator>
 
 using Label = autoware_auto_perception_msgs::msg::ObjectClassification;
 
 TrackerProcessor::TrackerProcessor(
-  const std::map<std::uint8_t, std::string> & tracker_map, const size_t & channel_size)
+  const std::map<std::uint8_t, std::string> & tracker_map, const size_t & channel_size,
+  const size_t num_threads)
 : tracker_map_(tracker_map), channel_size_(channel_size)
 {
+  if (num_threads > 1) {
+    worker_pool_ = std::make_unique<utils::WorkerPool>(num_threads);
+  }
+
   // Set tracker lifetime parameters
   max_elapsed_time_ = 1.0;  // [s]
 
@@ -39,31 +46,59 @@ TrackerProcessor::TrackerProcessor(
   confident_count_threshold_ = 3;  // [count]
 }
 
-void TrackerProcessor::predict(const rclcpp::Time & time)
+void TrackerProcessor::forEachTracker(const std::function<void(const size_t)> & process)
 {
-  for (auto itr = list_tracker_.begin(); itr != list_tracker_.end(); ++itr) {
-    (*itr)->predict(time);
+  const size_t tracker_num = list_tracker_.size();
+  if (!worker_pool_ || tracker_num < 2) {
+    for (size_t tracker_idx = 0; tracker_idx < tracker_num; ++tracker_idx) {
+      process(tracker_idx);
+    }
+    return;
+  }
+
+  // each worker processes a contiguous range of the trackers, which are independent of each other
+  const size_t job_num = std::min(worker_pool_->size(), tracker_num);
+  std::vector<std::future<void>> results;
+  results.reserve(job_num);
+  for (size_t job_idx = 0; job_idx < job_num; ++job_idx) {
+    const size_t begin = tracker_num * job_idx / job_num;
+    const size_t end = tracker_num * (job_idx + 1) / job_num;
+    results.push_back(worker_pool_->enqueue([&process, begin, end]() {
+      for (size_t tracker_idx = begin; tracker_idx < end; ++tracker_idx) {
+        process(tracker_idx);
+      }
+    }));
+  }
+  // wait for all the workers before rethrowing an exception since they refer to the trackers
+  for (auto & result : results) {
+    result.wait();
+  }
+  for (auto & result : results) {
+    result.get();
   }
 }
 
+void TrackerProcessor::predict(const rclcpp::Time & time)
+{
+  forEachTracker([&](const size_t tracker_idx) { list_tracker_.at(tracker_idx)->predict(time); });
+}
+
 void TrackerProcessor::update(
   const autoware_auto_perception_msgs::msg::DetectedObjects & detected_objects,
   const geometry_msgs::msg::Transform & self_transform,
   const std::unordered_map<int, int> & direct_assignment, const uint & channel_index)
 {
-  int tracker_idx = 0;
   const auto & time = detected_objects.header.stamp;
-  for (auto tracker_itr = list_tracker_.begin(); tracker_itr != list_tracker_.end();
-       ++tracker_itr, ++tracker_idx) {
-    if (direct_assignment.find(tracker_idx) != direct_assignment.end()) {  // found
-      const auto & associated_object =
-        detected_objects.objects.at(direct_assignment.find(tracker_idx)->second);
-      (*(tracker_itr))
-        ->updateWithMeasurement(associated_object, time, self_transform, channel_index);
+  forEachTracker([&](const size_t tracker_idx) {
+    const auto & tracker = list_tracker_.at(tracker_idx);
+    const auto assignment = direct_assignment.find(static_cast<int>(tracker_idx));
+    if (assignment != direct_assignment.end()) {  // found
+      const auto & associated_object = detected_objects.objects.at(assignment->second);
+      tracker->updateWithMeasurement(associated_object, time, self_transform, channel_index);
     } else {  // not found
-      (*(tracker_itr))->updateWithoutMeasurement(time);
+      tracker->updateWithoutMeasurement(time);
     }
-  }
+  });
 }
 
 void TrackerProcessor::spawn(
@@ -126,30 +161,50 @@ void TrackerProcessor::prune(const rclcpp::Time & time)
 
 void TrackerProcessor::removeOldTracker(const rclcpp::Time & time)
 {
-  // Check elapsed time from last update
-  for (auto itr = list_tracker_.begin(); itr != list_tracker_.end(); ++itr) {
-    const bool is_old = max_elapsed_time_ < (*itr)->getElapsedTimeFromLastUpdate(time);
-    // If the tracker is old, delete it
-    if (is_old) {
-      auto erase_itr = itr;
-      --itr;
-      list_tracker_.erase(erase_itr);
-    }
-  }
+  // Check elapsed time from last update, and delete the old trackers
+  const auto is_old = [&](const std::shared_ptr<Tracker> & tracker) {
+    return max_elapsed_time_ < tracker->getElapsedTimeFromLastUpdate(time);
+  };
+  list_tracker_.erase(
+    std::remove_if(list_tracker_.begin(), list_tracker_.end(), is_old), list_tracker_.end());
 }
 
 // This function removes overlapped trackers based on distance and IoU criteria
 void TrackerProcessor::removeOverlappedTracker(const rclcpp::Time & time)
 {
+  const size_t tracker_num = list_tracker_.size();
+  std::vector<autoware_auto_perception_msgs::msg::TrackedObject> objects(tracker_num);
+  std::vector<bool> is_valid(tracker_num, false);
+  std::vector<bool> is_deleted(tracker_num, false);
+  // the trackers farther than the distance threshold from a tracker are out of its neighbor cells
+  object_recognition_utils::SpatialGrid tracker_grid(std::max(distance_threshold_, 1e-3));
+  for (size_t tracker_idx = 0; tracker_idx < tracker_num; ++tracker_idx) {
+    is_valid.at(tracker_idx) =
+      list_tracker_.at(tracker_idx)->getTrackedObject(time, objects.at(tracker_idx));
+    if (is_valid.at(tracker_idx)) {
+      tracker_grid.insert(
+        objects.at(tracker_idx).kinematics.pose_with_covariance.pose.position, tracker_idx);
+    }
+  }
+
   // Iterate through the list of trackers
-  for (auto itr1 = list_tracker_.begin(); itr1 != list_tracker_.end(); ++itr1) {
-    autoware_auto_perception_msgs::msg::TrackedObject object1;
-    if (!(*itr1)->getTrackedObject(time, object1)) continue;
+  std::vector<size_t> neighbor_indices;
+  for (size_t idx1 = 0; idx1 < tracker_num; ++idx1) {
+    if (!is_valid.at(idx1) || is_deleted.at(idx1)) continue;
+    const auto & tracker1 = list_tracker_.at(idx1);
+    const auto & object1 = objects.at(idx1);
 
-    // Compare the current tracker with the remaining trackers
-    for (auto itr2 = std::next(itr1); itr2 != list_tracker_.end(); ++itr2) {
-      autoware_auto_perception_msgs::msg::TrackedObject object2;
-      if (!(*itr2)->getTrackedObject(time, object2)) continue;
+    // Compare the current tracker with the remaining trackers, in the order of the list
+    neighbor_indices.clear();
+    tracker_grid.forEachNeighbor(
+      object1.kinematics.pose_with_covariance.pose.position, [&](const size_t idx2) {
+        if (idx1 < idx2 && !is_deleted.at(idx2)) neighbor_indices.push_back(idx2);
+      });
+    std::sort(neighbor_indices.begin(), neighbor_indices.end());
+
+    for (const size_t idx2 : neighbor_indices) {
+      const auto & tracker2 = list_tracker_.at(idx2);
+      const auto & object2 = objects.at(idx2);
 
       // Calculate the distance between the two objects
       const double distance = std::hypot(
@@ -166,8 +221,8 @@ void TrackerProcessor::removeOverlappedTracker(const rclcpp::Time & time)
       // Check the Intersection over Union (IoU) between the two objects
       const double min_union_iou_area = 1e-2;
       const auto iou = object_recognition_utils::get2dIoU(object1, object2, min_union_iou_area);
-      const auto & label1 = (*itr1)->getHighestProbLabel();
-      const auto & label2 = (*itr2)->getHighestProbLabel();
+      const auto & label1 = tracker1->getHighestProbLabel();
+      const auto & label2 = tracker2->getHighestProbLabel();
       bool should_delete_tracker1 = false;
       bool should_delete_tracker2 = false;
 
@@ -176,7 +231,7 @@ void TrackerProcessor::removeOverlappedTracker(const rclcpp::Time & time)
       if (label1 == Label::UNKNOWN || label2 == Label::UNKNOWN) {
         if (iou > min_iou_for_unknown_object_) {
           if (label1 == Label::UNKNOWN && label2 == Label::UNKNOWN) {
-            if ((*itr1)->getTotalMeasurementCount() < (*itr2)->getTotalMeasurementCount()) {
+            if (tracker1->getTotalMeasurementCount() < tracker2->getTotalMeasurementCount()) {
               should_delete_tracker1 = true;
             } else {
               should_delete_tracker2 = true;
@@ -189,7 +244,7 @@ void TrackerProcessor::removeOverlappedTracker(const rclcpp::Time & time)
         }
       } else {  // If neither object is UNKNOWN, delete the younger tracker
         if (iou > min_iou_) {
-          if ((*itr1)->getTotalMeasurementCount() < (*itr2)->getTotalMeasurementCount()) {
+          if (tracker1->getTotalMeasurementCount() < tracker2->getTotalMeasurementCount()) {
             should_delete_tracker1 = true;
           } else {
             should_delete_tracker2 = true;
@@ -199,16 +254,22 @@ void TrackerProcessor::removeOverlappedTracker(const rclcpp::Time & time)
 
       // Delete the tracker
       if (should_delete_tracker1) {
-        itr1 = list_tracker_.erase(itr1);
-        --itr1;
+        is_deleted.at(idx1) = true;
         break;
       }
       if (should_delete_tracker2) {
-        itr2 = list_tracker_.erase(itr2);
-        --itr2;
+        is_deleted.at(idx2) = true;
       }
     }
   }
+
+  // Remove the deleted trackers keeping the order of the others
+  size_t tracker_idx = 0;
+  list_tracker_.erase(
+    std::remove_if(
+      list_tracker_.begin(), list_tracker_.end(),
+      [&](const std::shared_ptr<Tracker> &) { return is_deleted.at(tracker_idx++); }),
+    list_tracker_.end());
 }
 
 bool TrackerProcessor::isConfidentTracker(const std::shared_ptr<Tracker> & tracker) const
@@ -118,13 +118,13 @@ UnknownTracker::UnknownTracker(
     }
 
     // rotate twist covariance matrix, since it is in the vehicle coordinate system
-    Eigen::MatrixXd twist_cov_rotate(2, 2);
+    Eigen::Matrix2d twist_cov_rotate;
     twist_cov_rotate(0, 0) = twist_cov[utils::MSG_COV_IDX::X_X];
     twist_cov_rotate(0, 1) = twist_cov[utils::MSG_COV_IDX::X_Y];
     twist_cov_rotate(1, 0) = twist_cov[utils::MSG_COV_IDX::Y_X];
     twist_cov_rotate(1, 1) = twist_cov[utils::MSG_COV_IDX::Y_Y];
-    Eigen::MatrixXd R_yaw = Eigen::Rotation2Dd(-yaw).toRotationMatrix();
-    Eigen::MatrixXd twist_cov_rotated = R_yaw * twist_cov_rotate * R_yaw.transpose();
+    Eigen::Matrix2d R_yaw = Eigen::Rotation2Dd(-yaw).toRotationMatrix();
+    Eigen::Matrix2d twist_cov_rotated = R_yaw * twist_cov_rotate * R_yaw.transpose();
     twist_cov[utils::MSG_COV_IDX::X_X] = twist_cov_rotated(0, 0);
     twist_cov[utils::MSG_COV_IDX::X_Y] = twist_cov_rotated(0, 1);
     twist_cov[utils::MSG_COV_IDX::Y_X] = twist_cov_rotated(1, 0);
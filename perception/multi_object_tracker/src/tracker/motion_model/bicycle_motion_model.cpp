@@ -112,11 +112,11 @@ bool BicycleMotionModel::initialize(
   const double & slip, const double & slip_cov, const double & length)
 {
   // initialize state vector X
-  Eigen::MatrixXd X(DIM, 1);
+  StateVec X;
   X << x, y, yaw, vel, slip;
 
   // initialize covariance matrix P
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(DIM, DIM);
+  StateMat P = StateMat::Zero();
   P(IDX::X, IDX::X) = pose_cov[utils::MSG_COV_IDX::X_X];
   P(IDX::Y, IDX::Y) = pose_cov[utils::MSG_COV_IDX::Y_Y];
   P(IDX::YAW, IDX::YAW) = pose_cov[utils::MSG_COV_IDX::YAW_YAW];
@@ -139,14 +139,14 @@ bool BicycleMotionModel::updateStatePose(
   constexpr int DIM_Y = 2;
 
   // update state
-  Eigen::MatrixXd Y(DIM_Y, 1);
+  Eigen::Matrix<double, DIM_Y, 1> Y;
   Y << x, y;
 
-  Eigen::MatrixXd C = Eigen::MatrixXd::Zero(DIM_Y, DIM);
+  Eigen::Matrix<double, DIM_Y, DIM> C = Eigen::Matrix<double, DIM_Y, DIM>::Zero();
   C(0, IDX::X) = 1.0;
   C(1, IDX::Y) = 1.0;
 
-  Eigen::MatrixXd R = Eigen::MatrixXd::Zero(DIM_Y, DIM_Y);
+  Eigen::Matrix<double, DIM_Y, DIM_Y> R = Eigen::Matrix<double, DIM_Y, DIM_Y>::Zero();
   R(0, 0) = pose_cov[utils::MSG_COV_IDX::X_X];
   R(0, 1) = pose_cov[utils::MSG_COV_IDX::X_Y];
   R(1, 0) = pose_cov[utils::MSG_COV_IDX::Y_X];
@@ -177,15 +177,15 @@ bool BicycleMotionModel::updateStatePoseHead(
   }
 
   // update state
-  Eigen::MatrixXd Y(DIM_Y, 1);
+  Eigen::Matrix<double, DIM_Y, 1> Y;
   Y << x, y, fixed_yaw;
 
-  Eigen::MatrixXd C = Eigen::MatrixXd::Zero(DIM_Y, DIM);
+  Eigen::Matrix<double, DIM_Y, DIM> C = Eigen::Matrix<double, DIM_Y, DIM>::Zero();
   C(0, IDX::X) = 1.0;
   C(1, IDX::Y) = 1.0;
   C(2, IDX::YAW) = 1.0;
 
-  Eigen::MatrixXd R = Eigen::MatrixXd::Zero(DIM_Y, DIM_Y);
+  Eigen::Matrix<double, DIM_Y, DIM_Y> R = Eigen::Matrix<double, DIM_Y, DIM_Y>::Zero();
   R(0, 0) = pose_cov[utils::MSG_COV_IDX::X_X];
   R(0, 1) = pose_cov[utils::MSG_COV_IDX::X_Y];
   R(1, 0) = pose_cov[utils::MSG_COV_IDX::Y_X];
@@ -222,16 +222,16 @@ bool BicycleMotionModel::updateStatePoseHeadVel(
   }
 
   // update state
-  Eigen::MatrixXd Y(DIM_Y, 1);
+  Eigen::Matrix<double, DIM_Y, 1> Y;
   Y << x, y, yaw, vel;
 
-  Eigen::MatrixXd C = Eigen::MatrixXd::Zero(DIM_Y, DIM);
+  Eigen::Matrix<double, DIM_Y, DIM> C = Eigen::Matrix<double, DIM_Y, DIM>::Zero();
   C(0, IDX::X) = 1.0;
   C(1, IDX::Y) = 1.0;
   C(2, IDX::YAW) = 1.0;
   C(3, IDX::VEL) = 1.0;
 
-  Eigen::MatrixXd R = Eigen::MatrixXd::Zero(DIM_Y, DIM_Y);
+  Eigen::Matrix<double, DIM_Y, DIM_Y> R = Eigen::Matrix<double, DIM_Y, DIM_Y>::Zero();
   R(0, 0) = pose_cov[utils::MSG_COV_IDX::X_X];
   R(0, 1) = pose_cov[utils::MSG_COV_IDX::X_Y];
   R(1, 0) = pose_cov[utils::MSG_COV_IDX::Y_X];
@@ -248,8 +248,8 @@ bool BicycleMotionModel::updateStatePoseHeadVel(
 
 bool BicycleMotionModel::limitStates()
 {
-  Eigen::MatrixXd X_t(DIM, 1);
-  Eigen::MatrixXd P_t(DIM, DIM);
+  StateVec X_t;
+  StateMat P_t;
   ekf_.getX(X_t);
   ekf_.getP(P_t);
   X_t(IDX::YAW) = tier4_autoware_utils::normalizeRadian(X_t(IDX::YAW));
@@ -277,8 +277,8 @@ bool BicycleMotionModel::adjustPosition(const double & x, const double & y)
   if (!checkInitialized()) return false;
 
   // adjust position
-  Eigen::MatrixXd X_t(DIM, 1);
-  Eigen::MatrixXd P_t(DIM, DIM);
+  StateVec X_t;
+  StateMat P_t;
   ekf_.getX(X_t);
   ekf_.getP(P_t);
   X_t(IDX::X) += x;
@@ -288,7 +288,7 @@ bool BicycleMotionModel::adjustPosition(const double & x, const double & y)
   return true;
 }
 
-bool BicycleMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) const
+bool BicycleMotionModel::predictStateStep(const double dt, FixedSizeKalmanFilter<DIM> & ekf) const
 {
   /*  Motion model: static bicycle model (constant slip angle, constant velocity)
    *
@@ -316,7 +316,7 @@ bool BicycleMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) c
    */
 
   // Current state vector X t
-  Eigen::MatrixXd X_t(DIM, 1);
+  StateVec X_t;
   ekf.getX(X_t);
 
   const double cos_yaw = std::cos(X_t(IDX::YAW) + X_t(IDX::SLIP));
@@ -331,7 +331,7 @@ bool BicycleMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) c
   const double vv_dtdt__lr = vel * vel * dt * dt / lr_;
 
   // Predict state vector X t+1
-  Eigen::MatrixXd X_next_t(DIM, 1);  // predicted state
+  StateVec X_next_t;  // predicted state
   X_next_t(IDX::X) =
     X_t(IDX::X) + vel * cos_yaw * dt - 0.5 * vel * sin_slip * w_dtdt;  // dx = v * cos(yaw) * dt
   X_next_t(IDX::Y) =
@@ -341,7 +341,7 @@ bool BicycleMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) c
   X_next_t(IDX::SLIP) = X_t(IDX::SLIP);  // slip_angle = asin(lr * w / v)
 
   // State transition matrix A
-  Eigen::MatrixXd A = Eigen::MatrixXd::Identity(DIM, DIM);
+  StateMat A = StateMat::Identity();
   A(IDX::X, IDX::YAW) = -vel * sin_yaw * dt - 0.5 * vel * cos_yaw * w_dtdt;
   A(IDX::X, IDX::VEL) = cos_yaw * dt - sin_yaw * w_dtdt;
   A(IDX::X, IDX::SLIP) =
@@ -390,7 +390,7 @@ bool BicycleMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) c
   const double q_cov_vel = std::pow(motion_params_.q_stddev_acc_long * dt, 2);
   const double q_cov_slip = q_cov_slip_rate * dt * dt;
 
-  Eigen::MatrixXd Q = Eigen::MatrixXd::Zero(DIM, DIM);
+  StateMat Q = StateMat::Zero();
   // Rotate the covariance matrix according to the vehicle yaw
   // because q_cov_x and y are in the vehicle coordinate system.
   Q(IDX::X, IDX::X) = (q_cov_x * cos_yaw * cos_yaw + q_cov_y * sin_yaw * sin_yaw);
@@ -414,8 +414,8 @@ bool BicycleMotionModel::getPredictedState(
   geometry_msgs::msg::Twist & twist, std::array<double, 36> & twist_cov) const
 {
   // get predicted state
-  Eigen::MatrixXd X(DIM, 1);
-  Eigen::MatrixXd P(DIM, DIM);
+  StateVec X;
+  StateMat P;
   if (!MotionModel::getPredictedState(time, X, P)) {
     return false;
   }
@@ -455,14 +455,14 @@ bool BicycleMotionModel::getPredictedState(
   pose_cov[utils::MSG_COV_IDX::PITCH_PITCH] = pp_cov;
 
   // set twist covariance
-  Eigen::MatrixXd cov_jacob(3, 2);
+  Eigen::Matrix<double, 3, 2> cov_jacob;
   cov_jacob << std::cos(X(IDX::SLIP)), -X(IDX::VEL) * std::sin(X(IDX::SLIP)),
     std::sin(X(IDX::SLIP)), X(IDX::VEL) * std::cos(X(IDX::SLIP)), std::sin(X(IDX::SLIP)) / lr_,
     X(IDX::VEL) * std::cos(X(IDX::SLIP)) / lr_;
-  Eigen::MatrixXd cov_twist(2, 2);
+  Eigen::Matrix2d cov_twist;
   cov_twist << P(IDX::VEL, IDX::VEL), P(IDX::VEL, IDX::SLIP), P(IDX::SLIP, IDX::VEL),
     P(IDX::SLIP, IDX::SLIP);
-  Eigen::MatrixXd twist_cov_mat = cov_jacob * cov_twist * cov_jacob.transpose();
+  Eigen::Matrix3d twist_cov_mat = cov_jacob * cov_twist * cov_jacob.transpose();
   constexpr double vz_cov = 0.1 * 0.1;  // TODO(yukkysaito) Currently tentative
   constexpr double wx_cov = 0.1 * 0.1;  // TODO(yukkysaito) Currently tentative
   constexpr double wy_cov = 0.1 * 0.1;  // TODO(yukkysaito) Currently tentative
@@ -83,11 +83,11 @@ bool CTRVMotionModel::initialize(
   const double & wz, const double & wz_cov)
 {
   // initialize state vector X
-  Eigen::MatrixXd X(DIM, 1);
+  StateVec X;
   X << x, y, yaw, vel, wz;
 
   // initialize covariance matrix P
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(DIM, DIM);
+  StateMat P = StateMat::Zero();
   P(IDX::X, IDX::X) = pose_cov[utils::MSG_COV_IDX::X_X];
   P(IDX::Y, IDX::Y) = pose_cov[utils::MSG_COV_IDX::Y_Y];
   P(IDX::YAW, IDX::YAW) = pose_cov[utils::MSG_COV_IDX::YAW_YAW];
@@ -107,14 +107,14 @@ bool CTRVMotionModel::updateStatePose(
   constexpr int DIM_Y = 2;
 
   // update state
-  Eigen::MatrixXd Y(DIM_Y, 1);
+  Eigen::Matrix<double, DIM_Y, 1> Y;
   Y << x, y;
 
-  Eigen::MatrixXd C = Eigen::MatrixXd::Zero(DIM_Y, DIM);
+  Eigen::Matrix<double, DIM_Y, DIM> C = Eigen::Matrix<double, DIM_Y, DIM>::Zero();
   C(0, IDX::X) = 1.0;
   C(1, IDX::Y) = 1.0;
 
-  Eigen::MatrixXd R = Eigen::MatrixXd::Zero(DIM_Y, DIM_Y);
+  Eigen::Matrix<double, DIM_Y, DIM_Y> R = Eigen::Matrix<double, DIM_Y, DIM_Y>::Zero();
   R(0, 0) = pose_cov[utils::MSG_COV_IDX::X_X];
   R(0, 1) = pose_cov[utils::MSG_COV_IDX::X_Y];
   R(1, 0) = pose_cov[utils::MSG_COV_IDX::Y_X];
@@ -145,15 +145,15 @@ bool CTRVMotionModel::updateStatePoseHead(
   }
 
   // update state
-  Eigen::MatrixXd Y(DIM_Y, 1);
+  Eigen::Matrix<double, DIM_Y, 1> Y;
   Y << x, y, fixed_yaw;
 
-  Eigen::MatrixXd C = Eigen::MatrixXd::Zero(DIM_Y, DIM);
+  Eigen::Matrix<double, DIM_Y, DIM> C = Eigen::Matrix<double, DIM_Y, DIM>::Zero();
   C(0, IDX::X) = 1.0;
   C(1, IDX::Y) = 1.0;
   C(2, IDX::YAW) = 1.0;
 
-  Eigen::MatrixXd R = Eigen::MatrixXd::Zero(DIM_Y, DIM_Y);
+  Eigen::Matrix<double, DIM_Y, DIM_Y> R = Eigen::Matrix<double, DIM_Y, DIM_Y>::Zero();
   R(0, 0) = pose_cov[utils::MSG_COV_IDX::X_X];
   R(0, 1) = pose_cov[utils::MSG_COV_IDX::X_Y];
   R(1, 0) = pose_cov[utils::MSG_COV_IDX::Y_X];
@@ -190,16 +190,16 @@ bool CTRVMotionModel::updateStatePoseHeadVel(
   }
 
   // update state
-  Eigen::MatrixXd Y(DIM_Y, 1);
+  Eigen::Matrix<double, DIM_Y, 1> Y;
   Y << x, y, yaw, vel;
 
-  Eigen::MatrixXd C = Eigen::MatrixXd::Zero(DIM_Y, DIM);
+  Eigen::Matrix<double, DIM_Y, DIM> C = Eigen::Matrix<double, DIM_Y, DIM>::Zero();
   C(0, IDX::X) = 1.0;
   C(1, IDX::Y) = 1.0;
   C(2, IDX::YAW) = 1.0;
   C(3, IDX::VEL) = 1.0;
 
-  Eigen::MatrixXd R = Eigen::MatrixXd::Zero(DIM_Y, DIM_Y);
+  Eigen::Matrix<double, DIM_Y, DIM_Y> R = Eigen::Matrix<double, DIM_Y, DIM_Y>::Zero();
   R(0, 0) = pose_cov[utils::MSG_COV_IDX::X_X];
   R(0, 1) = pose_cov[utils::MSG_COV_IDX::X_Y];
   R(1, 0) = pose_cov[utils::MSG_COV_IDX::Y_X];
@@ -216,8 +216,8 @@ bool CTRVMotionModel::updateStatePoseHeadVel(
 
 bool CTRVMotionModel::limitStates()
 {
-  Eigen::MatrixXd X_t(DIM, 1);
-  Eigen::MatrixXd P_t(DIM, DIM);
+  StateVec X_t;
+  StateMat P_t;
   ekf_.getX(X_t);
   ekf_.getP(P_t);
   X_t(IDX::YAW) = tier4_autoware_utils::normalizeRadian(X_t(IDX::YAW));
@@ -238,8 +238,8 @@ bool CTRVMotionModel::adjustPosition(const double & x, const double & y)
   if (!checkInitialized()) return false;
 
   // adjust position
-  Eigen::MatrixXd X_t(DIM, 1);
-  Eigen::MatrixXd P_t(DIM, DIM);
+  StateVec X_t;
+  StateMat P_t;
   ekf_.getX(X_t);
   ekf_.getP(P_t);
   X_t(IDX::X) += x;
@@ -249,7 +249,7 @@ bool CTRVMotionModel::adjustPosition(const double & x, const double & y)
   return true;
 }
 
-bool CTRVMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) const
+bool CTRVMotionModel::predictStateStep(const double dt, FixedSizeKalmanFilter<DIM> & ekf) const
 {
   /*  Motion model: Constant Turn Rate and constant Velocity model (CTRV)
    *
@@ -271,7 +271,7 @@ bool CTRVMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) cons
    */
 
   // Current state vector X t
-  Eigen::MatrixXd X_t(DIM, 1);
+  StateVec X_t;
   ekf.getX(X_t);
 
   const double cos_yaw = std::cos(X_t(IDX::YAW));
@@ -279,7 +279,7 @@ bool CTRVMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) cons
   const double sin_2yaw = std::sin(2.0f * X_t(IDX::YAW));
 
   // Predict state vector X t+1
-  Eigen::MatrixXd X_next_t(DIM, 1);                               // predicted state
+  StateVec X_next_t;                                              // predicted state
   X_next_t(IDX::X) = X_t(IDX::X) + X_t(IDX::VEL) * cos_yaw * dt;  // dx = v * cos(yaw)
   X_next_t(IDX::Y) = X_t(IDX::Y) + X_t(IDX::VEL) * sin_yaw * dt;  // dy = v * sin(yaw)
   X_next_t(IDX::YAW) = X_t(IDX::YAW) + (X_t(IDX::WZ)) * dt;       // dyaw = omega
@@ -287,7 +287,7 @@ bool CTRVMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) cons
   X_next_t(IDX::WZ) = X_t(IDX::WZ);
 
   // State transition matrix A
-  Eigen::MatrixXd A = Eigen::MatrixXd::Identity(DIM, DIM);
+  StateMat A = StateMat::Identity();
   A(IDX::X, IDX::YAW) = -X_t(IDX::VEL) * sin_yaw * dt;
   A(IDX::X, IDX::VEL) = cos_yaw * dt;
   A(IDX::Y, IDX::YAW) = X_t(IDX::VEL) * cos_yaw * dt;
@@ -300,7 +300,7 @@ bool CTRVMotionModel::predictStateStep(const double dt, KalmanFilter & ekf) cons
   const double q_cov_yaw = std::pow(motion_params_.q_cov_yaw * dt, 2);
   const double q_cov_vel = std::pow(motion_params_.q_cov_vel * dt, 2);
   const double q_cov_wz = std::pow(motion_params_.q_cov_wz * dt, 2);
-  Eigen::MatrixXd Q = Eigen::MatrixXd::Zero(DIM, DIM);
+  StateMat Q = StateMat::Zero();
   // Rotate the covariance matrix according to the vehicle yaw
   // because q_cov_x and y are in the vehicle coordinate system.
   Q(IDX::X, IDX::X) = (q_cov_x * cos_yaw * cos_yaw + q_cov_y * sin_yaw * sin_yaw);
@@ -324,8 +324,8 @@ bool CTRVMotionModel::getPredictedState(
   geometry_msgs::msg::Twist & twist, std::array<double, 36> & twist_cov) const
 {
   // get predicted state
-  Eigen::MatrixXd X(DIM, 1);
-  Eigen::MatrixXd P(DIM, DIM);
+  StateVec X;
+  StateMat P;
   if (!MotionModel::getPredictedState(time, X, P)) {
     return false;
   }
@@ -18,12 +18,14 @@
 
 #include "multi_object_tracker/tracker/motion_model/motion_model_base.hpp"
 
-MotionModel::MotionModel() : last_update_time_(rclcpp::Time(0, 0))
+template <int StateDim>
+MotionModel<StateDim>::MotionModel() : last_update_time_(rclcpp::Time(0, 0))
 {
 }
 
-bool MotionModel::initialize(
-  const rclcpp::Time & time, const Eigen::MatrixXd & X, const Eigen::MatrixXd & P)
+template <int StateDim>
+bool MotionModel<StateDim>::initialize(
+  const rclcpp::Time & time, const StateVec & X, const StateMat & P)
 {
   // initialize Kalman filter
   if (!ekf_.init(X, P)) return false;
@@ -37,7 +39,8 @@ bool MotionModel::initialize(
   return true;
 }
 
-bool MotionModel::predictState(const rclcpp::Time & time)
+template <int StateDim>
+bool MotionModel<StateDim>::predictState(const rclcpp::Time & time)
 {
   // check if the state is initialized
   if (!checkInitialized()) return false;
@@ -63,8 +66,9 @@ bool MotionModel::predictState(const rclcpp::Time & time)
   return true;
 }
 
-bool MotionModel::getPredictedState(
-  const rclcpp::Time & time, Eigen::MatrixXd & X, Eigen::MatrixXd & P) const
+template <int StateDim>
+bool MotionModel<StateDim>::getPredictedState(
+  const rclcpp::Time & time, StateVec & X, StateMat & P) const
 {
   // check if the state is initialized
   if (!checkInitialized()) return false;
@@ -78,7 +82,7 @@ bool MotionModel::getPredictedState(
   }
 
   // copy the predicted state and covariance
-  KalmanFilter tmp_ekf_for_no_update = ekf_;
+  FixedSizeKalmanFilter<StateDim> tmp_ekf_for_no_update = ekf_;
   // multi-step prediction
   // if dt is too large, shorten dt and repeat prediction
   const uint32_t repeat = std::floor(dt / dt_max_) + 1;
@@ -90,3 +94,7 @@ bool MotionModel::getPredictedState(
   tmp_ekf_for_no_update.getP(P);
   return true;
 }
+
+// state dimensions of the CV, CTRV and bicycle motion models
+template class MotionModel<4>;
+template class MotionModel<5>;
@@ -29,16 +29,23 @@
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
+#include <Eigen/SparseCore>
 
 #include <autoware_auto_perception_msgs/msg/detected_objects.hpp>
 
 class DataAssociation
 {
+public:
+  // row : objects1, col : objects0, only the pairs passing all the gates are stored
+  using ScoreMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
 private:
   Eigen::MatrixXi can_assign_matrix_;
   Eigen::MatrixXd max_dist_matrix_;
   Eigen::MatrixXd max_rad_matrix_;
   Eigen::MatrixXd min_iou_matrix_;
+  // largest distance gate of the assignable labels, the cell size of the spatial pre-gate
+  double max_dist_;
   const double score_threshold_;
   std::unique_ptr<gnn_solver::GnnSolverInterface> gnn_solver_ptr_;
 
@@ -48,9 +55,9 @@ public:
     std::vector<int> can_assign_vector, std::vector<double> max_dist_vector,
     std::vector<double> max_rad_vector, std::vector<double> min_iou_vector);
   void assign(
-    const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
+    const ScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
     std::unordered_map<int, int> & reverse_assignment);
-  Eigen::MatrixXd calcScoreMatrix(
+  ScoreMatrix calcScoreMatrix(
     const autoware_auto_perception_msgs::msg::DetectedObjects & objects0,
     const autoware_auto_perception_msgs::msg::DetectedObjects & objects1);
   virtual ~DataAssociation() {}
@@ -20,6 +20,7 @@
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -50,7 +51,7 @@ double getFormedYawAngle(
 DataAssociation::DataAssociation(
   std::vector<int> can_assign_vector, std::vector<double> max_dist_vector,
   std::vector<double> max_rad_vector, std::vector<double> min_iou_vector)
-: score_threshold_(0.01)
+: max_dist_(0.0), score_threshold_(0.01)
 {
   {
     const int assign_label_num = static_cast<int>(std::sqrt(can_assign_vector.size()));
@@ -77,25 +78,33 @@ DataAssociation::DataAssociation(
     min_iou_matrix_ = min_iou_matrix_tmp.transpose();
   }
 
+  for (int label1 = 0; label1 < can_assign_matrix_.rows(); ++label1) {
+    for (int label0 = 0; label0 < can_assign_matrix_.cols(); ++label0) {
+      if (can_assign_matrix_(label1, label0)) {
+        max_dist_ = std::max(max_dist_, max_dist_matrix_(label1, label0));
+      }
+    }
+  }
+
   gnn_solver_ptr_ = std::make_unique<gnn_solver::MuSSP>();
 }
 
 void DataAssociation::assign(
-  const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
+  const ScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
   std::unordered_map<int, int> & reverse_assignment)
 {
-  std::vector<std::vector<double>> score(src.rows());
-  for (int row = 0; row < src.rows(); ++row) {
-    score.at(row).resize(src.cols());
-    for (int col = 0; col < src.cols(); ++col) {
-      score.at(row).at(col) = src(row, col);
+  // the solver takes a dense matrix, where the pairs not passing the gates score zero
+  std::vector<std::vector<double>> score(src.rows(), std::vector<double>(src.cols(), 0.0));
+  for (int row = 0; row < src.outerSize(); ++row) {
+    for (ScoreMatrix::InnerIterator itr(src, row); itr; ++itr) {
+      score.at(row).at(itr.col()) = itr.value();
     }
   }
   // Solve
   gnn_solver_ptr_->maximizeLinearAssignment(score, &direct_assignment, &reverse_assignment);
 
   for (auto itr = direct_assignment.begin(); itr != direct_assignment.end();) {
-    if (src(itr->first, itr->second) < score_threshold_) {
+    if (src.coeff(itr->first, itr->second) < score_threshold_) {
       itr = direct_assignment.erase(itr);
       continue;
     } else {
@@ -103,7 +112,7 @@ void DataAssociation::assign(
     }
   }
   for (auto itr = reverse_assignment.begin(); itr != reverse_assignment.end();) {
-    if (src(itr->second, itr->first) < score_threshold_) {
+    if (src.coeff(itr->second, itr->first) < score_threshold_) {
       itr = reverse_assignment.erase(itr);
       continue;
     } else {
@@ -112,63 +121,74 @@ void DataAssociation::assign(
   }
 }
 
-Eigen::MatrixXd DataAssociation::calcScoreMatrix(
+DataAssociation::ScoreMatrix DataAssociation::calcScoreMatrix(
   const autoware_auto_perception_msgs::msg::DetectedObjects & objects0,
   const autoware_auto_perception_msgs::msg::DetectedObjects & objects1)
 {
-  Eigen::MatrixXd score_matrix =
-    Eigen::MatrixXd::Zero(objects1.objects.size(), objects0.objects.size());
+  // objects0 hashed in the grid for the spatial pre-gate
+  object_recognition_utils::SpatialGrid objects0_grid(std::max(max_dist_, 1e-3));
+  std::vector<std::uint8_t> objects0_labels(objects0.objects.size());
+  for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    const auto & object0 = objects0.objects.at(objects0_idx);
+    objects0_labels.at(objects0_idx) =
+      object_recognition_utils::getHighestProbLabel(object0.classification);
+    objects0_grid.insert(object0.kinematics.pose_with_covariance.pose.position, objects0_idx);
+  }
+
+  std::vector<Eigen::Triplet<double>> scores;
   for (size_t objects1_idx = 0; objects1_idx < objects1.objects.size(); ++objects1_idx) {
     const autoware_auto_perception_msgs::msg::DetectedObject & object1 =
       objects1.objects.at(objects1_idx);
     const std::uint8_t object1_label =
       object_recognition_utils::getHighestProbLabel(object1.classification);
 
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    // the objects out of the neighbor cells are farther than any distance gate
+    const auto & object1_position = object1.kinematics.pose_with_covariance.pose.position;
+    objects0_grid.forEachNeighbor(object1_position, [&](const size_t objects0_idx) {
       const autoware_auto_perception_msgs::msg::DetectedObject & object0 =
         objects0.objects.at(objects0_idx);
-      const std::uint8_t object0_label =
-        object_recognition_utils::getHighestProbLabel(object0.classification);
-
-      double score = 0.0;
-      if (can_assign_matrix_(object1_label, object0_label)) {
-        const double max_dist = max_dist_matrix_(object1_label, object0_label);
-        const double dist = tier4_autoware_utils::calcDistance2d(
-          object0.kinematics.pose_with_covariance.pose.position,
-          object1.kinematics.pose_with_covariance.pose.position);
+      const std::uint8_t object0_label = objects0_labels.at(objects0_idx);
+      if (!can_assign_matrix_(object1_label, object0_label)) {
+        return;
+      }
 
-        bool passed_gate = true;
-        // dist gate
-        if (passed_gate) {
-          if (max_dist < dist) passed_gate = false;
-        }
-        // angle gate
-        if (passed_gate) {
-          const double max_rad = max_rad_matrix_(object1_label, object0_label);
-          const double angle = getFormedYawAngle(
-            object0.kinematics.pose_with_covariance.pose.orientation,
-            object1.kinematics.pose_with_covariance.pose.orientation, false);
-          if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle))
-            passed_gate = false;
+      const double max_dist = max_dist_matrix_(object1_label, object0_label);
+      const double dist = tier4_autoware_utils::calcDistance2d(
+        object0.kinematics.pose_with_covariance.pose.position, object1_position);
+      // dist gate
+      if (max_dist < dist) {
+        return;
+      }
+      // angle gate
+      {
+        const double max_rad = max_rad_matrix_(object1_label, object0_label);
+        const double angle = getFormedYawAngle(
+          object0.kinematics.pose_with_covariance.pose.orientation,
+          object1.kinematics.pose_with_covariance.pose.orientation, false);
+        if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle)) {
+          return;
         }
-        // 2d iou gate
-        if (passed_gate) {
-          const double min_iou = min_iou_matrix_(object1_label, object0_label);
-          const double min_union_iou_area = 1e-2;
-          const double iou =
-            object_recognition_utils::get2dIoU(object0, object1, min_union_iou_area);
-          if (iou < min_iou) passed_gate = false;
+      }
+      // 2d iou gate
+      {
+        const double min_iou = min_iou_matrix_(object1_label, object0_label);
+        const double min_union_iou_area = 1e-2;
+        const double iou =
+          object_recognition_utils::get2dIoU(object0, object1, min_union_iou_area);
+        if (iou < min_iou) {
+          return;
         }
+      }
 
-        // all gate is passed
-        if (passed_gate) {
-          score = (max_dist - std::min(dist, max_dist)) / max_dist;
-          if (score < score_threshold_) score = 0.0;
-        }
+      // all gate is passed
+      const double score = (max_dist - std::min(dist, max_dist)) / max_dist;
+      if (score_threshold_ <= score) {
+        scores.emplace_back(static_cast<int>(objects1_idx), static_cast<int>(objects0_idx), score);
       }
-      score_matrix(objects1_idx, objects0_idx) = score;
-    }
+    });
   }
 
+  ScoreMatrix score_matrix(objects1.objects.size(), objects0.objects.size());
+  score_matrix.setFromTriplets(scores.begin(), scores.end());
   return score_matrix;
 }
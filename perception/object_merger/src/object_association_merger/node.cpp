@@ -156,7 +156,7 @@ void ObjectAssociationMergerNode::objectsCallback(
   std::unordered_map<int, int> direct_assignment, reverse_assignment;
   const auto & objects0 = transformed_objects0.objects;
   const auto & objects1 = transformed_objects1.objects;
-  Eigen::MatrixXd score_matrix =
+  const auto score_matrix =
     data_association_->calcScoreMatrix(transformed_objects1, transformed_objects0);
   data_association_->assign(score_matrix, direct_assignment, reverse_assignment);
 
@@ -32,13 +32,14 @@
 #include <message_filters/synchronizer.h>
 #include <pcl/filters/extract_indices.h>
 #include <pcl/filters/radius_outlier_removal.h>
-#include <pcl/search/kdtree.h>
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/message_filter.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace occupancy_grid_map_outlier_filter
 {
@@ -47,23 +48,49 @@ using nav_msgs::msg::OccupancyGrid;
 using sensor_msgs::msg::PointCloud2;
 using std_msgs::msg::Header;
 
+/**
+ * @brief radius search 2d outlier filter with a grid hash neighbour search
+ * @details the points are bucketed into the cells of the given resolution, usually the one of the
+ * occupancy grid map, and the neighbours are searched only in the cells within the search radius.
+ * the buffers are kept across the calls.
+ */
 class RadiusSearch2dFilter
 {
 public:
   explicit RadiusSearch2dFilter(rclcpp::Node & node);
   void filter(
-    const PointCloud2 & input, const Pose & pose, PointCloud2 & output, PointCloud2 & outlier);
+    const PointCloud2 & input, const Pose & pose, const double resolution, PointCloud2 & output,
+    PointCloud2 & outlier);
   void filter(
     const PointCloud2 & high_conf_input, const PointCloud2 & low_conf_input, const Pose & pose,
-    PointCloud2 & output, PointCloud2 & outlier);
+    const double resolution, PointCloud2 & output, PointCloud2 & outlier);
 
 private:
+  void addPoints(const PointCloud2 & input);
+  void buildGrid(const double resolution);
+  int countNeighbours(const float x, const float y, const int max_count) const;
+  void classifyPoints(const size_t query_points_num, const Pose & pose);
+  void extractPoints(const PointCloud2 & input, PointCloud2 & output, PointCloud2 & outlier) const;
+
   float search_radius_;
   float min_points_and_distance_ratio_;
   int min_points_;
   int max_points_;
   long unsigned int max_filter_points_nb_;
-  pcl::search::Search<pcl::PointXY>::Ptr kd_tree_;
+
+  // the cell buckets of the points, sorted by cell
+  float cell_size_{0.0f};
+  float grid_min_x_{0.0f};
+  float grid_min_y_{0.0f};
+  int grid_size_x_{0};
+  int grid_size_y_{0};
+  std::vector<float> points_x_;
+  std::vector<float> points_y_;
+  std::vector<uint32_t> point_cells_;
+  std::vector<uint32_t> cell_begins_;
+  std::vector<float> sorted_points_x_;
+  std::vector<float> sorted_points_y_;
+  std::vector<uint8_t> is_inlier_;
 };
 
 class OccupancyGridMapOutlierFilterComponent : public rclcpp::Node
@@ -31,6 +31,9 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -112,37 +115,135 @@ RadiusSearch2dFilter::RadiusSearch2dFilter(rclcpp::Node & node)
   max_points_ = node.declare_parameter("radius_search_2d_filter.max_points", 70);
   max_filter_points_nb_ =
     node.declare_parameter("radius_search_2d_filter.max_filter_points_nb", 15000);
-  kd_tree_ = pcl::make_shared<pcl::search::KdTree<pcl::PointXY>>(false);
 }
 
-void RadiusSearch2dFilter::filter(
-  const PointCloud2 & input, const Pose & pose, PointCloud2 & output, PointCloud2 & outlier)
+void RadiusSearch2dFilter::addPoints(const PointCloud2 & input)
 {
-  pcl::PointCloud<pcl::PointXY>::Ptr xy_cloud(new pcl::PointCloud<pcl::PointXY>);
-  int point_step = input.point_step;
-  int x_offset = input.fields[pcl::getFieldIndex(input, "x")].offset;
-  int y_offset = input.fields[pcl::getFieldIndex(input, "y")].offset;
-  xy_cloud->points.resize(input.data.size() / point_step);
-  for (size_t i = 0; i < input.data.size() / point_step; ++i) {
-    std::memcpy(&xy_cloud->points[i].x, &input.data[i * point_step + x_offset], sizeof(float));
-    std::memcpy(&xy_cloud->points[i].y, &input.data[i * point_step + y_offset], sizeof(float));
+  const size_t point_step = input.point_step;
+  const size_t x_offset = input.fields[pcl::getFieldIndex(input, "x")].offset;
+  const size_t y_offset = input.fields[pcl::getFieldIndex(input, "y")].offset;
+  const size_t points_num = input.data.size() / point_step;
+  const size_t begin = points_x_.size();
+  points_x_.resize(begin + points_num);
+  points_y_.resize(begin + points_num);
+  for (size_t i = 0; i < points_num; ++i) {
+    std::memcpy(&points_x_[begin + i], &input.data[i * point_step + x_offset], sizeof(float));
+    std::memcpy(&points_y_[begin + i], &input.data[i * point_step + y_offset], sizeof(float));
   }
+}
 
-  std::vector<int> k_indices(xy_cloud->points.size());
-  std::vector<float> k_distances(xy_cloud->points.size());
-  kd_tree_->setInputCloud(xy_cloud);
-  size_t output_size = 0;
-  size_t outlier_size = 0;
-  for (size_t i = 0; i < xy_cloud->points.size(); ++i) {
+void RadiusSearch2dFilter::buildGrid(const double resolution)
+{
+  // the points which are not finite are not bucketed, and have no neighbours
+  constexpr uint32_t no_cell = std::numeric_limits<uint32_t>::max();
+  const size_t points_num = points_x_.size();
+  cell_size_ = 0.0 < resolution ? static_cast<float>(resolution) : search_radius_;
+  float min_x = std::numeric_limits<float>::max();
+  float min_y = std::numeric_limits<float>::max();
+  float max_x = std::numeric_limits<float>::lowest();
+  float max_y = std::numeric_limits<float>::lowest();
+  for (size_t i = 0; i < points_num; ++i) {
+    if (std::isfinite(points_x_[i]) && std::isfinite(points_y_[i])) {
+      min_x = std::min(min_x, points_x_[i]);
+      min_y = std::min(min_y, points_y_[i]);
+      max_x = std::max(max_x, points_x_[i]);
+      max_y = std::max(max_y, points_y_[i]);
+    }
+  }
+  grid_min_x_ = min_x;
+  grid_min_y_ = min_y;
+  grid_size_x_ = min_x <= max_x ? static_cast<int>((max_x - min_x) / cell_size_) + 1 : 0;
+  grid_size_y_ = min_y <= max_y ? static_cast<int>((max_y - min_y) / cell_size_) + 1 : 0;
+
+  // counting sort of the points by cell
+  const size_t cells_num = static_cast<size_t>(grid_size_x_) * grid_size_y_;
+  cell_begins_.assign(cells_num + 1, 0);
+  point_cells_.resize(points_num);
+  for (size_t i = 0; i < points_num; ++i) {
+    if (!std::isfinite(points_x_[i]) || !std::isfinite(points_y_[i])) {
+      point_cells_[i] = no_cell;
+      continue;
+    }
+    const int cell_x = std::min(
+      static_cast<int>((points_x_[i] - grid_min_x_) / cell_size_), grid_size_x_ - 1);
+    const int cell_y = std::min(
+      static_cast<int>((points_y_[i] - grid_min_y_) / cell_size_), grid_size_y_ - 1);
+    point_cells_[i] = static_cast<uint32_t>(cell_y * grid_size_x_ + cell_x);
+    ++cell_begins_[point_cells_[i] + 1];
+  }
+  for (size_t cell = 0; cell < cells_num; ++cell) {
+    cell_begins_[cell + 1] += cell_begins_[cell];
+  }
+  sorted_points_x_.resize(cell_begins_[cells_num]);
+  sorted_points_y_.resize(cell_begins_[cells_num]);
+  for (size_t i = 0; i < points_num; ++i) {
+    if (point_cells_[i] == no_cell) {
+      continue;
+    }
+    const uint32_t index = cell_begins_[point_cells_[i]]++;
+    sorted_points_x_[index] = points_x_[i];
+    sorted_points_y_[index] = points_y_[i];
+  }
+  // each begin has moved to the begin of the next cell
+  for (size_t cell = cells_num; cell > 0; --cell) {
+    cell_begins_[cell] = cell_begins_[cell - 1];
+  }
+  cell_begins_[0] = 0;
+}
+
+int RadiusSearch2dFilter::countNeighbours(const float x, const float y, const int max_count) const
+{
+  if (max_count <= 0 || !std::isfinite(x) || !std::isfinite(y)) {
+    return 0;
+  }
+  const float squared_radius = search_radius_ * search_radius_;
+  const int cell_range = static_cast<int>(std::ceil(search_radius_ / cell_size_));
+  const int cell_x = static_cast<int>((x - grid_min_x_) / cell_size_);
+  const int cell_y = static_cast<int>((y - grid_min_y_) / cell_size_);
+  const int begin_x = std::max(cell_x - cell_range, 0);
+  const int end_x = std::min(cell_x + cell_range, grid_size_x_ - 1);
+  const int begin_y = std::max(cell_y - cell_range, 0);
+  const int end_y = std::min(cell_y + cell_range, grid_size_y_ - 1);
+
+  // the point itself is counted as well as with the k-d tree search
+  int count = 0;
+  for (int neighbour_y = begin_y; neighbour_y <= end_y; ++neighbour_y) {
+    const size_t row = static_cast<size_t>(neighbour_y) * grid_size_x_;
+    const uint32_t end = cell_begins_[row + end_x + 1];
+    for (uint32_t i = cell_begins_[row + begin_x]; i < end; ++i) {
+      const float dx = sorted_points_x_[i] - x;
+      const float dy = sorted_points_y_[i] - y;
+      if (dx * dx + dy * dy <= squared_radius && max_count <= ++count) {
+        return count;
+      }
+    }
+  }
+  return count;
+}
+
+void RadiusSearch2dFilter::classifyPoints(const size_t query_points_num, const Pose & pose)
+{
+  is_inlier_.resize(query_points_num);
+#pragma omp parallel for schedule(dynamic, 256)
+  for (size_t i = 0; i < query_points_num; ++i) {
     const float distance =
-      std::hypot(xy_cloud->points[i].x - pose.position.x, xy_cloud->points[i].y - pose.position.y);
+      std::hypot(points_x_[i] - pose.position.x, points_y_[i] - pose.position.y);
     const int min_points_threshold = std::min(
       std::max(static_cast<int>(min_points_and_distance_ratio_ / distance + 0.5f), min_points_),
       max_points_);
-    const int points_num =
-      kd_tree_->radiusSearch(i, search_radius_, k_indices, k_distances, min_points_threshold);
+    const int points_num = countNeighbours(points_x_[i], points_y_[i], min_points_threshold);
+    is_inlier_[i] = min_points_threshold <= points_num;
+  }
+}
 
-    if (min_points_threshold <= points_num) {
+void RadiusSearch2dFilter::extractPoints(
+  const PointCloud2 & input, PointCloud2 & output, PointCloud2 & outlier) const
+{
+  const size_t point_step = input.point_step;
+  size_t output_size = 0;
+  size_t outlier_size = 0;
+  for (size_t i = 0; i < is_inlier_.size(); ++i) {
+    if (is_inlier_[i]) {
       std::memcpy(&output.data[output_size], &input.data[i * point_step], point_step);
       output_size += point_step;
     } else {
@@ -154,9 +255,21 @@ void RadiusSearch2dFilter::filter(
   outlier.data.resize(outlier_size);
 }
 
+void RadiusSearch2dFilter::filter(
+  const PointCloud2 & input, const Pose & pose, const double resolution, PointCloud2 & output,
+  PointCloud2 & outlier)
+{
+  points_x_.clear();
+  points_y_.clear();
+  addPoints(input);
+  buildGrid(resolution);
+  classifyPoints(points_x_.size(), pose);
+  extractPoints(input, output, outlier);
+}
+
 void RadiusSearch2dFilter::filter(
   const PointCloud2 & high_conf_xyz_cloud, const PointCloud2 & low_conf_xyz_cloud,
-  const Pose & pose, PointCloud2 & output, PointCloud2 & outlier)
+  const Pose & pose, const double resolution, PointCloud2 & output, PointCloud2 & outlier)
 {
   // check the limit points number
   if (low_conf_xyz_cloud.width > max_filter_points_nb_) {
@@ -165,58 +278,16 @@ void RadiusSearch2dFilter::filter(
       "Skip outlier filter since too much low_confidence pointcloud!");
     return;
   }
-  int x_offset = low_conf_xyz_cloud.fields[pcl::getFieldIndex(low_conf_xyz_cloud, "x")].offset;
-  int y_offset = low_conf_xyz_cloud.fields[pcl::getFieldIndex(low_conf_xyz_cloud, "y")].offset;
-  int point_step = low_conf_xyz_cloud.point_step;
-  pcl::PointCloud<pcl::PointXY>::Ptr xy_cloud(new pcl::PointCloud<pcl::PointXY>);
-  xy_cloud->points.resize(low_conf_xyz_cloud.width + high_conf_xyz_cloud.width);
-  for (size_t i = 0; i < low_conf_xyz_cloud.width; ++i) {
-    std::memcpy(
-      &xy_cloud->points[i].x, &low_conf_xyz_cloud.data[i * point_step + x_offset], sizeof(float));
-    std::memcpy(
-      &xy_cloud->points[i].y, &low_conf_xyz_cloud.data[i * point_step + y_offset], sizeof(float));
-  }
 
-  for (size_t i = low_conf_xyz_cloud.width; i < xy_cloud->points.size(); ++i) {
-    size_t high_conf_xyz_cloud_index = i - low_conf_xyz_cloud.width;
-    std::memcpy(
-      &xy_cloud->points[i].x,
-      &high_conf_xyz_cloud.data[high_conf_xyz_cloud_index * point_step + x_offset], sizeof(float));
-    std::memcpy(
-      &xy_cloud->points[i].y,
-      &high_conf_xyz_cloud.data[high_conf_xyz_cloud_index * point_step + y_offset], sizeof(float));
-  }
-
-  std::vector<int> k_indices(xy_cloud->points.size());
-  std::vector<float> k_distances(xy_cloud->points.size());
-  kd_tree_->setInputCloud(xy_cloud);
-
-  size_t output_size = 0;
-  size_t outlier_size = 0;
-  for (size_t i = 0; i < low_conf_xyz_cloud.data.size() / low_conf_xyz_cloud.point_step; ++i) {
-    const float distance =
-      std::hypot(xy_cloud->points[i].x - pose.position.x, xy_cloud->points[i].y - pose.position.y);
-    const int min_points_threshold = std::min(
-      std::max(static_cast<int>(min_points_and_distance_ratio_ / distance + 0.5f), min_points_),
-      max_points_);
-    const int points_num =
-      kd_tree_->radiusSearch(i, search_radius_, k_indices, k_distances, min_points_threshold);
-
-    if (min_points_threshold <= points_num) {
-      std::memcpy(
-        &output.data[output_size], &low_conf_xyz_cloud.data[i * low_conf_xyz_cloud.point_step],
-        low_conf_xyz_cloud.point_step);
-      output_size += low_conf_xyz_cloud.point_step;
-    } else {
-      std::memcpy(
-        &outlier.data[outlier_size], &low_conf_xyz_cloud.data[i * low_conf_xyz_cloud.point_step],
-        low_conf_xyz_cloud.point_step);
-      outlier_size += low_conf_xyz_cloud.point_step;
-    }
-  }
-
-  output.data.resize(output_size);
-  outlier.data.resize(outlier_size);
+  // the low confidence points are searched in all the points including the high confidence ones
+  points_x_.clear();
+  points_y_.clear();
+  addPoints(low_conf_xyz_cloud);
+  const size_t low_conf_points_num = points_x_.size();
+  addPoints(high_conf_xyz_cloud);
+  buildGrid(resolution);
+  classifyPoints(low_conf_points_num, pose);
+  extractPoints(low_conf_xyz_cloud, output, outlier);
 }
 
 OccupancyGridMapOutlierFilterComponent::OccupancyGridMapOutlierFilterComponent(
@@ -335,8 +406,8 @@ void OccupancyGridMapOutlierFilterComponent::onOccupancyGridMapAndPointCloud2(
     auto pc_frame_pose_stamped = getPoseStamped(
       *tf2_, input_ogm->header.frame_id, input_pc->header.frame_id, input_ogm->header.stamp);
     radius_search_2d_filter_ptr_->filter(
-      high_confidence_pc, low_confidence_pc, pc_frame_pose_stamped.pose, filtered_low_confidence_pc,
-      outlier_pc);
+      high_confidence_pc, low_confidence_pc, pc_frame_pose_stamped.pose,
+      input_ogm->info.resolution, filtered_low_confidence_pc, outlier_pc);
   } else {
     std::memcpy(&outlier_pc.data[0], &low_confidence_pc.data[0], low_confidence_pc.data.size());
     outlier_pc.data.resize(low_confidence_pc.data.size());
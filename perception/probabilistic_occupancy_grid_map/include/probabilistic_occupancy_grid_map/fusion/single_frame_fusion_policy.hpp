@@ -18,6 +18,7 @@
 #include "probabilistic_occupancy_grid_map/cost_value.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <stdexcept>
 #include <vector>
@@ -46,6 +47,10 @@ namespace log_odds_fusion
 double logOddsFusion(const std::vector<double> & probabilities);
 double logOddsFusion(
   const std::vector<double> & probabilities, const std::vector<double> & weights);
+double convertCharToLogOdds(const unsigned char & occupancy);
+void logOddsFusion(
+  const std::vector<const unsigned char *> & occupancy_rows, const std::vector<double> & weights,
+  const std::size_t cells_num, unsigned char * fused_row);
 }  // namespace log_odds_fusion
 
 namespace dempster_shafer_fusion
@@ -71,7 +71,7 @@ private:
   OccupancyGridMapFixedBlindSpot OccupancyGridMsgToGridMap(
     const nav_msgs::msg::OccupancyGrid & occupancy_grid_map);
   OccupancyGridMapFixedBlindSpot SingleFrameOccupancyFusion(
-    std::vector<OccupancyGridMapFixedBlindSpot> & occupancy_grid_maps,
+    const std::vector<nav_msgs::msg::OccupancyGrid::ConstSharedPtr> & occupancy_grid_msgs,
     const builtin_interfaces::msg::Time latest_stamp, const std::vector<double> & weights);
 
   void updateGridMap(const nav_msgs::msg::OccupancyGrid::ConstSharedPtr & occupancy_grid_msg);
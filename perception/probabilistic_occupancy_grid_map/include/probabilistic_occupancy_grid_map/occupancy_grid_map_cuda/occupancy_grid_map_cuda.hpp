@@ -0,0 +1,112 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PROBABILISTIC_OCCUPANCY_GRID_MAP__OCCUPANCY_GRID_MAP_CUDA__OCCUPANCY_GRID_MAP_CUDA_HPP_
+#define PROBABILISTIC_OCCUPANCY_GRID_MAP__OCCUPANCY_GRID_MAP_CUDA__OCCUPANCY_GRID_MAP_CUDA_HPP_
+
+#include "probabilistic_occupancy_grid_map/occupancy_grid_map_cuda/occupancy_grid_map_kernel.hpp"
+
+#include <cuda_utils/cuda_unique_ptr.hpp>
+#include <cuda_utils/stream_unique_ptr.hpp>
+
+#include <geometry_msgs/msg/pose.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace costmap_2d
+{
+/**
+ * @brief OccupancyGridMapFixedBlindSpot and OccupancyGridMapBBFUpdater on the GPU
+ * @details the points are binned by angle and sorted by range with one radix sort, and each bin
+ * is raytraced by one thread with the same steps as the CPU implementation. the single frame map
+ * and the updated map stay on the device, so that a consumer running on the same GPU can take
+ * them without a host round trip. the device buffers only grow and are reused across frames.
+ */
+class OccupancyGridMapCuda
+{
+public:
+  OccupancyGridMapCuda(
+    uint32_t cells_size_x, uint32_t cells_size_y, double resolution, double distance_margin,
+    const BinaryBayesFilterCudaParam & bbf_param);
+
+  /**
+   * @brief create the single frame map at the given origin from the point clouds on the host
+   */
+  void updateWithPointCloud(
+    const sensor_msgs::msg::PointCloud2 & raw_pointcloud,
+    const sensor_msgs::msg::PointCloud2 & obstacle_pointcloud,
+    const geometry_msgs::msg::Pose & robot_pose, const geometry_msgs::msg::Pose & scan_origin,
+    double origin_x, double origin_y);
+
+  /**
+   * @brief move the updated map to the origin of the single frame map and apply the binary bayes
+   * filter, the origin is moved in the same way as OccupancyGridMapInterface::updateOrigin()
+   */
+  void updateBinaryBayesFilter();
+
+  const uint8_t * singleFrameMapDevice() const { return single_frame_map_d_.get(); }
+  const uint8_t * updatedMapDevice() const { return updated_map_d_.get(); }
+  double updatedMapOriginX() const { return updated_map_origin_x_; }
+  double updatedMapOriginY() const { return updated_map_origin_y_; }
+  cudaStream_t stream() const { return *stream_; }
+
+  /** @brief copy the map to dst, which must hold cells_size_x * cells_size_y cells */
+  void copySingleFrameMapToHost(uint8_t * dst) const;
+  void copyUpdatedMapToHost(uint8_t * dst) const;
+
+private:
+  struct AngleBinsDevice
+  {
+    cuda_utils::CudaUniquePtr<uint8_t[]> points;
+    cuda_utils::CudaUniquePtr<float4[]> points_xyzr;
+    cuda_utils::CudaUniquePtr<uint64_t[]> sort_keys;
+    cuda_utils::CudaUniquePtr<uint64_t[]> sorted_keys;
+    cuda_utils::CudaUniquePtr<uint32_t[]> sort_indices;
+    cuda_utils::CudaUniquePtr<uint32_t[]> sorted_indices;
+    cuda_utils::CudaUniquePtr<float4[]> sorted_points;
+    cuda_utils::CudaUniquePtr<uint32_t[]> bin_begins;
+    std::size_t points_capacity{0};
+    std::size_t points_bytes_capacity{0};
+  };
+
+  void reservePoints(AngleBinsDevice & bins, std::size_t points_num, std::size_t point_step);
+  void reserveTempStorage(std::size_t temp_storage_bytes);
+  void createAngleBins(
+    const sensor_msgs::msg::PointCloud2 & pointcloud, const PointTransformCudaParam & transform,
+    const AngleBinsDevice * range_limit_bins, AngleBinsDevice & bins);
+
+  cuda_utils::StreamUniquePtr stream_;
+
+  GridMapCudaParam map_param_;
+  float distance_margin_;
+  BinaryBayesFilterCudaParam bbf_param_;
+  double updated_map_origin_x_{0.0};
+  double updated_map_origin_y_{0.0};
+
+  AngleBinsDevice raw_bins_;
+  AngleBinsDevice obstacle_bins_;
+  std::size_t temp_storage_capacity_{0};
+  cuda_utils::CudaUniquePtr<uint8_t[]> temp_storage_d_;
+
+  cuda_utils::CudaUniquePtr<uint64_t[]> cell_writes_d_;
+  cuda_utils::CudaUniquePtr<uint8_t[]> single_frame_map_d_;
+  cuda_utils::CudaUniquePtr<uint8_t[]> updated_map_d_;
+  cuda_utils::CudaUniquePtr<uint8_t[]> shifted_map_d_;
+};
+
+}  // namespace costmap_2d
+
+#endif  // PROBABILISTIC_OCCUPANCY_GRID_MAP__OCCUPANCY_GRID_MAP_CUDA__OCCUPANCY_GRID_MAP_CUDA_HPP_
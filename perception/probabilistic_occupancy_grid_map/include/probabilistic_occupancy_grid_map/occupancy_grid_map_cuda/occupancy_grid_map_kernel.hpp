@@ -0,0 +1,109 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PROBABILISTIC_OCCUPANCY_GRID_MAP__OCCUPANCY_GRID_MAP_CUDA__OCCUPANCY_GRID_MAP_KERNEL_HPP_
+#define PROBABILISTIC_OCCUPANCY_GRID_MAP__OCCUPANCY_GRID_MAP_CUDA__OCCUPANCY_GRID_MAP_KERNEL_HPP_
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace costmap_2d
+{
+// the same angle bins as AngleBins, 0.1 degree from -180 degree with one margin bin
+constexpr uint32_t CUDA_ANGLE_BINS_NUM = 3601;
+
+struct GridMapCudaParam
+{
+  double origin_x;
+  double origin_y;
+  double resolution;
+  uint32_t size_x;
+  uint32_t size_y;
+};
+
+// row-major 3x4 transforms of the input points to the map frame and to the scan origin frame
+struct PointTransformCudaParam
+{
+  float robot_to_map[12];
+  float robot_to_scan[12];
+};
+
+// see OccupancyGridMapBBFUpdater::applyBBF() for the meaning of each one
+struct BinaryBayesFilterCudaParam
+{
+  float occupied_to_occupied;
+  float occupied_to_free;
+  float free_to_free;
+  float free_to_occupied;
+  float v_ratio;
+};
+
+// write wx, wy, wz and the range of each point, and the key sorting the points by angle bin and
+// then by range. the points which are not finite, and the points in an empty bin of the limit
+// bins or beyond its farthest point if limit_sorted_keys is given, are keyed past the last bin.
+cudaError_t convertPoints_launch(
+  const uint8_t * points, std::size_t points_num, std::size_t point_step, uint32_t x_offset,
+  uint32_t y_offset, uint32_t z_offset, const PointTransformCudaParam & transform,
+  const uint64_t * limit_sorted_keys, const uint32_t * limit_bin_begins, float4 * points_xyzr,
+  uint64_t * sort_keys, uint32_t * sort_indices, cudaStream_t stream);
+
+// call with temp_storage == nullptr to get the required temp_storage_bytes
+cudaError_t sortPointsByAngleBin_launch(
+  void * temp_storage, std::size_t & temp_storage_bytes, const uint64_t * sort_keys,
+  uint64_t * sorted_keys, const uint32_t * sort_indices, uint32_t * sorted_indices,
+  std::size_t points_num, cudaStream_t stream);
+
+// bin_begins has CUDA_ANGLE_BINS_NUM + 1 elements, the last one is the end of the last bin.
+// the points are gathered in the sorted order.
+cudaError_t gatherPointsByAngleBin_launch(
+  const float4 * points_xyzr, const uint64_t * sorted_keys, const uint32_t * sorted_indices,
+  std::size_t points_num, float4 * sorted_points, uint32_t * bin_begins, cudaStream_t stream);
+
+// one thread raytraces one bin from the scan origin to its farthest raw point with FREE_SPACE
+cudaError_t raytraceFreeSpace_launch(
+  const float4 * raw_points, const uint32_t * raw_bin_begins, double scan_origin_x,
+  double scan_origin_y, const GridMapCudaParam & map, uint8_t * costmap, cudaStream_t stream);
+
+// one thread scans the obstacle points of one bin as the second step of
+// OccupancyGridMapFixedBlindSpot. the cells are written to cell_writes with atomicMax on a key of
+// (bin, write order) so that the last write of the sequential order wins, and are applied to the
+// costmap by applyCellWrites_launch(). cell_writes must be zero-filled in advance.
+cudaError_t addUnknownCells_launch(
+  const float4 * raw_points, const uint32_t * raw_bin_begins, const float4 * obstacle_points,
+  const uint32_t * obstacle_bin_begins, float distance_margin, const GridMapCudaParam & map,
+  uint64_t * cell_writes, cudaStream_t stream);
+
+cudaError_t applyCellWrites_launch(
+  const uint64_t * cell_writes, std::size_t cells_num, uint8_t * costmap, cudaStream_t stream);
+
+// one thread sets the obstacle cells of one bin with LETHAL_OBSTACLE
+cudaError_t addObstacleCells_launch(
+  const float4 * obstacle_points, const uint32_t * obstacle_bin_begins, float distance_margin,
+  const GridMapCudaParam & map, uint8_t * costmap, cudaStream_t stream);
+
+// dst(x, y) is src(x + cell_offset_x, y + cell_offset_y), or default_value out of src
+cudaError_t shiftMap_launch(
+  const uint8_t * src, uint32_t size_x, uint32_t size_y, int cell_offset_x, int cell_offset_y,
+  uint8_t default_value, uint8_t * dst, cudaStream_t stream);
+
+cudaError_t applyBinaryBayesFilter_launch(
+  const uint8_t * single_frame_costmap, std::size_t cells_num,
+  const BinaryBayesFilterCudaParam & param, uint8_t * costmap, cudaStream_t stream);
+
+}  // namespace costmap_2d
+
+#endif  // PROBABILISTIC_OCCUPANCY_GRID_MAP__OCCUPANCY_GRID_MAP_CUDA__OCCUPANCY_GRID_MAP_KERNEL_HPP_
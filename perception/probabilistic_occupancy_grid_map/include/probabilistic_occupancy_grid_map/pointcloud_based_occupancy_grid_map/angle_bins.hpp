@@ -0,0 +1,62 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PROBABILISTIC_OCCUPANCY_GRID_MAP__POINTCLOUD_BASED_OCCUPANCY_GRID_MAP__ANGLE_BINS_HPP_
+#define PROBABILISTIC_OCCUPANCY_GRID_MAP__POINTCLOUD_BASED_OCCUPANCY_GRID_MAP__ANGLE_BINS_HPP_
+
+#include <geometry_msgs/msg/pose.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace costmap_2d
+{
+/**
+ * @brief points of a pointcloud binned by their azimuth around the scan origin and sorted by range
+ * @details the points of the bin i are [offsets[i], offsets[i + 1]) of the point arrays. the range
+ * is in the scan origin frame and wx, wy and wz are in the map frame.
+ */
+struct AngleBins
+{
+  std::vector<std::size_t> offsets;
+  std::vector<float> range;
+  std::vector<float> wx;
+  std::vector<float> wy;
+  std::vector<float> wz;
+
+  std::size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+  std::size_t begin(const std::size_t bin_index) const { return offsets[bin_index]; }
+  std::size_t end(const std::size_t bin_index) const { return offsets[bin_index + 1]; }
+  bool empty(const std::size_t bin_index) const { return begin(bin_index) == end(bin_index); }
+  // the farthest point of the bin, the bin must not be empty
+  std::size_t back(const std::size_t bin_index) const { return end(bin_index) - 1; }
+};
+
+/**
+ * @brief bin the points of the pointcloud by 0.1 degree from -180 degree, as the grid maps do
+ * @details the points which are not finite are dropped.
+ * @param pointcloud pointcloud in the robot frame
+ * @param robot_pose pose of the robot frame in the map frame
+ * @param scan_origin pose of the scan origin in the map frame
+ * @param range_limit_bins if given, the points in its empty bins or farther than the farthest
+ * point of their bin in it are dropped
+ */
+void createAngleBins(
+  const sensor_msgs::msg::PointCloud2 & pointcloud, const geometry_msgs::msg::Pose & robot_pose,
+  const geometry_msgs::msg::Pose & scan_origin, AngleBins & angle_bins,
+  const AngleBins * range_limit_bins = nullptr);
+}  // namespace costmap_2d
+
+#endif  // PROBABILISTIC_OCCUPANCY_GRID_MAP__POINTCLOUD_BASED_OCCUPANCY_GRID_MAP__ANGLE_BINS_HPP_
@@ -59,6 +59,8 @@
 #include <sensor_msgs/msg/laser_scan.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
+#include <vector>
+
 namespace costmap_2d
 {
 using geometry_msgs::msg::Pose;
@@ -81,10 +83,86 @@ public:
   void setCellValue(const double wx, const double wy, const unsigned char cost);
   using nav2_costmap_2d::Costmap2D::resetMaps;
 
+  struct CellUpdate
+  {
+    unsigned int index;
+    unsigned char cost;
+  };
+  using CellUpdates = std::vector<CellUpdate>;
+
+  /**
+   * @brief raytrace or set a cell from multiple threads, the cells are written with relaxed atomic
+   * stores. the map is the same as with sequential calls only if the concurrent calls have the same
+   * cost.
+   */
+  void raytraceConcurrently(
+    const double source_x, const double source_y, const double target_x, const double target_y,
+    const unsigned char cost);
+  void setCellValueConcurrently(const double wx, const double wy, const unsigned char cost);
+
+  /**
+   * @brief record the cells to write instead of writing them, so that the cells of concurrent
+   * calls with different costs are written later in a chosen order with applyCellUpdates. it may be
+   * called from multiple threads with their own updates.
+   */
+  void raytrace(
+    const double source_x, const double source_y, const double target_x, const double target_y,
+    const unsigned char cost, CellUpdates & updates);
+  void setCellValue(
+    const double wx, const double wy, const unsigned char cost, CellUpdates & updates);
+  void applyCellUpdates(const CellUpdates & updates);
+
   virtual void initRosParam(rclcpp::Node & node) = 0;
 
 private:
   bool worldToMap(double wx, double wy, unsigned int & mx, unsigned int & my) const;
+  bool getRayCells(
+    const double source_x, const double source_y, const double target_x, const double target_y,
+    unsigned int & x0, unsigned int & y0, unsigned int & x1, unsigned int & y1) const;
+
+  template <class ActionType>
+  void raytraceWithAction(
+    const double source_x, const double source_y, const double target_x, const double target_y,
+    ActionType action)
+  {
+    unsigned int x0{};
+    unsigned int y0{};
+    unsigned int x1{};
+    unsigned int y1{};
+    if (!getRayCells(source_x, source_y, target_x, target_y, x0, y0, x1, y1)) {
+      return;
+    }
+    constexpr unsigned int cell_raytrace_range = 10000;  // large number to ignore range threshold
+    raytraceLine(action, x0, y0, x1, y1, cell_raytrace_range);
+  }
+
+  class ConcurrentMarkCell
+  {
+  public:
+    ConcurrentMarkCell(unsigned char * costmap, unsigned char value)
+    : costmap_(costmap), value_(value)
+    {
+    }
+    inline void operator()(unsigned int offset)
+    {
+      __atomic_store_n(costmap_ + offset, value_, __ATOMIC_RELAXED);
+    }
+
+  private:
+    unsigned char * costmap_;
+    unsigned char value_;
+  };
+
+  class RecordCell
+  {
+  public:
+    RecordCell(CellUpdates & updates, unsigned char value) : updates_(updates), value_(value) {}
+    inline void operator()(unsigned int offset) { updates_.push_back({offset, value_}); }
+
+  private:
+    CellUpdates & updates_;
+    unsigned char value_;
+  };
 
   rclcpp::Logger logger_{rclcpp::get_logger("pointcloud_based_occupancy_grid_map")};
   rclcpp::Clock clock_{RCL_ROS_TIME};
@@ -15,6 +15,7 @@
 #ifndef PROBABILISTIC_OCCUPANCY_GRID_MAP__POINTCLOUD_BASED_OCCUPANCY_GRID_MAP__OCCUPANCY_GRID_MAP_FIXED_HPP_
 #define PROBABILISTIC_OCCUPANCY_GRID_MAP__POINTCLOUD_BASED_OCCUPANCY_GRID_MAP__OCCUPANCY_GRID_MAP_FIXED_HPP_
 
+#include "probabilistic_occupancy_grid_map/pointcloud_based_occupancy_grid_map/angle_bins.hpp"
 #include "probabilistic_occupancy_grid_map/pointcloud_based_occupancy_grid_map/occupancy_grid_map_base.hpp"
 
 namespace costmap_2d
@@ -40,6 +41,9 @@ public:
 
 private:
   double distance_margin_;
+  AngleBins raw_pointcloud_angle_bins_;
+  AngleBins obstacle_pointcloud_angle_bins_;
+  std::vector<CellUpdates> sector_cell_updates_;
 };
 
 }  // namespace costmap_2d
@@ -15,12 +15,15 @@
 #ifndef PROBABILISTIC_OCCUPANCY_GRID_MAP__POINTCLOUD_BASED_OCCUPANCY_GRID_MAP__OCCUPANCY_GRID_MAP_PROJECTIVE_HPP_
 #define PROBABILISTIC_OCCUPANCY_GRID_MAP__POINTCLOUD_BASED_OCCUPANCY_GRID_MAP__OCCUPANCY_GRID_MAP_PROJECTIVE_HPP_
 
+#include "probabilistic_occupancy_grid_map/pointcloud_based_occupancy_grid_map/angle_bins.hpp"
 #include "probabilistic_occupancy_grid_map/pointcloud_based_occupancy_grid_map/occupancy_grid_map_base.hpp"
 
 #include <grid_map_core/GridMap.hpp>
 
 #include <grid_map_msgs/msg/grid_map.hpp>
 
+#include <vector>
+
 namespace costmap_2d
 {
 using geometry_msgs::msg::Pose;
@@ -48,6 +51,9 @@ private:
   bool pub_debug_grid_;
   grid_map::GridMap debug_grid_;
   rclcpp::Publisher<grid_map_msgs::msg::GridMap>::SharedPtr debug_grid_map_publisher_ptr_;
+  AngleBins raw_pointcloud_angle_bins_;
+  AngleBins obstacle_pointcloud_angle_bins_;
+  std::vector<CellUpdates> sector_cell_updates_;
 };
 
 }  // namespace costmap_2d
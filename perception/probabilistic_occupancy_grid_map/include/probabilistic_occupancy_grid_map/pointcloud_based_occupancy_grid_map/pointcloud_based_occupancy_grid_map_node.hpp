@@ -35,6 +35,10 @@
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
+#if ENABLE_GPU
+#include "probabilistic_occupancy_grid_map/occupancy_grid_map_cuda/occupancy_grid_map_cuda.hpp"
+#endif
+
 #include <memory>
 #include <string>
 
@@ -80,6 +84,9 @@ private:
 
   std::unique_ptr<OccupancyGridMapInterface> occupancy_grid_map_ptr_;
   std::unique_ptr<OccupancyGridMapUpdaterInterface> occupancy_grid_map_updater_ptr_;
+#if ENABLE_GPU
+  std::unique_ptr<costmap_2d::OccupancyGridMapCuda> cuda_occupancy_grid_map_ptr_{nullptr};
+#endif
 
   // ROS Parameters
   std::string map_frame_;
@@ -91,6 +98,7 @@ private:
   double max_height_;
   bool enable_single_frame_mode_;
   bool filter_obstacle_pointcloud_by_raw_pointcloud_;
+  bool use_cuda_;  // to run the fixed blind spot map and the binary bayes filter on the GPU
 };
 
 }  // namespace occupancy_grid_map
@@ -14,6 +14,9 @@
 
 #include "probabilistic_occupancy_grid_map/fusion/single_frame_fusion_policy.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace fusion_policy
 {
 
@@ -145,6 +148,63 @@ double logOddsFusion(const std::vector<double> & probabilities, const std::vecto
   }
   return 1.0 / (1.0 + std::exp(-log_odds));
 }
+
+/**
+ * @brief log-odds of an occupancy, clamped in the same way as logOddsFusion()
+ *
+ * @param occupancy [0, 255]
+ * @return double
+ */
+double convertCharToLogOdds(const unsigned char & occupancy)
+{
+  const double p = std::max(
+    EPSILON_PROB, std::min(1.0 - EPSILON_PROB, convertCharToProbability(occupancy)));
+  return std::log(p / (1.0 - p));
+}
+
+/**
+ * @brief weighted log-odds fusion of rows of cells, the same as singleFrameOccupancyFusion() with
+ * FusionMethod::LOG_ODDS on each cell. the log-odds are looked up in a table so that the loops
+ * over the cells of a row are vectorized.
+ *
+ * @param occupancy_rows : rows of cells to be fused, each with cells_num cells [0, 255]
+ * @param weights : weights of rows
+ * @param cells_num : number of cells of a row
+ * @param fused_row : output row with cells_num cells [0, 255]
+ */
+void logOddsFusion(
+  const std::vector<const unsigned char *> & occupancy_rows, const std::vector<double> & weights,
+  const std::size_t cells_num, unsigned char * fused_row)
+{
+  static const std::array<double, 256> log_odds_table = []() {
+    std::array<double, 256> table{};
+    for (std::size_t i = 0; i < table.size(); ++i) {
+      table[i] = convertCharToLogOdds(static_cast<unsigned char>(i));
+    }
+    return table;
+  }();
+
+  // check if the size of rows and weights are the same
+  const bool is_weighted = occupancy_rows.size() == weights.size();
+  if (!is_weighted) {
+    // warning and return normal log-odds fusion
+    std::cout << "The size of occupancy rows and weights are not the same. Return normal "
+                 "log-odds fusion."
+              << std::endl;
+  }
+
+  std::vector<double> log_odds(cells_num, 0.0);
+  for (std::size_t i = 0; i < occupancy_rows.size(); ++i) {
+    const unsigned char * row = occupancy_rows[i];
+    const double weight = is_weighted ? weights[i] : 1.0;
+    for (std::size_t x = 0; x < cells_num; ++x) {
+      log_odds[x] += weight * log_odds_table[row[x]];
+    }
+  }
+  for (std::size_t x = 0; x < cells_num; ++x) {
+    fused_row[x] = convertProbabilityToChar(1.0 / (1.0 + std::exp(-log_odds[x])));
+  }
+}
 }  // namespace log_odds_fusion
 
 /// @brief fusion with Dempster-Shafer Theory
@@ -17,6 +17,10 @@
 #include "probabilistic_occupancy_grid_map/cost_value.hpp"
 #include "probabilistic_occupancy_grid_map/utils/utils.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
 // cspell: ignore LOBF
 
 namespace synchronized_grid_map_fusion
@@ -270,12 +274,12 @@ void GridMapFusionNode::publish()
   builtin_interfaces::msg::Time latest_stamp = get_clock()->now();
   double height = 0.0;
 
-  // merge available gridmap
-  std::vector<OccupancyGridMapFixedBlindSpot> subscribed_maps;
+  // merge available gridmap, the messages are read in place
+  std::vector<nav_msgs::msg::OccupancyGrid::ConstSharedPtr> subscribed_maps;
   std::vector<double> weights;
   for (const auto & e : gridmap_dict_) {
     if (e.second != nullptr) {
-      subscribed_maps.push_back(GridMapFusionNode::OccupancyGridMsgToGridMap(*e.second));
+      subscribed_maps.push_back(e.second);
       weights.push_back(input_topic_weights_map_[e.first]);
       latest_stamp = e.second->header.stamp;
       height = e.second->info.origin.position.z;
@@ -325,12 +329,12 @@ void GridMapFusionNode::publish()
 }
 
 OccupancyGridMapFixedBlindSpot GridMapFusionNode::SingleFrameOccupancyFusion(
-  std::vector<OccupancyGridMapFixedBlindSpot> & occupancy_grid_maps,
+  const std::vector<nav_msgs::msg::OccupancyGrid::ConstSharedPtr> & occupancy_grid_msgs,
   const builtin_interfaces::msg::Time latest_stamp, const std::vector<double> & weights)
 {
   // if only single map
-  if (occupancy_grid_maps.size() == 1) {
-    return occupancy_grid_maps[0];
+  if (occupancy_grid_msgs.size() == 1) {
+    return OccupancyGridMsgToGridMap(*occupancy_grid_msgs[0]);
   }
 
   // get map to gridmap_origin_frame_ transform
@@ -339,36 +343,76 @@ OccupancyGridMapFixedBlindSpot GridMapFusionNode::SingleFrameOccupancyFusion(
     gridmap_origin = utils::getPose(latest_stamp, tf_buffer_, gridmap_origin_frame_, map_frame_);
   } catch (tf2::TransformException & ex) {
     RCLCPP_WARN_STREAM(get_logger(), ex.what());
-    return occupancy_grid_maps[0];
+    return OccupancyGridMsgToGridMap(*occupancy_grid_msgs[0]);
   }
 
   // init fused map with calculated origin
+  const auto & first_info = occupancy_grid_msgs[0]->info;
   OccupancyGridMapFixedBlindSpot fused_map(
-    occupancy_grid_maps[0].getSizeInCellsX(), occupancy_grid_maps[0].getSizeInCellsY(),
-    occupancy_grid_maps[0].getResolution());
+    first_info.width, first_info.height, first_info.resolution);
   fused_map.updateOrigin(
     gridmap_origin.position.x - fused_map.getSizeInMetersX() / 2,
     gridmap_origin.position.y - fused_map.getSizeInMetersY() / 2);
 
-  // fix origin of each map
-  for (auto & map : occupancy_grid_maps) {
-    map.updateOrigin(fused_map.getOriginX(), fused_map.getOriginY());
+  // the cell offset of each map to the fused map, the same as converting the message with
+  // OccupancyGridMsgToGridMap() and moving the converted map to the origin of the fused map
+  const double resolution = fused_map.getResolution();
+  std::vector<std::pair<int, int>> cell_offsets;
+  for (const auto & msg : occupancy_grid_msgs) {
+    const double map_origin_x = std::floor(msg->info.origin.position.x / resolution) * resolution;
+    const double map_origin_y = std::floor(msg->info.origin.position.y / resolution) * resolution;
+    cell_offsets.emplace_back(
+      static_cast<int>(std::floor((fused_map.getOriginX() - map_origin_x) / resolution)),
+      static_cast<int>(std::floor((fused_map.getOriginY() - map_origin_y) / resolution)));
   }
 
-  // assume map is same size and resolutions
-  for (unsigned int x = 0; x < fused_map.getSizeInCellsX(); x++) {
-    for (unsigned int y = 0; y < fused_map.getSizeInCellsY(); y++) {
-      // get cost of each map
-      std::vector<unsigned char> costs;
-      for (auto & map : occupancy_grid_maps) {
-        costs.push_back(map.getCost(x, y));
+  // assume map is same size and resolutions, each block of rows is fused by one thread
+  const int size_x = static_cast<int>(fused_map.getSizeInCellsX());
+  const int size_y = static_cast<int>(fused_map.getSizeInCellsY());
+  const std::size_t maps_num = occupancy_grid_msgs.size();
+  unsigned char * fused_data = fused_map.getCharMap();
+#pragma omp parallel
+  {
+    std::vector<std::vector<unsigned char>> rows(maps_num, std::vector<unsigned char>(size_x));
+    std::vector<const unsigned char *> row_ptrs;
+    for (const auto & row : rows) {
+      row_ptrs.push_back(row.data());
+    }
+    std::vector<unsigned char> costs(maps_num);
+
+#pragma omp for schedule(static)
+    for (int y = 0; y < size_y; ++y) {
+      // get cost of each map, out of the map is unknown
+      for (std::size_t i = 0; i < maps_num; ++i) {
+        const auto & msg = *occupancy_grid_msgs[i];
+        const int width = static_cast<int>(msg.info.width);
+        const int src_y = y + cell_offsets[i].second;
+        auto & row = rows[i];
+        std::fill(row.begin(), row.end(), occupancy_cost_value::NO_INFORMATION);
+        if (src_y < 0 || static_cast<int>(msg.info.height) <= src_y) {
+          continue;
+        }
+        const int offset_x = cell_offsets[i].first;
+        const int begin_x = std::max(0, -offset_x);
+        const int end_x = std::min(size_x, width - offset_x);
+        const int8_t * src_row = msg.data.data() + static_cast<std::size_t>(src_y) * width;
+        for (int x = begin_x; x < end_x; ++x) {
+          row[x] = occupancy_cost_value::inverse_cost_translation_table[src_row[x + offset_x]];
+        }
       }
 
       // set fusion policy
-      auto fused_cost = fusion_policy::singleFrameOccupancyFusion(costs, fusion_method_, weights);
-
-      // set max cost to fused map
-      fused_map.setCost(x, y, fused_cost);
+      unsigned char * fused_row = fused_data + static_cast<std::size_t>(y) * size_x;
+      if (fusion_method_ == fusion_policy::FusionMethod::LOG_ODDS) {
+        fusion_policy::log_odds_fusion::logOddsFusion(row_ptrs, weights, size_x, fused_row);
+        continue;
+      }
+      for (int x = 0; x < size_x; ++x) {
+        for (std::size_t i = 0; i < maps_num; ++i) {
+          costs[i] = rows[i][x];
+        }
+        fused_row[x] = fusion_policy::singleFrameOccupancyFusion(costs, fusion_method_, weights);
+      }
     }
   }
 
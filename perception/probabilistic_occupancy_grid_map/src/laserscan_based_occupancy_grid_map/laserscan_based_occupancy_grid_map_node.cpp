@@ -18,6 +18,7 @@
 #include "probabilistic_occupancy_grid_map/utils/utils.hpp"
 
 #include <pcl_ros/transforms.hpp>
+#include <tier4_autoware_utils/ros/loaned_message_publisher.hpp>
 
 #include <nav_msgs/msg/occupancy_grid.hpp>
 
@@ -190,17 +191,21 @@ void LaserscanBasedOccupancyGridMapNode::onLaserscanPointCloud2WithObstacleAndRa
 
   if (enable_single_frame_mode_) {
     // publish
-    occupancy_grid_map_pub_->publish(OccupancyGridMapToMsgPtr(
-      map_frame_, laserscan_pc_ptr->header.stamp, gridmap_origin.position.z,
-      single_frame_occupancy_grid_map));
+    tier4_autoware_utils::publishLoanedOrMoved(
+      occupancy_grid_map_pub_,
+      OccupancyGridMapToMsgPtr(
+        map_frame_, laserscan_pc_ptr->header.stamp, gridmap_origin.position.z,
+        single_frame_occupancy_grid_map));
   } else {
     // Update with bayes filter
     occupancy_grid_map_updater_ptr_->update(single_frame_occupancy_grid_map);
 
     // publish
-    occupancy_grid_map_pub_->publish(OccupancyGridMapToMsgPtr(
-      map_frame_, laserscan_pc_ptr->header.stamp, gridmap_origin.position.z,
-      *occupancy_grid_map_updater_ptr_));
+    tier4_autoware_utils::publishLoanedOrMoved(
+      occupancy_grid_map_pub_,
+      OccupancyGridMapToMsgPtr(
+        map_frame_, laserscan_pc_ptr->header.stamp, gridmap_origin.position.z,
+        *occupancy_grid_map_updater_ptr_));
   }
 }
 
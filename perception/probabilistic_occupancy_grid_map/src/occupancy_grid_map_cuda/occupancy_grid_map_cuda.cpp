@@ -0,0 +1,232 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "probabilistic_occupancy_grid_map/occupancy_grid_map_cuda/occupancy_grid_map_cuda.hpp"
+
+#include "probabilistic_occupancy_grid_map/cost_value.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <cuda_utils/cuda_check_error.hpp>
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+
+#ifdef ROS_DISTRO_GALACTIC
+#include <tf2_eigen/tf2_eigen.h>
+#else
+#include <tf2_eigen/tf2_eigen.hpp>
+#endif
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace
+{
+Eigen::Affine3d poseToAffine(const geometry_msgs::msg::Pose & pose)
+{
+  return tf2::transformToEigen(tier4_autoware_utils::pose2transform(pose));
+}
+
+uint32_t getFieldOffset(const sensor_msgs::msg::PointCloud2 & pointcloud, const std::string & name)
+{
+  for (const auto & field : pointcloud.fields) {
+    if (field.name == name) {
+      return field.offset;
+    }
+  }
+  throw std::runtime_error("Field " + name + " does not exist");
+}
+}  // namespace
+
+namespace costmap_2d
+{
+OccupancyGridMapCuda::OccupancyGridMapCuda(
+  const uint32_t cells_size_x, const uint32_t cells_size_y, const double resolution,
+  const double distance_margin, const BinaryBayesFilterCudaParam & bbf_param)
+: stream_(cuda_utils::makeCudaStream(cudaStreamNonBlocking)),
+  map_param_{0.0, 0.0, resolution, cells_size_x, cells_size_y},
+  distance_margin_(static_cast<float>(distance_margin)),
+  bbf_param_(bbf_param)
+{
+  if (!stream_) {
+    throw std::runtime_error("failed to create a CUDA stream for the occupancy grid map");
+  }
+  const std::size_t cells_num = static_cast<std::size_t>(cells_size_x) * cells_size_y;
+  cell_writes_d_ = cuda_utils::make_unique<uint64_t[]>(cells_num);
+  single_frame_map_d_ = cuda_utils::make_unique<uint8_t[]>(cells_num);
+  updated_map_d_ = cuda_utils::make_unique<uint8_t[]>(cells_num);
+  shifted_map_d_ = cuda_utils::make_unique<uint8_t[]>(cells_num);
+  raw_bins_.bin_begins = cuda_utils::make_unique<uint32_t[]>(CUDA_ANGLE_BINS_NUM + 1);
+  obstacle_bins_.bin_begins = cuda_utils::make_unique<uint32_t[]>(CUDA_ANGLE_BINS_NUM + 1);
+
+  CHECK_CUDA_ERROR(cudaMemsetAsync(
+    updated_map_d_.get(), occupancy_cost_value::NO_INFORMATION, cells_num, *stream_));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(*stream_));
+}
+
+void OccupancyGridMapCuda::reservePoints(
+  AngleBinsDevice & bins, const std::size_t points_num, const std::size_t point_step)
+{
+  const std::size_t points_bytes = points_num * point_step;
+  if (points_bytes > bins.points_bytes_capacity) {
+    bins.points = cuda_utils::make_unique<uint8_t[]>(points_bytes);
+    bins.points_bytes_capacity = points_bytes;
+  }
+  if (points_num > bins.points_capacity) {
+    bins.points_xyzr = cuda_utils::make_unique<float4[]>(points_num);
+    bins.sort_keys = cuda_utils::make_unique<uint64_t[]>(points_num);
+    bins.sorted_keys = cuda_utils::make_unique<uint64_t[]>(points_num);
+    bins.sort_indices = cuda_utils::make_unique<uint32_t[]>(points_num);
+    bins.sorted_indices = cuda_utils::make_unique<uint32_t[]>(points_num);
+    bins.sorted_points = cuda_utils::make_unique<float4[]>(points_num);
+    bins.points_capacity = points_num;
+  }
+}
+
+void OccupancyGridMapCuda::reserveTempStorage(const std::size_t temp_storage_bytes)
+{
+  if (temp_storage_bytes > temp_storage_capacity_) {
+    temp_storage_d_ = cuda_utils::make_unique<uint8_t[]>(temp_storage_bytes);
+    temp_storage_capacity_ = temp_storage_bytes;
+  }
+}
+
+void OccupancyGridMapCuda::createAngleBins(
+  const sensor_msgs::msg::PointCloud2 & pointcloud, const PointTransformCudaParam & transform,
+  const AngleBinsDevice * range_limit_bins, AngleBinsDevice & bins)
+{
+  const std::size_t points_num = static_cast<std::size_t>(pointcloud.width) * pointcloud.height;
+  const std::size_t point_step = pointcloud.point_step;
+  cudaStream_t stream = *stream_;
+  reservePoints(bins, points_num, point_step);
+
+  if (points_num > 0) {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      bins.points.get(), pointcloud.data.data(), points_num * point_step, cudaMemcpyHostToDevice,
+      stream));
+    CHECK_CUDA_ERROR(convertPoints_launch(
+      bins.points.get(), points_num, point_step, getFieldOffset(pointcloud, "x"),
+      getFieldOffset(pointcloud, "y"), getFieldOffset(pointcloud, "z"), transform,
+      range_limit_bins ? range_limit_bins->sorted_keys.get() : nullptr,
+      range_limit_bins ? range_limit_bins->bin_begins.get() : nullptr, bins.points_xyzr.get(),
+      bins.sort_keys.get(), bins.sort_indices.get(), stream));
+
+    std::size_t temp_storage_bytes = 0;
+    CHECK_CUDA_ERROR(sortPointsByAngleBin_launch(
+      nullptr, temp_storage_bytes, bins.sort_keys.get(), bins.sorted_keys.get(),
+      bins.sort_indices.get(), bins.sorted_indices.get(), points_num, stream));
+    reserveTempStorage(temp_storage_bytes);
+    CHECK_CUDA_ERROR(sortPointsByAngleBin_launch(
+      temp_storage_d_.get(), temp_storage_bytes, bins.sort_keys.get(), bins.sorted_keys.get(),
+      bins.sort_indices.get(), bins.sorted_indices.get(), points_num, stream));
+  }
+  CHECK_CUDA_ERROR(gatherPointsByAngleBin_launch(
+    bins.points_xyzr.get(), bins.sorted_keys.get(), bins.sorted_indices.get(), points_num,
+    bins.sorted_points.get(), bins.bin_begins.get(), stream));
+}
+
+void OccupancyGridMapCuda::updateWithPointCloud(
+  const sensor_msgs::msg::PointCloud2 & raw_pointcloud,
+  const sensor_msgs::msg::PointCloud2 & obstacle_pointcloud,
+  const geometry_msgs::msg::Pose & robot_pose, const geometry_msgs::msg::Pose & scan_origin,
+  const double origin_x, const double origin_y)
+{
+  map_param_.origin_x = origin_x;
+  map_param_.origin_y = origin_y;
+  const std::size_t cells_num = static_cast<std::size_t>(map_param_.size_x) * map_param_.size_y;
+  cudaStream_t stream = *stream_;
+
+  // robot -> map and robot -> scan transforms, the same as createAngleBins()
+  const Eigen::Affine3d robot_to_map = poseToAffine(robot_pose);
+  const Eigen::Matrix4f map_matrix = robot_to_map.matrix().cast<float>();
+  const Eigen::Matrix4f scan_matrix =
+    (poseToAffine(scan_origin).inverse() * robot_to_map).matrix().cast<float>();
+  PointTransformCudaParam transform;
+  for (int row = 0; row < 3; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      transform.robot_to_map[row * 4 + col] = map_matrix(row, col);
+      transform.robot_to_scan[row * 4 + col] = scan_matrix(row, col);
+    }
+  }
+
+  // the obstacle points exceeding the range of the raw points are dropped
+  createAngleBins(raw_pointcloud, transform, nullptr, raw_bins_);
+  createAngleBins(obstacle_pointcloud, transform, &raw_bins_, obstacle_bins_);
+
+  CHECK_CUDA_ERROR(cudaMemsetAsync(
+    single_frame_map_d_.get(), occupancy_cost_value::NO_INFORMATION, cells_num, stream));
+  CHECK_CUDA_ERROR(cudaMemsetAsync(cell_writes_d_.get(), 0, cells_num * sizeof(uint64_t), stream));
+
+  // First step: Initialize cells to the final point with freespace
+  CHECK_CUDA_ERROR(raytraceFreeSpace_launch(
+    raw_bins_.sorted_points.get(), raw_bins_.bin_begins.get(), scan_origin.position.x,
+    scan_origin.position.y, map_param_, single_frame_map_d_.get(), stream));
+
+  // Second step: Add unknown cell
+  CHECK_CUDA_ERROR(addUnknownCells_launch(
+    raw_bins_.sorted_points.get(), raw_bins_.bin_begins.get(), obstacle_bins_.sorted_points.get(),
+    obstacle_bins_.bin_begins.get(), distance_margin_, map_param_, cell_writes_d_.get(), stream));
+  CHECK_CUDA_ERROR(
+    applyCellWrites_launch(cell_writes_d_.get(), cells_num, single_frame_map_d_.get(), stream));
+
+  // Third step: Overwrite occupied cell
+  CHECK_CUDA_ERROR(addObstacleCells_launch(
+    obstacle_bins_.sorted_points.get(), obstacle_bins_.bin_begins.get(), distance_margin_,
+    map_param_, single_frame_map_d_.get(), stream));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream));
+}
+
+void OccupancyGridMapCuda::updateBinaryBayesFilter()
+{
+  cudaStream_t stream = *stream_;
+  const std::size_t cells_num = static_cast<std::size_t>(map_param_.size_x) * map_param_.size_y;
+
+  // project the new origin into the grid, keeping things grid-aligned
+  const double resolution = map_param_.resolution;
+  const int cell_ox =
+    static_cast<int>(std::floor((map_param_.origin_x - updated_map_origin_x_) / resolution));
+  const int cell_oy =
+    static_cast<int>(std::floor((map_param_.origin_y - updated_map_origin_y_) / resolution));
+  if (cell_ox != 0 || cell_oy != 0) {
+    CHECK_CUDA_ERROR(shiftMap_launch(
+      updated_map_d_.get(), map_param_.size_x, map_param_.size_y, cell_ox, cell_oy,
+      occupancy_cost_value::NO_INFORMATION, shifted_map_d_.get(), stream));
+    std::swap(updated_map_d_, shifted_map_d_);
+  }
+  updated_map_origin_x_ = updated_map_origin_x_ + cell_ox * resolution;
+  updated_map_origin_y_ = updated_map_origin_y_ + cell_oy * resolution;
+
+  CHECK_CUDA_ERROR(applyBinaryBayesFilter_launch(
+    single_frame_map_d_.get(), cells_num, bbf_param_, updated_map_d_.get(), stream));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream));
+}
+
+void OccupancyGridMapCuda::copySingleFrameMapToHost(uint8_t * dst) const
+{
+  const std::size_t cells_num = static_cast<std::size_t>(map_param_.size_x) * map_param_.size_y;
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    dst, single_frame_map_d_.get(), cells_num, cudaMemcpyDeviceToHost, *stream_));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(*stream_));
+}
+
+void OccupancyGridMapCuda::copyUpdatedMapToHost(uint8_t * dst) const
+{
+  const std::size_t cells_num = static_cast<std::size_t>(map_param_.size_x) * map_param_.size_y;
+  CHECK_CUDA_ERROR(
+    cudaMemcpyAsync(dst, updated_map_d_.get(), cells_num, cudaMemcpyDeviceToHost, *stream_));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(*stream_));
+}
+
+}  // namespace costmap_2d
@@ -0,0 +1,506 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "probabilistic_occupancy_grid_map/cost_value.hpp"
+#include "probabilistic_occupancy_grid_map/occupancy_grid_map_cuda/occupancy_grid_map_kernel.hpp"
+
+#include <cub/cub.cuh>
+
+namespace
+{
+const std::size_t THREADS_PER_BLOCK = 256;
+const std::size_t BINS_PER_BLOCK = 64;
+constexpr double MIN_ANGLE = -M_PI;
+constexpr double ANGLE_INCREMENT = M_PI / 1800.0;
+// the keys hold the range in the lower 32 bits and the angle bin above them
+const int SORT_KEY_END_BIT = 44;
+static_assert(costmap_2d::CUDA_ANGLE_BINS_NUM < (1U << (SORT_KEY_END_BIT - 32)), "too many bins");
+
+std::size_t divup(const std::size_t a, const std::size_t b)
+{
+  return (a + b - 1) / b;
+}
+}  // namespace
+
+namespace costmap_2d
+{
+__device__ inline float readFloat(const uint8_t * data)
+{
+  float value;
+  memcpy(&value, data, sizeof(float));
+  return value;
+}
+
+__device__ inline uint64_t toSortKey(const uint32_t bin_index, const float range)
+{
+  return (static_cast<uint64_t>(bin_index) << 32) | __float_as_uint(range);
+}
+
+__device__ inline float rangeOfSortKey(const uint64_t key)
+{
+  return __uint_as_float(static_cast<uint32_t>(key & 0xffffffffULL));
+}
+
+__device__ inline bool worldToMap(
+  const double wx, const double wy, const GridMapCudaParam & map, uint32_t & mx, uint32_t & my)
+{
+  if (wx < map.origin_x || wy < map.origin_y) {
+    return false;
+  }
+  mx = static_cast<int>(floor((wx - map.origin_x) / map.resolution));
+  my = static_cast<int>(floor((wy - map.origin_y) / map.resolution));
+  return mx < map.size_x && my < map.size_y;
+}
+
+// the same clipping of the ray to the map as OccupancyGridMapInterface::raytrace()
+__device__ bool getRayCells(
+  const double ox, const double oy, const double target_x, const double target_y,
+  const GridMapCudaParam & map, uint32_t & x0, uint32_t & y0, uint32_t & x1, uint32_t & y1)
+{
+  if (!worldToMap(ox, oy, map, x0, y0)) {
+    return false;
+  }
+  const double map_end_x = map.origin_x + map.size_x * map.resolution;
+  const double map_end_y = map.origin_y + map.size_y * map.resolution;
+  double wx = target_x;
+  double wy = target_y;
+  const double a = wx - ox;
+  const double b = wy - oy;
+  if (wx < map.origin_x) {
+    const double t = (map.origin_x - ox) / a;
+    wx = map.origin_x;
+    wy = oy + b * t;
+  }
+  if (wy < map.origin_y) {
+    const double t = (map.origin_y - oy) / b;
+    wx = ox + a * t;
+    wy = map.origin_y;
+  }
+  if (wx > map_end_x) {
+    const double t = (map_end_x - ox) / a;
+    wx = map_end_x - .001;
+    wy = oy + b * t;
+  }
+  if (wy > map_end_y) {
+    const double t = (map_end_y - oy) / b;
+    wx = ox + a * t;
+    wy = map_end_y - .001;
+  }
+  return worldToMap(wx, wy, map, x1, y1);
+}
+
+// the same cells as nav2_costmap_2d::Costmap2D::raytraceLine() without the length limits
+template <class ActionType>
+__device__ void raytrace(
+  const double source_x, const double source_y, const double target_x, const double target_y,
+  const GridMapCudaParam & map, ActionType & action)
+{
+  uint32_t x0, y0, x1, y1;
+  if (!getRayCells(source_x, source_y, target_x, target_y, map, x0, y0, x1, y1)) {
+    return;
+  }
+  const int dx = static_cast<int>(x1) - static_cast<int>(x0);
+  const int dy = static_cast<int>(y1) - static_cast<int>(y0);
+  const uint32_t abs_dx = abs(dx);
+  const uint32_t abs_dy = abs(dy);
+  const int offset_dx = dx > 0 ? 1 : -1;
+  const int offset_dy = (dy > 0 ? 1 : -1) * static_cast<int>(map.size_x);
+  const bool is_x_dominant = abs_dx >= abs_dy;
+  const uint32_t abs_da = is_x_dominant ? abs_dx : abs_dy;
+  const uint32_t abs_db = is_x_dominant ? abs_dy : abs_dx;
+  const int offset_a = is_x_dominant ? offset_dx : offset_dy;
+  const int offset_b = is_x_dominant ? offset_dy : offset_dx;
+  int error_b = abs_da / 2;
+  uint32_t offset = y0 * map.size_x + x0;
+  for (uint32_t i = 0; i < abs_da; ++i) {
+    action(offset);
+    offset += offset_a;
+    error_b += abs_db;
+    if (static_cast<uint32_t>(error_b) >= abs_da) {
+      offset += offset_b;
+      error_b -= abs_da;
+    }
+  }
+  action(offset);
+}
+
+template <class ActionType>
+__device__ void setCellValue(
+  const double wx, const double wy, const GridMapCudaParam & map, ActionType & action)
+{
+  uint32_t mx, my;
+  if (worldToMap(wx, wy, map, mx, my)) {
+    action(my * map.size_x + mx);
+  }
+}
+
+struct MarkCell
+{
+  uint8_t * costmap;
+  uint8_t cost;
+  __device__ void operator()(const uint32_t offset) { costmap[offset] = cost; }
+};
+
+// the write keys of a bin grow with the write order, and the keys of a bin are above the ones of
+// the former bins
+struct RecordCell
+{
+  unsigned long long * cell_writes;  // NOLINT
+  uint64_t key_base;
+  uint32_t write_index;
+  uint8_t cost;
+  __device__ void operator()(const uint32_t offset)
+  {
+    const uint64_t key = key_base | (static_cast<uint64_t>(++write_index) << 8) | cost;
+    atomicMax(cell_writes + offset, static_cast<unsigned long long>(key));  // NOLINT
+  }
+};
+
+__global__ void convertPoints_kernel(
+  const uint8_t * __restrict__ points, const std::size_t points_num, const std::size_t point_step,
+  const uint32_t x_offset, const uint32_t y_offset, const uint32_t z_offset,
+  const PointTransformCudaParam transform, const uint64_t * __restrict__ limit_sorted_keys,
+  const uint32_t * __restrict__ limit_bin_begins, float4 * __restrict__ points_xyzr,
+  uint64_t * __restrict__ sort_keys, uint32_t * __restrict__ sort_indices)
+{
+  const std::size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= points_num) {
+    return;
+  }
+  const uint8_t * point = points + i * point_step;
+  const float x = readFloat(point + x_offset);
+  const float y = readFloat(point + y_offset);
+  const float z = readFloat(point + z_offset);
+  const float * m = transform.robot_to_map;
+  const float * s = transform.robot_to_scan;
+  const float wx = m[0] * x + m[1] * y + m[2] * z + m[3];
+  const float wy = m[4] * x + m[5] * y + m[6] * z + m[7];
+  const float wz = m[8] * x + m[9] * y + m[10] * z + m[11];
+  const float scan_x = s[0] * x + s[1] * y + s[2] * z + s[3];
+  const float scan_y = s[4] * x + s[5] * y + s[6] * z + s[7];
+  const float range = sqrtf(scan_x * scan_x + scan_y * scan_y);
+  points_xyzr[i] = make_float4(wx, wy, wz, range);
+  sort_indices[i] = static_cast<uint32_t>(i);
+
+  bool is_dropped = !isfinite(wx) || !isfinite(wy) || !isfinite(wz) || !isfinite(range);
+  uint32_t bin_index = CUDA_ANGLE_BINS_NUM;
+  if (!is_dropped) {
+    const double bin = (static_cast<double>(atan2f(scan_y, scan_x)) - MIN_ANGLE) / ANGLE_INCREMENT;
+    bin_index = min(static_cast<uint32_t>(fmax(bin, 0.0)), CUDA_ANGLE_BINS_NUM - 1);
+  }
+  if (!is_dropped && limit_sorted_keys) {
+    const uint32_t limit_begin = limit_bin_begins[bin_index];
+    const uint32_t limit_end = limit_bin_begins[bin_index + 1];
+    is_dropped =
+      limit_begin == limit_end || range > rangeOfSortKey(limit_sorted_keys[limit_end - 1]);
+  }
+  sort_keys[i] = toSortKey(is_dropped ? CUDA_ANGLE_BINS_NUM : bin_index, range);
+}
+
+cudaError_t convertPoints_launch(
+  const uint8_t * points, const std::size_t points_num, const std::size_t point_step,
+  const uint32_t x_offset, const uint32_t y_offset, const uint32_t z_offset,
+  const PointTransformCudaParam & transform, const uint64_t * limit_sorted_keys,
+  const uint32_t * limit_bin_begins, float4 * points_xyzr, uint64_t * sort_keys,
+  uint32_t * sort_indices, cudaStream_t stream)
+{
+  if (points_num == 0) {
+    return cudaSuccess;
+  }
+  convertPoints_kernel<<<divup(points_num, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+    points, points_num, point_step, x_offset, y_offset, z_offset, transform, limit_sorted_keys,
+    limit_bin_begins, points_xyzr, sort_keys, sort_indices);
+  return cudaGetLastError();
+}
+
+cudaError_t sortPointsByAngleBin_launch(
+  void * temp_storage, std::size_t & temp_storage_bytes, const uint64_t * sort_keys,
+  uint64_t * sorted_keys, const uint32_t * sort_indices, uint32_t * sorted_indices,
+  const std::size_t points_num, cudaStream_t stream)
+{
+  return cub::DeviceRadixSort::SortPairs(
+    temp_storage, temp_storage_bytes, sort_keys, sorted_keys, sort_indices, sorted_indices,
+    static_cast<int>(points_num), 0, SORT_KEY_END_BIT, stream);
+}
+
+__global__ void gatherPoints_kernel(
+  const float4 * __restrict__ points_xyzr, const uint32_t * __restrict__ sorted_indices,
+  const std::size_t points_num, float4 * __restrict__ sorted_points)
+{
+  const std::size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < points_num) {
+    sorted_points[i] = points_xyzr[sorted_indices[i]];
+  }
+}
+
+__global__ void findBinBegins_kernel(
+  const uint64_t * __restrict__ sorted_keys, const std::size_t points_num,
+  uint32_t * __restrict__ bin_begins)
+{
+  const uint32_t bin_index = blockIdx.x * blockDim.x + threadIdx.x;
+  if (bin_index > CUDA_ANGLE_BINS_NUM) {
+    return;
+  }
+  // the first point of the bin or of the later bins
+  const uint64_t key = static_cast<uint64_t>(bin_index) << 32;
+  std::size_t begin = 0;
+  std::size_t end = points_num;
+  while (begin < end) {
+    const std::size_t middle = (begin + end) / 2;
+    if (sorted_keys[middle] < key) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  bin_begins[bin_index] = static_cast<uint32_t>(begin);
+}
+
+cudaError_t gatherPointsByAngleBin_launch(
+  const float4 * points_xyzr, const uint64_t * sorted_keys, const uint32_t * sorted_indices,
+  const std::size_t points_num, float4 * sorted_points, uint32_t * bin_begins,
+  cudaStream_t stream)
+{
+  if (points_num > 0) {
+    gatherPoints_kernel<<<divup(points_num, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+      points_xyzr, sorted_indices, points_num, sorted_points);
+  }
+  findBinBegins_kernel<<<
+    divup(CUDA_ANGLE_BINS_NUM + 1, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+    sorted_keys, points_num, bin_begins);
+  return cudaGetLastError();
+}
+
+__global__ void raytraceFreeSpace_kernel(
+  const float4 * __restrict__ raw_points, const uint32_t * __restrict__ raw_bin_begins,
+  const double scan_origin_x, const double scan_origin_y, const GridMapCudaParam map,
+  uint8_t * costmap)
+{
+  const uint32_t bin_index = blockIdx.x * blockDim.x + threadIdx.x;
+  if (bin_index >= CUDA_ANGLE_BINS_NUM) {
+    return;
+  }
+  const uint32_t raw_begin = raw_bin_begins[bin_index];
+  const uint32_t raw_end = raw_bin_begins[bin_index + 1];
+  if (raw_begin == raw_end) {
+    return;
+  }
+  // all the writes have the same cost, so their order does not matter
+  MarkCell marker{costmap, occupancy_cost_value::FREE_SPACE};
+  const float4 ray_end = raw_points[raw_end - 1];
+  raytrace(scan_origin_x, scan_origin_y, ray_end.x, ray_end.y, map, marker);
+}
+
+cudaError_t raytraceFreeSpace_launch(
+  const float4 * raw_points, const uint32_t * raw_bin_begins, const double scan_origin_x,
+  const double scan_origin_y, const GridMapCudaParam & map, uint8_t * costmap,
+  cudaStream_t stream)
+{
+  raytraceFreeSpace_kernel<<<
+    divup(CUDA_ANGLE_BINS_NUM, BINS_PER_BLOCK), BINS_PER_BLOCK, 0, stream>>>(
+    raw_points, raw_bin_begins, scan_origin_x, scan_origin_y, map, costmap);
+  return cudaGetLastError();
+}
+
+__global__ void addUnknownCells_kernel(
+  const float4 * __restrict__ raw_points, const uint32_t * __restrict__ raw_bin_begins,
+  const float4 * __restrict__ obstacle_points, const uint32_t * __restrict__ obstacle_bin_begins,
+  const float distance_margin, const GridMapCudaParam map, uint64_t * cell_writes)
+{
+  const uint32_t bin_index = blockIdx.x * blockDim.x + threadIdx.x;
+  if (bin_index >= CUDA_ANGLE_BINS_NUM) {
+    return;
+  }
+  RecordCell recorder{
+    reinterpret_cast<unsigned long long *>(cell_writes),  // NOLINT
+    static_cast<uint64_t>(bin_index) << 40, 0, occupancy_cost_value::NO_INFORMATION};
+  const auto raytrace_unknown = [&](const float4 & source, const float4 & target) {
+    recorder.cost = occupancy_cost_value::NO_INFORMATION;
+    raytrace(source.x, source.y, target.x, target.y, map, recorder);
+  };
+  const auto set_free = [&](const float4 & target) {
+    recorder.cost = occupancy_cost_value::FREE_SPACE;
+    setCellValue(target.x, target.y, map, recorder);
+  };
+
+  const uint32_t obstacle_end = obstacle_bin_begins[bin_index + 1];
+  const uint32_t raw_end = raw_bin_begins[bin_index + 1];
+  uint32_t raw_distance_index = raw_bin_begins[bin_index];
+  for (uint32_t source = obstacle_bin_begins[bin_index]; source < obstacle_end; ++source) {
+    const float4 source_point = obstacle_points[source];
+    // Calculate next raw point from obstacle point
+    while (raw_distance_index < raw_end &&
+           raw_points[raw_distance_index].w < source_point.w + distance_margin) {
+      raw_distance_index++;
+    }
+    // There is no point far than the obstacle point.
+    const bool no_freespace_point = (raw_distance_index == raw_end);
+
+    if (source + 1 == obstacle_end) {
+      if (!no_freespace_point) {
+        raytrace_unknown(source_point, raw_points[raw_distance_index]);
+        set_free(raw_points[raw_distance_index]);
+      }
+      continue;
+    }
+
+    const float4 next_obstacle_point = obstacle_points[source + 1];
+    const float next_obstacle_point_distance = fabsf(next_obstacle_point.w - source_point.w);
+    if (next_obstacle_point_distance <= distance_margin) {
+      continue;
+    } else if (no_freespace_point) {
+      raytrace_unknown(source_point, next_obstacle_point);
+      continue;
+    }
+
+    const float4 raw_point = raw_points[raw_distance_index];
+    const float next_raw_distance = fabsf(source_point.w - raw_point.w);
+    if (next_raw_distance < next_obstacle_point_distance) {
+      raytrace_unknown(source_point, raw_point);
+      set_free(raw_point);
+    } else {
+      raytrace_unknown(source_point, next_obstacle_point);
+    }
+  }
+}
+
+cudaError_t addUnknownCells_launch(
+  const float4 * raw_points, const uint32_t * raw_bin_begins, const float4 * obstacle_points,
+  const uint32_t * obstacle_bin_begins, const float distance_margin, const GridMapCudaParam & map,
+  uint64_t * cell_writes, cudaStream_t stream)
+{
+  addUnknownCells_kernel<<<divup(CUDA_ANGLE_BINS_NUM, BINS_PER_BLOCK), BINS_PER_BLOCK, 0, stream>>>(
+    raw_points, raw_bin_begins, obstacle_points, obstacle_bin_begins, distance_margin, map,
+    cell_writes);
+  return cudaGetLastError();
+}
+
+__global__ void applyCellWrites_kernel(
+  const uint64_t * __restrict__ cell_writes, const std::size_t cells_num,
+  uint8_t * __restrict__ costmap)
+{
+  const std::size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < cells_num && cell_writes[i] != 0) {
+    costmap[i] = static_cast<uint8_t>(cell_writes[i] & 0xff);
+  }
+}
+
+cudaError_t applyCellWrites_launch(
+  const uint64_t * cell_writes, const std::size_t cells_num, uint8_t * costmap,
+  cudaStream_t stream)
+{
+  applyCellWrites_kernel<<<divup(cells_num, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+    cell_writes, cells_num, costmap);
+  return cudaGetLastError();
+}
+
+__global__ void addObstacleCells_kernel(
+  const float4 * __restrict__ obstacle_points, const uint32_t * __restrict__ obstacle_bin_begins,
+  const float distance_margin, const GridMapCudaParam map, uint8_t * costmap)
+{
+  const uint32_t bin_index = blockIdx.x * blockDim.x + threadIdx.x;
+  if (bin_index >= CUDA_ANGLE_BINS_NUM) {
+    return;
+  }
+  // all the writes have the same cost, so their order does not matter
+  MarkCell marker{costmap, occupancy_cost_value::LETHAL_OBSTACLE};
+  const uint32_t obstacle_end = obstacle_bin_begins[bin_index + 1];
+  for (uint32_t source = obstacle_bin_begins[bin_index]; source < obstacle_end; ++source) {
+    const float4 source_point = obstacle_points[source];
+    setCellValue(source_point.x, source_point.y, map, marker);
+    if (source + 1 == obstacle_end) {
+      continue;
+    }
+    const float4 target_point = obstacle_points[source + 1];
+    if (fabsf(target_point.w - source_point.w) <= distance_margin) {
+      raytrace(source_point.x, source_point.y, target_point.x, target_point.y, map, marker);
+    }
+  }
+}
+
+cudaError_t addObstacleCells_launch(
+  const float4 * obstacle_points, const uint32_t * obstacle_bin_begins,
+  const float distance_margin, const GridMapCudaParam & map, uint8_t * costmap,
+  cudaStream_t stream)
+{
+  addObstacleCells_kernel<<<
+    divup(CUDA_ANGLE_BINS_NUM, BINS_PER_BLOCK), BINS_PER_BLOCK, 0, stream>>>(
+    obstacle_points, obstacle_bin_begins, distance_margin, map, costmap);
+  return cudaGetLastError();
+}
+
+__global__ void shiftMap_kernel(
+  const uint8_t * __restrict__ src, const uint32_t size_x, const uint32_t size_y,
+  const int cell_offset_x, const int cell_offset_y, const uint8_t default_value,
+  uint8_t * __restrict__ dst)
+{
+  const std::size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= static_cast<std::size_t>(size_x) * size_y) {
+    return;
+  }
+  const int src_x = static_cast<int>(i % size_x) + cell_offset_x;
+  const int src_y = static_cast<int>(i / size_x) + cell_offset_y;
+  const bool is_inside = 0 <= src_x && src_x < static_cast<int>(size_x) && 0 <= src_y &&
+                         src_y < static_cast<int>(size_y);
+  dst[i] = is_inside ? src[src_y * size_x + src_x] : default_value;
+}
+
+cudaError_t shiftMap_launch(
+  const uint8_t * src, const uint32_t size_x, const uint32_t size_y, const int cell_offset_x,
+  const int cell_offset_y, const uint8_t default_value, uint8_t * dst, cudaStream_t stream)
+{
+  const std::size_t cells_num = static_cast<std::size_t>(size_x) * size_y;
+  shiftMap_kernel<<<divup(cells_num, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+    src, size_x, size_y, cell_offset_x, cell_offset_y, default_value, dst);
+  return cudaGetLastError();
+}
+
+__global__ void applyBinaryBayesFilter_kernel(
+  const uint8_t * __restrict__ single_frame_costmap, const std::size_t cells_num,
+  const BinaryBayesFilterCudaParam param, uint8_t * __restrict__ costmap)
+{
+  const std::size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i >= cells_num) {
+    return;
+  }
+  const uint8_t z = single_frame_costmap[i];
+  const float po = costmap[i] * (1.f / 255.f);
+  float po_hat{};
+  if (z == occupancy_cost_value::LETHAL_OBSTACLE) {
+    const float pz = param.occupied_to_occupied;
+    const float not_pz = param.occupied_to_free;
+    po_hat = ((po * pz) / ((po * pz) + ((1.f - po) * not_pz)));
+  } else if (z == occupancy_cost_value::FREE_SPACE) {
+    const float pz = 1.f - param.free_to_free;
+    const float not_pz = 1.f - param.free_to_occupied;
+    po_hat = ((po * pz) / ((po * pz) + ((1.f - po) * not_pz)));
+  } else if (z == occupancy_cost_value::NO_INFORMATION) {
+    const float inv_v_ratio = 1.f / param.v_ratio;
+    po_hat = ((po + (0.5f * inv_v_ratio)) / ((1.f * inv_v_ratio) + 1.f));
+  }
+  const int cost = static_cast<uint8_t>(po_hat * 255.f + 0.5f);
+  costmap[i] = static_cast<uint8_t>(min(max(cost, 1), 254));
+}
+
+cudaError_t applyBinaryBayesFilter_launch(
+  const uint8_t * single_frame_costmap, const std::size_t cells_num,
+  const BinaryBayesFilterCudaParam & param, uint8_t * costmap, cudaStream_t stream)
+{
+  applyBinaryBayesFilter_kernel<<<
+    divup(cells_num, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+    single_frame_costmap, cells_num, param, costmap);
+  return cudaGetLastError();
+}
+
+}  // namespace costmap_2d
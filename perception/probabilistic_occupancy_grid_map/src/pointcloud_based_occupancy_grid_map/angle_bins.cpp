@@ -0,0 +1,167 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "probabilistic_occupancy_grid_map/pointcloud_based_occupancy_grid_map/angle_bins.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+#include <tier4_autoware_utils/geometry/radial_bins.hpp>
+#include <tier4_autoware_utils/math/unit_conversion.hpp>
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#ifdef ROS_DISTRO_GALACTIC
+#include <tf2_eigen/tf2_eigen.h>
+#else
+#include <tf2_eigen/tf2_eigen.hpp>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+namespace
+{
+Eigen::Affine3d poseToAffine(const geometry_msgs::msg::Pose & pose)
+{
+  return tf2::transformToEigen(tier4_autoware_utils::pose2transform(pose));
+}
+
+// atan2 in float without branches, so that the loops calling it are vectorized.
+// the error is below 3e-7 rad.
+inline float fastAtan2(const float y, const float x)
+{
+  constexpr float pi = 3.14159265f;
+  constexpr float half_pi = 1.57079633f;
+  constexpr float quarter_pi = 0.78539816f;
+  constexpr float tan_pi_8 = 0.41421356f;
+  const float abs_x = std::abs(x);
+  const float abs_y = std::abs(y);
+  // atan(a) for a = min / max in [0, 1], with the range reduced to [0, tan(pi / 8)]
+  const bool is_steep = abs_y > abs_x;
+  const float numerator = is_steep ? abs_x : abs_y;
+  const float denominator = is_steep ? abs_y : abs_x;
+  const float a = denominator > 0.0f ? numerator / denominator : 0.0f;
+  const bool is_reduced = a > tan_pi_8;
+  const float t = is_reduced ? (a - 1.0f) / (a + 1.0f) : a;
+  const float t2 = t * t;
+  float angle =
+    (((8.05374449538e-2f * t2 - 1.38776856032e-1f) * t2 + 1.99777106478e-1f) * t2 -
+     3.33329491539e-1f) *
+      t2 * t +
+    t;
+  angle += is_reduced ? quarter_pi : 0.0f;
+  angle = is_steep ? half_pi - angle : angle;
+  angle = x < 0.0f ? pi - angle : angle;
+  return y < 0.0f ? -angle : angle;
+}
+}  // namespace
+
+namespace costmap_2d
+{
+void createAngleBins(
+  const sensor_msgs::msg::PointCloud2 & pointcloud, const geometry_msgs::msg::Pose & robot_pose,
+  const geometry_msgs::msg::Pose & scan_origin, AngleBins & angle_bins,
+  const AngleBins * range_limit_bins)
+{
+  constexpr double min_angle = tier4_autoware_utils::deg2rad(-180.0);
+  constexpr double max_angle = tier4_autoware_utils::deg2rad(180.0);
+  constexpr double angle_increment = tier4_autoware_utils::deg2rad(0.1);
+  const size_t angle_bin_size = ((max_angle - min_angle) / angle_increment) + size_t(1 /*margin*/);
+
+  // copy the points to flat arrays
+  const size_t points_num = static_cast<size_t>(pointcloud.width) * pointcloud.height;
+  std::vector<float> x(points_num);
+  std::vector<float> y(points_num);
+  std::vector<float> z(points_num);
+  {
+    size_t i = 0;
+    for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(pointcloud, "x"),
+         iter_y(pointcloud, "y"), iter_z(pointcloud, "z");
+         iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z, ++i) {
+      x[i] = *iter_x;
+      y[i] = *iter_y;
+      z[i] = *iter_z;
+    }
+  }
+
+  // robot -> map and robot -> scan transforms in one pass
+  const Eigen::Affine3d robot_to_map = poseToAffine(robot_pose);
+  const Eigen::Matrix4f map_matrix = robot_to_map.matrix().cast<float>();
+  const Eigen::Matrix4f scan_matrix =
+    (poseToAffine(scan_origin).inverse() * robot_to_map).matrix().cast<float>();
+  const double max_bin = static_cast<double>(angle_bin_size - 1);
+  std::vector<float> wx(points_num);
+  std::vector<float> wy(points_num);
+  std::vector<float> wz(points_num);
+  std::vector<float> range(points_num);
+  std::vector<uint32_t> bin_indices(points_num);
+  for (size_t i = 0; i < points_num; ++i) {
+    const auto & m = map_matrix;
+    const auto & s = scan_matrix;
+    wx[i] = m(0, 0) * x[i] + m(0, 1) * y[i] + m(0, 2) * z[i] + m(0, 3);
+    wy[i] = m(1, 0) * x[i] + m(1, 1) * y[i] + m(1, 2) * z[i] + m(1, 3);
+    wz[i] = m(2, 0) * x[i] + m(2, 1) * y[i] + m(2, 2) * z[i] + m(2, 3);
+    const float scan_x = s(0, 0) * x[i] + s(0, 1) * y[i] + s(0, 2) * z[i] + s(0, 3);
+    const float scan_y = s(1, 0) * x[i] + s(1, 1) * y[i] + s(1, 2) * z[i] + s(1, 3);
+    range[i] = std::sqrt(scan_x * scan_x + scan_y * scan_y);
+    // the bin in double as the float rounding of the angle offset moves more points to the next bin
+    double bin = (static_cast<double>(fastAtan2(scan_y, scan_x)) - min_angle) / angle_increment;
+    // NaN goes to the first bin here, the points which are not finite are dropped below
+    bin = bin > 0.0 ? bin : 0.0;
+    bin = bin < max_bin ? bin : max_bin;
+    bin_indices[i] = static_cast<uint32_t>(bin);
+  }
+
+  // the dropped points go to the bin at angle_bin_size, which is out of the bins
+  for (size_t i = 0; i < points_num; ++i) {
+    const uint32_t bin_index = bin_indices[i];
+    bool is_dropped = !std::isfinite(range[i]) || !std::isfinite(wx[i]) ||
+                      !std::isfinite(wy[i]) || !std::isfinite(wz[i]);
+    if (range_limit_bins && !is_dropped) {
+      is_dropped = range_limit_bins->empty(bin_index) ||
+                   range[i] > range_limit_bins->range[range_limit_bins->back(bin_index)];
+    }
+    bin_indices[i] = is_dropped ? angle_bin_size : bin_index;
+  }
+
+  // counting sort by bin, then sort each bin by range
+  std::vector<size_t> offsets;
+  std::vector<uint32_t> order;
+  tier4_autoware_utils::sortIndicesByBin(bin_indices, angle_bin_size, offsets, order);
+  const int bins_num = static_cast<int>(angle_bin_size);
+#pragma omp parallel for schedule(dynamic, 64)
+  for (int bin_index = 0; bin_index < bins_num; ++bin_index) {
+    std::sort(
+      order.begin() + offsets[bin_index], order.begin() + offsets[bin_index + 1],
+      [&range](const uint32_t a, const uint32_t b) { return range[a] < range[b]; });
+  }
+
+  const size_t binned_points_num = offsets.back();
+  angle_bins.offsets = std::move(offsets);
+  angle_bins.range.resize(binned_points_num);
+  angle_bins.wx.resize(binned_points_num);
+  angle_bins.wy.resize(binned_points_num);
+  angle_bins.wz.resize(binned_points_num);
+  for (size_t i = 0; i < binned_points_num; ++i) {
+    const uint32_t point_index = order[i];
+    angle_bins.range[i] = range[point_index];
+    angle_bins.wx[i] = wx[point_index];
+    angle_bins.wy[i] = wy[point_index];
+    angle_bins.wz[i] = wz[point_index];
+  }
+}
+}  // namespace costmap_2d
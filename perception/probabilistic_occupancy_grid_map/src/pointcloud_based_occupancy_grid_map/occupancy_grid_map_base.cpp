@@ -161,12 +161,61 @@ void OccupancyGridMapInterface::setCellValue(
   marker(index);
 }
 
+void OccupancyGridMapInterface::setCellValueConcurrently(
+  const double wx, const double wy, const unsigned char cost)
+{
+  ConcurrentMarkCell marker(costmap_, cost);
+  unsigned int mx{};
+  unsigned int my{};
+  if (!worldToMap(wx, wy, mx, my)) {
+    return;
+  }
+  marker(getIndex(mx, my));
+}
+
+void OccupancyGridMapInterface::setCellValue(
+  const double wx, const double wy, const unsigned char cost, CellUpdates & updates)
+{
+  unsigned int mx{};
+  unsigned int my{};
+  if (!worldToMap(wx, wy, mx, my)) {
+    return;
+  }
+  updates.push_back({getIndex(mx, my), cost});
+}
+
+void OccupancyGridMapInterface::applyCellUpdates(const CellUpdates & updates)
+{
+  for (const auto & update : updates) {
+    costmap_[update.index] = update.cost;
+  }
+}
+
 void OccupancyGridMapInterface::raytrace(
   const double source_x, const double source_y, const double target_x, const double target_y,
   const unsigned char cost)
 {
-  unsigned int x0{};
-  unsigned int y0{};
+  raytraceWithAction(source_x, source_y, target_x, target_y, MarkCell(costmap_, cost));
+}
+
+void OccupancyGridMapInterface::raytraceConcurrently(
+  const double source_x, const double source_y, const double target_x, const double target_y,
+  const unsigned char cost)
+{
+  raytraceWithAction(source_x, source_y, target_x, target_y, ConcurrentMarkCell(costmap_, cost));
+}
+
+void OccupancyGridMapInterface::raytrace(
+  const double source_x, const double source_y, const double target_x, const double target_y,
+  const unsigned char cost, CellUpdates & updates)
+{
+  raytraceWithAction(source_x, source_y, target_x, target_y, RecordCell(updates, cost));
+}
+
+bool OccupancyGridMapInterface::getRayCells(
+  const double source_x, const double source_y, const double target_x, const double target_y,
+  unsigned int & x0, unsigned int & y0, unsigned int & x1, unsigned int & y1) const
+{
   const double ox{source_x};
   const double oy{source_y};
   if (!worldToMap(ox, oy, x0, y0)) {
@@ -175,9 +224,8 @@ void OccupancyGridMapInterface::raytrace(
       "The origin for the sensor at (%.2f, %.2f) is out of map bounds. So, the costmap cannot "
       "raytrace for it.",
       ox, oy);
-    return;
+    return false;
   }
-
   // we can pre-compute the endpoints of the map outside of the inner loop... we'll need these later
   const double origin_x = origin_x_, origin_y = origin_y_;
   const double map_end_x = origin_x + size_x_ * resolution_;
@@ -216,17 +264,9 @@ void OccupancyGridMapInterface::raytrace(
   }
 
   // now that the vector is scaled correctly... we'll get the map coordinates of its endpoint
-  unsigned int x1{};
-  unsigned int y1{};
-
   // check for legality just in case
-  if (!worldToMap(wx, wy, x1, y1)) {
-    return;
-  }
-
-  constexpr unsigned int cell_raytrace_range = 10000;  // large number to ignore range threshold
-  MarkCell marker(costmap_, cost);
-  raytraceLine(marker, x0, y0, x1, y1, cell_raytrace_range);
+  return worldToMap(wx, wy, x1, y1);
 }
 
+
 }  // namespace costmap_2d
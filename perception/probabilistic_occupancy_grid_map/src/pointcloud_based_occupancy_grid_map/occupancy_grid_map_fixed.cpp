@@ -33,13 +33,19 @@
 #endif
 
 #include <algorithm>
+#include <vector>
+
 namespace costmap_2d
 {
 using sensor_msgs::PointCloud2ConstIterator;
 
+// the angle bins are split into the sectors to add the unknown cells in parallel
+constexpr size_t raytrace_sectors_num = 64;
+
 OccupancyGridMapFixedBlindSpot::OccupancyGridMapFixedBlindSpot(
   const unsigned int cells_size_x, const unsigned int cells_size_y, const float resolution)
-: OccupancyGridMapInterface(cells_size_x, cells_size_y, resolution)
+: OccupancyGridMapInterface(cells_size_x, cells_size_y, resolution),
+  sector_cell_updates_(raytrace_sectors_num)
 {
 }
 
@@ -55,168 +61,118 @@ void OccupancyGridMapFixedBlindSpot::updateWithPointCloud(
   const PointCloud2 & raw_pointcloud, const PointCloud2 & obstacle_pointcloud,
   const Pose & robot_pose, const Pose & scan_origin)
 {
-  constexpr double min_angle = tier4_autoware_utils::deg2rad(-180.0);
-  constexpr double max_angle = tier4_autoware_utils::deg2rad(180.0);
-  constexpr double angle_increment = tier4_autoware_utils::deg2rad(0.1);
-  const size_t angle_bin_size = ((max_angle - min_angle) / angle_increment) + size_t(1 /*margin*/);
-
-  // Transform from base_link to map frame
-  PointCloud2 map_raw_pointcloud, map_obstacle_pointcloud;  // point cloud in map frame
-  utils::transformPointcloud(raw_pointcloud, robot_pose, map_raw_pointcloud);
-  utils::transformPointcloud(obstacle_pointcloud, robot_pose, map_obstacle_pointcloud);
-
-  // Transform from map frame to scan frame
-  PointCloud2 scan_raw_pointcloud, scan_obstacle_pointcloud;      // point cloud in scan frame
-  const auto scan2map_pose = utils::getInversePose(scan_origin);  // scan -> map transform pose
-  utils::transformPointcloud(map_raw_pointcloud, scan2map_pose, scan_raw_pointcloud);
-  utils::transformPointcloud(map_obstacle_pointcloud, scan2map_pose, scan_obstacle_pointcloud);
-
-  // Create angle bins and sort by distance
-  struct BinInfo
-  {
-    BinInfo() = default;
-    BinInfo(const double _range, const double _wx, const double _wy)
-    : range(_range), wx(_wx), wy(_wy)
-    {
-    }
-    double range;
-    double wx;
-    double wy;
-  };
-  std::vector</*angle bin*/ std::vector<BinInfo>> obstacle_pointcloud_angle_bins;
-  std::vector</*angle bin*/ std::vector<BinInfo>> raw_pointcloud_angle_bins;
-  obstacle_pointcloud_angle_bins.resize(angle_bin_size);
-  raw_pointcloud_angle_bins.resize(angle_bin_size);
-  for (PointCloud2ConstIterator<float> iter_x(scan_raw_pointcloud, "x"),
-       iter_y(scan_raw_pointcloud, "y"), iter_wx(map_raw_pointcloud, "x"),
-       iter_wy(map_raw_pointcloud, "y");
-       iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_wx, ++iter_wy) {
-    const double angle = atan2(*iter_y, *iter_x);
-    const int angle_bin_index = (angle - min_angle) / angle_increment;
-    raw_pointcloud_angle_bins.at(angle_bin_index)
-      .push_back(BinInfo(std::hypot(*iter_y, *iter_x), *iter_wx, *iter_wy));
-  }
-  for (auto & raw_pointcloud_angle_bin : raw_pointcloud_angle_bins) {
-    std::sort(raw_pointcloud_angle_bin.begin(), raw_pointcloud_angle_bin.end(), [](auto a, auto b) {
-      return a.range < b.range;
-    });
-  }
-  // create and sort bin for obstacle pointcloud
-  for (PointCloud2ConstIterator<float> iter_x(scan_obstacle_pointcloud, "x"),
-       iter_y(scan_obstacle_pointcloud, "y"), iter_wx(map_obstacle_pointcloud, "x"),
-       iter_wy(map_obstacle_pointcloud, "y");
-       iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_wx, ++iter_wy) {
-    const double angle = atan2(*iter_y, *iter_x);
-    const int angle_bin_index = (angle - min_angle) / angle_increment;
-    const double range = std::hypot(*iter_y, *iter_x);
-    // Ignore obstacle points exceed the range of the raw points
-    if (raw_pointcloud_angle_bins.at(angle_bin_index).empty()) {
-      continue;  // No raw point in this angle bin
-    } else if (range > raw_pointcloud_angle_bins.at(angle_bin_index).back().range) {
-      continue;  // Obstacle point exceeds the range of the raw points
-    }
-    obstacle_pointcloud_angle_bins.at(angle_bin_index)
-      .push_back(BinInfo(range, *iter_wx, *iter_wy));
-  }
-  for (auto & obstacle_pointcloud_angle_bin : obstacle_pointcloud_angle_bins) {
-    std::sort(
-      obstacle_pointcloud_angle_bin.begin(), obstacle_pointcloud_angle_bin.end(),
-      [](auto a, auto b) { return a.range < b.range; });
-  }
+  // Create angle bins and sort by distance, ignoring obstacle points exceeding the range of the
+  // raw points
+  createAngleBins(raw_pointcloud, robot_pose, scan_origin, raw_pointcloud_angle_bins_);
+  createAngleBins(
+    obstacle_pointcloud, robot_pose, scan_origin, obstacle_pointcloud_angle_bins_,
+    &raw_pointcloud_angle_bins_);
+  const auto & raw_bins = raw_pointcloud_angle_bins_;
+  const auto & obstacle_bins = obstacle_pointcloud_angle_bins_;
+  const int bins_num = static_cast<int>(raw_bins.size());
 
   // First step: Initialize cells to the final point with freespace
-  for (size_t bin_index = 0; bin_index < obstacle_pointcloud_angle_bins.size(); ++bin_index) {
-    auto & raw_pointcloud_angle_bin = raw_pointcloud_angle_bins.at(bin_index);
-
-    BinInfo end_distance;
-    if (raw_pointcloud_angle_bin.empty()) {
+#pragma omp parallel for schedule(dynamic, 64)
+  for (int bin_index = 0; bin_index < bins_num; ++bin_index) {
+    if (raw_bins.empty(bin_index)) {
       continue;
-    } else {
-      end_distance = raw_pointcloud_angle_bin.back();
     }
-    raytrace(
-      scan_origin.position.x, scan_origin.position.y, end_distance.wx, end_distance.wy,
-      occupancy_cost_value::FREE_SPACE);
+    const size_t end_distance = raw_bins.back(bin_index);
+    raytraceConcurrently(
+      scan_origin.position.x, scan_origin.position.y, raw_bins.wx[end_distance],
+      raw_bins.wy[end_distance], occupancy_cost_value::FREE_SPACE);
   }
 
   // Second step: Add unknown cell
-  for (size_t bin_index = 0; bin_index < obstacle_pointcloud_angle_bins.size(); ++bin_index) {
-    auto & obstacle_pointcloud_angle_bin = obstacle_pointcloud_angle_bins.at(bin_index);
-    auto & raw_pointcloud_angle_bin = raw_pointcloud_angle_bins.at(bin_index);
-    auto raw_distance_iter = raw_pointcloud_angle_bin.begin();
-    for (size_t dist_index = 0; dist_index < obstacle_pointcloud_angle_bin.size(); ++dist_index) {
+  // the cells of each sector of bins are recorded in parallel and written in the order of the bins
+  const auto add_unknown_cells = [&](const size_t bin_index, CellUpdates & updates) {
+    const size_t obstacle_end = obstacle_bins.end(bin_index);
+    const size_t raw_end = raw_bins.end(bin_index);
+    size_t raw_distance_index = raw_bins.begin(bin_index);
+    for (size_t source = obstacle_bins.begin(bin_index); source < obstacle_end; ++source) {
+      const double source_range = obstacle_bins.range[source];
       // Calculate next raw point from obstacle point
-      while (raw_distance_iter != raw_pointcloud_angle_bin.end()) {
-        if (
-          raw_distance_iter->range <
-          obstacle_pointcloud_angle_bin.at(dist_index).range + distance_margin_)
-          raw_distance_iter++;
-        else
-          break;
+      while (raw_distance_index < raw_end &&
+             raw_bins.range[raw_distance_index] < source_range + distance_margin_) {
+        raw_distance_index++;
       }
 
       // There is no point far than the obstacle point.
-      const bool no_freespace_point = (raw_distance_iter == raw_pointcloud_angle_bin.end());
-
-      if (dist_index + 1 == obstacle_pointcloud_angle_bin.size()) {
-        const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
+      const bool no_freespace_point = (raw_distance_index == raw_end);
+
+      const auto raytrace_to_raw_point = [&]() {
+        const size_t target = raw_distance_index;
+        raytrace(
+          obstacle_bins.wx[source], obstacle_bins.wy[source], raw_bins.wx[target],
+          raw_bins.wy[target], occupancy_cost_value::NO_INFORMATION, updates);
+        setCellValue(
+          raw_bins.wx[target], raw_bins.wy[target], occupancy_cost_value::FREE_SPACE, updates);
+      };
+      const auto raytrace_to_next_obstacle_point = [&]() {
+        const size_t target = source + 1;
+        raytrace(
+          obstacle_bins.wx[source], obstacle_bins.wy[source], obstacle_bins.wx[target],
+          obstacle_bins.wy[target], occupancy_cost_value::NO_INFORMATION, updates);
+      };
+
+      if (source + 1 == obstacle_end) {
         if (!no_freespace_point) {
-          const auto & target = *raw_distance_iter;
-          raytrace(
-            source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::NO_INFORMATION);
-          setCellValue(target.wx, target.wy, occupancy_cost_value::FREE_SPACE);
+          raytrace_to_raw_point();
         }
         continue;
       }
 
-      auto next_obstacle_point_distance = std::abs(
-        obstacle_pointcloud_angle_bin.at(dist_index + 1).range -
-        obstacle_pointcloud_angle_bin.at(dist_index).range);
+      const double next_obstacle_point_distance =
+        std::abs(obstacle_bins.range[source + 1] - source_range);
       if (next_obstacle_point_distance <= distance_margin_) {
         continue;
       } else if (no_freespace_point) {
-        const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-        const auto & target = obstacle_pointcloud_angle_bin.at(dist_index + 1);
-        raytrace(source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::NO_INFORMATION);
+        raytrace_to_next_obstacle_point();
         continue;
       }
 
-      auto next_raw_distance =
-        std::abs(obstacle_pointcloud_angle_bin.at(dist_index).range - raw_distance_iter->range);
+      const double next_raw_distance = std::abs(source_range - raw_bins.range[raw_distance_index]);
       if (next_raw_distance < next_obstacle_point_distance) {
-        const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-        const auto & target = *raw_distance_iter;
-        raytrace(source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::NO_INFORMATION);
-        setCellValue(target.wx, target.wy, occupancy_cost_value::FREE_SPACE);
-        continue;
+        raytrace_to_raw_point();
       } else {
-        const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-        const auto & target = obstacle_pointcloud_angle_bin.at(dist_index + 1);
-        raytrace(source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::NO_INFORMATION);
-        continue;
+        raytrace_to_next_obstacle_point();
       }
     }
+  };
+  const int sectors_num = static_cast<int>(sector_cell_updates_.size());
+  const int sector_bins_num = (bins_num + sectors_num - 1) / sectors_num;
+#pragma omp parallel for schedule(dynamic, 1)
+  for (int sector_index = 0; sector_index < sectors_num; ++sector_index) {
+    auto & updates = sector_cell_updates_[sector_index];
+    updates.clear();
+    const int sector_end = std::min(bins_num, (sector_index + 1) * sector_bins_num);
+    for (int bin_index = sector_index * sector_bins_num; bin_index < sector_end; ++bin_index) {
+      add_unknown_cells(bin_index, updates);
+    }
+  }
+  for (const auto & updates : sector_cell_updates_) {
+    applyCellUpdates(updates);
   }
 
   // Third step: Overwrite occupied cell
-  for (size_t bin_index = 0; bin_index < obstacle_pointcloud_angle_bins.size(); ++bin_index) {
-    auto & obstacle_pointcloud_angle_bin = obstacle_pointcloud_angle_bins.at(bin_index);
-    for (size_t dist_index = 0; dist_index < obstacle_pointcloud_angle_bin.size(); ++dist_index) {
-      const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-      setCellValue(source.wx, source.wy, occupancy_cost_value::LETHAL_OBSTACLE);
-
-      if (dist_index + 1 == obstacle_pointcloud_angle_bin.size()) {
+#pragma omp parallel for schedule(dynamic, 64)
+  for (int bin_index = 0; bin_index < bins_num; ++bin_index) {
+    const size_t obstacle_end = obstacle_bins.end(bin_index);
+    for (size_t source = obstacle_bins.begin(bin_index); source < obstacle_end; ++source) {
+      setCellValueConcurrently(
+        obstacle_bins.wx[source], obstacle_bins.wy[source], occupancy_cost_value::LETHAL_OBSTACLE);
+
+      if (source + 1 == obstacle_end) {
         continue;
       }
 
-      auto next_obstacle_point_distance = std::abs(
-        obstacle_pointcloud_angle_bin.at(dist_index + 1).range -
-        obstacle_pointcloud_angle_bin.at(dist_index).range);
+      const double next_obstacle_point_distance =
+        std::abs(obstacle_bins.range[source + 1] - obstacle_bins.range[source]);
       if (next_obstacle_point_distance <= distance_margin_) {
-        const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-        const auto & target = obstacle_pointcloud_angle_bin.at(dist_index + 1);
-        raytrace(source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::LETHAL_OBSTACLE);
-        continue;
+        const size_t target = source + 1;
+        raytraceConcurrently(
+          obstacle_bins.wx[source], obstacle_bins.wy[source], obstacle_bins.wx[target],
+          obstacle_bins.wy[target], occupancy_cost_value::LETHAL_OBSTACLE);
       }
     }
   }
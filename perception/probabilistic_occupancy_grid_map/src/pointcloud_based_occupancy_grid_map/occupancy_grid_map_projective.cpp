@@ -34,13 +34,20 @@
 #endif
 
 #include <algorithm>
+#include <limits>
+#include <vector>
+
 namespace costmap_2d
 {
 using sensor_msgs::PointCloud2ConstIterator;
 
+// the angle bins are split into the sectors to add the unknown cells in parallel
+constexpr size_t raytrace_sectors_num = 64;
+
 OccupancyGridMapProjectiveBlindSpot::OccupancyGridMapProjectiveBlindSpot(
   const unsigned int cells_size_x, const unsigned int cells_size_y, const float resolution)
-: OccupancyGridMapInterface(cells_size_x, cells_size_y, resolution)
+: OccupancyGridMapInterface(cells_size_x, cells_size_y, resolution),
+  sector_cell_updates_(raytrace_sectors_num)
 {
 }
 
@@ -56,103 +63,38 @@ void OccupancyGridMapProjectiveBlindSpot::updateWithPointCloud(
   const PointCloud2 & raw_pointcloud, const PointCloud2 & obstacle_pointcloud,
   const Pose & robot_pose, const Pose & scan_origin)
 {
-  constexpr double min_angle = tier4_autoware_utils::deg2rad(-180.0);
-  constexpr double max_angle = tier4_autoware_utils::deg2rad(180.0);
-  constexpr double angle_increment = tier4_autoware_utils::deg2rad(0.1);
-  const size_t angle_bin_size = ((max_angle - min_angle) / angle_increment) + size_t(1 /*margin*/);
-
-  // Transform from base_link to map frame
-  PointCloud2 map_raw_pointcloud, map_obstacle_pointcloud;  // point cloud in map frame
-  utils::transformPointcloud(raw_pointcloud, robot_pose, map_raw_pointcloud);
-  utils::transformPointcloud(obstacle_pointcloud, robot_pose, map_obstacle_pointcloud);
-
-  // Transform from map frame to scan frame
-  PointCloud2 scan_raw_pointcloud, scan_obstacle_pointcloud;      // point cloud in scan frame
-  const auto scan2map_pose = utils::getInversePose(scan_origin);  // scan -> map transform pose
-  utils::transformPointcloud(map_raw_pointcloud, scan2map_pose, scan_raw_pointcloud);
-  utils::transformPointcloud(map_obstacle_pointcloud, scan2map_pose, scan_obstacle_pointcloud);
-
-  // Create angle bins and sort points by range
-  struct BinInfo3D
-  {
-    BinInfo3D(
-      const double _range = 0.0, const double _wx = 0.0, const double _wy = 0.0,
-      const double _wz = 0.0, const double _projection_length = 0.0,
-      const double _projected_wx = 0.0, const double _projected_wy = 0.0)
-    : range(_range),
-      wx(_wx),
-      wy(_wy),
-      wz(_wz),
-      projection_length(_projection_length),
-      projected_wx(_projected_wx),
-      projected_wy(_projected_wy)
-    {
-    }
-    double range;
-    double wx;
-    double wy;
-    double wz;
-    double projection_length;
-    double projected_wx;
-    double projected_wy;
-  };
-
-  std::vector</*angle bin*/ std::vector<BinInfo3D>> obstacle_pointcloud_angle_bins;
-  std::vector</*angle bin*/ std::vector<BinInfo3D>> raw_pointcloud_angle_bins;
-  obstacle_pointcloud_angle_bins.resize(angle_bin_size);
-  raw_pointcloud_angle_bins.resize(angle_bin_size);
-  for (PointCloud2ConstIterator<float> iter_x(scan_raw_pointcloud, "x"),
-       iter_y(scan_raw_pointcloud, "y"), iter_wx(map_raw_pointcloud, "x"),
-       iter_wy(map_raw_pointcloud, "y"), iter_wz(map_raw_pointcloud, "z");
-       iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_wx, ++iter_wy, ++iter_wz) {
-    const double angle = atan2(*iter_y, *iter_x);
-    const int angle_bin_index = (angle - min_angle) / angle_increment;
-    raw_pointcloud_angle_bins.at(angle_bin_index)
-      .emplace_back(std::hypot(*iter_y, *iter_x), *iter_wx, *iter_wy, *iter_wz);
-  }
-  for (auto & raw_pointcloud_angle_bin : raw_pointcloud_angle_bins) {
-    std::sort(raw_pointcloud_angle_bin.begin(), raw_pointcloud_angle_bin.end(), [](auto a, auto b) {
-      return a.range < b.range;
-    });
-  }
-  // Create obstacle angle bins and sort points by range
-  for (PointCloud2ConstIterator<float> iter_x(scan_obstacle_pointcloud, "x"),
-       iter_y(scan_obstacle_pointcloud, "y"), iter_z(scan_obstacle_pointcloud, "z"),
-       iter_wx(map_obstacle_pointcloud, "x"), iter_wy(map_obstacle_pointcloud, "y"),
-       iter_wz(map_obstacle_pointcloud, "z");
-       iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z, ++iter_wx, ++iter_wy, ++iter_wz) {
-    const double scan_z = scan_origin.position.z - robot_pose.position.z;
-    const double obstacle_z = (*iter_wz) - robot_pose.position.z;
+  // Create angle bins and sort points by range, ignoring obstacle points exceeding the range of
+  // the raw points
+  createAngleBins(raw_pointcloud, robot_pose, scan_origin, raw_pointcloud_angle_bins_);
+  createAngleBins(
+    obstacle_pointcloud, robot_pose, scan_origin, obstacle_pointcloud_angle_bins_,
+    &raw_pointcloud_angle_bins_);
+  const auto & raw_bins = raw_pointcloud_angle_bins_;
+  const auto & obstacle_bins = obstacle_pointcloud_angle_bins_;
+  const int bins_num = static_cast<int>(raw_bins.size());
+
+  // Project the obstacle points to the ground from the scan origin
+  const size_t obstacle_points_num = obstacle_bins.range.size();
+  std::vector<double> projection_length(obstacle_points_num);
+  std::vector<double> projected_wx(obstacle_points_num);
+  std::vector<double> projected_wy(obstacle_points_num);
+  const double scan_z = scan_origin.position.z - robot_pose.position.z;
+  for (size_t i = 0; i < obstacle_points_num; ++i) {
+    const double obstacle_z = obstacle_bins.wz[i] - robot_pose.position.z;
     const double dz = scan_z - obstacle_z;
-    const double angle = atan2(*iter_y, *iter_x);
-    const int angle_bin_index = (angle - min_angle) / angle_increment;
-    const double range = std::hypot(*iter_x, *iter_y);
-    // Ignore obstacle points exceed the range of the raw points
-    if (raw_pointcloud_angle_bins.at(angle_bin_index).empty()) {
-      continue;  // No raw point in this angle bin
-    } else if (range > raw_pointcloud_angle_bins.at(angle_bin_index).back().range) {
-      continue;  // Obstacle point exceeds the range of the raw points
-    }
     if (dz > projection_dz_threshold_) {
       const double ratio = obstacle_z / dz;
-      const double projection_length = range * ratio;
-      const double projected_wx = (*iter_wx) + ((*iter_wx) - scan_origin.position.x) * ratio;
-      const double projected_wy = (*iter_wy) + ((*iter_wy) - scan_origin.position.y) * ratio;
-      obstacle_pointcloud_angle_bins.at(angle_bin_index)
-        .emplace_back(
-          range, *iter_wx, *iter_wy, *iter_wz, projection_length, projected_wx, projected_wy);
+      projection_length[i] = obstacle_bins.range[i] * ratio;
+      const double wx = obstacle_bins.wx[i];
+      const double wy = obstacle_bins.wy[i];
+      projected_wx[i] = wx + (wx - scan_origin.position.x) * ratio;
+      projected_wy[i] = wy + (wy - scan_origin.position.y) * ratio;
     } else {
-      obstacle_pointcloud_angle_bins.at(angle_bin_index)
-        .emplace_back(
-          range, *iter_wx, *iter_wy, *iter_wz, std::numeric_limits<double>::infinity(),
-          std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity());
+      projection_length[i] = std::numeric_limits<double>::infinity();
+      projected_wx[i] = std::numeric_limits<double>::infinity();
+      projected_wy[i] = std::numeric_limits<double>::infinity();
     }
   }
-  for (auto & obstacle_pointcloud_angle_bin : obstacle_pointcloud_angle_bins) {
-    std::sort(
-      obstacle_pointcloud_angle_bin.begin(), obstacle_pointcloud_angle_bin.end(),
-      [](auto a, auto b) { return a.range < b.range; });
-  }
 
   grid_map::Costmap2DConverter<grid_map::GridMap> converter;
   if (pub_debug_grid_) {
@@ -164,34 +106,31 @@ void OccupancyGridMapProjectiveBlindSpot::updateWithPointCloud(
         origin_x_ + size_x_ * resolution_ / 2.0, origin_y_ + size_y_ * resolution_ / 2.0));
   }
 
-  auto is_visible_beyond_obstacle = [&](const BinInfo3D & obstacle, const BinInfo3D & raw) -> bool {
-    if (raw.range < obstacle.range) {
+  auto is_visible_beyond_obstacle = [&](const size_t obstacle, const size_t raw) -> bool {
+    if (raw_bins.range[raw] < obstacle_bins.range[obstacle]) {
       return false;
     }
 
-    if (std::isinf(obstacle.projection_length)) {
+    if (std::isinf(projection_length[obstacle])) {
       return false;
     }
 
     // y = ax + b
     const double a = -(scan_origin.position.z - robot_pose.position.z) /
-                     (obstacle.range + obstacle.projection_length);
+                     (obstacle_bins.range[obstacle] + projection_length[obstacle]);
     const double b = scan_origin.position.z;
-    return raw.wz > (a * raw.range + b);
+    return raw_bins.wz[raw] > (a * raw_bins.range[raw] + b);
   };
 
   // First step: Initialize cells to the final point with freespace
-  for (size_t bin_index = 0; bin_index < obstacle_pointcloud_angle_bins.size(); ++bin_index) {
-    const auto & raw_pointcloud_angle_bin = raw_pointcloud_angle_bins.at(bin_index);
-
-    BinInfo3D ray_end;
-    if (raw_pointcloud_angle_bin.empty()) {
+#pragma omp parallel for schedule(dynamic, 64)
+  for (int bin_index = 0; bin_index < bins_num; ++bin_index) {
+    if (raw_bins.empty(bin_index)) {
       continue;
-    } else {
-      ray_end = raw_pointcloud_angle_bin.back();
     }
-    raytrace(
-      scan_origin.position.x, scan_origin.position.y, ray_end.wx, ray_end.wy,
+    const size_t ray_end = raw_bins.back(bin_index);
+    raytraceConcurrently(
+      scan_origin.position.x, scan_origin.position.y, raw_bins.wx[ray_end], raw_bins.wy[ray_end],
       occupancy_cost_value::FREE_SPACE);
   }
 
@@ -199,90 +138,93 @@ void OccupancyGridMapProjectiveBlindSpot::updateWithPointCloud(
     converter.addLayerFromCostmap2D(*this, "filled_free_to_farthest", debug_grid_);
 
   // Second step: Add unknown cell
-  for (size_t bin_index = 0; bin_index < obstacle_pointcloud_angle_bins.size(); ++bin_index) {
-    const auto & obstacle_pointcloud_angle_bin = obstacle_pointcloud_angle_bins.at(bin_index);
-    const auto & raw_pointcloud_angle_bin = raw_pointcloud_angle_bins.at(bin_index);
-    auto raw_distance_iter = raw_pointcloud_angle_bin.begin();
-    for (size_t dist_index = 0; dist_index < obstacle_pointcloud_angle_bin.size(); ++dist_index) {
+  // the cells of each sector of bins are recorded in parallel and written in the order of the bins
+  const auto add_unknown_cells = [&](const size_t bin_index, CellUpdates & updates) {
+    const size_t obstacle_end = obstacle_bins.end(bin_index);
+    const size_t raw_end = raw_bins.end(bin_index);
+    size_t raw_distance_index = raw_bins.begin(bin_index);
+    for (size_t source = obstacle_bins.begin(bin_index); source < obstacle_end; ++source) {
       // Calculate next raw point from obstacle point
-      const auto & obstacle_bin = obstacle_pointcloud_angle_bin.at(dist_index);
-      while (raw_distance_iter != raw_pointcloud_angle_bin.end()) {
-        if (!is_visible_beyond_obstacle(obstacle_bin, *raw_distance_iter))
-          raw_distance_iter++;
-        else
-          break;
+      while (raw_distance_index < raw_end &&
+             !is_visible_beyond_obstacle(source, raw_distance_index)) {
+        raw_distance_index++;
       }
 
       // There is no point farther than the obstacle point.
-      const bool no_visible_point_beyond = (raw_distance_iter == raw_pointcloud_angle_bin.end());
+      const bool no_visible_point_beyond = (raw_distance_index == raw_end);
       if (no_visible_point_beyond) {
-        const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
         raytrace(
-          source.wx, source.wy, source.projected_wx, source.projected_wy,
-          occupancy_cost_value::NO_INFORMATION);
+          obstacle_bins.wx[source], obstacle_bins.wy[source], projected_wx[source],
+          projected_wy[source], occupancy_cost_value::NO_INFORMATION, updates);
         break;
       }
 
-      if (dist_index + 1 == obstacle_pointcloud_angle_bin.size()) {
-        const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-        if (!no_visible_point_beyond) {
-          raytrace(
-            source.wx, source.wy, source.projected_wx, source.projected_wy,
-            occupancy_cost_value::NO_INFORMATION);
-        }
+      if (source + 1 == obstacle_end) {
+        raytrace(
+          obstacle_bins.wx[source], obstacle_bins.wy[source], projected_wx[source],
+          projected_wy[source], occupancy_cost_value::NO_INFORMATION, updates);
         continue;
       }
 
-      auto next_obstacle_point_distance = std::abs(
-        obstacle_pointcloud_angle_bin.at(dist_index + 1).range -
-        obstacle_pointcloud_angle_bin.at(dist_index).range);
+      const double next_obstacle_point_distance =
+        std::abs(obstacle_bins.range[source + 1] - obstacle_bins.range[source]);
       if (next_obstacle_point_distance <= obstacle_separation_threshold_) {
         continue;
-      } else if (no_visible_point_beyond) {
-        const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-        const auto & target = obstacle_pointcloud_angle_bin.at(dist_index + 1);
-        raytrace(source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::NO_INFORMATION);
-        continue;
       }
 
-      auto next_raw_distance =
-        std::abs(obstacle_pointcloud_angle_bin.at(dist_index).range - raw_distance_iter->range);
+      const double next_raw_distance =
+        std::abs(obstacle_bins.range[source] - raw_bins.range[raw_distance_index]);
       if (next_raw_distance < next_obstacle_point_distance) {
-        const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-        const auto & target = *raw_distance_iter;
-        raytrace(source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::NO_INFORMATION);
-        setCellValue(target.wx, target.wy, occupancy_cost_value::FREE_SPACE);
-        continue;
+        const size_t target = raw_distance_index;
+        raytrace(
+          obstacle_bins.wx[source], obstacle_bins.wy[source], raw_bins.wx[target],
+          raw_bins.wy[target], occupancy_cost_value::NO_INFORMATION, updates);
+        setCellValue(
+          raw_bins.wx[target], raw_bins.wy[target], occupancy_cost_value::FREE_SPACE, updates);
       } else {
-        const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-        const auto & target = obstacle_pointcloud_angle_bin.at(dist_index + 1);
-        raytrace(source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::NO_INFORMATION);
-        continue;
+        const size_t target = source + 1;
+        raytrace(
+          obstacle_bins.wx[source], obstacle_bins.wy[source], obstacle_bins.wx[target],
+          obstacle_bins.wy[target], occupancy_cost_value::NO_INFORMATION, updates);
       }
     }
+  };
+  const int sectors_num = static_cast<int>(sector_cell_updates_.size());
+  const int sector_bins_num = (bins_num + sectors_num - 1) / sectors_num;
+#pragma omp parallel for schedule(dynamic, 1)
+  for (int sector_index = 0; sector_index < sectors_num; ++sector_index) {
+    auto & updates = sector_cell_updates_[sector_index];
+    updates.clear();
+    const int sector_end = std::min(bins_num, (sector_index + 1) * sector_bins_num);
+    for (int bin_index = sector_index * sector_bins_num; bin_index < sector_end; ++bin_index) {
+      add_unknown_cells(bin_index, updates);
+    }
+  }
+  for (const auto & updates : sector_cell_updates_) {
+    applyCellUpdates(updates);
   }
 
   if (pub_debug_grid_) converter.addLayerFromCostmap2D(*this, "added_unknown", debug_grid_);
 
   // Third step: Overwrite occupied cell
-  for (size_t bin_index = 0; bin_index < obstacle_pointcloud_angle_bins.size(); ++bin_index) {
-    auto & obstacle_pointcloud_angle_bin = obstacle_pointcloud_angle_bins.at(bin_index);
-    for (size_t dist_index = 0; dist_index < obstacle_pointcloud_angle_bin.size(); ++dist_index) {
-      const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-      setCellValue(source.wx, source.wy, occupancy_cost_value::LETHAL_OBSTACLE);
-
-      if (dist_index + 1 == obstacle_pointcloud_angle_bin.size()) {
+#pragma omp parallel for schedule(dynamic, 64)
+  for (int bin_index = 0; bin_index < bins_num; ++bin_index) {
+    const size_t obstacle_end = obstacle_bins.end(bin_index);
+    for (size_t source = obstacle_bins.begin(bin_index); source < obstacle_end; ++source) {
+      setCellValueConcurrently(
+        obstacle_bins.wx[source], obstacle_bins.wy[source], occupancy_cost_value::LETHAL_OBSTACLE);
+
+      if (source + 1 == obstacle_end) {
         continue;
       }
 
-      auto next_obstacle_point_distance = std::abs(
-        obstacle_pointcloud_angle_bin.at(dist_index + 1).range -
-        obstacle_pointcloud_angle_bin.at(dist_index).range);
+      const double next_obstacle_point_distance =
+        std::abs(obstacle_bins.range[source + 1] - obstacle_bins.range[source]);
       if (next_obstacle_point_distance <= obstacle_separation_threshold_) {
-        const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-        const auto & target = obstacle_pointcloud_angle_bin.at(dist_index + 1);
-        raytrace(source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::LETHAL_OBSTACLE);
-        continue;
+        const size_t target = source + 1;
+        raytraceConcurrently(
+          obstacle_bins.wx[source], obstacle_bins.wy[source], obstacle_bins.wx[target],
+          obstacle_bins.wy[target], occupancy_cost_value::LETHAL_OBSTACLE);
       }
     }
   }
@@ -21,6 +21,7 @@
 
 #include <pcl_ros/transforms.hpp>
 #include <tier4_autoware_utils/ros/debug_publisher.hpp>
+#include <tier4_autoware_utils/ros/loaned_message_publisher.hpp>
 #include <tier4_autoware_utils/system/stop_watch.hpp>
 
 #include <nav_msgs/msg/occupancy_grid.hpp>
@@ -117,6 +118,34 @@ PointcloudBasedOccupancyGridMapNode::PointcloudBasedOccupancyGridMapNode(
   }
   occupancy_grid_map_ptr_->initRosParam(*this);
 
+  use_cuda_ = this->declare_parameter<bool>("use_cuda", false);
+  if (use_cuda_) {
+#if ENABLE_GPU
+    if (
+      grid_map_type != "OccupancyGridMapFixedBlindSpot" ||
+      updater_type != "binary_bayes_filter") {
+      RCLCPP_WARN(
+        get_logger(),
+        "use_cuda is supported only with OccupancyGridMapFixedBlindSpot and binary_bayes_filter, "
+        "run on CPU.");
+    } else {
+      costmap_2d::BinaryBayesFilterCudaParam bbf_param;
+      bbf_param.occupied_to_occupied =
+        get_parameter("probability_matrix.occupied_to_occupied").as_double();
+      bbf_param.occupied_to_free = get_parameter("probability_matrix.occupied_to_free").as_double();
+      bbf_param.free_to_free = get_parameter("probability_matrix.free_to_free").as_double();
+      bbf_param.free_to_occupied = get_parameter("probability_matrix.free_to_occupied").as_double();
+      bbf_param.v_ratio = get_parameter("v_ratio").as_double();
+      cuda_occupancy_grid_map_ptr_ = std::make_unique<costmap_2d::OccupancyGridMapCuda>(
+        occupancy_grid_map_ptr_->getSizeInCellsX(), occupancy_grid_map_ptr_->getSizeInCellsY(),
+        occupancy_grid_map_ptr_->getResolution(),
+        get_parameter("OccupancyGridMapFixedBlindSpot.distance_margin").as_double(), bbf_param);
+    }
+#else
+    RCLCPP_WARN(get_logger(), "use_cuda is set but built without CUDA, run on CPU.");
+#endif
+  }
+
   // initialize debug tool
   {
     using tier4_autoware_utils::DebugPublisher;
@@ -190,22 +219,52 @@ void PointcloudBasedOccupancyGridMapNode::onPointcloudWithObstacleAndRaw(
   occupancy_grid_map_ptr_->updateOrigin(
     gridmap_origin.position.x - occupancy_grid_map_ptr_->getSizeInMetersX() / 2,
     gridmap_origin.position.y - occupancy_grid_map_ptr_->getSizeInMetersY() / 2);
+#if ENABLE_GPU
+  if (cuda_occupancy_grid_map_ptr_) {
+    // the maps stay on the device and are copied to the host maps only to be published
+    cuda_occupancy_grid_map_ptr_->updateWithPointCloud(
+      filtered_raw_pc, filtered_obstacle_pc_common, robot_pose, scan_origin,
+      occupancy_grid_map_ptr_->getOriginX(), occupancy_grid_map_ptr_->getOriginY());
+    if (enable_single_frame_mode_) {
+      cuda_occupancy_grid_map_ptr_->copySingleFrameMapToHost(occupancy_grid_map_ptr_->getCharMap());
+    } else {
+      cuda_occupancy_grid_map_ptr_->updateBinaryBayesFilter();
+      // the same origin as the device map, the cells are overwritten by the device map
+      occupancy_grid_map_updater_ptr_->updateOrigin(
+        occupancy_grid_map_ptr_->getOriginX(), occupancy_grid_map_ptr_->getOriginY());
+      cuda_occupancy_grid_map_ptr_->copyUpdatedMapToHost(
+        occupancy_grid_map_updater_ptr_->getCharMap());
+    }
+  } else {
+    occupancy_grid_map_ptr_->updateWithPointCloud(
+      filtered_raw_pc, filtered_obstacle_pc_common, robot_pose, scan_origin);
+    if (!enable_single_frame_mode_) {
+      occupancy_grid_map_updater_ptr_->update(*occupancy_grid_map_ptr_);
+    }
+  }
+#else
   occupancy_grid_map_ptr_->updateWithPointCloud(
     filtered_raw_pc, filtered_obstacle_pc_common, robot_pose, scan_origin);
+  if (!enable_single_frame_mode_) {
+    // Update with bayes filter
+    occupancy_grid_map_updater_ptr_->update(*occupancy_grid_map_ptr_);
+  }
+#endif
 
   if (enable_single_frame_mode_) {
     // publish
-    occupancy_grid_map_pub_->publish(OccupancyGridMapToMsgPtr(
-      map_frame_, input_raw_msg->header.stamp, robot_pose.position.z,
-      *occupancy_grid_map_ptr_));  // (todo) robot_pose may be altered with gridmap_origin
+    tier4_autoware_utils::publishLoanedOrMoved(
+      occupancy_grid_map_pub_,
+      OccupancyGridMapToMsgPtr(
+        map_frame_, input_raw_msg->header.stamp, robot_pose.position.z,
+        *occupancy_grid_map_ptr_));  // (todo) robot_pose may be altered with gridmap_origin
   } else {
-    // Update with bayes filter
-    occupancy_grid_map_updater_ptr_->update(*occupancy_grid_map_ptr_);
-
     // publish
-    occupancy_grid_map_pub_->publish(OccupancyGridMapToMsgPtr(
-      map_frame_, input_raw_msg->header.stamp, robot_pose.position.z,
-      *occupancy_grid_map_updater_ptr_));
+    tier4_autoware_utils::publishLoanedOrMoved(
+      occupancy_grid_map_pub_,
+      OccupancyGridMapToMsgPtr(
+        map_frame_, input_raw_msg->header.stamp, robot_pose.position.z,
+        *occupancy_grid_map_updater_ptr_));
   }
 
   if (debug_publisher_ptr_ && stop_watch_ptr_) {
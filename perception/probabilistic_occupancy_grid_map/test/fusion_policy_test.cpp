@@ -74,3 +74,29 @@ TEST(FusionPolicyTest, TestDempsterShaferUpdateRule)
   std::vector<double> case3_1 = {OCCUPIED, FREE};
   EXPECT_NEAR(dempsterShaferFusion(case3_1), UNKNOWN, EPSILON);
 }
+
+// Test the log-odds fusion of rows against the fusion of each cell
+TEST(FusionPolicyTest, TestLogOddsRowFusion)
+{
+  using fusion_policy::FusionMethod;
+  using fusion_policy::singleFrameOccupancyFusion;
+  using fusion_policy::log_odds_fusion::logOddsFusion;
+
+  std::vector<unsigned char> row1(256);
+  std::vector<unsigned char> row2(256);
+  std::vector<unsigned char> row3(256);
+  for (size_t i = 0; i < row1.size(); ++i) {
+    row1[i] = static_cast<unsigned char>(i);
+    row2[i] = static_cast<unsigned char>(255 - i);
+    row3[i] = static_cast<unsigned char>((i * 7) % 256);
+  }
+  const std::vector<const unsigned char *> rows = {row1.data(), row2.data(), row3.data()};
+  const std::vector<double> weights = {0.5, 0.3, 0.2};
+
+  std::vector<unsigned char> fused_row(row1.size());
+  logOddsFusion(rows, weights, fused_row.size(), fused_row.data());
+  for (size_t i = 0; i < fused_row.size(); ++i) {
+    const std::vector<unsigned char> costs = {row1[i], row2[i], row3[i]};
+    EXPECT_EQ(fused_row[i], singleFrameOccupancyFusion(costs, FusionMethod::LOG_ODDS, weights));
+  }
+}
@@ -0,0 +1,122 @@
+// Copyright 2024 TIER IV, INC.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "probabilistic_occupancy_grid_map/pointcloud_based_occupancy_grid_map/angle_bins.hpp"
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using costmap_2d::AngleBins;
+using costmap_2d::createAngleBins;
+
+namespace
+{
+sensor_msgs::msg::PointCloud2 createPointCloud(const std::vector<std::array<float, 3>> & points)
+{
+  sensor_msgs::msg::PointCloud2 pointcloud;
+  sensor_msgs::PointCloud2Modifier modifier(pointcloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(points.size());
+  sensor_msgs::PointCloud2Iterator<float> iter_x(pointcloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(pointcloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(pointcloud, "z");
+  for (const auto & point : points) {
+    *iter_x = point[0];
+    *iter_y = point[1];
+    *iter_z = point[2];
+    ++iter_x, ++iter_y, ++iter_z;
+  }
+  return pointcloud;
+}
+
+// point at the range and the azimuth in degree, away from the bin boundaries
+std::array<float, 3> createPoint(const double range, const double angle_deg, const float z = 0.0f)
+{
+  const double angle = angle_deg * M_PI / 180.0;
+  return {
+    static_cast<float>(range * std::cos(angle)), static_cast<float>(range * std::sin(angle)), z};
+}
+
+geometry_msgs::msg::Pose createPose(const double x, const double y, const double z)
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.position.z = z;
+  pose.orientation.w = 1.0;
+  return pose;
+}
+
+// the bins at 45.05 and 135.05 degree
+constexpr size_t front_left_bin = 2250;
+constexpr size_t rear_left_bin = 3150;
+}  // namespace
+
+TEST(AngleBinsTest, sortPointsByRange)
+{
+  constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+  const auto pointcloud = createPointCloud(
+    {createPoint(10.0, 45.05), createPoint(3.0, 135.05, 1.0f), createPoint(5.0, 45.05),
+     {nan, 0.0f, 0.0f}});
+  AngleBins angle_bins;
+  createAngleBins(pointcloud, createPose(0.0, 0.0, 0.0), createPose(0.0, 0.0, 0.0), angle_bins);
+
+  ASSERT_EQ(angle_bins.size(), 3601u);
+  ASSERT_EQ(angle_bins.range.size(), 3u);
+  ASSERT_EQ(angle_bins.end(front_left_bin) - angle_bins.begin(front_left_bin), 2u);
+  EXPECT_NEAR(angle_bins.range[angle_bins.begin(front_left_bin)], 5.0, 1e-5);
+  EXPECT_NEAR(angle_bins.range[angle_bins.back(front_left_bin)], 10.0, 1e-5);
+  ASSERT_EQ(angle_bins.end(rear_left_bin) - angle_bins.begin(rear_left_bin), 1u);
+  EXPECT_NEAR(angle_bins.wz[angle_bins.begin(rear_left_bin)], 1.0, 1e-5);
+}
+
+TEST(AngleBinsTest, transformToScanOrigin)
+{
+  // the same bins and ranges with the robot and the scan origin moved together
+  const auto point = createPoint(5.0, 45.05);
+  const auto pointcloud = createPointCloud({point});
+  AngleBins angle_bins;
+  createAngleBins(pointcloud, createPose(10.0, 5.0, 1.0), createPose(10.0, 5.0, 2.0), angle_bins);
+
+  ASSERT_EQ(angle_bins.end(front_left_bin) - angle_bins.begin(front_left_bin), 1u);
+  const size_t point_index = angle_bins.begin(front_left_bin);
+  EXPECT_NEAR(angle_bins.range[point_index], 5.0, 1e-5);
+  EXPECT_NEAR(angle_bins.wx[point_index], 10.0 + point[0], 1e-4);
+  EXPECT_NEAR(angle_bins.wy[point_index], 5.0 + point[1], 1e-4);
+  EXPECT_NEAR(angle_bins.wz[point_index], 1.0, 1e-4);
+}
+
+TEST(AngleBinsTest, limitRangeByOtherBins)
+{
+  const auto pose = createPose(0.0, 0.0, 0.0);
+  AngleBins raw_bins;
+  createAngleBins(createPointCloud({createPoint(10.0, 45.05)}), pose, pose, raw_bins);
+
+  // the points beyond the raw point or in the bin without raw point are dropped
+  const auto obstacle_pointcloud = createPointCloud(
+    {createPoint(8.0, 45.05), createPoint(12.0, 45.05), createPoint(3.0, 135.05)});
+  AngleBins obstacle_bins;
+  createAngleBins(obstacle_pointcloud, pose, pose, obstacle_bins, &raw_bins);
+
+  ASSERT_EQ(obstacle_bins.range.size(), 1u);
+  ASSERT_EQ(obstacle_bins.end(front_left_bin) - obstacle_bins.begin(front_left_bin), 1u);
+  EXPECT_NEAR(obstacle_bins.range[obstacle_bins.begin(front_left_bin)], 8.0, 1e-5);
+  EXPECT_TRUE(obstacle_bins.empty(rear_left_bin));
+}
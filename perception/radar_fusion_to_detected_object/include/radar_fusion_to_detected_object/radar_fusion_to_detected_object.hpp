@@ -15,6 +15,7 @@
 #ifndef RADAR_FUSION_TO_DETECTED_OBJECT__RADAR_FUSION_TO_DETECTED_OBJECT_HPP_
 #define RADAR_FUSION_TO_DETECTED_OBJECT__RADAR_FUSION_TO_DETECTED_OBJECT_HPP_
 
+#include "object_recognition_utils/spatial_grid.hpp"
 #include "rclcpp/logger.hpp"
 #include "tier4_autoware_utils/geometry/boost_geometry.hpp"
 #define EIGEN_MPL2_ONLY
@@ -94,6 +95,11 @@ private:
   Param param_{};
   std::shared_ptr<std::vector<RadarInput>> filterRadarWithinObject(
     const DetectedObject & object, const std::shared_ptr<std::vector<RadarInput>> & radars);
+  std::shared_ptr<std::vector<RadarInput>> filterRadarWithinObject(
+    const DetectedObject & object, const std::vector<RadarInput> & radars,
+    const object_recognition_utils::SpatialGrid & radar_grid);
+  bool isRadarWithinObject(const RadarInput & radar, const LinearRing2d & object_box);
+  LinearRing2d createObject2dWithMargin(const DetectedObject & object);
   // TODO(Satoshi Tanaka): Implement
   // std::vector<DetectedObject> splitObject(
   //   const DetectedObject & object, const std::shared_ptr<std::vector<RadarInput>> & radars);
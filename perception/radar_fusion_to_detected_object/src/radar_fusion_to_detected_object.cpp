@@ -21,6 +21,7 @@
 #include <boost/geometry.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <memory>
 #include <numeric>
@@ -81,10 +82,28 @@ RadarFusionToDetectedObject::Output RadarFusionToDetectedObject::update(
     return output;
   }
 
+  // Index the radar data, so that each object is tested only with the radar data around it.
+  // The cells are as large as the circumscribed circle of the largest bounding box with margin, so
+  // the radar data within a bounding box are in the neighbor cells of its center.
+  double max_object_radius = 0.0;
+  for (const auto & object : input.objects->objects) {
+    max_object_radius = std::max(
+      max_object_radius,
+      std::hypot(
+        object.shape.dimensions.x / 2.0 + param_.bounding_box_margin,
+        object.shape.dimensions.y / 2.0 + param_.bounding_box_margin));
+  }
+  object_recognition_utils::SpatialGrid radar_grid(std::max(max_object_radius, 1e-3));
+  const std::vector<RadarInput> no_radars{};
+  const auto & radars = input.radars ? *input.radars : no_radars;
+  for (size_t radar_idx = 0; radar_idx < radars.size(); ++radar_idx) {
+    radar_grid.insert(radars.at(radar_idx).pose_with_covariance.pose.position, radar_idx);
+  }
+
   for (auto & object : input.objects->objects) {
     // Link between 3d bounding box and radar data
     std::shared_ptr<std::vector<RadarInput>> radars_within_object =
-      filterRadarWithinObject(object, input.radars);
+      filterRadarWithinObject(object, radars, radar_grid);
 
     // TODO(Satoshi Tanaka): Implement
     // Split the object going in a different direction
@@ -172,21 +191,56 @@ RadarFusionToDetectedObject::filterRadarWithinObject(
   const DetectedObject & object,
   const std::shared_ptr<std::vector<RadarFusionToDetectedObject::RadarInput>> & radars)
 {
-  std::vector<RadarInput> outputs{};
-
-  tier4_autoware_utils::Point2d object_size{object.shape.dimensions.x, object.shape.dimensions.y};
-  LinearRing2d object_box = createObject2dWithMargin(object_size, param_.bounding_box_margin);
-  object_box = tier4_autoware_utils::transformVector(
-    object_box, tier4_autoware_utils::pose2transform(object.kinematics.pose_with_covariance.pose));
-
+  auto outputs = std::make_shared<std::vector<RadarInput>>();
+  const LinearRing2d object_box = createObject2dWithMargin(object);
   for (const auto & radar : (*radars)) {
-    Point2d radar_point{
-      radar.pose_with_covariance.pose.position.x, radar.pose_with_covariance.pose.position.y};
-    if (boost::geometry::within(radar_point, object_box)) {
-      outputs.emplace_back(radar);
+    if (isRadarWithinObject(radar, object_box)) {
+      outputs->emplace_back(radar);
     }
   }
-  return std::make_shared<std::vector<RadarFusionToDetectedObject::RadarInput>>(outputs);
+  return outputs;
+}
+
+// Choose radar pointcloud/objects within the bounding box among the ones indexed around it.
+std::shared_ptr<std::vector<RadarFusionToDetectedObject::RadarInput>>
+RadarFusionToDetectedObject::filterRadarWithinObject(
+  const DetectedObject & object, const std::vector<RadarInput> & radars,
+  const object_recognition_utils::SpatialGrid & radar_grid)
+{
+  const LinearRing2d object_box = createObject2dWithMargin(object);
+  std::vector<size_t> radar_indices;
+  radar_grid.forEachNeighbor(
+    object.kinematics.pose_with_covariance.pose.position, [&](const size_t radar_idx) {
+      if (isRadarWithinObject(radars.at(radar_idx), object_box)) {
+        radar_indices.push_back(radar_idx);
+      }
+    });
+  // keep the order of the input as the estimation of twist depends on it
+  std::sort(radar_indices.begin(), radar_indices.end());
+
+  auto outputs = std::make_shared<std::vector<RadarInput>>();
+  outputs->reserve(radar_indices.size());
+  for (const size_t radar_idx : radar_indices) {
+    outputs->emplace_back(radars.at(radar_idx));
+  }
+  return outputs;
+}
+
+bool RadarFusionToDetectedObject::isRadarWithinObject(
+  const RadarInput & radar, const LinearRing2d & object_box)
+{
+  const Point2d radar_point{
+    radar.pose_with_covariance.pose.position.x, radar.pose_with_covariance.pose.position.y};
+  return boost::geometry::within(radar_point, object_box);
+}
+
+// Bounding box of the object with margin from bird's-eye view in the frame of the objects.
+LinearRing2d RadarFusionToDetectedObject::createObject2dWithMargin(const DetectedObject & object)
+{
+  const Point2d object_size{object.shape.dimensions.x, object.shape.dimensions.y};
+  return tier4_autoware_utils::transformVector(
+    createObject2dWithMargin(object_size, param_.bounding_box_margin),
+    tier4_autoware_utils::pose2transform(object.kinematics.pose_with_covariance.pose));
 }
 
 // TODO(Satoshi Tanaka): Implementation
@@ -21,6 +21,7 @@
 // #include "multi_object_tracker/utils/utils.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <list>
 #include <memory>
@@ -31,14 +32,15 @@ namespace
 {
 double getMahalanobisDistance(
   const geometry_msgs::msg::Point & measurement, const geometry_msgs::msg::Point & tracker,
-  const Eigen::Matrix2d & covariance)
+  const Eigen::Matrix2d & inverse_covariance)
 {
   Eigen::Vector2d measurement_point;
   measurement_point << measurement.x, measurement.y;
   Eigen::Vector2d tracker_point;
   tracker_point << tracker.x, tracker.y;
-  Eigen::MatrixXd mahalanobis_squared = (measurement_point - tracker_point).transpose() *
-                                        covariance.inverse() * (measurement_point - tracker_point);
+  const Eigen::Matrix<double, 1, 1> mahalanobis_squared =
+    (measurement_point - tracker_point).transpose() * inverse_covariance *
+    (measurement_point - tracker_point);
   return std::sqrt(mahalanobis_squared(0));
 }
 
@@ -164,41 +166,68 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
   log_data["time"] = measurements.header.stamp.sec + measurements.header.stamp.nanosec * 1e-9;
   nlohmann::json data_array = nlohmann::json::array();
 
-  Eigen::MatrixXd score_matrix =
-    Eigen::MatrixXd::Zero(trackers.size(), measurements.objects.size());
+  // trackers at the time of the measurements, which are evaluated once instead of for each pair
+  const size_t tracker_num = trackers.size();
+  std::vector<std::uint8_t> tracker_labels(tracker_num);
+  std::vector<autoware_auto_perception_msgs::msg::TrackedObject> tracked_objects(tracker_num);
+  std::vector<Eigen::Matrix2d> tracker_inverse_covariances(tracker_num);
   size_t tracker_idx = 0;
   for (auto tracker_itr = trackers.begin(); tracker_itr != trackers.end();
        ++tracker_itr, ++tracker_idx) {
-    const std::uint8_t tracker_label = (*tracker_itr)->getHighestProbLabel();
+    auto & tracked_object = tracked_objects.at(tracker_idx);
+    tracker_labels.at(tracker_idx) = (*tracker_itr)->getHighestProbLabel();
+    (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
+    tracker_inverse_covariances.at(tracker_idx) =
+      getXYCovariance(tracked_object.kinematics.pose_with_covariance).inverse();
+  }
+
+  const size_t measurement_num = measurements.objects.size();
+  std::vector<std::uint8_t> measurement_labels(measurement_num);
+  std::vector<double> measurement_areas(measurement_num);
+  for (size_t measurement_idx = 0; measurement_idx < measurement_num; ++measurement_idx) {
+    const auto & measurement_object = measurements.objects.at(measurement_idx);
+    measurement_labels.at(measurement_idx) =
+      object_recognition_utils::getHighestProbLabel(measurement_object.classification);
+    measurement_areas.at(measurement_idx) = tier4_autoware_utils::getArea(measurement_object.shape);
+  }
 
-    for (size_t measurement_idx = 0; measurement_idx < measurements.objects.size();
-         ++measurement_idx) {
+  Eigen::MatrixXd score_matrix = Eigen::MatrixXd::Zero(tracker_num, measurement_num);
+  for (tracker_idx = 0; tracker_idx < tracker_num; ++tracker_idx) {
+    const std::uint8_t tracker_label = tracker_labels.at(tracker_idx);
+    const auto & tracked_object = tracked_objects.at(tracker_idx);
+
+    for (size_t measurement_idx = 0; measurement_idx < measurement_num; ++measurement_idx) {
       const autoware_auto_perception_msgs::msg::DetectedObject & measurement_object =
         measurements.objects.at(measurement_idx);
-      const std::uint8_t measurement_label =
-        object_recognition_utils::getHighestProbLabel(measurement_object.classification);
-      // Create a JSON object to hold the log data for this pair
-      nlohmann::json pair_log_data;
-
-      autoware_auto_perception_msgs::msg::TrackedObject tracked_object;
-      (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
+      const std::uint8_t measurement_label = measurement_labels.at(measurement_idx);
+      const double area = measurement_areas.at(measurement_idx);
 
-      std::vector<double> tracker_pose = {
-        tracked_object.kinematics.pose_with_covariance.pose.position.x,
-        tracked_object.kinematics.pose_with_covariance.pose.position.y};
-      std::vector<double> measurement_pose = {
-        measurement_object.kinematics.pose_with_covariance.pose.position.x,
-        measurement_object.kinematics.pose_with_covariance.pose.position.y};
-      pair_log_data["tracker_uuid"] = tracked_object.object_id.uuid;
-      pair_log_data["tracker_idx"] = tracker_idx;
-      pair_log_data["measurement_idx"] = measurement_idx;
-      pair_log_data["tracker_label"] = tracker_label;
-      pair_log_data["measurement_label"] = measurement_label;
-      pair_log_data["gate_name"] = "";
-      pair_log_data["gate_value"] = 0.0;
-      pair_log_data["gate_threshold"] = 0.0;
-      pair_log_data["tracker_pose"] = tracker_pose;
-      pair_log_data["measurement_pose"] = measurement_pose;
+      // Create a JSON object to hold the log data for this pair, only if it is written
+      nlohmann::json pair_log_data;
+      const auto log_gate = [&](
+                              const char * gate_name, const double value, const double threshold) {
+        if (debug_log) {
+          pair_log_data["gate_name"] = gate_name;
+          pair_log_data["gate_value"] = value;
+          pair_log_data["gate_threshold"] = threshold;
+        }
+      };
+      if (debug_log) {
+        std::vector<double> tracker_pose = {
+          tracked_object.kinematics.pose_with_covariance.pose.position.x,
+          tracked_object.kinematics.pose_with_covariance.pose.position.y};
+        std::vector<double> measurement_pose = {
+          measurement_object.kinematics.pose_with_covariance.pose.position.x,
+          measurement_object.kinematics.pose_with_covariance.pose.position.y};
+        pair_log_data["tracker_uuid"] = tracked_object.object_id.uuid;
+        pair_log_data["tracker_idx"] = tracker_idx;
+        pair_log_data["measurement_idx"] = measurement_idx;
+        pair_log_data["tracker_label"] = tracker_label;
+        pair_log_data["measurement_label"] = measurement_label;
+        pair_log_data["tracker_pose"] = tracker_pose;
+        pair_log_data["measurement_pose"] = measurement_pose;
+        log_gate("", 0.0, 0.0);
+      }
 
       double score = 0.0;
       if (can_assign_matrix_(tracker_label, measurement_label)) {
@@ -213,21 +242,16 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
           if (max_dist < dist) {
             passed_gate = false;
           }
-          pair_log_data["gate_name"] = "dist gate";
-          pair_log_data["gate_value"] = dist;
-          pair_log_data["gate_threshold"] = max_dist;
+          log_gate("dist gate", dist, max_dist);
         }
         // area gate
         if (passed_gate) {
           const double max_area = max_area_matrix_(tracker_label, measurement_label);
           const double min_area = min_area_matrix_(tracker_label, measurement_label);
-          const double area = tier4_autoware_utils::getArea(measurement_object.shape);
           if (area < min_area || max_area < area) {
             passed_gate = false;
           }
-          pair_log_data["gate_name"] = "area gate";
-          pair_log_data["gate_value"] = area;
-          pair_log_data["gate_threshold"] = max_area;
+          log_gate("area gate", area, max_area);
         }
         // angle gate
         if (passed_gate) {
@@ -238,22 +262,18 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
           if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle)) {
             passed_gate = false;
           }
-          pair_log_data["gate_name"] = "angle gate";
-          pair_log_data["gate_value"] = angle;
-          pair_log_data["gate_threshold"] = max_rad;
+          log_gate("angle gate", angle, max_rad);
         }
         // mahalanobis dist gate
         if (passed_gate) {
           const double mahalanobis_dist = getMahalanobisDistance(
             measurement_object.kinematics.pose_with_covariance.pose.position,
             tracked_object.kinematics.pose_with_covariance.pose.position,
-            getXYCovariance(tracked_object.kinematics.pose_with_covariance));
+            tracker_inverse_covariances.at(tracker_idx));
           if (2.448 /*95%*/ <= mahalanobis_dist) {
             passed_gate = false;
           }
-          pair_log_data["gate_name"] = "mahalanobis dist gate";
-          pair_log_data["gate_value"] = mahalanobis_dist;
-          pair_log_data["gate_threshold"] = 2.448;
+          log_gate("mahalanobis dist gate", mahalanobis_dist, 2.448);
         }
         // 2d iou gate
         if (passed_gate) {
@@ -264,22 +284,24 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
           if (iou < min_iou) {
             passed_gate = false;
           }
-          pair_log_data["gate_name"] = "2d iou gate";
-          pair_log_data["gate_value"] = iou;
-          pair_log_data["gate_threshold"] = min_iou;
+          log_gate("2d iou gate", iou, min_iou);
         }
 
         // all gate is passed
         if (passed_gate) {
-          pair_log_data["gate_name"] = "all gate passed";
           score = (max_dist - std::min(dist, max_dist)) / max_dist;
           if (score < score_threshold_) {
             score = 0.0;
           }
         }
-        pair_log_data["passed_gate"] = passed_gate;
-        pair_log_data["score"] = score;
-        data_array.push_back(pair_log_data);
+        if (debug_log) {
+          if (passed_gate) {
+            pair_log_data["gate_name"] = "all gate passed";
+          }
+          pair_log_data["passed_gate"] = passed_gate;
+          pair_log_data["score"] = score;
+          data_array.push_back(pair_log_data);
+        }
       }
       score_matrix(tracker_idx, measurement_idx) = score;
     }
@@ -28,6 +28,7 @@
 #include <tf2_ros/create_timer_interface.h>
 #include <tf2_ros/create_timer_ros.h>
 
+#include <algorithm>
 #include <iterator>
 #include <list>
 #include <memory>
@@ -328,13 +329,40 @@ void RadarObjectTrackerNode::sanitizeTracker(
   constexpr float min_iou = 0.1;
   constexpr float min_iou_for_unknown_object = 0.001;
   constexpr double distance_threshold = 5.0;
+  const size_t tracker_num = list_tracker.size();
+  std::vector<std::shared_ptr<Tracker>> trackers(list_tracker.begin(), list_tracker.end());
+  std::vector<autoware_auto_perception_msgs::msg::TrackedObject> objects(tracker_num);
+  std::vector<bool> is_deleted(tracker_num, false);
+  // the trackers farther than the distance threshold from a tracker are out of its neighbor cells
+  object_recognition_utils::SpatialGrid tracker_grid(distance_threshold);
+  for (size_t tracker_idx = 0; tracker_idx < tracker_num; ++tracker_idx) {
+    trackers.at(tracker_idx)->getTrackedObject(time, objects.at(tracker_idx));
+    tracker_grid.insert(
+      objects.at(tracker_idx).kinematics.pose_with_covariance.pose.position, tracker_idx);
+  }
+
   /* delete collision tracker */
-  for (auto itr1 = list_tracker.begin(); itr1 != list_tracker.end(); ++itr1) {
-    autoware_auto_perception_msgs::msg::TrackedObject object1;
-    (*itr1)->getTrackedObject(time, object1);
-    for (auto itr2 = std::next(itr1); itr2 != list_tracker.end(); ++itr2) {
-      autoware_auto_perception_msgs::msg::TrackedObject object2;
-      (*itr2)->getTrackedObject(time, object2);
+  std::vector<size_t> neighbor_indices;
+  for (size_t idx1 = 0; idx1 < tracker_num; ++idx1) {
+    if (is_deleted.at(idx1)) {
+      continue;
+    }
+    const auto & tracker1 = trackers.at(idx1);
+    const auto & object1 = objects.at(idx1);
+
+    // compare with the remaining trackers in the order of the list
+    neighbor_indices.clear();
+    tracker_grid.forEachNeighbor(
+      object1.kinematics.pose_with_covariance.pose.position, [&](const size_t idx2) {
+        if (idx1 < idx2 && !is_deleted.at(idx2)) {
+          neighbor_indices.push_back(idx2);
+        }
+      });
+    std::sort(neighbor_indices.begin(), neighbor_indices.end());
+
+    for (const size_t idx2 : neighbor_indices) {
+      const auto & tracker2 = trackers.at(idx2);
+      const auto & object2 = objects.at(idx2);
       const double distance = std::hypot(
         object1.kinematics.pose_with_covariance.pose.position.x -
           object2.kinematics.pose_with_covariance.pose.position.x,
@@ -346,8 +374,8 @@ void RadarObjectTrackerNode::sanitizeTracker(
 
       const double min_union_iou_area = 1e-2;
       const auto iou = object_recognition_utils::get2dIoU(object1, object2, min_union_iou_area);
-      const auto & label1 = (*itr1)->getHighestProbLabel();
-      const auto & label2 = (*itr2)->getHighestProbLabel();
+      const auto & label1 = tracker1->getHighestProbLabel();
+      const auto & label2 = tracker2->getHighestProbLabel();
       bool should_delete_tracker1 = false;
       bool should_delete_tracker2 = false;
 
@@ -356,7 +384,7 @@ void RadarObjectTrackerNode::sanitizeTracker(
       if (label1 == Label::UNKNOWN || label2 == Label::UNKNOWN) {
         if (min_iou_for_unknown_object < iou) {
           if (label1 == Label::UNKNOWN && label2 == Label::UNKNOWN) {
-            if ((*itr1)->getTotalMeasurementCount() < (*itr2)->getTotalMeasurementCount()) {
+            if (tracker1->getTotalMeasurementCount() < tracker2->getTotalMeasurementCount()) {
               should_delete_tracker1 = true;
             } else {
               should_delete_tracker2 = true;
@@ -369,7 +397,7 @@ void RadarObjectTrackerNode::sanitizeTracker(
         }
       } else {  // If neither is UNKNOWN, delete the one with lower IOU.
         if (min_iou < iou) {
-          if ((*itr1)->getTotalMeasurementCount() < (*itr2)->getTotalMeasurementCount()) {
+          if (tracker1->getTotalMeasurementCount() < tracker2->getTotalMeasurementCount()) {
             should_delete_tracker1 = true;
           } else {
             should_delete_tracker2 = true;
@@ -378,15 +406,18 @@ void RadarObjectTrackerNode::sanitizeTracker(
       }
 
       if (should_delete_tracker1) {
-        itr1 = list_tracker.erase(itr1);
-        --itr1;
+        is_deleted.at(idx1) = true;
         break;
       } else if (should_delete_tracker2) {
-        itr2 = list_tracker.erase(itr2);
-        --itr2;
+        is_deleted.at(idx2) = true;
       }
     }
   }
+
+  // remove the deleted trackers keeping the order of the others
+  size_t tracker_idx = 0;
+  list_tracker.remove_if(
+    [&](const std::shared_ptr<Tracker> &) { return is_deleted.at(tracker_idx++); });
 }
 
 inline bool RadarObjectTrackerNode::shouldTrackerPublish(
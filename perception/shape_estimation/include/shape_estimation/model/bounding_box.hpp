@@ -28,6 +28,12 @@ private:
     autoware_auto_perception_msgs::msg::Shape & shape_output,
     geometry_msgs::msg::Pose & pose_output);
   float calcClosenessCriterion(const std::vector<float> & C_1, const std::vector<float> & C_2);
+  // project the points on the axes rotated by theta into C_1 and C_2, and calculate the criterion
+  float calcClosenessCriterion(
+    const std::vector<float> & x, const std::vector<float> & y, const float theta,
+    std::vector<float> & C_1, std::vector<float> & C_2);
+  void splitCoordinates(
+    const pcl::PointCloud<pcl::PointXYZ> & cluster, std::vector<float> & x, std::vector<float> & y);
   float optimize(
     const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle);
   float boostOptimize(
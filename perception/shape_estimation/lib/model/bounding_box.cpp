@@ -166,61 +166,80 @@ float BoundingBoxShapeModel::calcClosenessCriterion(
   const std::vector<float> & C_1, const std::vector<float> & C_2)
 {
   // Paper : Algo.4 Closeness Criterion
-  const float min_c_1 = *std::min_element(C_1.begin(), C_1.end());  // col.2, Algo.4
-  const float max_c_1 = *std::max_element(C_1.begin(), C_1.end());  // col.2, Algo.4
-  const float min_c_2 = *std::min_element(C_2.begin(), C_2.end());  // col.3, Algo.4
-  const float max_c_2 = *std::max_element(C_2.begin(), C_2.end());  // col.3, Algo.4
-
-  std::vector<float> D_1;  // col.4, Algo.4
-  for (const auto & c_1_element : C_1) {
-    const float v = std::min(max_c_1 - c_1_element, c_1_element - min_c_1);
-    D_1.push_back(v * v);
-  }
-
-  std::vector<float> D_2;  // col.5, Algo.4
-  for (const auto & c_2_element : C_2) {
-    const float v = std::min(max_c_2 - c_2_element, c_2_element - min_c_2);
-    D_2.push_back(v * v);
-  }
+  const auto [min_c_1_it, max_c_1_it] = std::minmax_element(C_1.begin(), C_1.end());
+  const auto [min_c_2_it, max_c_2_it] = std::minmax_element(C_2.begin(), C_2.end());
+  const float min_c_1 = *min_c_1_it;  // col.2, Algo.4
+  const float max_c_1 = *max_c_1_it;  // col.2, Algo.4
+  const float min_c_2 = *min_c_2_it;  // col.3, Algo.4
+  const float max_c_2 = *max_c_2_it;  // col.3, Algo.4
+
+  // NOTE: D_1 and D_2 are computed for each point in the same loop instead of storing them.
   constexpr float d_min = 0.1 * 0.1;
   constexpr float d_max = 0.4 * 0.4;
   float beta = 0;  // col.6, Algo.4
-  for (size_t i = 0; i < D_1.size(); ++i) {
-    if (d_max < std::min(D_1.at(i), D_2.at(i))) {
+  for (size_t i = 0; i < C_1.size(); ++i) {
+    const float v_1 = std::min(max_c_1 - C_1[i], C_1[i] - min_c_1);  // col.4, Algo.4
+    const float v_2 = std::min(max_c_2 - C_2[i], C_2[i] - min_c_2);  // col.5, Algo.4
+    const float d = std::min(v_1 * v_1, v_2 * v_2);
+    if (d_max < d) {
       continue;
     }
-    const float d = std::max(std::min(D_1.at(i), D_2.at(i)), d_min);
-    beta += 1.0 / d;
+    beta += 1.0 / std::max(d, d_min);
   }
   return beta;
 }
 
+float BoundingBoxShapeModel::calcClosenessCriterion(
+  const std::vector<float> & x, const std::vector<float> & y, const float theta,
+  std::vector<float> & C_1, std::vector<float> & C_2)
+{
+  Eigen::Vector2f e_1;
+  e_1 << std::cos(theta), std::sin(theta);  // col.3, Algo.2
+  Eigen::Vector2f e_2;
+  e_2 << -std::sin(theta), std::cos(theta);  // col.4, Algo.2
+
+  // the buffers are reused for all the angles, and the loop over the arrays is vectorized
+  const size_t size = x.size();
+  C_1.resize(size);  // col.5, Algo.2
+  C_2.resize(size);  // col.6, Algo.2
+  const float e_1_x = e_1.x();
+  const float e_1_y = e_1.y();
+  const float e_2_x = e_2.x();
+  const float e_2_y = e_2.y();
+  for (size_t i = 0; i < size; ++i) {
+    C_1[i] = x[i] * e_1_x + y[i] * e_1_y;
+    C_2[i] = x[i] * e_2_x + y[i] * e_2_y;
+  }
+  return calcClosenessCriterion(C_1, C_2);
+}
+
+void BoundingBoxShapeModel::splitCoordinates(
+  const pcl::PointCloud<pcl::PointXYZ> & cluster, std::vector<float> & x, std::vector<float> & y)
+{
+  x.resize(cluster.size());
+  y.resize(cluster.size());
+  for (size_t i = 0; i < cluster.size(); ++i) {
+    x[i] = cluster[i].x;
+    y[i] = cluster[i].y;
+  }
+}
+
 float BoundingBoxShapeModel::optimize(
   const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle)
 {
-  std::vector<std::pair<float /*theta*/, float /*q*/>> Q;
-  constexpr float angle_resolution = M_PI / 180.0;
-  for (float theta = min_angle; theta <= max_angle + epsilon; theta += angle_resolution) {
-    Eigen::Vector2f e_1;
-    e_1 << std::cos(theta), std::sin(theta);  // col.3, Algo.2
-    Eigen::Vector2f e_2;
-    e_2 << -std::sin(theta), std::cos(theta);  // col.4, Algo.2
-    std::vector<float> C_1;                    // col.5, Algo.2
-    std::vector<float> C_2;                    // col.6, Algo.2
-    for (const auto & point : cluster) {
-      C_1.push_back(point.x * e_1.x() + point.y * e_1.y());
-      C_2.push_back(point.x * e_2.x() + point.y * e_2.y());
-    }
-    float q = calcClosenessCriterion(C_1, C_2);  // col.7, Algo.2
-    Q.push_back(std::make_pair(theta, q));       // col.8, Algo.2
-  }
+  std::vector<float> x, y, C_1, C_2;
+  splitCoordinates(cluster, x, y);
 
   float theta_star{0.0};  // col.10, Algo.2
   float max_q = 0.0;
-  for (size_t i = 0; i < Q.size(); ++i) {
-    if (max_q < Q.at(i).second || i == 0) {
-      max_q = Q.at(i).second;
-      theta_star = Q.at(i).first;
+  constexpr float angle_resolution = M_PI / 180.0;
+  bool is_first = true;
+  for (float theta = min_angle; theta <= max_angle + epsilon; theta += angle_resolution) {
+    const float q = calcClosenessCriterion(x, y, theta, C_1, C_2);  // col.7, Algo.2
+    if (max_q < q || is_first) {                                      // col.8, Algo.2
+      max_q = q;
+      theta_star = theta;
+      is_first = false;
     }
   }
 
@@ -230,18 +249,11 @@ float BoundingBoxShapeModel::optimize(
 float BoundingBoxShapeModel::boostOptimize(
   const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle)
 {
+  std::vector<float> x, y, C_1, C_2;
+  splitCoordinates(cluster, x, y);
+
   auto closeness_func = [&](float theta) {
-    Eigen::Vector2f e_1;
-    e_1 << std::cos(theta), std::sin(theta);  // col.3, Algo.2
-    Eigen::Vector2f e_2;
-    e_2 << -std::sin(theta), std::cos(theta);  // col.4, Algo.2
-    std::vector<float> C_1;                    // col.5, Algo.2
-    std::vector<float> C_2;                    // col.6, Algo.2
-    for (const auto & point : cluster) {
-      C_1.push_back(point.x * e_1.x() + point.y * e_1.y());
-      C_2.push_back(point.x * e_2.x() + point.y * e_2.y());
-    }
-    float q = calcClosenessCriterion(C_1, C_2);
+    float q = calcClosenessCriterion(x, y, theta, C_1, C_2);
     return -q;
   };
 
@@ -31,9 +31,17 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 using Label = autoware_auto_perception_msgs::msg::ObjectClassification;
 
+namespace
+{
+// result of the shape estimation of each object, which is packed after the parallel loop
+enum class EstimationResult : uint8_t { SKIPPED, SUCCEEDED, FAILED };
+}  // namespace
+
 ShapeEstimationNode::ShapeEstimationNode(const rclcpp::NodeOptions & node_options)
 : Node("shape_estimation", node_options)
 {
@@ -86,11 +94,20 @@ void ShapeEstimationNode::callback(const DetectedObjectsWithFeature::ConstShared
   }
 
   // Create output msg
-  DetectedObjectsWithFeature output_msg;
-  output_msg.header = input_msg->header;
+  // NOTE: The output is published as unique_ptr, so that it is not copied when the subscriber is
+  //       in the same container with intra-process communication.
+  auto output_msg = std::make_unique<DetectedObjectsWithFeature>();
+  output_msg->header = input_msg->header;
 
   // Estimate shape for each object and pack msg
-  for (const auto & feature_object : input_msg->feature_objects) {
+  // NOTE: The clusters are estimated in parallel, and packed in the order of the input objects.
+  const size_t num_objects = input_msg->feature_objects.size();
+  std::vector<autoware_auto_perception_msgs::msg::Shape> shapes(num_objects);
+  std::vector<geometry_msgs::msg::Pose> poses(num_objects);
+  std::vector<EstimationResult> results(num_objects, EstimationResult::SKIPPED);
+#pragma omp parallel for schedule(dynamic)
+  for (size_t i = 0; i < num_objects; ++i) {
+    const auto & feature_object = input_msg->feature_objects.at(i);
     const auto & object = feature_object.object;
     const auto label = get_label(object.classification);
     const auto is_vehicle = label_is_vehicle(label);
@@ -105,8 +122,6 @@ void ShapeEstimationNode::callback(const DetectedObjectsWithFeature::ConstShared
     }
 
     // estimate shape and pose
-    autoware_auto_perception_msgs::msg::Shape shape;
-    geometry_msgs::msg::Pose pose;
     boost::optional<ReferenceYawInfo> ref_yaw_info = boost::none;
     boost::optional<ReferenceShapeSizeInfo> ref_shape_size_info = boost::none;
     if (use_vehicle_reference_yaw_ && is_vehicle) {
@@ -118,24 +133,34 @@ void ShapeEstimationNode::callback(const DetectedObjectsWithFeature::ConstShared
       ref_shape_size_info = ReferenceShapeSizeInfo{object.shape, ReferenceShapeSizeInfo::Mode::Min};
     }
     const bool estimated_success = estimator_->estimateShapeAndPose(
-      label, *cluster, ref_yaw_info, ref_shape_size_info, shape, pose);
+      label, *cluster, ref_yaw_info, ref_shape_size_info, shapes.at(i), poses.at(i));
+    results.at(i) = estimated_success ? EstimationResult::SUCCEEDED : EstimationResult::FAILED;
+  }
+
+  for (size_t i = 0; i < num_objects; ++i) {
+    if (results.at(i) == EstimationResult::SKIPPED) {
+      continue;
+    }
+    const bool estimated_success = results.at(i) == EstimationResult::SUCCEEDED;
 
     // If the shape estimation fails, change to Unknown object.
     if (!fix_filtered_objects_label_to_unknown_ && !estimated_success) {
       continue;
     }
-    output_msg.feature_objects.push_back(feature_object);
+    output_msg->feature_objects.push_back(input_msg->feature_objects.at(i));
+    auto & output_object = output_msg->feature_objects.back().object;
     if (!estimated_success) {
-      output_msg.feature_objects.back().object.classification.front().label = Label::UNKNOWN;
+      output_object.classification.front().label = Label::UNKNOWN;
     }
 
-    output_msg.feature_objects.back().object.shape = shape;
-    output_msg.feature_objects.back().object.kinematics.pose_with_covariance.pose = pose;
+    output_object.shape = shapes.at(i);
+    output_object.kinematics.pose_with_covariance.pose = poses.at(i);
   }
 
   // Publish
-  pub_->publish(output_msg);
-  published_time_publisher_->publish_if_subscribed(pub_, output_msg.header.stamp);
+  const auto stamp = output_msg->header.stamp;
+  pub_->publish(std::move(output_msg));
+  published_time_publisher_->publish_if_subscribed(pub_, stamp);
   processing_time_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
     "debug/cyclic_time_ms", stop_watch_ptr_->toc("cyclic_time", true));
   processing_time_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
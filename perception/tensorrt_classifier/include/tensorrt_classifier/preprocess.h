@@ -178,4 +178,25 @@ extern void multi_scale_resize_bilinear_letterbox_nhwc_to_nchw32_batch_gpu(
   float * dst, unsigned char * src, int d_w, int d_h, int d_c, Roi * d_roi, int s_w, int s_h,
   int s_c, int batch, float norm, cudaStream_t stream);
 
+/**
+ * @brief Optimized preprocessing including crop, resize, letterbox, nhwc2nchw, toFloat and
+ * normalization by mean and std for classification with batching on gpus
+ * @param[out] dst processed images
+ * @param[in] src image that all the regions are cropped from
+ * @param[in] d_w width for output
+ * @param[in] d_h height for output
+ * @param[in] d_c channel for output
+ * @param[in] d_roi regions of interest for cropping, one for each batch
+ * @param[in] s_w width for input
+ * @param[in] s_h height for input
+ * @param[in] s_c channel for input
+ * @param[in] batch batch size
+ * @param[in] mean mean of each channel
+ * @param[in] inv_std inverse of std of each channel
+ * @param[in] stream cuda stream
+ */
+extern void crop_resize_bilinear_letterbox_nhwc_to_nchw32_normalize_batch_gpu(
+  float * dst, const unsigned char * src, int d_w, int d_h, int d_c, const Roi * d_roi, int s_w,
+  int s_h, int s_c, int batch, float3 mean, float3 inv_std, cudaStream_t stream);
+
 #endif  // TENSORRT_CLASSIFIER__PREPROCESS_H_
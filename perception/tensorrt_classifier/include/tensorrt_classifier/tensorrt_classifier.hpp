@@ -19,6 +19,7 @@
 #include <cuda_utils/cuda_unique_ptr.hpp>
 #include <cuda_utils/stream_unique_ptr.hpp>
 #include <opencv2/opencv.hpp>
+#include <tensorrt_classifier/preprocess.h>
 #include <tensorrt_common/tensorrt_common.hpp>
 
 #include <memory>
@@ -75,6 +76,19 @@ public:
     const std::vector<cv::Mat> & images, std::vector<int> & results,
     std::vector<float> & probabilities);
 
+  /**
+   * @brief run inference on the regions of interest of an image, which are cropped, resized and
+   * normalized on GPU
+   * @param[in] image source image
+   * @param[in] rois regions of interest, which are classified together as one batch
+   * @param[out] results class index of each region
+   * @param[out] probabilities probability of each region
+   * @warning The number of the regions must not exceed the maximum batch size
+   */
+  bool doInferenceWithRoi(
+    const cv::Mat & image, const std::vector<cv::Rect> & rois, std::vector<int> & results,
+    std::vector<float> & probabilities);
+
   /**
    * @brief allocate buffer for preprocess on GPU
    * @param[in] width original image width
@@ -98,9 +112,15 @@ private:
    */
   void preprocessGpu(const std::vector<cv::Mat> & images);
 
+  /**
+   * @brief run preprocess including crop, resizing, letterbox, NHWC2NCHW and normalization on GPU
+   * @param[in] image source image
+   * @param[in] rois regions of interest
+   */
+  void preprocessWithRoiGpu(const cv::Mat & image, const std::vector<cv::Rect> & rois);
+
   bool feedforwardAndDecode(
-    const std::vector<cv::Mat> & images, std::vector<int> & results,
-    std::vector<float> & probabilities);
+    const int batch_size, std::vector<int> & results, std::vector<float> & probabilities);
 
   std::unique_ptr<tensorrt_common::TrtCommon> trt_common_;
 
@@ -128,6 +148,17 @@ private:
   int src_height_;
   int batch_size_;
   CudaUniquePtrHost<float[]> out_prob_h_;
+
+  // host buffer of the source image for preprocessing with ROI
+  CudaUniquePtrHost<unsigned char[]> roi_image_buf_h_;
+  // device buffer of the source image for preprocessing with ROI
+  CudaUniquePtr<unsigned char[]> roi_image_buf_d_;
+  // bytes of the buffers of the source image
+  std::size_t roi_image_buf_size_{0};
+  // host pointer for ROI
+  CudaUniquePtrHost<Roi[]> roi_h_;
+  // device pointer for ROI
+  CudaUniquePtr<Roi[]> roi_d_;
 };
 }  // namespace tensorrt_classifier
 
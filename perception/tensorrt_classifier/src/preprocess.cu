@@ -594,3 +594,69 @@ void multi_scale_resize_bilinear_letterbox_nhwc_to_nchw32_batch_gpu(
   multi_scale_resize_bilinear_letterbox_nhwc_to_nchw32_batch_kernel<<<
     cuda_gridsize(N), BLOCK, 0, stream>>>(N, dst, src, d_h, d_w, s_h, s_w, d_roi, norm, batch);
 }
+
+__global__ void crop_resize_bilinear_letterbox_nhwc_to_nchw32_normalize_batch_kernel(
+  int N, float * dst_img, const unsigned char * src_img, int dst_h, int dst_w, int src_h,
+  int src_w, const Roi * d_roi, float3 mean, float3 inv_std)
+{
+  // one thread for each pixel of each batch
+  int index = (blockIdx.x + blockIdx.y * gridDim.x) * blockDim.x + threadIdx.x;
+
+  if (index >= N) return;
+  int C = 3;
+  int H = dst_h;
+  int W = dst_w;
+
+  int w = index % W;
+  int h = (index / W) % H;
+  int b = index / (W * H);
+
+  // all the regions are cropped from the same image
+  Roi roi = d_roi[b];
+  int crop_w = roi.w < 1 ? 1 : roi.w;
+  int crop_h = roi.h < 1 ? 1 : roi.h;
+  // resize keeping the aspect ratio and pad the right and the bottom, as done on CPU
+  float scale = fminf(W / (float)crop_w, H / (float)crop_h);
+  int letter_bot = (int)(scale * crop_h);
+  int letter_right = (int)(scale * crop_w);
+  bool is_padding = h >= letter_bot || w >= letter_right;
+
+  float src_y = fminf(fmaxf((h + 0.5f) / scale - 0.5f, 0.0f), (float)(crop_h - 1));
+  float src_x = fminf(fmaxf((w + 0.5f) / scale - 0.5f, 0.0f), (float)(crop_w - 1));
+  int y0 = (int)src_y;
+  int x0 = (int)src_x;
+  float dy = src_y - y0;
+  float dx = src_x - x0;
+  int y1 = min(roi.y + min(y0 + 1, crop_h - 1), src_h - 1);
+  int x1 = min(roi.x + min(x0 + 1, crop_w - 1), src_w - 1);
+  y0 = min(roi.y + y0, src_h - 1);
+  x0 = min(roi.x + x0, src_w - 1);
+
+  float means[3] = {mean.x, mean.y, mean.z};
+  float inv_stds[3] = {inv_std.x, inv_std.y, inv_std.z};
+  int stride = src_w * C;
+
+  for (int c = 0; c < C; c++) {
+    float value = 0.0f;
+    if (!is_padding) {
+      // NHWC
+      float f00 = src_img[y0 * stride + x0 * C + c];
+      float f01 = src_img[y0 * stride + x1 * C + c];
+      float f10 = src_img[y1 * stride + x0 * C + c];
+      float f11 = src_img[y1 * stride + x1 * C + c];
+      value = (1.0f - dy) * ((1.0f - dx) * f00 + dx * f01) + dy * ((1.0f - dx) * f10 + dx * f11);
+    }
+    // NCHW
+    int dst_index = w + (W * h) + (W * H * c) + b * (W * H * C);
+    dst_img[dst_index] = (value - means[c]) * inv_stds[c];
+  }
+}
+
+void crop_resize_bilinear_letterbox_nhwc_to_nchw32_normalize_batch_gpu(
+  float * dst, const unsigned char * src, int d_w, int d_h, int d_c, const Roi * d_roi, int s_w,
+  int s_h, int s_c, int batch, float3 mean, float3 inv_std, cudaStream_t stream)
+{
+  int N = d_w * d_h * batch;
+  crop_resize_bilinear_letterbox_nhwc_to_nchw32_normalize_batch_kernel<<<
+    cuda_gridsize(N), BLOCK, 0, stream>>>(N, dst, src, d_h, d_w, s_h, s_w, d_roi, mean, inv_std);
+}
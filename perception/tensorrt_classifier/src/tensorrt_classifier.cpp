@@ -350,20 +350,81 @@ bool TrtClassifier::doInference(
   }
   preprocess_opt(images);
 
-  return feedforwardAndDecode(images, results, probabilities);
+  return feedforwardAndDecode(static_cast<int>(images.size()), results, probabilities);
 }
 
-bool TrtClassifier::feedforwardAndDecode(
-  const std::vector<cv::Mat> & images, std::vector<int> & results,
+void TrtClassifier::preprocessWithRoiGpu(const cv::Mat & image, const std::vector<cv::Rect> & rois)
+{
+  const auto batch_size = static_cast<int>(rois.size());
+  auto input_dims = trt_common_->getBindingDimensions(0);
+  input_dims.d[0] = batch_size;
+  trt_common_->setBindingDimensions(0, input_dims);
+  const int input_height = input_dims.d[2];
+  const int input_width = input_dims.d[3];
+
+  // The image is uploaded only once, and all the regions are cropped from it on GPU
+  const std::size_t image_size = image.cols * image.rows * 3 * sizeof(unsigned char);
+  if (roi_image_buf_size_ < image_size) {
+    roi_image_buf_h_ =
+      cuda_utils::make_unique_host<unsigned char[]>(image_size, cudaHostAllocWriteCombined);
+    roi_image_buf_d_ = cuda_utils::make_unique<unsigned char[]>(image_size);
+    roi_image_buf_size_ = image_size;
+  }
+  if (!roi_h_) {
+    roi_h_ = cuda_utils::make_unique_host<Roi[]>(batch_size_, cudaHostAllocWriteCombined);
+    roi_d_ = cuda_utils::make_unique<Roi[]>(batch_size_);
+  }
+
+  // Copy into pinned memory, which also makes the image continuous
+  cv::Mat pinned_image(image.rows, image.cols, CV_8UC3, roi_image_buf_h_.get());
+  image.copyTo(pinned_image);
+  const cv::Rect image_rect(0, 0, image.cols, image.rows);
+  for (int b = 0; b < batch_size; b++) {
+    const cv::Rect roi = rois[b] & image_rect;
+    roi_h_[b].x = roi.x;
+    roi_h_[b].y = roi.y;
+    roi_h_[b].w = roi.width;
+    roi_h_[b].h = roi.height;
+  }
+
+  // Copy into device memory
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    roi_image_buf_d_.get(), roi_image_buf_h_.get(), image_size, cudaMemcpyHostToDevice,
+    *stream_));
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    roi_d_.get(), roi_h_.get(), batch_size * sizeof(Roi), cudaMemcpyHostToDevice, *stream_));
+  crop_resize_bilinear_letterbox_nhwc_to_nchw32_normalize_batch_gpu(
+    input_d_.get(), roi_image_buf_d_.get(), input_width, input_height, 3, roi_d_.get(), image.cols,
+    image.rows, 3, batch_size, make_float3(mean_[0], mean_[1], mean_[2]),
+    make_float3(inv_std_[0], inv_std_[1], inv_std_[2]), *stream_);
+  // No Need for Sync
+}
+
+bool TrtClassifier::doInferenceWithRoi(
+  const cv::Mat & image, const std::vector<cv::Rect> & rois, std::vector<int> & results,
   std::vector<float> & probabilities)
+{
+  if (!trt_common_->isInitialized()) {
+    return false;
+  }
+  if (
+    image.empty() || image.type() != CV_8UC3 || rois.empty() ||
+    static_cast<int>(rois.size()) > batch_size_) {
+    return false;
+  }
+  preprocessWithRoiGpu(image, rois);
+
+  return feedforwardAndDecode(static_cast<int>(rois.size()), results, probabilities);
+}
+
+bool TrtClassifier::feedforwardAndDecode(
+  const int batch_size, std::vector<int> & results, std::vector<float> & probabilities)
 {
   results.clear();
   probabilities.clear();
   std::vector<void *> buffers = {input_d_.get(), out_prob_d_.get()};
   trt_common_->enqueueV2(buffers.data(), *stream_, nullptr);
 
-  int batch_size = static_cast<int>(images.size());
-
   CHECK_CUDA_ERROR(cudaMemcpyAsync(
     out_prob_h_.get(), out_prob_d_.get(), sizeof(float) * out_elem_num_, cudaMemcpyDeviceToHost,
     *stream_));
@@ -139,10 +139,16 @@ private:
 
   /**
    * @brief run preprocess on GPU
-   * @param[in] images batching images
+   * @param[in] images batching images, which may differ in size
    */
   void preprocessGpu(const std::vector<cv::Mat> & images);
 
+  /**
+   * @brief allocate buffers for preprocess on GPU unless the current ones hold size bytes
+   * @param[in] size bytes of the source images
+   */
+  void reserveImageBuffer(std::size_t size);
+
   /**
    * @brief run preprocess including resizing, letterbox, NHWC2NCHW and toFloat on CPU
    * @param[in] images batching images
@@ -172,6 +178,12 @@ private:
    */
   void multiScalePreprocessGpu(const cv::Mat & image, const std::vector<cv::Rect> & rois);
 
+  /**
+   * @brief copy the images preprocessed on CPU to the input buffer on GPU asynchronously
+   * @param[in] chw_images preprocessed images in NCHW order
+   */
+  void copyInputAsync(const cv::Mat & chw_images);
+
   bool multiScaleFeedforward(const cv::Mat & image, int batch_size, ObjectArrays & objects);
   bool multiScaleFeedforwardAndDecode(
     const cv::Mat & images, int batch_size, ObjectArrays & objects);
@@ -208,12 +220,16 @@ private:
 
   std::unique_ptr<tensorrt_common::TrtCommon> trt_common_;
 
-  std::vector<float> input_h_;
+  CudaUniquePtrHost<float[]> input_h_;
   CudaUniquePtr<float[]> input_d_;
   CudaUniquePtr<int32_t[]> out_num_detections_d_;
   CudaUniquePtr<float[]> out_boxes_d_;
   CudaUniquePtr<float[]> out_scores_d_;
   CudaUniquePtr<int32_t[]> out_classes_d_;
+  CudaUniquePtrHost<int32_t[]> out_num_detections_h_;
+  CudaUniquePtrHost<float[]> out_boxes_h_;
+  CudaUniquePtrHost<float[]> out_scores_h_;
+  CudaUniquePtrHost<int32_t[]> out_classes_h_;
 
   bool needs_output_decode_;
   size_t out_elem_num_;
@@ -237,6 +253,8 @@ private:
   CudaUniquePtrHost<unsigned char[]> image_buf_h_;
   // device buffer for preprocessing on GPU
   CudaUniquePtr<unsigned char[]> image_buf_d_;
+  // bytes of the buffers for preprocessing on GPU
+  std::size_t image_buf_size_{0};
   // normalization factor used for preprocessing
   double norm_factor_;
 
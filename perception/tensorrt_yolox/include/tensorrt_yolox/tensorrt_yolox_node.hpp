@@ -50,17 +50,28 @@ public:
 
 private:
   void onConnect();
-  void onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg);
+  void onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg, std::size_t image_id);
+  void onBatchTimeout();
+  void inferPendingImages();
   bool readLabelFile(const std::string & label_path);
   void replaceLabelMap();
 
-  image_transport::Publisher image_pub_;
-  rclcpp::Publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>::SharedPtr objects_pub_;
+  // one element per camera, the topics are suffixed with the camera index unless image_number is 1
+  std::vector<image_transport::Publisher> image_pubs_;
+  std::vector<rclcpp::Publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>::SharedPtr>
+    objects_pubs_;
 
-  image_transport::Subscriber image_sub_;
+  std::vector<image_transport::Subscriber> image_subs_;
 
   rclcpp::TimerBase::SharedPtr timer_;
 
+  // the images of the cameras are collected within batch_timeout_ms and inferred as a batch
+  std::size_t image_number_{1};
+  // batch size of a model without the dynamic batch axis, 0 for the others
+  std::size_t fixed_batch_size_{0};
+  std::vector<sensor_msgs::msg::Image::ConstSharedPtr> pending_images_;
+  rclcpp::TimerBase::SharedPtr batch_timer_;
+
   LabelMap label_map_;
   std::unique_ptr<tensorrt_yolox::TrtYoloX> trt_yolox_;
   std::unique_ptr<tier4_autoware_utils::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
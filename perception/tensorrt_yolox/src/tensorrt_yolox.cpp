@@ -208,6 +208,8 @@ TrtYoloX::TrtYoloX(
   if (needs_output_decode_) {
     const auto output_dims = trt_common_->getBindingDimensions(1);
     input_d_ = cuda_utils::make_unique<float[]>(batch_config[2] * input_size);
+    input_h_ = cuda_utils::make_unique_host<float[]>(
+      batch_config[2] * input_size, cudaHostAllocWriteCombined);
     out_elem_num_ = std::accumulate(
       output_dims.d + 1, output_dims.d + output_dims.nbDims, 1, std::multiplies<int>());
     out_elem_num_ = out_elem_num_ * batch_config[2];
@@ -229,10 +231,20 @@ TrtYoloX::TrtYoloX(
     const auto out_scores_dims = trt_common_->getBindingDimensions(3);
     max_detections_ = out_scores_dims.d[1];
     input_d_ = cuda_utils::make_unique<float[]>(batch_config[2] * input_size);
+    input_h_ = cuda_utils::make_unique_host<float[]>(
+      batch_config[2] * input_size, cudaHostAllocWriteCombined);
     out_num_detections_d_ = cuda_utils::make_unique<int32_t[]>(batch_config[2]);
     out_boxes_d_ = cuda_utils::make_unique<float[]>(batch_config[2] * max_detections_ * 4);
     out_scores_d_ = cuda_utils::make_unique<float[]>(batch_config[2] * max_detections_);
     out_classes_d_ = cuda_utils::make_unique<int32_t[]>(batch_config[2] * max_detections_);
+    out_num_detections_h_ =
+      cuda_utils::make_unique_host<int32_t[]>(batch_config[2], cudaHostAllocPortable);
+    out_boxes_h_ = cuda_utils::make_unique_host<float[]>(
+      batch_config[2] * max_detections_ * 4, cudaHostAllocPortable);
+    out_scores_h_ = cuda_utils::make_unique_host<float[]>(
+      batch_config[2] * max_detections_, cudaHostAllocPortable);
+    out_classes_h_ = cuda_utils::make_unique_host<int32_t[]>(
+      batch_config[2] * max_detections_, cudaHostAllocPortable);
   }
   if (use_gpu_preprocess) {
     use_gpu_preprocess_ = true;
@@ -290,9 +302,7 @@ void TrtYoloX::initPreprocessBuffer(int width, int height)
       for (int b = 0; b < batch_size_; b++) {
         scales_.emplace_back(scale);
       }
-      image_buf_h_ = cuda_utils::make_unique_host<unsigned char[]>(
-        width * height * 3 * batch_size_, cudaHostAllocWriteCombined);
-      image_buf_d_ = cuda_utils::make_unique<unsigned char[]>(width * height * 3 * batch_size_);
+      reserveImageBuffer(width * height * 3 * batch_size_);
     }
   }
 }
@@ -302,62 +312,69 @@ void TrtYoloX::printProfiling(void)
   trt_common_->printProfiling();
 }
 
+void TrtYoloX::reserveImageBuffer(const std::size_t size)
+{
+  if (image_buf_h_ && image_buf_d_ && size <= image_buf_size_) {
+    return;
+  }
+  image_buf_h_ = cuda_utils::make_unique_host<unsigned char[]>(size, cudaHostAllocWriteCombined);
+  image_buf_d_ = cuda_utils::make_unique<unsigned char[]>(size);
+  image_buf_size_ = size;
+}
+
 void TrtYoloX::preprocessGpu(const std::vector<cv::Mat> & images)
 {
   const auto batch_size = images.size();
   auto input_dims = trt_common_->getBindingDimensions(0);
 
   input_dims.d[0] = batch_size;
-  for (const auto & image : images) {
-    // if size of source input has been changed...
-    int width = image.cols;
-    int height = image.rows;
-    if (src_width_ != -1 || src_height_ != -1) {
-      if (width != src_width_ || height != src_height_) {
-        // Free cuda memory to reallocate
-        if (image_buf_h_) {
-          image_buf_h_.reset();
-        }
-        if (image_buf_d_) {
-          image_buf_d_.reset();
-        }
-      }
-    }
-    src_width_ = width;
-    src_height_ = height;
-  }
-  if (!image_buf_h_) {
-    trt_common_->setBindingDimensions(0, input_dims);
-    scales_.clear();
-  }
+  trt_common_->setBindingDimensions(0, input_dims);
   const float input_height = static_cast<float>(input_dims.d[2]);
   const float input_width = static_cast<float>(input_dims.d[3]);
-  int b = 0;
+  const std::size_t input_chw_size = 3 * input_dims.d[2] * input_dims.d[3];
+
+  // the images of a batch, e.g. from several cameras, may differ in size, so they are packed one
+  // after another and the buffer keeps the largest size seen so far
+  std::size_t images_size = 0;
   for (const auto & image : images) {
-    if (!image_buf_h_) {
-      const float scale = std::min(input_width / image.cols, input_height / image.rows);
-      scales_.emplace_back(scale);
-      image_buf_h_ = cuda_utils::make_unique_host<unsigned char[]>(
-        image.cols * image.rows * 3 * batch_size, cudaHostAllocWriteCombined);
-      image_buf_d_ =
-        cuda_utils::make_unique<unsigned char[]>(image.cols * image.rows * 3 * batch_size);
-    }
-    int index = b * image.cols * image.rows * 3;
+    images_size += image.cols * image.rows * 3;
+  }
+  reserveImageBuffer(images_size);
+  src_width_ = images.back().cols;
+  src_height_ = images.back().rows;
+
+  scales_.clear();
+  std::size_t index = 0;
+  for (const auto & image : images) {
+    const float scale = std::min(input_width / image.cols, input_height / image.rows);
+    scales_.emplace_back(scale);
     // Copy into pinned memory
     memcpy(
       image_buf_h_.get() + index, &image.data[0],
       image.cols * image.rows * 3 * sizeof(unsigned char));
-    b++;
+    index += image.cols * image.rows * 3;
   }
   // Copy into device memory
   CHECK_CUDA_ERROR(cudaMemcpyAsync(
-    image_buf_d_.get(), image_buf_h_.get(),
-    images[0].cols * images[0].rows * 3 * batch_size * sizeof(unsigned char),
+    image_buf_d_.get(), image_buf_h_.get(), images_size * sizeof(unsigned char),
     cudaMemcpyHostToDevice, *stream_));
   // Preprocess on GPU
-  resize_bilinear_letterbox_nhwc_to_nchw32_batch_gpu(
-    input_d_.get(), image_buf_d_.get(), input_width, input_height, 3, images[0].cols,
-    images[0].rows, 3, batch_size, static_cast<float>(norm_factor_), *stream_);
+  const bool is_same_size = std::all_of(images.begin(), images.end(), [&](const cv::Mat & image) {
+    return image.size() == images[0].size();
+  });
+  if (is_same_size) {
+    resize_bilinear_letterbox_nhwc_to_nchw32_batch_gpu(
+      input_d_.get(), image_buf_d_.get(), input_width, input_height, 3, images[0].cols,
+      images[0].rows, 3, batch_size, static_cast<float>(norm_factor_), *stream_);
+    return;
+  }
+  index = 0;
+  for (std::size_t b = 0; b < batch_size; ++b) {
+    resize_bilinear_letterbox_nhwc_to_nchw32_gpu(
+      input_d_.get() + b * input_chw_size, image_buf_d_.get() + index, input_width, input_height,
+      3, images[b].cols, images[b].rows, 3, static_cast<float>(norm_factor_), *stream_);
+    index += images[b].cols * images[b].rows * 3;
+  }
 }
 
 void TrtYoloX::preprocess(const std::vector<cv::Mat> & images)
@@ -397,12 +414,7 @@ void TrtYoloX::preprocess(const std::vector<cv::Mat> & images)
   const auto chw_images = cv::dnn::blobFromImages(
     dst_images, norm_factor_, cv::Size(), cv::Scalar(), false, false, CV_32F);
 
-  const auto data_length = chw_images.total();
-  input_h_.reserve(data_length);
-  const auto flat = chw_images.reshape(1, data_length);
-  input_h_ = chw_images.isContinuous() ? flat : flat.clone();
-  CHECK_CUDA_ERROR(cudaMemcpy(
-    input_d_.get(), input_h_.data(), input_h_.size() * sizeof(float), cudaMemcpyHostToDevice));
+  copyInputAsync(chw_images);
   // No Need for Sync
 }
 
@@ -468,12 +480,7 @@ void TrtYoloX::preprocessWithRoiGpu(
       input_width / static_cast<float>(rois[b].width),
       input_height / static_cast<float>(rois[b].height));
     scales_.emplace_back(scale);
-    if (!image_buf_h_) {
-      image_buf_h_ = cuda_utils::make_unique_host<unsigned char[]>(
-        image.cols * image.rows * 3 * batch_size, cudaHostAllocWriteCombined);
-      image_buf_d_ =
-        cuda_utils::make_unique<unsigned char[]>(image.cols * image.rows * 3 * batch_size);
-    }
+    reserveImageBuffer(image.cols * image.rows * 3 * batch_size);
     int index = b * image.cols * image.rows * 3;
     // Copy into pinned memory
     // memcpy(&(m_h_img[index]), &image.data[0], image.cols * image.rows * 3 * sizeof(unsigned
@@ -542,15 +549,21 @@ void TrtYoloX::preprocessWithRoi(
   const auto chw_images = cv::dnn::blobFromImages(
     dst_images, norm_factor_, cv::Size(), cv::Scalar(), false, false, CV_32F);
 
-  const auto data_length = chw_images.total();
-  input_h_.reserve(data_length);
-  const auto flat = chw_images.reshape(1, data_length);
-  input_h_ = chw_images.isContinuous() ? flat : flat.clone();
-  CHECK_CUDA_ERROR(cudaMemcpy(
-    input_d_.get(), input_h_.data(), input_h_.size() * sizeof(float), cudaMemcpyHostToDevice));
+  copyInputAsync(chw_images);
   // No Need for Sync
 }
 
+void TrtYoloX::copyInputAsync(const cv::Mat & chw_images)
+{
+  // The images are staged in the pinned buffer, so that the copy runs asynchronously
+  const cv::Mat input = chw_images.isContinuous() ? chw_images : chw_images.clone();
+  const auto data_length = input.total();
+  std::copy_n(input.ptr<float>(), data_length, input_h_.get());
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    input_d_.get(), input_h_.get(), data_length * sizeof(float), cudaMemcpyHostToDevice,
+    *stream_));
+}
+
 void TrtYoloX::multiScalePreprocessGpu(const cv::Mat & image, const std::vector<cv::Rect> & rois)
 {
   const auto batch_size = rois.size();
@@ -598,11 +611,7 @@ void TrtYoloX::multiScalePreprocessGpu(const cv::Mat & image, const std::vector<
     roi_h_[b].w = rois[b].width;
     roi_h_[b].h = rois[b].height;
   }
-  if (!image_buf_h_) {
-    image_buf_h_ = cuda_utils::make_unique_host<unsigned char[]>(
-      image.cols * image.rows * 3 * 1, cudaHostAllocWriteCombined);
-    image_buf_d_ = cuda_utils::make_unique<unsigned char[]>(image.cols * image.rows * 3 * 1);
-  }
+  reserveImageBuffer(image.cols * image.rows * 3 * 1);
   int index = 0 * image.cols * image.rows * 3;
   // Copy into pinned memory
   memcpy(
@@ -647,12 +656,7 @@ void TrtYoloX::multiScalePreprocess(const cv::Mat & image, const std::vector<cv:
   const auto chw_images = cv::dnn::blobFromImages(
     dst_images, norm_factor_, cv::Size(), cv::Scalar(), false, false, CV_32F);
 
-  const auto data_length = chw_images.total();
-  input_h_.reserve(data_length);
-  const auto flat = chw_images.reshape(1, data_length);
-  input_h_ = chw_images.isContinuous() ? flat : flat.clone();
-  CHECK_CUDA_ERROR(cudaMemcpy(
-    input_d_.get(), input_h_.data(), input_h_.size() * sizeof(float), cudaMemcpyHostToDevice));
+  copyInputAsync(chw_images);
   // No Need for Sync
 }
 
@@ -705,10 +709,11 @@ bool TrtYoloX::feedforward(const std::vector<cv::Mat> & images, ObjectArrays & o
   trt_common_->enqueueV2(buffers.data(), *stream_, nullptr);
 
   const auto batch_size = images.size();
-  auto out_num_detections = std::make_unique<int32_t[]>(batch_size);
-  auto out_boxes = std::make_unique<float[]>(4 * batch_size * max_detections_);
-  auto out_scores = std::make_unique<float[]>(batch_size * max_detections_);
-  auto out_classes = std::make_unique<int32_t[]>(batch_size * max_detections_);
+  // NOTE: The outputs are copied into the pinned buffers, so that the copies run asynchronously.
+  const auto & out_num_detections = out_num_detections_h_;
+  const auto & out_boxes = out_boxes_h_;
+  const auto & out_scores = out_scores_h_;
+  const auto & out_classes = out_classes_h_;
 
   CHECK_CUDA_ERROR(cudaMemcpyAsync(
     out_num_detections.get(), out_num_detections_d_.get(), sizeof(int32_t) * batch_size,
@@ -781,10 +786,10 @@ bool TrtYoloX::multiScaleFeedforward(const cv::Mat & image, int batch_size, Obje
 
   trt_common_->enqueueV2(buffers.data(), *stream_, nullptr);
 
-  auto out_num_detections = std::make_unique<int32_t[]>(batch_size);
-  auto out_boxes = std::make_unique<float[]>(4 * batch_size * max_detections_);
-  auto out_scores = std::make_unique<float[]>(batch_size * max_detections_);
-  auto out_classes = std::make_unique<int32_t[]>(batch_size * max_detections_);
+  const auto & out_num_detections = out_num_detections_h_;
+  const auto & out_boxes = out_boxes_h_;
+  const auto & out_scores = out_scores_h_;
+  const auto & out_classes = out_classes_h_;
 
   CHECK_CUDA_ERROR(cudaMemcpyAsync(
     out_num_detections.get(), out_num_detections_d_.get(), sizeof(int32_t) * batch_size,
@@ -20,10 +20,19 @@
 
 #include <algorithm>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
+namespace
+{
+std::string getTopicSuffix(const std::size_t image_number, const std::size_t image_id)
+{
+  return image_number == 1 ? std::string{} : std::to_string(image_id);
+}
+}  // namespace
+
 namespace tensorrt_yolox
 {
 TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
@@ -91,10 +100,23 @@ TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
      "the dynamic range instead of using any calibration"));
   bool preprocess_on_gpu = declare_parameter_with_description(
     "preprocess_on_gpu", true, "If true, pre-processing is performed on GPU");
+  bool use_cuda_graph = declare_parameter_with_description(
+    "use_cuda_graph", false,
+    ("If true, the inference is captured into a CUDA graph and replayed for each frame. "
+     "This option is not applied when profile_per_layer is true"));
   std::string calibration_image_list_path = declare_parameter_with_description(
     "calibration_image_list_path", "",
     ("Path to a file which contains path to images."
      "Those images will be used for int8 quantization."));
+  const int image_number = declare_parameter_with_description(
+    "image_number", 1,
+    ("The number of the cameras whose images are inferred together as one batch. "
+     "If larger than 1, the topics of each camera are suffixed with its index as ~/in/image0"));
+  const double batch_timeout_ms = declare_parameter_with_description(
+    "batch_timeout_ms", 50.0,
+    ("The time to wait for the images of all the cameras after the first one of a batch arrives. "
+     "This option is valid only when image_number is larger than 1"));
+  image_number_ = static_cast<std::size_t>(std::max(image_number, 1));
 
   if (!readLabelFile(label_path)) {
     RCLCPP_ERROR(this->get_logger(), "Could not find label file");
@@ -104,18 +126,41 @@ TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
 
   tensorrt_common::BuildConfig build_config(
     calibration_algorithm, dla_core_id, quantize_first_layer, quantize_last_layer,
-    profile_per_layer, clip_value);
+    profile_per_layer, clip_value, use_cuda_graph);
+
+  // one engine takes the images of all the cameras, and a model with a fixed batch size gets
+  // the empty slots of a batch padded
+  tensorrt_common::BatchConfig batch_config{1, 1, 1};
+  if (image_number_ > 1) {
+    const auto input_dims = tensorrt_common::get_input_dims(model_path);
+    const auto image_number_i32 = static_cast<int32_t>(image_number_);
+    if (input_dims.d[0] > 0 && input_dims.d[0] < image_number_i32) {
+      throw std::runtime_error("The batch size of the model is smaller than image_number.");
+    }
+    fixed_batch_size_ = input_dims.d[0] > 0 ? static_cast<std::size_t>(input_dims.d[0]) : 0;
+    const int32_t max_batch_size = std::max(input_dims.d[0], image_number_i32);
+    batch_config = {input_dims.d[0] > 0 ? max_batch_size : 1, max_batch_size, max_batch_size};
+  }
 
   trt_yolox_ = std::make_unique<tensorrt_yolox::TrtYoloX>(
     model_path, precision, label_map_.size(), score_threshold, nms_threshold, build_config,
-    preprocess_on_gpu, calibration_image_list_path);
+    preprocess_on_gpu, calibration_image_list_path, 1.0, "", batch_config);
 
   timer_ =
     rclcpp::create_timer(this, get_clock(), 100ms, std::bind(&TrtYoloXNode::onConnect, this));
 
-  objects_pub_ = this->create_publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
-    "~/out/objects", 1);
-  image_pub_ = image_transport::create_publisher(this, "~/out/image");
+  for (std::size_t image_id = 0; image_id < image_number_; ++image_id) {
+    const auto suffix = getTopicSuffix(image_number_, image_id);
+    objects_pubs_.push_back(
+      this->create_publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
+        "~/out/objects" + suffix, 1));
+    image_pubs_.push_back(image_transport::create_publisher(this, "~/out/image" + suffix));
+  }
+  pending_images_.resize(image_number_);
+  batch_timer_ = this->create_wall_timer(
+    std::chrono::duration<double, std::milli>(batch_timeout_ms),
+    std::bind(&TrtYoloXNode::onBatchTimeout, this));
+  batch_timer_->cancel();
 
   if (declare_parameter("build_only", false)) {
     RCLCPP_INFO(this->get_logger(), "TensorRT engine file is built and exit.");
@@ -126,62 +171,123 @@ TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
 void TrtYoloXNode::onConnect()
 {
   using std::placeholders::_1;
-  if (
-    objects_pub_->get_subscription_count() == 0 &&
-    objects_pub_->get_intra_process_subscription_count() == 0 &&
-    image_pub_.getNumSubscribers() == 0) {
-    image_sub_.shutdown();
-  } else if (!image_sub_) {
-    image_sub_ = image_transport::create_subscription(
-      this, "~/in/image", std::bind(&TrtYoloXNode::onImage, this, _1), "raw",
-      rmw_qos_profile_sensor_data);
+  bool has_subscribers = false;
+  for (std::size_t image_id = 0; image_id < image_number_; ++image_id) {
+    has_subscribers |= objects_pubs_[image_id]->get_subscription_count() > 0 ||
+                       objects_pubs_[image_id]->get_intra_process_subscription_count() > 0 ||
+                       image_pubs_[image_id].getNumSubscribers() > 0;
+  }
+  if (!has_subscribers) {
+    for (auto & image_sub : image_subs_) {
+      image_sub.shutdown();
+    }
+    image_subs_.clear();
+    std::fill(pending_images_.begin(), pending_images_.end(), nullptr);
+  } else if (image_subs_.empty()) {
+    for (std::size_t image_id = 0; image_id < image_number_; ++image_id) {
+      image_subs_.push_back(image_transport::create_subscription(
+        this, "~/in/image" + getTopicSuffix(image_number_, image_id),
+        std::bind(&TrtYoloXNode::onImage, this, _1, image_id), "raw",
+        rmw_qos_profile_sensor_data));
+    }
   }
 }
 
-void TrtYoloXNode::onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg)
+void TrtYoloXNode::onImage(
+  const sensor_msgs::msg::Image::ConstSharedPtr msg, const std::size_t image_id)
 {
+  // the next image of a camera already in the batch closes the batch
+  if (pending_images_.at(image_id)) {
+    inferPendingImages();
+  }
+  pending_images_.at(image_id) = msg;
+
+  const bool is_batch_complete =
+    std::all_of(pending_images_.begin(), pending_images_.end(), [](const auto & image) {
+      return image != nullptr;
+    });
+  if (is_batch_complete) {
+    inferPendingImages();
+  } else if (batch_timer_->is_canceled()) {
+    batch_timer_->reset();
+  }
+}
+
+void TrtYoloXNode::onBatchTimeout()
+{
+  inferPendingImages();
+}
+
+void TrtYoloXNode::inferPendingImages()
+{
+  batch_timer_->cancel();
+  std::vector<sensor_msgs::msg::Image::ConstSharedPtr> msgs(image_number_);
+  msgs.swap(pending_images_);
+
   stop_watch_ptr_->toc("processing_time", true);
-  tier4_perception_msgs::msg::DetectedObjectsWithFeature out_objects;
 
-  cv_bridge::CvImagePtr in_image_ptr;
-  try {
-    in_image_ptr = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::BGR8);
-  } catch (cv_bridge::Exception & e) {
-    RCLCPP_ERROR(this->get_logger(), "cv_bridge exception: %s", e.what());
+  std::vector<std::size_t> image_ids;
+  std::vector<cv_bridge::CvImagePtr> in_image_ptrs;
+  std::vector<cv::Mat> images;
+  for (std::size_t image_id = 0; image_id < image_number_; ++image_id) {
+    if (!msgs[image_id]) {
+      continue;
+    }
+    try {
+      in_image_ptrs.push_back(
+        cv_bridge::toCvCopy(msgs[image_id], sensor_msgs::image_encodings::BGR8));
+    } catch (cv_bridge::Exception & e) {
+      RCLCPP_ERROR(this->get_logger(), "cv_bridge exception: %s", e.what());
+      continue;
+    }
+    image_ids.push_back(image_id);
+    images.push_back(in_image_ptrs.back()->image);
+  }
+  if (images.empty()) {
     return;
   }
-  const auto width = in_image_ptr->image.cols;
-  const auto height = in_image_ptr->image.rows;
+  if (images.size() < fixed_batch_size_) {
+    const cv::Mat padding_image = images.back();
+    images.resize(fixed_batch_size_, padding_image);
+  }
 
   tensorrt_yolox::ObjectArrays objects;
-  if (!trt_yolox_->doInference({in_image_ptr->image}, objects)) {
+  if (!trt_yolox_->doInference(images, objects)) {
     RCLCPP_WARN(this->get_logger(), "Fail to inference");
     return;
   }
-  for (const auto & yolox_object : objects.at(0)) {
-    tier4_perception_msgs::msg::DetectedObjectWithFeature object;
-    object.feature.roi.x_offset = yolox_object.x_offset;
-    object.feature.roi.y_offset = yolox_object.y_offset;
-    object.feature.roi.width = yolox_object.width;
-    object.feature.roi.height = yolox_object.height;
-    object.object.existence_probability = yolox_object.score;
-    object.object.classification =
-      object_recognition_utils::toObjectClassifications(label_map_[yolox_object.type], 1.0f);
-    out_objects.feature_objects.push_back(object);
-    const auto left = std::max(0, static_cast<int>(object.feature.roi.x_offset));
-    const auto top = std::max(0, static_cast<int>(object.feature.roi.y_offset));
-    const auto right =
-      std::min(static_cast<int>(object.feature.roi.x_offset + object.feature.roi.width), width);
-    const auto bottom =
-      std::min(static_cast<int>(object.feature.roi.y_offset + object.feature.roi.height), height);
-    cv::rectangle(
-      in_image_ptr->image, cv::Point(left, top), cv::Point(right, bottom), cv::Scalar(0, 0, 255), 3,
-      8, 0);
-  }
-  image_pub_.publish(in_image_ptr->toImageMsg());
-
-  out_objects.header = msg->header;
-  objects_pub_->publish(out_objects);
+  for (std::size_t b = 0; b < image_ids.size(); ++b) {
+    const auto image_id = image_ids[b];
+    auto & in_image_ptr = in_image_ptrs[b];
+    const auto width = in_image_ptr->image.cols;
+    const auto height = in_image_ptr->image.rows;
+
+    tier4_perception_msgs::msg::DetectedObjectsWithFeature out_objects;
+    for (const auto & yolox_object : objects.at(b)) {
+      tier4_perception_msgs::msg::DetectedObjectWithFeature object;
+      object.feature.roi.x_offset = yolox_object.x_offset;
+      object.feature.roi.y_offset = yolox_object.y_offset;
+      object.feature.roi.width = yolox_object.width;
+      object.feature.roi.height = yolox_object.height;
+      object.object.existence_probability = yolox_object.score;
+      object.object.classification =
+        object_recognition_utils::toObjectClassifications(label_map_[yolox_object.type], 1.0f);
+      out_objects.feature_objects.push_back(object);
+      const auto left = std::max(0, static_cast<int>(object.feature.roi.x_offset));
+      const auto top = std::max(0, static_cast<int>(object.feature.roi.y_offset));
+      const auto right =
+        std::min(static_cast<int>(object.feature.roi.x_offset + object.feature.roi.width), width);
+      const auto bottom =
+        std::min(static_cast<int>(object.feature.roi.y_offset + object.feature.roi.height), height);
+      cv::rectangle(
+        in_image_ptr->image, cv::Point(left, top), cv::Point(right, bottom),
+        cv::Scalar(0, 0, 255), 3, 8, 0);
+    }
+    image_pubs_[image_id].publish(in_image_ptr->toImageMsg());
+
+    out_objects.header = msgs[image_id]->header;
+    objects_pubs_[image_id]->publish(out_objects);
+  }
 
   if (debug_publisher_) {
     const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
@@ -189,7 +295,8 @@ void TrtYoloXNode::onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg)
     const double pipeline_latency_ms =
       std::chrono::duration<double, std::milli>(
         std::chrono::nanoseconds(
-          (this->get_clock()->now() - out_objects.header.stamp).nanoseconds()))
+          (this->get_clock()->now() - rclcpp::Time(msgs[image_ids.front()]->header.stamp))
+            .nanoseconds()))
         .count();
     debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
       "debug/cyclic_time_ms", cyclic_time_ms);
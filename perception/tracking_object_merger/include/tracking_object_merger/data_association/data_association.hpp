@@ -26,10 +26,12 @@
 
 #define EIGEN_MPL2_ONLY
 #include "tracking_object_merger/data_association/solver/gnn_solver.hpp"
+#include "object_recognition_utils/spatial_grid.hpp"
 #include "tracking_object_merger/utils/tracker_state.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
+#include <Eigen/SparseCore>
 
 #include <autoware_auto_perception_msgs/msg/detected_objects.hpp>
 #include <autoware_auto_perception_msgs/msg/tracked_objects.hpp>
@@ -38,15 +40,24 @@
 
 class DataAssociation
 {
+public:
+  // row : objects1 or trackers, col : objects0, only the pairs passing all the gates are stored
+  using ScoreMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
 private:
   Eigen::MatrixXi can_assign_matrix_;
   Eigen::MatrixXd max_dist_matrix_;
   Eigen::MatrixXd max_rad_matrix_;
   Eigen::MatrixXd min_iou_matrix_;
   Eigen::MatrixXd max_velocity_diff_matrix_;
+  // largest distance gate of the assignable labels, the cell size of the spatial pre-gate
+  double max_dist_;
   const double score_threshold_;
   std::unique_ptr<gnn_solver::GnnSolverInterface> gnn_solver_ptr_;
 
+  object_recognition_utils::SpatialGrid createGrid(
+    const autoware_auto_perception_msgs::msg::TrackedObjects & objects) const;
+
 public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   DataAssociation(
@@ -54,17 +65,18 @@ public:
     std::vector<double> max_rad_vector, std::vector<double> min_iou_vector,
     std::vector<double> max_velocity_diff_vector);
   void assign(
-    const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
+    const ScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
     std::unordered_map<int, int> & reverse_assignment);
-  Eigen::MatrixXd calcScoreMatrix(
+  ScoreMatrix calcScoreMatrix(
     const autoware_auto_perception_msgs::msg::TrackedObjects & objects0,
     const autoware_auto_perception_msgs::msg::TrackedObjects & objects1);
-  Eigen::MatrixXd calcScoreMatrix(
+  ScoreMatrix calcScoreMatrix(
     const autoware_auto_perception_msgs::msg::TrackedObjects & objects0,
     const std::vector<TrackerState> & trackers);
   double calcScoreBetweenObjects(
     const autoware_auto_perception_msgs::msg::TrackedObject & object0,
     const autoware_auto_perception_msgs::msg::TrackedObject & object1) const;
+  double getMaxDistance() const { return max_dist_; }
   virtual ~DataAssociation() {}
 };
 
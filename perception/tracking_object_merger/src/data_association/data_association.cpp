@@ -51,7 +51,7 @@ DataAssociation::DataAssociation(
   std::vector<int> can_assign_vector, std::vector<double> max_dist_vector,
   std::vector<double> max_rad_vector, std::vector<double> min_iou_vector,
   std::vector<double> max_velocity_diff_vector)
-: score_threshold_(0.01)
+: max_dist_(0.0), score_threshold_(0.01)
 {
   {
     const int assign_label_num = static_cast<int>(std::sqrt(can_assign_vector.size()));
@@ -85,25 +85,33 @@ DataAssociation::DataAssociation(
     max_velocity_diff_matrix_ = max_velocity_diff_matrix_tmp.transpose();
   }
 
+  for (int label1 = 0; label1 < can_assign_matrix_.rows(); ++label1) {
+    for (int label0 = 0; label0 < can_assign_matrix_.cols(); ++label0) {
+      if (can_assign_matrix_(label1, label0)) {
+        max_dist_ = std::max(max_dist_, max_dist_matrix_(label1, label0));
+      }
+    }
+  }
+
   gnn_solver_ptr_ = std::make_unique<gnn_solver::MuSSP>();
 }
 
 void DataAssociation::assign(
-  const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
+  const ScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
   std::unordered_map<int, int> & reverse_assignment)
 {
-  std::vector<std::vector<double>> score(src.rows());
-  for (int row = 0; row < src.rows(); ++row) {
-    score.at(row).resize(src.cols());
-    for (int col = 0; col < src.cols(); ++col) {
-      score.at(row).at(col) = src(row, col);
+  // the solver takes a dense matrix, where the pairs not passing the gates score zero
+  std::vector<std::vector<double>> score(src.rows(), std::vector<double>(src.cols(), 0.0));
+  for (int row = 0; row < src.outerSize(); ++row) {
+    for (ScoreMatrix::InnerIterator itr(src, row); itr; ++itr) {
+      score.at(row).at(itr.col()) = itr.value();
     }
   }
   // Solve
   gnn_solver_ptr_->maximizeLinearAssignment(score, &direct_assignment, &reverse_assignment);
 
   for (auto itr = direct_assignment.begin(); itr != direct_assignment.end();) {
-    if (src(itr->first, itr->second) < score_threshold_) {
+    if (src.coeff(itr->first, itr->second) < score_threshold_) {
       itr = direct_assignment.erase(itr);
       continue;
     } else {
@@ -111,7 +119,7 @@ void DataAssociation::assign(
     }
   }
   for (auto itr = reverse_assignment.begin(); itr != reverse_assignment.end();) {
-    if (src(itr->second, itr->first) < score_threshold_) {
+    if (src.coeff(itr->second, itr->first) < score_threshold_) {
       itr = reverse_assignment.erase(itr);
       continue;
     } else {
@@ -126,23 +134,29 @@ void DataAssociation::assign(
  *
  * @param objects0 : measurements
  * @param objects1 : base objects(tracker objects)
- * @return Eigen::MatrixXd
+ * @return ScoreMatrix
  */
-Eigen::MatrixXd DataAssociation::calcScoreMatrix(
+DataAssociation::ScoreMatrix DataAssociation::calcScoreMatrix(
   const autoware_auto_perception_msgs::msg::TrackedObjects & objects0,
   const autoware_auto_perception_msgs::msg::TrackedObjects & objects1)
 {
-  Eigen::MatrixXd score_matrix =
-    Eigen::MatrixXd::Zero(objects1.objects.size(), objects0.objects.size());
+  const auto objects0_grid = createGrid(objects0);
+  std::vector<Eigen::Triplet<double>> scores;
   for (size_t objects1_idx = 0; objects1_idx < objects1.objects.size(); ++objects1_idx) {
     const auto & object1 = objects1.objects.at(objects1_idx);
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
-      const auto & object0 = objects0.objects.at(objects0_idx);
-      const double score = calcScoreBetweenObjects(object0, object1);
-
-      score_matrix(objects1_idx, objects0_idx) = score;
-    }
+    objects0_grid.forEachNeighbor(
+      object1.kinematics.pose_with_covariance.pose.position, [&](const size_t objects0_idx) {
+        const auto & object0 = objects0.objects.at(objects0_idx);
+        const double score = calcScoreBetweenObjects(object0, object1);
+        if (0.0 < score) {
+          scores.emplace_back(
+            static_cast<int>(objects1_idx), static_cast<int>(objects0_idx), score);
+        }
+      });
   }
+
+  ScoreMatrix score_matrix(objects1.objects.size(), objects0.objects.size());
+  score_matrix.setFromTriplets(scores.begin(), scores.end());
   return score_matrix;
 }
 
@@ -151,24 +165,41 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
  *
  * @param objects0 : measurements
  * @param objects1 : tracker inner objects
- * @return Eigen::MatrixXd
+ * @return ScoreMatrix
  */
-Eigen::MatrixXd DataAssociation::calcScoreMatrix(
+DataAssociation::ScoreMatrix DataAssociation::calcScoreMatrix(
   const autoware_auto_perception_msgs::msg::TrackedObjects & objects0,
   const std::vector<TrackerState> & trackers)
 {
-  Eigen::MatrixXd score_matrix = Eigen::MatrixXd::Zero(trackers.size(), objects0.objects.size());
+  const auto objects0_grid = createGrid(objects0);
+  std::vector<Eigen::Triplet<double>> scores;
   for (size_t trackers_idx = 0; trackers_idx < trackers.size(); ++trackers_idx) {
     const auto & object1 = trackers.at(trackers_idx).getObject();
+    objects0_grid.forEachNeighbor(
+      object1.kinematics.pose_with_covariance.pose.position, [&](const size_t objects0_idx) {
+        const auto & object0 = objects0.objects.at(objects0_idx);
+        const double score = calcScoreBetweenObjects(object0, object1);
+        if (0.0 < score) {
+          scores.emplace_back(
+            static_cast<int>(trackers_idx), static_cast<int>(objects0_idx), score);
+        }
+      });
+  }
 
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
-      const auto & object0 = objects0.objects.at(objects0_idx);
-      const double score = calcScoreBetweenObjects(object0, object1);
+  ScoreMatrix score_matrix(trackers.size(), objects0.objects.size());
+  score_matrix.setFromTriplets(scores.begin(), scores.end());
+  return score_matrix;
+}
 
-      score_matrix(trackers_idx, objects0_idx) = score;
-    }
+object_recognition_utils::SpatialGrid DataAssociation::createGrid(
+  const autoware_auto_perception_msgs::msg::TrackedObjects & objects) const
+{
+  // the objects out of the neighbor cells of the grid are farther than any distance gate
+  object_recognition_utils::SpatialGrid grid(std::max(max_dist_, 1e-3));
+  for (size_t idx = 0; idx < objects.objects.size(); ++idx) {
+    grid.insert(objects.objects.at(idx).kinematics.pose_with_covariance.pose.position, idx);
   }
-  return score_matrix;
+  return grid;
 }
 
 double DataAssociation::calcScoreBetweenObjects(
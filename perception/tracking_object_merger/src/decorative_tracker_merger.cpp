@@ -22,8 +22,10 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <chrono>
 #include <unordered_map>
+#include <vector>
 
 #define EIGEN_MPL2_ONLY
 #include <Eigen/Core>
@@ -44,7 +46,7 @@ double getUnixTime(const std_msgs::msg::Header & header)
 }
 
 // calc association score matrix
-Eigen::MatrixXd calcScoreMatrixForAssociation(
+DataAssociation::ScoreMatrix calcScoreMatrixForAssociation(
   const MEASUREMENT_STATE measurement_state,
   const autoware_auto_perception_msgs::msg::TrackedObjects & objects0,
   const std::vector<TrackerState> & trackers,
@@ -55,30 +57,53 @@ Eigen::MatrixXd calcScoreMatrixForAssociation(
   // get current time
   const rclcpp::Time current_time = rclcpp::Time(objects0.header.stamp);
 
+  // objects0 hashed in the grid for the spatial pre-gate, whose cell size is the largest distance
+  // gate of all the associations
+  double max_dist = 0.0;
+  for (const auto & [name, data_association] : data_association_map) {
+    max_dist = std::max(max_dist, data_association->getMaxDistance());
+  }
+  object_recognition_utils::SpatialGrid objects0_grid(std::max(max_dist, 1e-3));
+  for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    objects0_grid.insert(
+      objects0.objects.at(objects0_idx).kinematics.pose_with_covariance.pose.position,
+      objects0_idx);
+  }
+
   // calc score matrix
-  Eigen::MatrixXd score_matrix = Eigen::MatrixXd::Zero(trackers.size(), objects0.objects.size());
+  std::vector<Eigen::Triplet<double>> scores;
   for (size_t trackers_idx = 0; trackers_idx < trackers.size(); ++trackers_idx) {
     const auto & tracker_obj = trackers.at(trackers_idx);
     const auto & object1 = tracker_obj.getObject();
     const auto & tracker_state = tracker_obj.getCurrentMeasurementState(current_time);
 
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
-      const auto & object0 = objects0.objects.at(objects0_idx);
-      // switch calc score function by input and trackers measurement state
-      // we assume that lidar and radar are exclusive
-      double score;
-      const auto input_has_lidar = measurement_state & MEASUREMENT_STATE::LIDAR;
-      const auto tracker_has_lidar = tracker_state & MEASUREMENT_STATE::LIDAR;
-      if (input_has_lidar && tracker_has_lidar) {
-        score = data_association_map.at("lidar-lidar")->calcScoreBetweenObjects(object0, object1);
-      } else if (!input_has_lidar && !tracker_has_lidar) {
-        score = data_association_map.at("radar-radar")->calcScoreBetweenObjects(object0, object1);
-      } else {
-        score = data_association_map.at("lidar-radar")->calcScoreBetweenObjects(object0, object1);
-      }
-      score_matrix(trackers_idx, objects0_idx) = score;
+    // switch calc score function by input and trackers measurement state
+    // we assume that lidar and radar are exclusive
+    const auto input_has_lidar = measurement_state & MEASUREMENT_STATE::LIDAR;
+    const auto tracker_has_lidar = tracker_state & MEASUREMENT_STATE::LIDAR;
+    const DataAssociation * data_association = nullptr;
+    if (input_has_lidar && tracker_has_lidar) {
+      data_association = data_association_map.at("lidar-lidar").get();
+    } else if (!input_has_lidar && !tracker_has_lidar) {
+      data_association = data_association_map.at("radar-radar").get();
+    } else {
+      data_association = data_association_map.at("lidar-radar").get();
     }
+
+    // the objects out of the neighbor cells are farther than any distance gate
+    objects0_grid.forEachNeighbor(
+      object1.kinematics.pose_with_covariance.pose.position, [&](const size_t objects0_idx) {
+        const auto & object0 = objects0.objects.at(objects0_idx);
+        const double score = data_association->calcScoreBetweenObjects(object0, object1);
+        if (0.0 < score) {
+          scores.emplace_back(
+            static_cast<int>(trackers_idx), static_cast<int>(objects0_idx), score);
+        }
+      });
   }
+
+  DataAssociation::ScoreMatrix score_matrix(trackers.size(), objects0.objects.size());
+  score_matrix.setFromTriplets(scores.begin(), scores.end());
   return score_matrix;
 }
 
@@ -284,7 +309,7 @@ bool DecorativeTrackerMergerNode::decorativeMerger(
   /* global nearest neighbor */
   std::unordered_map<int, int> direct_assignment, reverse_assignment;
   const auto & objects1 = input_objects_msg->objects;
-  Eigen::MatrixXd score_matrix = calcScoreMatrixForAssociation(
+  const auto score_matrix = calcScoreMatrixForAssociation(
     input_sensor, *input_objects_msg, inner_tracker_objects_, data_association_map_);
   data_association_map_.at("lidar-lidar")
     ->assign(score_matrix, direct_assignment, reverse_assignment);
@@ -30,6 +30,19 @@ public:
   virtual bool getTrafficSignals(
     const std::vector<cv::Mat> & input_image,
     tier4_perception_msgs::msg::TrafficLightArray & traffic_signals) = 0;
+
+  // classify the traffic lights in the regions of an image, which are cropped on CPU by default
+  virtual bool getTrafficSignals(
+    const cv::Mat & image, const std::vector<cv::Rect> & rois,
+    tier4_perception_msgs::msg::TrafficLightArray & traffic_signals)
+  {
+    std::vector<cv::Mat> images;
+    images.reserve(rois.size());
+    for (const auto & roi : rois) {
+      images.emplace_back(image(roi));
+    }
+    return getTrafficSignals(images, traffic_signals);
+  }
 };
 }  // namespace traffic_light
 
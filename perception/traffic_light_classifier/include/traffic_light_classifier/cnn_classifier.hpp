@@ -59,6 +59,11 @@ public:
     const std::vector<cv::Mat> & images,
     tier4_perception_msgs::msg::TrafficLightArray & traffic_signals) override;
 
+  // The regions are cropped, resized and normalized on GPU, and are classified in batches
+  bool getTrafficSignals(
+    const cv::Mat & image, const std::vector<cv::Rect> & rois,
+    tier4_perception_msgs::msg::TrafficLightArray & traffic_signals) override;
+
 private:
   void postProcess(int cls, float prob, tier4_perception_msgs::msg::TrafficLight & traffic_signal);
   bool readLabelfile(std::string filepath, std::vector<std::string> & labels);
@@ -19,6 +19,7 @@
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -36,6 +37,8 @@ CNNClassifier::CNNClassifier(rclcpp::Node * node_ptr) : node_ptr_(node_ptr)
   precision = node_ptr_->declare_parameter("classifier_precision", "fp16");
   label_file_path = node_ptr_->declare_parameter("classifier_label_path", "labels.txt");
   model_file_path = node_ptr_->declare_parameter("classifier_model_path", "model.onnx");
+  // If positive ID value is specified, the inference runs on the DLA core with GPU fallback.
+  const int dla_core_id = node_ptr_->declare_parameter("classifier_dla_core_id", -1);
   // ros param does not support loading std::vector<float>
   // we have to load std::vector<double> and transfer to std::vector<float>
   auto mean_d =
@@ -56,7 +59,8 @@ CNNClassifier::CNNClassifier(rclcpp::Node * node_ptr) : node_ptr_(node_ptr)
 
   tensorrt_common::BatchConfig batch_config{batch_size_, batch_size_, batch_size_};
   classifier_ = std::make_unique<tensorrt_classifier::TrtClassifier>(
-    model_file_path, precision, batch_config, mean_, std_);
+    model_file_path, precision, batch_config, mean_, std_, (1 << 30), "",
+    tensorrt_common::BuildConfig("MinMax", dla_core_id, false, false, false, 0.0));
   if (node_ptr_->declare_parameter("build_only", false)) {
     RCLCPP_INFO(node_ptr_->get_logger(), "TensorRT engine is built and shutdown node.");
     rclcpp::shutdown();
@@ -105,6 +109,43 @@ bool CNNClassifier::getTrafficSignals(
   return true;
 }
 
+bool CNNClassifier::getTrafficSignals(
+  const cv::Mat & image, const std::vector<cv::Rect> & rois,
+  tier4_perception_msgs::msg::TrafficLightArray & traffic_signals)
+{
+  if (rois.size() != traffic_signals.signals.size()) {
+    RCLCPP_WARN(node_ptr_->get_logger(), "roi number should be equal to traffic signal number!");
+    return false;
+  }
+  std::vector<cv::Rect> roi_batch;
+  roi_batch.reserve(batch_size_);
+
+  for (size_t roi_i = 0; roi_i < rois.size(); roi_i += batch_size_) {
+    // keep the actual batch size
+    const size_t true_batch_size = std::min(rois.size() - roi_i, static_cast<size_t>(batch_size_));
+    roi_batch.assign(rois.begin() + roi_i, rois.begin() + roi_i + true_batch_size);
+    // insert fake roi since the TRT model requires static batch size
+    roi_batch.resize(batch_size_, roi_batch.front());
+
+    std::vector<float> probabilities;
+    std::vector<int> classes;
+    bool res = classifier_->doInferenceWithRoi(image, roi_batch, classes, probabilities);
+    if (!res || classes.empty() || probabilities.empty()) {
+      return false;
+    }
+    for (size_t i = 0; i < true_batch_size; i++) {
+      auto & traffic_signal = traffic_signals.signals[roi_i + i];
+      postProcess(classes[i], probabilities[i], traffic_signal);
+      /* debug */
+      if (0 < image_pub_.getNumSubscribers()) {
+        cv::Mat debug_image = image(roi_batch[i]);
+        outputDebugImage(debug_image, traffic_signal);
+      }
+    }
+  }
+  return true;
+}
+
 void CNNClassifier::outputDebugImage(
   cv::Mat & debug_image, const tier4_perception_msgs::msg::TrafficLight & traffic_signal)
 {
@@ -98,7 +98,7 @@ void TrafficLightClassifierNodelet::imageRoiCallback(
 
   output_msg.signals.resize(input_rois_msg->rois.size());
 
-  std::vector<cv::Mat> images;
+  std::vector<cv::Rect> rois;
   std::vector<size_t> backlight_indices;
   for (size_t i = 0; i < input_rois_msg->rois.size(); i++) {
     // skip if the roi is not detected
@@ -108,21 +108,21 @@ void TrafficLightClassifierNodelet::imageRoiCallback(
     if (input_rois_msg->rois.at(i).traffic_light_type != classify_traffic_light_type_) {
       continue;
     }
-    output_msg.signals[images.size()].traffic_light_id =
-      input_rois_msg->rois.at(i).traffic_light_id;
-    output_msg.signals[images.size()].traffic_light_type =
+    output_msg.signals[rois.size()].traffic_light_id = input_rois_msg->rois.at(i).traffic_light_id;
+    output_msg.signals[rois.size()].traffic_light_type =
       input_rois_msg->rois.at(i).traffic_light_type;
     const sensor_msgs::msg::RegionOfInterest & roi = input_rois_msg->rois.at(i).roi;
 
-    auto roi_img = cv_ptr->image(cv::Rect(roi.x_offset, roi.y_offset, roi.width, roi.height));
-    if (is_harsh_backlight(roi_img)) {
+    const cv::Rect rect(roi.x_offset, roi.y_offset, roi.width, roi.height);
+    if (is_harsh_backlight(cv_ptr->image(rect))) {
       backlight_indices.emplace_back(i);
     }
-    images.emplace_back(roi_img);
+    rois.emplace_back(rect);
   }
 
-  output_msg.signals.resize(images.size());
-  if (!classifier_ptr_->getTrafficSignals(images, output_msg)) {
+  output_msg.signals.resize(rois.size());
+  // all the regions are passed with the whole image, so that the classifier can crop them at once
+  if (!classifier_ptr_->getTrafficSignals(cv_ptr->image, rois, output_msg)) {
     RCLCPP_ERROR(this->get_logger(), "failed classify image, abort callback");
     return;
   }
@@ -71,6 +71,8 @@ TrafficLightFineDetectorNodelet::TrafficLightFineDetectorNodelet(
   // Detection results will be ignored if IoU over this value.
   // This threshold will be ignored if specified model contains EfficientNMS_TRT module in it
   float nms_threshold = declare_parameter("fine_detector_nms_thresh", 0.65);
+  // If positive ID value is specified, the inference runs on the DLA core with GPU fallback.
+  const int dla_core_id = declare_parameter("fine_detector_dla_core_id", -1);
   is_approximate_sync_ = this->declare_parameter<bool>("approximate_sync", false);
 
   if (!readLabelFile(label_path, tlr_label_id_, num_class)) {
@@ -78,7 +80,7 @@ TrafficLightFineDetectorNodelet::TrafficLightFineDetectorNodelet(
   }
 
   const tensorrt_common::BuildConfig build_config =
-    tensorrt_common::BuildConfig("MinMax", -1, false, false, false, 0.0);
+    tensorrt_common::BuildConfig("MinMax", dla_core_id, false, false, false, 0.0);
 
   const bool cuda_preprocess = true;
   const std::string calib_image_list = "";
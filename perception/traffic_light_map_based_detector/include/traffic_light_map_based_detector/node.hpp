@@ -17,6 +17,7 @@
 
 #include <lanelet2_extension/regulatory_elements/autoware_traffic_light.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <tier4_autoware_utils/geometry/boost_geometry.hpp>
 
 #include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
 #include <autoware_planning_msgs/msg/lanelet_route.hpp>
@@ -25,10 +26,13 @@
 #include <tier4_perception_msgs/msg/traffic_light_roi_array.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
+
 #include <image_geometry/pinhole_camera_model.h>
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
+#include <tf2/LinearMath/Transform.h>
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
@@ -37,6 +41,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace traffic_light
@@ -71,6 +76,32 @@ private:
     }
   };
 
+  /**
+   * @brief traffic light with its geometry in the map frame, computed once when it is indexed
+   */
+  struct TrafficLightGeometry
+  {
+    lanelet::ConstLineString3d traffic_light;
+    tf2::Vector3 top_left;
+    tf2::Vector3 bottom_right;
+    tf2::Vector3 center;
+    double yaw;
+  };
+
+  using TrafficLightRtree = boost::geometry::index::rtree<
+    std::pair<tier4_autoware_utils::Point2d, std::size_t>, boost::geometry::index::rstar<16>>;
+
+  /**
+   * @brief spatial index of the traffic lights, built when the map or the route is received
+   */
+  struct TrafficLightIndex
+  {
+    // in the same order as TrafficLightSet
+    std::vector<TrafficLightGeometry> traffic_lights;
+    // center of each traffic light
+    TrafficLightRtree rtree;
+  };
+
 private:
   rclcpp::Subscription<autoware_auto_mapping_msgs::msg::HADMapBin>::SharedPtr map_sub_;
   rclcpp::Subscription<sensor_msgs::msg::CameraInfo>::SharedPtr camera_info_sub_;
@@ -94,6 +125,8 @@ private:
 
   std::shared_ptr<TrafficLightSet> all_traffic_lights_ptr_;
   std::shared_ptr<TrafficLightSet> route_traffic_lights_ptr_;
+  std::shared_ptr<const TrafficLightIndex> all_traffic_lights_index_ptr_;
+  std::shared_ptr<const TrafficLightIndex> route_traffic_lights_index_ptr_;
 
   std::set<int64_t> pedestrian_tl_id_;
 
@@ -133,23 +166,33 @@ private:
    * @param input_msg
    */
   void routeCallback(const autoware_planning_msgs::msg::LaneletRoute::ConstSharedPtr input_msg);
+  /**
+   * @brief Build the spatial index of the traffic lights, excluding the solid ones
+   *
+   * @param traffic_lights  the traffic lights in the route or in the map
+   * @return                the built index
+   */
+  static std::shared_ptr<const TrafficLightIndex> buildTrafficLightIndex(
+    const TrafficLightSet & traffic_lights);
   /**
    * @brief Get the Visible Traffic Lights object
    *
-   * @param all_traffic_lights      all the traffic lights in the route or in the map
-   * @param tf_map2camera_vec           the transformation sequences from map to camera
+   * @param traffic_light_index     index of all the traffic lights in the route or in the map
+   * @param tf_map2camera_vec       the transformation sequences from map to camera
+   * @param tf_camera2map_vec       the inverse of tf_map2camera_vec
    * @param pinhole_camera_model    pinhole model calculated from camera_info
    * @param visible_traffic_lights  the visible traffic lights object
    */
   void getVisibleTrafficLights(
-    const TrafficLightSet & all_traffic_lights,
+    const TrafficLightIndex & traffic_light_index,
     const std::vector<tf2::Transform> & tf_map2camera_vec,
+    const std::vector<tf2::Transform> & tf_camera2map_vec,
     const image_geometry::PinholeCameraModel & pinhole_camera_model,
     std::vector<lanelet::ConstLineString3d> & visible_traffic_lights) const;
   /**
    * @brief Get the Traffic Light Roi from one tf
    *
-   * @param tf_map2camera         the transformation from map to camera
+   * @param tf_camera2map         the inverse of the transformation from map to camera
    * @param pinhole_camera_model  pinhole model calculated from camera_info
    * @param traffic_light         lanelet traffic light object
    * @param config                offset configuration
@@ -158,14 +201,14 @@ private:
    * @return false                the computation failed
    */
   bool getTrafficLightRoi(
-    const tf2::Transform & tf_map2camera,
+    const tf2::Transform & tf_camera2map,
     const image_geometry::PinholeCameraModel & pinhole_camera_model,
     const lanelet::ConstLineString3d traffic_light, const Config & config,
     tier4_perception_msgs::msg::TrafficLightRoi & roi) const;
   /**
    * @brief Calculate one traffic light roi for every tf and return the roi containing all of them
    *
-   * @param tf_map2camera_vec     the transformation vector
+   * @param tf_camera2map_vec     the inverse of the transformation vector
    * @param pinhole_camera_model  pinhole model calculated from camera_info
    * @param traffic_light         lanelet traffic light object
    * @param config                offset configuration
@@ -174,7 +217,7 @@ private:
    * @return false                the computation failed
    */
   bool getTrafficLightRoi(
-    const std::vector<tf2::Transform> & tf_map2camera_vec,
+    const std::vector<tf2::Transform> & tf_camera2map_vec,
     const image_geometry::PinholeCameraModel & pinhole_camera_model,
     const lanelet::ConstLineString3d traffic_light, const Config & config,
     tier4_perception_msgs::msg::TrafficLightRoi & roi) const;
@@ -27,6 +27,8 @@
 #include <tf2/LinearMath/Matrix3x3.h>
 #include <tf2/LinearMath/Transform.h>
 
+#include <boost/geometry.hpp>
+
 #define EIGEN_MPL2_ONLY
 #include <Eigen/Core>
 #include <Eigen/Geometry>
@@ -37,6 +39,8 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #endif
 
+#include <iterator>
+
 namespace
 {
 cv::Point2d calcRawImagePointFromPoint3D(
@@ -152,7 +156,7 @@ MapBasedDetector::MapBasedDetector(const rclcpp::NodeOptions & node_options)
     RCLCPP_ERROR_STREAM(
       get_logger(), "Invalid param timestamp_sample_len = " << config_.timestamp_sample_len
                                                             << ", set to default value = 0.01");
-    config_.timestamp_sample_len = 200.0;
+    config_.timestamp_sample_len = 0.01;
   }
   if (config_.max_timestamp_offset <= config_.min_timestamp_offset) {
     RCLCPP_ERROR_STREAM(
@@ -196,7 +200,7 @@ bool MapBasedDetector::getTransform(
 void MapBasedDetector::cameraInfoCallback(
   const sensor_msgs::msg::CameraInfo::ConstSharedPtr input_msg)
 {
-  if (all_traffic_lights_ptr_ == nullptr && route_traffic_lights_ptr_ == nullptr) {
+  if (all_traffic_lights_index_ptr_ == nullptr && route_traffic_lights_index_ptr_ == nullptr) {
     return;
   }
 
@@ -214,7 +218,7 @@ void MapBasedDetector::cameraInfoCallback(
                     rclcpp::Duration::from_seconds(config_.min_timestamp_offset);
   rclcpp::Time t2 = rclcpp::Time(input_msg->header.stamp) +
                     rclcpp::Duration::from_seconds(config_.max_timestamp_offset);
-  rclcpp::Duration interval = rclcpp::Duration::from_seconds(0.01);
+  rclcpp::Duration interval = rclcpp::Duration::from_seconds(config_.timestamp_sample_len);
   for (auto t = t1; t <= t2; t += interval) {
     tf2::Transform tf;
     if (getTransform(t, input_msg->header.frame_id, tf)) {
@@ -232,6 +236,13 @@ void MapBasedDetector::cameraInfoCallback(
   if (tf_map2camera_vec.empty()) {
     tf_map2camera_vec.push_back(tf_map2camera);
   }
+  // the inverse transforms are computed once, rather than for every point of every traffic light
+  const tf2::Transform tf_camera2map = tf_map2camera.inverse();
+  std::vector<tf2::Transform> tf_camera2map_vec;
+  tf_camera2map_vec.reserve(tf_map2camera_vec.size());
+  for (const auto & tf : tf_map2camera_vec) {
+    tf_camera2map_vec.push_back(tf.inverse());
+  }
 
   /*
    * visible_traffic_lights : for each traffic light in map check if in range and in view angle of
@@ -239,13 +250,15 @@ void MapBasedDetector::cameraInfoCallback(
    */
   std::vector<lanelet::ConstLineString3d> visible_traffic_lights;
   // If get a route, use only traffic lights on the route.
-  if (route_traffic_lights_ptr_ != nullptr) {
+  if (route_traffic_lights_index_ptr_ != nullptr) {
     getVisibleTrafficLights(
-      *route_traffic_lights_ptr_, tf_map2camera_vec, pinhole_camera_model, visible_traffic_lights);
+      *route_traffic_lights_index_ptr_, tf_map2camera_vec, tf_camera2map_vec, pinhole_camera_model,
+      visible_traffic_lights);
     // If don't get a route, use the traffic lights around ego vehicle.
-  } else if (all_traffic_lights_ptr_ != nullptr) {
+  } else if (all_traffic_lights_index_ptr_ != nullptr) {
     getVisibleTrafficLights(
-      *all_traffic_lights_ptr_, tf_map2camera_vec, pinhole_camera_model, visible_traffic_lights);
+      *all_traffic_lights_index_ptr_, tf_map2camera_vec, tf_camera2map_vec, pinhole_camera_model,
+      visible_traffic_lights);
     // This shouldn't run.
   } else {
     return;
@@ -267,11 +280,11 @@ void MapBasedDetector::cameraInfoCallback(
   for (const auto & traffic_light : visible_traffic_lights) {
     tier4_perception_msgs::msg::TrafficLightRoi rough_roi, expect_roi;
     if (!getTrafficLightRoi(
-          tf_map2camera, pinhole_camera_model, traffic_light, expect_roi_cfg, expect_roi)) {
+          tf_camera2map, pinhole_camera_model, traffic_light, expect_roi_cfg, expect_roi)) {
       continue;
     }
     if (!getTrafficLightRoi(
-          tf_map2camera_vec, pinhole_camera_model, traffic_light, config_, rough_roi)) {
+          tf_camera2map_vec, pinhole_camera_model, traffic_light, config_, rough_roi)) {
       continue;
     }
     output_msg.rois.push_back(rough_roi);
@@ -285,7 +298,7 @@ void MapBasedDetector::cameraInfoCallback(
 }
 
 bool MapBasedDetector::getTrafficLightRoi(
-  const tf2::Transform & tf_map2camera,
+  const tf2::Transform & tf_camera2map,
   const image_geometry::PinholeCameraModel & pinhole_camera_model,
   const lanelet::ConstLineString3d traffic_light, const Config & config,
   tier4_perception_msgs::msg::TrafficLightRoi & roi) const
@@ -300,7 +313,7 @@ bool MapBasedDetector::getTrafficLightRoi(
   // for roi.x_offset and roi.y_offset
   {
     tf2::Vector3 map2tl = getTrafficLightTopLeft(traffic_light);
-    tf2::Vector3 camera2tl = tf_map2camera.inverse() * map2tl;
+    tf2::Vector3 camera2tl = tf_camera2map * map2tl;
     // max vibration
     const double max_vibration_x =
       std::sin(config.max_vibration_yaw * 0.5) * camera2tl.z() + config.max_vibration_width * 0.5;
@@ -324,7 +337,7 @@ bool MapBasedDetector::getTrafficLightRoi(
   // for roi.width and roi.height
   {
     tf2::Vector3 map2tl = getTrafficLightBottomRight(traffic_light);
-    tf2::Vector3 camera2tl = tf_map2camera.inverse() * map2tl;
+    tf2::Vector3 camera2tl = tf_camera2map * map2tl;
     // max vibration
     const double max_vibration_x =
       std::sin(config.max_vibration_yaw * 0.5) * camera2tl.z() + config.max_vibration_width * 0.5;
@@ -352,15 +365,15 @@ bool MapBasedDetector::getTrafficLightRoi(
 }
 
 bool MapBasedDetector::getTrafficLightRoi(
-  const std::vector<tf2::Transform> & tf_map2camera_vec,
+  const std::vector<tf2::Transform> & tf_camera2map_vec,
   const image_geometry::PinholeCameraModel & pinhole_camera_model,
   const lanelet::ConstLineString3d traffic_light, const Config & config,
   tier4_perception_msgs::msg::TrafficLightRoi & out_roi) const
 {
   std::vector<tier4_perception_msgs::msg::TrafficLightRoi> rois;
-  for (const auto & tf_map2camera : tf_map2camera_vec) {
+  for (const auto & tf_camera2map : tf_camera2map_vec) {
     tier4_perception_msgs::msg::TrafficLightRoi roi;
-    if (getTrafficLightRoi(tf_map2camera, pinhole_camera_model, traffic_light, config, roi)) {
+    if (getTrafficLightRoi(tf_camera2map, pinhole_camera_model, traffic_light, config, roi)) {
       rois.push_back(roi);
     }
   }
@@ -409,6 +422,7 @@ void MapBasedDetector::mapCallback(
       all_traffic_lights_ptr_->insert(static_cast<lanelet::ConstLineString3d>(lsp));
     }
   }
+  all_traffic_lights_index_ptr_ = buildTrafficLightIndex(*all_traffic_lights_ptr_);
 
   auto crosswalk_lanelets = lanelet::utils::query::crosswalkLanelets(all_lanelets);
   for (const auto & tl : lanelet::utils::query::autowareTrafficLights(crosswalk_lanelets)) {
@@ -494,20 +508,81 @@ void MapBasedDetector::routeCallback(
       pedestrian_tl_id_.insert(lsp.id());
     }
   }
+  route_traffic_lights_index_ptr_ = buildTrafficLightIndex(*route_traffic_lights_ptr_);
 }
 
-void MapBasedDetector::getVisibleTrafficLights(
-  const MapBasedDetector::TrafficLightSet & all_traffic_lights,
-  const std::vector<tf2::Transform> & tf_map2camera_vec,
-  const image_geometry::PinholeCameraModel & pinhole_camera_model,
-  std::vector<lanelet::ConstLineString3d> & visible_traffic_lights) const
+std::shared_ptr<const MapBasedDetector::TrafficLightIndex> MapBasedDetector::buildTrafficLightIndex(
+  const MapBasedDetector::TrafficLightSet & traffic_lights)
 {
-  for (const auto & traffic_light : all_traffic_lights) {
+  auto index = std::make_shared<TrafficLightIndex>();
+  std::vector<std::pair<tier4_autoware_utils::Point2d, std::size_t>> centers;
+  for (const auto & traffic_light : traffic_lights) {
     if (
       traffic_light.hasAttribute("subtype") == false ||
       traffic_light.attribute("subtype").value() == "solid") {
       continue;
     }
+    TrafficLightGeometry geometry;
+    geometry.traffic_light = traffic_light;
+    geometry.top_left = getTrafficLightTopLeft(traffic_light);
+    geometry.bottom_right = getTrafficLightBottomRight(traffic_light);
+    geometry.center = (geometry.top_left + geometry.bottom_right) / 2;
+    // traffic light bottom left
+    const auto & tl_bl = traffic_light.front();
+    // traffic light bottom right
+    const auto & tl_br = traffic_light.back();
+    geometry.yaw = tier4_autoware_utils::normalizeRadian(
+      std::atan2(tl_br.y() - tl_bl.y(), tl_br.x() - tl_bl.x()) + M_PI_2);
+    centers.emplace_back(
+      tier4_autoware_utils::Point2d(geometry.center.x(), geometry.center.y()),
+      index->traffic_lights.size());
+    index->traffic_lights.push_back(geometry);
+  }
+  // packing algorithm is used by the range constructor
+  index->rtree = TrafficLightRtree(centers.begin(), centers.end());
+  return index;
+}
+
+void MapBasedDetector::getVisibleTrafficLights(
+  const MapBasedDetector::TrafficLightIndex & traffic_light_index,
+  const std::vector<tf2::Transform> & tf_map2camera_vec,
+  const std::vector<tf2::Transform> & tf_camera2map_vec,
+  const image_geometry::PinholeCameraModel & pinhole_camera_model,
+  std::vector<lanelet::ConstLineString3d> & visible_traffic_lights) const
+{
+  // only the traffic lights within the detection range of any camera pose are checked
+  tier4_autoware_utils::Box2d search_box;
+  boost::geometry::assign_inverse(search_box);
+  for (const auto & tf_map2camera : tf_map2camera_vec) {
+    const auto & origin = tf_map2camera.getOrigin();
+    boost::geometry::expand(search_box, tier4_autoware_utils::Point2d(origin.x(), origin.y()));
+  }
+  search_box.min_corner().x() -= config_.max_detection_range;
+  search_box.min_corner().y() -= config_.max_detection_range;
+  search_box.max_corner().x() += config_.max_detection_range;
+  search_box.max_corner().y() += config_.max_detection_range;
+  std::vector<std::pair<tier4_autoware_utils::Point2d, std::size_t>> candidates;
+  traffic_light_index.rtree.query(
+    boost::geometry::index::intersects(search_box), std::back_inserter(candidates));
+  // keep the order of the traffic light set
+  std::sort(candidates.begin(), candidates.end(), [](const auto & a, const auto & b) {
+    return a.second < b.second;
+  });
+
+  // get direction of z axis of each camera pose
+  std::vector<double> camera_yaws;
+  camera_yaws.reserve(tf_map2camera_vec.size());
+  for (const auto & tf_map2camera : tf_map2camera_vec) {
+    tf2::Vector3 camera_z_dir(0, 0, 1);
+    tf2::Matrix3x3 camera_rotation_matrix(tf_map2camera.getRotation());
+    camera_z_dir = camera_rotation_matrix * camera_z_dir;
+    double camera_yaw = std::atan2(camera_z_dir.y(), camera_z_dir.x());
+    camera_yaws.push_back(tier4_autoware_utils::normalizeRadian(camera_yaw));
+  }
+
+  for (const auto & candidate : candidates) {
+    const auto & geometry = traffic_light_index.traffic_lights.at(candidate.second);
+    const auto & traffic_light = geometry.traffic_light;
     // set different max angle range for ped and car traffic light
     double max_angle_range;
     if (pedestrian_tl_id_.find(traffic_light.id()) != pedestrian_tl_id_.end()) {
@@ -516,38 +591,24 @@ void MapBasedDetector::getVisibleTrafficLights(
     } else {
       max_angle_range = tier4_autoware_utils::deg2rad(config_.car_traffic_light_max_angle_range);
     }
-    // traffic light bottom left
-    const auto & tl_bl = traffic_light.front();
-    // traffic light bottom right
-    const auto & tl_br = traffic_light.back();
-    // check distance range
-    tf2::Vector3 tl_center = getTrafficLightCenter(traffic_light);
     // for every possible transformation, check if the tl is visible.
     // If under any tf the tl is visible, keep it
-    for (const auto & tf_map2camera : tf_map2camera_vec) {
-      if (!isInDistanceRange(tl_center, tf_map2camera.getOrigin(), config_.max_detection_range)) {
+    for (size_t i = 0; i < tf_map2camera_vec.size(); ++i) {
+      // check distance range
+      if (!isInDistanceRange(
+            geometry.center, tf_map2camera_vec[i].getOrigin(), config_.max_detection_range)) {
         continue;
       }
 
       // check angle range
-      const double tl_yaw = tier4_autoware_utils::normalizeRadian(
-        std::atan2(tl_br.y() - tl_bl.y(), tl_br.x() - tl_bl.x()) + M_PI_2);
-
-      // get direction of z axis
-      tf2::Vector3 camera_z_dir(0, 0, 1);
-      tf2::Matrix3x3 camera_rotation_matrix(tf_map2camera.getRotation());
-      camera_z_dir = camera_rotation_matrix * camera_z_dir;
-      double camera_yaw = std::atan2(camera_z_dir.y(), camera_z_dir.x());
-      camera_yaw = tier4_autoware_utils::normalizeRadian(camera_yaw);
-      if (!isInAngleRange(tl_yaw, camera_yaw, max_angle_range)) {
+      if (!isInAngleRange(geometry.yaw, camera_yaws[i], max_angle_range)) {
         continue;
       }
 
       // check within image frame
       // cspell: ignore tltl
-      tf2::Vector3 tf_camera2tltl = tf_map2camera.inverse() * getTrafficLightTopLeft(traffic_light);
-      tf2::Vector3 tf_camera2tlbr =
-        tf_map2camera.inverse() * getTrafficLightBottomRight(traffic_light);
+      tf2::Vector3 tf_camera2tltl = tf_camera2map_vec[i] * geometry.top_left;
+      tf2::Vector3 tf_camera2tlbr = tf_camera2map_vec[i] * geometry.bottom_right;
       if (
         !isInImageFrame(pinhole_camera_model, tf_camera2tltl) &&
         !isInImageFrame(pinhole_camera_model, tf_camera2tlbr)) {
@@ -565,10 +626,11 @@ void MapBasedDetector::publishVisibleTrafficLights(
   const rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr pub)
 {
   visualization_msgs::msg::MarkerArray output_msg;
+  const tf2::Transform tf_camera2map = tf_map2camera.inverse();
   for (const auto & traffic_light : visible_traffic_lights) {
     const int id = traffic_light.id();
     tf2::Vector3 tl_central_point = getTrafficLightCenter(traffic_light);
-    tf2::Vector3 camera2tl = tf_map2camera.inverse() * tl_central_point;
+    tf2::Vector3 camera2tl = tf_camera2map * tl_central_point;
 
     visualization_msgs::msg::Marker marker;
     marker.header = cam_info_header;
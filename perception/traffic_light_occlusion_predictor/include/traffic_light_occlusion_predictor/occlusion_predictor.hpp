@@ -66,9 +66,19 @@ public:
 private:
   uint32_t predict(const pcl::PointXYZ & roi_top_left, const pcl::PointXYZ & roi_bottom_right);
 
+  /**
+   * @brief transform the points into the camera frame and keep the rays of the points around the
+   * traffic lights, without converting the whole cloud
+   */
   void filterCloud(
-    const pcl::PointCloud<pcl::PointXYZ> & cloud_in, const std::vector<pcl::PointXYZ> & roi_tls,
-    const std::vector<pcl::PointXYZ> & roi_brs, pcl::PointCloud<pcl::PointXYZ> & cloud_out);
+    const sensor_msgs::msg::PointCloud2 & cloud_in, const Eigen::Matrix4f & camera2cloud,
+    const std::vector<pcl::PointXYZ> & roi_tls, const std::vector<pcl::PointXYZ> & roi_brs,
+    std::vector<Ray> & rays_out);
+
+  /**
+   * @brief sort the rays into the cells of the integer azimuth and elevation in lidar_rays_
+   */
+  void buildRayCells(const std::vector<Ray> & rays);
 
   void sampleTrafficLightRoi(
     const pcl::PointXYZ & top_left, const pcl::PointXYZ & bottom_right,
@@ -81,7 +91,13 @@ private:
     const std::map<lanelet::Id, tf2::Vector3> & traffic_light_position_map,
     const tf2::Transform & tf_camera2map, pcl::PointXYZ & top_left, pcl::PointXYZ & bottom_right);
 
-  std::map<int, std::map<int, std::vector<Ray> > > lidar_rays_;
+  // rays of the points around the traffic lights, in the order of their cells
+  std::vector<Ray> lidar_rays_;
+  // index of the first ray of each cell in lidar_rays_, followed by the number of the rays
+  std::vector<uint32_t> cell_offsets_;
+  // buffers reused in every prediction
+  std::vector<Ray> roi_rays_;
+  std::vector<uint32_t> cell_cursors_;
   rclcpp::Node * node_ptr_;
   float max_valid_pt_distance_;
   float azimuth_occlusion_resolution_deg_;
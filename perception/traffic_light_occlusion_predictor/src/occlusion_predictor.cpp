@@ -15,8 +15,34 @@
 
 #include "traffic_light_occlusion_predictor/occlusion_predictor.hpp"
 
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
 namespace
 {
+// the rays are put into the cells of the integer part of the azimuth in [-180, 180] and the
+// elevation in [-90, 90]
+constexpr int min_azimuth_cell = -180;
+constexpr int max_azimuth_cell = 180;
+constexpr int min_elevation_cell = -90;
+constexpr int max_elevation_cell = 90;
+constexpr size_t elevation_cell_num = max_elevation_cell - min_elevation_cell + 1;
+constexpr size_t cell_num = (max_azimuth_cell - min_azimuth_cell + 1) * elevation_cell_num;
+
+size_t toCellIndex(const int azimuth, const int elevation)
+{
+  return static_cast<size_t>(azimuth - min_azimuth_cell) * elevation_cell_num +
+         static_cast<size_t>(elevation - min_elevation_cell);
+}
+
+size_t toCellIndex(const traffic_light::Ray & ray)
+{
+  return toCellIndex(static_cast<int>(ray.azimuth), static_cast<int>(ray.elevation));
+}
 
 traffic_light::Ray point2ray(const pcl::PointXYZ & pt)
 {
@@ -97,19 +123,10 @@ void CloudOcclusionPredictor::predict(
       roi_brs[i]);
   }
 
-  lidar_rays_.clear();
-  // points in camera frame
-  pcl::PointCloud<pcl::PointXYZ> cloud_camera;
-  // points within roi
-  pcl::PointCloud<pcl::PointXYZ> cloud_roi;
-  tier4_autoware_utils::transformPointCloudFromROSMsg(*cloud_msg, cloud_camera, camera2cloud);
-
-  filterCloud(cloud_camera, roi_tls, roi_brs, cloud_roi);
+  // only the points within roi are transformed into rays
+  filterCloud(*cloud_msg, camera2cloud.cast<float>(), roi_tls, roi_brs, roi_rays_);
+  buildRayCells(roi_rays_);
 
-  for (const pcl::PointXYZ & pt : cloud_roi) {
-    Ray ray = ::point2ray(pt);
-    lidar_rays_[static_cast<int>(ray.azimuth)][static_cast<int>(ray.elevation)].push_back(ray);
-  }
   for (size_t i = 0; i < roi_tls.size(); i++) {
     occlusion_ratios[i] = rois_msg->rois[i].roi.height == 0 ? 0 : predict(roi_tls[i], roi_brs[i]);
   }
@@ -146,8 +163,9 @@ void CloudOcclusionPredictor::calcRoiVector3D(
 }
 
 void CloudOcclusionPredictor::filterCloud(
-  const pcl::PointCloud<pcl::PointXYZ> & cloud_in, const std::vector<pcl::PointXYZ> & roi_tls,
-  const std::vector<pcl::PointXYZ> & roi_brs, pcl::PointCloud<pcl::PointXYZ> & cloud_out)
+  const sensor_msgs::msg::PointCloud2 & cloud_in, const Eigen::Matrix4f & camera2cloud,
+  const std::vector<pcl::PointXYZ> & roi_tls, const std::vector<pcl::PointXYZ> & roi_brs,
+  std::vector<Ray> & rays_out)
 {
   float min_x = 0, max_x = 0, min_y = 0, max_y = 0, min_z = 0, max_z = 0;
   for (const auto & pt : roi_tls) {
@@ -167,20 +185,44 @@ void CloudOcclusionPredictor::filterCloud(
     max_z = std::max(max_z, pt.z);
   }
   const float min_dist_to_cam = 1.0f;
-  cloud_out.clear();
-  for (const auto & pt : cloud_in) {
+  const Eigen::Matrix3f rotation = camera2cloud.topLeftCorner<3, 3>();
+  const Eigen::Vector3f translation = camera2cloud.topRightCorner<3, 1>();
+  rays_out.clear();
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud_in, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud_in, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(cloud_in, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const Eigen::Vector3f pt = rotation * Eigen::Vector3f(*iter_x, *iter_y, *iter_z) + translation;
+    if (!std::isfinite(pt.x()) || !std::isfinite(pt.y()) || !std::isfinite(pt.z())) {
+      continue;
+    }
     if (
-      pt.x < min_x || pt.x > max_x || pt.y < min_y || pt.y > max_y || pt.z < min_z ||
-      pt.z > max_z) {
+      pt.x() < min_x || pt.x() > max_x || pt.y() < min_y || pt.y() > max_y || pt.z() < min_z ||
+      pt.z() > max_z) {
       continue;
     }
-    float dist = pt.getVector3fMap().squaredNorm();
+    float dist = pt.squaredNorm();
     if (
       dist <= min_dist_to_cam * min_dist_to_cam ||
       dist >= max_valid_pt_distance_ * max_valid_pt_distance_) {
       continue;
     }
-    cloud_out.push_back(pt);
+    rays_out.push_back(::point2ray(pcl::PointXYZ(pt.x(), pt.y(), pt.z())));
+  }
+}
+
+void CloudOcclusionPredictor::buildRayCells(const std::vector<Ray> & rays)
+{
+  // counting sort, which keeps the order of the rays in each cell
+  cell_offsets_.assign(cell_num + 1, 0);
+  for (const Ray & ray : rays) {
+    ++cell_offsets_[toCellIndex(ray) + 1];
+  }
+  std::partial_sum(cell_offsets_.begin(), cell_offsets_.end(), cell_offsets_.begin());
+  cell_cursors_.assign(cell_offsets_.begin(), cell_offsets_.end() - 1);
+  lidar_rays_.resize(rays.size());
+  for (const Ray & ray : rays) {
+    lidar_rays_[cell_cursors_[toCellIndex(ray)]++] = ray;
   }
 }
 
@@ -222,10 +264,15 @@ uint32_t CloudOcclusionPredictor::predict(
     Ray tl_ray = ::point2ray(tl_pt);
     bool occluded = false;
     // the azimuth and elevation range to search for points that may occlude tl_pt
-    int min_azimuth = static_cast<int>(tl_ray.azimuth - azimuth_occlusion_resolution_deg_);
-    int max_azimuth = static_cast<int>(tl_ray.azimuth + azimuth_occlusion_resolution_deg_);
-    int min_elevation = static_cast<int>(tl_ray.elevation - elevation_occlusion_resolution_deg_);
-    int max_elevation = static_cast<int>(tl_ray.elevation + elevation_occlusion_resolution_deg_);
+    // the cells out of the range have no rays
+    int min_azimuth = std::max(
+      static_cast<int>(tl_ray.azimuth - azimuth_occlusion_resolution_deg_), min_azimuth_cell);
+    int max_azimuth = std::min(
+      static_cast<int>(tl_ray.azimuth + azimuth_occlusion_resolution_deg_), max_azimuth_cell);
+    int min_elevation = std::max(
+      static_cast<int>(tl_ray.elevation - elevation_occlusion_resolution_deg_), min_elevation_cell);
+    int max_elevation = std::min(
+      static_cast<int>(tl_ray.elevation + elevation_occlusion_resolution_deg_), max_elevation_cell);
     /**
      * search among lidar rays whose azimuth and elevation angle are close to the tl_ray.
      * for a lidar ray r1 whose azimuth and elevation are very close to tl_pt,
@@ -234,7 +281,9 @@ uint32_t CloudOcclusionPredictor::predict(
      */
     for (int azimuth = min_azimuth; (azimuth <= max_azimuth) && !occluded; azimuth++) {
       for (int elevation = min_elevation; (elevation <= max_elevation) && !occluded; elevation++) {
-        for (const Ray & lidar_ray : lidar_rays_[azimuth][elevation]) {
+        const size_t cell = toCellIndex(azimuth, elevation);
+        for (uint32_t i = cell_offsets_[cell]; i < cell_offsets_[cell + 1]; i++) {
+          const Ray & lidar_ray = lidar_rays_[i];
           if (
             std::abs(lidar_ray.azimuth - tl_ray.azimuth) <= azimuth_occlusion_resolution_deg_ &&
             std::abs(lidar_ray.elevation - tl_ray.elevation) <=
@@ -16,6 +16,7 @@
 #define AUTOWARE_BEHAVIOR_PATH_DYNAMIC_OBSTACLE_AVOIDANCE_MODULE__SCENE_HPP_
 
 #include "behavior_path_planner_common/interface/scene_module_interface.hpp"
+#include "motion_utils/trajectory/indexed_trajectory.hpp"
 #include "tier4_autoware_utils/system/stop_watch.hpp"
 
 #include <rclcpp/rclcpp.hpp>
@@ -164,6 +165,53 @@ struct LatFeasiblePaths
   std::vector<geometry_msgs::msg::Point> left_path;
   std::vector<geometry_msgs::msg::Point> right_path;
 };
+
+/**
+ * @brief index of the reference path built once per cycle, so that the positions of the objects
+ * along the path are looked up instead of scanning the path for each query.
+ * @details The results are the same as motion_utils, whose lateral offset uses the points without
+ * overlap. The points must outlive the index.
+ */
+class RefPathIndex
+{
+public:
+  RefPathIndex(
+    const std::vector<PathPointWithLaneId> & points, const geometry_msgs::msg::Point & ego_pos,
+    const size_t ego_seg_idx);
+  RefPathIndex(const RefPathIndex &) = delete;
+  RefPathIndex & operator=(const RefPathIndex &) = delete;
+
+  const std::vector<PathPointWithLaneId> & points() const { return points_; }
+
+  // same as motion_utils::findNearestIndex(points, point)
+  size_t findNearestIndex(const geometry_msgs::msg::Point & point) const
+  {
+    return points_index_.findNearestIndex(point);
+  }
+  // same as motion_utils::findNearestSegmentIndex(points, point)
+  size_t findNearestSegmentIndex(const geometry_msgs::msg::Point & point) const
+  {
+    return points_index_.findNearestSegmentIndex(point);
+  }
+  // same as motion_utils::calcLateralOffset(points, point)
+  double calcLateralOffset(const geometry_msgs::msg::Point & point) const;
+  // same as motion_utils::calcLateralOffset(points, point, seg_idx)
+  double calcLateralOffset(const geometry_msgs::msg::Point & point, const size_t seg_idx) const;
+  // same as motion_utils::calcSignedArcLength(points, ego_pos, ego_seg_idx, idx)
+  double calcSignedArcLengthFromEgo(const size_t idx) const
+  {
+    return points_index_.calcSignedArcLength(ego_seg_idx_, idx) - ego_lon_offset_to_seg_;
+  }
+
+private:
+  const std::vector<PathPointWithLaneId> & points_;
+  motion_utils::IndexedTrajectory<std::vector<PathPointWithLaneId>> points_index_;
+  std::vector<PathPointWithLaneId> overlap_removed_points_;
+  motion_utils::IndexedTrajectory<std::vector<PathPointWithLaneId>> overlap_removed_points_index_;
+  size_t ego_seg_idx_;
+  double ego_lon_offset_to_seg_;
+};
+
 class DynamicObstacleAvoidanceModule : public SceneModuleInterface
 {
 public:
@@ -380,17 +428,19 @@ private:
   bool canTransitFailureState() override { return false; }
 
   ObjectType getObjectType(const uint8_t label) const;
-  void registerRegulatedObjects(const std::vector<DynamicAvoidanceObject> & prev_objects);
-  void registerUnregulatedObjects(const std::vector<DynamicAvoidanceObject> & prev_objects);
+  void registerRegulatedObjects(
+    const std::vector<DynamicAvoidanceObject> & prev_objects, const RefPathIndex & ref_path_index);
+  void registerUnregulatedObjects(
+    const std::vector<DynamicAvoidanceObject> & prev_objects, const RefPathIndex & ref_path_index);
   void determineWhetherToAvoidAgainstRegulatedObjects(
-    const std::vector<DynamicAvoidanceObject> & prev_objects);
+    const std::vector<DynamicAvoidanceObject> & prev_objects, const RefPathIndex & ref_path_index);
   void determineWhetherToAvoidAgainstUnregulatedObjects(
-    const std::vector<DynamicAvoidanceObject> & prev_objects);
+    const std::vector<DynamicAvoidanceObject> & prev_objects, const RefPathIndex & ref_path_index);
   LatFeasiblePaths generateLateralFeasiblePaths(
     const geometry_msgs::msg::Pose & ego_pose, const double ego_vel) const;
   void updateRefPathBeforeLaneChange(const std::vector<PathPointWithLaneId> & ego_ref_path_points);
   bool willObjectCutIn(
-    const std::vector<PathPointWithLaneId> & ego_path, const PredictedPath & predicted_path,
+    const RefPathIndex & ref_path_index, const PredictedPath & predicted_path,
     const double obj_tangent_vel, const LatLonOffset & lat_lon_offset) const;
   DecisionWithReason willObjectCutOut(
     const double obj_tangent_vel, const double obj_normal_vel, const bool is_object_left,
@@ -401,12 +451,12 @@ private:
   bool isObjectFarFromPath(
     const PredictedObject & predicted_object, const double obj_dist_to_path) const;
   TimeWhileCollision calcTimeWhileCollision(
-    const std::vector<PathPointWithLaneId> & ego_path, const double obj_tangent_vel,
+    const RefPathIndex & ref_path_index, const double obj_tangent_vel,
     const LatLonOffset & lat_lon_offset) const;
   std::optional<std::pair<size_t, size_t>> calcCollisionSection(
     const std::vector<PathPointWithLaneId> & ego_path, const PredictedPath & obj_path) const;
   LatLonOffset getLateralLongitudinalOffset(
-    const std::vector<PathPointWithLaneId> & ego_path, const geometry_msgs::msg::Pose & obj_pose,
+    const RefPathIndex & ref_path_index, const geometry_msgs::msg::Pose & obj_pose,
     const autoware_auto_perception_msgs::msg::Shape & obj_shape) const;
   double calcValidLengthToAvoid(
     const PredictedPath & obj_path, const geometry_msgs::msg::Pose & obj_pose,
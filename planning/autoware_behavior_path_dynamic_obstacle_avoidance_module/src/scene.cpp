@@ -112,11 +112,11 @@ std::optional<T> getObjectFromUuid(const std::vector<T> & objects, const std::st
 }
 
 std::pair<double, double> projectObstacleVelocityToTrajectory(
-  const std::vector<PathPointWithLaneId> & path_points, const PredictedObject & object)
+  const std::vector<PathPointWithLaneId> & path_points, const PredictedObject & object,
+  const size_t obj_idx)
 {
   const auto & obj_pose = object.kinematics.initial_pose_with_covariance.pose;
   const double obj_yaw = tf2::getYaw(obj_pose.orientation);
-  const size_t obj_idx = motion_utils::findNearestIndex(path_points, obj_pose.position);
   const double path_yaw = tf2::getYaw(path_points.at(obj_idx).point.pose.orientation);
 
   const Eigen::Rotation2Dd R_ego_to_obstacle(obj_yaw - path_yaw);
@@ -169,9 +169,8 @@ double calcObstacleWidth(const autoware_auto_perception_msgs::msg::Shape & shape
 
 double calcDiffAngleAgainstPath(
   const std::vector<PathPointWithLaneId> & path_points,
-  const geometry_msgs::msg::Pose & target_pose)
+  const geometry_msgs::msg::Pose & target_pose, const size_t nearest_idx)
 {
-  const size_t nearest_idx = motion_utils::findNearestIndex(path_points, target_pose.position);
   const double traj_yaw = tf2::getYaw(path_points.at(nearest_idx).point.pose.orientation);
 
   const double target_yaw = tf2::getYaw(target_pose.orientation);
@@ -200,10 +199,10 @@ double calcDiffAngleAgainstPath(
 }
 
 double calcDistanceToPath(
-  const std::vector<PathPointWithLaneId> & path_points,
-  const geometry_msgs::msg::Point & target_pos)
+  const RefPathIndex & ref_path_index, const geometry_msgs::msg::Point & target_pos,
+  const size_t target_idx)
 {
-  const size_t target_idx = motion_utils::findNearestIndex(path_points, target_pos);
+  const auto & path_points = ref_path_index.points();
   if (target_idx == 0 || target_idx == path_points.size() - 1) {
     const double target_yaw = tf2::getYaw(path_points.at(target_idx).point.pose.orientation);
     const double angle_to_target_pos = tier4_autoware_utils::calcAzimuthAngle(
@@ -217,14 +216,13 @@ double calcDistanceToPath(
     }
   }
 
-  return std::abs(motion_utils::calcLateralOffset(path_points, target_pos));
+  return std::abs(ref_path_index.calcLateralOffset(target_pos));
 }
 
 bool isLeft(
   const std::vector<PathPointWithLaneId> & path_points,
-  const geometry_msgs::msg::Point & target_pos)
+  const geometry_msgs::msg::Point & target_pos, const size_t target_idx)
 {
-  const size_t target_idx = motion_utils::findNearestIndex(path_points, target_pos);
   const double target_yaw = tf2::getYaw(path_points.at(target_idx).point.pose.orientation);
   const double angle_to_target_pos = tier4_autoware_utils::calcAzimuthAngle(
     path_points.at(target_idx).point.pose.position, target_pos);
@@ -301,6 +299,41 @@ std::vector<geometry_msgs::msg::Point> convertToPoints(
 }
 }  // namespace
 
+RefPathIndex::RefPathIndex(
+  const std::vector<PathPointWithLaneId> & points, const geometry_msgs::msg::Point & ego_pos,
+  const size_t ego_seg_idx)
+: points_(points),
+  points_index_(points_),
+  overlap_removed_points_(motion_utils::removeOverlapPoints(points_)),
+  overlap_removed_points_index_(overlap_removed_points_),
+  ego_seg_idx_(ego_seg_idx),
+  ego_lon_offset_to_seg_(points_index_.calcLongitudinalOffsetToSegment(ego_seg_idx, ego_pos))
+{
+}
+
+double RefPathIndex::calcLateralOffset(const geometry_msgs::msg::Point & point) const
+{
+  if (overlap_removed_points_.size() < 2) {
+    return std::nan("");
+  }
+  return calcLateralOffset(point, overlap_removed_points_index_.findNearestSegmentIndex(point));
+}
+
+double RefPathIndex::calcLateralOffset(
+  const geometry_msgs::msg::Point & point, const size_t seg_idx) const
+{
+  if (overlap_removed_points_.size() < 2) {
+    return std::nan("");
+  }
+  const size_t p_front_idx = std::min(seg_idx, overlap_removed_points_.size() - 2);
+  const auto & p_front = overlap_removed_points_.at(p_front_idx).point.pose.position;
+  const auto & p_back = overlap_removed_points_.at(p_front_idx + 1).point.pose.position;
+
+  const Eigen::Vector3d segment_vec{p_back.x - p_front.x, p_back.y - p_front.y, 0.0};
+  const Eigen::Vector3d target_vec{point.x - p_front.x, point.y - p_front.y, 0.0};
+  return segment_vec.cross(target_vec)(2) / segment_vec.norm();
+}
+
 DynamicObstacleAvoidanceModule::DynamicObstacleAvoidanceModule(
   const std::string & name, rclcpp::Node & node,
   std::shared_ptr<DynamicAvoidanceParameters> parameters,
@@ -355,16 +388,22 @@ void DynamicObstacleAvoidanceModule::updateData()
   const auto prev_objects = target_objects_manager_.getValidObjects();
   target_objects_manager_.initialize();
 
+  // NOTE: The reference path is indexed once here since all the objects are checked along it.
+  const auto & input_path_points = getPreviousModuleOutput().path.points;
+  const RefPathIndex ref_path_index(
+    input_path_points, getEgoPose().position,
+    planner_data_->findEgoSegmentIndex(input_path_points));
+
   // 1. Rough filtering of target objects with small computing cost
-  registerRegulatedObjects(prev_objects);
-  registerUnregulatedObjects(prev_objects);
+  registerRegulatedObjects(prev_objects, ref_path_index);
+  registerUnregulatedObjects(prev_objects, ref_path_index);
 
   const auto & ego_lat_feasible_paths = generateLateralFeasiblePaths(getEgoPose(), getEgoSpeed());
   target_objects_manager_.finalize(ego_lat_feasible_paths);
 
   // 2. Precise filtering of target objects and check if they should be avoided
-  determineWhetherToAvoidAgainstRegulatedObjects(prev_objects);
-  determineWhetherToAvoidAgainstUnregulatedObjects(prev_objects);
+  determineWhetherToAvoidAgainstRegulatedObjects(prev_objects, ref_path_index);
+  determineWhetherToAvoidAgainstUnregulatedObjects(prev_objects, ref_path_index);
 
   const auto target_objects_candidate = target_objects_manager_.getValidObjects();
   target_objects_.clear();
@@ -488,9 +527,9 @@ ObjectType DynamicObstacleAvoidanceModule::getObjectType(const uint8_t label) co
 }
 
 void DynamicObstacleAvoidanceModule::registerRegulatedObjects(
-  const std::vector<DynamicAvoidanceObject> & prev_objects)
+  const std::vector<DynamicAvoidanceObject> & prev_objects, const RefPathIndex & ref_path_index)
 {
-  const auto input_path = getPreviousModuleOutput().path;
+  const auto & input_path_points = ref_path_index.points();
   const auto & predicted_objects = planner_data_->dynamic_object->objects;
 
   for (const auto & predicted_object : predicted_objects) {
@@ -500,10 +539,6 @@ void DynamicObstacleAvoidanceModule::registerRegulatedObjects(
       predicted_object.kinematics.initial_twist_with_covariance.twist.linear.x,
       predicted_object.kinematics.initial_twist_with_covariance.twist.linear.y);
     const auto prev_object = getObstacleFromUuid(prev_objects, obj_uuid);
-    const auto obj_path = *std::max_element(
-      predicted_object.kinematics.predicted_paths.begin(),
-      predicted_object.kinematics.predicted_paths.end(),
-      [](const PredictedPath & a, const PredictedPath & b) { return a.confidence < b.confidence; });
 
     // 1.a. check label
     if (getObjectType(predicted_object.classification.front().label) != ObjectType::REGULATED) {
@@ -511,8 +546,9 @@ void DynamicObstacleAvoidanceModule::registerRegulatedObjects(
     }
 
     // 1.b. check obstacle velocity
+    const size_t obj_idx = ref_path_index.findNearestIndex(obj_pose.position);
     const auto [obj_tangent_vel, obj_normal_vel] =
-      projectObstacleVelocityToTrajectory(input_path.points, predicted_object);
+      projectObstacleVelocityToTrajectory(input_path_points, predicted_object, obj_idx);
     if (
       std::abs(obj_tangent_vel) < parameters_->min_obstacle_vel ||
       parameters_->max_obstacle_vel < std::abs(obj_tangent_vel)) {
@@ -520,7 +556,7 @@ void DynamicObstacleAvoidanceModule::registerRegulatedObjects(
     }
 
     // 1.c. check if object is not crossing ego's path
-    const double obj_angle = calcDiffAngleAgainstPath(input_path.points, obj_pose);
+    const double obj_angle = calcDiffAngleAgainstPath(input_path_points, obj_pose, obj_idx);
     const double max_crossing_object_angle = 0.0 <= obj_tangent_vel
                                                ? parameters_->max_overtaking_crossing_object_angle
                                                : parameters_->max_oncoming_crossing_object_angle;
@@ -540,7 +576,8 @@ void DynamicObstacleAvoidanceModule::registerRegulatedObjects(
     }
 
     // 1.e. check if object lateral offset to ego's path is small enough
-    const double obj_dist_to_path = calcDistanceToPath(input_path.points, obj_pose.position);
+    const double obj_dist_to_path =
+      calcDistanceToPath(ref_path_index, obj_pose.position, obj_idx);
     const bool is_object_far_from_path = isObjectFarFromPath(predicted_object, obj_dist_to_path);
     if (is_object_far_from_path) {
       RCLCPP_INFO_EXPRESSION(
@@ -576,9 +613,9 @@ void DynamicObstacleAvoidanceModule::registerRegulatedObjects(
 }
 
 void DynamicObstacleAvoidanceModule::registerUnregulatedObjects(
-  const std::vector<DynamicAvoidanceObject> & prev_objects)
+  const std::vector<DynamicAvoidanceObject> & prev_objects, const RefPathIndex & ref_path_index)
 {
-  const auto input_path = getPreviousModuleOutput().path;
+  const auto & input_path_points = ref_path_index.points();
   const auto & predicted_objects = planner_data_->dynamic_object->objects;
 
   for (const auto & predicted_object : predicted_objects) {
@@ -588,10 +625,6 @@ void DynamicObstacleAvoidanceModule::registerUnregulatedObjects(
       predicted_object.kinematics.initial_twist_with_covariance.twist.linear.x,
       predicted_object.kinematics.initial_twist_with_covariance.twist.linear.y);
     const auto prev_object = getObstacleFromUuid(prev_objects, obj_uuid);
-    const auto obj_path = *std::max_element(
-      predicted_object.kinematics.predicted_paths.begin(),
-      predicted_object.kinematics.predicted_paths.end(),
-      [](const PredictedPath & a, const PredictedPath & b) { return a.confidence < b.confidence; });
 
     // 1.a. Check if the obstacle is labeled as pedestrians, bicycle or similar.
     if (getObjectType(predicted_object.classification.front().label) != ObjectType::UNREGULATED) {
@@ -599,8 +632,9 @@ void DynamicObstacleAvoidanceModule::registerUnregulatedObjects(
     }
 
     // 1.b. Check if the object's velocity is within the module's coverage range.
+    const size_t obj_idx = ref_path_index.findNearestIndex(obj_pose.position);
     const auto [obj_tangent_vel, obj_normal_vel] =
-      projectObstacleVelocityToTrajectory(input_path.points, predicted_object);
+      projectObstacleVelocityToTrajectory(input_path_points, predicted_object, obj_idx);
     if (
       obj_vel_norm < parameters_->min_obstacle_vel ||
       obj_vel_norm > parameters_->max_obstacle_vel) {
@@ -622,7 +656,7 @@ void DynamicObstacleAvoidanceModule::registerUnregulatedObjects(
     //  1.f. calculate the object is on ego's path or not
 
     const double dist_obj_center_to_path =
-      std::abs(motion_utils::calcLateralOffset(input_path.points, obj_pose.position));
+      std::abs(ref_path_index.calcLateralOffset(obj_pose.position));
     const bool is_object_on_ego_path =
       dist_obj_center_to_path <
       planner_data_->parameters.vehicle_width / 2.0 + parameters_->min_obj_lat_offset_to_ego_path;
@@ -650,7 +684,7 @@ void DynamicObstacleAvoidanceModule::registerUnregulatedObjects(
 }
 
 void DynamicObstacleAvoidanceModule::determineWhetherToAvoidAgainstRegulatedObjects(
-  const std::vector<DynamicAvoidanceObject> & prev_objects)
+  const std::vector<DynamicAvoidanceObject> & prev_objects, const RefPathIndex & ref_path_index)
 {
   const auto & input_path = getPreviousModuleOutput().path;
 
@@ -668,7 +702,8 @@ void DynamicObstacleAvoidanceModule::determineWhetherToAvoidAgainstRegulatedObje
     const auto & ref_path_points_for_obj_poly = input_path.points;
 
     // 2.a. check if object is not to be followed by ego
-    const double obj_angle = calcDiffAngleAgainstPath(input_path.points, object.pose);
+    const size_t obj_idx = ref_path_index.findNearestIndex(object.pose.position);
+    const double obj_angle = calcDiffAngleAgainstPath(input_path.points, object.pose, obj_idx);
     const bool is_object_aligned_to_path =
       std::abs(obj_angle) < parameters_->max_front_object_angle ||
       M_PI - parameters_->max_front_object_angle < std::abs(obj_angle);
@@ -682,13 +717,13 @@ void DynamicObstacleAvoidanceModule::determineWhetherToAvoidAgainstRegulatedObje
     }
 
     // 2.b. calculate which side object exists against ego's path
-    const bool is_object_left = isLeft(input_path.points, object.pose.position);
+    const bool is_object_left = isLeft(input_path.points, object.pose.position, obj_idx);
     const auto lat_lon_offset =
-      getLateralLongitudinalOffset(input_path.points, object.pose, object.shape);
+      getLateralLongitudinalOffset(ref_path_index, object.pose, object.shape);
 
     // 2.c. check if object will not cut in
     const bool will_object_cut_in =
-      willObjectCutIn(input_path.points, obj_path, object.vel, lat_lon_offset);
+      willObjectCutIn(ref_path_index, obj_path, object.vel, lat_lon_offset);
     if (will_object_cut_in) {
       RCLCPP_INFO_EXPRESSION(
         getLogger(), parameters_->enable_debug_info,
@@ -717,7 +752,7 @@ void DynamicObstacleAvoidanceModule::determineWhetherToAvoidAgainstRegulatedObje
 
     // 2.e. check time to collision
     const auto time_while_collision =
-      calcTimeWhileCollision(input_path.points, object.vel, lat_lon_offset);
+      calcTimeWhileCollision(ref_path_index, object.vel, lat_lon_offset);
     const double time_to_collision = time_while_collision.time_to_start_collision;
     if (parameters_->max_stopped_object_vel < std::hypot(object.vel, object.lat_vel)) {
       // NOTE: Only not stopped object is filtered by time to collision.
@@ -755,15 +790,18 @@ void DynamicObstacleAvoidanceModule::determineWhetherToAvoidAgainstRegulatedObje
       }
       const auto future_obj_pose =
         object_recognition_utils::calcInterpolatedPose(obj_path, time_to_collision);
-      return future_obj_pose ? isLeft(input_path.points, future_obj_pose->position)
-                             : is_object_left;
+      if (!future_obj_pose) {
+        return is_object_left;
+      }
+      return isLeft(
+        input_path.points, future_obj_pose->position,
+        ref_path_index.findNearestIndex(future_obj_pose->position));
     }();
 
     // 2.g. check if the ego is not ahead of the object.
     const double signed_dist_ego_to_obj = [&]() {
-      const size_t ego_seg_idx = planner_data_->findEgoSegmentIndex(input_path.points);
-      const double lon_offset_ego_to_obj = motion_utils::calcSignedArcLength(
-        input_path.points, getEgoPose().position, ego_seg_idx, lat_lon_offset.nearest_idx);
+      const double lon_offset_ego_to_obj =
+        ref_path_index.calcSignedArcLengthFromEgo(lat_lon_offset.nearest_idx);
       if (0 < lon_offset_ego_to_obj) {
         return std::max(
           0.0, lon_offset_ego_to_obj - planner_data_->parameters.front_overhang +
@@ -810,7 +848,7 @@ void DynamicObstacleAvoidanceModule::determineWhetherToAvoidAgainstRegulatedObje
 }
 
 void DynamicObstacleAvoidanceModule::determineWhetherToAvoidAgainstUnregulatedObjects(
-  const std::vector<DynamicAvoidanceObject> & prev_objects)
+  const std::vector<DynamicAvoidanceObject> & prev_objects, const RefPathIndex & ref_path_index)
 {
   const auto & input_path = getPreviousModuleOutput().path;
 
@@ -824,11 +862,10 @@ void DynamicObstacleAvoidanceModule::determineWhetherToAvoidAgainstUnregulatedOb
 
     // 2.g. check if the ego is not ahead of the object.
     const auto lat_lon_offset =
-      getLateralLongitudinalOffset(input_path.points, object.pose, object.shape);
+      getLateralLongitudinalOffset(ref_path_index, object.pose, object.shape);
     const double signed_dist_ego_to_obj = [&]() {
-      const size_t ego_seg_idx = planner_data_->findEgoSegmentIndex(input_path.points);
-      const double lon_offset_ego_to_obj = motion_utils::calcSignedArcLength(
-        input_path.points, getEgoPose().position, ego_seg_idx, lat_lon_offset.nearest_idx);
+      const double lon_offset_ego_to_obj =
+        ref_path_index.calcSignedArcLengthFromEgo(lat_lon_offset.nearest_idx);
       if (0 < lon_offset_ego_to_obj) {
         return std::max(
           0.0, lon_offset_ego_to_obj - planner_data_->parameters.front_overhang +
@@ -972,14 +1009,13 @@ DynamicObstacleAvoidanceModule::calcCollisionSection(
 }
 
 TimeWhileCollision DynamicObstacleAvoidanceModule::calcTimeWhileCollision(
-  const std::vector<PathPointWithLaneId> & ego_path, const double obj_tangent_vel,
+  const RefPathIndex & ref_path_index, const double obj_tangent_vel,
   const LatLonOffset & lat_lon_offset) const
 {
   // Set maximum time-to-collision 0 if the object longitudinally overlaps ego.
   // NOTE: This is to avoid objects running right beside ego even if time-to-collision is negative.
-  const size_t ego_seg_idx = planner_data_->findEgoSegmentIndex(ego_path);
-  const double lon_offset_ego_to_obj_idx = motion_utils::calcSignedArcLength(
-    ego_path, getEgoPose().position, ego_seg_idx, lat_lon_offset.nearest_idx);
+  const double lon_offset_ego_to_obj_idx =
+    ref_path_index.calcSignedArcLengthFromEgo(lat_lon_offset.nearest_idx);
   const double relative_velocity = getEgoSpeed() - obj_tangent_vel;
 
   const double signed_time_to_start_collision = [&]() {
@@ -1038,7 +1074,7 @@ bool DynamicObstacleAvoidanceModule::isObjectFarFromPath(
 }
 
 bool DynamicObstacleAvoidanceModule::willObjectCutIn(
-  const std::vector<PathPointWithLaneId> & ego_path, const PredictedPath & predicted_path,
+  const RefPathIndex & ref_path_index, const PredictedPath & predicted_path,
   const double obj_tangent_vel, const LatLonOffset & lat_lon_offset) const
 {
   // Ignore oncoming object
@@ -1050,7 +1086,7 @@ bool DynamicObstacleAvoidanceModule::willObjectCutIn(
   const bool will_object_cut_in = [&]() {
     for (const auto & predicted_path_point : predicted_path.path) {
       const double paths_lat_diff =
-        motion_utils::calcLateralOffset(ego_path, predicted_path_point.position);
+        ref_path_index.calcLateralOffset(predicted_path_point.position);
       if (std::abs(paths_lat_diff) < planner_data_->parameters.vehicle_width / 2.0) {
         return true;
       }
@@ -1063,11 +1099,9 @@ bool DynamicObstacleAvoidanceModule::willObjectCutIn(
   }
 
   // Ignore object longitudinally close to the ego
-  const size_t ego_seg_idx = planner_data_->findEgoSegmentIndex(ego_path);
   const double relative_velocity = getEgoSpeed() - obj_tangent_vel;
   const double lon_offset_ego_to_obj =
-    motion_utils::calcSignedArcLength(
-      ego_path, getEgoPose().position, ego_seg_idx, lat_lon_offset.nearest_idx) +
+    ref_path_index.calcSignedArcLengthFromEgo(lat_lon_offset.nearest_idx) +
     lat_lon_offset.min_lon_offset;
   if (
     lon_offset_ego_to_obj < std::max(
@@ -1145,8 +1179,8 @@ DynamicObstacleAvoidanceModule::getAdjacentLanes(
 {
   const auto & rh = planner_data_->route_handler;
 
-  lanelet::ConstLanelet current_lane;
-  if (!rh->getClosestLaneletWithinRoute(getEgoPose(), &current_lane)) {
+  const auto current_lane = utils::getClosestLaneletWithinRoute(planner_data_);
+  if (!current_lane) {
     RCLCPP_ERROR(
       rclcpp::get_logger("behavior_path_planner").get_child("dynamic_avoidance"),
       "failed to find closest lanelet within route!!!");
@@ -1154,7 +1188,7 @@ DynamicObstacleAvoidanceModule::getAdjacentLanes(
   }
 
   const auto ego_succeeding_lanes =
-    rh->getLaneletSequence(current_lane, getEgoPose(), backward_distance, forward_distance);
+    rh->getLaneletSequence(*current_lane, getEgoPose(), backward_distance, forward_distance);
 
   lanelet::ConstLanelets right_lanes;
   lanelet::ConstLanelets left_lanes;
@@ -1182,10 +1216,11 @@ DynamicObstacleAvoidanceModule::getAdjacentLanes(
 
 DynamicObstacleAvoidanceModule::LatLonOffset
 DynamicObstacleAvoidanceModule::getLateralLongitudinalOffset(
-  const std::vector<PathPointWithLaneId> & ego_path, const geometry_msgs::msg::Pose & obj_pose,
+  const RefPathIndex & ref_path_index, const geometry_msgs::msg::Pose & obj_pose,
   const autoware_auto_perception_msgs::msg::Shape & obj_shape) const
 {
-  const size_t obj_seg_idx = motion_utils::findNearestSegmentIndex(ego_path, obj_pose.position);
+  const auto & ego_path = ref_path_index.points();
+  const size_t obj_seg_idx = ref_path_index.findNearestSegmentIndex(obj_pose.position);
   const auto obj_points = tier4_autoware_utils::toPolygon2d(obj_pose, obj_shape);
 
   // TODO(murooka) calculation is not so accurate.
@@ -1193,12 +1228,11 @@ DynamicObstacleAvoidanceModule::getLateralLongitudinalOffset(
   std::vector<double> obj_lon_offset_vec;
   for (size_t i = 0; i < obj_points.outer().size(); ++i) {
     const auto geom_obj_point = toGeometryPoint(obj_points.outer().at(i));
-    const size_t obj_point_seg_idx =
-      motion_utils::findNearestSegmentIndex(ego_path, geom_obj_point);
+    const size_t obj_point_seg_idx = ref_path_index.findNearestSegmentIndex(geom_obj_point);
 
     // calculate lateral offset
     const double obj_point_lat_offset =
-      motion_utils::calcLateralOffset(ego_path, geom_obj_point, obj_point_seg_idx);
+      ref_path_index.calcLateralOffset(geom_obj_point, obj_point_seg_idx);
     obj_lat_offset_vec.push_back(obj_point_lat_offset);
 
     // calculate longitudinal offset
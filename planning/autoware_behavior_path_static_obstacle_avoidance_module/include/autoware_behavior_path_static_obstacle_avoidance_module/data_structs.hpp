@@ -454,6 +454,30 @@ struct ObjectData  // avoidance target
 };
 using ObjectDataArray = std::vector<ObjectData>;
 
+/*
+ * One-shot envelope polygon of an object with the inputs it was made from, kept over the planning
+ * cycles so that the polygon is made again only when the inputs change more than the tolerances.
+ */
+struct ObjectEnvelopeCache
+{
+  // object pose and shape the polygon was made from
+  Pose object_pose{};
+  Shape object_shape{};
+
+  // yaw of the closest path pose, which the envelope is aligned with
+  double closest_yaw{0.0};
+
+  double envelope_buffer_margin{0.0};
+
+  Polygon2d object_poly{};
+
+  Polygon2d envelope_poly{};
+
+  // used in the current planning cycle. the unused caches are removed at the end of the cycle.
+  bool is_used{false};
+};
+using ObjectEnvelopeCacheMap = std::unordered_map<std::string, ObjectEnvelopeCache>;
+
 /*
  * Shift point with additional info for avoidance planning
  */
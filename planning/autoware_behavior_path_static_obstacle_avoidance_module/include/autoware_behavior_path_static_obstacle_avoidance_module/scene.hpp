@@ -445,6 +445,8 @@ private:
   // TODO(Satoshi OTA) remove this variable.
   mutable ObjectDataArray stopped_objects_;
 
+  mutable ObjectEnvelopeCacheMap envelope_cache_;
+
   mutable size_t safe_count_{0};
 
   mutable DebugData debug_data_;
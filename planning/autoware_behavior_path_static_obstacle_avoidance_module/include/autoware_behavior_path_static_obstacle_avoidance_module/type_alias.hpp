@@ -36,6 +36,7 @@ namespace behavior_path_planner
 // auto msgs
 using autoware_auto_perception_msgs::msg::PredictedObject;
 using autoware_auto_perception_msgs::msg::PredictedPath;
+using autoware_auto_perception_msgs::msg::Shape;
 using autoware_auto_planning_msgs::msg::PathWithLaneId;
 
 // ROS 2 general msgs
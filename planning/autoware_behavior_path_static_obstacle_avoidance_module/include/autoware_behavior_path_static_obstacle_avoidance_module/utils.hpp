@@ -104,6 +104,16 @@ void fillObjectEnvelopePolygon(
   ObjectData & object_data, const ObjectDataArray & registered_objects, const Pose & closest_pose,
   const std::shared_ptr<AvoidanceParameters> & parameters);
 
+void fillObjectEnvelopePolygon(
+  ObjectData & object_data, const ObjectDataArray & registered_objects, const Pose & closest_pose,
+  const std::shared_ptr<AvoidanceParameters> & parameters, ObjectEnvelopeCacheMap & envelope_cache);
+
+bool isSameEnvelopeInput(
+  const ObjectEnvelopeCache & cache, const PredictedObject & object, const double closest_yaw,
+  const double envelope_buffer_margin);
+
+void removeUnusedEnvelopeCache(ObjectEnvelopeCacheMap & envelope_cache);
+
 void fillObjectMovingTime(
   ObjectData & object_data, ObjectDataArray & stopped_objects,
   const std::shared_ptr<AvoidanceParameters> & parameters);
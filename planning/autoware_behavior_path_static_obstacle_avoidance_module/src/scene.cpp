@@ -284,6 +284,7 @@ void StaticObstacleAvoidanceModule::fillFundamentalData(
 
   // target objects for avoidance
   fillAvoidanceTargetObjects(data, debug);
+  utils::static_obstacle_avoidance::removeUnusedEnvelopeCache(envelope_cache_);
 
   // lost object compensation
   utils::static_obstacle_avoidance::updateRegisteredObject(
@@ -391,7 +392,7 @@ ObjectData StaticObstacleAvoidanceModule::createObjectData(
 
   // Calc envelop polygon.
   utils::static_obstacle_avoidance::fillObjectEnvelopePolygon(
-    object_data, registered_objects_, object_closest_pose, parameters_);
+    object_data, registered_objects_, object_closest_pose, parameters_, envelope_cache_);
 
   // calc object centroid.
   object_data.centroid = return_centroid<Point2d>(object_data.envelope_poly);
@@ -1302,6 +1303,7 @@ void StaticObstacleAvoidanceModule::initVariables()
   resetPathCandidate();
   resetPathReference();
   arrived_path_end_ = false;
+  envelope_cache_.clear();
 }
 
 void StaticObstacleAvoidanceModule::initRTCStatus()
@@ -1413,6 +1413,15 @@ void insertDecelPoint(
 void fillObjectEnvelopePolygon(
   ObjectData & object_data, const ObjectDataArray & registered_objects, const Pose & closest_pose,
   const std::shared_ptr<AvoidanceParameters> & parameters)
+{
+  ObjectEnvelopeCacheMap envelope_cache;
+  fillObjectEnvelopePolygon(
+    object_data, registered_objects, closest_pose, parameters, envelope_cache);
+}
+
+void fillObjectEnvelopePolygon(
+  ObjectData & object_data, const ObjectDataArray & registered_objects, const Pose & closest_pose,
+  const std::shared_ptr<AvoidanceParameters> & parameters, ObjectEnvelopeCacheMap & envelope_cache)
 {
   const auto object_type = utils::getHighestProbLabel(object_data.object.classification);
   const auto object_parameter = parameters->object_parameters.at(object_type);
@@ -1420,19 +1429,31 @@ void fillObjectEnvelopePolygon(
   const auto & envelope_buffer_margin =
     object_parameter.envelope_buffer_margin * object_data.distance_factor;
 
+  // make the one-shot envelope polygon again only if the object or the path around it moves.
+  const auto closest_yaw = tf2::getYaw(closest_pose.orientation);
+  auto & cache = envelope_cache[toHexString(object_data.object.object_id)];
+  if (!isSameEnvelopeInput(cache, object_data.object, closest_yaw, envelope_buffer_margin)) {
+    cache.object_pose = object_data.object.kinematics.initial_pose_with_covariance.pose;
+    cache.object_shape = object_data.object.shape;
+    cache.closest_yaw = closest_yaw;
+    cache.envelope_buffer_margin = envelope_buffer_margin;
+    cache.object_poly = tier4_autoware_utils::toPolygon2d(object_data.object);
+    cache.envelope_poly =
+      createEnvelopePolygon(cache.object_poly, closest_pose, envelope_buffer_margin);
+  }
+  cache.is_used = true;
+
   const auto id = object_data.object.object_id;
   const auto same_id_obj = std::find_if(
     registered_objects.begin(), registered_objects.end(),
     [&id](const auto & o) { return o.object.object_id == id; });
 
   if (same_id_obj == registered_objects.end()) {
-    object_data.envelope_poly =
-      createEnvelopePolygon(object_data, closest_pose, envelope_buffer_margin);
+    object_data.envelope_poly = cache.envelope_poly;
     return;
   }
 
-  const auto one_shot_envelope_poly =
-    createEnvelopePolygon(object_data, closest_pose, envelope_buffer_margin);
+  const auto & one_shot_envelope_poly = cache.envelope_poly;
 
   // If the one_shot_envelope_poly is within the registered envelope, use the registered one
   if (boost::geometry::within(one_shot_envelope_poly, same_id_obj->envelope_poly)) {
@@ -1453,8 +1474,7 @@ void fillObjectEnvelopePolygon(
 
   const auto multi_step_envelope_poly = createEnvelopePolygon(unions.front(), closest_pose, 0.0);
 
-  const auto object_polygon = tier4_autoware_utils::toPolygon2d(object_data.object);
-  const auto object_polygon_area = boost::geometry::area(object_polygon);
+  const auto object_polygon_area = boost::geometry::area(cache.object_poly);
   const auto envelope_polygon_area = boost::geometry::area(multi_step_envelope_poly);
 
   // keep multi-step envelope polygon.
@@ -1468,6 +1488,58 @@ void fillObjectEnvelopePolygon(
   object_data.envelope_poly = one_shot_envelope_poly;
 }
 
+bool isSameEnvelopeInput(
+  const ObjectEnvelopeCache & cache, const PredictedObject & object, const double closest_yaw,
+  const double envelope_buffer_margin)
+{
+  // NOTE: The tolerances are small against the envelope buffer margin, and the envelope made from
+  //       the cached inputs is kept, so that the error does not accumulate while the object creeps.
+  constexpr double POS_THR = 0.05;  // [m]
+  constexpr double YAW_THR = 0.01;  // [rad]
+
+  if (cache.envelope_poly.outer().empty()) {
+    return false;
+  }
+
+  const auto & object_pose = object.kinematics.initial_pose_with_covariance.pose;
+  if (calcDistance2d(cache.object_pose, object_pose) > POS_THR) {
+    return false;
+  }
+
+  if (std::abs(calcYawDeviation(cache.object_pose, object_pose)) > YAW_THR) {
+    return false;
+  }
+
+  if (std::abs(tier4_autoware_utils::normalizeRadian(closest_yaw - cache.closest_yaw)) > YAW_THR) {
+    return false;
+  }
+
+  if (std::abs(envelope_buffer_margin - cache.envelope_buffer_margin) > POS_THR) {
+    return false;
+  }
+
+  const auto & shape = object.shape;
+  const auto & cache_shape = cache.object_shape;
+  if (shape.type != cache_shape.type || shape.footprint != cache_shape.footprint) {
+    return false;
+  }
+
+  return std::abs(shape.dimensions.x - cache_shape.dimensions.x) < POS_THR &&
+         std::abs(shape.dimensions.y - cache_shape.dimensions.y) < POS_THR;
+}
+
+void removeUnusedEnvelopeCache(ObjectEnvelopeCacheMap & envelope_cache)
+{
+  for (auto itr = envelope_cache.begin(); itr != envelope_cache.end();) {
+    if (!itr->second.is_used) {
+      itr = envelope_cache.erase(itr);
+      continue;
+    }
+    itr->second.is_used = false;
+    ++itr;
+  }
+}
+
 void fillObjectMovingTime(
   ObjectData & object_data, ObjectDataArray & stopped_objects,
   const std::shared_ptr<AvoidanceParameters> & parameters)
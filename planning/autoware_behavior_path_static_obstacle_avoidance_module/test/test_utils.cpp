@@ -19,9 +19,13 @@
 #include <gtest/gtest.h>
 
 using behavior_path_planner::ObjectData;
+using behavior_path_planner::ObjectEnvelopeCache;
+using behavior_path_planner::ObjectEnvelopeCacheMap;
 using behavior_path_planner::utils::static_obstacle_avoidance::isOnRight;
 using behavior_path_planner::utils::static_obstacle_avoidance::isSameDirectionShift;
+using behavior_path_planner::utils::static_obstacle_avoidance::isSameEnvelopeInput;
 using behavior_path_planner::utils::static_obstacle_avoidance::isShiftNecessary;
+using behavior_path_planner::utils::static_obstacle_avoidance::removeUnusedEnvelopeCache;
 
 TEST(BehaviorPathPlanningAvoidanceUtilsTest, shiftLengthDirectionTest)
 {
@@ -54,3 +58,42 @@ TEST(BehaviorPathPlanningAvoidanceUtilsTest, shiftNecessaryTest)
   ASSERT_TRUE(isShiftNecessary(isOnRight(left_obj), negative_shift_length));
   ASSERT_FALSE(isShiftNecessary(isOnRight(left_obj), positive_shift_length));
 }
+
+TEST(BehaviorPathPlanningAvoidanceUtilsTest, envelopeCacheTest)
+{
+  ObjectData obj;
+  obj.object.shape.dimensions.x = 4.0;
+  obj.object.shape.dimensions.y = 2.0;
+  obj.object.kinematics.initial_pose_with_covariance.pose.orientation.w = 1.0;
+
+  ObjectEnvelopeCache cache;
+  cache.object_pose = obj.object.kinematics.initial_pose_with_covariance.pose;
+  cache.object_shape = obj.object.shape;
+  cache.closest_yaw = 0.0;
+  cache.envelope_buffer_margin = 0.5;
+
+  // the cache without polygon is always invalid.
+  ASSERT_FALSE(isSameEnvelopeInput(cache, obj.object, 0.0, 0.5));
+
+  cache.envelope_poly.outer().emplace_back(0.0, 0.0);
+  ASSERT_TRUE(isSameEnvelopeInput(cache, obj.object, 0.0, 0.5));
+  ASSERT_FALSE(isSameEnvelopeInput(cache, obj.object, 0.1, 0.5));
+  ASSERT_FALSE(isSameEnvelopeInput(cache, obj.object, 0.0, 1.0));
+
+  obj.object.kinematics.initial_pose_with_covariance.pose.position.x = 0.01;
+  ASSERT_TRUE(isSameEnvelopeInput(cache, obj.object, 0.0, 0.5));
+  obj.object.kinematics.initial_pose_with_covariance.pose.position.x = 1.0;
+  ASSERT_FALSE(isSameEnvelopeInput(cache, obj.object, 0.0, 0.5));
+
+  obj.object.kinematics.initial_pose_with_covariance.pose.position.x = 0.0;
+  obj.object.shape.dimensions.x = 5.0;
+  ASSERT_FALSE(isSameEnvelopeInput(cache, obj.object, 0.0, 0.5));
+
+  ObjectEnvelopeCacheMap envelope_cache;
+  envelope_cache["used"].is_used = true;
+  envelope_cache["unused"].is_used = false;
+  removeUnusedEnvelopeCache(envelope_cache);
+  ASSERT_EQ(envelope_cache.size(), 1u);
+  ASSERT_EQ(envelope_cache.count("used"), 1u);
+  ASSERT_FALSE(envelope_cache.at("used").is_used);
+}
@@ -133,6 +133,8 @@ BehaviorVelocityPlannerNode::BehaviorVelocityPlannerNode(const rclcpp::NodeOptio
   path_pub_ = this->create_publisher<autoware_auto_planning_msgs::msg::Path>("~/output/path", 1);
   stop_reason_diag_pub_ =
     this->create_publisher<diagnostic_msgs::msg::DiagnosticStatus>("~/output/stop_reason", 1);
+  processing_time_budget_diag_pub_ = this->create_publisher<diagnostic_msgs::msg::DiagnosticStatus>(
+    "~/output/processing_time_budget", 1);
   debug_viz_pub_ = this->create_publisher<visualization_msgs::msg::MarkerArray>("~/debug/path", 1);
 
   // Parameters
@@ -149,6 +151,20 @@ BehaviorVelocityPlannerNode::BehaviorVelocityPlannerNode(const rclcpp::NodeOptio
   // is simulation or not
   planner_data_.is_simulation = declare_parameter<bool>("is_simulation");
 
+  planner_manager_.setEnableParallelModuleUpdate(
+    declare_parameter<bool>("enable_parallel_module_update"));
+  {
+    ProcessingTimeBudgetParam param;
+    const std::string ns = "processing_time_budget.";
+    param.enable = declare_parameter<bool>(ns + "enable");
+    param.budget_ms = declare_parameter<double>(ns + "budget_ms");
+    param.overrun_count_threshold = declare_parameter<int>(ns + "overrun_count_threshold");
+    param.decimation = declare_parameter<int>(ns + "decimation");
+    param.decimatable_modules =
+      declare_parameter<std::vector<std::string>>(ns + "decimatable_modules");
+    planner_manager_.setProcessingTimeBudgetParam(param);
+  }
+
   // Initialize PlannerManager
   for (const auto & name : declare_parameter<std::vector<std::string>>("launch_modules")) {
     // workaround: Since ROS 2 can't get empty list, launcher set [''] on the parameter.
@@ -261,6 +277,8 @@ void BehaviorVelocityPlannerNode::onNoGroundPointCloud(
   {
     std::lock_guard<std::mutex> lock(mutex_);
     planner_data_.no_ground_pointcloud = pc_transformed;
+    planner_data_.no_ground_pointcloud_grid =
+      std::make_shared<const ::behavior_velocity_planner::PointCloudGrid>(pc_transformed);
   }
 }
 
@@ -404,6 +422,7 @@ void BehaviorVelocityPlannerNode::onTrigger(
   path_pub_->publish(output_path_msg);
   published_time_publisher_->publish_if_subscribed(path_pub_, output_path_msg.header.stamp);
   stop_reason_diag_pub_->publish(planner_manager_.getStopReasonDiag());
+  processing_time_budget_diag_pub_->publish(planner_manager_.getProcessingTimeBudgetDiag());
 
   if (debug_viz_pub_->get_subscription_count() > 0) {
     publishDebugMarker(output_path_msg);
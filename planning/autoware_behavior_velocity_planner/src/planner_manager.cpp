@@ -14,10 +14,18 @@
 
 #include "planner_manager.hpp"
 
+#include <motion_utils/trajectory/trajectory.hpp>
+#include <tier4_autoware_utils/geometry/pose_deviation.hpp>
+#include <tier4_autoware_utils/system/stop_watch.hpp>
+
 #include <boost/format.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace autoware::behavior_velocity_planner
 {
@@ -47,6 +55,33 @@ diagnostic_msgs::msg::DiagnosticStatus makeStopReasonDiag(
   stop_reason_diag.values.push_back(stop_reason_diag_kv);
   return stop_reason_diag;
 }
+
+// limit the velocities of the path by the ones planned by a plugin in its last run
+void applyLastPlannedVelocity(
+  const autoware_auto_planning_msgs::msg::PathWithLaneId & last_output_path,
+  autoware_auto_planning_msgs::msg::PathWithLaneId * path)
+{
+  const auto & last_points = last_output_path.points;
+  if (last_points.size() < 2) {
+    return;
+  }
+
+  for (auto & p : path->points) {
+    // NOTE: the points ahead of the end of the last output are not planned by the plugin yet
+    const auto & position = p.point.pose.position;
+    const auto & last_end_pose = last_points.back().point.pose;
+    if (tier4_autoware_utils::calcLongitudinalDeviation(last_end_pose, position) > 0) {
+      continue;
+    }
+    const size_t nearest_idx = motion_utils::findNearestIndex(last_points, position);
+    // NOTE: the next point is also considered, not to pass a stop point inserted between them
+    const size_t next_idx = std::min(nearest_idx + 1, last_points.size() - 1);
+    const float last_velocity = std::min(
+      last_points.at(nearest_idx).point.longitudinal_velocity_mps,
+      last_points.at(next_idx).point.longitudinal_velocity_mps);
+    p.point.longitudinal_velocity_mps = std::min(p.point.longitudinal_velocity_mps, last_velocity);
+  }
+}
 }  // namespace
 
 BehaviorVelocityPlannerManager::BehaviorVelocityPlannerManager()
@@ -92,6 +127,7 @@ void BehaviorVelocityPlannerManager::removeScenePlugin(
       "The scene plugin '" << name << "' is not found in the registered modules.");
   } else {
     scene_manager_plugins_.erase(it, scene_manager_plugins_.end());
+    plugin_processing_times_.erase(name);
     RCLCPP_INFO_STREAM(node.get_logger(), "The scene plugin '" << name << "' is unloaded.");
   }
 }
@@ -105,9 +141,54 @@ autoware_auto_planning_msgs::msg::PathWithLaneId BehaviorVelocityPlannerManager:
   int first_stop_path_point_index = static_cast<int>(output_path_msg.points.size() - 1);
   std::string stop_reason_msg("path_end");
 
-  for (const auto & plugin : scene_manager_plugins_) {
-    plugin->updateSceneModuleInstances(planner_data, input_path_msg);
+  // NOTE: the scene modules of each plugin are launched and expired only from the input path and
+  // the planner data, so that the plugins can update them in parallel. The velocities are planned
+  // in series since each plugin modifies the path planned by the previous ones.
+  const bool update_in_parallel =
+    enable_parallel_module_update_ && scene_manager_plugins_.size() > 1;
+  const size_t plugin_num = scene_manager_plugins_.size();
+  std::vector<bool> is_skipped(plugin_num);
+  for (size_t i = 0; i < plugin_num; ++i) {
+    is_skipped.at(i) = shouldSkip(scene_manager_plugins_.at(i)->getModuleName());
+  }
+
+  std::vector<double> update_times_ms(plugin_num, 0.0);
+  if (update_in_parallel) {
+    std::vector<std::future<void>> futures;
+    futures.reserve(plugin_num);
+    for (size_t i = 0; i < plugin_num; ++i) {
+      if (is_skipped.at(i)) {
+        continue;
+      }
+      const auto & plugin = scene_manager_plugins_.at(i);
+      futures.push_back(std::async(std::launch::async, [&, i]() {
+        tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+        stop_watch.tic();
+        plugin->updateSceneModuleInstances(planner_data, input_path_msg);
+        update_times_ms.at(i) = stop_watch.toc();
+      }));
+    }
+    for (auto & future : futures) {
+      future.get();
+    }
+  }
+
+  for (size_t i = 0; i < plugin_num; ++i) {
+    const auto & plugin = scene_manager_plugins_.at(i);
+    const std::string module_name = plugin->getModuleName();
+    if (is_skipped.at(i)) {
+      applyLastPlannedVelocity(
+        plugin_processing_times_.at(module_name).last_output_path, &output_path_msg);
+      continue;
+    }
+
+    tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+    stop_watch.tic();
+    if (!update_in_parallel) {
+      plugin->updateSceneModuleInstances(planner_data, input_path_msg);
+    }
     plugin->plan(&output_path_msg);
+    updateProcessingTime(module_name, update_times_ms.at(i) + stop_watch.toc(), output_path_msg);
     const auto firstStopPathPointIndex = plugin->getFirstStopPathPointIndex();
 
     if (firstStopPathPointIndex) {
@@ -128,4 +209,88 @@ diagnostic_msgs::msg::DiagnosticStatus BehaviorVelocityPlannerManager::getStopRe
 {
   return stop_reason_diag_;
 }
+
+diagnostic_msgs::msg::DiagnosticStatus
+BehaviorVelocityPlannerManager::getProcessingTimeBudgetDiag() const
+{
+  diagnostic_msgs::msg::DiagnosticStatus diag;
+  diag.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+  diag.name = "processing_time_budget";
+
+  std::vector<std::string> skipped_modules;
+  for (const auto & plugin : scene_manager_plugins_) {
+    const std::string module_name = plugin->getModuleName();
+    const auto itr = plugin_processing_times_.find(module_name);
+    if (itr == plugin_processing_times_.end()) {
+      continue;
+    }
+    const auto & processing_time = itr->second;
+
+    diagnostic_msgs::msg::KeyValue processing_time_kv;
+    processing_time_kv.key = module_name + "/processing_time_ms";
+    processing_time_kv.value = std::to_string(processing_time.processing_time_ms);
+    diag.values.push_back(processing_time_kv);
+    diagnostic_msgs::msg::KeyValue is_skipped_kv;
+    is_skipped_kv.key = module_name + "/is_skipped";
+    is_skipped_kv.value = processing_time.is_skipped ? "true" : "false";
+    diag.values.push_back(is_skipped_kv);
+
+    if (processing_time.is_skipped) {
+      skipped_modules.push_back(module_name);
+    }
+  }
+
+  if (!skipped_modules.empty()) {
+    diag.level = diagnostic_msgs::msg::DiagnosticStatus::WARN;
+    diag.message = "skipped over the processing time budget:";
+    for (const auto & module_name : skipped_modules) {
+      diag.message += " " + module_name;
+    }
+  }
+  return diag;
+}
+
+bool BehaviorVelocityPlannerManager::isDecimatable(const std::string & module_name) const
+{
+  const auto & modules = processing_time_budget_param_.decimatable_modules;
+  return processing_time_budget_param_.enable &&
+         std::find(modules.begin(), modules.end(), module_name) != modules.end();
+}
+
+bool BehaviorVelocityPlannerManager::shouldSkip(const std::string & module_name)
+{
+  const auto & param = processing_time_budget_param_;
+  auto & processing_time = plugin_processing_times_[module_name];
+
+  // NOTE: the plugin runs at least once before it is skipped, to have its last output
+  const bool is_decimated = isDecimatable(module_name) &&
+                            processing_time.overrun_count >= param.overrun_count_threshold &&
+                            !processing_time.last_output_path.points.empty();
+  processing_time.is_skipped = is_decimated && processing_time.skipped_count + 1 < param.decimation;
+  processing_time.skipped_count =
+    processing_time.is_skipped ? processing_time.skipped_count + 1 : 0;
+  return processing_time.is_skipped;
+}
+
+void BehaviorVelocityPlannerManager::updateProcessingTime(
+  const std::string & module_name, const double processing_time_ms,
+  const autoware_auto_planning_msgs::msg::PathWithLaneId & output_path)
+{
+  auto & processing_time = plugin_processing_times_[module_name];
+  processing_time.processing_time_ms = processing_time_ms;
+  if (!isDecimatable(module_name)) {
+    processing_time.overrun_count = 0;
+    processing_time.last_output_path.points.clear();
+    return;
+  }
+
+  const auto & param = processing_time_budget_param_;
+  if (processing_time_ms > param.budget_ms) {
+    processing_time.overrun_count =
+      std::min(processing_time.overrun_count + 1, param.overrun_count_threshold);
+  } else {
+    processing_time.overrun_count = 0;
+  }
+  processing_time.last_output_path = output_path;
+}
 }  // namespace autoware::behavior_velocity_planner
@@ -34,6 +34,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace autoware::behavior_velocity_planner
@@ -41,6 +42,21 @@ namespace autoware::behavior_velocity_planner
 using ::behavior_velocity_planner::PlannerData;
 using ::behavior_velocity_planner::PluginInterface;
 
+/**
+ * @brief processing time budget of the plugins which are allowed to skip some cycles
+ * @details a decimatable plugin which overruns the budget for overrun_count_threshold cycles in a
+ * row runs only every decimation cycles, and the velocities it planned in its last run are applied
+ * to the path in the other cycles. The other plugins always run.
+ */
+struct ProcessingTimeBudgetParam
+{
+  bool enable{false};
+  double budget_ms{0.0};
+  int overrun_count_threshold{1};
+  int decimation{1};
+  std::vector<std::string> decimatable_modules;
+};
+
 class BehaviorVelocityPlannerManager
 {
 public:
@@ -53,9 +69,34 @@ public:
     const autoware_auto_planning_msgs::msg::PathWithLaneId & input_path_msg);
 
   diagnostic_msgs::msg::DiagnosticStatus getStopReasonDiag() const;
+  diagnostic_msgs::msg::DiagnosticStatus getProcessingTimeBudgetDiag() const;
+
+  void setEnableParallelModuleUpdate(const bool enable) { enable_parallel_module_update_ = enable; }
+  void setProcessingTimeBudgetParam(const ProcessingTimeBudgetParam & param)
+  {
+    processing_time_budget_param_ = param;
+  }
 
 private:
+  struct PluginProcessingTime
+  {
+    double processing_time_ms{0.0};
+    int overrun_count{0};
+    int skipped_count{0};
+    bool is_skipped{false};
+    autoware_auto_planning_msgs::msg::PathWithLaneId last_output_path;
+  };
+
+  bool isDecimatable(const std::string & module_name) const;
+  bool shouldSkip(const std::string & module_name);
+  void updateProcessingTime(
+    const std::string & module_name, const double processing_time_ms,
+    const autoware_auto_planning_msgs::msg::PathWithLaneId & output_path);
+
   diagnostic_msgs::msg::DiagnosticStatus stop_reason_diag_;
+  bool enable_parallel_module_update_{false};
+  ProcessingTimeBudgetParam processing_time_budget_param_;
+  std::unordered_map<std::string, PluginProcessingTime> plugin_processing_times_;
   pluginlib::ClassLoader<PluginInterface> plugin_loader_;
   std::vector<std::shared_ptr<PluginInterface>> scene_manager_plugins_;
 };
@@ -108,8 +108,15 @@ OptimizationTrajectoryBasedCenterline::generate_centerline_with_optimization(
   pub_raw_path_->publish(raw_path);
   RCLCPP_INFO(node.get_logger(), "Converted to path and published.");
 
+  if (!prev_optimized_traj_points_.empty() && raw_path == prev_raw_path_) {
+    RCLCPP_INFO(node.get_logger(), "Reused the previously optimized trajectory.");
+    return prev_optimized_traj_points_;
+  }
+
   // smooth trajectory and road collision avoidance
   const auto optimized_traj_points = optimize_trajectory(raw_path);
+  prev_raw_path_ = raw_path;
+  prev_optimized_traj_points_ = optimized_traj_points;
   RCLCPP_INFO(
     node.get_logger(),
     "Smoothed trajectory and made it collision free with the road and published.");
@@ -168,16 +175,13 @@ std::vector<TrajectoryPoint> OptimizationTrajectoryBasedCenterline::optimize_tra
       const double dist = tier4_autoware_utils::calcDistance2d(
         whole_optimized_traj_points.at(j), optimized_traj_points.front());
       if (dist < 0.5) {
-        const std::vector<TrajectoryPoint> extracted_whole_optimized_traj_points{
-          whole_optimized_traj_points.begin(),
-          whole_optimized_traj_points.begin() + std::max(j, 1UL) - 1};
-        whole_optimized_traj_points = extracted_whole_optimized_traj_points;
+        whole_optimized_traj_points.resize(std::max(j, 1UL) - 1);
         break;
       }
     }
-    for (size_t j = 0; j < optimized_traj_points.size(); ++j) {
-      whole_optimized_traj_points.push_back(optimized_traj_points.at(j));
-    }
+    whole_optimized_traj_points.insert(
+      whole_optimized_traj_points.end(), optimized_traj_points.begin(),
+      optimized_traj_points.end());
   }
 
   return whole_optimized_traj_points;
@@ -36,6 +36,11 @@ private:
 
   rclcpp::Publisher<PathWithLaneId>::SharedPtr pub_raw_path_with_lane_id_{nullptr};
   rclcpp::Publisher<Path>::SharedPtr pub_raw_path_{nullptr};
+
+  // NOTE: The last optimization result is reused when the raw path does not change, e.g. the same
+  //       route is requested again on the same map.
+  Path prev_raw_path_{};
+  std::vector<TrajectoryPoint> prev_optimized_traj_points_{};
 };
 }  // namespace autoware::static_centerline_generator
 // clang-format off
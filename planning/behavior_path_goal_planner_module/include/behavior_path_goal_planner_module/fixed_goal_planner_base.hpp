@@ -43,7 +43,10 @@ public:
     previous_module_output_ = previous_module_output;
   }
 
-  BehaviorModuleOutput getPreviousModuleOutput() const { return previous_module_output_; }
+  const BehaviorModuleOutput & getPreviousModuleOutput() const
+  {
+    return previous_module_output_;
+  }
 
 protected:
   BehaviorModuleOutput previous_module_output_;
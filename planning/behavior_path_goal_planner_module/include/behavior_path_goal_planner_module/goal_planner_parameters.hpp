@@ -88,6 +88,7 @@ struct GoalPlannerParameters
   double maximum_jerk{0.0};
   std::string path_priority;  // "efficient_path" or "close_goal"
   std::vector<std::string> efficient_path_order{};
+  bool enable_parallel_planning{false};
 
   // shift path
   bool enable_shift_parking{false};
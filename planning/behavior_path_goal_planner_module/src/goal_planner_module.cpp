@@ -32,6 +32,7 @@
 #include <rclcpp/rclcpp.hpp>
 
 #include <algorithm>
+#include <future>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -263,12 +264,9 @@ void GoalPlannerModule::onTimer()
   std::vector<PullOverPath> path_candidates{};
   std::optional<Pose> closest_start_pose{};
   double min_start_arc_length = std::numeric_limits<double>::max();
-  const auto planCandidatePaths = [&](
-                                    const std::shared_ptr<PullOverPlannerBase> & planner,
-                                    const GoalCandidate & goal_candidate) {
-    planner->setPlannerData(local_planner_data);
-    planner->setPreviousModuleOutput(previous_module_output);
-    auto pull_over_path = planner->plan(goal_candidate.goal_pose);
+  const auto addCandidatePath = [&](
+                                  std::optional<PullOverPath> pull_over_path,
+                                  const GoalCandidate & goal_candidate) {
     if (pull_over_path) {
       pull_over_path->goal_id = goal_candidate.id;
       pull_over_path->id = path_candidates.size();
@@ -284,6 +282,13 @@ void GoalPlannerModule::onTimer()
     }
   };
 
+  if (parameters.path_priority != "efficient_path" && parameters.path_priority != "close_goal") {
+    RCLCPP_ERROR(
+      getLogger(), "path_priority should be efficient_path or close_goal, but %s is given.",
+      parameters.path_priority.c_str());
+    throw std::domain_error("[pull_over] invalid path_priority");
+  }
+
   // todo: currently non centerline input path is supported only by shift pull over
   const bool is_center_line_input_path = goal_planner_utils::isReferencePath(
     previous_module_output.reference_path, previous_module_output.path, 0.1);
@@ -291,32 +296,55 @@ void GoalPlannerModule::onTimer()
     getLogger(), "the input path of pull over planner is center line: %d",
     is_center_line_input_path);
 
-  // plan candidate paths and set them to the member variable
-  if (parameters.path_priority == "efficient_path") {
-    for (const auto & planner : pull_over_planners_) {
-      // todo: temporary skip NON SHIFT planner when input path is not center line
-      if (!is_center_line_input_path && planner->getPlannerType() != PullOverPlannerType::SHIFT) {
-        continue;
-      }
-      for (const auto & goal_candidate : goal_candidates) {
-        planCandidatePaths(planner, goal_candidate);
-      }
+  // plan the paths to all goal candidates with a planner. a planner keeps its state while planning,
+  // so each planner is used by only one thread.
+  const auto planCandidatePaths = [&](const std::shared_ptr<PullOverPlannerBase> & planner) {
+    std::vector<std::optional<PullOverPath>> pull_over_paths{};
+    // todo: temporary skip NON SHIFT planner when input path is not center line
+    if (!is_center_line_input_path && planner->getPlannerType() != PullOverPlannerType::SHIFT) {
+      return pull_over_paths;
     }
-  } else if (parameters.path_priority == "close_goal") {
+    planner->setPlannerData(local_planner_data);
+    planner->setPreviousModuleOutput(previous_module_output);
+    pull_over_paths.reserve(goal_candidates.size());
     for (const auto & goal_candidate : goal_candidates) {
-      for (const auto & planner : pull_over_planners_) {
-        // todo: temporary skip NON SHIFT planner when input path is not center line
-        if (!is_center_line_input_path && planner->getPlannerType() != PullOverPlannerType::SHIFT) {
-          continue;
-        }
-        planCandidatePaths(planner, goal_candidate);
+      pull_over_paths.push_back(planner->plan(goal_candidate.goal_pose));
+    }
+    return pull_over_paths;
+  };
+  std::vector<std::vector<std::optional<PullOverPath>>> planned_paths{};
+  if (parameters.enable_parallel_planning && pull_over_planners_.size() > 1) {
+    std::vector<std::future<std::vector<std::optional<PullOverPath>>>> futures{};
+    for (const auto & planner : pull_over_planners_) {
+      futures.push_back(std::async(std::launch::async, planCandidatePaths, planner));
+    }
+    for (auto & future : futures) {
+      planned_paths.push_back(future.get());
+    }
+  } else {
+    for (const auto & planner : pull_over_planners_) {
+      planned_paths.push_back(planCandidatePaths(planner));
+    }
+  }
+
+  // set the candidate paths in the order of the path priority. the skipped planner has no paths.
+  const auto addPlannedPath = [&](const size_t planner_idx, const size_t goal_idx) {
+    if (!planned_paths.at(planner_idx).empty()) {
+      addCandidatePath(planned_paths.at(planner_idx).at(goal_idx), goal_candidates.at(goal_idx));
+    }
+  };
+  if (parameters.path_priority == "efficient_path") {
+    for (size_t planner_idx = 0; planner_idx < planned_paths.size(); ++planner_idx) {
+      for (size_t goal_idx = 0; goal_idx < goal_candidates.size(); ++goal_idx) {
+        addPlannedPath(planner_idx, goal_idx);
       }
     }
   } else {
-    RCLCPP_ERROR(
-      getLogger(), "path_priority should be efficient_path or close_goal, but %s is given.",
-      parameters.path_priority.c_str());
-    throw std::domain_error("[pull_over] invalid path_priority");
+    for (size_t goal_idx = 0; goal_idx < goal_candidates.size(); ++goal_idx) {
+      for (size_t planner_idx = 0; planner_idx < planned_paths.size(); ++planner_idx) {
+        addPlannedPath(planner_idx, goal_idx);
+      }
+    }
   }
 
   // set member variables
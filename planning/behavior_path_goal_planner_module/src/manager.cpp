@@ -136,6 +136,7 @@ void GoalPlannerModuleManager::init(rclcpp::Node * node)
     p.path_priority = node->declare_parameter<std::string>(ns + "path_priority");
     p.efficient_path_order =
       node->declare_parameter<std::vector<std::string>>(ns + "efficient_path_order");
+    p.enable_parallel_planning = node->declare_parameter<bool>(ns + "enable_parallel_planning");
   }
 
   // shift parking
@@ -512,6 +513,7 @@ void GoalPlannerModuleManager::updateModuleParams(
     updateParam<std::string>(parameters, ns + "path_priority", p->path_priority);
     updateParam<std::vector<std::string>>(
       parameters, ns + "efficient_path_order", p->efficient_path_order);
+    updateParam<bool>(parameters, ns + "enable_parallel_planning", p->enable_parallel_planning);
   }
 
   // shift parking
@@ -90,6 +90,7 @@ struct LaneChangeParameters
   double prediction_time_resolution{0.5};
   int longitudinal_acc_sampling_num{10};
   int lateral_acc_sampling_num{10};
+  int safety_check_batch_size{1};
 
   // lane change parameters
   double backward_length_buffer_for_end_of_lane;
@@ -50,6 +50,8 @@ void LaneChangeModuleManager::initParams(rclcpp::Node * node)
     getOrDeclareParameter<int>(*node, parameter("longitudinal_acceleration_sampling_num"));
   p.lateral_acc_sampling_num =
     getOrDeclareParameter<int>(*node, parameter("lateral_acceleration_sampling_num"));
+  p.safety_check_batch_size =
+    getOrDeclareParameter<int>(*node, parameter("safety_check_batch_size"));
 
   // parked vehicle detection
   p.object_check_min_road_shoulder_width =
@@ -239,6 +241,15 @@ void LaneChangeModuleManager::initParams(rclcpp::Node * node)
     exit(EXIT_FAILURE);
   }
 
+  if (p.safety_check_batch_size < 1) {
+    RCLCPP_FATAL_STREAM(
+      node->get_logger().get_child(name()),
+      "safety_check_batch_size must be positive integer. Given parameter: "
+        << p.safety_check_batch_size << std::endl
+        << "Terminating the program...");
+    exit(EXIT_FAILURE);
+  }
+
   // validation of safety check parameters
   // if loosely check is not allowed, lane change module will keep on chattering and canceling, and
   // false positive situation might  occur
@@ -30,8 +30,10 @@
 #include <lanelet2_core/geometry/Polygon.h>
 
 #include <algorithm>
+#include <future>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -1364,11 +1366,102 @@ bool NormalLaneChange::getLaneChangePaths(
     return false;
   }
 
+  const auto target_lane_polygon =
+    lanelet::utils::getPolygonFromArcLength(target_lanes, 0, std::numeric_limits<double>::max());
+  const auto target_lane_poly_2d = lanelet::utils::to2D(target_lane_polygon).basicPolygon();
+
   const auto filtered_objects = filterObjects(current_lanes, target_lanes);
   const auto target_objects = getTargetObjects(filtered_objects, current_lanes);
 
   const auto prepare_durations = calcPrepareDuration(current_lanes, target_lanes);
 
+  // NOTE: the candidates are evaluated in batches, and the first decisive one in the sampling order
+  // is taken as the sequential evaluation does. without the safety check, the first candidate is
+  // decisive.
+  const size_t batch_size =
+    check_safety ? static_cast<size_t>(lane_change_parameters_->safety_check_batch_size) : 1;
+  std::vector<size_t> batch_indices;
+  batch_indices.reserve(batch_size);
+
+  enum class CandidateResult { PARKED_OBJECT, ACCEPTED_WITHOUT_CHECK, SAFE, UNSAFE };
+  const auto evaluate_candidate =
+    [&](const LaneChangePath & candidate_path, CollisionCheckDebugMap & debug_data) {
+      if (
+        !is_stuck &&
+        utils::lane_change::passParkedObject(
+          route_handler, candidate_path, filtered_objects.target_lane, lane_change_buffer,
+          is_goal_in_route, *lane_change_parameters_, debug_data)) {
+        return CandidateResult::PARKED_OBJECT;
+      }
+
+      if (!check_safety) {
+        return CandidateResult::ACCEPTED_WITHOUT_CHECK;
+      }
+
+      const auto [is_safe, is_object_coming_from_rear] =
+        isLaneChangePathSafe(candidate_path, target_objects, rss_params, debug_data);
+      return is_safe ? CandidateResult::SAFE : CandidateResult::UNSAFE;
+    };
+
+  // evaluate the candidates in the batch, and return the result of the first decisive one.
+  const auto evaluate_batch = [&]() -> std::optional<bool> {
+    std::vector<CandidateResult> results(batch_indices.size());
+    std::vector<CollisionCheckDebugMap> debug_data(batch_indices.size());
+    if (batch_indices.size() == 1) {
+      results.front() =
+        evaluate_candidate(candidate_paths->at(batch_indices.front()), debug_data.front());
+    } else {
+      std::vector<std::future<CandidateResult>> futures;
+      for (size_t i = 0; i < batch_indices.size(); ++i) {
+        futures.push_back(std::async(std::launch::async, [&, i]() {
+          return evaluate_candidate(candidate_paths->at(batch_indices.at(i)), debug_data.at(i));
+        }));
+      }
+      for (size_t i = 0; i < futures.size(); ++i) {
+        results.at(i) = futures.at(i).get();
+      }
+    }
+
+    std::optional<bool> decision{std::nullopt};
+    size_t num_evaluated = 0;
+    for (size_t i = 0; i < results.size() && !decision; ++i) {
+      ++num_evaluated;
+      for (const auto & debug : debug_data.at(i)) {
+        lane_change_debug_.collision_check_objects[debug.first] = debug.second;
+      }
+
+      switch (results.at(i)) {
+        case CandidateResult::PARKED_OBJECT:
+          RCLCPP_DEBUG(
+            logger_,
+            "Reject: parking vehicle exists in the target lane, and the ego is not in stuck. Skip "
+            "lane change.");
+          decision = false;
+          break;
+        case CandidateResult::ACCEPTED_WITHOUT_CHECK:
+          RCLCPP_DEBUG(logger_, "ACCEPT!!!: it is valid (and safety check is skipped).");
+          decision = false;
+          break;
+        case CandidateResult::SAFE:
+          RCLCPP_DEBUG(logger_, "ACCEPT!!!: it is valid and safe!");
+          decision = true;
+          break;
+        case CandidateResult::UNSAFE:
+          RCLCPP_DEBUG(logger_, "Reject: sampled path is not safe.");
+          break;
+      }
+    }
+
+    // the candidates after the decisive one are not the results of the sampling
+    if (decision) {
+      candidate_paths->erase(
+        candidate_paths->end() - static_cast<int>(batch_indices.size() - num_evaluated),
+        candidate_paths->end());
+    }
+    batch_indices.clear();
+    return decision;
+  };
+
   candidate_paths->reserve(
     longitudinal_acc_sampling_values.size() * lateral_acc_sampling_num * prepare_durations.size());
 
@@ -1494,10 +1587,6 @@ bool NormalLaneChange::getLaneChangePaths(
           prepare_segment.points.back().point.pose.position.x,
           prepare_segment.points.back().point.pose.position.y);
 
-        const auto target_lane_polygon = lanelet::utils::getPolygonFromArcLength(
-          target_lanes, 0, std::numeric_limits<double>::max());
-        const auto target_lane_poly_2d = lanelet::utils::to2D(target_lane_polygon).basicPolygon();
-
         const auto is_valid_start_point =
           boost::geometry::covered_by(lc_start_point, target_neighbor_preferred_lane_poly_2d) ||
           boost::geometry::covered_by(lc_start_point, target_lane_poly_2d);
@@ -1587,37 +1676,26 @@ bool NormalLaneChange::getLaneChangePaths(
           debug_print("Ego is stopping near traffic light. Do not allow lane change");
           continue;
         }
+        batch_indices.push_back(candidate_paths->size());
         candidate_paths->push_back(*candidate_path);
 
-        if (
-          !is_stuck && utils::lane_change::passParkedObject(
-                         route_handler, *candidate_path, filtered_objects.target_lane,
-                         lane_change_buffer, is_goal_in_route, *lane_change_parameters_,
-                         lane_change_debug_.collision_check_objects)) {
-          debug_print(
-            "Reject: parking vehicle exists in the target lane, and the ego is not in stuck. Skip "
-            "lane change.");
-          return false;
-        }
-
-        if (!check_safety) {
-          debug_print("ACCEPT!!!: it is valid (and safety check is skipped).");
-          return false;
+        if (batch_indices.size() < batch_size) {
+          continue;
         }
 
-        const auto [is_safe, is_object_coming_from_rear] = isLaneChangePathSafe(
-          *candidate_path, target_objects, rss_params, lane_change_debug_.collision_check_objects);
-
-        if (is_safe) {
-          debug_print("ACCEPT!!!: it is valid and safe!");
-          return true;
+        if (const auto decision = evaluate_batch()) {
+          return *decision;
         }
-
-        debug_print("Reject: sampled path is not safe.");
       }
     }
   }
 
+  if (!batch_indices.empty()) {
+    if (const auto decision = evaluate_batch()) {
+      return *decision;
+    }
+  }
+
   RCLCPP_DEBUG(logger_, "No safety path found.");
   return false;
 }
@@ -2220,13 +2298,14 @@ bool NormalLaneChange::check_prepare_phase() const
   const auto check_in_general_lanes =
     lane_change_parameters_->enable_collision_check_for_prepare_phase_in_general_lanes;
 
-  lanelet::ConstLanelet current_lane;
-  if (!route_handler->getClosestLaneletWithinRoute(getEgoPose(), &current_lane)) {
+  const auto current_lane_opt = utils::getClosestLaneletWithinRoute(planner_data_);
+  if (!current_lane_opt) {
     RCLCPP_DEBUG(
       logger_, "Unable to get current lane. Default to %s.",
       (check_in_general_lanes ? "true" : "false"));
     return check_in_general_lanes;
   }
+  const auto & current_lane = *current_lane_opt;
 
   const auto ego_footprint = utils::lane_change::getEgoCurrentFootprint(getEgoPose(), vehicle_info);
 
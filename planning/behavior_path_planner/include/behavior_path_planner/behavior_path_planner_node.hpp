@@ -19,6 +19,7 @@
 #include "behavior_path_planner_common/data_manager.hpp"
 #include "behavior_path_planner_common/interface/scene_module_interface.hpp"
 #include "behavior_path_planner_common/interface/steering_factor_interface.hpp"
+#include "tier4_autoware_utils/ros/latest_value_mailbox.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
 
 #include <tier4_autoware_utils/ros/published_time_publisher.hpp>
@@ -43,6 +44,8 @@
 #include <tier4_planning_msgs/msg/velocity_limit.hpp>
 #include <visualization_msgs/msg/marker.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -66,6 +69,7 @@ using nav_msgs::msg::OccupancyGrid;
 using nav_msgs::msg::Odometry;
 using rcl_interfaces::msg::SetParametersResult;
 using steering_factor_interface::SteeringFactorInterface;
+using tier4_autoware_utils::LatestValueMailbox;
 using tier4_planning_msgs::msg::AvoidanceDebugMsgArray;
 using tier4_planning_msgs::msg::LateralOffset;
 using tier4_planning_msgs::msg::RerouteAvailability;
@@ -118,15 +122,16 @@ private:
   std::unique_ptr<SteeringFactorInterface> steering_factor_interface_ptr_;
   Scenario::SharedPtr current_scenario_{nullptr};
 
-  HADMapBin::ConstSharedPtr map_ptr_{nullptr};
-  LaneletRoute::ConstSharedPtr route_ptr_{nullptr};
-  bool has_received_map_{false};
-  bool has_received_route_{false};
+  LatestValueMailbox<HADMapBin> map_mailbox_;
+  LatestValueMailbox<LaneletRoute> route_mailbox_;
 
   std::mutex mutex_pd_;       // mutex for planner_data_
   std::mutex mutex_manager_;  // mutex for bt_manager_ or planner_manager_
-  std::mutex mutex_map_;      // mutex for has_received_map_ and map_ptr_
-  std::mutex mutex_route_;    // mutex for has_received_route_ and route_ptr_
+  std::mutex mutex_run_;      // mutex for run(), which is called by the timer and the perception
+
+  bool trigger_by_perception_{false};
+  std::chrono::nanoseconds planning_period_{};
+  std::atomic<int64_t> last_run_time_ns_{0};  // steady clock
 
   // setup
   bool isDataReady();
@@ -157,6 +162,11 @@ private:
    */
   void run();
 
+  /**
+   * @brief run() unless it is running in another thread, warning when it overruns the period
+   */
+  void runExclusively();
+
   /**
    * @brief extract path from behavior tree output
    */
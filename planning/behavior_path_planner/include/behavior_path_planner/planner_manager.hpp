@@ -96,7 +96,9 @@ struct SceneModuleStatus
 class PlannerManager
 {
 public:
-  PlannerManager(rclcpp::Node & node, const size_t max_iteration_num);
+  PlannerManager(
+    rclcpp::Node & node, const size_t max_iteration_num,
+    const bool enable_parallel_candidate_modules = false);
 
   /**
    * @brief run all candidate and approved modules.
@@ -277,7 +279,8 @@ private:
     const SceneModulePtr & module_ptr, const std::shared_ptr<PlannerData> & planner_data,
     const BehaviorModuleOutput & previous_module_output) const
   {
-    stop_watch_.tic(module_ptr->name());
+    // NOTE: a local stop watch is used, since the candidate modules may run concurrently
+    StopWatch<std::chrono::milliseconds> stop_watch;
 
     module_ptr->setData(planner_data);
     module_ptr->setPreviousModuleOutput(previous_module_output);
@@ -294,7 +297,7 @@ private:
 
     module_ptr->publishObjectsOfInterestMarker();
 
-    processing_time_.at(module_ptr->name()) += stop_watch_.toc(module_ptr->name(), true);
+    processing_time_.at(module_ptr->name()) += stop_watch.toc();
 
     return result;
   }
@@ -430,6 +433,19 @@ private:
     const std::vector<SceneModulePtr> & request_modules, const std::shared_ptr<PlannerData> & data,
     const BehaviorModuleOutput & previous_module_output);
 
+  /**
+   * @brief run the executable candidate modules and get their planning results.
+   * @details if enable_parallel_candidate_modules_ is true, the modules of different managers run
+   * concurrently. the modules of the same manager share it, so they run in series.
+   * @param executable modules.
+   * @param planner data.
+   * @param previous module output.
+   * @return planning result of each module.
+   */
+  std::unordered_map<std::string, BehaviorModuleOutput> runExecutableModules(
+    const std::vector<SceneModulePtr> & executable_modules,
+    const std::shared_ptr<PlannerData> & data, const BehaviorModuleOutput & previous_module_output);
+
   /**
    * @brief run keep last approved modules
    * @param planner data.
@@ -443,6 +459,10 @@ private:
 
   std::optional<lanelet::ConstLanelet> current_route_lanelet_{std::nullopt};
 
+  bool enable_parallel_candidate_modules_{false};
+
+  std::shared_ptr<PlanningContextCache> context_cache_{std::make_shared<PlanningContextCache>()};
+
   std::vector<SceneModuleManagerPtr> manager_ptrs_;
 
   std::vector<SceneModulePtr> approved_module_ptrs_;
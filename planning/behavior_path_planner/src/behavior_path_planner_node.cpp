@@ -133,7 +133,8 @@ BehaviorPathPlannerNode::BehaviorPathPlannerNode(const rclcpp::NodeOptions & nod
     const std::lock_guard<std::mutex> lock(mutex_manager_);  // for planner_manager_
 
     const auto & p = planner_data_->parameters;
-    planner_manager_ = std::make_shared<PlannerManager>(*this, p.max_iteration_num);
+    planner_manager_ = std::make_shared<PlannerManager>(
+      *this, p.max_iteration_num, p.enable_parallel_candidate_modules);
 
     for (const auto & name : declare_parameter<std::vector<std::string>>("launch_modules")) {
       // workaround: Since ROS 2 can't get empty list, launcher set [''] on the parameter.
@@ -171,9 +172,17 @@ BehaviorPathPlannerNode::BehaviorPathPlannerNode(const rclcpp::NodeOptions & nod
   // Start timer
   {
     const auto planning_hz = declare_parameter<double>("planning_hz");
-    const auto period_ns = rclcpp::Rate(planning_hz).period();
-    timer_ = rclcpp::create_timer(
-      this, get_clock(), period_ns, std::bind(&BehaviorPathPlannerNode::run, this));
+    trigger_by_perception_ = declare_parameter<bool>("trigger_by_perception");
+    planning_period_ = rclcpp::Rate(planning_hz).period();
+    // NOTE: When the planning is triggered by the perception, the timer is kept as the fallback
+    //       for the case the predicted objects stop, so that the path is still updated.
+    timer_ = rclcpp::create_timer(this, get_clock(), planning_period_, [this]() {
+      const auto now_ns = std::chrono::steady_clock::now().time_since_epoch().count();
+      if (trigger_by_perception_ && now_ns - last_run_time_ns_ < planning_period_.count()) {
+        return;
+      }
+      runExclusively();
+    });
   }
 
   logger_configure_ = std::make_unique<tier4_autoware_utils::LoggerLevelConfigure>(this);
@@ -209,6 +218,8 @@ BehaviorPathPlannerParameters BehaviorPathPlannerNode::getCommonParam()
   BehaviorPathPlannerParameters p{};
 
   p.max_iteration_num = declare_parameter<int>("max_iteration_num");
+  p.enable_parallel_candidate_modules =
+    declare_parameter<bool>("enable_parallel_candidate_modules");
   p.traffic_light_signal_timeout = declare_parameter<double>("traffic_light_signal_timeout");
 
   // vehicle info
@@ -286,18 +297,12 @@ bool BehaviorPathPlannerNode::isDataReady()
     return missing("scenario_topic");
   }
 
-  {
-    std::lock_guard<std::mutex> lk_route(mutex_route_);
-    if (!route_ptr_) {
-      return missing("route");
-    }
+  if (!route_mailbox_.load()) {
+    return missing("route");
   }
 
-  {
-    std::lock_guard<std::mutex> lk_map(mutex_map_);
-    if (!map_ptr_) {
-      return missing("map");
-    }
+  if (!map_mailbox_.load()) {
+    return missing("map");
   }
 
   const std::lock_guard<std::mutex> lock(mutex_pd_);  // for planner_data_
@@ -325,6 +330,26 @@ bool BehaviorPathPlannerNode::isDataReady()
   return true;
 }
 
+void BehaviorPathPlannerNode::runExclusively()
+{
+  std::unique_lock<std::mutex> lock(mutex_run_, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    return;
+  }
+
+  const auto start_time = std::chrono::steady_clock::now();
+  last_run_time_ns_ = start_time.time_since_epoch().count();
+  run();
+
+  const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+  if (elapsed_time > planning_period_) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 5000, "planning took %.1f [ms], over the period %.1f [ms]",
+      std::chrono::duration<double, std::milli>(elapsed_time).count(),
+      std::chrono::duration<double, std::milli>(planning_period_).count());
+  }
+}
+
 void BehaviorPathPlannerNode::run()
 {
   if (!isDataReady()) {
@@ -339,26 +364,11 @@ void BehaviorPathPlannerNode::run()
   }
 
   // check for map update
-  HADMapBin::ConstSharedPtr map_ptr{nullptr};
-  {
-    std::lock_guard<std::mutex> lk_map(mutex_map_);  // for has_received_map_ and map_ptr_
-    if (has_received_map_) {
-      // Note: duplicating the shared_ptr prevents the data from being deleted by another thread!
-      map_ptr = map_ptr_;
-      has_received_map_ = false;
-    }
-  }
+  // Note: the taken shared_ptr prevents the data from being deleted by another thread!
+  const HADMapBin::ConstSharedPtr map_ptr = map_mailbox_.takeNew();
 
   // check for route update
-  LaneletRoute::ConstSharedPtr route_ptr{nullptr};
-  {
-    std::lock_guard<std::mutex> lk_route(mutex_route_);  // for has_received_route_ and route_ptr_
-    if (has_received_route_) {
-      // Note: duplicating the shared_ptr prevents the data from being deleted by another thread!
-      route_ptr = route_ptr_;
-      has_received_route_ = false;
-    }
-  }
+  const LaneletRoute::ConstSharedPtr route_ptr = route_mailbox_.takeNew();
 
   std::unique_lock<std::mutex> lk_pd(mutex_pd_);  // for planner_data_
 
@@ -732,17 +742,17 @@ PathWithLaneId::SharedPtr BehaviorPathPlannerNode::getPath(
 {
   // TODO(Horibe) do some error handling when path is not available.
 
-  auto path = !output.path.points.empty() ? std::make_shared<PathWithLaneId>(output.path)
-                                          : planner_data->prev_output_path;
-  path->header = planner_data->route_handler->getRouteHeader();
-  path->header.stamp = this->now();
+  // NOTE: the output path is resampled as it is, instead of its copy
+  const auto & path =
+    !output.path.points.empty() ? output.path : *planner_data->prev_output_path;
 
-  PathWithLaneId connected_path;
   const auto module_status_ptr_vec = planner_manager->getSceneModuleStatus();
 
-  const auto resampled_path = utils::resamplePathWithSpline(
-    *path, planner_data->parameters.output_path_interval, keepInputPoints(module_status_ptr_vec));
-  return std::make_shared<PathWithLaneId>(resampled_path);
+  auto resampled_path = utils::resamplePathWithSpline(
+    path, planner_data->parameters.output_path_interval, keepInputPoints(module_status_ptr_vec));
+  resampled_path.header = planner_data->route_handler->getRouteHeader();
+  resampled_path.header.stamp = this->now();
+  return std::make_shared<PathWithLaneId>(std::move(resampled_path));
 }
 
 // This is a temporary process until motion planning can take the terminal pose into account
@@ -777,8 +787,13 @@ void BehaviorPathPlannerNode::onAcceleration(const AccelWithCovarianceStamped::C
 }
 void BehaviorPathPlannerNode::onPerception(const PredictedObjects::ConstSharedPtr msg)
 {
-  const std::lock_guard<std::mutex> lock(mutex_pd_);
-  planner_data_->dynamic_object = msg;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_pd_);
+    planner_data_->dynamic_object = msg;
+  }
+  if (trigger_by_perception_) {
+    runExclusively();
+  }
 }
 void BehaviorPathPlannerNode::onOccupancyGrid(const OccupancyGrid::ConstSharedPtr msg)
 {
@@ -804,9 +819,7 @@ void BehaviorPathPlannerNode::onTrafficSignals(const TrafficSignalArray::ConstSh
 }
 void BehaviorPathPlannerNode::onMap(const HADMapBin::ConstSharedPtr msg)
 {
-  const std::lock_guard<std::mutex> lock(mutex_map_);
-  map_ptr_ = msg;
-  has_received_map_ = true;
+  map_mailbox_.store(msg);
 }
 void BehaviorPathPlannerNode::onRoute(const LaneletRoute::ConstSharedPtr msg)
 {
@@ -815,9 +828,7 @@ void BehaviorPathPlannerNode::onRoute(const LaneletRoute::ConstSharedPtr msg)
     return;
   }
 
-  const std::lock_guard<std::mutex> lock(mutex_route_);
-  route_ptr_ = msg;
-  has_received_route_ = true;
+  route_mailbox_.store(msg);
 }
 void BehaviorPathPlannerNode::onOperationMode(const OperationModeState::ConstSharedPtr msg)
 {
@@ -897,6 +908,9 @@ SetParametersResult BehaviorPathPlannerNode::onSetParam(
     updateParam(
       parameters, DrivableAreaExpansionParameters::AVOID_LINESTRING_DIST_PARAM,
       planner_data_->drivable_area_expansion_parameters.avoid_linestring_dist);
+    updateParam(
+      parameters, DrivableAreaExpansionParameters::AVOID_LINESTRING_REUSE_PARAM,
+      planner_data_->drivable_area_expansion_parameters.reuse_avoid_linestring_distances);
     updateParam(
       parameters, DrivableAreaExpansionParameters::EGO_EXTRA_FRONT_OVERHANG,
       planner_data_->drivable_area_expansion_parameters.extra_front_overhang);
@@ -25,15 +25,22 @@
 
 #include <boost/format.hpp>
 
+#include <deque>
+#include <future>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace behavior_path_planner
 {
-PlannerManager::PlannerManager(rclcpp::Node & node, const size_t max_iteration_num)
+PlannerManager::PlannerManager(
+  rclcpp::Node & node, const size_t max_iteration_num, const bool enable_parallel_candidate_modules)
 : plugin_loader_("behavior_path_planner", "behavior_path_planner::SceneModuleManagerInterface"),
   logger_(node.get_logger().get_child("planner_manager")),
   clock_(*node.get_clock()),
+  enable_parallel_candidate_modules_{enable_parallel_candidate_modules},
   max_iteration_num_{max_iteration_num}
 {
   processing_time_.emplace("total_time", 0.0);
@@ -87,6 +94,10 @@ BehaviorModuleOutput PlannerManager::run(const std::shared_ptr<PlannerData> & da
   stop_watch_.tic("total_time");
   debug_info_.clear();
 
+  // the values derived from the planner data are computed once in this cycle
+  context_cache_->reset(data.get());
+  data->context_cache = context_cache_;
+
   if (!current_route_lanelet_) resetCurrentRouteLanelet(data);
 
   std::for_each(
@@ -138,7 +149,7 @@ BehaviorModuleOutput PlannerManager::run(const std::shared_ptr<PlannerData> & da
        * STEP3: if there is no module that need to be launched, return approved modules' output
        */
       if (request_modules.empty()) {
-        const auto output = runKeepLastModules(data, approved_modules_output);
+        auto output = runKeepLastModules(data, approved_modules_output);
         processing_time_.at("total_time") = stop_watch_.toc("total_time", true);
         return output;
       }
@@ -154,7 +165,7 @@ BehaviorModuleOutput PlannerManager::run(const std::shared_ptr<PlannerData> & da
        * NOTE: if no candidate module is launched, approved_modules_output used as input for keep
        * last modules and return the result immediately.
        */
-      const auto output = runKeepLastModules(
+      auto output = runKeepLastModules(
         data, highest_priority_module ? candidate_modules_output : approved_modules_output);
       if (!highest_priority_module) {
         processing_time_.at("total_time") = stop_watch_.toc("total_time", true);
@@ -401,6 +412,55 @@ std::vector<SceneModulePtr> PlannerManager::getRequestModules(
   return request_modules;
 }
 
+std::unordered_map<std::string, BehaviorModuleOutput> PlannerManager::runExecutableModules(
+  const std::vector<SceneModulePtr> & executable_modules, const std::shared_ptr<PlannerData> & data,
+  const BehaviorModuleOutput & previous_module_output)
+{
+  std::unordered_map<std::string, BehaviorModuleOutput> results;
+
+  if (!enable_parallel_candidate_modules_ || executable_modules.size() < 2) {
+    for (const auto & module_ptr : executable_modules) {
+      results.emplace(module_ptr->name(), run(module_ptr, data, previous_module_output));
+    }
+    return results;
+  }
+
+  // group the modules by their managers, keeping the priority order in each group.
+  std::vector<std::vector<SceneModulePtr>> module_groups;
+  {
+    std::unordered_map<SceneModuleManagerPtr, size_t> group_index;
+    for (const auto & module_ptr : executable_modules) {
+      const auto [itr, is_new] = group_index.emplace(getManager(module_ptr), module_groups.size());
+      if (is_new) {
+        module_groups.emplace_back();
+      }
+      module_groups.at(itr->second).push_back(module_ptr);
+    }
+  }
+
+  std::vector<std::future<std::vector<std::pair<std::string, BehaviorModuleOutput>>>> futures;
+  for (const auto & modules : module_groups) {
+    futures.push_back(std::async(std::launch::async, [&, modules]() {
+      std::vector<std::pair<std::string, BehaviorModuleOutput>> group_results;
+      for (const auto & module_ptr : modules) {
+        group_results.emplace_back(
+          module_ptr->name(), run(module_ptr, data, previous_module_output));
+      }
+      return group_results;
+    }));
+  }
+
+  // NOTE: the results are collected in the order of the groups, so that it doesn't depend on the
+  // timing of the threads.
+  for (auto & future : futures) {
+    for (auto & [name, output] : future.get()) {
+      results.emplace(name, std::move(output));
+    }
+  }
+
+  return results;
+}
+
 BehaviorModuleOutput PlannerManager::runKeepLastModules(
   const std::shared_ptr<PlannerData> & data, const BehaviorModuleOutput & previous_output) const
 {
@@ -565,10 +625,10 @@ std::pair<SceneModulePtr, BehaviorModuleOutput> PlannerManager::runRequestModule
       manager_ptr->registerNewModule(
         std::weak_ptr<SceneModuleInterface>(module_ptr), previous_module_output);
     }
-
-    results.emplace(module_ptr->name(), run(module_ptr, data, previous_module_output));
   }
 
+  results = runExecutableModules(executable_modules, data, previous_module_output);
+
   /**
    * remove expired modules.
    */
@@ -634,17 +694,21 @@ std::pair<SceneModulePtr, BehaviorModuleOutput> PlannerManager::runRequestModule
    */
   updateCandidateModules(executable_modules, module_ptr);
 
-  return std::make_pair(module_ptr, results.at(module_ptr->name()));
+  return std::make_pair(module_ptr, std::move(results.at(module_ptr->name())));
 }
 
 BehaviorModuleOutput PlannerManager::runApprovedModules(const std::shared_ptr<PlannerData> & data)
 {
+  // NOTE: each module refers to the output of the previous one in results, instead of its copy,
+  // since the references to the elements of unordered_map are not invalidated by insertion. The
+  // outputs of the modules whose names are already in results are kept in unlisted_outputs.
   std::unordered_map<std::string, BehaviorModuleOutput> results;
-  BehaviorModuleOutput output = getReferencePath(data);
-  results.emplace("root", output);
+  std::deque<BehaviorModuleOutput> unlisted_outputs;
+  const BehaviorModuleOutput * output =
+    &results.emplace("root", getReferencePath(data)).first->second;
 
   if (approved_module_ptrs_.empty()) {
-    return output;
+    return std::move(results.at("root"));
   }
 
   // move modules whose keep last flag is true to end of the approved_module_ptrs_.
@@ -702,8 +766,12 @@ BehaviorModuleOutput PlannerManager::runApprovedModules(const std::shared_ptr<Pl
    */
   std::for_each(approved_module_ptrs_.begin(), approved_module_ptrs_.end(), [&](const auto & m) {
     if (!getManager(m)->isKeepLast()) {
-      output = run(m, data, output);
-      results.emplace(m->name(), output);
+      auto result = run(m, data, *output);
+      if (results.count(m->name()) == 0) {
+        output = &results.emplace(m->name(), std::move(result)).first->second;
+      } else {
+        output = &unlisted_outputs.emplace_back(std::move(result));
+      }
     }
   });
 
@@ -770,21 +838,21 @@ BehaviorModuleOutput PlannerManager::runApprovedModules(const std::shared_ptr<Pl
   }
 
   if (approved_module_ptrs_.empty()) {
-    return results.at("root");
+    return std::move(results.at("root"));
   }
 
   /**
    * use the last module's output as approved modules planning result.
    */
-  const auto approved_modules_output = [&results, this]() {
+  auto approved_modules_output = [&results, this]() {
     const auto itr = std::find_if(
       approved_module_ptrs_.rbegin(), approved_module_ptrs_.rend(),
       [&results](const auto & m) { return results.count(m->name()) != 0; });
 
     if (itr != approved_module_ptrs_.rend()) {
-      return results.at((*itr)->name());
+      return std::move(results.at((*itr)->name()));
     }
-    return results.at("root");
+    return std::move(results.at("root"));
   }();
 
   /**
@@ -16,8 +16,10 @@
 #define BEHAVIOR_PATH_PLANNER_COMMON__DATA_MANAGER_HPP_
 
 #include "behavior_path_planner_common/parameters.hpp"
+#include "behavior_path_planner_common/planning_context_cache.hpp"
 #include "behavior_path_planner_common/turn_signal_decider.hpp"
 #include "behavior_path_planner_common/utils/drivable_area_expansion/parameters.hpp"
+#include "behavior_path_planner_common/utils/drivable_area_expansion/types.hpp"
 #include "motion_utils/trajectory/trajectory.hpp"
 
 #include <lanelet2_extension/regulatory_elements/Forward.hpp>
@@ -167,8 +169,12 @@ struct PlannerData
 
   mutable std::vector<geometry_msgs::msg::Pose> drivable_area_expansion_prev_path_poses{};
   mutable std::vector<double> drivable_area_expansion_prev_curvatures{};
+  mutable drivable_area_expansion::LineDistanceCache drivable_area_expansion_line_distances{};
   mutable TurnSignalDecider turn_signal_decider;
 
+  // values shared by the scene modules in a cycle. it is reset by PlannerManager.
+  std::shared_ptr<PlanningContextCache> context_cache{};
+
   std::pair<TurnSignalInfo, bool> getBehaviorTurnSignalInfo(
     const PathWithLaneId & path, const size_t shift_start_idx, const size_t shift_end_idx,
     const lanelet::ConstLanelets & current_lanelets, const double current_shift_length,
@@ -266,11 +266,11 @@ public:
 
   PlanResult getPathReference() const { return path_reference_; }
 
-  MarkerArray getInfoMarkers() const { return info_marker_; }
+  const MarkerArray & getInfoMarkers() const { return info_marker_; }
 
-  MarkerArray getDebugMarkers() const { return debug_marker_; }
+  const MarkerArray & getDebugMarkers() const { return debug_marker_; }
 
-  MarkerArray getDrivableLanesMarkers() const { return drivable_lanes_marker_; }
+  const MarkerArray & getDrivableLanesMarkers() const { return drivable_lanes_marker_; }
 
   virtual MarkerArray getModuleVirtualWall() { return MarkerArray(); }
 
@@ -577,7 +577,10 @@ protected:
       marker_utils::createDrivableLanesMarkerArray(drivable_lanes, "drivable_lanes");
   }
 
-  BehaviorModuleOutput getPreviousModuleOutput() const { return previous_module_output_; }
+  const BehaviorModuleOutput & getPreviousModuleOutput() const
+  {
+    return previous_module_output_;
+  }
 
   bool isOutputPathLocked() const { return is_locked_output_path_; }
 
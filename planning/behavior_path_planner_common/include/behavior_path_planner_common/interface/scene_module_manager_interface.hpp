@@ -157,45 +157,69 @@ public:
   {
     using tier4_autoware_utils::appendMarkerArray;
 
+    // NOTE: the markers are collected only for the publishers with any subscriber, since they
+    //       are large and copied from every module in every cycle
+    const bool publish_info_markers = pub_info_marker_->get_subscription_count() > 0;
+    const bool publish_debug_markers = pub_debug_marker_->get_subscription_count() > 0;
+    const bool publish_drivable_lanes_markers = pub_drivable_lanes_->get_subscription_count() > 0;
+    if (!publish_info_markers && !publish_debug_markers && !publish_drivable_lanes_markers) {
+      return;
+    }
+
     MarkerArray info_markers{};
     MarkerArray debug_markers{};
     MarkerArray drivable_lanes_markers{};
 
     const auto marker_offset = std::numeric_limits<uint8_t>::max();
 
+    const auto append_markers = [](const MarkerArray & src, const uint32_t id, MarkerArray & dst) {
+      for (const auto & marker : src.markers) {
+        dst.markers.push_back(marker);
+        dst.markers.back().id += id;
+      }
+    };
+
     uint32_t marker_id = marker_offset;
     for (const auto & m : observers_) {
       if (m.expired()) {
         continue;
       }
 
-      for (auto & marker : m.lock()->getInfoMarkers().markers) {
-        marker.id += marker_id;
-        info_markers.markers.push_back(marker);
+      const auto module_ptr = m.lock();
+      if (publish_info_markers) {
+        append_markers(module_ptr->getInfoMarkers(), marker_id, info_markers);
       }
-
-      for (auto & marker : m.lock()->getDebugMarkers().markers) {
-        marker.id += marker_id;
-        debug_markers.markers.push_back(marker);
+      if (publish_debug_markers) {
+        append_markers(module_ptr->getDebugMarkers(), marker_id, debug_markers);
       }
-
-      for (auto & marker : m.lock()->getDrivableLanesMarkers().markers) {
-        marker.id += marker_id;
-        drivable_lanes_markers.markers.push_back(marker);
+      if (publish_drivable_lanes_markers) {
+        append_markers(module_ptr->getDrivableLanesMarkers(), marker_id, drivable_lanes_markers);
       }
 
       marker_id += marker_offset;
     }
 
     if (observers_.empty() && idle_module_ptr_ != nullptr) {
-      appendMarkerArray(idle_module_ptr_->getInfoMarkers(), &info_markers);
-      appendMarkerArray(idle_module_ptr_->getDebugMarkers(), &debug_markers);
-      appendMarkerArray(idle_module_ptr_->getDrivableLanesMarkers(), &drivable_lanes_markers);
+      if (publish_info_markers) {
+        appendMarkerArray(idle_module_ptr_->getInfoMarkers(), &info_markers);
+      }
+      if (publish_debug_markers) {
+        appendMarkerArray(idle_module_ptr_->getDebugMarkers(), &debug_markers);
+      }
+      if (publish_drivable_lanes_markers) {
+        appendMarkerArray(idle_module_ptr_->getDrivableLanesMarkers(), &drivable_lanes_markers);
+      }
     }
 
-    pub_info_marker_->publish(info_markers);
-    pub_debug_marker_->publish(debug_markers);
-    pub_drivable_lanes_->publish(drivable_lanes_markers);
+    if (publish_info_markers) {
+      pub_info_marker_->publish(info_markers);
+    }
+    if (publish_debug_markers) {
+      pub_debug_marker_->publish(debug_markers);
+    }
+    if (publish_drivable_lanes_markers) {
+      pub_drivable_lanes_->publish(drivable_lanes_markers);
+    }
   }
 
   bool exist(const SceneModulePtr & module_ptr) const
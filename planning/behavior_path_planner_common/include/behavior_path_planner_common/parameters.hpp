@@ -31,6 +31,7 @@ struct ModuleConfigParameters
 struct BehaviorPathPlannerParameters
 {
   size_t max_iteration_num{100};
+  bool enable_parallel_candidate_modules{false};
   double traffic_light_signal_timeout{1.0};
 
   double backward_path_length;
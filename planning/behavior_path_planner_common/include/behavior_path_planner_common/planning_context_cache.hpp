@@ -0,0 +1,122 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_PATH_PLANNER_COMMON__PLANNING_CONTEXT_CACHE_HPP_
+#define BEHAVIOR_PATH_PLANNER_COMMON__PLANNING_CONTEXT_CACHE_HPP_
+
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace behavior_path_planner
+{
+struct PlannerData;
+
+/**
+ * @brief values derived from the PlannerData, which are shared by the scene modules in a cycle
+ * @details PlannerManager resets the cache at the beginning of every cycle, and each value is
+ * computed at the first query in the cycle. Only the PlannerData bound by reset() hits the cache,
+ * since the copies of it made by the modules (e.g. for the background thread of start planner)
+ * may differ from it.
+ */
+class PlanningContextCache
+{
+public:
+  // the lane ids of a path and the ones of its front point
+  using PathLaneIds = std::pair<std::vector<lanelet::Id>, std::vector<lanelet::Id>>;
+
+  void reset(const PlannerData * planner_data)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    planner_data_ = planner_data;
+    closest_lanelet_within_route_.reset();
+    current_lanes_.reset();
+    current_lanes_from_path_.clear();
+  }
+
+  template <class Compute>
+  std::optional<lanelet::ConstLanelet> getClosestLaneletWithinRoute(
+    const PlannerData & planner_data, const Compute & compute)
+  {
+    return memoize(planner_data, closest_lanelet_within_route_, compute);
+  }
+
+  template <class Compute>
+  lanelet::ConstLanelets getCurrentLanes(const PlannerData & planner_data, const Compute & compute)
+  {
+    return memoize(planner_data, current_lanes_, compute);
+  }
+
+  template <class Compute>
+  lanelet::ConstLanelets getCurrentLanesFromPath(
+    const PlannerData & planner_data, const PathLaneIds & path_lane_ids, const Compute & compute)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (planner_data_ != &planner_data) {
+        return compute();
+      }
+      const auto itr = current_lanes_from_path_.find(path_lane_ids);
+      if (itr != current_lanes_from_path_.end()) {
+        return itr->second;
+      }
+    }
+
+    // NOTE: compute() may query the cache by itself, so it runs without the lock
+    auto value = compute();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (planner_data_ == &planner_data) {
+      current_lanes_from_path_.emplace(path_lane_ids, value);
+    }
+    return value;
+  }
+
+private:
+  template <class T, class Compute>
+  T memoize(const PlannerData & planner_data, std::optional<T> & slot, const Compute & compute)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (planner_data_ != &planner_data) {
+        return compute();
+      }
+      if (slot) {
+        return *slot;
+      }
+    }
+
+    // NOTE: compute() may query the cache by itself, so it runs without the lock
+    T value = compute();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (planner_data_ == &planner_data) {
+      slot = value;
+    }
+    return value;
+  }
+
+  std::mutex mutex_;
+  const PlannerData * planner_data_{nullptr};
+
+  std::optional<std::optional<lanelet::ConstLanelet>> closest_lanelet_within_route_;
+  std::optional<lanelet::ConstLanelets> current_lanes_;
+  std::map<PathLaneIds, lanelet::ConstLanelets> current_lanes_from_path_;
+};
+}  // namespace behavior_path_planner
+
+#endif  // BEHAVIOR_PATH_PLANNER_COMMON__PLANNING_CONTEXT_CACHE_HPP_
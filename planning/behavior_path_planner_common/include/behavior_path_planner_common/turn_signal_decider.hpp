@@ -38,7 +38,9 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace behavior_path_planner
 {
@@ -275,6 +277,19 @@ private:
   double intersection_search_time_{0.0};
   double intersection_angle_threshold_deg_{0.0};
   std::map<lanelet::Id, geometry_msgs::msg::Pose> desired_start_point_map_;
+
+  // consecutive lanes of the same turn direction combined from their front lane, which are kept
+  // until the route or the map changes
+  struct CombinedTurnLane
+  {
+    std::vector<lanelet::Id> lane_ids;
+    lanelet::ConstLanelet combined_lane;
+    lanelet::ConstLanelet front_lane;
+  };
+  std::unordered_map<lanelet::Id, CombinedTurnLane> combined_turn_lanes_;
+  std_msgs::msg::Header combined_turn_lanes_route_header_;
+  unique_identifier_msgs::msg::UUID combined_turn_lanes_route_uuid_;
+  lanelet::LaneletMapConstPtr combined_turn_lanes_map_ptr_{nullptr};
   mutable bool intersection_turn_signal_ = false;
   mutable bool approaching_intersection_turn_signal_ = false;
   mutable double intersection_distance_ = std::numeric_limits<double>::max();
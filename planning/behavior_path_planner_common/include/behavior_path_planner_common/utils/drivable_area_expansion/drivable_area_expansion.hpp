@@ -107,6 +107,25 @@ std::vector<double> calculate_maximum_distance(
   const std::vector<Polygon2d> & uncrossable_polygons,
   const DrivableAreaExpansionParameters & params, const Side side);
 
+/// @brief calculate the maximum distance by which a bound can be expanded, reusing the distances
+/// to the uncrossable lines calculated in the previous cycles
+/// @details the distance of a bound segment to the lines is reused if the lines not extracted
+/// around the ego point cannot be closer to it, in which case it does not depend on the ego point.
+/// @param [in] bound bound points
+/// @param [in] uncrossable_segments segments that limit the bound expansion, indexed in a Rtree
+/// @param [in] uncrossable_polygons polygons that limit the bound expansion
+/// @param [in] params parameters with the buffer distance to keep with lines,
+/// and the static maximum expansion distance
+/// @param [in] Side left or right side
+/// @param [in] ego_point point around which the uncrossable segments were extracted
+/// @param [inout] line_distances distances of the bound segments to the lines, updated with the
+/// ones of the given bound
+std::vector<double> calculate_maximum_distance(
+  const std::vector<Point> & bound, const SegmentRtree & uncrossable_lines,
+  const std::vector<Polygon2d> & uncrossable_polygons,
+  const DrivableAreaExpansionParameters & params, const Side side, const Point & ego_point,
+  LineDistanceCache::SegmentDistances & line_distances);
+
 /// @brief expand a bound by the given lateral distances away from the path
 /// @param [inout] bound bound points to expand
 /// @param [in] path_poses input path
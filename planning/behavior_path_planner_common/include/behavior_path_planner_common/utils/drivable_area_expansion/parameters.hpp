@@ -51,6 +51,8 @@ struct DrivableAreaExpansionParameters
   static constexpr auto AVOID_DYN_OBJECTS_PARAM = "dynamic_expansion.dynamic_objects.avoid";
   static constexpr auto AVOID_LINESTRING_TYPES_PARAM = "dynamic_expansion.avoid_linestring.types";
   static constexpr auto AVOID_LINESTRING_DIST_PARAM = "dynamic_expansion.avoid_linestring.distance";
+  static constexpr auto AVOID_LINESTRING_REUSE_PARAM =
+    "dynamic_expansion.avoid_linestring.reuse_distances";
   static constexpr auto SMOOTHING_CURVATURE_WINDOW_PARAM =
     "dynamic_expansion.smoothing.curvature_average_window";
   static constexpr auto SMOOTHING_MAX_BOUND_RATE_PARAM =
@@ -66,6 +68,7 @@ struct DrivableAreaExpansionParameters
   // dynamic expansion
   bool enabled = false;
   double avoid_linestring_dist{};
+  bool reuse_avoid_linestring_distances{};
   double extra_front_overhang{};
   double extra_wheelbase{};
   double extra_width{};
@@ -119,6 +122,7 @@ struct DrivableAreaExpansionParameters
       node.declare_parameter<std::vector<std::string>>(AVOID_LINESTRING_TYPES_PARAM);
     avoid_dynamic_objects = node.declare_parameter<bool>(AVOID_DYN_OBJECTS_PARAM);
     avoid_linestring_dist = node.declare_parameter<double>(AVOID_LINESTRING_DIST_PARAM);
+    reuse_avoid_linestring_distances = node.declare_parameter<bool>(AVOID_LINESTRING_REUSE_PARAM);
     print_runtime = node.declare_parameter<bool>(PRINT_RUNTIME_PARAM);
 
     vehicle_info = vehicle_info_util::VehicleInfoUtil(node).getVehicleInfo();
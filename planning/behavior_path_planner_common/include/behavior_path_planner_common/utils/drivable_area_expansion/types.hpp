@@ -24,7 +24,13 @@
 
 #include <boost/geometry/index/rtree.hpp>
 
+#include <lanelet2_core/Forward.h>
+
+#include <array>
+#include <cstdint>
+#include <map>
 #include <optional>
+#include <string>
 #include <vector>
 
 namespace drivable_area_expansion
@@ -70,5 +76,19 @@ struct Expansion
   std::vector<PointDistance> right_projections;
   std::vector<double> min_lane_widths;
 };
+/// @brief distances from the bound segments to the uncrossable lines of the map
+/// @details the distances are reused over the cycles as long as the map and the linestring types
+/// are the same. Only the distances that do not depend on the range of the extracted lines are
+/// kept.
+struct LineDistanceCache
+{
+  using SegmentKey = std::array<int64_t, 4>;  // points of a bound segment in [cm]
+  using SegmentDistances = std::map<SegmentKey, double>;
+
+  const lanelet::LaneletMap * lanelet_map{};
+  std::vector<std::string> linestring_types{};
+  SegmentDistances left_distances{};
+  SegmentDistances right_distances{};
+};
 }  // namespace drivable_area_expansion
 #endif  // BEHAVIOR_PATH_PLANNER_COMMON__UTILS__DRIVABLE_AREA_EXPANSION__TYPES_HPP_
@@ -21,6 +21,7 @@
 #include <geometry_msgs/msg/pose_array.hpp>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 
+#include <cstdint>
 #include <vector>
 
 namespace behavior_path_planner
@@ -106,7 +107,18 @@ public:
   virtual ~OccupancyGridBasedCollisionDetector() = default;
 
 protected:
+  // footprint of a yaw bin as the bit masks of the rows of its bounding box
+  struct CollisionMask
+  {
+    IndexXY min_index{0, 0};
+    IndexXY max_index{0, 0};
+    int words_per_row{0};
+    std::vector<uint64_t> rows;  // words_per_row words for each row from min_index.y
+  };
+
   void computeCollisionIndexes(int theta_index, std::vector<IndexXY> & indexes);
+  static CollisionMask computeCollisionMask(const std::vector<IndexXY> & indexes);
+  bool hasObstacleInMask(const CollisionMask & mask, const IndexXY & min_index) const;
   inline bool isOutOfRange(const IndexXYT & index) const
   {
     if (index.x < 0 || static_cast<int>(costmap_.info.width) <= index.x) {
@@ -133,9 +145,16 @@ protected:
   // collision indexes cache
   std::vector<std::vector<IndexXY>> coll_indexes_table_;
 
+  // collision masks cache, which is the bit-packed coll_indexes_table_
+  std::vector<CollisionMask> coll_masks_table_;
+
   // is_obstacle's table
   std::vector<std::vector<bool>> is_obstacle_table_;
 
+  // bit-packed is_obstacle_table_, which has an extra zero word at the end of each row
+  std::vector<uint64_t> obstacle_bits_;
+  size_t obstacle_words_per_row_{0};
+
   // pose in costmap frame
   geometry_msgs::msg::Pose start_pose_;
   geometry_msgs::msg::Pose goal_pose_;
@@ -75,6 +75,8 @@ public:
 
   /**
    * @brief  Set reference path.
+   * @details The arc lengths and the unit normals of the path are cached here, and shared by all
+   *          the generate() calls and the copies of the shifter.
    */
   void setPath(const PathWithLaneId & path);
 
@@ -131,6 +133,16 @@ public:
     ShiftedPath * shifted_path, const bool offset_back = true,
     const SHIFT_TYPE type = SHIFT_TYPE::SPLINE) const;
 
+  /**
+   * @brief  Generate a shifted path with the given shift lines instead of the set ones.
+   * @details This is for evaluating many candidates of the shift lines against the same reference
+   *          path without copying the shifter for each of them.
+   * @return False if the path is empty or shift points have conflicts.
+   */
+  bool generate(
+    const ShiftLineArray & shift_lines, ShiftedPath * shifted_path, const bool offset_back = true,
+    const SHIFT_TYPE type = SHIFT_TYPE::SPLINE) const;
+
   /**
    * @brief Remove behind shift points and add the removed offset to the base_offset_.
    * @details The previous offset information is stored in the base_offset_.
@@ -172,6 +184,11 @@ private:
   // The reference path along which the shift will be performed.
   PathWithLaneId reference_path_;
 
+  // Arc lengths and unit normals (left side positive) of the reference path.
+  std::vector<double> base_arclength_;
+  std::vector<double> base_normal_x_;
+  std::vector<double> base_normal_y_;
+
   // Shift points used for shifted-path generation.
   ShiftLineArray shift_lines_;
 
@@ -203,6 +220,13 @@ private:
     const double arclength, const double shift_length, const double velocity,
     const double longitudinal_acc, const double total_time, const bool offset_back);
 
+  /**
+   * @brief Generate a shifted path with the shift lines whose indices are updated and sorted.
+   */
+  bool generateShiftedPath(
+    const ShiftLineArray & shift_lines, ShiftedPath * shifted_path, const bool offset_back,
+    const SHIFT_TYPE type) const;
+
   /**
    * @brief Calculate path index for shift_lines and set is_index_aligned_ to true.
    */
@@ -214,17 +238,28 @@ private:
   void sortShiftLinesAlongPath(ShiftLineArray & shift_lines) const;
 
   /**
-   * @brief Generate shifted path from reference_path_ and shift_lines_ with linear shifting.
+   * @brief Calculate shift length profile from reference_path_ and shift_lines with linear
+   *        shifting.
    */
-  void applyLinearShifter(ShiftedPath * shifted_path) const;
+  void applyLinearShifter(
+    const ShiftLineArray & shift_lines, std::vector<double> & shift_length) const;
 
   /**
-   * @brief Generate shifted path from reference_path_ and shift_lines_ with spline_based shifting.
+   * @brief Calculate shift length profile from reference_path_ and shift_lines with spline_based
+   *        shifting.
    * @details Calculate the shift so that the horizontal jerk remains constant. This is achieved by
    *          dividing the shift interval into four parts and apply a cubic spline to them.
    *          The resultant shifting shape is closed to the Clothoid curve.
    */
-  void applySplineShifter(ShiftedPath * shifted_path, const bool offset_back) const;
+  void applySplineShifter(
+    const ShiftLineArray & shift_lines, std::vector<double> & shift_length,
+    const bool offset_back) const;
+
+  /**
+   * @brief Move the points of the shifted path along the normals of the reference path by the
+   *        shift length profile.
+   */
+  void applyShiftLength(ShiftedPath * shifted_path) const;
 
   ////////////////////////////////////////
   // Helper Functions
@@ -235,9 +270,10 @@ private:
    */
   bool checkShiftLinesAlignment(const ShiftLineArray & shift_lines) const;
 
-  static void addLateralOffsetOnIndexPoint(ShiftedPath * path, double offset, size_t index);
+  static void addLateralOffsetOnIndexPoint(
+    std::vector<double> & shift_length, double offset, size_t index);
 
-  static void shiftBaseLength(ShiftedPath * path, double offset);
+  static void shiftBaseLength(std::vector<double> & shift_length, double offset);
 
   void setBaseOffset(const double val)
   {
@@ -280,6 +280,12 @@ PathWithLaneId setDecelerationVelocity(
 // object label
 std::uint8_t getHighestProbLabel(const std::vector<ObjectClassification> & classification);
 
+/**
+ * @brief get the closest lanelet within route to ego. it is computed once in a planning cycle.
+ */
+std::optional<lanelet::ConstLanelet> getClosestLaneletWithinRoute(
+  const std::shared_ptr<const PlannerData> & planner_data);
+
 lanelet::ConstLanelets getCurrentLanes(
   const std::shared_ptr<const PlannerData> & planner_data, const double backward_path_length,
   const double forward_path_length);
@@ -158,6 +158,21 @@ std::optional<TurnSignalInfo> TurnSignalDecider::getIntersectionTurnSignalInfo(
     }
   }
 
+  // the combined lanes depend only on the route, so that they are reused while it is unchanged
+  {
+    const auto route_header = route_handler.getRouteHeader();
+    const auto route_uuid = route_handler.getRouteUuid();
+    const lanelet::LaneletMapConstPtr map_ptr = route_handler.getLaneletMapPtr();
+    if (
+      route_header != combined_turn_lanes_route_header_ ||
+      route_uuid != combined_turn_lanes_route_uuid_ || map_ptr != combined_turn_lanes_map_ptr_) {
+      combined_turn_lanes_.clear();
+      combined_turn_lanes_route_header_ = route_header;
+      combined_turn_lanes_route_uuid_ = route_uuid;
+      combined_turn_lanes_map_ptr_ = map_ptr;
+    }
+  }
+
   // combine consecutive lanes of the same turn direction
   // stores lanes that have already been combine
   std::set<int> processed_lanes;
@@ -169,26 +184,32 @@ std::optional<TurnSignalInfo> TurnSignalDecider::getIntersectionTurnSignalInfo(
     // Skip if already processed
     if (processed_lanes.find(lane_id) != processed_lanes.end()) continue;
     auto current_lane = route_handler.getLaneletsFromId(lane_id);
-    lanelet::ConstLanelets combined_lane_elems{};
     // Get the lane and its attribute
     const std::string lane_attribute =
       current_lane.attributeOr("turn_direction", std::string("none"));
     if (!requires_turn_signal(lane_attribute)) continue;
 
-    do {
-      processed_lanes.insert(current_lane.id());
-      combined_lane_elems.push_back(current_lane);
-      lanelet::ConstLanelet next_lane{};
-      current_lane = next_lane;
-    } while (route_handler.getNextLaneletWithinRoute(current_lane, &current_lane) &&
-             current_lane.attributeOr("turn_direction", std::string("none")) == lane_attribute);
-
-    if (!combined_lane_elems.empty()) {
-      // store combined lane and its front lane
-      const auto & combined_and_first = std::pair<lanelet::ConstLanelet, lanelet::ConstLanelet>(
-        lanelet::utils::combineLaneletsShape(combined_lane_elems), combined_lane_elems.front());
-      combined_and_front_vec.push_back(combined_and_first);
+    auto combined_turn_lane = combined_turn_lanes_.find(lane_id);
+    if (combined_turn_lane == combined_turn_lanes_.end()) {
+      CombinedTurnLane combined{};
+      lanelet::ConstLanelets combined_lane_elems{};
+      do {
+        combined.lane_ids.push_back(current_lane.id());
+        combined_lane_elems.push_back(current_lane);
+        lanelet::ConstLanelet next_lane{};
+        current_lane = next_lane;
+      } while (route_handler.getNextLaneletWithinRoute(current_lane, &current_lane) &&
+               current_lane.attributeOr("turn_direction", std::string("none")) == lane_attribute);
+      combined.combined_lane = lanelet::utils::combineLaneletsShape(combined_lane_elems);
+      combined.front_lane = combined_lane_elems.front();
+      combined_turn_lane = combined_turn_lanes_.emplace(lane_id, std::move(combined)).first;
     }
+
+    // store combined lane and its front lane
+    processed_lanes.insert(
+      combined_turn_lane->second.lane_ids.begin(), combined_turn_lane->second.lane_ids.end());
+    combined_and_front_vec.emplace_back(
+      combined_turn_lane->second.combined_lane, combined_turn_lane->second.front_lane);
   }
 
   std::queue<TurnSignalInfo> signal_queue;
@@ -28,7 +28,11 @@
 
 #include <boost/geometry/strategies/strategies.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <optional>
+#include <utility>
 
 namespace drivable_area_expansion
 {
@@ -209,14 +213,41 @@ void apply_bound_change_rate_limit(
   for (auto idx = distances.size() - 1; idx > 0; --idx) apply_max_vel(distances, idx, idx - 1);
 }
 
-std::vector<double> calculate_maximum_distance(
+namespace
+{
+LineDistanceCache::SegmentKey to_segment_key(const Segment2d & segment)
+{
+  const auto to_cm = [](const double v) { return static_cast<int64_t>(std::round(v * 100.0)); };
+  return {
+    to_cm(segment.first.x()), to_cm(segment.first.y()), to_cm(segment.second.x()),
+    to_cm(segment.second.y())};
+}
+
+double calculate_box_distance(
+  const tier4_autoware_utils::Box2d & a, const tier4_autoware_utils::Box2d & b)
+{
+  const auto dx = std::max(
+    {0.0, a.min_corner().x() - b.max_corner().x(), b.min_corner().x() - a.max_corner().x()});
+  const auto dy = std::max(
+    {0.0, a.min_corner().y() - b.max_corner().y(), b.min_corner().y() - a.max_corner().y()});
+  return std::hypot(dx, dy);
+}
+
+std::vector<double> calculate_maximum_distance_impl(
   const std::vector<Point> & bound, const SegmentRtree & uncrossable_segments,
   const std::vector<Polygon2d> & uncrossable_polygons,
-  const DrivableAreaExpansionParameters & params, const Side side)
+  const DrivableAreaExpansionParameters & params, const Side side, const Point * ego_point,
+  LineDistanceCache::SegmentDistances * line_distances)
 {
   std::vector<double> maximum_distances(bound.size(), std::numeric_limits<double>::max());
   LineString2d bound_ls;
   for (const auto & p : bound) bound_ls.push_back(convert_point(p));
+  // polygons farther than the maximum expansion distance cannot limit the expansion
+  std::vector<tier4_autoware_utils::Box2d> polygon_envelopes;
+  for (const auto & poly : uncrossable_polygons)
+    polygon_envelopes.push_back(
+      boost::geometry::return_envelope<tier4_autoware_utils::Box2d>(poly));
+  LineDistanceCache::SegmentDistances updated_line_distances;
   for (auto i = 0UL; i + 1 < bound_ls.size(); ++i) {
     const Segment2d segment_ls = {bound_ls[i], bound_ls[i + 1]};
     const auto segment_vector = segment_ls.second - segment_ls.first;
@@ -229,19 +260,52 @@ std::vector<double> calculate_maximum_distance(
     const auto is_on_correct_side = [&](const Segment2d & segment) {
       return is_point_on_correct_side(segment.first) || is_point_on_correct_side(segment.second);
     };
-    std::vector<Segment2d> query_result;
-    boost::geometry::index::query(
-      uncrossable_segments,
-      boost::geometry::index::nearest(segment_ls, 1) &&
-        boost::geometry::index::satisfies(is_on_correct_side),
-      std::back_inserter(query_result));
-    if (!query_result.empty()) {
-      const auto bound_to_line_dist = boost::geometry::distance(segment_ls, query_result.front());
-      const auto dist_limit = std::max(0.0, bound_to_line_dist - params.avoid_linestring_dist);
+    const auto calculate_line_distance = [&]() -> std::optional<double> {
+      std::vector<Segment2d> query_result;
+      boost::geometry::index::query(
+        uncrossable_segments,
+        boost::geometry::index::nearest(segment_ls, 1) &&
+          boost::geometry::index::satisfies(is_on_correct_side),
+        std::back_inserter(query_result));
+      if (query_result.empty()) return std::nullopt;
+      return boost::geometry::distance(segment_ls, query_result.front());
+    };
+    std::optional<double> bound_to_line_dist;
+    if (line_distances) {
+      const auto key = to_segment_key(segment_ls);
+      const auto cached_dist = line_distances->find(key);
+      if (cached_dist != line_distances->end()) {
+        bound_to_line_dist = cached_dist->second;
+        updated_line_distances.emplace(key, cached_dist->second);
+      } else {
+        bound_to_line_dist = calculate_line_distance();
+        // the segments were extracted within max_path_arc_length from ego, so the ones out of this
+        // range cannot be closer than the following distance
+        const auto ego_p = convert_point(*ego_point);
+        const auto min_dist_out_of_range =
+          params.max_path_arc_length - std::max(
+                                         boost::geometry::distance(segment_ls.first, ego_p),
+                                         boost::geometry::distance(segment_ls.second, ego_p));
+        if (bound_to_line_dist && *bound_to_line_dist <= min_dist_out_of_range)
+          updated_line_distances.emplace(key, *bound_to_line_dist);
+      }
+    } else {
+      bound_to_line_dist = calculate_line_distance();
+    }
+    if (bound_to_line_dist) {
+      const auto dist_limit = std::max(0.0, *bound_to_line_dist - params.avoid_linestring_dist);
       maximum_distances[i] = std::min(maximum_distances[i], dist_limit);
       maximum_distances[i + 1] = std::min(maximum_distances[i + 1], dist_limit);
     }
-    for (const auto & uncrossable_poly : uncrossable_polygons) {
+    const auto segment_envelope =
+      boost::geometry::return_envelope<tier4_autoware_utils::Box2d>(segment_ls);
+    for (auto poly_idx = 0UL; poly_idx < uncrossable_polygons.size(); ++poly_idx) {
+      const auto & uncrossable_poly = uncrossable_polygons[poly_idx];
+      if (
+        params.max_expansion_distance > 0.0 &&
+        calculate_box_distance(segment_envelope, polygon_envelopes[poly_idx]) >
+          params.max_expansion_distance)
+        continue;
       if (boost::geometry::intersects(uncrossable_poly.outer(), segment_ls)) {
         maximum_distances[i] = 0.0;
         maximum_distances[i + 1] = 0.0;
@@ -256,10 +320,32 @@ std::vector<double> calculate_maximum_distance(
       }
     }
   }
+  // only keep the distances of the current bound
+  if (line_distances) *line_distances = std::move(updated_line_distances);
   if (params.max_expansion_distance > 0.0)
     for (auto & d : maximum_distances) d = std::min(params.max_expansion_distance, d);
   return maximum_distances;
 }
+}  // namespace
+
+std::vector<double> calculate_maximum_distance(
+  const std::vector<Point> & bound, const SegmentRtree & uncrossable_segments,
+  const std::vector<Polygon2d> & uncrossable_polygons,
+  const DrivableAreaExpansionParameters & params, const Side side)
+{
+  return calculate_maximum_distance_impl(
+    bound, uncrossable_segments, uncrossable_polygons, params, side, nullptr, nullptr);
+}
+
+std::vector<double> calculate_maximum_distance(
+  const std::vector<Point> & bound, const SegmentRtree & uncrossable_segments,
+  const std::vector<Polygon2d> & uncrossable_polygons,
+  const DrivableAreaExpansionParameters & params, const Side side, const Point & ego_point,
+  LineDistanceCache::SegmentDistances & line_distances)
+{
+  return calculate_maximum_distance_impl(
+    bound, uncrossable_segments, uncrossable_polygons, params, side, &ego_point, &line_distances);
+}
 
 void expand_bound(
   std::vector<Point> & bound, const std::vector<Pose> & path_poses,
@@ -400,10 +486,31 @@ void expand_drivable_area(
   const auto curvature_expansion_ms = stop_watch.toc("curvatures_expansion");
 
   stop_watch.tic("max_dist");
-  const auto max_left_expansions = calculate_maximum_distance(
-    path.left_bound, uncrossable_segments, uncrossable_polygons, params, LEFT);
-  const auto max_right_expansions = calculate_maximum_distance(
-    path.right_bound, uncrossable_segments, uncrossable_polygons, params, RIGHT);
+  auto & line_distances = planner_data->drivable_area_expansion_line_distances;
+  const auto * lanelet_map = route_handler.getLaneletMapPtr().get();
+  if (
+    !params.reuse_avoid_linestring_distances || line_distances.lanelet_map != lanelet_map ||
+    line_distances.linestring_types != params.avoid_linestring_types) {
+    line_distances = LineDistanceCache{};
+    line_distances.lanelet_map = lanelet_map;
+    line_distances.linestring_types = params.avoid_linestring_types;
+  }
+  std::vector<double> max_left_expansions;
+  std::vector<double> max_right_expansions;
+  if (params.reuse_avoid_linestring_distances) {
+    const auto & ego_point = planner_data->self_odometry->pose.pose.position;
+    max_left_expansions = calculate_maximum_distance(
+      path.left_bound, uncrossable_segments, uncrossable_polygons, params, LEFT, ego_point,
+      line_distances.left_distances);
+    max_right_expansions = calculate_maximum_distance(
+      path.right_bound, uncrossable_segments, uncrossable_polygons, params, RIGHT, ego_point,
+      line_distances.right_distances);
+  } else {
+    max_left_expansions = calculate_maximum_distance(
+      path.left_bound, uncrossable_segments, uncrossable_polygons, params, LEFT);
+    max_right_expansions = calculate_maximum_distance(
+      path.right_bound, uncrossable_segments, uncrossable_polygons, params, RIGHT);
+  }
   const auto max_dist_ms = stop_watch.toc("max_dist");
 
   calculate_expansion_distances(expansion, max_left_expansions, max_right_expansions);
@@ -29,6 +29,10 @@
 #include <lanelet2_core/geometry/Polygon.h>
 #include <lanelet2_routing/RoutingGraphContainer.h>
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 namespace
 {
 template <class T>
@@ -230,6 +234,78 @@ std::vector<lanelet::ConstPoint3d> extractBoundFromPolygon(
 
   return ret;
 }
+
+/**
+ * @brief cache of the bounds expanded by the hatched road markings and the intersection areas
+ * @details the expanded bound depends only on the drivable lanes and the map, while it is
+ * generated every cycle by every module. The cache is cleared when the map is changed.
+ */
+class ExpandedBoundCache
+{
+public:
+  using Key = std::tuple<std::vector<lanelet::Id>, bool, bool, bool>;
+
+  static Key makeKey(
+    const std::vector<behavior_path_planner::DrivableLanes> & drivable_lanes,
+    const bool enable_expanding_hatched_road_markings,
+    const bool enable_expanding_intersection_areas, const bool is_left)
+  {
+    std::vector<lanelet::Id> lane_ids;
+    for (const auto & drivable_lane : drivable_lanes) {
+      lane_ids.push_back(drivable_lane.left_lane.id());
+      lane_ids.push_back(drivable_lane.right_lane.id());
+      for (const auto & middle_lane : drivable_lane.middle_lanes) {
+        lane_ids.push_back(middle_lane.id());
+      }
+      // separator of the drivable lanes
+      lane_ids.push_back(lanelet::InvalId);
+    }
+    return std::make_tuple(
+      std::move(lane_ids), enable_expanding_hatched_road_markings,
+      enable_expanding_intersection_areas, is_left);
+  }
+
+  std::optional<std::vector<geometry_msgs::msg::Point>> find(
+    const lanelet::LaneletMapConstPtr & map_ptr, const Key & key)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (map_ptr_.lock() != map_ptr) {
+      return std::nullopt;
+    }
+    const auto itr = bounds_.find(key);
+    if (itr == bounds_.end()) {
+      return std::nullopt;
+    }
+    return itr->second;
+  }
+
+  void insert(
+    const lanelet::LaneletMapConstPtr & map_ptr, const Key & key,
+    const std::vector<geometry_msgs::msg::Point> & bound)
+  {
+    // NOTE: The bounds are cleared at once instead of LRU, since the drivable lanes along the
+    //       route change little and the limit is rarely reached.
+    constexpr size_t max_cache_size = 256;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (map_ptr_.lock() != map_ptr || max_cache_size <= bounds_.size()) {
+      bounds_.clear();
+      map_ptr_ = map_ptr;
+    }
+    bounds_.emplace(key, bound);
+  }
+
+private:
+  std::mutex mutex_;
+  std::weak_ptr<const lanelet::LaneletMap> map_ptr_;
+  std::map<Key, std::vector<geometry_msgs::msg::Point>> bounds_;
+};
+
+ExpandedBoundCache & getExpandedBoundCache()
+{
+  static ExpandedBoundCache cache;
+  return cache;
+}
 }  // namespace
 
 namespace behavior_path_planner::utils::drivable_area_processing
@@ -1669,13 +1745,32 @@ std::vector<geometry_msgs::msg::Point> calcBound(
     return post_process(removeOverlapPoints(to_ros_point(bound_points)), skip_post_process);
   }
 
+  // NOTE: The bound expanded by the free space areas depends on the ego pose, so that only the
+  //       bound without them is cached. The cached bound is cut by postProcess() every cycle.
+  const lanelet::LaneletMapConstPtr map_ptr = route_handler->getLaneletMapPtr();
+  const auto cache_key = ExpandedBoundCache::makeKey(
+    drivable_lanes, enable_expanding_hatched_road_markings, enable_expanding_intersection_areas,
+    is_left);
+  if (!enable_expanding_freespace_areas) {
+    if (const auto cached_bound = getExpandedBoundCache().find(map_ptr, cache_key)) {
+      return post_process(*cached_bound, false);
+    }
+  }
+  const auto expanded_bound = [&]() {
+    const auto bound = removeOverlapPoints(to_ros_point(bound_points));
+    if (!enable_expanding_freespace_areas) {
+      getExpandedBoundCache().insert(map_ptr, cache_key, bound);
+    }
+    return bound;
+  };
+
   // Step3.if there are hatched road markings, expand drivable bound with the polygon.
   if (enable_expanding_hatched_road_markings) {
     bound_points = getBoundWithHatchedRoadMarkings(bound_points, route_handler);
   }
 
   if (!enable_expanding_intersection_areas) {
-    return post_process(removeOverlapPoints(to_ros_point(bound_points)), skip_post_process);
+    return post_process(expanded_bound(), skip_post_process);
   }
 
   // Step4. if there are intersection areas, expand drivable bound with the polygon.
@@ -1684,7 +1779,7 @@ std::vector<geometry_msgs::msg::Point> calcBound(
       getBoundWithIntersectionAreas(bound_points, route_handler, drivable_lanes, is_left);
   }
 
-  return post_process(removeOverlapPoints(to_ros_point(bound_points)), skip_post_process);
+  return post_process(expanded_bound(), skip_post_process);
 }
 
 std::vector<DrivableLanes> combineDrivableLanes(
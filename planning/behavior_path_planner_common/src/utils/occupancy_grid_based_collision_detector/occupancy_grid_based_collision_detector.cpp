@@ -17,6 +17,7 @@
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/math/normalization.hpp>
 
+#include <algorithm>
 #include <vector>
 
 namespace behavior_path_planner
@@ -89,6 +90,8 @@ void OccupancyGridBasedCollisionDetector::setMap(const nav_msgs::msg::OccupancyG
   // Initialize status
   std::vector<std::vector<bool>> is_obstacle_table;
   is_obstacle_table.resize(height);
+  obstacle_words_per_row_ = (width + 63) / 64 + 1;
+  obstacle_bits_.assign(height * obstacle_words_per_row_, 0);
   for (uint32_t i = 0; i < height; i++) {
     is_obstacle_table.at(i).resize(width);
     for (uint32_t j = 0; j < width; j++) {
@@ -96,6 +99,7 @@ void OccupancyGridBasedCollisionDetector::setMap(const nav_msgs::msg::OccupancyG
 
       if (cost < 0 || param_.obstacle_threshold <= cost) {
         is_obstacle_table[i][j] = true;
+        obstacle_bits_[i * obstacle_words_per_row_ + j / 64] |= uint64_t{1} << (j % 64);
       }
     }
   }
@@ -103,9 +107,11 @@ void OccupancyGridBasedCollisionDetector::setMap(const nav_msgs::msg::OccupancyG
 
   // construct collision indexes table
   coll_indexes_table_.clear();
+  coll_masks_table_.clear();
   for (int i = 0; i < param_.theta_size; i++) {
     std::vector<IndexXY> indexes_2d;
     computeCollisionIndexes(i, indexes_2d);
+    coll_masks_table_.push_back(computeCollisionMask(indexes_2d));
     coll_indexes_table_.push_back(indexes_2d);
   }
 }
@@ -159,6 +165,56 @@ void OccupancyGridBasedCollisionDetector::computeCollisionIndexes(
   addIndex2d(front, left);
 }
 
+OccupancyGridBasedCollisionDetector::CollisionMask
+OccupancyGridBasedCollisionDetector::computeCollisionMask(const std::vector<IndexXY> & indexes_2d)
+{
+  CollisionMask mask;
+  if (indexes_2d.empty()) {
+    return mask;
+  }
+
+  mask.min_index = indexes_2d.front();
+  mask.max_index = indexes_2d.front();
+  for (const auto & index_2d : indexes_2d) {
+    mask.min_index.x = std::min(mask.min_index.x, index_2d.x);
+    mask.min_index.y = std::min(mask.min_index.y, index_2d.y);
+    mask.max_index.x = std::max(mask.max_index.x, index_2d.x);
+    mask.max_index.y = std::max(mask.max_index.y, index_2d.y);
+  }
+
+  mask.words_per_row = (mask.max_index.x - mask.min_index.x) / 64 + 1;
+  mask.rows.assign((mask.max_index.y - mask.min_index.y + 1) * mask.words_per_row, 0);
+  for (const auto & index_2d : indexes_2d) {
+    const int x = index_2d.x - mask.min_index.x;
+    const int y = index_2d.y - mask.min_index.y;
+    mask.rows[y * mask.words_per_row + x / 64] |= uint64_t{1} << (x % 64);
+  }
+  return mask;
+}
+
+bool OccupancyGridBasedCollisionDetector::hasObstacleInMask(
+  const CollisionMask & mask, const IndexXY & min_index) const
+{
+  const int row_num = mask.max_index.y - mask.min_index.y + 1;
+  for (int row = 0; row < row_num; ++row) {
+    const uint64_t * obstacle_row = &obstacle_bits_[(min_index.y + row) * obstacle_words_per_row_];
+    const uint64_t * mask_row = &mask.rows[row * mask.words_per_row];
+    for (int word = 0; word < mask.words_per_row; ++word) {
+      // 64 cells of the grid from the column of the mask word
+      const int x = min_index.x + 64 * word;
+      const int shift = x % 64;
+      uint64_t obstacle_word = obstacle_row[x / 64] >> shift;
+      if (shift != 0) {
+        obstacle_word |= obstacle_row[x / 64 + 1] << (64 - shift);
+      }
+      if (obstacle_word & mask_row[word]) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 bool OccupancyGridBasedCollisionDetector::detectCollision(
   const IndexXYT & base_index, const bool check_out_of_range) const
 {
@@ -167,6 +223,19 @@ bool OccupancyGridBasedCollisionDetector::detectCollision(
               << std::endl;
     return false;
   }
+
+  // the footprint within the grid is checked word by word with its bit masks
+  const auto & coll_mask = coll_masks_table_[base_index.theta];
+  const IndexXYT min_index{
+    base_index.x + coll_mask.min_index.x, base_index.y + coll_mask.min_index.y, 0};
+  const IndexXYT max_index{
+    base_index.x + coll_mask.max_index.x, base_index.y + coll_mask.max_index.y, 0};
+  if (!isOutOfRange(min_index) && !isOutOfRange(max_index)) {
+    return hasObstacleInMask(coll_mask, {min_index.x, min_index.y});
+  }
+
+  // the footprint partially out of the grid is checked cell by cell, since the result depends on
+  // whether an obstacle is found before the cell out of the grid
   const auto & coll_indexes_2d = coll_indexes_table_[base_index.theta];
   for (const auto & coll_index_2d : coll_indexes_2d) {
     int idx_theta = 0;  // whatever. Yaw is nothing to do with collision detection between grids.
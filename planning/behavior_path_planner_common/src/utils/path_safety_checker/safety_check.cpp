@@ -26,6 +26,8 @@
 #include <boost/geometry/algorithms/union.hpp>
 #include <boost/geometry/strategies/strategies.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 namespace behavior_path_planner::utils::path_safety_checker
@@ -33,6 +35,20 @@ namespace behavior_path_planner::utils::path_safety_checker
 
 namespace bg = boost::geometry;
 
+namespace
+{
+double calcMaxDistanceFromPose(const Pose & pose, const Polygon2d & polygon)
+{
+  double max_squared_distance = 0.0;
+  for (const auto & p : polygon.outer()) {
+    const double dx = p.x() - pose.position.x;
+    const double dy = p.y() - pose.position.y;
+    max_squared_distance = std::max(max_squared_distance, dx * dx + dy * dy);
+  }
+  return std::sqrt(max_squared_distance);
+}
+}  // namespace
+
 void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point & geom_point)
 {
   Point2d point;
@@ -604,18 +620,6 @@ std::vector<Polygon2d> getCollidedPolygons(
     const auto & ego_polygon = interpolated_data->poly;
     const auto ego_velocity = std::min(interpolated_data->velocity, max_velocity_limit);
 
-    // check overlap
-    if (boost::geometry::overlaps(ego_polygon, obj_polygon)) {
-      debug.unsafe_reason = "overlap_polygon";
-      collided_polygons.push_back(obj_polygon);
-
-      debug.expected_ego_pose = ego_pose;
-      debug.expected_obj_pose = obj_pose;
-      debug.extended_ego_polygon = ego_polygon;
-      debug.extended_obj_polygon = obj_polygon;
-      continue;
-    }
-
     // compute which one is at the front of the other
     const bool is_object_front = isTargetObjectFront(ego_pose, obj_polygon, ego_vehicle_info);
     const auto & [front_object_velocity, rear_object_velocity] =
@@ -632,6 +636,36 @@ std::vector<Polygon2d> getCollidedPolygons(
 
     const auto & lon_offset = std::max(rss_dist, min_lon_length) * hysteresis_factor;
     const auto & lat_margin = rss_parameters.lateral_distance_max_threshold * hysteresis_factor;
+
+    // broad phase: the polygons below are in the circles around ego and the object, whose radii
+    // cover the extension by lon_offset and lat_margin. if the circles are apart, both of the
+    // overlap checks fail, so they are skipped. the extended polygon along the path is not
+    // bounded around ego, so it is always checked.
+    if (!is_object_front || rss_parameters.extended_polygon_policy == "rectangle") {
+      const double ego_radius = std::max(
+                                  ego_vehicle_info.max_longitudinal_offset_m,
+                                  ego_vehicle_info.rear_overhang_m) +
+                                ego_vehicle_info.vehicle_width_m / 2.0 + lon_offset + lat_margin;
+      const double obj_radius =
+        std::sqrt(2.0) * calcMaxDistanceFromPose(obj_pose, obj_polygon) + lon_offset + lat_margin;
+      const double distance =
+        tier4_autoware_utils::calcDistance2d(ego_pose.position, obj_pose.position);
+      if (distance > ego_radius + obj_radius) {
+        continue;
+      }
+    }
+
+    // check overlap
+    if (boost::geometry::overlaps(ego_polygon, obj_polygon)) {
+      debug.unsafe_reason = "overlap_polygon";
+      collided_polygons.push_back(obj_polygon);
+
+      debug.expected_ego_pose = ego_pose;
+      debug.expected_obj_pose = obj_pose;
+      debug.extended_ego_polygon = ego_polygon;
+      debug.extended_obj_polygon = obj_polygon;
+      continue;
+    }
     // TODO(watanabe) fix hard coding value
     const bool is_stopped_object = object_velocity < 0.3;
     const auto extended_ego_polygon = [&]() {
@@ -60,6 +60,15 @@ void PathShifter::setPath(const PathWithLaneId & path)
 {
   reference_path_ = path;
 
+  base_arclength_ = utils::calcPathArcLengthArray(path);
+  base_normal_x_.resize(path.points.size());
+  base_normal_y_.resize(path.points.size());
+  for (size_t i = 0; i < path.points.size(); ++i) {
+    const double yaw = tf2::getYaw(path.points.at(i).point.pose.orientation);
+    base_normal_x_.at(i) = -std::sin(yaw);
+    base_normal_y_.at(i) = std::cos(yaw);
+  }
+
   updateShiftLinesIndices(shift_lines_);
   sortShiftLinesAlongPath(shift_lines_);
 }
@@ -96,6 +105,23 @@ void PathShifter::setShiftLines(const std::vector<ShiftLine> & lines)
 
 bool PathShifter::generate(
   ShiftedPath * shifted_path, const bool offset_back, const SHIFT_TYPE type) const
+{
+  return generateShiftedPath(shift_lines_, shifted_path, offset_back, type);
+}
+
+bool PathShifter::generate(
+  const ShiftLineArray & shift_lines, ShiftedPath * shifted_path, const bool offset_back,
+  const SHIFT_TYPE type) const
+{
+  auto sorted_shift_lines = shift_lines;
+  updateShiftLinesIndices(sorted_shift_lines);
+  sortShiftLinesAlongPath(sorted_shift_lines);
+  return generateShiftedPath(sorted_shift_lines, shifted_path, offset_back, type);
+}
+
+bool PathShifter::generateShiftedPath(
+  const ShiftLineArray & shift_lines, ShiftedPath * shifted_path, const bool offset_back,
+  const SHIFT_TYPE type) const
 {
   RCLCPP_DEBUG_STREAM_THROTTLE(logger_, clock_, 3000, "PathShifter::generate start!");
 
@@ -106,16 +132,17 @@ bool PathShifter::generate(
   }
 
   shifted_path->path = reference_path_;
-  shifted_path->shift_length.resize(reference_path_.points.size(), 0.0);
+  shifted_path->shift_length.assign(reference_path_.points.size(), 0.0);
 
-  if (shift_lines_.empty()) {
+  if (shift_lines.empty()) {
     RCLCPP_DEBUG_STREAM_THROTTLE(
       logger_, clock_, 3000, "shift_lines_ is empty. Return reference with base offset.");
-    shiftBaseLength(shifted_path, base_offset_);
+    shiftBaseLength(shifted_path->shift_length, base_offset_);
+    applyShiftLength(shifted_path);
     return true;
   }
 
-  for (const auto & shift_line : shift_lines_) {
+  for (const auto & shift_line : shift_lines) {
     if (shift_line.end_idx < shift_line.start_idx) {
       RCLCPP_WARN_STREAM_THROTTLE(
         logger_, clock_, 3000, "Invalid indices: end_idx is less than start_idx");
@@ -133,12 +160,12 @@ bool PathShifter::generate(
   }
 
   // Check if the shift points are sorted correctly
-  if (!checkShiftLinesAlignment(shift_lines_)) {
+  if (!checkShiftLinesAlignment(shift_lines)) {
     RCLCPP_ERROR_STREAM(logger_, "Failed to sort shift points..!!");
     return false;
   }
 
-  if (shift_lines_.front().start_idx == 0) {
+  if (shift_lines.front().start_idx == 0) {
     // if offset is applied on front side, shifting from first point is no problem
     if (offset_back) {
       RCLCPP_WARN_STREAM_THROTTLE(
@@ -149,8 +176,10 @@ bool PathShifter::generate(
   }
 
   // Calculate shifted path
-  type == SHIFT_TYPE::SPLINE ? applySplineShifter(shifted_path, offset_back)
-                             : applyLinearShifter(shifted_path);
+  type == SHIFT_TYPE::SPLINE
+    ? applySplineShifter(shift_lines, shifted_path->shift_length, offset_back)
+    : applyLinearShifter(shift_lines, shifted_path->shift_length);
+  applyShiftLength(shifted_path);
 
   shifted_path->path.points = removeOverlapPoints(shifted_path->path.points);
   // Use orientation before shift to remove points in reverse order
@@ -168,28 +197,29 @@ bool PathShifter::generate(
   // DEBUG
   RCLCPP_DEBUG_STREAM_THROTTLE(
     logger_, clock_, 3000,
-    "PathShifter::generate end. shift_lines_.size = " << shift_lines_.size());
+    "PathShifter::generate end. shift_lines_.size = " << shift_lines.size());
 
   return true;
 }
 
-void PathShifter::applyLinearShifter(ShiftedPath * shifted_path) const
+void PathShifter::applyLinearShifter(
+  const ShiftLineArray & shift_lines, std::vector<double> & shift_length) const
 {
-  const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
+  const auto & arclength_arr = base_arclength_;
 
-  shiftBaseLength(shifted_path, base_offset_);
+  shiftBaseLength(shift_length, base_offset_);
 
   constexpr double epsilon = 1.0e-8;  // to avoid 0 division
 
-  // For all shift_lines_,
-  for (const auto & shift_line : shift_lines_) {
-    const auto current_shift = shifted_path->shift_length.at(shift_line.end_idx);
+  // For all shift_lines,
+  for (const auto & shift_line : shift_lines) {
+    const auto current_shift = shift_length.at(shift_line.end_idx);
     const auto delta_shift = shift_line.end_shift_length - current_shift;
     const auto shifting_arclength = std::max(
       arclength_arr.at(shift_line.end_idx) - arclength_arr.at(shift_line.start_idx), epsilon);
 
     // For all path.points,
-    for (size_t i = 0; i < shifted_path->path.points.size(); ++i) {
+    for (size_t i = 0; i < shift_length.size(); ++i) {
       // Set shift length.
       double ith_shift_length = 0.0;
       if (i < shift_line.start_idx) {
@@ -202,24 +232,29 @@ void PathShifter::applyLinearShifter(ShiftedPath * shifted_path) const
       }
 
       // Apply shifting.
-      addLateralOffsetOnIndexPoint(shifted_path, ith_shift_length, i);
+      addLateralOffsetOnIndexPoint(shift_length, ith_shift_length, i);
     }
   }
 }
 
-void PathShifter::applySplineShifter(ShiftedPath * shifted_path, const bool offset_back) const
+void PathShifter::applySplineShifter(
+  const ShiftLineArray & shift_lines, std::vector<double> & shift_length,
+  const bool offset_back) const
 {
-  const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
+  const auto & arclength_arr = base_arclength_;
 
-  shiftBaseLength(shifted_path, base_offset_);
+  shiftBaseLength(shift_length, base_offset_);
 
   constexpr double epsilon = 1.0e-8;  // to avoid 0 division
 
+  std::vector<double> query_distance;
+  std::vector<double> query_length;
+
   // For all shift_lines,
-  for (const auto & shift_line : shift_lines_) {
+  for (const auto & shift_line : shift_lines) {
     // calc delta shift at the sp.end_idx so that the sp.end_idx on the path will have
     // the desired shift length.
-    const auto current_shift = shifted_path->shift_length.at(shift_line.end_idx);
+    const auto current_shift = shift_length.at(shift_line.end_idx);
     const auto delta_shift = shift_line.end_shift_length - current_shift;
 
     RCLCPP_DEBUG(
@@ -241,8 +276,8 @@ void PathShifter::applySplineShifter(ShiftedPath * shifted_path, const bool offs
       logger_, "base_distance = %s, base_length = %s", toStr(base_distance).c_str(),
       toStr(base_length).c_str());
 
-    std::vector<double> query_distance;
-    std::vector<double> query_length;
+    query_distance.clear();
+    query_length.clear();
 
     // For all path.points,
     // Note: start_idx is not included since shift = 0,
@@ -259,25 +294,40 @@ void PathShifter::applySplineShifter(ShiftedPath * shifted_path, const bool offs
     {
       size_t i = shift_line.start_idx + 1;
       for (const auto & itr : query_length) {
-        addLateralOffsetOnIndexPoint(shifted_path, itr, i);
+        addLateralOffsetOnIndexPoint(shift_length, itr, i);
         ++i;
       }
     }
 
     if (offset_back) {
       // Apply shifting after shift
-      for (size_t i = shift_line.end_idx; i < shifted_path->path.points.size(); ++i) {
-        addLateralOffsetOnIndexPoint(shifted_path, delta_shift, i);
+      for (size_t i = shift_line.end_idx; i < shift_length.size(); ++i) {
+        addLateralOffsetOnIndexPoint(shift_length, delta_shift, i);
       }
     } else {
       // Apply shifting before shift
       for (size_t i = 0; i < shift_line.start_idx + 1; ++i) {
-        addLateralOffsetOnIndexPoint(shifted_path, query_length.front(), i);
+        addLateralOffsetOnIndexPoint(shift_length, query_length.front(), i);
       }
     }
   }
 }
 
+void PathShifter::applyShiftLength(ShiftedPath * shifted_path) const
+{
+  // NOTE: The orientations of the shifted path are the ones of the reference path until they are
+  //       updated after shifting, so that the cached normals of the reference path are used.
+  const auto & shift_length = shifted_path->shift_length;
+  for (size_t i = 0; i < shift_length.size(); ++i) {
+    if (shift_length.at(i) == 0.0) {
+      continue;
+    }
+    auto & p = shifted_path->path.points.at(i).point.pose.position;
+    p.x += base_normal_x_.at(i) * shift_length.at(i);
+    p.y += base_normal_y_.at(i) * shift_length.at(i);
+  }
+}
+
 std::pair<std::vector<double>, std::vector<double>> PathShifter::getBaseLengthsWithoutAccelLimit(
   const double arclength, const double shift_length, const bool offset_back)
 {
@@ -397,7 +447,7 @@ std::pair<std::vector<double>, std::vector<double>> PathShifter::calcBaseLengths
 
 std::vector<double> PathShifter::calcLateralJerk() const
 {
-  const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
+  const auto & arclength_arr = base_arclength_;
 
   constexpr double epsilon = 1.0e-8;  // to avoid 0 division
 
@@ -518,26 +568,22 @@ void PathShifter::removeBehindShiftLineAndSetBaseOffset(const size_t nearest_idx
   setBaseOffset(new_base_offset);
 }
 
-void PathShifter::addLateralOffsetOnIndexPoint(ShiftedPath * path, double offset, size_t index)
+void PathShifter::addLateralOffsetOnIndexPoint(
+  std::vector<double> & shift_length, double offset, size_t index)
 {
   if (fabs(offset) < 1.0e-8) {
     return;
   }
 
-  auto & p = path->path.points.at(index).point.pose;
-  double yaw = tf2::getYaw(p.orientation);
-  p.position.x -= std::sin(yaw) * offset;
-  p.position.y += std::cos(yaw) * offset;
-
-  path->shift_length.at(index) += offset;
+  shift_length.at(index) += offset;
 }
 
-void PathShifter::shiftBaseLength(ShiftedPath * path, double offset)
+void PathShifter::shiftBaseLength(std::vector<double> & shift_length, double offset)
 {
   constexpr double base_offset_thr = 1.0e-4;
   if (std::abs(offset) > base_offset_thr) {
-    for (size_t i = 0; i < path->path.points.size(); ++i) {
-      addLateralOffsetOnIndexPoint(path, offset, i);
+    for (size_t i = 0; i < shift_length.size(); ++i) {
+      addLateralOffsetOnIndexPoint(shift_length, offset, i);
     }
   }
 }
@@ -1228,6 +1228,24 @@ std::uint8_t getHighestProbLabel(const std::vector<ObjectClassification> & class
   return label;
 }
 
+std::optional<lanelet::ConstLanelet> getClosestLaneletWithinRoute(
+  const std::shared_ptr<const PlannerData> & planner_data)
+{
+  const auto compute = [&]() -> std::optional<lanelet::ConstLanelet> {
+    lanelet::ConstLanelet closest_lane;
+    if (!planner_data->route_handler->getClosestLaneletWithinRoute(
+          planner_data->self_odometry->pose.pose, &closest_lane)) {
+      return std::nullopt;
+    }
+    return closest_lane;
+  };
+
+  if (!planner_data->context_cache) {
+    return compute();
+  }
+  return planner_data->context_cache->getClosestLaneletWithinRoute(*planner_data, compute);
+}
+
 lanelet::ConstLanelets getCurrentLanes(
   const std::shared_ptr<const PlannerData> & planner_data, const double backward_path_length,
   const double forward_path_length)
@@ -1235,8 +1253,8 @@ lanelet::ConstLanelets getCurrentLanes(
   const auto & route_handler = planner_data->route_handler;
   const auto current_pose = planner_data->self_odometry->pose.pose;
 
-  lanelet::ConstLanelet current_lane;
-  if (!route_handler->getClosestLaneletWithinRoute(current_pose, &current_lane)) {
+  const auto current_lane = getClosestLaneletWithinRoute(planner_data);
+  if (!current_lane) {
     auto clock{rclcpp::Clock{RCL_ROS_TIME}};
     RCLCPP_ERROR_STREAM_THROTTLE(
       rclcpp::get_logger("behavior_path_planner").get_child("utils"), clock, 1000,
@@ -1246,30 +1264,33 @@ lanelet::ConstLanelets getCurrentLanes(
 
   // For current_lanes with desired length
   return route_handler->getLaneletSequence(
-    current_lane, current_pose, backward_path_length, forward_path_length);
+    *current_lane, current_pose, backward_path_length, forward_path_length);
 }
 
 lanelet::ConstLanelets getCurrentLanes(const std::shared_ptr<const PlannerData> & planner_data)
 {
   const auto & common_parameters = planner_data->parameters;
-  return getCurrentLanes(
-    planner_data, common_parameters.backward_path_length, common_parameters.forward_path_length);
+  const auto compute = [&]() {
+    return getCurrentLanes(
+      planner_data, common_parameters.backward_path_length, common_parameters.forward_path_length);
+  };
+
+  if (!planner_data->context_cache) {
+    return compute();
+  }
+  return planner_data->context_cache->getCurrentLanes(*planner_data, compute);
 }
 
-lanelet::ConstLanelets getCurrentLanesFromPath(
-  const PathWithLaneId & path, const std::shared_ptr<const PlannerData> & planner_data)
+namespace
+{
+lanelet::ConstLanelets computeCurrentLanesFromPath(
+  const PathWithLaneId & path, const std::set<lanelet::Id> & lane_ids,
+  const std::shared_ptr<const PlannerData> & planner_data)
 {
   const auto & route_handler = planner_data->route_handler;
   const auto & current_pose = planner_data->self_odometry->pose.pose;
   const auto & p = planner_data->parameters;
 
-  std::set<lanelet::Id> lane_ids;
-  for (const auto & p : path.points) {
-    for (const auto & id : p.lane_ids) {
-      lane_ids.insert(id);
-    }
-  }
-
   lanelet::ConstLanelets reference_lanes{};
   for (const auto & id : lane_ids) {
     reference_lanes.push_back(planner_data->route_handler->getLaneletsFromId(id));
@@ -1302,6 +1323,30 @@ lanelet::ConstLanelets getCurrentLanesFromPath(
 
   return current_lanes;
 }
+}  // namespace
+
+lanelet::ConstLanelets getCurrentLanesFromPath(
+  const PathWithLaneId & path, const std::shared_ptr<const PlannerData> & planner_data)
+{
+  std::set<lanelet::Id> lane_ids;
+  for (const auto & p : path.points) {
+    for (const auto & id : p.lane_ids) {
+      lane_ids.insert(id);
+    }
+  }
+
+  if (!planner_data->context_cache) {
+    return computeCurrentLanesFromPath(path, lane_ids, planner_data);
+  }
+
+  // NOTE: the result depends on the path only through its lane ids
+  const PlanningContextCache::PathLaneIds path_lane_ids{
+    {lane_ids.begin(), lane_ids.end()},
+    {path.points.front().lane_ids.begin(), path.points.front().lane_ids.end()}};
+  return planner_data->context_cache->getCurrentLanesFromPath(
+    *planner_data, path_lane_ids,
+    [&]() { return computeCurrentLanesFromPath(path, lane_ids, planner_data); });
+}
 
 lanelet::ConstLanelets extendNextLane(
   const std::shared_ptr<RouteHandler> route_handler, const lanelet::ConstLanelets & lanes,
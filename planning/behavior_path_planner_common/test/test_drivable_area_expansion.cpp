@@ -271,3 +271,44 @@ TEST(DrivableAreaExpansionProjection, expand_drivable_area)
   EXPECT_LT(path.right_bound[1].y, -1.0);
   EXPECT_LT(path.right_bound[2].y, -1.0);
 }
+
+TEST(DrivableAreaExpansion, calculate_maximum_distance_reuse)
+{
+  using drivable_area_expansion::Point;
+  drivable_area_expansion::DrivableAreaExpansionParameters params;
+  params.avoid_linestring_dist = 0.0;
+  params.max_expansion_distance = 0.0;  // means no limit
+  params.max_path_arc_length = 10.0;
+  // left bound at Y = 1 with an uncrossable line at Y = 3
+  std::vector<Point> bound(3);
+  for (auto i = 0UL; i < bound.size(); ++i) {
+    bound[i].x = static_cast<double>(i);
+    bound[i].y = 1.0;
+  }
+  drivable_area_expansion::SegmentRtree uncrossable_segments;
+  uncrossable_segments.insert(Segment2d{Point2d{-1.0, 3.0}, Point2d{3.0, 3.0}});
+  Point ego_point;
+  drivable_area_expansion::LineDistanceCache::SegmentDistances line_distances;
+
+  const auto distances = drivable_area_expansion::calculate_maximum_distance(
+    bound, uncrossable_segments, {}, params, drivable_area_expansion::LEFT, ego_point,
+    line_distances);
+  ASSERT_EQ(distances.size(), bound.size());
+  for (const auto d : distances) EXPECT_NEAR(d, 2.0, eps);
+  EXPECT_EQ(line_distances.size(), 2ul);
+
+  // the distances are reused without the uncrossable line
+  const drivable_area_expansion::SegmentRtree no_segments;
+  const auto reused_distances = drivable_area_expansion::calculate_maximum_distance(
+    bound, no_segments, {}, params, drivable_area_expansion::LEFT, ego_point, line_distances);
+  ASSERT_EQ(reused_distances.size(), bound.size());
+  for (const auto d : reused_distances) EXPECT_NEAR(d, 2.0, eps);
+
+  // the distance is not kept when a line out of the range around ego could be closer
+  line_distances.clear();
+  ego_point.x = -6.0;
+  drivable_area_expansion::calculate_maximum_distance(
+    bound, uncrossable_segments, {}, params, drivable_area_expansion::LEFT, ego_point,
+    line_distances);
+  EXPECT_EQ(line_distances.size(), 1ul);
+}
@@ -0,0 +1,128 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "behavior_path_planner_common/utils/occupancy_grid_based_collision_detector/occupancy_grid_based_collision_detector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using behavior_path_planner::IndexXYT;
+using behavior_path_planner::OccupancyGridBasedCollisionDetector;
+using behavior_path_planner::OccupancyGridMapParam;
+
+namespace
+{
+class TestDetector : public OccupancyGridBasedCollisionDetector
+{
+public:
+  // the check of each cell of the footprint, which is the reference of detectCollision()
+  bool detectCollisionByCells(const IndexXYT & base_index) const
+  {
+    for (const auto & coll_index_2d : coll_indexes_table_[base_index.theta]) {
+      const int x = base_index.x + coll_index_2d.x;
+      const int y = base_index.y + coll_index_2d.y;
+      if (is_obstacle_table_[y][x]) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+nav_msgs::msg::OccupancyGrid createCostmap(const uint32_t width, const uint32_t height)
+{
+  nav_msgs::msg::OccupancyGrid costmap;
+  costmap.info.resolution = 0.5;
+  costmap.info.width = width;
+  costmap.info.height = height;
+  costmap.info.origin.orientation.w = 1.0;
+  costmap.data.assign(width * height, 0);
+  // scattered obstacles, unknown cells and a wall crossing the 64 cells boundary of the rows
+  for (uint32_t i = 0; i < height; ++i) {
+    for (uint32_t j = 0; j < width; ++j) {
+      if ((i * 31 + j * 17) % 97 == 0) {
+        costmap.data[i * width + j] = 100;
+      } else if ((i * 13 + j * 7) % 211 == 0) {
+        costmap.data[i * width + j] = -1;
+      }
+    }
+  }
+  for (uint32_t j = 60; j < 70; ++j) {
+    costmap.data[20 * width + j] = 100;
+  }
+  return costmap;
+}
+}  // namespace
+
+TEST(OccupancyGridBasedCollisionDetector, detectCollisionSameAsCells)
+{
+  OccupancyGridMapParam param;
+  param.vehicle_shape.length = 4.8;
+  param.vehicle_shape.width = 1.8;
+  param.vehicle_shape.base2back = 1.0;
+  param.theta_size = 16;
+  param.obstacle_threshold = 50;
+
+  TestDetector detector;
+  detector.setParam(param);
+  const int width = 150;
+  const int height = 40;
+  detector.setMap(createCostmap(width, height));
+
+  int num_collisions = 0;
+  for (int theta = 0; theta < param.theta_size; ++theta) {
+    for (int y = 0; y < height; ++y) {
+      for (int x = 0; x < width; ++x) {
+        const IndexXYT index{x, y, theta};
+        if (detector.detectCollision(index, true)) {
+          ++num_collisions;
+        }
+
+        // the footprint within the grid is checked with its masks
+        const int margin = 10;
+        const bool is_in_range =
+          margin <= x && x < width - margin && margin <= y && y < height - margin;
+        if (is_in_range) {
+          EXPECT_EQ(detector.detectCollision(index, true), detector.detectCollisionByCells(index))
+            << "x: " << x << ", y: " << y << ", theta: " << theta;
+          EXPECT_EQ(detector.detectCollision(index, false), detector.detectCollisionByCells(index))
+            << "x: " << x << ", y: " << y << ", theta: " << theta;
+        }
+      }
+    }
+  }
+  EXPECT_GT(num_collisions, 0);
+}
+
+TEST(OccupancyGridBasedCollisionDetector, detectCollisionOutOfRange)
+{
+  OccupancyGridMapParam param;
+  param.vehicle_shape.length = 4.8;
+  param.vehicle_shape.width = 1.8;
+  param.vehicle_shape.base2back = 1.0;
+  param.theta_size = 16;
+  param.obstacle_threshold = 50;
+
+  OccupancyGridBasedCollisionDetector detector;
+  detector.setParam(param);
+  nav_msgs::msg::OccupancyGrid costmap = createCostmap(100, 30);
+  std::fill(costmap.data.begin(), costmap.data.end(), 0);
+  detector.setMap(costmap);
+
+  EXPECT_FALSE(detector.detectCollision({50, 15, 0}, true));
+  EXPECT_TRUE(detector.detectCollision({0, 15, 0}, true));
+  EXPECT_FALSE(detector.detectCollision({0, 15, 0}, false));
+  EXPECT_TRUE(detector.detectCollision({99, 29, 3}, true));
+}
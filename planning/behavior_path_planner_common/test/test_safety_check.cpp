@@ -16,6 +16,7 @@
 #include "behavior_path_planner_common/utils/path_safety_checker/path_safety_checker_parameters.hpp"
 #include "behavior_path_planner_common/utils/path_safety_checker/safety_check.hpp"
 
+#include <tier4_autoware_utils/geometry/boost_polygon_utils.hpp>
 #include <tier4_autoware_utils/math/unit_conversion.hpp>
 
 #include <geometry_msgs/msg/pose.hpp>
@@ -25,6 +26,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <vector>
+
 constexpr double epsilon = 1e-6;
 
 using autoware_auto_perception_msgs::msg::Shape;
@@ -201,3 +205,71 @@ TEST(BehaviorPathPlanningSafetyUtilsTest, calcRssDistance)
     EXPECT_NEAR(calcRssDistance(front_vel, rear_vel, params), 63.75, epsilon);
   }
 }
+
+TEST(BehaviorPathPlanningSafetyUtilsTest, getCollidedPolygons)
+{
+  using behavior_path_planner::BehaviorPathPlannerParameters;
+  using behavior_path_planner::utils::path_safety_checker::ExtendedPredictedObject;
+  using behavior_path_planner::utils::path_safety_checker::getCollidedPolygons;
+  using behavior_path_planner::utils::path_safety_checker::PoseWithVelocityAndPolygonStamped;
+  using behavior_path_planner::utils::path_safety_checker::PoseWithVelocityStamped;
+  using behavior_path_planner::utils::path_safety_checker::PredictedPathWithPolygon;
+  using behavior_path_planner::utils::path_safety_checker::RSSparams;
+  using tier4_autoware_utils::createPoint;
+  using tier4_autoware_utils::createQuaternionFromYaw;
+
+  BehaviorPathPlannerParameters common_parameters;
+  common_parameters.vehicle_info.max_longitudinal_offset_m = 4.0;
+  common_parameters.vehicle_info.vehicle_width_m = 2.0;
+  common_parameters.vehicle_info.rear_overhang_m = 1.0;
+
+  RSSparams rss_parameters;
+  rss_parameters.rear_vehicle_reaction_time = 1.0;
+  rss_parameters.rear_vehicle_safety_time_margin = 1.0;
+  rss_parameters.lateral_distance_max_threshold = 1.0;
+  rss_parameters.longitudinal_distance_min_threshold = 3.0;
+  rss_parameters.front_vehicle_deceleration = -1.0;
+  rss_parameters.rear_vehicle_deceleration = -1.0;
+
+  // ego drives at 5 m/s along the x-axis
+  std::vector<PoseWithVelocityStamped> ego_path;
+  for (double t = 0.0; t < 3.0; t += 0.5) {
+    Pose pose;
+    pose.position = createPoint(5.0 * t, 0.0, 0.0);
+    pose.orientation = createQuaternionFromYaw(0.0);
+    ego_path.emplace_back(t, pose, 5.0);
+  }
+
+  ExtendedPredictedObject object;
+  object.shape.type = autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX;
+  object.shape.dimensions.x = 4.0;
+  object.shape.dimensions.y = 2.0;
+
+  // a stopped object at the given distance ahead of ego
+  const auto create_object_path = [&](const double x) {
+    PredictedPathWithPolygon path;
+    for (double t = 0.0; t < 3.0; t += 0.5) {
+      Pose pose;
+      pose.position = createPoint(x, 0.0, 0.0);
+      pose.orientation = createQuaternionFromYaw(0.0);
+      path.path.emplace_back(t, pose, 0.0, tier4_autoware_utils::toPolygon2d(pose, object.shape));
+    }
+    return path;
+  };
+
+  {
+    CollisionCheckDebug debug;
+    const auto collided_polygons = getCollidedPolygons(
+      {}, ego_path, object, create_object_path(20.0), common_parameters, rss_parameters, 1.0,
+      std::numeric_limits<double>::max(), debug);
+    EXPECT_FALSE(collided_polygons.empty());
+  }
+
+  {
+    CollisionCheckDebug debug;
+    const auto collided_polygons = getCollidedPolygons(
+      {}, ego_path, object, create_object_path(200.0), common_parameters, rss_parameters, 1.0,
+      std::numeric_limits<double>::max(), debug);
+    EXPECT_TRUE(collided_polygons.empty());
+  }
+}
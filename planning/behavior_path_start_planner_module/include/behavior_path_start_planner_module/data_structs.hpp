@@ -98,6 +98,8 @@ struct StartPlannerParameters
   double backward_search_resolution{0.0};
   double backward_path_update_duration{0.0};
   double ignore_distance_from_lane_end{0.0};
+  bool enable_parallel_pull_out_planning{false};
+  int parallel_pull_out_planning_thread_num{1};
   // freespace planner
   bool enable_freespace_planner{false};
   std::string freespace_planner_algorithm;
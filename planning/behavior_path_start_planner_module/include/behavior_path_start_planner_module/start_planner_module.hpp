@@ -95,6 +95,9 @@ public:
     if (freespace_planner_timer_) {
       freespace_planner_timer_->cancel();
     }
+    if (pull_out_planner_timer_) {
+      pull_out_planner_timer_->cancel();
+    }
 
     while (is_freespace_planner_cb_running_.load()) {
       RCLCPP_INFO_THROTTLE(
@@ -103,6 +106,12 @@ public:
     }
 
     RCLCPP_INFO_THROTTLE(getLogger(), *clock_, 1000, "freespace planner callback finished");
+
+    while (is_pull_out_planner_cb_running_.load()) {
+      RCLCPP_INFO_THROTTLE(
+        getLogger(), *clock_, 1000, "Waiting for pull out planner callback to finish...");
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
   }
 
   void updateModuleParams(const std::any & parameters) override
@@ -171,7 +180,28 @@ private:
       const ModuleStatus & current_status, const PullOutStatus & pull_out_status,
       const bool is_stopped);
   };
+  // search of the pull out path requested to the pull out planner thread
+  struct PullOutSearchRequest
+  {
+    size_t generation{0};
+    std::vector<Pose> start_pose_candidates;
+    Pose refined_start_pose;
+    Pose goal_pose;
+  };
+  // pull out path found by the pull out planner thread
+  struct PullOutSearchResult
+  {
+    size_t generation{0};
+    std::optional<PullOutPath> pull_out_path{std::nullopt};  // std::nullopt if not found
+    Pose start_pose;
+    PlannerType planner_type{PlannerType::NONE};
+    bool backward_is_unnecessary{false};
+    size_t start_pose_candidate_index{0};
+    double collision_check_margin{0.0};
+  };
   std::optional<PullOutStatus> freespace_thread_status_{std::nullopt};
+  std::optional<PullOutSearchRequest> pull_out_search_request_{std::nullopt};
+  std::optional<PullOutSearchResult> pull_out_search_result_{std::nullopt};
   std::optional<StartPlannerData> start_planner_data_{std::nullopt};
   std::mutex start_planner_data_mutex_;
 
@@ -276,6 +306,15 @@ private:
   rclcpp::CallbackGroup::SharedPtr freespace_planner_timer_cb_group_;
   std::atomic<bool> is_freespace_planner_cb_running_;
 
+  // search the pull out paths of the shift and geometric planners in a separate thread
+  // NOTE: each element has its own instances of start_planners_, so that they run in parallel
+  std::vector<std::vector<std::shared_ptr<PullOutPlannerBase>>> parallel_start_planners_;
+  rclcpp::TimerBase::SharedPtr pull_out_planner_timer_;
+  rclcpp::CallbackGroup::SharedPtr pull_out_planner_timer_cb_group_;
+  std::atomic<bool> is_pull_out_planner_cb_running_;
+  // the results of the searches requested before the last reset of the status are discarded
+  size_t pull_out_search_generation_{0};
+
   // TODO(kosuke55)
   // Currently, we only do lock when updating a member of status_.
   // However, we need to ensure that the value does not change when referring to it.
@@ -296,10 +335,12 @@ private:
   void planWithPriority(
     const std::vector<Pose> & start_pose_candidates, const Pose & refined_start_pose,
     const Pose & goal_pose, const std::string search_priority);
+  bool applyPullOutSearchResult();
   PathWithLaneId generateStopPath() const;
   lanelet::ConstLanelets getPathRoadLanes(const PathWithLaneId & path) const;
   std::vector<DrivableLanes> generateDrivableLanes(const PathWithLaneId & path) const;
   void updatePullOutStatus();
+  void updateBackwardPath();
   void updateStatusAfterBackwardDriving();
   PredictedObjects filterStopObjectsInPullOutLanes(
     const lanelet::ConstLanelets & pull_out_lanes, const geometry_msgs::msg::Point & current_pose,
@@ -324,6 +365,12 @@ private:
   BehaviorModuleOutput generateStopOutput();
 
   SafetyCheckParams createSafetyCheckParams() const;
+  // pull out planner
+  void onPullOutPlannerTimer();
+  PullOutSearchResult searchPullOutPath(
+    const PullOutSearchRequest & request, const StartPlannerParameters & parameters,
+    const std::shared_ptr<const PlannerData> & planner_data);
+
   // freespace planner
   void onFreespacePlannerTimer();
   std::optional<PullOutStatus> planFreespacePath(
@@ -116,6 +116,10 @@ void StartPlannerModuleManager::init(rclcpp::Node * node)
     node->declare_parameter<double>(ns + "backward_path_update_duration");
   p.ignore_distance_from_lane_end =
     node->declare_parameter<double>(ns + "ignore_distance_from_lane_end");
+  p.enable_parallel_pull_out_planning =
+    node->declare_parameter<bool>(ns + "enable_parallel_pull_out_planning");
+  p.parallel_pull_out_planning_thread_num =
+    node->declare_parameter<int>(ns + "parallel_pull_out_planning_thread_num");
   // freespace planner general params
   {
     const std::string ns = "start_planner.freespace_planner.";
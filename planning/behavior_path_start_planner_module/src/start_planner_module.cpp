@@ -34,6 +34,7 @@
 #include <lanelet2_core/geometry/Lanelet.h>
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
@@ -52,6 +53,17 @@ using tier4_autoware_utils::calcOffsetPose;
 
 namespace behavior_path_planner
 {
+namespace
+{
+// if start_pose_candidate is far from refined_start_pose, backward driving is necessary
+bool isBackwardDrivingUnnecessary(
+  const Pose & start_pose_candidate, const Pose & refined_start_pose)
+{
+  constexpr double epsilon = 0.01;
+  return tier4_autoware_utils::calcDistance2d(start_pose_candidate, refined_start_pose) < epsilon;
+}
+}  // namespace
+
 StartPlannerModule::StartPlannerModule(
   const std::string & name, rclcpp::Node & node,
   const std::shared_ptr<StartPlannerParameters> & parameters,
@@ -61,24 +73,44 @@ StartPlannerModule::StartPlannerModule(
 : SceneModuleInterface{name, node, rtc_interface_ptr_map, objects_of_interest_marker_interface_ptr_map},  // NOLINT
   parameters_{parameters},
   vehicle_info_{vehicle_info_util::VehicleInfoUtil(node).getVehicleInfo()},
-  is_freespace_planner_cb_running_{false}
+  is_freespace_planner_cb_running_{false},
+  is_pull_out_planner_cb_running_{false}
 {
   lane_departure_checker_ = std::make_shared<LaneDepartureChecker>();
   lane_departure_checker_->setVehicleInfo(vehicle_info_);
 
   // set enabled planner
-  if (parameters_->enable_shift_pull_out) {
-    start_planners_.push_back(
-      std::make_shared<ShiftPullOut>(node, *parameters, lane_departure_checker_));
-  }
-  if (parameters_->enable_geometric_pull_out) {
-    start_planners_.push_back(
-      std::make_shared<GeometricPullOut>(node, *parameters, lane_departure_checker_));
-  }
+  const auto create_start_planners = [&]() {
+    std::vector<std::shared_ptr<PullOutPlannerBase>> start_planners;
+    if (parameters_->enable_shift_pull_out) {
+      start_planners.push_back(
+        std::make_shared<ShiftPullOut>(node, *parameters, lane_departure_checker_));
+    }
+    if (parameters_->enable_geometric_pull_out) {
+      start_planners.push_back(
+        std::make_shared<GeometricPullOut>(node, *parameters, lane_departure_checker_));
+    }
+    return start_planners;
+  };
+  start_planners_ = create_start_planners();
   if (start_planners_.empty()) {
     RCLCPP_ERROR(getLogger(), "Not found enabled planner");
   }
 
+  if (parameters_->enable_parallel_pull_out_planning && !start_planners_.empty()) {
+    const int thread_num = std::max(parameters_->parallel_pull_out_planning_thread_num, 1);
+    for (int i = 0; i < thread_num; ++i) {
+      parallel_start_planners_.push_back(create_start_planners());
+    }
+    const auto pull_out_planner_period_ns = rclcpp::Rate(10.0).period();
+    pull_out_planner_timer_cb_group_ =
+      node.create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    pull_out_planner_timer_ = rclcpp::create_timer(
+      &node, clock_, pull_out_planner_period_ns,
+      std::bind(&StartPlannerModule::onPullOutPlannerTimer, this),
+      pull_out_planner_timer_cb_group_);
+  }
+
   if (parameters_->enable_freespace_planner) {
     freespace_planner_ = std::make_unique<FreespacePullOut>(node, *parameters, vehicle_info_);
     const auto freespace_planner_period_ns = rclcpp::Rate(1.0).period();
@@ -148,6 +180,86 @@ void StartPlannerModule::onFreespacePlannerTimer()
   }
 }
 
+void StartPlannerModule::onPullOutPlannerTimer()
+{
+  const ScopedFlag flag(is_pull_out_planner_cb_running_);
+
+  std::optional<PullOutSearchRequest> request_opt{std::nullopt};
+  std::shared_ptr<const PlannerData> local_planner_data{nullptr};
+  std::optional<StartPlannerParameters> parameters_opt{std::nullopt};
+
+  // making a local copy of thread sensitive data
+  {
+    std::lock_guard<std::mutex> guard(start_planner_data_mutex_);
+    if (start_planner_data_ && pull_out_search_request_) {
+      request_opt.swap(pull_out_search_request_);
+      const auto & start_planner_data = start_planner_data_.value();
+      local_planner_data = std::make_shared<PlannerData>(start_planner_data.planner_data);
+      parameters_opt = start_planner_data.parameters;
+    }
+  }
+  // finish copying thread sensitive data
+  if (!request_opt || !local_planner_data || !parameters_opt) {
+    return;
+  }
+
+  const auto search_result =
+    searchPullOutPath(request_opt.value(), parameters_opt.value(), local_planner_data);
+  std::lock_guard<std::mutex> guard(start_planner_data_mutex_);
+  pull_out_search_result_ = search_result;
+}
+
+StartPlannerModule::PullOutSearchResult StartPlannerModule::searchPullOutPath(
+  const PullOutSearchRequest & request, const StartPlannerParameters & parameters,
+  const std::shared_ptr<const PlannerData> & planner_data)
+{
+  PullOutSearchResult search_result;
+  search_result.generation = request.generation;
+
+  const PriorityOrder order_priority =
+    determinePriorityOrder(parameters.search_priority, request.start_pose_candidates.size());
+
+  // the pairs of the priority order are planned in parallel batch by batch, and the first one
+  // found in the order is adopted, so that the result is the same as planWithPriority()
+  const size_t batch_size = parallel_start_planners_.size();
+  for (const auto & collision_check_margin : parameters.collision_check_margins) {
+    for (size_t batch_begin = 0; batch_begin < order_priority.size(); batch_begin += batch_size) {
+      const size_t batch_end = std::min(batch_begin + batch_size, order_priority.size());
+      std::vector<std::future<std::optional<PullOutPath>>> pull_out_path_futures;
+      for (size_t i = batch_begin; i < batch_end; ++i) {
+        const size_t index = order_priority.at(i).first;
+        const auto planner_index = std::distance(
+          start_planners_.begin(),
+          std::find(start_planners_.begin(), start_planners_.end(), order_priority.at(i).second));
+        const auto planner = parallel_start_planners_.at(i - batch_begin).at(planner_index);
+        pull_out_path_futures.push_back(std::async(std::launch::async, [&, index, planner]() {
+          planner->setCollisionCheckMargin(collision_check_margin);
+          planner->setPlannerData(planner_data);
+          return planner->plan(request.start_pose_candidates.at(index), request.goal_pose);
+        }));
+      }
+
+      for (size_t i = batch_begin; i < batch_end; ++i) {
+        auto pull_out_path = pull_out_path_futures.at(i - batch_begin).get();
+        if (!pull_out_path) {
+          continue;
+        }
+        const auto & [index, planner] = order_priority.at(i);
+        search_result.pull_out_path = pull_out_path;
+        search_result.start_pose = request.start_pose_candidates.at(index);
+        search_result.planner_type = planner->getPlannerType();
+        search_result.backward_is_unnecessary =
+          isBackwardDrivingUnnecessary(search_result.start_pose, request.refined_start_pose);
+        search_result.start_pose_candidate_index = index;
+        search_result.collision_check_margin = collision_check_margin;
+        return search_result;
+      }
+    }
+  }
+
+  return search_result;
+}
+
 BehaviorModuleOutput StartPlannerModule::run()
 {
   updateData();
@@ -786,6 +898,7 @@ BehaviorModuleOutput StartPlannerModule::planWaitingApproval()
 void StartPlannerModule::resetStatus()
 {
   status_ = PullOutStatus{};
+  ++pull_out_search_generation_;
 }
 
 void StartPlannerModule::incrementPathIndex()
@@ -826,6 +939,37 @@ void StartPlannerModule::planWithPriority(
   updateStatusIfNoSafePathFound();
 }
 
+bool StartPlannerModule::applyPullOutSearchResult()
+{
+  std::optional<PullOutSearchResult> search_result{std::nullopt};
+  {
+    std::lock_guard<std::mutex> guard(start_planner_data_mutex_);
+    search_result.swap(pull_out_search_result_);
+  }
+  if (!search_result || search_result->generation != pull_out_search_generation_) {
+    return false;
+  }
+  if (status_.backward_driving_complete) {
+    return false;
+  }
+
+  if (!search_result->pull_out_path) {
+    updateStatusIfNoSafePathFound();
+    return true;
+  }
+
+  if (search_result->backward_is_unnecessary) {
+    updateStatusWithCurrentPath(
+      *search_result->pull_out_path, search_result->start_pose, search_result->planner_type);
+  } else {
+    updateStatusWithNextPath(
+      *search_result->pull_out_path, search_result->start_pose, search_result->planner_type);
+  }
+  debug_data_.selected_start_pose_candidate_index = search_result->start_pose_candidate_index;
+  debug_data_.margin_for_start_pose_candidate = search_result->collision_check_margin;
+  return true;
+}
+
 PriorityOrder StartPlannerModule::determinePriorityOrder(
   const std::string & search_priority, const size_t start_pose_candidates_num)
 {
@@ -857,10 +1001,8 @@ bool StartPlannerModule::findPullOutPath(
   const Pose & start_pose_candidate, const std::shared_ptr<PullOutPlannerBase> & planner,
   const Pose & refined_start_pose, const Pose & goal_pose, const double collision_check_margin)
 {
-  // if start_pose_candidate is far from refined_start_pose, backward driving is necessary
-  constexpr double epsilon = 0.01;
   const bool backward_is_unnecessary =
-    tier4_autoware_utils::calcDistance2d(start_pose_candidate, refined_start_pose) < epsilon;
+    isBackwardDrivingUnnecessary(start_pose_candidate, refined_start_pose);
 
   planner->setCollisionCheckMargin(collision_check_margin);
   planner->setPlannerData(planner_data_);
@@ -998,6 +1140,9 @@ std::vector<DrivableLanes> StartPlannerModule::generateDrivableLanes(
 
 void StartPlannerModule::updatePullOutStatus()
 {
+  // the path found by the pull out planner thread is applied as soon as it is ready
+  const bool is_search_result_applied = pull_out_planner_timer_ && applyPullOutSearchResult();
+
   // skip updating if enough time has not passed for preventing chattering between back and
   // start_planner
   if (!receivedNewRoute()) {
@@ -1006,13 +1151,14 @@ void StartPlannerModule::updatePullOutStatus()
     }
     const auto elapsed_time = (clock_->now() - *last_pull_out_start_update_time_).seconds();
     if (elapsed_time < parameters_->backward_path_update_duration) {
+      if (is_search_result_applied) {
+        updateBackwardPath();
+      }
       return;
     }
   }
   last_pull_out_start_update_time_ = std::make_unique<rclcpp::Time>(clock_->now());
 
-  const auto & route_handler = planner_data_->route_handler;
-  const auto & current_pose = planner_data_->self_odometry->pose.pose;
   const auto & goal_pose = planner_data_->route_handler->getGoalPose();
 
   // refine start pose with pull out lanes.
@@ -1032,12 +1178,28 @@ void StartPlannerModule::updatePullOutStatus()
   });
 
   if (!status_.backward_driving_complete) {
-    planWithPriority(
-      start_pose_candidates, *refined_start_pose, goal_pose, parameters_->search_priority);
+    if (pull_out_planner_timer_) {
+      // the main cycle only requests the search, and the path is applied when it is found
+      if (!start_pose_candidates.empty()) {
+        std::lock_guard<std::mutex> guard(start_planner_data_mutex_);
+        pull_out_search_request_ = PullOutSearchRequest{
+          pull_out_search_generation_, start_pose_candidates, *refined_start_pose, goal_pose};
+      }
+    } else {
+      planWithPriority(
+        start_pose_candidates, *refined_start_pose, goal_pose, parameters_->search_priority);
+    }
   }
 
   debug_data_.refined_start_pose = *refined_start_pose;
   debug_data_.start_pose_candidates = start_pose_candidates;
+  updateBackwardPath();
+}
+
+void StartPlannerModule::updateBackwardPath()
+{
+  const auto & route_handler = planner_data_->route_handler;
+  const auto & current_pose = planner_data_->self_odometry->pose.pose;
   const auto pull_out_lanes = start_planner_utils::getPullOutLanes(
     planner_data_, planner_data_->parameters.backward_path_length + parameters_->max_back_distance);
 
@@ -1048,7 +1210,6 @@ void StartPlannerModule::updatePullOutStatus()
   status_.backward_path = start_planner_utils::getBackwardPath(
     *route_handler, pull_out_lanes, current_pose, status_.pull_out_start_pose,
     parameters_->backward_velocity);
-  return;
 }
 
 void StartPlannerModule::updateStatusAfterBackwardDriving()
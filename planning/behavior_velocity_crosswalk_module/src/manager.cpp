@@ -166,6 +166,10 @@ CrosswalkModuleManager::CrosswalkModuleManager(rclcpp::Node & node)
   }
   cp.occlusion_extra_objects_size =
     getOrDeclareParameter<double>(node, ns + ".occlusion.extra_predicted_objects_size");
+
+  collision_info_pub_ =
+    node.create_publisher<tier4_debug_msgs::msg::StringStamped>("~/debug/collision_info", 1);
+  occupancy_grid_map_cache_ = std::make_shared<CrosswalkModule::OccupancyGridMapCache>();
 }
 
 void CrosswalkModuleManager::launchNewModules(const PathWithLaneId & path)
@@ -186,8 +190,8 @@ void CrosswalkModuleManager::launchNewModules(const PathWithLaneId & path)
     // NOTE: module_id is always a lane id so that isModuleRegistered works correctly in the case
     //       where both regulatory element and non-regulatory element crosswalks exist.
     registerModule(std::make_shared<CrosswalkModule>(
-      node_, road_lanelet_id, crosswalk_lanelet_id, reg_elem_id, lanelet_map_ptr, p, logger,
-      clock_));
+      collision_info_pub_, occupancy_grid_map_cache_, road_lanelet_id, crosswalk_lanelet_id,
+      reg_elem_id, lanelet_map_ptr, p, logger, clock_));
     generateUUID(crosswalk_lanelet_id);
     updateRTCStatus(
       getUUID(crosswalk_lanelet_id), true, State::WAITING_FOR_EXECUTION,
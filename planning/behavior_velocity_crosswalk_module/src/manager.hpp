@@ -47,6 +47,11 @@ public:
 private:
   CrosswalkModule::PlannerParam crosswalk_planner_param_{};
 
+  // NOTE: the publishers of the modules are created once here, since the modules can be launched
+  // in parallel with the ones of the other managers.
+  rclcpp::Publisher<tier4_debug_msgs::msg::StringStamped>::SharedPtr collision_info_pub_;
+  std::shared_ptr<CrosswalkModule::OccupancyGridMapCache> occupancy_grid_map_cache_;
+
   void launchNewModules(const PathWithLaneId & path) override;
 
   std::function<bool(const std::shared_ptr<SceneModuleInterface> &)> getModuleExpiredFunction(
@@ -16,7 +16,6 @@
 
 #include "behavior_velocity_crosswalk_module/util.hpp"
 
-#include <grid_map_ros/GridMapRosConverter.hpp>
 #include <grid_map_utils/polygon_iterator.hpp>
 
 #include <algorithm>
@@ -136,30 +135,35 @@ void clear_occlusions_behind_objects(
 }
 
 bool is_crosswalk_occluded(
-  const lanelet::ConstLanelet & crosswalk_lanelet,
-  const nav_msgs::msg::OccupancyGrid & occupancy_grid,
+  const lanelet::ConstLanelet & crosswalk_lanelet, const grid_map::GridMap & grid_map,
   const geometry_msgs::msg::Point & path_intersection, const double detection_range,
   const std::vector<autoware_auto_perception_msgs::msg::PredictedObject> & dynamic_objects,
   const behavior_velocity_planner::CrosswalkModule::PlannerParam & params)
 {
-  grid_map::GridMap grid_map;
-  grid_map::GridMapRosConverter::fromOccupancyGrid(occupancy_grid, "layer", grid_map);
+  const auto min_nb_of_cells = std::ceil(params.occlusion_min_size / grid_map.getResolution());
+  const auto is_occluded_in_detection_areas = [&](const grid_map::GridMap & map) {
+    for (const auto & detection_area : calculate_detection_areas(
+           crosswalk_lanelet, {path_intersection.x, path_intersection.y}, detection_range)) {
+      grid_map::Polygon poly;
+      for (const auto & p : detection_area) poly.addVertex(grid_map::Position(p.x(), p.y()));
+      for (grid_map_utils::PolygonIterator iter(map, poly); !iter.isPastEnd(); ++iter)
+        if (is_occluded(map, min_nb_of_cells, *iter, params)) return true;
+    }
+    return false;
+  };
 
   if (params.occlusion_ignore_behind_predicted_objects) {
     const auto objects = select_and_inflate_objects(
       dynamic_objects, params.occlusion_ignore_velocity_thresholds,
       params.occlusion_extra_objects_size);
-    clear_occlusions_behind_objects(grid_map, objects);
-  }
-  const auto min_nb_of_cells = std::ceil(params.occlusion_min_size / grid_map.getResolution());
-  for (const auto & detection_area : calculate_detection_areas(
-         crosswalk_lanelet, {path_intersection.x, path_intersection.y}, detection_range)) {
-    grid_map::Polygon poly;
-    for (const auto & p : detection_area) poly.addVertex(grid_map::Position(p.x(), p.y()));
-    for (grid_map_utils::PolygonIterator iter(grid_map, poly); !iter.isPastEnd(); ++iter)
-      if (is_occluded(grid_map, min_nb_of_cells, *iter, params)) return true;
+    if (!objects.empty()) {
+      // the grid map is shared by the modules, so the occlusions are cleared on a copy of it
+      grid_map::GridMap cleared_grid_map = grid_map;
+      clear_occlusions_behind_objects(cleared_grid_map, objects);
+      return is_occluded_in_detection_areas(cleared_grid_map);
+    }
   }
-  return false;
+  return is_occluded_in_detection_areas(grid_map);
 }
 
 double calculate_detection_range(
@@ -51,15 +51,14 @@ lanelet::BasicPoint2d interpolate_point(
 
 /// @brief check if the crosswalk is occluded
 /// @param crosswalk_lanelet lanelet of the crosswalk
-/// @param occupancy_grid occupancy grid with the occlusion information
+/// @param grid_map occupancy grid with the occlusion information, converted to a grid map
 /// @param path_intersection intersection between the crosswalk and the ego path
 /// @param detection_range range away from the crosswalk until occlusions are considered
 /// @param dynamic_objects dynamic objects
 /// @param params parameters
 /// @return true if the crosswalk is occluded
 bool is_crosswalk_occluded(
-  const lanelet::ConstLanelet & crosswalk_lanelet,
-  const nav_msgs::msg::OccupancyGrid & occupancy_grid,
+  const lanelet::ConstLanelet & crosswalk_lanelet, const grid_map::GridMap & grid_map,
   const geometry_msgs::msg::Point & path_intersection, const double detection_range,
   const std::vector<autoware_auto_perception_msgs::msg::PredictedObject> & dynamic_objects,
   const behavior_velocity_planner::CrosswalkModule::PlannerParam & params);
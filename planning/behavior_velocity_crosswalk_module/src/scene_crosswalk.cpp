@@ -19,6 +19,7 @@
 #include <autoware_auto_tf2/tf2_autoware_auto_msgs.hpp>
 #include <behavior_velocity_planner_common/utilization/path_utilization.hpp>
 #include <behavior_velocity_planner_common/utilization/util.hpp>
+#include <grid_map_ros/GridMapRosConverter.hpp>
 #include <motion_utils/distance/distance.hpp>
 #include <motion_utils/resample/resample.hpp>
 #include <motion_utils/trajectory/trajectory.hpp>
@@ -171,15 +172,19 @@ tier4_debug_msgs::msg::StringStamped createStringStampedMessage(
 }  // namespace
 
 CrosswalkModule::CrosswalkModule(
-  rclcpp::Node & node, const int64_t lane_id, const int64_t module_id,
-  const std::optional<int64_t> & reg_elem_id, const lanelet::LaneletMapPtr & lanelet_map_ptr,
-  const PlannerParam & planner_param, const rclcpp::Logger & logger,
-  const rclcpp::Clock::SharedPtr clock)
+  const rclcpp::Publisher<tier4_debug_msgs::msg::StringStamped>::SharedPtr & collision_info_pub,
+  const std::shared_ptr<OccupancyGridMapCache> & occupancy_grid_map_cache, const int64_t lane_id,
+  const int64_t module_id, const std::optional<int64_t> & reg_elem_id,
+  const lanelet::LaneletMapPtr & lanelet_map_ptr, const PlannerParam & planner_param,
+  const rclcpp::Logger & logger, const rclcpp::Clock::SharedPtr clock)
 : SceneModuleInterface(module_id, logger, clock),
   module_id_(module_id),
   planner_param_(planner_param),
   use_regulatory_element_(reg_elem_id)
 {
+  collision_info_pub_ = collision_info_pub;
+  occupancy_grid_map_cache_ = occupancy_grid_map_cache;
+
   velocity_factor_.init(PlanningBehavior::CROSSWALK);
   passed_safety_slow_point_ = false;
 
@@ -197,9 +202,6 @@ CrosswalkModule::CrosswalkModule(
   }
 
   road_ = lanelet_map_ptr->laneletLayer.get(lane_id);
-
-  collision_info_pub_ =
-    node.create_publisher<tier4_debug_msgs::msg::StringStamped>("~/debug/collision_info", 1);
 }
 
 bool CrosswalkModule::modifyPathVelocity(PathWithLaneId * path, StopReason * stop_reason)
@@ -256,8 +258,14 @@ bool CrosswalkModule::modifyPathVelocity(PathWithLaneId * path, StopReason * sto
     const auto is_ego_on_the_crosswalk =
       dist_ego_to_crosswalk <= planner_data_->vehicle_info_.max_longitudinal_offset_m;
     if (!is_ego_on_the_crosswalk) {
+      const auto occupancy_grid_map = occupancy_grid_map_cache_->get(
+        planner_data_->occupancy_grid, [](const nav_msgs::msg::OccupancyGrid & occupancy_grid) {
+          grid_map::GridMap grid_map;
+          grid_map::GridMapRosConverter::fromOccupancyGrid(occupancy_grid, "layer", grid_map);
+          return grid_map;
+        });
       if (is_crosswalk_occluded(
-            crosswalk_, *planner_data_->occupancy_grid, path_intersects.front(), detection_range,
+            crosswalk_, *occupancy_grid_map, path_intersects.front(), detection_range,
             objects_ptr->objects, planner_param_)) {
         if (!current_initial_occlusion_time_) current_initial_occlusion_time_ = now;
         if (cmp_with_time_buffer(current_initial_occlusion_time_, std::greater_equal<double>{}))
@@ -376,9 +384,12 @@ std::optional<StopFactor> CrosswalkModule::checkStopForCrosswalkUsers(
   // Get attention area, which is ego's footprints on the crosswalk
   const auto attention_area = getAttentionArea(sparse_resample_path, crosswalk_attention_range);
 
+  // NOTE: the arc lengths along the sparse path are queried for each object
+  const PathArcLength sparse_resample_path_arc_length(sparse_resample_path.points);
+
   // Update object state
   updateObjectState(
-    dist_ego_to_stop, sparse_resample_path, crosswalk_attention_range, attention_area);
+    dist_ego_to_stop, sparse_resample_path_arc_length, crosswalk_attention_range, attention_area);
 
   // Check if ego moves forward enough to ignore yield.
   const auto & p = planner_param_;
@@ -425,9 +436,9 @@ std::optional<StopFactor> CrosswalkModule::checkStopForCrosswalkUsers(
 
       stop_factor_points.push_back(object.position);
 
-      const auto dist_ego2cp =
-        calcSignedArcLength(sparse_resample_path.points, ego_pos, collision_point.collision_point) -
-        planner_param_.stop_distance_from_object;
+      const auto dist_ego2cp = sparse_resample_path_arc_length.calcSignedArcLength(
+                                 ego_pos, collision_point.collision_point) -
+                               planner_param_.stop_distance_from_object;
       if (!nearest_stop_info || dist_ego2cp - base_link2front < nearest_stop_info->second) {
         nearest_stop_info =
           std::make_pair(collision_point.collision_point, dist_ego2cp - base_link2front);
@@ -708,7 +719,7 @@ std::optional<double> CrosswalkModule::findObjectPassageDirectionAlongVehicleLan
 }
 
 std::optional<CollisionPoint> CrosswalkModule::getCollisionPoint(
-  const PathWithLaneId & ego_path, const PredictedObject & object,
+  const PathArcLength & ego_path_arc_length, const PredictedObject & object,
   const std::pair<double, double> & crosswalk_attention_range, const Polygon2d & attention_area)
 {
   stop_watch_.tic(__func__);
@@ -721,6 +732,17 @@ std::optional<CollisionPoint> CrosswalkModule::getCollisionPoint(
   const auto obj_polygon =
     createObjectPolygon(object.shape.dimensions.x, object.shape.dimensions.y);
 
+  // NOTE: the points of the predicted paths far from the attention area are rejected by its
+  // bounding box before the object polygons are created.
+  const auto attention_area_box = bg::return_envelope<tier4_autoware_utils::Box2d>(attention_area);
+  const double obj_radius = std::hypot(object.shape.dimensions.x, object.shape.dimensions.y) / 2.0;
+  const auto is_near_attention_area = [&](const geometry_msgs::msg::Point & p) {
+    return attention_area_box.min_corner().x() - obj_radius <= p.x &&
+           p.x <= attention_area_box.max_corner().x() + obj_radius &&
+           attention_area_box.min_corner().y() - obj_radius <= p.y &&
+           p.y <= attention_area_box.max_corner().y() + obj_radius;
+  };
+
   double minimum_stop_dist = std::numeric_limits<double>::max();
   std::optional<CollisionPoint> nearest_collision_point{std::nullopt};
   for (const auto & obj_path : object.kinematics.predicted_paths) {
@@ -728,10 +750,14 @@ std::optional<CollisionPoint> CrosswalkModule::getCollisionPoint(
     bool is_start_idx_initialized{false};
     for (size_t i = 0; i < obj_path.path.size(); ++i) {
       // For effective computation, the point and polygon intersection is calculated first.
-      const auto obj_one_step_polygon = createMultiStepPolygon(obj_path.path, obj_polygon, i, i);
-      const auto one_step_intersection_polygons =
-        calcOverlappingPoints(obj_one_step_polygon, attention_area);
-      if (!one_step_intersection_polygons.empty()) {
+      const bool is_one_step_intersected = [&]() {
+        if (!is_near_attention_area(obj_path.path.at(i).position)) {
+          return false;
+        }
+        const auto obj_one_step_polygon = createMultiStepPolygon(obj_path.path, obj_polygon, i, i);
+        return !calcOverlappingPoints(obj_one_step_polygon, attention_area).empty();
+      }();
+      if (is_one_step_intersected) {
         if (!is_start_idx_initialized) {
           start_idx = i;
           is_start_idx_initialized = true;
@@ -770,7 +796,7 @@ std::optional<CollisionPoint> CrosswalkModule::getCollisionPoint(
         boost_intersection_center_point.x(), boost_intersection_center_point.y(), ego_pos.z);
 
       const auto dist_ego2cp =
-        calcSignedArcLength(ego_path.points, ego_pos, intersection_center_point);
+        ego_path_arc_length.calcSignedArcLength(ego_pos, intersection_center_point);
       constexpr double eps = 1e-3;
       const auto dist_obj2cp =
         calcArcLength(obj_path.path) < eps
@@ -1033,7 +1059,7 @@ std::optional<StopFactor> CrosswalkModule::getNearestStopFactor(
 }
 
 void CrosswalkModule::updateObjectState(
-  const double dist_ego_to_stop, const PathWithLaneId & sparse_resample_path,
+  const double dist_ego_to_stop, const PathArcLength & sparse_resample_path_arc_length,
   const std::pair<double, double> & crosswalk_attention_range, const Polygon2d & attention_area)
 {
   const auto & objects_ptr = planner_data_->predicted_objects;
@@ -1053,6 +1079,8 @@ void CrosswalkModule::updateObjectState(
   const auto ignore_crosswalk = isRedSignalForPedestrians();
   debug_data_.ignore_crosswalk = ignore_crosswalk;
 
+  const auto crosswalk_polygon = crosswalk_.polygon2d().basicPolygon();
+
   // Update object state
   object_info_manager_.init();
   for (const auto & object : objects_ptr->objects) {
@@ -1069,11 +1097,12 @@ void CrosswalkModule::updateObjectState(
     }
 
     const auto collision_point =
-      getCollisionPoint(sparse_resample_path, object, crosswalk_attention_range, attention_area);
+      getCollisionPoint(
+        sparse_resample_path_arc_length, object, crosswalk_attention_range, attention_area);
     object_info_manager_.update(
       obj_uuid, obj_pos, std::hypot(obj_vel.x, obj_vel.y), clock_->now(), is_ego_yielding,
       has_traffic_light, collision_point, object.classification.front().label, planner_param_,
-      crosswalk_.polygon2d().basicPolygon(), attention_area);
+      crosswalk_polygon, attention_area);
 
     const auto collision_state = object_info_manager_.getCollisionState(obj_uuid);
     if (collision_point) {
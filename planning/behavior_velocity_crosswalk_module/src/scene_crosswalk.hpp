@@ -18,6 +18,9 @@
 #include "behavior_velocity_crosswalk_module/util.hpp"
 
 #include <behavior_velocity_planner_common/scene_module_interface.hpp>
+#include <behavior_velocity_planner_common/utilization/occupancy_grid_cache.hpp>
+#include <behavior_velocity_planner_common/utilization/path_arc_length.hpp>
+#include <grid_map_core/GridMap.hpp>
 #include <lanelet2_extension/regulatory_elements/crosswalk.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <tier4_autoware_utils/geometry/boost_geometry.hpp>
@@ -318,8 +321,13 @@ public:
     std::vector<std::string> current_uuids_;
   };
 
+  // occupancy grid converted to a grid map, which is shared by the modules
+  using OccupancyGridMapCache = OccupancyGridCache<grid_map::GridMap>;
+
   CrosswalkModule(
-    rclcpp::Node & node, const int64_t lane_id, const int64_t module_id,
+    const rclcpp::Publisher<tier4_debug_msgs::msg::StringStamped>::SharedPtr & collision_info_pub,
+    const std::shared_ptr<OccupancyGridMapCache> & occupancy_grid_map_cache,
+    const int64_t lane_id, const int64_t module_id,
     const std::optional<int64_t> & reg_elem_id, const lanelet::LaneletMapPtr & lanelet_map_ptr,
     const PlannerParam & planner_param, const rclcpp::Logger & logger,
     const rclcpp::Clock::SharedPtr clock);
@@ -356,7 +364,7 @@ private:
     const autoware_auto_perception_msgs::msg::PredictedPath & path) const;
 
   std::optional<CollisionPoint> getCollisionPoint(
-    const PathWithLaneId & ego_path, const PredictedObject & object,
+    const PathArcLength & ego_path_arc_length, const PredictedObject & object,
     const std::pair<double, double> & crosswalk_attention_range, const Polygon2d & attention_area);
 
   std::optional<StopFactor> getNearestStopFactor(
@@ -406,7 +414,7 @@ private:
     const std::vector<geometry_msgs::msg::Point> & path_intersects) const;
 
   void updateObjectState(
-    const double dist_ego_to_stop, const PathWithLaneId & sparse_resample_path,
+    const double dist_ego_to_stop, const PathArcLength & sparse_resample_path_arc_length,
     const std::pair<double, double> & crosswalk_attention_range, const Polygon2d & attention_area);
 
   bool isRedSignalForPedestrians() const;
@@ -432,6 +440,8 @@ private:
 
   rclcpp::Publisher<tier4_debug_msgs::msg::StringStamped>::SharedPtr collision_info_pub_;
 
+  std::shared_ptr<OccupancyGridMapCache> occupancy_grid_map_cache_;
+
   lanelet::ConstLanelet crosswalk_;
 
   lanelet::ConstLanelet road_;
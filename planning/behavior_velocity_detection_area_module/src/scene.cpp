@@ -278,21 +278,14 @@ std::vector<geometry_msgs::msg::Point> DetectionAreaModule::getObstaclePoints()
   std::vector<geometry_msgs::msg::Point> obstacle_points;
 
   const auto detection_areas = detection_area_reg_elem_.detectionAreas();
-  const auto & points = *(planner_data_->no_ground_pointcloud);
+  const auto & grid = *(planner_data_->no_ground_pointcloud_grid);
 
   for (const auto & detection_area : detection_areas) {
     const auto poly = lanelet::utils::to2D(detection_area);
-    const auto circle = calcSmallestEnclosingCircle(poly);
-    for (const auto p : points) {
-      const double squared_dist = (circle.first.x() - p.x) * (circle.first.x() - p.x) +
-                                  (circle.first.y() - p.y) * (circle.first.y() - p.y);
-      if (squared_dist <= circle.second) {
-        if (bg::within(Point2d{p.x, p.y}, poly.basicPolygon())) {
-          obstacle_points.push_back(tier4_autoware_utils::createPoint(p.x, p.y, p.z));
-          // get all obstacle point becomes high computation cost so skip if any point is found
-          break;
-        }
-      }
+    // get all obstacle point becomes high computation cost so skip if any point is found
+    for (const auto i : grid.findPointsWithinPolygon(poly.basicPolygon(), 1)) {
+      const auto & p = grid.cloud().points.at(i);
+      obstacle_points.push_back(tier4_autoware_utils::createPoint(p.x, p.y, p.z));
     }
   }
 
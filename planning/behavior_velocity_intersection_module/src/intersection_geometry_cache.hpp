@@ -0,0 +1,112 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INTERSECTION_GEOMETRY_CACHE_HPP_
+#define INTERSECTION_GEOMETRY_CACHE_HPP_
+
+#include "intersection_lanelets.hpp"
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/LineString.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace behavior_velocity_planner::intersection
+{
+/**
+ * @brief geometries of the intersections which depend only on the map and the parameters
+ * @details the manager keeps the IntersectionLanelets before update() and the occlusion attention
+ * divisions of each intersection lane, so that they are not generated again when the module on
+ * the same lane is launched again. They are cleared when the map is changed.
+ */
+class IntersectionGeometryCache
+{
+public:
+  std::optional<IntersectionLanelets> getLanelets(
+    const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const lanelet::Id lane_id)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    resetIfMapChanged(lanelet_map_ptr);
+    const auto itr = lanelets_.find(lane_id);
+    if (itr == lanelets_.end()) {
+      return std::nullopt;
+    }
+    return itr->second;
+  }
+
+  void setLanelets(
+    const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const lanelet::Id lane_id,
+    const IntersectionLanelets & lanelets)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    resetIfMapChanged(lanelet_map_ptr);
+    lanelets_.insert_or_assign(lane_id, lanelets);
+  }
+
+  std::optional<std::vector<lanelet::ConstLineString3d>> getOcclusionAttentionDivisions(
+    const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const lanelet::Id lane_id,
+    const bool is_prioritized, const double resolution)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    resetIfMapChanged(lanelet_map_ptr);
+    const auto itr = occlusion_attention_divisions_.find({lane_id, is_prioritized});
+    if (itr == occlusion_attention_divisions_.end() || itr->second.first != resolution) {
+      return std::nullopt;
+    }
+    return itr->second.second;
+  }
+
+  void setOcclusionAttentionDivisions(
+    const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const lanelet::Id lane_id,
+    const bool is_prioritized, const double resolution,
+    const std::vector<lanelet::ConstLineString3d> & divisions)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    resetIfMapChanged(lanelet_map_ptr);
+    occlusion_attention_divisions_.insert_or_assign(
+      std::make_pair(lane_id, is_prioritized), std::make_pair(resolution, divisions));
+  }
+
+private:
+  void resetIfMapChanged(const lanelet::LaneletMapConstPtr & lanelet_map_ptr)
+  {
+    const bool is_same_map = !lanelet_map_.expired() &&
+                             !lanelet_map_.owner_before(lanelet_map_ptr) &&
+                             !lanelet_map_ptr.owner_before(lanelet_map_);
+    if (is_same_map) {
+      return;
+    }
+    lanelet_map_ = lanelet_map_ptr;
+    lanelets_.clear();
+    occlusion_attention_divisions_.clear();
+  }
+
+  std::mutex mutex_;
+  std::weak_ptr<const lanelet::LaneletMap> lanelet_map_;
+  std::unordered_map<lanelet::Id, IntersectionLanelets> lanelets_;
+  // the divisions are generated from the occlusion attention lanelets, which depend on the traffic
+  // priority, with the resolution of the occupancy grid
+  std::map<
+    std::pair<lanelet::Id, bool>, std::pair<double, std::vector<lanelet::ConstLineString3d>>>
+    occlusion_attention_divisions_;
+};
+}  // namespace behavior_velocity_planner::intersection
+
+#endif  // INTERSECTION_GEOMETRY_CACHE_HPP_
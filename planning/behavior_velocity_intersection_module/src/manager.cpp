@@ -299,6 +299,12 @@ IntersectionModuleManager::IntersectionModuleManager(rclcpp::Node & node)
     node.create_publisher<std_msgs::msg::String>("~/debug/intersection/decision_state", 1);
   tl_observation_pub_ = node.create_publisher<autoware_perception_msgs::msg::TrafficSignal>(
     "~/debug/intersection_traffic_signal", 1);
+  ego_ttc_pub_ = node.create_publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>(
+    "~/debug/intersection/ego_ttc", 1);
+  object_ttc_pub_ = node.create_publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>(
+    "~/debug/intersection/object_ttc", 1);
+  unknown_mask_cache_ = std::make_shared<IntersectionModule::UnknownMaskCache>();
+  geometry_cache_ = std::make_shared<intersection::IntersectionGeometryCache>();
 }
 
 void IntersectionModuleManager::launchNewModules(
@@ -339,7 +345,8 @@ void IntersectionModuleManager::launchNewModules(
     }
     const auto new_module = std::make_shared<IntersectionModule>(
       module_id, lane_id, planner_data_, intersection_param_, associative_ids, turn_direction,
-      has_traffic_light, node_, logger_.get_child("intersection_module"), clock_);
+      has_traffic_light, ego_ttc_pub_, object_ttc_pub_, unknown_mask_cache_, geometry_cache_,
+      logger_.get_child("intersection_module"), clock_);
     generateUUID(module_id);
     /* set RTC status as non_occluded status initially */
     const UUID uuid = getUUID(new_module->getModuleId());
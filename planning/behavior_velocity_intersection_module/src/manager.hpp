@@ -61,6 +61,12 @@ private:
 
   rclcpp::Publisher<std_msgs::msg::String>::SharedPtr decision_state_pub_;
   rclcpp::Publisher<autoware_perception_msgs::msg::TrafficSignal>::SharedPtr tl_observation_pub_;
+  // NOTE: created here rather than in each module, so that the modules can be launched in
+  // parallel with the ones of the other managers
+  IntersectionModule::TTCPublisher ego_ttc_pub_;
+  IntersectionModule::TTCPublisher object_ttc_pub_;
+  std::shared_ptr<IntersectionModule::UnknownMaskCache> unknown_mask_cache_;
+  std::shared_ptr<intersection::IntersectionGeometryCache> geometry_cache_;
 };
 
 class MergeFromPrivateModuleManager : public SceneModuleManagerInterface
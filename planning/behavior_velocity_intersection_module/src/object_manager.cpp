@@ -14,12 +14,16 @@
 
 #include "object_manager.hpp"
 
+#include "util.hpp"
+
 #include <lanelet2_extension/utility/utilities.hpp>
 #include <tier4_autoware_utils/geometry/boost_geometry.hpp>
 #include <tier4_autoware_utils/geometry/boost_polygon_utils.hpp>  // for toPolygon2d
 
+#include <boost/geometry/algorithms/assign.hpp>
 #include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/algorithms/intersection.hpp>
 
 #include <lanelet2_core/geometry/Lanelet.h>
@@ -256,19 +260,27 @@ std::optional<intersection::CollisionInterval> findPassageInterval(
   const std::optional<lanelet::ConstLanelet> & first_attention_lane_opt,
   const std::optional<lanelet::ConstLanelet> & second_attention_lane_opt)
 {
+  // NOTE: the steps far from ego_lane_poly are rejected by its bounding box before the one step
+  // polygons are created
+  tier4_autoware_utils::Box2d ego_lane_box;
+  bg::assign_inverse(ego_lane_box);
+  for (const auto & p : ego_lane_poly) {
+    bg::expand(ego_lane_box, tier4_autoware_utils::Point2d{p.x(), p.y()});
+  }
+  const double footprint_radius = util::calcFootprintRadius(shape);
+  const auto intersects_with_ego_lane = [&](const auto & a, const auto & b) {
+    return util::mayIntersectWithBox(a.position, b.position, footprint_radius, ego_lane_box) &&
+           bg::intersects(ego_lane_poly, ::createOneStepPolygon(a, b, shape));
+  };
+
   const auto first_itr = std::adjacent_find(
-    predicted_path.path.cbegin(), predicted_path.path.cend(), [&](const auto & a, const auto & b) {
-      return bg::intersects(ego_lane_poly, ::createOneStepPolygon(a, b, shape));
-    });
+    predicted_path.path.cbegin(), predicted_path.path.cend(), intersects_with_ego_lane);
   if (first_itr == predicted_path.path.cend()) {
     // even the predicted path end does not collide with the beginning of ego_lane_poly
     return std::nullopt;
   }
   const auto last_itr = std::adjacent_find(
-    predicted_path.path.crbegin(), predicted_path.path.crend(),
-    [&](const auto & a, const auto & b) {
-      return bg::intersects(ego_lane_poly, ::createOneStepPolygon(a, b, shape));
-    });
+    predicted_path.path.crbegin(), predicted_path.path.crend(), intersects_with_ego_lane);
   if (last_itr == predicted_path.path.crend()) {
     // even the predicted path start does not collide with the end of ego_lane_poly
     return std::nullopt;
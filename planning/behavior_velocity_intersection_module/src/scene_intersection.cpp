@@ -51,7 +51,10 @@ IntersectionModule::IntersectionModule(
   const int64_t module_id, const int64_t lane_id,
   [[maybe_unused]] std::shared_ptr<const PlannerData> planner_data,
   const PlannerParam & planner_param, const std::set<lanelet::Id> & associative_ids,
-  const std::string & turn_direction, const bool has_traffic_light, rclcpp::Node & node,
+  const std::string & turn_direction, const bool has_traffic_light,
+  const TTCPublisher & ego_ttc_pub, const TTCPublisher & object_ttc_pub,
+  const std::shared_ptr<UnknownMaskCache> & unknown_mask_cache,
+  const std::shared_ptr<intersection::IntersectionGeometryCache> & geometry_cache,
   const rclcpp::Logger logger, const rclcpp::Clock::SharedPtr clock)
 : SceneModuleInterface(module_id, logger, clock),
   planner_param_(planner_param),
@@ -62,6 +65,10 @@ IntersectionModule::IntersectionModule(
   occlusion_uuid_(tier4_autoware_utils::generateUUID())
 {
   velocity_factor_.init(PlanningBehavior::INTERSECTION);
+  ego_ttc_pub_ = ego_ttc_pub;
+  object_ttc_pub_ = object_ttc_pub;
+  unknown_mask_cache_ = unknown_mask_cache;
+  geometry_cache_ = geometry_cache;
 
   {
     collision_state_machine_.setMarginTime(
@@ -87,11 +94,6 @@ IntersectionModule::IntersectionModule(
       planner_param_.occlusion.static_occlusion_with_traffic_light_timeout);
     static_occlusion_timeout_state_machine_.setState(StateMachine::State::STOP);
   }
-
-  ego_ttc_pub_ = node.create_publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>(
-    "~/debug/intersection/ego_ttc", 1);
-  object_ttc_pub_ = node.create_publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>(
-    "~/debug/intersection/object_ttc", 1);
 }
 
 bool IntersectionModule::modifyPathVelocity(PathWithLaneId * path, StopReason * stop_reason)
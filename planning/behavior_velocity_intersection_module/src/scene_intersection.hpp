@@ -16,6 +16,7 @@
 #define SCENE_INTERSECTION_HPP_
 
 #include "decision_result.hpp"
+#include "intersection_geometry_cache.hpp"
 #include "interpolated_path_info.hpp"
 #include "intersection_lanelets.hpp"
 #include "intersection_stoplines.hpp"
@@ -23,8 +24,10 @@
 #include "result.hpp"
 
 #include <behavior_velocity_planner_common/scene_module_interface.hpp>
+#include <behavior_velocity_planner_common/utilization/occupancy_grid_cache.hpp>
 #include <behavior_velocity_planner_common/utilization/state_machine.hpp>
 #include <motion_utils/marker/virtual_wall_marker_creator.hpp>
+#include <opencv2/core.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_auto_planning_msgs/msg/path_with_lane_id.hpp>
@@ -49,6 +52,11 @@ namespace behavior_velocity_planner
 class IntersectionModule : public SceneModuleInterface
 {
 public:
+  using TTCPublisher =
+    rclcpp::Publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>::SharedPtr;
+  // denoised unknown cells of the occupancy grid, which are shared by the modules
+  using UnknownMaskCache = OccupancyGridCache<cv::Mat>;
+
   struct PlannerParam
   {
     struct Common
@@ -305,7 +313,10 @@ public:
   IntersectionModule(
     const int64_t module_id, const int64_t lane_id, std::shared_ptr<const PlannerData> planner_data,
     const PlannerParam & planner_param, const std::set<lanelet::Id> & associative_ids,
-    const std::string & turn_direction, const bool has_traffic_light, rclcpp::Node & node,
+    const std::string & turn_direction, const bool has_traffic_light,
+    const TTCPublisher & ego_ttc_pub, const TTCPublisher & object_ttc_pub,
+    const std::shared_ptr<UnknownMaskCache> & unknown_mask_cache,
+    const std::shared_ptr<intersection::IntersectionGeometryCache> & geometry_cache,
     const rclcpp::Logger logger, const rclcpp::Clock::SharedPtr clock);
 
   /**
@@ -825,8 +836,10 @@ private:
 
   mutable DebugData debug_data_;
   mutable InternalDebugData internal_debug_data_{};
-  rclcpp::Publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>::SharedPtr ego_ttc_pub_;
-  rclcpp::Publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>::SharedPtr object_ttc_pub_;
+  TTCPublisher ego_ttc_pub_;
+  TTCPublisher object_ttc_pub_;
+  std::shared_ptr<UnknownMaskCache> unknown_mask_cache_;
+  std::shared_ptr<intersection::IntersectionGeometryCache> geometry_cache_;
 };
 
 }  // namespace behavior_velocity_planner
@@ -24,6 +24,7 @@
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 
 #include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/intersects.hpp>
 #include <boost/geometry/algorithms/within.hpp>
 
@@ -205,6 +206,7 @@ void IntersectionModule::updateObjectInfoManagerCollision(
 
   for (auto & object_info : object_info_manager_.attentionObjects()) {
     const auto & predicted_object = object_info->predicted_object();
+    const double footprint_radius = util::calcFootprintRadius(predicted_object.shape);
     bool safe_under_traffic_control = false;
     const auto label = predicted_object.classification.at(0).label;
     const auto expected_deceleration =
@@ -308,8 +310,13 @@ void IntersectionModule::updateObjectInfoManagerCollision(
 
       const auto & object_path = object_passage_interval.path;
       const auto [begin, end] = object_passage_interval.interval_position;
+      const auto polygon_box = bg::return_envelope<tier4_autoware_utils::Box2d>(polygon);
       bool collision_detected = false;
       for (auto i = begin; i <= end; ++i) {
+        const auto & position = object_path.at(i).position;
+        if (!util::mayIntersectWithBox(position, position, footprint_radius, polygon_box)) {
+          continue;
+        }
         if (bg::intersects(
               polygon,
               tier4_autoware_utils::toPolygon2d(object_path.at(i), predicted_object.shape))) {
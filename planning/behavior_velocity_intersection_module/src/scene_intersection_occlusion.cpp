@@ -205,24 +205,33 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   // In OpenCV the pixel at (X=x, Y=y) (with left-upper origin) is accessed by img[y, x]
   // unknown: 255
   // not-unknown: 0
-  cv::Mat unknown_mask_raw(width, height, CV_8UC1, cv::Scalar(0));
-  cv::Mat unknown_mask(width, height, CV_8UC1, cv::Scalar(0));
-  for (int x = 0; x < width; x++) {
+  // NOTE: the mask depends only on the grid and the parameters of the manager, so it is computed
+  // once per grid and shared by the modules
+  const auto compute_unknown_mask = [&](const nav_msgs::msg::OccupancyGrid & grid) {
+    cv::Mat unknown_mask_raw(width, height, CV_8UC1, cv::Scalar(0));
+    cv::Mat unknown_mask(width, height, CV_8UC1, cv::Scalar(0));
     for (int y = 0; y < height; y++) {
-      const int idx = y * width + x;
-      const unsigned char intensity = occ_grid.data.at(idx);
-      if (
-        planner_param_.occlusion.free_space_max <= intensity &&
-        intensity < planner_param_.occlusion.occupied_min) {
-        unknown_mask_raw.at<unsigned char>(height - 1 - y, x) = 255;
+      const int8_t * row = grid.data.data() + y * width;
+      auto * mask_row = unknown_mask_raw.ptr<unsigned char>(height - 1 - y);
+      for (int x = 0; x < width; x++) {
+        const unsigned char intensity = row[x];
+        if (
+          planner_param_.occlusion.free_space_max <= intensity &&
+          intensity < planner_param_.occlusion.occupied_min) {
+          mask_row[x] = 255;
+        }
       }
     }
-  }
-  // (2.1) apply morphologyEx
-  const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
-  cv::morphologyEx(
-    unknown_mask_raw, unknown_mask, cv::MORPH_OPEN,
-    cv::getStructuringElement(cv::MORPH_RECT, cv::Size(morph_size, morph_size)));
+    // (2.1) apply morphologyEx
+    const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
+    cv::morphologyEx(
+      unknown_mask_raw, unknown_mask, cv::MORPH_OPEN,
+      cv::getStructuringElement(cv::MORPH_RECT, cv::Size(morph_size, morph_size)));
+    return unknown_mask;
+  };
+  const auto unknown_mask_ptr =
+    unknown_mask_cache_->get(planner_data_->occupancy_grid, compute_unknown_mask);
+  const cv::Mat & unknown_mask = *unknown_mask_ptr;
 
   // (3) occlusion mask
   static constexpr unsigned char OCCLUDED = 255;
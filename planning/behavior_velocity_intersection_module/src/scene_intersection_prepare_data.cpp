@@ -207,9 +207,13 @@ IntersectionModule::prepareIntersectionData(PathWithLaneId * path)
     path->points, current_pose.position,
     path_ip.points.at(path_ip_intersection_end).point.pose.position);
 
+  if (!intersection_lanelets_) {
+    intersection_lanelets_ = geometry_cache_->getLanelets(lanelet_map_ptr, lane_id_);
+  }
   if (!intersection_lanelets_) {
     intersection_lanelets_ =
       generateObjectiveLanelets(lanelet_map_ptr, routing_graph_ptr, assigned_lanelet);
+    geometry_cache_->setLanelets(lanelet_map_ptr, lane_id_, intersection_lanelets_.value());
   }
   auto & intersection_lanelets = intersection_lanelets_.value();
   debug_data_.attention_area = intersection_lanelets.attention_area();
@@ -271,9 +275,17 @@ IntersectionModule::prepareIntersectionData(PathWithLaneId * path)
   const auto & path_lanelets = path_lanelets_opt.value();
 
   if (!occlusion_attention_divisions_) {
-    occlusion_attention_divisions_ = generateDetectionLaneDivisions(
-      intersection_lanelets.occlusion_attention(), routing_graph_ptr,
-      planner_data_->occupancy_grid->info.resolution);
+    const double resolution = planner_data_->occupancy_grid->info.resolution;
+    occlusion_attention_divisions_ =
+      geometry_cache_->getOcclusionAttentionDivisions(
+        lanelet_map_ptr, lane_id_, is_prioritized, resolution);
+    if (!occlusion_attention_divisions_) {
+      occlusion_attention_divisions_ = generateDetectionLaneDivisions(
+        intersection_lanelets.occlusion_attention(), routing_graph_ptr, resolution);
+      geometry_cache_->setOcclusionAttentionDivisions(
+        lanelet_map_ptr, lane_id_, is_prioritized, resolution,
+        occlusion_attention_divisions_.value());
+    }
   }
 
   if (has_traffic_light_) {
@@ -21,6 +21,7 @@
 #include <behavior_velocity_planner_common/utilization/util.hpp>
 #include <lanelet2_extension/utility/utilities.hpp>
 #include <motion_utils/trajectory/trajectory.hpp>
+#include <tier4_autoware_utils/geometry/boost_polygon_utils.hpp>
 
 #include <boost/geometry/algorithms/correct.hpp>
 #include <boost/geometry/algorithms/intersects.hpp>
@@ -404,4 +405,24 @@ std::vector<lanelet::CompoundPolygon3d> getPolygon3dFromLanelets(
   return polys;
 }
 
+double calcFootprintRadius(const autoware_auto_perception_msgs::msg::Shape & shape)
+{
+  const auto footprint = tier4_autoware_utils::toPolygon2d(geometry_msgs::msg::Pose{}, shape);
+  double radius = 0.0;
+  for (const auto & p : footprint.outer()) {
+    radius = std::max(radius, std::hypot(p.x(), p.y()));
+  }
+  return radius;
+}
+
+bool mayIntersectWithBox(
+  const geometry_msgs::msg::Point & prev_position, const geometry_msgs::msg::Point & next_position,
+  const double footprint_radius, const tier4_autoware_utils::Box2d & box)
+{
+  return std::min(prev_position.x, next_position.x) - footprint_radius <= box.max_corner().x() &&
+         box.min_corner().x() <= std::max(prev_position.x, next_position.x) + footprint_radius &&
+         std::min(prev_position.y, next_position.y) - footprint_radius <= box.max_corner().y() &&
+         box.min_corner().y() <= std::max(prev_position.y, next_position.y) + footprint_radius;
+}
+
 }  // namespace behavior_velocity_planner::util
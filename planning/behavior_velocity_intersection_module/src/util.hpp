@@ -21,6 +21,7 @@
 #include <tier4_autoware_utils/geometry/boost_geometry.hpp>
 
 #include <autoware_auto_perception_msgs/msg/predicted_object_kinematics.hpp>
+#include <autoware_auto_perception_msgs/msg/shape.hpp>
 
 #include <lanelet2_core/Forward.h>
 #include <lanelet2_routing/Forward.h>
@@ -144,6 +145,20 @@ getFirstPointInsidePolygonsByFootprint(
 std::vector<lanelet::CompoundPolygon3d> getPolygon3dFromLanelets(
   const lanelet::ConstLanelets & ll_vec);
 
+/**
+ * @brief calculate the radius of the circle around the object position which contains the
+ * footprint of the object, which is used to reject the far objects before the polygon tests
+ */
+double calcFootprintRadius(const autoware_auto_perception_msgs::msg::Shape & shape);
+
+/**
+ * @brief check if the footprint of the object moving from prev_position to next_position may
+ * intersect with the box, i.e. false only if the footprint never intersects with the box
+ */
+bool mayIntersectWithBox(
+  const geometry_msgs::msg::Point & prev_position, const geometry_msgs::msg::Point & next_position,
+  const double footprint_radius, const tier4_autoware_utils::Box2d & box);
+
 }  // namespace behavior_velocity_planner::util
 
 #endif  // UTIL_HPP_
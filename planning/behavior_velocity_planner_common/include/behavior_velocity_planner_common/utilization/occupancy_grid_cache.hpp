@@ -0,0 +1,58 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__OCCUPANCY_GRID_CACHE_HPP_
+#define BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__OCCUPANCY_GRID_CACHE_HPP_
+
+#include <nav_msgs/msg/occupancy_grid.hpp>
+
+#include <memory>
+#include <mutex>
+
+namespace behavior_velocity_planner
+{
+/**
+ * @brief value derived from the occupancy grid, which is computed once per grid message
+ * @details a scene module manager shares it among its modules, so that the modules do not convert
+ * the same grid with the same parameters one by one.
+ */
+template <class T>
+class OccupancyGridCache
+{
+public:
+  /**
+   * @brief get the value derived from the grid
+   * @param grid occupancy grid
+   * @param compute function computing the value from the grid, called only for a new grid
+   */
+  template <class Compute>
+  std::shared_ptr<const T> get(
+    const nav_msgs::msg::OccupancyGrid::ConstSharedPtr & grid, const Compute & compute)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!value_ || grid != grid_) {
+      value_ = std::make_shared<const T>(compute(*grid));
+      grid_ = grid;
+    }
+    return value_;
+  }
+
+private:
+  std::mutex mutex_;
+  nav_msgs::msg::OccupancyGrid::ConstSharedPtr grid_;
+  std::shared_ptr<const T> value_;
+};
+}  // namespace behavior_velocity_planner
+
+#endif  // BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__OCCUPANCY_GRID_CACHE_HPP_
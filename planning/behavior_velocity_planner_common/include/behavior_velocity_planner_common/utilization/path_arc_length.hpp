@@ -0,0 +1,75 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PATH_ARC_LENGTH_HPP_
+#define BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PATH_ARC_LENGTH_HPP_
+
+#include <tier4_autoware_utils/geometry/boost_geometry.hpp>
+
+#include <autoware_auto_planning_msgs/msg/path_point_with_lane_id.hpp>
+#include <geometry_msgs/msg/point.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace behavior_velocity_planner
+{
+/**
+ * @brief arc lengths along the points of a path, computed once for many queries
+ * @details the cumulative arc lengths, the ends of the segments after the overlapping points and an
+ * R-tree of the points are built at the construction, so that each query does not scan the whole
+ * path. The queries give the same results as the ones of motion_utils with the same points, and
+ * the object has to be rebuilt when points are inserted to the path.
+ */
+class PathArcLength
+{
+public:
+  explicit PathArcLength(
+    const std::vector<autoware_auto_planning_msgs::msg::PathPointWithLaneId> & points);
+
+  size_t size() const { return arc_lengths_.size(); }
+
+  size_t findNearestIndex(const geometry_msgs::msg::Point & point) const;
+  size_t findNearestSegmentIndex(const geometry_msgs::msg::Point & point) const;
+
+  /**
+   * @brief signed length from the point to the segment along the segment
+   * @return NaN if the segment is not defined, as motion_utils::calcLongitudinalOffsetToSegment()
+   */
+  double calcLongitudinalOffsetToSegment(
+    const size_t seg_idx, const geometry_msgs::msg::Point & point) const;
+
+  double calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const;
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point, const size_t dst_idx) const;
+  double calcSignedArcLength(
+    const size_t src_idx, const geometry_msgs::msg::Point & dst_point) const;
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point, const geometry_msgs::msg::Point & dst_point) const;
+
+private:
+  using IndexedPoint = std::pair<tier4_autoware_utils::Point2d, size_t>;
+
+  std::vector<double> xs_;
+  std::vector<double> ys_;
+  std::vector<double> arc_lengths_;  // arc length from the front point to each point
+  // index of the first point after each point which does not overlap with it, or size if none
+  std::vector<size_t> segment_back_indices_;
+  boost::geometry::index::rtree<IndexedPoint, boost::geometry::index::rstar<16>> rtree_;
+};
+}  // namespace behavior_velocity_planner
+
+#endif  // BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__PATH_ARC_LENGTH_HPP_
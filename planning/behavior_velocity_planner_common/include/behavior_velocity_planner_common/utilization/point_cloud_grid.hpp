@@ -0,0 +1,68 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__POINT_CLOUD_GRID_HPP_
+#define BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__POINT_CLOUD_GRID_HPP_
+
+#include <lanelet2_core/primitives/Polygon.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace behavior_velocity_planner
+{
+/**
+ * @brief 2D grid index over the points of a point cloud
+ * @details the points are bucketed into square cells on the xy-plane at the first query, so that a
+ * polygon query tests only the points in the cells overlapping the bounding box of the polygon.
+ * The grid is shared by all the modules through PlannerData and built once per cloud.
+ */
+class PointCloudGrid
+{
+public:
+  explicit PointCloudGrid(
+    pcl::PointCloud<pcl::PointXYZ>::ConstPtr cloud, const double cell_size = 1.0);
+
+  /**
+   * @brief find the points within the polygon on the xy-plane
+   * @param polygon polygon in the frame of the cloud
+   * @param max_num maximum number of the points to find
+   * @return indices of the points in the cloud, in ascending order
+   */
+  std::vector<size_t> findPointsWithinPolygon(
+    const lanelet::BasicPolygon2d & polygon,
+    const size_t max_num = std::numeric_limits<size_t>::max()) const;
+
+  const pcl::PointCloud<pcl::PointXYZ> & cloud() const { return *cloud_; }
+
+private:
+  void build() const;
+  std::pair<int32_t, int32_t> toCell(const double x, const double y) const;
+  static int64_t toKey(const int32_t cell_x, const int32_t cell_y);
+
+  pcl::PointCloud<pcl::PointXYZ>::ConstPtr cloud_;
+  double cell_size_;
+
+  // pairs of the key of the cell and the index of the point, sorted by the key
+  mutable std::vector<std::pair<int64_t, size_t>> sorted_points_;
+  mutable std::once_flag build_flag_;
+};
+}  // namespace behavior_velocity_planner
+
+#endif  // BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__POINT_CLOUD_GRID_HPP_
@@ -0,0 +1,170 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <behavior_velocity_planner_common/utilization/path_arc_length.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace behavior_velocity_planner
+{
+namespace bgi = boost::geometry::index;
+
+PathArcLength::PathArcLength(
+  const std::vector<autoware_auto_planning_msgs::msg::PathPointWithLaneId> & points)
+{
+  const size_t size = points.size();
+  xs_.reserve(size);
+  ys_.reserve(size);
+  arc_lengths_.reserve(size);
+  std::vector<IndexedPoint> indexed_points;
+  indexed_points.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    const auto & p = points.at(i).point.pose.position;
+    xs_.push_back(p.x);
+    ys_.push_back(p.y);
+    arc_lengths_.push_back(
+      i == 0 ? 0.0 : arc_lengths_.back() + std::hypot(p.x - xs_.at(i - 1), p.y - ys_.at(i - 1)));
+    indexed_points.emplace_back(tier4_autoware_utils::Point2d(p.x, p.y), i);
+  }
+  rtree_ = decltype(rtree_)(indexed_points.begin(), indexed_points.end());
+
+  // same threshold as motion_utils::removeOverlapPoints()
+  constexpr double eps = 1.0E-08;
+  segment_back_indices_.resize(size, size);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = i + 1; j < size; ++j) {
+      if (std::abs(xs_.at(i) - xs_.at(j)) >= eps || std::abs(ys_.at(i) - ys_.at(j)) >= eps) {
+        segment_back_indices_.at(i) = j;
+        break;
+      }
+    }
+  }
+}
+
+size_t PathArcLength::findNearestIndex(const geometry_msgs::msg::Point & point) const
+{
+  if (rtree_.empty()) {
+    throw std::invalid_argument("[PathArcLength] Points is empty.");
+  }
+
+  const tier4_autoware_utils::Point2d query(point.x, point.y);
+  std::vector<IndexedPoint> nearest_points;
+  rtree_.query(bgi::nearest(query, 1), std::back_inserter(nearest_points));
+
+  // NOTE: the first one of the points at the same distance is returned as motion_utils does
+  constexpr double margin = 1e-6;
+  const double max_dist = boost::geometry::distance(query, nearest_points.front().first) + margin;
+  const tier4_autoware_utils::Box2d search_box(
+    tier4_autoware_utils::Point2d(point.x - max_dist, point.y - max_dist),
+    tier4_autoware_utils::Point2d(point.x + max_dist, point.y + max_dist));
+  std::vector<IndexedPoint> candidates;
+  rtree_.query(bgi::covered_by(search_box), std::back_inserter(candidates));
+
+  double min_dist = std::numeric_limits<double>::max();
+  size_t min_idx = nearest_points.front().second;
+  for (const auto & [candidate, idx] : candidates) {
+    const double dx = xs_.at(idx) - point.x;
+    const double dy = ys_.at(idx) - point.y;
+    const double dist = dx * dx + dy * dy;
+    if (dist < min_dist || (dist == min_dist && idx < min_idx)) {
+      min_dist = dist;
+      min_idx = idx;
+    }
+  }
+  return min_idx;
+}
+
+size_t PathArcLength::findNearestSegmentIndex(const geometry_msgs::msg::Point & point) const
+{
+  const size_t nearest_idx = findNearestIndex(point);
+
+  if (nearest_idx == 0) {
+    return 0;
+  }
+  if (nearest_idx == size() - 1) {
+    return size() - 2;
+  }
+
+  const double signed_length = calcLongitudinalOffsetToSegment(nearest_idx, point);
+
+  if (signed_length <= 0) {
+    return nearest_idx - 1;
+  }
+
+  return nearest_idx;
+}
+
+double PathArcLength::calcLongitudinalOffsetToSegment(
+  const size_t seg_idx, const geometry_msgs::msg::Point & point) const
+{
+  if (seg_idx + 1 >= size() || segment_back_indices_.at(seg_idx) == size()) {
+    return std::nan("");
+  }
+
+  const size_t back_idx = segment_back_indices_.at(seg_idx);
+  const double segment_x = xs_.at(back_idx) - xs_.at(seg_idx);
+  const double segment_y = ys_.at(back_idx) - ys_.at(seg_idx);
+  const double target_x = point.x - xs_.at(seg_idx);
+  const double target_y = point.y - ys_.at(seg_idx);
+  return (segment_x * target_x + segment_y * target_y) /
+         std::sqrt(segment_x * segment_x + segment_y * segment_y);
+}
+
+double PathArcLength::calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const
+{
+  if (arc_lengths_.empty()) {
+    return 0.0;
+  }
+  return arc_lengths_.at(dst_idx) - arc_lengths_.at(src_idx);
+}
+
+double PathArcLength::calcSignedArcLength(
+  const geometry_msgs::msg::Point & src_point, const size_t dst_idx) const
+{
+  if (arc_lengths_.empty()) {
+    return 0.0;
+  }
+
+  const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+  return calcSignedArcLength(src_seg_idx, dst_idx) -
+         calcLongitudinalOffsetToSegment(src_seg_idx, src_point);
+}
+
+double PathArcLength::calcSignedArcLength(
+  const size_t src_idx, const geometry_msgs::msg::Point & dst_point) const
+{
+  return -calcSignedArcLength(dst_point, src_idx);
+}
+
+double PathArcLength::calcSignedArcLength(
+  const geometry_msgs::msg::Point & src_point, const geometry_msgs::msg::Point & dst_point) const
+{
+  if (arc_lengths_.empty()) {
+    return 0.0;
+  }
+
+  const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+  const size_t dst_seg_idx = findNearestSegmentIndex(dst_point);
+  return calcSignedArcLength(src_seg_idx, dst_seg_idx) -
+         calcLongitudinalOffsetToSegment(src_seg_idx, src_point) +
+         calcLongitudinalOffsetToSegment(dst_seg_idx, dst_point);
+}
+}  // namespace behavior_velocity_planner
@@ -0,0 +1,114 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <behavior_velocity_planner_common/utilization/boost_geometry_helper.hpp>
+#include <behavior_velocity_planner_common/utilization/point_cloud_grid.hpp>
+
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <lanelet2_core/geometry/Polygon.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace behavior_velocity_planner
+{
+PointCloudGrid::PointCloudGrid(
+  pcl::PointCloud<pcl::PointXYZ>::ConstPtr cloud, const double cell_size)
+: cloud_(std::move(cloud)), cell_size_(cell_size)
+{
+}
+
+void PointCloudGrid::build() const
+{
+  sorted_points_.reserve(cloud_->size());
+  for (size_t i = 0; i < cloud_->size(); ++i) {
+    const auto & p = cloud_->points[i];
+    if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+      continue;
+    }
+    const auto [cell_x, cell_y] = toCell(p.x, p.y);
+    sorted_points_.emplace_back(toKey(cell_x, cell_y), i);
+  }
+  std::sort(sorted_points_.begin(), sorted_points_.end());
+}
+
+std::pair<int32_t, int32_t> PointCloudGrid::toCell(const double x, const double y) const
+{
+  return {
+    static_cast<int32_t>(std::floor(x / cell_size_)),
+    static_cast<int32_t>(std::floor(y / cell_size_))};
+}
+
+int64_t PointCloudGrid::toKey(const int32_t cell_x, const int32_t cell_y)
+{
+  // NOTE: the cells of the same cell_x are contiguous and sorted by cell_y
+  constexpr int64_t num_cells_y = int64_t{1} << 32;
+  return static_cast<int64_t>(cell_x) * num_cells_y + static_cast<int64_t>(cell_y) -
+         static_cast<int64_t>(std::numeric_limits<int32_t>::min());
+}
+
+std::vector<size_t> PointCloudGrid::findPointsWithinPolygon(
+  const lanelet::BasicPolygon2d & polygon, const size_t max_num) const
+{
+  std::vector<size_t> indices;
+  if (polygon.empty() || max_num == 0 || !cloud_ || cloud_->empty()) {
+    return indices;
+  }
+  std::call_once(build_flag_, [this]() { build(); });
+
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & p : polygon) {
+    min_x = std::min(min_x, p.x());
+    min_y = std::min(min_y, p.y());
+    max_x = std::max(max_x, p.x());
+    max_y = std::max(max_y, p.y());
+  }
+  const auto [min_cell_x, min_cell_y] = toCell(min_x, min_y);
+  const auto [max_cell_x, max_cell_y] = toCell(max_x, max_y);
+
+  // points in the bounding box of the polygon
+  std::vector<size_t> candidates;
+  for (int32_t cell_x = min_cell_x; cell_x <= max_cell_x; ++cell_x) {
+    const auto first = std::lower_bound(
+      sorted_points_.begin(), sorted_points_.end(),
+      std::make_pair(toKey(cell_x, min_cell_y), size_t{0}));
+    const auto last_key = toKey(cell_x, max_cell_y);
+    for (auto itr = first; itr != sorted_points_.end() && itr->first <= last_key; ++itr) {
+      const auto & p = cloud_->points[itr->second];
+      if (min_x <= p.x && p.x <= max_x && min_y <= p.y && p.y <= max_y) {
+        candidates.push_back(itr->second);
+      }
+    }
+  }
+
+  // test the candidates in the order of the cloud, so that the first ones are found
+  std::sort(candidates.begin(), candidates.end());
+  for (const auto i : candidates) {
+    const auto & p = cloud_->points[i];
+    if (bg::within(Point2d{p.x, p.y}, polygon)) {
+      indices.push_back(i);
+      if (indices.size() >= max_num) {
+        break;
+      }
+    }
+  }
+  return indices;
+}
+}  // namespace behavior_velocity_planner
@@ -0,0 +1,100 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <behavior_velocity_planner_common/utilization/path_arc_length.hpp>
+#include <motion_utils/trajectory/trajectory.hpp>
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using autoware_auto_planning_msgs::msg::PathPointWithLaneId;
+using behavior_velocity_planner::PathArcLength;
+
+namespace
+{
+// curved path with some overlapping points
+std::vector<PathPointWithLaneId> generateCurvedPoints()
+{
+  std::vector<PathPointWithLaneId> points;
+  for (int i = 0; i < 50; ++i) {
+    PathPointWithLaneId p;
+    p.point.pose.position.x = i * 1.0;
+    p.point.pose.position.y = 10.0 * std::sin(i * 0.1);
+    points.push_back(p);
+    if (i % 10 == 5) {
+      points.push_back(p);
+    }
+  }
+  return points;
+}
+}  // namespace
+
+TEST(PathArcLength, sameAsMotionUtils)
+{
+  const auto points = generateCurvedPoints();
+  const PathArcLength path_arc_length(points);
+  ASSERT_EQ(path_arc_length.size(), points.size());
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> dist_x(-5.0, 55.0);
+  std::uniform_real_distribution<double> dist_y(-15.0, 15.0);
+  for (int i = 0; i < 200; ++i) {
+    const auto src = tier4_autoware_utils::createPoint(dist_x(engine), dist_y(engine), 0.0);
+    const auto dst = tier4_autoware_utils::createPoint(dist_x(engine), dist_y(engine), 0.0);
+    const size_t idx = i % points.size();
+
+    EXPECT_EQ(path_arc_length.findNearestIndex(src), motion_utils::findNearestIndex(points, src));
+    EXPECT_EQ(
+      path_arc_length.findNearestSegmentIndex(src),
+      motion_utils::findNearestSegmentIndex(points, src));
+    EXPECT_NEAR(
+      path_arc_length.calcSignedArcLength(src, dst),
+      motion_utils::calcSignedArcLength(points, src, dst), 1e-6);
+    EXPECT_NEAR(
+      path_arc_length.calcSignedArcLength(src, idx),
+      motion_utils::calcSignedArcLength(points, src, idx), 1e-6);
+    EXPECT_NEAR(
+      path_arc_length.calcSignedArcLength(idx, dst),
+      motion_utils::calcSignedArcLength(points, idx, dst), 1e-6);
+    EXPECT_NEAR(
+      path_arc_length.calcSignedArcLength(idx, points.size() - 1 - idx),
+      motion_utils::calcSignedArcLength(points, idx, points.size() - 1 - idx), 1e-6);
+  }
+}
+
+TEST(PathArcLength, nearestIndexOfOverlappingPoints)
+{
+  // the first one of the overlapping points is the nearest as motion_utils
+  const auto points = generateCurvedPoints();
+  const PathArcLength path_arc_length(points);
+  const auto & overlapping_point = points.at(6).point.pose.position;
+  EXPECT_EQ(path_arc_length.findNearestIndex(overlapping_point), 5u);
+  EXPECT_EQ(
+    path_arc_length.findNearestIndex(overlapping_point),
+    motion_utils::findNearestIndex(points, overlapping_point));
+}
+
+TEST(PathArcLength, emptyPath)
+{
+  const PathArcLength path_arc_length(std::vector<PathPointWithLaneId>{});
+  const auto p = tier4_autoware_utils::createPoint(0.0, 0.0, 0.0);
+  EXPECT_DOUBLE_EQ(path_arc_length.calcSignedArcLength(p, p), 0.0);
+  EXPECT_THROW(path_arc_length.findNearestIndex(p), std::invalid_argument);
+}
@@ -0,0 +1,81 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <behavior_velocity_planner_common/utilization/boost_geometry_helper.hpp>
+#include <behavior_velocity_planner_common/utilization/point_cloud_grid.hpp>
+
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/geometry/Polygon.h>
+
+#include <random>
+#include <vector>
+
+using behavior_velocity_planner::PointCloudGrid;
+
+namespace
+{
+pcl::PointCloud<pcl::PointXYZ>::Ptr generateCloud(const size_t num)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> dist(-30.0f, 30.0f);
+  pcl::PointCloud<pcl::PointXYZ>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZ>);
+  for (size_t i = 0; i < num; ++i) {
+    cloud->push_back(pcl::PointXYZ(dist(engine), dist(engine), 0.0f));
+  }
+  return cloud;
+}
+
+std::vector<size_t> findPointsByBruteForce(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud, const lanelet::BasicPolygon2d & polygon)
+{
+  std::vector<size_t> indices;
+  for (size_t i = 0; i < cloud.size(); ++i) {
+    if (bg::within(Point2d{cloud[i].x, cloud[i].y}, polygon)) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+}  // namespace
+
+TEST(PointCloudGrid, findPointsWithinPolygon)
+{
+  const auto cloud = generateCloud(5000);
+  const PointCloudGrid grid(cloud, 1.5);
+
+  // concave polygon across the cells of negative coordinates
+  const lanelet::BasicPolygon2d polygon{
+    {-12.3, -8.1}, {5.2, -10.4}, {9.7, 3.3}, {0.4, -1.2}, {-4.8, 7.9}};
+  const auto expected = findPointsByBruteForce(*cloud, polygon);
+  ASSERT_FALSE(expected.empty());
+  EXPECT_EQ(grid.findPointsWithinPolygon(polygon), expected);
+
+  // the first points of the cloud are found
+  const auto first_points = grid.findPointsWithinPolygon(polygon, 3);
+  EXPECT_EQ(first_points, std::vector<size_t>(expected.begin(), expected.begin() + 3));
+
+  // polygon out of the cloud
+  const lanelet::BasicPolygon2d far_polygon{{100.0, 100.0}, {110.0, 100.0}, {110.0, 110.0}};
+  EXPECT_TRUE(grid.findPointsWithinPolygon(far_polygon).empty());
+}
+
+TEST(PointCloudGrid, emptyCloud)
+{
+  const pcl::PointCloud<pcl::PointXYZ>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZ>);
+  const PointCloudGrid grid(cloud);
+  const lanelet::BasicPolygon2d polygon{{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}};
+  EXPECT_TRUE(grid.findPointsWithinPolygon(polygon).empty());
+}
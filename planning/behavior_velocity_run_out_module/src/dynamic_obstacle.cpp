@@ -27,8 +27,10 @@
 #include <pcl/filters/voxel_grid.h>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
+#include <vector>
 
 namespace behavior_velocity_planner
 {
@@ -137,15 +139,17 @@ pcl::PointCloud<pcl::PointXYZ> extractObstaclePointsWithinPolygon(
   output_points.header = input_points.header;
   for (const auto & poly : polys) {
     const auto bounding_box = bg::return_envelope<tier4_autoware_utils::Box2d>(poly);
+    const auto & min_corner = bounding_box.min_corner();
+    const auto & max_corner = bounding_box.max_corner();
     for (const auto & p : input_points) {
-      Point2d point(p.x, p.y);
-
       // filter with bounding box to reduce calculation time
-      if (!bg::covered_by(point, bounding_box)) {
+      if (
+        p.x < min_corner.x() || p.x > max_corner.x() || p.y < min_corner.y() ||
+        p.y > max_corner.y()) {
         continue;
       }
 
-      if (!bg::covered_by(point, poly)) {
+      if (!bg::covered_by(Point2d(p.x, p.y), poly)) {
         continue;
       }
 
@@ -156,6 +160,79 @@ pcl::PointCloud<pcl::PointXYZ> extractObstaclePointsWithinPolygon(
   return output_points;
 }
 
+// find the nearest segment index of the path for many points
+// this gives the same result as motion_utils::findNearestSegmentIndex(), with the path points
+// kept in SoA form and the end of each segment after the overlapping points computed only once
+class NearestSegmentIndexFinder
+{
+public:
+  explicit NearestSegmentIndexFinder(const PathPointsWithLaneId & path_points)
+  {
+    const size_t size = path_points.size();
+    xs_.reserve(size);
+    ys_.reserve(size);
+    for (const auto & p : path_points) {
+      xs_.push_back(p.point.pose.position.x);
+      ys_.push_back(p.point.pose.position.y);
+    }
+
+    // index of the first point after i which does not overlap with i, or size if there is none
+    constexpr double eps = 1.0E-08;
+    segment_back_idx_.resize(size, size);
+    for (size_t i = 0; i < size; ++i) {
+      for (size_t j = i + 1; j < size; ++j) {
+        if (std::abs(xs_[i] - xs_[j]) >= eps || std::abs(ys_[i] - ys_[j]) >= eps) {
+          segment_back_idx_[i] = j;
+          break;
+        }
+      }
+    }
+  }
+
+  size_t find(const double x, const double y) const
+  {
+    const size_t size = xs_.size();
+    double min_dist = std::numeric_limits<double>::max();
+    size_t nearest_idx = 0;
+    for (size_t i = 0; i < size; ++i) {
+      const double dx = xs_[i] - x;
+      const double dy = ys_[i] - y;
+      const double dist = dx * dx + dy * dy;
+      if (dist < min_dist) {
+        min_dist = dist;
+        nearest_idx = i;
+      }
+    }
+
+    if (nearest_idx == 0) {
+      return 0;
+    }
+    if (nearest_idx == size - 1) {
+      return size - 2;
+    }
+
+    // the longitudinal offset to the segment is not defined if all the following points overlap
+    const size_t back_idx = segment_back_idx_[nearest_idx];
+    if (back_idx == size) {
+      return nearest_idx;
+    }
+    const double segment_x = xs_[back_idx] - xs_[nearest_idx];
+    const double segment_y = ys_[back_idx] - ys_[nearest_idx];
+    const double signed_length = segment_x * (x - xs_[nearest_idx]) +
+                                 segment_y * (y - ys_[nearest_idx]);
+    if (signed_length <= 0) {
+      return nearest_idx - 1;
+    }
+
+    return nearest_idx;
+  }
+
+private:
+  std::vector<double> xs_;
+  std::vector<double> ys_;
+  std::vector<size_t> segment_back_idx_;
+};
+
 // group points with its nearest segment of path points
 std::vector<pcl::PointCloud<pcl::PointXYZ>> groupPointsWithNearestSegmentIndex(
   const pcl::PointCloud<pcl::PointXYZ> & input_points, const PathPointsWithLaneId & path_points)
@@ -164,14 +241,14 @@ std::vector<pcl::PointCloud<pcl::PointXYZ>> groupPointsWithNearestSegmentIndex(
   std::vector<pcl::PointCloud<pcl::PointXYZ>> points_with_index;
   points_with_index.resize(path_points.size());
 
+  const NearestSegmentIndexFinder nearest_segment_index_finder(path_points);
   for (const auto & p : input_points.points) {
-    const auto ros_point = tier4_autoware_utils::createPoint(p.x, p.y, p.z);
-    const size_t nearest_seg_idx = motion_utils::findNearestSegmentIndex(path_points, ros_point);
+    const size_t nearest_seg_idx = nearest_segment_index_finder.find(p.x, p.y);
 
     // if the point is ahead of end of the path, index should be path.size() - 1
     if (
       nearest_seg_idx == path_points.size() - 2 &&
-      isAheadOf(ros_point, path_points.back().point.pose)) {
+      isAheadOf(tier4_autoware_utils::createPoint(p.x, p.y, p.z), path_points.back().point.pose)) {
       points_with_index.back().push_back(p);
       continue;
     }
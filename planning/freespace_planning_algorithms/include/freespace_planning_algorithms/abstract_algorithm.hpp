@@ -176,6 +176,12 @@ protected:
   // is_obstacle's table
   std::vector<std::vector<bool>> is_obstacle_table_;
 
+  // Chebyshev distance in cells to the closest obstacle, in the row-major order of the costmap
+  std::vector<int> obstacle_distance_table_;
+
+  // maximum Chebyshev distance in cells of the collision indexes from the base index
+  int max_coll_index_offset_{0};
+
   // pose in costmap frame
   geometry_msgs::msg::Pose start_pose_;
   geometry_msgs::msg::Pose goal_pose_;
@@ -20,12 +20,16 @@
 #include <tf2/utils.h>
 
 #include <algorithm>
+#include <climits>
 #include <cmath>
+#include <cstdint>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <optional>
 #include <random>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace rrtstar_core
@@ -85,6 +89,43 @@ private:
   std::mt19937 rand_gen_;
 };
 
+// Grid of the node positions in the xy plane, which finds the nodes near a pose without scanning
+// all the nodes. The xy distance is the lower bound of the reeds-shepp distance, so that the nodes
+// farther than a reeds-shepp distance in the xy plane are skipped by cells.
+class NodeGrid
+{
+public:
+  explicit NodeGrid(double cell_size) : cell_size_(cell_size) {}
+  void clear();
+  void insert(const Pose & pose, size_t index);
+  double getCellSize() const { return cell_size_; }
+
+  // Indices of the nodes whose xy distance from the pose is not more than the radius, in
+  // ascending order.
+  std::vector<size_t> findWithin(
+    const Pose & pose, double radius, const std::vector<Pose> & poses) const;
+
+  // Call the visitor for the indices of the nodes in the cells at the chebyshev distance ring from
+  // the cell of the pose. Return false if the ring is outside all the nodes.
+  bool forEachInRing(
+    const Pose & pose, int ring, const std::function<void(size_t)> & visitor) const;
+
+private:
+  int toCellIndex(double v) const { return static_cast<int>(std::floor(v / cell_size_)); }
+  static int64_t toKey(int ix, int iy)
+  {
+    return (static_cast<int64_t>(ix) << 32) | static_cast<uint32_t>(iy);
+  }
+  void forEachInCell(int ix, int iy, const std::function<void(size_t)> & visitor) const;
+
+  double cell_size_;
+  std::unordered_map<int64_t, std::vector<size_t>> cells_;
+  int ix_min_ = INT_MAX;
+  int ix_max_ = INT_MIN;
+  int iy_min_ = INT_MAX;
+  int iy_max_ = INT_MIN;
+};
+
 struct Node;
 using NodeSharedPtr = std::shared_ptr<Node>;
 using NodeConstSharedPtr = std::shared_ptr<const Node>;
@@ -144,10 +185,14 @@ private:
   NodeConstSharedPtr getReconnectTargeNode(
     const NodeConstSharedPtr node_new,
     const std::vector<NodeConstSharedPtr> & neighbor_nodes) const;
+  void rebuildNodeGrid();
 
   NodeSharedPtr node_start_;
   NodeSharedPtr node_goal_;
   std::vector<NodeSharedPtr> nodes_;
+  // poses of nodes_ in the same order, which are indexed by node_grid_
+  std::vector<Pose> node_poses_;
+  NodeGrid node_grid_;
   std::vector<NodeSharedPtr> reached_nodes_;
   // std::vector<Node> nodes_;
   const double mu_;
@@ -17,6 +17,8 @@
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/math/normalization.hpp>
 
+#include <algorithm>
+#include <cstdlib>
 #include <vector>
 
 namespace freespace_planning_algorithms
@@ -123,11 +125,49 @@ void AbstractPlanningAlgorithm::setMap(const nav_msgs::msg::OccupancyGrid & cost
   }
   is_obstacle_table_ = is_obstacle_table;
 
+  // Chebyshev distance in cells to the closest obstacle by the two passes of the 8-neighbors
+  const int max_distance = static_cast<int>(height + width);
+  obstacle_distance_table_.assign(height * width, max_distance);
+  const auto update_distance = [&](const int i, const int j, const int di, const int dj) {
+    const int ni = i + di;
+    const int nj = j + dj;
+    if (ni < 0 || static_cast<int>(height) <= ni || nj < 0 || static_cast<int>(width) <= nj) {
+      return;
+    }
+    int & distance = obstacle_distance_table_[i * width + j];
+    distance = std::min(distance, obstacle_distance_table_[ni * width + nj] + 1);
+  };
+  for (int i = 0; i < static_cast<int>(height); i++) {
+    for (int j = 0; j < static_cast<int>(width); j++) {
+      if (is_obstacle_table_[i][j]) {
+        obstacle_distance_table_[i * width + j] = 0;
+        continue;
+      }
+      update_distance(i, j, -1, -1);
+      update_distance(i, j, -1, 0);
+      update_distance(i, j, -1, 1);
+      update_distance(i, j, 0, -1);
+    }
+  }
+  for (int i = static_cast<int>(height) - 1; 0 <= i; i--) {
+    for (int j = static_cast<int>(width) - 1; 0 <= j; j--) {
+      update_distance(i, j, 1, 1);
+      update_distance(i, j, 1, 0);
+      update_distance(i, j, 1, -1);
+      update_distance(i, j, 0, 1);
+    }
+  }
+
   // construct collision indexes table
   if (is_collision_table_initialized == false) {
+    max_coll_index_offset_ = 0;
     for (int i = 0; i < planner_common_param_.theta_size; i++) {
       std::vector<IndexXY> indexes_2d, vertex_indexes_2d;
       computeCollisionIndexes(i, indexes_2d, vertex_indexes_2d);
+      for (const auto & index_2d : indexes_2d) {
+        max_coll_index_offset_ =
+          std::max({max_coll_index_offset_, std::abs(index_2d.x), std::abs(index_2d.y)});
+      }
       coll_indexes_table_.push_back(indexes_2d);
       vertex_indexes_table_.push_back(vertex_indexes_2d);
     }
@@ -219,6 +259,15 @@ bool AbstractPlanningAlgorithm::detectCollision(const IndexXYT & base_index) con
     }
   }
 
+  // NOTE: No collision index reaches an obstacle if all of them are closer to the base index
+  //       than the obstacle in the Chebyshev distance, which is the case in most of the space.
+  if (
+    !isOutOfRange(base_index) &&
+    max_coll_index_offset_ <
+      obstacle_distance_table_[base_index.y * costmap_.info.width + base_index.x]) {
+    return false;
+  }
+
   const auto & coll_indexes_2d = coll_indexes_table_[base_index.theta];
   for (const auto & coll_index_2d : coll_indexes_2d) {
     int idx_theta = 0;  // whatever. Yaw is nothing to do with collision detection between grids.
@@ -124,6 +124,7 @@ AstarSearch::AstarSearch(
     astar_param_.use_back);
 
   y_scale_ = planner_common_param.theta_size;
+  graph_.reserve(100000);
 }
 
 void AstarSearch::setMap(const nav_msgs::msg::OccupancyGrid & costmap)
@@ -133,7 +134,6 @@ void AstarSearch::setMap(const nav_msgs::msg::OccupancyGrid & costmap)
   clearNodes();
 
   x_scale_ = costmap_.info.height;
-  graph_.reserve(100000);
 }
 
 bool AstarSearch::makePlan(
@@ -159,7 +159,8 @@ void AstarSearch::clearNodes()
   // point to deleted node.
   openlist_ = std::priority_queue<AstarNode *, std::vector<AstarNode *>, NodeComparison>();
 
-  graph_ = std::unordered_map<uint, AstarNode>();
+  // NOTE: clear() keeps the buckets of the previous search to be reused
+  graph_.clear();
 }
 
 bool AstarSearch::setStartNode()
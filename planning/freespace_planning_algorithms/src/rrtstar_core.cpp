@@ -127,10 +127,89 @@ bool CSpace::isValidPath_child2parent(
   return true;
 }
 
+void NodeGrid::clear()
+{
+  cells_.clear();
+  ix_min_ = INT_MAX;
+  ix_max_ = INT_MIN;
+  iy_min_ = INT_MAX;
+  iy_max_ = INT_MIN;
+}
+
+void NodeGrid::insert(const Pose & pose, size_t index)
+{
+  const int ix = toCellIndex(pose.x);
+  const int iy = toCellIndex(pose.y);
+  cells_[toKey(ix, iy)].push_back(index);
+  ix_min_ = std::min(ix_min_, ix);
+  ix_max_ = std::max(ix_max_, ix);
+  iy_min_ = std::min(iy_min_, iy);
+  iy_max_ = std::max(iy_max_, iy);
+}
+
+void NodeGrid::forEachInCell(int ix, int iy, const std::function<void(size_t)> & visitor) const
+{
+  const auto cell = cells_.find(toKey(ix, iy));
+  if (cell == cells_.end()) {
+    return;
+  }
+  for (const size_t index : cell->second) {
+    visitor(index);
+  }
+}
+
+std::vector<size_t> NodeGrid::findWithin(
+  const Pose & pose, double radius, const std::vector<Pose> & poses) const
+{
+  std::vector<size_t> indices;
+  const int ix_lo = std::max(toCellIndex(pose.x - radius), ix_min_);
+  const int ix_hi = std::min(toCellIndex(pose.x + radius), ix_max_);
+  const int iy_lo = std::max(toCellIndex(pose.y - radius), iy_min_);
+  const int iy_hi = std::min(toCellIndex(pose.y + radius), iy_max_);
+  for (int ix = ix_lo; ix <= ix_hi; ++ix) {
+    for (int iy = iy_lo; iy <= iy_hi; ++iy) {
+      forEachInCell(ix, iy, [&](const size_t index) {
+        const auto & p = poses.at(index);
+        if (std::hypot(p.x - pose.x, p.y - pose.y) <= radius) {
+          indices.push_back(index);
+        }
+      });
+    }
+  }
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+bool NodeGrid::forEachInRing(
+  const Pose & pose, int ring, const std::function<void(size_t)> & visitor) const
+{
+  const int ix = toCellIndex(pose.x);
+  const int iy = toCellIndex(pose.y);
+  const int ring_max = std::max(
+    std::max(ix - ix_min_, ix_max_ - ix), std::max(iy - iy_min_, iy_max_ - iy));
+  if (cells_.empty() || ring > ring_max) {
+    return false;
+  }
+  if (ring == 0) {
+    forEachInCell(ix, iy, visitor);
+    return true;
+  }
+  for (int dx = -ring; dx <= ring; ++dx) {
+    forEachInCell(ix + dx, iy - ring, visitor);
+    forEachInCell(ix + dx, iy + ring, visitor);
+  }
+  for (int dy = -ring + 1; dy <= ring - 1; ++dy) {
+    forEachInCell(ix - ring, iy + dy, visitor);
+    forEachInCell(ix + ring, iy + dy, visitor);
+  }
+  return true;
+}
+
 RRTStar::RRTStar(
   Pose x_start, Pose x_goal, double mu, double collision_check_resolution, bool is_informed,
   CSpace cspace)
-: mu_(mu),
+: node_grid_(mu),
+  mu_(mu),
   collision_check_resolution_(collision_check_resolution),
   is_informed_(is_informed),
   cspace_(cspace)
@@ -138,6 +217,8 @@ RRTStar::RRTStar(
   node_goal_ = std::make_shared<Node>(Node{x_goal, std::nullopt, 0.0});
   node_start_ = std::make_shared<Node>(Node{x_start, 0.0});
   nodes_.push_back(node_start_);
+  node_poses_.push_back(x_start);
+  node_grid_.insert(x_start, 0);
 }
 
 void RRTStar::extend()
@@ -257,6 +338,17 @@ void RRTStar::deleteNodeUsingBranchAndBound()
   for (const size_t delete_idx : delete_indices_vec) {
     nodes_.erase(nodes_.begin() + delete_idx);
   }
+  rebuildNodeGrid();
+}
+
+void RRTStar::rebuildNodeGrid()
+{
+  node_poses_.clear();
+  node_grid_.clear();
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    node_poses_.push_back(nodes_.at(i)->pose);
+    node_grid_.insert(nodes_.at(i)->pose, i);
+  }
 }
 
 std::vector<Pose> RRTStar::sampleSolutionWaypoints() const
@@ -330,18 +422,28 @@ void RRTStar::dumpState(std::string filename) const
 
 NodeConstSharedPtr RRTStar::findNearestNode(const Pose & x_rand) const
 {
+  // NOTE: The rings of the grid are searched outward until the xy distance to the ring, which is
+  //       the lower bound of the reeds-shepp distance, exceeds the nearest distance found. Among
+  //       the nodes of the same distance the first one in nodes_ is taken, same as a linear scan.
   double dist_min = inf;
-  NodeConstSharedPtr node_nearest;
-  for (const auto & node : nodes_) {
-    if (cspace_.distanceLowerBound(node->pose, x_rand) < dist_min) {
-      const double dist_real = cspace_.distance(node->pose, x_rand);
-      if (dist_real < dist_min) {
+  size_t index_nearest = nodes_.size();
+  const double cell_size = node_grid_.getCellSize();
+  for (int ring = 0; (ring - 1) * cell_size <= dist_min; ++ring) {
+    const bool is_ring_inside = node_grid_.forEachInRing(x_rand, ring, [&](const size_t index) {
+      if (cspace_.distanceLowerBound(node_poses_.at(index), x_rand) > dist_min) {
+        return;
+      }
+      const double dist_real = cspace_.distance(node_poses_.at(index), x_rand);
+      if (dist_real < dist_min || (dist_real == dist_min && index < index_nearest)) {
         dist_min = dist_real;
-        node_nearest = node;
+        index_nearest = index;
       }
+    });
+    if (!is_ring_inside) {
+      break;
     }
   }
-  return node_nearest;
+  return nodes_.at(index_nearest);
 }
 
 std::vector<NodeConstSharedPtr> RRTStar::findNeighborNodes(const Pose & x_new) const
@@ -360,8 +462,8 @@ std::vector<NodeConstSharedPtr> RRTStar::findNeighborNodes(const Pose & x_new) c
   const double radius_neighbor = mu_;
 
   std::vector<NodeConstSharedPtr> nodes;
-  for (auto & node : nodes_) {
-    if (cspace_.distanceLowerBound(node->pose, x_new) > radius_neighbor) continue;
+  for (const size_t index : node_grid_.findWithin(x_new, radius_neighbor, node_poses_)) {
+    const auto & node = nodes_.at(index);
     const bool is_neighbor = (cspace_.distance(node->pose, x_new) < radius_neighbor);
     if (is_neighbor) {
       nodes.push_back(node);
@@ -377,6 +479,8 @@ NodeSharedPtr RRTStar::addNewNode(const Pose & pose, NodeSharedPtr node_parent)
   auto node_new =
     std::make_shared<Node>(Node{pose, cost_from_start, std::nullopt, cost_to_parent, node_parent});
   nodes_.push_back(node_new);
+  node_poses_.push_back(pose);
+  node_grid_.insert(pose, nodes_.size() - 1);
   node_parent->childs.push_back(node_new);
   return node_new;
 }
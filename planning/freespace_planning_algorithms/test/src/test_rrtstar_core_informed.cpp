@@ -16,8 +16,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <random>
 #include <stack>
+#include <vector>
 
 bool checkAllNodeConnected(const rrtstar_core::RRTStar & tree)
 {
@@ -106,6 +110,36 @@ TEST(RRTStarCore, WithInformedOption)
   }
 }
 
+TEST(RRTStarCore, NodeGrid)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> distr(-5.0, 5.0);
+  std::vector<rrtstar_core::Pose> poses;
+  rrtstar_core::NodeGrid grid(0.7);
+  for (size_t i = 0; i < 500; ++i) {
+    poses.push_back(rrtstar_core::Pose{distr(gen), distr(gen), 0.0});
+    grid.insert(poses.back(), i);
+  }
+
+  for (int trial = 0; trial < 50; ++trial) {
+    const rrtstar_core::Pose query{distr(gen) * 1.5, distr(gen) * 1.5, 0.0};
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < poses.size(); ++i) {
+      if (std::hypot(poses.at(i).x - query.x, poses.at(i).y - query.y) <= 1.0) {
+        expected.push_back(i);
+      }
+    }
+    EXPECT_EQ(grid.findWithin(query, 1.0, poses), expected);
+
+    // all the nodes are visited once over the rings
+    std::vector<int> visit_count(poses.size(), 0);
+    for (int ring = 0; grid.forEachInRing(query, ring, [&](size_t i) { visit_count.at(i)++; });
+         ++ring) {
+    }
+    EXPECT_TRUE(std::all_of(visit_count.begin(), visit_count.end(), [](int c) { return c == 1; }));
+  }
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
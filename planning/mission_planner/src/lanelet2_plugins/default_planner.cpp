@@ -33,7 +33,9 @@
 #include <lanelet2_routing/RoutingCost.h>
 #include <tf2/utils.h>
 
+#include <algorithm>
 #include <limits>
+#include <utility>
 #include <vector>
 
 namespace
@@ -182,6 +184,7 @@ bool DefaultPlanner::ready() const
 void DefaultPlanner::map_callback(const HADMapBin::ConstSharedPtr msg)
 {
   route_handler_.setMap(*msg);
+  checkpoint_legs_.clear();
   is_graph_ready_ = true;
 }
 
@@ -412,24 +415,40 @@ PlannerPlugin::LaneletRoute DefaultPlanner::plan(const RoutePoints & points)
   LaneletRoute route_msg;
   RouteSections route_sections;
 
+  // NOTE: The legs between the same checkpoints as the previous plan(), e.g. after the first
+  //       waypoint of a reroute, are taken from the previous result without the graph search.
+  std::vector<CheckpointLeg> checkpoint_legs;
+  checkpoint_legs.reserve(points.size());
   lanelet::ConstLanelets all_route_lanelets;
   for (std::size_t i = 1; i < points.size(); i++) {
-    const auto start_check_point = points.at(i - 1);
-    const auto goal_check_point = points.at(i);
-    lanelet::ConstLanelets path_lanelets;
-    if (!route_handler_.planPathLaneletsBetweenCheckpoints(
-          start_check_point, goal_check_point, &path_lanelets, param_.consider_no_drivable_lanes)) {
-      RCLCPP_WARN(logger, "Failed to plan route.");
-      return route_msg;
-    }
-    for (const auto & lane : path_lanelets) {
-      all_route_lanelets.push_back(lane);
+    const auto & start_check_point = points.at(i - 1);
+    const auto & goal_check_point = points.at(i);
+    const auto cached_leg = std::find_if(
+      checkpoint_legs_.begin(), checkpoint_legs_.end(), [&](const CheckpointLeg & leg) {
+        return leg.start_check_point == start_check_point &&
+               leg.goal_check_point == goal_check_point;
+      });
+    if (cached_leg != checkpoint_legs_.end()) {
+      checkpoint_legs.push_back(*cached_leg);
+    } else {
+      CheckpointLeg leg{start_check_point, goal_check_point, {}, {}};
+      if (!route_handler_.planPathLaneletsBetweenCheckpoints(
+            start_check_point, goal_check_point, &leg.path_lanelets,
+            param_.consider_no_drivable_lanes)) {
+        RCLCPP_WARN(logger, "Failed to plan route.");
+        return route_msg;
+      }
+      // create local route sections
+      route_handler_.setRouteLanelets(leg.path_lanelets);
+      leg.route_sections = route_handler_.createMapSegments(leg.path_lanelets);
+      checkpoint_legs.push_back(std::move(leg));
     }
-    // create local route sections
-    route_handler_.setRouteLanelets(path_lanelets);
-    const auto local_route_sections = route_handler_.createMapSegments(path_lanelets);
-    route_sections = combine_consecutive_route_sections(route_sections, local_route_sections);
+    const auto & leg = checkpoint_legs.back();
+    all_route_lanelets.insert(
+      all_route_lanelets.end(), leg.path_lanelets.begin(), leg.path_lanelets.end());
+    route_sections = combine_consecutive_route_sections(route_sections, leg.route_sections);
   }
+  checkpoint_legs_ = std::move(checkpoint_legs);
   route_handler_.setRouteLanelets(all_route_lanelets);
 
   auto goal_pose = points.back();
@@ -60,6 +60,19 @@ private:
   bool is_graph_ready_;
   route_handler::RouteHandler route_handler_;
 
+  /**
+   * @brief the result planned between a pair of consecutive checkpoints, which is reused by
+   * the successive plan() (e.g. rerouting) until the map is updated
+   */
+  struct CheckpointLeg
+  {
+    Pose start_check_point;
+    Pose goal_check_point;
+    lanelet::ConstLanelets path_lanelets;
+    RouteSections route_sections;
+  };
+  std::vector<CheckpointLeg> checkpoint_legs_;
+
   DefaultPlannerParameters param_;
 
   rclcpp::Node * node_;
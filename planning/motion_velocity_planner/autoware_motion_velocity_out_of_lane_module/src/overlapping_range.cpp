@@ -19,10 +19,13 @@
 
 #include <geometry_msgs/msg/pose.hpp>
 
+#include <lanelet2_core/geometry/BoundingBox.h>
+#include <lanelet2_core/geometry/Lanelet.h>
 #include <lanelet2_core/geometry/LaneletMap.h>
 #include <tf2/utils.h>
 
 #include <algorithm>
+#include <vector>
 
 namespace autoware::motion_velocity_planner::out_of_lane
 {
@@ -70,16 +73,34 @@ Overlap calculate_overlap(
   return overlap;
 }
 
+namespace
+{
+std::vector<lanelet::BoundingBox2d> calculate_footprint_boxes(
+  const std::vector<lanelet::BasicPolygon2d> & trajectory_footprints)
+{
+  std::vector<lanelet::BoundingBox2d> boxes;
+  boxes.reserve(trajectory_footprints.size());
+  for (const auto & footprint : trajectory_footprints)
+    boxes.push_back(boost::geometry::return_envelope<lanelet::BoundingBox2d>(footprint));
+  return boxes;
+}
+
 OverlapRanges calculate_overlapping_ranges(
   const std::vector<lanelet::BasicPolygon2d> & trajectory_footprints,
+  const std::vector<lanelet::BoundingBox2d> & footprint_boxes,
   const lanelet::ConstLanelets & trajectory_lanelets, const lanelet::ConstLanelet & lanelet,
   const PlannerParam & params)
 {
   OverlapRanges ranges;
   OtherLane other_lane(lanelet);
   std::vector<Overlap> overlaps;
+  const auto lanelet_box = lanelet::geometry::boundingBox2d(lanelet);
   for (auto i = 0UL; i < trajectory_footprints.size(); ++i) {
-    const auto overlap = calculate_overlap(trajectory_footprints[i], trajectory_lanelets, lanelet);
+    // a footprint whose box is disjoint from the lanelet's cannot intersect its bounds
+    const auto overlap =
+      boost::geometry::disjoint(footprint_boxes[i], lanelet_box)
+        ? Overlap{}
+        : calculate_overlap(trajectory_footprints[i], trajectory_lanelets, lanelet);
     const auto has_overlap = overlap.inside_distance > params.overlap_min_dist;
     if (has_overlap) {  // open/update the range
       overlaps.push_back(overlap);
@@ -109,6 +130,17 @@ OverlapRanges calculate_overlapping_ranges(
   }
   return ranges;
 }
+}  // namespace
+
+OverlapRanges calculate_overlapping_ranges(
+  const std::vector<lanelet::BasicPolygon2d> & trajectory_footprints,
+  const lanelet::ConstLanelets & trajectory_lanelets, const lanelet::ConstLanelet & lanelet,
+  const PlannerParam & params)
+{
+  return calculate_overlapping_ranges(
+    trajectory_footprints, calculate_footprint_boxes(trajectory_footprints), trajectory_lanelets,
+    lanelet, params);
+}
 
 OverlapRanges calculate_overlapping_ranges(
   const std::vector<lanelet::BasicPolygon2d> & trajectory_footprints,
@@ -116,9 +148,11 @@ OverlapRanges calculate_overlapping_ranges(
   const PlannerParam & params)
 {
   OverlapRanges ranges;
+  // the boxes of the footprints are shared by all lanelets
+  const auto footprint_boxes = calculate_footprint_boxes(trajectory_footprints);
   for (auto & lanelet : lanelets) {
-    const auto lanelet_ranges =
-      calculate_overlapping_ranges(trajectory_footprints, trajectory_lanelets, lanelet, params);
+    const auto lanelet_ranges = calculate_overlapping_ranges(
+      trajectory_footprints, footprint_boxes, trajectory_lanelets, lanelet, params);
     ranges.insert(ranges.end(), lanelet_ranges.begin(), lanelet_ranges.end());
   }
   return ranges;
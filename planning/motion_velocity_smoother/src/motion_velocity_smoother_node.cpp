@@ -18,6 +18,7 @@
 #include "motion_velocity_smoother/smoother/jerk_filtered_smoother.hpp"
 #include "motion_velocity_smoother/smoother/l2_pseudo_jerk_smoother.hpp"
 #include "motion_velocity_smoother/smoother/linf_pseudo_jerk_smoother.hpp"
+#include "tier4_autoware_utils/ros/loaned_message_publisher.hpp"
 #include "tier4_autoware_utils/ros/update_param.hpp"
 
 #include <vehicle_info_util/vehicle_info_util.hpp>
@@ -29,6 +30,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 // clang-format on
@@ -314,9 +316,9 @@ void MotionVelocitySmootherNode::publishTrajectory(const TrajectoryPoints & traj
 {
   Trajectory publishing_trajectory = motion_utils::convertToTrajectory(trajectory);
   publishing_trajectory.header = base_traj_raw_ptr_->header;
-  pub_trajectory_->publish(publishing_trajectory);
-  published_time_publisher_->publish_if_subscribed(
-    pub_trajectory_, publishing_trajectory.header.stamp);
+  const auto stamp = publishing_trajectory.header.stamp;
+  tier4_autoware_utils::publishLoanedOrMoved(pub_trajectory_, std::move(publishing_trajectory));
+  published_time_publisher_->publish_if_subscribed(pub_trajectory_, stamp);
 }
 
 void MotionVelocitySmootherNode::onCurrentOdometry(const Odometry::ConstSharedPtr msg)
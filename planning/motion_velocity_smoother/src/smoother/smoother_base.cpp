@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <deque>
 #include <vector>
 
 namespace motion_velocity_smoother
@@ -172,14 +173,28 @@ TrajectoryPoints SmootherBase::applyLateralAccelerationFilter(
                             base_param_.min_decel_for_lateral_acc_lim_filter)
                         : std::vector<double>{};
 
+  // NOTE: The maximum curvature in the sliding window [i - after, i + before] is kept with a
+  //       deque of the indices of decreasing curvatures, so that it takes O(N) instead of O(N * W).
+  std::deque<size_t> max_curvature_indices;
+  size_t window_end = 0;
   for (size_t i = 0; i < output.size(); ++i) {
-    double curvature = 0.0;
     const size_t start = i > after_decel_index ? i - after_decel_index : 0;
     const size_t end = std::min(output.size(), i + before_decel_index + 1);
-    for (size_t j = start; j < end; ++j) {
-      if (j >= curvature_v.size()) return output;
-      curvature = std::max(curvature, std::fabs(curvature_v.at(j)));
+    for (; window_end < end; ++window_end) {
+      if (window_end >= curvature_v.size()) return output;
+      const double abs_curvature = std::fabs(curvature_v.at(window_end));
+      while (!max_curvature_indices.empty() &&
+             std::fabs(curvature_v.at(max_curvature_indices.back())) <= abs_curvature) {
+        max_curvature_indices.pop_back();
+      }
+      max_curvature_indices.push_back(window_end);
     }
+    while (!max_curvature_indices.empty() && max_curvature_indices.front() < start) {
+      max_curvature_indices.pop_front();
+    }
+    const double curvature = max_curvature_indices.empty()
+                               ? 0.0
+                               : std::fabs(curvature_v.at(max_curvature_indices.front()));
     double v_curvature_max = std::sqrt(max_lateral_accel_abs / std::max(curvature, 1.0E-5));
     v_curvature_max = std::max(v_curvature_max, base_param_.min_curve_velocity);
 
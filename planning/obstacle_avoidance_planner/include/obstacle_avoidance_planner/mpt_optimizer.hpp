@@ -129,13 +129,13 @@ private:
 
   struct ObjectiveMatrix
   {
-    Eigen::MatrixXd hessian;
+    Eigen::SparseMatrix<double> hessian;
     Eigen::VectorXd gradient;
   };
 
   struct ConstraintMatrix
   {
-    Eigen::MatrixXd linear;
+    Eigen::SparseMatrix<double> linear;
     Eigen::VectorXd lower_bound;
     Eigen::VectorXd upper_bound;
   };
@@ -235,8 +235,11 @@ private:
   std::vector<double> vehicle_circle_radiuses_;
 
   // previous data
-  int prev_mat_n_ = 0;
-  int prev_mat_m_ = 0;
+  // sparsity patterns of the previous P and A, with which the solver can be updated
+  std::vector<c_int> prev_P_row_idxs_;
+  std::vector<c_int> prev_P_col_idxs_;
+  std::vector<c_int> prev_A_row_idxs_;
+  std::vector<c_int> prev_A_col_idxs_;
   int prev_solution_status_ = 0;
   std::shared_ptr<std::vector<ReferencePoint>> prev_ref_points_ptr_{nullptr};
   std::shared_ptr<std::vector<TrajectoryPoint>> prev_optimized_traj_points_ptr_{nullptr};
@@ -1270,14 +1270,29 @@ MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
   sparse_T_mat.setFromTriplets(triplet_T_vec.begin(), triplet_T_vec.end());
 
   // NOTE: min J(v) = min (v'Hv + v'g)
-  Eigen::MatrixXd H_x = Eigen::MatrixXd::Zero(N_x, N_x);
-  H_x.triangularView<Eigen::Upper>() =
-    Eigen::MatrixXd(sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat);
-  H_x.triangularView<Eigen::Lower>() = H_x.transpose();
-
-  Eigen::MatrixXd H = Eigen::MatrixXd::Zero(N_v, N_v);
-  H.block(0, 0, N_x, N_x) = H_x;
-  H.block(N_x, N_x, N_u, N_u) = val_mat.R;
+  //       H is built as a sparse matrix whose sparsity pattern depends only on the number of the
+  //       points and the slack variables, so that its values can be updated in the solver.
+  const Eigen::SparseMatrix<double> H_x = sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat;
+  std::vector<Eigen::Triplet<double>> H_triplet_vec;
+  H_triplet_vec.reserve(H_x.nonZeros() + val_mat.R.nonZeros());
+  for (int k = 0; k < H_x.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(H_x, k); it; ++it) {
+      // make H_x symmetric with its upper triangle
+      if (it.row() <= it.col()) {
+        H_triplet_vec.emplace_back(it.row(), it.col(), it.value());
+        if (it.row() != it.col()) {
+          H_triplet_vec.emplace_back(it.col(), it.row(), it.value());
+        }
+      }
+    }
+  }
+  for (int k = 0; k < val_mat.R.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(val_mat.R, k); it; ++it) {
+      H_triplet_vec.emplace_back(N_x + it.row(), N_x + it.col(), it.value());
+    }
+  }
+  Eigen::SparseMatrix<double> H(N_v, N_v);
+  H.setFromTriplets(H_triplet_vec.begin(), H_triplet_vec.end());
 
   Eigen::VectorXd g = Eigen::VectorXd::Zero(N_v);
   g.segment(0, N_x) = T_vec.transpose() * val_mat.Q * sparse_T_mat;
@@ -1339,15 +1354,30 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows += N_u;
   }
 
-  // NOTE: The following takes 1 [ms]
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(A_rows, N_v);
+  // NOTE: A is built as a sparse matrix whose sparsity pattern depends only on the number of the
+  //       points, the slack variables and the fixed points, so that its values can be updated in
+  //       the solver. The zero values in the pattern are kept explicitly.
+  std::vector<Eigen::Triplet<double>> A_triplet_vec;
   Eigen::VectorXd lb = Eigen::VectorXd::Constant(A_rows, -autoware::common::osqp::INF);
   Eigen::VectorXd ub = Eigen::VectorXd::Constant(A_rows, autoware::common::osqp::INF);
   size_t A_rows_end = 0;
 
   // 1. State equation
-  A.block(0, 0, N_x, N_x) = Eigen::MatrixXd::Identity(N_x, N_x) - mpt_mat.A;
-  A.block(0, N_x, N_x, N_u) = -mpt_mat.B;
+  // NOTE: the state equation of StateEquationGenerator relates each state to the previous state
+  //       and input only.
+  for (size_t i = 0; i < N_ref; ++i) {
+    for (size_t r = i * D_x; r < (i + 1) * D_x; ++r) {
+      const size_t x_cols_begin = (0 < i ? i - 1 : 0) * D_x;
+      for (size_t c = x_cols_begin; c < (i + 1) * D_x; ++c) {
+        A_triplet_vec.emplace_back(r, c, (r == c ? 1.0 : 0.0) - mpt_mat.A(r, c));
+      }
+      if (0 < i) {
+        for (size_t c = (i - 1) * D_u; c < i * D_u; ++c) {
+          A_triplet_vec.emplace_back(r, N_x + c, -mpt_mat.B(r, c));
+        }
+      }
+    }
+  }
   lb.segment(0, N_x) = mpt_mat.W;
   ub.segment(0, N_x) = mpt_mat.W;
   A_rows_end += N_x;
@@ -1356,20 +1386,19 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   // CX = C(Bv + w) + C \in R^{N_ref, N_ref * D_x}
   for (size_t l_idx = 0; l_idx < N_collision_check; ++l_idx) {
     // create C := [cos(beta) | l cos(beta)]
-    Eigen::SparseMatrix<double> C_sparse_mat(N_ref, N_x);
-    std::vector<Eigen::Triplet<double>> C_triplet_vec;
+    const double lon_offset = vehicle_circle_longitudinal_offsets_.at(l_idx);
+    const auto add_C_triplets = [&](const size_t rows_begin, const double sign) {
+      for (size_t i = 0; i < N_ref; ++i) {
+        const double beta = *ref_points.at(i).beta.at(l_idx);
+        A_triplet_vec.emplace_back(rows_begin + i, i * D_x, sign * 1.0 * std::cos(beta));
+        A_triplet_vec.emplace_back(rows_begin + i, i * D_x + 1, sign * lon_offset * std::cos(beta));
+      }
+    };
     Eigen::VectorXd C_vec = Eigen::VectorXd::Zero(N_ref);
-
-    // calculate C mat and vec
     for (size_t i = 0; i < N_ref; ++i) {
       const double beta = *ref_points.at(i).beta.at(l_idx);
-      const double lon_offset = vehicle_circle_longitudinal_offsets_.at(l_idx);
-
-      C_triplet_vec.push_back(Eigen::Triplet<double>(i, i * D_x, 1.0 * std::cos(beta)));
-      C_triplet_vec.push_back(Eigen::Triplet<double>(i, i * D_x + 1, lon_offset * std::cos(beta)));
       C_vec(i) = lon_offset * std::sin(beta);
     }
-    C_sparse_mat.setFromTriplets(C_triplet_vec.begin(), C_triplet_vec.end());
 
     // calculate bounds
     const double bounds_offset =
@@ -1383,26 +1412,22 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       // A := [C | O | ... | O | I | O | ...
       //      -C | O | ... | O | I | O | ...
       //          O    | O | ... | O | I | O | ... ]
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_x) = C_sparse_mat;
-      A_blk.block(N_ref, 0, N_ref, N_x) = -C_sparse_mat;
+      add_C_triplets(A_rows_end, 1.0);
+      add_C_triplets(A_rows_end + N_ref, -1.0);
 
       const size_t local_A_offset_cols = N_x + N_u + (!mpt_param_.l_inf_norm ? N_ref * l_idx : 0);
-      A_blk.block(0, local_A_offset_cols, N_ref, N_ref) = Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(2 * N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
+      for (size_t i = 0; i < N_ref; ++i) {
+        A_triplet_vec.emplace_back(A_rows_end + i, local_A_offset_cols + i, 1.0);
+        A_triplet_vec.emplace_back(A_rows_end + N_ref + i, local_A_offset_cols + i, 1.0);
+        A_triplet_vec.emplace_back(A_rows_end + 2 * N_ref + i, local_A_offset_cols + i, 1.0);
+      }
 
       // lb := [lower_bound - C
       //        C - upper_bound
       //               O        ]
-      Eigen::VectorXd lb_blk = Eigen::VectorXd::Zero(A_blk_rows);
-      lb_blk.segment(0, N_ref) = -C_vec + part_lb;
-      lb_blk.segment(N_ref, N_ref) = C_vec - part_ub;
-
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
-      lb.segment(A_rows_end, A_blk_rows) = lb_blk;
+      lb.segment(A_rows_end, N_ref) = -C_vec + part_lb;
+      lb.segment(A_rows_end + N_ref, N_ref) = C_vec - part_ub;
+      lb.segment(A_rows_end + 2 * N_ref, N_ref) = Eigen::VectorXd::Zero(N_ref);
 
       A_rows_end += A_blk_rows;
     }
@@ -1411,10 +1436,8 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     if (mpt_param_.hard_constraint) {
       const size_t A_blk_rows = N_ref;
 
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_ref) = C_sparse_mat;
+      add_C_triplets(A_rows_end, 1.0);
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = part_lb - C_vec;
       ub.segment(A_rows_end, A_blk_rows) = part_ub - C_vec;
 
@@ -1425,7 +1448,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   // 3. fixed points constraint
   // X = B v + w where point is fixed
   for (const size_t i : fixed_points_indices) {
-    A.block(A_rows_end, D_x * i, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+    for (size_t d = 0; d < D_x; ++d) {
+      A_triplet_vec.emplace_back(A_rows_end + d, D_x * i + d, 1.0);
+    }
 
     lb.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
     ub.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
@@ -1435,7 +1460,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
 
   // 4. steer angle limit
   if (mpt_param_.steer_limit_constraint) {
-    A.block(A_rows_end, N_x, N_u, N_u) = Eigen::MatrixXd::Identity(N_u, N_u);
+    for (size_t i = 0; i < N_u; ++i) {
+      A_triplet_vec.emplace_back(A_rows_end + i, N_x + i, 1.0);
+    }
 
     // TODO(murooka) use curvature by stabling optimization
     // Currently, when using curvature, the optimization result is weird with sample_map.
@@ -1452,6 +1479,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows_end += N_u;
   }
 
+  Eigen::SparseMatrix<double> A(A_rows, N_v);
+  A.setFromTriplets(A_triplet_vec.begin(), A_triplet_vec.end());
+
   time_keeper_ptr_->toc(__func__, "        ");
   return ConstraintMatrix{A, lb, ub};
 }
@@ -1504,8 +1534,8 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
     updateMatrixForManualWarmStart(obj_mat, const_mat, u0);
 
   // calculate matrices for qp
-  const Eigen::MatrixXd & H = updated_obj_mat.hessian;
-  const Eigen::MatrixXd & A = updated_const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = updated_obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = updated_const_mat.linear;
   const auto f = toStdVector(updated_obj_mat.gradient);
   const auto upper_bound = toStdVector(updated_const_mat.upper_bound);
   const auto lower_bound = toStdVector(updated_const_mat.lower_bound);
@@ -1516,9 +1546,11 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
   const autoware::common::osqp::CSC_Matrix P_csc =
     autoware::common::osqp::calCSCMatrixTrapezoidal(H);
   const autoware::common::osqp::CSC_Matrix A_csc = autoware::common::osqp::calCSCMatrix(A);
+  // NOTE: The solver can be updated only with the matrices of the same sparsity pattern.
   if (
-    prev_solution_status_ == 1 && mpt_param_.enable_warm_start && prev_mat_n_ == H.rows() &&
-    prev_mat_m_ == A.rows()) {
+    prev_solution_status_ == 1 && mpt_param_.enable_warm_start &&
+    prev_P_row_idxs_ == P_csc.m_row_idxs && prev_P_col_idxs_ == P_csc.m_col_idxs &&
+    prev_A_row_idxs_ == A_csc.m_row_idxs && prev_A_col_idxs_ == A_csc.m_col_idxs) {
     RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "warm start");
     osqp_solver_ptr_->updateCscP(P_csc);
     osqp_solver_ptr_->updateQ(f);
@@ -1529,8 +1561,10 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
     osqp_solver_ptr_ = std::make_unique<autoware::common::osqp::OSQPInterface>(
       P_csc, A_csc, f, lower_bound, upper_bound, osqp_epsilon_);
   }
-  prev_mat_n_ = H.rows();
-  prev_mat_m_ = A.rows();
+  prev_P_row_idxs_ = P_csc.m_row_idxs;
+  prev_P_col_idxs_ = P_csc.m_col_idxs;
+  prev_A_row_idxs_ = A_csc.m_row_idxs;
+  prev_A_col_idxs_ = A_csc.m_col_idxs;
 
   time_keeper_ptr_->toc("initOsqp", "          ");
 
@@ -1623,8 +1657,8 @@ MPTOptimizer::updateMatrixForManualWarmStart(
     return {obj_mat, const_mat};
   }
 
-  const Eigen::MatrixXd & H = obj_mat.hessian;
-  const Eigen::MatrixXd & A = const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = const_mat.linear;
 
   auto updated_obj_mat = obj_mat;
   auto updated_const_mat = const_mat;
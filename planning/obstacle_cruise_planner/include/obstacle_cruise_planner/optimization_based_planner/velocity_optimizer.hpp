@@ -70,6 +70,7 @@ private:
 
   // QPSolver
   autoware::common::osqp::OSQPInterface qp_solver_;
+  int prev_status_val_{0};
 };
 
 #endif  // OBSTACLE_CRUISE_PLANNER__OPTIMIZATION_BASED_PLANNER__VELOCITY_OPTIMIZER_HPP_
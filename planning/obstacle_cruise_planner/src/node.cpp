@@ -27,6 +27,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
 
 namespace
 {
@@ -106,6 +110,44 @@ std::pair<double, double> projectObstacleVelocityToTrajectory(
   return std::make_pair(projected_velocity[0], projected_velocity[1]);
 }
 
+// lower bound of the distance between the geometries enveloped by the boxes
+double calcDistanceBetweenBoxes(
+  const tier4_autoware_utils::Box2d & box1, const tier4_autoware_utils::Box2d & box2)
+{
+  const double dx = std::max(
+    {0.0, box1.min_corner().x() - box2.max_corner().x(),
+     box2.min_corner().x() - box1.max_corner().x()});
+  const double dy = std::max(
+    {0.0, box1.min_corner().y() - box2.max_corner().y(),
+     box2.min_corner().y() - box1.max_corner().y()});
+  return std::hypot(dx, dy);
+}
+
+// NOTE: The polygons are checked in the order of the distance between their boxes and the box of
+//       the target polygon, which is a lower bound of the distance between them, until the lower
+//       bound gets larger than the minimum distance. The result is the same as checking all.
+double calcMinDistanceToPolygons(
+  const std::vector<Polygon2d> & polygons,
+  const std::vector<tier4_autoware_utils::Box2d> & polygon_boxes, const Polygon2d & target_polygon)
+{
+  const auto target_box = bg::return_envelope<tier4_autoware_utils::Box2d>(target_polygon);
+  std::vector<std::pair<double, size_t>> box_dist_indices;
+  box_dist_indices.reserve(polygon_boxes.size());
+  for (size_t i = 0; i < polygon_boxes.size(); ++i) {
+    box_dist_indices.emplace_back(calcDistanceBetweenBoxes(polygon_boxes.at(i), target_box), i);
+  }
+  std::sort(box_dist_indices.begin(), box_dist_indices.end());
+
+  double min_dist = std::numeric_limits<double>::max();
+  for (const auto & [box_dist, idx] : box_dist_indices) {
+    if (min_dist <= box_dist) {
+      break;
+    }
+    min_dist = std::min(min_dist, bg::distance(polygons.at(idx), target_polygon));
+  }
+  return min_dist;
+}
+
 double calcObstacleMaxLength(const Shape & shape)
 {
   if (shape.type == Shape::BOUNDING_BOX) {
@@ -765,6 +807,12 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstObstacles(
   const auto decimated_traj_polys =
     createOneStepPolygons(decimated_traj_points, vehicle_info_, odometry.pose.pose);
   debug_data_ptr_->detection_polygons = decimated_traj_polys;
+  std::vector<tier4_autoware_utils::Box2d> decimated_traj_poly_boxes;
+  decimated_traj_poly_boxes.reserve(decimated_traj_polys.size());
+  for (const auto & traj_poly : decimated_traj_polys) {
+    decimated_traj_poly_boxes.push_back(
+      bg::return_envelope<tier4_autoware_utils::Box2d>(traj_poly));
+  }
 
   // determine ego's behavior from stop, cruise and slow down
   std::vector<StopObstacle> stop_obstacles;
@@ -775,11 +823,8 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstObstacles(
     const auto obstacle_poly = obstacle.toPolygon();
 
     // Calculate distance between trajectory and obstacle first
-    double precise_lat_dist = std::numeric_limits<double>::max();
-    for (const auto & traj_poly : decimated_traj_polys) {
-      const double current_precise_lat_dist = bg::distance(traj_poly, obstacle_poly);
-      precise_lat_dist = std::min(precise_lat_dist, current_precise_lat_dist);
-    }
+    const double precise_lat_dist =
+      calcMinDistanceToPolygons(decimated_traj_polys, decimated_traj_poly_boxes, obstacle_poly);
 
     // Filter obstacles for cruise, stop and slow down
     const auto cruise_obstacle =
@@ -1520,108 +1565,112 @@ void ObstacleCruisePlannerNode::publishDebugMarker() const
   stop_watch_.tic(__func__);
 
   // 1. publish debug marker
-  MarkerArray debug_marker;
-
-  // obstacles to cruise
-  std::vector<geometry_msgs::msg::Point> stop_collision_points;
-  for (size_t i = 0; i < debug_data_ptr_->obstacles_to_cruise.size(); ++i) {
-    // obstacle
-    const auto obstacle_marker = obstacle_cruise_utils::getObjectMarker(
-      debug_data_ptr_->obstacles_to_cruise.at(i).pose, i, "obstacles_to_cruise", 1.0, 0.6, 0.1);
-    debug_marker.markers.push_back(obstacle_marker);
-
-    // collision points
-    for (size_t j = 0; j < debug_data_ptr_->obstacles_to_cruise.at(i).collision_points.size();
-         ++j) {
-      stop_collision_points.push_back(
-        debug_data_ptr_->obstacles_to_cruise.at(i).collision_points.at(j).point);
+  // NOTE: the markers are built only when subscribed, since there are many obstacles in a cycle
+  if (debug_marker_pub_->get_subscription_count() > 0) {
+    MarkerArray debug_marker;
+
+    // obstacles to cruise
+    std::vector<geometry_msgs::msg::Point> stop_collision_points;
+    for (size_t i = 0; i < debug_data_ptr_->obstacles_to_cruise.size(); ++i) {
+      // obstacle
+      const auto obstacle_marker = obstacle_cruise_utils::getObjectMarker(
+        debug_data_ptr_->obstacles_to_cruise.at(i).pose, i, "obstacles_to_cruise", 1.0, 0.6, 0.1);
+      debug_marker.markers.push_back(obstacle_marker);
+
+      // collision points
+      for (size_t j = 0; j < debug_data_ptr_->obstacles_to_cruise.at(i).collision_points.size();
+           ++j) {
+        stop_collision_points.push_back(
+          debug_data_ptr_->obstacles_to_cruise.at(i).collision_points.at(j).point);
+      }
+    }
+    for (size_t i = 0; i < stop_collision_points.size(); ++i) {
+      auto collision_point_marker = tier4_autoware_utils::createDefaultMarker(
+        "map", now(), "cruise_collision_points", i, Marker::SPHERE,
+        tier4_autoware_utils::createMarkerScale(0.25, 0.25, 0.25),
+        tier4_autoware_utils::createMarkerColor(1.0, 0.0, 0.0, 0.999));
+      collision_point_marker.pose.position = stop_collision_points.at(i);
+      debug_marker.markers.push_back(collision_point_marker);
     }
-  }
-  for (size_t i = 0; i < stop_collision_points.size(); ++i) {
-    auto collision_point_marker = tier4_autoware_utils::createDefaultMarker(
-      "map", now(), "cruise_collision_points", i, Marker::SPHERE,
-      tier4_autoware_utils::createMarkerScale(0.25, 0.25, 0.25),
-      tier4_autoware_utils::createMarkerColor(1.0, 0.0, 0.0, 0.999));
-    collision_point_marker.pose.position = stop_collision_points.at(i);
-    debug_marker.markers.push_back(collision_point_marker);
-  }
 
-  // obstacles to stop
-  for (size_t i = 0; i < debug_data_ptr_->obstacles_to_stop.size(); ++i) {
-    // obstacle
-    const auto obstacle_marker = obstacle_cruise_utils::getObjectMarker(
-      debug_data_ptr_->obstacles_to_stop.at(i).pose, i, "obstacles_to_stop", 1.0, 0.0, 0.0);
-    debug_marker.markers.push_back(obstacle_marker);
-
-    // collision point
-    auto collision_point_marker = tier4_autoware_utils::createDefaultMarker(
-      "map", now(), "stop_collision_points", 0, Marker::SPHERE,
-      tier4_autoware_utils::createMarkerScale(0.25, 0.25, 0.25),
-      tier4_autoware_utils::createMarkerColor(1.0, 0.0, 0.0, 0.999));
-    collision_point_marker.pose.position = debug_data_ptr_->obstacles_to_stop.at(i).collision_point;
-    debug_marker.markers.push_back(collision_point_marker);
-  }
+    // obstacles to stop
+    for (size_t i = 0; i < debug_data_ptr_->obstacles_to_stop.size(); ++i) {
+      // obstacle
+      const auto obstacle_marker = obstacle_cruise_utils::getObjectMarker(
+        debug_data_ptr_->obstacles_to_stop.at(i).pose, i, "obstacles_to_stop", 1.0, 0.0, 0.0);
+      debug_marker.markers.push_back(obstacle_marker);
+
+      // collision point
+      auto collision_point_marker = tier4_autoware_utils::createDefaultMarker(
+        "map", now(), "stop_collision_points", 0, Marker::SPHERE,
+        tier4_autoware_utils::createMarkerScale(0.25, 0.25, 0.25),
+        tier4_autoware_utils::createMarkerColor(1.0, 0.0, 0.0, 0.999));
+      collision_point_marker.pose.position =
+        debug_data_ptr_->obstacles_to_stop.at(i).collision_point;
+      debug_marker.markers.push_back(collision_point_marker);
+    }
 
-  // obstacles to slow down
-  for (size_t i = 0; i < debug_data_ptr_->obstacles_to_slow_down.size(); ++i) {
-    // obstacle
-    const auto obstacle_marker = obstacle_cruise_utils::getObjectMarker(
-      debug_data_ptr_->obstacles_to_slow_down.at(i).pose, i, "obstacles_to_slow_down", 0.7, 0.7,
-      0.0);
-    debug_marker.markers.push_back(obstacle_marker);
-
-    // collision points
-    auto front_collision_point_marker = tier4_autoware_utils::createDefaultMarker(
-      "map", now(), "slow_down_collision_points", i * 2 + 0, Marker::SPHERE,
-      tier4_autoware_utils::createMarkerScale(0.25, 0.25, 0.25),
-      tier4_autoware_utils::createMarkerColor(1.0, 0.0, 0.0, 0.999));
-    front_collision_point_marker.pose.position =
-      debug_data_ptr_->obstacles_to_slow_down.at(i).front_collision_point;
-    auto back_collision_point_marker = tier4_autoware_utils::createDefaultMarker(
-      "map", now(), "slow_down_collision_points", i * 2 + 1, Marker::SPHERE,
-      tier4_autoware_utils::createMarkerScale(0.25, 0.25, 0.25),
-      tier4_autoware_utils::createMarkerColor(1.0, 0.0, 0.0, 0.999));
-    back_collision_point_marker.pose.position =
-      debug_data_ptr_->obstacles_to_slow_down.at(i).back_collision_point;
-
-    debug_marker.markers.push_back(front_collision_point_marker);
-    debug_marker.markers.push_back(back_collision_point_marker);
-  }
+    // obstacles to slow down
+    for (size_t i = 0; i < debug_data_ptr_->obstacles_to_slow_down.size(); ++i) {
+      // obstacle
+      const auto obstacle_marker = obstacle_cruise_utils::getObjectMarker(
+        debug_data_ptr_->obstacles_to_slow_down.at(i).pose, i, "obstacles_to_slow_down", 0.7, 0.7,
+        0.0);
+      debug_marker.markers.push_back(obstacle_marker);
+
+      // collision points
+      auto front_collision_point_marker = tier4_autoware_utils::createDefaultMarker(
+        "map", now(), "slow_down_collision_points", i * 2 + 0, Marker::SPHERE,
+        tier4_autoware_utils::createMarkerScale(0.25, 0.25, 0.25),
+        tier4_autoware_utils::createMarkerColor(1.0, 0.0, 0.0, 0.999));
+      front_collision_point_marker.pose.position =
+        debug_data_ptr_->obstacles_to_slow_down.at(i).front_collision_point;
+      auto back_collision_point_marker = tier4_autoware_utils::createDefaultMarker(
+        "map", now(), "slow_down_collision_points", i * 2 + 1, Marker::SPHERE,
+        tier4_autoware_utils::createMarkerScale(0.25, 0.25, 0.25),
+        tier4_autoware_utils::createMarkerColor(1.0, 0.0, 0.0, 0.999));
+      back_collision_point_marker.pose.position =
+        debug_data_ptr_->obstacles_to_slow_down.at(i).back_collision_point;
+
+      debug_marker.markers.push_back(front_collision_point_marker);
+      debug_marker.markers.push_back(back_collision_point_marker);
+    }
 
-  // intentionally ignored obstacles to cruise or stop
-  for (size_t i = 0; i < debug_data_ptr_->intentionally_ignored_obstacles.size(); ++i) {
-    const auto marker = obstacle_cruise_utils::getObjectMarker(
-      debug_data_ptr_->intentionally_ignored_obstacles.at(i).pose, i,
-      "intentionally_ignored_obstacles", 0.0, 1.0, 0.0);
-    debug_marker.markers.push_back(marker);
-  }
+    // intentionally ignored obstacles to cruise or stop
+    for (size_t i = 0; i < debug_data_ptr_->intentionally_ignored_obstacles.size(); ++i) {
+      const auto marker = obstacle_cruise_utils::getObjectMarker(
+        debug_data_ptr_->intentionally_ignored_obstacles.at(i).pose, i,
+        "intentionally_ignored_obstacles", 0.0, 1.0, 0.0);
+      debug_marker.markers.push_back(marker);
+    }
 
-  {  // footprint polygons
-    auto marker = tier4_autoware_utils::createDefaultMarker(
-      "map", now(), "detection_polygons", 0, Marker::LINE_LIST,
-      tier4_autoware_utils::createMarkerScale(0.01, 0.0, 0.0),
-      tier4_autoware_utils::createMarkerColor(0.0, 1.0, 0.0, 0.999));
-
-    for (const auto & detection_polygon : debug_data_ptr_->detection_polygons) {
-      for (size_t dp_idx = 0; dp_idx < detection_polygon.outer().size(); ++dp_idx) {
-        const auto & current_point = detection_polygon.outer().at(dp_idx);
-        const auto & next_point =
-          detection_polygon.outer().at((dp_idx + 1) % detection_polygon.outer().size());
-
-        marker.points.push_back(
-          tier4_autoware_utils::createPoint(current_point.x(), current_point.y(), 0.0));
-        marker.points.push_back(
-          tier4_autoware_utils::createPoint(next_point.x(), next_point.y(), 0.0));
+    {  // footprint polygons
+      auto marker = tier4_autoware_utils::createDefaultMarker(
+        "map", now(), "detection_polygons", 0, Marker::LINE_LIST,
+        tier4_autoware_utils::createMarkerScale(0.01, 0.0, 0.0),
+        tier4_autoware_utils::createMarkerColor(0.0, 1.0, 0.0, 0.999));
+
+      for (const auto & detection_polygon : debug_data_ptr_->detection_polygons) {
+        for (size_t dp_idx = 0; dp_idx < detection_polygon.outer().size(); ++dp_idx) {
+          const auto & current_point = detection_polygon.outer().at(dp_idx);
+          const auto & next_point =
+            detection_polygon.outer().at((dp_idx + 1) % detection_polygon.outer().size());
+
+          marker.points.push_back(
+            tier4_autoware_utils::createPoint(current_point.x(), current_point.y(), 0.0));
+          marker.points.push_back(
+            tier4_autoware_utils::createPoint(next_point.x(), next_point.y(), 0.0));
+        }
       }
+      debug_marker.markers.push_back(marker);
     }
-    debug_marker.markers.push_back(marker);
-  }
 
-  // slow down debug wall marker
-  tier4_autoware_utils::appendMarkerArray(
-    debug_data_ptr_->slow_down_debug_wall_marker, &debug_marker);
+    // slow down debug wall marker
+    tier4_autoware_utils::appendMarkerArray(
+      debug_data_ptr_->slow_down_debug_wall_marker, &debug_marker);
 
-  debug_marker_pub_->publish(debug_marker);
+    debug_marker_pub_->publish(debug_marker);
+  }
 
   // 2. publish virtual wall for cruise and stop
   debug_cruise_wall_marker_pub_->publish(debug_data_ptr_->cruise_wall_marker);
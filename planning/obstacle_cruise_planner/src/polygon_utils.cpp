@@ -52,12 +52,19 @@ std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndex(
   const Shape & object_shape, const double max_dist = std::numeric_limits<double>::max())
 {
   const auto obj_polygon = tier4_autoware_utils::toPolygon2d(object_pose, object_shape);
+  const auto obj_box = boost::geometry::return_envelope<tier4_autoware_utils::Box2d>(obj_polygon);
   for (size_t i = 0; i < traj_polygons.size(); ++i) {
     const double approximated_dist =
       tier4_autoware_utils::calcDistance2d(traj_points.at(i).pose, object_pose);
     if (approximated_dist > max_dist) {
       continue;
     }
+    // NOTE: The polygons whose boxes are disjoint have no intersection with a positive area.
+    if (boost::geometry::disjoint(
+          boost::geometry::return_envelope<tier4_autoware_utils::Box2d>(traj_polygons.at(i)),
+          obj_box)) {
+      continue;
+    }
 
     std::vector<Polygon2d> collision_polygons;
     boost::geometry::intersection(traj_polygons.at(i), obj_polygon, collision_polygons);
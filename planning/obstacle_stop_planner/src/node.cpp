@@ -13,9 +13,12 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -27,6 +30,7 @@
 #include <Eigen/Geometry>
 
 #include <pcl/filters/voxel_grid.h>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 #include <tf2/utils.h>
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -1461,32 +1465,65 @@ bool ObstacleStopPlannerNode::searchPointcloudNearTrajectory(
     return false;
   }
 
-  PointCloud2 transformed_points{};
   const Eigen::Matrix4f affine_matrix =
     tf2::transformToEigen(transform_stamped.transform).matrix().cast<float>();
-  pcl_ros::transformPointCloud(affine_matrix, *input_points_ptr, transformed_points);
-  PointCloud::Ptr transformed_points_ptr(new PointCloud);
-  pcl::fromROSMsg(transformed_points, *transformed_points_ptr);
 
-  output_points_ptr->header = transformed_points_ptr->header;
+  // NOTE: pcl_ros::transformPointCloud keeps the header of the input pointcloud.
+  pcl_conversions::toPCL(input_points_ptr->header, output_points_ptr->header);
 
   // search obstacle candidate pointcloud to reduce calculation cost
   const double search_radius = node_param_.enable_slow_down
                                  ? slow_down_param_.slow_down_search_radius
                                  : stop_param.stop_search_radius;
   const double squared_radius = search_radius * search_radius;
-  std::vector<geometry_msgs::msg::Point> center_points;
-  center_points.reserve(trajectory.size());
+  if (!(0.0 < search_radius)) {
+    return true;
+  }
+
+  // NOTE: Each center point is registered to the 3x3 cells of search_radius size around it, so
+  //       that a point is compared only with the center points registered to the cell of it.
+  const auto to_cell_index = [&](const double x, const double y) {
+    return std::make_pair(
+      static_cast<int64_t>(std::floor(x / search_radius)),
+      static_cast<int64_t>(std::floor(y / search_radius)));
+  };
+  const auto to_cell_key = [](const int64_t ix, const int64_t iy) {
+    return (static_cast<uint64_t>(ix) << 32) ^ (static_cast<uint64_t>(iy) & 0xffffffff);
+  };
+  std::unordered_map<uint64_t, std::vector<geometry_msgs::msg::Point>> center_points_grid;
   for (const auto & trajectory_point : trajectory) {
-    center_points.push_back(getVehicleCenterFromBase(trajectory_point.pose, vehicle_info).position);
+    const auto center_point =
+      getVehicleCenterFromBase(trajectory_point.pose, vehicle_info).position;
+    const auto [ix, iy] = to_cell_index(center_point.x, center_point.y);
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+      for (int64_t dy = -1; dy <= 1; ++dy) {
+        center_points_grid[to_cell_key(ix + dx, iy + dy)].push_back(center_point);
+      }
+    }
   }
-  for (const auto & point : transformed_points_ptr->points) {
-    for (const auto & center_point : center_points) {
-      const double x = center_point.x - point.x;
-      const double y = center_point.y - point.y;
+
+  // NOTE: The points are transformed as pcl_ros::transformPointCloud does, while being streamed
+  //       from the buffer of the input pointcloud without the intermediate pointclouds.
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(*input_points_ptr, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(*input_points_ptr, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(*input_points_ptr, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    if (!std::isfinite(*iter_x) || !std::isfinite(*iter_y) || !std::isfinite(*iter_z)) {
+      continue;
+    }
+    const Eigen::Vector4f point = affine_matrix * Eigen::Vector4f(*iter_x, *iter_y, *iter_z, 1.0f);
+
+    const auto [ix, iy] = to_cell_index(point.x(), point.y());
+    const auto cell_itr = center_points_grid.find(to_cell_key(ix, iy));
+    if (cell_itr == center_points_grid.end()) {
+      continue;
+    }
+    for (const auto & center_point : cell_itr->second) {
+      const double x = center_point.x - point.x();
+      const double y = center_point.y - point.y();
       const double squared_distance = x * x + y * y;
       if (squared_distance < squared_radius) {
-        output_points_ptr->points.push_back(point);
+        output_points_ptr->points.emplace_back(point.x(), point.y(), point.z());
         break;
       }
     }
@@ -77,6 +77,7 @@ private:
   PointCloud::ConstSharedPtr pointcloud_ptr_;
   lanelet::LaneletMapPtr lanelet_map_ptr_{new lanelet::LaneletMap};
   multi_linestring_t static_map_obstacles_;
+  std::shared_ptr<const ObstacleTree<multi_linestring_t>> static_map_obstacle_tree_ptr_;
   nav_msgs::msg::Odometry::ConstSharedPtr current_odometry_ptr_;
 
   // parameters
@@ -100,6 +101,10 @@ private:
   /// @param[in] msg input trajectory message
   void onTrajectory(const Trajectory::ConstSharedPtr msg);
 
+  /// @brief extract the static obstacles from the lanelet map and build their R-tree
+  /// @details the R-tree is only built if the obstacles have more segments than the R-tree minimum
+  void updateStaticMapObstacles();
+
   /// @brief validate the inputs of the node
   /// @return true if the inputs are valid
   bool validInputs();
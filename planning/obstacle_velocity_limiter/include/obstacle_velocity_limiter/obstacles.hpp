@@ -115,10 +115,14 @@ struct CollisionChecker
   const Obstacles obstacles;
   std::unique_ptr<ObstacleTree<multipoint_t>> point_obstacle_tree_ptr;
   std::unique_ptr<ObstacleTree<multi_linestring_t>> line_obstacle_tree_ptr;
+  // tree of the line obstacles which are not in the obstacles, e.g., the static map obstacles
+  // whose tree is built once for all the trajectories
+  std::shared_ptr<const ObstacleTree<multi_linestring_t>> static_line_obstacle_tree_ptr;
 
   explicit CollisionChecker(
-    Obstacles obs, const size_t rtree_min_points, const size_t rtree_min_segments)
-  : obstacles(std::move(obs))
+    Obstacles obs, const size_t rtree_min_points, const size_t rtree_min_segments,
+    std::shared_ptr<const ObstacleTree<multi_linestring_t>> static_line_tree_ptr = nullptr)
+  : obstacles(std::move(obs)), static_line_obstacle_tree_ptr(std::move(static_line_tree_ptr))
   {
     auto segment_count = 0lu;
     for (const auto & line : obstacles.lines)
@@ -137,6 +141,10 @@ struct CollisionChecker
     } else {
       boost::geometry::intersection(polygon, obstacles.lines, result);
     }
+    if (static_line_obstacle_tree_ptr) {
+      const auto & static_line_result = static_line_obstacle_tree_ptr->intersections(polygon);
+      result.insert(result.end(), static_line_result.begin(), static_line_result.end());
+    }
     if (point_obstacle_tree_ptr) {
       const auto & point_result = point_obstacle_tree_ptr->intersections(polygon);
       result.insert(result.end(), point_result.begin(), point_result.end());
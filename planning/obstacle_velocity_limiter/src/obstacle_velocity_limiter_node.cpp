@@ -61,8 +61,7 @@ ObstacleVelocityLimiterNode::ObstacleVelocityLimiterNode(const rclcpp::NodeOptio
     "~/input/map", rclcpp::QoS{1}.transient_local(),
     [this](const autoware_auto_mapping_msgs::msg::HADMapBin::ConstSharedPtr msg) {
       lanelet::utils::conversion::fromBinMsg(*msg, lanelet_map_ptr_);
-      static_map_obstacles_ =
-        extractStaticObstacles(*lanelet_map_ptr_, obstacle_params_.static_map_tags);
+      updateStaticMapObstacles();
     });
 
   pub_trajectory_ = create_publisher<Trajectory>("~/output/trajectory", 1);
@@ -135,9 +134,7 @@ rcl_interfaces::msg::SetParametersResult ObstacleVelocityLimiterNode::onParamete
       obstacle_params_.dynamic_obstacles_min_vel = static_cast<Float>(parameter.as_double());
     } else if (parameter.get_name() == ObstacleParameters::MAP_TAGS_PARAM) {
       obstacle_params_.static_map_tags = parameter.as_string_array();
-      if (lanelet_map_ptr_)
-        static_map_obstacles_ =
-          extractStaticObstacles(*lanelet_map_ptr_, obstacle_params_.static_map_tags);
+      if (lanelet_map_ptr_) updateStaticMapObstacles();
     } else if (parameter.get_name() == ObstacleParameters::FILTERING_PARAM) {
       obstacle_params_.filter_envelope = parameter.as_bool();
     } else if (parameter.get_name() == ObstacleParameters::IGNORE_ON_PATH_PARAM) {
@@ -148,6 +145,7 @@ rcl_interfaces::msg::SetParametersResult ObstacleVelocityLimiterNode::onParamete
       obstacle_params_.updateRtreeMinPoints(*this, static_cast<int>(parameter.as_int()));
     } else if (parameter.get_name() == ObstacleParameters::RTREE_SEGMENTS_PARAM) {
       obstacle_params_.updateRtreeMinSegments(*this, static_cast<int>(parameter.as_int()));
+      if (lanelet_map_ptr_) updateStaticMapObstacles();
       // Projection parameters
     } else if (parameter.get_name() == ProjectionParameters::MODEL_PARAM) {
       if (!projection_params_.updateModel(*this, parameter.as_string())) {
@@ -204,7 +202,7 @@ void ObstacleVelocityLimiterNode::onTrajectory(const Trajectory::ConstSharedPtr
   const auto footprint_polygons =
     createFootprintPolygons(projected_linestrings, vehicle_lateral_offset_);
   Obstacles obstacles;
-  obstacles.lines = static_map_obstacles_;
+  if (!static_map_obstacle_tree_ptr_) obstacles.lines = static_map_obstacles_;
   if (obstacle_params_.dynamic_source != ObstacleParameters::STATIC_ONLY) {
     if (obstacle_params_.filter_envelope)
       obstacle_masks.positive_mask = createEnvelopePolygon(footprint_polygons);
@@ -215,7 +213,8 @@ void ObstacleVelocityLimiterNode::onTrajectory(const Trajectory::ConstSharedPtr
   limitVelocity(
     downsampled_traj,
     CollisionChecker(
-      obstacles, obstacle_params_.rtree_min_points, obstacle_params_.rtree_min_segments),
+      obstacles, obstacle_params_.rtree_min_points, obstacle_params_.rtree_min_segments,
+      static_map_obstacle_tree_ptr_),
     projected_linestrings, footprint_polygons, projection_params_, velocity_params_);
   auto safe_trajectory = copyDownsampledVelocity(
     downsampled_traj, original_traj, start_idx, preprocessing_params_.downsample_factor);
@@ -230,6 +229,9 @@ void ObstacleVelocityLimiterNode::onTrajectory(const Trajectory::ConstSharedPtr
     static_cast<double>(runtime.count())));
 
   if (pub_debug_markers_->get_subscription_count() > 0) {
+    if (static_map_obstacle_tree_ptr_)
+      obstacles.lines.insert(
+        obstacles.lines.end(), static_map_obstacles_.begin(), static_map_obstacles_.end());
     const auto safe_projected_linestrings =
       createProjectedLines(downsampled_traj, projection_params_);
     const auto safe_footprint_polygons =
@@ -240,6 +242,21 @@ void ObstacleVelocityLimiterNode::onTrajectory(const Trajectory::ConstSharedPtr
   }
 }
 
+void ObstacleVelocityLimiterNode::updateStaticMapObstacles()
+{
+  static_map_obstacles_ =
+    extractStaticObstacles(*lanelet_map_ptr_, obstacle_params_.static_map_tags);
+  // the static obstacles do not change between trajectories so their R-tree is only built here
+  auto segment_count = 0lu;
+  for (const auto & line : static_map_obstacles_)
+    if (!line.empty()) segment_count += line.size() - 1;
+  if (segment_count > obstacle_params_.rtree_min_segments)
+    static_map_obstacle_tree_ptr_ =
+      std::make_shared<const ObstacleTree<multi_linestring_t>>(static_map_obstacles_);
+  else
+    static_map_obstacle_tree_ptr_.reset();
+}
+
 bool ObstacleVelocityLimiterNode::validInputs()
 {
   constexpr auto one_sec = rcutils_duration_value_t(1000);
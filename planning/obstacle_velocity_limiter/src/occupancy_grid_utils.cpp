@@ -17,7 +17,6 @@
 #include "obstacle_velocity_limiter/types.hpp"
 
 #include <grid_map_core/Polygon.hpp>
-#include <grid_map_core/iterators/GridMapIterator.hpp>
 #include <grid_map_cv/GridMapCvConverter.hpp>
 #include <grid_map_ros/GridMapRosConverter.hpp>
 #include <grid_map_utils/polygon_iterator.hpp>
@@ -53,13 +52,10 @@ void maskPolygons(grid_map::GridMap & grid_map, const ObstacleMasks & obstacle_m
 
 void threshold(grid_map::GridMap & grid_map, const float threshold)
 {
-  for (grid_map::GridMapIterator iter(grid_map); !iter.isPastEnd(); ++iter) {
-    auto & val = grid_map.at("layer", *iter);
-    if (val < threshold)
-      val = 0.0;
-    else
-      val = 127;
-  }
+  // NOTE: The whole layer is thresholded at once instead of looking up the layer for each cell.
+  //       Unknown cells (NaN) are set to the max value as the comparison with them is false.
+  auto & layer = grid_map["layer"];
+  layer = layer.unaryExpr([threshold](const float val) { return val < threshold ? 0.0f : 127.0f; });
 }
 
 grid_map::GridMap convertToGridMap(const OccupancyGrid & occupancy_grid)
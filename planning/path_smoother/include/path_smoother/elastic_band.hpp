@@ -111,6 +111,8 @@ private:
 
   std::unique_ptr<autoware::common::osqp::OSQPInterface> osqp_solver_ptr_;
   std::shared_ptr<std::vector<TrajectoryPoint>> prev_eb_traj_points_ptr_{nullptr};
+  std::vector<double> prev_primal_solution_;
+  std::vector<double> prev_dual_solution_;
 
   std::vector<TrajectoryPoint> insertFixedPoint(
     const std::vector<TrajectoryPoint> & traj_point) const;
@@ -122,6 +124,8 @@ private:
     const std::vector<TrajectoryPoint> & traj_points, const bool is_goal_contained,
     const int pad_start_idx);
 
+  void setShiftedWarmStart(const std::vector<TrajectoryPoint> & traj_points);
+
   std::optional<std::vector<double>> calcSmoothedTrajectory();
 
   std::optional<std::vector<TrajectoryPoint>> convertOptimizedPointsToTrajectory(
@@ -39,8 +39,10 @@ Eigen::SparseMatrix<double> makePMatrix(const int num_points)
       triplet_vec.push_back(Eigen::Triplet<double>(row + num_points, colum + num_points, value));
     };
 
+  // NOTE: Only the band of the second order difference is stored so that the sparsity pattern of
+  //       the QP does not depend on the number of points quadratically.
   for (int r = 0; r < num_points; ++r) {
-    for (int c = 0; c < num_points; ++c) {
+    for (int c = std::max(r - 2, 0); c <= std::min(r + 2, num_points - 1); ++c) {
       if (r == c) {
         if (r == 0 || r == num_points - 1) {
           assign_value_to_triplet_vec(r, c, 1.0);
@@ -57,10 +59,8 @@ Eigen::SparseMatrix<double> makePMatrix(const int num_points)
         } else {
           assign_value_to_triplet_vec(r, c, -4.0);
         }
-      } else if (std::abs(c - r) == 2) {
-        assign_value_to_triplet_vec(r, c, 1.0);
       } else {
-        assign_value_to_triplet_vec(r, c, 0.0);
+        assign_value_to_triplet_vec(r, c, 1.0);
       }
     }
   }
@@ -192,6 +192,8 @@ void EBPathSmoother::initialize(const bool enable_debug_info, const CommonParam
 void EBPathSmoother::resetPreviousData()
 {
   prev_eb_traj_points_ptr_ = nullptr;
+  prev_primal_solution_.clear();
+  prev_dual_solution_.clear();
 }
 
 std::vector<TrajectoryPoint> EBPathSmoother::smoothTrajectory(
@@ -256,6 +258,9 @@ std::vector<TrajectoryPoint> EBPathSmoother::smoothTrajectory(
     convertOptimizedPointsToTrajectory(*optimized_points, padded_traj_points, pad_start_idx);
   if (!eb_traj_points) {
     RCLCPP_WARN(logger_, "return std::nullopt since x or y error is too large");
+    // NOTE: The solution is not shifted for warm start since it was not output.
+    prev_primal_solution_.clear();
+    prev_dual_solution_.clear();
     return get_prev_eb_traj_points();
   }
 
@@ -317,7 +322,8 @@ void EBPathSmoother::updateConstraint(
 
   std::vector<TrajectoryPoint> debug_fixed_traj_points;  // for debug
 
-  const Eigen::MatrixXd A = Eigen::MatrixXd::Identity(p.num_points, p.num_points);
+  Eigen::SparseMatrix<double> A(p.num_points, p.num_points);
+  A.setIdentity();
   std::vector<double> upper_bound(p.num_points, 0.0);
   std::vector<double> lower_bound(p.num_points, 0.0);
   for (size_t i = 0; i < static_cast<size_t>(p.num_points); ++i) {
@@ -363,26 +369,31 @@ void EBPathSmoother::updateConstraint(
   sparse_theta_mat.setFromTriplets(theta_triplet_vec.begin(), theta_triplet_vec.end());
 
   // calculate P
+  // NOTE: P and A are kept sparse so that their sparsity pattern depends only on the number of
+  //       points, and the solver is updated in place.
   const Eigen::SparseMatrix<double> raw_P_for_smooth = p.smooth_weight * makePMatrix(p.num_points);
-  const Eigen::MatrixXd theta_P_mat = sparse_theta_mat * raw_P_for_smooth;
-  const Eigen::MatrixXd P_for_smooth = theta_P_mat * sparse_theta_mat.transpose();
-  const Eigen::MatrixXd P_for_lat_error =
-    p.lat_error_weight * Eigen::MatrixXd::Identity(p.num_points, p.num_points);
-  const Eigen::MatrixXd P = P_for_smooth + P_for_lat_error;
+  const Eigen::SparseMatrix<double> theta_P_mat = sparse_theta_mat * raw_P_for_smooth;
+  const Eigen::SparseMatrix<double> P_for_smooth = theta_P_mat * sparse_theta_mat.transpose();
+  Eigen::SparseMatrix<double> P_for_lat_error(p.num_points, p.num_points);
+  P_for_lat_error.setIdentity();
+  const Eigen::SparseMatrix<double> P = P_for_smooth + p.lat_error_weight * P_for_lat_error;
 
   // calculate q
   const Eigen::VectorXd raw_q_for_smooth = theta_P_mat * x_mat;
   const auto q = toStdVector(raw_q_for_smooth);
 
+  const auto P_csc = autoware::common::osqp::calCSCMatrixTrapezoidal(P);
+  const auto A_csc = autoware::common::osqp::calCSCMatrix(A);
   if (p.enable_warm_start && osqp_solver_ptr_) {
-    osqp_solver_ptr_->updateP(P);
-    osqp_solver_ptr_->updateQ(q);
-    osqp_solver_ptr_->updateA(A);
-    osqp_solver_ptr_->updateBounds(lower_bound, upper_bound);
+    const bool is_updated_in_place = osqp_solver_ptr_->isSameSparsityPattern(P_csc, A_csc);
+    osqp_solver_ptr_->updateCscProblem(P_csc, A_csc, q, lower_bound, upper_bound);
     osqp_solver_ptr_->updateEpsRel(p.qp_param.eps_rel);
+    if (is_updated_in_place) {
+      setShiftedWarmStart(traj_points);
+    }
   } else {
     osqp_solver_ptr_ = std::make_unique<autoware::common::osqp::OSQPInterface>(
-      P, A, q, lower_bound, upper_bound, p.qp_param.eps_abs);
+      P_csc, A_csc, q, lower_bound, upper_bound, p.qp_param.eps_abs);
     osqp_solver_ptr_->updateEpsRel(p.qp_param.eps_rel);
     osqp_solver_ptr_->updateEpsAbs(p.qp_param.eps_abs);
     osqp_solver_ptr_->updateMaxIter(p.qp_param.max_iteration);
@@ -396,6 +407,33 @@ void EBPathSmoother::updateConstraint(
   time_keeper_ptr_->toc(__func__, "        ");
 }
 
+void EBPathSmoother::setShiftedWarmStart(const std::vector<TrajectoryPoint> & traj_points)
+{
+  if (
+    !prev_eb_traj_points_ptr_ || prev_eb_traj_points_ptr_->empty() ||
+    prev_primal_solution_.size() != traj_points.size() ||
+    prev_dual_solution_.size() != traj_points.size()) {
+    return;
+  }
+
+  // NOTE: The previous solution is shifted by the number of points the ego travelled, so that the
+  //       lateral offset of each point starts from the one of the same point in the previous cycle.
+  const size_t shift_idx = motion_utils::findNearestIndex(
+    *prev_eb_traj_points_ptr_, traj_points.front().pose.position);
+  if (shift_idx == 0) {
+    return;
+  }
+
+  std::vector<double> primal_solution(traj_points.size());
+  std::vector<double> dual_solution(traj_points.size());
+  for (size_t i = 0; i < traj_points.size(); ++i) {
+    const size_t prev_idx = std::min(i + shift_idx, traj_points.size() - 1);
+    primal_solution.at(i) = prev_primal_solution_.at(prev_idx);
+    dual_solution.at(i) = prev_dual_solution_.at(prev_idx);
+  }
+  osqp_solver_ptr_->setWarmStart(primal_solution, dual_solution);
+}
+
 std::optional<std::vector<double>> EBPathSmoother::calcSmoothedTrajectory()
 {
   time_keeper_ptr_->tic(__func__);
@@ -418,6 +456,9 @@ std::optional<std::vector<double>> EBPathSmoother::calcSmoothedTrajectory()
     return std::nullopt;
   }
 
+  prev_primal_solution_ = optimized_points;
+  prev_dual_solution_ = std::get<1>(result);
+
   time_keeper_ptr_->toc(__func__, "        ");
   return optimized_points;
 }
@@ -24,6 +24,7 @@
 #include <lanelet2_extension/utility/message_conversion.hpp>
 #include <lanelet2_extension/utility/utilities.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
+#include <tier4_autoware_utils/ros/polling_subscriber.hpp>
 
 #include <autoware_adapi_v1_msgs/msg/operation_mode_state.hpp>
 #include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
@@ -192,7 +193,8 @@ HADMapBin make_map_bin_msg(
  *
  * This function loads a lanelet2_map.osm from the test_map folder in the
  * planning_test_utils package, overwrites the centerline with a resolution of 5.0,
- * and converts the map to a HADMapBin message.
+ * and converts the map to a HADMapBin message. The map is loaded only once in a process,
+ * and the cached message is returned with the current stamp.
  *
  * @return A HADMapBin message containing the map data.
  */
@@ -299,7 +301,7 @@ void updateNodeOptions(
  * @brief Loads a PathWithLaneId message from a YAML file.
  *
  * This function loads a PathWithLaneId message from a YAML file located in the
- * planning_test_utils package.
+ * planning_test_utils package. The file is parsed only once in a process.
  *
  * @return A PathWithLaneId message containing the loaded data.
  */
@@ -440,6 +442,27 @@ void setSubscriber(
     test_node, topic_name, [&count](const typename T::ConstSharedPtr) { count++; }, subscriber);
 }
 
+/**
+ * @brief Creates a polling subscriber with appropriate QoS settings.
+ *
+ * This function creates a polling subscriber for a given topic name and message type with the
+ * same QoS settings as createSubscription, so that the output of the target node can be checked
+ * with takeAll() without adding a subscription callback to the executor.
+ *
+ * @tparam T The type of the message to subscribe to.
+ * @param test_node The node to create the subscriber on.
+ * @param topic_name The name of the topic to subscribe to.
+ * @return A shared pointer to the created polling subscriber.
+ */
+template <typename T>
+std::shared_ptr<tier4_autoware_utils::InterProcessPollingBatchSubscriber<T>>
+createPollingSubscriber(rclcpp::Node::SharedPtr test_node, std::string topic_name)
+{
+  const auto qos = std::is_same_v<T, Trajectory> ? rclcpp::QoS{1} : rclcpp::QoS{10};
+  return std::make_shared<tier4_autoware_utils::InterProcessPollingBatchSubscriber<T>>(
+    test_node.get(), topic_name, qos);
+}
+
 /**
  * @brief Publishes data to a target node.
  *
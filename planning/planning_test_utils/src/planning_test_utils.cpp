@@ -121,12 +121,20 @@ HADMapBin make_map_bin_msg(const std::string & absolute_path, const double cente
 
 HADMapBin makeMapBinMsg()
 {
-  const auto planning_test_utils_dir =
-    ament_index_cpp::get_package_share_directory("planning_test_utils");
-  const auto lanelet2_path = planning_test_utils_dir + "/test_map/lanelet2_map.osm";
-  double center_line_resolution = 5.0;
-
-  return make_map_bin_msg(lanelet2_path, center_line_resolution);
+  // NOTE: The map is loaded only once in a process, since loading and converting it takes most of
+  //       the time of the tests that publish it to each target node.
+  static const HADMapBin cached_map_bin_msg = []() {
+    const auto planning_test_utils_dir =
+      ament_index_cpp::get_package_share_directory("planning_test_utils");
+    const auto lanelet2_path = planning_test_utils_dir + "/test_map/lanelet2_map.osm";
+    double center_line_resolution = 5.0;
+
+    return make_map_bin_msg(lanelet2_path, center_line_resolution);
+  }();
+
+  HADMapBin map_bin_msg = cached_map_bin_msg;
+  map_bin_msg.header.stamp = rclcpp::Clock(RCL_ROS_TIME).now();
+  return map_bin_msg;
 }
 
 Odometry makeOdometry(const double shift)
@@ -248,7 +256,9 @@ void updateNodeOptions(
   node_options.arguments(std::vector<std::string>{arguments.begin(), arguments.end()});
 }
 
-PathWithLaneId loadPathWithLaneIdInYaml()
+namespace
+{
+PathWithLaneId loadPathWithLaneIdInYamlFile()
 {
   const auto planning_test_utils_dir =
     ament_index_cpp::get_package_share_directory("planning_test_utils");
@@ -309,5 +319,13 @@ PathWithLaneId loadPathWithLaneIdInYaml()
   }
   return path_msg;
 }
+}  // namespace
+
+PathWithLaneId loadPathWithLaneIdInYaml()
+{
+  // The file is parsed only once in a process, the same as the map.
+  static const PathWithLaneId cached_path_msg = loadPathWithLaneIdInYamlFile();
+  return cached_path_msg;
+}
 
 }  // namespace test_utils
@@ -32,6 +32,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace planning_validator
 {
@@ -95,6 +96,16 @@ private:
 
   void validate(const Trajectory & trajectory);
 
+  // check with the maximum value and its index which are already calculated
+  bool checkValidCurvature(
+    const Trajectory & trajectory, const std::pair<double, size_t> & max_curvature);
+  bool checkValidLateralAcceleration(
+    const Trajectory & trajectory, const std::pair<double, size_t> & max_lateral_acc);
+  bool checkValidSteering(
+    const Trajectory & trajectory, const std::pair<double, size_t> & max_steering);
+  bool checkValidSteeringRate(
+    const Trajectory & trajectory, const std::pair<double, size_t> & max_steering_rate);
+
   void publishProcessingTime(const double processing_time_ms);
   void publishTrajectory();
   void publishDebugInfo();
@@ -28,6 +28,15 @@ namespace planning_validator
 using autoware_auto_planning_msgs::msg::Trajectory;
 using autoware_auto_planning_msgs::msg::TrajectoryPoint;
 
+// maximum value and its index of the metrics calculated from the curvature
+struct CurvatureMetrics
+{
+  std::pair<double, size_t> max_curvature{0.0, 0};
+  std::pair<double, size_t> max_lateral_acc{0.0, 0};
+  std::pair<double, size_t> max_steering{0.0, 0};
+  std::pair<double, size_t> max_steering_rate{0.0, 0};
+};
+
 std::pair<double, size_t> getMaxValAndIdx(const std::vector<double> & v);
 
 std::pair<double, size_t> getMinValAndIdx(const std::vector<double> & v);
@@ -61,6 +70,10 @@ std::pair<double, size_t> calcMaxSteeringAngles(
 std::pair<double, size_t> calcMaxSteeringRates(
   const Trajectory & trajectory, const double wheelbase);
 
+// same results as calcMaxCurvature(), calcMaxLateralAcceleration(), calcMaxSteeringAngles() and
+// calcMaxSteeringRates(), with the curvature calculated only once
+CurvatureMetrics calcCurvatureMetrics(const Trajectory & trajectory, const double wheelbase);
+
 bool checkFinite(const TrajectoryPoint & point);
 
 void shiftPose(geometry_msgs::msg::Pose & pose, double longitudinal);
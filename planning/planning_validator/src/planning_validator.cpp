@@ -315,10 +315,15 @@ void PlanningValidator::validate(const Trajectory & trajectory)
   const auto resampled = resampleTrajectory(trajectory, min_interval);
 
   s.is_valid_relative_angle = checkValidRelativeAngle(resampled);
-  s.is_valid_curvature = checkValidCurvature(resampled);
-  s.is_valid_lateral_acc = checkValidLateralAcceleration(resampled);
-  s.is_valid_steering = checkValidSteering(resampled);
-  s.is_valid_steering_rate = checkValidSteeringRate(resampled);
+
+  // the metrics from the curvature are calculated together to calculate the curvature only once
+  const auto curvature_metrics = calcCurvatureMetrics(resampled, vehicle_info_.wheel_base_m);
+  s.is_valid_curvature = checkValidCurvature(resampled, curvature_metrics.max_curvature);
+  s.is_valid_lateral_acc =
+    checkValidLateralAcceleration(resampled, curvature_metrics.max_lateral_acc);
+  s.is_valid_steering = checkValidSteering(resampled, curvature_metrics.max_steering);
+  s.is_valid_steering_rate =
+    checkValidSteeringRate(resampled, curvature_metrics.max_steering_rate);
 
   s.invalid_count = isAllValid(s) ? 0 : s.invalid_count + 1;
 }
@@ -373,7 +378,13 @@ bool PlanningValidator::checkValidRelativeAngle(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidCurvature(const Trajectory & trajectory)
 {
-  const auto [max_curvature, i] = calcMaxCurvature(trajectory);
+  return checkValidCurvature(trajectory, calcMaxCurvature(trajectory));
+}
+
+bool PlanningValidator::checkValidCurvature(
+  const Trajectory & trajectory, const std::pair<double, size_t> & max_curvature_and_idx)
+{
+  const auto [max_curvature, i] = max_curvature_and_idx;
   validation_status_.max_curvature = max_curvature;
   if (max_curvature > validation_params_.curvature_threshold) {
     const auto & p = trajectory.points;
@@ -389,7 +400,13 @@ bool PlanningValidator::checkValidCurvature(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidLateralAcceleration(const Trajectory & trajectory)
 {
-  const auto [max_lateral_acc, i] = calcMaxLateralAcceleration(trajectory);
+  return checkValidLateralAcceleration(trajectory, calcMaxLateralAcceleration(trajectory));
+}
+
+bool PlanningValidator::checkValidLateralAcceleration(
+  const Trajectory & trajectory, const std::pair<double, size_t> & max_lateral_acc_and_idx)
+{
+  const auto [max_lateral_acc, i] = max_lateral_acc_and_idx;
   validation_status_.max_lateral_acc = max_lateral_acc;
   if (max_lateral_acc > validation_params_.lateral_acc_threshold) {
     debug_pose_publisher_->pushPoseMarker(trajectory.points.at(i), "lateral_acceleration");
@@ -424,7 +441,14 @@ bool PlanningValidator::checkValidMaxLongitudinalAcceleration(const Trajectory &
 
 bool PlanningValidator::checkValidSteering(const Trajectory & trajectory)
 {
-  const auto [max_steering, i] = calcMaxSteeringAngles(trajectory, vehicle_info_.wheel_base_m);
+  return checkValidSteering(
+    trajectory, calcMaxSteeringAngles(trajectory, vehicle_info_.wheel_base_m));
+}
+
+bool PlanningValidator::checkValidSteering(
+  const Trajectory & trajectory, const std::pair<double, size_t> & max_steering_and_idx)
+{
+  const auto [max_steering, i] = max_steering_and_idx;
   validation_status_.max_steering = max_steering;
 
   if (max_steering > validation_params_.steering_threshold) {
@@ -436,7 +460,14 @@ bool PlanningValidator::checkValidSteering(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidSteeringRate(const Trajectory & trajectory)
 {
-  const auto [max_steering_rate, i] = calcMaxSteeringRates(trajectory, vehicle_info_.wheel_base_m);
+  return checkValidSteeringRate(
+    trajectory, calcMaxSteeringRates(trajectory, vehicle_info_.wheel_base_m));
+}
+
+bool PlanningValidator::checkValidSteeringRate(
+  const Trajectory & trajectory, const std::pair<double, size_t> & max_steering_rate_and_idx)
+{
+  const auto [max_steering_rate, i] = max_steering_rate_and_idx;
   validation_status_.max_steering_rate = max_steering_rate;
 
   if (max_steering_rate > validation_params_.steering_rate_threshold) {
@@ -78,10 +78,11 @@ Trajectory resampleTrajectory(const Trajectory & trajectory, const double min_in
     return resampled;
   }
 
+  resampled.points.reserve(trajectory.points.size());
   resampled.points.push_back(trajectory.points.front());
   for (size_t i = 1; i < trajectory.points.size(); ++i) {
-    const auto prev = resampled.points.back();
-    const auto curr = trajectory.points.at(i);
+    const auto & prev = resampled.points.back();
+    const auto & curr = trajectory.points.at(i);
     if (calcDistance2d(prev, curr) > min_interval) {
       resampled.points.push_back(curr);
     }
@@ -95,7 +96,7 @@ void calcCurvature(
   const double curvature_distance)
 {
   if (trajectory.points.size() < 3) {
-    curvature_arr = std::vector<double>(trajectory.points.size(), 0.0);
+    curvature_arr.assign(trajectory.points.size(), 0.0);
     return;
   }
 
@@ -107,7 +108,7 @@ void calcCurvature(
   }
 
   // initialize with 0 curvature
-  curvature_arr = std::vector<double>(trajectory.points.size(), 0.0);
+  curvature_arr.assign(trajectory.points.size(), 0.0);
 
   size_t first_distant_index = 0;
   size_t last_distant_index = trajectory.points.size() - 1;
@@ -302,6 +303,53 @@ std::pair<double, size_t> calcMaxSteeringRates(
   return {max_steering_rate, max_index};
 }
 
+CurvatureMetrics calcCurvatureMetrics(const Trajectory & trajectory, const double wheelbase)
+{
+  CurvatureMetrics metrics;
+  if (trajectory.points.empty()) {
+    return metrics;
+  }
+
+  std::vector<double> curvatures;
+  calcCurvature(trajectory, curvatures);
+
+  // NOTE: The curvature and the steering take the first maximum as std::max_element() does.
+  metrics.max_curvature = {curvatures.front(), 0};
+  metrics.max_steering = {std::abs(std::atan(curvatures.front() * wheelbase)), 0};
+  double prev_steering = 0.0;
+  for (size_t i = 0; i < curvatures.size(); ++i) {
+    const auto & p = trajectory.points.at(i);
+    const auto k = curvatures.at(i);
+
+    if (metrics.max_curvature.first < k) {
+      metrics.max_curvature = {k, i};
+    }
+
+    const auto v = p.longitudinal_velocity_mps;
+    const auto lat_acc = v * v * k;
+    takeBigger(
+      metrics.max_lateral_acc.first, metrics.max_lateral_acc.second, std::abs(lat_acc), i);
+
+    const auto steering = std::atan(k * wheelbase);
+    if (metrics.max_steering.first < std::abs(steering)) {
+      metrics.max_steering = {std::abs(steering), i};
+    }
+
+    if (0 < i) {
+      const auto & p_prev = trajectory.points.at(i - 1);
+      const auto delta_s = calcDistance2d(p_prev, p);
+      const auto v_mean = 0.5 * (p.longitudinal_velocity_mps + p_prev.longitudinal_velocity_mps);
+      const auto dt = delta_s / std::max(v_mean, 1.0e-5);
+      const auto steer_rate = (steering - prev_steering) / dt;
+      takeBigger(
+        metrics.max_steering_rate.first, metrics.max_steering_rate.second, std::abs(steer_rate),
+        i - 1);
+    }
+    prev_steering = steering;
+  }
+  return metrics;
+}
+
 bool checkFinite(const TrajectoryPoint & point)
 {
   const auto & p = point.pose.position;
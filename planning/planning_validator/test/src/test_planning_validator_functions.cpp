@@ -14,6 +14,7 @@
 
 #include "planning_validator/debug_marker.hpp"
 #include "planning_validator/planning_validator.hpp"
+#include "planning_validator/utils.hpp"
 #include "test_parameter.hpp"
 #include "test_planning_validator_helper.hpp"
 
@@ -160,3 +161,31 @@ TEST(PlanningValidatorTestSuite, checkValidRelativeAngleFunction)
     ASSERT_FALSE(validator->checkValidRelativeAngle(invalid_traj));
   }
 }
+
+TEST(PlanningValidatorTestSuite, calcCurvatureMetricsFunction)
+{
+  using planning_validator::calcCurvatureMetrics;
+  using planning_validator::calcMaxCurvature;
+  using planning_validator::calcMaxLateralAcceleration;
+  using planning_validator::calcMaxSteeringAngles;
+  using planning_validator::calcMaxSteeringRates;
+
+  constexpr auto wheelbase = 2.5;
+  const auto expect_same_metrics = [&](const Trajectory & trajectory) {
+    const auto metrics = calcCurvatureMetrics(trajectory, wheelbase);
+    EXPECT_EQ(metrics.max_curvature, calcMaxCurvature(trajectory));
+    EXPECT_EQ(metrics.max_lateral_acc, calcMaxLateralAcceleration(trajectory));
+    EXPECT_EQ(metrics.max_steering, calcMaxSteeringAngles(trajectory, wheelbase));
+    EXPECT_EQ(metrics.max_steering_rate, calcMaxSteeringRates(trajectory, wheelbase));
+  };
+
+  expect_same_metrics(generateTrajectory(1.0));
+  expect_same_metrics(generateTrajectory(1.0, 10.0, 0.0, 2));
+
+  Trajectory traj = generateTrajectory(1.0);
+  traj.points[3].pose.position.y = 0.5;
+  traj.points[4].pose.position.y = 1.5;
+  traj.points[6].pose.position.y = -0.5;
+  traj.points[6].longitudinal_velocity_mps = 3.0;
+  expect_same_metrics(traj);
+}
@@ -31,8 +31,13 @@
 #include <lanelet2_traffic_rules/TrafficRules.h>
 
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace route_handler
@@ -288,6 +293,9 @@ public:
 private:
   // MUST
   lanelet::routing::RoutingGraphPtr routing_graph_ptr_;
+  // NOTE: built on the first search avoiding the no drivable lanes and reset with the map, since it
+  //       is needed only by the mission planner
+  mutable lanelet::routing::RoutingGraphConstPtr drivable_routing_graph_ptr_{nullptr};
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules_ptr_;
   std::shared_ptr<const lanelet::routing::RoutingGraphContainer> overall_graphs_ptr_;
   lanelet::LaneletMapPtr lanelet_map_ptr_;
@@ -306,8 +314,37 @@ private:
   Pose original_start_pose_;
   Pose original_goal_pose_;
 
+  // index of route_lanelets_ for the membership and the spatial queries
+  std::unordered_map<lanelet::Id, size_t> route_lanelet_indices_;
+  lanelet::LaneletSubmapConstPtr route_lanelet_submap_{nullptr};
+
+  /**
+   * results of the queries which only depend on the map and the route, memoized by the lanelet
+   * (id, inverted) and the arguments. It is replaced by a new one whenever the map or the route is
+   * set, so that the copies of this handler keep sharing the results of the same map and route.
+   */
+  struct QueryCache
+  {
+    template <class... Args>
+    using Lanelets = std::map<std::tuple<lanelet::Id, bool, Args...>, lanelet::ConstLanelets>;
+    template <class... Args>
+    using OptionalLanelet =
+      std::map<std::tuple<lanelet::Id, bool, Args...>, std::optional<lanelet::ConstLanelet>>;
+
+    std::mutex mutex;
+    Lanelets<> next_lanelets;
+    Lanelets<> previous_lanelets;
+    Lanelets<> lane_changeable_neighbors;
+    Lanelets<double, bool> lanelet_sequences_after;
+    Lanelets<double, bool> lanelet_sequences_up_to;
+    OptionalLanelet<bool, bool> right_lanelets;
+    OptionalLanelet<bool, bool> left_lanelets;
+  };
+  std::shared_ptr<QueryCache> query_cache_{std::make_shared<QueryCache>()};
+
   // non-const methods
   void setLaneletsFromRouteMsg();
+  void updateRouteLaneletIndex();
 
   // const methods
   // for routing
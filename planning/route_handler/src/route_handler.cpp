@@ -26,6 +26,7 @@
 #include <autoware_auto_planning_msgs/msg/path_point_with_lane_id.hpp>
 #include <autoware_planning_msgs/msg/lanelet_primitive.hpp>
 
+#include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_core/geometry/Lanelet.h>
 #include <lanelet2_core/primitives/LaneletSequence.h>
 #include <lanelet2_routing/Route.h>
@@ -36,8 +37,10 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <unordered_set>
 #include <vector>
 
@@ -122,6 +125,27 @@ PathWithLaneId removeOverlappingPoints(const PathWithLaneId & input_path)
   return filtered_path;
 }
 
+/**
+ * @brief return the memoized value of the key, or compute and memoize it
+ * @details compute() may query the other memoized values, so it runs without the lock
+ */
+template <class Map, class Compute>
+typename Map::mapped_type memoize(
+  std::mutex & mutex, Map & memo, const typename Map::key_type & key, const Compute & compute)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto itr = memo.find(key);
+    if (itr != memo.end()) {
+      return itr->second;
+    }
+  }
+  typename Map::mapped_type value = compute();
+  std::lock_guard<std::mutex> lock(mutex);
+  memo.emplace(key, value);
+  return value;
+}
+
 std::string toString(const geometry_msgs::msg::Pose & pose)
 {
   std::stringstream ss;
@@ -144,6 +168,7 @@ void RouteHandler::setMap(const HADMapBin & map_msg)
   lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
   lanelet::utils::conversion::fromBinMsg(
     map_msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
+  drivable_routing_graph_ptr_ = nullptr;
 
   const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
     lanelet::Locations::Germany, lanelet::Participants::Vehicle);
@@ -162,6 +187,7 @@ void RouteHandler::setMap(const HADMapBin & map_msg)
   is_handler_ready_ = false;
 
   setLaneletsFromRouteMsg();
+  updateRouteLaneletIndex();
 }
 
 bool RouteHandler::isRouteLooped(const RouteSections & route_sections)
@@ -189,6 +215,7 @@ void RouteHandler::setRoute(const LaneletRoute & route_msg)
     route_ptr_ = std::make_shared<LaneletRoute>(route_msg);
     is_handler_ready_ = false;
     setLaneletsFromRouteMsg();
+    updateRouteLaneletIndex();
   } else {
     RCLCPP_ERROR(
       logger_,
@@ -298,6 +325,7 @@ void RouteHandler::setRouteLanelets(const lanelet::ConstLanelets & path_lanelets
   for (const auto & id : route_lanelets_id) {
     route_lanelets_.push_back(lanelet_map_ptr_->laneletLayer.get(id));
   }
+  updateRouteLaneletIndex();
   is_handler_ready_ = true;
 }
 
@@ -309,6 +337,7 @@ void RouteHandler::clearRoute()
   goal_lanelets_.clear();
   route_ptr_ = nullptr;
   is_handler_ready_ = false;
+  updateRouteLaneletIndex();
 }
 
 void RouteHandler::setLaneletsFromRouteMsg()
@@ -358,6 +387,21 @@ void RouteHandler::setLaneletsFromRouteMsg()
   is_handler_ready_ = true;
 }
 
+void RouteHandler::updateRouteLaneletIndex()
+{
+  route_lanelet_indices_.clear();
+  for (size_t i = 0; i < route_lanelets_.size(); ++i) {
+    route_lanelet_indices_.emplace(route_lanelets_.at(i).id(), i);
+  }
+  route_lanelet_submap_ = route_lanelets_.empty()
+                            ? nullptr
+                            : lanelet::utils::createConstSubmap(route_lanelets_, {});
+
+  // the memoized results of the previous map and route may be shared with the copies of this
+  // handler, so they are replaced instead of being cleared
+  query_cache_ = std::make_shared<QueryCache>();
+}
+
 lanelet::ConstPolygon3d RouteHandler::getIntersectionAreaById(const lanelet::Id id) const
 {
   return lanelet_map_ptr_->polygonLayer.get(id);
@@ -525,87 +569,99 @@ bool RouteHandler::isDeadEndLanelet(const lanelet::ConstLanelet & lanelet) const
 lanelet::ConstLanelets RouteHandler::getLaneChangeableNeighbors(
   const lanelet::ConstLanelet & lanelet) const
 {
-  return lanelet::utils::query::getLaneChangeableNeighbors(routing_graph_ptr_, lanelet);
+  return memoize(
+    query_cache_->mutex, query_cache_->lane_changeable_neighbors,
+    {lanelet.id(), lanelet.inverted()}, [&]() {
+      return lanelet::utils::query::getLaneChangeableNeighbors(routing_graph_ptr_, lanelet);
+    });
 }
 
 lanelet::ConstLanelets RouteHandler::getLaneletSequenceAfter(
   const lanelet::ConstLanelet & lanelet, const double min_length, const bool only_route_lanes) const
 {
-  lanelet::ConstLanelets lanelet_sequence_forward;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
-    return lanelet_sequence_forward;
-  }
-
-  double length = 0;
-  lanelet::ConstLanelet current_lanelet = lanelet;
-  while (rclcpp::ok() && length < min_length) {
-    lanelet::ConstLanelet next_lanelet;
-    if (!getNextLaneletWithinRoute(current_lanelet, &next_lanelet)) {
-      if (only_route_lanes) {
-        break;
+  return memoize(
+    query_cache_->mutex, query_cache_->lanelet_sequences_after,
+    {lanelet.id(), lanelet.inverted(), min_length, only_route_lanes}, [&]() {
+      lanelet::ConstLanelets lanelet_sequence_forward;
+      if (only_route_lanes && !isRouteLanelet(lanelet)) {
+        return lanelet_sequence_forward;
       }
-      const auto next_lanes = getNextLanelets(current_lanelet);
-      if (next_lanes.empty()) {
-        break;
+
+      double length = 0;
+      lanelet::ConstLanelet current_lanelet = lanelet;
+      while (rclcpp::ok() && length < min_length) {
+        lanelet::ConstLanelet next_lanelet;
+        if (!getNextLaneletWithinRoute(current_lanelet, &next_lanelet)) {
+          if (only_route_lanes) {
+            break;
+          }
+          const auto next_lanes = getNextLanelets(current_lanelet);
+          if (next_lanes.empty()) {
+            break;
+          }
+          next_lanelet = next_lanes.front();
+        }
+        // loop check
+        if (lanelet.id() == next_lanelet.id()) {
+          break;
+        }
+        lanelet_sequence_forward.push_back(next_lanelet);
+        current_lanelet = next_lanelet;
+        length +=
+          static_cast<double>(boost::geometry::length(next_lanelet.centerline().basicLineString()));
       }
-      next_lanelet = next_lanes.front();
-    }
-    // loop check
-    if (lanelet.id() == next_lanelet.id()) {
-      break;
-    }
-    lanelet_sequence_forward.push_back(next_lanelet);
-    current_lanelet = next_lanelet;
-    length +=
-      static_cast<double>(boost::geometry::length(next_lanelet.centerline().basicLineString()));
-  }
 
-  return lanelet_sequence_forward;
+      return lanelet_sequence_forward;
+    });
 }
 
 lanelet::ConstLanelets RouteHandler::getLaneletSequenceUpTo(
   const lanelet::ConstLanelet & lanelet, const double min_length, const bool only_route_lanes) const
 {
-  lanelet::ConstLanelets lanelet_sequence_backward;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
-    return lanelet_sequence_backward;
-  }
+  return memoize(
+    query_cache_->mutex, query_cache_->lanelet_sequences_up_to,
+    {lanelet.id(), lanelet.inverted(), min_length, only_route_lanes}, [&]() {
+      lanelet::ConstLanelets lanelet_sequence_backward;
+      if (only_route_lanes && !isRouteLanelet(lanelet)) {
+        return lanelet_sequence_backward;
+      }
 
-  lanelet::ConstLanelet current_lanelet = lanelet;
-  double length = 0;
-  lanelet::ConstLanelets previous_lanelets;
-  while (rclcpp::ok() && length < min_length) {
-    previous_lanelets.clear();
-    if (!getPreviousLaneletsWithinRoute(current_lanelet, &previous_lanelets)) {
-      if (only_route_lanes) break;
-      const auto previous_lanelets = getPreviousLanelets(current_lanelet);
-      if (previous_lanelets.empty()) break;
-    }
-    // loop check
-    if (std::any_of(previous_lanelets.begin(), previous_lanelets.end(), [lanelet](auto & prev_llt) {
-          return lanelet.id() == prev_llt.id();
-        })) {
-      break;
-    }
+      lanelet::ConstLanelet current_lanelet = lanelet;
+      double length = 0;
+      lanelet::ConstLanelets previous_lanelets;
+      while (rclcpp::ok() && length < min_length) {
+        previous_lanelets.clear();
+        if (!getPreviousLaneletsWithinRoute(current_lanelet, &previous_lanelets)) {
+          if (only_route_lanes) break;
+          const auto previous_lanelets = getPreviousLanelets(current_lanelet);
+          if (previous_lanelets.empty()) break;
+        }
+        // loop check
+        if (std::any_of(
+              previous_lanelets.begin(), previous_lanelets.end(),
+              [lanelet](auto & prev_llt) { return lanelet.id() == prev_llt.id(); })) {
+          break;
+        }
 
-    for (const auto & prev_lanelet : previous_lanelets) {
-      if (std::any_of(
-            lanelet_sequence_backward.begin(), lanelet_sequence_backward.end(),
-            [prev_lanelet, lanelet](auto & backward) {
-              return (backward.id() == prev_lanelet.id());
-            })) {
-        continue;
+        for (const auto & prev_lanelet : previous_lanelets) {
+          if (std::any_of(
+                lanelet_sequence_backward.begin(), lanelet_sequence_backward.end(),
+                [prev_lanelet, lanelet](auto & backward) {
+                  return (backward.id() == prev_lanelet.id());
+                })) {
+            continue;
+          }
+          lanelet_sequence_backward.push_back(prev_lanelet);
+          length += static_cast<double>(
+            boost::geometry::length(prev_lanelet.centerline().basicLineString()));
+          current_lanelet = prev_lanelet;
+          break;
+        }
       }
-      lanelet_sequence_backward.push_back(prev_lanelet);
-      length +=
-        static_cast<double>(boost::geometry::length(prev_lanelet.centerline().basicLineString()));
-      current_lanelet = prev_lanelet;
-      break;
-    }
-  }
 
-  std::reverse(lanelet_sequence_backward.begin(), lanelet_sequence_backward.end());
-  return lanelet_sequence_backward;
+      std::reverse(lanelet_sequence_backward.begin(), lanelet_sequence_backward.end());
+      return lanelet_sequence_backward;
+    });
 }
 
 lanelet::ConstLanelets RouteHandler::getLaneletSequence(
@@ -619,7 +675,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   }
 
   lanelet::ConstLanelets lanelet_sequence;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return lanelet_sequence;
   }
 
@@ -662,7 +718,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   const lanelet::ConstLanelet & lanelet, const Pose & current_pose, const double backward_distance,
   const double forward_distance, const bool only_route_lanes) const
 {
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return {};
   }
 
@@ -862,7 +918,31 @@ lanelet::ConstLanelets RouteHandler::getShoulderLaneletSequence(
 bool RouteHandler::getClosestLaneletWithinRoute(
   const Pose & search_pose, lanelet::ConstLanelet * closest_lanelet) const
 {
-  return lanelet::utils::query::getClosestLanelet(route_lanelets_, search_pose, closest_lanelet);
+  if (!route_lanelet_submap_) {
+    return lanelet::utils::query::getClosestLanelet(route_lanelets_, search_pose, closest_lanelet);
+  }
+
+  // the lanelets as close as the one with the nearest bounding box have their bounding box within
+  // its distance. the margin is larger than the tolerance used to compare the distances.
+  constexpr double margin = 1.0;
+  const lanelet::BasicPoint2d search_point(search_pose.position.x, search_pose.position.y);
+  const auto nearest_lanelets = route_lanelet_submap_->laneletLayer.nearest(search_point, 1);
+  if (nearest_lanelets.empty()) {
+    return lanelet::utils::query::getClosestLanelet(route_lanelets_, search_pose, closest_lanelet);
+  }
+  const double search_distance =
+    lanelet::geometry::distance2d(nearest_lanelets.front(), search_point) + margin;
+  const lanelet::BasicPoint2d search_offset(search_distance, search_distance);
+  lanelet::ConstLanelets candidate_lanelets = route_lanelet_submap_->laneletLayer.search(
+    lanelet::BoundingBox2d(search_point - search_offset, search_point + search_offset));
+
+  // keep the order of the route lanelets, which decides between the lanelets of the same distance
+  std::sort(
+    candidate_lanelets.begin(), candidate_lanelets.end(), [&](const auto & a, const auto & b) {
+      return route_lanelet_indices_.at(a.id()) < route_lanelet_indices_.at(b.id());
+    });
+  return lanelet::utils::query::getClosestLanelet(
+    candidate_lanelets, search_pose, closest_lanelet);
 }
 
 bool RouteHandler::getClosestPreferredLaneletWithinRoute(
@@ -891,7 +971,7 @@ bool RouteHandler::getNextLaneletWithinRoute(
 
   const auto following_lanelets = routing_graph_ptr_->following(lanelet);
   for (const auto & llt : following_lanelets) {
-    if (start_lane_id != llt.id() && exists(route_lanelets_, llt)) {
+    if (start_lane_id != llt.id() && isRouteLanelet(llt)) {
       *next_lanelet = llt;
       return true;
     }
@@ -901,7 +981,9 @@ bool RouteHandler::getNextLaneletWithinRoute(
 
 lanelet::ConstLanelets RouteHandler::getNextLanelets(const lanelet::ConstLanelet & lanelet) const
 {
-  return routing_graph_ptr_->following(lanelet);
+  return memoize(
+    query_cache_->mutex, query_cache_->next_lanelets, {lanelet.id(), lanelet.inverted()},
+    [&]() { return routing_graph_ptr_->following(lanelet); });
 }
 
 bool RouteHandler::getPreviousLaneletsWithinRoute(
@@ -913,7 +995,7 @@ bool RouteHandler::getPreviousLaneletsWithinRoute(
   const auto candidate_lanelets = routing_graph_ptr_->previous(lanelet);
   prev_lanelets->clear();
   for (const auto & llt : candidate_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (isRouteLanelet(llt)) {
       prev_lanelets->push_back(llt);
     }
   }
@@ -923,7 +1005,9 @@ bool RouteHandler::getPreviousLaneletsWithinRoute(
 lanelet::ConstLanelets RouteHandler::getPreviousLanelets(
   const lanelet::ConstLanelet & lanelet) const
 {
-  return routing_graph_ptr_->previous(lanelet);
+  return memoize(
+    query_cache_->mutex, query_cache_->previous_lanelets, {lanelet.id(), lanelet.inverted()},
+    [&]() { return routing_graph_ptr_->previous(lanelet); });
 }
 
 lanelet::ConstLanelets RouteHandler::getLaneletsFromPoint(const lanelet::ConstPoint3d & point) const
@@ -937,7 +1021,7 @@ bool RouteHandler::getRightLaneletWithinRoute(
   const auto opt_right_lanelet = routing_graph_ptr_->right(lanelet);
   if (!!opt_right_lanelet) {
     *right_lanelet = opt_right_lanelet.value();
-    return exists(route_lanelets_, *right_lanelet);
+    return isRouteLanelet(*right_lanelet);
   }
   return false;
 }
@@ -950,7 +1034,7 @@ bool RouteHandler::getNextLaneletWithinRouteExceptStart(
   }
   const lanelet::ConstLanelets following_lanelets = routing_graph_ptr_->following(lanelet);
   for (const auto & llt : following_lanelets) {
-    if (exists(route_lanelets_, llt) && !exists(start_lanelets_, llt)) {
+    if (isRouteLanelet(llt) && !exists(start_lanelets_, llt)) {
       *next_lanelet = llt;
       return true;
     }
@@ -966,7 +1050,7 @@ bool RouteHandler::getPreviousLaneletWithinRouteExceptGoal(
   }
   const lanelet::ConstLanelets previous_lanelets = routing_graph_ptr_->previous(lanelet);
   for (const auto & llt : previous_lanelets) {
-    if (exists(route_lanelets_, llt) && !(exists(goal_lanelets_, llt))) {
+    if (isRouteLanelet(llt) && !(exists(goal_lanelets_, llt))) {
       *prev_lanelet = llt;
       return true;
     }
@@ -1010,66 +1094,71 @@ std::optional<lanelet::ConstLanelet> RouteHandler::getRightLanelet(
   const lanelet::ConstLanelet & lanelet, const bool enable_same_root,
   const bool get_shoulder_lane) const
 {
-  // right road lanelet of shoulder lanelet
-  if (isShoulderLanelet(lanelet)) {
-    const auto right_lanelets = lanelet_map_ptr_->laneletLayer.findUsages(lanelet.rightBound());
-    for (const auto & right_lanelet : right_lanelets)
-      if (isRoadLanelet(right_lanelet)) return right_lanelet;
-    return std::nullopt;
-  }
+  return memoize(
+    query_cache_->mutex, query_cache_->right_lanelets,
+    {lanelet.id(), lanelet.inverted(), enable_same_root, get_shoulder_lane},
+    [&]() -> std::optional<lanelet::ConstLanelet> {
+      // right road lanelet of shoulder lanelet
+      if (isShoulderLanelet(lanelet)) {
+        const auto right_lanelets = lanelet_map_ptr_->laneletLayer.findUsages(lanelet.rightBound());
+        for (const auto & right_lanelet : right_lanelets)
+          if (isRoadLanelet(right_lanelet)) return right_lanelet;
+        return std::nullopt;
+      }
 
-  // right shoulder lanelet
-  if (get_shoulder_lane) {
-    const auto right_shoulder_lanelet = getRightShoulderLanelet(lanelet);
-    if (right_shoulder_lanelet) return *right_shoulder_lanelet;
-  }
+      // right shoulder lanelet
+      if (get_shoulder_lane) {
+        const auto right_shoulder_lanelet = getRightShoulderLanelet(lanelet);
+        if (right_shoulder_lanelet) return *right_shoulder_lanelet;
+      }
 
-  // routable lane
-  const auto & right_lane = routing_graph_ptr_->right(lanelet);
-  if (right_lane) {
-    return *right_lane;
-  }
+      // routable lane
+      const auto & right_lane = routing_graph_ptr_->right(lanelet);
+      if (right_lane) {
+        return *right_lane;
+      }
 
-  // non-routable lane (e.g. lane change infeasible)
-  const auto & adjacent_right_lane = routing_graph_ptr_->adjacentRight(lanelet);
-  if (adjacent_right_lane) {
-    return *adjacent_right_lane;
-  }
+      // non-routable lane (e.g. lane change infeasible)
+      const auto & adjacent_right_lane = routing_graph_ptr_->adjacentRight(lanelet);
+      if (adjacent_right_lane) {
+        return *adjacent_right_lane;
+      }
 
-  // same root right lanelet
-  if (!enable_same_root) {
-    return std::nullopt;
-  }
+      // same root right lanelet
+      if (!enable_same_root) {
+        return std::nullopt;
+      }
 
-  lanelet::ConstLanelets prev_lanelet;
-  if (!getPreviousLaneletsWithinRoute(lanelet, &prev_lanelet)) {
-    return std::nullopt;
-  }
+      lanelet::ConstLanelets prev_lanelet;
+      if (!getPreviousLaneletsWithinRoute(lanelet, &prev_lanelet)) {
+        return std::nullopt;
+      }
 
-  lanelet::ConstLanelet next_lanelet;
-  if (!getNextLaneletWithinRoute(lanelet, &next_lanelet)) {
-    for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
-      if (lanelet.rightBound().back().id() == lane.leftBound().back().id()) {
-        return lane;
+      lanelet::ConstLanelet next_lanelet;
+      if (!getNextLaneletWithinRoute(lanelet, &next_lanelet)) {
+        for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
+          if (lanelet.rightBound().back().id() == lane.leftBound().back().id()) {
+            return lane;
+          }
+        }
+        return std::nullopt;
       }
-    }
-    return std::nullopt;
-  }
 
-  const auto next_right_lane = getRightLanelet(next_lanelet, false);
-  if (!next_right_lane) {
-    return std::nullopt;
-  }
+      const auto next_right_lane = getRightLanelet(next_lanelet, false);
+      if (!next_right_lane) {
+        return std::nullopt;
+      }
 
-  for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
-    for (const auto & target_lane : getNextLanelets(lane)) {
-      if (next_right_lane.value().id() == target_lane.id()) {
-        return lane;
+      for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
+        for (const auto & target_lane : getNextLanelets(lane)) {
+          if (next_right_lane.value().id() == target_lane.id()) {
+            return lane;
+          }
+        }
       }
-    }
-  }
 
-  return std::nullopt;
+      return std::nullopt;
+    });
 }
 
 bool RouteHandler::getLeftLaneletWithinRoute(
@@ -1078,7 +1167,7 @@ bool RouteHandler::getLeftLaneletWithinRoute(
   const auto opt_left_lanelet = routing_graph_ptr_->left(lanelet);
   if (!!opt_left_lanelet) {
     *left_lanelet = opt_left_lanelet.value();
-    return exists(route_lanelets_, *left_lanelet);
+    return isRouteLanelet(*left_lanelet);
   }
   return false;
 }
@@ -1087,66 +1176,71 @@ std::optional<lanelet::ConstLanelet> RouteHandler::getLeftLanelet(
   const lanelet::ConstLanelet & lanelet, const bool enable_same_root,
   const bool get_shoulder_lane) const
 {
-  // left road lanelet of shoulder lanelet
-  if (isShoulderLanelet(lanelet)) {
-    const auto left_lanelets = lanelet_map_ptr_->laneletLayer.findUsages(lanelet.leftBound());
-    for (const auto & left_lanelet : left_lanelets)
-      if (isRoadLanelet(left_lanelet)) return left_lanelet;
-    return std::nullopt;
-  }
+  return memoize(
+    query_cache_->mutex, query_cache_->left_lanelets,
+    {lanelet.id(), lanelet.inverted(), enable_same_root, get_shoulder_lane},
+    [&]() -> std::optional<lanelet::ConstLanelet> {
+      // left road lanelet of shoulder lanelet
+      if (isShoulderLanelet(lanelet)) {
+        const auto left_lanelets = lanelet_map_ptr_->laneletLayer.findUsages(lanelet.leftBound());
+        for (const auto & left_lanelet : left_lanelets)
+          if (isRoadLanelet(left_lanelet)) return left_lanelet;
+        return std::nullopt;
+      }
 
-  // left shoulder lanelet
-  if (get_shoulder_lane) {
-    const auto left_shoulder_lanelet = getLeftShoulderLanelet(lanelet);
-    if (left_shoulder_lanelet) return *left_shoulder_lanelet;
-  }
+      // left shoulder lanelet
+      if (get_shoulder_lane) {
+        const auto left_shoulder_lanelet = getLeftShoulderLanelet(lanelet);
+        if (left_shoulder_lanelet) return *left_shoulder_lanelet;
+      }
 
-  // routable lane
-  const auto & left_lane = routing_graph_ptr_->left(lanelet);
-  if (left_lane) {
-    return *left_lane;
-  }
+      // routable lane
+      const auto & left_lane = routing_graph_ptr_->left(lanelet);
+      if (left_lane) {
+        return *left_lane;
+      }
 
-  // non-routable lane (e.g. lane change infeasible)
-  const auto & adjacent_left_lane = routing_graph_ptr_->adjacentLeft(lanelet);
-  if (adjacent_left_lane) {
-    return *adjacent_left_lane;
-  }
+      // non-routable lane (e.g. lane change infeasible)
+      const auto & adjacent_left_lane = routing_graph_ptr_->adjacentLeft(lanelet);
+      if (adjacent_left_lane) {
+        return *adjacent_left_lane;
+      }
 
-  // same root right lanelet
-  if (!enable_same_root) {
-    return std::nullopt;
-  }
+      // same root right lanelet
+      if (!enable_same_root) {
+        return std::nullopt;
+      }
 
-  lanelet::ConstLanelets prev_lanelet;
-  if (!getPreviousLaneletsWithinRoute(lanelet, &prev_lanelet)) {
-    return std::nullopt;
-  }
+      lanelet::ConstLanelets prev_lanelet;
+      if (!getPreviousLaneletsWithinRoute(lanelet, &prev_lanelet)) {
+        return std::nullopt;
+      }
 
-  lanelet::ConstLanelet next_lanelet;
-  if (!getNextLaneletWithinRoute(lanelet, &next_lanelet)) {
-    for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
-      if (lanelet.leftBound().back().id() == lane.rightBound().back().id()) {
-        return lane;
+      lanelet::ConstLanelet next_lanelet;
+      if (!getNextLaneletWithinRoute(lanelet, &next_lanelet)) {
+        for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
+          if (lanelet.leftBound().back().id() == lane.rightBound().back().id()) {
+            return lane;
+          }
+        }
+        return std::nullopt;
       }
-    }
-    return std::nullopt;
-  }
 
-  const auto next_left_lane = getLeftLanelet(next_lanelet, false);
-  if (!next_left_lane) {
-    return std::nullopt;
-  }
+      const auto next_left_lane = getLeftLanelet(next_lanelet, false);
+      if (!next_left_lane) {
+        return std::nullopt;
+      }
 
-  for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
-    for (const auto & target_lane : getNextLanelets(lane)) {
-      if (next_left_lane.value().id() == target_lane.id()) {
-        return lane;
+      for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
+        for (const auto & target_lane : getNextLanelets(lane)) {
+          if (next_left_lane.value().id() == target_lane.id()) {
+            return lane;
+          }
+        }
       }
-    }
-  }
 
-  return std::nullopt;
+      return std::nullopt;
+    });
 }
 
 lanelet::Lanelets RouteHandler::getRightOppositeLanelets(
@@ -1599,7 +1693,8 @@ bool RouteHandler::isShoulderLanelet(const lanelet::ConstLanelet & lanelet) cons
 
 bool RouteHandler::isRouteLanelet(const lanelet::ConstLanelet & lanelet) const
 {
-  return lanelet::utils::contains(route_lanelets_, lanelet);
+  // route lanelets are never inverted
+  return !lanelet.inverted() && route_lanelet_indices_.count(lanelet.id()) > 0;
 }
 
 bool RouteHandler::isRoadLanelet(const lanelet::ConstLanelet & lanelet) const
@@ -1655,7 +1750,7 @@ lanelet::ConstLanelets RouteHandler::getLaneSequenceUpTo(
   const lanelet::ConstLanelet & lanelet) const
 {
   lanelet::ConstLanelets lanelet_sequence_backward;
-  if (!exists(route_lanelets_, lanelet)) {
+  if (!isRouteLanelet(lanelet)) {
     return lanelet_sequence_backward;
   }
 
@@ -1711,7 +1806,7 @@ lanelet::ConstLanelets RouteHandler::getLaneSequenceAfter(
   const lanelet::ConstLanelet & lanelet) const
 {
   lanelet::ConstLanelets lane_sequence_forward;
-  if (!exists(route_lanelets_, lanelet)) {
+  if (!isRouteLanelet(lanelet)) {
     return lane_sequence_forward;
   }
   lane_sequence_forward.push_back(lanelet);
@@ -1742,7 +1837,7 @@ lanelet::ConstLanelets RouteHandler::getNeighborsWithinRoute(
     lanelet::utils::query::getAllNeighbors(routing_graph_ptr_, lanelet);
   lanelet::ConstLanelets neighbors_within_route;
   for (const auto & llt : neighbor_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (isRouteLanelet(llt)) {
       neighbors_within_route.push_back(llt);
     }
   }
@@ -1803,8 +1898,6 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
     return false;
   }
 
-  lanelet::Optional<lanelet::routing::Route> optional_route;
-  std::vector<lanelet::ConstLanelets> candidate_paths;
   lanelet::routing::LaneletPath shortest_path;
   bool is_route_found = false;
 
@@ -1820,8 +1913,11 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
 
     bool is_proper_angle = angle_diff <= std::abs(yaw_threshold);
 
-    optional_route = routing_graph_ptr_->getRoute(st_llt, goal_lanelet, 0);
-    if (!optional_route || !is_proper_angle) {
+    // NOTE: only the shortest path is used, so that the whole route is not built by getRoute()
+    const auto optional_path =
+      is_proper_angle ? routing_graph_ptr_->shortestPath(st_llt, goal_lanelet, 0)
+                      : lanelet::Optional<lanelet::routing::LaneletPath>{};
+    if (!optional_path) {
       RCLCPP_ERROR_STREAM(
         logger_, "Failed to find a proper route!"
                    << std::endl
@@ -1834,7 +1930,7 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
     is_route_found = true;
     if (angle_diff < smallest_angle_diff) {
       smallest_angle_diff = angle_diff;
-      shortest_path = optional_route->shortestPath();
+      shortest_path = *optional_path;
       start_lanelet = st_llt;
     }
   }
@@ -1915,11 +2011,13 @@ std::optional<lanelet::routing::LaneletPath> RouteHandler::findDrivableLanePath(
   const lanelet::ConstLanelet & start_lanelet, const lanelet::ConstLanelet & goal_lanelet) const
 {
   // we create a new routing graph with infinite cost on no drivable lanes
-  const auto drivable_routing_graph_ptr = lanelet::routing::RoutingGraph::build(
-    *lanelet_map_ptr_, *traffic_rules_ptr_,
-    lanelet::routing::RoutingCostPtrs{std::make_shared<RoutingCostDrivable>()});
-  const auto route = drivable_routing_graph_ptr->getRoute(start_lanelet, goal_lanelet, 0);
-  if (route) return route->shortestPath();
+  if (!drivable_routing_graph_ptr_) {
+    drivable_routing_graph_ptr_ = lanelet::routing::RoutingGraph::build(
+      *lanelet_map_ptr_, *traffic_rules_ptr_,
+      lanelet::routing::RoutingCostPtrs{std::make_shared<RoutingCostDrivable>()});
+  }
+  const auto path = drivable_routing_graph_ptr_->shortestPath(start_lanelet, goal_lanelet, 0);
+  if (path) return *path;
   return {};
 }
 }  // namespace route_handler
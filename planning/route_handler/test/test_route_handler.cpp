@@ -45,6 +45,20 @@ TEST_F(TestRouteHandler, getGoalLaneId)
   ASSERT_EQ(goal_lane.id(), 5088);
 }
 
+TEST_F(TestRouteHandler, getLaneletSequenceAfterRouteIsUpdated)
+{
+  const auto lanelet = route_handler_->getLaneletsFromId(4785);
+  const auto lanelet_sequence = route_handler_->getLaneletSequence(lanelet);
+  ASSERT_FALSE(lanelet_sequence.empty());
+  EXPECT_EQ(route_handler_->getLaneletSequence(lanelet), lanelet_sequence);
+
+  route_handler_->clearRoute();
+  EXPECT_TRUE(route_handler_->getLaneletSequence(lanelet).empty());
+
+  set_lane_change_test_route();
+  EXPECT_EQ(route_handler_->getLaneletSequence(lanelet), lanelet_sequence);
+}
+
 // TEST_F(TestRouteHandler, getClosestLaneletWithinRouteWhenPointsInRoute)
 // {
 //   lanelet::ConstLanelet closest_lane;
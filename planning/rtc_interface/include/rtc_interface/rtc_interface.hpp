@@ -31,6 +31,7 @@
 
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace rtc_interface
@@ -77,6 +78,9 @@ private:
   void removeStoredCommand(const UUID & uuid);
   rclcpp::Logger getLogger() const;
   bool isLocked() const;
+  CooperateStatus * findCooperateStatus(const UUID & uuid);
+  const CooperateStatus * findCooperateStatus(const UUID & uuid) const;
+  void updateStatusIndices();
 
   rclcpp::Publisher<CooperateStatusArray>::SharedPtr pub_statuses_;
   rclcpp::Publisher<AutoModeStatus>::SharedPtr pub_auto_mode_status_;
@@ -87,8 +91,15 @@ private:
   rclcpp::Clock::SharedPtr clock_;
   rclcpp::Logger logger_;
 
+  struct UUIDHash
+  {
+    size_t operator()(const UUID & uuid) const;
+  };
+
   Module module_;
   CooperateStatusArray registered_status_;
+  // indices of registered_status_.statuses, updated whenever a status is added or removed
+  std::unordered_map<UUID, size_t, UUIDHash> status_indices_;
   std::vector<CooperateCommand> stored_commands_;
   bool is_auto_mode_enabled_;
   bool is_locked_;
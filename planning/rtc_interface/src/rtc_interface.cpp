@@ -15,6 +15,7 @@
 #include "rtc_interface/rtc_interface.hpp"
 
 #include <chrono>
+#include <cstring>
 
 namespace
 {
@@ -149,10 +150,8 @@ std::vector<CooperateResponse> RTCInterface::validateCooperateCommands(
     response.uuid = command.uuid;
     response.module = command.module;
 
-    const auto itr = std::find_if(
-      registered_status_.statuses.begin(), registered_status_.statuses.end(),
-      [command](auto & s) { return s.uuid == command.uuid; });
-    if (itr != registered_status_.statuses.end()) {
+    const auto * itr = findCooperateStatus(command.uuid);
+    if (itr) {
       if (itr->state.type == State::WAITING_FOR_EXECUTION || itr->state.type == State::RUNNING) {
         response.success = true;
       } else {
@@ -178,12 +177,10 @@ std::vector<CooperateResponse> RTCInterface::validateCooperateCommands(
 void RTCInterface::updateCooperateCommandStatus(const std::vector<CooperateCommand> & commands)
 {
   for (const auto & command : commands) {
-    const auto itr = std::find_if(
-      registered_status_.statuses.begin(), registered_status_.statuses.end(),
-      [command](auto & s) { return s.uuid == command.uuid; });
+    auto * itr = findCooperateStatus(command.uuid);
 
     // Update command if the command has been already received
-    if (itr != registered_status_.statuses.end()) {
+    if (itr) {
       if (itr->state.type == State::WAITING_FOR_EXECUTION || itr->state.type == State::RUNNING) {
         itr->command_status = command.command;
         itr->auto_mode = false;
@@ -218,12 +215,10 @@ void RTCInterface::updateCooperateStatus(
 {
   std::lock_guard<std::mutex> lock(mutex_);
   // Find registered status which has same uuid
-  auto itr = std::find_if(
-    registered_status_.statuses.begin(), registered_status_.statuses.end(),
-    [uuid](auto & s) { return s.uuid == uuid; });
+  auto * itr = findCooperateStatus(uuid);
 
   // If there is no registered status, add it
-  if (itr == registered_status_.statuses.end()) {
+  if (!itr) {
     CooperateStatus status;
     status.stamp = stamp;
     status.uuid = uuid;
@@ -235,6 +230,7 @@ void RTCInterface::updateCooperateStatus(
     status.finish_distance = finish_distance;
     status.auto_mode = is_auto_mode_enabled_;
     registered_status_.statuses.push_back(status);
+    status_indices_.emplace(uuid, registered_status_.statuses.size() - 1);
     return;
   }
 
@@ -251,12 +247,11 @@ void RTCInterface::removeCooperateStatus(const UUID & uuid)
   std::lock_guard<std::mutex> lock(mutex_);
   removeStoredCommand(uuid);
   // Find registered status which has same uuid and erase it
-  const auto itr = std::find_if(
-    registered_status_.statuses.begin(), registered_status_.statuses.end(),
-    [uuid](auto & s) { return s.uuid == uuid; });
+  const auto itr = status_indices_.find(uuid);
 
-  if (itr != registered_status_.statuses.end()) {
-    registered_status_.statuses.erase(itr);
+  if (itr != status_indices_.end()) {
+    registered_status_.statuses.erase(registered_status_.statuses.begin() + itr->second);
+    updateStatusIndices();
     return;
   }
 
@@ -280,28 +275,31 @@ void RTCInterface::removeStoredCommand(const UUID & uuid)
 void RTCInterface::removeExpiredCooperateStatus()
 {
   std::lock_guard<std::mutex> lock(mutex_);
+  const auto now = clock_->now();
   const auto itr = std::remove_if(
     registered_status_.statuses.begin(), registered_status_.statuses.end(),
-    [this](const auto & status) { return (clock_->now() - status.stamp).seconds() > 10.0; });
+    [&now](const auto & status) { return (now - status.stamp).seconds() > 10.0; });
 
-  registered_status_.statuses.erase(itr, registered_status_.statuses.end());
+  if (itr != registered_status_.statuses.end()) {
+    registered_status_.statuses.erase(itr, registered_status_.statuses.end());
+    updateStatusIndices();
+  }
 }
 
 void RTCInterface::clearCooperateStatus()
 {
   std::lock_guard<std::mutex> lock(mutex_);
   registered_status_.statuses.clear();
+  status_indices_.clear();
   stored_commands_.clear();
 }
 
 bool RTCInterface::isActivated(const UUID & uuid) const
 {
   std::lock_guard<std::mutex> lock(mutex_);
-  const auto itr = std::find_if(
-    registered_status_.statuses.begin(), registered_status_.statuses.end(),
-    [uuid](auto & s) { return s.uuid == uuid; });
+  const auto * itr = findCooperateStatus(uuid);
 
-  if (itr != registered_status_.statuses.end()) {
+  if (itr) {
     if (itr->state.type == State::FAILED || itr->state.type == State::SUCCEEDED) {
       return false;
     }
@@ -320,20 +318,15 @@ bool RTCInterface::isActivated(const UUID & uuid) const
 bool RTCInterface::isRegistered(const UUID & uuid) const
 {
   std::lock_guard<std::mutex> lock(mutex_);
-  const auto itr = std::find_if(
-    registered_status_.statuses.begin(), registered_status_.statuses.end(),
-    [uuid](auto & s) { return s.uuid == uuid; });
-  return itr != registered_status_.statuses.end();
+  return status_indices_.count(uuid) != 0;
 }
 
 bool RTCInterface::isRTCEnabled(const UUID & uuid) const
 {
   std::lock_guard<std::mutex> lock(mutex_);
-  const auto itr = std::find_if(
-    registered_status_.statuses.begin(), registered_status_.statuses.end(),
-    [uuid](auto & s) { return s.uuid == uuid; });
+  const auto * itr = findCooperateStatus(uuid);
 
-  if (itr != registered_status_.statuses.end()) {
+  if (itr) {
     return !itr->auto_mode;
   }
 
@@ -363,4 +356,38 @@ bool RTCInterface::isLocked() const
   return is_locked_;
 }
 
+size_t RTCInterface::UUIDHash::operator()(const UUID & uuid) const
+{
+  // the uuid is random, so that the first bytes are enough as the hash
+  size_t hash = 0;
+  std::memcpy(&hash, uuid.uuid.data(), sizeof(hash));
+  return hash;
+}
+
+CooperateStatus * RTCInterface::findCooperateStatus(const UUID & uuid)
+{
+  const auto itr = status_indices_.find(uuid);
+  if (itr == status_indices_.end()) {
+    return nullptr;
+  }
+  return &registered_status_.statuses.at(itr->second);
+}
+
+const CooperateStatus * RTCInterface::findCooperateStatus(const UUID & uuid) const
+{
+  const auto itr = status_indices_.find(uuid);
+  if (itr == status_indices_.end()) {
+    return nullptr;
+  }
+  return &registered_status_.statuses.at(itr->second);
+}
+
+void RTCInterface::updateStatusIndices()
+{
+  status_indices_.clear();
+  for (size_t i = 0; i < registered_status_.statuses.size(); ++i) {
+    status_indices_.emplace(registered_status_.statuses.at(i).uuid, i);
+  }
+}
+
 }  // namespace rtc_interface
@@ -19,10 +19,28 @@
 #include <boost/geometry.hpp>
 #include <boost/geometry/algorithms/within.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 namespace sampler_common::constraints
 {
+namespace
+{
+using tier4_autoware_utils::Box2d;
+
+double calcDistanceBetweenBoxes(const Box2d & box1, const Box2d & box2)
+{
+  const double dx = std::max(
+    {0.0, box1.min_corner().x() - box2.max_corner().x(),
+     box2.min_corner().x() - box1.max_corner().x()});
+  const double dy = std::max(
+    {0.0, box1.min_corner().y() - box2.max_corner().y(),
+     box2.min_corner().y() - box1.max_corner().y()});
+  return std::hypot(dx, dy);
+}
+}  // namespace
+
 bool satisfyMinMax(const std::vector<double> & values, const double min, const double max)
 {
   for (const auto value : values) {
@@ -35,8 +53,14 @@ bool has_collision(
   const MultiPoint2d & footprint, const MultiPolygon2d & obstacles, const double min_distance)
 {
   if (footprint.empty()) return false;
-  for (const auto & o : obstacles)
+  const auto footprint_box = boost::geometry::return_envelope<Box2d>(footprint);
+  for (const auto & o : obstacles) {
+    // NOTE: the distance between the envelopes is a lower bound of the distance, so that the
+    //       obstacles far from the footprint are skipped without the exact distance
+    const auto obstacle_box = boost::geometry::return_envelope<Box2d>(o);
+    if (calcDistanceBetweenBoxes(footprint_box, obstacle_box) > min_distance) continue;
     if (boost::geometry::distance(o, footprint) <= min_distance) return true;
+  }
   return false;
 }
 
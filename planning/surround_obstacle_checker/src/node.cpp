@@ -17,7 +17,6 @@
 #include <autoware_auto_tf2/tf2_autoware_auto_msgs.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/ros/update_param.hpp>
-#include <tier4_autoware_utils/transform/transforms.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/assign/list_of.hpp>
@@ -26,9 +25,7 @@
 #include <boost/geometry/geometries/linestring.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 
-#include <pcl/common/transforms.h>
-#include <pcl/point_cloud.h>
-#include <pcl_conversions/pcl_conversions.h>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 
 #include <optional>
 #ifdef ROS_DISTRO_GALACTIC
@@ -38,6 +35,7 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -146,6 +144,47 @@ Polygon2d createSelfPolygon(
 
   return ego_polygon;
 }
+
+// axis-aligned rectangle in base_link with the same corners as createSelfPolygon()
+struct SelfRectangle
+{
+  double front_m;
+  double rear_m;
+  double left_m;
+  double right_m;
+
+  // same as bg::distance(createSelfPolygon(...), Point2d(x, y)), 0 inside the rectangle
+  double distance(const double x, const double y) const
+  {
+    const double dx = std::max({rear_m - x, 0.0, x - front_m});
+    const double dy = std::max({right_m - y, 0.0, y - left_m});
+    return std::sqrt(dx * dx + dy * dy);
+  }
+};
+
+SelfRectangle createSelfRectangle(
+  const VehicleInfo & vehicle_info, const double front_margin, const double side_margin,
+  const double rear_margin)
+{
+  return SelfRectangle{
+    vehicle_info.max_longitudinal_offset_m + front_margin,
+    vehicle_info.min_longitudinal_offset_m - rear_margin,
+    vehicle_info.max_lateral_offset_m + side_margin,
+    vehicle_info.min_lateral_offset_m - side_margin};
+}
+
+// radius of the circle around the object center which covers the object polygon
+double calcObjectRadius(const Shape & shape)
+{
+  if (shape.type == Shape::POLYGON) {
+    double radius = 0.0;
+    for (const auto & p : shape.footprint.points) {
+      radius = std::max(radius, std::hypot(p.x, p.y));
+    }
+    return radius;
+  }
+  return std::hypot(shape.dimensions.x / 2.0, shape.dimensions.y / 2.0);
+}
 }  // namespace
 
 SurroundObstacleCheckerNode::SurroundObstacleCheckerNode(const rclcpp::NodeOptions & node_options)
@@ -431,30 +470,40 @@ std::optional<Obstacle> SurroundObstacleCheckerNode::getNearestObstacleByPointCl
     return std::nullopt;
   }
 
-  Eigen::Affine3f isometry =
+  const Eigen::Affine3f isometry =
     tf2::transformToEigen(transform_stamped.value().transform).cast<float>();
-  pcl::PointCloud<pcl::PointXYZ> transformed_pointcloud;
-  pcl::fromROSMsg(*pointcloud_ptr_, transformed_pointcloud);
-  tier4_autoware_utils::transformPointCloud(
-    transformed_pointcloud, transformed_pointcloud, isometry);
 
   const double front_margin = node_param_.pointcloud_surround_check_front_distance;
   const double side_margin = node_param_.pointcloud_surround_check_side_distance;
   const double back_margin = node_param_.pointcloud_surround_check_back_distance;
-  const auto ego_polygon = createSelfPolygon(vehicle_info_, front_margin, side_margin, back_margin);
+  const auto ego_rectangle =
+    createSelfRectangle(vehicle_info_, front_margin, side_margin, back_margin);
 
+  // NOTE: The points are read from the message buffer and transformed one by one instead of
+  //       converting and transforming the whole pointcloud with PCL.
   geometry_msgs::msg::Point nearest_point;
   double minimum_distance = std::numeric_limits<double>::max();
   bool was_minimum_distance_updated = false;
-  for (const auto & p : transformed_pointcloud) {
-    Point2d boost_point(p.x, p.y);
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(*pointcloud_ptr_, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(*pointcloud_ptr_, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(*pointcloud_ptr_, "z");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    const Eigen::Vector3f p = isometry * Eigen::Vector3f(*iter_x, *iter_y, *iter_z);
+    // the distance to the invalid points is NaN, which never updates the minimum distance
+    if (!std::isfinite(p.x()) || !std::isfinite(p.y())) {
+      continue;
+    }
 
-    const auto distance_to_object = bg::distance(ego_polygon, boost_point);
+    const auto distance_to_object = ego_rectangle.distance(p.x(), p.y());
 
     if (distance_to_object < minimum_distance) {
-      nearest_point = createPoint(p.x, p.y, p.z);
+      nearest_point = createPoint(p.x(), p.y(), p.z());
       minimum_distance = distance_to_object;
       was_minimum_distance_updated = true;
+      // no point can be nearer than the one inside the ego polygon
+      if (minimum_distance == 0.0) {
+        break;
+      }
     }
   }
 
@@ -492,8 +541,6 @@ std::optional<Obstacle> SurroundObstacleCheckerNode::getNearestObstacleByDynamic
     const double front_margin = node_param_.surround_check_front_distance_map.at(label);
     const double side_margin = node_param_.surround_check_side_distance_map.at(label);
     const double back_margin = node_param_.surround_check_back_distance_map.at(label);
-    const auto ego_polygon =
-      createSelfPolygon(vehicle_info_, front_margin, side_margin, back_margin);
 
     tf2::Transform tf_src2object;
     tf2::fromMsg(object_pose, tf_src2object);
@@ -501,6 +548,19 @@ std::optional<Obstacle> SurroundObstacleCheckerNode::getNearestObstacleByDynamic
     geometry_msgs::msg::Pose transformed_object_pose;
     tf2::toMsg(tf_src2target.inverse() * tf_src2object, transformed_object_pose);
 
+    // skip the polygon distance if the circle covering the object is not nearer than the nearest
+    // object, since the distance to the object polygon is not less than the one to the circle
+    const double lower_bound_distance = std::max(
+      0.0, createSelfRectangle(vehicle_info_, front_margin, side_margin, back_margin)
+               .distance(transformed_object_pose.position.x, transformed_object_pose.position.y) -
+             calcObjectRadius(object.shape));
+    if (minimum_distance <= lower_bound_distance) {
+      continue;
+    }
+
+    const auto ego_polygon =
+      createSelfPolygon(vehicle_info_, front_margin, side_margin, back_margin);
+
     const auto object_polygon =
       object.shape.type == Shape::POLYGON
         ? createObjPolygon(transformed_object_pose, object.shape.footprint)
@@ -16,6 +16,7 @@
 
 #include <component_interface_specs/map.hpp>
 #include <component_interface_utils/rclcpp.hpp>
+#include <geography_utils/projection.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_sensing_msgs/msg/gnss_ins_orientation_stamped.hpp>
@@ -37,7 +38,9 @@
 #include <tf2_ros/transform_broadcaster.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace gnss_poser
 {
@@ -89,6 +92,8 @@ private:
   rclcpp::Publisher<tier4_debug_msgs::msg::BoolStamped>::SharedPtr fixed_pub_;
 
   MapProjectorInfo::Message projector_info_;
+  // NOTE: The projector is built once per projector info instead of once per fix.
+  std::unique_ptr<geography_utils::MapProjector> map_projector_;
   const std::string base_frame_;
   const std::string gnss_base_frame_;
   const std::string map_frame_;
@@ -96,6 +101,13 @@ private:
   bool use_gnss_ins_orientation_;
 
   boost::circular_buffer<geometry_msgs::msg::Point> position_buffer_;
+  std::vector<double> median_buffer_;
+
+  // static TF from the gnss frame, which is looked up again until it is found
+  bool is_tf_gnss_antenna2base_link_cached_ = false;
+  std::string tf_gnss_antenna2base_link_frame_id_;
+  geometry_msgs::msg::TransformStamped::SharedPtr tf_gnss_antenna2base_link_msg_ptr_;
+  tf2::Transform tf_gnss_antenna2base_link_;
 
   autoware_sensing_msgs::msg::GnssInsOrientationStamped::SharedPtr
     msg_gnss_ins_orientation_stamped_;
@@ -15,7 +15,6 @@
 #include "gnss_poser/gnss_poser_core.hpp"
 
 #include <geography_utils/height.hpp>
-#include <geography_utils/projection.hpp>
 
 #include <autoware_sensing_msgs/msg/gnss_ins_orientation_stamped.hpp>
 
@@ -64,6 +63,10 @@ void GNSSPoser::callbackMapProjectorInfo(const MapProjectorInfo::Message::ConstS
 {
   projector_info_ = *msg;
   received_map_projector_info_ = true;
+  map_projector_.reset();
+  if (projector_info_.projector_type != MapProjectorInfo::Message::LOCAL) {
+    map_projector_ = std::make_unique<geography_utils::MapProjector>(projector_info_);
+  }
 }
 
 void GNSSPoser::callbackNavSatFix(
@@ -106,7 +109,7 @@ void GNSSPoser::callbackNavSatFix(
   gps_point.latitude = nav_sat_fix_msg_ptr->latitude;
   gps_point.longitude = nav_sat_fix_msg_ptr->longitude;
   gps_point.altitude = nav_sat_fix_msg_ptr->altitude;
-  geometry_msgs::msg::Point position = geography_utils::project_forward(gps_point, projector_info_);
+  geometry_msgs::msg::Point position = map_projector_->forward(gps_point);
   position.z = geography_utils::convert_height(
     position.z, gps_point.latitude, gps_point.longitude, MapProjectorInfo::Message::WGS84,
     projector_info_.vertical_datum);
@@ -146,13 +149,20 @@ void GNSSPoser::callbackNavSatFix(
   tf2::fromMsg(gnss_antenna_pose, tf_map2gnss_antenna);
 
   // get TF from gnss_antenna to base_link
-  auto tf_gnss_antenna2base_link_msg_ptr = std::make_shared<geometry_msgs::msg::TransformStamped>();
-
-  const std::string gnss_frame = nav_sat_fix_msg_ptr->header.frame_id;
-  getStaticTransform(
-    gnss_frame, base_frame_, tf_gnss_antenna2base_link_msg_ptr, nav_sat_fix_msg_ptr->header.stamp);
-  tf2::Transform tf_gnss_antenna2base_link{};
-  tf2::fromMsg(tf_gnss_antenna2base_link_msg_ptr->transform, tf_gnss_antenna2base_link);
+  // NOTE: The TF is static, so that it is looked up only until it is found for the gnss frame.
+  const std::string & gnss_frame = nav_sat_fix_msg_ptr->header.frame_id;
+  if (!is_tf_gnss_antenna2base_link_cached_ || gnss_frame != tf_gnss_antenna2base_link_frame_id_) {
+    if (!tf_gnss_antenna2base_link_msg_ptr_) {
+      tf_gnss_antenna2base_link_msg_ptr_ = std::make_shared<geometry_msgs::msg::TransformStamped>();
+    }
+    const bool found = getStaticTransform(
+      gnss_frame, base_frame_, tf_gnss_antenna2base_link_msg_ptr_,
+      nav_sat_fix_msg_ptr->header.stamp);
+    tf2::fromMsg(tf_gnss_antenna2base_link_msg_ptr_->transform, tf_gnss_antenna2base_link_);
+    tf_gnss_antenna2base_link_frame_id_ = gnss_frame;
+    is_tf_gnss_antenna2base_link_cached_ = found;
+  }
+  const tf2::Transform & tf_gnss_antenna2base_link = tf_gnss_antenna2base_link_;
 
   // transform pose from gnss_antenna(in map frame) to base_link(in map frame)
   tf2::Transform tf_map2base_link{};
@@ -216,50 +226,51 @@ bool GNSSPoser::canGetCovariance(const sensor_msgs::msg::NavSatFix & nav_sat_fix
 geometry_msgs::msg::Point GNSSPoser::getMedianPosition(
   const boost::circular_buffer<geometry_msgs::msg::Point> & position_buffer)
 {
-  auto getMedian = [](std::vector<double> array) {
-    std::sort(std::begin(array), std::end(array));
+  // NOTE: nth_element() gives the same median as sorting, and the reused buffer does not
+  //       allocate after the first call.
+  auto & array = median_buffer_;
+  auto getMedian = [&array]() {
     const size_t median_index = array.size() / 2;
-    double median = (array.size() % 2)
-                      ? (array.at(median_index))
-                      : ((array.at(median_index) + array.at(median_index - 1)) / 2);
+    std::nth_element(array.begin(), array.begin() + median_index, array.end());
+    double median = array.at(median_index);
+    if (array.size() % 2 == 0) {
+      median = (median + *std::max_element(array.begin(), array.begin() + median_index)) / 2;
+    }
     return median;
   };
 
-  std::vector<double> array_x;
-  std::vector<double> array_y;
-  std::vector<double> array_z;
+  geometry_msgs::msg::Point median_point;
+  array.clear();
   for (const auto & position : position_buffer) {
-    array_x.push_back(position.x);
-    array_y.push_back(position.y);
-    array_z.push_back(position.z);
+    array.push_back(position.x);
   }
-
-  geometry_msgs::msg::Point median_point;
-  median_point.x = getMedian(array_x);
-  median_point.y = getMedian(array_y);
-  median_point.z = getMedian(array_z);
+  median_point.x = getMedian();
+  array.clear();
+  for (const auto & position : position_buffer) {
+    array.push_back(position.y);
+  }
+  median_point.y = getMedian();
+  array.clear();
+  for (const auto & position : position_buffer) {
+    array.push_back(position.z);
+  }
+  median_point.z = getMedian();
   return median_point;
 }
 
 geometry_msgs::msg::Point GNSSPoser::getAveragePosition(
   const boost::circular_buffer<geometry_msgs::msg::Point> & position_buffer)
 {
-  std::vector<double> array_x;
-  std::vector<double> array_y;
-  std::vector<double> array_z;
+  geometry_msgs::msg::Point average_point;
   for (const auto & position : position_buffer) {
-    array_x.push_back(position.x);
-    array_y.push_back(position.y);
-    array_z.push_back(position.z);
+    average_point.x += position.x;
+    average_point.y += position.y;
+    average_point.z += position.z;
   }
-
-  geometry_msgs::msg::Point average_point;
-  average_point.x =
-    std::reduce(array_x.begin(), array_x.end()) / static_cast<double>(array_x.size());
-  average_point.y =
-    std::reduce(array_y.begin(), array_y.end()) / static_cast<double>(array_y.size());
-  average_point.z =
-    std::reduce(array_z.begin(), array_z.end()) / static_cast<double>(array_z.size());
+  const auto size = static_cast<double>(position_buffer.size());
+  average_point.x /= size;
+  average_point.y /= size;
+  average_point.z /= size;
   return average_point;
 }
 
@@ -81,28 +81,37 @@ ImageTransportDecompressor::ImageTransportDecompressor(const rclcpp::NodeOptions
 void ImageTransportDecompressor::onCompressedImage(
   const sensor_msgs::msg::CompressedImage::ConstSharedPtr input_compressed_image_msg)
 {
-  cv_bridge::CvImagePtr cv_ptr(new cv_bridge::CvImage);
+  cv_bridge::CvImage cv_image;
   // Copy message header
-  cv_ptr->header = input_compressed_image_msg->header;
+  cv_image.header = input_compressed_image_msg->header;
+
+  // NOTE: The images are decoded into and converted to the member buffers, which are reallocated
+  //       only when the size of the image changes.
+  const auto convert_color = [&](const int code) {
+    cv::cvtColor(cv_image.image, converted_image_, code);
+    cv_image.image = converted_image_;
+  };
 
   // Decode color/mono image
   try {
-    cv_ptr->image = cv::imdecode(cv::Mat(input_compressed_image_msg->data), cv::IMREAD_COLOR);
+    // The compressed data is wrapped without copy
+    cv::imdecode(cv::Mat(input_compressed_image_msg->data), cv::IMREAD_COLOR, &decoded_image_);
+    cv_image.image = decoded_image_;
 
     // Assign image encoding string
     const size_t split_pos = input_compressed_image_msg->format.find(';');
     if (split_pos == std::string::npos) {
       // Older version of compressed_image_transport does not signal image format
-      switch (cv_ptr->image.channels()) {
+      switch (cv_image.image.channels()) {
         case 1:
-          cv_ptr->encoding = sensor_msgs::image_encodings::MONO8;
+          cv_image.encoding = sensor_msgs::image_encodings::MONO8;
           break;
         case 3:
-          cv_ptr->encoding = sensor_msgs::image_encodings::BGR8;
+          cv_image.encoding = sensor_msgs::image_encodings::BGR8;
           break;
         default:
           RCLCPP_ERROR(
-            get_logger(), "Unsupported number of channels: %i", cv_ptr->image.channels());
+            get_logger(), "Unsupported number of channels: %i", cv_image.image.channels());
           break;
       }
     } else {
@@ -117,7 +126,7 @@ void ImageTransportDecompressor::onCompressedImage(
         image_encoding = input_compressed_image_msg->format.substr(0, split_pos);
       }
 
-      cv_ptr->encoding = image_encoding;
+      cv_image.encoding = image_encoding;
 
       if (sensor_msgs::image_encodings::isColor(image_encoding)) {
         std::string compressed_encoding = input_compressed_image_msg->format.substr(split_pos);
@@ -130,38 +139,38 @@ void ImageTransportDecompressor::onCompressedImage(
           if (
             (image_encoding == sensor_msgs::image_encodings::RGB8) ||
             (image_encoding == sensor_msgs::image_encodings::RGB16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_BGR2RGB);
+            convert_color(CV_BGR2RGB);
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::RGBA8) ||
             (image_encoding == sensor_msgs::image_encodings::RGBA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_BGR2RGBA);
+            convert_color(CV_BGR2RGBA);
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::BGRA8) ||
             (image_encoding == sensor_msgs::image_encodings::BGRA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_BGR2BGRA);
+            convert_color(CV_BGR2BGRA);
           }
         } else {
           // if necessary convert colors from rgb to bgr
           if (
             (image_encoding == sensor_msgs::image_encodings::BGR8) ||
             (image_encoding == sensor_msgs::image_encodings::BGR16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_RGB2BGR);
+            convert_color(CV_RGB2BGR);
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::BGRA8) ||
             (image_encoding == sensor_msgs::image_encodings::BGRA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_RGB2BGRA);
+            convert_color(CV_RGB2BGRA);
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::RGBA8) ||
             (image_encoding == sensor_msgs::image_encodings::RGBA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_RGB2RGBA);
+            convert_color(CV_RGB2RGBA);
           }
         }
       }
@@ -170,12 +179,13 @@ void ImageTransportDecompressor::onCompressedImage(
     RCLCPP_ERROR(get_logger(), "%s", e.what());
   }
 
-  size_t rows = cv_ptr->image.rows;
-  size_t cols = cv_ptr->image.cols;
+  size_t rows = cv_image.image.rows;
+  size_t cols = cv_image.image.cols;
 
   if ((rows > 0) && (cols > 0)) {
-    // Publish message to user callback
-    auto image_ptr = std::make_unique<sensor_msgs::msg::Image>(*cv_ptr->toImageMsg());
+    // Publish message to user callback, whose data is filled in place
+    auto image_ptr = std::make_unique<sensor_msgs::msg::Image>();
+    cv_image.toImageMsg(*image_ptr);
     raw_image_pub_->publish(std::move(image_ptr));
   }
 }
@@ -56,7 +56,8 @@ namespace imu_corrector
 ImuCorrector::ImuCorrector()
 : Node("imu_corrector"), output_frame_(declare_parameter<std::string>("base_link", "base_link"))
 {
-  transform_listener_ = std::make_shared<tier4_autoware_utils::TransformListener>(this);
+  // NOTE: The transform from the IMU frame is static, which is cached to skip the tf lookup.
+  transform_listener_ = std::make_shared<tier4_autoware_utils::TransformListener>(this, true);
 
   angular_velocity_offset_x_imu_link_ = declare_parameter<double>("angular_velocity_offset_x", 0.0);
   angular_velocity_offset_y_imu_link_ = declare_parameter<double>("angular_velocity_offset_y", 0.0);
@@ -0,0 +1,156 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/crop_box_filter/crop_box_filter_nodelet.hpp"
+#include "pointcloud_preprocessor/downsample_filter/voxel_grid_downsample_filter_nodelet.hpp"
+#include "pointcloud_preprocessor/outlier_filter/dual_return_outlier_filter_nodelet.hpp"
+#include "pointcloud_preprocessor/outlier_filter/ring_outlier_filter_nodelet.hpp"
+#include "pointcloud_preprocessor/utility/filter_benchmark.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// count the allocations of all the libraries for the allocations per frame
+void * operator new(std::size_t size)
+{
+  pointcloud_preprocessor::filter_benchmark::allocationCount().fetch_add(
+    1, std::memory_order_relaxed);
+  if (void * ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+void operator delete(void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace
+{
+using pointcloud_preprocessor::filter_benchmark::PointCloud2;
+using pointcloud_preprocessor::filter_benchmark::Result;
+
+// expose the filter methods, which are called by the base class otherwise
+template <class Component>
+class BenchmarkComponent : public Component
+{
+public:
+  using Component::Component;
+  using Component::faster_filter;
+  using Component::filter;
+};
+
+template <class Component>
+void runComponent(
+  const std::string & name, const bool has_faster_filter, const rclcpp::NodeOptions & options,
+  const std::vector<PointCloud2::ConstSharedPtr> & frames, const size_t iterations,
+  std::vector<Result> & results)
+{
+  using pointcloud_preprocessor::filter_benchmark::run;
+
+  const auto component = std::make_shared<BenchmarkComponent<Component>>(options);
+  results.push_back(run(
+    name, "filter", frames, iterations,
+    [&](const PointCloud2::ConstSharedPtr & input, PointCloud2 & output) {
+      component->filter(input, nullptr, output);
+    }));
+  if (has_faster_filter) {
+    const pointcloud_preprocessor::TransformInfo transform_info;
+    results.push_back(run(
+      name, "faster_filter", frames, iterations,
+      [&](const PointCloud2::ConstSharedPtr & input, PointCloud2 & output) {
+        component->faster_filter(input, nullptr, output, transform_info);
+      }));
+  }
+}
+
+rclcpp::NodeOptions makeOptions(const std::vector<rclcpp::Parameter> & parameters)
+{
+  rclcpp::NodeOptions options;
+  options.parameter_overrides(parameters);
+  return options;
+}
+}  // namespace
+
+/**
+ * @brief measure the filter() and faster_filter() of the pointcloud_preprocessor filters on the
+ * frames recorded as PCD files
+ * @details usage: filter_benchmark [--iterations N] [--filter NAME] [--json PATH] PCD...
+ */
+int main(int argc, char * argv[])
+{
+  rclcpp::init(argc, argv);
+  const auto options = pointcloud_preprocessor::filter_benchmark::parseOptions(
+    rclcpp::remove_ros_arguments(argc, argv));
+  if (options.pcd_paths.empty()) {
+    std::cerr << "usage: " << argv[0] << " [--iterations N] [--filter NAME] [--json PATH] PCD..."
+              << std::endl;
+    rclcpp::shutdown();
+    return 1;
+  }
+  const auto frames =
+    pointcloud_preprocessor::filter_benchmark::loadFrames(options.pcd_paths, "base_link");
+
+  const auto is_selected = [&options](const std::string & name) {
+    return options.filter.empty() || options.filter == name;
+  };
+  std::vector<Result> results;
+  if (is_selected("crop_box_filter")) {
+    // a box around the vehicle removing its own points
+    runComponent<pointcloud_preprocessor::CropBoxFilterComponent>(
+      "crop_box_filter", true,
+      makeOptions(
+        {rclcpp::Parameter("min_x", -1.0), rclcpp::Parameter("max_x", 4.0),
+         rclcpp::Parameter("min_y", -1.0), rclcpp::Parameter("max_y", 1.0),
+         rclcpp::Parameter("min_z", -2.0), rclcpp::Parameter("max_z", 2.5),
+         rclcpp::Parameter("negative", true)}),
+      frames, options.iterations, results);
+  }
+  if (is_selected("voxel_grid_downsample_filter")) {
+    runComponent<pointcloud_preprocessor::VoxelGridDownsampleFilterComponent>(
+      "voxel_grid_downsample_filter", true, makeOptions({}), frames, options.iterations, results);
+  }
+  if (is_selected("ring_outlier_filter")) {
+    runComponent<pointcloud_preprocessor::RingOutlierFilterComponent>(
+      "ring_outlier_filter", true, makeOptions({}), frames, options.iterations, results);
+  }
+  if (is_selected("dual_return_outlier_filter")) {
+    runComponent<pointcloud_preprocessor::DualReturnOutlierFilterComponent>(
+      "dual_return_outlier_filter", false, makeOptions({}), frames, options.iterations, results);
+  }
+
+  for (const auto & r : results) {
+    std::printf(
+      "%-30s %-14s %14.0f points/s %10.1f allocations/frame\n", r.filter.c_str(), r.method.c_str(),
+      r.points_per_sec, r.allocations_per_frame);
+  }
+  if (!options.json_path.empty()) {
+    std::ofstream(options.json_path) << pointcloud_preprocessor::filter_benchmark::toJson(results);
+  }
+
+  rclcpp::shutdown();
+  return 0;
+}
@@ -16,6 +16,7 @@
 #define POINTCLOUD_PREPROCESSOR__BLOCKAGE_DIAG__BLOCKAGE_DIAG_NODELET_HPP_
 
 #include "pointcloud_preprocessor/filter.hpp"
+#include "pointcloud_preprocessor/utility/point_cloud2_accessor.hpp"
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
 #include <image_transport/image_transport.hpp>
@@ -97,6 +98,7 @@ private:
   double horizontal_resolution_{0.4};
   boost::circular_buffer<cv::Mat> no_return_mask_buffer{1};
   boost::circular_buffer<cv::Mat> dust_mask_buffer{1};
+  utils::FieldOffsetsCache input_field_offsets_cache_;
 
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
@@ -53,6 +53,7 @@
 #define POINTCLOUD_PREPROCESSOR__CONCATENATE_DATA__CONCATENATE_AND_TIME_SYNC_NODELET_HPP_
 
 #include <deque>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -62,6 +63,7 @@
 
 // ROS includes
 #include "autoware_point_types/types.hpp"
+#include "pointcloud_preprocessor/utility/worker_pool.hpp"
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
 #include <point_cloud_msg_wrapper/point_cloud_msg_wrapper.hpp>
@@ -162,6 +164,22 @@ private:
   std::vector<double> input_offset_;
   std::map<std::string, double> offset_map_;
 
+  /** \brief Input cloud already converted to XYZI and transformed to the output frame. */
+  struct PreparedCloud
+  {
+    std::vector<PointXYZI> points;
+    std::string frame_id;
+    Eigen::Matrix4f sensor_to_output{Eigen::Matrix4f::Identity()};
+    bool valid{false};
+  };
+  using PreparedCloudFuture = std::shared_future<std::shared_ptr<const PreparedCloud>>;
+
+  /** \brief Write every input straight into one preallocated output buffer. */
+  bool use_zero_copy_concatenation_;
+  std::unique_ptr<utils::WorkerPool> worker_pool_;
+  std::map<std::string, PreparedCloudFuture> prepared_cloud_map_;
+  std::map<std::string, PreparedCloudFuture> prepared_cloud_map_tmp_;
+
   void transformPointCloud(const PointCloud2::ConstSharedPtr & in, PointCloud2::SharedPtr & out);
   Eigen::Matrix4f computeTransformToAdjustForOldTimestamp(
     const rclcpp::Time & old_stamp, const rclcpp::Time & new_stamp);
@@ -169,6 +187,14 @@ private:
     sensor_msgs::msg::PointCloud2::SharedPtr & concat_cloud_ptr);
   void publish();
 
+  PreparedCloudFuture prepareCloud(const PointCloud2::ConstSharedPtr & input_ptr);
+  std::shared_ptr<const PreparedCloud> convertToXYZICloudInOutputFrame(
+    const PointCloud2::ConstSharedPtr & input_ptr);
+  bool combineCloudsZeroCopy(
+    sensor_msgs::msg::PointCloud2 & concat_cloud,
+    std::map<std::string, sensor_msgs::msg::PointCloud2::UniquePtr> & transformed_clouds);
+  void publishZeroCopy();
+
   void convertToXYZICloud(
     const sensor_msgs::msg::PointCloud2::SharedPtr & input_ptr,
     sensor_msgs::msg::PointCloud2::SharedPtr & output_ptr);
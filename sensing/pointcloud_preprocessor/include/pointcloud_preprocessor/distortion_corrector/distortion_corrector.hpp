@@ -48,6 +48,48 @@ namespace pointcloud_preprocessor
 using rcl_interfaces::msg::SetParametersResult;
 using sensor_msgs::msg::PointCloud2;
 
+/**
+ * @brief undistortion of a point cloud based on the buffered twist and imu messages
+ * @details holds no subscription so that it can be shared by the distortion corrector node
+ * and the nodes fusing several preprocessing stages in one callback.
+ */
+class DistortionCorrector
+{
+public:
+  struct Param
+  {
+    std::string base_link_frame = "base_link";
+    std::string time_stamp_field_name = "time_stamp";
+    bool use_imu = true;
+    bool use_vectorized_undistortion = false;
+    double undistortion_block_time_sec = 0.0001;
+  };
+
+  DistortionCorrector(rclcpp::Node & node, const Param & param);
+
+  void processTwistMessage(
+    const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr & twist_msg);
+  void processIMUMessage(
+    const sensor_msgs::msg::Imu::ConstSharedPtr & imu_msg,
+    const tf2::Transform & tf2_imu_link_to_base_link);
+  bool undistortPointCloud(const tf2::Transform & tf2_base_link_to_sensor, PointCloud2 & points);
+
+  const Param & param() const { return param_; }
+
+private:
+  bool undistortPointCloudPerPoint(
+    const tf2::Transform & tf2_base_link_to_sensor, PointCloud2 & points);
+  bool undistortPointCloudVectorized(
+    const tf2::Transform & tf2_base_link_to_sensor, PointCloud2 & points);
+
+  rclcpp::Logger logger_;
+  rclcpp::Clock::SharedPtr clock_;
+  Param param_;
+
+  std::deque<geometry_msgs::msg::TwistStamped> twist_queue_;
+  std::deque<geometry_msgs::msg::Vector3Stamped> angular_velocity_queue_;
+};
+
 class DistortionCorrectorComponent : public rclcpp::Node
 {
 public:
@@ -62,8 +104,6 @@ private:
     const std::string & target_frame, const std::string & source_frame,
     tf2::Transform * tf2_transform_ptr);
 
-  bool undistortPointCloud(const tf2::Transform & tf2_base_link_to_sensor, PointCloud2 & points);
-
   rclcpp::Subscription<PointCloud2>::SharedPtr input_points_sub_;
   rclcpp::Subscription<sensor_msgs::msg::Imu>::SharedPtr imu_sub_;
   rclcpp::Subscription<geometry_msgs::msg::TwistWithCovarianceStamped>::SharedPtr twist_sub_;
@@ -75,8 +115,7 @@ private:
   tf2_ros::Buffer tf2_buffer_{get_clock()};
   tf2_ros::TransformListener tf2_listener_{tf2_buffer_};
 
-  std::deque<geometry_msgs::msg::TwistStamped> twist_queue_;
-  std::deque<geometry_msgs::msg::Vector3Stamped> angular_velocity_queue_;
+  std::unique_ptr<DistortionCorrector> distortion_corrector_;
 
   std::string base_link_frame_ = "base_link";
   std::string time_stamp_field_name_;
@@ -0,0 +1,55 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__DISTORTION_CORRECTOR__UNDISTORTION_KERNEL_HPP_
+#define POINTCLOUD_PREPROCESSOR__DISTORTION_CORRECTOR__UNDISTORTION_KERNEL_HPP_
+
+#include <cstddef>
+
+namespace pointcloud_preprocessor::undistortion
+{
+/** @brief number of points gathered into one SoA batch */
+constexpr size_t kBatchSize = 64;
+
+/**
+ * @brief rigid transform applied to a batch of points, p' = rotation * p + translation
+ * @note the rotation is stored in row-major order
+ */
+struct AffineTransform3f
+{
+  float rotation[9]{1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+  float translation[3]{0.0f, 0.0f, 0.0f};
+};
+
+/**
+ * @brief apply the transform in place to SoA arrays of x, y and z
+ * @details uses AVX2, SSE2 or NEON depending on the target architecture and handles the
+ * remainder with a scalar loop.
+ */
+void transformPoints(
+  const AffineTransform3f & transform, float * x, float * y, float * z, const size_t size);
+
+/**
+ * @brief scalar reference of transformPoints
+ */
+void transformPointsScalar(
+  const AffineTransform3f & transform, float * x, float * y, float * z, const size_t size);
+
+/**
+ * @brief name of the instruction set used by transformPoints
+ */
+const char * instructionSet();
+}  // namespace pointcloud_preprocessor::undistortion
+
+#endif  // POINTCLOUD_PREPROCESSOR__DISTORTION_CORRECTOR__UNDISTORTION_KERNEL_HPP_
@@ -15,12 +15,13 @@
 #pragma once
 
 #include "pointcloud_preprocessor/transform_info.hpp"
+#include "pointcloud_preprocessor/utility/worker_pool.hpp"
 
 #include <pcl/filters/voxel_grid.h>
 #include <pcl_conversions/pcl_conversions.h>
 #include <sensor_msgs/msg/point_cloud2.h>
 
-#include <unordered_map>
+#include <memory>
 #include <vector>
 
 namespace pointcloud_preprocessor
@@ -33,8 +34,21 @@ class FasterVoxelGridDownsampleFilter
 
 public:
   FasterVoxelGridDownsampleFilter();
+  ~FasterVoxelGridDownsampleFilter();
   void set_voxel_size(float voxel_size_x, float voxel_size_y, float voxel_size_z);
   void set_field_offsets(const PointCloud2ConstPtr & input);
+  /**
+   * @brief set the number of threads filling the voxel map
+   * @details the voxels are sharded by voxel index, each thread accumulating the points of its
+   * own shard, and the shards are written to disjoint ranges of the output.
+   */
+  void set_num_threads(size_t num_threads);
+  /**
+   * @brief bound the number of voxels held in memory, 0 for unbounded
+   * @details the voxel map is allocated once for this number of voxels, and the points falling
+   * into new voxels once it is full are dropped.
+   */
+  void set_max_voxel_count(size_t max_voxel_count);
   void filter(
     const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info,
     const rclcpp::Logger & logger);
@@ -73,6 +87,10 @@ private:
     }
   };
 
+  // one hash map per thread, defined in the source file; kept across frames so that the
+  // capacity of the maps is reused
+  struct VoxelShard;
+
   Eigen::Vector3f inverse_voxel_size_;
   int x_offset_;
   int y_offset_;
@@ -80,6 +98,11 @@ private:
   int intensity_index_;
   int intensity_offset_;
   bool offset_initialized_;
+  size_t max_voxel_count_;
+
+  std::unique_ptr<utils::WorkerPool> worker_pool_;
+  std::vector<std::unique_ptr<VoxelShard>> voxel_shards_;
+  std::vector<uint32_t> voxel_indices_;
 
   Eigen::Vector4f get_point_from_global_offset(
     const PointCloud2ConstPtr & input, size_t global_offset);
@@ -87,13 +110,17 @@ private:
   bool get_min_max_voxel(
     const PointCloud2ConstPtr & input, Eigen::Vector3i & min_voxel, Eigen::Vector3i & max_voxel);
 
-  std::unordered_map<uint32_t, Centroid> calc_centroids_each_voxel(
+  void calc_voxel_index_each_point(
     const PointCloud2ConstPtr & input, const Eigen::Vector3i & max_voxel,
     const Eigen::Vector3i & min_voxel);
 
-  void copy_centroids_to_output(
-    std::unordered_map<uint32_t, Centroid> & voxel_centroid_map, PointCloud2 & output,
-    const TransformInfo & transform_info);
+  size_t calc_centroids_each_voxel(const PointCloud2ConstPtr & input);
+
+  void copy_centroids_to_output(PointCloud2 & output, const TransformInfo & transform_info);
+
+  /** @brief run func(task_index) for every task, on the worker pool when there is one */
+  template <class F>
+  void run_tasks(size_t num_tasks, F && func);
 };
 
 }  // namespace pointcloud_preprocessor
@@ -53,6 +53,7 @@
 #define POINTCLOUD_PREPROCESSOR__FILTER_HPP_
 
 #include "pointcloud_preprocessor/transform_info.hpp"
+#include "pointcloud_preprocessor/utility/point_cloud2_accessor.hpp"
 
 #include <memory>
 #include <string>
@@ -176,6 +177,9 @@ protected:
   /** \brief Internal mutex. */
   std::mutex mutex_;
 
+  /** \brief Field offsets of the input topic, resolved again only when its fields change. */
+  utils::FieldOffsetsCache input_field_offsets_cache_;
+
   /** \brief processing time publisher. **/
   std::unique_ptr<tier4_autoware_utils::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
   std::unique_ptr<tier4_autoware_utils::DebugPublisher> debug_publisher_;
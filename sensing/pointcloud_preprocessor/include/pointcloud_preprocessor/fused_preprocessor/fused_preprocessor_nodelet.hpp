@@ -0,0 +1,126 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__FUSED_PREPROCESSOR__FUSED_PREPROCESSOR_NODELET_HPP_
+#define POINTCLOUD_PREPROCESSOR__FUSED_PREPROCESSOR__FUSED_PREPROCESSOR_NODELET_HPP_
+
+#include "pointcloud_preprocessor/distortion_corrector/distortion_corrector.hpp"
+#include "pointcloud_preprocessor/downsample_filter/faster_voxel_grid_downsample_filter.hpp"
+#include "pointcloud_preprocessor/transform_info.hpp"
+#include "pointcloud_preprocessor/utility/point_cloud2_accessor.hpp"
+
+#include <Eigen/Core>
+#include <rclcpp/rclcpp.hpp>
+
+#include <geometry_msgs/msg/twist_with_covariance_stamped.hpp>
+#include <sensor_msgs/msg/imu.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <tf2_ros/buffer.h>
+#include <tf2_ros/transform_listener.h>
+
+// Include tier4 autoware utils
+#include <tier4_autoware_utils/ros/debug_publisher.hpp>
+#include <tier4_autoware_utils/system/stop_watch.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+using sensor_msgs::msg::PointCloud2;
+
+/**
+ * @brief crop box → distortion corrector → ring outlier filter → voxel grid downsample filter
+ * in one callback
+ * @details the stages take the parameters of the corresponding nodes and are applied in place to
+ * the buffer of the received message, so that no intermediate message is serialized or copied
+ * unless `publish_intermediate_pointclouds` is set.
+ */
+class FusedPreprocessorComponent : public rclcpp::Node
+{
+public:
+  explicit FusedPreprocessorComponent(const rclcpp::NodeOptions & options);
+
+private:
+  struct CropBoxParam
+  {
+    float min_x;
+    float max_x;
+    float min_y;
+    float max_y;
+    float min_z;
+    float max_z;
+    bool negative;
+  };
+
+  struct RingOutlierParam
+  {
+    double distance_ratio;
+    double object_length_threshold;
+    int num_points_threshold;
+    uint16_t max_rings_num;
+    size_t max_points_num_per_ring;
+  };
+
+  void onPointCloud(PointCloud2::UniquePtr points_msg);
+  void onTwistWithCovarianceStamped(
+    const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr twist_msg);
+  void onImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_msg);
+  bool getTransform(
+    const std::string & target_frame, const std::string & source_frame,
+    tf2::Transform * tf2_transform_ptr);
+
+  /** @brief transform the points to the base link frame and remove the cropped ones in place */
+  void cropPointCloud(const TransformInfo & transform_info, PointCloud2 & points);
+  /** @brief remove the ring outliers in place and reduce the points to PointXYZI */
+  bool filterRingOutlier(PointCloud2 & points);
+  void publishIntermediatePointCloud(
+    const rclcpp::Publisher<PointCloud2>::SharedPtr & publisher, const PointCloud2 & points);
+
+  rclcpp::Subscription<PointCloud2>::SharedPtr input_points_sub_;
+  rclcpp::Subscription<sensor_msgs::msg::Imu>::SharedPtr imu_sub_;
+  rclcpp::Subscription<geometry_msgs::msg::TwistWithCovarianceStamped>::SharedPtr twist_sub_;
+  rclcpp::Publisher<PointCloud2>::SharedPtr output_points_pub_;
+  rclcpp::Publisher<PointCloud2>::SharedPtr cropped_points_pub_;
+  rclcpp::Publisher<PointCloud2>::SharedPtr undistorted_points_pub_;
+  rclcpp::Publisher<PointCloud2>::SharedPtr outlier_filtered_points_pub_;
+
+  std::unique_ptr<tier4_autoware_utils::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
+  std::unique_ptr<tier4_autoware_utils::DebugPublisher> debug_publisher_;
+
+  tf2_ros::Buffer tf2_buffer_{get_clock()};
+  tf2_ros::TransformListener tf2_listener_{tf2_buffer_};
+
+  std::unique_ptr<DistortionCorrector> distortion_corrector_;
+  FasterVoxelGridDownsampleFilter voxel_grid_filter_;
+  utils::FieldOffsetsCache input_field_offsets_cache_;
+
+  std::string base_link_frame_ = "base_link";
+  bool publish_intermediate_pointclouds_;
+  std::vector<CropBoxParam> crop_box_params_;
+  RingOutlierParam ring_outlier_param_;
+  bool use_imu_;
+  bool use_ring_outlier_filter_;
+  bool use_downsample_filter_;
+
+  // reused across frames to keep the callback free of allocations
+  std::vector<std::vector<uint32_t>> ring2indices_;
+  std::vector<uint8_t> is_inlier_;
+};
+
+}  // namespace pointcloud_preprocessor
+
+#endif  // POINTCLOUD_PREPROCESSOR__FUSED_PREPROCESSOR__FUSED_PREPROCESSOR_NODELET_HPP_
@@ -16,6 +16,9 @@
 #define POINTCLOUD_PREPROCESSOR__OUTLIER_FILTER__DUAL_RETURN_OUTLIER_FILTER_NODELET_HPP_
 
 #include "pointcloud_preprocessor/filter.hpp"
+#include "pointcloud_preprocessor/utility/point_cloud2_accessor.hpp"
+#include "pointcloud_preprocessor/utility/ring_index.hpp"
+#include "pointcloud_preprocessor/utility/worker_pool.hpp"
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
 #include <image_transport/image_transport.hpp>
@@ -34,6 +37,7 @@
 #include <pcl/filters/voxel_grid.h>
 #include <pcl/search/pcl_search.h>
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -86,6 +90,24 @@ private:
     {"Fixed_azimuth_ROI", 2},
   };
 
+  /** \brief Indices of the points kept and removed in a ring */
+  struct RingResult
+  {
+    std::vector<size_t> output;
+    std::vector<size_t> noise;
+  };
+
+  utils::FieldOffsetsCache input_field_offsets_cache_;
+  // the buffers below are kept across frames
+  utils::RingIndex weak_first_ring_index_;
+  utils::RingIndex ring_index_;
+  std::vector<RingResult> weak_first_ring_results_;
+  std::vector<RingResult> ring_results_;
+  std::vector<size_t> output_indices_;
+  std::vector<size_t> noise_indices_;
+  // filter the rings in parallel if num_threads is greater than 1
+  std::unique_ptr<utils::WorkerPool> worker_pool_;
+
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
   explicit DualReturnOutlierFilterComponent(const rclcpp::NodeOptions & options);
@@ -16,9 +16,11 @@
 #define POINTCLOUD_PREPROCESSOR__POINTCLOUD_ACCUMULATOR__POINTCLOUD_ACCUMULATOR_NODELET_HPP_
 
 #include "pointcloud_preprocessor/filter.hpp"
+#include "pointcloud_preprocessor/utility/point_ring_buffer.hpp"
 
 #include <boost/circular_buffer.hpp>
 
+#include <string>
 #include <vector>
 
 namespace pointcloud_preprocessor
@@ -35,10 +37,19 @@ protected:
   /** \brief Parameter service callback */
   rcl_interfaces::msg::SetParametersResult paramCallback(const std::vector<rclcpp::Parameter> & p);
 
+  /** \brief Accumulate the points in the preallocated ring instead of the buffered clouds */
+  void streamingFilter(const PointCloud2ConstPtr & input, PointCloud2 & output);
+
 private:
   double accumulation_time_sec_;
   boost::circular_buffer<PointCloud2ConstPtr> pointcloud_buffer_;
 
+  bool use_streaming_;
+  std::string accumulation_frame_;
+  // NOTE: The points are stored in accumulation_frame_ if it is given, so the old frames are not
+  //       transformed again when the vehicle moves.
+  utils::PointRingBuffer<pcl::PointXYZ> point_buffer_;
+
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
   explicit PointcloudAccumulatorComponent(const rclcpp::NodeOptions & options);
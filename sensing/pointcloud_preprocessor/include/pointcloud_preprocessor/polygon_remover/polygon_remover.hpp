@@ -52,6 +52,7 @@ private:
   bool polygon_is_initialized_;
   bool will_visualize_;
   PolygonCgal polygon_cgal_;
+  utils::PolygonMask polygon_mask_;
   visualization_msgs::msg::Marker marker_;
 
   rclcpp::Publisher<visualization_msgs::msg::Marker>::SharedPtr pub_marker_ptr_;
@@ -0,0 +1,255 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__UTILITY__FILTER_BENCHMARK_HPP_
+#define POINTCLOUD_PREPROCESSOR__UTILITY__FILTER_BENCHMARK_HPP_
+
+#include <autoware_point_types/types.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <pcl/PCLPointCloud2.h>
+#include <pcl/common/io.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief helpers of the benchmarks measuring the filter() and faster_filter() of the pointcloud
+ * filters on the frames recorded as PCD files
+ */
+namespace pointcloud_preprocessor::filter_benchmark
+{
+using sensor_msgs::msg::PointCloud2;
+
+/**
+ * @brief number of the allocations, incremented by the operator new of the benchmark executable
+ * @details the allocations are reported as 0 if the executable does not replace operator new
+ */
+inline std::atomic<size_t> & allocationCount()
+{
+  static std::atomic<size_t> count{0};
+  return count;
+}
+
+struct Options
+{
+  size_t iterations{10};
+  // run only this filter if not empty
+  std::string filter{};
+  // write the results to this file if not empty
+  std::string json_path{};
+  std::vector<std::string> pcd_paths{};
+};
+
+/**
+ * @brief parse [--iterations N] [--filter NAME] [--json PATH] [PCD...], the ROS arguments have to
+ *        be removed beforehand
+ */
+inline Options parseOptions(const std::vector<std::string> & args)
+{
+  Options options;
+  for (size_t i = 1; i < args.size(); ++i) {
+    const bool has_value = i + 1 < args.size();
+    if (args[i] == "--iterations" && has_value) {
+      options.iterations = std::stoul(args[++i]);
+    } else if (args[i] == "--filter" && has_value) {
+      options.filter = args[++i];
+    } else if (args[i] == "--json" && has_value) {
+      options.json_path = args[++i];
+    } else {
+      options.pcd_paths.push_back(args[i]);
+    }
+  }
+  return options;
+}
+
+/**
+ * @brief convert the points to PointXYZIRADRT as a rotating lidar would output them
+ * @details the points are sorted by azimuth and the ring is given by the elevation angle, so that
+ *          the ring based filters see each ring in the order of the scan
+ */
+inline pcl::PointCloud<autoware_point_types::PointXYZIRADRT> toPointXYZIRADRT(
+  const pcl::PointCloud<pcl::PointXYZI> & cloud, const uint16_t rings_num)
+{
+  using autoware_point_types::PointXYZIRADRT;
+
+  std::vector<PointXYZIRADRT> points;
+  points.reserve(cloud.size());
+  float min_elevation = std::numeric_limits<float>::max();
+  float max_elevation = std::numeric_limits<float>::lowest();
+  for (const auto & p : cloud) {
+    PointXYZIRADRT point;
+    point.x = p.x;
+    point.y = p.y;
+    point.z = p.z;
+    point.intensity = p.intensity;
+    point.distance = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+    // in 0.01 degree within [0, 36000) as the drivers output
+    const float azimuth = std::atan2(p.y, p.x) * 18000.0f / static_cast<float>(M_PI);
+    point.azimuth = azimuth < 0.0f ? azimuth + 36000.0f : azimuth;
+    point.return_type = autoware_point_types::ReturnType::SINGLE_STRONGEST;
+    points.push_back(point);
+
+    const float elevation = std::atan2(p.z, std::hypot(p.x, p.y));
+    min_elevation = std::min(min_elevation, elevation);
+    max_elevation = std::max(max_elevation, elevation);
+  }
+
+  const float elevation_range = std::max(max_elevation - min_elevation, 1e-6f);
+  for (auto & point : points) {
+    const float elevation = std::atan2(point.z, std::hypot(point.x, point.y));
+    const auto ring =
+      static_cast<uint16_t>((elevation - min_elevation) / elevation_range * rings_num);
+    point.ring = std::min<uint16_t>(ring, rings_num - 1);
+  }
+
+  std::stable_sort(
+    points.begin(), points.end(),
+    [](const PointXYZIRADRT & a, const PointXYZIRADRT & b) { return a.azimuth < b.azimuth; });
+  // a scan of 100 ms
+  for (size_t i = 0; i < points.size(); ++i) {
+    points[i].time_stamp = 0.1 * static_cast<double>(i) / static_cast<double>(points.size());
+  }
+
+  pcl::PointCloud<PointXYZIRADRT> output;
+  output.points.assign(points.begin(), points.end());
+  output.width = static_cast<uint32_t>(output.points.size());
+  output.height = 1;
+  output.is_dense = cloud.is_dense;
+  return output;
+}
+
+/**
+ * @brief load the PCD files as the frames
+ * @details the frames without the ring field are converted to PointXYZIRADRT, the others are used
+ *          as they are recorded
+ */
+inline std::vector<PointCloud2::ConstSharedPtr> loadFrames(
+  const std::vector<std::string> & pcd_paths, const std::string & frame_id,
+  const uint16_t rings_num = 128)
+{
+  std::vector<PointCloud2::ConstSharedPtr> frames;
+  for (const auto & pcd_path : pcd_paths) {
+    pcl::PCLPointCloud2 blob;
+    if (pcl::io::loadPCDFile(pcd_path, blob) < 0) {
+      throw std::runtime_error("failed to load " + pcd_path);
+    }
+
+    auto frame = std::make_shared<PointCloud2>();
+    if (pcl::getFieldIndex(blob, "ring") < 0) {
+      pcl::PointCloud<pcl::PointXYZI> cloud;
+      pcl::fromPCLPointCloud2(blob, cloud);
+      pcl::toROSMsg(toPointXYZIRADRT(cloud, rings_num), *frame);
+    } else {
+      pcl_conversions::moveFromPCL(blob, *frame);
+    }
+    frame->header.frame_id = frame_id;
+    frames.push_back(frame);
+  }
+  return frames;
+}
+
+struct Result
+{
+  std::string filter{};
+  // "filter" or "faster_filter"
+  std::string method{};
+  size_t frames{};
+  size_t iterations{};
+  double points_per_sec{};
+  double allocations_per_frame{};
+  // ratio of the output points to the input points
+  double output_ratio{};
+};
+
+/**
+ * @brief run the filter on all the frames for the iterations after a warm-up round
+ * @param filter_function called as filter_function(input, output)
+ * @details the output is a new message for each frame like the node, so that its allocations are
+ *          counted as well
+ */
+template <class FilterFunction>
+Result run(
+  const std::string & filter, const std::string & method,
+  const std::vector<PointCloud2::ConstSharedPtr> & frames, const size_t iterations,
+  const FilterFunction & filter_function)
+{
+  size_t input_points = 0;
+  size_t output_points = 0;
+  for (const auto & frame : frames) {
+    PointCloud2 output;
+    filter_function(frame, output);
+    input_points += static_cast<size_t>(frame->width) * frame->height;
+    output_points += static_cast<size_t>(output.width) * output.height;
+  }
+
+  const size_t allocation_count_start = allocationCount().load();
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    for (const auto & frame : frames) {
+      PointCloud2 output;
+      filter_function(frame, output);
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const size_t allocation_count = allocationCount().load() - allocation_count_start;
+
+  Result result;
+  result.filter = filter;
+  result.method = method;
+  result.frames = frames.size();
+  result.iterations = iterations;
+  const double elapsed_sec = std::chrono::duration<double>(end - start).count();
+  const double runs = static_cast<double>(iterations * frames.size());
+  result.points_per_sec =
+    elapsed_sec > 0.0 ? static_cast<double>(input_points * iterations) / elapsed_sec : 0.0;
+  result.allocations_per_frame = runs > 0.0 ? static_cast<double>(allocation_count) / runs : 0.0;
+  result.output_ratio =
+    input_points > 0 ? static_cast<double>(output_points) / static_cast<double>(input_points) : 0.0;
+  return result;
+}
+
+inline std::string toJson(const std::vector<Result> & results)
+{
+  std::ostringstream ss;
+  ss << "{\n  \"results\": [";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto & r = results[i];
+    ss << (i == 0 ? "\n" : ",\n");
+    ss << "    {\"filter\": \"" << r.filter << "\", \"method\": \"" << r.method
+       << "\", \"frames\": " << r.frames << ", \"iterations\": " << r.iterations
+       << ", \"points_per_sec\": " << r.points_per_sec
+       << ", \"allocations_per_frame\": " << r.allocations_per_frame
+       << ", \"output_ratio\": " << r.output_ratio << "}";
+  }
+  ss << "\n  ]\n}\n";
+  return ss.str();
+}
+}  // namespace pointcloud_preprocessor::filter_benchmark
+
+#endif  // POINTCLOUD_PREPROCESSOR__UTILITY__FILTER_BENCHMARK_HPP_
@@ -0,0 +1,316 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__UTILITY__POINT_CLOUD2_ACCESSOR_HPP_
+#define POINTCLOUD_PREPROCESSOR__UTILITY__POINT_CLOUD2_ACCESSOR_HPP_
+
+#include <autoware_point_types/types.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Field-offset-aware accessors to the points of a sensor_msgs::msg::PointCloud2.
+ *
+ * The byte offsets of the fields are either known at compile time (StaticLayout, for the
+ * autoware_point_types layouts) or resolved once from the message fields (DynamicLayout).
+ * visitPointCloud2() picks the static layout when the message matches one, so that the loops
+ * written against the view are branch-free on the layout and can be vectorized.
+ *
+ * Usage example:
+ *   \code
+ *   utils::visitPointCloud2<PointXYZIRADRT, PointXYZI>(
+ *     *input, field_offsets_cache_.resolve(*input), [&](const auto & view) {
+ *       for (size_t i = 0; i < view.size(); ++i) {
+ *         sum += view.x(i);
+ *       }
+ *     });
+ *   \endcode
+ */
+namespace pointcloud_preprocessor::utils
+{
+/** @brief byte offsets of the fields used by the filters, -1 if the field does not exist */
+struct PointFieldOffsets
+{
+  int x{-1};
+  int y{-1};
+  int z{-1};
+  int intensity{-1};
+  int ring{-1};
+  int azimuth{-1};
+  int distance{-1};
+  int return_type{-1};
+  int time_stamp{-1};
+};
+
+/** @brief find the offsets of the known fields in the given cloud */
+inline PointFieldOffsets resolveFieldOffsets(const sensor_msgs::msg::PointCloud2 & cloud)
+{
+  PointFieldOffsets offsets;
+  for (const auto & field : cloud.fields) {
+    const int offset = static_cast<int>(field.offset);
+    if (field.name == "x") {
+      offsets.x = offset;
+    } else if (field.name == "y") {
+      offsets.y = offset;
+    } else if (field.name == "z") {
+      offsets.z = offset;
+    } else if (field.name == "intensity") {
+      offsets.intensity = offset;
+    } else if (field.name == "ring") {
+      offsets.ring = offset;
+    } else if (field.name == "azimuth") {
+      offsets.azimuth = offset;
+    } else if (field.name == "distance") {
+      offsets.distance = offset;
+    } else if (field.name == "return_type") {
+      offsets.return_type = offset;
+    } else if (field.name == "time_stamp") {
+      offsets.time_stamp = offset;
+    }
+  }
+  return offsets;
+}
+
+/**
+ * @brief keep the field offsets of a topic and resolve them again only when the fields change
+ */
+class FieldOffsetsCache
+{
+public:
+  const PointFieldOffsets & resolve(const sensor_msgs::msg::PointCloud2 & cloud)
+  {
+    if (!initialized_ || cloud.fields != fields_) {
+      fields_ = cloud.fields;
+      offsets_ = resolveFieldOffsets(cloud);
+      initialized_ = true;
+    }
+    return offsets_;
+  }
+
+private:
+  bool initialized_{false};
+  std::vector<sensor_msgs::msg::PointField> fields_;
+  PointFieldOffsets offsets_;
+};
+
+/** @brief layout whose offsets are resolved at runtime */
+class DynamicLayout
+{
+public:
+  DynamicLayout(const PointFieldOffsets & offsets, const size_t point_step)
+  : offsets_(offsets), point_step_(point_step)
+  {
+  }
+
+  size_t point_step() const { return point_step_; }
+  size_t x_offset() const { return static_cast<size_t>(offsets_.x); }
+  size_t y_offset() const { return static_cast<size_t>(offsets_.y); }
+  size_t z_offset() const { return static_cast<size_t>(offsets_.z); }
+  size_t intensity_offset() const { return static_cast<size_t>(offsets_.intensity); }
+  size_t ring_offset() const { return static_cast<size_t>(offsets_.ring); }
+  size_t azimuth_offset() const { return static_cast<size_t>(offsets_.azimuth); }
+  size_t distance_offset() const { return static_cast<size_t>(offsets_.distance); }
+  size_t return_type_offset() const { return static_cast<size_t>(offsets_.return_type); }
+  size_t time_stamp_offset() const { return static_cast<size_t>(offsets_.time_stamp); }
+
+  bool has_intensity() const { return offsets_.intensity >= 0; }
+  bool has_ring() const { return offsets_.ring >= 0; }
+  bool has_azimuth() const { return offsets_.azimuth >= 0; }
+  bool has_distance() const { return offsets_.distance >= 0; }
+  bool has_return_type() const { return offsets_.return_type >= 0; }
+  bool has_time_stamp() const { return offsets_.time_stamp >= 0; }
+
+private:
+  PointFieldOffsets offsets_;
+  size_t point_step_;
+};
+
+namespace detail
+{
+inline bool hasField(
+  const sensor_msgs::msg::PointCloud2 & cloud, const std::string & name, const size_t offset,
+  const uint8_t datatype)
+{
+  for (const auto & field : cloud.fields) {
+    if (field.name == name) {
+      return field.offset == offset && field.datatype == datatype;
+    }
+  }
+  return false;
+}
+}  // namespace detail
+
+/** @brief layout whose offsets are known at compile time */
+template <class PointT>
+struct StaticLayout;
+
+template <>
+struct StaticLayout<autoware_point_types::PointXYZI>
+{
+  using PointT = autoware_point_types::PointXYZI;
+  static constexpr size_t point_step() { return sizeof(PointT); }
+  static constexpr size_t x_offset() { return offsetof(PointT, x); }
+  static constexpr size_t y_offset() { return offsetof(PointT, y); }
+  static constexpr size_t z_offset() { return offsetof(PointT, z); }
+  static constexpr size_t intensity_offset() { return offsetof(PointT, intensity); }
+  static constexpr bool has_intensity() { return true; }
+
+  static bool matches(const sensor_msgs::msg::PointCloud2 & cloud)
+  {
+    using sensor_msgs::msg::PointField;
+    return cloud.point_step == point_step() && cloud.fields.size() == 4 &&
+           detail::hasField(cloud, "x", x_offset(), PointField::FLOAT32) &&
+           detail::hasField(cloud, "y", y_offset(), PointField::FLOAT32) &&
+           detail::hasField(cloud, "z", z_offset(), PointField::FLOAT32) &&
+           detail::hasField(cloud, "intensity", intensity_offset(), PointField::FLOAT32);
+  }
+};
+
+template <>
+struct StaticLayout<autoware_point_types::PointXYZIRADRT>
+{
+  using PointT = autoware_point_types::PointXYZIRADRT;
+  static constexpr size_t point_step() { return sizeof(PointT); }
+  static constexpr size_t x_offset() { return offsetof(PointT, x); }
+  static constexpr size_t y_offset() { return offsetof(PointT, y); }
+  static constexpr size_t z_offset() { return offsetof(PointT, z); }
+  static constexpr size_t intensity_offset() { return offsetof(PointT, intensity); }
+  static constexpr size_t ring_offset() { return offsetof(PointT, ring); }
+  static constexpr size_t azimuth_offset() { return offsetof(PointT, azimuth); }
+  static constexpr size_t distance_offset() { return offsetof(PointT, distance); }
+  static constexpr size_t return_type_offset() { return offsetof(PointT, return_type); }
+  static constexpr size_t time_stamp_offset() { return offsetof(PointT, time_stamp); }
+  static constexpr bool has_intensity() { return true; }
+  static constexpr bool has_ring() { return true; }
+  static constexpr bool has_azimuth() { return true; }
+  static constexpr bool has_distance() { return true; }
+  static constexpr bool has_return_type() { return true; }
+  static constexpr bool has_time_stamp() { return true; }
+
+  static bool matches(const sensor_msgs::msg::PointCloud2 & cloud)
+  {
+    using sensor_msgs::msg::PointField;
+    return cloud.point_step == point_step() && cloud.fields.size() == 9 &&
+           detail::hasField(cloud, "x", x_offset(), PointField::FLOAT32) &&
+           detail::hasField(cloud, "y", y_offset(), PointField::FLOAT32) &&
+           detail::hasField(cloud, "z", z_offset(), PointField::FLOAT32) &&
+           detail::hasField(cloud, "intensity", intensity_offset(), PointField::FLOAT32) &&
+           detail::hasField(cloud, "ring", ring_offset(), PointField::UINT16) &&
+           detail::hasField(cloud, "azimuth", azimuth_offset(), PointField::FLOAT32) &&
+           detail::hasField(cloud, "distance", distance_offset(), PointField::FLOAT32) &&
+           detail::hasField(cloud, "return_type", return_type_offset(), PointField::UINT8) &&
+           detail::hasField(cloud, "time_stamp", time_stamp_offset(), PointField::FLOAT64);
+  }
+};
+
+/**
+ * @brief view to the points of a PointCloud2 with the given layout
+ * @details DataT is `const uint8_t` for a read-only view and `uint8_t` for a writable view.
+ */
+template <class LayoutT, class DataT = const uint8_t>
+class BasicPointCloud2View
+{
+public:
+  using CloudT = std::conditional_t<
+    std::is_const_v<DataT>, const sensor_msgs::msg::PointCloud2, sensor_msgs::msg::PointCloud2>;
+
+  BasicPointCloud2View(CloudT & cloud, const LayoutT & layout)
+  : data_(cloud.data.data()), size_(cloud.data.size() / layout.point_step()), layout_(layout)
+  {
+  }
+
+  size_t size() const { return size_; }
+  const LayoutT & layout() const { return layout_; }
+
+  DataT * point(const size_t i) const { return data_ + i * layout_.point_step(); }
+
+  float x(const size_t i) const { return get<float>(i, layout_.x_offset()); }
+  float y(const size_t i) const { return get<float>(i, layout_.y_offset()); }
+  float z(const size_t i) const { return get<float>(i, layout_.z_offset()); }
+  float intensity(const size_t i) const { return get<float>(i, layout_.intensity_offset()); }
+  uint16_t ring(const size_t i) const { return get<uint16_t>(i, layout_.ring_offset()); }
+  float azimuth(const size_t i) const { return get<float>(i, layout_.azimuth_offset()); }
+  float distance(const size_t i) const { return get<float>(i, layout_.distance_offset()); }
+  uint8_t return_type(const size_t i) const
+  {
+    return get<uint8_t>(i, layout_.return_type_offset());
+  }
+  double time_stamp(const size_t i) const { return get<double>(i, layout_.time_stamp_offset()); }
+
+  void set_x(const size_t i, const float value) const { set(i, layout_.x_offset(), value); }
+  void set_y(const size_t i, const float value) const { set(i, layout_.y_offset(), value); }
+  void set_z(const size_t i, const float value) const { set(i, layout_.z_offset(), value); }
+  void set_intensity(const size_t i, const float value) const
+  {
+    set(i, layout_.intensity_offset(), value);
+  }
+
+  template <class T>
+  T get(const size_t i, const size_t offset) const
+  {
+    T value;
+    std::memcpy(&value, point(i) + offset, sizeof(T));
+    return value;
+  }
+
+  template <class T>
+  void set(const size_t i, const size_t offset, const T value) const
+  {
+    static_assert(!std::is_const_v<DataT>, "cannot write to a read-only view");
+    std::memcpy(point(i) + offset, &value, sizeof(T));
+  }
+
+private:
+  DataT * data_;
+  size_t size_;
+  LayoutT layout_;
+};
+
+template <class LayoutT>
+using PointCloud2ConstView = BasicPointCloud2View<LayoutT, const uint8_t>;
+
+template <class LayoutT>
+using PointCloud2View = BasicPointCloud2View<LayoutT, uint8_t>;
+
+/**
+ * @brief call `func` with a read-only view of the cloud
+ * @details the view uses the first of PointTs whose layout matches the cloud, and falls back to
+ * a DynamicLayout built from `offsets`. `func` is instantiated for every candidate layout, so it
+ * must only use fields that exist in all of them.
+ */
+template <class... PointTs, class F>
+void visitPointCloud2(
+  const sensor_msgs::msg::PointCloud2 & cloud, const PointFieldOffsets & offsets, F && func)
+{
+  const bool visited =
+    ((StaticLayout<PointTs>::matches(cloud)
+        ? (func(PointCloud2ConstView<StaticLayout<PointTs>>(cloud, StaticLayout<PointTs>{})), true)
+        : false) ||
+     ...);
+  if (!visited) {
+    func(PointCloud2ConstView<DynamicLayout>(cloud, DynamicLayout(offsets, cloud.point_step)));
+  }
+}
+}  // namespace pointcloud_preprocessor::utils
+
+#endif  // POINTCLOUD_PREPROCESSOR__UTILITY__POINT_CLOUD2_ACCESSOR_HPP_
@@ -0,0 +1,136 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__UTILITY__POINT_RING_BUFFER_HPP_
+#define POINTCLOUD_PREPROCESSOR__UTILITY__POINT_RING_BUFFER_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+namespace pointcloud_preprocessor::utils
+{
+/**
+ * @brief preallocated ring of the points of consecutive frames
+ * @details the frames are stored one after another in the ring, and the oldest frames are dropped
+ * by moving the head of the ring, so the remaining points are never copied. A new frame
+ * overwrites the oldest frames if the ring is full.
+ */
+template <class PointT>
+class PointRingBuffer
+{
+public:
+  struct Frame
+  {
+    double stamp;
+    size_t begin;  //!< @brief index of the first point in the ring
+    size_t size;
+  };
+
+  /** @brief reallocate the ring, which drops all the frames */
+  void setCapacity(const size_t capacity)
+  {
+    points_.assign(capacity, PointT{});
+    clear();
+  }
+
+  void clear()
+  {
+    frames_.clear();
+    head_ = 0;
+    size_ = 0;
+  }
+
+  size_t capacity() const { return points_.size(); }
+  size_t size() const { return size_; }
+  const std::deque<Frame> & frames() const { return frames_; }
+
+  /**
+   * @brief add a frame of num_points points, which are written by `get_point(i)`
+   * @details only the last points of the frame are kept if it exceeds the capacity
+   */
+  template <class F>
+  void push(const double stamp, const size_t num_points, F && get_point)
+  {
+    if (capacity() == 0) {
+      return;
+    }
+    const size_t num_kept = std::min(num_points, capacity());
+    while (!frames_.empty() && size_ + num_kept > capacity()) {
+      dropOldest();
+    }
+
+    const size_t begin = (head_ + size_) % capacity();
+    size_t index = begin;
+    for (size_t i = num_points - num_kept; i < num_points; ++i) {
+      points_[index] = get_point(i);
+      index = index + 1 == capacity() ? 0 : index + 1;
+    }
+    frames_.push_back(Frame{stamp, begin, num_kept});
+    size_ += num_kept;
+  }
+
+  /** @brief drop the frames older than the given stamp */
+  void dropOlderThan(const double stamp)
+  {
+    while (!frames_.empty() && frames_.front().stamp < stamp) {
+      dropOldest();
+    }
+  }
+
+  /** @brief drop the oldest frames to keep the given number of frames at most */
+  void keepLatestFrames(const size_t num_frames)
+  {
+    while (frames_.size() > num_frames) {
+      dropOldest();
+    }
+  }
+
+  /**
+   * @brief call `func(points, num_points)` for the contiguous segments of the ring from the oldest
+   * point, which are two at most
+   */
+  template <class F>
+  void forEachSegment(F && func) const
+  {
+    const size_t first_size = std::min(size_, capacity() - head_);
+    if (first_size > 0) {
+      func(points_.data() + head_, first_size);
+    }
+    if (size_ > first_size) {
+      func(points_.data(), size_ - first_size);
+    }
+  }
+
+private:
+  void dropOldest()
+  {
+    const Frame & frame = frames_.front();
+    head_ = (frame.begin + frame.size) % capacity();
+    size_ -= frame.size;
+    frames_.pop_front();
+    if (frames_.empty()) {
+      head_ = 0;
+    }
+  }
+
+  std::vector<PointT> points_;
+  std::deque<Frame> frames_;
+  size_t head_{0};
+  size_t size_{0};
+};
+}  // namespace pointcloud_preprocessor::utils
+
+#endif  // POINTCLOUD_PREPROCESSOR__UTILITY__POINT_RING_BUFFER_HPP_
@@ -0,0 +1,186 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__UTILITY__POLYGON_MASK_HPP_
+#define POINTCLOUD_PREPROCESSOR__UTILITY__POLYGON_MASK_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace pointcloud_preprocessor::utils
+{
+/**
+ * @brief raster of the union of polygons, which decides most of the points without testing them
+ * against the polygons
+ * @details the cells crossed by an edge of the polygons are UNKNOWN, and the points in them have
+ * to be tested exactly. The other cells are entirely inside or outside of the polygons, which is
+ * decided at their centers by a scanline fill. The buffer is kept across builds.
+ */
+class PolygonMask
+{
+public:
+  enum class CellState : uint8_t { OUTSIDE = 0, INSIDE = 1, UNKNOWN = 2 };
+
+  /**
+   * @brief rasterize the polygons in the area [min_x, max_x) x [min_y, max_y)
+   * @details a polygon is a range of vertices with x() and y(), e.g. lanelet::BasicPolygon2d,
+   * which is closed implicitly. The points out of the area are UNKNOWN, unless the area contains
+   * all the polygons, in which case they are OUTSIDE.
+   */
+  template <class PolygonRange>
+  void build(
+    const PolygonRange & polygons, const double min_x, const double min_y, const double max_x,
+    const double max_y, const double cell_size)
+  {
+    cell_size_ = cell_size;
+    origin_x_ = min_x;
+    origin_y_ = min_y;
+    width_ = static_cast<int>(std::max(std::ceil((max_x - min_x) / cell_size), 1.0));
+    height_ = static_cast<int>(std::max(std::ceil((max_y - min_y) / cell_size), 1.0));
+    cells_.assign(static_cast<size_t>(width_) * static_cast<size_t>(height_), CellState::OUTSIDE);
+
+    bool contains_polygons = true;
+    for (const auto & polygon : polygons) {
+      for (const auto & vertex : polygon) {
+        contains_polygons &= min_x <= vertex.x() && vertex.x() < max_x && min_y <= vertex.y() &&
+                             vertex.y() < max_y;
+      }
+      fillPolygon(polygon);
+    }
+    for (const auto & polygon : polygons) {
+      if (std::size(polygon) == 0) {
+        continue;
+      }
+      auto prev = std::prev(std::end(polygon));
+      for (auto vertex = std::begin(polygon); vertex != std::end(polygon); prev = vertex++) {
+        markSegment(prev->x(), prev->y(), vertex->x(), vertex->y());
+      }
+    }
+    out_of_area_state_ = contains_polygons ? CellState::OUTSIDE : CellState::UNKNOWN;
+  }
+
+  /** @brief state of the cell containing the point */
+  CellState at(const double x, const double y) const
+  {
+    const double col = std::floor((x - origin_x_) / cell_size_);
+    const double row = std::floor((y - origin_y_) / cell_size_);
+    if (!(0.0 <= col && col < width_ && 0.0 <= row && row < height_)) {
+      return out_of_area_state_;
+    }
+    return cells_[static_cast<size_t>(row) * width_ + static_cast<size_t>(col)];
+  }
+
+  bool empty() const { return cells_.empty(); }
+
+  /** @brief whether the area of the mask contains the given area */
+  bool contains(const double min_x, const double min_y, const double max_x, const double max_y)
+    const
+  {
+    return !empty() && origin_x_ <= min_x && origin_y_ <= min_y &&
+           max_x <= origin_x_ + width_ * cell_size_ && max_y <= origin_y_ + height_ * cell_size_;
+  }
+
+private:
+  // mark the cells whose centers are inside the polygon by the even-odd rule
+  template <class Polygon>
+  void fillPolygon(const Polygon & polygon)
+  {
+    if (std::size(polygon) < 3) {
+      return;
+    }
+    double min_y = std::begin(polygon)->y();
+    double max_y = min_y;
+    for (const auto & vertex : polygon) {
+      min_y = std::min(min_y, vertex.y());
+      max_y = std::max(max_y, vertex.y());
+    }
+    const int row_begin = std::max(toIndex(min_y, origin_y_) - 1, 0);
+    const int row_end = std::min(toIndex(max_y, origin_y_) + 1, height_ - 1);
+    for (int row = row_begin; row <= row_end; ++row) {
+      const double y = origin_y_ + (row + 0.5) * cell_size_;
+      crossings_.clear();
+      auto prev = std::prev(std::end(polygon));
+      for (auto vertex = std::begin(polygon); vertex != std::end(polygon); prev = vertex++) {
+        if ((prev->y() <= y) != (vertex->y() <= y)) {
+          crossings_.push_back(
+            prev->x() + (y - prev->y()) * (vertex->x() - prev->x()) / (vertex->y() - prev->y()));
+        }
+      }
+      std::sort(crossings_.begin(), crossings_.end());
+      for (size_t i = 0; i + 1 < crossings_.size(); i += 2) {
+        // the columns whose centers are in [crossings_[i], crossings_[i + 1])
+        const int col_begin = std::max(
+          static_cast<int>(std::ceil((crossings_[i] - origin_x_) / cell_size_ - 0.5)), 0);
+        const int col_end = std::min(
+          static_cast<int>(std::ceil((crossings_[i + 1] - origin_x_) / cell_size_ - 0.5)),
+          width_);
+        for (int col = col_begin; col < col_end; ++col) {
+          cells_[static_cast<size_t>(row) * width_ + col] = CellState::INSIDE;
+        }
+      }
+    }
+  }
+
+  // mark the cells touched by the segment, with a margin for the rounding errors
+  void markSegment(double ax, double ay, double bx, double by)
+  {
+    if (bx < ax) {
+      std::swap(ax, bx);
+      std::swap(ay, by);
+    }
+    const double margin = cell_size_ * 1e-3;
+    const int col_begin = std::max(toIndex(ax - margin, origin_x_), 0);
+    const int col_end = std::min(toIndex(bx + margin, origin_x_), width_ - 1);
+    for (int col = col_begin; col <= col_end; ++col) {
+      // the part of the segment in the column
+      const double left = std::clamp(origin_x_ + col * cell_size_, ax, bx);
+      const double right = std::clamp(origin_x_ + (col + 1) * cell_size_, ax, bx);
+      double y_left = ay;
+      double y_right = by;
+      if (ax < bx) {
+        y_left = ay + (left - ax) * (by - ay) / (bx - ax);
+        y_right = ay + (right - ax) * (by - ay) / (bx - ax);
+      }
+      const int row_begin = std::max(toIndex(std::min(y_left, y_right) - margin, origin_y_), 0);
+      const int row_end =
+        std::min(toIndex(std::max(y_left, y_right) + margin, origin_y_), height_ - 1);
+      for (int row = row_begin; row <= row_end; ++row) {
+        cells_[static_cast<size_t>(row) * width_ + col] = CellState::UNKNOWN;
+      }
+    }
+  }
+
+  // index of the cell containing the coordinate, which is clamped to the range of int
+  int toIndex(const double value, const double origin) const
+  {
+    const double index = std::floor((value - origin) / cell_size_);
+    return static_cast<int>(std::clamp(index, -1.0, static_cast<double>(1 << 30)));
+  }
+
+  double cell_size_{1.0};
+  double origin_x_{0.0};
+  double origin_y_{0.0};
+  int width_{0};
+  int height_{0};
+  CellState out_of_area_state_{CellState::UNKNOWN};
+  std::vector<CellState> cells_;
+  std::vector<double> crossings_;
+};
+}  // namespace pointcloud_preprocessor::utils
+
+#endif  // POINTCLOUD_PREPROCESSOR__UTILITY__POLYGON_MASK_HPP_
@@ -0,0 +1,84 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__UTILITY__RING_INDEX_HPP_
+#define POINTCLOUD_PREPROCESSOR__UTILITY__RING_INDEX_HPP_
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace pointcloud_preprocessor::utils
+{
+/**
+ * @brief indices of the points of a cloud grouped by ring, in the order of the cloud
+ * @details the points are grouped by a counting sort over the rings of a view of
+ * point_cloud2_accessor.hpp, so that each ring can be iterated, or processed in parallel, without
+ * copying the points. The buffers are kept across frames.
+ */
+class RingIndex
+{
+public:
+  /**
+   * @brief group the points of the view for which `is_target(i)` holds by ring
+   * @details the points whose ring is not less than `num_rings` are ignored
+   */
+  template <class ViewT, class F>
+  void build(const ViewT & view, const size_t num_rings, F && is_target)
+  {
+    offsets_.assign(num_rings + 1, 0);
+    for (size_t i = 0; i < view.size(); ++i) {
+      const size_t ring = view.ring(i);
+      if (ring < num_rings && is_target(i)) {
+        ++offsets_[ring + 1];
+      }
+    }
+    std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+
+    indices_.resize(offsets_.back());
+    cursors_.assign(offsets_.begin(), offsets_.end() - 1);
+    for (size_t i = 0; i < view.size(); ++i) {
+      const size_t ring = view.ring(i);
+      if (ring < num_rings && is_target(i)) {
+        indices_[cursors_[ring]++] = i;
+      }
+    }
+  }
+
+  /** @brief group all the points of the view by ring */
+  template <class ViewT>
+  void build(const ViewT & view, const size_t num_rings)
+  {
+    build(view, num_rings, [](const size_t) { return true; });
+  }
+
+  size_t num_rings() const { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+  size_t size() const { return indices_.size(); }
+
+  /** @brief number of the points in the ring */
+  size_t ring_size(const size_t ring) const { return offsets_[ring + 1] - offsets_[ring]; }
+  /** @brief index in the cloud of the i-th point of the ring */
+  size_t at(const size_t ring, const size_t i) const { return indices_[offsets_[ring] + i]; }
+
+  const size_t * begin(const size_t ring) const { return indices_.data() + offsets_[ring]; }
+  const size_t * end(const size_t ring) const { return indices_.data() + offsets_[ring + 1]; }
+
+private:
+  std::vector<size_t> offsets_;  // the points of ring r are in [offsets_[r], offsets_[r + 1])
+  std::vector<size_t> indices_;
+  std::vector<size_t> cursors_;
+};
+}  // namespace pointcloud_preprocessor::utils
+
+#endif  // POINTCLOUD_PREPROCESSOR__UTILITY__RING_INDEX_HPP_
@@ -15,6 +15,8 @@
 #ifndef POINTCLOUD_PREPROCESSOR__UTILITY__UTILITIES_HPP_
 #define POINTCLOUD_PREPROCESSOR__UTILITY__UTILITIES_HPP_
 
+#include "pointcloud_preprocessor/utility/polygon_mask.hpp"
+
 #include <geometry_msgs/msg/polygon.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 #include <sensor_msgs/point_cloud2_iterator.hpp>
@@ -72,6 +74,23 @@ void remove_polygon_cgal_from_cloud(
   const pcl::PointCloud<pcl::PointXYZ> & cloud_in,
   const std::vector<PolygonCgal> & polyline_polygons, pcl::PointCloud<pcl::PointXYZ> & cloud_out);
 
+/**
+ * @brief remove points in the given polygon, testing only the points in the UNKNOWN cells of the
+ * mask built from the polygon
+ */
+void remove_polygon_cgal_from_cloud(
+  const sensor_msgs::msg::PointCloud2 & cloud_in, const PolygonCgal & polyline_polygon,
+  const PolygonMask & mask, sensor_msgs::msg::PointCloud2 & cloud_out);
+
+/**
+ * @brief remove points in the given polygons, testing only the points in the UNKNOWN cells of the
+ * mask built from the polygons
+ */
+void remove_polygon_cgal_from_cloud(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud_in,
+  const std::vector<PolygonCgal> & polyline_polygons, const PolygonMask & mask,
+  pcl::PointCloud<pcl::PointXYZ> & cloud_out);
+
 /**
  * @brief return true if the given point is inside the at least one of the polygons
  */
@@ -15,6 +15,8 @@
 #ifndef POINTCLOUD_PREPROCESSOR__VECTOR_MAP_FILTER__LANELET2_MAP_FILTER_NODELET_HPP_
 #define POINTCLOUD_PREPROCESSOR__VECTOR_MAP_FILTER__LANELET2_MAP_FILTER_NODELET_HPP_
 
+#include "pointcloud_preprocessor/utility/polygon_mask.hpp"
+
 #include <lanelet2_extension/utility/message_conversion.hpp>
 #include <lanelet2_extension/utility/query.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -40,8 +42,6 @@
 #include <string>
 #include <vector>
 
-using tier4_autoware_utils::LinearRing2d;
-using tier4_autoware_utils::MultiPoint2d;
 using tier4_autoware_utils::Point2d;
 
 namespace pointcloud_preprocessor
@@ -66,6 +66,13 @@ private:
   lanelet::LaneletMapPtr lanelet_map_ptr_;
   lanelet::ConstLanelets road_lanelets_;
 
+  // NOTE: The mask covers the point cloud with a margin, and is rebuilt only when the map is
+  //       updated or the point cloud goes out of it. The points in the cells crossed by the
+  //       boundaries of the lanelets are tested against mask_polygons_.
+  utils::PolygonMask road_mask_;
+  std::vector<lanelet::BasicPolygon2d> mask_polygons_;
+  std::vector<lanelet::BoundingBox2d> mask_polygon_boxes_;
+
   float voxel_size_x_;
   float voxel_size_y_;
 
@@ -77,16 +84,12 @@ private:
     const std::string & in_target_frame, const PointCloud2ConstPtr & in_cloud_ptr,
     PointCloud2 * out_cloud_ptr);
 
-  LinearRing2d getConvexHull(const pcl::PointCloud<pcl::PointXYZ>::Ptr & input_cloud);
-
-  lanelet::ConstLanelets getIntersectedLanelets(
-    const LinearRing2d & convex_hull, const lanelet::ConstLanelets & road_lanelets_);
+  void updateRoadMask(const pcl::PointCloud<pcl::PointXYZ> & cloud);
 
   pcl::PointCloud<pcl::PointXYZ> getLaneFilteredPointCloud(
-    const lanelet::ConstLanelets & joint_lanelets,
     const pcl::PointCloud<pcl::PointXYZ>::Ptr & cloud);
 
-  bool pointWithinLanelets(const Point2d & point, const lanelet::ConstLanelets & joint_lanelets);
+  bool pointWithinLanelets(const Point2d & point) const;
 
   /** \brief Parameter service callback result : needed to be hold */
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
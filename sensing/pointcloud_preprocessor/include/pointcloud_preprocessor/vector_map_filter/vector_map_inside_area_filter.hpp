@@ -25,6 +25,7 @@
 #include <lanelet2_core/geometry/Polygon.h>
 
 #include <string>
+#include <vector>
 
 using tier4_autoware_utils::MultiPoint2d;
 
@@ -39,6 +40,13 @@ private:
   rclcpp::Subscription<autoware_auto_mapping_msgs::msg::HADMapBin>::SharedPtr map_sub_;
   lanelet::ConstPolygons3d polygon_lanelets_;
 
+  // NOTE: The mask covers the point cloud with a margin, and is rebuilt only when the map is
+  //       updated or the point cloud goes out of it.
+  utils::PolygonMask polygon_mask_;
+  std::vector<PolygonCgal> mask_polygons_;
+
+  void updatePolygonMask(const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & cloud);
+
   void mapCallback(const autoware_auto_mapping_msgs::msg::HADMapBin::ConstSharedPtr msg);
 
   // parameter
@@ -175,13 +175,20 @@ void BlockageDiagComponent::filter(
   }
   ideal_horizontal_bins = static_cast<int>(
     (angle_range_deg_[1] + compensate_angle - angle_range_deg_[0]) / horizontal_resolution_);
-  pcl::PointCloud<PointXYZIRADRT>::Ptr pcl_input(new pcl::PointCloud<PointXYZIRADRT>);
-  pcl::fromROSMsg(*input, *pcl_input);
+  const auto & field_offsets = input_field_offsets_cache_.resolve(*input);
+  if (field_offsets.ring < 0 || field_offsets.azimuth < 0 || field_offsets.distance < 0) {
+    RCLCPP_ERROR_THROTTLE(
+      get_logger(), *get_clock(), 1000,
+      "Input pointcloud does not have the fields of PointXYZIRADRT. Skipping.");
+    output = *input;
+    return;
+  }
   cv::Mat full_size_depth_map(
     cv::Size(ideal_horizontal_bins, vertical_bins), CV_16UC1, cv::Scalar(0));
   cv::Mat lidar_depth_map_8u(
     cv::Size(ideal_horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
-  if (pcl_input->points.empty()) {
+  const size_t num_points = input->data.size() / std::max<size_t>(input->point_step, 1);
+  if (num_points == 0) {
     ground_blockage_ratio_ = 1.0f;
     sky_blockage_ratio_ = 1.0f;
     if (ground_blockage_count_ <= 2 * blockage_count_threshold_) {
@@ -195,26 +202,34 @@ void BlockageDiagComponent::filter(
     sky_blockage_range_deg_[0] = angle_range_deg_[0];
     sky_blockage_range_deg_[1] = angle_range_deg_[1];
   } else {
-    for (const auto p : pcl_input->points) {
-      double azimuth_deg = p.azimuth / 100.;
-      if (
-        ((azimuth_deg > angle_range_deg_[0]) &&
-         (azimuth_deg <= angle_range_deg_[1] + compensate_angle)) ||
-        ((azimuth_deg + compensate_angle > angle_range_deg_[0]) &&
-         (azimuth_deg < angle_range_deg_[1]))) {
-        double current_angle_range = (azimuth_deg + compensate_angle - angle_range_deg_[0]);
-        int horizontal_bin_index = static_cast<int>(current_angle_range / horizontal_resolution_) %
-                                   static_cast<int>(360.0 / horizontal_resolution_);
-        uint16_t depth_intensity =
-          UINT16_MAX * (1.0 - std::min(p.distance / max_distance_range_, 1.0));
-        if (is_channel_order_top2down_) {
-          full_size_depth_map.at<uint16_t>(p.ring, horizontal_bin_index) = depth_intensity;
-        } else {
-          full_size_depth_map.at<uint16_t>(vertical_bins - p.ring - 1, horizontal_bin_index) =
-            depth_intensity;
+    // The points are read in place, without converting the cloud
+    utils::visitPointCloud2<PointXYZIRADRT>(*input, field_offsets, [&](const auto & view) {
+      for (size_t i = 0; i < view.size(); ++i) {
+        const int ring = view.ring(i);
+        if (vertical_bins <= ring) {
+          continue;
+        }
+        double azimuth_deg = view.azimuth(i) / 100.;
+        if (
+          ((azimuth_deg > angle_range_deg_[0]) &&
+           (azimuth_deg <= angle_range_deg_[1] + compensate_angle)) ||
+          ((azimuth_deg + compensate_angle > angle_range_deg_[0]) &&
+           (azimuth_deg < angle_range_deg_[1]))) {
+          double current_angle_range = (azimuth_deg + compensate_angle - angle_range_deg_[0]);
+          int horizontal_bin_index =
+            static_cast<int>(current_angle_range / horizontal_resolution_) %
+            static_cast<int>(360.0 / horizontal_resolution_);
+          uint16_t depth_intensity =
+            UINT16_MAX * (1.0 - std::min(view.distance(i) / max_distance_range_, 1.0));
+          if (is_channel_order_top2down_) {
+            full_size_depth_map.at<uint16_t>(ring, horizontal_bin_index) = depth_intensity;
+          } else {
+            full_size_depth_map.at<uint16_t>(vertical_bins - ring - 1, horizontal_bin_index) =
+              depth_intensity;
+          }
         }
       }
-    }
+    });
   }
   full_size_depth_map.convertTo(lidar_depth_map_8u, CV_8UC1, 1.0 / 300);
   cv::Mat no_return_mask(cv::Size(ideal_horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
@@ -404,8 +419,8 @@ void BlockageDiagComponent::filter(
     blockage_mask_pub_.publish(blockage_mask_msg);
   }
 
-  pcl::toROSMsg(*pcl_input, output);
-  output.header = input->header;
+  // The input is passed through
+  output = *input;
 }
 rcl_interfaces::msg::SetParametersResult BlockageDiagComponent::paramCallback(
   const std::vector<rclcpp::Parameter> & p)
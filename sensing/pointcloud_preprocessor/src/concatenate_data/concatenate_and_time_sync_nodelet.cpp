@@ -55,7 +55,14 @@
 
 #include <pcl_conversions/pcl_conversions.h>
 
+#ifdef ROS_DISTRO_GALACTIC
+#include <tf2_eigen/tf2_eigen.h>
+#else
+#include <tf2_eigen/tf2_eigen.hpp>
+#endif
+
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -117,6 +124,15 @@ PointCloudConcatenateDataSynchronizerComponent::PointCloudConcatenateDataSynchro
       declare_parameter("keep_input_frame_in_synchronized_pointcloud", true);
     synchronized_pointcloud_postfix_ =
       declare_parameter("synchronized_pointcloud_postfix", "pointcloud");
+
+    // Zero-copy concatenation
+    use_zero_copy_concatenation_ = declare_parameter("use_zero_copy_concatenation", false);
+    const auto concatenation_worker_threads =
+      static_cast<int>(declare_parameter("concatenation_worker_threads", 4));
+    if (use_zero_copy_concatenation_) {
+      worker_pool_ = std::make_unique<utils::WorkerPool>(
+        static_cast<size_t>(std::max(concatenation_worker_threads, 1)));
+    }
   }
 
   // Initialize not_subscribed_topic_names_
@@ -160,6 +176,8 @@ PointCloudConcatenateDataSynchronizerComponent::PointCloudConcatenateDataSynchro
     for (size_t d = 0; d < input_topics_.size(); ++d) {
       cloud_stdmap_.insert(std::make_pair(input_topics_[d], nullptr));
       cloud_stdmap_tmp_ = cloud_stdmap_;
+      prepared_cloud_map_.insert(std::make_pair(input_topics_[d], PreparedCloudFuture{}));
+      prepared_cloud_map_tmp_ = prepared_cloud_map_;
 
       // CAN'T use auto type here.
       std::function<void(const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)> cb = std::bind(
@@ -430,27 +448,31 @@ void PointCloudConcatenateDataSynchronizerComponent::publish()
   sensor_msgs::msg::PointCloud2::SharedPtr concat_cloud_ptr = nullptr;
   not_subscribed_topic_names_.clear();
 
-  const auto & transformed_raw_points =
-    PointCloudConcatenateDataSynchronizerComponent::combineClouds(concat_cloud_ptr);
-
-  // publish concatenated pointcloud
-  if (concat_cloud_ptr) {
-    auto output = std::make_unique<sensor_msgs::msg::PointCloud2>(*concat_cloud_ptr);
-    pub_output_->publish(std::move(output));
+  if (use_zero_copy_concatenation_) {
+    publishZeroCopy();
   } else {
-    RCLCPP_WARN(this->get_logger(), "concat_cloud_ptr is nullptr, skipping pointcloud publish.");
-  }
+    const auto & transformed_raw_points =
+      PointCloudConcatenateDataSynchronizerComponent::combineClouds(concat_cloud_ptr);
 
-  // publish transformed raw pointclouds
-  if (publish_synchronized_pointcloud_) {
-    for (const auto & e : transformed_raw_points) {
-      if (e.second) {
-        auto output = std::make_unique<sensor_msgs::msg::PointCloud2>(*e.second);
-        transformed_raw_pc_publisher_map_[e.first]->publish(std::move(output));
-      } else {
-        RCLCPP_WARN(
-          this->get_logger(), "transformed_raw_points[%s] is nullptr, skipping pointcloud publish.",
-          e.first.c_str());
+    // publish concatenated pointcloud
+    if (concat_cloud_ptr) {
+      auto output = std::make_unique<sensor_msgs::msg::PointCloud2>(*concat_cloud_ptr);
+      pub_output_->publish(std::move(output));
+    } else {
+      RCLCPP_WARN(this->get_logger(), "concat_cloud_ptr is nullptr, skipping pointcloud publish.");
+    }
+
+    // publish transformed raw pointclouds
+    if (publish_synchronized_pointcloud_) {
+      for (const auto & e : transformed_raw_points) {
+        if (e.second) {
+          auto output = std::make_unique<sensor_msgs::msg::PointCloud2>(*e.second);
+          transformed_raw_pc_publisher_map_[e.first]->publish(std::move(output));
+        } else {
+          RCLCPP_WARN(
+            this->get_logger(),
+            "transformed_raw_points[%s] is nullptr, skipping pointcloud publish.", e.first.c_str());
+        }
       }
     }
   }
@@ -461,6 +483,10 @@ void PointCloudConcatenateDataSynchronizerComponent::publish()
   std::for_each(std::begin(cloud_stdmap_tmp_), std::end(cloud_stdmap_tmp_), [](auto & e) {
     e.second = nullptr;
   });
+  prepared_cloud_map_ = prepared_cloud_map_tmp_;
+  std::for_each(
+    std::begin(prepared_cloud_map_tmp_), std::end(prepared_cloud_map_tmp_),
+    [](auto & e) { e.second = PreparedCloudFuture{}; });
   // add processing time for debug
   if (debug_publisher_) {
     const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
@@ -525,6 +551,222 @@ void PointCloudConcatenateDataSynchronizerComponent::convertToXYZICloud(
   }
 }
 
+PointCloudConcatenateDataSynchronizerComponent::PreparedCloudFuture
+PointCloudConcatenateDataSynchronizerComponent::prepareCloud(
+  const PointCloud2::ConstSharedPtr & input_ptr)
+{
+  return worker_pool_
+    ->enqueue([this, input_ptr]() { return convertToXYZICloudInOutputFrame(input_ptr); })
+    .share();
+}
+
+std::shared_ptr<const PointCloudConcatenateDataSynchronizerComponent::PreparedCloud>
+PointCloudConcatenateDataSynchronizerComponent::convertToXYZICloudInOutputFrame(
+  const PointCloud2::ConstSharedPtr & input_ptr)
+{
+  auto prepared_cloud = std::make_shared<PreparedCloud>();
+  prepared_cloud->frame_id = input_ptr->header.frame_id;
+  if (input_ptr->data.empty()) {
+    return prepared_cloud;
+  }
+
+  if (output_frame_ != input_ptr->header.frame_id) {
+    try {
+      const auto transform_stamped = tf2_buffer_->lookupTransform(
+        output_frame_, input_ptr->header.frame_id, tf2::TimePointZero);
+      prepared_cloud->sensor_to_output =
+        tf2::transformToEigen(transform_stamped.transform).matrix().cast<float>();
+    } catch (const tf2::TransformException & ex) {
+      RCLCPP_ERROR(
+        this->get_logger(),
+        "[convertToXYZICloudInOutputFrame] Error converting input dataset from %s to %s: %s",
+        input_ptr->header.frame_id.c_str(), output_frame_.c_str(), ex.what());
+      return prepared_cloud;
+    }
+  }
+
+  const bool has_intensity = std::any_of(
+    input_ptr->fields.begin(), input_ptr->fields.end(),
+    [](auto & field) { return field.name == "intensity"; });
+
+  const Eigen::Affine3f sensor_to_output(prepared_cloud->sensor_to_output);
+  auto & points = prepared_cloud->points;
+  points.resize(static_cast<size_t>(input_ptr->width) * input_ptr->height);
+
+  sensor_msgs::PointCloud2ConstIterator<float> it_x(*input_ptr, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> it_y(*input_ptr, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> it_z(*input_ptr, "z");
+  if (has_intensity) {
+    sensor_msgs::PointCloud2ConstIterator<float> it_i(*input_ptr, "intensity");
+    for (auto & point : points) {
+      const Eigen::Vector3f p = sensor_to_output * Eigen::Vector3f(*it_x, *it_y, *it_z);
+      point = PointXYZI{p.x(), p.y(), p.z(), *it_i};
+      ++it_x, ++it_y, ++it_z, ++it_i;
+    }
+  } else {
+    for (auto & point : points) {
+      const Eigen::Vector3f p = sensor_to_output * Eigen::Vector3f(*it_x, *it_y, *it_z);
+      point = PointXYZI{p.x(), p.y(), p.z(), 0.0f};
+      ++it_x, ++it_y, ++it_z;
+    }
+  }
+  prepared_cloud->valid = true;
+  return prepared_cloud;
+}
+
+bool PointCloudConcatenateDataSynchronizerComponent::combineCloudsZeroCopy(
+  sensor_msgs::msg::PointCloud2 & concat_cloud,
+  std::map<std::string, sensor_msgs::msg::PointCloud2::UniquePtr> & transformed_clouds)
+{
+  // Step1. gather stamps and sort it
+  std::vector<rclcpp::Time> pc_stamps;
+  for (const auto & e : cloud_stdmap_) {
+    transformed_clouds[e.first] = nullptr;
+    if (e.second != nullptr) {
+      if (e.second->data.size() == 0) {
+        continue;
+      }
+      pc_stamps.push_back(rclcpp::Time(e.second->header.stamp));
+    }
+  }
+  if (pc_stamps.empty()) {
+    return false;
+  }
+  // sort stamps and get oldest stamp
+  std::sort(pc_stamps.begin(), pc_stamps.end());
+  std::reverse(pc_stamps.begin(), pc_stamps.end());
+  const auto oldest_stamp = pc_stamps.back();
+
+  // Step2. Calculate compensation transform and the offset of each cloud in the output buffer
+  struct ConcatTarget
+  {
+    std::string topic_name;
+    std::shared_ptr<const PreparedCloud> cloud;
+    Eigen::Matrix4f adjust_to_old_data_transform;
+    size_t offset;
+    sensor_msgs::msg::PointCloud2::UniquePtr synchronized_cloud;
+  };
+  std::vector<ConcatTarget> targets;
+  size_t num_concat_points = 0;
+  for (const auto & e : cloud_stdmap_) {
+    if (e.second == nullptr) {
+      not_subscribed_topic_names_.insert(e.first);
+      continue;
+    }
+    const auto & prepared_cloud_future = prepared_cloud_map_[e.first];
+    if (e.second->data.size() == 0 || !prepared_cloud_future.valid()) {
+      continue;
+    }
+    const auto prepared_cloud = prepared_cloud_future.get();
+    if (!prepared_cloud->valid) {
+      continue;
+    }
+
+    // calculate transforms to oldest stamp
+    Eigen::Matrix4f adjust_to_old_data_transform = Eigen::Matrix4f::Identity();
+    rclcpp::Time transformed_stamp = rclcpp::Time(e.second->header.stamp);
+    for (const auto & stamp : pc_stamps) {
+      const auto new_to_old_transform =
+        computeTransformToAdjustForOldTimestamp(stamp, transformed_stamp);
+      adjust_to_old_data_transform = new_to_old_transform * adjust_to_old_data_transform;
+      transformed_stamp = std::min(transformed_stamp, stamp);
+    }
+    targets.push_back(ConcatTarget{
+      e.first, prepared_cloud, adjust_to_old_data_transform, num_concat_points, nullptr});
+    num_concat_points += prepared_cloud->points.size();
+  }
+
+  // Step3. Allocate the output once and let every cloud write its own slice of it
+  PointCloud2Modifier<PointXYZI> concat_modifier{concat_cloud, output_frame_};
+  concat_modifier.resize(num_concat_points);
+  concat_cloud.header.stamp = oldest_stamp;
+
+  const auto write_points = [](
+                              const std::vector<PointXYZI> & points,
+                              const Eigen::Affine3f & transform, uint8_t * data,
+                              const uint32_t point_step) {
+    for (const auto & point : points) {
+      const Eigen::Vector3f p = transform * Eigen::Vector3f(point.x, point.y, point.z);
+      const PointXYZI transformed_point{p.x(), p.y(), p.z(), point.intensity};
+      std::memcpy(data, &transformed_point, sizeof(PointXYZI));
+      data += point_step;
+    }
+  };
+
+  uint8_t * const concat_data = concat_cloud.data.data();
+  const uint32_t concat_point_step = concat_cloud.point_step;
+  std::vector<std::future<void>> jobs;
+  jobs.reserve(targets.size());
+  for (auto & target : targets) {
+    jobs.push_back(worker_pool_->enqueue([&, concat_data]() {
+      const Eigen::Affine3f adjust_to_old_data_transform(target.adjust_to_old_data_transform);
+      write_points(
+        target.cloud->points, adjust_to_old_data_transform,
+        concat_data + target.offset * concat_point_step, concat_point_step);
+
+      if (!publish_synchronized_pointcloud_) {
+        return;
+      }
+      // convert to original sensor frame if necessary
+      const bool need_transform_to_sensor_frame = (target.cloud->frame_id != output_frame_);
+      const bool keep_input_frame =
+        keep_input_frame_in_synchronized_pointcloud_ && need_transform_to_sensor_frame;
+      const std::string & frame_id = keep_input_frame ? target.cloud->frame_id : output_frame_;
+      const Eigen::Affine3f synchronized_transform =
+        keep_input_frame ? Eigen::Affine3f(
+                             target.cloud->sensor_to_output.inverse() *
+                             target.adjust_to_old_data_transform)
+                         : adjust_to_old_data_transform;
+
+      auto synchronized_cloud = std::make_unique<sensor_msgs::msg::PointCloud2>();
+      PointCloud2Modifier<PointXYZI> synchronized_modifier{*synchronized_cloud, frame_id};
+      synchronized_modifier.resize(target.cloud->points.size());
+      write_points(
+        target.cloud->points, synchronized_transform, synchronized_cloud->data.data(),
+        synchronized_cloud->point_step);
+      synchronized_cloud->header.stamp = oldest_stamp;
+      target.synchronized_cloud = std::move(synchronized_cloud);
+    }));
+  }
+  for (auto & job : jobs) {
+    job.wait();
+  }
+  for (auto & job : jobs) {
+    job.get();
+  }
+
+  for (auto & target : targets) {
+    transformed_clouds[target.topic_name] = std::move(target.synchronized_cloud);
+  }
+  return true;
+}
+
+void PointCloudConcatenateDataSynchronizerComponent::publishZeroCopy()
+{
+  auto concat_cloud = pub_output_->borrow_loaned_message();
+  std::map<std::string, sensor_msgs::msg::PointCloud2::UniquePtr> transformed_raw_points;
+
+  // publish concatenated pointcloud
+  if (combineCloudsZeroCopy(concat_cloud.get(), transformed_raw_points)) {
+    pub_output_->publish(std::move(concat_cloud));
+  } else {
+    RCLCPP_WARN(this->get_logger(), "concat_cloud is empty, skipping pointcloud publish.");
+  }
+
+  // publish transformed raw pointclouds
+  if (publish_synchronized_pointcloud_) {
+    for (auto & e : transformed_raw_points) {
+      if (e.second) {
+        transformed_raw_pc_publisher_map_[e.first]->publish(std::move(e.second));
+      } else {
+        RCLCPP_WARN(
+          this->get_logger(), "transformed_raw_points[%s] is nullptr, skipping pointcloud publish.",
+          e.first.c_str());
+      }
+    }
+  }
+}
+
 void PointCloudConcatenateDataSynchronizerComponent::setPeriod(const int64_t new_period)
 {
   if (!timer_) {
@@ -545,14 +787,27 @@ void PointCloudConcatenateDataSynchronizerComponent::cloud_callback(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr & input_ptr, const std::string & topic_name)
 {
   std::lock_guard<std::mutex> lock(mutex_);
-  sensor_msgs::msg::PointCloud2::SharedPtr xyzi_input_ptr(new sensor_msgs::msg::PointCloud2());
-  auto input = std::make_shared<sensor_msgs::msg::PointCloud2>(*input_ptr);
-  if (input->data.empty()) {
-    RCLCPP_WARN_STREAM_THROTTLE(
-      this->get_logger(), *this->get_clock(), 1000, "Empty sensor points!");
+  sensor_msgs::msg::PointCloud2::ConstSharedPtr xyzi_input_ptr;
+  PreparedCloudFuture prepared_cloud;
+  if (use_zero_copy_concatenation_) {
+    // keep the received message as is, the XYZI conversion runs on the worker pool
+    if (input_ptr->data.empty()) {
+      RCLCPP_WARN_STREAM_THROTTLE(
+        this->get_logger(), *this->get_clock(), 1000, "Empty sensor points!");
+    }
+    xyzi_input_ptr = input_ptr;
+    prepared_cloud = prepareCloud(input_ptr);
   } else {
-    // convert to XYZI pointcloud if pointcloud is not empty
-    convertToXYZICloud(input, xyzi_input_ptr);
+    auto converted_ptr = std::make_shared<sensor_msgs::msg::PointCloud2>();
+    auto input = std::make_shared<sensor_msgs::msg::PointCloud2>(*input_ptr);
+    if (input->data.empty()) {
+      RCLCPP_WARN_STREAM_THROTTLE(
+        this->get_logger(), *this->get_clock(), 1000, "Empty sensor points!");
+    } else {
+      // convert to XYZI pointcloud if pointcloud is not empty
+      convertToXYZICloud(input, converted_ptr);
+    }
+    xyzi_input_ptr = converted_ptr;
   }
 
   const bool is_already_subscribed_this = (cloud_stdmap_[topic_name] != nullptr);
@@ -562,6 +817,7 @@ void PointCloudConcatenateDataSynchronizerComponent::cloud_callback(
 
   if (is_already_subscribed_this) {
     cloud_stdmap_tmp_[topic_name] = xyzi_input_ptr;
+    prepared_cloud_map_tmp_[topic_name] = prepared_cloud;
 
     if (!is_already_subscribed_tmp) {
       auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(
@@ -575,6 +831,7 @@ void PointCloudConcatenateDataSynchronizerComponent::cloud_callback(
     }
   } else {
     cloud_stdmap_[topic_name] = xyzi_input_ptr;
+    prepared_cloud_map_[topic_name] = prepared_cloud;
 
     const bool is_subscribed_all = std::all_of(
       std::begin(cloud_stdmap_), std::end(cloud_stdmap_),
@@ -584,11 +841,15 @@ void PointCloudConcatenateDataSynchronizerComponent::cloud_callback(
       for (const auto & e : cloud_stdmap_tmp_) {
         if (e.second != nullptr) {
           cloud_stdmap_[e.first] = e.second;
+          prepared_cloud_map_[e.first] = prepared_cloud_map_tmp_[e.first];
         }
       }
       std::for_each(std::begin(cloud_stdmap_tmp_), std::end(cloud_stdmap_tmp_), [](auto & e) {
         e.second = nullptr;
       });
+      std::for_each(
+        std::begin(prepared_cloud_map_tmp_), std::end(prepared_cloud_map_tmp_),
+        [](auto & e) { e.second = PreparedCloudFuture{}; });
 
       timer_->cancel();
       publish();
@@ -123,47 +123,42 @@ void CropBoxFilterComponent::faster_filter(
       get_logger(), *get_clock(), 1000, "Indices are not supported and will be ignored");
   }
 
-  int x_offset = input->fields[pcl::getFieldIndex(*input, "x")].offset;
-  int y_offset = input->fields[pcl::getFieldIndex(*input, "y")].offset;
-  int z_offset = input->fields[pcl::getFieldIndex(*input, "z")].offset;
-
   output.data.resize(input->data.size());
   size_t output_size = 0;
 
   int skipped_count = 0;
 
-  for (size_t global_offset = 0; global_offset + input->point_step <= input->data.size();
-       global_offset += input->point_step) {
-    Eigen::Vector4f point;
-    std::memcpy(&point[0], &input->data[global_offset + x_offset], sizeof(float));
-    std::memcpy(&point[1], &input->data[global_offset + y_offset], sizeof(float));
-    std::memcpy(&point[2], &input->data[global_offset + z_offset], sizeof(float));
-    point[3] = 1;
-
-    if (!std::isfinite(point[0]) || !std::isfinite(point[1]) || !std::isfinite(point[2])) {
-      skipped_count++;
-      continue;
-    }
-
-    if (transform_info.need_transform) {
-      point = transform_info.eigen_transform * point;
-    }
-
-    bool point_is_inside = point[2] > param_.min_z && point[2] < param_.max_z &&
-                           point[1] > param_.min_y && point[1] < param_.max_y &&
-                           point[0] > param_.min_x && point[0] < param_.max_x;
-    if ((!param_.negative && point_is_inside) || (param_.negative && !point_is_inside)) {
-      memcpy(&output.data[output_size], &input->data[global_offset], input->point_step);
-
-      if (transform_info.need_transform) {
-        std::memcpy(&output.data[output_size + x_offset], &point[0], sizeof(float));
-        std::memcpy(&output.data[output_size + y_offset], &point[1], sizeof(float));
-        std::memcpy(&output.data[output_size + z_offset], &point[2], sizeof(float));
+  utils::visitPointCloud2<autoware_point_types::PointXYZIRADRT, autoware_point_types::PointXYZI>(
+    *input, input_field_offsets_cache_.resolve(*input), [&](const auto & input_view) {
+      const auto & layout = input_view.layout();
+      for (size_t i = 0; i < input_view.size(); ++i) {
+        Eigen::Vector4f point(input_view.x(i), input_view.y(i), input_view.z(i), 1);
+
+        if (!std::isfinite(point[0]) || !std::isfinite(point[1]) || !std::isfinite(point[2])) {
+          skipped_count++;
+          continue;
+        }
+
+        if (transform_info.need_transform) {
+          point = transform_info.eigen_transform * point;
+        }
+
+        bool point_is_inside = point[2] > param_.min_z && point[2] < param_.max_z &&
+                               point[1] > param_.min_y && point[1] < param_.max_y &&
+                               point[0] > param_.min_x && point[0] < param_.max_x;
+        if ((!param_.negative && point_is_inside) || (param_.negative && !point_is_inside)) {
+          memcpy(&output.data[output_size], input_view.point(i), input->point_step);
+
+          if (transform_info.need_transform) {
+            std::memcpy(&output.data[output_size + layout.x_offset()], &point[0], sizeof(float));
+            std::memcpy(&output.data[output_size + layout.y_offset()], &point[1], sizeof(float));
+            std::memcpy(&output.data[output_size + layout.z_offset()], &point[2], sizeof(float));
+          }
+
+          output_size += input->point_step;
+        }
       }
-
-      output_size += input->point_step;
-    }
-  }
+    });
 
   if (skipped_count > 0) {
     RCLCPP_WARN_THROTTLE(
@@ -14,9 +14,14 @@
 
 #include "pointcloud_preprocessor/distortion_corrector/distortion_corrector.hpp"
 
+#include "pointcloud_preprocessor/distortion_corrector/undistortion_kernel.hpp"
+
 #include "tier4_autoware_utils/math/trigonometry.hpp"
 
+#include <array>
+#include <cstring>
 #include <deque>
+#include <stdexcept>
 #include <string>
 #include <utility>
 
@@ -39,6 +44,15 @@ DistortionCorrectorComponent::DistortionCorrectorComponent(const rclcpp::NodeOpt
   // Parameter
   time_stamp_field_name_ = declare_parameter("time_stamp_field_name", "time_stamp");
   use_imu_ = declare_parameter("use_imu", true);
+  {
+    DistortionCorrector::Param param;
+    param.base_link_frame = base_link_frame_;
+    param.time_stamp_field_name = time_stamp_field_name_;
+    param.use_imu = use_imu_;
+    param.use_vectorized_undistortion = declare_parameter("use_vectorized_undistortion", false);
+    param.undistortion_block_time_sec = declare_parameter("undistortion_block_time_sec", 0.0001);
+    distortion_corrector_ = std::make_unique<DistortionCorrector>(*this, param);
+  }
 
   // Publisher
   undistorted_points_pub_ =
@@ -60,22 +74,7 @@ DistortionCorrectorComponent::DistortionCorrectorComponent(const rclcpp::NodeOpt
 void DistortionCorrectorComponent::onTwistWithCovarianceStamped(
   const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr twist_msg)
 {
-  geometry_msgs::msg::TwistStamped msg;
-  msg.header = twist_msg->header;
-  msg.twist = twist_msg->twist.twist;
-  twist_queue_.push_back(msg);
-
-  while (!twist_queue_.empty()) {
-    // for replay rosbag
-    if (rclcpp::Time(twist_queue_.front().header.stamp) > rclcpp::Time(twist_msg->header.stamp)) {
-      twist_queue_.pop_front();
-    } else if (  // NOLINT
-      rclcpp::Time(twist_queue_.front().header.stamp) <
-      rclcpp::Time(twist_msg->header.stamp) - rclcpp::Duration::from_seconds(1.0)) {
-      twist_queue_.pop_front();
-    }
-    break;
-  }
+  distortion_corrector_->processTwistMessage(twist_msg);
 }
 
 void DistortionCorrectorComponent::onImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_msg)
@@ -86,31 +85,7 @@ void DistortionCorrectorComponent::onImu(const sensor_msgs::msg::Imu::ConstShare
 
   tf2::Transform tf2_imu_link_to_base_link{};
   getTransform(base_link_frame_, imu_msg->header.frame_id, &tf2_imu_link_to_base_link);
-  geometry_msgs::msg::TransformStamped::SharedPtr tf_base2imu_ptr =
-    std::make_shared<geometry_msgs::msg::TransformStamped>();
-  tf_base2imu_ptr->transform.rotation = tf2::toMsg(tf2_imu_link_to_base_link.getRotation());
-
-  geometry_msgs::msg::Vector3Stamped angular_velocity;
-  angular_velocity.vector = imu_msg->angular_velocity;
-
-  geometry_msgs::msg::Vector3Stamped transformed_angular_velocity;
-  tf2::doTransform(angular_velocity, transformed_angular_velocity, *tf_base2imu_ptr);
-  transformed_angular_velocity.header = imu_msg->header;
-  angular_velocity_queue_.push_back(transformed_angular_velocity);
-
-  while (!angular_velocity_queue_.empty()) {
-    // for replay rosbag
-    if (
-      rclcpp::Time(angular_velocity_queue_.front().header.stamp) >
-      rclcpp::Time(imu_msg->header.stamp)) {
-      angular_velocity_queue_.pop_front();
-    } else if (  // NOLINT
-      rclcpp::Time(angular_velocity_queue_.front().header.stamp) <
-      rclcpp::Time(imu_msg->header.stamp) - rclcpp::Duration::from_seconds(1.0)) {
-      angular_velocity_queue_.pop_front();
-    }
-    break;
-  }
+  distortion_corrector_->processIMUMessage(imu_msg, tf2_imu_link_to_base_link);
 }
 
 void DistortionCorrectorComponent::onPointCloud(PointCloud2::UniquePtr points_msg)
@@ -126,7 +101,7 @@ void DistortionCorrectorComponent::onPointCloud(PointCloud2::UniquePtr points_ms
   tf2::Transform tf2_base_link_to_sensor{};
   getTransform(points_msg->header.frame_id, base_link_frame_, &tf2_base_link_to_sensor);
 
-  undistortPointCloud(tf2_base_link_to_sensor, *points_msg);
+  distortion_corrector_->undistortPointCloud(tf2_base_link_to_sensor, *points_msg);
 
   if (debug_publisher_) {
     auto pipeline_latency_ms =
@@ -177,12 +152,81 @@ bool DistortionCorrectorComponent::getTransform(
   return true;
 }
 
-bool DistortionCorrectorComponent::undistortPointCloud(
+DistortionCorrector::DistortionCorrector(rclcpp::Node & node, const Param & param)
+: logger_(node.get_logger()), clock_(node.get_clock()), param_(param)
+{
+  if (param_.use_vectorized_undistortion) {
+    RCLCPP_INFO(logger_, "Vectorized undistortion enabled (%s).", undistortion::instructionSet());
+  }
+}
+
+void DistortionCorrector::processTwistMessage(
+  const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr & twist_msg)
+{
+  geometry_msgs::msg::TwistStamped msg;
+  msg.header = twist_msg->header;
+  msg.twist = twist_msg->twist.twist;
+  twist_queue_.push_back(msg);
+
+  while (!twist_queue_.empty()) {
+    // for replay rosbag
+    if (rclcpp::Time(twist_queue_.front().header.stamp) > rclcpp::Time(twist_msg->header.stamp)) {
+      twist_queue_.pop_front();
+    } else if (  // NOLINT
+      rclcpp::Time(twist_queue_.front().header.stamp) <
+      rclcpp::Time(twist_msg->header.stamp) - rclcpp::Duration::from_seconds(1.0)) {
+      twist_queue_.pop_front();
+    }
+    break;
+  }
+}
+
+void DistortionCorrector::processIMUMessage(
+  const sensor_msgs::msg::Imu::ConstSharedPtr & imu_msg,
+  const tf2::Transform & tf2_imu_link_to_base_link)
+{
+  geometry_msgs::msg::TransformStamped::SharedPtr tf_base2imu_ptr =
+    std::make_shared<geometry_msgs::msg::TransformStamped>();
+  tf_base2imu_ptr->transform.rotation = tf2::toMsg(tf2_imu_link_to_base_link.getRotation());
+
+  geometry_msgs::msg::Vector3Stamped angular_velocity;
+  angular_velocity.vector = imu_msg->angular_velocity;
+
+  geometry_msgs::msg::Vector3Stamped transformed_angular_velocity;
+  tf2::doTransform(angular_velocity, transformed_angular_velocity, *tf_base2imu_ptr);
+  transformed_angular_velocity.header = imu_msg->header;
+  angular_velocity_queue_.push_back(transformed_angular_velocity);
+
+  while (!angular_velocity_queue_.empty()) {
+    // for replay rosbag
+    if (
+      rclcpp::Time(angular_velocity_queue_.front().header.stamp) >
+      rclcpp::Time(imu_msg->header.stamp)) {
+      angular_velocity_queue_.pop_front();
+    } else if (  // NOLINT
+      rclcpp::Time(angular_velocity_queue_.front().header.stamp) <
+      rclcpp::Time(imu_msg->header.stamp) - rclcpp::Duration::from_seconds(1.0)) {
+      angular_velocity_queue_.pop_front();
+    }
+    break;
+  }
+}
+
+bool DistortionCorrector::undistortPointCloud(
+  const tf2::Transform & tf2_base_link_to_sensor, PointCloud2 & points)
+{
+  if (param_.use_vectorized_undistortion) {
+    return undistortPointCloudVectorized(tf2_base_link_to_sensor, points);
+  }
+  return undistortPointCloudPerPoint(tf2_base_link_to_sensor, points);
+}
+
+bool DistortionCorrector::undistortPointCloudPerPoint(
   const tf2::Transform & tf2_base_link_to_sensor, PointCloud2 & points)
 {
   if (points.data.empty() || twist_queue_.empty()) {
     RCLCPP_WARN_STREAM_THROTTLE(
-      get_logger(), *get_clock(), 10000 /* ms */,
+      logger_, *clock_, 10000 /* ms */,
       "input_pointcloud->points or twist_queue_ is empty.");
     return false;
   }
@@ -190,11 +234,11 @@ bool DistortionCorrectorComponent::undistortPointCloud(
   auto time_stamp_field_it = std::find_if(
     std::cbegin(points.fields), std::cend(points.fields),
     [this](const sensor_msgs::msg::PointField & field) {
-      return field.name == time_stamp_field_name_;
+      return field.name == param_.time_stamp_field_name;
     });
   if (time_stamp_field_it == points.fields.cend()) {
     RCLCPP_WARN_STREAM_THROTTLE(
-      get_logger(), *get_clock(), 10000 /* ms */,
+      logger_, *clock_, 10000 /* ms */,
       "Required field time stamp doesn't exist in the point cloud.");
     return false;
   }
@@ -202,7 +246,7 @@ bool DistortionCorrectorComponent::undistortPointCloud(
   sensor_msgs::PointCloud2Iterator<float> it_x(points, "x");
   sensor_msgs::PointCloud2Iterator<float> it_y(points, "y");
   sensor_msgs::PointCloud2Iterator<float> it_z(points, "z");
-  sensor_msgs::PointCloud2ConstIterator<double> it_time_stamp(points, time_stamp_field_name_);
+  sensor_msgs::PointCloud2ConstIterator<double> it_time_stamp(points, param_.time_stamp_field_name);
 
   float theta{0.0f};
   float x{0.0f};
@@ -218,7 +262,7 @@ bool DistortionCorrectorComponent::undistortPointCloud(
   twist_it = twist_it == std::end(twist_queue_) ? std::end(twist_queue_) - 1 : twist_it;
 
   decltype(angular_velocity_queue_)::iterator imu_it;
-  if (use_imu_ && !angular_velocity_queue_.empty()) {
+  if (param_.use_imu && !angular_velocity_queue_.empty()) {
     imu_it = std::lower_bound(
       std::begin(angular_velocity_queue_), std::end(angular_velocity_queue_),
       first_point_time_stamp_sec, [](const geometry_msgs::msg::Vector3Stamped & x, const double t) {
@@ -240,11 +284,11 @@ bool DistortionCorrectorComponent::undistortPointCloud(
   tf2::Vector3 undistorted_point{};
 
   // For performance, avoid transform computation if unnecessary
-  bool need_transform = points.header.frame_id != base_link_frame_;
+  bool need_transform = points.header.frame_id != param_.base_link_frame;
 
   // For performance, do not instantiate `rclcpp::Time` inside of the for-loop
   double imu_stamp{0.0};
-  if (use_imu_ && !angular_velocity_queue_.empty()) {
+  if (param_.use_imu && !angular_velocity_queue_.empty()) {
     imu_stamp = rclcpp::Time(imu_it->header.stamp).seconds();
   }
 
@@ -267,7 +311,7 @@ bool DistortionCorrectorComponent::undistortPointCloud(
       w = 0.0f;
     }
 
-    if (use_imu_ && !angular_velocity_queue_.empty()) {
+    if (param_.use_imu && !angular_velocity_queue_.empty()) {
       while (imu_it != std::end(angular_velocity_queue_) - 1 && *it_time_stamp > imu_stamp) {
         ++imu_it;
         imu_stamp = rclcpp::Time(imu_it->header.stamp).seconds();
@@ -314,13 +358,200 @@ bool DistortionCorrectorComponent::undistortPointCloud(
 
   if (twist_time_stamp_is_too_late) {
     RCLCPP_WARN_STREAM_THROTTLE(
-      get_logger(), *get_clock(), 10000 /* ms */,
+      logger_, *clock_, 10000 /* ms */,
+      "twist time_stamp is too late. Could not interpolate.");
+  }
+
+  if (imu_time_stamp_is_too_late) {
+    RCLCPP_WARN_STREAM_THROTTLE(
+      logger_, *clock_, 10000 /* ms */,
+      "imu time_stamp is too late. Could not interpolate.");
+  }
+
+  return true;
+}
+
+bool DistortionCorrector::undistortPointCloudVectorized(
+  const tf2::Transform & tf2_base_link_to_sensor, PointCloud2 & points)
+{
+  if (points.data.empty() || twist_queue_.empty()) {
+    RCLCPP_WARN_STREAM_THROTTLE(
+      logger_, *clock_, 10000 /* ms */,
+      "input_pointcloud->points or twist_queue_ is empty.");
+    return false;
+  }
+
+  auto time_stamp_field_it = std::find_if(
+    std::cbegin(points.fields), std::cend(points.fields),
+    [this](const sensor_msgs::msg::PointField & field) {
+      return field.name == param_.time_stamp_field_name;
+    });
+  if (time_stamp_field_it == points.fields.cend()) {
+    RCLCPP_WARN_STREAM_THROTTLE(
+      logger_, *clock_, 10000 /* ms */,
+      "Required field time stamp doesn't exist in the point cloud.");
+    return false;
+  }
+
+  // resolve the field offsets once, the points are accessed by byte offset in the loop
+  const auto get_field_offset = [&points](const std::string & name) {
+    for (const auto & field : points.fields) {
+      if (field.name == name) {
+        return static_cast<size_t>(field.offset);
+      }
+    }
+    throw std::runtime_error("Field " + name + " does not exist in the point cloud.");
+  };
+  const size_t x_offset = get_field_offset("x");
+  const size_t y_offset = get_field_offset("y");
+  const size_t z_offset = get_field_offset("z");
+  const size_t time_stamp_offset = time_stamp_field_it->offset;
+  const size_t point_step = points.point_step;
+  const size_t num_points = static_cast<size_t>(points.width) * points.height;
+  uint8_t * const data = points.data.data();
+
+  const auto time_stamp_at = [&](const size_t i) {
+    double time_stamp;
+    std::memcpy(&time_stamp, data + i * point_step + time_stamp_offset, sizeof(double));
+    return time_stamp;
+  };
+
+  float theta{0.0f};
+  float x{0.0f};
+  float y{0.0f};
+  const double first_point_time_stamp_sec{time_stamp_at(0)};
+  double prev_time_stamp_sec{first_point_time_stamp_sec};
+
+  auto twist_it = std::lower_bound(
+    std::begin(twist_queue_), std::end(twist_queue_), first_point_time_stamp_sec,
+    [](const geometry_msgs::msg::TwistStamped & x, const double t) {
+      return rclcpp::Time(x.header.stamp).seconds() < t;
+    });
+  twist_it = twist_it == std::end(twist_queue_) ? std::end(twist_queue_) - 1 : twist_it;
+
+  const bool use_imu = param_.use_imu && !angular_velocity_queue_.empty();
+  decltype(angular_velocity_queue_)::iterator imu_it;
+  if (use_imu) {
+    imu_it = std::lower_bound(
+      std::begin(angular_velocity_queue_), std::end(angular_velocity_queue_),
+      first_point_time_stamp_sec, [](const geometry_msgs::msg::Vector3Stamped & x, const double t) {
+        return rclcpp::Time(x.header.stamp).seconds() < t;
+      });
+    imu_it =
+      imu_it == std::end(angular_velocity_queue_) ? std::end(angular_velocity_queue_) - 1 : imu_it;
+  }
+
+  const tf2::Transform tf2_base_link_to_sensor_inv{tf2_base_link_to_sensor.inverse()};
+  const bool need_transform = points.header.frame_id != param_.base_link_frame;
+
+  double twist_stamp = rclcpp::Time(twist_it->header.stamp).seconds();
+  double imu_stamp = use_imu ? rclcpp::Time(imu_it->header.stamp).seconds() : 0.0;
+
+  bool twist_time_stamp_is_too_late = false;
+  bool imu_time_stamp_is_too_late = false;
+
+  // Compute the odometry of the block starting at time_stamp with the same integration as
+  // undistortPointCloud, and convert it into a transform in the sensor frame.
+  const auto compute_block_transform = [&](const double time_stamp) {
+    while (twist_it != std::end(twist_queue_) - 1 && time_stamp > twist_stamp) {
+      ++twist_it;
+      twist_stamp = rclcpp::Time(twist_it->header.stamp).seconds();
+    }
+
+    float v{static_cast<float>(twist_it->twist.linear.x)};
+    float w{static_cast<float>(twist_it->twist.angular.z)};
+
+    if (std::abs(time_stamp - twist_stamp) > 0.1) {
+      twist_time_stamp_is_too_late = true;
+      v = 0.0f;
+      w = 0.0f;
+    }
+
+    if (use_imu) {
+      while (imu_it != std::end(angular_velocity_queue_) - 1 && time_stamp > imu_stamp) {
+        ++imu_it;
+        imu_stamp = rclcpp::Time(imu_it->header.stamp).seconds();
+      }
+
+      if (std::abs(time_stamp - imu_stamp) > 0.1) {
+        imu_time_stamp_is_too_late = true;
+      } else {
+        w = static_cast<float>(imu_it->vector.z);
+      }
+    }
+
+    const auto time_offset = static_cast<float>(time_stamp - prev_time_stamp_sec);
+    theta += w * time_offset;
+    const float dis = v * time_offset;
+    x += dis * tier4_autoware_utils::cos(theta);
+    y += dis * tier4_autoware_utils::sin(theta);
+    prev_time_stamp_sec = time_stamp;
+
+    tf2::Transform baselink_tf_odom{};
+    baselink_tf_odom.setOrigin(tf2::Vector3(x, y, 0.0));
+    baselink_tf_odom.setRotation(tf2::Quaternion(
+      0, 0, tier4_autoware_utils::sin(theta * 0.5f), tier4_autoware_utils::cos(theta * 0.5f)));
+    if (need_transform) {
+      baselink_tf_odom = tf2_base_link_to_sensor * baselink_tf_odom * tf2_base_link_to_sensor_inv;
+    }
+
+    undistortion::AffineTransform3f block_transform;
+    const auto & basis = baselink_tf_odom.getBasis();
+    for (int row = 0; row < 3; ++row) {
+      for (int col = 0; col < 3; ++col) {
+        block_transform.rotation[row * 3 + col] = static_cast<float>(basis[row][col]);
+      }
+      block_transform.translation[row] = static_cast<float>(baselink_tf_odom.getOrigin()[row]);
+    }
+    return block_transform;
+  };
+
+  // Points of the same block share one transform and are processed in SoA batches
+  std::array<float, undistortion::kBatchSize> batch_x{};
+  std::array<float, undistortion::kBatchSize> batch_y{};
+  std::array<float, undistortion::kBatchSize> batch_z{};
+
+  size_t block_begin = 0;
+  while (block_begin < num_points) {
+    const double block_time_stamp = time_stamp_at(block_begin);
+    const auto block_transform = compute_block_transform(block_time_stamp);
+
+    size_t block_end = block_begin + 1;
+    while (block_end < num_points &&
+           time_stamp_at(block_end) - block_time_stamp <= param_.undistortion_block_time_sec) {
+      ++block_end;
+    }
+
+    for (size_t batch_begin = block_begin; batch_begin < block_end;
+         batch_begin += undistortion::kBatchSize) {
+      const size_t batch_size = std::min(undistortion::kBatchSize, block_end - batch_begin);
+      for (size_t i = 0; i < batch_size; ++i) {
+        const uint8_t * point = data + (batch_begin + i) * point_step;
+        std::memcpy(&batch_x[i], point + x_offset, sizeof(float));
+        std::memcpy(&batch_y[i], point + y_offset, sizeof(float));
+        std::memcpy(&batch_z[i], point + z_offset, sizeof(float));
+      }
+      undistortion::transformPoints(
+        block_transform, batch_x.data(), batch_y.data(), batch_z.data(), batch_size);
+      for (size_t i = 0; i < batch_size; ++i) {
+        uint8_t * point = data + (batch_begin + i) * point_step;
+        std::memcpy(point + x_offset, &batch_x[i], sizeof(float));
+        std::memcpy(point + y_offset, &batch_y[i], sizeof(float));
+        std::memcpy(point + z_offset, &batch_z[i], sizeof(float));
+      }
+    }
+    block_begin = block_end;
+  }
+
+  if (twist_time_stamp_is_too_late) {
+    RCLCPP_WARN_STREAM_THROTTLE(
+      logger_, *clock_, 10000 /* ms */,
       "twist time_stamp is too late. Could not interpolate.");
   }
 
   if (imu_time_stamp_is_too_late) {
     RCLCPP_WARN_STREAM_THROTTLE(
-      get_logger(), *get_clock(), 10000 /* ms */,
+      logger_, *clock_, 10000 /* ms */,
       "imu time_stamp is too late. Could not interpolate.");
   }
 
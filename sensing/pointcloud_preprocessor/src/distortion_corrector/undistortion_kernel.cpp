@@ -0,0 +1,160 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/distortion_corrector/undistortion_kernel.hpp"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace pointcloud_preprocessor::undistortion
+{
+namespace
+{
+inline void transformPointsTail(
+  const AffineTransform3f & transform, float * x, float * y, float * z, size_t begin,
+  const size_t size)
+{
+  const float * r = transform.rotation;
+  const float * t = transform.translation;
+  for (; begin < size; ++begin) {
+    const float px = x[begin];
+    const float py = y[begin];
+    const float pz = z[begin];
+    x[begin] = r[0] * px + r[1] * py + r[2] * pz + t[0];
+    y[begin] = r[3] * px + r[4] * py + r[5] * pz + t[1];
+    z[begin] = r[6] * px + r[7] * py + r[8] * pz + t[2];
+  }
+}
+}  // namespace
+
+void transformPointsScalar(
+  const AffineTransform3f & transform, float * x, float * y, float * z, const size_t size)
+{
+  transformPointsTail(transform, x, y, z, 0, size);
+}
+
+#if defined(__AVX2__)
+void transformPoints(
+  const AffineTransform3f & transform, float * x, float * y, float * z, const size_t size)
+{
+  const float * r = transform.rotation;
+  const float * t = transform.translation;
+  const __m256 r0 = _mm256_set1_ps(r[0]), r1 = _mm256_set1_ps(r[1]), r2 = _mm256_set1_ps(r[2]);
+  const __m256 r3 = _mm256_set1_ps(r[3]), r4 = _mm256_set1_ps(r[4]), r5 = _mm256_set1_ps(r[5]);
+  const __m256 r6 = _mm256_set1_ps(r[6]), r7 = _mm256_set1_ps(r[7]), r8 = _mm256_set1_ps(r[8]);
+  const __m256 t0 = _mm256_set1_ps(t[0]), t1 = _mm256_set1_ps(t[1]), t2 = _mm256_set1_ps(t[2]);
+
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m256 px = _mm256_loadu_ps(x + i);
+    const __m256 py = _mm256_loadu_ps(y + i);
+    const __m256 pz = _mm256_loadu_ps(z + i);
+    const __m256 qx = _mm256_add_ps(
+      _mm256_add_ps(_mm256_mul_ps(r0, px), _mm256_mul_ps(r1, py)),
+      _mm256_add_ps(_mm256_mul_ps(r2, pz), t0));
+    const __m256 qy = _mm256_add_ps(
+      _mm256_add_ps(_mm256_mul_ps(r3, px), _mm256_mul_ps(r4, py)),
+      _mm256_add_ps(_mm256_mul_ps(r5, pz), t1));
+    const __m256 qz = _mm256_add_ps(
+      _mm256_add_ps(_mm256_mul_ps(r6, px), _mm256_mul_ps(r7, py)),
+      _mm256_add_ps(_mm256_mul_ps(r8, pz), t2));
+    _mm256_storeu_ps(x + i, qx);
+    _mm256_storeu_ps(y + i, qy);
+    _mm256_storeu_ps(z + i, qz);
+  }
+  transformPointsTail(transform, x, y, z, i, size);
+}
+
+const char * instructionSet()
+{
+  return "AVX2";
+}
+#elif defined(__SSE2__)
+void transformPoints(
+  const AffineTransform3f & transform, float * x, float * y, float * z, const size_t size)
+{
+  const float * r = transform.rotation;
+  const float * t = transform.translation;
+  const __m128 r0 = _mm_set1_ps(r[0]), r1 = _mm_set1_ps(r[1]), r2 = _mm_set1_ps(r[2]);
+  const __m128 r3 = _mm_set1_ps(r[3]), r4 = _mm_set1_ps(r[4]), r5 = _mm_set1_ps(r[5]);
+  const __m128 r6 = _mm_set1_ps(r[6]), r7 = _mm_set1_ps(r[7]), r8 = _mm_set1_ps(r[8]);
+  const __m128 t0 = _mm_set1_ps(t[0]), t1 = _mm_set1_ps(t[1]), t2 = _mm_set1_ps(t[2]);
+
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    const __m128 px = _mm_loadu_ps(x + i);
+    const __m128 py = _mm_loadu_ps(y + i);
+    const __m128 pz = _mm_loadu_ps(z + i);
+    const __m128 qx = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(r0, px), _mm_mul_ps(r1, py)), _mm_add_ps(_mm_mul_ps(r2, pz), t0));
+    const __m128 qy = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(r3, px), _mm_mul_ps(r4, py)), _mm_add_ps(_mm_mul_ps(r5, pz), t1));
+    const __m128 qz = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(r6, px), _mm_mul_ps(r7, py)), _mm_add_ps(_mm_mul_ps(r8, pz), t2));
+    _mm_storeu_ps(x + i, qx);
+    _mm_storeu_ps(y + i, qy);
+    _mm_storeu_ps(z + i, qz);
+  }
+  transformPointsTail(transform, x, y, z, i, size);
+}
+
+const char * instructionSet()
+{
+  return "SSE2";
+}
+#elif defined(__ARM_NEON)
+void transformPoints(
+  const AffineTransform3f & transform, float * x, float * y, float * z, const size_t size)
+{
+  const float * r = transform.rotation;
+  const float * t = transform.translation;
+  const float32x4_t t0 = vdupq_n_f32(t[0]);
+  const float32x4_t t1 = vdupq_n_f32(t[1]);
+  const float32x4_t t2 = vdupq_n_f32(t[2]);
+
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    const float32x4_t px = vld1q_f32(x + i);
+    const float32x4_t py = vld1q_f32(y + i);
+    const float32x4_t pz = vld1q_f32(z + i);
+    const float32x4_t qx = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(t0, px, r[0]), py, r[1]), pz, r[2]);
+    const float32x4_t qy = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(t1, px, r[3]), py, r[4]), pz, r[5]);
+    const float32x4_t qz = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(t2, px, r[6]), py, r[7]), pz, r[8]);
+    vst1q_f32(x + i, qx);
+    vst1q_f32(y + i, qy);
+    vst1q_f32(z + i, qz);
+  }
+  transformPointsTail(transform, x, y, z, i, size);
+}
+
+const char * instructionSet()
+{
+  return "NEON";
+}
+#else
+void transformPoints(
+  const AffineTransform3f & transform, float * x, float * y, float * z, const size_t size)
+{
+  transformPointsTail(transform, x, y, z, 0, size);
+}
+
+const char * instructionSet()
+{
+  return "scalar";
+}
+#endif
+}  // namespace pointcloud_preprocessor::undistortion
@@ -14,14 +14,42 @@
 
 #include "pointcloud_preprocessor/downsample_filter/faster_voxel_grid_downsample_filter.hpp"
 
+#include "robin_hood.h"
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <utility>
+#include <vector>
+
 namespace pointcloud_preprocessor
 {
 
+namespace
+{
+constexpr uint32_t invalid_voxel_index = std::numeric_limits<uint32_t>::max();
+}  // namespace
+
+struct FasterVoxelGridDownsampleFilter::VoxelShard
+{
+  robin_hood::unordered_flat_map<uint32_t, Centroid> voxel_centroid_map;
+  // bounds of the points in the range of this shard
+  Eigen::Vector3f min_point;
+  Eigen::Vector3f max_point;
+  // index of the first centroid of this shard in the output
+  size_t output_offset = 0;
+  size_t dropped_point_count = 0;
+};
+
 FasterVoxelGridDownsampleFilter::FasterVoxelGridDownsampleFilter()
 {
   offset_initialized_ = false;
+  max_voxel_count_ = 0;
+  set_num_threads(1);
 }
 
+FasterVoxelGridDownsampleFilter::~FasterVoxelGridDownsampleFilter() = default;
+
 void FasterVoxelGridDownsampleFilter::set_voxel_size(
   float voxel_size_x, float voxel_size_y, float voxel_size_z)
 {
@@ -29,6 +57,36 @@ void FasterVoxelGridDownsampleFilter::set_voxel_size(
     Eigen::Array3f::Ones() / Eigen::Array3f(voxel_size_x, voxel_size_y, voxel_size_z);
 }
 
+void FasterVoxelGridDownsampleFilter::set_num_threads(size_t num_threads)
+{
+  num_threads = std::max<size_t>(num_threads, 1);
+  if (num_threads == voxel_shards_.size()) {
+    return;
+  }
+
+  worker_pool_ = num_threads > 1 ? std::make_unique<utils::WorkerPool>(num_threads) : nullptr;
+  voxel_shards_.clear();
+  for (size_t i = 0; i < num_threads; ++i) {
+    voxel_shards_.push_back(std::make_unique<VoxelShard>());
+  }
+  set_max_voxel_count(max_voxel_count_);
+}
+
+void FasterVoxelGridDownsampleFilter::set_max_voxel_count(size_t max_voxel_count)
+{
+  max_voxel_count_ = max_voxel_count;
+  if (max_voxel_count_ == 0) {
+    return;
+  }
+
+  // allocate the bounded maps up front so that they never grow
+  const size_t max_voxel_count_per_shard =
+    (max_voxel_count_ + voxel_shards_.size() - 1) / voxel_shards_.size();
+  for (auto & shard : voxel_shards_) {
+    shard->voxel_centroid_map.reserve(max_voxel_count_per_shard);
+  }
+}
+
 void FasterVoxelGridDownsampleFilter::set_field_offsets(const PointCloud2ConstPtr & input)
 {
   x_offset_ = input->fields[pcl::getFieldIndex(*input, "x")].offset;
@@ -43,6 +101,30 @@ void FasterVoxelGridDownsampleFilter::set_field_offsets(const PointCloud2ConstPt
   offset_initialized_ = true;
 }
 
+template <class F>
+void FasterVoxelGridDownsampleFilter::run_tasks(size_t num_tasks, F && func)
+{
+  if (!worker_pool_ || num_tasks < 2) {
+    for (size_t task_index = 0; task_index < num_tasks; ++task_index) {
+      func(task_index);
+    }
+    return;
+  }
+
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_tasks);
+  for (size_t task_index = 0; task_index < num_tasks; ++task_index) {
+    futures.push_back(worker_pool_->enqueue([&func, task_index]() { func(task_index); }));
+  }
+  // wait for every task before rethrowing, since the tasks refer to the caller's stack
+  for (auto & future : futures) {
+    future.wait();
+  }
+  for (auto & future : futures) {
+    future.get();
+  }
+}
+
 void FasterVoxelGridDownsampleFilter::filter(
   const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info,
   const rclcpp::Logger & logger)
@@ -64,12 +146,23 @@ void FasterVoxelGridDownsampleFilter::filter(
   }
 
   // Storage for mapping voxel coordinates to centroids
-  auto voxel_centroid_map = calc_centroids_each_voxel(input, max_voxel, min_voxel);
+  calc_voxel_index_each_point(input, max_voxel, min_voxel);
+  const size_t voxel_count = calc_centroids_each_voxel(input);
+
+  size_t dropped_point_count = 0;
+  for (const auto & shard : voxel_shards_) {
+    dropped_point_count += shard->dropped_point_count;
+  }
+  if (dropped_point_count > 0) {
+    RCLCPP_WARN(
+      logger, "The number of voxels exceeds max_voxel_count (%zu). %zu points have been dropped.",
+      max_voxel_count_, dropped_point_count);
+  }
 
   // Initialize the output
-  output.row_step = voxel_centroid_map.size() * input->point_step;
+  output.row_step = voxel_count * input->point_step;
   output.data.resize(output.row_step);
-  output.width = voxel_centroid_map.size();
+  output.width = voxel_count;
   output.fields = input->fields;
   output.is_dense = true;  // we filter out invalid points
   output.height = input->height;
@@ -78,7 +171,7 @@ void FasterVoxelGridDownsampleFilter::filter(
   output.header = input->header;
 
   // Copy the centroids to the output
-  copy_centroids_to_output(voxel_centroid_map, output, transform_info);
+  copy_centroids_to_output(output, transform_info);
 }
 
 Eigen::Vector4f FasterVoxelGridDownsampleFilter::get_point_from_global_offset(
@@ -100,17 +193,29 @@ Eigen::Vector4f FasterVoxelGridDownsampleFilter::get_point_from_global_offset(
 bool FasterVoxelGridDownsampleFilter::get_min_max_voxel(
   const PointCloud2ConstPtr & input, Eigen::Vector3i & min_voxel, Eigen::Vector3i & max_voxel)
 {
-  // Compute the minimum and maximum point coordinates
+  // Compute the minimum and maximum point coordinates, one contiguous range of points per shard
+  const size_t num_points = input->data.size() / input->point_step;
+  const size_t num_tasks = voxel_shards_.size();
+  run_tasks(num_tasks, [&](const size_t task_index) {
+    auto & shard = *voxel_shards_[task_index];
+    shard.min_point.setConstant(FLT_MAX);
+    shard.max_point.setConstant(-FLT_MAX);
+    const size_t end = num_points * (task_index + 1) / num_tasks;
+    for (size_t i = num_points * task_index / num_tasks; i < end; ++i) {
+      Eigen::Vector4f point = get_point_from_global_offset(input, i * input->point_step);
+      if (std::isfinite(point[0]) && std::isfinite(point[1]) && std::isfinite(point[2])) {
+        shard.min_point = shard.min_point.cwiseMin(point.head<3>());
+        shard.max_point = shard.max_point.cwiseMax(point.head<3>());
+      }
+    }
+  });
+
   Eigen::Vector3f min_point, max_point;
   min_point.setConstant(FLT_MAX);
   max_point.setConstant(-FLT_MAX);
-  for (size_t global_offset = 0; global_offset + input->point_step <= input->data.size();
-       global_offset += input->point_step) {
-    Eigen::Vector4f point = get_point_from_global_offset(input, global_offset);
-    if (std::isfinite(point[0]) && std::isfinite(point[1]), std::isfinite(point[2])) {
-      min_point = min_point.cwiseMin(point.head<3>());
-      max_point = max_point.cwiseMax(point.head<3>());
-    }
+  for (const auto & shard : voxel_shards_) {
+    min_point = min_point.cwiseMin(shard->min_point);
+    max_point = max_point.cwiseMax(shard->max_point);
   }
 
   // Check that the voxel size is not too small, given the size of the data
@@ -133,55 +238,99 @@ bool FasterVoxelGridDownsampleFilter::get_min_max_voxel(
   return true;
 }
 
-std::unordered_map<uint32_t, FasterVoxelGridDownsampleFilter::Centroid>
-FasterVoxelGridDownsampleFilter::calc_centroids_each_voxel(
+void FasterVoxelGridDownsampleFilter::calc_voxel_index_each_point(
   const PointCloud2ConstPtr & input, const Eigen::Vector3i & max_voxel,
   const Eigen::Vector3i & min_voxel)
 {
-  std::unordered_map<uint32_t, Centroid> voxel_centroid_map;
   // Compute the number of divisions needed along all axis
   Eigen::Vector3i div_b = max_voxel - min_voxel + Eigen::Vector3i::Ones();
   // Set up the division multiplier
   Eigen::Vector3i div_b_mul(1, div_b[0], div_b[0] * div_b[1]);
 
-  for (size_t global_offset = 0; global_offset + input->point_step <= input->data.size();
-       global_offset += input->point_step) {
-    Eigen::Vector4f point = get_point_from_global_offset(input, global_offset);
-    if (std::isfinite(point[0]) && std::isfinite(point[1]), std::isfinite(point[2])) {
+  // does not reallocate once the capacity has grown to the size of the inputs
+  const size_t num_points = input->data.size() / input->point_step;
+  voxel_indices_.resize(num_points);
+
+  const size_t num_tasks = voxel_shards_.size();
+  run_tasks(num_tasks, [&](const size_t task_index) {
+    const size_t end = num_points * (task_index + 1) / num_tasks;
+    for (size_t i = num_points * task_index / num_tasks; i < end; ++i) {
+      Eigen::Vector4f point = get_point_from_global_offset(input, i * input->point_step);
+      if (!std::isfinite(point[0]) || !std::isfinite(point[1]) || !std::isfinite(point[2])) {
+        voxel_indices_[i] = invalid_voxel_index;
+        continue;
+      }
       // Calculate the voxel index to which the point belongs
       int ijk0 = static_cast<int>(std::floor(point[0] * inverse_voxel_size_[0]) - min_voxel[0]);
       int ijk1 = static_cast<int>(std::floor(point[1] * inverse_voxel_size_[1]) - min_voxel[1]);
       int ijk2 = static_cast<int>(std::floor(point[2] * inverse_voxel_size_[2]) - min_voxel[2]);
-      uint32_t voxel_id = ijk0 * div_b_mul[0] + ijk1 * div_b_mul[1] + ijk2 * div_b_mul[2];
+      voxel_indices_[i] = ijk0 * div_b_mul[0] + ijk1 * div_b_mul[1] + ijk2 * div_b_mul[2];
+    }
+  });
+}
+
+size_t FasterVoxelGridDownsampleFilter::calc_centroids_each_voxel(
+  const PointCloud2ConstPtr & input)
+{
+  const size_t num_shards = voxel_shards_.size();
+  const size_t max_voxel_count_per_shard = max_voxel_count_ == 0
+                                             ? std::numeric_limits<size_t>::max()
+                                             : (max_voxel_count_ + num_shards - 1) / num_shards;
+
+  // each shard owns the voxels whose index is congruent to the shard index, so that the shards
+  // never share a voxel and need no merge other than concatenation
+  run_tasks(num_shards, [&](const size_t shard_index) {
+    auto & shard = *voxel_shards_[shard_index];
+    auto & voxel_centroid_map = shard.voxel_centroid_map;
+    voxel_centroid_map.clear();
+    shard.dropped_point_count = 0;
+
+    for (size_t i = 0; i < voxel_indices_.size(); ++i) {
+      const uint32_t voxel_index = voxel_indices_[i];
+      if (voxel_index == invalid_voxel_index || voxel_index % num_shards != shard_index) {
+        continue;
+      }
 
       // Add the point to the corresponding centroid
-      if (voxel_centroid_map.find(voxel_id) == voxel_centroid_map.end()) {
-        voxel_centroid_map[voxel_id] = Centroid(point[0], point[1], point[2], point[3]);
+      Eigen::Vector4f point = get_point_from_global_offset(input, i * input->point_step);
+      auto centroid_it = voxel_centroid_map.find(voxel_index);
+      if (centroid_it != voxel_centroid_map.end()) {
+        centroid_it->second.add_point(point[0], point[1], point[2], point[3]);
+      } else if (voxel_centroid_map.size() < max_voxel_count_per_shard) {
+        voxel_centroid_map.emplace(voxel_index, Centroid(point[0], point[1], point[2], point[3]));
       } else {
-        voxel_centroid_map[voxel_id].add_point(point[0], point[1], point[2], point[3]);
+        shard.dropped_point_count++;
       }
     }
-  }
+  });
 
-  return voxel_centroid_map;
+  size_t voxel_count = 0;
+  for (auto & shard : voxel_shards_) {
+    shard->output_offset = voxel_count;
+    voxel_count += shard->voxel_centroid_map.size();
+  }
+  return voxel_count;
 }
 
 void FasterVoxelGridDownsampleFilter::copy_centroids_to_output(
-  std::unordered_map<uint32_t, Centroid> & voxel_centroid_map, PointCloud2 & output,
-  const TransformInfo & transform_info)
+  PointCloud2 & output, const TransformInfo & transform_info)
 {
-  size_t output_data_size = 0;
-  for (const auto & pair : voxel_centroid_map) {
-    Eigen::Vector4f centroid = pair.second.calc_centroid();
-    if (transform_info.need_transform) {
-      centroid = transform_info.eigen_transform * centroid;
+  run_tasks(voxel_shards_.size(), [&](const size_t shard_index) {
+    const auto & shard = *voxel_shards_[shard_index];
+    size_t output_data_size = shard.output_offset * output.point_step;
+    for (const auto & pair : shard.voxel_centroid_map) {
+      Eigen::Vector4f centroid = pair.second.calc_centroid();
+      if (transform_info.need_transform) {
+        centroid = transform_info.eigen_transform * centroid;
+      }
+      *reinterpret_cast<float *>(&output.data[output_data_size + x_offset_]) = centroid[0];
+      *reinterpret_cast<float *>(&output.data[output_data_size + y_offset_]) = centroid[1];
+      *reinterpret_cast<float *>(&output.data[output_data_size + z_offset_]) = centroid[2];
+      *reinterpret_cast<float *>(&output.data[output_data_size + intensity_offset_]) =
+        centroid[3];
+      output_data_size += output.point_step;
     }
-    *reinterpret_cast<float *>(&output.data[output_data_size + x_offset_]) = centroid[0];
-    *reinterpret_cast<float *>(&output.data[output_data_size + y_offset_]) = centroid[1];
-    *reinterpret_cast<float *>(&output.data[output_data_size + z_offset_]) = centroid[2];
-    *reinterpret_cast<float *>(&output.data[output_data_size + intensity_offset_]) = centroid[3];
-    output_data_size += output.point_step;
-  }
+  });
 }
 
 }  // namespace pointcloud_preprocessor
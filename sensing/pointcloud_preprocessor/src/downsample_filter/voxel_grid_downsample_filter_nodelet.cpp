@@ -56,6 +56,7 @@
 #include <pcl/search/kdtree.h>
 #include <pcl/segmentation/segment_differences.h>
 
+#include <algorithm>
 #include <vector>
 
 namespace pointcloud_preprocessor
@@ -69,6 +70,8 @@ VoxelGridDownsampleFilterComponent::VoxelGridDownsampleFilterComponent(
     voxel_size_x_ = static_cast<float>(declare_parameter("voxel_size_x", 0.3));
     voxel_size_y_ = static_cast<float>(declare_parameter("voxel_size_y", 0.3));
     voxel_size_z_ = static_cast<float>(declare_parameter("voxel_size_z", 0.1));
+    num_threads_ = static_cast<int>(declare_parameter("num_threads", 1));
+    max_voxel_count_ = static_cast<int>(declare_parameter("max_voxel_count", 0));
   }
 
   using std::placeholders::_1;
@@ -106,10 +109,11 @@ void VoxelGridDownsampleFilterComponent::faster_filter(
   PointCloud2 & output, const TransformInfo & transform_info)
 {
   std::scoped_lock lock(mutex_);
-  FasterVoxelGridDownsampleFilter faster_voxel_filter;
-  faster_voxel_filter.set_voxel_size(voxel_size_x_, voxel_size_y_, voxel_size_z_);
-  faster_voxel_filter.set_field_offsets(input);
-  faster_voxel_filter.filter(input, output, transform_info, this->get_logger());
+  faster_voxel_filter_.set_voxel_size(voxel_size_x_, voxel_size_y_, voxel_size_z_);
+  faster_voxel_filter_.set_num_threads(static_cast<size_t>(std::max(num_threads_, 1)));
+  faster_voxel_filter_.set_max_voxel_count(static_cast<size_t>(std::max(max_voxel_count_, 0)));
+  faster_voxel_filter_.set_field_offsets(input);
+  faster_voxel_filter_.filter(input, output, transform_info, this->get_logger());
 }
 
 rcl_interfaces::msg::SetParametersResult VoxelGridDownsampleFilterComponent::paramCallback(
@@ -126,6 +130,12 @@ rcl_interfaces::msg::SetParametersResult VoxelGridDownsampleFilterComponent::par
   if (get_param(p, "voxel_size_z", voxel_size_z_)) {
     RCLCPP_DEBUG(get_logger(), "Setting new distance threshold to: %f.", voxel_size_z_);
   }
+  if (get_param(p, "num_threads", num_threads_)) {
+    RCLCPP_DEBUG(get_logger(), "Setting new num_threads to: %d.", num_threads_);
+  }
+  if (get_param(p, "max_voxel_count", max_voxel_count_)) {
+    RCLCPP_DEBUG(get_logger(), "Setting new max_voxel_count to: %d.", max_voxel_count_);
+  }
 
   rcl_interfaces::msg::SetParametersResult result;
   result.successful = true;
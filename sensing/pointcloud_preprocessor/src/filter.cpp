@@ -52,6 +52,7 @@
 #include "pointcloud_preprocessor/filter.hpp"
 
 #include <pcl_ros/transforms.hpp>
+#include <tier4_autoware_utils/ros/loaned_message_publisher.hpp>
 
 #include <pcl/io/io.h>
 
@@ -192,7 +193,7 @@ void pointcloud_preprocessor::Filter::computePublish(
   output->header.stamp = input->header.stamp;
 
   // Publish a boost shared ptr
-  pub_output_->publish(std::move(output));
+  tier4_autoware_utils::publishLoanedOrMoved(pub_output_, std::move(output));
   published_time_publisher_->publish_if_subscribed(pub_output_, input->header.stamp);
 }
 
@@ -457,7 +458,7 @@ void pointcloud_preprocessor::Filter::faster_input_indices_callback(
   if (!convert_output_costly(output)) return;
 
   output->header.stamp = cloud->header.stamp;
-  pub_output_->publish(std::move(output));
+  tier4_autoware_utils::publishLoanedOrMoved(pub_output_, std::move(output));
   published_time_publisher_->publish_if_subscribed(pub_output_, cloud->header.stamp);
 }
 
@@ -0,0 +1,429 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/fused_preprocessor/fused_preprocessor_nodelet.hpp"
+
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+
+FusedPreprocessorComponent::FusedPreprocessorComponent(const rclcpp::NodeOptions & options)
+: Node("fused_preprocessor_node", options)
+{
+  // initialize debug tool
+  {
+    using tier4_autoware_utils::DebugPublisher;
+    using tier4_autoware_utils::StopWatch;
+    stop_watch_ptr_ = std::make_unique<StopWatch<std::chrono::milliseconds>>();
+    debug_publisher_ = std::make_unique<DebugPublisher>(this, "fused_preprocessor");
+    stop_watch_ptr_->tic("cyclic_time");
+    stop_watch_ptr_->tic("processing_time");
+  }
+
+  // Parameter
+  base_link_frame_ = declare_parameter("base_link_frame", "base_link");
+  publish_intermediate_pointclouds_ = declare_parameter("publish_intermediate_pointclouds", false);
+
+  // crop box: one set of crop box filter parameters per name, applied within the same pass
+  {
+    const auto crop_box_names =
+      declare_parameter("crop_box_names", std::vector<std::string>{"crop_box_filter"});
+    for (const auto & name : crop_box_names) {
+      CropBoxParam p;
+      p.min_x = static_cast<float>(declare_parameter(name + ".min_x", -1.0));
+      p.min_y = static_cast<float>(declare_parameter(name + ".min_y", -1.0));
+      p.min_z = static_cast<float>(declare_parameter(name + ".min_z", -1.0));
+      p.max_x = static_cast<float>(declare_parameter(name + ".max_x", 1.0));
+      p.max_y = static_cast<float>(declare_parameter(name + ".max_y", 1.0));
+      p.max_z = static_cast<float>(declare_parameter(name + ".max_z", 1.0));
+      p.negative = static_cast<bool>(declare_parameter(name + ".negative", false));
+      crop_box_params_.push_back(p);
+    }
+  }
+
+  // distortion corrector
+  {
+    DistortionCorrector::Param param;
+    param.base_link_frame = base_link_frame_;
+    param.time_stamp_field_name =
+      declare_parameter("distortion_corrector.time_stamp_field_name", "time_stamp");
+    param.use_imu = declare_parameter("distortion_corrector.use_imu", true);
+    param.use_vectorized_undistortion =
+      declare_parameter("distortion_corrector.use_vectorized_undistortion", false);
+    param.undistortion_block_time_sec =
+      declare_parameter("distortion_corrector.undistortion_block_time_sec", 0.0001);
+    use_imu_ = param.use_imu;
+    distortion_corrector_ = std::make_unique<DistortionCorrector>(*this, param);
+  }
+
+  // ring outlier filter
+  {
+    use_ring_outlier_filter_ = declare_parameter("use_ring_outlier_filter", true);
+    auto & p = ring_outlier_param_;
+    p.distance_ratio =
+      static_cast<double>(declare_parameter("ring_outlier_filter.distance_ratio", 1.03));
+    p.object_length_threshold =
+      static_cast<double>(declare_parameter("ring_outlier_filter.object_length_threshold", 0.1));
+    p.num_points_threshold =
+      static_cast<int>(declare_parameter("ring_outlier_filter.num_points_threshold", 4));
+    p.max_rings_num =
+      static_cast<uint16_t>(declare_parameter("ring_outlier_filter.max_rings_num", 128));
+    p.max_points_num_per_ring =
+      static_cast<size_t>(declare_parameter("ring_outlier_filter.max_points_num_per_ring", 4000));
+
+    ring2indices_.resize(p.max_rings_num);
+    for (auto & indices : ring2indices_) {
+      indices.reserve(p.max_points_num_per_ring);
+    }
+  }
+
+  // voxel grid downsample filter
+  {
+    use_downsample_filter_ = declare_parameter("use_downsample_filter", true);
+    const auto voxel_size_x =
+      static_cast<float>(declare_parameter("voxel_grid_downsample_filter.voxel_size_x", 0.3));
+    const auto voxel_size_y =
+      static_cast<float>(declare_parameter("voxel_grid_downsample_filter.voxel_size_y", 0.3));
+    const auto voxel_size_z =
+      static_cast<float>(declare_parameter("voxel_grid_downsample_filter.voxel_size_z", 0.1));
+    const auto num_threads =
+      static_cast<int>(declare_parameter("voxel_grid_downsample_filter.num_threads", 1));
+    const auto max_voxel_count =
+      static_cast<int>(declare_parameter("voxel_grid_downsample_filter.max_voxel_count", 0));
+    voxel_grid_filter_.set_voxel_size(voxel_size_x, voxel_size_y, voxel_size_z);
+    voxel_grid_filter_.set_num_threads(static_cast<size_t>(std::max(num_threads, 1)));
+    voxel_grid_filter_.set_max_voxel_count(static_cast<size_t>(std::max(max_voxel_count, 0)));
+  }
+
+  // Publisher
+  output_points_pub_ =
+    this->create_publisher<PointCloud2>("~/output/pointcloud", rclcpp::SensorDataQoS());
+  if (publish_intermediate_pointclouds_) {
+    cropped_points_pub_ = this->create_publisher<PointCloud2>(
+      "~/debug/crop_box_filter/pointcloud", rclcpp::SensorDataQoS());
+    undistorted_points_pub_ = this->create_publisher<PointCloud2>(
+      "~/debug/distortion_corrector/pointcloud", rclcpp::SensorDataQoS());
+    outlier_filtered_points_pub_ = this->create_publisher<PointCloud2>(
+      "~/debug/ring_outlier_filter/pointcloud", rclcpp::SensorDataQoS());
+  }
+
+  // Subscriber
+  twist_sub_ = this->create_subscription<geometry_msgs::msg::TwistWithCovarianceStamped>(
+    "~/input/twist", 10,
+    std::bind(
+      &FusedPreprocessorComponent::onTwistWithCovarianceStamped, this, std::placeholders::_1));
+  imu_sub_ = this->create_subscription<sensor_msgs::msg::Imu>(
+    "~/input/imu", 10,
+    std::bind(&FusedPreprocessorComponent::onImu, this, std::placeholders::_1));
+  input_points_sub_ = this->create_subscription<PointCloud2>(
+    "~/input/pointcloud", rclcpp::SensorDataQoS(),
+    std::bind(&FusedPreprocessorComponent::onPointCloud, this, std::placeholders::_1));
+}
+
+void FusedPreprocessorComponent::onTwistWithCovarianceStamped(
+  const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr twist_msg)
+{
+  distortion_corrector_->processTwistMessage(twist_msg);
+}
+
+void FusedPreprocessorComponent::onImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_msg)
+{
+  if (!use_imu_) {
+    return;
+  }
+
+  tf2::Transform tf2_imu_link_to_base_link{};
+  getTransform(base_link_frame_, imu_msg->header.frame_id, &tf2_imu_link_to_base_link);
+  distortion_corrector_->processIMUMessage(imu_msg, tf2_imu_link_to_base_link);
+}
+
+void FusedPreprocessorComponent::onPointCloud(PointCloud2::UniquePtr points_msg)
+{
+  stop_watch_ptr_->toc("processing_time", true);
+  const auto points_sub_count = output_points_pub_->get_subscription_count() +
+                                output_points_pub_->get_intra_process_subscription_count();
+
+  if (points_sub_count < 1 && !publish_intermediate_pointclouds_) {
+    return;
+  }
+
+  // 1. crop box filter, transforming the points to the base link frame on the way
+  tf2::Transform tf2_sensor_to_base_link{};
+  if (!getTransform(base_link_frame_, points_msg->header.frame_id, &tf2_sensor_to_base_link)) {
+    return;
+  }
+  TransformInfo transform_info;
+  transform_info.need_transform = points_msg->header.frame_id != base_link_frame_;
+  if (transform_info.need_transform) {
+    const auto & basis = tf2_sensor_to_base_link.getBasis();
+    const auto & origin = tf2_sensor_to_base_link.getOrigin();
+    for (int row = 0; row < 3; ++row) {
+      for (int col = 0; col < 3; ++col) {
+        transform_info.eigen_transform(row, col) = static_cast<float>(basis[row][col]);
+      }
+      transform_info.eigen_transform(row, 3) = static_cast<float>(origin[row]);
+    }
+  }
+  cropPointCloud(transform_info, *points_msg);
+  publishIntermediatePointCloud(cropped_points_pub_, *points_msg);
+
+  // 2. distortion corrector, the points are already in the base link frame
+  tf2::Transform tf2_identity{};
+  tf2_identity.setIdentity();
+  distortion_corrector_->undistortPointCloud(tf2_identity, *points_msg);
+  publishIntermediatePointCloud(undistorted_points_pub_, *points_msg);
+
+  // 3. ring outlier filter
+  if (use_ring_outlier_filter_ && filterRingOutlier(*points_msg)) {
+    publishIntermediatePointCloud(outlier_filtered_points_pub_, *points_msg);
+  }
+
+  if (debug_publisher_) {
+    auto pipeline_latency_ms =
+      std::chrono::duration<double, std::milli>(
+        std::chrono::nanoseconds(
+          (this->get_clock()->now() - points_msg->header.stamp).nanoseconds()))
+        .count();
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/pipeline_latency_ms", pipeline_latency_ms);
+  }
+
+  // 4. voxel grid downsample filter, the only stage writing to a new buffer
+  if (use_downsample_filter_) {
+    PointCloud2::ConstSharedPtr filtered_points = std::move(points_msg);
+    auto output = std::make_unique<PointCloud2>();
+    voxel_grid_filter_.set_field_offsets(filtered_points);
+    voxel_grid_filter_.filter(filtered_points, *output, TransformInfo{}, get_logger());
+    output_points_pub_->publish(std::move(output));
+  } else {
+    output_points_pub_->publish(std::move(points_msg));
+  }
+
+  // add processing time for debug
+  if (debug_publisher_) {
+    const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
+    const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/cyclic_time_ms", cyclic_time_ms);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/processing_time_ms", processing_time_ms);
+  }
+}
+
+void FusedPreprocessorComponent::cropPointCloud(
+  const TransformInfo & transform_info, PointCloud2 & points)
+{
+  const auto & offsets = input_field_offsets_cache_.resolve(points);
+  const utils::PointCloud2View<utils::DynamicLayout> view(
+    points, utils::DynamicLayout(offsets, points.point_step));
+
+  // the points are compacted towards the front of the buffer, so the write position never
+  // overtakes the read position
+  size_t output_size = 0;
+  int skipped_count = 0;
+  for (size_t i = 0; i < view.size(); ++i) {
+    Eigen::Vector4f point(view.x(i), view.y(i), view.z(i), 1);
+
+    if (!std::isfinite(point[0]) || !std::isfinite(point[1]) || !std::isfinite(point[2])) {
+      skipped_count++;
+      continue;
+    }
+
+    if (transform_info.need_transform) {
+      point = transform_info.eigen_transform * point;
+    }
+
+    const bool keep_point = std::all_of(
+      crop_box_params_.begin(), crop_box_params_.end(), [&point](const CropBoxParam & p) {
+        const bool point_is_inside = point[2] > p.min_z && point[2] < p.max_z &&
+                                     point[1] > p.min_y && point[1] < p.max_y &&
+                                     point[0] > p.min_x && point[0] < p.max_x;
+        return p.negative != point_is_inside;
+      });
+    if (!keep_point) {
+      continue;
+    }
+
+    if (output_size != i) {
+      std::memcpy(view.point(output_size), view.point(i), points.point_step);
+    }
+    view.set_x(output_size, point[0]);
+    view.set_y(output_size, point[1]);
+    view.set_z(output_size, point[2]);
+    output_size++;
+  }
+
+  if (skipped_count > 0) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 1000, "%d points contained NaN values and have been ignored",
+      skipped_count);
+  }
+
+  points.data.resize(output_size * points.point_step);
+  points.height = 1;
+  points.width = static_cast<uint32_t>(output_size);
+  points.row_step = static_cast<uint32_t>(points.data.size());
+  points.header.frame_id = base_link_frame_;
+}
+
+bool FusedPreprocessorComponent::filterRingOutlier(PointCloud2 & points)
+{
+  const auto & offsets = input_field_offsets_cache_.resolve(points);
+  const utils::PointCloud2View<utils::DynamicLayout> view(
+    points, utils::DynamicLayout(offsets, points.point_step));
+  const auto & layout = view.layout();
+  if (
+    !layout.has_intensity() || !layout.has_ring() || !layout.has_azimuth() ||
+    !layout.has_distance()) {
+    RCLCPP_ERROR_THROTTLE(
+      get_logger(), *get_clock(), 1000,
+      "Input pointcloud does not have the fields of PointXYZIRADRT. Skipping ring outlier filter.");
+    return false;
+  }
+
+  const auto & p = ring_outlier_param_;
+  for (auto & indices : ring2indices_) {
+    indices.clear();
+  }
+  for (size_t i = 0; i < view.size(); ++i) {
+    const uint16_t ring = view.ring(i);
+    if (ring < ring2indices_.size()) {
+      ring2indices_[ring].push_back(static_cast<uint32_t>(i));
+    }
+  }
+
+  const auto is_cluster = [&](const size_t first, const size_t last, const int walk_size) {
+    if (walk_size > p.num_points_threshold) return true;
+
+    const auto x = view.x(first) - view.x(last);
+    const auto y = view.y(first) - view.y(last);
+    const auto z = view.z(first) - view.z(last);
+
+    return x * x + y * y + z * z >= p.object_length_threshold * p.object_length_threshold;
+  };
+
+  // same walks as RingOutlierFilterComponent, marking the inliers instead of copying them
+  is_inlier_.assign(view.size(), 0);
+  const auto mark_walk = [&](const std::vector<uint32_t> & indices, int first, int last) {
+    if (is_cluster(indices[first], indices[last], last - first + 1)) {
+      for (int i = first; i <= last; i++) {
+        is_inlier_[indices[i]] = 1;
+      }
+    }
+  };
+
+  for (const auto & indices : ring2indices_) {
+    if (indices.size() < 2) continue;
+
+    // walk range: [walk_first_idx, walk_last_idx]
+    int walk_first_idx = 0;
+    int walk_last_idx = -1;
+
+    for (size_t idx = 0U; idx < indices.size() - 1; ++idx) {
+      walk_last_idx = idx;
+
+      float azimuth_diff = view.azimuth(indices[idx + 1]) - view.azimuth(indices[idx]);
+      azimuth_diff = azimuth_diff < 0.f ? azimuth_diff + 36000.f : azimuth_diff;
+
+      const float current_distance = view.distance(indices[idx]);
+      const float next_distance = view.distance(indices[idx + 1]);
+
+      if (
+        std::max(current_distance, next_distance) <
+          std::min(current_distance, next_distance) * p.distance_ratio &&
+        azimuth_diff < 100.f) {
+        continue;  // Determined to be included in the same walk
+      }
+
+      mark_walk(indices, walk_first_idx, walk_last_idx);
+      walk_first_idx = idx + 1;
+    }
+
+    if (walk_first_idx > walk_last_idx) continue;
+
+    mark_walk(indices, walk_first_idx, walk_last_idx);
+  }
+
+  // reduce the inliers to PointXYZI in place, which never overtakes the read position since
+  // the input point step is at least sizeof(PointXYZI)
+  size_t output_size = 0;
+  for (size_t i = 0; i < view.size(); ++i) {
+    if (!is_inlier_[i]) continue;
+
+    const std::array<float, 4> point{view.x(i), view.y(i), view.z(i), view.intensity(i)};
+    std::memcpy(&points.data[output_size * sizeof(point)], point.data(), sizeof(point));
+    output_size++;
+  }
+
+  points.height = 1;
+  points.width = static_cast<uint32_t>(output_size);
+  sensor_msgs::PointCloud2Modifier pcd_modifier(points);
+  pcd_modifier.setPointCloud2Fields(
+    4, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1,
+    sensor_msgs::msg::PointField::FLOAT32, "z", 1, sensor_msgs::msg::PointField::FLOAT32,
+    "intensity", 1, sensor_msgs::msg::PointField::FLOAT32);
+  return true;
+}
+
+void FusedPreprocessorComponent::publishIntermediatePointCloud(
+  const rclcpp::Publisher<PointCloud2>::SharedPtr & publisher, const PointCloud2 & points)
+{
+  if (!publisher) {
+    return;
+  }
+  if (publisher->get_subscription_count() + publisher->get_intra_process_subscription_count() > 0) {
+    publisher->publish(points);
+  }
+}
+
+bool FusedPreprocessorComponent::getTransform(
+  const std::string & target_frame, const std::string & source_frame,
+  tf2::Transform * tf2_transform_ptr)
+{
+  if (target_frame == source_frame) {
+    tf2_transform_ptr->setOrigin(tf2::Vector3(0.0, 0.0, 0.0));
+    tf2_transform_ptr->setRotation(tf2::Quaternion(0.0, 0.0, 0.0, 1.0));
+    return true;
+  }
+
+  try {
+    const auto transform_msg =
+      tf2_buffer_.lookupTransform(target_frame, source_frame, tf2::TimePointZero);
+    tf2::convert(transform_msg.transform, *tf2_transform_ptr);
+  } catch (const tf2::TransformException & ex) {
+    RCLCPP_WARN(get_logger(), "%s", ex.what());
+    RCLCPP_ERROR(
+      get_logger(), "Please publish TF %s to %s", target_frame.c_str(), source_frame.c_str());
+
+    tf2_transform_ptr->setOrigin(tf2::Vector3(0.0, 0.0, 0.0));
+    tf2_transform_ptr->setRotation(tf2::Quaternion(0.0, 0.0, 0.0, 1.0));
+    return false;
+  }
+  return true;
+}
+
+}  // namespace pointcloud_preprocessor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(pointcloud_preprocessor::FusedPreprocessorComponent)
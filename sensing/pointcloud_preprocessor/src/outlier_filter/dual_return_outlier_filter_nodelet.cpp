@@ -18,11 +18,10 @@
 
 #include <std_msgs/msg/header.hpp>
 
-#include <pcl/kdtree/kdtree_flann.h>
-#include <pcl/search/kdtree.h>
-#include <pcl/segmentation/segment_differences.h>
-
 #include <algorithm>
+#include <cstring>
+#include <future>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -32,6 +31,29 @@ using autoware_point_types::PointXYZIRADRT;
 using autoware_point_types::ReturnType;
 using diagnostic_msgs::msg::DiagnosticStatus;
 
+namespace
+{
+// copy the points of the indices keeping the layout of the input
+void extractPoints(
+  const sensor_msgs::msg::PointCloud2 & input, const std::vector<size_t> & indices,
+  sensor_msgs::msg::PointCloud2 & output)
+{
+  output.fields = input.fields;
+  output.is_bigendian = input.is_bigendian;
+  output.point_step = input.point_step;
+  output.height = 1;
+  output.width = static_cast<uint32_t>(indices.size());
+  output.row_step = output.width * output.point_step;
+  output.is_dense = input.is_dense;
+  output.data.resize(output.row_step);
+  uint8_t * data = output.data.data();
+  for (const auto index : indices) {
+    std::memcpy(data, input.data.data() + index * input.point_step, input.point_step);
+    data += input.point_step;
+  }
+}
+}  // namespace
+
 DualReturnOutlierFilterComponent::DualReturnOutlierFilterComponent(
   const rclcpp::NodeOptions & options)
 : Filter("DualReturnOutlierFilter", options)
@@ -61,6 +83,10 @@ DualReturnOutlierFilterComponent::DualReturnOutlierFilterComponent(
       static_cast<float>(declare_parameter("visibility_error_threshold", 0.5));
     visibility_warn_threshold_ =
       static_cast<float>(declare_parameter("visibility_warn_threshold", 0.7));
+    const auto num_threads = static_cast<int>(declare_parameter("num_threads", 1));
+    if (num_threads > 1) {
+      worker_pool_ = std::make_unique<utils::WorkerPool>(static_cast<size_t>(num_threads));
+    }
   }
   updater_.setHardwareID("dual_return_outlier_filter");
   updater_.add(
@@ -118,14 +144,24 @@ void DualReturnOutlierFilterComponent::filter(
   if (indices) {
     RCLCPP_WARN(get_logger(), "Indices are not supported and will be ignored");
   }
-  pcl::PointCloud<PointXYZIRADRT>::Ptr pcl_input(new pcl::PointCloud<PointXYZIRADRT>);
-  pcl::fromROSMsg(*input, *pcl_input);
+  const auto & field_offsets = input_field_offsets_cache_.resolve(*input);
+  if (
+    field_offsets.x < 0 || field_offsets.y < 0 || field_offsets.z < 0 || field_offsets.ring < 0 ||
+    field_offsets.azimuth < 0 || field_offsets.distance < 0 || field_offsets.return_type < 0) {
+    RCLCPP_ERROR_THROTTLE(
+      get_logger(), *get_clock(), 1000,
+      "Input pointcloud does not have the fields of PointXYZIRADRT. Skipping.");
+    extractPoints(*input, {}, output);
+    return;
+  }
 
   uint32_t vertical_bins = vertical_bins_;
   uint32_t horizontal_bins = 36;
   float max_azimuth = 36000.0f;
   float min_azimuth = 0.0f;
-  switch (roi_mode_map_[roi_mode_]) {
+  // NOTE: The mode is looked up once, since the rings are filtered in parallel
+  const uint8_t roi_mode = roi_mode_map_[roi_mode_];
+  switch (roi_mode) {
     case 2: {
       max_azimuth = max_azimuth_deg_ * 100.0;
       min_azimuth = min_azimuth_deg_ * 100.0;
@@ -142,180 +178,202 @@ void DualReturnOutlierFilterComponent::filter(
   uint32_t horizontal_resolution =
     static_cast<uint32_t>((max_azimuth - min_azimuth) / horizontal_bins);
 
-  pcl::PointCloud<PointXYZIRADRT>::Ptr pcl_output(new pcl::PointCloud<PointXYZIRADRT>);
-  pcl_output->points.reserve(pcl_input->points.size());
-
-  std::vector<pcl::PointCloud<PointXYZIRADRT>> pcl_input_ring_array;
-  std::vector<pcl::PointCloud<PointXYZIRADRT>> weak_first_pcl_input_ring_array;
-
-  pcl::PointCloud<PointXYZIRADRT>::Ptr noise_output(new pcl::PointCloud<PointXYZIRADRT>);
-  noise_output->points.reserve(pcl_input->points.size());
-  pcl_input_ring_array.resize(
-    vertical_bins);  // TODO(davidw): this is for Pandar 40 only, make dynamic
-  weak_first_pcl_input_ring_array.resize(vertical_bins);
-
-  // Split into 36 x 10 degree bins x 40 lines (TODO: change to dynamic)
-  for (const auto & p : pcl_input->points) {
-    if (p.return_type == ReturnType::DUAL_WEAK_FIRST) {
-      weak_first_pcl_input_ring_array.at(p.ring).push_back(p);
-    } else {
-      pcl_input_ring_array.at(p.ring).push_back(p);
-    }
-  }
-
   float max_azimuth_diff = max_azimuth_diff_;
   cv::Mat frequency_image(cv::Size(horizontal_bins, vertical_bins), CV_8UC1, cv::Scalar(0));
 
-  for (const auto & weak_first_single_ring : weak_first_pcl_input_ring_array) {
-    if (weak_first_single_ring.points.size() < 2) {
-      continue;
+  weak_first_ring_results_.resize(vertical_bins);
+  ring_results_.resize(vertical_bins);
+
+  // Run the jobs of the rings on the worker threads, each of which writes only its own result and
+  // its own row of the frequency image
+  const auto for_each_ring = [&](const auto & filter_ring) {
+    if (!worker_pool_) {
+      for (uint32_t ring_id = 0; ring_id < vertical_bins; ++ring_id) {
+        filter_ring(ring_id);
+      }
+      return;
     }
-    std::vector<float> deleted_azimuths;
-    std::vector<float> deleted_distances;
-    pcl::PointCloud<PointXYZIRADRT> temp_segment;
-
-    bool keep_next = false;
-    uint ring_id = weak_first_single_ring.points.front().ring;
-    for (auto iter = std::begin(weak_first_single_ring) + 1;
-         iter != std::end(weak_first_single_ring) - 1; ++iter) {
-      const float min_dist = std::min(iter->distance, (iter + 1)->distance);
-      const float max_dist = std::max(iter->distance, (iter + 1)->distance);
-      float azimuth_diff = (iter + 1)->azimuth - iter->azimuth;
-      azimuth_diff = azimuth_diff < 0.f ? azimuth_diff + 36000.f : azimuth_diff;
-
-      if (max_dist < min_dist * weak_first_distance_ratio_ && azimuth_diff < max_azimuth_diff) {
-        temp_segment.points.push_back(*iter);
-        keep_next = true;
-      } else if (keep_next) {
-        temp_segment.points.push_back(*iter);
-        keep_next = false;
-        // Analyze segment points here
-      } else {
-        // Log the deleted azimuth and its distance for analysis
-        switch (roi_mode_map_[roi_mode_]) {
-          case 1:  // base_link xyz-ROI
-          {
-            if (
-              iter->x > x_min_ && iter->x < x_max_ && iter->y > y_min_ && iter->y < y_max_ &&
-              iter->z > z_min_ && iter->z < z_max_) {
-              deleted_azimuths.push_back(iter->azimuth < 0.f ? 0.f : iter->azimuth);
-              deleted_distances.push_back(iter->distance);
-              noise_output->points.push_back(*iter);
+    const size_t num_workers = worker_pool_->size();
+    std::vector<std::future<void>> jobs;
+    jobs.reserve(num_workers);
+    for (size_t worker_id = 0; worker_id < num_workers; ++worker_id) {
+      jobs.push_back(worker_pool_->enqueue([&, worker_id]() {
+        for (size_t ring_id = worker_id; ring_id < vertical_bins; ring_id += num_workers) {
+          filter_ring(static_cast<uint32_t>(ring_id));
+        }
+      }));
+    }
+    for (auto & job : jobs) {
+      job.get();
+    }
+  };
+
+  utils::visitPointCloud2<PointXYZIRADRT>(*input, field_offsets, [&](const auto & view) {
+    // Split into 36 x 10 degree bins x vertical_bins lines, by the indices of the points
+    weak_first_ring_index_.build(view, vertical_bins, [&](const size_t i) {
+      return view.return_type(i) == ReturnType::DUAL_WEAK_FIRST;
+    });
+    ring_index_.build(view, vertical_bins, [&](const size_t i) {
+      return view.return_type(i) != ReturnType::DUAL_WEAK_FIRST;
+    });
+
+    for_each_ring([&](const uint32_t ring_id) {
+      auto & result = weak_first_ring_results_.at(ring_id);
+      result.output.clear();
+      result.noise.clear();
+      const size_t ring_size = weak_first_ring_index_.ring_size(ring_id);
+      if (ring_size < 2) {
+        return;
+      }
+      std::vector<float> deleted_azimuths;
+      std::vector<size_t> temp_segment;
+
+      bool keep_next = false;
+      for (size_t k = 1; k + 1 < ring_size; ++k) {
+        const size_t i = weak_first_ring_index_.at(ring_id, k);
+        const size_t next = weak_first_ring_index_.at(ring_id, k + 1);
+        const float distance = view.distance(i);
+        const float azimuth = view.azimuth(i);
+        const float min_dist = std::min(distance, view.distance(next));
+        const float max_dist = std::max(distance, view.distance(next));
+        float azimuth_diff = view.azimuth(next) - azimuth;
+        azimuth_diff = azimuth_diff < 0.f ? azimuth_diff + 36000.f : azimuth_diff;
+
+        if (max_dist < min_dist * weak_first_distance_ratio_ && azimuth_diff < max_azimuth_diff) {
+          temp_segment.push_back(i);
+          keep_next = true;
+        } else if (keep_next) {
+          temp_segment.push_back(i);
+          keep_next = false;
+          // Analyze segment points here
+        } else {
+          // Log the deleted azimuth for analysis
+          switch (roi_mode) {
+            case 1:  // base_link xyz-ROI
+            {
+              const float x = view.x(i);
+              const float y = view.y(i);
+              const float z = view.z(i);
+              if (
+                x > x_min_ && x < x_max_ && y > y_min_ && y < y_max_ && z > z_min_ && z < z_max_) {
+                deleted_azimuths.push_back(azimuth < 0.f ? 0.f : azimuth);
+                result.noise.push_back(i);
+              }
+              break;
             }
-            break;
-          }
-          case 2: {
-            if (
-              iter->azimuth > min_azimuth && iter->azimuth < max_azimuth &&
-              iter->distance < max_distance_) {
-              deleted_azimuths.push_back(iter->azimuth < 0.f ? 0.f : iter->azimuth);
-              noise_output->points.push_back(*iter);
-              deleted_distances.push_back(iter->distance);
+            case 2: {
+              if (azimuth > min_azimuth && azimuth < max_azimuth && distance < max_distance_) {
+                deleted_azimuths.push_back(azimuth < 0.f ? 0.f : azimuth);
+                result.noise.push_back(i);
+              }
+              break;
+            }
+            default: {
+              deleted_azimuths.push_back(azimuth < 0.f ? 0.f : azimuth);
+              result.noise.push_back(i);
+              break;
             }
-            break;
-          }
-          default: {
-            deleted_azimuths.push_back(iter->azimuth < 0.f ? 0.f : iter->azimuth);
-            deleted_distances.push_back(iter->distance);
-            noise_output->points.push_back(*iter);
-            break;
           }
         }
       }
-    }
-    // Analyze last segment points here
-    std::vector<int> noise_frequency(horizontal_bins, 0);
-    uint current_deleted_index = 0;
-    uint current_temp_segment_index = 0;
-    for (uint i = 0; i < noise_frequency.size() - 1; i++) {
-      if (deleted_azimuths.size() == 0) {
-        continue;
-      }
-      while ((uint)deleted_azimuths[current_deleted_index] <
-               ((i + static_cast<uint>(min_azimuth / horizontal_resolution) + 1) *
-                horizontal_resolution) &&
-             current_deleted_index < (deleted_azimuths.size() - 1)) {
-        noise_frequency[i] = noise_frequency[i] + 1;
-        current_deleted_index++;
-      }
-      if (temp_segment.points.size() > 0) {
-        while ((temp_segment.points[current_temp_segment_index].azimuth < 0.f
-                  ? 0.f
-                  : temp_segment.points[current_temp_segment_index].azimuth) <
-                 ((i + 1 + static_cast<uint>(min_azimuth / horizontal_resolution)) *
+      // Analyze last segment points here
+      std::vector<int> noise_frequency(horizontal_bins, 0);
+      uint current_deleted_index = 0;
+      uint current_temp_segment_index = 0;
+      for (uint i = 0; i < noise_frequency.size() - 1; i++) {
+        if (deleted_azimuths.size() == 0) {
+          continue;
+        }
+        while ((uint)deleted_azimuths[current_deleted_index] <
+                 ((i + static_cast<uint>(min_azimuth / horizontal_resolution) + 1) *
                   horizontal_resolution) &&
-               current_temp_segment_index < (temp_segment.points.size() - 1)) {
-          if (noise_frequency[i] < weak_first_local_noise_threshold_) {
-            pcl_output->points.push_back(temp_segment.points[current_temp_segment_index]);
-          } else {
-            switch (roi_mode_map_[roi_mode_]) {
-              case 1: {
-                if (
-                  temp_segment.points[current_temp_segment_index].x < x_max_ &&
-                  temp_segment.points[current_temp_segment_index].x > x_min_ &&
-                  temp_segment.points[current_temp_segment_index].y > y_max_ &&
-                  temp_segment.points[current_temp_segment_index].y < y_min_ &&
-                  temp_segment.points[current_temp_segment_index].z < z_max_ &&
-                  temp_segment.points[current_temp_segment_index].z > z_min_) {
-                  noise_frequency[i] = noise_frequency[i] + 1;
-                  noise_output->points.push_back(temp_segment.points[current_temp_segment_index]);
+               current_deleted_index < (deleted_azimuths.size() - 1)) {
+          noise_frequency[i] = noise_frequency[i] + 1;
+          current_deleted_index++;
+        }
+        if (temp_segment.size() > 0) {
+          while ((view.azimuth(temp_segment[current_temp_segment_index]) < 0.f
+                    ? 0.f
+                    : view.azimuth(temp_segment[current_temp_segment_index])) <
+                   ((i + 1 + static_cast<uint>(min_azimuth / horizontal_resolution)) *
+                    horizontal_resolution) &&
+                 current_temp_segment_index < (temp_segment.size() - 1)) {
+            const size_t point = temp_segment[current_temp_segment_index];
+            if (noise_frequency[i] < weak_first_local_noise_threshold_) {
+              result.output.push_back(point);
+            } else {
+              switch (roi_mode) {
+                case 1: {
+                  if (
+                    view.x(point) < x_max_ && view.x(point) > x_min_ && view.y(point) > y_max_ &&
+                    view.y(point) < y_min_ && view.z(point) < z_max_ && view.z(point) > z_min_) {
+                    noise_frequency[i] = noise_frequency[i] + 1;
+                    result.noise.push_back(point);
+                  }
+                  break;
                 }
-                break;
-              }
-              case 2: {
-                if (
-                  temp_segment.points[current_temp_segment_index].azimuth < max_azimuth &&
-                  temp_segment.points[current_temp_segment_index].azimuth > min_azimuth &&
-                  temp_segment.points[current_temp_segment_index].distance < max_distance_) {
+                case 2: {
+                  if (
+                    view.azimuth(point) < max_azimuth && view.azimuth(point) > min_azimuth &&
+                    view.distance(point) < max_distance_) {
+                    noise_frequency[i] = noise_frequency[i] + 1;
+                    result.noise.push_back(point);
+                  }
+                  break;
+                }
+                default: {
                   noise_frequency[i] = noise_frequency[i] + 1;
-                  noise_output->points.push_back(temp_segment.points[current_temp_segment_index]);
+                  result.noise.push_back(point);
+                  break;
                 }
-                break;
-              }
-              default: {
-                noise_frequency[i] = noise_frequency[i] + 1;
-                noise_output->points.push_back(temp_segment.points[current_temp_segment_index]);
-                break;
               }
             }
+            current_temp_segment_index++;
+            frequency_image.at<uchar>(ring_id, i) = noise_frequency[i];
           }
-          current_temp_segment_index++;
-          frequency_image.at<uchar>(ring_id, i) = noise_frequency[i];
         }
       }
-    }
-  }
-
-  // Ring outlier filter for normal points
-  for (const auto & input_ring : pcl_input_ring_array) {
-    if (input_ring.size() < 2) {
-      continue;
-    }
-    pcl::PointCloud<PointXYZIRADRT> temp_segment;
-    bool keep_next = false;
-    // uint ring_id = input_ring.points.front().ring;
-    for (auto iter = std::begin(input_ring) + 1; iter != std::end(input_ring) - 1; ++iter) {
-      const float min_dist = std::min(iter->distance, (iter + 1)->distance);
-      const float max_dist = std::max(iter->distance, (iter + 1)->distance);
-      float azimuth_diff = (iter + 1)->azimuth - iter->azimuth;
-      azimuth_diff = azimuth_diff < 0.f ? azimuth_diff + 36000.f : azimuth_diff;
-
-      if (max_dist < min_dist * general_distance_ratio_ && azimuth_diff < max_azimuth_diff) {
-        temp_segment.points.push_back(*iter);
-        keep_next = true;
-      } else if (keep_next) {
-        temp_segment.points.push_back(*iter);
-        keep_next = false;
-        // Analyze segment points here
-      } else {
-        // Log the deleted azimuth and its distance for analysis
-        // deleted_azimuths.push_back(iter->azimuth < 0.f ? 0.f : iter->azimuth);
-        // deleted_distances.push_back(iter->distance);
-        noise_output->points.push_back(*iter);
+    });
+
+    // Ring outlier filter for normal points
+    for_each_ring([&](const uint32_t ring_id) {
+      auto & result = ring_results_.at(ring_id);
+      result.output.clear();
+      result.noise.clear();
+      const size_t ring_size = ring_index_.ring_size(ring_id);
+      if (ring_size < 2) {
+        return;
       }
-    }
-    for (const auto & tmp_p : temp_segment.points) {
-      pcl_output->points.push_back(tmp_p);
+      bool keep_next = false;
+      for (size_t k = 1; k + 1 < ring_size; ++k) {
+        const size_t i = ring_index_.at(ring_id, k);
+        const size_t next = ring_index_.at(ring_id, k + 1);
+        const float min_dist = std::min(view.distance(i), view.distance(next));
+        const float max_dist = std::max(view.distance(i), view.distance(next));
+        float azimuth_diff = view.azimuth(next) - view.azimuth(i);
+        azimuth_diff = azimuth_diff < 0.f ? azimuth_diff + 36000.f : azimuth_diff;
+
+        if (max_dist < min_dist * general_distance_ratio_ && azimuth_diff < max_azimuth_diff) {
+          result.output.push_back(i);
+          keep_next = true;
+        } else if (keep_next) {
+          result.output.push_back(i);
+          keep_next = false;
+          // Analyze segment points here
+        } else {
+          result.noise.push_back(i);
+        }
+      }
+    });
+  });
+
+  // Gather the results in the order of the rings, the weak first returns first
+  output_indices_.clear();
+  noise_indices_.clear();
+  for (const auto * ring_results : {&weak_first_ring_results_, &ring_results_}) {
+    for (const auto & result : *ring_results) {
+      output_indices_.insert(output_indices_.end(), result.output.begin(), result.output.end());
+      noise_indices_.insert(noise_indices_.end(), result.noise.begin(), result.noise.end());
     }
   }
 
@@ -342,12 +400,12 @@ void DualReturnOutlierFilterComponent::filter(
 
   // Publish noise points
   sensor_msgs::msg::PointCloud2 noise_output_msg;
-  pcl::toROSMsg(*noise_output, noise_output_msg);
+  extractPoints(*input, noise_indices_, noise_output_msg);
   noise_output_msg.header = input->header;
   noise_cloud_pub_->publish(noise_output_msg);
 
   // Publish filtered pointcloud
-  pcl::toROSMsg(*pcl_output, output);
+  extractPoints(*input, output_indices_, output);
   output.header = input->header;
 }
 
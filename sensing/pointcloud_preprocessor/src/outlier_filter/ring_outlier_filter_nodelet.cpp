@@ -84,18 +84,22 @@ void RingOutlierFilterComponent::faster_filter(
 
   pcl::PointCloud<PointXYZIRADRT>::Ptr outlier_pcl(new pcl::PointCloud<PointXYZIRADRT>);
 
-  const auto ring_offset =
-    input->fields.at(static_cast<size_t>(autoware_point_types::PointIndex::Ring)).offset;
-  const auto azimuth_offset =
-    input->fields.at(static_cast<size_t>(autoware_point_types::PointIndex::Azimuth)).offset;
-  const auto distance_offset =
-    input->fields.at(static_cast<size_t>(autoware_point_types::PointIndex::Distance)).offset;
-  const auto intensity_offset =
-    input->fields.at(static_cast<size_t>(autoware_point_types::PointIndex::Intensity)).offset;
-  const auto return_type_offset =
-    input->fields.at(static_cast<size_t>(autoware_point_types::PointIndex::ReturnType)).offset;
-  const auto time_stamp_offset =
-    input->fields.at(static_cast<size_t>(autoware_point_types::PointIndex::TimeStamp)).offset;
+  const auto & field_offsets = input_field_offsets_cache_.resolve(*input);
+  if (
+    field_offsets.ring < 0 || field_offsets.azimuth < 0 || field_offsets.distance < 0 ||
+    field_offsets.intensity < 0 || field_offsets.return_type < 0 || field_offsets.time_stamp < 0) {
+    RCLCPP_ERROR_THROTTLE(
+      get_logger(), *get_clock(), 1000,
+      "Input pointcloud does not have the fields of PointXYZIRADRT. Skipping.");
+    setUpPointCloudFormat(input, output, 0, /*num_fields=*/4);
+    return;
+  }
+  const size_t ring_offset = field_offsets.ring;
+  const size_t azimuth_offset = field_offsets.azimuth;
+  const size_t distance_offset = field_offsets.distance;
+  const size_t intensity_offset = field_offsets.intensity;
+  const size_t return_type_offset = field_offsets.return_type;
+  const size_t time_stamp_offset = field_offsets.time_stamp;
 
   std::vector<std::vector<size_t>> ring2indices;
   ring2indices.reserve(max_rings_num_);
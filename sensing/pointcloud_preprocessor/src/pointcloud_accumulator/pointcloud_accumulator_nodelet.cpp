@@ -14,6 +14,10 @@
 
 #include "pointcloud_preprocessor/pointcloud_accumulator/pointcloud_accumulator_nodelet.hpp"
 
+#include <autoware_point_types/types.hpp>
+
+#include <cstring>
+#include <string>
 #include <vector>
 
 namespace pointcloud_preprocessor
@@ -26,6 +30,12 @@ PointcloudAccumulatorComponent::PointcloudAccumulatorComponent(const rclcpp::Nod
     accumulation_time_sec_ = static_cast<double>(declare_parameter("accumulation_time_sec", 2.0));
     pointcloud_buffer_.set_capacity(
       static_cast<size_t>(declare_parameter("pointcloud_buffer_size", 50)));
+    use_streaming_ = declare_parameter("use_streaming", false);
+    accumulation_frame_ = static_cast<std::string>(declare_parameter("accumulation_frame", ""));
+    const auto streaming_buffer_size = declare_parameter("streaming_buffer_size", 3000000);
+    if (use_streaming_) {
+      point_buffer_.setCapacity(static_cast<size_t>(streaming_buffer_size));
+    }
   }
 
   using std::placeholders::_1;
@@ -40,6 +50,10 @@ void PointcloudAccumulatorComponent::filter(
   if (indices) {
     RCLCPP_WARN(get_logger(), "Indices are not supported and will be ignored");
   }
+  if (use_streaming_) {
+    streamingFilter(input, output);
+    return;
+  }
   pointcloud_buffer_.push_front(input);
   rclcpp::Time last_time = input->header.stamp;
   pcl::PointCloud<pcl::PointXYZ> pcl_input;
@@ -55,6 +69,61 @@ void PointcloudAccumulatorComponent::filter(
   output.header = input->header;
 }
 
+void PointcloudAccumulatorComponent::streamingFilter(
+  const PointCloud2ConstPtr & input, PointCloud2 & output)
+{
+  // The input is transformed into the accumulation frame once when it is added, and the
+  // accumulated points are transformed back into the frame of the input when published
+  TransformInfo transform_info;
+  if (!calculate_transform_matrix(accumulation_frame_, *input, transform_info)) {
+    output = *input;
+    return;
+  }
+  const Eigen::Affine3f to_accumulation_frame(transform_info.eigen_transform);
+  const Eigen::Affine3f from_accumulation_frame = to_accumulation_frame.inverse();
+
+  const double stamp = rclcpp::Time(input->header.stamp).seconds();
+  if (!point_buffer_.frames().empty() && stamp < point_buffer_.frames().back().stamp) {
+    // The time jumped back, e.g. a rosbag is replayed again
+    point_buffer_.clear();
+  }
+  utils::visitPointCloud2<autoware_point_types::PointXYZIRADRT, autoware_point_types::PointXYZI>(
+    *input, input_field_offsets_cache_.resolve(*input), [&](const auto & input_view) {
+      point_buffer_.push(stamp, input_view.size(), [&](const size_t i) {
+        Eigen::Vector3f point(input_view.x(i), input_view.y(i), input_view.z(i));
+        if (transform_info.need_transform) {
+          point = to_accumulation_frame * point;
+        }
+        return pcl::PointXYZ(point.x(), point.y(), point.z());
+      });
+    });
+  point_buffer_.dropOlderThan(stamp - accumulation_time_sec_);
+  point_buffer_.keepLatestFrames(pointcloud_buffer_.capacity());
+
+  // NOTE: The layout of the output is the same as pcl::PointXYZ, so the points are copied as is
+  pcl::toROSMsg(pcl::PointCloud<pcl::PointXYZ>(), output);
+  output.header = input->header;
+  output.height = 1;
+  output.width = static_cast<uint32_t>(point_buffer_.size());
+  output.row_step = output.width * output.point_step;
+  output.is_dense = false;
+  output.data.resize(static_cast<size_t>(output.row_step));
+  uint8_t * output_data = output.data.data();
+  point_buffer_.forEachSegment([&](const pcl::PointXYZ * points, const size_t num_points) {
+    if (!transform_info.need_transform) {
+      std::memcpy(output_data, points, num_points * sizeof(pcl::PointXYZ));
+      output_data += num_points * sizeof(pcl::PointXYZ);
+      return;
+    }
+    for (size_t i = 0; i < num_points; ++i) {
+      const Eigen::Vector3f point = from_accumulation_frame * points[i].getVector3fMap();
+      const pcl::PointXYZ output_point(point.x(), point.y(), point.z());
+      std::memcpy(output_data, &output_point, sizeof(pcl::PointXYZ));
+      output_data += sizeof(pcl::PointXYZ);
+    }
+  });
+}
+
 rcl_interfaces::msg::SetParametersResult PointcloudAccumulatorComponent::paramCallback(
   const std::vector<rclcpp::Parameter> & p)
 {
@@ -14,6 +14,15 @@
 
 #include "pointcloud_preprocessor/polygon_remover/polygon_remover.hpp"
 
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+// The polygon is rasterized into this number of cells along the longer side of its bounding box
+constexpr double mask_cells_per_side = 256.0;
+}  // namespace
+
 namespace pointcloud_preprocessor
 {
 PolygonRemoverComponent::PolygonRemoverComponent(const rclcpp::NodeOptions & options)
@@ -71,6 +80,24 @@ void PolygonRemoverComponent::update_polygon(
   const geometry_msgs::msg::Polygon::ConstSharedPtr & polygon_in)
 {
   pointcloud_preprocessor::utils::to_cgal_polygon(*polygon_in, polygon_cgal_);
+
+  // The mask contains the polygon with a margin of a cell, so the points out of it are outside
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & vertex : polygon_cgal_) {
+    min_x = std::min(min_x, vertex.x());
+    min_y = std::min(min_y, vertex.y());
+    max_x = std::max(max_x, vertex.x());
+    max_y = std::max(max_y, vertex.y());
+  }
+  const double cell_size =
+    std::max(std::max(max_x - min_x, max_y - min_y) / mask_cells_per_side, 1e-3);
+  polygon_mask_.build(
+    std::vector<PolygonCgal>{polygon_cgal_}, min_x - cell_size, min_y - cell_size,
+    max_x + cell_size, max_y + cell_size, cell_size);
+
   if (will_visualize_) {
     marker_.ns = "";
     marker_.id = 0;
@@ -133,7 +160,7 @@ sensor_msgs::msg::PointCloud2 PolygonRemoverComponent::remove_updated_polygon_fr
 
   PointCloud2 cloud_out;
   pointcloud_preprocessor::utils::remove_polygon_cgal_from_cloud(
-    *cloud_in, polygon_cgal_, cloud_out);
+    *cloud_in, polygon_cgal_, polygon_mask_, cloud_out);
   return cloud_out;
 }
 }  // namespace pointcloud_preprocessor
@@ -135,6 +135,58 @@ void remove_polygon_cgal_from_cloud(
   cloud_out.header = cloud_in.header;
 }
 
+void remove_polygon_cgal_from_cloud(
+  const sensor_msgs::msg::PointCloud2 & cloud_in, const PolygonCgal & polyline_polygon,
+  const PolygonMask & mask, sensor_msgs::msg::PointCloud2 & cloud_out)
+{
+  pcl::PointCloud<pcl::PointXYZ> pcl_output;
+
+  for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud_in, "x"), iter_y(cloud_in, "y"),
+       iter_z(cloud_in, "z");
+       iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    // check if the point is inside the polygon only if the mask does not decide it
+    const auto state = mask.at(*iter_x, *iter_y);
+    if (
+      state == PolygonMask::CellState::OUTSIDE ||
+      (state == PolygonMask::CellState::UNKNOWN &&
+       CGAL::bounded_side_2(
+         polyline_polygon.begin(), polyline_polygon.end(), PointCgal(*iter_x, *iter_y), K()) ==
+         CGAL::ON_UNBOUNDED_SIDE)) {
+      pcl_output.emplace_back(*iter_x, *iter_y, *iter_z);
+    }
+  }
+
+  pcl::toROSMsg(pcl_output, cloud_out);
+  cloud_out.header = cloud_in.header;
+}
+
+void remove_polygon_cgal_from_cloud(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud_in,
+  const std::vector<PolygonCgal> & polyline_polygons, const PolygonMask & mask,
+  pcl::PointCloud<pcl::PointXYZ> & cloud_out)
+{
+  if (polyline_polygons.empty()) {
+    cloud_out = cloud_in;
+    return;
+  }
+
+  pcl::PointCloud<pcl::PointXYZ> filtered_cloud;
+  filtered_cloud.reserve(cloud_in.size());
+  for (const auto & p : cloud_in) {
+    // if the point is inside the polygon, skip inserting and check the next point
+    const auto state = mask.at(p.x, p.y);
+    if (
+      state == PolygonMask::CellState::INSIDE ||
+      (state == PolygonMask::CellState::UNKNOWN && point_within_cgal_polys(p, polyline_polygons))) {
+      continue;
+    }
+    filtered_cloud.emplace_back(p);
+  }
+
+  cloud_out = filtered_cloud;
+  cloud_out.header = cloud_in.header;
+}
+
 bool point_within_cgal_polys(
   const pcl::PointXYZ & point, const std::vector<PolygonCgal> & polyline_polygons)
 {
@@ -16,20 +16,34 @@
 
 #include "pointcloud_preprocessor/filter.hpp"
 
+#include <lanelet2_map_cache/lanelet2_map_cache.hpp>
 #include <pcl_ros/transforms.hpp>
 
-#include <boost/geometry/algorithms/convex_hull.hpp>
-#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/within.hpp>
 
+#include <lanelet2_core/geometry/BoundingBox.h>
+#include <lanelet2_core/geometry/Lanelet.h>
 #include <lanelet2_core/geometry/Polygon.h>
 #include <tf2_ros/create_timer_ros.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+namespace
+{
+// NOTE: The mask is about 3 MB for the point cloud of 200 m x 200 m, and only the points in the
+//       cells along the boundaries of the lanelets are tested against the polygons.
+constexpr double mask_resolution = 0.2;
+// The mask follows the vehicle in steps of the margin, so it is rebuilt every 50 m at most
+constexpr double mask_margin = 50.0;
+}  // namespace
+
 namespace pointcloud_preprocessor
 {
 Lanelet2MapFilterComponent::Lanelet2MapFilterComponent(const rclcpp::NodeOptions & node_options)
@@ -119,45 +133,62 @@ bool Lanelet2MapFilterComponent::transformPointCloud(
   return true;
 }
 
-LinearRing2d Lanelet2MapFilterComponent::getConvexHull(
-  const pcl::PointCloud<pcl::PointXYZ>::Ptr & input_cloud)
+void Lanelet2MapFilterComponent::updateRoadMask(const pcl::PointCloud<pcl::PointXYZ> & cloud)
 {
-  // downsample pointcloud to reduce convex hull calculation cost
-  pcl::PointCloud<pcl::PointXYZ>::Ptr downsampled_cloud(new pcl::PointCloud<pcl::PointXYZ>);
-  downsampled_cloud->points.reserve(input_cloud->points.size());
-  pcl::VoxelGrid<pcl::PointXYZ> filter;
-  filter.setInputCloud(input_cloud);
-  filter.setLeafSize(0.5, 0.5, 100.0);
-  filter.filter(*downsampled_cloud);
-
-  MultiPoint2d candidate_points;
-  for (const auto & p : downsampled_cloud->points) {
-    candidate_points.emplace_back(p.x, p.y);
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & p : cloud.points) {
+    if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+      continue;
+    }
+    min_x = std::min(min_x, static_cast<double>(p.x));
+    min_y = std::min(min_y, static_cast<double>(p.y));
+    max_x = std::max(max_x, static_cast<double>(p.x));
+    max_y = std::max(max_y, static_cast<double>(p.y));
+  }
+  if (min_x > max_x || road_mask_.contains(min_x, min_y, max_x, max_y)) {
+    return;
   }
 
-  LinearRing2d convex_hull;
-  boost::geometry::convex_hull(candidate_points, convex_hull);
-
-  return convex_hull;
-}
-
-lanelet::ConstLanelets Lanelet2MapFilterComponent::getIntersectedLanelets(
-  const LinearRing2d & convex_hull, const lanelet::ConstLanelets & road_lanelets)
-{
-  lanelet::ConstLanelets intersected_lanelets;
-  for (const auto & road_lanelet : road_lanelets) {
-    if (boost::geometry::intersects(convex_hull, road_lanelet.polygon2d().basicPolygon())) {
-      intersected_lanelets.push_back(road_lanelet);
+  // Snap the area to the margin so that the mask is stable while the vehicle moves
+  const lanelet::BoundingBox2d mask_area(
+    lanelet::BasicPoint2d(
+      std::floor(min_x / mask_margin) * mask_margin - mask_margin,
+      std::floor(min_y / mask_margin) * mask_margin - mask_margin),
+    lanelet::BasicPoint2d(
+      std::ceil(max_x / mask_margin) * mask_margin + mask_margin,
+      std::ceil(max_y / mask_margin) * mask_margin + mask_margin));
+  mask_polygons_.clear();
+  mask_polygon_boxes_.clear();
+  for (const auto & road_lanelet : road_lanelets_) {
+    const auto box = lanelet::geometry::boundingBox2d(road_lanelet);
+    if (box.intersects(mask_area)) {
+      mask_polygons_.push_back(road_lanelet.polygon2d().basicPolygon());
+      mask_polygon_boxes_.push_back(box);
     }
   }
-  return intersected_lanelets;
+  road_mask_.build(
+    mask_polygons_, mask_area.min().x(), mask_area.min().y(), mask_area.max().x(),
+    mask_area.max().y(), mask_resolution);
 }
 
-bool Lanelet2MapFilterComponent::pointWithinLanelets(
-  const Point2d & point, const lanelet::ConstLanelets & intersected_lanelets)
+bool Lanelet2MapFilterComponent::pointWithinLanelets(const Point2d & point) const
 {
-  for (const auto & lanelet : intersected_lanelets) {
-    if (boost::geometry::within(point, lanelet.polygon2d().basicPolygon())) {
+  switch (road_mask_.at(point.x(), point.y())) {
+    case utils::PolygonMask::CellState::INSIDE:
+      return true;
+    case utils::PolygonMask::CellState::OUTSIDE:
+      return false;
+    default:
+      break;
+  }
+  const lanelet::BasicPoint2d query(point.x(), point.y());
+  for (size_t i = 0; i < mask_polygons_.size(); ++i) {
+    if (
+      mask_polygon_boxes_.at(i).contains(query) &&
+      boost::geometry::within(point, mask_polygons_.at(i))) {
       return true;
     }
   }
@@ -165,7 +196,6 @@ bool Lanelet2MapFilterComponent::pointWithinLanelets(
 }
 
 pcl::PointCloud<pcl::PointXYZ> Lanelet2MapFilterComponent::getLaneFilteredPointCloud(
-  const lanelet::ConstLanelets & intersected_lanelets,
   const pcl::PointCloud<pcl::PointXYZ>::Ptr & cloud)
 {
   pcl::PointCloud<pcl::PointXYZ> filtered_cloud;
@@ -201,8 +231,7 @@ pcl::PointCloud<pcl::PointXYZ> Lanelet2MapFilterComponent::getLaneFilteredPointC
   }
 
   for (auto & point : downsampled_cloud->points) {
-    if (pointWithinLanelets(
-          Point2d(point.x + centroid[0], point.y + centroid[1]), intersected_lanelets)) {
+    if (pointWithinLanelets(Point2d(point.x + centroid[0], point.y + centroid[1]))) {
       const size_t index = voxel_grid.getCentroidIndex(point);
       for (auto & original_point : downsampled2original_map[index].points) {
         original_point.x += centroid[0];
@@ -236,12 +265,10 @@ void Lanelet2MapFilterComponent::pointcloudCallback(const PointCloud2ConstPtr cl
   if (cloud->points.empty()) {
     return;
   }
-  // calculate convex hull
-  const auto convex_hull = getConvexHull(cloud);
-  // get intersected lanelets
-  lanelet::ConstLanelets intersected_lanelets = getIntersectedLanelets(convex_hull, road_lanelets_);
+  // rasterize the lanelets around the pointcloud if it goes out of the mask
+  updateRoadMask(*cloud);
   // filter pointcloud by lanelet
-  const auto filtered_cloud = getLaneFilteredPointCloud(intersected_lanelets, cloud);
+  const auto filtered_cloud = getLaneFilteredPointCloud(cloud);
   // transform pointcloud to input frame
   PointCloud2Ptr output_cloud_ptr(new sensor_msgs::msg::PointCloud2);
   pcl::toROSMsg(filtered_cloud, *output_cloud_ptr);
@@ -261,10 +288,11 @@ void Lanelet2MapFilterComponent::pointcloudCallback(const PointCloud2ConstPtr cl
 void Lanelet2MapFilterComponent::mapCallback(
   const autoware_auto_mapping_msgs::msg::HADMapBin::ConstSharedPtr map_msg)
 {
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(*map_msg, lanelet_map_ptr_);
+  lanelet_map_ptr_ = lanelet2_map_cache::fromBinMsg(*map_msg).lanelet_map_ptr;
   const lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
   road_lanelets_ = lanelet::utils::query::roadLanelets(all_lanelets);
+  // rebuild the mask for the new map
+  road_mask_ = utils::PolygonMask();
 }
 
 }  // namespace pointcloud_preprocessor
@@ -14,14 +14,24 @@
 
 #include "pointcloud_preprocessor/vector_map_filter/vector_map_inside_area_filter.hpp"
 
+#include <cmath>
+#include <utility>
+#include <vector>
+
 namespace
 {
+constexpr double mask_resolution = 0.2;
+// The mask follows the vehicle in steps of the margin, so it is rebuilt every 50 m at most
+constexpr double mask_margin = 50.0;
+
 tier4_autoware_utils::Box2d calcBoundingBox(
   const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & input_cloud)
 {
   MultiPoint2d candidate_points;
   for (const auto & p : input_cloud->points) {
-    candidate_points.emplace_back(p.x, p.y);
+    if (std::isfinite(p.x) && std::isfinite(p.y)) {
+      candidate_points.emplace_back(p.x, p.y);
+    }
   }
 
   return boost::geometry::return_envelope<tier4_autoware_utils::Box2d>(candidate_points);
@@ -39,25 +49,6 @@ lanelet::ConstPolygons3d calcIntersectedPolygons(
   return intersected_polygons;
 }
 
-pcl::PointCloud<pcl::PointXYZ> removePointsWithinPolygons(
-  const pcl::PointCloud<pcl::PointXYZ>::Ptr & cloud_in, const lanelet::ConstPolygons3d & polygons)
-{
-  std::vector<PolygonCgal> cgal_polys;
-
-  for (const auto & polygon : polygons) {
-    const auto lanelet_poly = lanelet::utils::to2D(polygon).basicPolygon();
-    PolygonCgal cgal_poly;
-    pointcloud_preprocessor::utils::to_cgal_polygon(lanelet_poly, cgal_poly);
-    cgal_polys.emplace_back(cgal_poly);
-  }
-
-  pcl::PointCloud<pcl::PointXYZ> filtered_cloud;
-  pointcloud_preprocessor::utils::remove_polygon_cgal_from_cloud(
-    *cloud_in, cgal_polys, filtered_cloud);
-
-  return filtered_cloud;
-}
-
 }  // anonymous namespace
 
 namespace pointcloud_preprocessor
@@ -92,20 +83,49 @@ void VectorMapInsideAreaFilterComponent::filter(
   pcl::PointCloud<pcl::PointXYZ>::Ptr pc_input = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
   pcl::fromROSMsg(*input, *pc_input);
 
-  // calculate bounding box of points
-  const auto bounding_box = calcBoundingBox(pc_input);
-
-  // use only intersected lanelets to reduce calculation cost
-  const auto intersected_lanelets = calcIntersectedPolygons(bounding_box, polygon_lanelets_);
+  // rasterize the polygons around the pointcloud if it goes out of the mask
+  updatePolygonMask(pc_input);
 
   // filter pointcloud by lanelet
-  const auto filtered_pc = removePointsWithinPolygons(pc_input, intersected_lanelets);
+  pcl::PointCloud<pcl::PointXYZ> filtered_pc;
+  utils::remove_polygon_cgal_from_cloud(*pc_input, mask_polygons_, polygon_mask_, filtered_pc);
 
   // convert to ROS message
   pcl::toROSMsg(filtered_pc, output);
   output.header = input->header;
 }
 
+void VectorMapInsideAreaFilterComponent::updatePolygonMask(
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & cloud)
+{
+  const auto bounding_box = calcBoundingBox(cloud);
+  const auto & min_corner = bounding_box.min_corner();
+  const auto & max_corner = bounding_box.max_corner();
+  if (
+    !(min_corner.x() <= max_corner.x()) ||
+    polygon_mask_.contains(min_corner.x(), min_corner.y(), max_corner.x(), max_corner.y())) {
+    return;
+  }
+
+  // Snap the area to the margin so that the mask is stable while the vehicle moves
+  tier4_autoware_utils::Box2d mask_area;
+  mask_area.min_corner().x() = std::floor(min_corner.x() / mask_margin) * mask_margin - mask_margin;
+  mask_area.min_corner().y() = std::floor(min_corner.y() / mask_margin) * mask_margin - mask_margin;
+  mask_area.max_corner().x() = std::ceil(max_corner.x() / mask_margin) * mask_margin + mask_margin;
+  mask_area.max_corner().y() = std::ceil(max_corner.y() / mask_margin) * mask_margin + mask_margin;
+
+  // use only intersected lanelets to reduce calculation cost
+  mask_polygons_.clear();
+  for (const auto & polygon : calcIntersectedPolygons(mask_area, polygon_lanelets_)) {
+    PolygonCgal cgal_poly;
+    utils::to_cgal_polygon(lanelet::utils::to2D(polygon).basicPolygon(), cgal_poly);
+    mask_polygons_.push_back(std::move(cgal_poly));
+  }
+  polygon_mask_.build(
+    mask_polygons_, mask_area.min_corner().x(), mask_area.min_corner().y(),
+    mask_area.max_corner().x(), mask_area.max_corner().y(), mask_resolution);
+}
+
 void VectorMapInsideAreaFilterComponent::mapCallback(
   const autoware_auto_mapping_msgs::msg::HADMapBin::ConstSharedPtr map_msg)
 {
@@ -114,6 +134,8 @@ void VectorMapInsideAreaFilterComponent::mapCallback(
   const auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
   lanelet::utils::conversion::fromBinMsg(*map_msg, lanelet_map_ptr);
   polygon_lanelets_ = lanelet::utils::query::getAllPolygonsByType(lanelet_map_ptr, polygon_type_);
+  // rebuild the mask for the new map
+  polygon_mask_ = utils::PolygonMask();
 }
 
 }  // namespace pointcloud_preprocessor
@@ -0,0 +1,110 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/downsample_filter/faster_voxel_grid_downsample_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using pointcloud_preprocessor::FasterVoxelGridDownsampleFilter;
+using pointcloud_preprocessor::TransformInfo;
+using sensor_msgs::msg::PointCloud2;
+
+namespace
+{
+PointCloud2::SharedPtr createPointCloud(const size_t num_points)
+{
+  auto cloud = std::make_shared<PointCloud2>();
+  const std::array<std::string, 4> names{"x", "y", "z", "intensity"};
+  for (size_t i = 0; i < names.size(); ++i) {
+    sensor_msgs::msg::PointField field;
+    field.name = names[i];
+    field.offset = static_cast<uint32_t>(i * sizeof(float));
+    field.datatype = sensor_msgs::msg::PointField::FLOAT32;
+    field.count = 1;
+    cloud->fields.push_back(field);
+  }
+  cloud->height = 1;
+  cloud->width = static_cast<uint32_t>(num_points);
+  cloud->point_step = 4 * sizeof(float);
+  cloud->row_step = cloud->width * cloud->point_step;
+  cloud->data.resize(cloud->row_step);
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> xy_dist(-20.0f, 20.0f);
+  std::uniform_real_distribution<float> z_dist(-2.0f, 3.0f);
+  for (size_t i = 0; i < num_points; ++i) {
+    std::array<float, 4> point{xy_dist(engine), xy_dist(engine), z_dist(engine), 10.0f};
+    if (i % 997 == 0) {
+      point[0] = std::nanf("");
+    }
+    std::memcpy(&cloud->data[i * cloud->point_step], point.data(), sizeof(point));
+  }
+  return cloud;
+}
+
+std::vector<std::array<float, 4>> filterAndSort(
+  FasterVoxelGridDownsampleFilter & filter, const PointCloud2::ConstSharedPtr & input)
+{
+  PointCloud2 output;
+  filter.set_field_offsets(input);
+  filter.filter(input, output, TransformInfo{}, rclcpp::get_logger("test"));
+
+  std::vector<std::array<float, 4>> points(output.width);
+  for (size_t i = 0; i < points.size(); ++i) {
+    std::memcpy(points[i].data(), &output.data[i * output.point_step], sizeof(points[i]));
+  }
+  std::sort(points.begin(), points.end());
+  return points;
+}
+}  // namespace
+
+TEST(FasterVoxelGridDownsampleFilter, ShardedFillMatchesSingleThread)
+{
+  const auto input = createPointCloud(50000);
+
+  FasterVoxelGridDownsampleFilter single_thread_filter;
+  single_thread_filter.set_voxel_size(0.5f, 0.5f, 0.5f);
+  const auto expected = filterAndSort(single_thread_filter, input);
+  ASSERT_FALSE(expected.empty());
+
+  FasterVoxelGridDownsampleFilter multi_thread_filter;
+  multi_thread_filter.set_voxel_size(0.5f, 0.5f, 0.5f);
+  multi_thread_filter.set_num_threads(4);
+  // the second frame reuses the voxel maps of the first one
+  for (int frame = 0; frame < 2; ++frame) {
+    EXPECT_EQ(filterAndSort(multi_thread_filter, input), expected);
+  }
+}
+
+TEST(FasterVoxelGridDownsampleFilter, BoundedVoxelCount)
+{
+  const auto input = createPointCloud(50000);
+
+  FasterVoxelGridDownsampleFilter filter;
+  filter.set_voxel_size(0.5f, 0.5f, 0.5f);
+  filter.set_num_threads(2);
+  filter.set_max_voxel_count(100);
+  const auto points = filterAndSort(filter, input);
+  EXPECT_LE(points.size(), 100U);
+  EXPECT_FALSE(points.empty());
+}
@@ -0,0 +1,85 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/utility/point_ring_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using pointcloud_preprocessor::utils::PointRingBuffer;
+
+namespace
+{
+void pushFrame(PointRingBuffer<int> & buffer, const double stamp, const std::vector<int> & points)
+{
+  buffer.push(stamp, points.size(), [&](const size_t i) { return points.at(i); });
+}
+
+std::vector<int> getPoints(const PointRingBuffer<int> & buffer)
+{
+  std::vector<int> points;
+  buffer.forEachSegment([&](const int * data, const size_t size) {
+    points.insert(points.end(), data, data + size);
+  });
+  return points;
+}
+}  // namespace
+
+TEST(PointRingBufferTest, KeepsFramesInOrder)
+{
+  PointRingBuffer<int> buffer;
+  buffer.setCapacity(8);
+  pushFrame(buffer, 0.0, {0, 1, 2});
+  pushFrame(buffer, 0.1, {3, 4});
+
+  EXPECT_EQ(buffer.size(), 5u);
+  EXPECT_EQ(buffer.frames().size(), 2u);
+  EXPECT_EQ(getPoints(buffer), (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(PointRingBufferTest, DropsExpiredFrames)
+{
+  PointRingBuffer<int> buffer;
+  buffer.setCapacity(8);
+  pushFrame(buffer, 0.0, {0, 1, 2});
+  pushFrame(buffer, 0.1, {3, 4});
+  pushFrame(buffer, 0.2, {5});
+
+  buffer.dropOlderThan(0.1);
+  EXPECT_EQ(getPoints(buffer), (std::vector<int>{3, 4, 5}));
+  buffer.keepLatestFrames(1);
+  EXPECT_EQ(getPoints(buffer), (std::vector<int>{5}));
+  buffer.dropOlderThan(1.0);
+  EXPECT_EQ(buffer.size(), 0u);
+  EXPECT_TRUE(buffer.frames().empty());
+}
+
+TEST(PointRingBufferTest, OverwritesOldestFramesAndWrapsAround)
+{
+  PointRingBuffer<int> buffer;
+  buffer.setCapacity(6);
+  pushFrame(buffer, 0.0, {0, 1, 2});
+  pushFrame(buffer, 0.1, {3, 4});
+  // the first frame is dropped to make room, and the new frame wraps around the end of the ring
+  pushFrame(buffer, 0.2, {5, 6, 7});
+
+  EXPECT_EQ(buffer.frames().size(), 2u);
+  EXPECT_EQ(getPoints(buffer), (std::vector<int>{3, 4, 5, 6, 7}));
+
+  // only the last points are kept if a frame exceeds the capacity
+  pushFrame(buffer, 0.3, {10, 11, 12, 13, 14, 15, 16, 17});
+  EXPECT_EQ(buffer.frames().size(), 1u);
+  EXPECT_EQ(getPoints(buffer), (std::vector<int>{12, 13, 14, 15, 16, 17}));
+}
@@ -0,0 +1,115 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/utility/polygon_mask.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using pointcloud_preprocessor::utils::PolygonMask;
+using CellState = PolygonMask::CellState;
+
+namespace
+{
+// minimal vertex with the accessors of lanelet::BasicPoint2d
+struct Vertex
+{
+  double x_;
+  double y_;
+  double x() const { return x_; }
+  double y() const { return y_; }
+};
+using Polygon = std::vector<Vertex>;
+
+// even-odd rule as the reference
+bool isInside(const Polygon & polygon, const double x, const double y)
+{
+  bool inside = false;
+  for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+    const auto & a = polygon.at(i);
+    const auto & b = polygon.at(j);
+    if (
+      (a.y() <= y) != (b.y() <= y) &&
+      x < a.x() + (y - a.y()) * (b.x() - a.x()) / (b.y() - a.y())) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+bool isInside(const std::vector<Polygon> & polygons, const double x, const double y)
+{
+  for (const auto & polygon : polygons) {
+    if (isInside(polygon, x, y)) {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace
+
+TEST(PolygonMaskTest, ClassifiesCellsOfSquare)
+{
+  const std::vector<Polygon> polygons{{{1.0, 1.0}, {5.0, 1.0}, {5.0, 5.0}, {1.0, 5.0}}};
+  PolygonMask mask;
+  mask.build(polygons, 0.0, 0.0, 10.0, 10.0, 0.5);
+
+  EXPECT_EQ(mask.at(3.0, 3.0), CellState::INSIDE);
+  EXPECT_EQ(mask.at(8.0, 8.0), CellState::OUTSIDE);
+  EXPECT_EQ(mask.at(1.2, 3.0), CellState::UNKNOWN);
+  EXPECT_EQ(mask.at(4.9, 4.9), CellState::UNKNOWN);
+  // the area contains the polygon, so the points out of it are outside
+  EXPECT_EQ(mask.at(-5.0, 3.0), CellState::OUTSIDE);
+  EXPECT_TRUE(mask.contains(1.0, 1.0, 9.0, 9.0));
+  EXPECT_FALSE(mask.contains(1.0, 1.0, 11.0, 9.0));
+}
+
+TEST(PolygonMaskTest, PointsOutOfAreaAreUnknownIfPolygonsExceedArea)
+{
+  const std::vector<Polygon> polygons{{{-5.0, 1.0}, {5.0, 1.0}, {5.0, 5.0}, {-5.0, 5.0}}};
+  PolygonMask mask;
+  mask.build(polygons, 0.0, 0.0, 10.0, 10.0, 0.5);
+
+  EXPECT_EQ(mask.at(0.3, 3.0), CellState::INSIDE);
+  EXPECT_EQ(mask.at(-2.0, 3.0), CellState::UNKNOWN);
+}
+
+TEST(PolygonMaskTest, AgreesWithExactTestOfPolygons)
+{
+  // a concave polygon, a triangle overlapping it and a thin sliver
+  const std::vector<Polygon> polygons{
+    {{0.3, 0.2}, {8.7, 0.9}, {9.1, 7.3}, {5.2, 3.1}, {1.1, 8.4}},
+    {{4.0, 4.0}, {9.5, 9.7}, {2.2, 9.3}},
+    {{0.1, 9.0}, {9.9, 9.05}, {0.1, 9.1}}};
+  PolygonMask mask;
+  mask.build(polygons, 0.0, 0.0, 10.0, 10.0, 0.25);
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> distribution(-1.0, 11.0);
+  size_t num_decided = 0;
+  for (int i = 0; i < 100000; ++i) {
+    const double x = distribution(engine);
+    const double y = distribution(engine);
+    const auto state = mask.at(x, y);
+    if (state == CellState::UNKNOWN) {
+      continue;
+    }
+    ++num_decided;
+    EXPECT_EQ(state == CellState::INSIDE, isInside(polygons, x, y)) << x << ", " << y;
+  }
+  // most of the points are decided without the exact test
+  EXPECT_GT(num_decided, 80000u);
+}
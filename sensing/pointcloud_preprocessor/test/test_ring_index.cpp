@@ -0,0 +1,76 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/utility/ring_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+using pointcloud_preprocessor::utils::RingIndex;
+
+namespace
+{
+// minimal view with the ring accessor of point_cloud2_accessor.hpp
+struct RingView
+{
+  std::vector<uint16_t> rings;
+  size_t size() const { return rings.size(); }
+  uint16_t ring(const size_t i) const { return rings.at(i); }
+};
+
+std::vector<size_t> getRing(const RingIndex & ring_index, const size_t ring)
+{
+  return std::vector<size_t>(ring_index.begin(ring), ring_index.end(ring));
+}
+}  // namespace
+
+TEST(RingIndexTest, GroupsPointsByRingInCloudOrder)
+{
+  const RingView view{{2, 0, 2, 1, 0, 2}};
+  RingIndex ring_index;
+  ring_index.build(view, 3);
+
+  EXPECT_EQ(ring_index.num_rings(), 3u);
+  EXPECT_EQ(ring_index.size(), 6u);
+  EXPECT_EQ(getRing(ring_index, 0), (std::vector<size_t>{1, 4}));
+  EXPECT_EQ(getRing(ring_index, 1), (std::vector<size_t>{3}));
+  EXPECT_EQ(getRing(ring_index, 2), (std::vector<size_t>{0, 2, 5}));
+  EXPECT_EQ(ring_index.ring_size(2), 3u);
+  EXPECT_EQ(ring_index.at(2, 1), 2u);
+}
+
+TEST(RingIndexTest, SkipsPointsOutOfRangeAndNotTargeted)
+{
+  const RingView view{{0, 5, 1, 0, 1}};
+  RingIndex ring_index;
+  ring_index.build(view, 2, [](const size_t i) { return i != 3; });
+
+  EXPECT_EQ(ring_index.size(), 3u);
+  EXPECT_EQ(getRing(ring_index, 0), (std::vector<size_t>{0}));
+  EXPECT_EQ(getRing(ring_index, 1), (std::vector<size_t>{2, 4}));
+}
+
+TEST(RingIndexTest, ReusedForAnotherCloud)
+{
+  RingIndex ring_index;
+  ring_index.build(RingView{{0, 1, 1, 1}}, 2);
+  ring_index.build(RingView{{1, 0}}, 3);
+
+  EXPECT_EQ(ring_index.num_rings(), 3u);
+  EXPECT_EQ(getRing(ring_index, 0), (std::vector<size_t>{1}));
+  EXPECT_EQ(getRing(ring_index, 1), (std::vector<size_t>{0}));
+  EXPECT_EQ(ring_index.ring_size(2), 0u);
+}
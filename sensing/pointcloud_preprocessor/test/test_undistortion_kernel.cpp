@@ -0,0 +1,84 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/distortion_corrector/undistortion_kernel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using pointcloud_preprocessor::undistortion::AffineTransform3f;
+
+namespace
+{
+AffineTransform3f createTransform(const float yaw, const float tx, const float ty, const float tz)
+{
+  AffineTransform3f transform;
+  transform.rotation[0] = std::cos(yaw);
+  transform.rotation[1] = -std::sin(yaw);
+  transform.rotation[3] = std::sin(yaw);
+  transform.rotation[4] = std::cos(yaw);
+  transform.translation[0] = tx;
+  transform.translation[1] = ty;
+  transform.translation[2] = tz;
+  return transform;
+}
+}  // namespace
+
+TEST(UndistortionKernel, MatchesScalarReference)
+{
+  // odd size to exercise the remainder loop of every instruction set
+  constexpr size_t num_points = 203;
+  std::vector<float> x(num_points), y(num_points), z(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    x[i] = 0.1f * static_cast<float>(i);
+    y[i] = -0.05f * static_cast<float>(i) + 3.0f;
+    z[i] = std::sin(static_cast<float>(i));
+  }
+  auto x_ref = x, y_ref = y, z_ref = z;
+
+  const auto transform = createTransform(0.3f, 1.0f, -2.0f, 0.5f);
+  pointcloud_preprocessor::undistortion::transformPoints(
+    transform, x.data(), y.data(), z.data(), num_points);
+  pointcloud_preprocessor::undistortion::transformPointsScalar(
+    transform, x_ref.data(), y_ref.data(), z_ref.data(), num_points);
+
+  for (size_t i = 0; i < num_points; ++i) {
+    EXPECT_NEAR(x[i], x_ref[i], 1e-5f);
+    EXPECT_NEAR(y[i], y_ref[i], 1e-5f);
+    EXPECT_NEAR(z[i], z_ref[i], 1e-5f);
+  }
+}
+
+TEST(UndistortionKernel, IdentityKeepsPoints)
+{
+  std::vector<float> x{1.0f, 2.0f, 3.0f}, y{4.0f, 5.0f, 6.0f}, z{7.0f, 8.0f, 9.0f};
+  pointcloud_preprocessor::undistortion::transformPoints(
+    AffineTransform3f{}, x.data(), y.data(), z.data(), x.size());
+  EXPECT_FLOAT_EQ(x[2], 3.0f);
+  EXPECT_FLOAT_EQ(y[1], 5.0f);
+  EXPECT_FLOAT_EQ(z[0], 7.0f);
+}
+
+TEST(UndistortionKernel, RotatesAroundZ)
+{
+  std::vector<float> x{1.0f}, y{0.0f}, z{2.0f};
+  pointcloud_preprocessor::undistortion::transformPoints(
+    createTransform(static_cast<float>(M_PI_2), 0.0f, 0.0f, 0.0f), x.data(), y.data(), z.data(),
+    x.size());
+  EXPECT_NEAR(x[0], 0.0f, 1e-6f);
+  EXPECT_NEAR(y[0], 1.0f, 1e-6f);
+  EXPECT_NEAR(z[0], 2.0f, 1e-6f);
+}
@@ -0,0 +1,100 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RADAR_FILTER_PIPELINE__RADAR_FILTER_PIPELINE_NODE_HPP_
+#define RADAR_FILTER_PIPELINE__RADAR_FILTER_PIPELINE_NODE_HPP_
+
+#include "radar_filter_pipeline/radar_filters.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <nav_msgs/msg/odometry.hpp>
+#include <radar_msgs/msg/radar_scan.hpp>
+#include <radar_msgs/msg/radar_tracks.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace radar_filter_pipeline
+{
+using nav_msgs::msg::Odometry;
+using radar_msgs::msg::RadarScan;
+using radar_msgs::msg::RadarTracks;
+using sensor_msgs::msg::PointCloud2;
+
+/**
+ * @brief one node filtering the scans and the tracks of several radars, in place of a chain of
+ * radar_threshold_filter, radar_static_pointcloud_filter, radar_scan_to_pointcloud2 and
+ * radar_tracks_noise_filter per radar
+ * @details each radar has its own output messages, which are reused over the frames
+ */
+class RadarFilterPipelineNode : public rclcpp::Node
+{
+public:
+  explicit RadarFilterPipelineNode(const rclcpp::NodeOptions & node_options);
+
+  struct NodeParam
+  {
+    ThresholdFilter::Param threshold_param{};
+    bool is_static_filter{};
+    StaticFilter::Param static_param{};
+    bool publish_amplitude_pointcloud{};
+    bool publish_doppler_pointcloud{};
+    double velocity_y_threshold{};
+  };
+
+private:
+  struct ScanChannel
+  {
+    rclcpp::Subscription<RadarScan>::SharedPtr sub_radar{};
+    rclcpp::Publisher<RadarScan>::SharedPtr pub_radar{};
+    rclcpp::Publisher<PointCloud2>::SharedPtr pub_amplitude_pointcloud{};
+    rclcpp::Publisher<PointCloud2>::SharedPtr pub_doppler_pointcloud{};
+    RadarScan output{};
+    PointCloud2 pointcloud{};
+  };
+  struct TrackChannel
+  {
+    rclcpp::Subscription<RadarTracks>::SharedPtr sub_tracks{};
+    rclcpp::Publisher<RadarTracks>::SharedPtr pub_tracks{};
+    RadarTracks output{};
+  };
+
+  // Subscriber
+  rclcpp::Subscription<Odometry>::SharedPtr sub_odometry_{};
+  Odometry::ConstSharedPtr odometry_{};
+
+  // Callback
+  void onScan(const RadarScan::ConstSharedPtr msg, ScanChannel & channel);
+  void onTracks(const RadarTracks::ConstSharedPtr msg, TrackChannel & channel);
+
+  // Channel
+  // NOTE: The channels are held by unique_ptr since the callbacks refer to them.
+  std::vector<std::unique_ptr<ScanChannel>> scan_channels_{};
+  std::vector<std::unique_ptr<TrackChannel>> track_channels_{};
+
+  // Parameter Server
+  OnSetParametersCallbackHandle::SharedPtr set_param_res_;
+  rcl_interfaces::msg::SetParametersResult onSetParam(
+    const std::vector<rclcpp::Parameter> & params);
+
+  // Parameter
+  NodeParam node_param_{};
+};
+
+}  // namespace radar_filter_pipeline
+
+#endif  // RADAR_FILTER_PIPELINE__RADAR_FILTER_PIPELINE_NODE_HPP_
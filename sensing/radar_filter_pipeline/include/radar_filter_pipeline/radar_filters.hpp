@@ -0,0 +1,225 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RADAR_FILTER_PIPELINE__RADAR_FILTERS_HPP_
+#define RADAR_FILTER_PIPELINE__RADAR_FILTERS_HPP_
+
+#include <radar_msgs/msg/radar_return.hpp>
+#include <radar_msgs/msg/radar_scan.hpp>
+#include <radar_msgs/msg/radar_track.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace radar_filter_pipeline
+{
+using radar_msgs::msg::RadarReturn;
+using radar_msgs::msg::RadarScan;
+using radar_msgs::msg::RadarTrack;
+using sensor_msgs::msg::PointCloud2;
+
+/**
+ * @brief remove the elements rejected by the filter in place, keeping the order of the rest
+ * @details the capacity of the vector is kept, so that a reused vector does not allocate
+ */
+template <typename T, typename Filter>
+void filterInPlace(std::vector<T> & elements, const Filter & filter)
+{
+  elements.erase(
+    std::remove_if(
+      elements.begin(), elements.end(), [&filter](const T & element) { return !filter(element); }),
+    elements.end());
+}
+
+/**
+ * @brief keep the elements accepted by all the filters, in the order of the filters
+ */
+template <typename T, typename Filter, typename... Filters>
+void filterInPlace(std::vector<T> & elements, const Filter & filter, const Filters &... filters)
+{
+  filterInPlace(elements, filter);
+  filterInPlace(elements, filters...);
+}
+
+/** @brief same thresholds as radar_threshold_filter */
+class ThresholdFilter
+{
+public:
+  struct Param
+  {
+    bool is_amplitude_filter{};
+    double amplitude_min{};
+    double amplitude_max{};
+    bool is_range_filter{};
+    double range_min{};
+    double range_max{};
+    bool is_azimuth_filter{};
+    double azimuth_min{};
+    double azimuth_max{};
+    bool is_z_filter{};
+    double z_min{};
+    double z_max{};
+  };
+
+  explicit ThresholdFilter(const Param & param) : param_(param) {}
+
+  /** @brief true if the return is within all the enabled thresholds */
+  bool operator()(const RadarReturn & radar_return) const
+  {
+    if (
+      param_.is_amplitude_filter &&
+      !isWithin(radar_return.amplitude, param_.amplitude_max, param_.amplitude_min)) {
+      return false;
+    }
+    if (
+      param_.is_range_filter &&
+      !isWithin(radar_return.range, param_.range_max, param_.range_min)) {
+      return false;
+    }
+    if (
+      param_.is_azimuth_filter &&
+      !isWithin(radar_return.azimuth, param_.azimuth_max, param_.azimuth_min)) {
+      return false;
+    }
+    if (param_.is_z_filter) {
+      const auto z = radar_return.range * std::sin(radar_return.elevation);
+      if (!isWithin(z, param_.z_max, param_.z_min)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  static bool isWithin(const double value, const double max, const double min)
+  {
+    return min < value && value < max;
+  }
+
+  Param param_;
+};
+
+/**
+ * @brief same criterion as radar_static_pointcloud_filter, which compensates the doppler velocity
+ * along the azimuth with the ego velocity
+ */
+class StaticFilter
+{
+public:
+  struct Param
+  {
+    double doppler_velocity_sd{};
+    // keep the static returns instead of the dynamic ones
+    bool keep_static{};
+  };
+
+  explicit StaticFilter(const Param & param) : param_(param) {}
+
+  void setEgoVelocity(const double velocity_x) { ego_velocity_x_ = velocity_x; }
+
+  bool isStatic(const RadarReturn & radar_return) const
+  {
+    const double compensated_velocity_x =
+      radar_return.doppler_velocity * std::cos(radar_return.azimuth) + ego_velocity_x_;
+    return -param_.doppler_velocity_sd < compensated_velocity_x &&
+           compensated_velocity_x < param_.doppler_velocity_sd;
+  }
+
+  bool operator()(const RadarReturn & radar_return) const
+  {
+    return isStatic(radar_return) == param_.keep_static;
+  }
+
+private:
+  Param param_;
+  double ego_velocity_x_{0.0};
+};
+
+/** @brief same criterion as radar_tracks_noise_filter, the noise tracks are removed */
+class CrossingNoiseFilter
+{
+public:
+  explicit CrossingNoiseFilter(const double velocity_y_threshold)
+  : velocity_y_threshold_(velocity_y_threshold)
+  {
+  }
+
+  bool isNoise(const RadarTrack & radar_track) const
+  {
+    return !(std::abs(radar_track.velocity.y) < velocity_y_threshold_);
+  }
+
+  bool operator()(const RadarTrack & radar_track) const { return !isNoise(radar_track); }
+
+private:
+  double velocity_y_threshold_;
+};
+
+/**
+ * @brief write the returns to the pointcloud with the same layout as PointXYZI of
+ * radar_scan_to_pointcloud2, reusing the buffer of the pointcloud
+ * @param use_doppler_velocity true for the doppler velocity as the intensity, false for the
+ * amplitude
+ */
+inline void toPointcloud2(
+  const RadarScan & radar_scan, const bool use_doppler_velocity, PointCloud2 & pointcloud)
+{
+  using sensor_msgs::msg::PointField;
+  // same as pcl::toROSMsg() of pcl::PointXYZI: x, y and z in the first 16 bytes and the
+  // intensity in the next 16 bytes
+  constexpr uint32_t point_step = 32;
+  if (pointcloud.fields.size() != 4) {
+    const auto make_field = [](const char * name, const uint32_t offset) {
+      PointField field;
+      field.name = name;
+      field.offset = offset;
+      field.datatype = PointField::FLOAT32;
+      field.count = 1;
+      return field;
+    };
+    pointcloud.fields = {
+      make_field("x", 0), make_field("y", 4), make_field("z", 8), make_field("intensity", 16)};
+  }
+
+  const size_t points_num = radar_scan.returns.size();
+  pointcloud.header = radar_scan.header;
+  pointcloud.height = 1;
+  pointcloud.width = static_cast<uint32_t>(points_num);
+  pointcloud.is_bigendian = false;
+  pointcloud.is_dense = true;
+  pointcloud.point_step = point_step;
+  pointcloud.row_step = point_step * static_cast<uint32_t>(points_num);
+  pointcloud.data.resize(point_step * points_num);
+
+  uint8_t * data = pointcloud.data.data();
+  for (const auto & radar : radar_scan.returns) {
+    const float r_xy = radar.range * std::cos(radar.elevation);
+    const float xyz[4] = {
+      r_xy * std::cos(radar.azimuth), r_xy * std::sin(radar.azimuth),
+      radar.range * std::sin(radar.elevation), 1.0f};
+    const float intensity[4] = {
+      use_doppler_velocity ? radar.doppler_velocity : radar.amplitude, 0.0f, 0.0f, 0.0f};
+    std::memcpy(data, xyz, sizeof(xyz));
+    std::memcpy(data + 16, intensity, sizeof(intensity));
+    data += point_step;
+  }
+}
+}  // namespace radar_filter_pipeline
+
+#endif  // RADAR_FILTER_PIPELINE__RADAR_FILTERS_HPP_
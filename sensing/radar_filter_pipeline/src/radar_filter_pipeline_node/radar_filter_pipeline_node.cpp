@@ -0,0 +1,198 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "radar_filter_pipeline/radar_filter_pipeline_node.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using std::placeholders::_1;
+
+namespace
+{
+template <class T>
+bool update_param(
+  const std::vector<rclcpp::Parameter> & params, const std::string & name, T & value)
+{
+  const auto itr = std::find_if(
+    params.cbegin(), params.cend(),
+    [&name](const rclcpp::Parameter & p) { return p.get_name() == name; });
+
+  // Not found
+  if (itr == params.cend()) {
+    return false;
+  }
+
+  value = itr->template get_value<T>();
+  return true;
+}
+}  // namespace
+
+namespace radar_filter_pipeline
+{
+RadarFilterPipelineNode::RadarFilterPipelineNode(const rclcpp::NodeOptions & node_options)
+: Node("radar_filter_pipeline", node_options)
+{
+  // Parameter Server
+  set_param_res_ = this->add_on_set_parameters_callback(
+    std::bind(&RadarFilterPipelineNode::onSetParam, this, _1));
+
+  // Node Parameter
+  {
+    auto & p = node_param_.threshold_param;
+    p.is_amplitude_filter = declare_parameter<bool>("node_params.is_amplitude_filter");
+    p.amplitude_min = declare_parameter<double>("node_params.amplitude_min");
+    p.amplitude_max = declare_parameter<double>("node_params.amplitude_max");
+    p.is_range_filter = declare_parameter<bool>("node_params.is_range_filter");
+    p.range_min = declare_parameter<double>("node_params.range_min");
+    p.range_max = declare_parameter<double>("node_params.range_max");
+    p.is_azimuth_filter = declare_parameter<bool>("node_params.is_azimuth_filter");
+    p.azimuth_min = declare_parameter<double>("node_params.azimuth_min");
+    p.azimuth_max = declare_parameter<double>("node_params.azimuth_max");
+    p.is_z_filter = declare_parameter<bool>("node_params.is_z_filter");
+    p.z_min = declare_parameter<double>("node_params.z_min");
+    p.z_max = declare_parameter<double>("node_params.z_max");
+  }
+  node_param_.is_static_filter = declare_parameter<bool>("node_params.is_static_filter");
+  node_param_.static_param.doppler_velocity_sd =
+    declare_parameter<double>("node_params.doppler_velocity_sd");
+  node_param_.static_param.keep_static = declare_parameter<bool>("node_params.keep_static");
+  node_param_.publish_amplitude_pointcloud =
+    declare_parameter<bool>("node_params.publish_amplitude_pointcloud");
+  node_param_.publish_doppler_pointcloud =
+    declare_parameter<bool>("node_params.publish_doppler_pointcloud");
+  node_param_.velocity_y_threshold = declare_parameter<double>("node_params.velocity_y_threshold");
+
+  const auto radar_names = declare_parameter<std::vector<std::string>>("radar_names");
+  const auto track_names = declare_parameter<std::vector<std::string>>("track_names");
+
+  // Subscriber
+  // NOTE: The latest odometry is used for all the radars instead of a synchronizer per radar,
+  //       since the ego velocity changes little in a radar cycle.
+  if (node_param_.is_static_filter) {
+    sub_odometry_ = create_subscription<Odometry>(
+      "~/input/odometry", rclcpp::QoS{1},
+      [this](const Odometry::ConstSharedPtr msg) { odometry_ = msg; });
+  }
+
+  for (const auto & name : radar_names) {
+    scan_channels_.push_back(std::make_unique<ScanChannel>());
+    auto & channel = *scan_channels_.back();
+    channel.sub_radar = create_subscription<RadarScan>(
+      "~/input/" + name + "/radar", rclcpp::QoS{1},
+      [this, &channel](const RadarScan::ConstSharedPtr msg) { onScan(msg, channel); });
+    channel.pub_radar = create_publisher<RadarScan>("~/output/" + name + "/radar", 1);
+    if (node_param_.publish_amplitude_pointcloud) {
+      channel.pub_amplitude_pointcloud =
+        create_publisher<PointCloud2>("~/output/" + name + "/amplitude_pointcloud", 1);
+    }
+    if (node_param_.publish_doppler_pointcloud) {
+      channel.pub_doppler_pointcloud =
+        create_publisher<PointCloud2>("~/output/" + name + "/doppler_pointcloud", 1);
+    }
+  }
+
+  for (const auto & name : track_names) {
+    track_channels_.push_back(std::make_unique<TrackChannel>());
+    auto & channel = *track_channels_.back();
+    channel.sub_tracks = create_subscription<RadarTracks>(
+      "~/input/" + name + "/tracks", rclcpp::QoS{1},
+      [this, &channel](const RadarTracks::ConstSharedPtr msg) { onTracks(msg, channel); });
+    channel.pub_tracks = create_publisher<RadarTracks>("~/output/" + name + "/tracks", 1);
+  }
+}
+
+rcl_interfaces::msg::SetParametersResult RadarFilterPipelineNode::onSetParam(
+  const std::vector<rclcpp::Parameter> & params)
+{
+  rcl_interfaces::msg::SetParametersResult result;
+  try {
+    {
+      auto & p = node_param_.threshold_param;
+      update_param(params, "node_params.is_amplitude_filter", p.is_amplitude_filter);
+      update_param(params, "node_params.amplitude_min", p.amplitude_min);
+      update_param(params, "node_params.amplitude_max", p.amplitude_max);
+      update_param(params, "node_params.is_range_filter", p.is_range_filter);
+      update_param(params, "node_params.range_min", p.range_min);
+      update_param(params, "node_params.range_max", p.range_max);
+      update_param(params, "node_params.is_azimuth_filter", p.is_azimuth_filter);
+      update_param(params, "node_params.azimuth_min", p.azimuth_min);
+      update_param(params, "node_params.azimuth_max", p.azimuth_max);
+      update_param(params, "node_params.is_z_filter", p.is_z_filter);
+      update_param(params, "node_params.z_min", p.z_min);
+      update_param(params, "node_params.z_max", p.z_max);
+    }
+    {
+      auto & p = node_param_;
+      update_param(params, "node_params.doppler_velocity_sd", p.static_param.doppler_velocity_sd);
+      update_param(params, "node_params.keep_static", p.static_param.keep_static);
+      update_param(params, "node_params.velocity_y_threshold", p.velocity_y_threshold);
+    }
+  } catch (const rclcpp::exceptions::InvalidParameterTypeException & e) {
+    result.successful = false;
+    result.reason = e.what();
+    return result;
+  }
+  result.successful = true;
+  result.reason = "success";
+  return result;
+}
+
+void RadarFilterPipelineNode::onScan(const RadarScan::ConstSharedPtr msg, ScanChannel & channel)
+{
+  // NOTE: assign() keeps the capacity of the reused output, so that the returns are not
+  //       allocated once the output has seen the largest scan.
+  auto & output = channel.output;
+  output.header = msg->header;
+  output.returns.assign(msg->returns.begin(), msg->returns.end());
+
+  const ThresholdFilter threshold_filter(node_param_.threshold_param);
+  if (node_param_.is_static_filter) {
+    if (!odometry_) {
+      RCLCPP_WARN_THROTTLE(get_logger(), *get_clock(), 5000, "waiting for odometry");
+      return;
+    }
+    StaticFilter static_filter(node_param_.static_param);
+    static_filter.setEgoVelocity(odometry_->twist.twist.linear.x);
+    filterInPlace(output.returns, threshold_filter, static_filter);
+  } else {
+    filterInPlace(output.returns, threshold_filter);
+  }
+
+  channel.pub_radar->publish(output);
+  if (channel.pub_amplitude_pointcloud) {
+    toPointcloud2(output, false, channel.pointcloud);
+    channel.pub_amplitude_pointcloud->publish(channel.pointcloud);
+  }
+  if (channel.pub_doppler_pointcloud) {
+    toPointcloud2(output, true, channel.pointcloud);
+    channel.pub_doppler_pointcloud->publish(channel.pointcloud);
+  }
+}
+
+void RadarFilterPipelineNode::onTracks(
+  const RadarTracks::ConstSharedPtr msg, TrackChannel & channel)
+{
+  auto & output = channel.output;
+  output.header = msg->header;
+  output.tracks.assign(msg->tracks.begin(), msg->tracks.end());
+  filterInPlace(output.tracks, CrossingNoiseFilter(node_param_.velocity_y_threshold));
+  channel.pub_tracks->publish(output);
+}
+
+}  // namespace radar_filter_pipeline
+
+#include "rclcpp_components/register_node_macro.hpp"
+RCLCPP_COMPONENTS_REGISTER_NODE(radar_filter_pipeline::RadarFilterPipelineNode)
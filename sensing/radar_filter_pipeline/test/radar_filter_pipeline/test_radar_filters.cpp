@@ -0,0 +1,144 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "radar_filter_pipeline/radar_filters.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+using radar_filter_pipeline::RadarReturn;
+using radar_filter_pipeline::RadarScan;
+using radar_filter_pipeline::RadarTrack;
+
+RadarReturn makeReturn(
+  const float range, const float azimuth, const float elevation, const float doppler_velocity,
+  const float amplitude)
+{
+  RadarReturn radar_return;
+  radar_return.range = range;
+  radar_return.azimuth = azimuth;
+  radar_return.elevation = elevation;
+  radar_return.doppler_velocity = doppler_velocity;
+  radar_return.amplitude = amplitude;
+  return radar_return;
+}
+}  // namespace
+
+TEST(RadarFilters, ThresholdFilter)
+{
+  using radar_filter_pipeline::ThresholdFilter;
+
+  ThresholdFilter::Param param;
+  param.is_amplitude_filter = true;
+  param.amplitude_min = -10.0;
+  param.amplitude_max = 100.0;
+  param.is_azimuth_filter = true;
+  param.azimuth_min = -1.2;
+  param.azimuth_max = 1.2;
+  param.is_z_filter = true;
+  param.z_min = -2.0;
+  param.z_max = 5.0;
+  const ThresholdFilter filter(param);
+
+  EXPECT_TRUE(filter(makeReturn(10.0f, 0.0f, 0.0f, 0.0f, 0.0f)));
+  EXPECT_FALSE(filter(makeReturn(10.0f, 0.0f, 0.0f, 0.0f, -100.0f)));
+  EXPECT_FALSE(filter(makeReturn(10.0f, 1.5f, 0.0f, 0.0f, 0.0f)));
+  // z = 10 * sin(1.0) > 5
+  EXPECT_FALSE(filter(makeReturn(10.0f, 0.0f, 1.0f, 0.0f, 0.0f)));
+  // the range filter is disabled
+  EXPECT_TRUE(filter(makeReturn(1000.0f, 0.0f, 0.0f, 0.0f, 0.0f)));
+}
+
+TEST(RadarFilters, StaticFilter)
+{
+  using radar_filter_pipeline::StaticFilter;
+
+  StaticFilter filter(StaticFilter::Param{1.0, false});
+  filter.setEgoVelocity(10.0);
+
+  // a return ahead approaching as fast as the ego vehicle moves is static
+  const auto static_return = makeReturn(10.0f, 0.0f, 0.0f, -10.0f, 0.0f);
+  const auto dynamic_return = makeReturn(10.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+  EXPECT_TRUE(filter.isStatic(static_return));
+  EXPECT_FALSE(filter.isStatic(dynamic_return));
+  EXPECT_FALSE(filter(static_return));
+  EXPECT_TRUE(filter(dynamic_return));
+
+  const StaticFilter static_filter(StaticFilter::Param{1.0, true});
+  // the ego velocity is 0, so that the return with no doppler velocity is static
+  EXPECT_TRUE(static_filter(dynamic_return));
+  EXPECT_FALSE(static_filter(static_return));
+}
+
+TEST(RadarFilters, CrossingNoiseFilter)
+{
+  const radar_filter_pipeline::CrossingNoiseFilter filter(7.0);
+
+  RadarTrack radar_track;
+  radar_track.velocity.y = 3.0;
+  EXPECT_FALSE(filter.isNoise(radar_track));
+  radar_track.velocity.y = -7.0;
+  EXPECT_TRUE(filter.isNoise(radar_track));
+  radar_track.velocity.y = 10.0;
+  EXPECT_FALSE(filter(radar_track));
+}
+
+TEST(RadarFilters, filterInPlace)
+{
+  using radar_filter_pipeline::filterInPlace;
+
+  std::vector<int> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  const auto capacity = values.capacity();
+  filterInPlace(
+    values, [](const int v) { return v % 2 == 0; }, [](const int v) { return v > 2; });
+  EXPECT_EQ(values, (std::vector<int>{4, 6, 8}));
+  EXPECT_EQ(values.capacity(), capacity);
+}
+
+TEST(RadarFilters, toPointcloud2)
+{
+  RadarScan radar_scan;
+  radar_scan.header.frame_id = "radar";
+  radar_scan.returns.push_back(makeReturn(10.0f, 0.0f, 0.0f, -3.0f, 20.0f));
+  radar_scan.returns.push_back(makeReturn(2.0f, 0.5f, 0.1f, 4.0f, 30.0f));
+
+  radar_filter_pipeline::PointCloud2 pointcloud;
+  for (const bool use_doppler_velocity : {false, true}) {
+    radar_filter_pipeline::toPointcloud2(radar_scan, use_doppler_velocity, pointcloud);
+    EXPECT_EQ(pointcloud.header.frame_id, "radar");
+    ASSERT_EQ(pointcloud.fields.size(), 4u);
+    EXPECT_EQ(pointcloud.fields[3].name, "intensity");
+    EXPECT_EQ(pointcloud.fields[3].offset, 16u);
+    EXPECT_EQ(pointcloud.width, 2u);
+    ASSERT_EQ(pointcloud.data.size(), 2u * pointcloud.point_step);
+
+    for (size_t i = 0; i < radar_scan.returns.size(); ++i) {
+      const auto & radar = radar_scan.returns[i];
+      float xyz[3];
+      float intensity;
+      std::memcpy(xyz, pointcloud.data.data() + i * pointcloud.point_step, sizeof(xyz));
+      std::memcpy(
+        &intensity, pointcloud.data.data() + i * pointcloud.point_step + 16, sizeof(intensity));
+      const float r_xy = radar.range * std::cos(radar.elevation);
+      EXPECT_FLOAT_EQ(xyz[0], r_xy * std::cos(radar.azimuth));
+      EXPECT_FLOAT_EQ(xyz[1], r_xy * std::sin(radar.azimuth));
+      EXPECT_FLOAT_EQ(xyz[2], radar.range * std::sin(radar.elevation));
+      EXPECT_FLOAT_EQ(intensity, use_doppler_velocity ? radar.doppler_velocity : radar.amplitude);
+    }
+  }
+}
@@ -88,9 +88,18 @@ public:
     pcl::PointCloud<pcl::PointXYZ>::Ptr & merged_pointcloud) const override;
 
 private:
+  // buffers of the 2D ray tracing, which are shared by the objects in a frame
+  struct RayBuffer
+  {
+    std::vector<double> ranges;
+    std::vector<int> indices;
+    std::vector<int> hit_ray_indices;
+  };
+
   void create_object_pointcloud(
     const ObjectInfo & obj_info, const tf2::Transform & tf_base_link2map,
-    std::mt19937 & random_generator, pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud) const;
+    std::mt19937 & random_generator, RayBuffer & ray_buffer,
+    pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud) const;
 
   bool enable_ray_tracing_;
 };
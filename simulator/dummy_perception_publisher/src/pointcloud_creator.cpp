@@ -21,6 +21,7 @@
 #include <tf2/LinearMath/Transform.h>
 #include <tf2/LinearMath/Vector3.h>
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -36,6 +37,7 @@ static constexpr double vertical_max_theta = (15.0 / 180.0) * M_PI;
 static constexpr double horizontal_theta_step = (0.1 / 180.0) * M_PI;
 static constexpr double horizontal_min_theta = (-180.0 / 180.0) * M_PI;
 static constexpr double horizontal_max_theta = (180.0 / 180.0) * M_PI;
+static constexpr double sphere_tracing_eps = 1e-2;
 
 pcl::PointXYZ getPointWrtBaseLink(
   const tf2::Transform & tf_base_link2moved_object, double x, double y, double z)
@@ -48,7 +50,8 @@ pcl::PointXYZ getPointWrtBaseLink(
 
 void ObjectCentricPointCloudCreator::create_object_pointcloud(
   const ObjectInfo & obj_info, const tf2::Transform & tf_base_link2map,
-  std::mt19937 & random_generator, pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud) const
+  std::mt19937 & random_generator, RayBuffer & ray_buffer,
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud) const
 {
   std::normal_distribution<> x_random(0.0, obj_info.std_dev_x);
   std::normal_distribution<> y_random(0.0, obj_info.std_dev_y);
@@ -93,13 +96,20 @@ void ObjectCentricPointCloudCreator::create_object_pointcloud(
     }
   }
   // 2D ray tracing
+  // NOTE: The buffers are shared by all the objects, and only the rays which the object hits are
+  //       visited and reset, since an object covers a small part of the rays in general.
   size_t ranges_size =
     std::ceil((horizontal_max_theta - horizontal_min_theta) / horizontal_theta_step);
-  std::vector<double> horizontal_ray_traced_2d_pointcloud;
-  horizontal_ray_traced_2d_pointcloud.assign(ranges_size, std::numeric_limits<double>::infinity());
+  auto & horizontal_ray_traced_2d_pointcloud = ray_buffer.ranges;
+  auto & horizontal_ray_traced_pointcloud_indices = ray_buffer.indices;
+  auto & hit_ray_indices = ray_buffer.hit_ray_indices;
   const int no_data = -1;
-  std::vector<int> horizontal_ray_traced_pointcloud_indices;
-  horizontal_ray_traced_pointcloud_indices.assign(ranges_size, no_data);
+  if (horizontal_ray_traced_2d_pointcloud.size() != ranges_size) {
+    horizontal_ray_traced_2d_pointcloud.assign(
+      ranges_size, std::numeric_limits<double>::infinity());
+    horizontal_ray_traced_pointcloud_indices.assign(ranges_size, no_data);
+  }
+  hit_ray_indices.clear();
   for (size_t i = 0; i < horizontal_candidate_pointcloud.points.size(); ++i) {
     double angle =
       std::atan2(horizontal_candidate_pointcloud.at(i).y, horizontal_candidate_pointcloud.at(i).x);
@@ -109,31 +119,41 @@ void ObjectCentricPointCloudCreator::create_object_pointcloud(
       continue;
     }
     int index = (angle - horizontal_min_theta) / horizontal_theta_step;
+    if (horizontal_ray_traced_pointcloud_indices.at(index) == no_data) {
+      hit_ray_indices.push_back(index);
+    }
     if (range < horizontal_ray_traced_2d_pointcloud[index]) {
       horizontal_ray_traced_2d_pointcloud[index] = range;
       horizontal_ray_traced_pointcloud_indices.at(index) = i;
     }
   }
 
-  for (const auto & pointcloud_index : horizontal_ray_traced_pointcloud_indices) {
-    if (pointcloud_index != no_data) {
-      // generate vertical point
-      horizontal_pointcloud.push_back(horizontal_candidate_pointcloud.at(pointcloud_index));
-      const double distance = std::hypot(
-        horizontal_candidate_pointcloud.at(pointcloud_index).x,
-        horizontal_candidate_pointcloud.at(pointcloud_index).y);
-      for (double vertical_theta = vertical_min_theta;
-           vertical_theta <= vertical_max_theta + epsilon; vertical_theta += vertical_theta_step) {
-        const double z = distance * std::tan(vertical_theta);
-        if (min_z <= z && z <= max_z + epsilon) {
-          pcl::PointXYZ point;
-          point.x =
-            horizontal_candidate_pointcloud.at(pointcloud_index).x + x_random(random_generator);
-          point.y =
-            horizontal_candidate_pointcloud.at(pointcloud_index).y + y_random(random_generator);
-          point.z = z + z_random(random_generator);
-          pointcloud->push_back(point);
-        }
+  // Visit the rays in the order of the angle, which is the same as the order of the points
+  std::sort(hit_ray_indices.begin(), hit_ray_indices.end());
+  for (const auto ray_index : hit_ray_indices) {
+    const int pointcloud_index = horizontal_ray_traced_pointcloud_indices.at(ray_index);
+    horizontal_ray_traced_2d_pointcloud[ray_index] = std::numeric_limits<double>::infinity();
+    horizontal_ray_traced_pointcloud_indices.at(ray_index) = no_data;
+    if (pointcloud_index == no_data) {
+      continue;
+    }
+
+    // generate vertical point
+    horizontal_pointcloud.push_back(horizontal_candidate_pointcloud.at(pointcloud_index));
+    const double distance = std::hypot(
+      horizontal_candidate_pointcloud.at(pointcloud_index).x,
+      horizontal_candidate_pointcloud.at(pointcloud_index).y);
+    for (double vertical_theta = vertical_min_theta; vertical_theta <= vertical_max_theta + epsilon;
+         vertical_theta += vertical_theta_step) {
+      const double z = distance * std::tan(vertical_theta);
+      if (min_z <= z && z <= max_z + epsilon) {
+        pcl::PointXYZ point;
+        point.x =
+          horizontal_candidate_pointcloud.at(pointcloud_index).x + x_random(random_generator);
+        point.y =
+          horizontal_candidate_pointcloud.at(pointcloud_index).y + y_random(random_generator);
+        point.z = z + z_random(random_generator);
+        pointcloud->push_back(point);
       }
     }
   }
@@ -146,10 +166,11 @@ std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> ObjectCentricPointCloudCreator:
   std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> pointclouds_tmp;
   pcl::PointCloud<pcl::PointXYZ>::Ptr merged_pointcloud_tmp(new pcl::PointCloud<pcl::PointXYZ>);
 
+  RayBuffer ray_buffer;
   for (const auto & obj_info : obj_infos) {
     pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_shared_ptr(new pcl::PointCloud<pcl::PointXYZ>);
     this->create_object_pointcloud(
-      obj_info, tf_base_link2map, random_generator, pointcloud_shared_ptr);
+      obj_info, tf_base_link2map, random_generator, ray_buffer, pointcloud_shared_ptr);
     pointclouds_tmp.push_back(pointcloud_shared_ptr);
   }
 
@@ -199,13 +220,20 @@ std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> EgoCentricPointCloudCreator::cr
   const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
   std::mt19937 & random_generator, pcl::PointCloud<pcl::PointXYZ>::Ptr & merged_pointcloud) const
 {
-  std::vector<std::shared_ptr<signed_distance_function::AbstractSignedDistanceFunction>> sdf_ptrs;
+  using SignedDistanceFunctionPtr =
+    std::shared_ptr<signed_distance_function::AbstractSignedDistanceFunction>;
+  std::vector<SignedDistanceFunctionPtr> sdf_ptrs;
+  std::vector<tf2::Vector3> centers;
+  std::vector<double> radii;
   for (const auto & obj_info : obj_infos) {
+    const auto tf_base_link2moved_object = tf_base_link2map * obj_info.tf_map2moved_object;
     const auto sdf_ptr = std::make_shared<signed_distance_function::BoxSDF>(
-      obj_info.length, obj_info.width, tf_base_link2map * obj_info.tf_map2moved_object);
+      obj_info.length, obj_info.width, tf_base_link2moved_object);
     sdf_ptrs.push_back(sdf_ptr);
+    centers.push_back(tf_base_link2moved_object.getOrigin());
+    // the bounding circle with the tolerance of the sphere tracing
+    radii.push_back(0.5 * std::hypot(obj_info.length, obj_info.width) + sphere_tracing_eps);
   }
-  const auto composite_sdf = signed_distance_function::CompositeSDF(sdf_ptrs);
 
   std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> pointclouds(obj_infos.size());
   for (size_t i = 0; i < obj_infos.size(); ++i) {
@@ -224,16 +252,40 @@ std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> EgoCentricPointCloudCreator::cr
     max_zs.at(idx) = max_z;
   }
 
+  // NOTE: Each ray is traced only with the objects whose bounding circle intersects the ray, since
+  //       the cost of the sphere tracing is proportional to the number of the objects.
+  std::vector<SignedDistanceFunctionPtr> ray_sdf_ptrs;
+  std::vector<size_t> ray_object_indices;
   double angle = 0.0;
   const auto n_scan = static_cast<size_t>(std::floor(2 * M_PI / horizontal_theta_step));
   for (size_t i = 0; i < n_scan; ++i) {
     angle += horizontal_theta_step;
-    const auto dist = composite_sdf.getSphereTracingDist(0.0, 0.0, angle, visible_range_);
+    const double dir_x = cos(angle);
+    const double dir_y = sin(angle);
+
+    ray_sdf_ptrs.clear();
+    ray_object_indices.clear();
+    for (size_t idx = 0; idx < obj_infos.size(); ++idx) {
+      const double along = centers.at(idx).x() * dir_x + centers.at(idx).y() * dir_y;
+      const double across = centers.at(idx).y() * dir_x - centers.at(idx).x() * dir_y;
+      if (along < -radii.at(idx) || std::abs(across) > radii.at(idx)) {
+        continue;
+      }
+      ray_sdf_ptrs.push_back(sdf_ptrs.at(idx));
+      ray_object_indices.push_back(idx);
+    }
+    if (ray_sdf_ptrs.empty()) {
+      continue;
+    }
+
+    const auto composite_sdf = signed_distance_function::CompositeSDF(ray_sdf_ptrs);
+    const auto dist = composite_sdf.getSphereTracingDist(
+      0.0, 0.0, angle, visible_range_, sphere_tracing_eps);
 
     if (std::isfinite(dist)) {
-      const auto x_hit = dist * cos(angle);
-      const auto y_hit = dist * sin(angle);
-      const auto idx_hit = composite_sdf.nearest_sdf_index(x_hit, y_hit);
+      const auto x_hit = dist * dir_x;
+      const auto y_hit = dist * dir_y;
+      const auto idx_hit = ray_object_indices.at(composite_sdf.nearest_sdf_index(x_hit, y_hit));
       const auto obj_info_here = obj_infos.at(idx_hit);
       const auto min_z_here = min_zs.at(idx_hit);
       const auto max_z_here = max_zs.at(idx_hit);
@@ -16,6 +16,7 @@
 
 #include <tf2/LinearMath/Vector3.h>
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 
@@ -70,8 +71,12 @@ double BoxSDF::operator()(double x, double y) const
 
 double CompositeSDF::operator()(double x, double y) const
 {
-  const size_t nearest_idx = nearest_sdf_index(x, y);
-  return sdf_ptrs_.at(nearest_idx)->operator()(x, y);
+  // Take the minimum directly not to evaluate the nearest function twice
+  double min_value = std::numeric_limits<double>::infinity();
+  for (const auto & sdf_ptr : sdf_ptrs_) {
+    min_value = std::min(min_value, sdf_ptr->operator()(x, y));
+  }
+  return min_value;
 }
 
 size_t CompositeSDF::nearest_sdf_index(double x, double y) const
@@ -36,6 +36,7 @@ class __attribute__((visibility("default"))) InterconnectedModel
   // Vector of unique names of inputs and outputs of sub-models
   std::vector<char *> signals_vec_names;
   std::vector<double> model_signals_vec;
+  std::vector<double> model_signals_vec_next;  // buffer of the next signals, reused in every step
   int num_signals;
 
   std::vector<std::unique_ptr<SubModelInterface>> submodels;
@@ -21,6 +21,15 @@
 std::vector<double> fillVectorUsingMap(
   std::vector<double> vector1, std::vector<double> vector2, std::vector<int> map, bool inverse);
 
+/**
+ * @brief copy the mapped values of "source" to "target" without allocation
+ * @param [out] target vector to fill, whose index is the index in "map"
+ * @param [in] source vector of the values, whose index is the value in "map"
+ * @param [in] map connections created by createConnectionsMap(), -1 if not connected
+ */
+void fillVectorInPlace(
+  std::vector<double> & target, const std::vector<double> & source, const std::vector<int> & map);
+
 std::vector<int> createConnectionsMap(
   std::vector<char *> connection_names_1, std::vector<char *> connection_names_2);
 
@@ -40,6 +40,11 @@ private:
   int num_outputs_py;
 
   py::object py_model_class;
+  py::object py_model_forward;  // bound "forward" method, looked up only once
+
+  // buffers of the inputs and the state of the python model, reused in every step
+  std::vector<double> py_inputs;
+  std::vector<double> py_state;
 
   std::vector<int>
     map_sig_vec_to_py_model_inputs;  // index in "map_sig_vec_to_py_model_inputs" is index in
@@ -68,7 +73,8 @@ public:
    * @param [in] model_signals_vec all available inputs from PSIM
    */
   std::vector<double> getNextState(
-    std::vector<double> model_signals_vec, std::vector<double> model_signals_vec_next) override;
+    const std::vector<double> & model_signals_vec,
+    std::vector<double> model_signals_vec_next) override;
 
   /**
    * @brief set time step of the model
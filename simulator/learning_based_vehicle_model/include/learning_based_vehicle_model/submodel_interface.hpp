@@ -54,7 +54,8 @@ public:
    * @param [in] model_signals_vec_next values of signals in model signal vector to update
    */
   virtual std::vector<double> getNextState(
-    std::vector<double> model_signals_vec, std::vector<double> model_signals_vec_next) = 0;
+    const std::vector<double> & model_signals_vec,
+    std::vector<double> model_signals_vec_next) = 0;
 };
 
 #endif  // LEARNING_BASED_VEHICLE_MODEL__SUBMODEL_INTERFACE_HPP_
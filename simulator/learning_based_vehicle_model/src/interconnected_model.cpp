@@ -14,6 +14,9 @@
 
 #include "learning_based_vehicle_model/interconnected_model.hpp"
 
+#include <utility>
+#include <vector>
+
 void InterconnectedModel::mapInputs(std::vector<char *> in_names)
 {
   // index in "map_in_to_sig_vec" is index in "in_names" and value in "map_in_to_sig_vec" is index
@@ -120,19 +123,21 @@ std::vector<double> InterconnectedModel::updatePyModel(std::vector<double> psim_
   }
 
   // Compute forward pass through all models (order should not matter)
-  std::vector<double> model_signals_vec_next = model_signals_vec;
+  // NOTE: The vector is moved through the sub-models to avoid copying it for each of them.
+  model_signals_vec_next = model_signals_vec;
   for (auto & submodel : submodels) {
-    model_signals_vec_next = submodel->getNextState(model_signals_vec, model_signals_vec_next);
+    model_signals_vec_next =
+      submodel->getNextState(model_signals_vec, std::move(model_signals_vec_next));
   }
 
   // Map vector of all variables to
-  std::vector<double> psim_next_state;
+  std::vector<double> psim_next_state(map_sig_vec_to_out.size());
   for (size_t PSIM_STATE_IDX = 0; PSIM_STATE_IDX < map_sig_vec_to_out.size(); PSIM_STATE_IDX++) {
-    psim_next_state.push_back(model_signals_vec_next[map_sig_vec_to_out[PSIM_STATE_IDX]]);
+    psim_next_state[PSIM_STATE_IDX] = model_signals_vec_next[map_sig_vec_to_out[PSIM_STATE_IDX]];
   }
 
   // Update vector of all variables
-  model_signals_vec = model_signals_vec_next;
+  model_signals_vec.swap(model_signals_vec_next);
 
   return psim_next_state;
 }
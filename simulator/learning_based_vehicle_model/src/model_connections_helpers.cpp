@@ -26,6 +26,15 @@ std::vector<double> fillVectorUsingMap(
   return inverse ? vector1 : vector2;
 }
 
+void fillVectorInPlace(
+  std::vector<double> & target, const std::vector<double> & source, const std::vector<int> & map)
+{
+  for (std::size_t idx = 0; idx < map.size(); idx++) {
+    if (map[idx] == -1) continue;
+    target[idx] = source[map[idx]];
+  }
+}
+
 std::vector<int> createConnectionsMap(
   std::vector<char *> connection_names_1, std::vector<char *> connection_names_2)
 {
@@ -31,6 +31,7 @@ SimplePyModel::SimplePyModel(
     py::module_ imported_module = py::module_::import(py_model_import_name.c_str());
     // Initialize model class from imported module
     py_model_class = imported_module.attr(py_class_name.c_str())();
+    py_model_forward = py_model_class.attr("forward");
   } else {
     return;
   }
@@ -61,24 +62,25 @@ SimplePyModel::SimplePyModel(
 }
 
 std::vector<double> SimplePyModel::getNextState(
-  std::vector<double> model_signals_vec, std::vector<double> model_signals_vec_next)
+  const std::vector<double> & model_signals_vec, std::vector<double> model_signals_vec_next)
 {
   // get inputs and states of the python model from the vector of signals
-  std::vector<double> py_inputs(num_inputs_py);
-  std::vector<double> py_state(num_outputs_py);
-  py_inputs =
-    fillVectorUsingMap(py_inputs, model_signals_vec, map_sig_vec_to_py_model_inputs, true);
-  py_state = fillVectorUsingMap(py_state, model_signals_vec, map_py_model_outputs_to_sig_vec, true);
+  py_inputs.resize(num_inputs_py);
+  py_state.resize(num_outputs_py);
+  fillVectorInPlace(py_inputs, model_signals_vec, map_sig_vec_to_py_model_inputs);
+  fillVectorInPlace(py_state, model_signals_vec, map_py_model_outputs_to_sig_vec);
 
   // forward pass through the base model
-  py::tuple res = py_model_class.attr("forward")(py_inputs, py_state);
-  std::vector<double> py_state_next = res.cast<std::vector<double>>();
+  py::tuple res = py_model_forward(py_inputs, py_state);
+  const std::vector<double> py_state_next = res.cast<std::vector<double>>();
 
   // map outputs from python model to required outputs
-  std::vector<double> next_state = fillVectorUsingMap(
-    py_state_next, model_signals_vec_next, map_py_model_outputs_to_sig_vec, false);
-
-  return next_state;
+  const auto & map = map_py_model_outputs_to_sig_vec;
+  for (std::size_t idx = 0; idx < map.size() && idx < py_state_next.size(); idx++) {
+    if (map[idx] == -1) continue;
+    model_signals_vec_next[map[idx]] = py_state_next[idx];
+  }
+  return model_signals_vec_next;
 }
 
 void SimplePyModel::dtSet(double dt)
@@ -159,6 +159,11 @@ private:
 
   uint32_t timer_sampling_time_ms_;        //!< @brief timer sampling time
   rclcpp::TimerBase::SharedPtr on_timer_;  //!< @brief timer for simulation
+  bool enable_fixed_time_step_;            //!< @brief flag to simulate by the fixed time step
+  int max_steps_per_cycle_;                //!< @brief max number of the fixed steps in a cycle
+  int publish_decimation_;                 //!< @brief number of cycles to publish the state once
+  int publish_count_ = 0;                  //!< @brief number of cycles since the last publish
+  int64_t remaining_time_ns_ = 0;          //!< @brief time not simulated in the fixed step mode
 
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
   rcl_interfaces::msg::SetParametersResult on_parameter(
@@ -302,6 +307,12 @@ private:
    */
   void on_timer();
 
+  /**
+   * @brief update the vehicle model by the fixed time step for the elapsed time
+   * @param [in] dt elapsed time since the last cycle
+   */
+  void update_with_fixed_time_step(const double dt);
+
   /**
    * @brief initialize vehicle_model_ptr
    */
@@ -167,6 +167,9 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
     std::bind(&SimplePlanningSimulator::on_parameter, this, _1));
 
   timer_sampling_time_ms_ = static_cast<uint32_t>(declare_parameter("timer_sampling_time_ms", 25));
+  enable_fixed_time_step_ = declare_parameter("enable_fixed_time_step", false);
+  max_steps_per_cycle_ = std::max(declare_parameter("max_steps_per_cycle", 10), 1);
+  publish_decimation_ = std::max(declare_parameter("publish_decimation", 1), 1);
   on_timer_ = rclcpp::create_timer(
     this, get_clock(), std::chrono::milliseconds(timer_sampling_time_ms_),
     std::bind(&SimplePlanningSimulator::on_timer, this));
@@ -381,7 +384,11 @@ void SimplePlanningSimulator::on_timer()
       set_input(current_manual_ackermann_cmd_, acc_by_slope);
     }
 
-    if (simulate_motion_) {
+    if (!simulate_motion_) {
+      remaining_time_ns_ = 0;
+    } else if (enable_fixed_time_step_) {
+      update_with_fixed_time_step(dt);
+    } else {
       vehicle_model_ptr_->update(dt);
     }
   }
@@ -407,6 +414,10 @@ void SimplePlanningSimulator::on_timer()
   }
 
   // publish vehicle state
+  if (++publish_count_ < publish_decimation_) {
+    return;
+  }
+  publish_count_ = 0;
   publish_odometry(current_odometry_);
   publish_velocity(current_velocity_);
   publish_steering(current_steer_);
@@ -420,6 +431,23 @@ void SimplePlanningSimulator::on_timer()
   publish_tf(current_odometry_);
 }
 
+void SimplePlanningSimulator::update_with_fixed_time_step(const double dt)
+{
+  // NOTE: The time is accumulated in nanoseconds so that the number of steps only depends on the
+  //       clock, even if the clock is published faster than real time and the timer is delayed.
+  const int64_t step_ns = static_cast<int64_t>(timer_sampling_time_ms_) * 1000000;
+  remaining_time_ns_ = std::max(remaining_time_ns_ + std::llround(dt * 1e9), int64_t{0});
+
+  const int64_t num_steps = std::min(remaining_time_ns_ / step_ns, int64_t{max_steps_per_cycle_});
+  for (int64_t i = 0; i < num_steps; ++i) {
+    vehicle_model_ptr_->update(step_ns * 1e-9);
+  }
+
+  // Drop the time exceeding the max steps not to fall behind the clock
+  remaining_time_ns_ =
+    (num_steps == max_steps_per_cycle_) ? 0 : remaining_time_ns_ - num_steps * step_ns;
+}
+
 void SimplePlanningSimulator::on_map(const HADMapBin::ConstSharedPtr msg)
 {
   auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
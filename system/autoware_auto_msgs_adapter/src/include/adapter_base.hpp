@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace autoware_auto_msgs_adapter
 {
@@ -46,9 +47,11 @@ private:
   typename rclcpp::Publisher<TargetT>::SharedPtr pub_target_;
   typename rclcpp::Subscription<SourceT>::SharedPtr sub_source_;
 
-  void callback(const typename SourceT::SharedPtr msg_source)
+  void callback(const typename SourceT::ConstSharedPtr msg_source)
   {
-    pub_target_->publish(convert(*msg_source));
+    // NOTE: The converted message is published as unique_ptr, so that it is moved to an
+    //       intra-process subscriber in the same container instead of being copied.
+    pub_target_->publish(std::make_unique<TargetT>(convert(*msg_source)));
   }
 };
 
@@ -47,47 +47,39 @@ protected:
     Objects_auto msg_auto;
     msg_auto.header = msg_source.header;
 
-    autoware_auto_perception_msgs::msg::PredictedObject object_auto;
-    for (size_t it_of_objects = 0; it_of_objects < msg_source.objects.size(); it_of_objects++) {
+    msg_auto.objects.reserve(msg_source.objects.size());
+    for (const auto & object : msg_source.objects) {
+      auto & object_auto = msg_auto.objects.emplace_back();
       // convert id and probability
-      object_auto.object_id = msg_source.objects[it_of_objects].object_id;
-      object_auto.existence_probability = msg_source.objects[it_of_objects].existence_probability;
+      object_auto.object_id = object.object_id;
+      object_auto.existence_probability = object.existence_probability;
       // convert classification
-      autoware_auto_perception_msgs::msg::ObjectClassification classification;
-      for (size_t i = 0; i < msg_source.objects[it_of_objects].classification.size(); i++) {
-        classification.label = msg_source.objects[it_of_objects].classification[i].label;
-        classification.probability =
-          msg_source.objects[it_of_objects].classification[i].probability;
-        object_auto.classification.push_back(classification);
+      object_auto.classification.reserve(object.classification.size());
+      for (const auto & classification : object.classification) {
+        object_auto.classification.emplace_back();
+        auto & classification_auto = object_auto.classification.back();
+        classification_auto.label = classification.label;
+        classification_auto.probability = classification.probability;
       }
       // convert kinematics
       object_auto.kinematics.initial_pose_with_covariance =
-        msg_source.objects[it_of_objects].kinematics.initial_pose_with_covariance;
+        object.kinematics.initial_pose_with_covariance;
       object_auto.kinematics.initial_twist_with_covariance =
-        msg_source.objects[it_of_objects].kinematics.initial_twist_with_covariance;
+        object.kinematics.initial_twist_with_covariance;
       object_auto.kinematics.initial_acceleration_with_covariance =
-        msg_source.objects[it_of_objects].kinematics.initial_acceleration_with_covariance;
-      for (size_t j = 0; j < msg_source.objects[it_of_objects].kinematics.predicted_paths.size();
-           j++) {
-        autoware_auto_perception_msgs::msg::PredictedPath predicted_path;
-        for (size_t k = 0;
-             k < msg_source.objects[it_of_objects].kinematics.predicted_paths[j].path.size(); k++) {
-          predicted_path.path.push_back(
-            msg_source.objects[it_of_objects].kinematics.predicted_paths[j].path[k]);
-        }
-        predicted_path.time_step =
-          msg_source.objects[it_of_objects].kinematics.predicted_paths[j].time_step;
-        predicted_path.confidence =
-          msg_source.objects[it_of_objects].kinematics.predicted_paths[j].confidence;
-        object_auto.kinematics.predicted_paths.push_back(predicted_path);
+        object.kinematics.initial_acceleration_with_covariance;
+      // NOTE: predicted_paths and path are bounded sequences, whose emplace_back() returns void.
+      for (const auto & predicted_path : object.kinematics.predicted_paths) {
+        object_auto.kinematics.predicted_paths.emplace_back();
+        auto & predicted_path_auto = object_auto.kinematics.predicted_paths.back();
+        predicted_path_auto.path.assign(predicted_path.path.begin(), predicted_path.path.end());
+        predicted_path_auto.time_step = predicted_path.time_step;
+        predicted_path_auto.confidence = predicted_path.confidence;
       }
       // convert shape
-      object_auto.shape.type = msg_source.objects[it_of_objects].shape.type;
-      object_auto.shape.footprint = msg_source.objects[it_of_objects].shape.footprint;
-      object_auto.shape.dimensions = msg_source.objects[it_of_objects].shape.dimensions;
-
-      // add to objects list
-      msg_auto.objects.push_back(object_auto);
+      object_auto.shape.type = object.shape.type;
+      object_auto.shape.footprint = object.shape.footprint;
+      object_auto.shape.dimensions = object.shape.dimensions;
     }
     return msg_auto;
   }
@@ -47,19 +47,19 @@ protected:
   {
     TrajectoryAuto msg_auto;
     msg_auto.header = msg_source.header;
-    PointAuto trajectory_point_auto;
     msg_auto.points.reserve(msg_source.points.size());
-    for (size_t i = 0; i < msg_source.points.size(); i++) {
-      trajectory_point_auto.time_from_start = msg_source.points.at(i).time_from_start;
-      trajectory_point_auto.pose = msg_source.points.at(i).pose;
-      trajectory_point_auto.longitudinal_velocity_mps =
-        msg_source.points.at(i).longitudinal_velocity_mps;
-      trajectory_point_auto.lateral_velocity_mps = msg_source.points.at(i).lateral_velocity_mps;
-      trajectory_point_auto.acceleration_mps2 = msg_source.points.at(i).acceleration_mps2;
-      trajectory_point_auto.heading_rate_rps = msg_source.points.at(i).heading_rate_rps;
-      trajectory_point_auto.front_wheel_angle_rad = msg_source.points.at(i).front_wheel_angle_rad;
-      trajectory_point_auto.rear_wheel_angle_rad = msg_source.points.at(i).rear_wheel_angle_rad;
-      msg_auto.points.push_back(trajectory_point_auto);
+    for (const auto & point : msg_source.points) {
+      // NOTE: points is a bounded sequence, whose emplace_back() returns void.
+      msg_auto.points.emplace_back();
+      auto & trajectory_point_auto = msg_auto.points.back();
+      trajectory_point_auto.time_from_start = point.time_from_start;
+      trajectory_point_auto.pose = point.pose;
+      trajectory_point_auto.longitudinal_velocity_mps = point.longitudinal_velocity_mps;
+      trajectory_point_auto.lateral_velocity_mps = point.lateral_velocity_mps;
+      trajectory_point_auto.acceleration_mps2 = point.acceleration_mps2;
+      trajectory_point_auto.heading_rate_rps = point.heading_rate_rps;
+      trajectory_point_auto.front_wheel_angle_rad = point.front_wheel_angle_rad;
+      trajectory_point_auto.rear_wheel_angle_rad = point.rear_wheel_angle_rad;
     }
 
     return msg_auto;
@@ -46,12 +46,10 @@ OperationModeNode::OperationModeNode(const rclcpp::NodeOptions & options)
     mode_available_[OperationModeState::Message::AUTONOMOUS] = msg->autonomous;
     mode_available_[OperationModeState::Message::LOCAL] = msg->local;
     mode_available_[OperationModeState::Message::REMOTE] = msg->remote;
+    update_state();
   };
   sub_availability_ = create_subscription<OperationModeAvailability>(name, qos, callback);
 
-  timer_ = rclcpp::create_timer(
-    this, get_clock(), rclcpp::Rate(5.0).period(), std::bind(&OperationModeNode::on_timer, this));
-
   curr_state_.mode = OperationModeState::Message::UNKNOWN;
   prev_state_.mode = OperationModeState::Message::UNKNOWN;
   mode_available_[OperationModeState::Message::UNKNOWN] = false;
@@ -130,11 +128,6 @@ void OperationModeNode::on_state(const OperationModeState::Message::ConstSharedP
   update_state();
 }
 
-void OperationModeNode::on_timer()
-{
-  update_state();
-}
-
 void OperationModeNode::update_state()
 {
   // Clear stamp to compare other fields.
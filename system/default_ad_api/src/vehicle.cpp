@@ -74,7 +74,9 @@ VehicleNode::VehicleNode(const rclcpp::NodeOptions & options) : Node("vehicle",
   adaptor.init_sub(sub_hazard_light_, this, &VehicleNode::hazard_light_status);
   adaptor.init_sub(sub_energy_level_, this, &VehicleNode::energy_status);
 
-  const auto rate = rclcpp::Rate(10);
+  status_max_interval_ = declare_parameter<double>("status_max_interval");
+
+  const auto rate = rclcpp::Rate(declare_parameter<double>("publish_rate"));
   timer_ = rclcpp::create_timer(this, get_clock(), rate.period(), [this]() { on_timer(); });
 }
 
@@ -171,7 +173,6 @@ void VehicleNode::publish_status()
     return;
 
   autoware_ad_api::vehicle::VehicleStatus::Message vehicle_status;
-  vehicle_status.stamp = now();
   vehicle_status.steering_tire_angle = steering_status_msgs_->steering_tire_angle;
   vehicle_status.gear.status = mapping(gear_type_, gear_status_msgs_->report, ApiGear::UNKNOWN);
   vehicle_status.turn_indicators.status =
@@ -179,6 +180,16 @@ void VehicleNode::publish_status()
   vehicle_status.hazard_lights.status =
     mapping(hazard_light_type_, hazard_light_status_msgs_->report, ApiHazardLight::UNKNOWN);
   vehicle_status.energy_percentage = energy_status_msgs_->energy_level;
+
+  // Publish only when the status changes, and at the max interval to show the status is alive.
+  const auto stamp = now();
+  const auto elapsed = prev_status_stamp_ ? (stamp - *prev_status_stamp_).seconds() : 0.0;
+  if (prev_status_ && *prev_status_ == vehicle_status && elapsed < status_max_interval_) {
+    return;
+  }
+  prev_status_ = vehicle_status;
+  prev_status_stamp_ = stamp;
+  vehicle_status.stamp = stamp;
   pub_status_->publish(vehicle_status);
 }
 
@@ -25,6 +25,7 @@
 #include <autoware_adapi_v1_msgs/msg/hazard_lights.hpp>
 #include <autoware_adapi_v1_msgs/msg/turn_indicators.hpp>
 
+#include <optional>
 #include <unordered_map>
 
 // This file should be included after messages.
@@ -51,6 +52,9 @@ private:
   Sub<vehicle_interface::EnergyStatus> sub_energy_level_;
   Sub<map_interface::MapProjectorInfo> sub_map_projector_info_;
   rclcpp::TimerBase::SharedPtr timer_;
+  double status_max_interval_;
+  std::optional<autoware_ad_api::vehicle::VehicleStatus::Message> prev_status_;
+  std::optional<rclcpp::Time> prev_status_stamp_;
 
   localization_interface::KinematicState::Message::ConstSharedPtr kinematic_state_msgs_;
   localization_interface::Acceleration::Message::ConstSharedPtr acceleration_msgs_;
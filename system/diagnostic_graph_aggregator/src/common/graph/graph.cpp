@@ -19,11 +19,25 @@
 #include "loader.hpp"
 #include "units.hpp"
 
+#include <algorithm>
 #include <unordered_map>
 
 namespace diagnostic_graph_aggregator
 {
 
+size_t update_depth(BaseUnit * unit, std::unordered_map<BaseUnit *, bool> & visited)
+{
+  // The graph has no circulation since it is checked when the config is loaded.
+  if (visited[unit]) return unit->depth();
+  size_t depth = 0;
+  for (const auto & link : unit->child_links()) {
+    depth = std::max(depth, update_depth(link->child(), visited) + 1);
+  }
+  unit->set_depth(depth);
+  visited[unit] = true;
+  return depth;
+}
+
 void Graph::create(const std::string & file, const std::string & id)
 {
   GraphLoader graph(file);
@@ -34,22 +48,78 @@ void Graph::create(const std::string & file, const std::string & id)
   for (const auto & node : nodes_) units_.push_back(node.get());
   for (const auto & diag : diags_) units_.push_back(diag.get());
 
+  // Evaluate all units once, because the loader updates only the units without children.
+  std::unordered_map<BaseUnit *, bool> visited;
+  size_t max_depth = 0;
+  for (const auto & unit : units_) max_depth = std::max(max_depth, update_depth(unit, visited));
+  dirty_units_.resize(max_depth + 1);
+  for (const auto & unit : units_) {
+    unit->set_dirty(true);
+    dirty_units_[unit->depth()].push_back(unit);
+  }
+  update_dirty_units();
+
   id_ = id;
 }
 
 void Graph::update(const rclcpp::Time & stamp)
 {
-  for (const auto & diag : diags_) diag->on_time(stamp);
+  for (const auto & diag : diags_) {
+    if (diag->on_time(stamp)) mark_parents(diag.get());
+  }
+  update_dirty_units();
 }
 
 bool Graph::update(const rclcpp::Time & stamp, const DiagnosticStatus & status)
+{
+  const auto result = update_diag(stamp, status);
+  update_dirty_units();
+  return result;
+}
+
+std::vector<const DiagnosticStatus *> Graph::update(
+  const rclcpp::Time & stamp, const DiagnosticArray & array)
+{
+  // Update the parents at once after all diags in the array are updated.
+  std::vector<const DiagnosticStatus *> unknowns;
+  for (const auto & status : array.status) {
+    if (!update_diag(stamp, status)) unknowns.push_back(&status);
+  }
+  update_dirty_units();
+  return unknowns;
+}
+
+bool Graph::update_diag(const rclcpp::Time & stamp, const DiagnosticStatus & status)
 {
   const auto iter = names_.find(status.name);
   if (iter == names_.end()) return false;
-  iter->second->on_diag(stamp, status);
+  if (iter->second->on_diag(stamp, status)) mark_parents(iter->second);
   return true;
 }
 
+void Graph::mark_parents(BaseUnit * unit)
+{
+  for (const auto & link : unit->parent_links()) {
+    const auto parent = link->parent();
+    if (parent->is_dirty()) continue;
+    parent->set_dirty(true);
+    dirty_units_[parent->depth()].push_back(parent);
+  }
+}
+
+void Graph::update_dirty_units()
+{
+  // Only the ancestors of the changed units are evaluated, and each of them is evaluated once
+  // after all of its children since the parents are always deeper than the children.
+  for (auto & units : dirty_units_) {
+    for (const auto & unit : units) {
+      unit->set_dirty(false);
+      if (unit->update()) mark_parents(unit);
+    }
+    units.clear();
+  }
+}
+
 DiagGraphStruct Graph::create_struct(const rclcpp::Time & stamp) const
 {
   DiagGraphStruct msg;
@@ -33,6 +33,8 @@ public:
   void create(const std::string & file, const std::string & id = "");
   void update(const rclcpp::Time & stamp);
   bool update(const rclcpp::Time & stamp, const DiagnosticStatus & status);
+  std::vector<const DiagnosticStatus *> update(
+    const rclcpp::Time & stamp, const DiagnosticArray & array);
   const auto & nodes() const { return nodes_; }
   const auto & diags() const { return diags_; }
   const auto & units() const { return units_; }
@@ -43,12 +45,17 @@ public:
   ~Graph();  // For unique_ptr members.
 
 private:
+  bool update_diag(const rclcpp::Time & stamp, const DiagnosticStatus & status);
+  void mark_parents(BaseUnit * unit);
+  void update_dirty_units();
+
   // Note: keep order correspondence between links and unit children for viewer.
   std::vector<std::unique_ptr<NodeUnit>> nodes_;
   std::vector<std::unique_ptr<DiagUnit>> diags_;
   std::vector<std::unique_ptr<UnitLink>> links_;
   std::vector<BaseUnit *> units_;
   std::unordered_map<std::string, DiagUnit *> names_;
+  std::vector<std::vector<BaseUnit *>> dirty_units_;  // Dirty units for each depth.
   std::string id_;
 };
 
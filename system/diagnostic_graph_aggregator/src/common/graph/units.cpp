@@ -57,13 +57,8 @@ bool BaseUnit::update()
   if (curr_level == prev_level_) return false;
   prev_level_ = curr_level;
 
-  // If the level changes, the parents also need to be updated.
-  bool result = false;
-  for (const auto & link : parents_) {
-    const auto unit = link->parent();
-    result = result || unit->update();
-  }
-  return result;
+  // If the level changes, the graph updates the parents after all changes of the children.
+  return true;
 }
 
 NodeUnit::NodeUnit(const UnitLoader & unit) : BaseUnit(unit)
@@ -125,15 +120,16 @@ bool DiagUnit::on_diag(const rclcpp::Time & stamp, const DiagnosticStatus & stat
 
 bool DiagUnit::on_time(const rclcpp::Time & stamp)
 {
-  if (last_updated_time_) {
-    const auto updated = last_updated_time_.value();
-    const auto elapsed = (stamp - updated).seconds();
-    if (timeout_ < elapsed) {
-      last_updated_time_ = std::nullopt;
-      status_ = DiagLeafStatus();
-      status_.level = DiagnosticStatus::STALE;
-    }
-  }
+  // The level changes only when the diag times out.
+  if (!last_updated_time_) return false;
+
+  const auto updated = last_updated_time_.value();
+  const auto elapsed = (stamp - updated).seconds();
+  if (elapsed <= timeout_) return false;
+
+  last_updated_time_ = std::nullopt;
+  status_ = DiagLeafStatus();
+  status_.level = DiagnosticStatus::STALE;
   return update();
 }
 
@@ -57,13 +57,22 @@ public:
   virtual bool is_leaf() const = 0;
   size_t index() const { return index_; }
   size_t parent_size() const { return parents_.size(); }
+  const std::vector<UnitLink *> & parent_links() const { return parents_; }
 
-protected:
+  // Update the level of this unit only, and return true if the level changes.
   bool update();
 
+  // The depth is larger than all of the children to evaluate the units in that order.
+  size_t depth() const { return depth_; }
+  void set_depth(size_t depth) { depth_ = depth; }
+  bool is_dirty() const { return is_dirty_; }
+  void set_dirty(bool dirty) { is_dirty_ = dirty; }
+
 private:
   virtual void update_status() = 0;
   size_t index_;
+  size_t depth_ = 0;
+  bool is_dirty_ = false;
   std::vector<UnitLink *> parents_;
   std::optional<DiagnosticLevel> prev_level_;
 };
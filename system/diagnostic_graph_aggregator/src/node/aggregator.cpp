@@ -87,10 +87,8 @@ void AggregatorNode::on_diag(const DiagnosticArray & msg)
 {
   // Update status. Store it as unknown if it does not exist in the graph.
   const auto & stamp = msg.header.stamp;
-  for (const auto & status : msg.status) {
-    if (!graph_.update(stamp, status)) {
-      unknown_diags_[status.name] = status;
-    }
+  for (const auto & status : graph_.update(stamp, msg)) {
+    unknown_diags_[status->name] = *status;
   }
 
   // TODO(Takagi, Isamu): Publish immediately when graph status changes.
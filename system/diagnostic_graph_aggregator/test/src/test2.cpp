@@ -85,6 +85,20 @@ TEST_P(GraphTest, Aggregation)
   EXPECT_EQ(output, param.result);
 }
 
+TEST_P(GraphTest, AggregationAtOnce)
+{
+  const auto stamp = rclcpp::Clock().now();
+  const auto param = GetParam();
+  Graph graph;
+  graph.create(resource(param.config));
+
+  const auto array = create_input(param.inputs);
+  EXPECT_TRUE(graph.update(stamp, array).empty());
+
+  const auto output = get_output(graph, stamp);
+  EXPECT_EQ(output, param.result);
+}
+
 // clang-format off
 
 INSTANTIATE_TEST_SUITE_P(And, GraphTest,
@@ -44,10 +44,13 @@ public:
 
 private:
   void onTimer();
+  void updateIdenticalNames();
   void produceDiagnostics(diagnostic_updater::DiagnosticStatusWrapper & stat);
 
   diagnostic_updater::Updater updater_{this};
   rclcpp::TimerBase::SharedPtr timer_;
+  rclcpp::Event::SharedPtr graph_event_;
+  std::vector<std::string> identical_names_;
   bool add_duplicated_node_names_to_msg_;
 };
 }  // namespace duplicated_node_checker
@@ -32,6 +32,11 @@ DuplicatedNodeChecker::DuplicatedNodeChecker(const rclcpp::NodeOptions & node_op
   updater_.setHardwareID("duplicated_node_checker");
   updater_.add("duplicated_node_checker", this, &DuplicatedNodeChecker::produceDiagnostics);
 
+  // NOTE: The node names are checked again only when the graph listener of rclcpp notifies a
+  //       change of the graph, instead of on every timer.
+  graph_event_ = get_graph_event();
+  updateIdenticalNames();
+
   const auto period_ns = rclcpp::Rate(update_rate).period();
   timer_ = rclcpp::create_timer(
     this, get_clock(), period_ns, std::bind(&DuplicatedNodeChecker::onTimer, this));
@@ -55,12 +60,20 @@ void DuplicatedNodeChecker::onTimer()
   updater_.force_update();
 }
 
+void DuplicatedNodeChecker::updateIdenticalNames()
+{
+  identical_names_ = findIdenticalNames(this->get_node_names());
+}
+
 void DuplicatedNodeChecker::produceDiagnostics(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
   using diagnostic_msgs::msg::DiagnosticStatus;
 
-  std::vector<std::string> node_names = this->get_node_names();
-  std::vector<std::string> identical_names = findIdenticalNames(node_names);
+  // the event is cleared before getting the names, so that a change during it is not missed
+  if (graph_event_->check_and_clear()) {
+    updateIdenticalNames();
+  }
+  const auto & identical_names = identical_names_;
   std::string msg;
   int level;
   if (identical_names.size() > 0) {
@@ -0,0 +1,66 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LATENCY_CHAIN_MONITOR__LATENCY_CHAIN_MONITOR_CORE_HPP_
+#define LATENCY_CHAIN_MONITOR__LATENCY_CHAIN_MONITOR_CORE_HPP_
+
+#include <diagnostic_updater/diagnostic_updater.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_internal_msgs/msg/published_time.hpp>
+
+#include <deque>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace latency_chain_monitor
+{
+using autoware_internal_msgs::msg::PublishedTime;
+
+class LatencyChainMonitor : public rclcpp::Node
+{
+public:
+  explicit LatencyChainMonitor(const rclcpp::NodeOptions & node_options);
+
+private:
+  // a topic of the chain and the published times of its messages
+  struct Hop
+  {
+    std::string topic;
+    double budget_ms;
+    std::deque<PublishedTime> history;
+    std::optional<rclcpp::Time> last_received_time;
+    rclcpp::Subscription<PublishedTime>::SharedPtr sub;
+  };
+
+  void onPublishedTime(const size_t hop_index, const PublishedTime::ConstSharedPtr msg);
+  void onTimer();
+  void produceDiagnostics(diagnostic_updater::DiagnosticStatusWrapper & stat);
+
+  // find the published time of the message of the hop with the header stamp
+  std::optional<rclcpp::Time> findPublishedStamp(
+    const Hop & hop, const builtin_interfaces::msg::Time & stamp) const;
+
+  diagnostic_updater::Updater updater_{this};
+  rclcpp::TimerBase::SharedPtr timer_;
+
+  std::vector<Hop> hops_;
+  size_t history_size_;
+  double timeout_;
+  double total_budget_ms_;
+};
+}  // namespace latency_chain_monitor
+
+#endif  // LATENCY_CHAIN_MONITOR__LATENCY_CHAIN_MONITOR_CORE_HPP_
@@ -0,0 +1,184 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "latency_chain_monitor/latency_chain_monitor_core.hpp"
+
+#include <diagnostic_updater/diagnostic_updater.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace latency_chain_monitor
+{
+namespace
+{
+// NOTE: the stamps are compared with the same clock type, since PublishedTimePublisher stamps
+//       published_stamp with the system time while the header stamps may be the simulation time
+rclcpp::Time toTime(const builtin_interfaces::msg::Time & stamp)
+{
+  return rclcpp::Time(stamp, RCL_ROS_TIME);
+}
+
+double toMilliseconds(const rclcpp::Duration & duration)
+{
+  return duration.seconds() * 1e3;
+}
+}  // namespace
+
+LatencyChainMonitor::LatencyChainMonitor(const rclcpp::NodeOptions & node_options)
+: Node("latency_chain_monitor", node_options)
+{
+  const double update_rate = declare_parameter<double>("update_rate");
+  history_size_ = static_cast<size_t>(declare_parameter<int>("history_size"));
+  timeout_ = declare_parameter<double>("timeout");
+  total_budget_ms_ = declare_parameter<double>("total_budget_ms");
+  const auto topics = declare_parameter<std::vector<std::string>>("topics");
+  const auto hop_budgets_ms = declare_parameter<std::vector<double>>("hop_budgets_ms");
+  if (topics.empty() || topics.size() != hop_budgets_ms.size()) {
+    throw std::invalid_argument("topics and hop_budgets_ms must have the same non-zero size.");
+  }
+
+  hops_.resize(topics.size());
+  for (size_t i = 0; i < topics.size(); ++i) {
+    auto & hop = hops_.at(i);
+    hop.topic = topics.at(i);
+    hop.budget_ms = hop_budgets_ms.at(i);
+    // NOTE: PublishedTimePublisher publishes the published time only while it is subscribed
+    hop.sub = create_subscription<PublishedTime>(
+      hop.topic + "/debug/published_time", rclcpp::QoS{10},
+      [this, i](const PublishedTime::ConstSharedPtr msg) { onPublishedTime(i, msg); });
+  }
+
+  updater_.setHardwareID("latency_chain_monitor");
+  updater_.add("latency_chain", this, &LatencyChainMonitor::produceDiagnostics);
+
+  const auto period_ns = rclcpp::Rate(update_rate).period();
+  timer_ = rclcpp::create_timer(
+    this, get_clock(), period_ns, std::bind(&LatencyChainMonitor::onTimer, this));
+}
+
+void LatencyChainMonitor::onPublishedTime(
+  const size_t hop_index, const PublishedTime::ConstSharedPtr msg)
+{
+  auto & hop = hops_.at(hop_index);
+  hop.history.push_back(*msg);
+  while (history_size_ < hop.history.size()) {
+    hop.history.pop_front();
+  }
+  hop.last_received_time = now();
+}
+
+void LatencyChainMonitor::onTimer()
+{
+  updater_.force_update();
+}
+
+std::optional<rclcpp::Time> LatencyChainMonitor::findPublishedStamp(
+  const Hop & hop, const builtin_interfaces::msg::Time & stamp) const
+{
+  const auto itr = std::find_if(
+    hop.history.rbegin(), hop.history.rend(),
+    [&](const PublishedTime & published_time) { return published_time.header.stamp == stamp; });
+  if (itr == hop.history.rend()) {
+    return std::nullopt;
+  }
+  return toTime(itr->published_stamp);
+}
+
+void LatencyChainMonitor::produceDiagnostics(diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  using diagnostic_msgs::msg::DiagnosticStatus;
+
+  std::vector<std::string> stale_topics;
+  for (const auto & hop : hops_) {
+    if (!hop.last_received_time || timeout_ < (now() - *hop.last_received_time).seconds()) {
+      stale_topics.push_back(hop.topic);
+    }
+  }
+  for (const auto & topic : stale_topics) {
+    stat.add("Stale Topic", topic);
+  }
+
+  const auto & last_hop = hops_.back();
+  if (last_hop.history.empty()) {
+    stat.summary(DiagnosticStatus::STALE, "No published time of " + last_hop.topic);
+    return;
+  }
+
+  // trace the latest message of the last topic back to the first one by its header stamp
+  const auto & stamp = last_hop.history.back().header.stamp;
+  std::vector<std::optional<rclcpp::Time>> published_stamps;
+  for (const auto & hop : hops_) {
+    published_stamps.push_back(findPublishedStamp(hop, stamp));
+  }
+  const bool is_traced = std::all_of(
+    published_stamps.begin(), published_stamps.end(),
+    [](const auto & published_stamp) { return published_stamp.has_value(); });
+
+  std::vector<std::string> over_budget_topics;
+  if (is_traced) {
+    // the contribution of each topic to the latency of the chain
+    rclcpp::Time prev_stamp = toTime(stamp);
+    for (size_t i = 0; i < hops_.size(); ++i) {
+      const double hop_latency_ms = toMilliseconds(*published_stamps.at(i) - prev_stamp);
+      stat.addf(hops_.at(i).topic, "%.3f [ms]", hop_latency_ms);
+      if (hops_.at(i).budget_ms < hop_latency_ms) {
+        over_budget_topics.push_back(hops_.at(i).topic);
+      }
+      prev_stamp = *published_stamps.at(i);
+    }
+  } else {
+    // NOTE: The header stamp is not propagated through the chain, so the latency of each topic
+    //       from its own header stamp is reported instead.
+    for (const auto & hop : hops_) {
+      if (hop.history.empty()) {
+        continue;
+      }
+      const auto & latest = hop.history.back();
+      const double latency_ms =
+        toMilliseconds(toTime(latest.published_stamp) - toTime(latest.header.stamp));
+      stat.addf(hop.topic + " (from its own stamp)", "%.3f [ms]", latency_ms);
+      if (hop.budget_ms < latency_ms) {
+        over_budget_topics.push_back(hop.topic);
+      }
+    }
+  }
+
+  std::optional<double> total_latency_ms;
+  if (is_traced) {
+    total_latency_ms = toMilliseconds(*published_stamps.back() - toTime(stamp));
+    stat.addf("Total", "%.3f [ms]", *total_latency_ms);
+  }
+  for (const auto & topic : over_budget_topics) {
+    stat.add("Over Budget Topic", topic);
+  }
+
+  if (!stale_topics.empty()) {
+    stat.summary(DiagnosticStatus::STALE, "Published time is not received");
+  } else if (total_latency_ms && total_budget_ms_ < *total_latency_ms) {
+    stat.summary(DiagnosticStatus::WARN, "Latency of the chain exceeds the budget");
+  } else if (!over_budget_topics.empty()) {
+    stat.summary(DiagnosticStatus::WARN, "Latency of a topic exceeds the budget");
+  } else {
+    stat.summary(DiagnosticStatus::OK, is_traced ? "OK" : "OK (the chain is not traced)");
+  }
+}
+
+}  // namespace latency_chain_monitor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(latency_chain_monitor::LatencyChainMonitor)
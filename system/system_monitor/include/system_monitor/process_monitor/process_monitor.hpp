@@ -21,6 +21,7 @@
 #define SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_MONITOR_HPP_
 
 #include "system_monitor/process_monitor/diag_task.hpp"
+#include "system_monitor/process_monitor/process_stat_reader.hpp"
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
@@ -54,6 +55,15 @@ protected:
   void monitorProcesses(
     diagnostic_updater::DiagnosticStatusWrapper & stat);  // NOLINT(runtime/references)
 
+  /**
+   * @brief monitor processes with the statistics read from procfs
+   * @param [out] stat diagnostic message passed directly to diagnostic publish calls
+   * @note NOLINT syntax is needed since diagnostic_updater asks for a non-const reference
+   * to pass diagnostic message updated in this function to diagnostic publish calls.
+   */
+  void monitorProcessesWithProcStat(
+    diagnostic_updater::DiagnosticStatusWrapper & stat);  // NOLINT(runtime/references)
+
   /**
    * @brief get task summary
    * @param [out] stat diagnostic message passed directly to diagnostic publish calls
@@ -115,15 +125,26 @@ protected:
     const std::string & error_command, const std::string & content);
 
   /**
-   * @brief timer callback to execute top command
+   * @brief timer callback to execute top command or to read procfs
    */
   void onTimer();
 
+  /**
+   * @brief execute top command
+   */
+  void executeTop();
+
+  /**
+   * @brief read the statistics of the processes from procfs
+   */
+  void readProcStat();
+
   diagnostic_updater::Updater updater_;  //!< @brief Updater class which advertises to /diagnostics
 
   char hostname_[HOST_NAME_MAX + 1];  //!< @brief host name
 
-  int num_of_procs_;  //!< @brief number of processes to show
+  int num_of_procs_;      //!< @brief number of processes to show
+  bool use_top_command_;  //!< @brief flag to use top command instead of reading procfs
   std::vector<std::shared_ptr<DiagTask>>
     load_tasks_;  //!< @brief list of diagnostics tasks for high load procs
   std::vector<std::shared_ptr<DiagTask>>
@@ -135,6 +156,16 @@ protected:
   double elapsed_ms_;                   //!< @brief Execution time of top command
   std::mutex mutex_;                    //!< @brief mutex for output from top command
   rclcpp::CallbackGroup::SharedPtr timer_callback_group_;  //!< @brief Callback Group
+
+  ProcessStatReader proc_stat_reader_;            //!< @brief reader of procfs
+  bool is_proc_stat_read_;                        //!< @brief flag if procfs has been read
+  bool is_proc_stat_error_;                       //!< @brief flag if a procfs error occurs
+  std::string proc_stat_error_;                   //!< @brief error content of procfs
+  TasksSummary tasks_summary_;                    //!< @brief number of the tasks in each state
+  std::vector<ProcessInfo> load_procs_;           //!< @brief high load processes
+  std::vector<ProcessInfo> memory_procs_;         //!< @brief high memory processes
+  std::vector<ProcessInfo> load_procs_buffer_;    //!< @brief buffer of high load processes
+  std::vector<ProcessInfo> memory_procs_buffer_;  //!< @brief buffer of high memory processes
 };
 
 #endif  // SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_MONITOR_HPP_
@@ -0,0 +1,150 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file process_stat_reader.hpp
+ * @brief Reader of the process statistics from procfs
+ */
+
+#ifndef SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_STAT_READER_HPP_
+#define SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_STAT_READER_HPP_
+
+#include "system_monitor/process_monitor/diag_task.hpp"
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Struct for storing the number of the tasks in each state
+ */
+struct TasksSummary
+{
+  int total{0};
+  int running{0};
+  int sleeping{0};
+  int stopped{0};
+  int zombie{0};
+};
+
+/**
+ * @brief Reader of the process statistics from /proc/[pid]/stat and /proc/[pid]/status
+ * @note The CPU usage is the difference of the CPU time between two samples, as top shows.
+ * The same buffers are reused in every sample, and no process is spawned.
+ */
+class ProcessStatReader
+{
+public:
+  /**
+   * @brief constructor
+   * @param [in] proc_dir directory where procfs is mounted
+   */
+  explicit ProcessStatReader(const std::string & proc_dir = "/proc");
+
+  /**
+   * @brief read the statistics of all the processes and rank them
+   * @param [in] num_of_procs number of processes to rank
+   * @param [out] summary number of the tasks in each state
+   * @param [out] load_procs processes in descending order of CPU usage
+   * @param [out] memory_procs processes in descending order of memory usage
+   * @param [out] error error content if failed
+   * @return true if success to read the statistics
+   */
+  bool read(
+    int num_of_procs, TasksSummary & summary, std::vector<ProcessInfo> & load_procs,
+    std::vector<ProcessInfo> & memory_procs, std::string & error);
+
+protected:
+  /**
+   * @brief Struct for storing the fields of /proc/[pid]/stat
+   */
+  struct ProcessStat
+  {
+    int pid{0};
+    std::string comm;
+    char state{'?'};
+    int64_t priority{0};
+    int64_t nice{0};
+    uint64_t cpu_ticks{0};   //!< @brief utime + stime
+    uint64_t start_time{0};  //!< @brief start time after boot in clock ticks
+    uint64_t vsize{0};       //!< @brief virtual memory size in bytes
+    int64_t rss{0};          //!< @brief resident set size in pages
+    double cpu_usage{0.0};   //!< @brief CPU usage in percent
+  };
+
+  /**
+   * @brief Struct for storing the CPU time of a process at the previous sample
+   */
+  struct CpuTime
+  {
+    uint64_t start_time{0};
+    uint64_t cpu_ticks{0};
+  };
+
+  /**
+   * @brief read a file into buffer_
+   * @param [in] path file path
+   * @return true if success to read the file
+   */
+  bool readFile(const std::string & path);
+
+  /**
+   * @brief parse the content of /proc/[pid]/stat
+   * @param [in] content content of the file
+   * @param [out] stat parsed fields
+   * @return true if success to parse the content
+   */
+  static bool parseStat(const std::string & content, ProcessStat & stat);
+
+  /**
+   * @brief select the processes with the largest values
+   * @param [in] num_of_procs number of processes to select
+   * @param [in] is_less comparison of the processes
+   * @return indices of stats_ in descending order
+   */
+  template <class Compare>
+  const std::vector<size_t> & selectTopRated(size_t num_of_procs, Compare is_less);
+
+  /**
+   * @brief make the process information shown in the diagnostics
+   * @param [in] stat fields of /proc/[pid]/stat
+   * @return process information
+   */
+  ProcessInfo toProcessInfo(const ProcessStat & stat);
+
+  /**
+   * @brief get user name from user id
+   * @param [in] uid user id
+   * @return user name, or user id if not found
+   */
+  const std::string & getUserName(uid_t uid);
+
+  std::string proc_dir_;                               //!< @brief procfs directory
+  int64_t clock_ticks_;                                //!< @brief clock ticks per second
+  int64_t page_size_kb_;                               //!< @brief page size in kB
+  uint64_t mem_total_kb_;                              //!< @brief total memory in kB
+  double prev_time_;                                   //!< @brief boot time at the previous sample
+  std::string buffer_;                                 //!< @brief buffer to read a file
+  std::string path_;                                   //!< @brief buffer to make a file path
+  std::vector<ProcessStat> stats_;                     //!< @brief statistics of the processes
+  std::vector<size_t> heap_;                           //!< @brief heap to select top-rated procs
+  std::unordered_map<int, CpuTime> prev_cpu_times_;    //!< @brief CPU time at the previous sample
+  std::unordered_map<int, CpuTime> cpu_times_;         //!< @brief CPU time at the current sample
+  std::unordered_map<uid_t, std::string> user_names_;  //!< @brief cache of the user names
+};
+
+#endif  // SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_STAT_READER_HPP_
@@ -24,6 +24,8 @@
 #include <boost/foreach.hpp>
 #include <boost/range.hpp>
 
+#include <mntent.h>
+
 #include <chrono>
 #include <regex>
 #include <string>
@@ -44,6 +46,18 @@ typedef struct thermal_zone
   }
 } thermal_zone;
 
+typedef struct mount_entry
+{
+  std::string device_;       //!< @brief name of the mounted file system
+  std::string mount_point_;  //!< @brief directory where the file system is mounted
+
+  mount_entry() : device_(), mount_point_() {}
+  mount_entry(const std::string & device, const std::string & mount_point)
+  : device_(device), mount_point_(mount_point)
+  {
+  }
+} mount_entry;
+
 class SystemMonitorUtility
 {
 public:
@@ -96,6 +110,39 @@ public:
     }
   }
 
+  /**
+   * @brief read the first line of a file in procfs or sysfs without executing a command
+   * @param [in] path file path
+   * @param [out] line first line of the file
+   * @return true if success to read the file
+   */
+  static bool readFirstLine(const std::string & path, std::string & line)
+  {
+    fs::ifstream ifs(path, std::ios::in);
+    return ifs && std::getline(ifs, line);
+  }
+
+  /**
+   * @brief get mounted file systems without executing findmnt or df
+   * @return mounted file systems in the order of /proc/self/mounts
+   */
+  static std::vector<mount_entry> getMountEntries()
+  {
+    std::vector<mount_entry> entries;
+    FILE * fp = setmntent("/proc/self/mounts", "r");
+    if (fp == nullptr) {
+      return entries;
+    }
+
+    struct mntent ent;
+    char buf[4096];
+    while (getmntent_r(fp, &ent, buf, sizeof(buf)) != nullptr) {
+      entries.emplace_back(ent.mnt_fsname, ent.mnt_dir);
+    }
+    endmntent(fp);
+    return entries;
+  }
+
   /**
    * @brief Remember start time to measure elapsed time
    * @return start time
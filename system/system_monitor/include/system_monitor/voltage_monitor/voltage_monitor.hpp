@@ -63,10 +63,29 @@ protected:
   void checkBatteryStatus(
     diagnostic_updater::DiagnosticStatusWrapper & stat);  // NOLINT(runtime/references)
 
+  /**
+   * @brief check the level of CMOS battery voltage
+   * @param [out] stat diagnostic message passed directly to diagnostic publish calls
+   * @param [in] voltage CMOS battery voltage
+   * @note NOLINT syntax is needed since diagnostic_updater asks for a non-const reference
+   * to pass diagnostic message updated in this function to diagnostic publish calls.
+   */
+  void checkVoltageLevel(
+    diagnostic_updater::DiagnosticStatusWrapper & stat,  // NOLINT(runtime/references)
+    float voltage);
+
+  /**
+   * @brief find the voltage input of hwmon shown with the label in sensors command outputs
+   * @param [in] label voltage string in sensors command outputs
+   * @return path to the voltage input, or empty if not found
+   */
+  static std::string findVoltageInput(const std::string & label);
+
   float voltage_warn_;
   float voltage_error_;
   std::string voltage_string_;
   std::regex voltage_regex_;
+  std::string voltage_input_path_;  //!< @brief sysfs path to the voltage input of hwmon
 };
 
 #endif  // SYSTEM_MONITOR__VOLTAGE_MONITOR__VOLTAGE_MONITOR_HPP_
@@ -25,19 +25,17 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
-#include <boost/process.hpp>
 #include <boost/serialization/vector.hpp>
 
 #include <fmt/format.h>
 #include <stdio.h>
+#include <sys/statvfs.h>
 
 #include <algorithm>
 #include <filesystem>
 #include <string>
 #include <vector>
 
-namespace bp = boost::process;
-
 HddMonitor::HddMonitor(const rclcpp::NodeOptions & options)
 : Node("hdd_monitor", options),
   updater_(this),
@@ -251,70 +249,46 @@ void HddMonitor::checkUsage(diagnostic_updater::DiagnosticStatusWrapper & stat)
     }
 
     // Get summary of disk space usage of ext4
-
-    // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-    // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      error_str = "pipe2 error";
-      stat.add(fmt::format("HDD {}: status", hdd_index), "pipe2 error");
-      stat.add(fmt::format("HDD {}: name", hdd_index), itr->first.c_str());
-      stat.add(fmt::format("HDD {}: pipe2", hdd_index), strerror(errno));
-      continue;
-    }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
-
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      error_str = "pipe2 error";
-      stat.add(fmt::format("HDD {}: status", hdd_index), "pipe2 error");
-      stat.add(fmt::format("HDD {}: name", hdd_index), itr->first.c_str());
-      stat.add(fmt::format("HDD {}: pipe2", hdd_index), strerror(errno));
-      continue;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    // Invoke shell to use shell wildcard expansion
-    bp::child c(
-      "/bin/sh", "-c", fmt::format("df -Pm {}*", itr->second.part_device_.c_str()),
-      bp::std_out > is_out, bp::std_err > is_err);
-    c.wait();
-
-    if (c.exit_code() != 0) {
-      std::ostringstream os;
-      is_err >> os.rdbuf();
-      error_str = "df error";
-      stat.add(fmt::format("HDD {}: status", hdd_index), "df error");
-      stat.add(fmt::format("HDD {}: name", hdd_index), itr->second.part_device_.c_str());
-      stat.add(fmt::format("HDD {}: df", hdd_index), os.str().c_str());
-      continue;
-    }
-
-    int level = DiagStatus::OK;
-    std::string line;
-    int index = 0;
-    std::vector<std::string> list;
-    int avail;
-
-    while (std::getline(is_out, line) && !line.empty()) {
-      // Skip header
-      if (index <= 0) {
-        ++index;
+    // NOTE: The file systems are read by statvfs instead of executing df, as df -Pm shows the
+    //       first mount point of each partition device
+    std::vector<mount_entry> partitions;
+    for (const auto & entry : SystemMonitorUtility::getMountEntries()) {
+      if (!boost::starts_with(entry.device_, itr->second.part_device_)) {
         continue;
       }
-
-      boost::split(list, line, boost::is_space(), boost::token_compress_on);
-
-      try {
-        avail = std::stoi(list[3].c_str());
-      } catch (std::exception & e) {
-        avail = -1;
-        error_str = e.what();
-        stat.add(fmt::format("HDD {}: status", hdd_index), "avail string error");
+      const auto is_same_device = [&entry](const mount_entry & partition) {
+        return partition.device_ == entry.device_;
+      };
+      if (std::none_of(partitions.begin(), partitions.end(), is_same_device)) {
+        partitions.push_back(entry);
+      }
+    }
+    std::sort(
+      partitions.begin(), partitions.end(),
+      [](const mount_entry & a, const mount_entry & b) { return a.device_ < b.device_; });
+
+    for (const auto & partition : partitions) {
+      struct statvfs buf;
+      if (statvfs(partition.mount_point_.c_str(), &buf) != 0) {
+        error_str = "statvfs error";
+        stat.add(fmt::format("HDD {}: status", hdd_index), "statvfs error");
+        stat.add(fmt::format("HDD {}: name", hdd_index), partition.device_.c_str());
+        stat.add(fmt::format("HDD {}: statvfs", hdd_index), strerror(errno));
+        continue;
       }
 
+      // Round up to MiB and percent in the same way as df
+      const auto to_mib = [&buf](const uint64_t blocks) {
+        constexpr uint64_t mib = 1024 * 1024;
+        return (blocks * buf.f_frsize + mib - 1) / mib;
+      };
+      const uint64_t used_blocks = buf.f_blocks - buf.f_bfree;
+      const uint64_t usable_blocks = used_blocks + buf.f_bavail;
+      const uint64_t use =
+        usable_blocks == 0 ? 0 : (used_blocks * 100 + usable_blocks - 1) / usable_blocks;
+      const int avail = static_cast<int>(to_mib(buf.f_bavail));
+
+      int level = DiagStatus::OK;
       if (avail <= itr->second.free_error_) {
         level = DiagStatus::ERROR;
       } else if (avail <= itr->second.free_warn_) {
@@ -324,22 +298,14 @@ void HddMonitor::checkUsage(diagnostic_updater::DiagnosticStatusWrapper & stat)
       }
 
       stat.add(fmt::format("HDD {}: status", hdd_index), usage_dict_.at(level));
-      stat.add(fmt::format("HDD {}: filesystem", hdd_index), list[0].c_str());
-      stat.add(fmt::format("HDD {}: size", hdd_index), (list[1] + " MiB").c_str());
-      stat.add(fmt::format("HDD {}: used", hdd_index), (list[2] + " MiB").c_str());
-      stat.add(fmt::format("HDD {}: avail", hdd_index), (list[3] + " MiB").c_str());
-      stat.add(fmt::format("HDD {}: use", hdd_index), list[4].c_str());
-      std::string mounted_ = list[5];
-      if (list.size() > 6) {
-        std::string::size_type pos = line.find("% /");
-        if (pos != std::string::npos) {
-          mounted_ = line.substr(pos + 2);  // 2 is "% " length
-        }
-      }
-      stat.add(fmt::format("HDD {}: mounted on", hdd_index), mounted_.c_str());
+      stat.add(fmt::format("HDD {}: filesystem", hdd_index), partition.device_.c_str());
+      stat.add(fmt::format("HDD {}: size", hdd_index), fmt::format("{} MiB", to_mib(buf.f_blocks)));
+      stat.add(fmt::format("HDD {}: used", hdd_index), fmt::format("{} MiB", to_mib(used_blocks)));
+      stat.add(fmt::format("HDD {}: avail", hdd_index), fmt::format("{} MiB", avail));
+      stat.add(fmt::format("HDD {}: use", hdd_index), fmt::format("{}%", use));
+      stat.add(fmt::format("HDD {}: mounted on", hdd_index), partition.mount_point_.c_str());
 
       whole_level = std::max(whole_level, level);
-      ++index;
     }
   }
 
@@ -538,39 +504,16 @@ void HddMonitor::getHddParams()
 
 std::string HddMonitor::getDeviceFromMountPoint(const std::string & mount_point)
 {
+  // The last entry is the file system visible at the mount point, as findmnt shows
   std::string ret;
-
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR(get_logger(), "Failed to execute pipe2. %s", strerror(errno));
-    return "";
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    RCLCPP_ERROR(get_logger(), "Failed to execute pipe2. %s", strerror(errno));
-    return "";
-  }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  bp::child c(
-    "/bin/sh", "-c", fmt::format("findmnt -n -o SOURCE {}", mount_point.c_str()),
-    bp::std_out > is_out, bp::std_err > is_err);
-  c.wait();
-
-  if (c.exit_code() != 0) {
-    RCLCPP_ERROR(get_logger(), "Failed to execute findmnt. %s", mount_point.c_str());
-    return "";
+  for (const auto & entry : SystemMonitorUtility::getMountEntries()) {
+    if (entry.mount_point_ == mount_point) {
+      ret = entry.device_;
+    }
   }
 
-  if (!std::getline(is_out, ret)) {
+  if (ret.empty()) {
     RCLCPP_ERROR(get_logger(), "Failed to find device name. %s", mount_point.c_str());
-    return "";
   }
 
   return ret;
@@ -34,8 +34,12 @@ ProcessMonitor::ProcessMonitor(const rclcpp::NodeOptions & options)
 : Node("process_monitor", options),
   updater_(this),
   num_of_procs_(declare_parameter<int>("num_of_procs", 5)),
+  use_top_command_(declare_parameter<bool>("use_top_command", false)),
   is_top_error_(false),
-  is_pipe2_error_(false)
+  is_pipe2_error_(false),
+  elapsed_ms_(0.0),
+  is_proc_stat_read_(false),
+  is_proc_stat_error_(false)
 {
   using namespace std::literals::chrono_literals;
 
@@ -65,6 +69,11 @@ ProcessMonitor::ProcessMonitor(const rclcpp::NodeOptions & options)
 
 void ProcessMonitor::monitorProcesses(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
+  if (!use_top_command_) {
+    monitorProcessesWithProcStat(stat);
+    return;
+  }
+
   // thread-safe read
   std::string str;
   bool is_top_error;
@@ -114,6 +123,62 @@ void ProcessMonitor::monitorProcesses(diagnostic_updater::DiagnosticStatusWrappe
   stat.addf("execution time", "%f ms", elapsed_ms);
 }
 
+void ProcessMonitor::monitorProcessesWithProcStat(
+  diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  // thread-safe read
+  bool is_read;
+  bool is_error;
+  std::string error;
+  TasksSummary summary;
+  std::vector<ProcessInfo> load_procs;
+  std::vector<ProcessInfo> memory_procs;
+  double elapsed_ms;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_read = is_proc_stat_read_;
+    is_error = is_proc_stat_error_;
+    error = proc_stat_error_;
+    summary = tasks_summary_;
+    load_procs = load_procs_;
+    memory_procs = memory_procs_;
+    elapsed_ms = elapsed_ms_;
+  }
+
+  if (is_error) {
+    stat.summary(DiagStatus::ERROR, "proc error");
+    stat.add("proc", error);
+    setErrorContent(&load_tasks_, "proc error", "proc", error);
+    setErrorContent(&memory_tasks_, "proc error", "proc", error);
+    return;
+  }
+
+  // If procfs still not read
+  if (!is_read) {
+    // Send OK tentatively
+    stat.summary(DiagStatus::OK, "starting up");
+    return;
+  }
+
+  stat.add("total", summary.total);
+  stat.add("running", summary.running);
+  stat.add("sleeping", summary.sleeping);
+  stat.add("stopped", summary.stopped);
+  stat.add("zombie", summary.zombie);
+  stat.summary(DiagStatus::OK, "OK");
+
+  for (size_t index = 0; index < load_procs.size() && index < load_tasks_.size(); ++index) {
+    load_tasks_.at(index)->setDiagnosticsStatus(DiagStatus::OK, "OK");
+    load_tasks_.at(index)->setProcessInformation(load_procs.at(index));
+  }
+  for (size_t index = 0; index < memory_procs.size() && index < memory_tasks_.size(); ++index) {
+    memory_tasks_.at(index)->setDiagnosticsStatus(DiagStatus::OK, "OK");
+    memory_tasks_.at(index)->setProcessInformation(memory_procs.at(index));
+  }
+
+  stat.addf("execution time", "%f ms", elapsed_ms);
+}
+
 void ProcessMonitor::getTasksSummary(
   diagnostic_updater::DiagnosticStatusWrapper & stat, const std::string & output)
 {
@@ -513,6 +578,15 @@ void ProcessMonitor::setErrorContent(
 }
 
 void ProcessMonitor::onTimer()
+{
+  if (use_top_command_) {
+    executeTop();
+  } else {
+    readProcStat();
+  }
+}
+
+void ProcessMonitor::executeTop()
 {
   bool is_top_error = false;
 
@@ -565,5 +639,35 @@ void ProcessMonitor::onTimer()
   }
 }
 
+void ProcessMonitor::readProcStat()
+{
+  // Start to measure elapsed time
+  tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+  stop_watch.tic("execution_time");
+
+  TasksSummary summary;
+  std::string error;
+  // NOTE: The processes are read into the buffers outside the lock, and swapped with the ones
+  //       shown in the diagnostics so that the lock is held only for a moment
+  const bool is_success =
+    proc_stat_reader_.read(num_of_procs_, summary, load_procs_buffer_, memory_procs_buffer_, error);
+
+  const double elapsed_ms = stop_watch.toc("execution_time");
+
+  // thread-safe copy
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_proc_stat_read_ = true;
+    is_proc_stat_error_ = !is_success;
+    proc_stat_error_ = error;
+    if (is_success) {
+      tasks_summary_ = summary;
+      load_procs_.swap(load_procs_buffer_);
+      memory_procs_.swap(memory_procs_buffer_);
+    }
+    elapsed_ms_ = elapsed_ms;
+  }
+}
+
 #include <rclcpp_components/register_node_macro.hpp>
 RCLCPP_COMPONENTS_REGISTER_NODE(ProcessMonitor)
@@ -0,0 +1,362 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file process_stat_reader.cpp
+ * @brief Reader of the process statistics from procfs
+ */
+
+#include "system_monitor/process_monitor/process_stat_reader.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <pwd.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+namespace
+{
+// NOTE: /proc/[pid]/stat and /proc/[pid]/status are a few kB at most, so the buffer rarely grows
+constexpr size_t initial_buffer_size = 4096;
+
+double getBootTime()
+{
+  struct timespec ts
+  {
+  };
+  clock_gettime(CLOCK_BOOTTIME, &ts);
+  return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+}
+
+bool isNumber(const char * name)
+{
+  if (*name == '\0') {
+    return false;
+  }
+  for (; *name != '\0'; ++name) {
+    if (*name < '0' || '9' < *name) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// get the value of the line starting with the key in /proc/[pid]/status or /proc/meminfo
+uint64_t findValue(const std::string & content, const char * key)
+{
+  const size_t key_length = std::strlen(key);
+  size_t pos = 0;
+  while (pos < content.size()) {
+    if (content.compare(pos, key_length, key) == 0) {
+      return std::strtoull(content.c_str() + pos + key_length, nullptr, 10);
+    }
+    pos = content.find('\n', pos);
+    if (pos == std::string::npos) {
+      break;
+    }
+    ++pos;
+  }
+  return 0;
+}
+
+std::string toCpuTime(const uint64_t cpu_ticks, const int64_t clock_ticks)
+{
+  const uint64_t centiseconds = cpu_ticks * 100 / static_cast<uint64_t>(clock_ticks);
+  return fmt::format(
+    "{}:{:02}.{:02}", centiseconds / 6000, (centiseconds / 100) % 60, centiseconds % 100);
+}
+}  // namespace
+
+ProcessStatReader::ProcessStatReader(const std::string & proc_dir)
+: proc_dir_(proc_dir),
+  clock_ticks_(sysconf(_SC_CLK_TCK)),
+  page_size_kb_(sysconf(_SC_PAGESIZE) / 1024),
+  mem_total_kb_(0),
+  prev_time_(0.0)
+{
+  buffer_.resize(initial_buffer_size);
+  if (readFile(proc_dir_ + "/meminfo")) {
+    mem_total_kb_ = findValue(buffer_, "MemTotal:");
+  }
+}
+
+bool ProcessStatReader::read(
+  int num_of_procs, TasksSummary & summary, std::vector<ProcessInfo> & load_procs,
+  std::vector<ProcessInfo> & memory_procs, std::string & error)
+{
+  DIR * dir = opendir(proc_dir_.c_str());
+  if (dir == nullptr) {
+    error = fmt::format("{}: {}", proc_dir_, strerror(errno));
+    return false;
+  }
+
+  const double now = getBootTime();
+  summary = TasksSummary{};
+  stats_.clear();
+  cpu_times_.clear();
+
+  ProcessStat stat;
+  for (const struct dirent * entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+    if (!isNumber(entry->d_name)) {
+      continue;
+    }
+    path_.assign(proc_dir_).append("/").append(entry->d_name).append("/stat");
+    // The process may exit while reading the directory
+    if (!readFile(path_) || !parseStat(buffer_, stat)) {
+      continue;
+    }
+
+    const auto prev = prev_cpu_times_.find(stat.pid);
+    if (prev != prev_cpu_times_.end() && prev->second.start_time == stat.start_time) {
+      const double elapsed = std::max(now - prev_time_, 1e-3);
+      stat.cpu_usage = static_cast<double>(stat.cpu_ticks - prev->second.cpu_ticks) /
+                       static_cast<double>(clock_ticks_) / elapsed * 100.0;
+    } else {
+      // The average since started at the first sample or if the process is new
+      const double elapsed = std::max(
+        now - static_cast<double>(stat.start_time) / static_cast<double>(clock_ticks_), 1e-3);
+      stat.cpu_usage =
+        static_cast<double>(stat.cpu_ticks) / static_cast<double>(clock_ticks_) / elapsed * 100.0;
+    }
+    cpu_times_[stat.pid] = CpuTime{stat.start_time, stat.cpu_ticks};
+
+    ++summary.total;
+    switch (stat.state) {
+      case 'R':
+        ++summary.running;
+        break;
+      case 'S':
+      case 'D':
+      case 'I':
+        ++summary.sleeping;
+        break;
+      case 'T':
+      case 't':
+        ++summary.stopped;
+        break;
+      case 'Z':
+        ++summary.zombie;
+        break;
+      default:
+        break;
+    }
+    stats_.push_back(stat);
+  }
+  closedir(dir);
+
+  prev_cpu_times_.swap(cpu_times_);
+  prev_time_ = now;
+
+  const size_t num = static_cast<size_t>(std::max(num_of_procs, 0));
+  load_procs.clear();
+  for (const auto index : selectTopRated(num, [](const ProcessStat & a, const ProcessStat & b) {
+         return a.cpu_usage < b.cpu_usage || (a.cpu_usage == b.cpu_usage && a.pid > b.pid);
+       })) {
+    load_procs.push_back(toProcessInfo(stats_.at(index)));
+  }
+  memory_procs.clear();
+  for (const auto index : selectTopRated(num, [](const ProcessStat & a, const ProcessStat & b) {
+         return a.rss < b.rss || (a.rss == b.rss && a.pid > b.pid);
+       })) {
+    memory_procs.push_back(toProcessInfo(stats_.at(index)));
+  }
+  return true;
+}
+
+bool ProcessStatReader::readFile(const std::string & path)
+{
+  const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+
+  size_t size = 0;
+  buffer_.resize(buffer_.capacity());
+  while (true) {
+    if (size == buffer_.size()) {
+      buffer_.resize(buffer_.size() * 2);
+    }
+    const ssize_t ret = ::read(fd, &buffer_[size], buffer_.size() - size);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      close(fd);
+      return false;
+    }
+    if (ret == 0) {
+      break;
+    }
+    size += static_cast<size_t>(ret);
+  }
+  close(fd);
+  buffer_.resize(size);
+  return true;
+}
+
+bool ProcessStatReader::parseStat(const std::string & content, ProcessStat & stat)
+{
+  // The command name may contain spaces and parentheses, so it is enclosed by the first '(' and
+  // the last ')'
+  const size_t comm_begin = content.find('(');
+  const size_t comm_end = content.rfind(')');
+  if (comm_begin == std::string::npos || comm_end == std::string::npos || comm_end < comm_begin) {
+    return false;
+  }
+  if (comm_end + 2 >= content.size()) {
+    return false;
+  }
+
+  stat.pid = static_cast<int>(std::strtol(content.c_str(), nullptr, 10));
+  stat.comm.assign(content, comm_begin + 1, comm_end - comm_begin - 1);
+  stat.state = content.at(comm_end + 2);
+
+  // Fields after the state, starting from the 4th field (ppid)
+  const char * p = content.c_str() + comm_end + 3;
+  char * end = nullptr;
+  uint64_t utime = 0;
+  uint64_t stime = 0;
+  for (int field = 4; field <= 24; ++field) {
+    const int64_t value = std::strtoll(p, &end, 10);
+    if (end == p) {
+      return false;
+    }
+    switch (field) {
+      case 14:
+        utime = static_cast<uint64_t>(value);
+        break;
+      case 15:
+        stime = static_cast<uint64_t>(value);
+        break;
+      case 18:
+        stat.priority = value;
+        break;
+      case 19:
+        stat.nice = value;
+        break;
+      case 22:
+        stat.start_time = static_cast<uint64_t>(value);
+        break;
+      case 23:
+        // NOTE: vsize may exceed the range of int64_t in theory, so it is parsed again as unsigned
+        stat.vsize = std::strtoull(p, nullptr, 10);
+        break;
+      case 24:
+        stat.rss = value;
+        break;
+      default:
+        break;
+    }
+    p = end;
+  }
+  stat.cpu_ticks = utime + stime;
+  stat.cpu_usage = 0.0;
+  return true;
+}
+
+template <class Compare>
+const std::vector<size_t> & ProcessStatReader::selectTopRated(
+  const size_t num_of_procs, Compare is_less)
+{
+  // Keep the top-rated processes in a min-heap, whose top is the lowest one of them
+  const auto is_greater = [&](const size_t a, const size_t b) {
+    return is_less(stats_.at(b), stats_.at(a));
+  };
+
+  heap_.clear();
+  if (num_of_procs == 0) {
+    return heap_;
+  }
+  for (size_t i = 0; i < stats_.size(); ++i) {
+    if (heap_.size() < num_of_procs) {
+      heap_.push_back(i);
+      std::push_heap(heap_.begin(), heap_.end(), is_greater);
+    } else if (is_less(stats_.at(heap_.front()), stats_.at(i))) {
+      std::pop_heap(heap_.begin(), heap_.end(), is_greater);
+      heap_.back() = i;
+      std::push_heap(heap_.begin(), heap_.end(), is_greater);
+    }
+  }
+  std::sort_heap(heap_.begin(), heap_.end(), is_greater);
+  return heap_;
+}
+
+ProcessInfo ProcessStatReader::toProcessInfo(const ProcessStat & stat)
+{
+  ProcessInfo info;
+  info.processId = std::to_string(stat.pid);
+  // NOTE: top shows "rt" for the highest real-time priority
+  info.priority = stat.priority <= -100 ? "rt" : std::to_string(stat.priority);
+  info.niceValue = std::to_string(stat.nice);
+  info.virtualImage = std::to_string(stat.vsize / 1024);
+  info.residentSize = std::to_string(stat.rss * page_size_kb_);
+  info.processStatus = std::string(1, stat.state);
+  info.cpuUsage = fmt::format("{:.1f}", stat.cpu_usage);
+  info.memoryUsage =
+    mem_total_kb_ == 0
+      ? "0.0"
+      : fmt::format(
+          "{:.1f}", static_cast<double>(stat.rss * page_size_kb_) * 100.0 /
+                      static_cast<double>(mem_total_kb_));
+  info.cpuTime = toCpuTime(stat.cpu_ticks, clock_ticks_);
+
+  // The status is read only for the processes to show
+  path_.assign(proc_dir_).append("/").append(info.processId).append("/status");
+  if (readFile(path_)) {
+    info.userName = getUserName(static_cast<uid_t>(findValue(buffer_, "Uid:")));
+    // The shared memory size as top shows, which is the resident file-backed and shared memory
+    info.sharedMemSize =
+      std::to_string(findValue(buffer_, "RssFile:") + findValue(buffer_, "RssShmem:"));
+  }
+
+  // The command line is empty if it is kernel process, so use the command name instead
+  path_.assign(proc_dir_).append("/").append(info.processId).append("/cmdline");
+  if (readFile(path_) && !buffer_.empty()) {
+    // 0x00 is used as delimiter in /cmdline instead of 0x20 (space)
+    std::replace(buffer_.begin(), buffer_.end(), '\0', ' ');
+    info.commandName.assign(buffer_, 0, buffer_.find_last_not_of(' ') + 1);
+  }
+  if (info.commandName.empty()) {
+    info.commandName = stat.comm;
+  }
+  return info;
+}
+
+const std::string & ProcessStatReader::getUserName(const uid_t uid)
+{
+  const auto cached = user_names_.find(uid);
+  if (cached != user_names_.end()) {
+    return cached->second;
+  }
+
+  struct passwd pwd
+  {
+  };
+  struct passwd * result = nullptr;
+  std::vector<char> buffer(initial_buffer_size);
+  std::string name = std::to_string(uid);
+  if (getpwuid_r(uid, &pwd, buffer.data(), buffer.size(), &result) == 0 && result != nullptr) {
+    name = result->pw_name;
+  }
+  return user_names_.emplace(uid, name).first->second;
+}
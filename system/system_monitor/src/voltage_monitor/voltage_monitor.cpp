@@ -32,6 +32,7 @@
 #include <sys/socket.h>
 
 #include <algorithm>
+#include <fstream>
 #include <regex>
 #include <string>
 #include <vector>
@@ -55,9 +56,10 @@ VoltageMonitor::VoltageMonitor(const rclcpp::NodeOptions & options)
   if (voltage_string_ == "") {
     sensors_exists = false;
   } else {
-    // Check if command exists
+    // Find the voltage in hwmon, or check if command exists
+    voltage_input_path_ = findVoltageInput(voltage_string_);
     fs::path p = bp::search_path("sensors");
-    sensors_exists = (p.empty()) ? false : true;
+    sensors_exists = (!voltage_input_path_.empty() || !p.empty()) ? true : false;
   }
   gethostname(hostname_, sizeof(hostname_));
   auto callback = &VoltageMonitor::checkBatteryStatus;
@@ -75,12 +77,67 @@ VoltageMonitor::VoltageMonitor(const rclcpp::NodeOptions & options)
   updater_.add("CMOS Battery Status", this, callback);
 }
 
+std::string VoltageMonitor::findVoltageInput(const std::string & label)
+{
+  const fs::path root("/sys/class/hwmon");
+  if (!fs::is_directory(root)) {
+    return "";
+  }
+
+  const std::regex input_pattern("in(\\d+)_input");
+  for (const fs::path & hwmon :
+       boost::make_iterator_range(fs::directory_iterator(root), fs::directory_iterator())) {
+    for (const fs::path & path :
+         boost::make_iterator_range(fs::directory_iterator(hwmon), fs::directory_iterator())) {
+      std::smatch match;
+      const std::string filename = path.filename().generic_string();
+      if (!std::regex_match(filename, match, input_pattern)) {
+        continue;
+      }
+
+      // sensors shows the label of the chip driver, or the name of the input if not labeled
+      std::string name;
+      if (!SystemMonitorUtility::readFirstLine(
+            (hwmon / fmt::format("in{}_label", match[1].str())).generic_string(), name)) {
+        name = fmt::format("in{}", match[1].str());
+      }
+      if ((name + ":").find(label) != std::string::npos) {
+        return path.generic_string();
+      }
+    }
+  }
+  return "";
+}
+
 void VoltageMonitor::checkVoltage(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
   // Remember start time to measure elapsed time
   const auto t_start = SystemMonitorUtility::startMeasurement();
   float voltage = 0.0;
 
+  // Read the voltage from hwmon directly if found, instead of executing sensors
+  if (!voltage_input_path_.empty()) {
+    std::string line;
+    if (!SystemMonitorUtility::readFirstLine(voltage_input_path_, line)) {
+      stat.summary(DiagStatus::ERROR, "hwmon error");
+      stat.add("hwmon", fmt::format("Failed to read {}", voltage_input_path_));
+      return;
+    }
+    try {
+      // The input is in millivolt
+      voltage = std::stof(line) / 1000.0;
+    } catch (std::exception & e) {
+      stat.summary(DiagStatus::WARN, "format error");
+      stat.add("exception in std::stof", e.what());
+      return;
+    }
+    checkVoltageLevel(stat, voltage);
+
+    // Measure elapsed time since start time and report
+    SystemMonitorUtility::stopMeasurement(t_start, stat);
+    return;
+  }
+
   int out_fd[2];
   if (RCUTILS_UNLIKELY(pipe2(out_fd, O_CLOEXEC) != 0)) {
     stat.summary(DiagStatus::ERROR, "pipe2 error");
@@ -126,6 +183,15 @@ void VoltageMonitor::checkVoltage(diagnostic_updater::DiagnosticStatusWrapper &
       break;
     }
   }
+  checkVoltageLevel(stat, voltage);
+
+  // Measure elapsed time since start time and report
+  SystemMonitorUtility::stopMeasurement(t_start, stat);
+}
+
+void VoltageMonitor::checkVoltageLevel(
+  diagnostic_updater::DiagnosticStatusWrapper & stat, float voltage)
+{
   stat.add("CMOS battery voltage", fmt::format("{}", voltage));
   if (voltage < voltage_error_) {
     stat.summary(DiagStatus::WARN, "Battery Died");
@@ -134,9 +200,6 @@ void VoltageMonitor::checkVoltage(diagnostic_updater::DiagnosticStatusWrapper &
   } else {
     stat.summary(DiagStatus::OK, "OK");
   }
-
-  // Measure elapsed time since start time and report
-  SystemMonitorUtility::stopMeasurement(t_start, stat);
 }
 
 void VoltageMonitor::checkBatteryStatus(diagnostic_updater::DiagnosticStatusWrapper & stat)
@@ -145,38 +208,16 @@ void VoltageMonitor::checkBatteryStatus(diagnostic_updater::DiagnosticStatusWrap
   const auto t_start = SystemMonitorUtility::startMeasurement();
 
   // Get status of RTC
-  int out_fd[2];
-  if (RCUTILS_UNLIKELY(pipe2(out_fd, O_CLOEXEC) != 0)) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (RCUTILS_UNLIKELY(pipe2(err_fd, O_CLOEXEC) != 0)) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  bp::child c("cat /proc/driver/rtc", bp::std_out > is_out, bp::std_err > is_err);
-  c.wait();
-
-  if (RCUTILS_UNLIKELY(c.exit_code() != 0)) {
-    std::ostringstream os;
-    is_err >> os.rdbuf();
+  std::ifstream ifs("/proc/driver/rtc");
+  if (RCUTILS_UNLIKELY(!ifs)) {
     stat.summary(DiagStatus::ERROR, "rtc error");
-    stat.add("rtc", os.str().c_str());
+    stat.add("rtc", strerror(errno));
     return;
   }
 
   std::string line;
   bool status = false;
-  while (std::getline(is_out, line)) {
+  while (std::getline(ifs, line)) {
     auto batStatusLine = line.find("batt_status");
     if (batStatusLine != std::string::npos) {
       auto batStatus = line.find("okay");
@@ -0,0 +1,71 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
+#define TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
+
+#include "topic_state_monitor/topic_state_monitor.hpp"
+#include "topic_state_monitor/topic_state_monitor_core.hpp"
+
+#include <diagnostic_updater/diagnostic_updater.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <tf2_msgs/msg/tf_message.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace topic_state_monitor
+{
+struct MonitoredTopic
+{
+  std::string name;
+  NodeParam node_param;
+  Param param;
+  std::unique_ptr<TopicStateMonitor> topic_state_monitor;
+  rclcpp::GenericSubscription::SharedPtr sub_topic;
+  rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr sub_transform;
+};
+
+// Monitor multiple topics in one node, which share the timer and the diagnostic updater.
+class MultiTopicStateMonitorNode : public rclcpp::Node
+{
+public:
+  explicit MultiTopicStateMonitorNode(const rclcpp::NodeOptions & node_options);
+
+private:
+  // Parameter
+  double update_rate_;
+
+  // Parameter Reconfigure
+  OnSetParametersCallbackHandle::SharedPtr set_param_res_;
+  rcl_interfaces::msg::SetParametersResult onParameter(
+    const std::vector<rclcpp::Parameter> & parameters);
+
+  // Core
+  // NOTE: The elements are not moved since the subscriptions capture their addresses.
+  std::vector<std::unique_ptr<MonitoredTopic>> topics_;
+  void addTopic(const std::string & name);
+
+  // Timer
+  void onTimer();
+  rclcpp::TimerBase::SharedPtr timer_;
+
+  // Diagnostic Updater
+  diagnostic_updater::Updater updater_;
+};
+}  // namespace topic_state_monitor
+
+#endif  // TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
@@ -43,6 +43,12 @@ struct NodeParam
   bool is_transform;
 };
 
+// Fill the diagnostics of a monitored topic, which is shared by the single and multi-topic nodes.
+void checkTopicStatus(
+  rclcpp::Node & node, const NodeParam & node_param, const Param & param,
+  const TopicStateMonitor & topic_state_monitor,
+  diagnostic_updater::DiagnosticStatusWrapper & stat);
+
 class TopicStateMonitorNode : public rclcpp::Node
 {
 public:
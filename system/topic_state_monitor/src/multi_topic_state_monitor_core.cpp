@@ -0,0 +1,172 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "topic_state_monitor/multi_topic_state_monitor_core.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+template <typename T>
+void update_param(
+  const std::vector<rclcpp::Parameter> & parameters, const std::string & name, T & value)
+{
+  auto it = std::find_if(
+    parameters.cbegin(), parameters.cend(),
+    [&name](const rclcpp::Parameter & parameter) { return parameter.get_name() == name; });
+  if (it != parameters.cend()) {
+    value = it->template get_value<T>();
+  }
+}
+}  // namespace
+
+namespace topic_state_monitor
+{
+MultiTopicStateMonitorNode::MultiTopicStateMonitorNode(const rclcpp::NodeOptions & node_options)
+: Node("multi_topic_state_monitor", node_options), updater_(this)
+{
+  using std::placeholders::_1;
+
+  // Parameter
+  update_rate_ = declare_parameter("update_rate", 10.0);
+  for (const auto & name : declare_parameter<std::vector<std::string>>("topics")) {
+    addTopic(name);
+  }
+
+  // Parameter Reconfigure
+  set_param_res_ = this->add_on_set_parameters_callback(
+    std::bind(&MultiTopicStateMonitorNode::onParameter, this, _1));
+
+  // Diagnostic Updater
+  updater_.setHardwareID("topic_state_monitor");
+  for (const auto & topic : topics_) {
+    const auto monitored = topic.get();
+    updater_.add(
+      topic->node_param.diag_name,
+      [this, monitored](diagnostic_updater::DiagnosticStatusWrapper & stat) {
+        checkTopicStatus(
+          *this, monitored->node_param, monitored->param, *monitored->topic_state_monitor, stat);
+      });
+  }
+
+  // Timer
+  const auto period_ns = rclcpp::Rate(update_rate_).period();
+  timer_ = rclcpp::create_timer(
+    this, get_clock(), period_ns, std::bind(&MultiTopicStateMonitorNode::onTimer, this));
+}
+
+void MultiTopicStateMonitorNode::addTopic(const std::string & name)
+{
+  auto topic = std::make_unique<MonitoredTopic>();
+  const auto prefix = name + ".";
+
+  // Parameter
+  auto & node_param = topic->node_param;
+  node_param.update_rate = update_rate_;
+  node_param.topic = declare_parameter<std::string>(prefix + "topic");
+  node_param.transient_local = declare_parameter(prefix + "transient_local", false);
+  node_param.best_effort = declare_parameter(prefix + "best_effort", false);
+  node_param.diag_name = declare_parameter<std::string>(prefix + "diag_name");
+  node_param.is_transform = (node_param.topic == "/tf" || node_param.topic == "/tf_static");
+
+  if (node_param.is_transform) {
+    node_param.frame_id = declare_parameter<std::string>(prefix + "frame_id");
+    node_param.child_frame_id = declare_parameter<std::string>(prefix + "child_frame_id");
+  } else {
+    node_param.topic_type = declare_parameter<std::string>(prefix + "topic_type");
+  }
+
+  auto & param = topic->param;
+  param.warn_rate = declare_parameter(prefix + "warn_rate", 0.5);
+  param.error_rate = declare_parameter(prefix + "error_rate", 0.1);
+  param.timeout = declare_parameter(prefix + "timeout", 1.0);
+  param.window_size = declare_parameter(prefix + "window_size", 10);
+
+  // Core
+  topic->name = name;
+  topic->topic_state_monitor = std::make_unique<TopicStateMonitor>(*this);
+  topic->topic_state_monitor->setParam(param);
+
+  // Subscriber
+  rclcpp::QoS qos = rclcpp::QoS{1};
+  if (node_param.transient_local) {
+    qos.transient_local();
+  }
+  if (node_param.best_effort) {
+    qos.best_effort();
+  }
+
+  // NOTE: The callbacks of the default callback group are mutually exclusive, so the monitors are
+  //       updated without any lock.
+  const auto monitored = topic.get();
+  if (node_param.is_transform) {
+    topic->sub_transform = this->create_subscription<tf2_msgs::msg::TFMessage>(
+      node_param.topic, qos, [monitored](tf2_msgs::msg::TFMessage::ConstSharedPtr msg) {
+        for (const auto & transform : msg->transforms) {
+          if (
+            transform.header.frame_id == monitored->node_param.frame_id &&
+            transform.child_frame_id == monitored->node_param.child_frame_id) {
+            monitored->topic_state_monitor->update();
+          }
+        }
+      });
+  } else {
+    // The message is only counted, so it is not deserialized.
+    topic->sub_topic = this->create_generic_subscription(
+      node_param.topic, node_param.topic_type, qos,
+      [monitored]([[maybe_unused]] std::shared_ptr<rclcpp::SerializedMessage> msg) {
+        monitored->topic_state_monitor->update();
+      });
+  }
+
+  topics_.push_back(std::move(topic));
+}
+
+rcl_interfaces::msg::SetParametersResult MultiTopicStateMonitorNode::onParameter(
+  const std::vector<rclcpp::Parameter> & parameters)
+{
+  rcl_interfaces::msg::SetParametersResult result;
+  result.successful = true;
+  result.reason = "success";
+
+  try {
+    for (const auto & topic : topics_) {
+      const auto prefix = topic->name + ".";
+      update_param(parameters, prefix + "warn_rate", topic->param.warn_rate);
+      update_param(parameters, prefix + "error_rate", topic->param.error_rate);
+      update_param(parameters, prefix + "timeout", topic->param.timeout);
+      update_param(parameters, prefix + "window_size", topic->param.window_size);
+      topic->topic_state_monitor->setParam(topic->param);
+    }
+  } catch (const rclcpp::exceptions::InvalidParameterTypeException & e) {
+    result.successful = false;
+    result.reason = e.what();
+  }
+
+  return result;
+}
+
+void MultiTopicStateMonitorNode::onTimer()
+{
+  // Publish diagnostics of all the topics at once
+  updater_.force_update();
+}
+
+}  // namespace topic_state_monitor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(topic_state_monitor::MultiTopicStateMonitorNode)
@@ -55,6 +55,7 @@ struct NodeParams
   std::string running_mode;
   double timer_period;
   std::string output_file_path;
+  BaselineParams baseline_params;
   size_t test_iteration;
   double spawn_time_after_init;
   double spawn_distance_threshold;
@@ -172,9 +172,20 @@ struct LatencyStats
   double max;
   double mean;
   double median;
+  double p95;
+  double p99;
   double std_dev;
 };
 
+/**
+ * @brief Struct containing the parameters to compare the statistics with a baseline.
+ */
+struct BaselineParams
+{
+  std::string baseline_file_path;  // statistics file of a previous run, empty if not compared
+  double regression_threshold;     // ratio of p95 latency to the baseline to report a regression
+};
+
 /**
  * @brief Convert string to SubscriberMessageType.
  */
@@ -357,7 +368,15 @@ TimestampedReactionPairsVector convert_pipeline_map_to_sorted_vector(
  */
 void write_results(
   rclcpp::Node * node, const std::string & output_file_path, const RunningMode & node_running_mode,
-  const std::vector<PipelineMap> & pipeline_map_vector);
+  const std::vector<PipelineMap> & pipeline_map_vector, const BaselineParams & baseline_params);
+
+/**
+ * @brief Reads the p95 latencies from a statistics file written by write_results.
+ *
+ * @param file_path The path to the statistics file.
+ * @return The map from "node name,latency type" to the p95 latency, empty if failed to read.
+ */
+std::map<std::string, double> read_baseline_p95_latencies(const std::string & file_path);
 }  // namespace reaction_analyzer
 
 #endif  // UTILS_HPP_
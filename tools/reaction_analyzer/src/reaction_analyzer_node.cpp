@@ -75,6 +75,11 @@ ReactionAnalyzerNode::ReactionAnalyzerNode(rclcpp::NodeOptions node_options)
     return;
   }
 
+  node_params_.baseline_params.baseline_file_path =
+    get_parameter("baseline_file_path").as_string();
+  node_params_.baseline_params.regression_threshold =
+    get_parameter("regression_threshold").as_double();
+
   node_params_.timer_period = get_parameter("timer_period").as_double();
   node_params_.test_iteration = get_parameter("test_iteration").as_int();
   node_params_.spawn_time_after_init = get_parameter("spawn_time_after_init").as_double();
@@ -413,7 +418,9 @@ bool ReactionAnalyzerNode::check_ego_init_correctly(
 void ReactionAnalyzerNode::reset()
 {
   if (test_iteration_count_ >= node_params_.test_iteration) {
-    write_results(this, node_params_.output_file_path, node_running_mode_, pipeline_map_vector_);
+    write_results(
+      this, node_params_.output_file_path, node_running_mode_, pipeline_map_vector_,
+      node_params_.baseline_params);
     RCLCPP_INFO(get_logger(), "%zu Tests are finished. Node shutting down.", test_iteration_count_);
     rclcpp::shutdown();
     return;
@@ -441,7 +441,7 @@ bool search_tracked_objects_near_pose(
 
 LatencyStats calculate_statistics(const std::vector<double> & latency_vec)
 {
-  LatencyStats stats{0.0, 0.0, 0.0, 0.0, 0.0};
+  LatencyStats stats{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
   stats.max = *max_element(latency_vec.begin(), latency_vec.end());
   stats.min = *min_element(latency_vec.begin(), latency_vec.end());
 
@@ -456,6 +456,14 @@ LatencyStats calculate_statistics(const std::vector<double> & latency_vec)
                        2
                    : sorted_latencies[sorted_latencies.size() / 2];
 
+  // nearest-rank percentiles
+  const auto percentile = [&sorted_latencies](const double ratio) {
+    const auto rank = static_cast<size_t>(std::ceil(ratio * sorted_latencies.size()));
+    return sorted_latencies[std::clamp(rank, size_t{1}, sorted_latencies.size()) - 1];
+  };
+  stats.p95 = percentile(0.95);
+  stats.p99 = percentile(0.99);
+
   const double sq_sum =
     std::inner_product(latency_vec.begin(), latency_vec.end(), latency_vec.begin(), 0.0);
   stats.std_dev =
@@ -463,9 +471,35 @@ LatencyStats calculate_statistics(const std::vector<double> & latency_vec)
   return stats;
 }
 
+std::map<std::string, double> read_baseline_p95_latencies(const std::string & file_path)
+{
+  std::map<std::string, double> p95_latencies;
+  std::ifstream file(file_path);
+  std::string line;
+  // skip the header
+  std::getline(file, line);
+  while (std::getline(file, line)) {
+    // node name, latency type, count, min, max, mean, median, p95, ...
+    std::vector<std::string> fields;
+    std::stringstream line_stream(line);
+    for (std::string field; std::getline(line_stream, field, ',');) {
+      fields.push_back(field);
+    }
+    if (fields.size() < 8) {
+      continue;
+    }
+    try {
+      p95_latencies[fields.at(0) + "," + fields.at(1)] = std::stod(fields.at(7));
+    } catch (const std::exception &) {
+      continue;
+    }
+  }
+  return p95_latencies;
+}
+
 void write_results(
   rclcpp::Node * node, const std::string & output_file_path, const RunningMode & node_running_mode,
-  const std::vector<PipelineMap> & pipeline_map_vector)
+  const std::vector<PipelineMap> & pipeline_map_vector, const BaselineParams & baseline_params)
 {
   // create csv file
   auto now = std::chrono::system_clock::now();
@@ -483,6 +517,7 @@ void write_results(
   }
 
   ss << std::put_time(std::localtime(&in_time_t), "%Y-%m-%d-%H-%M-%S");
+  const auto file_path_prefix = ss.str();
   ss << "-reaction-results.csv";
 
   // open file
@@ -549,6 +584,48 @@ void write_results(
   }
 
   // write statistics
+  // NOTE: The statistics are also written to another file with one row for each latency, which is
+  //       read by the next runs as the baseline.
+  const auto statistics_file_path = file_path_prefix + "-reaction-statistics.csv";
+  std::ofstream statistics_file(statistics_file_path);
+  statistics_file << "Node Name,Latency Type,Count,Min,Max,Mean,Median,P95,P99,Std-Dev,"
+                     "Baseline-P95,P95-Ratio,Regressed\n";
+
+  std::map<std::string, double> baseline_p95_latencies;
+  if (!baseline_params.baseline_file_path.empty()) {
+    baseline_p95_latencies = read_baseline_p95_latencies(baseline_params.baseline_file_path);
+    if (baseline_p95_latencies.empty()) {
+      RCLCPP_WARN(
+        node->get_logger(), "Failed to read the baseline: %s",
+        baseline_params.baseline_file_path.c_str());
+    }
+  }
+
+  size_t regression_count = 0;
+  const auto write_statistics_row = [&](
+    const std::string & node_name, const std::string & latency_type,
+    const std::vector<double> & latencies) {
+    const auto stats = calculate_statistics(latencies);
+    statistics_file << node_name << "," << latency_type << "," << latencies.size() << ","
+                    << stats.min << "," << stats.max << "," << stats.mean << "," << stats.median
+                    << "," << stats.p95 << "," << stats.p99 << "," << stats.std_dev << ",";
+
+    const auto baseline = baseline_p95_latencies.find(node_name + "," + latency_type);
+    if (baseline == baseline_p95_latencies.end() || baseline->second <= 0.0) {
+      statistics_file << ",,\n";
+      return;
+    }
+    const double ratio = stats.p95 / baseline->second;
+    const bool is_regressed = ratio > baseline_params.regression_threshold;
+    statistics_file << baseline->second << "," << ratio << "," << (is_regressed ? "1" : "0")
+                    << "\n";
+    if (is_regressed) {
+      regression_count++;
+      RCLCPP_WARN(
+        node->get_logger(), "Latency regression of %s (%s): p95 %.3f ms, baseline %.3f ms",
+        node_name.c_str(), latency_type.c_str(), stats.p95, baseline->second);
+    }
+  };
 
   file << "\nStatistics\n";
   file << "Node "
@@ -573,6 +650,9 @@ void write_results(
     const auto stats_node_latency = calculate_statistics(node_latencies);
     const auto stats_pipeline_latency = calculate_statistics(pipeline_latencies);
     const auto stats_total_latency = calculate_statistics(total_latencies);
+    write_statistics_row(node_name, "Node", node_latencies);
+    write_statistics_row(node_name, "Pipeline", pipeline_latencies);
+    write_statistics_row(node_name, "Total", total_latencies);
 
     file << stats_node_latency.min << "," << stats_node_latency.max << ","
          << stats_node_latency.mean << "," << stats_node_latency.median << ","
@@ -584,6 +664,12 @@ void write_results(
          << stats_total_latency.std_dev << "\n";
   }
   file.close();
+  statistics_file.close();
   RCLCPP_INFO(node->get_logger(), "Results written to: %s", ss.str().c_str());
+  RCLCPP_INFO(node->get_logger(), "Statistics written to: %s", statistics_file_path.c_str());
+  if (!baseline_p95_latencies.empty()) {
+    RCLCPP_INFO(
+      node->get_logger(), "%zu latencies regressed from the baseline.", regression_count);
+  }
 }
 }  // namespace reaction_analyzer
@@ -17,6 +17,7 @@
 #ifndef ACCEL_BRAKE_MAP_CALIBRATOR__ACCEL_BRAKE_MAP_CALIBRATOR_NODE_HPP_
 #define ACCEL_BRAKE_MAP_CALIBRATOR__ACCEL_BRAKE_MAP_CALIBRATOR_NODE_HPP_
 
+#include "accel_brake_map_calibrator/incremental_statistics.hpp"
 #include "diagnostic_updater/diagnostic_updater.hpp"
 #include "raw_vehicle_cmd_converter/accel_map.hpp"
 #include "raw_vehicle_cmd_converter/brake_map.hpp"
@@ -181,14 +182,13 @@ private:
   // for evaluation
   AccelMap new_accel_map_;
   BrakeMap new_brake_map_;
-  std::vector<double> part_original_accel_mse_que_;
-  std::vector<double> full_original_accel_mse_que_;
-  // std::vector<double> full_original_accel_esm_que_;
-  std::vector<double> full_original_accel_l1_que_;
-  std::vector<double> full_original_accel_sq_l1_que_;
-  std::vector<double> new_accel_mse_que_;
-  std::size_t full_mse_que_size_ = 100000;
-  std::size_t part_mse_que_size_ = 3000;
+  const std::size_t full_mse_que_size_ = 100000;
+  const std::size_t part_mse_que_size_ = 3000;
+  MovingAverage part_original_accel_mse_que_{part_mse_que_size_};
+  MovingAverage full_original_accel_mse_que_{full_mse_que_size_};
+  MovingAverage full_original_accel_l1_que_{full_mse_que_size_};
+  MovingAverage full_original_accel_sq_l1_que_{full_mse_que_size_};
+  MovingAverage new_accel_mse_que_{part_mse_que_size_};
   double full_original_accel_rmse_ = 0.0;
   double full_original_accel_error_l1norm_ = 0.0;
   double part_original_accel_rmse_ = 0.0;
@@ -202,7 +202,8 @@ private:
   Map update_brake_map_value_;
   Map accel_offset_covariance_value_;
   Map brake_offset_covariance_value_;
-  std::vector<Map> map_value_data_;
+  // statistics of the measured accelerations on each cell of the unified map
+  std::vector<std::vector<WelfordStatistics>> map_value_data_;
   std::vector<double> accel_vel_index_;
   std::vector<double> brake_vel_index_;
   std::vector<double> accel_pedal_index_;
@@ -226,6 +227,14 @@ private:
   double covariance_;
   const double forgetting_factor_ = 0.999;
   const double coef_update_skip_thresh_ = 0.1;
+  // offset and covariance on each cell of the unified map, for UPDATE_OFFSET_EACH_CELL
+  Map map_offset_vec_;
+  Map covariance_vec_;
+  // offset on each cell and covariance on each four cells, for UPDATE_OFFSET_FOUR_CELL_AROUND
+  Map accel_map_offset_vec_;
+  Map brake_map_offset_vec_;
+  std::vector<std::vector<Eigen::MatrixXd>> accel_covariance_mat_;
+  std::vector<std::vector<Eigen::MatrixXd>> brake_covariance_mat_;
 
   // output log
   std::ofstream output_log_;
@@ -298,8 +307,6 @@ private:
     const T base_data, const double back_time, const std::vector<T> & vec);
   DataStampedPtr getNearestTimeDataFromVec(
     DataStampedPtr base_data, const double back_time, const std::vector<DataStampedPtr> & vec);
-  double getAverage(const std::vector<double> & vec);
-  double getStandardDeviation(const std::vector<double> & vec);
   bool isTimeout(const builtin_interfaces::msg::Time & stamp, const double timeout_sec);
   bool isTimeout(const DataStampedPtr & data_stamped, const double timeout_sec);
 
@@ -0,0 +1,106 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ACCEL_BRAKE_MAP_CALIBRATOR__INCREMENTAL_STATISTICS_HPP_
+#define ACCEL_BRAKE_MAP_CALIBRATOR__INCREMENTAL_STATISTICS_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace accel_brake_map_calibrator
+{
+/**
+ * @brief average of the latest values, which are kept in a ring buffer of the fixed capacity
+ * @details The sum of the values is updated at each push, so the average is given in constant
+ * time regardless of the capacity.
+ */
+class MovingAverage
+{
+public:
+  /// @param capacity number of the latest values to be averaged, which must be positive
+  explicit MovingAverage(const std::size_t capacity) : buffer_(capacity) {}
+
+  void push(const double value)
+  {
+    if (size_ < buffer_.size()) {
+      ++size_;
+    } else {
+      sum_ -= buffer_.at(next_);
+    }
+    buffer_.at(next_) = value;
+    sum_ += value;
+    next_ = (next_ + 1) % buffer_.size();
+    // NOTE: The sum is recalculated once a round, so that the rounding error of the additions and
+    //       the subtractions does not accumulate over a long calibration.
+    if (next_ == 0) {
+      sum_ = std::accumulate(buffer_.begin(), buffer_.end(), 0.0);
+    }
+  }
+
+  std::size_t size() const { return size_; }
+  double getAverage() const { return size_ == 0 ? 0.0 : sum_ / static_cast<double>(size_); }
+
+private:
+  std::vector<double> buffer_;
+  std::size_t size_{0};
+  std::size_t next_{0};
+  double sum_{0.0};
+};
+
+/// @brief mean and standard deviation of all the values added so far, by the Welford's algorithm
+class WelfordStatistics
+{
+public:
+  void add(const double value)
+  {
+    ++count_;
+    const double delta = value - mean_;
+    mean_ += delta / static_cast<double>(count_);
+    squared_deviation_sum_ += delta * (value - mean_);
+  }
+
+  std::size_t count() const { return count_; }
+  bool empty() const { return count_ == 0; }
+  double getMean() const { return mean_; }
+  /// @brief population standard deviation, i.e. divided by the number of the values
+  double getStandardDeviation() const
+  {
+    return count_ == 0 ? 0.0 : std::sqrt(squared_deviation_sum_ / static_cast<double>(count_));
+  }
+
+private:
+  std::size_t count_{0};
+  double mean_{0.0};
+  double squared_deviation_sum_{0.0};
+};
+
+/// @brief update the offset estimated by the recursive least squares with the forgetting factor,
+/// whose regressor is 1
+/// @param error measured value minus the value estimated with the current offset
+inline void updateOffsetRLS(
+  const double error, const double forgetting_factor, double & offset, double & covariance)
+{
+  const double phi = 1.0;
+  covariance = (covariance - (covariance * phi * phi * covariance) /
+                               (forgetting_factor + phi * covariance * phi)) /
+               forgetting_factor;
+
+  const double coef = (covariance * phi) / (forgetting_factor + phi * covariance * phi);
+  offset = offset + coef * error;
+}
+}  // namespace accel_brake_map_calibrator
+
+#endif  // ACCEL_BRAKE_MAP_CALIBRATOR__INCREMENTAL_STATISTICS_HPP_
@@ -164,6 +164,26 @@ AccelBrakeMapCalibrator::AccelBrakeMapCalibrator(const rclcpp::NodeOptions & nod
     m.resize(accel_map_value_.at(0).size());
   }
 
+  // initialize the estimators of the map offsets
+  map_offset_vec_ = Map(
+    accel_map_value_.size() + brake_map_value_.size() - 1,
+    std::vector<double>(accel_map_value_.at(0).size(), map_offset_));
+  covariance_vec_ = Map(
+    accel_map_value_.size() + brake_map_value_.size() - 1,
+    std::vector<double>(accel_map_value_.at(0).size(), covariance_));
+  accel_map_offset_vec_ =
+    Map(accel_map_value_.size(), std::vector<double>(accel_map_value_.at(0).size(), map_offset_));
+  brake_map_offset_vec_ =
+    Map(brake_map_value_.size(), std::vector<double>(accel_map_value_.at(0).size(), map_offset_));
+  accel_covariance_mat_ = std::vector<std::vector<Eigen::MatrixXd>>(
+    accel_map_value_.size() - 1,
+    std::vector<Eigen::MatrixXd>(
+      accel_map_value_.at(0).size() - 1, Eigen::MatrixXd::Identity(4, 4) * covariance_));
+  brake_covariance_mat_ = std::vector<std::vector<Eigen::MatrixXd>>(
+    brake_map_value_.size() - 1,
+    std::vector<Eigen::MatrixXd>(
+      accel_map_value_.at(0).size() - 1, Eigen::MatrixXd::Identity(4, 4) * covariance_));
+
   std::copy(accel_map_value_.begin(), accel_map_value_.end(), update_accel_map_value_.begin());
   std::copy(brake_map_value_.begin(), brake_map_value_.end(), update_brake_map_value_.begin());
 
@@ -448,11 +468,10 @@ void AccelBrakeMapCalibrator::timerCallbackOutputCSV()
     return;
   }
 
-  new_accel_map_ = AccelMap();
+  // NOTE: the maps are replaced only when they are read, and keep the previous ones otherwise
   if (!new_accel_map_.readAccelMapFromCSV(output_accel_file_)) {
     RCLCPP_WARN(get_logger(), "Cannot read accelmap. csv path = %s. ", output_accel_file_.c_str());
   }
-  new_brake_map_ = BrakeMap();
   if (!new_brake_map_.readBrakeMapFromCSV(output_brake_file_)) {
     RCLCPP_WARN(get_logger(), "Cannot read brakemap. csv path = %s. ", output_brake_file_.c_str());
   }
@@ -846,30 +865,16 @@ void AccelBrakeMapCalibrator::executeUpdate(
   // add accel data to map
   accel_mode ? map_value_data_.at(getUnifiedIndexFromAccelBrakeIndex(true, accel_pedal_index))
                  .at(accel_vel_index)
-                 .emplace_back(measured_acc)
+                 .add(measured_acc)
              : map_value_data_.at(getUnifiedIndexFromAccelBrakeIndex(false, brake_pedal_index))
                  .at(brake_vel_index)
-                 .emplace_back(measured_acc);
+                 .add(measured_acc);
 }
 
 bool AccelBrakeMapCalibrator::updateFourCellAroundOffset(
   const bool accel_mode, const int accel_pedal_index, const int accel_vel_index,
   const int brake_pedal_index, const int brake_vel_index, const double measured_acc)
 {
-  // pre-defined
-  static Map accel_map_offset_vec_(
-    accel_map_value_.size(), std::vector<double>(accel_map_value_.at(0).size(), map_offset_));
-  static Map brake_map_offset_vec_(
-    brake_map_value_.size(), std::vector<double>(accel_map_value_.at(0).size(), map_offset_));
-  static std::vector<std::vector<Eigen::MatrixXd>> accel_covariance_mat_(
-    accel_map_value_.size() - 1,
-    std::vector<Eigen::MatrixXd>(
-      accel_map_value_.at(0).size() - 1, Eigen::MatrixXd::Identity(4, 4) * covariance_));
-  static std::vector<std::vector<Eigen::MatrixXd>> brake_covariance_mat_(
-    brake_map_value_.size() - 1,
-    std::vector<Eigen::MatrixXd>(
-      accel_map_value_.at(0).size() - 1, Eigen::MatrixXd::Identity(4, 4) * covariance_));
-
   auto & update_map_value = accel_mode ? update_accel_map_value_ : update_brake_map_value_;
   auto & offset_covariance_value =
     accel_mode ? accel_offset_covariance_value_ : brake_offset_covariance_value_;
@@ -1005,14 +1010,6 @@ bool AccelBrakeMapCalibrator::updateEachValOffset(
   const int brake_pedal_index, const int brake_vel_index, const double measured_acc,
   const double map_acc)
 {
-  // pre-defined
-  static Map map_offset_vec_(
-    accel_map_value_.size() + brake_map_value_.size() - 1,
-    std::vector<double>(accel_map_value_.at(0).size(), map_offset_));
-  static Map covariance_vec_(
-    accel_map_value_.size() + brake_map_value_.size() - 1,
-    std::vector<double>(accel_map_value_.at(0).size(), covariance_));
-
   const int vel_idx = accel_mode ? accel_vel_index : brake_vel_index;
   int ped_idx = accel_mode ? accel_pedal_index : brake_pedal_index;
   ped_idx = getUnifiedIndexFromAccelBrakeIndex(accel_mode, ped_idx);
@@ -1020,15 +1017,7 @@ bool AccelBrakeMapCalibrator::updateEachValOffset(
   double covariance = covariance_vec_.at(ped_idx).at(vel_idx);
 
   /* calculate adaptive map offset */
-  const double phi = 1.0;
-  covariance = (covariance - (covariance * phi * phi * covariance) /
-                               (forgetting_factor_ + phi * covariance * phi)) /
-               forgetting_factor_;
-
-  const double coef = (covariance * phi) / (forgetting_factor_ + phi * covariance * phi);
-
-  const double error_map_offset = measured_acc - map_acc;
-  map_offset = map_offset + coef * error_map_offset;
+  updateOffsetRLS(measured_acc - map_acc, forgetting_factor_, map_offset, covariance);
 
   RCLCPP_DEBUG_STREAM(
     get_logger(), "index: " << ped_idx << ", " << vel_idx
@@ -1052,14 +1041,7 @@ bool AccelBrakeMapCalibrator::updateEachValOffset(
 void AccelBrakeMapCalibrator::updateTotalMapOffset(const double measured_acc, const double map_acc)
 {
   /* calculate adaptive map offset */
-  const double phi = 1.0;
-  covariance_ = (covariance_ - (covariance_ * phi * phi * covariance_) /
-                                 (forgetting_factor_ + phi * covariance_ * phi)) /
-                forgetting_factor_;
-
-  const double coef = (covariance_ * phi) / (forgetting_factor_ + phi * covariance_ * phi);
-  const double error_map_offset = measured_acc - map_acc;
-  map_offset_ = map_offset_ + coef * error_map_offset;
+  updateOffsetRLS(measured_acc - map_acc, forgetting_factor_, map_offset_, covariance_);
 
   RCLCPP_DEBUG_STREAM(
     get_logger(), "map_offset_ = " << map_offset_ << "\t"
@@ -1128,20 +1110,20 @@ void AccelBrakeMapCalibrator::executeEvaluation()
   const double full_orig_accel_sq_error = calculateAccelSquaredError(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
-  pushDataToVec(full_orig_accel_sq_error, full_mse_que_size_, &full_original_accel_mse_que_);
-  full_original_accel_rmse_ = getAverage(full_original_accel_mse_que_);
+  full_original_accel_mse_que_.push(full_orig_accel_sq_error);
+  full_original_accel_rmse_ = full_original_accel_mse_que_.getAverage();
   // std::cerr << "rmse : " << sqrt(full_original_accel_rmse_) << std::endl;
 
   const double full_orig_accel_l1_error = calculateAccelErrorL1Norm(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
   const double full_orig_accel_sq_l1_error = full_orig_accel_l1_error * full_orig_accel_l1_error;
-  pushDataToVec(full_orig_accel_l1_error, full_mse_que_size_, &full_original_accel_l1_que_);
-  pushDataToVec(full_orig_accel_sq_l1_error, full_mse_que_size_, &full_original_accel_sq_l1_que_);
-  full_original_accel_error_l1norm_ = getAverage(full_original_accel_l1_que_);
+  full_original_accel_l1_que_.push(full_orig_accel_l1_error);
+  full_original_accel_sq_l1_que_.push(full_orig_accel_sq_l1_error);
+  full_original_accel_error_l1norm_ = full_original_accel_l1_que_.getAverage();
 
   /*calculate l1norm_covariance*/
-  // const double full_original_accel_error_sql1_ = getAverage(full_original_accel_sq_l1_que_);
+  // const double full_original_accel_error_sql1_ = full_original_accel_sq_l1_que_.getAverage();
   // std::cerr << "error_l1norm : " << full_original_accel_error_l1norm_ << std::endl;
   // std::cerr << "error_l1_cov : " <<
   // full_original_accel_error_sql1_-full_original_accel_error_l1norm_*full_original_accel_error_l1norm_
@@ -1150,14 +1132,14 @@ void AccelBrakeMapCalibrator::executeEvaluation()
   const double part_orig_accel_sq_error = calculateAccelSquaredError(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
-  pushDataToVec(part_orig_accel_sq_error, part_mse_que_size_, &part_original_accel_mse_que_);
-  part_original_accel_rmse_ = getAverage(part_original_accel_mse_que_);
+  part_original_accel_mse_que_.push(part_orig_accel_sq_error);
+  part_original_accel_rmse_ = part_original_accel_mse_que_.getAverage();
 
   const double new_accel_sq_error = calculateAccelSquaredError(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     new_accel_map_, new_brake_map_);
-  pushDataToVec(new_accel_sq_error, part_mse_que_size_, &new_accel_mse_que_);
-  new_accel_rmse_ = getAverage(new_accel_mse_que_);
+  new_accel_mse_que_.push(new_accel_sq_error);
+  new_accel_rmse_ = new_accel_mse_que_.getAverage();
 }
 
 double AccelBrakeMapCalibrator::calculateEstimatedAcc(
@@ -1251,34 +1233,6 @@ DataStampedPtr AccelBrakeMapCalibrator::getNearestTimeDataFromVec(
   return nearest_time_data;
 }
 
-double AccelBrakeMapCalibrator::getAverage(const std::vector<double> & vec)
-{
-  if (vec.empty()) {
-    return 0.0;
-  }
-
-  double sum = 0.0;
-  for (const auto num : vec) {
-    sum += num;
-  }
-  return sum / vec.size();
-}
-
-double AccelBrakeMapCalibrator::getStandardDeviation(const std::vector<double> & vec)
-{
-  if (vec.empty()) {
-    return 0.0;
-  }
-
-  const double ave = getAverage(vec);
-
-  double sum = 0.0;
-  for (const auto num : vec) {
-    sum += std::pow(num - ave, 2);
-  }
-  return std::sqrt(sum / vec.size());
-}
-
 bool AccelBrakeMapCalibrator::isTimeout(
   const builtin_interfaces::msg::Time & stamp, const double timeout_sec)
 {
@@ -1488,26 +1442,26 @@ void AccelBrakeMapCalibrator::publishCountMap()
 
   for (int i = 0; i < h; i++) {
     for (int j = 0; j < w; j++) {
-      const auto data_vec = map_value_data_.at(i).at(j);
-      if (data_vec.empty()) {
+      const auto & data_statistics = map_value_data_.at(i).at(j);
+      if (data_statistics.empty()) {
         // input *UNKNOWN* value
         count_map.at(i * w + j) = -1;
         ave_map.at(i * w + j) = -1;
       } else {
         const auto count_rate =
-          MAX_OCC_VALUE * (static_cast<double>(data_vec.size()) / max_data_count_);
+          MAX_OCC_VALUE * (static_cast<double>(data_statistics.count()) / max_data_count_);
         count_map.at(i * w + j) = static_cast<int8_t>(
           std::max(std::min(static_cast<int>(MAX_OCC_VALUE), static_cast<int>(count_rate)), 0));
         // calculate average
         {
-          const double average = getAverage(data_vec);
+          const double average = data_statistics.getMean();
           int8_t int_average = static_cast<uint8_t>(
             MAX_OCC_VALUE * ((average - min_accel_) / (max_accel_ - min_accel_)));
           ave_map.at(i * w + j) = std::max(std::min(MAX_OCC_VALUE, int_average), (int8_t)0);
         }
         // calculate standard deviation
         {
-          const double std_dev = getStandardDeviation(data_vec);
+          const double std_dev = data_statistics.getStandardDeviation();
           const double max_std_dev = 0.2;
           const double min_std_dev = 0.0;
           int8_t int_std_dev = static_cast<uint8_t>(
@@ -15,12 +15,14 @@
 #ifndef RAW_VEHICLE_CMD_CONVERTER__ACCEL_MAP_HPP_
 #define RAW_VEHICLE_CMD_CONVERTER__ACCEL_MAP_HPP_
 
+#include "raw_vehicle_cmd_converter/compiled_map.hpp"
 #include "raw_vehicle_cmd_converter/csv_loader.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
 #include <algorithm>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -32,17 +34,20 @@ public:
   bool readAccelMapFromCSV(const std::string & csv_path, const bool validation = false);
   bool getThrottle(const double acc, const double vel, double & throttle) const;
   bool getAcceleration(const double throttle, const double vel, double & acc) const;
-  std::vector<double> getVelIdx() const { return vel_index_; }
-  std::vector<double> getThrottleIdx() const { return throttle_index_; }
-  std::vector<std::vector<double>> getAccelMap() const { return accel_map_; }
+  std::vector<double> getVelIdx() const { return getCompiledMap()->getRowIndex(); }
+  std::vector<double> getThrottleIdx() const { return getCompiledMap()->getColumnIndex(); }
+  std::vector<std::vector<double>> getAccelMap() const { return getCompiledMap()->getMap(); }
+
+  /// @brief snapshot of the map in use, which is never null
+  std::shared_ptr<const CompiledMap> getCompiledMap() const;
 
 private:
   rclcpp::Logger logger_{rclcpp::get_logger("raw_vehicle_cmd_converter").get_child("accel_map")};
   rclcpp::Clock clock_{RCL_ROS_TIME};
   std::string vehicle_name_;
-  std::vector<double> vel_index_;
-  std::vector<double> throttle_index_;
-  std::vector<std::vector<double>> accel_map_;
+  // NOTE: The map is replaced as a whole by an atomic store, so that a reload does not disturb the
+  //       conversion running on another thread, and the failed one keeps the map in use.
+  std::shared_ptr<const CompiledMap> compiled_map_{std::make_shared<const CompiledMap>()};
 };
 }  // namespace raw_vehicle_cmd_converter
 
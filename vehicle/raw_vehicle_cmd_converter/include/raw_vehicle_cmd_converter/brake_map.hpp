@@ -15,12 +15,14 @@
 #ifndef RAW_VEHICLE_CMD_CONVERTER__BRAKE_MAP_HPP_
 #define RAW_VEHICLE_CMD_CONVERTER__BRAKE_MAP_HPP_
 
+#include "raw_vehicle_cmd_converter/compiled_map.hpp"
 #include "raw_vehicle_cmd_converter/csv_loader.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
 #include <algorithm>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -32,18 +34,19 @@ public:
   bool readBrakeMapFromCSV(const std::string & csv_path, const bool validation = false);
   bool getBrake(const double acc, const double vel, double & brake);
   bool getAcceleration(const double brake, const double vel, double & acc) const;
-  std::vector<double> getVelIdx() const { return vel_index_; }
-  std::vector<double> getBrakeIdx() const { return brake_index_; }
-  std::vector<std::vector<double>> getBrakeMap() const { return brake_map_; }
+  std::vector<double> getVelIdx() const { return getCompiledMap()->getRowIndex(); }
+  std::vector<double> getBrakeIdx() const { return getCompiledMap()->getColumnIndex(); }
+  std::vector<std::vector<double>> getBrakeMap() const { return getCompiledMap()->getMap(); }
+
+  /// @brief snapshot of the map in use, which is never null
+  std::shared_ptr<const CompiledMap> getCompiledMap() const;
 
 private:
   rclcpp::Logger logger_{rclcpp::get_logger("raw_vehicle_cmd_converter").get_child("accel_map")};
   rclcpp::Clock clock_{RCL_ROS_TIME};
   std::string vehicle_name_;
-  std::vector<double> vel_index_;
-  std::vector<double> brake_index_;
-  std::vector<double> brake_index_rev_;
-  std::vector<std::vector<double>> brake_map_;
+  // NOTE: replaced as a whole by an atomic store as AccelMap
+  std::shared_ptr<const CompiledMap> compiled_map_{std::make_shared<const CompiledMap>()};
 };
 }  // namespace raw_vehicle_cmd_converter
 
@@ -0,0 +1,67 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RAW_VEHICLE_CMD_CONVERTER__COMPILED_MAP_HPP_
+#define RAW_VEHICLE_CMD_CONVERTER__COMPILED_MAP_HPP_
+
+#include "raw_vehicle_cmd_converter/csv_loader.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace raw_vehicle_cmd_converter
+{
+/**
+ * @brief map loaded from the CSV, compiled for the interpolation at every command
+ * @details The row index is the first row of the CSV (e.g. velocity) and the column index is the
+ * first column (e.g. throttle), as CSVLoader names them. The values of all the columns at a row
+ * index are stored contiguously, so they are interpolated at once with a single ratio in a loop
+ * which the compiler vectorizes. The segment of the row index is found on a uniform grid over the
+ * index range, whose cell is not wider than the narrowest segment, instead of a binary search.
+ * The result is the same as interpolation::lerp on each column.
+ */
+class CompiledMap
+{
+public:
+  CompiledMap() = default;
+  CompiledMap(
+    const std::vector<double> & row_index, const std::vector<double> & column_index,
+    const Map & map);
+
+  bool empty() const { return row_index_.size() < 2 || column_index_.empty(); }
+  const std::vector<double> & getRowIndex() const { return row_index_; }
+  const std::vector<double> & getColumnIndex() const { return column_index_; }
+  const Map & getMap() const { return map_; }
+
+  /// @brief interpolate the values of all the columns at the row value, which is clamped into the
+  /// range of the row index
+  /// @throws std::invalid_argument if the map is not valid for interpolation::lerp, as it does
+  std::vector<double> interpolateAtRow(const double row_value) const;
+
+private:
+  std::vector<double> row_index_;
+  std::vector<double> column_index_;
+  Map map_;
+
+  // values_[i * column_index_.size() + j] is map_[j][i], which is empty if the map is invalid
+  std::vector<double> values_;
+  // segment of the row index at the lower bound of each grid cell
+  std::vector<size_t> grid_segments_;
+  double grid_inverse_cell_size_{0.0};
+
+  size_t findRowSegment(const double row_value) const;
+};
+}  // namespace raw_vehicle_cmd_converter
+
+#endif  // RAW_VEHICLE_CMD_CONVERTER__COMPILED_MAP_HPP_
@@ -112,11 +112,15 @@ public:
   void onSteering(const Steering::ConstSharedPtr msg);
   void onControlCmd(const AckermannControlCommand::ConstSharedPtr msg);
   void onVelocity(const Odometry::ConstSharedPtr msg);
+  rcl_interfaces::msg::SetParametersResult onParameter(
+    const std::vector<rclcpp::Parameter> & parameters);
   void publishActuationCmd();
   // for debugging
   rclcpp::Publisher<Float32MultiArrayStamped>::SharedPtr debug_pub_steer_pid_;
   DebugValues debug_steer_;
 
+  OnSetParametersCallbackHandle::SharedPtr set_param_res_;
+
   std::unique_ptr<tier4_autoware_utils::LoggerLevelConfigure> logger_configure_;
 };
 }  // namespace raw_vehicle_cmd_converter
@@ -15,11 +15,13 @@
 #ifndef RAW_VEHICLE_CMD_CONVERTER__STEER_MAP_HPP_
 #define RAW_VEHICLE_CMD_CONVERTER__STEER_MAP_HPP_
 
+#include "raw_vehicle_cmd_converter/compiled_map.hpp"
 #include "raw_vehicle_cmd_converter/csv_loader.hpp"
 #include "raw_vehicle_cmd_converter/pid.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -31,11 +33,13 @@ public:
   bool readSteerMapFromCSV(const std::string & csv_path, const bool validation = false);
   void getSteer(const double steer_rate, const double steer, double & output) const;
 
+  /// @brief snapshot of the map in use, which is never null
+  std::shared_ptr<const CompiledMap> getCompiledMap() const;
+
 private:
   std::string vehicle_name_;
-  std::vector<double> steer_index_;
-  std::vector<double> output_index_;
-  std::vector<std::vector<double>> steer_map_;
+  // NOTE: replaced as a whole by an atomic store as AccelMap
+  std::shared_ptr<const CompiledMap> compiled_map_{std::make_shared<const CompiledMap>()};
   rclcpp::Logger logger_{rclcpp::get_logger("raw_vehicle_cmd_converter").get_child("steer_map")};
 };
 }  // namespace raw_vehicle_cmd_converter
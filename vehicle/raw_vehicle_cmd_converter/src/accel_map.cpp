@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -34,52 +35,64 @@ bool AccelMap::readAccelMapFromCSV(const std::string & csv_path, const bool vali
     return false;
   }
 
-  vehicle_name_ = table[0][0];
-  vel_index_ = CSVLoader::getRowIndex(table);
-  throttle_index_ = CSVLoader::getColumnIndex(table);
-  accel_map_ = CSVLoader::getMap(table);
-  if (validation && !CSVLoader::validateMap(accel_map_, true)) {
+  const auto accel_map = CSVLoader::getMap(table);
+  if (validation && !CSVLoader::validateMap(accel_map, true)) {
     return false;
   }
+  vehicle_name_ = table[0][0];
+  std::atomic_store(
+    &compiled_map_, std::make_shared<const CompiledMap>(
+                      CSVLoader::getRowIndex(table), CSVLoader::getColumnIndex(table), accel_map));
   return true;
 }
 
+std::shared_ptr<const CompiledMap> AccelMap::getCompiledMap() const
+{
+  return std::atomic_load(&compiled_map_);
+}
+
 bool AccelMap::getThrottle(const double acc, double vel, double & throttle) const
 {
-  std::vector<double> interpolated_acc_vec;
-  const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "throttle: vel");
-  // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (std::vector<double> accelerations : accel_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, accelerations, clamped_vel));
+  const auto compiled_map = getCompiledMap();
+  if (compiled_map->empty()) {
+    return false;
   }
+  const auto & vel_index = compiled_map->getRowIndex();
+  const auto & throttle_index = compiled_map->getColumnIndex();
+  const double clamped_vel = CSVLoader::clampValue(vel, vel_index, "throttle: vel");
+  // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
+  const std::vector<double> interpolated_acc_vec = compiled_map->interpolateAtRow(clamped_vel);
   // calculate throttle
   // When the desired acceleration is smaller than the throttle area, return false => brake sequence
   // When the desired acceleration is greater than the throttle area, return max throttle
   if (acc < interpolated_acc_vec.front()) {
     return false;
   } else if (interpolated_acc_vec.back() < acc) {
-    throttle = throttle_index_.back();
+    throttle = throttle_index.back();
     return true;
   }
-  throttle = interpolation::lerp(interpolated_acc_vec, throttle_index_, acc);
+  throttle = interpolation::lerp(interpolated_acc_vec, throttle_index, acc);
   return true;
 }
 
 bool AccelMap::getAcceleration(const double throttle, const double vel, double & acc) const
 {
-  std::vector<double> interpolated_acc_vec;
-  const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "throttle: vel");
+  const auto compiled_map = getCompiledMap();
+  if (compiled_map->empty()) {
+    return false;
+  }
+  const auto & vel_index = compiled_map->getRowIndex();
+  const auto & throttle_index = compiled_map->getColumnIndex();
+  const double clamped_vel = CSVLoader::clampValue(vel, vel_index, "throttle: vel");
 
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (const auto & acc_vec : accel_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, acc_vec, clamped_vel));
-  }
+  const std::vector<double> interpolated_acc_vec = compiled_map->interpolateAtRow(clamped_vel);
 
   // calculate throttle
   // When the desired acceleration is smaller than the throttle area, return min acc
   // When the desired acceleration is greater than the throttle area, return max acc
-  const double clamped_throttle = CSVLoader::clampValue(throttle, throttle_index_, "throttle: acc");
-  acc = interpolation::lerp(throttle_index_, interpolated_acc_vec, clamped_throttle);
+  const double clamped_throttle = CSVLoader::clampValue(throttle, throttle_index, "throttle: acc");
+  acc = interpolation::lerp(throttle_index, interpolated_acc_vec, clamped_throttle);
 
   return true;
 }
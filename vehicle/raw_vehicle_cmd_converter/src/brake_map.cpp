@@ -17,6 +17,7 @@
 #include "interpolation/linear_interpolation.hpp"
 
 #include <algorithm>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -31,28 +32,35 @@ bool BrakeMap::readBrakeMapFromCSV(const std::string & csv_path, const bool vali
     return false;
   }
 
-  vehicle_name_ = table[0][0];
-  vel_index_ = CSVLoader::getRowIndex(table);
-  brake_index_ = CSVLoader::getColumnIndex(table);
-  brake_map_ = CSVLoader::getMap(table);
-  brake_index_rev_ = brake_index_;
-  if (validation && !CSVLoader::validateMap(brake_map_, false)) {
+  const auto brake_map = CSVLoader::getMap(table);
+  if (validation && !CSVLoader::validateMap(brake_map, false)) {
     return false;
   }
-  std::reverse(std::begin(brake_index_rev_), std::end(brake_index_rev_));
+  vehicle_name_ = table[0][0];
+  std::atomic_store(
+    &compiled_map_, std::make_shared<const CompiledMap>(
+                      CSVLoader::getRowIndex(table), CSVLoader::getColumnIndex(table), brake_map));
 
   return true;
 }
 
+std::shared_ptr<const CompiledMap> BrakeMap::getCompiledMap() const
+{
+  return std::atomic_load(&compiled_map_);
+}
+
 bool BrakeMap::getBrake(const double acc, const double vel, double & brake)
 {
-  std::vector<double> interpolated_acc_vec;
-  const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "brake: vel");
+  const auto compiled_map = getCompiledMap();
+  if (compiled_map->empty()) {
+    return false;
+  }
+  const auto & vel_index = compiled_map->getRowIndex();
+  const auto & brake_index = compiled_map->getColumnIndex();
+  const double clamped_vel = CSVLoader::clampValue(vel, vel_index, "brake: vel");
 
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (std::vector<double> accelerations : brake_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, accelerations, clamped_vel));
-  }
+  std::vector<double> interpolated_acc_vec = compiled_map->interpolateAtRow(clamped_vel);
 
   // calculate brake
   // When the desired acceleration is smaller than the brake area, return max brake on the map
@@ -63,34 +71,38 @@ bool BrakeMap::getBrake(const double acc, const double vel, double & brake)
       "Exceeding the acc range. Desired acc: %f < min acc on map: %f. return max "
       "value.",
       acc, interpolated_acc_vec.back());
-    brake = brake_index_.back();
+    brake = brake_index.back();
     return true;
   } else if (interpolated_acc_vec.front() < acc) {
-    brake = brake_index_.front();
+    brake = brake_index.front();
     return true;
   }
 
   std::reverse(std::begin(interpolated_acc_vec), std::end(interpolated_acc_vec));
-  brake = interpolation::lerp(interpolated_acc_vec, brake_index_rev_, acc);
+  const std::vector<double> brake_index_rev(brake_index.rbegin(), brake_index.rend());
+  brake = interpolation::lerp(interpolated_acc_vec, brake_index_rev, acc);
 
   return true;
 }
 
 bool BrakeMap::getAcceleration(const double brake, const double vel, double & acc) const
 {
-  std::vector<double> interpolated_acc_vec;
-  const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "brake: vel");
+  const auto compiled_map = getCompiledMap();
+  if (compiled_map->empty()) {
+    return false;
+  }
+  const auto & vel_index = compiled_map->getRowIndex();
+  const auto & brake_index = compiled_map->getColumnIndex();
+  const double clamped_vel = CSVLoader::clampValue(vel, vel_index, "brake: vel");
 
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (const auto & acc_vec : brake_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, acc_vec, clamped_vel));
-  }
+  const std::vector<double> interpolated_acc_vec = compiled_map->interpolateAtRow(clamped_vel);
 
   // calculate brake
   // When the desired acceleration is smaller than the brake area, return min acc
   // When the desired acceleration is greater than the brake area, return min acc
-  const double clamped_brake = CSVLoader::clampValue(brake, brake_index_, "brake: acc");
-  acc = interpolation::lerp(brake_index_, interpolated_acc_vec, clamped_brake);
+  const double clamped_brake = CSVLoader::clampValue(brake, brake_index, "brake: acc");
+  acc = interpolation::lerp(brake_index, interpolated_acc_vec, clamped_brake);
 
   return true;
 }
@@ -0,0 +1,132 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "raw_vehicle_cmd_converter/compiled_map.hpp"
+
+#include "interpolation/linear_interpolation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace raw_vehicle_cmd_converter
+{
+namespace
+{
+// NOTE: The grid is limited so that a map with a tiny segment does not allocate a huge table. The
+//       segment search walks over the segments in a cell in that case, which is still correct.
+constexpr size_t max_grid_cells_num = 4096;
+
+double lerp(const double src_val, const double dst_val, const double ratio)
+{
+  return src_val + (dst_val - src_val) * ratio;
+}
+
+// the same segment as interpolation::lerp, i.e. the first one whose end is not less than the key
+size_t findSegment(const std::vector<double> & keys, const double key)
+{
+  const auto itr = std::lower_bound(keys.begin() + 1, keys.end() - 1, key);
+  return static_cast<size_t>(std::distance(keys.begin() + 1, itr));
+}
+}  // namespace
+
+CompiledMap::CompiledMap(
+  const std::vector<double> & row_index, const std::vector<double> & column_index,
+  const Map & map)
+: row_index_(row_index), column_index_(column_index), map_(map)
+{
+  if (empty() || map_.size() != column_index_.size()) {
+    return;
+  }
+  for (size_t i = 0; i + 1 < row_index_.size(); ++i) {
+    if (!(row_index_.at(i) < row_index_.at(i + 1))) {
+      return;
+    }
+  }
+  for (const auto & values : map_) {
+    if (values.size() != row_index_.size()) {
+      return;
+    }
+  }
+
+  const size_t columns_num = column_index_.size();
+  values_.resize(row_index_.size() * columns_num);
+  for (size_t j = 0; j < columns_num; ++j) {
+    for (size_t i = 0; i < row_index_.size(); ++i) {
+      values_.at(i * columns_num + j) = map_.at(j).at(i);
+    }
+  }
+
+  const double range = row_index_.back() - row_index_.front();
+  double min_segment_length = range;
+  for (size_t i = 0; i + 1 < row_index_.size(); ++i) {
+    min_segment_length = std::min(min_segment_length, row_index_.at(i + 1) - row_index_.at(i));
+  }
+  const size_t cells_num = static_cast<size_t>(std::min(
+    static_cast<double>(max_grid_cells_num), std::ceil(range / min_segment_length) + 1.0));
+  grid_inverse_cell_size_ = static_cast<double>(cells_num) / range;
+  grid_segments_.resize(cells_num);
+  for (size_t c = 0; c < cells_num; ++c) {
+    grid_segments_.at(c) =
+      findSegment(row_index_, row_index_.front() + static_cast<double>(c) / grid_inverse_cell_size_);
+  }
+}
+
+size_t CompiledMap::findRowSegment(const double row_value) const
+{
+  if (grid_segments_.empty()) {
+    return findSegment(row_index_, row_value);
+  }
+
+  const double cell = std::floor((row_value - row_index_.front()) * grid_inverse_cell_size_);
+  const size_t max_cell = grid_segments_.size() - 1;
+  size_t segment = grid_segments_.at(
+    cell < 0.0 ? 0 : std::min(max_cell, static_cast<size_t>(cell)));
+  // NOTE: The cell of the value may differ from the exact one by the rounding error, so the
+  //       segment is corrected in both directions. This takes at most a few steps.
+  while (segment + 2 < row_index_.size() && row_index_.at(segment + 1) < row_value) {
+    ++segment;
+  }
+  while (segment > 0 && !(row_index_.at(segment) < row_value)) {
+    --segment;
+  }
+  return segment;
+}
+
+std::vector<double> CompiledMap::interpolateAtRow(const double row_value) const
+{
+  const size_t columns_num = column_index_.size();
+  std::vector<double> interpolated_values(columns_num);
+  if (values_.empty()) {
+    // NOTE: interpolation::lerp rejects the invalid map with the same exception as before
+    for (size_t j = 0; j < map_.size() && j < columns_num; ++j) {
+      interpolated_values.at(j) = interpolation::lerp(row_index_, map_.at(j), row_value);
+    }
+    return interpolated_values;
+  }
+
+  const double clamped_value = std::clamp(row_value, row_index_.front(), row_index_.back());
+  const size_t segment = findRowSegment(clamped_value);
+  const double ratio = (clamped_value - row_index_.at(segment)) /
+                       (row_index_.at(segment + 1) - row_index_.at(segment));
+
+  const double * src_values = values_.data() + segment * columns_num;
+  const double * dst_values = src_values + columns_num;
+  double * out = interpolated_values.data();
+  for (size_t j = 0; j < columns_num; ++j) {
+    out[j] = lerp(src_values[j], dst_values[j], ratio);
+  }
+  return interpolated_values;
+}
+}  // namespace raw_vehicle_cmd_converter
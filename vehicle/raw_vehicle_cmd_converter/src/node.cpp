@@ -85,6 +85,9 @@ RawVehicleCommandConverterNode::RawVehicleCommandConverterNode(
   debug_pub_steer_pid_ = create_publisher<Float32MultiArrayStamped>(
     "/vehicle/raw_vehicle_cmd_converter/debug/steer_pid", 1);
 
+  set_param_res_ = add_on_set_parameters_callback(
+    std::bind(&RawVehicleCommandConverterNode::onParameter, this, _1));
+
   logger_configure_ = std::make_unique<tier4_autoware_utils::LoggerLevelConfigure>(this);
 }
 
@@ -216,6 +219,58 @@ void RawVehicleCommandConverterNode::onVelocity(const Odometry::ConstSharedPtr m
   current_twist_ptr_->twist = msg->twist.twist;
 }
 
+rcl_interfaces::msg::SetParametersResult RawVehicleCommandConverterNode::onParameter(
+  const std::vector<rclcpp::Parameter> & parameters)
+{
+  rcl_interfaces::msg::SetParametersResult result;
+  result.successful = true;
+  result.reason = "success";
+
+  std::string csv_path_accel_map;
+  std::string csv_path_brake_map;
+  std::string csv_path_steer_map;
+  for (const auto & parameter : parameters) {
+    if (parameter.get_name() == "csv_path_accel_map") {
+      csv_path_accel_map = parameter.as_string();
+    } else if (parameter.get_name() == "csv_path_brake_map") {
+      csv_path_brake_map = parameter.as_string();
+    } else if (parameter.get_name() == "csv_path_steer_map") {
+      csv_path_steer_map = parameter.as_string();
+    }
+  }
+
+  // NOTE: All the maps are validated before any of them is replaced, so that the parameters are
+  //       applied all or nothing. The replacement is atomic and does not stop the conversion.
+  if (
+    !csv_path_accel_map.empty() && !AccelMap{}.readAccelMapFromCSV(csv_path_accel_map, true)) {
+    result.successful = false;
+    result.reason = "Accel map is invalid.";
+  } else if (
+    !csv_path_brake_map.empty() && !BrakeMap{}.readBrakeMapFromCSV(csv_path_brake_map, true)) {
+    result.successful = false;
+    result.reason = "Brake map is invalid.";
+  } else if (
+    !csv_path_steer_map.empty() && !SteerMap{}.readSteerMapFromCSV(csv_path_steer_map, true)) {
+    result.successful = false;
+    result.reason = "Steer map is invalid.";
+  }
+  if (!result.successful) {
+    RCLCPP_WARN(get_logger(), "Reject the parameters: %s", result.reason.c_str());
+    return result;
+  }
+
+  if (!csv_path_accel_map.empty()) {
+    accel_map_.readAccelMapFromCSV(csv_path_accel_map, true);
+  }
+  if (!csv_path_brake_map.empty()) {
+    brake_map_.readBrakeMapFromCSV(csv_path_brake_map, true);
+  }
+  if (!csv_path_steer_map.empty()) {
+    steer_map_.readSteerMapFromCSV(csv_path_steer_map, true);
+  }
+  return result;
+}
+
 void RawVehicleCommandConverterNode::onControlCmd(const AckermannControlCommand::ConstSharedPtr msg)
 {
   control_cmd_ptr_ = msg;
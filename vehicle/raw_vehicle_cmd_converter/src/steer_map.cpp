@@ -16,6 +16,7 @@
 
 #include "interpolation/linear_interpolation.hpp"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -31,26 +32,35 @@ bool SteerMap::readSteerMapFromCSV(const std::string & csv_path, const bool vali
     return false;
   }
 
-  vehicle_name_ = table[0][0];
-  steer_index_ = CSVLoader::getRowIndex(table);
-  output_index_ = CSVLoader::getColumnIndex(table);
-  steer_map_ = CSVLoader::getMap(table);
-  if (validation && !CSVLoader::validateMap(steer_map_, true)) {
+  const auto steer_map = CSVLoader::getMap(table);
+  if (validation && !CSVLoader::validateMap(steer_map, true)) {
     return false;
   }
+  vehicle_name_ = table[0][0];
+  std::atomic_store(
+    &compiled_map_, std::make_shared<const CompiledMap>(
+                      CSVLoader::getRowIndex(table), CSVLoader::getColumnIndex(table), steer_map));
   return true;
 }
 
+std::shared_ptr<const CompiledMap> SteerMap::getCompiledMap() const
+{
+  return std::atomic_load(&compiled_map_);
+}
+
 void SteerMap::getSteer(const double steer_rate, const double steer, double & output) const
 {
-  const double clamped_steer = CSVLoader::clampValue(steer, steer_index_, "steer: steer");
-  std::vector<double> steer_rate_interp = {};
-  for (const auto & steer_rate_vec : steer_map_) {
-    steer_rate_interp.push_back(interpolation::lerp(steer_index_, steer_rate_vec, clamped_steer));
+  const auto compiled_map = getCompiledMap();
+  if (compiled_map->empty()) {
+    return;
   }
+  const double clamped_steer =
+    CSVLoader::clampValue(steer, compiled_map->getRowIndex(), "steer: steer");
+  const std::vector<double> steer_rate_interp = compiled_map->interpolateAtRow(clamped_steer);
 
   const double clamped_steer_rate =
     CSVLoader::clampValue(steer_rate, steer_rate_interp, "steer: steer_rate");
-  output = interpolation::lerp(steer_rate_interp, output_index_, clamped_steer_rate);
+  output =
+    interpolation::lerp(steer_rate_interp, compiled_map->getColumnIndex(), clamped_steer_rate);
 }
 }  // namespace raw_vehicle_cmd_converter
@@ -15,12 +15,16 @@
 #include "ament_index_cpp/get_package_share_directory.hpp"
 #include "gtest/gtest.h"
 #include "raw_vehicle_cmd_converter/accel_map.hpp"
+#include "interpolation/linear_interpolation.hpp"
 #include "raw_vehicle_cmd_converter/brake_map.hpp"
+#include "raw_vehicle_cmd_converter/compiled_map.hpp"
 #include "raw_vehicle_cmd_converter/pid.hpp"
 #include "raw_vehicle_cmd_converter/steer_map.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
+#include <vector>
 
 /*
  * Throttle data: (vel, throttle -> acc)
@@ -50,6 +54,7 @@
 
 using raw_vehicle_cmd_converter::AccelMap;
 using raw_vehicle_cmd_converter::BrakeMap;
+using raw_vehicle_cmd_converter::CompiledMap;
 using raw_vehicle_cmd_converter::PIDController;
 using raw_vehicle_cmd_converter::SteerMap;
 double epsilon = 1e-4;
@@ -230,6 +235,68 @@ TEST(ConverterTests, SteerMapCalculation)
   EXPECT_DOUBLE_EQ(calcSteer(5.0, 5.0), 5.0);
 }
 
+TEST(ConverterTests, CompiledMapInterpolation)
+{
+  // the row index with the segments of different widths
+  const std::vector<double> vel_index{0.0, 0.3, 1.39, 2.78, 5.56, 8.0, 8.1, 11.1, 13.89};
+  const std::vector<double> throttle_index{0.0, 0.1, 0.2, 0.5};
+  std::vector<std::vector<double>> accel_map;
+  for (size_t j = 0; j < throttle_index.size(); ++j) {
+    std::vector<double> accelerations;
+    for (size_t i = 0; i < vel_index.size(); ++i) {
+      accelerations.push_back(std::sin(0.7 * i + 1.3 * j) + static_cast<double>(j));
+    }
+    accel_map.push_back(accelerations);
+  }
+  const CompiledMap compiled_map(vel_index, throttle_index, accel_map);
+  ASSERT_FALSE(compiled_map.empty());
+
+  // same as interpolation::lerp on each column, including the knots and out of the range
+  std::vector<double> vel_samples{-1.0, 20.0};
+  vel_samples.insert(vel_samples.end(), vel_index.begin(), vel_index.end());
+  for (double vel = -0.5; vel < 15.0; vel += 0.013) {
+    vel_samples.push_back(vel);
+  }
+  for (const double vel : vel_samples) {
+    const auto interpolated_acc_vec = compiled_map.interpolateAtRow(vel);
+    ASSERT_EQ(interpolated_acc_vec.size(), throttle_index.size());
+    const double clamped_vel = std::clamp(vel, vel_index.front(), vel_index.back());
+    for (size_t j = 0; j < throttle_index.size(); ++j) {
+      EXPECT_DOUBLE_EQ(
+        interpolated_acc_vec.at(j), interpolation::lerp(vel_index, accel_map.at(j), clamped_vel));
+    }
+  }
+
+  // the map which interpolation::lerp rejects is rejected as well
+  const CompiledMap not_increasing_map({0.0, 0.0, 1.0}, {0.0}, {{0.0, 1.0, 2.0}});
+  EXPECT_THROW(not_increasing_map.interpolateAtRow(0.5), std::invalid_argument);
+}
+
+TEST(ConverterTests, KeepMapOnInvalidReload)
+{
+  AccelMap accel_map;
+  ASSERT_TRUE(loadAccelMapData(accel_map));
+  const auto compiled_accel_map = accel_map.getCompiledMap();
+
+  // the map in use is kept when the new one is invalid
+  EXPECT_FALSE(accel_map.readAccelMapFromCSV(map_path + "test_not_interpolatable.csv", true));
+  EXPECT_FALSE(accel_map.readAccelMapFromCSV("invalid.csv", true));
+  EXPECT_EQ(accel_map.getCompiledMap(), compiled_accel_map);
+  double throttle = 0.0;
+  EXPECT_TRUE(accel_map.getThrottle(0.5, 5.0, throttle));
+  EXPECT_DOUBLE_EQ(throttle, 0.5);
+
+  // the map is replaced by the valid one, while the snapshot taken before is still usable
+  EXPECT_TRUE(accel_map.readAccelMapFromCSV(map_path + "test_accel_map.csv", true));
+  EXPECT_NE(accel_map.getCompiledMap(), compiled_accel_map);
+  EXPECT_EQ(compiled_accel_map->getColumnIndex(), accel_map.getThrottleIdx());
+
+  // no conversion without the map
+  EXPECT_FALSE(AccelMap{}.getThrottle(0.5, 5.0, throttle));
+  EXPECT_FALSE(BrakeMap{}.getAcceleration(0.5, 5.0, throttle));
+  EXPECT_TRUE(AccelMap{}.getVelIdx().empty());
+}
+
 TEST(PIDTests, calculateFB)
 {
   PIDController steer_pid;